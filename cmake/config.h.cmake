@@ -34,12 +34,15 @@
 #cmakedefine HAVE_OPEN_MEMSTREAM 1
 #cmakedefine HAVE_STRDUP 1
 #cmakedefine HAVE_STRLCPY 1
+#cmakedefine HAVE_COPY_FILE_RANGE 1
+#cmakedefine HAVE_SYNC_FILE_RANGE 1
 
 #cmakedefine HAVE_ERR_H 1
 #cmakedefine HAVE_GETOPT_H 1
 #cmakedefine HAVE_INTTYPES_H 1
 #cmakedefine HAVE_LIBGEN_H 1
 #cmakedefine HAVE_LIMITS_H 1
+#cmakedefine HAVE_LINUX_IO_URING_H 1
 #cmakedefine PATH_MAX @PATH_MAX@
 #cmakedefine NAME_MAX @NAME_MAX@
 #cmakedefine LINE_MAX @LINE_MAX@
@@ -90,6 +93,7 @@
 
 
 #cmakedefine ENABLE_SYSTEMTAP 1
+#cmakedefine ENABLE_HOTPATH_STATS 1
 
 #include "system.h"
 #include "version.h"
@@ -84,11 +84,51 @@ pthread_mutex_t area_List_lock = PTHREAD_MUTEX_INITIALIZER;
  */
 #define VOLATILE_ACCESS(v,t)		(*((t volatile *) &(v)))
 
+#if defined (SERVER_MODE)
+/*
+ * Per-thread magazines - each thread keeps a few free entries of every area, so most alloc/free pairs do not touch
+ * the shared block bitmaps. A magazine is refilled from or drained to the blocks half at a time. Entries in magazines
+ * are still marked as used in the block bitmaps.
+ */
+#define AREA_MAGAZINE_SIZE 32
+#define AREA_MAGAZINE_MAX_AREAS 32
+
+typedef struct area_magazine AREA_MAGAZINE;
+struct area_magazine
+{
+  int count;
+  char *entries[AREA_MAGAZINE_SIZE];
+};
+
+// *INDENT-OFF*
+/* magazines of a thread; the entries left are returned to their areas when thread exits */
+class area_magazine_cache
+{
+  public:
+    ~area_magazine_cache ();
+
+    AREA_MAGAZINE magazines[AREA_MAGAZINE_MAX_AREAS];
+};
+
+static thread_local area_magazine_cache area_Tl_magazines;
+// *INDENT-ON*
+
+/* areas owning each magazine index, NULL once destroyed. indexes are never reused. protected by area_List_lock. */
+static AREA *area_Magazine_owners[AREA_MAGAZINE_MAX_AREAS];
+static int area_Magazine_count = 0;
+#endif /* SERVER_MODE */
+
 static void area_info (AREA * area, FILE * fp);
 static AREA_BLOCK *area_alloc_block (AREA * area);
 static AREA_BLOCKSET_LIST *area_alloc_blockset (AREA * area);
 static int area_insert_block (AREA * area, AREA_BLOCK * new_block);
 static AREA_BLOCK *area_find_block (AREA * area, const void *ptr);
+static char *area_alloc_entry (AREA * area);
+static void area_free_entry (AREA * area, AREA_BLOCK * block, int entry_idx);
+#if defined (SERVER_MODE)
+static void area_magazine_refill (AREA * area, AREA_MAGAZINE * magazine);
+static void area_magazine_drain (AREA * area, AREA_MAGAZINE * magazine, int count);
+#endif /* SERVER_MODE */
 
 /*
  * area_init - Initialize the area manager
@@ -123,6 +163,12 @@ area_final (void)
   for (area = area_List, next = NULL; area != NULL; area = next)
     {
       next = area->next;
+#if defined (SERVER_MODE)
+      if (area->magazine_id >= 0)
+	{
+	  area_Magazine_owners[area->magazine_id] = NULL;
+	}
+#endif /* SERVER_MODE */
       area_flush (area);
       free_and_init (area);
     }
@@ -217,6 +263,20 @@ area_create (const char *name, size_t element_size, size_t alloc_count)
   rv = pthread_mutex_lock (&area_List_lock);
   area->next = area_List;
   area_List = area;
+#if defined (SERVER_MODE)
+  if (area_Magazine_count < AREA_MAGAZINE_MAX_AREAS)
+    {
+      area->magazine_id = area_Magazine_count++;
+      area_Magazine_owners[area->magazine_id] = area;
+    }
+  else
+    {
+      /* too many areas; this one is used without magazines */
+      area->magazine_id = -1;
+    }
+#else
+  area->magazine_id = -1;
+#endif /* SERVER_MODE */
   pthread_mutex_unlock (&area_List_lock);
 
   return area;
@@ -271,6 +331,13 @@ area_destroy (AREA * area)
 	  prev->next = a->next;
 	}
     }
+#if defined (SERVER_MODE)
+  if (area->magazine_id >= 0)
+    {
+      /* entries left in magazines of other threads are freed with the blocks */
+      area_Magazine_owners[area->magazine_id] = NULL;
+    }
+#endif /* SERVER_MODE */
 
   pthread_mutex_unlock (&area_List_lock);
 
@@ -352,12 +419,71 @@ area_alloc_blockset (AREA * area)
  *   return: pointer to the element allocated
  *   area(in):
  *
- * Note: The element will be taken from the area's free list,
+ * Note: The element will be taken from the thread magazine or from the area blocks,
  *       otherwise a new block will be allocated and the element
  *       taken from there
  */
 void *
 area_alloc (AREA * area)
+{
+  char *entry_ptr;
+#if !defined (NDEBUG)
+  int *prefix;
+#endif /* !NDEBUG */
+
+  assert (area != NULL);
+
+#if defined (SERVER_MODE)
+  if (area->magazine_id >= 0)
+    {
+      AREA_MAGAZINE *magazine = &area_Tl_magazines.magazines[area->magazine_id];
+
+      if (magazine->count == 0)
+	{
+	  area_magazine_refill (area, magazine);
+	  if (magazine->count == 0)
+	    {
+	      /* error has been set */
+	      return NULL;
+	    }
+	}
+      entry_ptr = magazine->entries[--magazine->count];
+    }
+  else
+#endif /* SERVER_MODE */
+    {
+      entry_ptr = area_alloc_entry (area);
+      if (entry_ptr == NULL)
+	{
+	  /* error has been set */
+	  return NULL;
+	}
+    }
+
+#if defined(SERVER_MODE)
+  /* do not count in SERVER_MODE */
+  /* ATOMIC_INC_32 (&area->n_allocs, 1); */
+#else
+  area->n_allocs++;
+#endif
+
+#if !defined (NDEBUG)
+  prefix = (int *) entry_ptr;
+  *prefix = AREA_PREFIX_INITED;
+
+  entry_ptr += AREA_PREFIX_SIZE;
+#endif /* !NDEBUG */
+
+  return ((void *) entry_ptr);
+}
+
+/*
+ * area_alloc_entry - Allocate a new element from the area blocks
+ *   return: pointer to the element allocated, without prefix
+ *   area(in):
+ */
+static char *
+area_alloc_entry (AREA * area)
 {
   AREA_BLOCKSET_LIST *blockset;
   AREA_BLOCK *block, *hint_block;
@@ -366,11 +492,6 @@ area_alloc (AREA * area)
 #if defined(SERVER_MODE)
   int rv;
 #endif /* SERVER_MODE */
-#if !defined (NDEBUG)
-  int *prefix;
-#endif /* !NDEBUG */
-
-  assert (area != NULL);
 
   /* Step 1: find a free entry from the hint block */
   hint_block = VOLATILE_ACCESS (area->hint_block, AREA_BLOCK *);
@@ -451,25 +572,11 @@ area_alloc (AREA * area)
 
 found:
 
-#if defined(SERVER_MODE)
-  /* do not count in SERVER_MODE */
-  /* ATOMIC_INC_32 (&area->n_allocs, 1); */
-#else
-  area->n_allocs++;
-#endif
-
   entry_ptr = block->data + area->element_size * entry_idx;
 
-#if !defined (NDEBUG)
-  prefix = (int *) entry_ptr;
-  *prefix = AREA_PREFIX_INITED;
-
-  entry_ptr += AREA_PREFIX_SIZE;
-#endif /* !NDEBUG */
-
   assert (entry_ptr < (block->data + area->block_size));
 
-  return ((void *) entry_ptr);
+  return entry_ptr;
 }
 
 /*
@@ -513,7 +620,7 @@ area_validate (AREA * area, const void *address)
 int
 area_free (AREA * area, void *ptr)
 {
-  AREA_BLOCK *block, *hint_block;
+  AREA_BLOCK *block;
   char *entry_ptr;
   int entry_idx;
   int offset = -1;
@@ -567,13 +674,21 @@ area_free (AREA * area, void *ptr)
 
   assert (entry_idx >= 0 && entry_idx < (int) area->alloc_count);
 
-  block->bitmap.free_entry (entry_idx);
+#if defined (SERVER_MODE)
+  if (area->magazine_id >= 0)
+    {
+      AREA_MAGAZINE *magazine = &area_Tl_magazines.magazines[area->magazine_id];
 
-  /* change hint block if needed */
-  hint_block = VOLATILE_ACCESS (area->hint_block, AREA_BLOCK *);
-  if (LF_BITMAP_IS_FULL (&hint_block->bitmap) && !LF_BITMAP_IS_FULL (&block->bitmap))
+      if (magazine->count == AREA_MAGAZINE_SIZE)
+	{
+	  area_magazine_drain (area, magazine, AREA_MAGAZINE_SIZE / 2);
+	}
+      magazine->entries[magazine->count++] = entry_ptr;
+    }
+  else
+#endif /* SERVER_MODE */
     {
-      ATOMIC_CAS_ADDR (&area->hint_block, hint_block, block);
+      area_free_entry (area, block, entry_idx);
     }
 
 #if defined(SERVER_MODE)
@@ -586,6 +701,117 @@ area_free (AREA * area, void *ptr)
   return NO_ERROR;
 }
 
+/*
+ * area_free_entry - Free an element to its block
+ *   return: none
+ *   area(in): AREA
+ *   block(in): block of the element
+ *   entry_idx(in): element index in block
+ */
+static void
+area_free_entry (AREA * area, AREA_BLOCK * block, int entry_idx)
+{
+  AREA_BLOCK *hint_block;
+
+  block->bitmap.free_entry (entry_idx);
+
+  /* change hint block if needed */
+  hint_block = VOLATILE_ACCESS (area->hint_block, AREA_BLOCK *);
+  if (LF_BITMAP_IS_FULL (&hint_block->bitmap) && !LF_BITMAP_IS_FULL (&block->bitmap))
+    {
+      ATOMIC_CAS_ADDR (&area->hint_block, hint_block, block);
+    }
+}
+
+#if defined (SERVER_MODE)
+/*
+ * area_magazine_refill - Fill half of an empty magazine from the area blocks
+ *   return: none, magazine stays empty if no element could be allocated (error is set)
+ *   area(in): AREA
+ *   magazine(in/out): thread magazine of area
+ */
+static void
+area_magazine_refill (AREA * area, AREA_MAGAZINE * magazine)
+{
+  char *entry_ptr;
+
+  assert (magazine->count == 0);
+
+  while (magazine->count < AREA_MAGAZINE_SIZE / 2)
+    {
+      entry_ptr = area_alloc_entry (area);
+      if (entry_ptr == NULL)
+	{
+	  if (magazine->count > 0)
+	    {
+	      /* use what we have */
+	      er_clear ();
+	    }
+	  return;
+	}
+      magazine->entries[magazine->count++] = entry_ptr;
+    }
+}
+
+/*
+ * area_magazine_drain - Return elements of a magazine to the area blocks
+ *   return: none
+ *   area(in): AREA
+ *   magazine(in/out): thread magazine of area
+ *   count(in): number of elements to return
+ */
+static void
+area_magazine_drain (AREA * area, AREA_MAGAZINE * magazine, int count)
+{
+  AREA_BLOCK *block;
+  char *entry_ptr;
+
+  assert (count <= magazine->count);
+
+  while (count-- > 0)
+    {
+      entry_ptr = magazine->entries[--magazine->count];
+
+      /* entries were validated when freed */
+      block = area_find_block (area, entry_ptr);
+      assert (block != NULL);
+      area_free_entry (area, block, (int) ((entry_ptr - block->data) / area->element_size));
+    }
+}
+
+// *INDENT-OFF*
+area_magazine_cache::~area_magazine_cache ()
+{
+  bool is_empty = true;
+  int rv;
+
+  for (int magazine_id = 0; magazine_id < AREA_MAGAZINE_MAX_AREAS; magazine_id++)
+    {
+      if (magazines[magazine_id].count > 0)
+	{
+	  is_empty = false;
+	  break;
+	}
+    }
+  if (is_empty)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&area_List_lock);
+  for (int magazine_id = 0; magazine_id < area_Magazine_count; magazine_id++)
+    {
+      if (magazines[magazine_id].count > 0 && area_Magazine_owners[magazine_id] != NULL)
+	{
+	  area_magazine_drain (area_Magazine_owners[magazine_id], &magazines[magazine_id],
+			       magazines[magazine_id].count);
+	}
+    }
+  pthread_mutex_unlock (&area_List_lock);
+}
+// *INDENT-ON*
+#endif /* SERVER_MODE */
+
 /*
  * area_flush - Free all storage allocated for an area
  *   return: none
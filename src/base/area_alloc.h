@@ -83,6 +83,7 @@ struct area
   AREA_BLOCKSET_LIST *blockset_list;	/* the blockset list */
   AREA_BLOCK *hint_block;	/* the hint block which may include free slot */
   pthread_mutex_t area_mutex;	/* only used for insert new block */
+  int magazine_id;		/* index of per-thread magazines, -1 if area has none */
 
   /* for dumping */
   size_t n_allocs;		/* total alloc element count */
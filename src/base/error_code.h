@@ -1621,8 +1621,15 @@
 #define ER_TDE_RESTORE_CHANGE_MASTER_KEY            -1261
 #define ER_TDE_MAX_KEY_FILE                         -1262
 #define ER_TDE_ENCRYPTION_LOGPAGE_ERORR_AND_OFF_TDE -1263
-
-#define ER_LAST_ERROR                               -1264
+#define ER_TDE_DATA_KEY_ROTATION_IN_PROGRESS        -1264
+#define ER_TDE_CIPHER_ENGINE_LOAD_FAIL              -1265
+#define ER_IO_URING_SETUP_FAIL                      -1266
+#define ER_NET_REQUEST_NOT_PIPELINED                -1267
+#define ER_LDR_INVALID_BINARY_OBJECT_FILE           -1268
+#define ER_FILE_TRAN_TEMP_QUOTA_EXCEEDED            -1269
+#define ER_LOG_RECOVERY_STATS                       -1270
+
+#define ER_LAST_ERROR                               -1271
 
 /*
  * CAUTION!
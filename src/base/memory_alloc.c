@@ -269,12 +269,11 @@ db_ostk_alloc (HL_HEAPID heap_id, size_t size)
   return ptr;
 }
 
-#if defined (ENABLE_UNUSED_FUNCTION)
 /*
  * db_ostk_free () - call free function for the ostk heap
  *   return:
  *   heap_id(in): memory heap identifier
- *   ptr(in): memory pointer to free
+ *   ptr(in): memory pointer to free; it and everything allocated after it is freed
  */
 void
 db_ostk_free (HL_HEAPID heap_id, void *ptr)
@@ -284,7 +283,6 @@ db_ostk_free (HL_HEAPID heap_id, void *ptr)
       hl_ostk_free (heap_id, ptr);
     }
 }
-#endif /* ENABLE_UNUSED_FUNCTION */
 
 /*
  * db_create_private_heap () - create a thread specific heap
@@ -973,6 +971,85 @@ db_private_set_heapid_to_thread (THREAD_ENTRY * thread_p, HL_HEAPID heap_id)
 
   return old_heap_id;
 }
+
+/*
+ * db_request_alloc () - allocate memory that is released when the current request is finished
+ *   return: allocated memory pointer
+ *   thread_p(in): thread entry
+ *   size(in): size to allocate
+ *
+ * Note: the memory is taken by bumping a pointer in an obstack of the thread; it cannot be freed or reallocated and it
+ *       must not be kept after the request. The obstack is rewound to its first chunk at the end of every request.
+ */
+void *
+db_request_alloc (THREAD_ENTRY * thread_p, size_t size)
+{
+  void *ptr;
+
+  assert (size > 0);
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  if (thread_p->request_heap_id == 0)
+    {
+      thread_p->request_heap_id = db_create_ostk_heap (DEFAULT_OBSTACK_CHUNK_SIZE);
+      if (thread_p->request_heap_id == 0)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) DEFAULT_OBSTACK_CHUNK_SIZE);
+	  return NULL;
+	}
+    }
+
+  ptr = db_ostk_alloc (thread_p->request_heap_id, size);
+  if (ptr == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return NULL;
+    }
+
+  if (thread_p->request_heap_base == NULL)
+    {
+      /* the heap is rewound to the first allocation of the request */
+      thread_p->request_heap_base = ptr;
+    }
+
+  return ptr;
+}
+
+/*
+ * db_request_heap_release () - release all memory allocated by db_request_alloc during the request
+ *   return:
+ *   thread_p(in): thread entry
+ */
+void
+db_request_heap_release (THREAD_ENTRY * thread_p)
+{
+  if (thread_p->request_heap_base != NULL)
+    {
+      /* frees the chunks added during the request; the first one is kept for the next request */
+      db_ostk_free (thread_p->request_heap_id, thread_p->request_heap_base);
+      thread_p->request_heap_base = NULL;
+    }
+}
+
+/*
+ * db_request_heap_destroy () - destroy the request heap of thread
+ *   return:
+ *   thread_p(in): thread entry
+ */
+void
+db_request_heap_destroy (THREAD_ENTRY * thread_p)
+{
+  if (thread_p->request_heap_id != 0)
+    {
+      db_destroy_ostk_heap (thread_p->request_heap_id);
+      thread_p->request_heap_id = 0;
+      thread_p->request_heap_base = NULL;
+    }
+}
 #endif // SERVER_MODE
 
 #endif
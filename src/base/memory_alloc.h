@@ -213,9 +213,7 @@ extern HL_HEAPID db_create_ostk_heap (int chunk_size);
 extern void db_destroy_ostk_heap (HL_HEAPID heap_id);
 
 extern void *db_ostk_alloc (HL_HEAPID heap_id, size_t size);
-#if defined(ENABLE_UNUSED_FUNCTION)
 extern void db_ostk_free (HL_HEAPID heap_id, void *ptr);
-#endif
 
 extern HL_HEAPID db_create_private_heap (void);
 extern void db_clear_private_heap (THREAD_ENTRY * thread_p, HL_HEAPID heap_id);
@@ -282,6 +280,11 @@ extern void *db_private_realloc_external (THREAD_ENTRY * thrd, void *ptr, size_t
 
 #if defined (SERVER_MODE)
 extern HL_HEAPID db_private_set_heapid_to_thread (THREAD_ENTRY * thread_p, HL_HEAPID heap_id);
+
+/* memory of the current client request; not freed one by one, but all at once when the request is finished */
+extern void *db_request_alloc (THREAD_ENTRY * thread_p, size_t size);
+extern void db_request_heap_release (THREAD_ENTRY * thread_p);
+extern void db_request_heap_destroy (THREAD_ENTRY * thread_p);
 #endif // SERVER_MODE
 
 extern HL_HEAPID db_create_fixed_heap (int req_size, int recs_per_chunk);
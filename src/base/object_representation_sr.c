@@ -278,6 +278,9 @@ orc_diskrep_from_record (THREAD_ENTRY * thread_p, RECDES * record)
       or_att->default_value.value = NULL;
       att->classoid = or_att->classoid;
 
+      /* the value statistics are not gathered yet */
+      att->value_stats.null_ppm = -1;
+
       /* initialize B+tree statistics information */
 
       n_btstats = att->n_btstats = or_att->n_btids;
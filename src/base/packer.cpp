@@ -61,11 +61,15 @@ namespace cubpacking
   //
 
   packer::packer (void)
+    : m_reference_min_size (0)
+    , m_references ()
   {
     // all pointers are initialized to NULL
   }
 
   packer::packer (char *storage, const size_t amount)
+    : m_reference_min_size (0)
+    , m_references ()
   {
     set_buffer (storage, amount);
   }
@@ -76,6 +80,7 @@ namespace cubpacking
     m_start_ptr = storage;
     m_ptr = storage;
     m_end_ptr = m_start_ptr + amount;
+    m_references.clear ();
   }
 
   unpacker::unpacker (const char *storage, const size_t amount)
@@ -530,7 +535,7 @@ namespace cubpacking
   {
     size_t entry_size;
 
-    entry_size = OR_INT_SIZE + str.size ();
+    entry_size = OR_INT_SIZE + get_packed_data_size (str.size ());
 
     return DB_ALIGN (curr_offset + entry_size, INT_ALIGNMENT) - curr_offset;
   }
@@ -550,13 +555,12 @@ namespace cubpacking
       }
 
     align (INT_ALIGNMENT);
-    check_range (m_ptr, m_end_ptr, len + OR_INT_SIZE);
+    check_range (m_ptr, m_end_ptr, get_packed_data_size (len) + OR_INT_SIZE);
 
     OR_PUT_INT (m_ptr, len);
     m_ptr += OR_INT_SIZE;
 
-    std::memcpy (m_ptr, string, len);
-    m_ptr += len;
+    pack_data (string, len);
 
     align (INT_ALIGNMENT);
   }
@@ -657,7 +661,7 @@ namespace cubpacking
       }
     else
       {
-	entry_size = DB_ALIGN (OR_BYTE_SIZE, INT_ALIGNMENT) + OR_INT_SIZE + str_size;
+	entry_size = DB_ALIGN (OR_BYTE_SIZE, INT_ALIGNMENT) + OR_INT_SIZE + get_packed_data_size (str_size);
       }
 
     return DB_ALIGN (curr_offset + entry_size, INT_ALIGNMENT) - curr_offset;
@@ -672,7 +676,7 @@ namespace cubpacking
       }
     else
       {
-	check_range (m_ptr, m_end_ptr, str_size + 1 + OR_INT_SIZE);
+	check_range (m_ptr, m_end_ptr, get_packed_data_size (str_size) + 1 + OR_INT_SIZE);
 
 	OR_PUT_BYTE (m_ptr, LARGE_STRING_CODE);
 	m_ptr++;
@@ -854,7 +858,7 @@ namespace cubpacking
 
     if (stream != NULL)
       {
-	actual_length = length;
+	actual_length = get_packed_data_size (length);
       }
 
     size_t entry_size = OR_INT_SIZE + actual_length;
@@ -867,15 +871,14 @@ namespace cubpacking
   {
     align (INT_ALIGNMENT);
 
-    check_range (m_ptr, m_end_ptr, length + OR_INT_SIZE);
+    check_range (m_ptr, m_end_ptr, get_packed_data_size (length) + OR_INT_SIZE);
 
     OR_PUT_INT (m_ptr, length);
     m_ptr += OR_INT_SIZE;
 
     if (length > 0)
       {
-	std::memcpy (m_ptr, stream, length);
-	m_ptr += length;
+	pack_data (stream, length);
 
 	align (INT_ALIGNMENT);
       }
@@ -962,6 +965,68 @@ namespace cubpacking
     return get_curr_ptr () == get_buffer_end ();
   }
 
+  void
+  packer::set_reference_min_size (const std::size_t min_size)
+  {
+    m_reference_min_size = min_size;
+  }
+
+  void
+  packer::get_segments (std::vector<packed_segment> &segments) const
+  {
+    const char *own_ptr = m_start_ptr;
+
+    segments.clear ();
+    for (const reference &ref : m_references)
+      {
+	const char *ref_pos = m_start_ptr + ref.m_offset;
+
+	if (ref_pos > own_ptr)
+	  {
+	    segments.push_back ({ own_ptr, (std::size_t) (ref_pos - own_ptr) });
+	  }
+	segments.push_back ({ ref.m_ptr, ref.m_size });
+	own_ptr = ref_pos + get_packed_data_size (ref.m_size);
+      }
+    if (m_ptr > own_ptr)
+      {
+	segments.push_back ({ own_ptr, (std::size_t) (m_ptr - own_ptr) });
+      }
+  }
+
+  bool
+  packer::is_referenced (const std::size_t size) const
+  {
+    return m_reference_min_size > 0 && size >= m_reference_min_size;
+  }
+
+  std::size_t
+  packer::get_packed_data_size (const std::size_t size) const
+  {
+    if (is_referenced (size))
+      {
+	// referenced data is not in buffer, but the next offsets keep their alignment
+	return size % MAX_ALIGNMENT;
+      }
+    return size;
+  }
+
+  void
+  packer::pack_data (const char *data, const std::size_t size)
+  {
+    if (is_referenced (size))
+      {
+	// offsets are kept, segments can be used after buffer is extended
+	m_references.push_back ({ (std::size_t) (m_ptr - m_start_ptr), data, size });
+	m_ptr += get_packed_data_size (size);
+      }
+    else
+      {
+	std::memcpy (m_ptr, data, size);
+	m_ptr += size;
+      }
+  }
+
   void
   unpacker::delegate_to_or_buf (const size_t size, or_buf &buf)
   {
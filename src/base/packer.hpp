@@ -39,6 +39,16 @@ namespace cubpacking
   class packable_object;
 };
 
+namespace cubpacking
+{
+  // a piece of the packed data; see packer::set_reference_min_size
+  struct packed_segment
+  {
+    const char *m_ptr;
+    std::size_t m_size;
+  };
+};
+
 /*
  * the packer object packs primitive objects from a buffer and unpacker unpacks same objects from the buffer.
  * the packer & unpacker implementations should be mirrored.
@@ -124,6 +134,16 @@ namespace cubpacking
       std::size_t get_packed_buffer_size (const char *stream, const std::size_t length, const std::size_t curr_offset) const;
       void pack_buffer_with_length (const char *stream, const std::size_t length);
 
+      // scatter-gather packing
+      //
+      // large strings and buffers of at least min_size bytes are referenced instead of being copied to the packer
+      // buffer, which is then smaller. the packed data is made of the segments, in order, and it is the same as the
+      // data packed without references. referenced memory must not change until segments are sent.
+      //
+      // must be set before computing packed sizes; zero (default) never references.
+      void set_reference_min_size (const std::size_t min_size);
+      void get_segments (std::vector<packed_segment> &segments) const;
+
       // template function to pack object as int type
       template <typename T>
       void pack_to_int (const T &t);
@@ -161,8 +181,20 @@ namespace cubpacking
       void append_to_buffer_and_pack_all (ExtBlk &eb, Args &&... args);
 
     private:
+      // a buffer referenced at an offset of packer buffer
+      struct reference
+      {
+	std::size_t m_offset;
+	const char *m_ptr;
+	std::size_t m_size;
+      };
+
       void pack_large_c_string (const char *string, const size_t str_size);
 
+      bool is_referenced (const std::size_t size) const;
+      std::size_t get_packed_data_size (const std::size_t size) const;
+      void pack_data (const char *data, const std::size_t size);
+
       template <typename T, typename ... Args>
       size_t get_all_packed_size_recursive (size_t curr_offset, T &&t, Args &&... args);
       template <typename T>
@@ -176,6 +208,9 @@ namespace cubpacking
       const char *m_start_ptr; /* start of buffer */
       const char *m_end_ptr;     /* end of available serialization scope */
       char *m_ptr;
+
+      std::size_t m_reference_min_size;   /* zero if nothing is referenced */
+      std::vector<reference> m_references;
   };
 
   class unpacker
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * perf_hotpath.cpp - implementation of the server hot paths profiling
+ */
+
+#include "perf_hotpath.hpp"
+
+#include "perf.hpp"
+#include "perf_monitor.h"
+#include "tsc_timer.h"
+
+#include <atomic>
+
+namespace cubperf
+{
+  static const statset_definition Hotpath_statdef =
+  {
+    stat_definition (PERF_HOTPATH_PGBUF_FIX, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_pgbuf_fix", "Time_hotpath_pgbuf_fix"),
+    stat_definition (PERF_HOTPATH_PGBUF_UNFIX, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_pgbuf_unfix", "Time_hotpath_pgbuf_unfix"),
+    stat_definition (PERF_HOTPATH_SPAGE_INSERT, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_spage_insert", "Time_hotpath_spage_insert"),
+    stat_definition (PERF_HOTPATH_BTREE_SEARCH, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_btree_search", "Time_hotpath_btree_search"),
+    stat_definition (PERF_HOTPATH_HEAP_NEXT, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_heap_next", "Time_hotpath_heap_next"),
+    stat_definition (PERF_HOTPATH_LOG_APPEND, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_log_append", "Time_hotpath_log_append"),
+    stat_definition (PERF_HOTPATH_PRIOR_FLUSH, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_prior_flush", "Time_hotpath_prior_flush"),
+    stat_definition (PERF_HOTPATH_LOCK_OBJECT, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_lock_object", "Time_hotpath_lock_object"),
+    stat_definition (PERF_HOTPATH_TDE_ENCRYPT, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_tde_encrypt", "Time_hotpath_tde_encrypt"),
+    stat_definition (PERF_HOTPATH_TDE_DECRYPT, stat_definition::COUNTER_AND_TIMER,
+		     "Num_hotpath_tde_decrypt", "Time_hotpath_tde_decrypt")
+  };
+
+  // one set per perfmon shard; timers hold ticks until they are read
+  static std::atomic<atomic_statset *> Hotpath_shards[PERFMON_SHARD_COUNT];
+
+  static atomic_statset &
+  hotpath_get_shard (std::size_t shard_index)
+  {
+    atomic_statset *shard = Hotpath_shards[shard_index].load ();
+
+    if (shard == NULL)
+      {
+	atomic_statset *new_shard = Hotpath_statdef.create_atomic_statset ();
+
+	// first user of the shard creates it; others keep the winner
+	if (Hotpath_shards[shard_index].compare_exchange_strong (shard, new_shard))
+	  {
+	    shard = new_shard;
+	  }
+	else
+	  {
+	    delete new_shard;
+	  }
+      }
+    return *shard;
+  }
+
+  void
+  hotpath_add (PERF_HOTPATH_ID path, std::uint64_t ticks)
+  {
+    static thread_local int shard_index = -1;
+
+    assert (path >= 0 && path < PERF_HOTPATH_COUNT);
+
+    if (shard_index < 0)
+      {
+	shard_index = perfmon_get_next_shard_index ();
+      }
+    Hotpath_statdef.time_and_increment (hotpath_get_shard ((std::size_t) shard_index), path, duration (ticks));
+  }
+
+  std::size_t
+  hotpath_get_value_count (void)
+  {
+    return Hotpath_statdef.get_value_count ();
+  }
+
+  const char *
+  hotpath_get_value_name (std::size_t value_index)
+  {
+    return Hotpath_statdef.get_value_name (value_index);
+  }
+
+  void
+  hotpath_get_stat_values (std::uint64_t *output_stats)
+  {
+    std::size_t value_count = Hotpath_statdef.get_value_count ();
+
+    for (std::size_t index = 0; index < value_count; index++)
+      {
+	output_stats[index] = 0;
+      }
+
+    // fold shards; timers are still in ticks
+    for (std::size_t shard_index = 0; shard_index < PERFMON_SHARD_COUNT; shard_index++)
+      {
+	atomic_statset *shard = Hotpath_shards[shard_index].load ();
+	if (shard != NULL)
+	  {
+	    Hotpath_statdef.add_stat_values (*shard, output_stats);
+	  }
+      }
+
+    // each path has its counter followed by its timer
+    for (std::size_t index = 1; index < value_count; index += 2)
+      {
+	output_stats[index] = tsc_ticks_to_nsec (output_stats[index]) / 1000;
+      }
+  }
+} // namespace cubperf
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * perf_hotpath.hpp - interface for profiling the server hot paths
+ */
+
+#ifndef _PERF_HOTPATH_HPP_
+#define _PERF_HOTPATH_HPP_
+
+#include "config.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined (SERVER_MODE) && defined (ENABLE_HOTPATH_STATS)
+#include "tsc_timer.h"
+#endif // SERVER_MODE && ENABLE_HOTPATH_STATS
+
+// hot path profiling
+//
+//  description:
+//
+//    counts and times the calls of the server hot paths, continuously and with no sampling. each profiled function
+//    declares a PERF_HOTPATH_SCOPE at its start; the scope reads the time stamp counter when it is created and when
+//    it is destroyed, and adds the elapsed ticks to the counter and timer of the path.
+//
+//    values are accumulated in a cubperf statistics set per perfmon shard, so concurrent threads rarely touch the
+//    same cache line. ticks are converted to microseconds only when statistics are read, and they are exported in
+//    statdump as "Num_hotpath_<path>" and "Time_hotpath_<path>".
+//
+//    the hooks are built only with ENABLE_HOTPATH_STATS cmake option; otherwise PERF_HOTPATH_SCOPE expands to nothing
+//    and the exported values stay zero.
+//
+//  usage:
+//
+//    int
+//    spage_insert (...)
+//    {
+//      PERF_HOTPATH_SCOPE (PERF_HOTPATH_SPAGE_INSERT);
+//      ...
+//    }
+//
+
+// NOTE - perfmon_Portable_hotpath_stat_names must match the paths
+enum PERF_HOTPATH_ID
+{
+  PERF_HOTPATH_PGBUF_FIX = 0,
+  PERF_HOTPATH_PGBUF_UNFIX,
+  PERF_HOTPATH_SPAGE_INSERT,
+  PERF_HOTPATH_BTREE_SEARCH,
+  PERF_HOTPATH_HEAP_NEXT,
+  PERF_HOTPATH_LOG_APPEND,
+  PERF_HOTPATH_PRIOR_FLUSH,
+  PERF_HOTPATH_LOCK_OBJECT,
+  PERF_HOTPATH_TDE_ENCRYPT,
+  PERF_HOTPATH_TDE_DECRYPT,
+
+  PERF_HOTPATH_COUNT
+};
+
+#if defined (SERVER_MODE)
+namespace cubperf
+{
+  // add a call of path with elapsed ticks (as returned by tsc_elapsed_ticks)
+  void hotpath_add (PERF_HOTPATH_ID path, std::uint64_t ticks);
+
+  // statistics values are counters and timers in microseconds, in the order of paths
+  std::size_t hotpath_get_value_count (void);
+  const char *hotpath_get_value_name (std::size_t value_index);
+  void hotpath_get_stat_values (std::uint64_t *output_stats);
+
+#if defined (ENABLE_HOTPATH_STATS)
+  // scoped timer of a hot path call
+  class hotpath_scope
+  {
+    public:
+      hotpath_scope (PERF_HOTPATH_ID path)
+	: m_path (path)
+      {
+	tsc_getticks (&m_start);
+      }
+
+      ~hotpath_scope ()
+      {
+	TSC_TICKS end;
+
+	tsc_getticks (&end);
+	hotpath_add (m_path, tsc_elapsed_ticks (end, m_start));
+      }
+
+      hotpath_scope (const hotpath_scope &other) = delete;
+      hotpath_scope &operator= (const hotpath_scope &other) = delete;
+
+    private:
+      PERF_HOTPATH_ID m_path;
+      TSC_TICKS m_start;
+  };
+#endif // ENABLE_HOTPATH_STATS
+} // namespace cubperf
+#endif // SERVER_MODE
+
+#if defined (SERVER_MODE) && defined (ENABLE_HOTPATH_STATS)
+#define PERF_HOTPATH_SCOPE_NAME_CONCAT(name, line) name ## line
+#define PERF_HOTPATH_SCOPE_NAME(line) PERF_HOTPATH_SCOPE_NAME_CONCAT (perf_hotpath_scope_, line)
+#define PERF_HOTPATH_SCOPE(path) cubperf::hotpath_scope PERF_HOTPATH_SCOPE_NAME (__LINE__) (path)
+#else // !SERVER_MODE || !ENABLE_HOTPATH_STATS
+#define PERF_HOTPATH_SCOPE(path)
+#endif // !SERVER_MODE || !ENABLE_HOTPATH_STATS
+
+#endif // _PERF_HOTPATH_HPP_
@@ -42,6 +42,7 @@
 #include "thread_worker_pool.hpp"
 #if defined (SERVER_MODE)
 #include "thread_daemon.hpp"
+#include "perf_hotpath.hpp"
 #endif // SERVER_MODE
 #if defined (SERVER_MODE) || defined (SA_MODE)
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info
@@ -80,6 +81,9 @@
 #include "vacuum.h"
 #include "xasl_cache.h"
 #include "load_worker_manager.hpp"
+#include "page_zcache.h"
+#include "show_scan.h"
+#include "dbtype.h"
 
 #if defined (SERVER_MODE)
 #include "connection_error.h"
@@ -111,6 +115,8 @@ static int rv;
   { id, name, PSTAT_COMPLEX_VALUE, 0, 0, f_dump_in_file, f_dump_in_buffer, f_load }
 
 #define PERFMON_VALUES_MEMSIZE (pstat_Global.n_stat_values * sizeof (UINT64))
+/* Statistic values in a cache line; each shard is rounded up to it. */
+#define PERFMON_SHARD_LINE_VALUES (64 / sizeof (UINT64))
 
 static int f_load_Num_data_page_fix_ext (void);
 static int f_load_Num_data_page_promote_ext (void);
@@ -129,6 +135,9 @@ static int f_load_Time_get_oldest_mvcc_acquire_time (void);
 static int f_load_Count_get_oldest_mvcc_retry (void);
 static int f_load_thread_stats (void);
 static int f_load_thread_daemon_stats (void);
+static int f_load_Num_obj_lock_wait_histogram (void);
+static int f_load_Num_data_page_latch_wait_histogram (void);
+static int f_load_hotpath_stats (void);
 
 static void f_dump_in_file_Num_data_page_fix_ext (FILE *, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_data_page_promote_ext (FILE *, const UINT64 * stat_vals);
@@ -142,6 +151,9 @@ static void f_dump_in_file_Time_obj_lock_acquire_time (FILE *, const UINT64 * st
 static void f_dump_in_file_thread_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_thread_daemon_stats (FILE * f, const UINT64 * stat_vals);
 static void f_dump_in_file_Num_dwb_flushed_block_volumes (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_Num_obj_lock_wait_histogram (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_Num_data_page_latch_wait_histogram (FILE *, const UINT64 * stat_vals);
+static void f_dump_in_file_hotpath_stats (FILE *, const UINT64 * stat_vals);
 
 static void f_dump_in_buffer_Num_data_page_fix_ext (char **, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_data_page_promote_ext (char **, const UINT64 * stat_vals, int *remaining_size);
@@ -155,6 +167,10 @@ static void f_dump_in_buffer_Time_obj_lock_acquire_time (char **, const UINT64 *
 static void f_dump_in_buffer_thread_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_thread_daemon_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 static void f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_vals, int *remaining_size);
+static void f_dump_in_buffer_Num_obj_lock_wait_histogram (char **s, const UINT64 * stat_vals, int *remaining_size);
+static void f_dump_in_buffer_Num_data_page_latch_wait_histogram (char **s, const UINT64 * stat_vals,
+								 int *remaining_size);
+static void f_dump_in_buffer_hotpath_stats (char **s, const UINT64 * stat_vals, int *remaining_size);
 
 static void perfmon_stat_dump_in_file_fix_page_array_stat (FILE *, const UINT64 * stats_ptr);
 static void perfmon_stat_dump_in_file_promote_page_array_stat (FILE *, const UINT64 * stats_ptr);
@@ -198,6 +214,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_IOREADS, "Num_file_ioreads"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_IOWRITES, "Num_file_iowrites"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_IOSYNCHES, "Num_file_iosynches"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_IO_URING_SUBMITS, "Num_file_io_uring_submits"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_IOWRITEVS, "Num_file_iowritevs"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_FILE_IOSYNC_ALL, "file_iosync_all"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_PAGE_ALLOCS, "Num_file_page_allocs"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FILE_NUM_PAGE_DEALLOCS, "Num_file_page_deallocs"),
@@ -208,6 +226,12 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_DIRTIES, "Num_data_page_dirties"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_IOREADS, "Num_data_page_ioreads"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_IOWRITES, "Num_data_page_iowrites"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_ATOMIC_IOWRITES, "Num_data_page_atomic_iowrites"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_ZCACHE_HITS, "Num_data_page_compressed_cache_hits"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_ZCACHE_MISSES, "Num_data_page_compressed_cache_misses"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_ZCACHE_STORES, "Num_data_page_compressed_cache_stores"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_ZCACHE_TEMP_STORES, "Num_data_page_compressed_cache_temp_stores"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_ZCACHE_WRITE_BACKS, "Num_data_page_compressed_cache_write_backs"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_FLUSHED, "Num_data_page_flushed"),
   /* peeked stats */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_PRIVATE_QUOTA, "Num_data_page_private_quota"),
@@ -230,6 +254,8 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_WALS, "Num_log_wals"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_REPLACEMENTS_IOWRITES, "Num_log_page_iowrites_for_replacement"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_NUM_REPLACEMENTS, "Num_log_page_replacements"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_GROUP_COMMIT_FLUSHES, "Num_log_group_commit_flushes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_GROUP_COMMIT_BATCHED, "Num_log_group_commit_batched_commits"),
 
   /* Execution statistics for the lock manager */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LK_NUM_ACQUIRED_ON_PAGES, "Num_page_locks_acquired"),
@@ -258,6 +284,9 @@ PSTAT_METADATA pstat_Metadata[] = {
 
   /* Execution statistics for the btree manager */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_INSERTS, "Num_btree_inserts"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_INSERT_LEAF_HINTS, "Num_btree_insert_leaf_hints"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_UNIQUE_FILTER_SKIPS, "Num_btree_unique_filter_skips"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_ROOT_COPY_SEARCHES, "Num_btree_root_copy_searches"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_DELETES, "Num_btree_deletes"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_UPDATES, "Num_btree_updates"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_BT_NUM_COVERED, "Num_btree_covered"),
@@ -322,13 +351,19 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_FULL, "Num_plan_cache_full"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_DELETE, "Num_plan_cache_delete"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_INVALID_XASL_ID, "Num_plan_cache_invalid_xasl_id"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PC_NUM_CLONE_MISS, "Num_plan_cache_clone_miss"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_PC_UNPACK_XASL, "plan_cache_unpack_xasl"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PC_NUM_CACHE_ENTRIES, "Num_plan_cache_entries"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FPC_NUM_CLONE_HIT, "Num_filter_pred_cache_clone_hit"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_FPC_NUM_CLONE_MISS, "Num_filter_pred_cache_clone_miss"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_FPC_UNPACK_PRED, "filter_pred_cache_unpack_pred"),
 
   /* Vacuum process log section. */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_VACUUMED_LOG_PAGES, "Num_vacuum_log_pages_vacuumed"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES, "Num_vacuum_log_pages_to_vacuum"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES, "Num_vacuum_prefetch_requests_log_pages"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES, "Num_vacuum_prefetch_hits_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_VAC_NUM_SKIPPED_INSERT_RECORDS, "Num_vacuum_skipped_insert_records"),
 
   /* Track heap modify counters. */
   /* Make a complex entry for heap stats */
@@ -434,6 +469,7 @@ PSTAT_METADATA pstat_Metadata[] = {
 
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_TIME_COUNTERS, "Time_get_snapshot_acquire_time"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS, "Count_get_snapshot_retry"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_SNAPSHOT_REUSED_COUNTERS, "Count_get_snapshot_reused"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_TRAN_COMPLETE_TIME_COUNTERS, "Time_tran_complete_time"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_OLDEST_MVCC_TIME_COUNTERS, "compute_oldest_visible"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_LOG_OLDEST_MVCC_RETRY_COUNTERS, "Count_get_oldest_mvcc_retry"),
@@ -482,6 +518,11 @@ PSTAT_METADATA pstat_Metadata[] = {
   /* hash anchor */
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_HASH_ANCHOR_WAITS, "Num_data_page_hash_anchor_waits"),
   PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_TIME_HASH_ANCHOR_WAIT, "Time_data_page_hash_anchor_wait"),
+  /* read-ahead */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_READ_AHEAD_REQUESTS, "Num_data_page_read_ahead_requests"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_READ_AHEAD_PAGES, "Num_data_page_read_ahead_pages"),
+  /* warm-up */
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_PB_NUM_WARMUP_PAGES, "Num_data_page_warmup_pages"),
   /* flushing */
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_PB_FLUSH_COLLECT, "flush_collect"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_PB_FLUSH_FLUSH, "flush_flush"),
@@ -553,6 +594,17 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_LZ4_COMPRESS_TIME_COUNTERS, "Log_LZ4_compress"),
   PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_LOG_LZ4_DECOMPRESS_TIME_COUNTERS, "Log_LZ4_decompress"),
 
+  /* TDE statistics */
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_TDE_ENCRYPT_PERM_PAGE_TIME_COUNTERS, "TDE_encrypt_perm_page"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_TDE_DECRYPT_PERM_PAGE_TIME_COUNTERS, "TDE_decrypt_perm_page"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_TDE_ENCRYPT_TEMP_PAGE_TIME_COUNTERS, "TDE_encrypt_temp_page"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_TDE_DECRYPT_TEMP_PAGE_TIME_COUNTERS, "TDE_decrypt_temp_page"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_TDE_ENCRYPT_LOG_PAGE_TIME_COUNTERS, "TDE_encrypt_log_page"),
+  PSTAT_METADATA_INIT_COUNTER_TIMER (PSTAT_TDE_DECRYPT_LOG_PAGE_TIME_COUNTERS, "TDE_decrypt_log_page"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TDE_NUM_ENCRYPTED_BYTES, "Num_tde_encrypted_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TDE_NUM_DECRYPTED_BYTES, "Num_tde_decrypted_bytes"),
+  PSTAT_METADATA_INIT_SINGLE_ACC (PSTAT_TDE_LOG_PAGE_CACHE_HITS, "Num_tde_log_page_cache_hits"),
+
   /* peeked stats */
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_WAIT_THREADS_HIGH_PRIO, "Num_alloc_bcb_wait_threads_high_priority"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_WAIT_THREADS_LOW_PRIO, "Num_alloc_bcb_wait_threads_low_priority"),
@@ -562,6 +614,17 @@ PSTAT_METADATA pstat_Metadata[] = {
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_LFCQ_SHR_NUM, "Num_lfcq_shared_lists"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_AVOID_DEALLOC_CNT, "Num_data_page_avoid_dealloc"),
   PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_AVOID_VICTIM_CNT, "Num_data_page_avoid_victim"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_HUGE_PAGES, "Data_page_buffer_huge_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_LOG_HUGE_PAGES, "Log_page_buffer_huge_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_FILE_ATOMIC_WRITE_VOLUMES, "Num_file_atomic_write_volumes"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_FLUSH_FEEDBACK_BOOST, "Data_page_buffer_flush_feedback_boost"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_PB_ZCACHE_SIZE, "Data_page_compressed_cache_size"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_LOG_GROUP_COMMIT_TARGET_BATCH, "Log_group_commit_target_batch"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_PENDING_BLOCKS, "Num_vacuum_pending_blocks"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_OLDEST_UNVACUUMED_MVCCID, "Vacuum_oldest_unvacuumed_mvccid"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_OLDEST_UNVACUUMED_MVCCID_AGE, "Vacuum_oldest_unvacuumed_mvccid_age"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_KEPT_ARCHIVE_LOG_PAGES, "Num_vacuum_kept_archive_log_pages"),
+  PSTAT_METADATA_INIT_SINGLE_PEEK (PSTAT_VAC_NUM_DROPPED_FILES, "Num_vacuum_dropped_files"),
 
   /* Array type statistics */
   PSTAT_METADATA_INIT_COMPLEX (PSTAT_PBX_FIX_COUNTERS, "Num_data_page_fix_ext", &f_dump_in_file_Num_data_page_fix_ext,
@@ -604,7 +667,16 @@ PSTAT_METADATA pstat_Metadata[] = {
 			       &f_dump_in_buffer_Num_dwb_flushed_block_volumes,
 			       &f_load_Num_dwb_flushed_block_volumes),
   PSTAT_METADATA_INIT_COMPLEX (PSTAT_LOAD_THREAD_STATS, "Thread_loaddb_stats_counters_timers",
-			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats)
+			       &f_dump_in_file_thread_stats, &f_dump_in_buffer_thread_stats, &f_load_thread_stats),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_OBJ_LOCK_WAIT_HISTOGRAM, "Num_obj_lock_wait_histogram",
+			       &f_dump_in_file_Num_obj_lock_wait_histogram,
+			       &f_dump_in_buffer_Num_obj_lock_wait_histogram, &f_load_Num_obj_lock_wait_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_PBX_LATCH_WAIT_HISTOGRAM, "Num_data_page_latch_wait_histogram",
+			       &f_dump_in_file_Num_data_page_latch_wait_histogram,
+			       &f_dump_in_buffer_Num_data_page_latch_wait_histogram,
+			       &f_load_Num_data_page_latch_wait_histogram),
+  PSTAT_METADATA_INIT_COMPLEX (PSTAT_HOTPATH_STATS, "Hotpath_stats_counters_timers", &f_dump_in_file_hotpath_stats,
+			       &f_dump_in_buffer_hotpath_stats, &f_load_hotpath_stats)
 };
 
 STATIC_INLINE void perfmon_add_stat_at_offset (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, const int offset,
@@ -624,9 +696,12 @@ STATIC_INLINE const char *perfmon_stat_promote_cond_name (const int cond_type) _
 STATIC_INLINE const char *perfmon_stat_snapshot_name (const int snapshot) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE const char *perfmon_stat_snapshot_record_type (const int rec_type) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE const char *perfmon_stat_lock_mode_name (const int lock_mode) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE const char *perfmon_stat_lock_resource_name (const int res_type) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE const char *perfmon_stat_wait_time_bucket_name (const int bucket) __attribute__ ((ALWAYS_INLINE));
 static const char *perfmon_stat_thread_stat_name (size_t index);
 
 STATIC_INLINE void perfmon_get_peek_stats (UINT64 * stats) __attribute__ ((ALWAYS_INLINE));
+static void perfmon_fold_shard_stats (UINT64 * stats);
 
 #if defined(CS_MODE) || defined(SA_MODE)
 bool perfmon_Iscollecting_stats = false;
@@ -1002,6 +1077,47 @@ xperfmon_server_copy_stats (THREAD_ENTRY * thread_p, UINT64 * to_stats)
     }
 }
 
+/*
+ * perfmon_fold_shard_stats () - Add the values accumulated in the shards to the statistics.
+ *
+ * return     : Void.
+ * stats (in) : Statistics block with global values.
+ *
+ * NOTE: Shards only have counters and total times added, so their values are summed up.
+ */
+static void
+perfmon_fold_shard_stats (UINT64 * stats)
+{
+#if defined (SERVER_MODE)
+  int shard, offset;
+  const UINT64 *shard_stats;
+
+  for (shard = 0; shard < PERFMON_SHARD_COUNT; shard++)
+    {
+      shard_stats = pstat_Global.shard_stats + (size_t) shard * pstat_Global.shard_stride;
+      for (offset = 0; offset < pstat_Global.n_stat_values; offset++)
+	{
+	  stats[offset] += shard_stats[offset];
+	}
+    }
+#endif /* SERVER_MODE */
+}
+
+#if defined (SERVER_MODE)
+/*
+ * perfmon_get_next_shard_index () - Get the shard index for a thread that accumulates statistics the first time.
+ *
+ * return : Shard index.
+ */
+int
+perfmon_get_next_shard_index (void)
+{
+  static int next_index = 0;
+
+  return (ATOMIC_INC_32 (&next_index, 1) - 1) % PERFMON_SHARD_COUNT;
+}
+#endif /* SERVER_MODE */
+
 /*
  *   xperfmon_server_copy_global_stats - Copy recorded system wide statistics
  *   return: none
@@ -1014,6 +1130,7 @@ xperfmon_server_copy_global_stats (UINT64 * to_stats)
     {
       perfmon_get_peek_stats (pstat_Global.global_stats);
       perfmon_copy_values (to_stats, pstat_Global.global_stats);
+      perfmon_fold_shard_stats (to_stats);
       perfmon_server_calc_stats (to_stats);
     }
 }
@@ -1048,6 +1165,67 @@ perfmon_lk_waited_time_on_objects (THREAD_ENTRY * thread_p, int lock_mode, UINT6
   perfmon_add_stat_at_offset (thread_p, PSTAT_OBJ_LOCK_TIME_COUNTERS, lock_mode, amount);
 }
 
+/*
+ * perfmon_get_wait_time_bucket - get the histogram bucket of a wait time
+ *   return: PERF_WAIT_TIME_BUCKET
+ *   wait_usec(in): wait time in microseconds
+ */
+STATIC_INLINE int
+perfmon_get_wait_time_bucket (UINT64 wait_usec)
+{
+  int bucket = PERF_WAIT_TIME_UNDER_10US;
+  UINT64 limit = 10;
+
+  while (bucket < PERF_WAIT_TIME_OVER_1S && wait_usec >= limit)
+    {
+      bucket++;
+      limit *= 10;
+    }
+
+  return bucket;
+}
+
+/*
+ * perfmon_lk_wait_histogram - count a lock wait in the wait time histogram
+ *   return: none
+ *
+ * Note: the histogram is always collected, it does not depend on the watchers or on the activation flags.
+ */
+void
+perfmon_lk_wait_histogram (THREAD_ENTRY * thread_p, int res_type, int lock_mode, UINT64 wait_usec)
+{
+  int offset;
+
+  assert (pstat_Global.initialized);
+  assert (res_type >= PERF_LOCK_RESOURCE_INSTANCE && res_type < PERF_LOCK_RESOURCE_CNT);
+  assert (lock_mode >= NA_LOCK && lock_mode <= SCH_M_LOCK);
+
+  offset = PERF_LOCK_WAIT_HISTOGRAM_OFFSET (res_type, lock_mode, perfmon_get_wait_time_bucket (wait_usec));
+  assert (offset < PERF_LOCK_WAIT_HISTOGRAM_COUNTERS);
+
+  perfmon_add_stat_at_offset (thread_p, PSTAT_OBJ_LOCK_WAIT_HISTOGRAM, offset, 1);
+}
+
+/*
+ * perfmon_pbx_latch_wait_histogram - count a page latch wait in the wait time histogram
+ *   return: none
+ *
+ * Note: the histogram is always collected, it does not depend on the watchers or on the activation flags.
+ */
+void
+perfmon_pbx_latch_wait_histogram (THREAD_ENTRY * thread_p, int page_type, UINT64 wait_usec)
+{
+  int offset;
+
+  assert (pstat_Global.initialized);
+  assert (page_type >= PERF_PAGE_UNKNOWN && page_type < PERF_PAGE_CNT);
+
+  offset = PERF_LATCH_WAIT_HISTOGRAM_OFFSET (page_type, perfmon_get_wait_time_bucket (wait_usec));
+  assert (offset < PERF_LATCH_WAIT_HISTOGRAM_COUNTERS);
+
+  perfmon_add_stat_at_offset (thread_p, PSTAT_PBX_LATCH_WAIT_HISTOGRAM, offset, 1);
+}
+
 UINT64
 perfmon_get_stats_and_clear (THREAD_ENTRY * thread_p, const char *stat_name)
 {
@@ -1795,11 +1973,29 @@ perfmon_server_calc_stats (UINT64 * stats)
 		    &(stats[pstat_Metadata[PSTAT_PB_LFCQ_BIG_PRV_NUM].start_offset]),
 		    &(stats[pstat_Metadata[PSTAT_PB_LFCQ_PRV_NUM].start_offset]),
 		    &(stats[pstat_Metadata[PSTAT_PB_LFCQ_SHR_NUM].start_offset]));
+  /* 0: regular pages, 1: transparent huge pages, 2: explicit huge pages */
+  stats[pstat_Metadata[PSTAT_PB_HUGE_PAGES].start_offset] = pgbuf_get_huge_pages_type ();
+  stats[pstat_Metadata[PSTAT_LOG_HUGE_PAGES].start_offset] = logpb_get_huge_pages_type ();
+  /* volumes whose pages are written atomically and bypass the double write buffer */
+  stats[pstat_Metadata[PSTAT_FILE_ATOMIC_WRITE_VOLUMES].start_offset] = fileio_get_num_atomic_write_volumes ();
+  /* victim flush boost of the flush feedback controller, in percents */
+  stats[pstat_Metadata[PSTAT_PB_FLUSH_FEEDBACK_BOOST].start_offset] = pgbuf_get_flush_feedback_boost ();
+  /* memory used by the compressed cache of evicted pages */
+  stats[pstat_Metadata[PSTAT_PB_ZCACHE_SIZE].start_offset] = zcache_get_size ();
+  /* commits the adaptive group commit currently batches in one log flush */
+  stats[pstat_Metadata[PSTAT_LOG_GROUP_COMMIT_TARGET_BATCH].start_offset] = logpb_get_group_commit_target_batch ();
+  /* vacuum lag; archives are kept and dropped files are not cleaned up until vacuum catches up */
+  vacuum_peek_stats (&(stats[pstat_Metadata[PSTAT_VAC_NUM_PENDING_BLOCKS].start_offset]),
+		     &(stats[pstat_Metadata[PSTAT_VAC_OLDEST_UNVACUUMED_MVCCID].start_offset]),
+		     &(stats[pstat_Metadata[PSTAT_VAC_OLDEST_UNVACUUMED_MVCCID_AGE].start_offset]),
+		     &(stats[pstat_Metadata[PSTAT_VAC_NUM_KEPT_ARCHIVE_LOG_PAGES].start_offset]),
+		     &(stats[pstat_Metadata[PSTAT_VAC_NUM_DROPPED_FILES].start_offset]));
 
   css_get_thread_stats (&stats[pstat_Metadata[PSTAT_THREAD_STATS].start_offset]);
   perfmon_peek_thread_daemon_stats (stats);
   // *INDENT-OFF*
   cubload::worker_manager_get_stats (&stats[pstat_Metadata[PSTAT_LOAD_THREAD_STATS].start_offset]);
+  cubperf::hotpath_get_stat_values (&stats[pstat_Metadata[PSTAT_HOTPATH_STATS].start_offset]);
   // *INDENT-ON*
 #endif // SERVER_MODE
 
@@ -2067,6 +2263,48 @@ perfmon_stat_lock_mode_name (const int lock_mode)
   return "ERROR";
 }
 
+STATIC_INLINE const char *
+perfmon_stat_lock_resource_name (const int res_type)
+{
+  switch (res_type)
+    {
+    case PERF_LOCK_RESOURCE_INSTANCE:
+      return "INSTANCE";
+    case PERF_LOCK_RESOURCE_CLASS:
+      return "CLASS";
+    case PERF_LOCK_RESOURCE_ROOT_CLASS:
+      return "ROOT_CLASS";
+    default:
+      break;
+    }
+  return "ERROR";
+}
+
+STATIC_INLINE const char *
+perfmon_stat_wait_time_bucket_name (const int bucket)
+{
+  switch (bucket)
+    {
+    case PERF_WAIT_TIME_UNDER_10US:
+      return "<10us";
+    case PERF_WAIT_TIME_UNDER_100US:
+      return "<100us";
+    case PERF_WAIT_TIME_UNDER_1MS:
+      return "<1ms";
+    case PERF_WAIT_TIME_UNDER_10MS:
+      return "<10ms";
+    case PERF_WAIT_TIME_UNDER_100MS:
+      return "<100ms";
+    case PERF_WAIT_TIME_UNDER_1S:
+      return "<1s";
+    case PERF_WAIT_TIME_OVER_1S:
+      return ">=1s";
+    default:
+      break;
+    }
+  return "ERROR";
+}
+
 /*
  * perfmon_stat_cond_type_name () -
  */
@@ -2996,6 +3234,8 @@ perfmon_initialize (int num_trans)
 
   pstat_Global.n_stat_values = 0;
   pstat_Global.global_stats = NULL;
+  pstat_Global.shard_stats = NULL;
+  pstat_Global.shard_stride = 0;
   pstat_Global.n_trans = 0;
   pstat_Global.tran_stats = NULL;
   pstat_Global.is_watching = NULL;
@@ -3067,6 +3307,20 @@ perfmon_initialize (int num_trans)
     }
   memset (pstat_Global.global_stats, 0, PERFMON_VALUES_MEMSIZE);
 
+#if defined (SERVER_MODE)
+  /* Allocate shards, each rounded up to cache line. */
+  pstat_Global.shard_stride = (pstat_Global.n_stat_values + PERFMON_SHARD_LINE_VALUES - 1)
+    / PERFMON_SHARD_LINE_VALUES * PERFMON_SHARD_LINE_VALUES;
+  memsize = PERFMON_SHARD_COUNT * pstat_Global.shard_stride * sizeof (UINT64);
+  pstat_Global.shard_stats = (UINT64 *) malloc (memsize);
+  if (pstat_Global.shard_stats == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, memsize);
+      goto error;
+    }
+  memset (pstat_Global.shard_stats, 0, memsize);
+#endif /* SERVER_MODE */
+
   assert (num_trans > 0);
 
   pstat_Global.n_trans = num_trans + 1;	/* 1 more for easier indexing with tran_index */
@@ -3138,6 +3392,10 @@ perfmon_finalize (void)
     {
       free_and_init (pstat_Global.global_stats);
     }
+  if (pstat_Global.shard_stats != NULL)
+    {
+      free_and_init (pstat_Global.shard_stats);
+    }
 #if defined (SERVER_MODE) || defined (SA_MODE)
 #if !defined (HAVE_ATOMIC_BUILTINS)
   pthread_mutex_destroy (&pstat_Global.watch_lock);
@@ -3327,6 +3585,27 @@ f_load_Time_obj_lock_acquire_time (void)
   return PERF_OBJ_LOCK_STAT_COUNTERS;
 }
 
+/*
+ * f_load_Num_obj_lock_wait_histogram () - Get the number of values for Num_obj_lock_wait_histogram statistic
+ *
+ */
+static int
+f_load_Num_obj_lock_wait_histogram (void)
+{
+  return PERF_LOCK_WAIT_HISTOGRAM_COUNTERS;
+}
+
+/*
+ * f_load_Num_data_page_latch_wait_histogram () - Get the number of values for Num_data_page_latch_wait_histogram
+ *						  statistic
+ *
+ */
+static int
+f_load_Num_data_page_latch_wait_histogram (void)
+{
+  return PERF_LATCH_WAIT_HISTOGRAM_COUNTERS;
+}
+
 /*
  * f_load_Num_dwb_flushed_block_volumes () - Get the number of values for Num_dwb_flushed_block_volumes statistic
  *
@@ -3525,6 +3804,68 @@ f_dump_in_file_Num_dwb_flushed_block_volumes (FILE * f, const UINT64 * stat_vals
     }
 }
 
+/*
+ * f_dump_in_file_Num_obj_lock_wait_histogram () - Write in file the values for Num_obj_lock_wait_histogram
+ *						   statistic
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_Num_obj_lock_wait_histogram (FILE * f, const UINT64 * stat_vals)
+{
+  int res_type, lock_mode, bucket;
+  UINT64 counter;
+
+  for (res_type = PERF_LOCK_RESOURCE_INSTANCE; res_type < PERF_LOCK_RESOURCE_CNT; res_type++)
+    {
+      for (lock_mode = NA_LOCK; lock_mode <= SCH_M_LOCK; lock_mode++)
+	{
+	  for (bucket = PERF_WAIT_TIME_UNDER_10US; bucket < PERF_WAIT_TIME_BUCKET_CNT; bucket++)
+	    {
+	      counter = stat_vals[PERF_LOCK_WAIT_HISTOGRAM_OFFSET (res_type, lock_mode, bucket)];
+	      if (counter == 0)
+		{
+		  continue;
+		}
+
+	      fprintf (f, "%-10s,%-10s,%-6s = %16llu\n", perfmon_stat_lock_resource_name (res_type),
+		       perfmon_stat_lock_mode_name (lock_mode), perfmon_stat_wait_time_bucket_name (bucket),
+		       (long long unsigned int) counter);
+	    }
+	}
+    }
+}
+
+/*
+ * f_dump_in_file_Num_data_page_latch_wait_histogram () - Write in file the values for
+ *							  Num_data_page_latch_wait_histogram statistic
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_Num_data_page_latch_wait_histogram (FILE * f, const UINT64 * stat_vals)
+{
+  int page_type, bucket;
+  UINT64 counter;
+
+  for (page_type = PERF_PAGE_UNKNOWN; page_type < PERF_PAGE_CNT; page_type++)
+    {
+      for (bucket = PERF_WAIT_TIME_UNDER_10US; bucket < PERF_WAIT_TIME_BUCKET_CNT; bucket++)
+	{
+	  counter = stat_vals[PERF_LATCH_WAIT_HISTOGRAM_OFFSET (page_type, bucket)];
+	  if (counter == 0)
+	    {
+	      continue;
+	    }
+
+	  fprintf (f, "%-14s,%-6s = %16llu\n", perfmon_stat_page_type_name (page_type),
+		   perfmon_stat_wait_time_bucket_name (bucket), (long long unsigned int) counter);
+	}
+    }
+}
+
 /*
  * f_dump_in_buffer_Num_data_page_fix_ext () - Write to a buffer the values for Num_data_page_fix_ext
  *					       statistic
@@ -3677,6 +4018,98 @@ f_dump_in_buffer_Num_dwb_flushed_block_volumes (char **s, const UINT64 * stat_va
     }
 }
 
+/*
+ * f_dump_in_buffer_Num_obj_lock_wait_histogram () - Write to a buffer the values for Num_obj_lock_wait_histogram
+ *						     statistic
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_Num_obj_lock_wait_histogram (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  int res_type, lock_mode, bucket;
+  UINT64 counter;
+  int ret;
+
+  assert (remaining_size != NULL);
+  assert (s != NULL);
+  if (*s == NULL)
+    {
+      return;
+    }
+
+  for (res_type = PERF_LOCK_RESOURCE_INSTANCE; res_type < PERF_LOCK_RESOURCE_CNT; res_type++)
+    {
+      for (lock_mode = NA_LOCK; lock_mode <= SCH_M_LOCK; lock_mode++)
+	{
+	  for (bucket = PERF_WAIT_TIME_UNDER_10US; bucket < PERF_WAIT_TIME_BUCKET_CNT; bucket++)
+	    {
+	      counter = stat_vals[PERF_LOCK_WAIT_HISTOGRAM_OFFSET (res_type, lock_mode, bucket)];
+	      if (counter == 0)
+		{
+		  continue;
+		}
+
+	      ret = snprintf (*s, *remaining_size, "%-10s,%-10s,%-6s = %16llu\n",
+			      perfmon_stat_lock_resource_name (res_type), perfmon_stat_lock_mode_name (lock_mode),
+			      perfmon_stat_wait_time_bucket_name (bucket), (long long unsigned int) counter);
+	      *remaining_size -= ret;
+	      *s += ret;
+	      if (*remaining_size <= 0)
+		{
+		  return;
+		}
+	    }
+	}
+    }
+}
+
+/*
+ * f_dump_in_buffer_Num_data_page_latch_wait_histogram () - Write to a buffer the values for
+ *							    Num_data_page_latch_wait_histogram statistic
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_Num_data_page_latch_wait_histogram (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  int page_type, bucket;
+  UINT64 counter;
+  int ret;
+
+  assert (remaining_size != NULL);
+  assert (s != NULL);
+  if (*s == NULL)
+    {
+      return;
+    }
+
+  for (page_type = PERF_PAGE_UNKNOWN; page_type < PERF_PAGE_CNT; page_type++)
+    {
+      for (bucket = PERF_WAIT_TIME_UNDER_10US; bucket < PERF_WAIT_TIME_BUCKET_CNT; bucket++)
+	{
+	  counter = stat_vals[PERF_LATCH_WAIT_HISTOGRAM_OFFSET (page_type, bucket)];
+	  if (counter == 0)
+	    {
+	      continue;
+	    }
+
+	  ret = snprintf (*s, *remaining_size, "%-14s,%-6s = %16llu\n", perfmon_stat_page_type_name (page_type),
+			  perfmon_stat_wait_time_bucket_name (bucket), (long long unsigned int) counter);
+	  *remaining_size -= ret;
+	  *s += ret;
+	  if (*remaining_size <= 0)
+	    {
+	      return;
+	    }
+	}
+    }
+}
+
 /*
  * perfmon_get_number_of_statistic_values () - Get the number of entries in the statistic array
  *
@@ -3875,6 +4308,159 @@ perfmon_print_timer_to_buffer (char **s, int stat_index, UINT64 * stats_ptr, int
   *s += ret;
 }
 
+#if defined (SERVER_MODE) || defined (SA_MODE)
+/*
+ * perfmon_wait_statistics_add_row () - add a histogram row to show wait statistics result
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   ctx(in/out): show statement array context
+ *   wait_type(in): "LOCK" or "LATCH"
+ *   resource(in): lock resource type or page type name
+ *   mode(in): lock mode name, NULL for latch waits
+ *   counters(in): histogram buckets
+ */
+static int
+perfmon_wait_statistics_add_row (THREAD_ENTRY * thread_p, SHOWSTMT_ARRAY_CONTEXT * ctx, const char *wait_type,
+				 const char *resource, const char *mode, const UINT64 * counters)
+{
+  DB_VALUE *vals = NULL;
+  UINT64 total = 0;
+  int bucket;
+  int idx = 0;
+
+  for (bucket = PERF_WAIT_TIME_UNDER_10US; bucket < PERF_WAIT_TIME_BUCKET_CNT; bucket++)
+    {
+      total += counters[bucket];
+    }
+  if (total == 0)
+    {
+      return NO_ERROR;
+    }
+
+  vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+  if (vals == NULL)
+    {
+      return er_errid ();
+    }
+
+  db_make_string (&vals[idx], wait_type);
+  idx++;
+
+  db_make_string (&vals[idx], resource);
+  idx++;
+
+  if (mode != NULL)
+    {
+      db_make_string (&vals[idx], mode);
+    }
+  else
+    {
+      db_make_null (&vals[idx]);
+    }
+  idx++;
+
+  for (bucket = PERF_WAIT_TIME_UNDER_10US; bucket < PERF_WAIT_TIME_BUCKET_CNT; bucket++)
+    {
+      db_make_bigint (&vals[idx], (DB_BIGINT) counters[bucket]);
+      idx++;
+    }
+
+  db_make_bigint (&vals[idx], (DB_BIGINT) total);
+  idx++;
+
+  assert (idx == ctx->num_cols);
+
+  return NO_ERROR;
+}
+
+/*
+ * perfmon_wait_statistics_start_scan () - start scan function for show wait statistics
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   type (in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ *
+ * Note: a row is made for each lock resource type and lock mode, and for each page type, that waited at least once.
+ */
+int
+perfmon_wait_statistics_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt,
+				    void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  const int num_cols = 3 + PERF_WAIT_TIME_BUCKET_CNT + 1;
+  UINT64 *stats = NULL;
+  const UINT64 *lock_stats;
+  const UINT64 *latch_stats;
+  const UINT64 *counters;
+  int res_type, lock_mode, page_type;
+  int error = NO_ERROR;
+
+  *ptr = NULL;
+
+  stats = perfmon_allocate_values ();
+  if (stats == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+  perfmon_copy_values (stats, pstat_Global.global_stats);
+  perfmon_fold_shard_stats (stats);
+  lock_stats = stats + pstat_Metadata[PSTAT_OBJ_LOCK_WAIT_HISTOGRAM].start_offset;
+  latch_stats = stats + pstat_Metadata[PSTAT_PBX_LATCH_WAIT_HISTOGRAM].start_offset;
+
+  ctx = showstmt_alloc_array_context (thread_p, PERF_LOCK_RESOURCE_CNT * PERF_OBJ_LOCK_STAT_COUNTERS + PERF_PAGE_CNT,
+				      num_cols);
+  if (ctx == NULL)
+    {
+      error = er_errid ();
+      goto exit_on_error;
+    }
+
+  for (res_type = PERF_LOCK_RESOURCE_INSTANCE; res_type < PERF_LOCK_RESOURCE_CNT; res_type++)
+    {
+      for (lock_mode = NA_LOCK; lock_mode <= SCH_M_LOCK; lock_mode++)
+	{
+	  counters = lock_stats + PERF_LOCK_WAIT_HISTOGRAM_OFFSET (res_type, lock_mode, 0);
+	  error = perfmon_wait_statistics_add_row (thread_p, ctx, "LOCK", perfmon_stat_lock_resource_name (res_type),
+						   perfmon_stat_lock_mode_name (lock_mode), counters);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+    }
+
+  for (page_type = PERF_PAGE_UNKNOWN; page_type < PERF_PAGE_CNT; page_type++)
+    {
+      counters = latch_stats + PERF_LATCH_WAIT_HISTOGRAM_OFFSET (page_type, 0);
+      error = perfmon_wait_statistics_add_row (thread_p, ctx, "LATCH", perfmon_stat_page_type_name (page_type), NULL,
+					       counters);
+      if (error != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+    }
+
+  free_and_init (stats);
+  *ptr = ctx;
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (ctx != NULL)
+    {
+      showstmt_free_array_context (thread_p, ctx);
+    }
+  free_and_init (stats);
+
+  return error;
+}
+#endif /* SERVER_MODE || SA_MODE */
+
 // *INDENT-OFF*
 //////////////////////////////////////////////////////////////////////////
 // thread workers section
@@ -3911,7 +4497,9 @@ const char *perfmon_Portable_worker_stat_names [] =
     "Counter_recycle_context",
     "Timer_recycle_context",
     "Counter_retire_context",
-    "Timer_retire_context"
+    "Timer_retire_context",
+    "Counter_stolen_task",
+    "Timer_stolen_task"
   };
 static const size_t PERFMON_PORTABLE_WORKER_STAT_COUNT =
   sizeof (perfmon_Portable_worker_stat_names) / sizeof (const char *);
@@ -4244,6 +4832,97 @@ perfmon_peek_thread_daemon_stats (UINT64 * stats)
 }
 #endif // SERVER_MODE
 
+//////////////////////////////////////////////////////////////////////////
+// Hot paths section
+//////////////////////////////////////////////////////////////////////////
+
+// NOTE - should match cubperf::Hotpath_statdef
+static const char *perfmon_Portable_hotpath_stat_names[] =
+{
+  "Num_hotpath_pgbuf_fix", "Time_hotpath_pgbuf_fix",
+  "Num_hotpath_pgbuf_unfix", "Time_hotpath_pgbuf_unfix",
+  "Num_hotpath_spage_insert", "Time_hotpath_spage_insert",
+  "Num_hotpath_btree_search", "Time_hotpath_btree_search",
+  "Num_hotpath_heap_next", "Time_hotpath_heap_next",
+  "Num_hotpath_log_append", "Time_hotpath_log_append",
+  "Num_hotpath_prior_flush", "Time_hotpath_prior_flush",
+  "Num_hotpath_lock_object", "Time_hotpath_lock_object",
+  "Num_hotpath_tde_encrypt", "Time_hotpath_tde_encrypt",
+  "Num_hotpath_tde_decrypt", "Time_hotpath_tde_decrypt"
+};
+static const size_t PERFMON_PORTABLE_HOTPATH_STAT_COUNT =
+  sizeof (perfmon_Portable_hotpath_stat_names) / sizeof (const char *);
+
+static int
+f_load_hotpath_stats (void)
+{
+#if defined (SERVER_MODE)
+  assert (PERFMON_PORTABLE_HOTPATH_STAT_COUNT == cubperf::hotpath_get_value_count ());
+  for (size_t index = 0; index < PERFMON_PORTABLE_HOTPATH_STAT_COUNT; index++)
+    {
+      assert (std::strcmp (perfmon_Portable_hotpath_stat_names[index], cubperf::hotpath_get_value_name (index)) == 0);
+    }
+#endif // SERVER_MODE
+  return (int) PERFMON_PORTABLE_HOTPATH_STAT_COUNT;
+}
+
+/*
+ * f_dump_in_file_hotpath_stats () - Write in file the values of the hot paths that were profiled
+ *
+ * f (out): File handle
+ * stat_vals (in): statistics buffer
+ *
+ */
+static void
+f_dump_in_file_hotpath_stats (FILE * f, const UINT64 * stat_vals)
+{
+  assert (f != NULL);
+
+  /* values stay zero unless server is built with hot path profiling */
+  for (size_t it = 0; it < PERFMON_PORTABLE_HOTPATH_STAT_COUNT; it++)
+    {
+      if (stat_vals[it] == 0)
+	{
+	  continue;
+	}
+      fprintf (f, "%-29s = %16llu\n", perfmon_Portable_hotpath_stat_names[it], (long long unsigned int) stat_vals[it]);
+    }
+}
+
+/*
+ * f_dump_in_buffer_hotpath_stats () - Write to a buffer the values of the hot paths that were profiled
+ *
+ * s (out): Buffer to write to
+ * stat_vals (in): statistics buffer
+ * remaining_size (in): size of input buffer
+ *
+ */
+static void
+f_dump_in_buffer_hotpath_stats (char **s, const UINT64 * stat_vals, int *remaining_size)
+{
+  int ret;
+
+  assert (s != NULL);
+  assert (remaining_size != NULL);
+
+  for (size_t it = 0; it < PERFMON_PORTABLE_HOTPATH_STAT_COUNT; it++)
+    {
+      if (stat_vals[it] == 0)
+	{
+	  continue;
+	}
+      ret = snprintf (*s, *remaining_size, "%-29s = %16llu\n", perfmon_Portable_hotpath_stat_names[it],
+		      (long long unsigned int) stat_vals[it]);
+
+      *remaining_size -= ret;
+      *s += ret;
+      if (*remaining_size <= 0)
+	{
+	  return;
+	}
+    }
+}
+
 #if defined (SERVER_MODE) || defined (SA_MODE)
 void
 perfmon_er_log_current_stats (THREAD_ENTRY * thread_p)
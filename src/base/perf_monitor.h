@@ -130,6 +130,19 @@ typedef enum
    + (rec_type) * PERF_SNAPSHOT_VISIBILITY_CNT + (visibility))
 
 #define PERF_OBJ_LOCK_STAT_COUNTERS (SCH_M_LOCK + 1)
+
+/* PERF_LOCK_RESOURCE_TYPE x LOCK x PERF_WAIT_TIME_BUCKET */
+#define PERF_LOCK_WAIT_HISTOGRAM_COUNTERS \
+  (PERF_LOCK_RESOURCE_CNT * PERF_OBJ_LOCK_STAT_COUNTERS * PERF_WAIT_TIME_BUCKET_CNT)
+
+#define PERF_LOCK_WAIT_HISTOGRAM_OFFSET(res_type,lock_mode,bucket) \
+  ((res_type) * PERF_OBJ_LOCK_STAT_COUNTERS * PERF_WAIT_TIME_BUCKET_CNT \
+   + (lock_mode) * PERF_WAIT_TIME_BUCKET_CNT + (bucket))
+
+/* PERF_PAGE_TYPE x PERF_WAIT_TIME_BUCKET */
+#define PERF_LATCH_WAIT_HISTOGRAM_COUNTERS (PERF_PAGE_CNT * PERF_WAIT_TIME_BUCKET_CNT)
+
+#define PERF_LATCH_WAIT_HISTOGRAM_OFFSET(page_type,bucket) ((page_type) * PERF_WAIT_TIME_BUCKET_CNT + (bucket))
 #define PERF_DWB_FLUSHED_BLOCK_VOLUMES_CNT 10
 
 #define SAFE_DIV(a, b) ((b) == 0 ? 0 : (a) / (b))
@@ -265,6 +278,30 @@ typedef enum
   PERF_SNAPSHOT_VISIBILITY_CNT
 } PERF_SNAPSHOT_VISIBILITY;
 
+/* extension of LOCK_RESOURCE_TYPE (lock_manager.h) - keep value compatibility */
+typedef enum
+{
+  PERF_LOCK_RESOURCE_INSTANCE = 0,
+  PERF_LOCK_RESOURCE_CLASS,
+  PERF_LOCK_RESOURCE_ROOT_CLASS,
+
+  PERF_LOCK_RESOURCE_CNT
+} PERF_LOCK_RESOURCE_TYPE;
+
+/* buckets of the wait time histograms, in microseconds */
+typedef enum
+{
+  PERF_WAIT_TIME_UNDER_10US = 0,
+  PERF_WAIT_TIME_UNDER_100US,
+  PERF_WAIT_TIME_UNDER_1MS,
+  PERF_WAIT_TIME_UNDER_10MS,
+  PERF_WAIT_TIME_UNDER_100MS,
+  PERF_WAIT_TIME_UNDER_1S,
+  PERF_WAIT_TIME_OVER_1S,
+
+  PERF_WAIT_TIME_BUCKET_CNT
+} PERF_WAIT_TIME_BUCKET;
+
 typedef enum
 {
   PSTAT_BASE = -1,		/* not a real entry. just to avoid compile warnings */
@@ -275,6 +312,8 @@ typedef enum
   PSTAT_FILE_NUM_IOREADS,
   PSTAT_FILE_NUM_IOWRITES,
   PSTAT_FILE_NUM_IOSYNCHES,
+  PSTAT_FILE_NUM_IO_URING_SUBMITS,
+  PSTAT_FILE_NUM_IOWRITEVS,
   PSTAT_FILE_IOSYNC_ALL,
   PSTAT_FILE_NUM_PAGE_ALLOCS,
   PSTAT_FILE_NUM_PAGE_DEALLOCS,
@@ -285,6 +324,12 @@ typedef enum
   PSTAT_PB_NUM_DIRTIES,
   PSTAT_PB_NUM_IOREADS,
   PSTAT_PB_NUM_IOWRITES,
+  PSTAT_PB_NUM_ATOMIC_IOWRITES,
+  PSTAT_PB_ZCACHE_HITS,
+  PSTAT_PB_ZCACHE_MISSES,
+  PSTAT_PB_ZCACHE_STORES,
+  PSTAT_PB_ZCACHE_TEMP_STORES,
+  PSTAT_PB_ZCACHE_WRITE_BACKS,
   PSTAT_PB_NUM_FLUSHED,
   /* peeked stats */
   PSTAT_PB_PRIVATE_QUOTA,
@@ -307,6 +352,8 @@ typedef enum
   PSTAT_LOG_NUM_WALS,
   PSTAT_LOG_NUM_REPLACEMENTS_IOWRITES,
   PSTAT_LOG_NUM_REPLACEMENTS,
+  PSTAT_LOG_GROUP_COMMIT_FLUSHES,
+  PSTAT_LOG_GROUP_COMMIT_BATCHED,
 
   /* Execution statistics for the lock manager */
   PSTAT_LK_NUM_ACQUIRED_ON_PAGES,
@@ -334,6 +381,9 @@ typedef enum
 
   /* Execution statistics for the btree manager */
   PSTAT_BT_NUM_INSERTS,
+  PSTAT_BT_NUM_INSERT_LEAF_HINTS,
+  PSTAT_BT_NUM_UNIQUE_FILTER_SKIPS,
+  PSTAT_BT_NUM_ROOT_COPY_SEARCHES,
   PSTAT_BT_NUM_DELETES,
   PSTAT_BT_NUM_UPDATES,
   PSTAT_BT_NUM_COVERED,
@@ -397,12 +447,18 @@ typedef enum
   PSTAT_PC_NUM_FULL,
   PSTAT_PC_NUM_DELETE,
   PSTAT_PC_NUM_INVALID_XASL_ID,
+  PSTAT_PC_NUM_CLONE_MISS,
+  PSTAT_PC_UNPACK_XASL,
   PSTAT_PC_NUM_CACHE_ENTRIES,
+  PSTAT_FPC_NUM_CLONE_HIT,
+  PSTAT_FPC_NUM_CLONE_MISS,
+  PSTAT_FPC_UNPACK_PRED,
 
   PSTAT_VAC_NUM_VACUUMED_LOG_PAGES,
   PSTAT_VAC_NUM_TO_VACUUM_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_REQUESTS_LOG_PAGES,
   PSTAT_VAC_NUM_PREFETCH_HITS_LOG_PAGES,
+  PSTAT_VAC_NUM_SKIPPED_INSERT_RECORDS,
 
   /* Track heap modify counters. */
   PSTAT_HEAP_HOME_INSERTS,
@@ -496,6 +552,7 @@ typedef enum
   /* Log statistics */
   PSTAT_LOG_SNAPSHOT_TIME_COUNTERS,
   PSTAT_LOG_SNAPSHOT_RETRY_COUNTERS,
+  PSTAT_LOG_SNAPSHOT_REUSED_COUNTERS,
   PSTAT_LOG_TRAN_COMPLETE_TIME_COUNTERS,
   PSTAT_LOG_OLDEST_MVCC_TIME_COUNTERS,
   PSTAT_LOG_OLDEST_MVCC_RETRY_COUNTERS,
@@ -556,6 +613,11 @@ typedef enum
   /* hash anchor */
   PSTAT_PB_NUM_HASH_ANCHOR_WAITS,
   PSTAT_PB_TIME_HASH_ANCHOR_WAIT,
+  /* read-ahead */
+  PSTAT_PB_NUM_READ_AHEAD_REQUESTS,
+  PSTAT_PB_NUM_READ_AHEAD_PAGES,
+  /* warm-up */
+  PSTAT_PB_NUM_WARMUP_PAGES,
   /* flushing */
   PSTAT_PB_FLUSH_COLLECT,
   PSTAT_PB_FLUSH_FLUSH,
@@ -624,6 +686,17 @@ typedef enum
   PSTAT_LOG_LZ4_COMPRESS_TIME_COUNTERS,
   PSTAT_LOG_LZ4_DECOMPRESS_TIME_COUNTERS,
 
+  /* TDE statistics, pages en/decrypted with each data key */
+  PSTAT_TDE_ENCRYPT_PERM_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_DECRYPT_PERM_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_ENCRYPT_TEMP_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_DECRYPT_TEMP_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_ENCRYPT_LOG_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_DECRYPT_LOG_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_NUM_ENCRYPTED_BYTES,
+  PSTAT_TDE_NUM_DECRYPTED_BYTES,
+  PSTAT_TDE_LOG_PAGE_CACHE_HITS,
+
   /* peeked stats */
   PSTAT_PB_WAIT_THREADS_HIGH_PRIO,
   PSTAT_PB_WAIT_THREADS_LOW_PRIO,
@@ -633,6 +706,17 @@ typedef enum
   PSTAT_PB_LFCQ_SHR_NUM,
   PSTAT_PB_AVOID_DEALLOC_CNT,
   PSTAT_PB_AVOID_VICTIM_CNT,
+  PSTAT_PB_HUGE_PAGES,
+  PSTAT_LOG_HUGE_PAGES,
+  PSTAT_FILE_ATOMIC_WRITE_VOLUMES,
+  PSTAT_PB_FLUSH_FEEDBACK_BOOST,
+  PSTAT_PB_ZCACHE_SIZE,
+  PSTAT_LOG_GROUP_COMMIT_TARGET_BATCH,
+  PSTAT_VAC_NUM_PENDING_BLOCKS,
+  PSTAT_VAC_OLDEST_UNVACUUMED_MVCCID,
+  PSTAT_VAC_OLDEST_UNVACUUMED_MVCCID_AGE,
+  PSTAT_VAC_NUM_KEPT_ARCHIVE_LOG_PAGES,
+  PSTAT_VAC_NUM_DROPPED_FILES,
 
   /* Complex statistics */
   PSTAT_PBX_FIX_COUNTERS,
@@ -648,6 +732,9 @@ typedef enum
   PSTAT_THREAD_DAEMON_STATS,
   PSTAT_DWB_FLUSHED_BLOCK_NUM_VOLUMES,
   PSTAT_LOAD_THREAD_STATS,
+  PSTAT_OBJ_LOCK_WAIT_HISTOGRAM,
+  PSTAT_PBX_LATCH_WAIT_HISTOGRAM,
+  PSTAT_HOTPATH_STATS,
 
   PSTAT_COUNT
 } PERF_STAT_ID;
@@ -660,6 +747,12 @@ struct pstat_global
 
   UINT64 *global_stats;
 
+  /* Accumulated values are added to one of the shard blocks picked by the thread, instead of the global block, so
+   * the threads do not bounce the same cache lines on every statistic. Shards are folded into the global values when
+   * these are read. Peek values and max times are kept in the global block only. */
+  UINT64 *shard_stats;
+  int shard_stride;
+
   int n_trans;
   UINT64 **tran_stats;
 
@@ -676,6 +769,10 @@ struct pstat_global
 
 extern PSTAT_GLOBAL pstat_Global;
 
+#if defined (SERVER_MODE)
+#define PERFMON_SHARD_COUNT 16
+#endif /* SERVER_MODE */
+
 typedef enum
 {
   PSTAT_ACCUMULATE_SINGLE_VALUE,	/* A single accumulator value. */
@@ -821,6 +918,9 @@ extern int perfmon_get_number_of_statistic_values (void);
 extern UINT64 *perfmon_allocate_values (void);
 extern char *perfmon_allocate_packed_values_buffer (void);
 extern void perfmon_copy_values (UINT64 * src, UINT64 * dest);
+#if defined (SERVER_MODE)
+extern int perfmon_get_next_shard_index (void);
+#endif /* SERVER_MODE */
 
 #if defined (SERVER_MODE) || defined (SA_MODE)
 extern void perfmon_start_watch (THREAD_ENTRY * thread_p);
@@ -831,6 +931,7 @@ extern void perfmon_er_log_current_stats (THREAD_ENTRY * thread_p);
 STATIC_INLINE bool perfmon_is_perf_tracking (void) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool perfmon_is_perf_tracking_and_active (int activation_flag) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool perfmon_is_perf_tracking_force (bool always_collect) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE UINT64 *perfmon_get_accumulate_stats (void) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void perfmon_add_stat (THREAD_ENTRY * thread_p, PERF_STAT_ID psid, UINT64 amount)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void perfmon_add_stat_to_global (PERF_STAT_ID psid, UINT64 amount) __attribute__ ((ALWAYS_INLINE));
@@ -941,6 +1042,27 @@ perfmon_inc_stat_to_global (PERF_STAT_ID psid)
   perfmon_add_stat_to_global (psid, 1);
 }
 
+/*
+ * perfmon_get_accumulate_stats () - Get the statistics block the current thread accumulates values to.
+ *
+ * return : Shard block of thread on server, global block otherwise.
+ */
+STATIC_INLINE UINT64 *
+perfmon_get_accumulate_stats (void)
+{
+#if defined (SERVER_MODE)
+  static thread_local int shard_index = -1;
+
+  if (shard_index < 0)
+    {
+      shard_index = perfmon_get_next_shard_index ();
+    }
+  return pstat_Global.shard_stats + (size_t) shard_index * pstat_Global.shard_stride;
+#else /* !SERVER_MODE */
+  return pstat_Global.global_stats;
+#endif /* !SERVER_MODE */
+}
+
 /*
  * perfmon_add_at_offset () - Add amount to statistic in global/local at offset.
  *
@@ -960,7 +1082,7 @@ perfmon_add_at_offset (THREAD_ENTRY * thread_p, int offset, UINT64 amount)
   assert (pstat_Global.initialized);
 
   /* Update global statistic. */
-  ATOMIC_INC_64 (&(pstat_Global.global_stats[offset]), amount);
+  ATOMIC_INC_64 (&(perfmon_get_accumulate_stats ()[offset]), amount);
 
 #if defined (SERVER_MODE) || defined (SA_MODE)
   /* Update local statistic */
@@ -1132,9 +1254,10 @@ perfmon_time_at_offset (THREAD_ENTRY * thread_p, int offset, UINT64 timediff)
   assert (pstat_Global.initialized);
 
   /* Update global statistics. */
-  statvalp = pstat_Global.global_stats + offset;
+  statvalp = perfmon_get_accumulate_stats () + offset;
   ATOMIC_INC_64 (PSTAT_COUNTER_TIMER_COUNT_VALUE (statvalp), 1ULL);
   ATOMIC_INC_64 (PSTAT_COUNTER_TIMER_TOTAL_TIME_VALUE (statvalp), timediff);
+  statvalp = pstat_Global.global_stats + offset;
   do
     {
       max_time = ATOMIC_LOAD_64 (PSTAT_COUNTER_TIMER_MAX_TIME_VALUE (statvalp));
@@ -1220,9 +1343,10 @@ perfmon_time_bulk_at_offset (THREAD_ENTRY * thread_p, int offset, UINT64 timedif
   time_per_unit = timediff / count;
 
   /* Update global statistics. */
-  statvalp = pstat_Global.global_stats + offset;
+  statvalp = perfmon_get_accumulate_stats () + offset;
   ATOMIC_INC_64 (PSTAT_COUNTER_TIMER_COUNT_VALUE (statvalp), count);
   ATOMIC_INC_64 (PSTAT_COUNTER_TIMER_TOTAL_TIME_VALUE (statvalp), timediff);
+  statvalp = pstat_Global.global_stats + offset;
   do
     {
       max_time = ATOMIC_LOAD_64 (PSTAT_COUNTER_TIMER_MAX_TIME_VALUE (statvalp));
@@ -1459,6 +1583,10 @@ extern bool perfmon_server_is_stats_on (THREAD_ENTRY * thread_p);
 extern UINT64 perfmon_get_from_statistic (THREAD_ENTRY * thread_p, const int statistic_id);
 
 extern void perfmon_lk_waited_time_on_objects (THREAD_ENTRY * thread_p, int lock_mode, UINT64 amount);
+extern void perfmon_lk_wait_histogram (THREAD_ENTRY * thread_p, int res_type, int lock_mode, UINT64 wait_usec);
+extern void perfmon_pbx_latch_wait_histogram (THREAD_ENTRY * thread_p, int page_type, UINT64 wait_usec);
+extern int perfmon_wait_statistics_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt,
+					       void **ptr);
 
 extern UINT64 perfmon_get_stats_and_clear (THREAD_ENTRY * thread_p, const char *stat_name);
 
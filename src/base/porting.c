@@ -50,6 +50,10 @@
 
 #include "porting.h"
 
+#if defined (LINUX)
+#include <sys/mman.h>
+#endif /* LINUX */
+
 #if !defined(HAVE_ASPRINTF)
 #include <stdarg.h>
 #endif
@@ -1310,6 +1314,89 @@ os_rename_file (const char *src_path, const char *dest_path)
 #endif /* WINDOWS */
 }
 
+/*
+ * os_alloc_huge_pages() - allocate a big memory area backed by huge pages
+ *   return: the memory area, or NULL if it can't be allocated
+ *   size(in/out): requested size; rounded up to the size that must be given to os_free_huge_pages
+ *   huge_page_size(in): size of the explicit huge pages (e.g. 2M or 1G)
+ *   type(out): how the memory is backed
+ *
+ * Note: Explicit huge pages are tried first. If the system has not reserved enough of them, the area is mapped with
+ *       regular pages and advised for transparent huge pages. Other systems just use malloc.
+ */
+void *
+os_alloc_huge_pages (size_t * size, size_t huge_page_size, OS_HUGE_PAGES_TYPE * type)
+{
+#if defined (LINUX)
+#if defined (MAP_HUGE_SHIFT)
+#define OS_MAP_HUGE_SHIFT MAP_HUGE_SHIFT
+#else
+#define OS_MAP_HUGE_SHIFT 26	/* the page size log2 is encoded from this bit of the mmap flags */
+#endif
+  void *ptr;
+  size_t rounded_size;
+  int huge_page_shift = 0;
+
+  if (huge_page_size > 0)
+    {
+      while (((size_t) 1 << huge_page_shift) < huge_page_size)
+	{
+	  huge_page_shift++;
+	}
+      rounded_size = ((*size + huge_page_size - 1) / huge_page_size) * huge_page_size;
+
+      ptr = mmap (NULL, rounded_size, PROT_READ | PROT_WRITE,
+		  MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (huge_page_shift << OS_MAP_HUGE_SHIFT), -1, 0);
+      if (ptr != MAP_FAILED)
+	{
+	  *size = rounded_size;
+	  *type = OS_HUGE_PAGES_EXPLICIT;
+	  return ptr;
+	}
+
+      ptr = mmap (NULL, rounded_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (ptr != MAP_FAILED)
+	{
+	  /* the advice may be refused, the area is still usable */
+	  (void) madvise (ptr, rounded_size, MADV_HUGEPAGE);
+	  *size = rounded_size;
+	  *type = OS_HUGE_PAGES_TRANSPARENT;
+	  return ptr;
+	}
+    }
+#undef OS_MAP_HUGE_SHIFT
+#endif /* LINUX */
+
+  *type = OS_HUGE_PAGES_NONE;
+  return malloc (*size);
+}
+
+/*
+ * os_free_huge_pages() - free a memory area allocated by os_alloc_huge_pages
+ *   return: void
+ *   ptr(in): memory area
+ *   size(in): size returned by os_alloc_huge_pages
+ *   type(in): type returned by os_alloc_huge_pages
+ */
+void
+os_free_huge_pages (void *ptr, size_t size, OS_HUGE_PAGES_TYPE type)
+{
+  if (ptr == NULL)
+    {
+      return;
+    }
+
+#if defined (LINUX)
+  if (type != OS_HUGE_PAGES_NONE)
+    {
+      (void) munmap (ptr, size);
+      return;
+    }
+#endif /* LINUX */
+
+  free (ptr);
+}
+
 #include <signal.h>
 /*
  * os_set_signal_handler() - sets the signal handler
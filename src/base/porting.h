@@ -493,6 +493,17 @@ extern char *getuserid (char *string, int size);
  */
 extern int os_rename_file (const char *src_path, const char *dest_path);
 
+/* kind of memory returned by os_alloc_huge_pages () */
+typedef enum
+{
+  OS_HUGE_PAGES_NONE = 0,	/* regular pages, allocated with malloc */
+  OS_HUGE_PAGES_TRANSPARENT = 1,	/* regular mapping, advised for transparent huge pages */
+  OS_HUGE_PAGES_EXPLICIT = 2	/* mapping of explicit huge pages */
+} OS_HUGE_PAGES_TYPE;
+
+extern void *os_alloc_huge_pages (size_t * size, size_t huge_page_size, OS_HUGE_PAGES_TYPE * type);
+extern void os_free_huge_pages (void *ptr, size_t size, OS_HUGE_PAGES_TYPE type);
+
 /* os_send_kill() - send the KILL signal to ourselves */
 #if defined (WINDOWS)
 #define os_send_kill() os_send_signal(SIGABRT)
@@ -145,6 +145,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_BT_INDEX_SCAN_OID_ORDER "index_scan_in_oid_order"
 
 #define PRM_NAME_BOSR_MAXTMP_PAGES "temp_file_max_size_in_pages"
+#define PRM_NAME_TEMP_FILE_MAX_PAGES_PER_TRAN "temp_file_max_size_in_pages_per_tran"
 
 #define PRM_NAME_LK_TIMEOUT_MESSAGE_DUMP_LEVEL "lock_timeout_message_type"
 
@@ -188,6 +189,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_CSQL_AUTO_COMMIT "csql_auto_commit"
 
 #define PRM_NAME_WS_HASHTABLE_SIZE "initial_workspace_table_size"
+#define PRM_NAME_WS_PREFETCH_REFERENCES "workspace_prefetch_references"
 
 #define PRM_NAME_WS_MEMORY_REPORT "workspace_memory_report"
 
@@ -214,6 +216,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_IO_BACKUP_MAX_VOLUME_SIZE "backup_volume_max_size_bytes"
 
 #define PRM_NAME_IO_BACKUP_SLEEP_MSECS "backup_sleep_msecs"
+#define PRM_NAME_BACKUP_TRACK_CHANGED_PAGES "backup_track_changed_pages"
 
 #define PRM_NAME_MAX_PAGES_IN_TEMP_FILE_CACHE "max_pages_in_temp_file_cache"
 
@@ -222,12 +225,15 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_PTHREAD_SCOPE_PROCESS "pthread_scope_process"
 
 #define PRM_NAME_TEMP_MEM_BUFFER_PAGES "temp_file_memory_size_in_pages"
+#define PRM_NAME_TEMP_MEM_BUFFER_QUERY_PAGES "temp_file_memory_size_in_pages_per_query"
 
 #define PRM_NAME_INDEX_SCAN_KEY_BUFFER_PAGES "index_scan_key_buffer_pages"
 
 #define PRM_NAME_INDEX_SCAN_KEY_BUFFER_SIZE "index_scan_key_buffer_size"
 
 #define PRM_NAME_DONT_REUSE_HEAP_FILE "dont_reuse_heap_file"
+#define PRM_NAME_FILE_EXPAND_MIN_SECTORS "file_expand_min_sectors"
+#define PRM_NAME_FILE_EXPAND_RATIO "file_expand_ratio"
 
 #define PRM_NAME_INSERT_MODE "insert_execution_mode"
 
@@ -290,6 +296,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_ALTER_TABLE_CHANGE_TYPE_STRICT "alter_table_change_type_strict"
 
 #define PRM_NAME_COMPACTDB_PAGE_RECLAIM_ONLY "compactdb_page_reclaim_only"
+#define PRM_NAME_COMPACTDB_MAX_PAGES_PER_SEC "compactdb_max_pages_per_sec"
 
 #define PRM_NAME_LIKE_TERM_SELECTIVITY "like_term_selectivity"
 
@@ -324,6 +331,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_LIST_MAX_QUERY_CACHE_ENTRIES "max_query_cache_entries"
 
 #define PRM_NAME_LIST_MAX_QUERY_CACHE_PAGES "query_cache_size_in_pages"
+#define PRM_NAME_LIST_QUERY_CACHE_PARTITION_INVALIDATION "query_cache_partition_invalidation"
 
 #define PRM_NAME_USE_ORDERBY_SORT_LIMIT  "use_orderby_sort_limit"
 
@@ -372,6 +380,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_HA_CHANGEMODE_INTERVAL_IN_MSEC "ha_changemode_interval_in_msecs"
 
 #define PRM_NAME_HA_MAX_HEARTBEAT_GAP "ha_max_heartbeat_gap"
+#define PRM_NAME_HA_HEARTBEAT_PHI_THRESHOLD "ha_heartbeat_phi_threshold"
 
 #define PRM_NAME_HA_PING_HOSTS "ha_ping_hosts"
 
@@ -388,6 +397,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_HA_COPY_LOG_MAX_ARCHIVES "ha_copy_log_max_archives"
 
 #define PRM_NAME_HA_COPY_LOG_TIMEOUT "ha_copy_log_timeout"
+#define PRM_NAME_HA_COPY_LOG_PIPELINED "ha_copy_log_pipelined"
 
 #define PRM_NAME_HA_REPLICA_DELAY "ha_replica_delay"
 
@@ -412,6 +422,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_JAVA_STORED_PROCEDURE_DEBUG "java_stored_procedure_debug"
 
 #define PRM_NAME_JAVA_STORED_PROCEDURE_RESERVE_01 "java_stored_procedure_reserve_01"
+#define PRM_NAME_JAVA_STORED_PROCEDURE_BATCH_SIZE "java_stored_procedure_batch_size"
 
 #define PRM_NAME_ALLOW_TRUNCATED_STRING "allow_truncated_string"
 
@@ -506,6 +517,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_ACCESS_IP_CONTROL_FILE "access_ip_control_file"
 
 #define PRM_NAME_DB_VOLUME_SIZE "db_volume_size"
+#define PRM_NAME_VOLUME_PREEXTEND_SECONDS "volume_preextend_seconds"
 
 #define PRM_NAME_LOG_VOLUME_SIZE "log_volume_size"
 
@@ -554,6 +566,7 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 
 #define PRM_NAME_OPTIMIZER_ENABLE_MERGE_JOIN "optimizer_enable_merge_join"
 #define PRM_NAME_MAX_HASH_LIST_SCAN_SIZE "max_hash_list_scan_size"
+#define PRM_NAME_QUERY_WORK_MEMORY_SIZE "query_work_memory_size"
 #define PRM_NAME_OPTIMIZER_RESERVE_02 "optimizer_reserve_02"
 #define PRM_NAME_OPTIMIZER_RESERVE_03 "optimizer_reserve_03"
 #define PRM_NAME_OPTIMIZER_RESERVE_04 "optimizer_reserve_04"
@@ -647,6 +660,9 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_DWB_BLOCKS "double_write_buffer_blocks"
 #define PRM_NAME_ENABLE_DWB_FLUSH_THREAD "double_write_buffer_enable_flush_thread"
 #define PRM_NAME_DWB_LOGGING "double_write_buffer_logging"
+#define PRM_NAME_DWB_VOLUME_FLUSH_THREADS "double_write_buffer_volume_flush_threads"
+#define PRM_NAME_DWB_ATOMIC_WRITE_BYPASS "double_write_buffer_atomic_write_bypass"
+#define PRM_NAME_DWB_INSTANCES "double_write_buffer_instances"
 
 #define PRM_NAME_JSON_LOG_ALLOCATIONS "json_log_allocations"
 #define PRM_NAME_JSON_MAX_ARRAY_IDX "json_max_array_idx"
@@ -681,6 +697,61 @@ static const char sysprm_ha_conf_file_name[] = "cubrid_ha.conf";
 #define PRM_NAME_ENABLE_NEW_LFHASH "new_lfhash"
 #define PRM_NAME_HEAP_INFO_CACHE_LOGGING "heap_info_cache_logging"
 #define PRM_NAME_TDE_DEFAULT_ALGORITHM "tde_default_algorithm"
+#define PRM_NAME_TDE_APPLY_THROTTLE_MSECS "tde_apply_throttle_in_msecs"
+#define PRM_NAME_TDE_LOG_PAGE_CACHE_NPAGES "tde_log_page_cache_npages"
+#define PRM_NAME_TDE_CIPHER_ENGINE "tde_cipher_engine"
+#define PRM_NAME_TDE_ENCRYPT_USED_REGION_ONLY "tde_encrypt_used_region_only"
+#define PRM_NAME_PB_READ_AHEAD_PAGES "data_buffer_read_ahead_pages"
+#define PRM_NAME_HEAP_ZONE_MAP_PAGES "heap_zone_map_pages"
+#define PRM_NAME_PB_BULK_READ_SCANS "data_buffer_bulk_read_scans"
+#define PRM_NAME_PB_WARMUP_INTERVAL_SECS "data_buffer_warmup_interval_in_secs"
+#define PRM_NAME_PB_WARMUP_RATIO "data_buffer_warmup_ratio"
+#define PRM_NAME_PB_WARMUP_THREADS "data_buffer_warmup_threads"
+#define PRM_NAME_PB_NUMA_PARTITIONS "data_buffer_numa_partitions"
+#define PRM_NAME_PB_FLUSH_FEEDBACK "data_buffer_flush_feedback"
+#define PRM_NAME_PB_FLUSH_FEEDBACK_VICTIM_WAIT_USECS "data_buffer_flush_feedback_victim_wait_in_usecs"
+#define PRM_NAME_PB_COMPRESSED_CACHE_SIZE "data_buffer_compressed_cache_size"
+#define PRM_NAME_PB_COMPRESSED_CACHE_TEMP_PAGES "data_buffer_compressed_cache_temp_pages"
+#define PRM_NAME_LOG_RECOVERY_REDO_THREADS "log_recovery_redo_threads"
+#define PRM_NAME_LOG_GROUP_COMMIT_ADAPTIVE "group_commit_adaptive"
+#define PRM_NAME_LOG_COMPRESS_LEVEL "log_compress_level"
+#define PRM_NAME_LOG_ARCHIVE_COMPRESS "log_archive_compress"
+#define PRM_NAME_LOG_CHECKPOINT_INCREMENTAL "checkpoint_incremental"
+#define PRM_NAME_HA_APPLYLOGDB_MAX_FLUSH_ITEMS "ha_applylogdb_max_flush_items"
+#define PRM_NAME_LOG_COMMIT_REPLY_DEFERRED "log_commit_reply_deferred"
+#define PRM_NAME_LOG_POSTPONE_CACHE_SIZE_KB "log_postpone_cache_size_in_kbytes"
+#define PRM_NAME_VACUUM_HEAP_BATCH_BLOCKS "vacuum_heap_batch_blocks"
+#define PRM_NAME_VACUUM_WORKER_COUNT_MIN "vacuum_worker_count_min"
+#define PRM_NAME_VACUUM_SKIP_INSERT_RECORDS "vacuum_skip_insert_records"
+#define PRM_NAME_IB_SORT_THREADS "index_load_sort_threads"
+#define PRM_NAME_QUERY_SORT_THREADS "query_sort_threads"
+#define PRM_NAME_SORT_KEY_PREFIX "sort_key_prefix"
+#define PRM_NAME_BT_UNIQUE_FILTER_SIZE "unique_key_filter_size"
+#define PRM_NAME_USE_HUGE_PAGES "use_huge_pages"
+#define PRM_NAME_HUGE_PAGE_SIZE_KB "huge_page_size_in_kbytes"
+#define PRM_NAME_IO_URING "data_volume_io_uring"
+#define PRM_NAME_IO_URING_QUEUE_DEPTH "io_uring_queue_depth"
+#define PRM_NAME_USE_DIRECT_IO "use_direct_io"
+#define PRM_NAME_REGEXP_CACHE_SIZE "regexp_cache_size"
+#define PRM_NAME_JSON_PATH_CACHE_SIZE "json_path_cache_size"
+#define PRM_NAME_STATS_UPDATE_THREADS "stats_update_threads"
+#define PRM_NAME_STATS_REFRESH_THRESHOLD "stats_refresh_threshold"
+#define PRM_NAME_STATS_INCREMENTAL_UPDATE "stats_incremental_update"
+#define PRM_NAME_STATS_AUTO_REFRESH_INTERVAL "stats_auto_refresh_interval"
+#define PRM_NAME_PLAN_CACHE_FEEDBACK_FACTOR "plan_cache_feedback_factor"
+#define PRM_NAME_PLAN_CACHE_FEEDBACK_RUNS "plan_cache_feedback_runs"
+#define PRM_NAME_CLIENT_PLAN_CACHE_ENTRIES "client_plan_cache_entries"
+#define PRM_NAME_OPTIMIZER_JOIN_SEARCH_BUDGET "optimizer_join_search_budget"
+#define PRM_NAME_FILTER_PRED_MAX_ADAPTIVE_CLONES "max_filter_pred_cache_adaptive_clones"
+#define PRM_NAME_CONNECTION_REACTOR_THREADS "connection_reactor_threads"
+#define PRM_NAME_THREAD_WORKER_STEALING "thread_worker_stealing"
+#define PRM_NAME_THREAD_NUMA_PLACEMENT "thread_numa_placement"
+#define PRM_NAME_THREAD_DAEMON_CPUS "thread_daemon_cpus"
+#define PRM_NAME_THREAD_PINNED_DAEMONS "thread_pinned_daemons"
+#define PRM_NAME_THREAD_DAEMON_TIMER_TICK "thread_daemon_timer_tick_in_msecs"
+#define PRM_NAME_THREAD_WAIT_EVENT_SAMPLE_INTERVAL "thread_wait_event_sample_interval_in_msecs"
+#define PRM_NAME_LIST_FETCH_PAGE_COUNT "list_fetch_page_count"
+#define PRM_NAME_LIST_FETCH_COMPRESSION "list_fetch_compression"
 
 #define PRM_NAME_GENERAL_RESERVE_01 "general_reserve_01"
 
@@ -1014,6 +1085,12 @@ int PRM_BOSR_MAXTMP_PAGES = INT_MIN;
 static int prm_bosr_maxtmp_pages = -1;	/* Infinite */
 static unsigned int prm_bosr_maxtmp_flag = 0;
 
+int PRM_TEMP_FILE_MAX_PAGES_PER_TRAN = -1;
+static int prm_temp_file_max_pages_per_tran_default = -1;
+static int prm_temp_file_max_pages_per_tran_upper = INT_MAX;
+static int prm_temp_file_max_pages_per_tran_lower = -1;
+static unsigned int prm_temp_file_max_pages_per_tran_flag = 0;
+
 int PRM_LK_TIMEOUT_MESSAGE_DUMP_LEVEL = 0;
 static unsigned int prm_lk_timeout_message_dump_level_flag = 0;
 
@@ -1093,6 +1170,10 @@ static int prm_ws_hashtable_size_default = 4096;
 static int prm_ws_hashtable_size_lower = 1024;
 static unsigned int prm_ws_hashtable_size_flag = 0;
 
+bool PRM_WS_PREFETCH_REFERENCES = false;
+static bool prm_ws_prefetch_references_default = false;
+static unsigned int prm_ws_prefetch_references_flag = 0;
+
 bool PRM_WS_MEMORY_REPORT = false;
 static bool prm_ws_memory_report_default = false;
 static unsigned int prm_ws_memory_report_flag = 0;
@@ -1159,6 +1240,10 @@ static int prm_io_backup_sleep_msecs_default = 0;
 static int prm_io_backup_sleep_msecs_lower = 0;
 static unsigned int prm_io_backup_sleep_msecs_flag = 0;
 
+bool PRM_BACKUP_TRACK_CHANGED_PAGES = false;
+static bool prm_backup_track_changed_pages_default = false;
+static unsigned int prm_backup_track_changed_pages_flag = 0;
+
 int PRM_MAX_PAGES_IN_TEMP_FILE_CACHE = 1000;
 static int prm_max_pages_in_temp_file_cache_default = 1000;	/* pages */
 static int prm_max_pages_in_temp_file_cache_lower = 100;
@@ -1179,6 +1264,12 @@ static int prm_temp_mem_buffer_pages_lower = 0;
 static int prm_temp_mem_buffer_pages_upper = 20;
 static unsigned int prm_temp_mem_buffer_pages_flag = 0;
 
+int PRM_TEMP_MEM_BUFFER_QUERY_PAGES = 256;
+static int prm_temp_mem_buffer_query_pages_default = 256;
+static int prm_temp_mem_buffer_query_pages_upper = 16384;
+static int prm_temp_mem_buffer_query_pages_lower = 0;
+static unsigned int prm_temp_mem_buffer_query_pages_flag = 0;
+
 int PRM_INDEX_SCAN_KEY_BUFFER_PAGES = 20;
 static int prm_index_scan_key_buffer_pages_default = 20;
 static int prm_index_scan_key_buffer_pages_lower = 0;
@@ -1188,6 +1279,18 @@ bool PRM_DONT_REUSE_HEAP_FILE = false;
 static bool prm_dont_reuse_heap_file_default = false;
 static unsigned int prm_dont_reuse_heap_file_flag = 0;
 
+int PRM_FILE_EXPAND_MIN_SECTORS = 1;
+static int prm_file_expand_min_sectors_default = 1;
+static int prm_file_expand_min_sectors_upper = 1024;
+static int prm_file_expand_min_sectors_lower = 1;
+static unsigned int prm_file_expand_min_sectors_flag = 0;
+
+float PRM_FILE_EXPAND_RATIO = 0.01f;
+static float prm_file_expand_ratio_default = 0.01f;
+static float prm_file_expand_ratio_upper = 1.0f;
+static float prm_file_expand_ratio_lower = 0.0f;
+static unsigned int prm_file_expand_ratio_flag = 0;
+
 int PRM_INSERT_MODE = 1 + 2;
 static int prm_insert_mode_default = 1 + 2;
 static int prm_insert_mode_lower = 0;
@@ -1332,6 +1435,12 @@ int PRM_COMPACTDB_PAGE_RECLAIM_ONLY = 0;
 static int prm_compactdb_page_reclaim_only_default = 0;
 static unsigned int prm_compactdb_page_reclaim_only_flag = 0;
 
+int PRM_COMPACTDB_MAX_PAGES_PER_SEC = 0;
+static int prm_compactdb_max_pages_per_sec_default = 0;
+static int prm_compactdb_max_pages_per_sec_upper = INT_MAX;
+static int prm_compactdb_max_pages_per_sec_lower = 0;
+static unsigned int prm_compactdb_max_pages_per_sec_flag = 0;
+
 float PRM_LIKE_TERM_SELECTIVITY = 0.1f;
 static float prm_like_term_selectivity_default = 0.1f;
 static float prm_like_term_selectivity_upper = 1.0f;
@@ -1421,6 +1530,10 @@ static int prm_list_max_query_cache_pages_upper = INT_MAX;
 static int prm_list_max_query_cache_pages_lower = 0;
 static unsigned int prm_list_max_query_cache_pages_flag = 0;
 
+bool PRM_LIST_QUERY_CACHE_PARTITION_INVALIDATION = false;
+static bool prm_list_query_cache_partition_invalidation_default = false;
+static unsigned int prm_list_query_cache_partition_invalidation_flag = 0;
+
 bool PRM_USE_ORDERBY_SORT_LIMIT = true;
 static bool prm_use_orderby_sort_limit_default = true;
 static unsigned int prm_use_orderby_sort_limit_flag = 0;
@@ -1522,6 +1635,12 @@ int PRM_HA_MAX_HEARTBEAT_GAP = HB_DEFAULT_MAX_HEARTBEAT_GAP;
 static int prm_ha_max_heartbeat_gap_default = HB_DEFAULT_MAX_HEARTBEAT_GAP;
 static unsigned int prm_ha_max_heartbeat_gap_flag = 0;
 
+float PRM_HA_HEARTBEAT_PHI_THRESHOLD = 0.0f;
+static float prm_ha_heartbeat_phi_threshold_default = 0.0f;
+static float prm_ha_heartbeat_phi_threshold_upper = 100.0f;
+static float prm_ha_heartbeat_phi_threshold_lower = 0.0f;
+static unsigned int prm_ha_heartbeat_phi_threshold_flag = 0;
+
 const char *PRM_HA_PING_HOSTS = "";
 static const char *prm_ha_ping_hosts_default = NULL;
 static unsigned int prm_ha_ping_hosts_flag = 0;
@@ -1561,6 +1680,10 @@ static int prm_ha_copy_log_timeout_upper = INT_MAX;
 static int prm_ha_copy_log_timeout_lower = -1;
 static unsigned int prm_ha_copy_log_timeout_flag = 0;
 
+bool PRM_HA_COPY_LOG_PIPELINED = false;
+static bool prm_ha_copy_log_pipelined_default = false;
+static unsigned int prm_ha_copy_log_pipelined_flag = 0;
+
 int PRM_HA_REPLICA_DELAY_IN_SECS = 0;
 static int prm_ha_replica_delay_in_secs_default = 0;
 static int prm_ha_replica_delay_in_secs_upper = INT_MAX;
@@ -1786,6 +1909,12 @@ static UINT64 prm_db_volume_size_lower = 0;
 static UINT64 prm_db_volume_size_upper = 21474836480ULL;	/* 20G */
 static unsigned int prm_db_volume_size_flag = 0;
 
+int PRM_VOLUME_PREEXTEND_SECONDS = 60;
+static int prm_volume_preextend_seconds_default = 60;
+static int prm_volume_preextend_seconds_upper = 3600;
+static int prm_volume_preextend_seconds_lower = 0;
+static unsigned int prm_volume_preextend_seconds_flag = 0;
+
 UINT64 PRM_LOG_VOLUME_SIZE = 536870912ULL;
 static UINT64 prm_log_volume_size_default = 536870912ULL;	/* 512M */
 static UINT64 prm_log_volume_size_lower = 20971520ULL;	/* 20M */
@@ -1900,6 +2029,12 @@ static UINT64 prm_max_hash_list_scan_size_lower = 0;	/* 0 */
 static UINT64 prm_max_hash_list_scan_size_upper = 128 * 1024 * 1024;	/* 128 MB */
 static unsigned int prm_max_hash_list_scan_size_flag = 0;
 
+UINT64 PRM_QUERY_WORK_MEMORY_SIZE = 0;	/* off */
+static UINT64 prm_query_work_memory_size_default = 0;	/* off */
+static UINT64 prm_query_work_memory_size_lower = 0;
+static UINT64 prm_query_work_memory_size_upper = 68719476736ULL;	/* 64G */
+static unsigned int prm_query_work_memory_size_flag = 0;
+
 bool PRM_OPTIMIZER_RESERVE_02 = false;
 static bool prm_optimizer_reserve_02_default = false;
 static unsigned int prm_optimizer_reserve_02_flag = 0;
@@ -2216,6 +2351,22 @@ bool PRM_DWB_LOGGING = false;
 static bool prm_dwb_logging_default = false;
 static unsigned int prm_dwb_logging_flag = 0;
 
+int PRM_DWB_VOLUME_FLUSH_THREADS = 0;
+static int prm_dwb_volume_flush_threads_default = 0;
+static int prm_dwb_volume_flush_threads_upper = 16;
+static int prm_dwb_volume_flush_threads_lower = 0;
+static unsigned int prm_dwb_volume_flush_threads_flag = 0;
+
+bool PRM_DWB_ATOMIC_WRITE_BYPASS = false;
+static bool prm_dwb_atomic_write_bypass_default = false;
+static unsigned int prm_dwb_atomic_write_bypass_flag = 0;
+
+int PRM_DWB_INSTANCES = 1;
+static int prm_dwb_instances_default = 1;
+static int prm_dwb_instances_upper = 8;
+static int prm_dwb_instances_lower = 1;
+static unsigned int prm_dwb_instances_flag = 0;
+
 int PRM_DATA_FILE_ADVISE = 0;
 static int prm_data_file_advise_default = 0;
 static unsigned int prm_data_file_advise_flag = 0;
@@ -2294,6 +2445,295 @@ int PRM_TDE_DEFAULT_ALGORITHM = TDE_ALGORITHM_AES;
 static int prm_tde_default_algorithm = TDE_ALGORITHM_AES;
 static unsigned int prm_tde_default_algorithm_flag = 0;
 
+int PRM_TDE_APPLY_THROTTLE_MSECS = 0;
+static int prm_tde_apply_throttle_msecs_default = 0;
+static int prm_tde_apply_throttle_msecs_upper = 1000;
+static int prm_tde_apply_throttle_msecs_lower = 0;
+static unsigned int prm_tde_apply_throttle_msecs_flag = 0;
+
+int PRM_TDE_LOG_PAGE_CACHE_NPAGES = 256;
+static int prm_tde_log_page_cache_npages_default = 256;
+static int prm_tde_log_page_cache_npages_upper = 65536;
+static int prm_tde_log_page_cache_npages_lower = 0;
+static unsigned int prm_tde_log_page_cache_npages_flag = 0;
+
+const char *PRM_TDE_CIPHER_ENGINE = "";
+static char *prm_tde_cipher_engine_default = NULL;
+static unsigned int prm_tde_cipher_engine_flag = 0;
+
+bool PRM_TDE_ENCRYPT_USED_REGION_ONLY = false;
+static bool prm_tde_encrypt_used_region_only_default = false;
+static unsigned int prm_tde_encrypt_used_region_only_flag = 0;
+
+int PRM_PB_READ_AHEAD_PAGES = 32;
+static int prm_pb_read_ahead_pages_default = 32;
+static int prm_pb_read_ahead_pages_upper = 256;
+static int prm_pb_read_ahead_pages_lower = 0;
+static unsigned int prm_pb_read_ahead_pages_flag = 0;
+
+int PRM_HEAP_ZONE_MAP_PAGES = 0;
+static int prm_heap_zone_map_pages_default = 0;
+static int prm_heap_zone_map_pages_upper = 1048576;
+static int prm_heap_zone_map_pages_lower = 0;
+static unsigned int prm_heap_zone_map_pages_flag = 0;
+
+bool PRM_PB_BULK_READ_SCANS = true;
+static bool prm_pb_bulk_read_scans_default = true;
+static unsigned int prm_pb_bulk_read_scans_flag = 0;
+
+int PRM_PB_WARMUP_INTERVAL_SECS = 300;
+static int prm_pb_warmup_interval_secs_default = 300;
+static int prm_pb_warmup_interval_secs_upper = 86400;
+static int prm_pb_warmup_interval_secs_lower = 0;
+static unsigned int prm_pb_warmup_interval_secs_flag = 0;
+
+float PRM_PB_WARMUP_RATIO = 0.5;
+static float prm_pb_warmup_ratio_default = 0.5;
+static float prm_pb_warmup_ratio_upper = 1.0;
+static float prm_pb_warmup_ratio_lower = 0.0;
+static unsigned int prm_pb_warmup_ratio_flag = 0;
+
+int PRM_PB_WARMUP_THREADS = 4;
+static int prm_pb_warmup_threads_default = 4;
+static int prm_pb_warmup_threads_upper = 32;
+static int prm_pb_warmup_threads_lower = 1;
+static unsigned int prm_pb_warmup_threads_flag = 0;
+
+bool PRM_PB_NUMA_PARTITIONS = false;
+static bool prm_pb_numa_partitions_default = false;
+static unsigned int prm_pb_numa_partitions_flag = 0;
+
+bool PRM_PB_FLUSH_FEEDBACK = true;
+static bool prm_pb_flush_feedback_default = true;
+static unsigned int prm_pb_flush_feedback_flag = 0;
+
+int PRM_PB_FLUSH_FEEDBACK_VICTIM_WAIT_USECS = 1000;
+static int prm_pb_flush_feedback_victim_wait_usecs_default = 1000;
+static int prm_pb_flush_feedback_victim_wait_usecs_upper = 1000000;
+static int prm_pb_flush_feedback_victim_wait_usecs_lower = 0;
+static unsigned int prm_pb_flush_feedback_victim_wait_usecs_flag = 0;
+
+UINT64 PRM_PB_COMPRESSED_CACHE_SIZE = 0;
+static UINT64 prm_pb_compressed_cache_size_default = 0;	/* disabled */
+static UINT64 prm_pb_compressed_cache_size_upper = 1024ULL * 1024 * 1024 * 1024;	/* 1T */
+static UINT64 prm_pb_compressed_cache_size_lower = 0;
+static unsigned int prm_pb_compressed_cache_size_flag = 0;
+
+bool PRM_PB_COMPRESSED_CACHE_TEMP_PAGES = false;
+static bool prm_pb_compressed_cache_temp_pages_default = false;
+static unsigned int prm_pb_compressed_cache_temp_pages_flag = 0;
+
+int PRM_LOG_RECOVERY_REDO_THREADS = 0;
+static int prm_log_recovery_redo_threads_default = 0;
+static int prm_log_recovery_redo_threads_upper = 32;
+static int prm_log_recovery_redo_threads_lower = 0;
+static unsigned int prm_log_recovery_redo_threads_flag = 0;
+
+bool PRM_LOG_GROUP_COMMIT_ADAPTIVE = false;
+static bool prm_log_group_commit_adaptive_default = false;
+static unsigned int prm_log_group_commit_adaptive_flag = 0;
+
+int PRM_LOG_COMPRESS_LEVEL = 0;
+static int prm_log_compress_level_default = 0;
+static int prm_log_compress_level_upper = 12;
+static int prm_log_compress_level_lower = 0;
+static unsigned int prm_log_compress_level_flag = 0;
+
+bool PRM_LOG_ARCHIVE_COMPRESS = false;
+static bool prm_log_archive_compress_default = false;
+static unsigned int prm_log_archive_compress_flag = 0;
+
+bool PRM_LOG_CHECKPOINT_INCREMENTAL = false;
+static bool prm_log_checkpoint_incremental_default = false;
+static unsigned int prm_log_checkpoint_incremental_flag = 0;
+
+int PRM_HA_APPLYLOGDB_MAX_FLUSH_ITEMS = 200;
+static int prm_ha_applylogdb_max_flush_items_default = 200;
+static int prm_ha_applylogdb_max_flush_items_upper = 4096;
+static int prm_ha_applylogdb_max_flush_items_lower = 1;
+static unsigned int prm_ha_applylogdb_max_flush_items_flag = 0;
+
+bool PRM_LOG_COMMIT_REPLY_DEFERRED = false;
+static bool prm_log_commit_reply_deferred_default = false;
+static unsigned int prm_log_commit_reply_deferred_flag = 0;
+
+int PRM_LOG_POSTPONE_CACHE_SIZE_KB = 1024;
+static int prm_log_postpone_cache_size_kb_default = 1024;
+static int prm_log_postpone_cache_size_kb_upper = 1048576;
+static int prm_log_postpone_cache_size_kb_lower = 100;
+static unsigned int prm_log_postpone_cache_size_kb_flag = 0;
+
+int PRM_VACUUM_HEAP_BATCH_BLOCKS = 1;
+static int prm_vacuum_heap_batch_blocks_default = 1;
+static int prm_vacuum_heap_batch_blocks_upper = 16;
+static int prm_vacuum_heap_batch_blocks_lower = 1;
+static unsigned int prm_vacuum_heap_batch_blocks_flag = 0;
+
+int PRM_VACUUM_WORKER_COUNT_MIN = 0;
+static int prm_vacuum_worker_count_min_default = 0;
+static int prm_vacuum_worker_count_min_upper = VACUUM_MAX_WORKER_COUNT;
+static int prm_vacuum_worker_count_min_lower = 0;
+static unsigned int prm_vacuum_worker_count_min_flag = 0;
+
+bool PRM_VACUUM_SKIP_INSERT_RECORDS = false;
+static bool prm_vacuum_skip_insert_records_default = false;
+static unsigned int prm_vacuum_skip_insert_records_flag = 0;
+
+int PRM_IB_SORT_THREADS = 1;
+static int prm_ib_sort_threads_default = 1;
+static int prm_ib_sort_threads_upper = 64;
+static int prm_ib_sort_threads_lower = 1;
+static unsigned int prm_ib_sort_threads_flag = 0;
+
+int PRM_QUERY_SORT_THREADS = 1;
+static int prm_query_sort_threads_default = 1;
+static int prm_query_sort_threads_upper = 64;
+static int prm_query_sort_threads_lower = 1;
+static unsigned int prm_query_sort_threads_flag = 0;
+
+bool PRM_SORT_KEY_PREFIX = true;
+static bool prm_sort_key_prefix_default = true;
+static unsigned int prm_sort_key_prefix_flag = 0;
+
+UINT64 PRM_BT_UNIQUE_FILTER_SIZE = 0;
+static UINT64 prm_bt_unique_filter_size_default = 0;	/* disabled */
+static UINT64 prm_bt_unique_filter_size_upper = 64ULL * 1024 * 1024 * 1024;	/* 64G */
+static UINT64 prm_bt_unique_filter_size_lower = 0;
+static unsigned int prm_bt_unique_filter_size_flag = 0;
+
+bool PRM_USE_HUGE_PAGES = false;
+static bool prm_use_huge_pages_default = false;
+static unsigned int prm_use_huge_pages_flag = 0;
+
+int PRM_HUGE_PAGE_SIZE_KB = 2048;
+static int prm_huge_page_size_kb_default = 2048;
+static int prm_huge_page_size_kb_upper = 1048576;
+static int prm_huge_page_size_kb_lower = 2048;
+static unsigned int prm_huge_page_size_kb_flag = 0;
+
+bool PRM_IO_URING = false;
+static bool prm_io_uring_default = false;
+static unsigned int prm_io_uring_flag = 0;
+
+int PRM_IO_URING_QUEUE_DEPTH = 64;
+static int prm_io_uring_queue_depth_default = 64;
+static int prm_io_uring_queue_depth_upper = 4096;
+static int prm_io_uring_queue_depth_lower = 1;
+static unsigned int prm_io_uring_queue_depth_flag = 0;
+
+bool PRM_USE_DIRECT_IO = false;
+static bool prm_use_direct_io_default = false;
+static unsigned int prm_use_direct_io_flag = 0;
+
+int PRM_REGEXP_CACHE_SIZE = 256;
+static int prm_regexp_cache_size_default = 256;
+static int prm_regexp_cache_size_upper = 65536;
+static int prm_regexp_cache_size_lower = 0;
+static unsigned int prm_regexp_cache_size_flag = 0;
+
+int PRM_JSON_PATH_CACHE_SIZE = 256;
+static int prm_json_path_cache_size_default = 256;
+static int prm_json_path_cache_size_upper = 65536;
+static int prm_json_path_cache_size_lower = 0;
+static unsigned int prm_json_path_cache_size_flag = 0;
+
+int PRM_STATS_UPDATE_THREADS = 4;
+static int prm_stats_update_threads_default = 4;
+static int prm_stats_update_threads_upper = 64;
+static int prm_stats_update_threads_lower = 0;
+static unsigned int prm_stats_update_threads_flag = 0;
+
+int PRM_STATS_REFRESH_THRESHOLD = 10;
+static int prm_stats_refresh_threshold_default = 10;
+static int prm_stats_refresh_threshold_upper = 100;
+static int prm_stats_refresh_threshold_lower = 1;
+static unsigned int prm_stats_refresh_threshold_flag = 0;
+
+bool PRM_STATS_INCREMENTAL_UPDATE = false;
+static bool prm_stats_incremental_update_default = false;
+static unsigned int prm_stats_incremental_update_flag = 0;
+
+int PRM_STATS_AUTO_REFRESH_INTERVAL = 0;
+static int prm_stats_auto_refresh_interval_default = 0;
+static int prm_stats_auto_refresh_interval_upper = 86400;
+static int prm_stats_auto_refresh_interval_lower = 0;
+static unsigned int prm_stats_auto_refresh_interval_flag = 0;
+
+int PRM_PLAN_CACHE_FEEDBACK_FACTOR = 10;
+static int prm_plan_cache_feedback_factor_default = 10;
+static int prm_plan_cache_feedback_factor_upper = 1000000;
+static int prm_plan_cache_feedback_factor_lower = 0;
+static unsigned int prm_plan_cache_feedback_factor_flag = 0;
+
+int PRM_PLAN_CACHE_FEEDBACK_RUNS = 3;
+static int prm_plan_cache_feedback_runs_default = 3;
+static int prm_plan_cache_feedback_runs_upper = 1000;
+static int prm_plan_cache_feedback_runs_lower = 1;
+static unsigned int prm_plan_cache_feedback_runs_flag = 0;
+
+int PRM_CLIENT_PLAN_CACHE_ENTRIES = 1000;
+static int prm_client_plan_cache_entries_default = 1000;
+static int prm_client_plan_cache_entries_upper = 100000;
+static int prm_client_plan_cache_entries_lower = 0;
+static unsigned int prm_client_plan_cache_entries_flag = 0;
+
+int PRM_OPTIMIZER_JOIN_SEARCH_BUDGET = 100000;
+static int prm_optimizer_join_search_budget_default = 100000;
+static int prm_optimizer_join_search_budget_upper = 100000000;
+static int prm_optimizer_join_search_budget_lower = 0;
+static unsigned int prm_optimizer_join_search_budget_flag = 0;
+
+int PRM_FILTER_PRED_MAX_ADAPTIVE_CLONES = 200;
+static int prm_filter_pred_max_adaptive_clones_default = 200;
+static int prm_filter_pred_max_adaptive_clones_upper = 10000;
+static int prm_filter_pred_max_adaptive_clones_lower = 0;
+static unsigned int prm_filter_pred_max_adaptive_clones_flag = 0;
+
+int PRM_CONNECTION_REACTOR_THREADS = 0;
+static int prm_connection_reactor_threads_default = 0;
+static int prm_connection_reactor_threads_upper = 64;
+static int prm_connection_reactor_threads_lower = 0;
+static unsigned int prm_connection_reactor_threads_flag = 0;
+
+bool PRM_THREAD_WORKER_STEALING = false;
+static bool prm_thread_worker_stealing_default = false;
+static unsigned int prm_thread_worker_stealing_flag = 0;
+
+bool PRM_THREAD_NUMA_PLACEMENT = false;
+static bool prm_thread_numa_placement_default = false;
+static unsigned int prm_thread_numa_placement_flag = 0;
+
+const char *PRM_THREAD_DAEMON_CPUS = "";
+static char *prm_thread_daemon_cpus_default = NULL;
+static unsigned int prm_thread_daemon_cpus_flag = 0;
+
+const char *PRM_THREAD_PINNED_DAEMONS = "";
+static const char *prm_thread_pinned_daemons_default =
+  "log_flush,pgbuf_page_flush,pgbuf_page_post_flush,vacuum_master,dwb_flush_block";
+static unsigned int prm_thread_pinned_daemons_flag = 0;
+
+int PRM_THREAD_DAEMON_TIMER_TICK = 10;
+static int prm_thread_daemon_timer_tick_default = 10;
+static int prm_thread_daemon_timer_tick_upper = 1000;
+static int prm_thread_daemon_timer_tick_lower = 0;
+static unsigned int prm_thread_daemon_timer_tick_flag = 0;
+
+int PRM_THREAD_WAIT_EVENT_SAMPLE_INTERVAL = 1000;
+static int prm_thread_wait_event_sample_interval_default = 1000;
+static int prm_thread_wait_event_sample_interval_upper = 60000;
+static int prm_thread_wait_event_sample_interval_lower = 0;
+static unsigned int prm_thread_wait_event_sample_interval_flag = 0;
+
+int PRM_LIST_FETCH_PAGE_COUNT = 4;
+static int prm_list_fetch_page_count_default = 4;
+static int prm_list_fetch_page_count_upper = 64;
+static int prm_list_fetch_page_count_lower = 1;
+static unsigned int prm_list_fetch_page_count_flag = 0;
+
+bool PRM_LIST_FETCH_COMPRESSION = false;
+static bool prm_list_fetch_compression_default = false;
+static unsigned int prm_list_fetch_compression_flag = 0;
+
 bool PRM_JAVA_STORED_PROCEDURE = false;
 static bool prm_java_stored_procedure_default = false;
 static unsigned int prm_java_stored_procedure_flag = 0;
@@ -2318,6 +2758,12 @@ bool PRM_JAVA_STORED_PROCEDURE_RESERVE_01 = false;
 static bool prm_java_stored_procedure_reserve_01_default = false;
 static unsigned int prm_java_stored_procedure_reserve_01_flag = 0;
 
+int PRM_JAVA_STORED_PROCEDURE_BATCH_SIZE = 64;
+static int prm_java_stored_procedure_batch_size_default = 64;
+static int prm_java_stored_procedure_batch_size_upper = 4096;
+static int prm_java_stored_procedure_batch_size_lower = 1;
+static unsigned int prm_java_stored_procedure_batch_size_flag = 0;
+
 bool PRM_ALLOW_TRUNCATED_STRING = false;
 static bool prm_allow_truncated_string_default = false;
 static unsigned int prm_allow_truncated_string_flag = 0;
@@ -2624,6 +3070,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TEMP_FILE_MAX_PAGES_PER_TRAN,
+   PRM_NAME_TEMP_FILE_MAX_PAGES_PER_TRAN,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_temp_file_max_pages_per_tran_flag,
+   (void *) &prm_temp_file_max_pages_per_tran_default,
+   (void *) &PRM_TEMP_FILE_MAX_PAGES_PER_TRAN,
+   (void *) &prm_temp_file_max_pages_per_tran_upper, (void *) &prm_temp_file_max_pages_per_tran_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_LK_TIMEOUT_MESSAGE_DUMP_LEVEL,
    PRM_NAME_LK_TIMEOUT_MESSAGE_DUMP_LEVEL,
    (PRM_OBSOLETED),
@@ -2858,6 +3315,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_WS_PREFETCH_REFERENCES,
+   PRM_NAME_WS_PREFETCH_REFERENCES,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_ws_prefetch_references_flag,
+   (void *) &prm_ws_prefetch_references_default,
+   (void *) &PRM_WS_PREFETCH_REFERENCES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_WS_MEMORY_REPORT,
    PRM_NAME_WS_MEMORY_REPORT,
    (PRM_FOR_CLIENT | PRM_USER_CHANGE | PRM_HIDDEN),
@@ -3004,6 +3472,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BACKUP_TRACK_CHANGED_PAGES,
+   PRM_NAME_BACKUP_TRACK_CHANGED_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_backup_track_changed_pages_flag,
+   (void *) &prm_backup_track_changed_pages_default,
+   (void *) &PRM_BACKUP_TRACK_CHANGED_PAGES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_MAX_PAGES_IN_TEMP_FILE_CACHE,
    PRM_NAME_MAX_PAGES_IN_TEMP_FILE_CACHE,
    (PRM_FOR_SERVER | PRM_HIDDEN),
@@ -3049,6 +3528,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TEMP_MEM_BUFFER_QUERY_PAGES,
+   PRM_NAME_TEMP_MEM_BUFFER_QUERY_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_temp_mem_buffer_query_pages_flag,
+   (void *) &prm_temp_mem_buffer_query_pages_default,
+   (void *) &PRM_TEMP_MEM_BUFFER_QUERY_PAGES,
+   (void *) &prm_temp_mem_buffer_query_pages_upper, (void *) &prm_temp_mem_buffer_query_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_INDEX_SCAN_KEY_BUFFER_PAGES,
    PRM_NAME_INDEX_SCAN_KEY_BUFFER_PAGES,
    (PRM_FOR_SERVER | PRM_DEPRECATED | PRM_RELOADABLE),
@@ -3084,6 +3574,28 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_FILE_EXPAND_MIN_SECTORS,
+   PRM_NAME_FILE_EXPAND_MIN_SECTORS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_file_expand_min_sectors_flag,
+   (void *) &prm_file_expand_min_sectors_default,
+   (void *) &PRM_FILE_EXPAND_MIN_SECTORS,
+   (void *) &prm_file_expand_min_sectors_upper, (void *) &prm_file_expand_min_sectors_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_FILE_EXPAND_RATIO,
+   PRM_NAME_FILE_EXPAND_RATIO,
+   (PRM_FOR_SERVER),
+   PRM_FLOAT,
+   &prm_file_expand_ratio_flag,
+   (void *) &prm_file_expand_ratio_default,
+   (void *) &PRM_FILE_EXPAND_RATIO,
+   (void *) &prm_file_expand_ratio_upper, (void *) &prm_file_expand_ratio_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_INSERT_MODE,
    PRM_NAME_INSERT_MODE,
    (PRM_FOR_CLIENT | PRM_USER_CHANGE | PRM_HIDDEN),
@@ -3415,6 +3927,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_COMPACTDB_MAX_PAGES_PER_SEC,
+   PRM_NAME_COMPACTDB_MAX_PAGES_PER_SEC,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_compactdb_max_pages_per_sec_flag,
+   (void *) &prm_compactdb_max_pages_per_sec_default,
+   (void *) &PRM_COMPACTDB_MAX_PAGES_PER_SEC,
+   (void *) &prm_compactdb_max_pages_per_sec_upper, (void *) &prm_compactdb_max_pages_per_sec_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_PLUS_AS_CONCAT,
    PRM_NAME_PLUS_AS_CONCAT,
    (PRM_FOR_CLIENT | PRM_FOR_SERVER | PRM_TEST_CHANGE),
@@ -3643,6 +4166,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LIST_QUERY_CACHE_PARTITION_INVALIDATION,
+   PRM_NAME_LIST_QUERY_CACHE_PARTITION_INVALIDATION,
+   (PRM_FOR_SERVER | PRM_FORCE_SERVER),
+   PRM_BOOLEAN,
+   &prm_list_query_cache_partition_invalidation_flag,
+   (void *) &prm_list_query_cache_partition_invalidation_default,
+   (void *) &PRM_LIST_QUERY_CACHE_PARTITION_INVALIDATION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_USE_ORDERBY_SORT_LIMIT,
    PRM_NAME_USE_ORDERBY_SORT_LIMIT,
    (PRM_FOR_SERVER | PRM_USER_CHANGE),
@@ -3912,6 +4446,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HA_HEARTBEAT_PHI_THRESHOLD,
+   PRM_NAME_HA_HEARTBEAT_PHI_THRESHOLD,
+   (PRM_FOR_CLIENT | PRM_FOR_HA),
+   PRM_FLOAT,
+   &prm_ha_heartbeat_phi_threshold_flag,
+   (void *) &prm_ha_heartbeat_phi_threshold_default,
+   (void *) &PRM_HA_HEARTBEAT_PHI_THRESHOLD,
+   (void *) &prm_ha_heartbeat_phi_threshold_upper, (void *) &prm_ha_heartbeat_phi_threshold_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_HA_PING_HOSTS,
    PRM_NAME_HA_PING_HOSTS,
    (PRM_FOR_CLIENT | PRM_RELOADABLE | PRM_FOR_HA),
@@ -4003,6 +4548,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HA_COPY_LOG_PIPELINED,
+   PRM_NAME_HA_COPY_LOG_PIPELINED,
+   (PRM_FOR_SERVER | PRM_FOR_HA),
+   PRM_BOOLEAN,
+   &prm_ha_copy_log_pipelined_flag,
+   (void *) &prm_ha_copy_log_pipelined_default,
+   (void *) &PRM_HA_COPY_LOG_PIPELINED,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_HA_REPLICA_DELAY_IN_SECS,
    PRM_NAME_HA_REPLICA_DELAY,
    (PRM_FOR_CLIENT | PRM_FOR_HA | PRM_TIME_UNIT | PRM_DIFFER_UNIT),
@@ -4615,6 +5171,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VOLUME_PREEXTEND_SECONDS,
+   PRM_NAME_VOLUME_PREEXTEND_SECONDS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_volume_preextend_seconds_flag,
+   (void *) &prm_volume_preextend_seconds_default,
+   (void *) &PRM_VOLUME_PREEXTEND_SECONDS,
+   (void *) &prm_volume_preextend_seconds_upper, (void *) &prm_volume_preextend_seconds_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_LOG_VOLUME_SIZE,
    PRM_NAME_LOG_VOLUME_SIZE,
    (PRM_SIZE_UNIT),
@@ -4884,6 +5451,18 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_QUERY_WORK_MEMORY_SIZE,
+   PRM_NAME_QUERY_WORK_MEMORY_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_query_work_memory_size_flag,
+   (void *) &prm_query_work_memory_size_default,
+   (void *) &PRM_QUERY_WORK_MEMORY_SIZE,
+   (void *) &prm_query_work_memory_size_upper,
+   (void *) &prm_query_work_memory_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_OPTIMIZER_RESERVE_02,
    PRM_NAME_OPTIMIZER_RESERVE_02,
    (PRM_FOR_CLIENT | PRM_USER_CHANGE | PRM_HIDDEN),
@@ -5705,6 +6284,39 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DWB_VOLUME_FLUSH_THREADS,
+   PRM_NAME_DWB_VOLUME_FLUSH_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_dwb_volume_flush_threads_flag,
+   (void *) &prm_dwb_volume_flush_threads_default,
+   (void *) &PRM_DWB_VOLUME_FLUSH_THREADS,
+   (void *) &prm_dwb_volume_flush_threads_upper, (void *) &prm_dwb_volume_flush_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DWB_ATOMIC_WRITE_BYPASS,
+   PRM_NAME_DWB_ATOMIC_WRITE_BYPASS,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_dwb_atomic_write_bypass_flag,
+   (void *) &prm_dwb_atomic_write_bypass_default,
+   (void *) &PRM_DWB_ATOMIC_WRITE_BYPASS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_DWB_INSTANCES,
+   PRM_NAME_DWB_INSTANCES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_dwb_instances_flag,
+   (void *) &prm_dwb_instances_default,
+   (void *) &PRM_DWB_INSTANCES,
+   (void *) &prm_dwb_instances_upper, (void *) &prm_dwb_instances_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_DATA_FILE_ADVISE,
    PRM_NAME_DATA_FILE_ADVISE,
    (PRM_FOR_SERVER | PRM_USER_CHANGE),
@@ -5915,6 +6527,611 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TDE_APPLY_THROTTLE_MSECS,
+   PRM_NAME_TDE_APPLY_THROTTLE_MSECS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_tde_apply_throttle_msecs_flag,
+   (void *) &prm_tde_apply_throttle_msecs_default,
+   (void *) &PRM_TDE_APPLY_THROTTLE_MSECS,
+   (void *) &prm_tde_apply_throttle_msecs_upper, (void *) &prm_tde_apply_throttle_msecs_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TDE_LOG_PAGE_CACHE_NPAGES,
+   PRM_NAME_TDE_LOG_PAGE_CACHE_NPAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_tde_log_page_cache_npages_flag,
+   (void *) &prm_tde_log_page_cache_npages_default,
+   (void *) &PRM_TDE_LOG_PAGE_CACHE_NPAGES,
+   (void *) &prm_tde_log_page_cache_npages_upper, (void *) &prm_tde_log_page_cache_npages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TDE_CIPHER_ENGINE,
+   PRM_NAME_TDE_CIPHER_ENGINE,
+   (PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_tde_cipher_engine_flag,
+   (void *) &prm_tde_cipher_engine_default,
+   (void *) &PRM_TDE_CIPHER_ENGINE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_TDE_ENCRYPT_USED_REGION_ONLY,
+   PRM_NAME_TDE_ENCRYPT_USED_REGION_ONLY,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_tde_encrypt_used_region_only_flag,
+   (void *) &prm_tde_encrypt_used_region_only_default,
+   (void *) &PRM_TDE_ENCRYPT_USED_REGION_ONLY,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_READ_AHEAD_PAGES,
+   PRM_NAME_PB_READ_AHEAD_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_read_ahead_pages_flag,
+   (void *) &prm_pb_read_ahead_pages_default,
+   (void *) &PRM_PB_READ_AHEAD_PAGES,
+   (void *) &prm_pb_read_ahead_pages_upper, (void *) &prm_pb_read_ahead_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HEAP_ZONE_MAP_PAGES,
+   PRM_NAME_HEAP_ZONE_MAP_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_heap_zone_map_pages_flag,
+   (void *) &prm_heap_zone_map_pages_default,
+   (void *) &PRM_HEAP_ZONE_MAP_PAGES,
+   (void *) &prm_heap_zone_map_pages_upper, (void *) &prm_heap_zone_map_pages_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_BULK_READ_SCANS,
+   PRM_NAME_PB_BULK_READ_SCANS,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_bulk_read_scans_flag,
+   (void *) &prm_pb_bulk_read_scans_default,
+   (void *) &PRM_PB_BULK_READ_SCANS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_WARMUP_INTERVAL_SECS,
+   PRM_NAME_PB_WARMUP_INTERVAL_SECS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_warmup_interval_secs_flag,
+   (void *) &prm_pb_warmup_interval_secs_default,
+   (void *) &PRM_PB_WARMUP_INTERVAL_SECS,
+   (void *) &prm_pb_warmup_interval_secs_upper, (void *) &prm_pb_warmup_interval_secs_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_WARMUP_RATIO,
+   PRM_NAME_PB_WARMUP_RATIO,
+   (PRM_FOR_SERVER),
+   PRM_FLOAT,
+   &prm_pb_warmup_ratio_flag,
+   (void *) &prm_pb_warmup_ratio_default,
+   (void *) &PRM_PB_WARMUP_RATIO,
+   (void *) &prm_pb_warmup_ratio_upper, (void *) &prm_pb_warmup_ratio_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_WARMUP_THREADS,
+   PRM_NAME_PB_WARMUP_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_warmup_threads_flag,
+   (void *) &prm_pb_warmup_threads_default,
+   (void *) &PRM_PB_WARMUP_THREADS,
+   (void *) &prm_pb_warmup_threads_upper, (void *) &prm_pb_warmup_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_NUMA_PARTITIONS,
+   PRM_NAME_PB_NUMA_PARTITIONS,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_numa_partitions_flag,
+   (void *) &prm_pb_numa_partitions_default,
+   (void *) &PRM_PB_NUMA_PARTITIONS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_FLUSH_FEEDBACK,
+   PRM_NAME_PB_FLUSH_FEEDBACK,
+   (PRM_USER_CHANGE | PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_flush_feedback_flag,
+   (void *) &prm_pb_flush_feedback_default,
+   (void *) &PRM_PB_FLUSH_FEEDBACK,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_FLUSH_FEEDBACK_VICTIM_WAIT_USECS,
+   PRM_NAME_PB_FLUSH_FEEDBACK_VICTIM_WAIT_USECS,
+   (PRM_USER_CHANGE | PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_pb_flush_feedback_victim_wait_usecs_flag,
+   (void *) &prm_pb_flush_feedback_victim_wait_usecs_default,
+   (void *) &PRM_PB_FLUSH_FEEDBACK_VICTIM_WAIT_USECS,
+   (void *) &prm_pb_flush_feedback_victim_wait_usecs_upper, (void *) &prm_pb_flush_feedback_victim_wait_usecs_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_COMPRESSED_CACHE_SIZE,
+   PRM_NAME_PB_COMPRESSED_CACHE_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_pb_compressed_cache_size_flag,
+   (void *) &prm_pb_compressed_cache_size_default,
+   (void *) &PRM_PB_COMPRESSED_CACHE_SIZE,
+   (void *) &prm_pb_compressed_cache_size_upper, (void *) &prm_pb_compressed_cache_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PB_COMPRESSED_CACHE_TEMP_PAGES,
+   PRM_NAME_PB_COMPRESSED_CACHE_TEMP_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_pb_compressed_cache_temp_pages_flag,
+   (void *) &prm_pb_compressed_cache_temp_pages_default,
+   (void *) &PRM_PB_COMPRESSED_CACHE_TEMP_PAGES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_RECOVERY_REDO_THREADS,
+   PRM_NAME_LOG_RECOVERY_REDO_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_log_recovery_redo_threads_flag,
+   (void *) &prm_log_recovery_redo_threads_default,
+   (void *) &PRM_LOG_RECOVERY_REDO_THREADS,
+   (void *) &prm_log_recovery_redo_threads_upper, (void *) &prm_log_recovery_redo_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE,
+   PRM_NAME_LOG_GROUP_COMMIT_ADAPTIVE,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_log_group_commit_adaptive_flag,
+   (void *) &prm_log_group_commit_adaptive_default,
+   (void *) &PRM_LOG_GROUP_COMMIT_ADAPTIVE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_COMPRESS_LEVEL,
+   PRM_NAME_LOG_COMPRESS_LEVEL,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_log_compress_level_flag,
+   (void *) &prm_log_compress_level_default,
+   (void *) &PRM_LOG_COMPRESS_LEVEL,
+   (void *) &prm_log_compress_level_upper, (void *) &prm_log_compress_level_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_ARCHIVE_COMPRESS,
+   PRM_NAME_LOG_ARCHIVE_COMPRESS,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_log_archive_compress_flag,
+   (void *) &prm_log_archive_compress_default,
+   (void *) &PRM_LOG_ARCHIVE_COMPRESS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_CHECKPOINT_INCREMENTAL,
+   PRM_NAME_LOG_CHECKPOINT_INCREMENTAL,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_log_checkpoint_incremental_flag,
+   (void *) &prm_log_checkpoint_incremental_default,
+   (void *) &PRM_LOG_CHECKPOINT_INCREMENTAL,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HA_APPLYLOGDB_MAX_FLUSH_ITEMS,
+   PRM_NAME_HA_APPLYLOGDB_MAX_FLUSH_ITEMS,
+   (PRM_FOR_CLIENT | PRM_FOR_HA),
+   PRM_INTEGER,
+   &prm_ha_applylogdb_max_flush_items_flag,
+   (void *) &prm_ha_applylogdb_max_flush_items_default,
+   (void *) &PRM_HA_APPLYLOGDB_MAX_FLUSH_ITEMS,
+   (void *) &prm_ha_applylogdb_max_flush_items_upper, (void *) &prm_ha_applylogdb_max_flush_items_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_COMMIT_REPLY_DEFERRED,
+   PRM_NAME_LOG_COMMIT_REPLY_DEFERRED,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_log_commit_reply_deferred_flag,
+   (void *) &prm_log_commit_reply_deferred_default,
+   (void *) &PRM_LOG_COMMIT_REPLY_DEFERRED,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LOG_POSTPONE_CACHE_SIZE_KB,
+   PRM_NAME_LOG_POSTPONE_CACHE_SIZE_KB,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_log_postpone_cache_size_kb_flag,
+   (void *) &prm_log_postpone_cache_size_kb_default,
+   (void *) &PRM_LOG_POSTPONE_CACHE_SIZE_KB,
+   (void *) &prm_log_postpone_cache_size_kb_upper, (void *) &prm_log_postpone_cache_size_kb_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VACUUM_HEAP_BATCH_BLOCKS,
+   PRM_NAME_VACUUM_HEAP_BATCH_BLOCKS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_vacuum_heap_batch_blocks_flag,
+   (void *) &prm_vacuum_heap_batch_blocks_default,
+   (void *) &PRM_VACUUM_HEAP_BATCH_BLOCKS,
+   (void *) &prm_vacuum_heap_batch_blocks_upper, (void *) &prm_vacuum_heap_batch_blocks_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VACUUM_WORKER_COUNT_MIN,
+   PRM_NAME_VACUUM_WORKER_COUNT_MIN,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_vacuum_worker_count_min_flag,
+   (void *) &prm_vacuum_worker_count_min_default,
+   (void *) &PRM_VACUUM_WORKER_COUNT_MIN,
+   (void *) &prm_vacuum_worker_count_min_upper, (void *) &prm_vacuum_worker_count_min_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_VACUUM_SKIP_INSERT_RECORDS,
+   PRM_NAME_VACUUM_SKIP_INSERT_RECORDS,
+   (PRM_FOR_SERVER | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_vacuum_skip_insert_records_flag,
+   (void *) &prm_vacuum_skip_insert_records_default,
+   (void *) &PRM_VACUUM_SKIP_INSERT_RECORDS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_IB_SORT_THREADS,
+   PRM_NAME_IB_SORT_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_ib_sort_threads_flag,
+   (void *) &prm_ib_sort_threads_default,
+   (void *) &PRM_IB_SORT_THREADS,
+   (void *) &prm_ib_sort_threads_upper, (void *) &prm_ib_sort_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_QUERY_SORT_THREADS,
+   PRM_NAME_QUERY_SORT_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_query_sort_threads_flag,
+   (void *) &prm_query_sort_threads_default,
+   (void *) &PRM_QUERY_SORT_THREADS,
+   (void *) &prm_query_sort_threads_upper, (void *) &prm_query_sort_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_SORT_KEY_PREFIX,
+   PRM_NAME_SORT_KEY_PREFIX,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_sort_key_prefix_flag,
+   (void *) &prm_sort_key_prefix_default,
+   (void *) &PRM_SORT_KEY_PREFIX,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_BT_UNIQUE_FILTER_SIZE,
+   PRM_NAME_BT_UNIQUE_FILTER_SIZE,
+   (PRM_FOR_SERVER | PRM_SIZE_UNIT),
+   PRM_BIGINT,
+   &prm_bt_unique_filter_size_flag,
+   (void *) &prm_bt_unique_filter_size_default,
+   (void *) &PRM_BT_UNIQUE_FILTER_SIZE,
+   (void *) &prm_bt_unique_filter_size_upper, (void *) &prm_bt_unique_filter_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_USE_HUGE_PAGES,
+   PRM_NAME_USE_HUGE_PAGES,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_use_huge_pages_flag,
+   (void *) &prm_use_huge_pages_default,
+   (void *) &PRM_USE_HUGE_PAGES,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_HUGE_PAGE_SIZE_KB,
+   PRM_NAME_HUGE_PAGE_SIZE_KB,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_huge_page_size_kb_flag,
+   (void *) &prm_huge_page_size_kb_default,
+   (void *) &PRM_HUGE_PAGE_SIZE_KB,
+   (void *) &prm_huge_page_size_kb_upper, (void *) &prm_huge_page_size_kb_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_IO_URING,
+   PRM_NAME_IO_URING,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_io_uring_flag,
+   (void *) &prm_io_uring_default,
+   (void *) &PRM_IO_URING,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_IO_URING_QUEUE_DEPTH,
+   PRM_NAME_IO_URING_QUEUE_DEPTH,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_io_uring_queue_depth_flag,
+   (void *) &prm_io_uring_queue_depth_default,
+   (void *) &PRM_IO_URING_QUEUE_DEPTH,
+   (void *) &prm_io_uring_queue_depth_upper, (void *) &prm_io_uring_queue_depth_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_USE_DIRECT_IO,
+   PRM_NAME_USE_DIRECT_IO,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_use_direct_io_flag,
+   (void *) &prm_use_direct_io_default,
+   (void *) &PRM_USE_DIRECT_IO,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_REGEXP_CACHE_SIZE,
+   PRM_NAME_REGEXP_CACHE_SIZE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_regexp_cache_size_flag,
+   (void *) &prm_regexp_cache_size_default,
+   (void *) &PRM_REGEXP_CACHE_SIZE,
+   (void *) &prm_regexp_cache_size_upper, (void *) &prm_regexp_cache_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_JSON_PATH_CACHE_SIZE,
+   PRM_NAME_JSON_PATH_CACHE_SIZE,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_json_path_cache_size_flag,
+   (void *) &prm_json_path_cache_size_default,
+   (void *) &PRM_JSON_PATH_CACHE_SIZE,
+   (void *) &prm_json_path_cache_size_upper, (void *) &prm_json_path_cache_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_UPDATE_THREADS,
+   PRM_NAME_STATS_UPDATE_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_stats_update_threads_flag,
+   (void *) &prm_stats_update_threads_default,
+   (void *) &PRM_STATS_UPDATE_THREADS,
+   (void *) &prm_stats_update_threads_upper, (void *) &prm_stats_update_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_REFRESH_THRESHOLD,
+   PRM_NAME_STATS_REFRESH_THRESHOLD,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_stats_refresh_threshold_flag,
+   (void *) &prm_stats_refresh_threshold_default,
+   (void *) &PRM_STATS_REFRESH_THRESHOLD,
+   (void *) &prm_stats_refresh_threshold_upper, (void *) &prm_stats_refresh_threshold_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_INCREMENTAL_UPDATE,
+   PRM_NAME_STATS_INCREMENTAL_UPDATE,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_stats_incremental_update_flag,
+   (void *) &prm_stats_incremental_update_default,
+   (void *) &PRM_STATS_INCREMENTAL_UPDATE,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_STATS_AUTO_REFRESH_INTERVAL,
+   PRM_NAME_STATS_AUTO_REFRESH_INTERVAL,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_stats_auto_refresh_interval_flag,
+   (void *) &prm_stats_auto_refresh_interval_default,
+   (void *) &PRM_STATS_AUTO_REFRESH_INTERVAL,
+   (void *) &prm_stats_auto_refresh_interval_upper, (void *) &prm_stats_auto_refresh_interval_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PLAN_CACHE_FEEDBACK_FACTOR,
+   PRM_NAME_PLAN_CACHE_FEEDBACK_FACTOR,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_plan_cache_feedback_factor_flag,
+   (void *) &prm_plan_cache_feedback_factor_default,
+   (void *) &PRM_PLAN_CACHE_FEEDBACK_FACTOR,
+   (void *) &prm_plan_cache_feedback_factor_upper, (void *) &prm_plan_cache_feedback_factor_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_PLAN_CACHE_FEEDBACK_RUNS,
+   PRM_NAME_PLAN_CACHE_FEEDBACK_RUNS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_plan_cache_feedback_runs_flag,
+   (void *) &prm_plan_cache_feedback_runs_default,
+   (void *) &PRM_PLAN_CACHE_FEEDBACK_RUNS,
+   (void *) &prm_plan_cache_feedback_runs_upper, (void *) &prm_plan_cache_feedback_runs_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_CLIENT_PLAN_CACHE_ENTRIES,
+   PRM_NAME_CLIENT_PLAN_CACHE_ENTRIES,
+   (PRM_FOR_CLIENT),
+   PRM_INTEGER,
+   &prm_client_plan_cache_entries_flag,
+   (void *) &prm_client_plan_cache_entries_default,
+   (void *) &PRM_CLIENT_PLAN_CACHE_ENTRIES,
+   (void *) &prm_client_plan_cache_entries_upper, (void *) &prm_client_plan_cache_entries_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_OPTIMIZER_JOIN_SEARCH_BUDGET,
+   PRM_NAME_OPTIMIZER_JOIN_SEARCH_BUDGET,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_optimizer_join_search_budget_flag,
+   (void *) &prm_optimizer_join_search_budget_default,
+   (void *) &PRM_OPTIMIZER_JOIN_SEARCH_BUDGET,
+   (void *) &prm_optimizer_join_search_budget_upper, (void *) &prm_optimizer_join_search_budget_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_FILTER_PRED_MAX_ADAPTIVE_CLONES,
+   PRM_NAME_FILTER_PRED_MAX_ADAPTIVE_CLONES,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_filter_pred_max_adaptive_clones_flag,
+   (void *) &prm_filter_pred_max_adaptive_clones_default,
+   (void *) &PRM_FILTER_PRED_MAX_ADAPTIVE_CLONES,
+   (void *) &prm_filter_pred_max_adaptive_clones_upper, (void *) &prm_filter_pred_max_adaptive_clones_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_CONNECTION_REACTOR_THREADS,
+   PRM_NAME_CONNECTION_REACTOR_THREADS,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_connection_reactor_threads_flag,
+   (void *) &prm_connection_reactor_threads_default,
+   (void *) &PRM_CONNECTION_REACTOR_THREADS,
+   (void *) &prm_connection_reactor_threads_upper, (void *) &prm_connection_reactor_threads_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_WORKER_STEALING,
+   PRM_NAME_THREAD_WORKER_STEALING,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_thread_worker_stealing_flag,
+   (void *) &prm_thread_worker_stealing_default,
+   (void *) &PRM_THREAD_WORKER_STEALING,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_NUMA_PLACEMENT,
+   PRM_NAME_THREAD_NUMA_PLACEMENT,
+   (PRM_FOR_SERVER),
+   PRM_BOOLEAN,
+   &prm_thread_numa_placement_flag,
+   (void *) &prm_thread_numa_placement_default,
+   (void *) &PRM_THREAD_NUMA_PLACEMENT,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_DAEMON_CPUS,
+   PRM_NAME_THREAD_DAEMON_CPUS,
+   (PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_thread_daemon_cpus_flag,
+   (void *) &prm_thread_daemon_cpus_default,
+   (void *) &PRM_THREAD_DAEMON_CPUS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_PINNED_DAEMONS,
+   PRM_NAME_THREAD_PINNED_DAEMONS,
+   (PRM_FOR_SERVER),
+   PRM_STRING,
+   &prm_thread_pinned_daemons_flag,
+   (void *) &prm_thread_pinned_daemons_default,
+   (void *) &PRM_THREAD_PINNED_DAEMONS,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_DAEMON_TIMER_TICK,
+   PRM_NAME_THREAD_DAEMON_TIMER_TICK,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_thread_daemon_timer_tick_flag,
+   (void *) &prm_thread_daemon_timer_tick_default,
+   (void *) &PRM_THREAD_DAEMON_TIMER_TICK,
+   (void *) &prm_thread_daemon_timer_tick_upper, (void *) &prm_thread_daemon_timer_tick_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_THREAD_WAIT_EVENT_SAMPLE_INTERVAL,
+   PRM_NAME_THREAD_WAIT_EVENT_SAMPLE_INTERVAL,
+   (PRM_FOR_SERVER),
+   PRM_INTEGER,
+   &prm_thread_wait_event_sample_interval_flag,
+   (void *) &prm_thread_wait_event_sample_interval_default,
+   (void *) &PRM_THREAD_WAIT_EVENT_SAMPLE_INTERVAL,
+   (void *) &prm_thread_wait_event_sample_interval_upper, (void *) &prm_thread_wait_event_sample_interval_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LIST_FETCH_PAGE_COUNT,
+   PRM_NAME_LIST_FETCH_PAGE_COUNT,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_list_fetch_page_count_flag,
+   (void *) &prm_list_fetch_page_count_default,
+   (void *) &PRM_LIST_FETCH_PAGE_COUNT,
+   (void *) &prm_list_fetch_page_count_upper, (void *) &prm_list_fetch_page_count_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
+  {PRM_ID_LIST_FETCH_COMPRESSION,
+   PRM_NAME_LIST_FETCH_COMPRESSION,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_BOOLEAN,
+   &prm_list_fetch_compression_flag,
+   (void *) &prm_list_fetch_compression_default,
+   (void *) &PRM_LIST_FETCH_COMPRESSION,
+   (void *) NULL, (void *) NULL,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_JAVA_STORED_PROCEDURE,
    PRM_NAME_JAVA_STORED_PROCEDURE,
    (PRM_FOR_SERVER),
@@ -5970,6 +7187,17 @@ static SYSPRM_PARAM prm_Def[] = {
    (char *) NULL,
    (DUP_PRM_FUNC) NULL,
    (DUP_PRM_FUNC) NULL},
+  {PRM_ID_JAVA_STORED_PROCEDURE_BATCH_SIZE,
+   PRM_NAME_JAVA_STORED_PROCEDURE_BATCH_SIZE,
+   (PRM_FOR_CLIENT | PRM_USER_CHANGE),
+   PRM_INTEGER,
+   &prm_java_stored_procedure_batch_size_flag,
+   (void *) &prm_java_stored_procedure_batch_size_default,
+   (void *) &PRM_JAVA_STORED_PROCEDURE_BATCH_SIZE,
+   (void *) &prm_java_stored_procedure_batch_size_upper, (void *) &prm_java_stored_procedure_batch_size_lower,
+   (char *) NULL,
+   (DUP_PRM_FUNC) NULL,
+   (DUP_PRM_FUNC) NULL},
   {PRM_ID_ALLOW_TRUNCATED_STRING,
    PRM_NAME_ALLOW_TRUNCATED_STRING,
    (PRM_USER_CHANGE | PRM_FOR_CLIENT | PRM_FOR_SERVER | PRM_FOR_SESSION | PRM_FOR_HA_CONTEXT),
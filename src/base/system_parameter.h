@@ -114,6 +114,7 @@ enum param_id
   PRM_ID_BT_OID_BUFFER_SIZE,
   PRM_ID_BT_INDEX_SCAN_OID_ORDER,
   PRM_ID_BOSR_MAXTMP_PAGES,
+  PRM_ID_TEMP_FILE_MAX_PAGES_PER_TRAN,
   PRM_ID_LK_TIMEOUT_MESSAGE_DUMP_LEVEL,
   PRM_ID_LK_ESCALATION_AT,
   PRM_ID_LK_ROLLBACK_ON_LOCK_ESCALATION,
@@ -135,6 +136,7 @@ enum param_id
   PRM_ID_CSQL_AUTO_COMMIT,
   PRM_ID_LOG_SWEEP_CLEAN,
   PRM_ID_WS_HASHTABLE_SIZE,
+  PRM_ID_WS_PREFETCH_REFERENCES,
   PRM_ID_WS_MEMORY_REPORT,
   PRM_ID_GC_ENABLE,
   PRM_ID_TCP_PORT_ID,
@@ -148,13 +150,17 @@ enum param_id
   PRM_ID_IO_BACKUP_NBUFFERS,
   PRM_ID_IO_BACKUP_MAX_VOLUME_SIZE,
   PRM_ID_IO_BACKUP_SLEEP_MSECS,
+  PRM_ID_BACKUP_TRACK_CHANGED_PAGES,
   PRM_ID_MAX_PAGES_IN_TEMP_FILE_CACHE,
   PRM_ID_MAX_ENTRIES_IN_TEMP_FILE_CACHE,
   PRM_ID_PTHREAD_SCOPE_PROCESS,	/* AIX only */
   PRM_ID_TEMP_MEM_BUFFER_PAGES,
+  PRM_ID_TEMP_MEM_BUFFER_QUERY_PAGES,
   PRM_ID_INDEX_SCAN_KEY_BUFFER_PAGES,
   PRM_ID_INDEX_SCAN_KEY_BUFFER_SIZE,
   PRM_ID_DONT_REUSE_HEAP_FILE,
+  PRM_ID_FILE_EXPAND_MIN_SECTORS,
+  PRM_ID_FILE_EXPAND_RATIO,
   PRM_ID_INSERT_MODE,
   PRM_ID_LK_MAX_SCANID_BIT,
   PRM_ID_HOSTVAR_LATE_BINDING,
@@ -184,6 +190,7 @@ enum param_id
   PRM_ID_RETURN_NULL_ON_FUNCTION_ERRORS,
   PRM_ID_ALTER_TABLE_CHANGE_TYPE_STRICT,
   PRM_ID_COMPACTDB_PAGE_RECLAIM_ONLY,
+  PRM_ID_COMPACTDB_MAX_PAGES_PER_SEC,
   PRM_ID_PLUS_AS_CONCAT,
   PRM_ID_LIKE_TERM_SELECTIVITY,
   PRM_ID_MAX_OUTER_CARD_OF_IDXJOIN,
@@ -204,6 +211,7 @@ enum param_id
   PRM_ID_LIST_QUERY_CACHE_MODE,
   PRM_ID_LIST_MAX_QUERY_CACHE_ENTRIES,
   PRM_ID_LIST_MAX_QUERY_CACHE_PAGES,
+  PRM_ID_LIST_QUERY_CACHE_PARTITION_INVALIDATION,
   PRM_ID_USE_ORDERBY_SORT_LIMIT,
   PRM_ID_REPLICATION_MODE,
   PRM_ID_HA_MODE,
@@ -228,6 +236,7 @@ enum param_id
   PRM_ID_HA_UNACCEPTABLE_PROC_RESTART_TIMEDIFF_IN_MSECS,
   PRM_ID_HA_CHANGEMODE_INTERVAL_IN_MSECS,
   PRM_ID_HA_MAX_HEARTBEAT_GAP,
+  PRM_ID_HA_HEARTBEAT_PHI_THRESHOLD,
   PRM_ID_HA_PING_HOSTS,
   PRM_ID_HA_APPLYLOGDB_RETRY_ERROR_LIST,
   PRM_ID_HA_APPLYLOGDB_IGNORE_ERROR_LIST,
@@ -236,6 +245,7 @@ enum param_id
   PRM_ID_HA_SQL_LOG_MAX_SIZE_IN_MB,
   PRM_ID_HA_COPY_LOG_MAX_ARCHIVES,
   PRM_ID_HA_COPY_LOG_TIMEOUT,
+  PRM_ID_HA_COPY_LOG_PIPELINED,
   PRM_ID_HA_REPLICA_DELAY_IN_SECS,
   PRM_ID_HA_REPLICA_TIME_BOUND,
   PRM_ID_HA_DELAY_LIMIT_IN_SECS,
@@ -295,6 +305,7 @@ enum param_id
    * are found in this array). */
   PRM_ID_COMPAT_MODE,
   PRM_ID_DB_VOLUME_SIZE,
+  PRM_ID_VOLUME_PREEXTEND_SECONDS,
   PRM_ID_LOG_VOLUME_SIZE,
   PRM_ID_UNICODE_INPUT_NORMALIZATION,
   PRM_ID_UNICODE_OUTPUT_NORMALIZATION,
@@ -318,6 +329,7 @@ enum param_id
   PRM_ID_USE_BTREE_FENCE_KEY,
   PRM_ID_OPTIMIZER_ENABLE_MERGE_JOIN,
   PRM_ID_MAX_HASH_LIST_SCAN_SIZE,
+  PRM_ID_QUERY_WORK_MEMORY_SIZE,
   PRM_ID_OPTIMIZER_RESERVE_02,
   PRM_ID_OPTIMIZER_RESERVE_03,
   PRM_ID_OPTIMIZER_RESERVE_04,
@@ -417,6 +429,9 @@ enum param_id
   PRM_ID_DWB_BLOCKS,
   PRM_ID_ENABLE_DWB_FLUSH_THREAD,
   PRM_ID_DWB_LOGGING,
+  PRM_ID_DWB_VOLUME_FLUSH_THREADS,
+  PRM_ID_DWB_ATOMIC_WRITE_BYPASS,
+  PRM_ID_DWB_INSTANCES,
   PRM_ID_DATA_FILE_ADVISE,
 
   PRM_ID_DEBUG_LOG_ARCHIVES,
@@ -440,12 +455,68 @@ enum param_id
 
   PRM_ID_TDE_KEYS_FILE_PATH,
   PRM_ID_TDE_DEFAULT_ALGORITHM,
+  PRM_ID_TDE_APPLY_THROTTLE_MSECS,
+  PRM_ID_TDE_LOG_PAGE_CACHE_NPAGES,
+  PRM_ID_TDE_CIPHER_ENGINE,
+  PRM_ID_TDE_ENCRYPT_USED_REGION_ONLY,
+  PRM_ID_PB_READ_AHEAD_PAGES,
+  PRM_ID_HEAP_ZONE_MAP_PAGES,
+  PRM_ID_PB_BULK_READ_SCANS,
+  PRM_ID_PB_WARMUP_INTERVAL_SECS,
+  PRM_ID_PB_WARMUP_RATIO,
+  PRM_ID_PB_WARMUP_THREADS,
+  PRM_ID_PB_NUMA_PARTITIONS,
+  PRM_ID_PB_FLUSH_FEEDBACK,
+  PRM_ID_PB_FLUSH_FEEDBACK_VICTIM_WAIT_USECS,
+  PRM_ID_PB_COMPRESSED_CACHE_SIZE,
+  PRM_ID_PB_COMPRESSED_CACHE_TEMP_PAGES,
+  PRM_ID_LOG_RECOVERY_REDO_THREADS,
+  PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE,
+  PRM_ID_LOG_COMPRESS_LEVEL,
+  PRM_ID_LOG_ARCHIVE_COMPRESS,
+  PRM_ID_LOG_CHECKPOINT_INCREMENTAL,
+  PRM_ID_HA_APPLYLOGDB_MAX_FLUSH_ITEMS,
+  PRM_ID_LOG_COMMIT_REPLY_DEFERRED,
+  PRM_ID_LOG_POSTPONE_CACHE_SIZE_KB,
+  PRM_ID_VACUUM_HEAP_BATCH_BLOCKS,
+  PRM_ID_VACUUM_WORKER_COUNT_MIN,
+  PRM_ID_VACUUM_SKIP_INSERT_RECORDS,
+  PRM_ID_IB_SORT_THREADS,
+  PRM_ID_QUERY_SORT_THREADS,
+  PRM_ID_SORT_KEY_PREFIX,
+  PRM_ID_BT_UNIQUE_FILTER_SIZE,
+  PRM_ID_USE_HUGE_PAGES,
+  PRM_ID_HUGE_PAGE_SIZE_KB,
+  PRM_ID_IO_URING,
+  PRM_ID_IO_URING_QUEUE_DEPTH,
+  PRM_ID_USE_DIRECT_IO,
+  PRM_ID_REGEXP_CACHE_SIZE,
+  PRM_ID_JSON_PATH_CACHE_SIZE,
+  PRM_ID_STATS_UPDATE_THREADS,
+  PRM_ID_STATS_REFRESH_THRESHOLD,
+  PRM_ID_STATS_INCREMENTAL_UPDATE,
+  PRM_ID_STATS_AUTO_REFRESH_INTERVAL,
+  PRM_ID_PLAN_CACHE_FEEDBACK_FACTOR,
+  PRM_ID_PLAN_CACHE_FEEDBACK_RUNS,
+  PRM_ID_CLIENT_PLAN_CACHE_ENTRIES,
+  PRM_ID_OPTIMIZER_JOIN_SEARCH_BUDGET,
+  PRM_ID_FILTER_PRED_MAX_ADAPTIVE_CLONES,
+  PRM_ID_CONNECTION_REACTOR_THREADS,
+  PRM_ID_THREAD_WORKER_STEALING,
+  PRM_ID_THREAD_NUMA_PLACEMENT,
+  PRM_ID_THREAD_DAEMON_CPUS,
+  PRM_ID_THREAD_PINNED_DAEMONS,
+  PRM_ID_THREAD_DAEMON_TIMER_TICK,
+  PRM_ID_THREAD_WAIT_EVENT_SAMPLE_INTERVAL,
+  PRM_ID_LIST_FETCH_PAGE_COUNT,
+  PRM_ID_LIST_FETCH_COMPRESSION,
 
   PRM_ID_JAVA_STORED_PROCEDURE,
   PRM_ID_JAVA_STORED_PROCEDURE_PORT,
   PRM_ID_JAVA_STORED_PROCEDURE_JVM_OPTIONS,
   PRM_ID_JAVA_STORED_PROCEDURE_DEBUG,
   PRM_ID_JAVA_STORED_PROCEDURE_RESERVE_01,
+  PRM_ID_JAVA_STORED_PROCEDURE_BATCH_SIZE,
   PRM_ID_ALLOW_TRUNCATED_STRING,
   PRM_ID_TB_DEFAULT_REUSE_OID,
   PRM_ID_USE_STAT_ESTIMATION,
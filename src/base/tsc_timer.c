@@ -139,6 +139,56 @@ tsc_elapsed_utime (TSC_TICKS end_tick, TSC_TICKS start_tick)
   return tv.tv_sec * 1000000LL + tv.tv_usec;
 }
 
+/*
+ * tsc_elapsed_ticks () - measure the elapsed time in ticks, to be summed up and converted later by
+ *			  tsc_ticks_to_nsec.
+ *
+ * return	   : Elapsed ticks (CPU ticks, or microseconds when CPU ticks are not used).
+ * end_tick (in)   : End time.
+ * start_tick (in) : Start time.
+ */
+UINT64
+tsc_elapsed_ticks (TSC_TICKS end_tick, TSC_TICKS start_tick)
+{
+  if (power_Savings == 0)
+    {
+      /* Sometimes the time goes backwards in the MULTI-CORE processor world. But it is a negligible level. */
+      if (end_tick.tc < start_tick.tc)
+	{
+	  return 0;
+	}
+      return (UINT64) elapsed ((ticks) end_tick.tc, (ticks) start_tick.tc);
+    }
+  else
+    {
+      TSCTIMEVAL tv;
+
+      CALCULATE_ELAPSED_TIMEVAL (&tv, end_tick.tv, start_tick.tv);
+      return tv.tv_sec * 1000000LL + tv.tv_usec;
+    }
+}
+
+/*
+ * tsc_ticks_to_nsec () - convert the ticks measured by tsc_elapsed_ticks to nanoseconds.
+ *
+ * return	      : Elapsed time (nanoseconds).
+ * elapsed_ticks (in) : Elapsed ticks.
+ */
+UINT64
+tsc_ticks_to_nsec (UINT64 elapsed_ticks)
+{
+  if (power_Savings == 0)
+    {
+      CHECK_CPU_FREQ (cpu_Clock_rate);
+      return (elapsed_ticks / cpu_Clock_rate) * 1000000000LL
+	+ ((elapsed_ticks % cpu_Clock_rate) * (TSC_UINT64) (1000000000)) / cpu_Clock_rate;
+    }
+  else
+    {
+      return elapsed_ticks * 1000;
+    }
+}
+
 /*
  * tsc_start_time_usec() - get the current Time Stamp Counter
  *   tck(out): current CPU ticks or timeval
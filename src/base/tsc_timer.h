@@ -52,6 +52,8 @@ extern void tsc_init (void);
 extern void tsc_getticks (TSC_TICKS * tck);
 extern void tsc_elapsed_time_usec (TSCTIMEVAL * tv, TSC_TICKS end_tick, TSC_TICKS start_tick);
 extern UINT64 tsc_elapsed_utime (TSC_TICKS end_tick, TSC_TICKS start_tick);
+extern UINT64 tsc_elapsed_ticks (TSC_TICKS end_tick, TSC_TICKS start_tick);
+extern UINT64 tsc_ticks_to_nsec (UINT64 elapsed_ticks);
 extern void tsc_start_time_usec (TSC_TICKS * tck);
 extern void tsc_end_time_usec (TSCTIMEVAL * tv, TSC_TICKS start_tick);
 
@@ -136,6 +136,7 @@ extern int xfile_apply_tde_to_class_files (THREAD_ENTRY * thread_p, const OID *
 
 extern int xtde_get_mk_info (THREAD_ENTRY * thread_p, int *mk_index, time_t * created_time, time_t * set_time);
 extern int xtde_change_mk_without_flock (THREAD_ENTRY * thread_p, const int mk_index);
+extern int xtde_rotate_dk_without_flock (THREAD_ENTRY * thread_p, int *dk_gen);
 
 extern TRAN_STATE xtran_server_commit (THREAD_ENTRY * thrd, bool retain_lock);
 extern TRAN_STATE xtran_server_abort (THREAD_ENTRY * thrd);
@@ -210,7 +211,7 @@ extern int xdisk_get_purpose_and_space_info (THREAD_ENTRY * thread_p, VOLID voli
 					     DISK_VOLUME_SPACE_INFO * space_info);
 
 extern int xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID volid, PAGEID pageid,
-				      char *page_bufp, int *page_sizep);
+				      char *page_bufp, int page_buf_size, int *page_sizep);
 
 /* new query interface */
 extern int xqmgr_prepare_query (THREAD_ENTRY * thrd, compile_context * ctx, xasl_stream * stream);
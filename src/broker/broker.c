@@ -41,6 +41,9 @@
 #include <netinet/tcp.h>
 #include <sys/time.h>
 #include <sys/un.h>
+#if defined(LINUX)
+#include <sys/epoll.h>
+#endif /* LINUX */
 #else
 #include  <io.h>
 #endif
@@ -242,6 +245,18 @@ static void proxy_check_worker (int br_index, T_PROXY_INFO * proxy_info_p);
 static void proxy_monitor_worker (T_PROXY_INFO * proxy_info_p, int br_index, int proxy_index);
 
 static THREAD_FUNC receiver_thr_f (void *arg);
+static int receiver_prepare_client (SOCKET clt_sock_fd);
+static void receiver_process_client (SOCKET clt_sock_fd, struct sockaddr_in *clt_sock_addr_p, char *cas_req_header,
+				     int *job_count_p);
+#if defined(LINUX)
+typedef struct t_pending_client T_PENDING_CLIENT;
+typedef struct t_pending_client_list T_PENDING_CLIENT_LIST;
+static int receiver_epoll_loop (int *job_count_p);
+static bool receiver_accept_clients (int ep_fd, T_PENDING_CLIENT_LIST * pending);
+static void receiver_read_client_header (int ep_fd, T_PENDING_CLIENT_LIST * pending, T_PENDING_CLIENT * client,
+					 int *job_count_p);
+static void receiver_remove_pending_client (int ep_fd, T_PENDING_CLIENT_LIST * pending, T_PENDING_CLIENT * client);
+#endif /* LINUX */
 static THREAD_FUNC dispatch_thr_f (void *arg);
 static THREAD_FUNC shard_dispatch_thr_f (void *arg);
 static THREAD_FUNC psize_check_thr_f (void *arg);
@@ -775,22 +790,13 @@ receiver_thr_f (void *arg)
   T_SOCKLEN clt_sock_addr_len;
   struct sockaddr_in clt_sock_addr;
   SOCKET clt_sock_fd;
-  int job_queue_size;
-  T_MAX_HEAP_NODE *job_queue;
-  T_MAX_HEAP_NODE new_job;
   int job_count;
   int read_len;
-  int one = 1;
   char cas_req_header[SRV_CON_CLIENT_INFO_SIZE];
-  char cas_client_type;
-  char driver_version;
-  T_BROKER_VERSION client_version;
 #if defined(LINUX)
   int timeout;
 #endif /* LINUX */
 
-  job_queue_size = shm_appl->job_queue_size;
-  job_queue = shm_appl->job_queue;
   job_count = 1;
 
 #if !defined(WINDOWS)
@@ -800,6 +806,12 @@ receiver_thr_f (void *arg)
 #if defined(LINUX)
   timeout = 5;
   setsockopt (sock_fd, IPPROTO_TCP, TCP_DEFER_ACCEPT, (char *) &timeout, sizeof (timeout));
+
+  if (receiver_epoll_loop (&job_count) == 0)
+    {
+      return NULL;
+    }
+  /* no epoll; accept and read the headers in line */
 #endif /* LINUX */
 
   while (process_flag)
@@ -811,257 +823,545 @@ receiver_thr_f (void *arg)
 	  continue;
 	}
 
-      if (shm_br->br_info[br_index].monitor_hang_flag && shm_br->br_info[br_index].reject_client_flag)
+      if (receiver_prepare_client (clt_sock_fd) < 0)
 	{
-	  shm_br->br_info[br_index].reject_client_count++;
-	  CLOSE_SOCKET (clt_sock_fd);
 	  continue;
 	}
 
-#if !defined(WINDOWS) && defined(ASYNC_MODE)
-      if (fcntl (clt_sock_fd, F_SETFL, FNDELAY) < 0)
+      /* read header */
+      read_len = read_nbytes_from_client (clt_sock_fd, cas_req_header, SRV_CON_CLIENT_INFO_SIZE);
+      if (read_len < 0)
 	{
 	  CLOSE_SOCKET (clt_sock_fd);
 	  continue;
 	}
+
+      receiver_process_client (clt_sock_fd, &clt_sock_addr, cas_req_header, &job_count);
+    }
+
+#if defined(WINDOWS)
+  return;
+#else
+  return NULL;
 #endif
+}
 
-      setsockopt (clt_sock_fd, IPPROTO_TCP, TCP_NODELAY, (char *) &one, sizeof (one));
-      ut_set_keepalive (clt_sock_fd);
+/*
+ * receiver_prepare_client () - check and set up an accepted client socket
+ *   return: 0, or -1 if the client is rejected and its socket closed
+ */
+static int
+receiver_prepare_client (SOCKET clt_sock_fd)
+{
+  int one = 1;
 
-      cas_client_type = CAS_CLIENT_NONE;
+  if (shm_br->br_info[br_index].monitor_hang_flag && shm_br->br_info[br_index].reject_client_flag)
+    {
+      shm_br->br_info[br_index].reject_client_count++;
+      CLOSE_SOCKET (clt_sock_fd);
+      return -1;
+    }
 
-      /* read header */
-      read_len = read_nbytes_from_client (clt_sock_fd, cas_req_header, SRV_CON_CLIENT_INFO_SIZE);
-      if (read_len < 0)
-	{
-	  CLOSE_SOCKET (clt_sock_fd);
-	  continue;
-	}
+#if !defined(WINDOWS) && defined(ASYNC_MODE)
+  if (fcntl (clt_sock_fd, F_SETFL, FNDELAY) < 0)
+    {
+      CLOSE_SOCKET (clt_sock_fd);
+      return -1;
+    }
+#endif
 
-      if (strncmp (cas_req_header, "PING", 4) == 0)
-	{
-	  int ret_code = 0;
-	  CAS_SEND_ERROR_CODE (clt_sock_fd, ret_code);
-	  CLOSE_SOCKET (clt_sock_fd);
-	  continue;
-	}
+  setsockopt (clt_sock_fd, IPPROTO_TCP, TCP_NODELAY, (char *) &one, sizeof (one));
+  ut_set_keepalive (clt_sock_fd);
 
-      if (strncmp (cas_req_header, "ST", 2) == 0)
-	{
-	  int status = FN_STATUS_NONE;
-	  int pid, i;
-	  unsigned int session_id;
+  return 0;
+}
 
-	  memcpy ((char *) &pid, cas_req_header + 2, 4);
-	  pid = ntohl (pid);
-	  memcpy ((char *) &session_id, cas_req_header + 6, 4);
-	  session_id = ntohl (session_id);
+/*
+ * receiver_process_client () - answer or queue a client whose connection header is read
+ *   return: nothing; the socket is closed or queued for a dispatcher
+ */
+static void
+receiver_process_client (SOCKET clt_sock_fd, struct sockaddr_in *clt_sock_addr_p, char *cas_req_header,
+			 int *job_count_p)
+{
+  int job_queue_size;
+  T_MAX_HEAP_NODE *job_queue;
+  T_MAX_HEAP_NODE new_job;
+  char cas_client_type;
+  char driver_version;
+  T_BROKER_VERSION client_version;
+
+  job_queue_size = shm_appl->job_queue_size;
+  job_queue = shm_appl->job_queue;
+
+  cas_client_type = CAS_CLIENT_NONE;
+
+  if (strncmp (cas_req_header, "PING", 4) == 0)
+    {
+      int ret_code = 0;
+      CAS_SEND_ERROR_CODE (clt_sock_fd, ret_code);
+      CLOSE_SOCKET (clt_sock_fd);
+      return;
+    }
+
+  if (strncmp (cas_req_header, "ST", 2) == 0)
+    {
+      int status = FN_STATUS_NONE;
+      int pid, i;
+      unsigned int session_id;
+
+      memcpy ((char *) &pid, cas_req_header + 2, 4);
+      pid = ntohl (pid);
+      memcpy ((char *) &session_id, cas_req_header + 6, 4);
+      session_id = ntohl (session_id);
 
-	  if (shm_br->br_info[br_index].shard_flag == OFF)
+      if (shm_br->br_info[br_index].shard_flag == OFF)
+	{
+	  for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
 	    {
-	      for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
+	      if (shm_appl->as_info[i].service_flag == SERVICE_ON && shm_appl->as_info[i].pid == pid)
 		{
-		  if (shm_appl->as_info[i].service_flag == SERVICE_ON && shm_appl->as_info[i].pid == pid)
+		  if (session_id == shm_appl->as_info[i].session_id)
 		    {
-		      if (session_id == shm_appl->as_info[i].session_id)
-			{
-			  status = shm_appl->as_info[i].fn_status;
-			}
-		      break;
+		      status = shm_appl->as_info[i].fn_status;
 		    }
+		  break;
 		}
 	    }
-
-	  CAS_SEND_ERROR_CODE (clt_sock_fd, status);
-	  CLOSE_SOCKET (clt_sock_fd);
-	  continue;
 	}
 
-      /*
-       * Query cancel message (size in bytes)
-       *
-       * - For client version 8.4.0 patch 1 or below:
-       *   |COMMAND("CANCEL",6)|PID(4)|
-       *
-       * - For CAS protocol version 1 or above:
-       *   |COMMAND("QC",2)|PID(4)|CLIENT_PORT(2)|RESERVED(2)|
-       *
-       *   CLIENT_PORT can be 0 if the client failed to get its local port.
-       */
-      else if (strncmp (cas_req_header, "QC", 2) == 0 || strncmp (cas_req_header, "CANCEL", 6) == 0
-	       || strncmp (cas_req_header, "X1", 2) == 0)
-	{
-	  int ret_code = 0;
+      CAS_SEND_ERROR_CODE (clt_sock_fd, status);
+      CLOSE_SOCKET (clt_sock_fd);
+      return;
+    }
+
+  /*
+   * Query cancel message (size in bytes)
+   *
+   * - For client version 8.4.0 patch 1 or below:
+   *   |COMMAND("CANCEL",6)|PID(4)|
+   *
+   * - For CAS protocol version 1 or above:
+   *   |COMMAND("QC",2)|PID(4)|CLIENT_PORT(2)|RESERVED(2)|
+   *
+   *   CLIENT_PORT can be 0 if the client failed to get its local port.
+   */
+  else if (strncmp (cas_req_header, "QC", 2) == 0 || strncmp (cas_req_header, "CANCEL", 6) == 0
+	   || strncmp (cas_req_header, "X1", 2) == 0)
+    {
+      int ret_code = 0;
 #if !defined(WINDOWS)
-	  int pid, i;
-	  unsigned short client_port = 0;
+      int pid, i;
+      unsigned short client_port = 0;
 #endif
 
 #if !defined(WINDOWS)
-	  if (cas_req_header[0] == 'Q')
-	    {
-	      memcpy ((char *) &pid, cas_req_header + 2, 4);
-	      memcpy ((char *) &client_port, cas_req_header + 6, 2);
-	      pid = ntohl (pid);
-	      client_port = ntohs (client_port);
-	    }
-	  else
-	    {
-	      memcpy ((char *) &pid, cas_req_header + 6, 4);
-	      pid = ntohl (pid);
-	    }
+      if (cas_req_header[0] == 'Q')
+	{
+	  memcpy ((char *) &pid, cas_req_header + 2, 4);
+	  memcpy ((char *) &client_port, cas_req_header + 6, 2);
+	  pid = ntohl (pid);
+	  client_port = ntohs (client_port);
+	}
+      else
+	{
+	  memcpy ((char *) &pid, cas_req_header + 6, 4);
+	  pid = ntohl (pid);
+	}
 
-	  ret_code = CAS_ER_QUERY_CANCEL;
-	  if (shm_br->br_info[br_index].shard_flag == OFF)
-	    {
+      ret_code = CAS_ER_QUERY_CANCEL;
+      if (shm_br->br_info[br_index].shard_flag == OFF)
+	{
 
-	      for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
+	  for (i = 0; i < shm_br->br_info[br_index].appl_server_max_num; i++)
+	    {
+	      if (shm_appl->as_info[i].service_flag == SERVICE_ON && shm_appl->as_info[i].pid == pid
+		  && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY)
 		{
-		  if (shm_appl->as_info[i].service_flag == SERVICE_ON && shm_appl->as_info[i].pid == pid
-		      && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY)
+		  if (cas_req_header[0] == 'Q' && client_port > 0
+		      && shm_appl->as_info[i].cas_clt_port != client_port
+		      && memcmp (&shm_appl->as_info[i].cas_clt_ip, &clt_sock_addr_p->sin_addr, 4) != 0)
 		    {
-		      if (cas_req_header[0] == 'Q' && client_port > 0
-			  && shm_appl->as_info[i].cas_clt_port != client_port
-			  && memcmp (&shm_appl->as_info[i].cas_clt_ip, &clt_sock_addr.sin_addr, 4) != 0)
-			{
-			  continue;
-			}
-
-		      ret_code = 0;
-		      kill (pid, SIGUSR1);
-		      break;
+		      continue;
 		    }
+
+		  ret_code = 0;
+		  kill (pid, SIGUSR1);
+		  break;
 		}
 	    }
-	  else
-	    {
-	      /* SHARD TODO : not implemented yet */
-	    }
+	}
+      else
+	{
+	  /* SHARD TODO : not implemented yet */
+	}
 #endif
-	  if (cas_req_header[0] == 'X')
-	    {
-	      char driver_info[SRV_CON_CLIENT_INFO_SIZE];
+      if (cas_req_header[0] == 'X')
+	{
+	  char driver_info[SRV_CON_CLIENT_INFO_SIZE];
 
-	      driver_info[SRV_CON_MSG_IDX_PROTO_VERSION] = cas_req_header[2];
-	      driver_info[SRV_CON_MSG_IDX_FUNCTION_FLAG] = cas_req_header[3];
-	      send_error_to_driver (clt_sock_fd, ret_code, driver_info);
-	    }
-	  else
-	    {
-	      ret_code = CAS_CONV_ERROR_TO_OLD (ret_code);
-	      CAS_SEND_ERROR_CODE (clt_sock_fd, ret_code);
-	    }
-	  CLOSE_SOCKET (clt_sock_fd);
-	  continue;
+	  driver_info[SRV_CON_MSG_IDX_PROTO_VERSION] = cas_req_header[2];
+	  driver_info[SRV_CON_MSG_IDX_FUNCTION_FLAG] = cas_req_header[3];
+	  send_error_to_driver (clt_sock_fd, ret_code, driver_info);
 	}
+      else
+	{
+	  ret_code = CAS_CONV_ERROR_TO_OLD (ret_code);
+	  CAS_SEND_ERROR_CODE (clt_sock_fd, ret_code);
+	}
+      CLOSE_SOCKET (clt_sock_fd);
+      return;
+    }
+
+  cas_client_type = cas_req_header[SRV_CON_MSG_IDX_CLIENT_TYPE];
+  if (!(strncmp (cas_req_header, SRV_CON_CLIENT_MAGIC_STR, SRV_CON_CLIENT_MAGIC_LEN) == 0
+	|| strncmp (cas_req_header, SRV_CON_CLIENT_MAGIC_STR_SSL, SRV_CON_CLIENT_MAGIC_LEN) == 0)
+      || cas_client_type < CAS_CLIENT_TYPE_MIN || cas_client_type > CAS_CLIENT_TYPE_MAX)
+    {
+      send_error_to_driver (clt_sock_fd, CAS_ER_NOT_AUTHORIZED_CLIENT, cas_req_header);
+      CLOSE_SOCKET (clt_sock_fd);
+      return;
+    }
 
-      cas_client_type = cas_req_header[SRV_CON_MSG_IDX_CLIENT_TYPE];
-      if (!(strncmp (cas_req_header, SRV_CON_CLIENT_MAGIC_STR, SRV_CON_CLIENT_MAGIC_LEN) == 0
-	    || strncmp (cas_req_header, SRV_CON_CLIENT_MAGIC_STR_SSL, SRV_CON_CLIENT_MAGIC_LEN) == 0)
-	  || cas_client_type < CAS_CLIENT_TYPE_MIN || cas_client_type > CAS_CLIENT_TYPE_MAX)
+  if ((IS_SSL_CLIENT (cas_req_header) && shm_br->br_info[br_index].use_SSL == OFF)
+      || (!IS_SSL_CLIENT (cas_req_header) && shm_br->br_info[br_index].use_SSL == ON))
+    {
+      send_error_to_driver (clt_sock_fd, CAS_ER_SSL_TYPE_NOT_ALLOWED, cas_req_header);
+      CLOSE_SOCKET (clt_sock_fd);
+      return;
+    }
+
+  driver_version = cas_req_header[SRV_CON_MSG_IDX_PROTO_VERSION];
+  if (driver_version & CAS_PROTO_INDICATOR)
+    {
+      /* Protocol version */
+      client_version = CAS_PROTO_UNPACK_NET_VER (driver_version);
+    }
+  else
+    {
+      /* Build version; major, minor, and patch */
+      client_version =
+	CAS_MAKE_VER (cas_req_header[SRV_CON_MSG_IDX_MAJOR_VER], cas_req_header[SRV_CON_MSG_IDX_MINOR_VER],
+		      cas_req_header[SRV_CON_MSG_IDX_PATCH_VER]);
+    }
+
+  if (br_shard_flag == ON)
+    {
+      /* SHARD ONLY SUPPORT client_version.8.2.0 ~ */
+      if (client_version < CAS_MAKE_VER (8, 2, 0))
 	{
-	  send_error_to_driver (clt_sock_fd, CAS_ER_NOT_AUTHORIZED_CLIENT, cas_req_header);
+	  CAS_SEND_ERROR_CODE (clt_sock_fd, CAS_ER_COMMUNICATION);
 	  CLOSE_SOCKET (clt_sock_fd);
-	  continue;
+	  return;
 	}
+    }
+
+  if (v3_acl != NULL)
+    {
+      unsigned char ip_addr[4];
+
+      memcpy (ip_addr, &(clt_sock_addr_p->sin_addr), 4);
 
-      if ((IS_SSL_CLIENT (cas_req_header) && shm_br->br_info[br_index].use_SSL == OFF)
-	  || (!IS_SSL_CLIENT (cas_req_header) && shm_br->br_info[br_index].use_SSL == ON))
+      if (uw_acl_check (ip_addr) < 0)
 	{
-	  send_error_to_driver (clt_sock_fd, CAS_ER_SSL_TYPE_NOT_ALLOWED, cas_req_header);
+	  send_error_to_driver (clt_sock_fd, CAS_ER_NOT_AUTHORIZED_CLIENT, cas_req_header);
 	  CLOSE_SOCKET (clt_sock_fd);
-	  continue;
+	  return;
 	}
+    }
 
-      driver_version = cas_req_header[SRV_CON_MSG_IDX_PROTO_VERSION];
-      if (driver_version & CAS_PROTO_INDICATOR)
+  if (job_queue[0].id == job_queue_size)
+    {
+      send_error_to_driver (clt_sock_fd, CAS_ER_FREE_SERVER, cas_req_header);
+      CLOSE_SOCKET (clt_sock_fd);
+      return;
+    }
+
+  if (max_open_fd < clt_sock_fd)
+    {
+      max_open_fd = clt_sock_fd;
+    }
+
+  *job_count_p = (*job_count_p >= JOB_COUNT_MAX) ? 1 : *job_count_p + 1;
+  new_job.id = *job_count_p;
+  new_job.clt_sock_fd = clt_sock_fd;
+  new_job.recv_time = time (NULL);
+  gettimeofday (&new_job.recv_tv, NULL);
+  new_job.priority = 0;
+  new_job.script[0] = '\0';
+  new_job.cas_client_type = cas_client_type;
+  new_job.port = ntohs (clt_sock_addr_p->sin_port);
+  memcpy (new_job.ip_addr, &(clt_sock_addr_p->sin_addr), 4);
+  strcpy (new_job.prg_name, cas_client_type_str[(int) cas_client_type]);
+  new_job.clt_version = client_version;
+  memcpy (new_job.driver_info, cas_req_header, SRV_CON_CLIENT_INFO_SIZE);
+
+  while (1)
+    {
+      pthread_mutex_lock (&clt_table_mutex);
+      if (max_heap_insert (job_queue, job_queue_size, &new_job) < 0)
 	{
-	  /* Protocol version */
-	  client_version = CAS_PROTO_UNPACK_NET_VER (driver_version);
+	  pthread_mutex_unlock (&clt_table_mutex);
+	  SLEEP_MILISEC (0, 100);
 	}
       else
 	{
-	  /* Build version; major, minor, and patch */
-	  client_version =
-	    CAS_MAKE_VER (cas_req_header[SRV_CON_MSG_IDX_MAJOR_VER], cas_req_header[SRV_CON_MSG_IDX_MINOR_VER],
-			  cas_req_header[SRV_CON_MSG_IDX_PATCH_VER]);
+	  pthread_cond_signal (&clt_table_cond);
+	  pthread_mutex_unlock (&clt_table_mutex);
+	  break;
 	}
+    }
+}
 
-      if (br_shard_flag == ON)
+#if defined(LINUX)
+/*
+ * On Linux, the receiver does not wait in line for the connection header of each client: a client that connected
+ * and sent nothing would keep the others from connecting until it timed out. The accepted clients wait in an
+ * edge-triggered epoll set until their header arrived, and the listener is drained of all pending connections at each
+ * event. The clients waiting for their header are listed in accept order, so the ones that took longer than the read
+ * timeout are found at the head.
+ */
+#define RECEIVER_MAX_EVENTS             256
+#define RECEIVER_HEADER_TIMEOUT_SEC     60	/* as read_from_client */
+
+struct t_pending_client
+{
+  SOCKET clt_sock_fd;
+  struct sockaddr_in clt_sock_addr;
+  time_t accept_time;
+  int read_len;
+  char cas_req_header[SRV_CON_CLIENT_INFO_SIZE];
+  T_PENDING_CLIENT *prev;
+  T_PENDING_CLIENT *next;
+};
+
+struct t_pending_client_list
+{
+  T_PENDING_CLIENT *head;	/* oldest */
+  T_PENDING_CLIENT *tail;
+};
+
+/*
+ * receiver_epoll_loop () - receive clients until the broker stops
+ *   return: 0, or -1 if epoll could not be set up and nothing was changed
+ */
+static int
+receiver_epoll_loop (int *job_count_p)
+{
+  struct epoll_event events[RECEIVER_MAX_EVENTS];
+  struct epoll_event ev;
+  T_PENDING_CLIENT_LIST pending = { NULL, NULL };
+  bool need_accept = false;
+  time_t now;
+  int ep_fd, flags, n, i;
+
+  ep_fd = epoll_create (RECEIVER_MAX_EVENTS);
+  if (ep_fd < 0)
+    {
+      return -1;
+    }
+
+  flags = fcntl (sock_fd, F_GETFL);
+  if (flags < 0 || fcntl (sock_fd, F_SETFL, flags | O_NONBLOCK) < 0)
+    {
+      close (ep_fd);
+      return -1;
+    }
+
+  memset (&ev, 0, sizeof (ev));
+  ev.events = EPOLLIN | EPOLLET;
+  ev.data.ptr = NULL;		/* listener */
+  if (epoll_ctl (ep_fd, EPOLL_CTL_ADD, sock_fd, &ev) < 0)
+    {
+      (void) fcntl (sock_fd, F_SETFL, flags);
+      close (ep_fd);
+      return -1;
+    }
+
+  while (process_flag)
+    {
+      n = epoll_wait (ep_fd, events, RECEIVER_MAX_EVENTS, 1000);
+
+      for (i = 0; i < n; i++)
 	{
-	  /* SHARD ONLY SUPPORT client_version.8.2.0 ~ */
-	  if (client_version < CAS_MAKE_VER (8, 2, 0))
+	  if (events[i].data.ptr == NULL)
 	    {
-	      CAS_SEND_ERROR_CODE (clt_sock_fd, CAS_ER_COMMUNICATION);
-	      CLOSE_SOCKET (clt_sock_fd);
-	      continue;
+	      need_accept = true;
+	    }
+	  else
+	    {
+	      receiver_read_client_header (ep_fd, &pending, (T_PENDING_CLIENT *) events[i].data.ptr, job_count_p);
 	    }
 	}
 
-      if (v3_acl != NULL)
+      if (need_accept)
 	{
-	  unsigned char ip_addr[4];
+	  /* still true if accept failed before the listener was drained; it gets no new edge for those */
+	  need_accept = receiver_accept_clients (ep_fd, &pending);
+	}
+
+      now = time (NULL);
+      while (pending.head != NULL && now - pending.head->accept_time > RECEIVER_HEADER_TIMEOUT_SEC)
+	{
+	  T_PENDING_CLIENT *client = pending.head;
+
+	  receiver_remove_pending_client (ep_fd, &pending, client);
+	  CLOSE_SOCKET (client->clt_sock_fd);
+	  free (client);
+	}
+    }
+
+  while (pending.head != NULL)
+    {
+      T_PENDING_CLIENT *client = pending.head;
+
+      receiver_remove_pending_client (ep_fd, &pending, client);
+      CLOSE_SOCKET (client->clt_sock_fd);
+      free (client);
+    }
+  close (ep_fd);
 
-	  memcpy (ip_addr, &(clt_sock_addr.sin_addr), 4);
+  return 0;
+}
+
+/*
+ * receiver_accept_clients () - accept all pending connections of the listener
+ *   return: true if the listener may still have connections to accept
+ */
+static bool
+receiver_accept_clients (int ep_fd, T_PENDING_CLIENT_LIST * pending)
+{
+  T_SOCKLEN clt_sock_addr_len;
+  struct sockaddr_in clt_sock_addr;
+  struct epoll_event ev;
+  SOCKET clt_sock_fd;
+  T_PENDING_CLIENT *client;
 
-	  if (uw_acl_check (ip_addr) < 0)
+  while (process_flag)
+    {
+      clt_sock_addr_len = sizeof (clt_sock_addr);
+      clt_sock_fd = accept (sock_fd, (struct sockaddr *) &clt_sock_addr, &clt_sock_addr_len);
+      if (IS_INVALID_SOCKET (clt_sock_fd))
+	{
+	  if (errno == EINTR || errno == ECONNABORTED)
 	    {
-	      send_error_to_driver (clt_sock_fd, CAS_ER_NOT_AUTHORIZED_CLIENT, cas_req_header);
-	      CLOSE_SOCKET (clt_sock_fd);
 	      continue;
 	    }
+	  /* drained, or out of descriptors; then try again later */
+	  return (errno != EAGAIN && errno != EWOULDBLOCK);
+	}
+
+      if (receiver_prepare_client (clt_sock_fd) < 0)
+	{
+	  continue;
 	}
 
-      if (job_queue[0].id == job_queue_size)
+      client = (T_PENDING_CLIENT *) malloc (sizeof (T_PENDING_CLIENT));
+      if (client == NULL)
 	{
-	  send_error_to_driver (clt_sock_fd, CAS_ER_FREE_SERVER, cas_req_header);
 	  CLOSE_SOCKET (clt_sock_fd);
 	  continue;
 	}
+      client->clt_sock_fd = clt_sock_fd;
+      client->clt_sock_addr = clt_sock_addr;
+      client->accept_time = time (NULL);
+      client->read_len = 0;
 
-      if (max_open_fd < clt_sock_fd)
+      memset (&ev, 0, sizeof (ev));
+      ev.events = EPOLLIN | EPOLLRDHUP | EPOLLET;
+      ev.data.ptr = client;
+      if (epoll_ctl (ep_fd, EPOLL_CTL_ADD, clt_sock_fd, &ev) < 0)
 	{
-	  max_open_fd = clt_sock_fd;
+	  CLOSE_SOCKET (clt_sock_fd);
+	  free (client);
+	  continue;
 	}
 
-      job_count = (job_count >= JOB_COUNT_MAX) ? 1 : job_count + 1;
-      new_job.id = job_count;
-      new_job.clt_sock_fd = clt_sock_fd;
-      new_job.recv_time = time (NULL);
-      new_job.priority = 0;
-      new_job.script[0] = '\0';
-      new_job.cas_client_type = cas_client_type;
-      new_job.port = ntohs (clt_sock_addr.sin_port);
-      memcpy (new_job.ip_addr, &(clt_sock_addr.sin_addr), 4);
-      strcpy (new_job.prg_name, cas_client_type_str[(int) cas_client_type]);
-      new_job.clt_version = client_version;
-      memcpy (new_job.driver_info, cas_req_header, SRV_CON_CLIENT_INFO_SIZE);
+      client->prev = pending->tail;
+      client->next = NULL;
+      if (pending->tail != NULL)
+	{
+	  pending->tail->next = client;
+	}
+      else
+	{
+	  pending->head = client;
+	}
+      pending->tail = client;
+    }
 
-      while (1)
+  return false;
+}
+
+/*
+ * receiver_read_client_header () - read what arrived of a client connection header, process the client once it is
+ *                                  complete
+ */
+static void
+receiver_read_client_header (int ep_fd, T_PENDING_CLIENT_LIST * pending, T_PENDING_CLIENT * client,
+			     int *job_count_p)
+{
+  ssize_t read_len;
+
+  while (client->read_len < SRV_CON_CLIENT_INFO_SIZE)
+    {
+      read_len = recv (client->clt_sock_fd, client->cas_req_header + client->read_len,
+		       SRV_CON_CLIENT_INFO_SIZE - client->read_len, MSG_DONTWAIT);
+      if (read_len > 0)
 	{
-	  pthread_mutex_lock (&clt_table_mutex);
-	  if (max_heap_insert (job_queue, job_queue_size, &new_job) < 0)
-	    {
-	      pthread_mutex_unlock (&clt_table_mutex);
-	      SLEEP_MILISEC (0, 100);
-	    }
-	  else
-	    {
-	      pthread_cond_signal (&clt_table_cond);
-	      pthread_mutex_unlock (&clt_table_mutex);
-	      break;
-	    }
+	  client->read_len += (int) read_len;
+	  continue;
+	}
+      if (read_len < 0 && errno == EINTR)
+	{
+	  continue;
 	}
+      if (read_len < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+	{
+	  /* wait for the rest */
+	  return;
+	}
+
+      /* closed or failed */
+      receiver_remove_pending_client (ep_fd, pending, client);
+      CLOSE_SOCKET (client->clt_sock_fd);
+      free (client);
+      return;
     }
 
-#if defined(WINDOWS)
-  return;
-#else
-  return NULL;
-#endif
+  receiver_remove_pending_client (ep_fd, pending, client);
+  receiver_process_client (client->clt_sock_fd, &client->clt_sock_addr, client->cas_req_header, job_count_p);
+  free (client);
 }
 
+static void
+receiver_remove_pending_client (int ep_fd, T_PENDING_CLIENT_LIST * pending, T_PENDING_CLIENT * client)
+{
+  struct epoll_event ev;
+
+  memset (&ev, 0, sizeof (ev));
+  (void) epoll_ctl (ep_fd, EPOLL_CTL_DEL, client->clt_sock_fd, &ev);
+
+  if (client->prev != NULL)
+    {
+      client->prev->next = client->next;
+    }
+  else
+    {
+      pending->head = client->next;
+    }
+  if (client->next != NULL)
+    {
+      client->next->prev = client->prev;
+    }
+  else
+    {
+      pending->tail = client->prev;
+    }
+  client->prev = client->next = NULL;
+}
+#endif /* LINUX */
+
 static THREAD_FUNC
 shard_dispatch_thr_f (void *arg)
 {
@@ -1215,6 +1515,15 @@ dispatch_thr_f (void *arg)
 
       hold_job = 0;
 
+      {
+	struct timeval dispatch_tv;
+
+	/* dispatcher is the only writer of queue wait histogram */
+	gettimeofday (&dispatch_tv, NULL);
+	broker_shm_add_latency (&shm_appl->as_info[as_index].latency_hist[CAS_LATENCY_QUEUE_WAIT],
+				&cur_job.recv_tv, &dispatch_tv);
+      }
+
       shm_appl->as_info[as_index].num_connect_requests++;
 #if !defined(WIN_FW)
       shm_appl->as_info[as_index].clt_version = cur_job.clt_version;
@@ -2754,7 +3063,12 @@ find_idle_cas (void)
 	  wait_cas_id = -1;
 	  break;
 	}
-      if (shm_br->br_info[br_index].appl_server_num == shm_br->br_info[br_index].appl_server_max_num
+      /* in KEEP_CONNECTION AUTO, a CAS with its client out of transaction is reclaimed for the waiting client when no
+       * CAS can be added, or when the client has not used it for CAS_RECLAIM_IDLE_TIME. the client that lost it
+       * reconnects to another CAS at its next request. */
+      if ((shm_br->br_info[br_index].appl_server_num == shm_br->br_info[br_index].appl_server_max_num
+	   || (shm_br->br_info[br_index].cas_reclaim_idle_time > 0
+	       && cur_time - shm_appl->as_info[i].last_access_time >= shm_br->br_info[br_index].cas_reclaim_idle_time))
 	  && shm_appl->as_info[i].uts_status == UTS_STATUS_BUSY && shm_appl->as_info[i].cur_keep_con == KEEP_CON_AUTO
 	  && shm_appl->as_info[i].con_status == CON_STATUS_OUT_TRAN && shm_appl->as_info[i].num_holdable_results < 1
 	  && shm_appl->as_info[i].cas_change_mode == CAS_CHANGE_MODE_AUTO)
@@ -1906,6 +1906,18 @@ admin_conf_change (int master_shm_id, const char *br_name, const char *conf_name
 	}
       br_info_p->time_to_kill = time_to_kill;
     }
+  else if (strcasecmp (conf_name, "CAS_RECLAIM_IDLE_TIME") == 0)
+    {
+      int cas_reclaim_idle_time;
+
+      cas_reclaim_idle_time = (int) ut_time_string_to_sec (conf_value, "sec");
+      if (cas_reclaim_idle_time < 0)
+	{
+	  sprintf (admin_err_msg, "invalid value : %s", conf_value);
+	  goto set_conf_error;
+	}
+      br_info_p->cas_reclaim_idle_time = cas_reclaim_idle_time;
+    }
   else if (strcasecmp (conf_name, "ACCESS_LOG") == 0)
     {
       int access_log_flag;
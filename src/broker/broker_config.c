@@ -597,6 +597,15 @@ broker_config_read_internal (const char *conf_file, T_BROKER_INFO * br_info, int
 	  goto conf_error;
 	}
 
+      strncpy_bufsize (time_str,
+		       ini_getstr (ini, sec_name, "CAS_RECLAIM_IDLE_TIME", DEFAULT_CAS_RECLAIM_IDLE_TIME, &lineno));
+      br_info[num_brs].cas_reclaim_idle_time = (int) ut_time_string_to_sec (time_str, "sec");
+      if (br_info[num_brs].cas_reclaim_idle_time < 0)
+	{
+	  errcode = PARAM_BAD_VALUE;
+	  goto conf_error;
+	}
+
       br_info[num_brs].access_log =
 	conf_get_value_table_on_off (ini_getstr (ini, sec_name, "ACCESS_LOG", "OFF", &lineno));
       if (br_info[num_brs].access_log < 0)
@@ -1239,6 +1248,7 @@ broker_config_dump (FILE * fp, const T_BROKER_INFO * br_info, int num_broker, in
 	}
       fprintf (fp, "JOB_QUEUE_SIZE\t\t=%d\n", br_info[i].job_queue_size);
       fprintf (fp, "TIME_TO_KILL\t\t=%d\n", br_info[i].time_to_kill);
+      fprintf (fp, "CAS_RECLAIM_IDLE_TIME\t=%d\n", br_info[i].cas_reclaim_idle_time);
       tmp_str = get_conf_string (br_info[i].access_log, tbl_on_off);
       if (tmp_str)
 	{
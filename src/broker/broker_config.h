@@ -69,6 +69,7 @@
 #define	DEFAULT_SERVER_HARD_LIMIT	"1G"
 
 #define	DEFAULT_TIME_TO_KILL	"2min"
+#define	DEFAULT_CAS_RECLAIM_IDLE_TIME	"0"
 #define SQL_LOG_TIME_MAX	-1
 
 #define CONF_ERR_LOG_NONE       0x00
@@ -200,6 +201,7 @@ struct t_broker_info
   int mysql_keepalive_interval;
   int job_queue_size;
   int time_to_kill;
+  int cas_reclaim_idle_time;	/* sec, 0 if CAS is reclaimed only when no CAS can be added */
   int err_code;
   int os_err_code;
   int sql_log_max_size;
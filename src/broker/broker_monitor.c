@@ -91,6 +91,8 @@
 #define         METADATA_MONITOR_FLAG_MASK   0x08
 #define         CLIENT_MONITOR_FLAG_MASK     0x10
 #define         UNUSABLE_DATABASES_FLAG_MASK 0x20
+#define         LATENCY_MONITOR_FLAG_MASK    0x40
+#define         LATENCY_EXPOSITION_FLAG_MASK 0x80
 
 #if defined(WINDOWS) && !defined(PRId64)
 #define PRId64 "lld"
@@ -358,6 +360,11 @@ static void endwin ();
 static int metadata_monitor (double elapsed_time);
 static int client_monitor (void);
 static int unusable_databases_monitor (void);
+static int latency_monitor (char *br_vector);
+static int latency_exposition_monitor (char *br_vector);
+static void latency_hist_merge (T_CAS_LATENCY_HIST * dest, const T_CAS_LATENCY_HIST * src);
+static void latency_hist_print (const T_CAS_LATENCY_HIST * hist);
+static void latency_hist_print_exposition (const T_CAS_LATENCY_HIST * hist, const char *labels);
 
 static T_SHM_BROKER *shm_br;
 static bool display_job_queue = false;
@@ -612,6 +619,20 @@ main (int argc, char **argv)
 	      unusable_databases_monitor ();
 	    }
 
+	  if (monitor_flag & LATENCY_MONITOR_FLAG_MASK)
+	    {
+	      if ((monitor_flag & ~LATENCY_MONITOR_FLAG_MASK) != 0)
+		{
+		  print_newline ();
+		}
+	      latency_monitor (br_vector);
+	    }
+
+	  if (monitor_flag & LATENCY_EXPOSITION_FLAG_MASK)
+	    {
+	      latency_exposition_monitor (br_vector);
+	    }
+
 	  if (monitor_flag == 0)
 	    {
 	      appl_monitor (br_vector, elapsed_time);
@@ -687,12 +708,14 @@ main (int argc, char **argv)
 static void
 print_usage (void)
 {
-  printf ("broker_monitor [-b] [-q] [-t] [-s <sec>] [-S] [-P] [-m] [-c] [-u] [-f] [<expr>]\n");
+  printf ("broker_monitor [-b] [-q] [-t] [-s <sec>] [-S] [-P] [-m] [-c] [-u] [-L] [-e] [-f] [<expr>]\n");
   printf ("\t<expr> part of broker name or SERVICE=[ON|OFF]\n");
   printf ("\t-q display job queue\n");
   printf ("\t-m display shard statistics information\n");
   printf ("\t-c display client information\n");
   printf ("\t-u display unusable database server\n");
+  printf ("\t-L display request latency (queue wait, prepare, execute, fetch)\n");
+  printf ("\t-e print request latency histograms in Prometheus text format\n");
   printf ("\t-b brief mode (show broker info)\n");
   printf ("\t-S brief mode (show sharddb info)\n");
   printf ("\t-P brief mode (show proxy info)\n");
@@ -710,7 +733,7 @@ get_args (int argc, char *argv[], char *br_vector)
   regex_t re;
 #endif
 
-  char optchars[] = "hbqts:l:fmcSPu";
+  char optchars[] = "hbqts:l:fmcSPuLe";
 
   display_job_queue = false;
   refresh_sec = 0;
@@ -759,6 +782,12 @@ get_args (int argc, char *argv[], char *br_vector)
 	case 'u':
 	  monitor_flag |= UNUSABLE_DATABASES_FLAG_MASK;
 	  break;
+	case 'L':
+	  monitor_flag |= LATENCY_MONITOR_FLAG_MASK;
+	  break;
+	case 'e':
+	  monitor_flag |= LATENCY_EXPOSITION_FLAG_MASK;
+	  break;
 	case 'h':
 	case '?':
 	  print_usage ();
@@ -2533,6 +2562,245 @@ unusable_databases_monitor (void)
   return 0;
 }
 
+static const char *latency_type_name[CAS_LATENCY_TYPE_COUNT] = { "queue_wait", "prepare", "execute", "fetch" };
+
+static int
+latency_monitor (char *br_vector)
+{
+  T_SHM_APPL_SERVER *shm_appl = NULL;
+  T_CAS_LATENCY_HIST hist;
+  int i, j, type;
+
+  str_out ("%-20s %-12s %12s %10s %8s %8s %8s", "NAME", "TYPE", "COUNT", "AVG(ms)", "P50(ms)", "P90(ms)", "P99(ms)");
+  print_newline ();
+  for (i = 0; i < 84; i++)
+    {
+      str_out ("%s", "=");
+    }
+  print_newline ();
+
+  for (i = 0; i < shm_br->num_broker; i++)
+    {
+      if (br_vector[i] == 0)
+	{
+	  continue;
+	}
+
+      if (shm_br->br_info[i].service_flag != SERVICE_ON)
+	{
+	  str_out ("*%-19s %s", shm_br->br_info[i].name, "OFF");
+	  print_newline ();
+	  continue;
+	}
+
+      shm_appl =
+	(T_SHM_APPL_SERVER *) uw_shm_open (shm_br->br_info[i].appl_server_shm_id, SHM_APPL_SERVER, SHM_MODE_MONITOR);
+      if (shm_appl == NULL)
+	{
+	  str_out ("*%-19s %s", shm_br->br_info[i].name, "shared memory open error");
+	  print_newline ();
+	  continue;
+	}
+
+      for (type = 0; type < CAS_LATENCY_TYPE_COUNT; type++)
+	{
+	  memset (&hist, 0, sizeof (hist));
+	  for (j = 0; j < shm_br->br_info[i].appl_server_max_num; j++)
+	    {
+	      latency_hist_merge (&hist, &shm_appl->as_info[j].latency_hist[type]);
+	    }
+
+	  str_out ("*%-19s %-12s", shm_br->br_info[i].name, latency_type_name[type]);
+	  latency_hist_print (&hist);
+	  print_newline ();
+	}
+
+      if (full_info_flag)
+	{
+	  char name[32];
+
+	  for (j = 0; j < shm_br->br_info[i].appl_server_max_num; j++)
+	    {
+	      if (shm_appl->as_info[j].service_flag != SERVICE_ON)
+		{
+		  continue;
+		}
+
+	      snprintf (name, sizeof (name), "  %s_%d", shm_br->br_info[i].name, j + 1);
+	      for (type = 0; type < CAS_LATENCY_TYPE_COUNT; type++)
+		{
+		  str_out ("%-20s %-12s", name, latency_type_name[type]);
+		  latency_hist_print (&shm_appl->as_info[j].latency_hist[type]);
+		  print_newline ();
+		}
+	    }
+	}
+
+      uw_shm_detach (shm_appl);
+    }
+
+  return 0;
+}
+
+/*
+ * latency_exposition_monitor - print the latency histograms in the Prometheus text exposition format, so that they
+ *				can be scraped through a textfile collector
+ */
+static int
+latency_exposition_monitor (char *br_vector)
+{
+  T_SHM_APPL_SERVER *shm_appl = NULL;
+  T_CAS_LATENCY_HIST hist;
+  char labels[256];
+  int i, j, type;
+
+  str_out ("# HELP cubrid_broker_request_latency_seconds Latency of the requests handled by broker.");
+  print_newline ();
+  str_out ("# TYPE cubrid_broker_request_latency_seconds histogram");
+  print_newline ();
+
+  for (i = 0; i < shm_br->num_broker; i++)
+    {
+      if (br_vector[i] == 0 || shm_br->br_info[i].service_flag != SERVICE_ON)
+	{
+	  continue;
+	}
+
+      shm_appl =
+	(T_SHM_APPL_SERVER *) uw_shm_open (shm_br->br_info[i].appl_server_shm_id, SHM_APPL_SERVER, SHM_MODE_MONITOR);
+      if (shm_appl == NULL)
+	{
+	  continue;
+	}
+
+      for (type = 0; type < CAS_LATENCY_TYPE_COUNT; type++)
+	{
+	  if (full_info_flag)
+	    {
+	      for (j = 0; j < shm_br->br_info[i].appl_server_max_num; j++)
+		{
+		  if (shm_appl->as_info[j].service_flag != SERVICE_ON)
+		    {
+		      continue;
+		    }
+
+		  snprintf (labels, sizeof (labels), "broker=\"%s\",cas=\"%d\",type=\"%s\"", shm_br->br_info[i].name,
+			    j + 1, latency_type_name[type]);
+		  latency_hist_print_exposition (&shm_appl->as_info[j].latency_hist[type], labels);
+		}
+	    }
+	  else
+	    {
+	      memset (&hist, 0, sizeof (hist));
+	      for (j = 0; j < shm_br->br_info[i].appl_server_max_num; j++)
+		{
+		  latency_hist_merge (&hist, &shm_appl->as_info[j].latency_hist[type]);
+		}
+
+	      snprintf (labels, sizeof (labels), "broker=\"%s\",type=\"%s\"", shm_br->br_info[i].name,
+			latency_type_name[type]);
+	      latency_hist_print_exposition (&hist, labels);
+	    }
+	}
+
+      uw_shm_detach (shm_appl);
+    }
+
+  return 0;
+}
+
+static void
+latency_hist_merge (T_CAS_LATENCY_HIST * dest, const T_CAS_LATENCY_HIST * src)
+{
+  int i;
+
+  for (i = 0; i < CAS_LATENCY_NUM_BUCKETS; i++)
+    {
+      dest->bucket[i] += src->bucket[i];
+    }
+  dest->count += src->count;
+  dest->sum_usec += src->sum_usec;
+}
+
+/*
+ * latency_hist_print - print count, average and percentiles of a histogram
+ *
+ * A percentile is printed as the upper bound of the bucket it falls in.
+ */
+static void
+latency_hist_print (const T_CAS_LATENCY_HIST * hist)
+{
+  static const int percentiles[] = { 50, 90, 99 };
+  INT64 count = 0, cumulative, bound;
+  int i, p;
+
+  /* histogram is updated without lock; count buckets instead of trusting count */
+  for (i = 0; i < CAS_LATENCY_NUM_BUCKETS; i++)
+    {
+      count += hist->bucket[i];
+    }
+
+  str_out (" %12lld", (long long) count);
+  if (count == 0)
+    {
+      str_out (" %10s %8s %8s %8s", "-", "-", "-", "-");
+      return;
+    }
+
+  str_out (" %10.3f", (double) hist->sum_usec / 1000.0 / (double) count);
+
+  for (p = 0; p < (int) DIM (percentiles); p++)
+    {
+      cumulative = 0;
+      for (i = 0; i < CAS_LATENCY_NUM_BUCKETS - 1; i++)
+	{
+	  cumulative += hist->bucket[i];
+	  if (cumulative * 100 >= count * percentiles[p])
+	    {
+	      break;
+	    }
+	}
+
+      bound = broker_shm_latency_bucket_bound_msec (i);
+      if (bound < 0)
+	{
+	  str_out (" %8s", "INF");
+	}
+      else
+	{
+	  str_out (" %8lld", (long long) bound);
+	}
+    }
+}
+
+static void
+latency_hist_print_exposition (const T_CAS_LATENCY_HIST * hist, const char *labels)
+{
+  INT64 cumulative = 0, bound;
+  int i;
+
+  for (i = 0; i < CAS_LATENCY_NUM_BUCKETS; i++)
+    {
+      cumulative += hist->bucket[i];
+      bound = broker_shm_latency_bucket_bound_msec (i);
+      if (bound < 0)
+	{
+	  str_out ("cubrid_broker_request_latency_seconds_bucket{%s,le=\"+Inf\"} %lld", labels, (long long) cumulative);
+	}
+      else
+	{
+	  str_out ("cubrid_broker_request_latency_seconds_bucket{%s,le=\"%g\"} %lld", labels, (double) bound / 1000.0,
+		   (long long) cumulative);
+	}
+      print_newline ();
+    }
+
+  str_out ("cubrid_broker_request_latency_seconds_sum{%s} %.6f", labels, (double) hist->sum_usec / 1000000.0);
+  print_newline ();
+  str_out ("cubrid_broker_request_latency_seconds_count{%s} %lld", labels, (long long) cumulative);
+  print_newline ();
+}
+
 static int
 print_title (char *buf_p, int buf_offset, FIELD_NAME name, const char *new_title_p)
 {
@@ -648,9 +648,56 @@ broker_shm_set_as_info (T_SHM_APPL_SERVER * shm_appl, T_APPL_SERVER_INFO * as_in
 
   as_info_p->fn_status = -1;
   as_info_p->session_id = 0;
+
+  memset (as_info_p->latency_hist, 0, sizeof (as_info_p->latency_hist));
   return;
 }
 
+/*
+ * broker_shm_add_latency - count the time from start to end in a histogram
+ *
+ * The caller must be the only writer of the histogram.
+ */
+void
+broker_shm_add_latency (T_CAS_LATENCY_HIST * hist, struct timeval *start, struct timeval *end)
+{
+  INT64 elapsed_usec, elapsed_msec;
+  int bucket;
+
+  elapsed_usec = ((INT64) (end->tv_sec - start->tv_sec)) * 1000000 + (end->tv_usec - start->tv_usec);
+  if (elapsed_usec < 0)
+    {
+      elapsed_usec = 0;
+    }
+
+  elapsed_msec = elapsed_usec / 1000;
+  for (bucket = 0; bucket < CAS_LATENCY_NUM_BUCKETS - 1; bucket++)
+    {
+      if (elapsed_msec < ((INT64) 1 << bucket))
+	{
+	  break;
+	}
+    }
+
+  hist->bucket[bucket]++;
+  hist->sum_usec += elapsed_usec;
+  hist->count++;
+}
+
+/*
+ * broker_shm_latency_bucket_bound_msec - exclusive upper bound of a histogram bucket; -1 for the last one
+ */
+INT64
+broker_shm_latency_bucket_bound_msec (int bucket)
+{
+  if (bucket >= CAS_LATENCY_NUM_BUCKETS - 1)
+    {
+      return -1;
+    }
+
+  return (INT64) 1 << bucket;
+}
+
 static void
 shard_shm_set_shard_conn_info (T_SHM_APPL_SERVER * shm_as_p, T_SHM_PROXY * shm_proxy_p)
 {
@@ -139,6 +139,7 @@
 #define SHM_BROKER_PATH_MAX      (PATH_MAX)
 #define SHM_PROXY_NAME_MAX       (SHM_BROKER_PATH_MAX)
 #define SHM_APPL_SERVER_NAME_MAX (SHM_BROKER_PATH_MAX)
+#define SHM_XASL_ID_DIR_SIZE     (256 * 1024)
 
 #define MAX_SHARD_USER           (4)
 #define MAX_SHARD_KEY            (2)
@@ -148,6 +149,10 @@
 #define SHARD_KEY_RANGE_MAX      (256)
 
 #define UNUSABLE_DATABASE_MAX    (200)
+
+/* bucket 0 of a latency histogram counts the latencies under 1 msec, bucket i the ones under 2^i msec and the last
+ * bucket all the others */
+#define CAS_LATENCY_NUM_BUCKETS  (20)
 #define PAIR_LIST                (2)
 
 /*
@@ -192,6 +197,24 @@ enum t_con_status
 };
 typedef enum t_con_status T_CON_STATUS;
 
+typedef enum
+{
+  CAS_LATENCY_QUEUE_WAIT = 0,	/* from job queue to CAS, recorded by broker */
+  CAS_LATENCY_PREPARE,
+  CAS_LATENCY_EXECUTE,
+  CAS_LATENCY_FETCH,
+  CAS_LATENCY_TYPE_COUNT
+} T_CAS_LATENCY_TYPE;
+
+/* each histogram has a single writer, so it is updated without lock; readers may see it in the middle of an update */
+typedef struct t_cas_latency_hist T_CAS_LATENCY_HIST;
+struct t_cas_latency_hist
+{
+  INT64 bucket[CAS_LATENCY_NUM_BUCKETS];
+  INT64 count;
+  INT64 sum_usec;
+};
+
 #if defined(WINDOWS)
 typedef INT64 int64_t;
 #endif
@@ -380,6 +403,8 @@ struct t_appl_server_info
   int advance_activate_flag;	/* it is used only in shard */
   int proxy_conn_wait_timeout;	/* it is used only in shard */
   bool force_reconnect;		/* it is used only in shard */
+
+  T_CAS_LATENCY_HIST latency_hist[CAS_LATENCY_TYPE_COUNT];
 };
 
 typedef struct t_client_info T_CLIENT_INFO;
@@ -641,6 +666,9 @@ struct t_shm_appl_server
   T_APPL_SERVER_INFO as_info[APPL_SERVER_NUM_LIMIT];
 
   T_DB_SERVER unusable_databases[PAIR_LIST][UNUSABLE_DATABASE_MAX];
+
+  /* XASL_IDs of the queries prepared by the CAS processes, shared among them; see do_share_xasl_id_cache */
+  INT64 xasl_id_dir[SHM_XASL_ID_DIR_SIZE / sizeof (INT64)];
 };
 
 /* shared memory information */
@@ -690,5 +718,7 @@ int uw_sem_destroy (sem_t * sem_t);
 T_SHM_BROKER *broker_shm_initialize_shm_broker (int master_shm_id, T_BROKER_INFO * br_info, int br_num, int acl_flag,
 						char *acl_file);
 T_SHM_APPL_SERVER *broker_shm_initialize_shm_as (T_BROKER_INFO * br_info_p, T_SHM_PROXY * shm_proxy_p);
+void broker_shm_add_latency (T_CAS_LATENCY_HIST * hist, struct timeval *start, struct timeval *end);
+INT64 broker_shm_latency_bucket_bound_msec (int bucket);
 
 #endif /* _BROKER_SHM_H_ */
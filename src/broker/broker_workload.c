@@ -0,0 +1,2058 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * broker_workload.c - throughput benchmark driver of YCSB and TPC-C like workloads over CCI
+ *
+ *  Each connection is run by its own thread, which loops on the operations of the workload until the run time is
+ *  over. YCSB workloads A to F run single row operations on one table, on keys picked with a zipfian or latest
+ *  distribution. The TPC-C like mix runs simplified New-Order, Payment, Order-Status, Delivery and Stock-Level
+ *  transactions on a scaled down TPC-C schema. The tables are created and loaded before the run, and they can be
+ *  encrypted with TDE; with compare mode, the workload is loaded and run once without and once with TDE and the
+ *  overhead is printed.
+ *
+ *  Throughput and latency percentiles are printed at every report interval and for the whole run.
+ */
+
+#ident "$Id$"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <signal.h>
+#include <stdarg.h>
+#if defined(WINDOWS)
+#include <winsock2.h>
+#include <windows.h>
+#else /* WINDOWS */
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/time.h>
+#endif /* !WINDOWS */
+#include <assert.h>
+
+#include "cubrid_getopt.h"
+#include "cas_common.h"
+#include "cas_cci.h"
+#include "porting.h"
+#include "error_code.h"
+
+#if defined(WINDOWS)
+#define THREAD_FUNC			unsigned __stdcall
+#define SLEEP_MILISEC(sec, msec)	Sleep((sec) * 1000 + (msec))
+#else
+#define THREAD_FUNC		void*
+#define SLEEP_MILISEC(sec, msec)			\
+	do {						\
+	  struct timeval sleep_time_val;		\
+	  sleep_time_val.tv_sec = sec;			\
+	  sleep_time_val.tv_usec = (msec) * 1000;	\
+	  select(0, 0, 0, 0, &sleep_time_val);		\
+	} while(0)
+#endif
+
+#define INVALID_PORT_NUM                (-1)
+
+#define WL_DEFAULT_RECORD_COUNT         (100000)
+#define WL_DEFAULT_RUN_SECONDS          (60)
+#define WL_DEFAULT_REPORT_INTERVAL      (10)
+#define WL_DEFAULT_ZIPF_THETA           (0.99)
+
+#define WL_MAX_ERROR_PRINT              (10)
+#define WL_LOAD_COMMIT_ROWS             (1000)
+#define WL_MAX_SQL_LEN                  (1024)
+
+/* YCSB */
+#define WL_YCSB_FIELD_COUNT             (10)
+#define WL_YCSB_FIELD_LEN               (100)
+#define WL_YCSB_MAX_SCAN_LEN            (100)
+
+/* TPC-C like, scaled down */
+#define WL_TPCC_DISTRICTS               (10)
+#define WL_TPCC_CUSTOMERS               (300)	/* per district */
+#define WL_TPCC_ITEMS                   (10000)
+#define WL_TPCC_NEW_ORDERS              (90)	/* the last orders of each district are not delivered yet */
+#define WL_TPCC_MIN_ORDER_LINES         (5)
+#define WL_TPCC_MAX_ORDER_LINES         (15)
+#define WL_TPCC_STOCK_LEVEL_ORDERS      (20)
+
+/*
+ * latency histogram: values below WL_HIST_SUB_COUNT microseconds have their own bucket, then each power of two range
+ * is split into WL_HIST_SUB_COUNT buckets, so a percentile is within about 6% of the real value.
+ */
+#define WL_HIST_SUB_BITS                (4)
+#define WL_HIST_SUB_COUNT               (1 << WL_HIST_SUB_BITS)
+#define WL_HIST_BUCKET_COUNT            ((64 - WL_HIST_SUB_BITS + 1) * WL_HIST_SUB_COUNT)
+
+typedef enum
+{
+  WL_WORKLOAD_YCSB_A,
+  WL_WORKLOAD_YCSB_B,
+  WL_WORKLOAD_YCSB_C,
+  WL_WORKLOAD_YCSB_D,
+  WL_WORKLOAD_YCSB_E,
+  WL_WORKLOAD_YCSB_F,
+  WL_WORKLOAD_TPCC,
+  WL_WORKLOAD_COUNT
+} WL_WORKLOAD;
+
+static const char *wl_workload_names[WL_WORKLOAD_COUNT] = {
+  "ycsb-a", "ycsb-b", "ycsb-c", "ycsb-d", "ycsb-e", "ycsb-f", "tpcc"
+};
+
+typedef enum
+{
+  WL_TDE_OFF,
+  WL_TDE_AES,
+  WL_TDE_ARIA,
+  WL_TDE_COMPARE		/* run without TDE, then with AES */
+} WL_TDE_MODE;
+
+typedef enum
+{
+  WL_OP_READ,
+  WL_OP_UPDATE,
+  WL_OP_INSERT,
+  WL_OP_SCAN,
+  WL_OP_READ_MODIFY_WRITE,
+  WL_OP_NEW_ORDER,
+  WL_OP_PAYMENT,
+  WL_OP_ORDER_STATUS,
+  WL_OP_DELIVERY,
+  WL_OP_STOCK_LEVEL,
+  WL_OP_COUNT
+} WL_OP;
+
+static const char *wl_op_names[WL_OP_COUNT] = {
+  "read", "update", "insert", "scan", "read-modify-write",
+  "new-order", "payment", "order-status", "delivery", "stock-level"
+};
+
+/* operation mix of each workload, in percent; the TPC-C mix is that of the specification */
+static const int wl_op_mix[WL_WORKLOAD_COUNT][WL_OP_COUNT] = {
+  /* read, update, insert, scan, rmw, new-order, payment, order-status, delivery, stock-level */
+  {50, 50, 0, 0, 0, 0, 0, 0, 0, 0},
+  {95, 5, 0, 0, 0, 0, 0, 0, 0, 0},
+  {100, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+  {95, 0, 5, 0, 0, 0, 0, 0, 0, 0},
+  {0, 0, 5, 95, 0, 0, 0, 0, 0, 0},
+  {50, 0, 0, 0, 50, 0, 0, 0, 0, 0},
+  {0, 0, 0, 0, 0, 45, 43, 4, 4, 4}
+};
+
+/* prepared statements; each connection prepares them on first use */
+typedef enum
+{
+  WL_STMT_YCSB_READ,
+  WL_STMT_YCSB_UPDATE,
+  WL_STMT_YCSB_INSERT,
+  WL_STMT_YCSB_SCAN,
+  WL_STMT_TPCC_INSERT_WAREHOUSE,
+  WL_STMT_TPCC_INSERT_DISTRICT,
+  WL_STMT_TPCC_INSERT_CUSTOMER,
+  WL_STMT_TPCC_INSERT_ITEM,
+  WL_STMT_TPCC_INSERT_STOCK,
+  WL_STMT_TPCC_INSERT_ORDER,
+  WL_STMT_TPCC_INSERT_NEW_ORDER,
+  WL_STMT_TPCC_INSERT_ORDER_LINE,
+  WL_STMT_TPCC_INSERT_HISTORY,
+  WL_STMT_TPCC_NEXT_ORDER_ID,
+  WL_STMT_TPCC_GET_DISTRICT,
+  WL_STMT_TPCC_GET_WAREHOUSE_TAX,
+  WL_STMT_TPCC_GET_CUSTOMER,
+  WL_STMT_TPCC_GET_ITEM_PRICE,
+  WL_STMT_TPCC_UPDATE_STOCK,
+  WL_STMT_TPCC_PAY_WAREHOUSE,
+  WL_STMT_TPCC_PAY_DISTRICT,
+  WL_STMT_TPCC_PAY_CUSTOMER,
+  WL_STMT_TPCC_LAST_ORDER,
+  WL_STMT_TPCC_GET_ORDER_LINES,
+  WL_STMT_TPCC_OLDEST_NEW_ORDER,
+  WL_STMT_TPCC_DELETE_NEW_ORDER,
+  WL_STMT_TPCC_GET_ORDER_CUSTOMER,
+  WL_STMT_TPCC_SET_CARRIER,
+  WL_STMT_TPCC_DELIVER_ORDER_LINES,
+  WL_STMT_TPCC_SUM_ORDER_LINES,
+  WL_STMT_TPCC_DELIVER_CUSTOMER,
+  WL_STMT_TPCC_GET_NEXT_ORDER_ID,
+  WL_STMT_TPCC_COUNT_LOW_STOCK,
+  WL_STMT_COUNT
+} WL_STMT;
+
+static const char *wl_stmt_sql[WL_STMT_COUNT] = {
+  "SELECT field0, field1, field2, field3, field4, field5, field6, field7, field8, field9 "
+    "FROM ycsb_usertable WHERE ycsb_key = ?",
+  "UPDATE ycsb_usertable SET field0 = ? WHERE ycsb_key = ?",
+  "INSERT INTO ycsb_usertable VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)",
+  "SELECT ycsb_key, field0 FROM ycsb_usertable WHERE ycsb_key >= ? AND ycsb_key < ?",
+  "INSERT INTO tpcc_warehouse VALUES (?, ?, ?, 300000)",
+  "INSERT INTO tpcc_district VALUES (?, ?, ?, ?, 30000, ?)",
+  "INSERT INTO tpcc_customer VALUES (?, ?, ?, ?, ?, -10, 10, 1, 0, ?)",
+  "INSERT INTO tpcc_item VALUES (?, ?, ?, ?)",
+  "INSERT INTO tpcc_stock VALUES (?, ?, ?, 0, 0, ?)",
+  "INSERT INTO tpcc_orders VALUES (?, ?, ?, ?, ?, ?)",
+  "INSERT INTO tpcc_new_order VALUES (?, ?, ?)",
+  "INSERT INTO tpcc_order_line VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)",
+  "INSERT INTO tpcc_history VALUES (?, ?, ?, ?, ?, ?, ?)",
+  "UPDATE tpcc_district SET d_next_o_id = d_next_o_id + 1 WHERE d_w_id = ? AND d_id = ?",
+  "SELECT d_next_o_id - 1, d_tax FROM tpcc_district WHERE d_w_id = ? AND d_id = ?",
+  "SELECT w_tax FROM tpcc_warehouse WHERE w_id = ?",
+  "SELECT c_discount, c_balance FROM tpcc_customer WHERE c_w_id = ? AND c_d_id = ? AND c_id = ?",
+  "SELECT i_price FROM tpcc_item WHERE i_id = ?",
+  "UPDATE tpcc_stock SET s_quantity = CASE WHEN s_quantity >= ? + 10 THEN s_quantity - ? ELSE s_quantity - ? + 91 END, "
+    "s_ytd = s_ytd + ?, s_order_cnt = s_order_cnt + 1 WHERE s_w_id = ? AND s_i_id = ?",
+  "UPDATE tpcc_warehouse SET w_ytd = w_ytd + ? WHERE w_id = ?",
+  "UPDATE tpcc_district SET d_ytd = d_ytd + ? WHERE d_w_id = ? AND d_id = ?",
+  "UPDATE tpcc_customer SET c_balance = c_balance - ?, c_ytd_payment = c_ytd_payment + ?, "
+    "c_payment_cnt = c_payment_cnt + 1 WHERE c_w_id = ? AND c_d_id = ? AND c_id = ?",
+  "SELECT MAX (o_id) FROM tpcc_orders WHERE o_w_id = ? AND o_d_id = ? AND o_c_id = ?",
+  "SELECT ol_i_id, ol_supply_w_id, ol_quantity, ol_amount, ol_delivered FROM tpcc_order_line "
+    "WHERE ol_w_id = ? AND ol_d_id = ? AND ol_o_id = ?",
+  "SELECT MIN (no_o_id) FROM tpcc_new_order WHERE no_w_id = ? AND no_d_id = ?",
+  "DELETE FROM tpcc_new_order WHERE no_w_id = ? AND no_d_id = ? AND no_o_id = ?",
+  "SELECT o_c_id FROM tpcc_orders WHERE o_w_id = ? AND o_d_id = ? AND o_id = ?",
+  "UPDATE tpcc_orders SET o_carrier_id = ? WHERE o_w_id = ? AND o_d_id = ? AND o_id = ?",
+  "UPDATE tpcc_order_line SET ol_delivered = 1 WHERE ol_w_id = ? AND ol_d_id = ? AND ol_o_id = ?",
+  "SELECT SUM (ol_amount) FROM tpcc_order_line WHERE ol_w_id = ? AND ol_d_id = ? AND ol_o_id = ?",
+  "UPDATE tpcc_customer SET c_balance = c_balance + ?, c_delivery_cnt = c_delivery_cnt + 1 "
+    "WHERE c_w_id = ? AND c_d_id = ? AND c_id = ?",
+  "SELECT d_next_o_id FROM tpcc_district WHERE d_w_id = ? AND d_id = ?",
+  "SELECT COUNT (DISTINCT s_i_id) FROM tpcc_order_line, tpcc_stock WHERE ol_w_id = ? AND ol_d_id = ? "
+    "AND ol_o_id >= ? AND ol_o_id < ? AND s_w_id = ? AND s_i_id = ol_i_id AND s_quantity < ?"
+};
+
+/* tables are created with the TDE clause appended */
+static const char *wl_ycsb_schema[] = {
+  "DROP TABLE IF EXISTS ycsb_usertable",
+  "CREATE TABLE ycsb_usertable (ycsb_key BIGINT PRIMARY KEY, field0 VARCHAR(100), field1 VARCHAR(100), "
+    "field2 VARCHAR(100), field3 VARCHAR(100), field4 VARCHAR(100), field5 VARCHAR(100), field6 VARCHAR(100), "
+    "field7 VARCHAR(100), field8 VARCHAR(100), field9 VARCHAR(100)) %s",
+  NULL
+};
+
+static const char *wl_tpcc_schema[] = {
+  "DROP TABLE IF EXISTS tpcc_warehouse, tpcc_district, tpcc_customer, tpcc_history, tpcc_item, tpcc_stock, "
+    "tpcc_orders, tpcc_new_order, tpcc_order_line",
+  "CREATE TABLE tpcc_warehouse (w_id INT PRIMARY KEY, w_name VARCHAR(10), w_tax DOUBLE, w_ytd DOUBLE) %s",
+  "CREATE TABLE tpcc_district (d_w_id INT, d_id INT, d_name VARCHAR(10), d_tax DOUBLE, d_ytd DOUBLE, "
+    "d_next_o_id INT, PRIMARY KEY (d_w_id, d_id)) %s",
+  "CREATE TABLE tpcc_customer (c_w_id INT, c_d_id INT, c_id INT, c_last VARCHAR(16), c_discount DOUBLE, "
+    "c_balance DOUBLE, c_ytd_payment DOUBLE, c_payment_cnt INT, c_delivery_cnt INT, c_data VARCHAR(500), "
+    "PRIMARY KEY (c_w_id, c_d_id, c_id)) %s",
+  "CREATE TABLE tpcc_history (h_c_id INT, h_c_d_id INT, h_c_w_id INT, h_d_id INT, h_w_id INT, h_amount DOUBLE, "
+    "h_data VARCHAR(24)) %s",
+  "CREATE TABLE tpcc_item (i_id INT PRIMARY KEY, i_name VARCHAR(24), i_price DOUBLE, i_data VARCHAR(50)) %s",
+  "CREATE TABLE tpcc_stock (s_w_id INT, s_i_id INT, s_quantity INT, s_ytd INT, s_order_cnt INT, s_data VARCHAR(50), "
+    "PRIMARY KEY (s_w_id, s_i_id)) %s",
+  "CREATE TABLE tpcc_orders (o_w_id INT, o_d_id INT, o_id INT, o_c_id INT, o_carrier_id INT, o_ol_cnt INT, "
+    "PRIMARY KEY (o_w_id, o_d_id, o_id)) %s",
+  "CREATE INDEX tpcc_orders_customer ON tpcc_orders (o_w_id, o_d_id, o_c_id, o_id)",
+  "CREATE TABLE tpcc_new_order (no_w_id INT, no_d_id INT, no_o_id INT, PRIMARY KEY (no_w_id, no_d_id, no_o_id)) %s",
+  "CREATE TABLE tpcc_order_line (ol_w_id INT, ol_d_id INT, ol_o_id INT, ol_number INT, ol_i_id INT, "
+    "ol_supply_w_id INT, ol_quantity INT, ol_amount DOUBLE, ol_delivered INT, "
+    "PRIMARY KEY (ol_w_id, ol_d_id, ol_o_id, ol_number)) %s",
+  NULL
+};
+
+typedef struct wl_histogram WL_HISTOGRAM;
+struct wl_histogram
+{
+  UINT64 counts[WL_HIST_BUCKET_COUNT];
+  UINT64 total_count;
+  UINT64 sum_usec;
+  UINT64 max_usec;
+};
+
+/* zipfian generator of Gray et al., as used by YCSB */
+typedef struct wl_zipfian WL_ZIPFIAN;
+struct wl_zipfian
+{
+  INT64 items;
+  double theta;
+  double alpha;
+  double zetan;
+  double eta;
+};
+
+typedef struct wl_conn WL_CONN;
+struct wl_conn
+{
+  int con_h;
+  int req_h[WL_STMT_COUNT];
+  T_CCI_ERROR cci_error;
+  UINT64 rand_state;
+};
+
+typedef struct wl_thread WL_THREAD;
+struct wl_thread
+{
+  int index;
+  pthread_t tid;
+  WL_CONN conn;
+  int error;
+
+  /* interval statistics are taken by the main thread at every report */
+  pthread_mutex_t stat_mutex;
+  WL_HISTOGRAM interval_hist;
+  UINT64 interval_errors;
+  WL_HISTOGRAM op_hist[WL_OP_COUNT];
+  UINT64 op_errors[WL_OP_COUNT];
+  UINT64 rollbacks;
+};
+
+/* result of a run, printed at the end and compared in TDE compare mode */
+typedef struct wl_result WL_RESULT;
+struct wl_result
+{
+  double elapsed_sec;
+  WL_HISTOGRAM total_hist;
+  UINT64 errors;
+};
+
+/* an operation that ended with an intentional rollback, like the New-Order with an invalid item */
+#define WL_ROLLED_BACK                  (1)
+
+static int wl_get_args (int argc, char *argv[]);
+static INT64 wl_now_usec (void);
+
+static UINT64 wl_random (WL_CONN * conn);
+static int wl_random_int (WL_CONN * conn, int min, int max);
+static double wl_random_double (WL_CONN * conn);
+static void wl_random_string (WL_CONN * conn, char *buf, int len);
+static int wl_nurand (WL_CONN * conn, int a, int x, int y);
+static void wl_zipfian_init (WL_ZIPFIAN * zipf, INT64 items, double theta);
+static INT64 wl_zipfian_next (const WL_ZIPFIAN * zipf, WL_CONN * conn);
+
+static int wl_hist_bucket (UINT64 usec);
+static UINT64 wl_hist_bucket_value (int bucket);
+static void wl_hist_record (WL_HISTOGRAM * hist, UINT64 usec);
+static void wl_hist_merge (WL_HISTOGRAM * dest, const WL_HISTOGRAM * src);
+static UINT64 wl_hist_percentile (const WL_HISTOGRAM * hist, double percent);
+
+static int wl_connect (WL_CONN * conn, int index, CCI_AUTOCOMMIT_MODE autocommit);
+static void wl_disconnect (WL_CONN * conn);
+static void wl_print_error (WL_CONN * conn, int res, const char *what);
+static int wl_execute_va (WL_CONN * conn, WL_STMT stmt, const char *types, va_list args);
+static int wl_execute (WL_CONN * conn, WL_STMT stmt, const char *types, ...);
+static int wl_select_row (WL_CONN * conn, WL_STMT stmt, const char *types, ...);
+static int wl_fetch (WL_CONN * conn, WL_STMT stmt, bool is_first);
+static int wl_get_int (WL_CONN * conn, WL_STMT stmt, int col, int *value);
+static int wl_get_double (WL_CONN * conn, WL_STMT stmt, int col, double *value);
+static int wl_execute_sql (WL_CONN * conn, const char *sql);
+static int wl_commit (WL_CONN * conn);
+static void wl_rollback (WL_CONN * conn);
+
+static int wl_create_schema (const char **schema, const char *tde_clause);
+static int wl_load_ycsb (WL_THREAD * thread);
+static int wl_load_tpcc_items (WL_THREAD * thread);
+static int wl_load_tpcc_warehouse (WL_THREAD * thread, int w_id);
+static int wl_load_row_done (WL_CONN * conn, int *rows);
+static THREAD_FUNC wl_load_main (void *arg);
+
+static int wl_ycsb_read (WL_CONN * conn);
+static int wl_ycsb_update (WL_CONN * conn);
+static int wl_ycsb_insert (WL_CONN * conn);
+static int wl_ycsb_scan (WL_CONN * conn);
+static int wl_ycsb_read_modify_write (WL_CONN * conn);
+static INT64 wl_ycsb_next_key (WL_CONN * conn);
+static void wl_ycsb_fill_fields (WL_CONN * conn, char fields[WL_YCSB_FIELD_COUNT][WL_YCSB_FIELD_LEN + 1]);
+
+static int wl_tpcc_new_order (WL_CONN * conn, int w_id);
+static int wl_tpcc_payment (WL_CONN * conn, int w_id);
+static int wl_tpcc_order_status (WL_CONN * conn, int w_id);
+static int wl_tpcc_delivery (WL_CONN * conn, int w_id);
+static int wl_tpcc_stock_level (WL_CONN * conn, int w_id);
+
+static WL_OP wl_pick_op (WL_CONN * conn);
+static int wl_run_op (WL_THREAD * thread, WL_OP op);
+static THREAD_FUNC wl_run_main (void *arg);
+
+static int wl_load_threads (WL_THREAD * threads);
+static int wl_run_pass (WL_TDE_MODE tde, WL_RESULT * result);
+static void wl_print_report_header (void);
+static void wl_print_interval (WL_THREAD * threads, double elapsed_sec, double interval_sec, WL_RESULT * result);
+static void wl_print_summary (WL_THREAD * threads, const WL_RESULT * result);
+
+static char *broker_host = NULL;
+static int broker_port = INVALID_PORT_NUM;
+static char *dbname = NULL;
+static char *dbuser = NULL;
+static char *dbpasswd = NULL;
+
+static WL_WORKLOAD workload = WL_WORKLOAD_YCSB_A;
+static int num_connections = 1;
+static int record_count = WL_DEFAULT_RECORD_COUNT;
+static int warehouse_count = 1;
+static int run_seconds = WL_DEFAULT_RUN_SECONDS;
+static int report_interval = WL_DEFAULT_REPORT_INTERVAL;
+static double zipf_theta = WL_DEFAULT_ZIPF_THETA;
+static WL_TDE_MODE tde_mode = WL_TDE_OFF;
+static int skip_load = 0;
+
+static volatile int wl_stop = 0;
+static int wl_error_print_count = 0;
+static pthread_mutex_t wl_mutex;
+static INT64 wl_ycsb_insert_key;	/* next key to insert, guarded by wl_mutex */
+static WL_ZIPFIAN wl_ycsb_zipfian;
+
+int
+main (int argc, char *argv[])
+{
+  WL_RESULT results[2];
+  int error;
+
+#if !defined(WINDOWS)
+  signal (SIGPIPE, SIG_IGN);
+#endif
+
+  if (wl_get_args (argc, argv) < 0)
+    {
+      return -1;
+    }
+
+  if (dbuser == NULL)
+    {
+      dbuser = (char *) "PUBLIC";
+    }
+  if (dbpasswd == NULL)
+    {
+      dbpasswd = (char *) "";
+    }
+
+  pthread_mutex_init (&wl_mutex, NULL);
+  cci_init ();
+
+  fprintf (stdout, "workload = %s\n", wl_workload_names[workload]);
+  fprintf (stdout, "connections = %d\n", num_connections);
+  if (workload == WL_WORKLOAD_TPCC)
+    {
+      fprintf (stdout, "warehouses = %d\n", warehouse_count);
+    }
+  else
+    {
+      fprintf (stdout, "records = %d, zipfian theta = %.2f\n", record_count, zipf_theta);
+      wl_zipfian_init (&wl_ycsb_zipfian, record_count, zipf_theta);
+    }
+  fprintf (stdout, "run time = %d sec, report interval = %d sec\n", run_seconds, report_interval);
+
+  if (tde_mode == WL_TDE_COMPARE)
+    {
+      error = wl_run_pass (WL_TDE_OFF, &results[0]);
+      if (error == NO_ERROR)
+	{
+	  error = wl_run_pass (WL_TDE_AES, &results[1]);
+	}
+      if (error == NO_ERROR)
+	{
+	  double tps_off = results[0].total_hist.total_count / results[0].elapsed_sec;
+	  double tps_on = results[1].total_hist.total_count / results[1].elapsed_sec;
+	  UINT64 p99_off = wl_hist_percentile (&results[0].total_hist, 99);
+	  UINT64 p99_on = wl_hist_percentile (&results[1].total_hist, 99);
+
+	  fprintf (stdout, "\nTDE overhead (AES)\n");
+	  fprintf (stdout, "  throughput : %.1f -> %.1f ops/s (%+.1f%%)\n", tps_off, tps_on,
+		   tps_off > 0 ? (tps_on - tps_off) * 100 / tps_off : 0);
+	  fprintf (stdout, "  p99 latency: %llu -> %llu us (%+.1f%%)\n", (unsigned long long) p99_off,
+		   (unsigned long long) p99_on, p99_off > 0 ? ((double) p99_on - p99_off) * 100 / p99_off : 0);
+	}
+    }
+  else
+    {
+      error = wl_run_pass (tde_mode, &results[0]);
+    }
+
+  cci_end ();
+  pthread_mutex_destroy (&wl_mutex);
+
+  return error == NO_ERROR ? 0 : -1;
+}
+
+static int
+wl_get_args (int argc, char *argv[])
+{
+  int c;
+  int i;
+
+  while (1)
+    {
+      c = getopt (argc, argv, "LI:P:d:u:p:c:w:r:W:t:i:z:E:");
+      if (c == EOF)
+	{
+	  break;
+	}
+      switch (c)
+	{
+	case 'I':
+	  broker_host = optarg;
+	  break;
+	case 'P':
+	  if (parse_int (&broker_port, optarg, 10) < 0)
+	    {
+	      goto usage;
+	    }
+	  break;
+	case 'd':
+	  dbname = optarg;
+	  break;
+	case 'u':
+	  dbuser = optarg;
+	  break;
+	case 'p':
+	  dbpasswd = strdup (optarg);
+#if defined (LINUX)
+	  memset (optarg, '*', strlen (optarg));
+#endif
+	  break;
+	case 'c':
+	  if (parse_int (&num_connections, optarg, 10) < 0 || num_connections < 1)
+	    {
+	      goto usage;
+	    }
+	  break;
+	case 'w':
+	  for (i = 0; i < WL_WORKLOAD_COUNT; i++)
+	    {
+	      if (strcasecmp (optarg, wl_workload_names[i]) == 0)
+		{
+		  break;
+		}
+	    }
+	  if (i == WL_WORKLOAD_COUNT)
+	    {
+	      goto usage;
+	    }
+	  workload = (WL_WORKLOAD) i;
+	  break;
+	case 'r':
+	  if (parse_int (&record_count, optarg, 10) < 0 || record_count < 1)
+	    {
+	      goto usage;
+	    }
+	  break;
+	case 'W':
+	  if (parse_int (&warehouse_count, optarg, 10) < 0 || warehouse_count < 1)
+	    {
+	      goto usage;
+	    }
+	  break;
+	case 't':
+	  if (parse_int (&run_seconds, optarg, 10) < 0 || run_seconds < 1)
+	    {
+	      goto usage;
+	    }
+	  break;
+	case 'i':
+	  if (parse_int (&report_interval, optarg, 10) < 0 || report_interval < 1)
+	    {
+	      goto usage;
+	    }
+	  break;
+	case 'z':
+	  zipf_theta = atof (optarg);
+	  if (zipf_theta <= 0 || zipf_theta >= 1)
+	    {
+	      goto usage;
+	    }
+	  break;
+	case 'E':
+	  if (strcasecmp (optarg, "off") == 0)
+	    {
+	      tde_mode = WL_TDE_OFF;
+	    }
+	  else if (strcasecmp (optarg, "aes") == 0)
+	    {
+	      tde_mode = WL_TDE_AES;
+	    }
+	  else if (strcasecmp (optarg, "aria") == 0)
+	    {
+	      tde_mode = WL_TDE_ARIA;
+	    }
+	  else if (strcasecmp (optarg, "compare") == 0)
+	    {
+	      tde_mode = WL_TDE_COMPARE;
+	    }
+	  else
+	    {
+	      goto usage;
+	    }
+	  break;
+	case 'L':
+	  skip_load = 1;
+	  break;
+	default:
+	  goto usage;
+	}
+    }
+
+  if (broker_host == NULL || broker_port == INVALID_PORT_NUM || dbname == NULL)
+    {
+      goto usage;
+    }
+  if (skip_load && tde_mode == WL_TDE_COMPARE)
+    {
+      fprintf (stderr, "error: -L cannot be used with -E compare, the tables are loaded for each run\n");
+      return -1;
+    }
+
+  return 0;
+
+usage:
+  fprintf (stderr,
+	   "usage : %s [OPTION]\n" "\n" "valid options:\n" "  -I   broker host\n" "  -P   broker port\n"
+	   "  -d   database name\n" "  -u   user name\n" "  -p   user password\n"
+	   "  -c   the number of connections, each run by a thread (default 1)\n"
+	   "  -w   workload: ycsb-a, ycsb-b, ycsb-c, ycsb-d, ycsb-e, ycsb-f or tpcc (default ycsb-a)\n"
+	   "  -r   the number of records of ycsb workloads (default %d)\n"
+	   "  -W   the number of warehouses of tpcc workload (default 1)\n"
+	   "  -t   run time in seconds (default %d)\n" "  -i   report interval in seconds (default %d)\n"
+	   "  -z   zipfian constant of ycsb workloads, between 0 and 1 (default %.2f)\n"
+	   "  -E   TDE of the tables: off, aes, aria or compare to run without and with aes (default off)\n"
+	   "  -L   skip creating and loading the tables\n", argv[0], WL_DEFAULT_RECORD_COUNT,
+	   WL_DEFAULT_RUN_SECONDS, WL_DEFAULT_REPORT_INTERVAL, WL_DEFAULT_ZIPF_THETA);
+  return -1;
+}
+
+static INT64
+wl_now_usec (void)
+{
+  struct timeval tv;
+
+  gettimeofday (&tv, NULL);
+  return (INT64) tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+/*
+ * random values: xorshift64* with a state per connection
+ */
+
+static UINT64
+wl_random (WL_CONN * conn)
+{
+  conn->rand_state ^= conn->rand_state >> 12;
+  conn->rand_state ^= conn->rand_state << 25;
+  conn->rand_state ^= conn->rand_state >> 27;
+  return conn->rand_state * 2685821657736338717ULL;
+}
+
+/* random integer in [min, max] */
+static int
+wl_random_int (WL_CONN * conn, int min, int max)
+{
+  return min + (int) (wl_random (conn) % (UINT64) (max - min + 1));
+}
+
+/* random double in [0, 1) */
+static double
+wl_random_double (WL_CONN * conn)
+{
+  return (wl_random (conn) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void
+wl_random_string (WL_CONN * conn, char *buf, int len)
+{
+  static const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+  int i;
+
+  for (i = 0; i < len; i++)
+    {
+      buf[i] = chars[wl_random (conn) % (sizeof (chars) - 1)];
+    }
+  buf[len] = '\0';
+}
+
+/* non-uniform random of TPC-C */
+static int
+wl_nurand (WL_CONN * conn, int a, int x, int y)
+{
+  return (((wl_random_int (conn, 0, a) | wl_random_int (conn, x, y)) + 42) % (y - x + 1)) + x;
+}
+
+static void
+wl_zipfian_init (WL_ZIPFIAN * zipf, INT64 items, double theta)
+{
+  double zeta2theta = 1 + pow (0.5, theta);
+  INT64 i;
+
+  zipf->items = items;
+  zipf->theta = theta;
+  zipf->alpha = 1 / (1 - theta);
+  zipf->zetan = 0;
+  for (i = 1; i <= items; i++)
+    {
+      zipf->zetan += 1 / pow ((double) i, theta);
+    }
+  zipf->eta = (1 - pow (2.0 / items, 1 - theta)) / (1 - zeta2theta / zipf->zetan);
+}
+
+/* zipfian value in [0, items), 0 is the most popular */
+static INT64
+wl_zipfian_next (const WL_ZIPFIAN * zipf, WL_CONN * conn)
+{
+  double u = wl_random_double (conn);
+  double uz = u * zipf->zetan;
+  INT64 value;
+
+  if (uz < 1)
+    {
+      return 0;
+    }
+  if (uz < 1 + pow (0.5, zipf->theta))
+    {
+      return 1;
+    }
+  value = (INT64) (zipf->items * pow (zipf->eta * u - zipf->eta + 1, zipf->alpha));
+  return value < zipf->items ? value : zipf->items - 1;
+}
+
+/*
+ * latency histogram
+ */
+
+static int
+wl_hist_bucket (UINT64 usec)
+{
+  int msb = 0;
+  int sub;
+
+  if (usec < WL_HIST_SUB_COUNT)
+    {
+      return (int) usec;
+    }
+  while ((usec >> (msb + 1)) != 0)
+    {
+      msb++;
+    }
+  sub = (int) ((usec >> (msb - WL_HIST_SUB_BITS)) & (WL_HIST_SUB_COUNT - 1));
+  return (msb - WL_HIST_SUB_BITS + 1) * WL_HIST_SUB_COUNT + sub;
+}
+
+/* the highest value of a bucket */
+static UINT64
+wl_hist_bucket_value (int bucket)
+{
+  int msb;
+  UINT64 sub;
+
+  if (bucket < WL_HIST_SUB_COUNT)
+    {
+      return (UINT64) bucket;
+    }
+  msb = bucket / WL_HIST_SUB_COUNT + WL_HIST_SUB_BITS - 1;
+  sub = (UINT64) (bucket % WL_HIST_SUB_COUNT);
+  return ((WL_HIST_SUB_COUNT + sub + 1) << (msb - WL_HIST_SUB_BITS)) - 1;
+}
+
+static void
+wl_hist_record (WL_HISTOGRAM * hist, UINT64 usec)
+{
+  hist->counts[wl_hist_bucket (usec)]++;
+  hist->total_count++;
+  hist->sum_usec += usec;
+  if (usec > hist->max_usec)
+    {
+      hist->max_usec = usec;
+    }
+}
+
+static void
+wl_hist_merge (WL_HISTOGRAM * dest, const WL_HISTOGRAM * src)
+{
+  int i;
+
+  for (i = 0; i < WL_HIST_BUCKET_COUNT; i++)
+    {
+      dest->counts[i] += src->counts[i];
+    }
+  dest->total_count += src->total_count;
+  dest->sum_usec += src->sum_usec;
+  if (src->max_usec > dest->max_usec)
+    {
+      dest->max_usec = src->max_usec;
+    }
+}
+
+static UINT64
+wl_hist_percentile (const WL_HISTOGRAM * hist, double percent)
+{
+  UINT64 rank = (UINT64) ceil (hist->total_count * percent / 100);
+  UINT64 seen = 0;
+  int i;
+
+  if (hist->total_count == 0)
+    {
+      return 0;
+    }
+  for (i = 0; i < WL_HIST_BUCKET_COUNT; i++)
+    {
+      seen += hist->counts[i];
+      if (seen >= rank)
+	{
+	  UINT64 value = wl_hist_bucket_value (i);
+	  return value < hist->max_usec ? value : hist->max_usec;
+	}
+    }
+  return hist->max_usec;
+}
+
+/*
+ * CCI
+ */
+
+static int
+wl_connect (WL_CONN * conn, int index, CCI_AUTOCOMMIT_MODE autocommit)
+{
+  int i;
+  int res;
+
+  for (i = 0; i < WL_STMT_COUNT; i++)
+    {
+      conn->req_h[i] = -1;
+    }
+  conn->rand_state = ((UINT64) index + 1) * 0x9E3779B97F4A7C15ULL;
+
+  conn->con_h = cci_connect (broker_host, broker_port, dbname, dbuser, dbpasswd);
+  if (conn->con_h < 0)
+    {
+      wl_print_error (conn, conn->con_h, "cci_connect");
+      return conn->con_h;
+    }
+  res = cci_set_autocommit (conn->con_h, autocommit);
+  if (res < 0)
+    {
+      wl_print_error (conn, res, "cci_set_autocommit");
+      wl_disconnect (conn);
+      return res;
+    }
+  return NO_ERROR;
+}
+
+static void
+wl_disconnect (WL_CONN * conn)
+{
+  int i;
+
+  if (conn->con_h < 0)
+    {
+      return;
+    }
+  for (i = 0; i < WL_STMT_COUNT; i++)
+    {
+      if (conn->req_h[i] >= 0)
+	{
+	  cci_close_req_handle (conn->req_h[i]);
+	  conn->req_h[i] = -1;
+	}
+    }
+  cci_disconnect (conn->con_h, &conn->cci_error);
+  conn->con_h = -1;
+}
+
+/* print the first errors only, a failing workload would flood the output */
+static void
+wl_print_error (WL_CONN * conn, int res, const char *what)
+{
+  char msgbuf[1024] = "";
+  bool do_print;
+
+  pthread_mutex_lock (&wl_mutex);
+  do_print = wl_error_print_count++ < WL_MAX_ERROR_PRINT;
+  pthread_mutex_unlock (&wl_mutex);
+  if (!do_print)
+    {
+      return;
+    }
+
+  if (res == CCI_ER_DBMS)
+    {
+      fprintf (stderr, "%s: server error : %d %s\n", what, conn->cci_error.err_code, conn->cci_error.err_msg);
+    }
+  else
+    {
+      cci_get_error_msg (res, NULL, msgbuf, sizeof (msgbuf));
+      fprintf (stderr, "%s: cci error : %d %s\n", what, res, msgbuf);
+    }
+}
+
+/*
+ * wl_execute_va () - execute a statement, prepared on first use
+ *   return: the number of rows changed or selected, or an error
+ *   types(in): a character for each bound value: 'i' int, 'l' INT64, 'd' double, 's' string
+ */
+static int
+wl_execute_va (WL_CONN * conn, WL_STMT stmt, const char *types, va_list args)
+{
+  int req_h;
+  int index;
+  int res = 0;
+
+  if (conn->req_h[stmt] < 0)
+    {
+      conn->req_h[stmt] = cci_prepare (conn->con_h, wl_stmt_sql[stmt], 0, &conn->cci_error);
+      if (conn->req_h[stmt] < 0)
+	{
+	  res = conn->req_h[stmt];
+	  wl_print_error (conn, res, wl_stmt_sql[stmt]);
+	  return res;
+	}
+    }
+  req_h = conn->req_h[stmt];
+
+  for (index = 1; *types != '\0' && res >= 0; types++, index++)
+    {
+      int int_value;
+      INT64 bigint_value;
+      double double_value;
+      char *str_value;
+
+      switch (*types)
+	{
+	case 'i':
+	  int_value = va_arg (args, int);
+	  res = cci_bind_param (req_h, index, CCI_A_TYPE_INT, &int_value, CCI_U_TYPE_INT, 0);
+	  break;
+	case 'l':
+	  bigint_value = va_arg (args, INT64);
+	  res = cci_bind_param (req_h, index, CCI_A_TYPE_BIGINT, &bigint_value, CCI_U_TYPE_BIGINT, 0);
+	  break;
+	case 'd':
+	  double_value = va_arg (args, double);
+	  res = cci_bind_param (req_h, index, CCI_A_TYPE_DOUBLE, &double_value, CCI_U_TYPE_DOUBLE, 0);
+	  break;
+	case 's':
+	  str_value = va_arg (args, char *);
+	  res = cci_bind_param (req_h, index, CCI_A_TYPE_STR, str_value, CCI_U_TYPE_STRING, 0);
+	  break;
+	default:
+	  assert (false);
+	  res = CCI_ER_BIND_INDEX;
+	  break;
+	}
+    }
+
+  if (res >= 0)
+    {
+      res = cci_execute (req_h, 0, 0, &conn->cci_error);
+    }
+  if (res < 0)
+    {
+      wl_print_error (conn, res, wl_stmt_sql[stmt]);
+    }
+  return res;
+}
+
+static int
+wl_execute (WL_CONN * conn, WL_STMT stmt, const char *types, ...)
+{
+  va_list args;
+  int res;
+
+  va_start (args, types);
+  res = wl_execute_va (conn, stmt, types, args);
+  va_end (args);
+
+  return res;
+}
+
+/*
+ * wl_select_row () - execute a select and fetch its first row
+ *   return: 1 if a row was fetched, 0 if there is no row, or an error
+ */
+static int
+wl_select_row (WL_CONN * conn, WL_STMT stmt, const char *types, ...)
+{
+  va_list args;
+  int res;
+
+  va_start (args, types);
+  res = wl_execute_va (conn, stmt, types, args);
+  va_end (args);
+
+  if (res < 0)
+    {
+      return res;
+    }
+  return wl_fetch (conn, stmt, true);
+}
+
+/*
+ * wl_fetch () - fetch the first or the next row of an executed select
+ *   return: 1 if a row was fetched, 0 if there are no more rows, or an error
+ */
+static int
+wl_fetch (WL_CONN * conn, WL_STMT stmt, bool is_first)
+{
+  int res;
+
+  res = cci_cursor (conn->req_h[stmt], 1, is_first ? CCI_CURSOR_FIRST : CCI_CURSOR_CURRENT, &conn->cci_error);
+  if (res == CCI_ER_NO_MORE_DATA)
+    {
+      return 0;
+    }
+  if (res >= 0)
+    {
+      res = cci_fetch (conn->req_h[stmt], &conn->cci_error);
+    }
+  if (res < 0)
+    {
+      wl_print_error (conn, res, wl_stmt_sql[stmt]);
+      return res;
+    }
+  return 1;
+}
+
+/* get a column of the fetched row; null is returned as 0 */
+static int
+wl_get_int (WL_CONN * conn, WL_STMT stmt, int col, int *value)
+{
+  int indicator;
+  int res;
+
+  res = cci_get_data (conn->req_h[stmt], col, CCI_A_TYPE_INT, value, &indicator);
+  if (res < 0)
+    {
+      wl_print_error (conn, res, wl_stmt_sql[stmt]);
+      return res;
+    }
+  if (indicator < 0)
+    {
+      *value = 0;
+    }
+  return NO_ERROR;
+}
+
+static int
+wl_get_double (WL_CONN * conn, WL_STMT stmt, int col, double *value)
+{
+  int indicator;
+  int res;
+
+  res = cci_get_data (conn->req_h[stmt], col, CCI_A_TYPE_DOUBLE, value, &indicator);
+  if (res < 0)
+    {
+      wl_print_error (conn, res, wl_stmt_sql[stmt]);
+      return res;
+    }
+  if (indicator < 0)
+    {
+      *value = 0;
+    }
+  return NO_ERROR;
+}
+
+static int
+wl_execute_sql (WL_CONN * conn, const char *sql)
+{
+  int req_h;
+  int res;
+
+  req_h = cci_prepare (conn->con_h, (char *) sql, 0, &conn->cci_error);
+  if (req_h < 0)
+    {
+      wl_print_error (conn, req_h, sql);
+      return req_h;
+    }
+  res = cci_execute (req_h, 0, 0, &conn->cci_error);
+  if (res < 0)
+    {
+      wl_print_error (conn, res, sql);
+    }
+  cci_close_req_handle (req_h);
+  return res;
+}
+
+static int
+wl_commit (WL_CONN * conn)
+{
+  int res;
+
+  res = cci_end_tran (conn->con_h, CCI_TRAN_COMMIT, &conn->cci_error);
+  if (res < 0)
+    {
+      wl_print_error (conn, res, "commit");
+    }
+  return res;
+}
+
+static void
+wl_rollback (WL_CONN * conn)
+{
+  (void) cci_end_tran (conn->con_h, CCI_TRAN_ROLLBACK, &conn->cci_error);
+}
+
+/*
+ * schema and load
+ */
+
+static int
+wl_create_schema (const char **schema, const char *tde_clause)
+{
+  WL_CONN conn;
+  char sql[WL_MAX_SQL_LEN];
+  int res = NO_ERROR;
+  int i;
+
+  res = wl_connect (&conn, 0, CCI_AUTOCOMMIT_TRUE);
+  if (res < 0)
+    {
+      return res;
+    }
+  for (i = 0; schema[i] != NULL && res >= 0; i++)
+    {
+      snprintf (sql, sizeof (sql), schema[i], tde_clause);
+      res = wl_execute_sql (&conn, sql);
+    }
+  wl_disconnect (&conn);
+
+  return res < 0 ? res : NO_ERROR;
+}
+
+/* commit every WL_LOAD_COMMIT_ROWS rows */
+static int
+wl_load_row_done (WL_CONN * conn, int *rows)
+{
+  if (++(*rows) % WL_LOAD_COMMIT_ROWS == 0)
+    {
+      return wl_commit (conn);
+    }
+  return NO_ERROR;
+}
+
+/* each loader inserts the keys for which key modulo the number of connections is its index */
+static int
+wl_load_ycsb (WL_THREAD * thread)
+{
+  WL_CONN *conn = &thread->conn;
+  char fields[WL_YCSB_FIELD_COUNT][WL_YCSB_FIELD_LEN + 1];
+  INT64 key;
+  int rows = 0;
+  int res;
+
+  for (key = thread->index; key < record_count; key += num_connections)
+    {
+      wl_ycsb_fill_fields (conn, fields);
+      res = wl_execute (conn, WL_STMT_YCSB_INSERT, "lssssssssss", key, fields[0], fields[1], fields[2], fields[3],
+			fields[4], fields[5], fields[6], fields[7], fields[8], fields[9]);
+      if (res < 0 || (res = wl_load_row_done (conn, &rows)) < 0)
+	{
+	  return res;
+	}
+    }
+  return wl_commit (conn);
+}
+
+static int
+wl_load_tpcc_items (WL_THREAD * thread)
+{
+  WL_CONN *conn = &thread->conn;
+  char name[25], data[51];
+  int rows = 0;
+  int i_id;
+  int res;
+
+  for (i_id = 1; i_id <= WL_TPCC_ITEMS; i_id++)
+    {
+      wl_random_string (conn, name, wl_random_int (conn, 14, 24));
+      wl_random_string (conn, data, wl_random_int (conn, 26, 50));
+      res = wl_execute (conn, WL_STMT_TPCC_INSERT_ITEM, "isds", i_id, name, wl_random_int (conn, 100, 10000) / 100.0,
+			data);
+      if (res < 0 || (res = wl_load_row_done (conn, &rows)) < 0)
+	{
+	  return res;
+	}
+    }
+  return wl_commit (conn);
+}
+
+/*
+ * wl_load_tpcc_warehouse () - load a warehouse with its stock, districts, customers and orders
+ *
+ *  each customer has placed one order, and the last WL_TPCC_NEW_ORDERS orders of each district are not delivered.
+ */
+static int
+wl_load_tpcc_warehouse (WL_THREAD * thread, int w_id)
+{
+  WL_CONN *conn = &thread->conn;
+  char name[17], data[501];
+  int rows = 0;
+  int d_id, c_id, i_id, o_id, ol_number, ol_cnt;
+  int res;
+
+  wl_random_string (conn, name, 10);
+  res = wl_execute (conn, WL_STMT_TPCC_INSERT_WAREHOUSE, "isd", w_id, name, wl_random_int (conn, 0, 2000) / 10000.0);
+  if (res < 0)
+    {
+      return res;
+    }
+
+  for (i_id = 1; i_id <= WL_TPCC_ITEMS; i_id++)
+    {
+      wl_random_string (conn, data, wl_random_int (conn, 26, 50));
+      res = wl_execute (conn, WL_STMT_TPCC_INSERT_STOCK, "iiis", w_id, i_id, wl_random_int (conn, 10, 100), data);
+      if (res < 0 || (res = wl_load_row_done (conn, &rows)) < 0)
+	{
+	  return res;
+	}
+    }
+
+  for (d_id = 1; d_id <= WL_TPCC_DISTRICTS; d_id++)
+    {
+      wl_random_string (conn, name, 10);
+      res = wl_execute (conn, WL_STMT_TPCC_INSERT_DISTRICT, "iisdi", w_id, d_id, name,
+			wl_random_int (conn, 0, 2000) / 10000.0, WL_TPCC_CUSTOMERS + 1);
+      if (res < 0)
+	{
+	  return res;
+	}
+
+      for (c_id = 1; c_id <= WL_TPCC_CUSTOMERS; c_id++)
+	{
+	  wl_random_string (conn, name, 16);
+	  wl_random_string (conn, data, wl_random_int (conn, 300, 500));
+	  res = wl_execute (conn, WL_STMT_TPCC_INSERT_CUSTOMER, "iiisds", w_id, d_id, c_id, name,
+			    wl_random_int (conn, 0, 5000) / 10000.0, data);
+	  if (res < 0 || (res = wl_load_row_done (conn, &rows)) < 0)
+	    {
+	      return res;
+	    }
+	}
+
+      for (o_id = 1; o_id <= WL_TPCC_CUSTOMERS; o_id++)
+	{
+	  bool is_delivered = o_id <= WL_TPCC_CUSTOMERS - WL_TPCC_NEW_ORDERS;
+
+	  ol_cnt = wl_random_int (conn, WL_TPCC_MIN_ORDER_LINES, WL_TPCC_MAX_ORDER_LINES);
+	  res = wl_execute (conn, WL_STMT_TPCC_INSERT_ORDER, "iiiiii", w_id, d_id, o_id, o_id,
+			    is_delivered ? wl_random_int (conn, 1, 10) : 0, ol_cnt);
+	  if (res >= 0 && !is_delivered)
+	    {
+	      res = wl_execute (conn, WL_STMT_TPCC_INSERT_NEW_ORDER, "iii", w_id, d_id, o_id);
+	    }
+	  for (ol_number = 1; ol_number <= ol_cnt && res >= 0; ol_number++)
+	    {
+	      res = wl_execute (conn, WL_STMT_TPCC_INSERT_ORDER_LINE, "iiiiiiidi", w_id, d_id, o_id, ol_number,
+				wl_random_int (conn, 1, WL_TPCC_ITEMS), w_id, 5,
+				is_delivered ? 0.0 : wl_random_int (conn, 1, 999999) / 100.0, is_delivered ? 1 : 0);
+	    }
+	  if (res < 0 || (res = wl_load_row_done (conn, &rows)) < 0)
+	    {
+	      return res;
+	    }
+	}
+    }
+
+  return wl_commit (conn);
+}
+
+static THREAD_FUNC
+wl_load_main (void *arg)
+{
+  WL_THREAD *thread = (WL_THREAD *) arg;
+  int w_id;
+  int res;
+
+  res = wl_connect (&thread->conn, thread->index, CCI_AUTOCOMMIT_FALSE);
+  if (res < 0)
+    {
+      thread->error = res;
+      return 0;
+    }
+
+  if (workload != WL_WORKLOAD_TPCC)
+    {
+      res = wl_load_ycsb (thread);
+    }
+  else
+    {
+      if (thread->index == 0)
+	{
+	  res = wl_load_tpcc_items (thread);
+	}
+      for (w_id = thread->index + 1; w_id <= warehouse_count && res >= 0; w_id += num_connections)
+	{
+	  res = wl_load_tpcc_warehouse (thread, w_id);
+	}
+    }
+
+  if (res < 0)
+    {
+      wl_rollback (&thread->conn);
+      thread->error = res;
+    }
+  wl_disconnect (&thread->conn);
+  return 0;
+}
+
+/*
+ * YCSB operations
+ */
+
+static void
+wl_ycsb_fill_fields (WL_CONN * conn, char fields[WL_YCSB_FIELD_COUNT][WL_YCSB_FIELD_LEN + 1])
+{
+  int i;
+
+  for (i = 0; i < WL_YCSB_FIELD_COUNT; i++)
+    {
+      wl_random_string (conn, fields[i], WL_YCSB_FIELD_LEN);
+    }
+}
+
+/*
+ * wl_ycsb_next_key () - key of a read, update or scan
+ *
+ *  workload D reads the latest records the most, the inserted ones included. the other workloads scramble the
+ *  zipfian value, so the popular keys are spread over the table instead of being clustered at its start.
+ */
+static INT64
+wl_ycsb_next_key (WL_CONN * conn)
+{
+  INT64 value = wl_zipfian_next (&wl_ycsb_zipfian, conn);
+  INT64 latest;
+  UINT64 hash = 14695981039346656037ULL;
+  int i;
+
+  if (workload == WL_WORKLOAD_YCSB_D)
+    {
+      pthread_mutex_lock (&wl_mutex);
+      latest = wl_ycsb_insert_key;
+      pthread_mutex_unlock (&wl_mutex);
+      return latest - 1 - value >= 0 ? latest - 1 - value : 0;
+    }
+
+  /* FNV-1a */
+  for (i = 0; i < 8; i++)
+    {
+      hash ^= (UINT64) ((value >> (i * 8)) & 0xff);
+      hash *= 1099511628211ULL;
+    }
+  return (INT64) (hash % (UINT64) record_count);
+}
+
+static int
+wl_ycsb_read (WL_CONN * conn)
+{
+  int res = wl_select_row (conn, WL_STMT_YCSB_READ, "l", wl_ycsb_next_key (conn));
+  return res < 0 ? res : NO_ERROR;
+}
+
+static int
+wl_ycsb_update (WL_CONN * conn)
+{
+  char field[WL_YCSB_FIELD_LEN + 1];
+  int res;
+
+  wl_random_string (conn, field, WL_YCSB_FIELD_LEN);
+  res = wl_execute (conn, WL_STMT_YCSB_UPDATE, "sl", field, wl_ycsb_next_key (conn));
+  return res < 0 ? res : NO_ERROR;
+}
+
+static int
+wl_ycsb_insert (WL_CONN * conn)
+{
+  char fields[WL_YCSB_FIELD_COUNT][WL_YCSB_FIELD_LEN + 1];
+  INT64 key;
+  int res;
+
+  pthread_mutex_lock (&wl_mutex);
+  key = wl_ycsb_insert_key++;
+  pthread_mutex_unlock (&wl_mutex);
+
+  wl_ycsb_fill_fields (conn, fields);
+  res = wl_execute (conn, WL_STMT_YCSB_INSERT, "lssssssssss", key, fields[0], fields[1], fields[2], fields[3],
+		    fields[4], fields[5], fields[6], fields[7], fields[8], fields[9]);
+  return res < 0 ? res : NO_ERROR;
+}
+
+static int
+wl_ycsb_scan (WL_CONN * conn)
+{
+  INT64 start_key = wl_ycsb_next_key (conn);
+  int scan_len = wl_random_int (conn, 1, WL_YCSB_MAX_SCAN_LEN);
+  int res;
+
+  res = wl_execute (conn, WL_STMT_YCSB_SCAN, "ll", start_key, start_key + scan_len);
+  if (res > 0)
+    {
+      res = wl_fetch (conn, WL_STMT_YCSB_SCAN, true);
+      while (res > 0)
+	{
+	  res = wl_fetch (conn, WL_STMT_YCSB_SCAN, false);
+	}
+    }
+  return res < 0 ? res : NO_ERROR;
+}
+
+static int
+wl_ycsb_read_modify_write (WL_CONN * conn)
+{
+  char field[WL_YCSB_FIELD_LEN + 1];
+  INT64 key = wl_ycsb_next_key (conn);
+  int res;
+
+  res = wl_select_row (conn, WL_STMT_YCSB_READ, "l", key);
+  if (res < 0)
+    {
+      return res;
+    }
+  wl_random_string (conn, field, WL_YCSB_FIELD_LEN);
+  res = wl_execute (conn, WL_STMT_YCSB_UPDATE, "sl", field, key);
+  return res < 0 ? res : NO_ERROR;
+}
+
+/*
+ * TPC-C like transactions; they are committed or rolled back by the caller
+ */
+
+static int
+wl_tpcc_new_order (WL_CONN * conn, int w_id)
+{
+  int d_id = wl_random_int (conn, 1, WL_TPCC_DISTRICTS);
+  int c_id = wl_nurand (conn, 1023, 1, WL_TPCC_CUSTOMERS);
+  int ol_cnt = wl_random_int (conn, WL_TPCC_MIN_ORDER_LINES, WL_TPCC_MAX_ORDER_LINES);
+  int items[WL_TPCC_MAX_ORDER_LINES], supply_w_ids[WL_TPCC_MAX_ORDER_LINES], quantities[WL_TPCC_MAX_ORDER_LINES];
+  double w_tax, d_tax, discount, price;
+  int o_id;
+  int i, j;
+  int res;
+
+  for (i = 0; i < ol_cnt; i++)
+    {
+      items[i] = wl_nurand (conn, 8191, 1, WL_TPCC_ITEMS);
+      supply_w_ids[i] = w_id;
+      if (warehouse_count > 1 && wl_random_int (conn, 1, 100) == 1)
+	{
+	  supply_w_ids[i] = wl_random_int (conn, 1, warehouse_count);
+	}
+      quantities[i] = wl_random_int (conn, 1, 10);
+    }
+  /* update stock in the same order in all transactions, so they do not deadlock each other */
+  for (i = 1; i < ol_cnt; i++)
+    {
+      int item = items[i], supply_w_id = supply_w_ids[i];
+      for (j = i; j > 0 && (supply_w_ids[j - 1] > supply_w_id
+			    || (supply_w_ids[j - 1] == supply_w_id && items[j - 1] > item)); j--)
+	{
+	  items[j] = items[j - 1];
+	  supply_w_ids[j] = supply_w_ids[j - 1];
+	}
+      items[j] = item;
+      supply_w_ids[j] = supply_w_id;
+    }
+  /* 1% of the orders have an unused item and are rolled back */
+  if (wl_random_int (conn, 1, 100) == 1)
+    {
+      items[ol_cnt - 1] = WL_TPCC_ITEMS + 1;
+    }
+
+  res = wl_execute (conn, WL_STMT_TPCC_NEXT_ORDER_ID, "ii", w_id, d_id);
+  if (res >= 0)
+    {
+      res = wl_select_row (conn, WL_STMT_TPCC_GET_DISTRICT, "ii", w_id, d_id);
+    }
+  if (res > 0 && (res = wl_get_int (conn, WL_STMT_TPCC_GET_DISTRICT, 1, &o_id)) >= 0)
+    {
+      res = wl_get_double (conn, WL_STMT_TPCC_GET_DISTRICT, 2, &d_tax);
+    }
+  if (res >= 0)
+    {
+      res = wl_select_row (conn, WL_STMT_TPCC_GET_WAREHOUSE_TAX, "i", w_id);
+    }
+  if (res > 0)
+    {
+      res = wl_get_double (conn, WL_STMT_TPCC_GET_WAREHOUSE_TAX, 1, &w_tax);
+    }
+  if (res >= 0)
+    {
+      res = wl_select_row (conn, WL_STMT_TPCC_GET_CUSTOMER, "iii", w_id, d_id, c_id);
+    }
+  if (res > 0)
+    {
+      res = wl_get_double (conn, WL_STMT_TPCC_GET_CUSTOMER, 1, &discount);
+    }
+  if (res >= 0)
+    {
+      res = wl_execute (conn, WL_STMT_TPCC_INSERT_ORDER, "iiiiii", w_id, d_id, o_id, c_id, 0, ol_cnt);
+    }
+  if (res >= 0)
+    {
+      res = wl_execute (conn, WL_STMT_TPCC_INSERT_NEW_ORDER, "iii", w_id, d_id, o_id);
+    }
+
+  for (i = 0; i < ol_cnt && res >= 0; i++)
+    {
+      res = wl_select_row (conn, WL_STMT_TPCC_GET_ITEM_PRICE, "i", items[i]);
+      if (res == 0)
+	{
+	  return WL_ROLLED_BACK;
+	}
+      if (res > 0)
+	{
+	  res = wl_get_double (conn, WL_STMT_TPCC_GET_ITEM_PRICE, 1, &price);
+	}
+      if (res >= 0)
+	{
+	  res = wl_execute (conn, WL_STMT_TPCC_UPDATE_STOCK, "iiiiii", quantities[i], quantities[i], quantities[i],
+			    quantities[i], supply_w_ids[i], items[i]);
+	}
+      if (res >= 0)
+	{
+	  res = wl_execute (conn, WL_STMT_TPCC_INSERT_ORDER_LINE, "iiiiiiidi", w_id, d_id, o_id, i + 1, items[i],
+			    supply_w_ids[i], quantities[i],
+			    quantities[i] * price * (1 + w_tax + d_tax) * (1 - discount), 0);
+	}
+    }
+
+  return res < 0 ? res : NO_ERROR;
+}
+
+static int
+wl_tpcc_payment (WL_CONN * conn, int w_id)
+{
+  int d_id = wl_random_int (conn, 1, WL_TPCC_DISTRICTS);
+  int c_w_id = w_id, c_d_id = d_id;
+  int c_id = wl_nurand (conn, 1023, 1, WL_TPCC_CUSTOMERS);
+  double amount = wl_random_int (conn, 100, 500000) / 100.0;
+  char data[25];
+  int res;
+
+  /* 15% of the customers pay through another warehouse */
+  if (warehouse_count > 1 && wl_random_int (conn, 1, 100) <= 15)
+    {
+      c_w_id = wl_random_int (conn, 1, warehouse_count);
+      c_d_id = wl_random_int (conn, 1, WL_TPCC_DISTRICTS);
+    }
+  wl_random_string (conn, data, 24);
+
+  res = wl_execute (conn, WL_STMT_TPCC_PAY_WAREHOUSE, "di", amount, w_id);
+  if (res >= 0)
+    {
+      res = wl_execute (conn, WL_STMT_TPCC_PAY_DISTRICT, "dii", amount, w_id, d_id);
+    }
+  if (res >= 0)
+    {
+      res = wl_execute (conn, WL_STMT_TPCC_PAY_CUSTOMER, "ddiii", amount, amount, c_w_id, c_d_id, c_id);
+    }
+  if (res >= 0)
+    {
+      res = wl_execute (conn, WL_STMT_TPCC_INSERT_HISTORY, "iiiiids", c_id, c_d_id, c_w_id, d_id, w_id, amount, data);
+    }
+
+  return res < 0 ? res : NO_ERROR;
+}
+
+static int
+wl_tpcc_order_status (WL_CONN * conn, int w_id)
+{
+  int d_id = wl_random_int (conn, 1, WL_TPCC_DISTRICTS);
+  int c_id = wl_nurand (conn, 1023, 1, WL_TPCC_CUSTOMERS);
+  int o_id = 0;
+  int res;
+
+  res = wl_select_row (conn, WL_STMT_TPCC_GET_CUSTOMER, "iii", w_id, d_id, c_id);
+  if (res >= 0)
+    {
+      res = wl_select_row (conn, WL_STMT_TPCC_LAST_ORDER, "iii", w_id, d_id, c_id);
+    }
+  if (res > 0)
+    {
+      res = wl_get_int (conn, WL_STMT_TPCC_LAST_ORDER, 1, &o_id);
+    }
+  if (res >= 0 && o_id > 0)
+    {
+      res = wl_select_row (conn, WL_STMT_TPCC_GET_ORDER_LINES, "iii", w_id, d_id, o_id);
+      while (res > 0)
+	{
+	  res = wl_fetch (conn, WL_STMT_TPCC_GET_ORDER_LINES, false);
+	}
+    }
+
+  return res < 0 ? res : NO_ERROR;
+}
+
+/* deliver the oldest undelivered order of each district */
+static int
+wl_tpcc_delivery (WL_CONN * conn, int w_id)
+{
+  int carrier_id = wl_random_int (conn, 1, 10);
+  int d_id, o_id, c_id;
+  double amount;
+  int res = NO_ERROR;
+
+  for (d_id = 1; d_id <= WL_TPCC_DISTRICTS && res >= 0; d_id++)
+    {
+      o_id = 0;
+      res = wl_select_row (conn, WL_STMT_TPCC_OLDEST_NEW_ORDER, "ii", w_id, d_id);
+      if (res > 0)
+	{
+	  res = wl_get_int (conn, WL_STMT_TPCC_OLDEST_NEW_ORDER, 1, &o_id);
+	}
+      if (res < 0 || o_id == 0)
+	{
+	  continue;
+	}
+
+      res = wl_execute (conn, WL_STMT_TPCC_DELETE_NEW_ORDER, "iii", w_id, d_id, o_id);
+      if (res <= 0)
+	{
+	  /* delivered by another transaction meanwhile */
+	  continue;
+	}
+
+      c_id = 0;
+      res = wl_select_row (conn, WL_STMT_TPCC_GET_ORDER_CUSTOMER, "iii", w_id, d_id, o_id);
+      if (res > 0)
+	{
+	  res = wl_get_int (conn, WL_STMT_TPCC_GET_ORDER_CUSTOMER, 1, &c_id);
+	}
+      if (res >= 0)
+	{
+	  res = wl_execute (conn, WL_STMT_TPCC_SET_CARRIER, "iiii", carrier_id, w_id, d_id, o_id);
+	}
+      if (res >= 0)
+	{
+	  res = wl_execute (conn, WL_STMT_TPCC_DELIVER_ORDER_LINES, "iii", w_id, d_id, o_id);
+	}
+      amount = 0;
+      if (res >= 0)
+	{
+	  res = wl_select_row (conn, WL_STMT_TPCC_SUM_ORDER_LINES, "iii", w_id, d_id, o_id);
+	}
+      if (res > 0)
+	{
+	  res = wl_get_double (conn, WL_STMT_TPCC_SUM_ORDER_LINES, 1, &amount);
+	}
+      if (res >= 0)
+	{
+	  res = wl_execute (conn, WL_STMT_TPCC_DELIVER_CUSTOMER, "diii", amount, w_id, d_id, c_id);
+	}
+    }
+
+  return res < 0 ? res : NO_ERROR;
+}
+
+/* count the items under a threshold in the stock, among those of the last orders of a district */
+static int
+wl_tpcc_stock_level (WL_CONN * conn, int w_id)
+{
+  int d_id = wl_random_int (conn, 1, WL_TPCC_DISTRICTS);
+  int threshold = wl_random_int (conn, 10, 20);
+  int next_o_id = 0;
+  int low_stock;
+  int res;
+
+  res = wl_select_row (conn, WL_STMT_TPCC_GET_NEXT_ORDER_ID, "ii", w_id, d_id);
+  if (res > 0)
+    {
+      res = wl_get_int (conn, WL_STMT_TPCC_GET_NEXT_ORDER_ID, 1, &next_o_id);
+    }
+  if (res >= 0)
+    {
+      res = wl_select_row (conn, WL_STMT_TPCC_COUNT_LOW_STOCK, "iiiiii", w_id, d_id,
+			   next_o_id - WL_TPCC_STOCK_LEVEL_ORDERS, next_o_id, w_id, threshold);
+    }
+  if (res > 0)
+    {
+      res = wl_get_int (conn, WL_STMT_TPCC_COUNT_LOW_STOCK, 1, &low_stock);
+    }
+
+  return res < 0 ? res : NO_ERROR;
+}
+
+/*
+ * run
+ */
+
+static WL_OP
+wl_pick_op (WL_CONN * conn)
+{
+  int pick = wl_random_int (conn, 0, 99);
+  int op;
+
+  for (op = 0; op < WL_OP_COUNT - 1; op++)
+    {
+      pick -= wl_op_mix[workload][op];
+      if (pick < 0)
+	{
+	  break;
+	}
+    }
+  return (WL_OP) op;
+}
+
+/* run an operation; TPC-C like transactions are committed here, YCSB operations run in auto commit mode */
+static int
+wl_run_op (WL_THREAD * thread, WL_OP op)
+{
+  WL_CONN *conn = &thread->conn;
+  int w_id = thread->index % warehouse_count + 1;	/* each connection is a terminal of a home warehouse */
+  int res;
+
+  switch (op)
+    {
+    case WL_OP_READ:
+      return wl_ycsb_read (conn);
+    case WL_OP_UPDATE:
+      return wl_ycsb_update (conn);
+    case WL_OP_INSERT:
+      return wl_ycsb_insert (conn);
+    case WL_OP_SCAN:
+      return wl_ycsb_scan (conn);
+    case WL_OP_READ_MODIFY_WRITE:
+      return wl_ycsb_read_modify_write (conn);
+    case WL_OP_NEW_ORDER:
+      res = wl_tpcc_new_order (conn, w_id);
+      break;
+    case WL_OP_PAYMENT:
+      res = wl_tpcc_payment (conn, w_id);
+      break;
+    case WL_OP_ORDER_STATUS:
+      res = wl_tpcc_order_status (conn, w_id);
+      break;
+    case WL_OP_DELIVERY:
+      res = wl_tpcc_delivery (conn, w_id);
+      break;
+    case WL_OP_STOCK_LEVEL:
+      res = wl_tpcc_stock_level (conn, w_id);
+      break;
+    default:
+      assert (false);
+      return ER_FAILED;
+    }
+
+  if (res == NO_ERROR)
+    {
+      res = wl_commit (conn);
+    }
+  else
+    {
+      wl_rollback (conn);
+    }
+  return res;
+}
+
+static THREAD_FUNC
+wl_run_main (void *arg)
+{
+  WL_THREAD *thread = (WL_THREAD *) arg;
+  WL_OP op;
+  INT64 start_usec;
+  UINT64 elapsed_usec;
+  int res;
+
+  res = wl_connect (&thread->conn, thread->index,
+		    workload == WL_WORKLOAD_TPCC ? CCI_AUTOCOMMIT_FALSE : CCI_AUTOCOMMIT_TRUE);
+  if (res < 0)
+    {
+      thread->error = res;
+      return 0;
+    }
+
+  while (!wl_stop)
+    {
+      op = wl_pick_op (&thread->conn);
+      start_usec = wl_now_usec ();
+      res = wl_run_op (thread, op);
+      elapsed_usec = (UINT64) (wl_now_usec () - start_usec);
+
+      pthread_mutex_lock (&thread->stat_mutex);
+      if (res < 0)
+	{
+	  thread->interval_errors++;
+	  thread->op_errors[op]++;
+	}
+      else
+	{
+	  wl_hist_record (&thread->interval_hist, elapsed_usec);
+	  wl_hist_record (&thread->op_hist[op], elapsed_usec);
+	  if (res == WL_ROLLED_BACK)
+	    {
+	      thread->rollbacks++;
+	    }
+	}
+      pthread_mutex_unlock (&thread->stat_mutex);
+
+      if (res == CCI_ER_COMMUNICATION || res == CCI_ER_CON_HANDLE)
+	{
+	  /* connection is lost */
+	  thread->error = res;
+	  break;
+	}
+    }
+
+  wl_disconnect (&thread->conn);
+  return 0;
+}
+
+/* start a thread for each connection and wait for them, to load the tables */
+static int
+wl_load_threads (WL_THREAD * threads)
+{
+  int i;
+  int error = NO_ERROR;
+
+  for (i = 0; i < num_connections; i++)
+    {
+      if (pthread_create (&threads[i].tid, NULL, wl_load_main, (void *) &threads[i]) < 0)
+	{
+	  perror ("Error:cannot create thread");
+	  wl_stop = 1;
+	  num_connections = i;
+	  error = ER_FAILED;
+	  break;
+	}
+    }
+  for (i = 0; i < num_connections; i++)
+    {
+      pthread_join (threads[i].tid, NULL);
+      if (threads[i].error != NO_ERROR && error == NO_ERROR)
+	{
+	  error = threads[i].error;
+	}
+    }
+  return error;
+}
+
+/*
+ * wl_run_pass () - create and load the tables, then run the workload and report
+ *   return: error code
+ *   tde(in): TDE algorithm of the tables
+ *   result(out): throughput and latency of the run
+ */
+static int
+wl_run_pass (WL_TDE_MODE tde, WL_RESULT * result)
+{
+  const char *tde_clause = tde == WL_TDE_AES ? "ENCRYPT=AES" : (tde == WL_TDE_ARIA ? "ENCRYPT=ARIA" : "");
+  WL_THREAD *threads;
+  INT64 start_usec, end_usec, report_usec, now_usec, last_report_usec;
+  int thread_count = num_connections;
+  int error = NO_ERROR;
+  int i;
+
+  memset (result, 0, sizeof (*result));
+
+  threads = (WL_THREAD *) calloc (num_connections, sizeof (WL_THREAD));
+  if (threads == NULL)
+    {
+      fprintf (stderr, "malloc error\n");
+      return ER_FAILED;
+    }
+  for (i = 0; i < num_connections; i++)
+    {
+      threads[i].index = i;
+      threads[i].conn.con_h = -1;
+      pthread_mutex_init (&threads[i].stat_mutex, NULL);
+    }
+
+  fprintf (stdout, "\n%s, TDE %s\n", wl_workload_names[workload],
+	   tde == WL_TDE_AES ? "AES" : (tde == WL_TDE_ARIA ? "ARIA" : "off"));
+
+  wl_ycsb_insert_key = record_count;
+  if (!skip_load)
+    {
+      start_usec = wl_now_usec ();
+      error = wl_create_schema (workload == WL_WORKLOAD_TPCC ? wl_tpcc_schema : wl_ycsb_schema, tde_clause);
+      if (error == NO_ERROR)
+	{
+	  error = wl_load_threads (threads);
+	}
+      if (error != NO_ERROR)
+	{
+	  fprintf (stderr, "error: failed to load the tables\n");
+	  goto end;
+	}
+      fprintf (stdout, "loaded in %.1f sec\n", (wl_now_usec () - start_usec) / 1000000.0);
+    }
+
+  wl_stop = 0;
+  wl_print_report_header ();
+
+  start_usec = wl_now_usec ();
+  for (i = 0; i < num_connections; i++)
+    {
+      if (pthread_create (&threads[i].tid, NULL, wl_run_main, (void *) &threads[i]) < 0)
+	{
+	  perror ("Error:cannot create thread");
+	  wl_stop = 1;
+	  thread_count = i;
+	  error = ER_FAILED;
+	  break;
+	}
+    }
+
+  end_usec = start_usec + (INT64) run_seconds * 1000000;
+  last_report_usec = start_usec;
+  report_usec = start_usec + (INT64) report_interval * 1000000;
+  while (!wl_stop)
+    {
+      SLEEP_MILISEC (0, 100);
+      now_usec = wl_now_usec ();
+      if (now_usec >= end_usec)
+	{
+	  wl_stop = 1;
+	}
+      else if (now_usec >= report_usec)
+	{
+	  wl_print_interval (threads, (now_usec - start_usec) / 1000000.0, (now_usec - last_report_usec) / 1000000.0,
+			     result);
+	  last_report_usec = now_usec;
+	  report_usec += (INT64) report_interval * 1000000;
+	}
+    }
+  for (i = 0; i < thread_count; i++)
+    {
+      pthread_join (threads[i].tid, NULL);
+      if (threads[i].error != NO_ERROR && error == NO_ERROR)
+	{
+	  error = threads[i].error;
+	}
+    }
+  now_usec = wl_now_usec ();
+  wl_print_interval (threads, (now_usec - start_usec) / 1000000.0, (now_usec - last_report_usec) / 1000000.0,
+		     result);
+  result->elapsed_sec = (now_usec - start_usec) / 1000000.0;
+
+  wl_print_summary (threads, result);
+  if (error != NO_ERROR)
+    {
+      fprintf (stderr, "error: some connections failed\n");
+    }
+
+end:
+  for (i = 0; i < num_connections; i++)
+    {
+      pthread_mutex_destroy (&threads[i].stat_mutex);
+    }
+  free (threads);
+  return error;
+}
+
+static void
+wl_print_report_header (void)
+{
+  fprintf (stdout, "%8s %10s %10s %10s %10s %10s %10s %8s\n", "time(s)", "ops/s", "avg(us)", "p50(us)", "p95(us)",
+	   "p99(us)", "max(us)", "errors");
+}
+
+/* take and print the statistics of the last interval, and add them to the run result */
+static void
+wl_print_interval (WL_THREAD * threads, double elapsed_sec, double interval_sec, WL_RESULT * result)
+{
+  WL_HISTOGRAM *hist;
+  UINT64 errors = 0;
+  int i;
+
+  hist = (WL_HISTOGRAM *) calloc (1, sizeof (WL_HISTOGRAM));
+  if (hist == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < num_connections; i++)
+    {
+      pthread_mutex_lock (&threads[i].stat_mutex);
+      wl_hist_merge (hist, &threads[i].interval_hist);
+      errors += threads[i].interval_errors;
+      memset (&threads[i].interval_hist, 0, sizeof (WL_HISTOGRAM));
+      threads[i].interval_errors = 0;
+      pthread_mutex_unlock (&threads[i].stat_mutex);
+    }
+  wl_hist_merge (&result->total_hist, hist);
+  result->errors += errors;
+
+  if (interval_sec <= 0)
+    {
+      interval_sec = 1;
+    }
+  fprintf (stdout, "%8.1f %10.1f %10llu %10llu %10llu %10llu %10llu %8llu\n", elapsed_sec,
+	   hist->total_count / interval_sec,
+	   (unsigned long long) (hist->total_count > 0 ? hist->sum_usec / hist->total_count : 0),
+	   (unsigned long long) wl_hist_percentile (hist, 50), (unsigned long long) wl_hist_percentile (hist, 95),
+	   (unsigned long long) wl_hist_percentile (hist, 99), (unsigned long long) hist->max_usec,
+	   (unsigned long long) errors);
+  fflush (stdout);
+
+  free (hist);
+}
+
+static void
+wl_print_summary (WL_THREAD * threads, const WL_RESULT * result)
+{
+  WL_HISTOGRAM *hist;
+  UINT64 errors, rollbacks = 0, new_orders = 0;
+  int op, i;
+
+  hist = (WL_HISTOGRAM *) malloc (sizeof (WL_HISTOGRAM));
+  if (hist == NULL)
+    {
+      return;
+    }
+
+  fprintf (stdout, "\n%-18s %10s %10s %10s %10s %10s %10s %10s %8s\n", "operation", "count", "ops/s", "avg(us)",
+	   "p50(us)", "p95(us)", "p99(us)", "max(us)", "errors");
+  for (op = 0; op <= WL_OP_COUNT; op++)
+    {
+      const char *name;
+
+      if (op < WL_OP_COUNT)
+	{
+	  memset (hist, 0, sizeof (WL_HISTOGRAM));
+	  errors = 0;
+	  for (i = 0; i < num_connections; i++)
+	    {
+	      wl_hist_merge (hist, &threads[i].op_hist[op]);
+	      errors += threads[i].op_errors[op];
+	    }
+	  if (hist->total_count == 0 && errors == 0)
+	    {
+	      continue;
+	    }
+	  if (op == WL_OP_NEW_ORDER)
+	    {
+	      new_orders = hist->total_count;
+	    }
+	  name = wl_op_names[op];
+	}
+      else
+	{
+	  memcpy (hist, &result->total_hist, sizeof (WL_HISTOGRAM));
+	  errors = result->errors;
+	  name = "total";
+	}
+
+      fprintf (stdout, "%-18s %10llu %10.1f %10llu %10llu %10llu %10llu %10llu %8llu\n", name,
+	       (unsigned long long) hist->total_count, hist->total_count / result->elapsed_sec,
+	       (unsigned long long) (hist->total_count > 0 ? hist->sum_usec / hist->total_count : 0),
+	       (unsigned long long) wl_hist_percentile (hist, 50), (unsigned long long) wl_hist_percentile (hist, 95),
+	       (unsigned long long) wl_hist_percentile (hist, 99), (unsigned long long) hist->max_usec,
+	       (unsigned long long) errors);
+    }
+
+  if (workload == WL_WORKLOAD_TPCC)
+    {
+      for (i = 0; i < num_connections; i++)
+	{
+	  rollbacks += threads[i].rollbacks;
+	}
+      fprintf (stdout, "new-order per minute: %.1f, rolled back new-orders: %llu\n",
+	       new_orders * 60 / result->elapsed_sec, (unsigned long long) rollbacks);
+    }
+
+  free (hist);
+}
@@ -81,6 +81,9 @@
 #endif /* !CAS_FOR_ORACLE && !CAS_FOR_MYSQL */
 #include "error_manager.h"
 #include "ddl_log.h"
+#ifndef LIBCAS_FOR_JSP
+#include "lz4.h"
+#endif /* !LIBCAS_FOR_JSP */
 
 static const int DEFAULT_CHECK_INTERVAL = 1;
 
@@ -122,6 +125,9 @@ static int net_read_header_keep_con_on (SOCKET clt_sock_fd, MSG_HEADER * client_
 static void set_db_connection_info (void);
 static void clear_db_connection_info (void);
 static bool need_database_reconnect (void);
+static T_CAS_LATENCY_TYPE get_latency_type (char func_code);
+static int cas_write_compressed_msg (SOCKET sock_fd, T_NET_BUF * net_buf);
+static char *cas_read_compressed_msg (SOCKET sock_fd, int compressed_size, int *msg_size);
 
 extern bool ssl_client;
 extern int cas_init_ssl (int);
@@ -1261,6 +1267,7 @@ cas_main (void)
 		as_info->cur_statement_pooling = OFF;
 	      }
 	    cas_bi_set_cci_pconnect (shm_appl->cci_pconnect);
+	    cas_bi_set_lz4_compression (cas_di_request_lz4_compression (req_info.driver_info));
 
 	    cas_info[CAS_INFO_STATUS] = CAS_INFO_STATUS_ACTIVE;
 	    /* todo: casting T_BROKER_VERSION to T_CAS_PROTOCOL */
@@ -1703,6 +1710,10 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 #endif
   T_SERVER_FUNC server_fn;
   FN_RETURN fn_ret = FN_KEEP_CONN;
+#ifndef LIBCAS_FOR_JSP
+  struct timeval fn_start_time;
+  T_CAS_LATENCY_TYPE latency_type;
+#endif
 
   error_info_clear ();
   init_msg_header (&client_msg_header);
@@ -1882,20 +1893,37 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
       req_info->client_version = CAS_PROTO_CURRENT_VER;
     }
 
-  read_msg = (char *) MALLOC (*(client_msg_header.msg_body_size_ptr));
-  if (read_msg == NULL)
+#ifndef LIBCAS_FOR_JSP
+  if (*(client_msg_header.msg_body_size_ptr) < 0 && cas_bi_get_lz4_compression ())
     {
-      net_write_error (sock_fd, req_info->client_version, req_info->driver_info, cas_msg_header.info_ptr, cas_info_size,
-		       CAS_ERROR_INDICATOR, CAS_ER_NO_MORE_MEMORY, NULL);
-      return FN_CLOSE_CONN;
+      read_msg = cas_read_compressed_msg (sock_fd, -*(client_msg_header.msg_body_size_ptr),
+					  client_msg_header.msg_body_size_ptr);
+      if (read_msg == NULL)
+	{
+	  net_write_error (sock_fd, req_info->client_version, req_info->driver_info, cas_msg_header.info_ptr,
+			   cas_info_size, CAS_ERROR_INDICATOR, CAS_ER_COMMUNICATION, NULL);
+	  cas_log_write_and_end (0, true, "COMMUNICATION ERROR cas_read_compressed_msg()");
+	  return FN_CLOSE_CONN;
+	}
     }
-  if (net_read_stream (sock_fd, read_msg, *(client_msg_header.msg_body_size_ptr)) < 0)
+  else
+#endif /* !LIBCAS_FOR_JSP */
     {
-      FREE_MEM (read_msg);
-      net_write_error (sock_fd, req_info->client_version, req_info->driver_info, cas_msg_header.info_ptr, cas_info_size,
-		       CAS_ERROR_INDICATOR, CAS_ER_COMMUNICATION, NULL);
-      cas_log_write_and_end (0, true, "COMMUNICATION ERROR net_read_stream()");
-      return FN_CLOSE_CONN;
+      read_msg = (char *) MALLOC (*(client_msg_header.msg_body_size_ptr));
+      if (read_msg == NULL)
+	{
+	  net_write_error (sock_fd, req_info->client_version, req_info->driver_info, cas_msg_header.info_ptr,
+			   cas_info_size, CAS_ERROR_INDICATOR, CAS_ER_NO_MORE_MEMORY, NULL);
+	  return FN_CLOSE_CONN;
+	}
+      if (net_read_stream (sock_fd, read_msg, *(client_msg_header.msg_body_size_ptr)) < 0)
+	{
+	  FREE_MEM (read_msg);
+	  net_write_error (sock_fd, req_info->client_version, req_info->driver_info, cas_msg_header.info_ptr,
+			   cas_info_size, CAS_ERROR_INDICATOR, CAS_ER_COMMUNICATION, NULL);
+	  cas_log_write_and_end (0, true, "COMMUNICATION ERROR net_read_stream()");
+	  return FN_CLOSE_CONN;
+	}
     }
 
   argc = net_decode_str (read_msg, *(client_msg_header.msg_body_size_ptr), &func_code, &argv);
@@ -2021,9 +2049,23 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 
   net_buf->client_version = req_info->client_version;
   set_hang_check_time ();
+#ifndef LIBCAS_FOR_JSP
+  gettimeofday (&fn_start_time, NULL);
+#endif
   fn_ret = (*server_fn) (sock_fd, argc, argv, net_buf, req_info);
   set_hang_check_time ();
 
+#ifndef LIBCAS_FOR_JSP
+  latency_type = get_latency_type (func_code);
+  if (latency_type != CAS_LATENCY_TYPE_COUNT)
+    {
+      struct timeval fn_end_time;
+
+      gettimeofday (&fn_end_time, NULL);
+      broker_shm_add_latency (&as_info->latency_hist[latency_type], &fn_start_time, &fn_end_time);
+    }
+#endif
+
 #if !defined(CAS_FOR_ORACLE) && !defined(CAS_FOR_MYSQL)
   /* set back original utype for enum, date-time, JSON */
   if (DOES_CLIENT_MATCH_THE_PROTOCOL (req_info->client_version, PROTOCOL_V2))
@@ -2186,10 +2228,27 @@ process_request (SOCKET sock_fd, T_NET_BUF * net_buf, T_REQ_INFO * req_info)
 	}
 
       assert (NET_BUF_CURR_SIZE (net_buf) <= net_buf->alloc_size);
-      if (net_write_stream (sock_fd, net_buf->data, NET_BUF_CURR_SIZE (net_buf)) < 0)
+#ifndef LIBCAS_FOR_JSP
+      /* the file sent after the message is counted in the message size, so such a message is not compressed */
+      if (cas_bi_get_lz4_compression () && net_buf->post_send_file == NULL
+	  && net_buf->data_size >= CAS_COMPRESS_MIN_SIZE)
+	{
+	  err_code = cas_write_compressed_msg (sock_fd, net_buf);
+	}
+      else
 	{
-	  cas_log_write_and_end (0, true, "COMMUNICATION ERROR net_write_stream()");
+	  err_code = 0;
 	}
+      if (err_code < 0)
+	{
+	  cas_log_write_and_end (0, true, "COMMUNICATION ERROR cas_write_compressed_msg()");
+	}
+      else if (err_code == 0)
+#endif /* !LIBCAS_FOR_JSP */
+	if (net_write_stream (sock_fd, net_buf->data, NET_BUF_CURR_SIZE (net_buf)) < 0)
+	  {
+	    cas_log_write_and_end (0, true, "COMMUNICATION ERROR net_write_stream()");
+	  }
     }
 
   if (cas_shard_flag == OFF && cas_send_result_flag && net_buf->post_send_file != NULL)
@@ -2232,6 +2291,132 @@ exit_on_end:
 }
 
 #ifndef LIBCAS_FOR_JSP
+/*
+ * get_latency_type - latency histogram the request is counted in; CAS_LATENCY_TYPE_COUNT if none
+ */
+static T_CAS_LATENCY_TYPE
+get_latency_type (char func_code)
+{
+  switch (func_code)
+    {
+    case CAS_FC_PREPARE:
+      return CAS_LATENCY_PREPARE;
+    case CAS_FC_EXECUTE:
+    case CAS_FC_EXECUTE_BATCH:
+    case CAS_FC_EXECUTE_ARRAY:
+    case CAS_FC_PREPARE_AND_EXECUTE:
+    case CAS_FC_PREPARE_AND_EXECUTE_FOR_PROTO_V2:
+      return CAS_LATENCY_EXECUTE;
+    case CAS_FC_FETCH:
+      return CAS_LATENCY_FETCH;
+    default:
+      return CAS_LATENCY_TYPE_COUNT;
+    }
+}
+
+/*
+ * cas_write_compressed_msg - write the message in net_buf with its body LZ4 compressed
+ *   return: 1 if written, 0 if compression does not pay and the message was not written, -1 on write error
+ */
+static int
+cas_write_compressed_msg (SOCKET sock_fd, T_NET_BUF * net_buf)
+{
+  static char *compress_buf = NULL;
+  static int compress_buf_size = 0;
+  char *p;
+  int bound, compressed_size, v;
+
+  bound = NET_BUF_HEADER_SIZE + CAS_COMPRESS_ORIGINAL_SIZE_SIZE + LZ4_compressBound (net_buf->data_size);
+  if (bound > compress_buf_size)
+    {
+      p = (char *) REALLOC (compress_buf, bound);
+      if (p == NULL)
+	{
+	  return 0;
+	}
+      compress_buf = p;
+      compress_buf_size = bound;
+    }
+
+  p = compress_buf + NET_BUF_HEADER_SIZE + CAS_COMPRESS_ORIGINAL_SIZE_SIZE;
+  compressed_size =
+    LZ4_compress_default (net_buf->data + NET_BUF_HEADER_SIZE, p, net_buf->data_size,
+			  compress_buf_size - (int) (p - compress_buf));
+  if (compressed_size <= 0 || compressed_size + CAS_COMPRESS_ORIGINAL_SIZE_SIZE >= net_buf->data_size)
+    {
+      return 0;
+    }
+
+  /* header with negated body size and cas info, then original size and compressed body */
+  v = htonl (-(compressed_size + CAS_COMPRESS_ORIGINAL_SIZE_SIZE));
+  memcpy (compress_buf, &v, NET_BUF_HEADER_MSG_SIZE);
+  memcpy (compress_buf + NET_BUF_HEADER_MSG_SIZE, net_buf->data + NET_BUF_HEADER_MSG_SIZE, cas_info_size);
+  v = htonl (net_buf->data_size);
+  memcpy (compress_buf + NET_BUF_HEADER_SIZE, &v, CAS_COMPRESS_ORIGINAL_SIZE_SIZE);
+
+  if (net_write_stream (sock_fd, compress_buf, NET_BUF_HEADER_SIZE + CAS_COMPRESS_ORIGINAL_SIZE_SIZE + compressed_size)
+      < 0)
+    {
+      return -1;
+    }
+
+  return 1;
+}
+
+/*
+ * cas_read_compressed_msg - read a compressed message body and return it decompressed
+ *   return: body allocated with MALLOC, NULL on error
+ */
+static char *
+cas_read_compressed_msg (SOCKET sock_fd, int compressed_size, int *msg_size)
+{
+  char *compressed_msg, *msg;
+  int original_size;
+
+  if (compressed_size <= CAS_COMPRESS_ORIGINAL_SIZE_SIZE)
+    {
+      return NULL;
+    }
+
+  compressed_msg = (char *) MALLOC (compressed_size);
+  if (compressed_msg == NULL)
+    {
+      return NULL;
+    }
+  if (net_read_stream (sock_fd, compressed_msg, compressed_size) < 0)
+    {
+      FREE_MEM (compressed_msg);
+      return NULL;
+    }
+
+  memcpy (&original_size, compressed_msg, CAS_COMPRESS_ORIGINAL_SIZE_SIZE);
+  original_size = ntohl (original_size);
+  if (original_size <= 0)
+    {
+      FREE_MEM (compressed_msg);
+      return NULL;
+    }
+
+  msg = (char *) MALLOC (original_size);
+  if (msg == NULL)
+    {
+      FREE_MEM (compressed_msg);
+      return NULL;
+    }
+
+  if (LZ4_decompress_safe (compressed_msg + CAS_COMPRESS_ORIGINAL_SIZE_SIZE, msg,
+			   compressed_size - CAS_COMPRESS_ORIGINAL_SIZE_SIZE, original_size) != original_size)
+    {
+      FREE_MEM (compressed_msg);
+      FREE_MEM (msg);
+      return NULL;
+    }
+
+  FREE_MEM (compressed_msg);
+  *msg_size = original_size;
+  return msg;
+}
+
 static int
 cas_init ()
 {
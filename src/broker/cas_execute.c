@@ -69,6 +69,7 @@
 #include "schema_manager.h"
 #include "object_representation.h"
 #include "connection_cl.h"
+#include "execute_statement.h"
 
 #include "db_set_function.h"
 #include "dbi.h"
@@ -230,6 +231,8 @@ static int fetch_foreign_keys (T_SRV_HANDLE *, int, int, char, int, T_NET_BUF *,
 static void add_res_data_bytes (T_NET_BUF * net_buf, const char *str, int size, unsigned char ext_type, int *net_size);
 static void add_res_data_string (T_NET_BUF * net_buf, const char *str, int size, unsigned char ext_type,
 				 unsigned char charset, int *net_size);
+static void add_res_data_decomposed_string (T_NET_BUF * net_buf, const char *str, int size, int decomp_size,
+					    unsigned char ext_type, unsigned char charset, int *net_size);
 static void add_res_data_string_safe (T_NET_BUF * net_buf, const char *str, unsigned char ext_type,
 				      unsigned char charset, int *net_size);
 static void add_res_data_int (T_NET_BUF * net_buf, int value, unsigned char ext_type, int *net_size);
@@ -548,6 +551,9 @@ ux_database_connect (char *db_name, char *db_user, char *db_passwd, char **db_er
 	  db_enable_trigger ();
 	}
 
+      /* prepare by the XASL_IDs the other CAS processes of the broker got */
+      do_share_xasl_id_cache (shm_appl->xasl_id_dir, (int) sizeof (shm_appl->xasl_id_dir));
+
       cas_log_debug (ARG_FILE_LINE, "ux_database_connect: db_login(%s) db_restart(%s) at %s", db_user, db_name,
 		     host_connected);
       p = strchr (db_name, '@');
@@ -4544,7 +4550,6 @@ dbval_to_net_buf (DB_VALUE * val, T_NET_BUF * net_buf, char fetch_flag, int max_
 	int dummy = 0;
 	int bytes_size = 0;
 	int decomp_size;
-	char *decomposed = NULL;
 	bool need_decomp = false;
 
 	str = db_get_char (val, &dummy);
@@ -4563,28 +4568,12 @@ dbval_to_net_buf (DB_VALUE * val, T_NET_BUF * net_buf, char fetch_flag, int max_
 
 	if (need_decomp)
 	  {
-	    decomposed = (char *) MALLOC (decomp_size * sizeof (char));
-	    if (decomposed != NULL)
-	      {
-		unicode_decompose_string (str, bytes_size, decomposed, &decomp_size, lang_get_generic_unicode_norm ());
-
-		str = decomposed;
-		bytes_size = decomp_size;
-	      }
-	    else
-	      {
-		/* set error indicator and send empty string */
-		ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
-		bytes_size = 0;
-	      }
+	    add_res_data_decomposed_string (net_buf, str, bytes_size, decomp_size, ext_col_type,
+					    db_get_string_codeset (val), &data_size);
 	  }
-
-	add_res_data_string (net_buf, str, bytes_size, ext_col_type, db_get_string_codeset (val), &data_size);
-
-	if (decomposed != NULL)
+	else
 	  {
-	    FREE (decomposed);
-	    decomposed = NULL;
+	    add_res_data_string (net_buf, str, bytes_size, ext_col_type, db_get_string_codeset (val), &data_size);
 	  }
       }
       break;
@@ -4595,7 +4584,6 @@ dbval_to_net_buf (DB_VALUE * val, T_NET_BUF * net_buf, char fetch_flag, int max_
 	int dummy = 0;
 	int bytes_size = 0;
 	int decomp_size;
-	char *decomposed = NULL;
 	bool need_decomp = false;
 
 	nchar = db_get_nchar (val, &dummy);
@@ -4613,29 +4601,12 @@ dbval_to_net_buf (DB_VALUE * val, T_NET_BUF * net_buf, char fetch_flag, int max_
 
 	if (need_decomp)
 	  {
-	    decomposed = (char *) MALLOC (decomp_size * sizeof (char));
-	    if (decomposed != NULL)
-	      {
-		unicode_decompose_string (nchar, bytes_size, decomposed, &decomp_size,
-					  lang_get_generic_unicode_norm ());
-
-		nchar = decomposed;
-		bytes_size = decomp_size;
-	      }
-	    else
-	      {
-		/* set error indicator and send empty string */
-		ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
-		bytes_size = 0;
-	      }
+	    add_res_data_decomposed_string (net_buf, nchar, bytes_size, decomp_size, ext_col_type,
+					    db_get_string_codeset (val), &data_size);
 	  }
-
-	add_res_data_string (net_buf, nchar, bytes_size, ext_col_type, db_get_string_codeset (val), &data_size);
-
-	if (decomposed != NULL)
+	else
 	  {
-	    FREE (decomposed);
-	    decomposed = NULL;
+	    add_res_data_string (net_buf, nchar, bytes_size, ext_col_type, db_get_string_codeset (val), &data_size);
 	  }
       }
       break;
@@ -4643,7 +4614,6 @@ dbval_to_net_buf (DB_VALUE * val, T_NET_BUF * net_buf, char fetch_flag, int max_
       {
 	int bytes_size = 0;
 	int decomp_size;
-	char *decomposed = NULL;
 	bool need_decomp = false;
 
 	const char *str = db_get_enum_string (val);
@@ -4661,28 +4631,12 @@ dbval_to_net_buf (DB_VALUE * val, T_NET_BUF * net_buf, char fetch_flag, int max_
 
 	if (need_decomp)
 	  {
-	    decomposed = (char *) MALLOC (decomp_size * sizeof (char));
-	    if (decomposed != NULL)
-	      {
-		unicode_decompose_string (str, bytes_size, decomposed, &decomp_size, lang_get_generic_unicode_norm ());
-
-		str = decomposed;
-		bytes_size = decomp_size;
-	      }
-	    else
-	      {
-		/* set error indicator and send empty string */
-		ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
-		bytes_size = 0;
-	      }
+	    add_res_data_decomposed_string (net_buf, str, bytes_size, decomp_size, ext_col_type,
+					    db_get_enum_codeset (val), &data_size);
 	  }
-
-	add_res_data_string (net_buf, str, bytes_size, ext_col_type, db_get_enum_codeset (val), &data_size);
-
-	if (decomposed != NULL)
+	else
 	  {
-	    FREE (decomposed);
-	    decomposed = NULL;
+	    add_res_data_string (net_buf, str, bytes_size, ext_col_type, db_get_enum_codeset (val), &data_size);
 	  }
 
 	break;
@@ -6433,6 +6387,9 @@ fetch_foreign_keys (T_SRV_HANDLE * srv_handle, int cursor_pos, int fetch_count,
 static void
 add_res_data_bytes (T_NET_BUF * net_buf, const char *str, int size, unsigned char ext_type, int *net_size)
 {
+  /* copy the value in one piece */
+  (void) net_buf_reserve (net_buf, NET_SIZE_INT + (ext_type ? NET_BUF_TYPE_SIZE (net_buf) : 0) + size);
+
   if (ext_type)
     {
       net_buf_cp_int (net_buf, NET_BUF_TYPE_SIZE (net_buf) + size, NULL);	/* type */
@@ -6456,6 +6413,9 @@ static void
 add_res_data_string (T_NET_BUF * net_buf, const char *str, int size, unsigned char ext_type, unsigned char charset,
 		     int *net_size)
 {
+  /* copy the value in one piece */
+  (void) net_buf_reserve (net_buf, NET_SIZE_INT + (ext_type ? NET_BUF_TYPE_SIZE (net_buf) : 0) + size + NET_SIZE_BYTE);
+
   if (ext_type)
     {
       net_buf_cp_int (net_buf, NET_BUF_TYPE_SIZE (net_buf) + size + 1, NULL);	/* type, NULL terminator */
@@ -6475,6 +6435,43 @@ add_res_data_string (T_NET_BUF * net_buf, const char *str, int size, unsigned ch
     }
 }
 
+/*
+ * add_res_data_decomposed_string () - add the unicode decomposition of a string, decomposed in place in net_buf
+ */
+static void
+add_res_data_decomposed_string (T_NET_BUF * net_buf, const char *str, int size, int decomp_size,
+				unsigned char ext_type, unsigned char charset, int *net_size)
+{
+  int type_size = ext_type ? NET_BUF_TYPE_SIZE (net_buf) : 0;
+  int size_offset;
+
+  if (net_buf_reserve (net_buf, NET_SIZE_INT + type_size + decomp_size + NET_SIZE_BYTE) < 0)
+    {
+      /* set error indicator and send empty string */
+      ERROR_INFO_SET (CAS_ER_NO_MORE_MEMORY, CAS_ERROR_INDICATOR);
+      add_res_data_string (net_buf, "", 0, ext_type, charset, net_size);
+      return;
+    }
+
+  net_buf_cp_int (net_buf, 0, &size_offset);
+  if (ext_type)
+    {
+      net_buf_cp_cas_type_and_charset (net_buf, ext_type, charset);
+    }
+
+  unicode_decompose_string (str, size, NET_BUF_CURR_PTR (net_buf), &decomp_size, lang_get_generic_unicode_norm ());
+  net_buf_commit (net_buf, decomp_size);
+  net_buf_cp_byte (net_buf, '\0');
+
+  /* type, NULL terminator */
+  net_buf_overwrite_int (net_buf, size_offset, type_size + decomp_size + NET_SIZE_BYTE);
+
+  if (net_size)
+    {
+      *net_size = NET_SIZE_INT + type_size + decomp_size + NET_SIZE_BYTE;
+    }
+}
+
 static void
 add_res_data_string_safe (T_NET_BUF * net_buf, const char *str, unsigned char ext_type, unsigned char charset,
 			  int *net_size)
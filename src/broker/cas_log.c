@@ -38,6 +38,13 @@
 #include <sys/time.h>
 #endif
 #include <assert.h>
+#include <signal.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <new>
+#include <thread>
 
 #include "porting.h"
 #include "cas_common.h"
@@ -61,6 +68,9 @@ typedef int mode_t;
 
 #define CAS_LOG_BUFFER_SIZE (8192)
 #define SQL_LOG_BUFFER_SIZE 163840
+#define SQL_LOG_RING_SIZE (512 * 1024)
+#define SQL_LOG_RING_MAX_DATA (SQL_LOG_RING_SIZE / 4)
+#define SQL_LOG_END_MARK "END OF LOG\n\n"
 #define ACCESS_LOG_IS_DENIED_TYPE(T)  ((T)==ACL_REJECTED)
 
 static const char *get_access_log_type_string (ACCESS_LOG_TYPE type);
@@ -69,12 +79,13 @@ static char sql_log_buffer[SQL_LOG_BUFFER_SIZE];
 
 static char *make_sql_log_filename (T_CUBRID_FILE_ID fid, char *filename_buf, size_t buf_size, const char *br_name);
 static void cas_log_backup (T_CUBRID_FILE_ID fid);
-static void cas_log_write_and_set_savedpos (FILE * log_fp, const char *fmt, ...);
 
 
 #if defined (ENABLE_UNUSED_FUNCTION)
 static void cas_log_rename (int run_time, time_t cur_time, char *br_name, int as_index);
 #endif
+static int cas_log_format_internal (char *buf, int buf_size, struct timeval *log_time, unsigned int seq_num,
+				    const char *fmt, va_list ap);
 static void cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_num, bool do_flush,
 				    const char *fmt, va_list ap);
 static void cas_log_write2_internal (FILE * fp, bool do_flush, const char *fmt, va_list ap);
@@ -90,7 +101,69 @@ static char cas_log_error_flag;
 #endif
 static FILE *log_fp = NULL, *slow_log_fp = NULL;
 static char log_filepath[BROKER_PATH_MAX], slow_log_filepath[BROKER_PATH_MAX];
-static INT64 saved_log_fpos = 0;
+static INT64 saved_log_fpos = 0;	/* start of current unit in file; used by SQL log writer */
+
+#if !defined (LIBCAS_FOR_JSP)
+/*
+ * SQL log writer
+ *
+ * The request loop does not write SQL log to the file. It formats the lines and appends them, with the unit
+ * boundaries, to a single-producer single-consumer ring; a writer thread writes them to the file, marks the end of
+ * log after each unit, goes back over the abandoned units and flushes the file whenever it catches up. The request
+ * loop waits only if the ring is full, and before it uses the file itself (close, truncate or backup) it waits for
+ * the writer to drain the ring.
+ * If the writer thread cannot be started, the records are applied to the file right away, as they were before.
+ */
+typedef enum
+{
+  SQL_LOG_REC_DATA,		/* bytes written at current position */
+  SQL_LOG_REC_UNIT_START,	/* current position is the start of a unit */
+  SQL_LOG_REC_UNIT_KEEP,	/* unit is kept; the end of log is marked after it */
+  SQL_LOG_REC_UNIT_ABANDON	/* unit is abandoned; end of log is marked after it and position goes back to start */
+} SQL_LOG_REC_TYPE;
+
+typedef struct sql_log_rec_header SQL_LOG_REC_HEADER;
+struct sql_log_rec_header
+{
+  int type;
+  int size;
+};
+
+typedef struct sql_log_writer SQL_LOG_WRITER;
+struct sql_log_writer
+{
+  char ring[SQL_LOG_RING_SIZE];
+  std::atomic < UINT64 > tail;	/* end of appended records */
+  std::atomic < UINT64 > head;	/* end of records applied to file */
+  std::atomic < UINT64 > flushed;	/* end of records applied and flushed */
+  std::atomic < bool > writer_waiting;
+  std::atomic < bool > appender_waiting;
+  std::mutex mutex;
+  std::condition_variable writer_cv;
+  std::condition_variable appender_cv;
+  bool stop;
+  std::thread thread;
+};
+
+static SQL_LOG_WRITER *sql_log_writer = NULL;
+static INT64 appended_log_fpos = 0;	/* file position after the appended records */
+static INT64 appended_unit_fpos = 0;	/* file position of the appended unit start */
+
+static void sql_log_writer_start (void);
+static void sql_log_writer_finalize (void);
+static void sql_log_writer_main (SQL_LOG_WRITER * writer);
+static void sql_log_writer_wait (const std::atomic < UINT64 > &pos, UINT64 target);
+static void sql_log_writer_drain (void);
+static void sql_log_ring_copy_in (SQL_LOG_WRITER * writer, UINT64 pos, const void *data, size_t size);
+static void sql_log_ring_copy_out (SQL_LOG_WRITER * writer, UINT64 pos, void *data, size_t size);
+static void sql_log_apply_record (int type, const char *data, size_t size, const char *data2, size_t size2);
+static void sql_log_append_record (int type, const char *data, size_t size);
+static void sql_log_append (const char *data, size_t size);
+static void sql_log_append_query_string (const char *query);
+static void sql_log_write_internal (struct timeval *log_time, unsigned int seq_num, bool newline, const char *fmt,
+				    va_list ap);
+static void sql_log_write2_internal (bool newline, const char *fmt, va_list ap);
+#endif /* !LIBCAS_FOR_JSP */
 
 static size_t cas_fwrite (const void *ptr, size_t size, size_t nmemb, FILE * stream);
 static INT64 cas_ftell (FILE * stream);
@@ -196,6 +269,7 @@ cas_log_open (char *br_name)
       if (log_fp)
 	{
 	  setvbuf (log_fp, sql_log_buffer, _IOFBF, SQL_LOG_BUFFER_SIZE);
+	  sql_log_writer_start ();
 	}
     }
   else
@@ -203,6 +277,7 @@ cas_log_open (char *br_name)
       log_fp = NULL;
       saved_log_fpos = 0;
     }
+  appended_log_fpos = appended_unit_fpos = saved_log_fpos;
   as_info->cas_log_reset = 0;
 #endif /* LIBCAS_FOR_JSP */
 }
@@ -236,6 +311,8 @@ cas_log_close (bool flag)
 #ifndef LIBCAS_FOR_JSP
   if (log_fp != NULL)
     {
+      sql_log_writer_drain ();
+
       if (flag)
 	{
 	  cas_fseek (log_fp, saved_log_fpos, SEEK_SET);
@@ -244,6 +321,7 @@ cas_log_close (bool flag)
       cas_fclose (log_fp);
       log_fp = NULL;
       saved_log_fpos = 0;
+      appended_log_fpos = appended_unit_fpos = 0;
     }
 #endif /* LIBCAS_FOR_JSP */
 }
@@ -278,25 +356,334 @@ cas_log_backup (T_CUBRID_FILE_ID fid)
   cas_rename (filepath, backup_filepath);
 }
 
+#if !defined (LIBCAS_FOR_JSP)
 static void
-cas_log_write_and_set_savedpos (FILE * log_fp, const char *fmt, ...)
+sql_log_writer_start (void)
 {
-  va_list ap;
+  SQL_LOG_WRITER *writer;
+#if !defined (WINDOWS)
+  sigset_t all_signals, old_signals;
+#endif /* !WINDOWS */
+
+  if (sql_log_writer != NULL)
+    {
+      return;
+    }
+
+  writer = new (std::nothrow) SQL_LOG_WRITER ();
+  if (writer == NULL)
+    {
+      return;
+    }
+  writer->tail = 0;
+  writer->head = 0;
+  writer->flushed = 0;
+  writer->writer_waiting = false;
+  writer->appender_waiting = false;
+  writer->stop = false;
+
+#if !defined (WINDOWS)
+  /* signals are handled by the request loop; the writer thread inherits the mask */
+  sigfillset (&all_signals);
+  pthread_sigmask (SIG_BLOCK, &all_signals, &old_signals);
+#endif /* !WINDOWS */
+
+  try
+  {
+    writer->thread = std::thread (sql_log_writer_main, writer);
+  }
+  catch (const std::system_error &)
+  {
+    delete writer;
+    writer = NULL;
+  }
+
+#if !defined (WINDOWS)
+  pthread_sigmask (SIG_SETMASK, &old_signals, NULL);
+#endif /* !WINDOWS */
+
+  if (writer != NULL)
+    {
+      sql_log_writer = writer;
+      atexit (sql_log_writer_finalize);
+    }
+}
+
+static void
+sql_log_writer_finalize (void)
+{
+  SQL_LOG_WRITER *writer = sql_log_writer;
+
+  if (writer == NULL)
+    {
+      return;
+    }
+
+  sql_log_writer_drain ();
+
+  {
+    std::unique_lock < std::mutex > lock (writer->mutex);
+    writer->stop = true;
+  }
+  writer->writer_cv.notify_one ();
+  writer->thread.join ();
+
+  sql_log_writer = NULL;
+  delete writer;
+}
+
+static void
+sql_log_writer_main (SQL_LOG_WRITER * writer)
+{
+  SQL_LOG_REC_HEADER header;
+  UINT64 head = writer->head;
+  bool is_dirty = false;
+
+  while (true)
+    {
+      if (head != writer->tail)
+	{
+	  size_t offset, first_size;
+
+	  sql_log_ring_copy_out (writer, head, &header, sizeof (header));
+	  head += sizeof (header);
 
+	  /* records are not split, but may wrap around the ring end */
+	  offset = (size_t) (head % SQL_LOG_RING_SIZE);
+	  first_size = MIN ((size_t) header.size, SQL_LOG_RING_SIZE - offset);
+	  sql_log_apply_record (header.type, writer->ring + offset, first_size, writer->ring,
+				(size_t) header.size - first_size);
+	  head += header.size;
+	  is_dirty = true;
+
+	  writer->head = head;
+	  if (writer->appender_waiting)
+	    {
+	      std::unique_lock < std::mutex > lock (writer->mutex);
+	      writer->appender_cv.notify_all ();
+	    }
+	  continue;
+	}
+
+      /* caught up; make the log visible before telling it is drained */
+      if (is_dirty && log_fp != NULL)
+	{
+	  fflush (log_fp);
+	}
+      is_dirty = false;
+      writer->flushed = head;
+
+      std::unique_lock < std::mutex > lock (writer->mutex);
+      if (writer->appender_waiting)
+	{
+	  writer->appender_cv.notify_all ();
+	}
+      writer->writer_waiting = true;
+      while (head == writer->tail && !writer->stop)
+	{
+	  writer->writer_cv.wait (lock);
+	}
+      writer->writer_waiting = false;
+      if (head == writer->tail && writer->stop)
+	{
+	  break;
+	}
+    }
+}
+
+/*
+ * sql_log_writer_wait () - wait until writer position reaches target
+ */
+static void
+sql_log_writer_wait (const std::atomic < UINT64 > &pos, UINT64 target)
+{
+  SQL_LOG_WRITER *writer = sql_log_writer;
+
+  if (pos >= target)
+    {
+      return;
+    }
+
+  std::unique_lock < std::mutex > lock (writer->mutex);
+  writer->appender_waiting = true;
+  while (pos < target)
+    {
+      writer->appender_cv.wait (lock);
+    }
+  writer->appender_waiting = false;
+}
+
+/*
+ * sql_log_writer_drain () - wait until writer has applied and flushed everything appended
+ *
+ * note: the request loop may use log_fp after this, until it appends again.
+ */
+static void
+sql_log_writer_drain (void)
+{
+  if (sql_log_writer != NULL)
+    {
+      sql_log_writer_wait (sql_log_writer->flushed, sql_log_writer->tail);
+    }
+}
+
+static void
+sql_log_ring_copy_in (SQL_LOG_WRITER * writer, UINT64 pos, const void *data, size_t size)
+{
+  size_t offset = (size_t) (pos % SQL_LOG_RING_SIZE);
+  size_t first_size = MIN (size, SQL_LOG_RING_SIZE - offset);
+
+  memcpy (writer->ring + offset, data, first_size);
+  memcpy (writer->ring, (const char *) data + first_size, size - first_size);
+}
+
+static void
+sql_log_ring_copy_out (SQL_LOG_WRITER * writer, UINT64 pos, void *data, size_t size)
+{
+  size_t offset = (size_t) (pos % SQL_LOG_RING_SIZE);
+  size_t first_size = MIN (size, SQL_LOG_RING_SIZE - offset);
+
+  memcpy (data, writer->ring + offset, first_size);
+  memcpy ((char *) data + first_size, writer->ring, size - first_size);
+}
+
+/*
+ * sql_log_apply_record () - apply a record to the SQL log file
+ *
+ * note: data of the record is given in two parts, the second one is not empty if it wraps around the ring end.
+ *       it is called by the writer thread, or by the request loop if there is no writer.
+ */
+static void
+sql_log_apply_record (int type, const char *data, size_t size, const char *data2, size_t size2)
+{
   if (log_fp == NULL)
     {
+      assert (false);
       return;
     }
 
-  va_start (ap, fmt);
-  cas_log_write_internal (log_fp, NULL, 0, false, fmt, ap);
-  va_end (ap);
+  switch (type)
+    {
+    case SQL_LOG_REC_DATA:
+      fwrite (data, 1, size, log_fp);
+      if (size2 > 0)
+	{
+	  fwrite (data2, 1, size2, log_fp);
+	}
+      break;
+
+    case SQL_LOG_REC_UNIT_START:
+      saved_log_fpos = ftell (log_fp);
+      break;
+
+    case SQL_LOG_REC_UNIT_KEEP:
+      saved_log_fpos = ftell (log_fp);
+      fwrite (SQL_LOG_END_MARK, 1, sizeof (SQL_LOG_END_MARK) - 1, log_fp);
+      fseek (log_fp, saved_log_fpos, SEEK_SET);
+      break;
 
-  cas_fseek (log_fp, saved_log_fpos, SEEK_SET);
+    case SQL_LOG_REC_UNIT_ABANDON:
+      fwrite (SQL_LOG_END_MARK, 1, sizeof (SQL_LOG_END_MARK) - 1, log_fp);
+      fseek (log_fp, saved_log_fpos, SEEK_SET);
+      break;
+
+    default:
+      assert (false);
+      break;
+    }
+}
+
+static void
+sql_log_append_record (int type, const char *data, size_t size)
+{
+  SQL_LOG_WRITER *writer = sql_log_writer;
+  SQL_LOG_REC_HEADER header;
+  UINT64 tail;
+
+  assert (size <= SQL_LOG_RING_MAX_DATA);
+
+  /* mirror the file position, so the request loop does not have to ask the writer */
+  switch (type)
+    {
+    case SQL_LOG_REC_DATA:
+      appended_log_fpos += size;
+      break;
+    case SQL_LOG_REC_UNIT_START:
+    case SQL_LOG_REC_UNIT_KEEP:
+      appended_unit_fpos = appended_log_fpos;
+      break;
+    case SQL_LOG_REC_UNIT_ABANDON:
+      appended_log_fpos = appended_unit_fpos;
+      break;
+    default:
+      assert (false);
+      break;
+    }
+
+  if (writer == NULL)
+    {
+      sql_log_apply_record (type, data, size, NULL, 0);
+      return;
+    }
+
+  header.type = type;
+  header.size = (int) size;
+
+  tail = writer->tail.load (std::memory_order_relaxed);
+  if (tail + sizeof (header) + size > SQL_LOG_RING_SIZE)
+    {
+      /* wait for room in ring */
+      sql_log_writer_wait (writer->head, tail + sizeof (header) + size - SQL_LOG_RING_SIZE);
+    }
+
+  sql_log_ring_copy_in (writer, tail, &header, sizeof (header));
+  if (size > 0)
+    {
+      sql_log_ring_copy_in (writer, tail + sizeof (header), data, size);
+    }
+  writer->tail = tail + sizeof (header) + size;
+
+  if (writer->writer_waiting)
+    {
+      std::unique_lock < std::mutex > lock (writer->mutex);
+      writer->writer_cv.notify_one ();
+    }
+}
 
-  return;
+static void
+sql_log_append (const char *data, size_t size)
+{
+  while (size > 0)
+    {
+      size_t chunk_size = MIN (size, SQL_LOG_RING_MAX_DATA);
+
+      sql_log_append_record (SQL_LOG_REC_DATA, data, chunk_size);
+      data += chunk_size;
+      size -= chunk_size;
+    }
 }
 
+static void
+sql_log_append_query_string (const char *query)
+{
+  char buf[CAS_LOG_BUFFER_SIZE];
+  const char *s;
+  size_t n = 0;
+
+  /* query is logged in one line */
+  for (s = query; *s; s++)
+    {
+      buf[n++] = (*s == '\n' || *s == '\r') ? ' ' : *s;
+      if (n == sizeof (buf))
+	{
+	  sql_log_append (buf, n);
+	  n = 0;
+	}
+    }
+  sql_log_append (buf, n);
+}
+#endif /* !LIBCAS_FOR_JSP */
+
 #if defined (ENABLE_UNUSED_FUNCTION)
 static void
 cas_log_rename (int run_time, time_t cur_time, char *br_name, int as_index)
@@ -374,7 +761,7 @@ cas_log_end (int mode, int run_time_sec, int run_time_msec)
 
       if (abandon)
 	{
-	  cas_log_write_and_set_savedpos (log_fp, "%s", "END OF LOG\n\n");
+	  sql_log_append_record (SQL_LOG_REC_UNIT_ABANDON, NULL, 0);
 	}
       else
 	{
@@ -382,32 +769,28 @@ cas_log_end (int mode, int run_time_sec, int run_time_msec)
 	    {
 	      cas_log_write (0, false, "*** elapsed time %d.%03d\n", run_time_sec, run_time_msec);
 	    }
-	  saved_log_fpos = cas_ftell (log_fp);
+	  sql_log_append_record (SQL_LOG_REC_UNIT_KEEP, NULL, 0);
 
-	  if ((saved_log_fpos / 1000) > shm_appl->sql_log_max_size)
+	  if ((appended_log_fpos / 1000) > shm_appl->sql_log_max_size)
 	    {
 	      cas_log_close (true);
 	      cas_log_backup (FID_SQL_LOG_DIR);
 	      cas_log_open (NULL);
 	    }
-	  else
-	    {
-	      cas_log_write_and_set_savedpos (log_fp, "%s", "END OF LOG\n\n");
-	    }
 	}
     }
 #endif /* LIBCAS_FOR_JSP */
 }
 
-static void
-cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_num, bool do_flush, const char *fmt,
-			va_list ap)
+static int
+cas_log_format_internal (char *buf, int buf_size, struct timeval *log_time, unsigned int seq_num, const char *fmt,
+			 va_list ap)
 {
-  char *buf, *p;
+  char *p;
   int len, n;
 
-  p = buf = cas_log_buffer;
-  len = CAS_LOG_BUFFER_SIZE;
+  p = buf;
+  len = buf_size;
   n = ut_time_string (p, log_time);
   len -= n;
   p += n;
@@ -430,7 +813,17 @@ cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_nu
 	}
     }
 
-  cas_fwrite (buf, (p - buf), 1, fp);
+  return (int) (p - buf);
+}
+
+static void
+cas_log_write_internal (FILE * fp, struct timeval *log_time, unsigned int seq_num, bool do_flush, const char *fmt,
+			va_list ap)
+{
+  int len;
+
+  len = cas_log_format_internal (cas_log_buffer, CAS_LOG_BUFFER_SIZE, log_time, seq_num, fmt, ap);
+  cas_fwrite (cas_log_buffer, len, 1, fp);
 
   if (do_flush == true)
     {
@@ -453,10 +846,10 @@ cas_log_write_nonl (unsigned int seq_num, bool unit_start, const char *fmt, ...)
 
       if (unit_start)
 	{
-	  saved_log_fpos = cas_ftell (log_fp);
+	  sql_log_append_record (SQL_LOG_REC_UNIT_START, NULL, 0);
 	}
       va_start (ap, fmt);
-      cas_log_write_internal (log_fp, NULL, seq_num, (as_info->cur_sql_log_mode == SQL_LOG_MODE_ALL), fmt, ap);
+      sql_log_write_internal (NULL, seq_num, false, fmt, ap);
       va_end (ap);
     }
 #endif /* LIBCAS_FOR_JSP */
@@ -469,7 +862,6 @@ cas_log_query_cancel (int dummy, ...)
   va_list ap;
   const char *fmt;
   char buf[LINE_MAX];
-  bool log_mode;
   struct timeval tv;
 
   if (log_fp == NULL || query_cancel_flag != 1)
@@ -492,11 +884,9 @@ cas_log_query_cancel (int dummy, ...)
       snprintf (buf, LINE_MAX, "query_cancel");
     }
 
-  log_mode = as_info->cur_sql_log_mode == SQL_LOG_MODE_ALL;
   va_start (ap, dummy);
-  cas_log_write_internal (log_fp, &tv, 0, log_mode, buf, ap);
+  sql_log_write_internal (&tv, 0, true, buf, ap);
   va_end (ap);
-  cas_fputc ('\n', log_fp);
 
   query_cancel_flag = 0;
 #endif /* LIBCAS_FOR_JSP */
@@ -519,12 +909,11 @@ cas_log_write (unsigned int seq_num, bool unit_start, const char *fmt, ...)
 
       if (unit_start)
 	{
-	  saved_log_fpos = cas_ftell (log_fp);
+	  sql_log_append_record (SQL_LOG_REC_UNIT_START, NULL, 0);
 	}
       va_start (ap, fmt);
-      cas_log_write_internal (log_fp, NULL, seq_num, (as_info->cur_sql_log_mode == SQL_LOG_MODE_ALL), fmt, ap);
+      sql_log_write_internal (NULL, seq_num, true, fmt, ap);
       va_end (ap);
-      cas_fputc ('\n', log_fp);
     }
 #endif /* LIBCAS_FOR_JSP */
 }
@@ -544,17 +933,54 @@ cas_log_write_and_end (unsigned int seq_num, bool unit_start, const char *fmt, .
 
       if (unit_start)
 	{
-	  saved_log_fpos = cas_ftell (log_fp);
+	  sql_log_append_record (SQL_LOG_REC_UNIT_START, NULL, 0);
 	}
       va_start (ap, fmt);
-      cas_log_write_internal (log_fp, NULL, seq_num, (as_info->cur_sql_log_mode == SQL_LOG_MODE_ALL), fmt, ap);
+      sql_log_write_internal (NULL, seq_num, true, fmt, ap);
       va_end (ap);
-      cas_fputc ('\n', log_fp);
       cas_log_end (SQL_LOG_MODE_ALL, -1, -1);
     }
 #endif /* LIBCAS_FOR_JSP */
 }
 
+#if !defined (LIBCAS_FOR_JSP)
+static void
+sql_log_write_internal (struct timeval *log_time, unsigned int seq_num, bool newline, const char *fmt, va_list ap)
+{
+  int len;
+
+  /* leave room for newline */
+  len = cas_log_format_internal (cas_log_buffer, CAS_LOG_BUFFER_SIZE - 1, log_time, seq_num, fmt, ap);
+  if (newline)
+    {
+      cas_log_buffer[len++] = '\n';
+    }
+  sql_log_append (cas_log_buffer, len);
+}
+
+static void
+sql_log_write2_internal (bool newline, const char *fmt, va_list ap)
+{
+  int len;
+
+  len = vsnprintf (cas_log_buffer, CAS_LOG_BUFFER_SIZE - 1, fmt, ap);
+  if (len < 0)
+    {
+      len = 0;
+    }
+  else if (len >= CAS_LOG_BUFFER_SIZE - 1)
+    {
+      /* string is truncated and trailing '\0' is included */
+      len = CAS_LOG_BUFFER_SIZE - 2;
+    }
+  if (newline)
+    {
+      cas_log_buffer[len++] = '\n';
+    }
+  sql_log_append (cas_log_buffer, len);
+}
+#endif /* !LIBCAS_FOR_JSP */
+
 static void
 cas_log_write2_internal (FILE * fp, bool do_flush, const char *fmt, va_list ap)
 {
@@ -594,7 +1020,7 @@ cas_log_write2_nonl (const char *fmt, ...)
       va_list ap;
 
       va_start (ap, fmt);
-      cas_log_write2_internal (log_fp, (as_info->cur_sql_log_mode == SQL_LOG_MODE_ALL), fmt, ap);
+      sql_log_write2_internal (false, fmt, ap);
       va_end (ap);
     }
 #endif /* LIBCAS_FOR_JSP */
@@ -614,9 +1040,8 @@ cas_log_write2 (const char *fmt, ...)
       va_list ap;
 
       va_start (ap, fmt);
-      cas_log_write2_internal (log_fp, (as_info->cur_sql_log_mode == SQL_LOG_MODE_ALL), fmt, ap);
+      sql_log_write2_internal (true, fmt, ap);
       va_end (ap);
-      cas_fputc ('\n', log_fp);
     }
 #endif /* LIBCAS_FOR_JSP */
 }
@@ -632,7 +1057,7 @@ cas_log_write_value_string (char *value, int size)
 
   if (log_fp != NULL)
     {
-      cas_fwrite (value, size, 1, log_fp);
+      sql_log_append (value, size);
     }
 #endif /* LIBCAS_FOR_JSP */
 }
@@ -660,23 +1085,11 @@ cas_log_write_query_string_internal (char *query, int size, bool newline)
 
   if (log_fp != NULL && query != NULL)
     {
-      char *s;
-
-      for (s = query; *s; s++)
-	{
-	  if (*s == '\n' || *s == '\r')
-	    {
-	      cas_fputc (' ', log_fp);
-	    }
-	  else
-	    {
-	      cas_fputc (*s, log_fp);
-	    }
-	}
+      sql_log_append_query_string (query);
 
       if (newline)
 	{
-	  fputc ('\n', log_fp);
+	  sql_log_append ("\n", 1);
 	}
     }
 #endif /* LIBCAS_FOR_JSP */
@@ -45,7 +45,8 @@ static char broker_info[BROKER_INFO_SIZE] = {
 typedef enum
 {
   BI_FUNC_ERROR_CODE,
-  BI_FUNC_SUPPORT_HOLDABLE_RESULT
+  BI_FUNC_SUPPORT_HOLDABLE_RESULT,
+  BI_FUNC_LZ4_COMPRESSION
 } BI_FUNCTION_CODE;
 
 const char *
@@ -143,6 +144,9 @@ cas_bi_set_function_enable (BI_FUNCTION_CODE function_code)
     case BI_FUNC_SUPPORT_HOLDABLE_RESULT:
       SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_HOLDABLE_RESULT);
       break;
+    case BI_FUNC_LZ4_COMPRESSION:
+      SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_LZ4_COMPRESSION);
+      break;
     default:
       assert (false);
       break;
@@ -160,6 +164,9 @@ cas_bi_set_function_disable (BI_FUNCTION_CODE function_code)
     case BI_FUNC_SUPPORT_HOLDABLE_RESULT:
       CLEAR_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_HOLDABLE_RESULT);
       break;
+    case BI_FUNC_LZ4_COMPRESSION:
+      CLEAR_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_LZ4_COMPRESSION);
+      break;
     default:
       assert (false);
       break;
@@ -175,6 +182,8 @@ cas_bi_is_enabled_function (BI_FUNCTION_CODE function_code)
       return IS_SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_RENEWED_ERROR_CODE);
     case BI_FUNC_SUPPORT_HOLDABLE_RESULT:
       return IS_SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_HOLDABLE_RESULT);
+    case BI_FUNC_LZ4_COMPRESSION:
+      return IS_SET_BIT (broker_info[BROKER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_LZ4_COMPRESSION);
     default:
       return 0;
     }
@@ -210,6 +219,36 @@ cas_di_understand_renewed_error_code (const char *driver_info)
   return IS_SET_BIT (driver_info[DRIVER_INFO_FUNCTION_FLAG], BROKER_RENEWED_ERROR_CODE);
 }
 
+void
+cas_bi_set_lz4_compression (const bool lz4_compression)
+{
+  if (lz4_compression)
+    {
+      cas_bi_set_function_enable (BI_FUNC_LZ4_COMPRESSION);
+    }
+  else
+    {
+      cas_bi_set_function_disable (BI_FUNC_LZ4_COMPRESSION);
+    }
+}
+
+bool
+cas_bi_get_lz4_compression (void)
+{
+  return cas_bi_is_enabled_function (BI_FUNC_LZ4_COMPRESSION);
+}
+
+bool
+cas_di_request_lz4_compression (const char *driver_info)
+{
+  if (!IS_SET_BIT (driver_info[SRV_CON_MSG_IDX_PROTO_VERSION], CAS_PROTO_INDICATOR))
+    {
+      return false;
+    }
+
+  return IS_SET_BIT (driver_info[DRIVER_INFO_FUNCTION_FLAG], BROKER_SUPPORT_LZ4_COMPRESSION);
+}
+
 void
 cas_bi_make_broker_info (char *broker_info, char dbms_type, char statement_pooling, char cci_pconnect)
 {
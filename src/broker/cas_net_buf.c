@@ -26,6 +26,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
 #include <assert.h>
 
 #if defined(WINDOWS)
@@ -106,6 +107,33 @@ net_buf_cp_byte (T_NET_BUF * net_buf, char ch)
   return 0;
 }
 
+/*
+ * net_buf_reserve () - make room for size bytes at the end of buffer
+ *
+ * note: the caller may fill the room through NET_BUF_CURR_PTR and add it with net_buf_commit, or copy several items
+ *       without reallocating the buffer in between.
+ */
+int
+net_buf_reserve (T_NET_BUF * net_buf, int size)
+{
+  if (NET_BUF_FREE_SIZE (net_buf) < size && net_buf_realloc (net_buf, size) < 0)
+    {
+      return CAS_ER_NO_MORE_MEMORY;
+    }
+
+  return 0;
+}
+
+/*
+ * net_buf_commit () - add size bytes written in reserved room to buffer data
+ */
+void
+net_buf_commit (T_NET_BUF * net_buf, int size)
+{
+  assert (size <= NET_BUF_FREE_SIZE (net_buf));
+  net_buf->data_size += size;
+}
+
 int
 net_buf_cp_str (T_NET_BUF * net_buf, const char *buf, int size)
 {
@@ -433,6 +461,12 @@ net_buf_realloc (T_NET_BUF * net_buf, int size)
       /* realloc unit is 64 Kbyte */
       extra = (size + NET_BUF_EXTRA_SIZE - 1) / NET_BUF_EXTRA_SIZE;
       new_alloc_size = net_buf->alloc_size + extra * NET_BUF_EXTRA_SIZE;
+      if (net_buf->alloc_size >= NET_BUF_ALLOC_SIZE && net_buf->alloc_size < INT_MAX / 2)
+	{
+	  /* a buffer growing past its initial size is holding large values; grow it at least twice, so copying them
+	   * over does not become quadratic */
+	  new_alloc_size = MAX (new_alloc_size, net_buf->alloc_size * 2);
+	}
       net_buf->data = (char *) REALLOC (net_buf->data, new_alloc_size);
       if (net_buf->data == NULL)
 	{
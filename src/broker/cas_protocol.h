@@ -118,6 +118,13 @@ extern "C"
 #define BROKER_SUPPORT_HOLDABLE_RESULT          0x40
 /* Do not remove or rename BROKER_RECONNECT_WHEN_SERVER_DOWN */
 #define BROKER_RECONNECT_WHEN_SERVER_DOWN       0x20
+#define BROKER_SUPPORT_LZ4_COMPRESSION          0x10
+
+/* When both driver and CAS set BROKER_SUPPORT_LZ4_COMPRESSION, a message body of CAS_COMPRESS_MIN_SIZE bytes or more
+ * may be sent compressed. The body size in the header of a compressed message is negated, and the body holds the
+ * original size (CAS_COMPRESS_ORIGINAL_SIZE_SIZE bytes, network order) followed by the LZ4 block. */
+#define CAS_COMPRESS_MIN_SIZE                   1024
+#define CAS_COMPRESS_ORIGINAL_SIZE_SIZE         4
 
 /* For backward compatibility */
 #define BROKER_INFO_MAJOR_VERSION               (BROKER_INFO_PROTO_VERSION)
@@ -355,6 +362,9 @@ extern "C"
   extern void cas_bi_set_renewed_error_code (const bool renewed_error_code);
   extern bool cas_bi_get_renewed_error_code (void);
   extern bool cas_di_understand_renewed_error_code (const char *driver_info);
+  extern void cas_bi_set_lz4_compression (const bool lz4_compression);
+  extern bool cas_bi_get_lz4_compression (void);
+  extern bool cas_di_request_lz4_compression (const char *driver_info);
   extern void cas_bi_make_broker_info (char *broker_info, char dbms_type, char statement_pooling, char cci_pconnect);
 #ifdef __cplusplus
 }
@@ -2345,6 +2345,278 @@ cci_fetch_sensitive (int mapped_stmt_id, T_CCI_ERROR * err_buf)
   return fetch_cmd (mapped_stmt_id, CCI_FETCH_SENSITIVE, err_buf);
 }
 
+/*
+ * cci_execute_async - send the execute request of a prepared statement without waiting for its reply
+ *
+ * return: 1 when the request is sent, error code otherwise
+ *
+ * The reply is read by cci_async_result once the socket returned by cci_async_get_fd is readable; the connection is
+ * used until then. Like cci_execute, the request is sent again on a new connection when the old one is broken, but
+ * only as long as it has not reached the broker: a broken connection found by cci_async_result is reported as is.
+ */
+int
+cci_execute_async (int mapped_stmt_id, char flag, int max_col_size, T_CCI_ERROR * err_buf)
+{
+  T_REQ_HANDLE *req_handle = NULL;
+  T_CON_HANDLE *con_handle = NULL;
+  int error = CCI_ER_NO_ERROR;
+  bool is_first_exec_in_tran = false;
+
+#ifdef CCI_DEBUG
+  CCI_DEBUG_PRINT (print_debug_msg
+		   ("(%d:%d)exe_async: %d, %d", CON_ID (mapped_stmt_id), REQ_ID (mapped_stmt_id), flag, max_col_size));
+#endif
+
+  reset_error_buffer (err_buf);
+  error = hm_get_statement (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      set_error_buffer (err_buf, error, NULL);
+      return error;
+    }
+  reset_error_buffer (&(con_handle->err_buf));
+  con_handle->shard_id = CCI_SHARD_ID_INVALID;
+  req_handle->shard_id = CCI_SHARD_ID_INVALID;
+
+  API_SLOG (con_handle);
+  if (con_handle->log_trace_api)
+    {
+      CCI_LOGF_DEBUG (con_handle->logger, "FLAG[%d], MAX_COL_SIZE[%d]", flag, max_col_size);
+    }
+
+  if (flag & CCI_EXEC_ONLY_QUERY_PLAN)
+    {
+      flag |= CCI_EXEC_QUERY_INFO;
+    }
+  flag &= ~CCI_EXEC_ASYNC;
+
+  if (IS_OUT_TRAN (con_handle) && IS_FORCE_FAILBACK (con_handle) && !IS_INVALID_SOCKET (con_handle->sock_fd))
+    {
+      hm_force_close_connection (con_handle);
+    }
+  SET_START_TIME_FOR_QUERY (con_handle, req_handle);
+
+  if (IS_BROKER_STMT_POOL (con_handle) && req_handle->valid == false)
+    {
+      error =
+	qe_prepare (req_handle, con_handle, req_handle->sql_text, req_handle->prepare_flag, &(con_handle->err_buf), 1);
+    }
+
+  is_first_exec_in_tran = IS_OUT_TRAN (con_handle);
+
+  if (error >= 0)
+    {
+      error = qe_execute_send (req_handle, con_handle, flag, max_col_size);
+    }
+  while ((IS_OUT_TRAN (con_handle) || is_first_exec_in_tran)
+	 && IS_ER_TO_RECONNECT (error, con_handle->err_buf.err_code))
+    {
+      if (NEED_TO_RECONNECT (con_handle, error))
+	{
+	  error = reset_connect (con_handle, req_handle, &(con_handle->err_buf));
+	  if (error != CCI_ER_NO_ERROR)
+	    {
+	      break;
+	    }
+	}
+
+      error =
+	qe_prepare (req_handle, con_handle, req_handle->sql_text, req_handle->prepare_flag, &(con_handle->err_buf), 1);
+      if (error < 0)
+	{
+	  continue;
+	}
+
+      error = qe_execute_send (req_handle, con_handle, flag, max_col_size);
+    }
+
+  if (error < 0)
+    {
+      RESET_START_TIME (con_handle);
+
+      if (IS_OUT_TRAN (con_handle))
+	{
+	  hm_check_rc_time (con_handle);
+	}
+
+      API_ELOG (con_handle, error);
+      set_error_buffer (&(con_handle->err_buf), error, NULL);
+      get_last_error (con_handle, err_buf);
+      con_handle->used = false;
+
+      return error;
+    }
+
+  /* the connection stays used until cci_async_result */
+  con_handle->async_req_handle = req_handle;
+  con_handle->async_func_code = CAS_FC_EXECUTE;
+  con_handle->async_flag = flag;
+  con_handle->async_max_col_size = max_col_size;
+
+  API_ELOG (con_handle, 1);
+  return 1;
+}
+
+/*
+ * cci_fetch_async - send the fetch request of the tuple at cursor without waiting for its reply
+ *
+ * return: 1 when the request is sent, 0 when the tuple is in the fetch buffer already, error code otherwise
+ *
+ * Only when 1 is returned, the reply is read by cci_async_result.
+ */
+int
+cci_fetch_async (int mapped_stmt_id, T_CCI_ERROR * err_buf)
+{
+  T_REQ_HANDLE *req_handle = NULL;
+  T_CON_HANDLE *con_handle = NULL;
+  int error = CCI_ER_NO_ERROR;
+  bool is_sent = false;
+
+#ifdef CCI_FULL_DEBUG
+  CCI_DEBUG_PRINT (print_debug_msg ("(%d:%d)cci_fetch_async", CON_ID (mapped_stmt_id), REQ_ID (mapped_stmt_id)));
+#endif
+
+  reset_error_buffer (err_buf);
+  error = hm_get_statement (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      set_error_buffer (err_buf, error, NULL);
+      return error;
+    }
+  reset_error_buffer (&(con_handle->err_buf));
+
+  error = qe_fetch_send (req_handle, con_handle, 0, 0, &is_sent);
+  if (error >= 0 && is_sent)
+    {
+      /* the connection stays used until cci_async_result */
+      con_handle->async_req_handle = req_handle;
+      con_handle->async_func_code = CAS_FC_FETCH;
+      con_handle->async_flag = 0;
+      return 1;
+    }
+
+  if (IS_OUT_TRAN (con_handle))
+    {
+      hm_check_rc_time (con_handle);
+    }
+
+  set_error_buffer (&(con_handle->err_buf), error, NULL);
+  get_last_error (con_handle, err_buf);
+  con_handle->used = false;
+
+  return error;
+}
+
+/*
+ * cci_async_get_fd - socket to watch for the reply of the pending request of a statement
+ *
+ * return: socket descriptor, or error code
+ *
+ * The socket turning readable means the reply started to arrive; cci_async_result may still wait for the rest of it.
+ */
+int
+cci_async_get_fd (int mapped_stmt_id)
+{
+  T_REQ_HANDLE *req_handle = NULL;
+  T_CON_HANDLE *con_handle = NULL;
+  int error;
+
+  error = hm_get_statement_force (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      return error;
+    }
+
+  if (con_handle->async_req_handle != req_handle)
+    {
+      return CCI_ER_NO_ASYNC_REQUEST;
+    }
+
+  return (int) con_handle->sock_fd;
+}
+
+/*
+ * cci_async_result - read the reply of the request sent by cci_execute_async or cci_fetch_async
+ *
+ * return: what cci_execute or cci_fetch would have returned
+ */
+int
+cci_async_result (int mapped_stmt_id, T_CCI_ERROR * err_buf)
+{
+  T_REQ_HANDLE *req_handle = NULL;
+  T_CON_HANDLE *con_handle = NULL;
+  int error = CCI_ER_NO_ERROR;
+  char func_code;
+  char flag;
+  char prepare_flag;
+
+  reset_error_buffer (err_buf);
+  error = hm_get_statement_force (mapped_stmt_id, &con_handle, &req_handle);
+  if (error != CCI_ER_NO_ERROR)
+    {
+      set_error_buffer (err_buf, error, NULL);
+      return error;
+    }
+
+  if (con_handle->async_req_handle != req_handle)
+    {
+      set_error_buffer (err_buf, CCI_ER_NO_ASYNC_REQUEST, NULL);
+      return CCI_ER_NO_ASYNC_REQUEST;
+    }
+
+  func_code = con_handle->async_func_code;
+  flag = con_handle->async_flag;
+  con_handle->async_req_handle = NULL;
+
+  API_SLOG (con_handle);
+
+  if (func_code == CAS_FC_EXECUTE)
+    {
+      error = qe_execute_recv (req_handle, con_handle, flag, &(con_handle->err_buf));
+
+      /* the prepared plan is invalidated; prepare and execute again, as cci_execute does */
+      if (error == CAS_ER_STMT_POOLING && IS_BROKER_STMT_POOL (con_handle))
+	{
+	  prepare_flag = req_handle->prepare_flag;
+	  if (hm_broker_understand_the_protocol (hm_get_broker_version (con_handle), PROTOCOL_V7))
+	    {
+	      prepare_flag |= CCI_PREPARE_XASL_CACHE_PINNED;
+	    }
+
+	  req_handle_content_free (req_handle, 1);
+	  error = qe_prepare (req_handle, con_handle, req_handle->sql_text, prepare_flag, &(con_handle->err_buf), 1);
+	  if (error >= 0)
+	    {
+	      error =
+		qe_execute (req_handle, con_handle, flag, con_handle->async_max_col_size, &(con_handle->err_buf));
+	    }
+	}
+
+      RESET_START_TIME (con_handle);
+
+      if (error == CCI_ER_QUERY_TIMEOUT && con_handle->disconnect_on_query_timeout)
+	{
+	  hm_force_close_connection (con_handle);
+	}
+    }
+  else
+    {
+      error = qe_fetch_recv (req_handle, con_handle, flag, &(con_handle->err_buf));
+    }
+
+  if (IS_OUT_TRAN (con_handle))
+    {
+      hm_check_rc_time (con_handle);
+    }
+
+  API_ELOG (con_handle, error);
+  set_error_buffer (&(con_handle->err_buf), error, NULL);
+  get_last_error (con_handle, err_buf);
+  con_handle->used = false;
+
+  return error;
+}
+
 int
 cci_get_data (int mapped_stmt_id, int col_no, int a_type, void *value, int *indicator)
 {
@@ -4581,6 +4853,9 @@ cci_get_err_msg_internal (int error)
     case CCI_ER_INVALID_SHARD:
       return "Invalid shard";
 
+    case CCI_ER_NO_ASYNC_REQUEST:
+      return "No asynchronous request is pending on the statement";
+
     case CCI_ER_SSL_HANDSHAKE:
       return "SSL handshake failure";
 
@@ -494,6 +494,8 @@ typedef enum
   CCI_ER_NO_SHARD_AVAILABLE = -20045,
   CCI_ER_INVALID_SHARD = -20046,
 
+  CCI_ER_NO_ASYNC_REQUEST = -20047,
+
   CCI_ER_SSL_HANDSHAKE = -21047,
 
   CCI_ER_NOT_IMPLEMENTED = -20099,
@@ -819,6 +821,17 @@ extern "C"
   extern int cci_cursor (int req_handle, int offset, T_CCI_CURSOR_POS origin, T_CCI_ERROR * err_buf);
   extern int cci_fetch_size (int req_handle, int fetch_size);
   extern int cci_fetch (int req_handle, T_CCI_ERROR * err_buf);
+  /*
+   * Asynchronous execute and fetch. cci_execute_async and cci_fetch_async send the request and return 1 without
+   * waiting for the reply, or 0 when cci_fetch_async finds the tuple in the fetch buffer and no request is needed.
+   * While a request is pending, its connection is in use and other calls on it fail with CCI_ER_USED_CONNECTION.
+   * cci_async_get_fd returns the socket of the connection to be watched for readability; cci_async_result reads the
+   * reply and returns what cci_execute or cci_fetch would have returned.
+   */
+  extern int cci_execute_async (int req_handle, char flag, int max_col_size, T_CCI_ERROR * err_buf);
+  extern int cci_fetch_async (int req_handle, T_CCI_ERROR * err_buf);
+  extern int cci_async_get_fd (int req_handle);
+  extern int cci_async_result (int req_handle, T_CCI_ERROR * err_buf);
   extern int cci_get_data (int req_handle, int col_no, int type, void *value, int *indicator);
   extern int cci_schema_info (int con_handle, T_CCI_SCH_TYPE type, char *arg1,
 			      char *arg2, char flag, T_CCI_ERROR * err_buf);
@@ -617,8 +617,8 @@ hm_get_connection (int mapped_id, T_CON_HANDLE ** connection)
   return hm_get_connection_internal (mapped_id, connection, false);
 }
 
-T_CCI_ERROR_CODE
-hm_get_statement (int mapped_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** statement)
+static T_CCI_ERROR_CODE
+hm_get_statement_internal (int mapped_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** statement, bool force)
 {
   int connection_id;
   int statement_id;
@@ -636,7 +636,7 @@ hm_get_statement (int mapped_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** sta
     }
   *statement = NULL;
 
-  error = map_get_ots_value (mapped_id, &statement_id, false);
+  error = map_get_ots_value (mapped_id, &statement_id, force);
   if (error != CCI_ER_NO_ERROR)
     {
       return error;
@@ -670,6 +670,19 @@ hm_get_statement (int mapped_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** sta
   return CCI_ER_NO_ERROR;
 }
 
+T_CCI_ERROR_CODE
+hm_get_statement (int mapped_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** statement)
+{
+  return hm_get_statement_internal (mapped_id, connection, statement, false);
+}
+
+/* gets the statement without marking its connection as used; for the owner of the connection */
+T_CCI_ERROR_CODE
+hm_get_statement_force (int mapped_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** statement)
+{
+  return hm_get_statement_internal (mapped_id, connection, statement, true);
+}
+
 static T_CCI_ERROR_CODE
 hm_release_connection_internal (int mapped_id, T_CON_HANDLE ** connection, bool delete_handle)
 {
@@ -731,6 +744,12 @@ hm_req_handle_free (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle)
   con_handle->req_handle_table[req_handle->req_handle_index - 1] = NULL;
   --(con_handle->req_handle_count);
 
+  if (con_handle->prefetch_req_handle == req_handle)
+    {
+      /* the reply is discarded when it is drained */
+      con_handle->prefetch_req_handle = NULL;
+    }
+
   req_handle_content_free (req_handle, 0);
   FREE_MEM (req_handle);
 }
@@ -753,6 +772,8 @@ hm_req_handle_free_all (T_CON_HANDLE * con_handle)
       con_handle->req_handle_table[i] = NULL;
       --(con_handle->req_handle_count);
     }
+
+  con_handle->prefetch_req_handle = NULL;
 }
 
 void
@@ -773,6 +794,10 @@ hm_req_handle_free_all_unholdable (T_CON_HANDLE * con_handle)
 	  /* do not free holdable req_handles */
 	  continue;
 	}
+      if (con_handle->prefetch_req_handle == req_handle)
+	{
+	  con_handle->prefetch_req_handle = NULL;
+	}
       req_handle_content_free (req_handle, 0);
       FREE_MEM (req_handle);
       con_handle->req_handle_table[i] = NULL;
@@ -1168,6 +1193,14 @@ hm_broker_reconnect_when_server_down (T_CON_HANDLE * con_handle)
   return (f & BROKER_RECONNECT_WHEN_SERVER_DOWN) == BROKER_RECONNECT_WHEN_SERVER_DOWN;
 }
 
+bool
+hm_broker_support_lz4_compression (T_CON_HANDLE * con_handle)
+{
+  char f = con_handle->broker_info[BROKER_INFO_FUNCTION_FLAG];
+
+  return con_handle->compression && (f & BROKER_SUPPORT_LZ4_COMPRESSION) == BROKER_SUPPORT_LZ4_COMPRESSION;
+}
+
 void
 hm_check_rc_time (T_CON_HANDLE * con_handle)
 {
@@ -1335,6 +1368,18 @@ init_con_handle (T_CON_HANDLE * con_handle, char *ip_str, int port, char *db_nam
   con_handle->shard_id = CCI_SHARD_ID_INVALID;
 
   con_handle->ssl_handle.is_connected = false;
+
+  con_handle->async_req_handle = NULL;
+  con_handle->async_func_code = 0;
+  con_handle->async_flag = 0;
+  con_handle->async_max_col_size = 0;
+
+  con_handle->prefetch = false;
+  con_handle->prefetch_pending = false;
+  con_handle->prefetch_cursor_pos = 0;
+  con_handle->prefetch_req_handle = NULL;
+
+  con_handle->compression = false;
   return 0;
 }
 
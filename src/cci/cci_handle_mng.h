@@ -277,6 +277,20 @@ typedef struct
   /* ssl */
   T_SSL_HANDLE ssl_handle;
 
+  /* asynchronous request */
+  T_REQ_HANDLE *async_req_handle;	/* statement waiting for the reply, NULL if none */
+  char async_func_code;		/* CAS_FC_EXECUTE or CAS_FC_FETCH */
+  char async_flag;		/* execute or fetch flag of the request */
+  int async_max_col_size;	/* max_col_size of the execute request */
+
+  /* prefetch of the next tuples of a result set */
+  char prefetch;		/* connection property */
+  char prefetch_pending;	/* a prefetch reply is on the wire */
+  int prefetch_cursor_pos;	/* cursor position of the pending prefetch */
+  T_REQ_HANDLE *prefetch_req_handle;	/* statement of the pending prefetch, NULL if freed meanwhile */
+
+  char compression;		/* connection property, LZ4 compression of large messages */
+
 } T_CON_HANDLE;
 
 /************************************************************************
@@ -297,6 +311,8 @@ extern T_CCI_ERROR_CODE hm_get_connection_by_resolved_id (int resolved_id, T_CON
 extern T_CCI_ERROR_CODE hm_get_connection_force (int mapped_id, T_CON_HANDLE ** connection);
 extern T_CCI_ERROR_CODE hm_get_connection (int connection_id, T_CON_HANDLE ** connection);
 extern T_CCI_ERROR_CODE hm_get_statement (int statement_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** statement);
+extern T_CCI_ERROR_CODE hm_get_statement_force (int statement_id, T_CON_HANDLE ** connection,
+						T_REQ_HANDLE ** statement);
 extern T_CCI_ERROR_CODE hm_release_connection (int connection_id, T_CON_HANDLE ** connection);
 extern T_CCI_ERROR_CODE hm_delete_connection (int connection_id, T_CON_HANDLE ** connection);
 extern T_CCI_ERROR_CODE hm_release_statement (int statement_id, T_CON_HANDLE ** connection, T_REQ_HANDLE ** statement);
@@ -321,6 +337,7 @@ extern bool hm_broker_match_the_protocol (T_BROKER_VERSION broker_version, int r
 
 extern bool hm_broker_support_holdable_result (T_CON_HANDLE * con_handle);
 extern bool hm_broker_reconnect_when_server_down (T_CON_HANDLE * con_handle);
+extern bool hm_broker_support_lz4_compression (T_CON_HANDLE * con_handle);
 
 extern void hm_set_con_handle_holdable (T_CON_HANDLE * con_handle, int holdable);
 extern int hm_get_con_handle_holdable (T_CON_HANDLE * con_handle);
@@ -43,6 +43,7 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
 
 #if defined(WINDOWS)
 #include <winsock2.h>
@@ -282,6 +283,11 @@ net_buf_realloc (T_NET_BUF * net_buf, int size)
   if (size + net_buf->data_size > net_buf->alloc_size)
     {
       new_alloc_size = net_buf->alloc_size + 1024;
+      if (net_buf->alloc_size > 1024 && net_buf->alloc_size < INT_MAX / 2)
+	{
+	  /* grow twofold; a large array execution would copy the request over and over otherwise */
+	  new_alloc_size = net_buf->alloc_size * 2;
+	}
       if (size + net_buf->data_size > new_alloc_size)
 	{
 	  new_alloc_size = size + net_buf->data_size;
@@ -75,6 +75,8 @@
 #include "version.h"
 #endif
 
+#include "lz4.h"
+
 #include <openssl/ssl.h>
 #include <openssl/err.h>
 #include <openssl/opensslv.h>
@@ -132,6 +134,9 @@ static int net_cancel_request_w_local_port (unsigned char *ip_addr, int port, in
 static int net_cancel_request_wo_local_port (unsigned char *ip_addr, int port, int pid);
 static int net_status_request (unsigned char *ip_addr, int port, int cas_pid, char *sessionid, int timeout_msec);
 static int net_status_recv_stream (SOCKET sock_fd, char *buf, int size, int timeout);
+static char *net_compress_msg (char *msg, int size, int *compressed_size);
+static int net_recv_compressed_msg (T_CON_HANDLE * con_handle, unsigned char *ip_addr, int port, int compressed_size,
+				    char **msg, int *msg_size, int timeout);
 
 static int ssl_session_init (T_CON_HANDLE * con_handle, SOCKET sock_fd);
 /************************************************************************
@@ -177,6 +182,10 @@ net_connect_srv (T_CON_HANDLE * con_handle, int host_id, T_CCI_ERROR * err_buf,
 
   init_msg_header (&msg_header);
 
+  /* no reply is pending on a new connection */
+  con_handle->prefetch_pending = false;
+  con_handle->prefetch_req_handle = NULL;
+
   memset (client_info, 0, sizeof (client_info));
   memset (db_info, 0, sizeof (db_info));
 
@@ -191,6 +200,10 @@ net_connect_srv (T_CON_HANDLE * con_handle, int host_id, T_CCI_ERROR * err_buf,
   client_info[SRV_CON_MSG_IDX_CLIENT_TYPE] = cci_client_type;
   client_info[SRV_CON_MSG_IDX_PROTO_VERSION] = CAS_PROTO_PACK_CURRENT_NET_VER;
   client_info[SRV_CON_MSG_IDX_FUNCTION_FLAG] = BROKER_RENEWED_ERROR_CODE | BROKER_SUPPORT_HOLDABLE_RESULT;
+  if (con_handle->compression)
+    {
+      client_info[SRV_CON_MSG_IDX_FUNCTION_FLAG] |= BROKER_SUPPORT_LZ4_COMPRESSION;
+    }
   client_info[SRV_CON_MSG_IDX_RESERVED2] = 0;
 
   info = db_info;
@@ -615,14 +628,35 @@ int
 net_send_msg (T_CON_HANDLE * con_handle, char *msg, int size)
 {
   MSG_HEADER send_msg_header;
+  char *compressed_msg = NULL;
+  int compressed_size;
   int err;
   struct timeval ts, te;
 
+  if (con_handle->prefetch_pending)
+    {
+      /* the reply of a prefetch is read before the one of this request; nobody waits for it any more */
+      con_handle->prefetch_pending = false;
+      con_handle->prefetch_req_handle = NULL;
+      (void) net_recv_msg (con_handle, NULL, NULL, NULL);
+    }
+
   init_msg_header (&send_msg_header);
 
   *(send_msg_header.msg_body_size_ptr) = size;
   memcpy (send_msg_header.info_ptr, con_handle->cas_info, MSG_HEADER_INFO_SIZE);
 
+  if (size >= CAS_COMPRESS_MIN_SIZE && hm_broker_support_lz4_compression (con_handle))
+    {
+      compressed_msg = net_compress_msg (msg, size, &compressed_size);
+      if (compressed_msg != NULL)
+	{
+	  msg = compressed_msg;
+	  size = compressed_size;
+	  *(send_msg_header.msg_body_size_ptr) = -compressed_size;
+	}
+    }
+
   /* send msg header */
   if (con_handle->log_trace_network)
     {
@@ -639,6 +673,7 @@ net_send_msg (T_CON_HANDLE * con_handle, char *msg, int size)
     }
   if (err < 0)
     {
+      FREE_MEM (compressed_msg);
       return CCI_ER_COMMUNICATION;
     }
 
@@ -655,6 +690,7 @@ net_send_msg (T_CON_HANDLE * con_handle, char *msg, int size)
       elapsed = ut_timeval_diff_msec (&ts, &te);
       CCI_LOGF_DEBUG (con_handle->logger, "[NET][W][B][S:%d][E:%d][T:%d]", size, err, elapsed);
     }
+  FREE_MEM (compressed_msg);
   if (err < 0)
     {
       return CCI_ER_COMMUNICATION;
@@ -752,33 +788,47 @@ net_recv_msg_timeout (T_CON_HANDLE * con_handle, char **msg, int *msg_size, T_CC
       con_handle->con_status = CCI_CON_STATUS_IN_TRAN;
     }
 
-  if (*(recv_msg_header.msg_body_size_ptr) > 0)
+  if (*(recv_msg_header.msg_body_size_ptr) < 0)
     {
-      tmp_p = (char *) MALLOC (*(recv_msg_header.msg_body_size_ptr));
-      if (tmp_p == NULL)
+      /* net_recv_msg_header accepts a negative size only when compression is negotiated */
+      result_code = net_recv_compressed_msg (con_handle, ip_addr, broker_port, -*(recv_msg_header.msg_body_size_ptr),
+					     &tmp_p, recv_msg_header.msg_body_size_ptr, timeout);
+      if (result_code < 0)
 	{
-	  result_code = CCI_ER_NO_MORE_MEMORY;
 	  goto error_return;
 	}
+    }
 
-      if (con_handle->log_trace_network)
-	{
-	  gettimeofday (&ts, NULL);
-	}
-      result_code = net_recv_stream (con_handle, ip_addr, broker_port, tmp_p,
-				     *(recv_msg_header.msg_body_size_ptr), timeout);
-      if (con_handle->log_trace_network)
+  if (*(recv_msg_header.msg_body_size_ptr) > 0)
+    {
+      if (tmp_p == NULL)
 	{
-	  long elapsed;
+	  tmp_p = (char *) MALLOC (*(recv_msg_header.msg_body_size_ptr));
+	  if (tmp_p == NULL)
+	    {
+	      result_code = CCI_ER_NO_MORE_MEMORY;
+	      goto error_return;
+	    }
 
-	  gettimeofday (&te, NULL);
-	  elapsed = ut_timeval_diff_msec (&ts, &te);
-	  CCI_LOGF_DEBUG (con_handle->logger, "[NET][R][B][S:%d][E:%d][T:%d]", *(recv_msg_header.msg_body_size_ptr),
-			  result_code, elapsed);
-	}
-      if (result_code < 0)
-	{
-	  goto error_return;
+	  if (con_handle->log_trace_network)
+	    {
+	      gettimeofday (&ts, NULL);
+	    }
+	  result_code = net_recv_stream (con_handle, ip_addr, broker_port, tmp_p,
+					 *(recv_msg_header.msg_body_size_ptr), timeout);
+	  if (con_handle->log_trace_network)
+	    {
+	      long elapsed;
+
+	      gettimeofday (&te, NULL);
+	      elapsed = ut_timeval_diff_msec (&ts, &te);
+	      CCI_LOGF_DEBUG (con_handle->logger, "[NET][R][B][S:%d][E:%d][T:%d]",
+			      *(recv_msg_header.msg_body_size_ptr), result_code, elapsed);
+	    }
+	  if (result_code < 0)
+	    {
+	      goto error_return;
+	    }
 	}
 
       memcpy ((char *) &result_code, tmp_p + CAS_PROTOCOL_ERR_INDICATOR_INDEX, CAS_PROTOCOL_ERR_INDICATOR_SIZE);
@@ -1368,7 +1418,7 @@ net_recv_msg_header (T_CON_HANDLE * con_handle, unsigned char *ip_addr, int port
   *(header->msg_body_size_ptr) = ntohl (*(header->msg_body_size_ptr));
 
   assert (header->info_ptr[0] != 0 || header->info_ptr[1] != 0 || header->info_ptr[2] != 0 || header->info_ptr[3] != 0);
-  if (*(header->msg_body_size_ptr) < 0)
+  if (*(header->msg_body_size_ptr) < 0 && !hm_broker_support_lz4_compression (con_handle))
     {
       return CCI_ER_COMMUNICATION;
     }
@@ -1405,6 +1455,92 @@ net_send_stream (T_CON_HANDLE * con_handle, char *msg, int size)
   return 0;
 }
 
+/*
+ * net_compress_msg - LZ4 compress a message body in the compressed message format of cas_protocol.h
+ *   return: compressed body allocated with MALLOC, NULL if compression does not pay
+ */
+static char *
+net_compress_msg (char *msg, int size, int *compressed_size)
+{
+  char *buf;
+  int bound, lz4_size, v;
+
+  bound = CAS_COMPRESS_ORIGINAL_SIZE_SIZE + LZ4_compressBound (size);
+  buf = (char *) MALLOC (bound);
+  if (buf == NULL)
+    {
+      return NULL;
+    }
+
+  lz4_size = LZ4_compress_default (msg, buf + CAS_COMPRESS_ORIGINAL_SIZE_SIZE, size,
+				   bound - CAS_COMPRESS_ORIGINAL_SIZE_SIZE);
+  if (lz4_size <= 0 || lz4_size + CAS_COMPRESS_ORIGINAL_SIZE_SIZE >= size)
+    {
+      FREE_MEM (buf);
+      return NULL;
+    }
+
+  v = htonl (size);
+  memcpy (buf, &v, CAS_COMPRESS_ORIGINAL_SIZE_SIZE);
+  *compressed_size = lz4_size + CAS_COMPRESS_ORIGINAL_SIZE_SIZE;
+  return buf;
+}
+
+static int
+net_recv_compressed_msg (T_CON_HANDLE * con_handle, unsigned char *ip_addr, int port, int compressed_size, char **msg,
+			 int *msg_size, int timeout)
+{
+  char *compressed_msg, *buf;
+  int original_size;
+  int err;
+
+  if (compressed_size <= CAS_COMPRESS_ORIGINAL_SIZE_SIZE)
+    {
+      return CCI_ER_COMMUNICATION;
+    }
+
+  compressed_msg = (char *) MALLOC (compressed_size);
+  if (compressed_msg == NULL)
+    {
+      return CCI_ER_NO_MORE_MEMORY;
+    }
+
+  err = net_recv_stream (con_handle, ip_addr, port, compressed_msg, compressed_size, timeout);
+  if (err < 0)
+    {
+      FREE_MEM (compressed_msg);
+      return err;
+    }
+
+  memcpy (&original_size, compressed_msg, CAS_COMPRESS_ORIGINAL_SIZE_SIZE);
+  original_size = ntohl (original_size);
+  if (original_size <= 0)
+    {
+      FREE_MEM (compressed_msg);
+      return CCI_ER_COMMUNICATION;
+    }
+
+  buf = (char *) MALLOC (original_size);
+  if (buf == NULL)
+    {
+      FREE_MEM (compressed_msg);
+      return CCI_ER_NO_MORE_MEMORY;
+    }
+
+  if (LZ4_decompress_safe (compressed_msg + CAS_COMPRESS_ORIGINAL_SIZE_SIZE, buf,
+			   compressed_size - CAS_COMPRESS_ORIGINAL_SIZE_SIZE, original_size) != original_size)
+    {
+      FREE_MEM (compressed_msg);
+      FREE_MEM (buf);
+      return CCI_ER_COMMUNICATION;
+    }
+
+  FREE_MEM (compressed_msg);
+  *msg = buf;
+  *msg_size = original_size;
+  return 0;
+}
+
 static void
 init_msg_header (MSG_HEADER * header)
 {
@@ -351,6 +351,8 @@ cci_conn_set_properties (T_CON_HANDLE * handle, char *properties)
     {"logTraceApi", BOOL_PROPERTY, &handle->log_trace_api},
     {"logTraceNetwork", BOOL_PROPERTY, &handle->log_trace_network},
     {"logBaseDir", STRING_PROPERTY, &base},
+    {"prefetch", BOOL_PROPERTY, &handle->prefetch},
+    {"compression", BOOL_PROPERTY, &handle->compression},
     /* for backward compatibility */
     {"login_timeout", INT_PROPERTY, &handle->login_timeout},
     {"query_timeout", INT_PROPERTY, &handle->query_timeout},
@@ -216,6 +216,11 @@ static bool is_set_default_value_if_null (T_CON_HANDLE * con_handle, T_CCI_CUBRI
 static T_CCI_U_EXT_TYPE get_ext_utype_from_net_bytes (T_CCI_U_TYPE basic_type, T_CCI_U_TYPE set_type);
 static void confirm_schema_type_info (T_REQ_HANDLE * req_handle, int col_no, T_CCI_U_TYPE u_type, char *col_value_p,
 				      int data_size);
+static int qe_get_query_recv_timeout (T_CON_HANDLE * con_handle);
+static int qe_send_fetch_msg (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, int cursor_pos, char flag,
+			      int result_set_index);
+static void qe_prefetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle);
+static bool bind_array_value_to_net_buf (T_NET_BUF * net_buf, T_BIND_VALUE * bind_value, int row);
 
 
 /************************************************************************
@@ -566,23 +571,34 @@ qe_bind_param (T_REQ_HANDLE * req_handle, int index, T_CCI_A_TYPE a_type, void *
 
 int
 qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size, T_CCI_ERROR * err_buf)
+{
+  int err_code;
+
+  err_code = qe_execute_send (req_handle, con_handle, flag, max_col_size);
+  if (err_code < 0)
+    {
+      return err_code;
+    }
+
+  return qe_execute_recv (req_handle, con_handle, flag, err_buf);
+}
+
+/*
+ * qe_execute_send - send the execute request of a prepared statement without waiting for its reply
+ *
+ * The reply is read by qe_execute_recv. Nothing else may be sent on the connection in between.
+ */
+int
+qe_execute_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size)
 {
   T_NET_BUF net_buf;
   char func_code = CAS_FC_EXECUTE;
   char autocommit_flag;
   int i;
   int err_code = 0;
-  int res_count;
-  char *result_msg = NULL, *msg;
-  int result_msg_size;
-  T_CCI_QUERY_RESULT *qr = NULL;
   char fetch_flag;
   char forward_only_cursor;
-  char include_column_info;
-  int remain_msg_size = 0;
   int remaining_time = 0;
-  bool use_server_query_cancel = false;
-  int shard_id;
   T_BROKER_VERSION broker_ver;
 
   req_handle->is_fetch_completed = 0;
@@ -643,11 +659,6 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
   broker_ver = hm_get_broker_version (con_handle);
   if (hm_broker_understand_the_protocol (broker_ver, PROTOCOL_V2))
     {
-      /* In PROTOCOL_V2, cci driver use server query timeout feature, when disconnect_on_query_timeout is false. */
-      if (TIMEOUT_IS_SET (con_handle) && con_handle->disconnect_on_query_timeout == false)
-	{
-	  use_server_query_cancel = true;
-	}
       ADD_ARG_INT (&net_buf, remaining_time);
     }
   else if (hm_broker_understand_the_protocol (broker_ver, PROTOCOL_V1))
@@ -677,10 +688,33 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
     }
 
   net_buf_clear (&net_buf);
+  return CCI_ER_NO_ERROR;
+
+execute_error:
+  net_buf_clear (&net_buf);
+  return err_code;
+}
+
+/*
+ * qe_execute_recv - read and decode the reply of the execute request sent by qe_execute_send
+ */
+int
+qe_execute_recv (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, T_CCI_ERROR * err_buf)
+{
+  int res_count;
+  int err_code = 0;
+  char *result_msg = NULL, *msg;
+  int result_msg_size;
+  T_CCI_QUERY_RESULT *qr = NULL;
+  char include_column_info;
+  int remain_msg_size = 0;
+  int shard_id;
+  T_BROKER_VERSION broker_ver;
+
+  broker_ver = hm_get_broker_version (con_handle);
 
   res_count =
-    net_recv_msg_timeout (con_handle, &result_msg, &result_msg_size, err_buf,
-			  ((use_server_query_cancel) ? 0 : remaining_time));
+    net_recv_msg_timeout (con_handle, &result_msg, &result_msg_size, err_buf, qe_get_query_recv_timeout (con_handle));
 
   if (res_count < 0)
     {
@@ -785,11 +819,12 @@ qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int
   req_handle->is_closed = 0;
   req_handle->is_from_current_transaction = 1;
 
-  return res_count;
+  if (req_handle->first_stmt_type == CUBRID_STMT_SELECT)
+    {
+      qe_prefetch (req_handle, con_handle);
+    }
 
-execute_error:
-  net_buf_clear (&net_buf);
-  return err_code;
+  return res_count;
 }
 
 int
@@ -1600,12 +1635,30 @@ cursor_error:
 int
 qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int result_set_index, T_CCI_ERROR * err_buf)
 {
-  T_NET_BUF net_buf;
   int err_code;
-  char func_code = CAS_FC_FETCH;
-  char *result_msg = NULL;
-  int result_msg_size;
-  int num_tuple;
+  bool is_sent = false;
+
+  err_code = qe_fetch_send (req_handle, con_handle, flag, result_set_index, &is_sent);
+  if (err_code < 0 || !is_sent)
+    {
+      return err_code;
+    }
+
+  return qe_fetch_recv (req_handle, con_handle, flag, err_buf);
+}
+
+/*
+ * qe_fetch_send - send the fetch request of the tuple at cursor without waiting for its reply
+ *
+ * is_sent is set to false when the tuple is already in the fetch buffer and no request is needed; otherwise the reply
+ * is read by qe_fetch_recv.
+ */
+int
+qe_fetch_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int result_set_index, bool * is_sent)
+{
+  int err_code;
+
+  *is_sent = false;
 
   if (req_handle->cursor_pos <= 0)
     {
@@ -1633,10 +1686,92 @@ qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int r
 
   hm_req_handle_fetch_buf_free (req_handle);
 
+  if (con_handle->prefetch_pending && con_handle->prefetch_req_handle == req_handle
+      && con_handle->prefetch_cursor_pos == req_handle->cursor_pos && flag == 0 && result_set_index == 0)
+    {
+      /* the request was sent ahead by qe_prefetch; only its reply is left to read */
+      con_handle->prefetch_pending = false;
+      con_handle->prefetch_req_handle = NULL;
+      *is_sent = true;
+      return 0;
+    }
+
+  err_code = qe_send_fetch_msg (req_handle, con_handle, req_handle->cursor_pos, flag, result_set_index);
+  if (err_code < 0)
+    return err_code;
+
+  *is_sent = true;
+  return 0;
+}
+
+/*
+ * bind_array_value_to_net_buf - write a value of a bound array as it is, when it needs no conversion
+ *
+ * return: false if the value has to be converted by bind_value_conversion
+ *
+ * This saves the allocation and copy of a converted value for each fixed size value of an array execution.
+ */
+static bool
+bind_array_value_to_net_buf (T_NET_BUF * net_buf, T_BIND_VALUE * bind_value, int row)
+{
+  T_CCI_A_TYPE a_type = (T_CCI_A_TYPE) bind_value->size;
+  char u_type = (char) bind_value->u_type;
+
+  switch (a_type)
+    {
+    case CCI_A_TYPE_INT:
+      if (bind_value->u_type != CCI_U_TYPE_INT)
+	{
+	  return false;
+	}
+      ADD_ARG_BYTES (net_buf, &u_type, 1);
+      ADD_ARG_INT (net_buf, ((int *) bind_value->value)[row]);
+      return true;
+
+    case CCI_A_TYPE_BIGINT:
+      if (bind_value->u_type != CCI_U_TYPE_BIGINT)
+	{
+	  return false;
+	}
+      ADD_ARG_BYTES (net_buf, &u_type, 1);
+      ADD_ARG_BIGINT (net_buf, ((INT64 *) bind_value->value)[row]);
+      return true;
+
+    case CCI_A_TYPE_FLOAT:
+      if (bind_value->u_type != CCI_U_TYPE_FLOAT)
+	{
+	  return false;
+	}
+      ADD_ARG_BYTES (net_buf, &u_type, 1);
+      ADD_ARG_FLOAT (net_buf, ((float *) bind_value->value)[row]);
+      return true;
+
+    case CCI_A_TYPE_DOUBLE:
+      if (bind_value->u_type != CCI_U_TYPE_DOUBLE)
+	{
+	  return false;
+	}
+      ADD_ARG_BYTES (net_buf, &u_type, 1);
+      ADD_ARG_DOUBLE (net_buf, ((double *) bind_value->value)[row]);
+      return true;
+
+    default:
+      return false;
+    }
+}
+
+static int
+qe_send_fetch_msg (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, int cursor_pos, char flag,
+		   int result_set_index)
+{
+  T_NET_BUF net_buf;
+  int err_code;
+  char func_code = CAS_FC_FETCH;
+
   net_buf_init (&net_buf);
   net_buf_cp_str (&net_buf, &func_code, 1);
   ADD_ARG_INT (&net_buf, req_handle->server_handle_id);
-  ADD_ARG_INT (&net_buf, req_handle->cursor_pos);
+  ADD_ARG_INT (&net_buf, cursor_pos);
   ADD_ARG_INT (&net_buf, req_handle->fetch_size);
   ADD_ARG_BYTES (&net_buf, &flag, 1);
   ADD_ARG_INT (&net_buf, result_set_index);
@@ -1650,8 +1785,55 @@ qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int r
 
   err_code = net_send_msg (con_handle, net_buf.data, net_buf.data_size);
   net_buf_clear (&net_buf);
-  if (err_code < 0)
-    return err_code;
+
+  return err_code;
+}
+
+/*
+ * qe_prefetch - send the fetch request of the tuples following the fetched ones, without waiting for its reply
+ *
+ * The broker fills the reply while the application consumes the fetched tuples, and the next qe_fetch of the statement
+ * only has to read it. At most one prefetch is pending on a connection; any other request sent on the connection
+ * first drains its reply and throws it away (see net_send_msg).
+ */
+static void
+qe_prefetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle)
+{
+  int cursor_pos;
+
+  if (!con_handle->prefetch || con_handle->prefetch_pending || req_handle->is_closed)
+    {
+      return;
+    }
+
+  if (req_handle->fetched_tuple_end <= 0 || req_handle->fetched_tuple_end >= req_handle->num_tuple)
+    {
+      /* nothing fetched, or the last tuple is fetched already */
+      return;
+    }
+
+  cursor_pos = req_handle->fetched_tuple_end + 1;
+  if (qe_send_fetch_msg (req_handle, con_handle, cursor_pos, 0, 0) < 0)
+    {
+      /* the next qe_fetch finds out */
+      return;
+    }
+
+  con_handle->prefetch_pending = true;
+  con_handle->prefetch_req_handle = req_handle;
+  con_handle->prefetch_cursor_pos = cursor_pos;
+}
+
+/*
+ * qe_fetch_recv - read and decode the reply of the fetch request sent by qe_fetch_send
+ */
+int
+qe_fetch_recv (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, T_CCI_ERROR * err_buf)
+{
+  int err_code;
+  char *result_msg = NULL;
+  int result_msg_size;
+  int num_tuple;
 
   err_code = net_recv_msg (con_handle, &result_msg, &result_msg_size, err_buf);
   if (err_code < 0)
@@ -1675,6 +1857,10 @@ qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int r
 	      return CCI_ER_DELETED_TUPLE;
 	    }
 	}
+      else
+	{
+	  qe_prefetch (req_handle, con_handle);
+	}
     }
   else
     {
@@ -2859,6 +3045,10 @@ qe_execute_array (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, T_CCI_QU
 	    {
 	      cur_cell.u_type = CCI_U_TYPE_NULL;
 	    }
+	  else if (bind_array_value_to_net_buf (&net_buf, &(req_handle->bind_value[idx]), row))
+	    {
+	      continue;
+	    }
 	  else
 	    {
 	      char a_type;
@@ -4820,6 +5010,34 @@ get_windows_charset_code (char *str)
 }
 #endif
 
+/*
+ * qe_get_query_recv_timeout - time left to wait for the reply of a query, zero to wait without limit
+ *
+ * When the broker cancels the query by itself (PROTOCOL_V2 and disconnect_on_query_timeout is false), the reply comes
+ * back anyway and is waited for without limit.
+ */
+static int
+qe_get_query_recv_timeout (T_CON_HANDLE * con_handle)
+{
+  int remaining_time;
+
+  if (!TIMEOUT_IS_SET (con_handle))
+    {
+      return 0;
+    }
+
+  if (hm_broker_understand_the_protocol (hm_get_broker_version (con_handle), PROTOCOL_V2)
+      && con_handle->disconnect_on_query_timeout == false)
+    {
+      return 0;
+    }
+
+  remaining_time = con_handle->current_timeout - get_elapsed_time (&con_handle->start_time);
+
+  /* zero would mean no limit */
+  return (remaining_time > 0) ? remaining_time : 1;
+}
+
 static int
 prepare_info_decode (char *buf, int *size, T_REQ_HANDLE * req_handle)
 {
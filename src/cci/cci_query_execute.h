@@ -399,6 +399,8 @@ extern int qe_bind_param (T_REQ_HANDLE * req_handle, int index, T_CCI_A_TYPE a_t
 			  T_CCI_U_TYPE u_type, char flag);
 extern int qe_execute (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size,
 		       T_CCI_ERROR * err_buf);
+extern int qe_execute_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int max_col_size);
+extern int qe_execute_recv (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, T_CCI_ERROR * err_buf);
 extern int qe_end_tran (T_CON_HANDLE * con_handle, char type, T_CCI_ERROR * err_buf);
 extern int qe_end_session (T_CON_HANDLE * con_handle, T_CCI_ERROR * err_buf);
 extern int qe_get_db_parameter (T_CON_HANDLE * con_handle, T_CCI_DB_PARAM param_name, void *value,
@@ -413,6 +415,9 @@ extern int qe_cursor (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, int
 		      T_CCI_ERROR * err_buf);
 extern int qe_fetch (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int result_set_index,
 		     T_CCI_ERROR * err_buf);
+extern int qe_fetch_send (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, int result_set_index,
+			  bool * is_sent);
+extern int qe_fetch_recv (T_REQ_HANDLE * req_handle, T_CON_HANDLE * con_handle, char flag, T_CCI_ERROR * err_buf);
 extern int qe_get_data (T_CON_HANDLE * con_handle, T_REQ_HANDLE * req_handle, int col_no, int a_type, void *value,
 			int *indicator);
 extern int qe_get_cur_oid (T_REQ_HANDLE * req_handle, char *oid_str_buf);
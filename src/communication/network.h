@@ -120,6 +120,7 @@ enum net_server_request
   NET_SERVER_TDE_GET_MK_FILE_PATH,
   NET_SERVER_TDE_GET_MK_INFO,
   NET_SERVER_TDE_CHANGE_MK_ON_SERVER,
+  NET_SERVER_TDE_ROTATE_DK_ON_SERVER,
 
   NET_SERVER_LOG_RESET_WAIT_MSECS,
   NET_SERVER_LOG_RESET_ISOLATION,
@@ -247,6 +248,12 @@ enum net_server_request
   NET_SERVER_LD_INTERRUPT,
   NET_SERVER_LD_UPDATE_STATS,
 
+  /* several independent requests sent at once, answered in order */
+  NET_SERVER_PIPELINE,
+
+  /* several prepared statements executed at once */
+  NET_SERVER_QM_QUERY_EXECUTE_BATCH,
+
   /*
    * This is the last entry. It is also used for the end of an
    * array of statistics information on client/server communication.
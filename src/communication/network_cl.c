@@ -119,6 +119,8 @@ static int compare_size_and_buffer (int *replysize, int size, char **replybuf, c
 static int net_client_request_internal (int request, char *argbuf, int argsize, char *replybuf, int replysize,
 					char *databuf, int datasize, char *replydata, int replydatasize);
 static int set_server_error (int error);
+static int net_client_receive_reply2 (int request, unsigned int rc, char *replybuf, int replysize,
+				      char **replydata_ptr, int *replydatasize_ptr);
 
 static void net_histo_setup_names (void);
 static void net_histo_add_entry (int request, int data_sent);
@@ -544,6 +546,7 @@ net_histo_setup_names (void)
   net_Req_buffer[NET_SERVER_TDE_GET_MK_FILE_PATH].name = "NET_SERVER_TDE_GET_MK_FILE_PATH";
   net_Req_buffer[NET_SERVER_TDE_GET_MK_INFO].name = "NET_SERVER_TDE_GET_MK_INFO";
   net_Req_buffer[NET_SERVER_TDE_CHANGE_MK_ON_SERVER].name = "NET_SERVER_TDE_CHANGE_MK_ON_SERVER";
+  net_Req_buffer[NET_SERVER_TDE_ROTATE_DK_ON_SERVER].name = "NET_SERVER_TDE_ROTATE_DK_ON_SERVER";
 
   net_Req_buffer[NET_SERVER_LOG_RESET_WAIT_MSECS].name = "NET_SERVER_LOG_RESET_WAIT_MSECS";
   net_Req_buffer[NET_SERVER_LOG_RESET_ISOLATION].name = "NET_SERVER_LOG_RESET_ISOLATION";
@@ -652,6 +655,9 @@ net_histo_setup_names (void)
   net_Req_buffer[NET_SERVER_LD_DESTROY].name = "NET_SERVER_LD_DESTROY";
   net_Req_buffer[NET_SERVER_LD_INTERRUPT].name = "NET_SERVER_LD_INTERRUPT";
   net_Req_buffer[NET_SERVER_LD_UPDATE_STATS].name = "NET_SERVER_LD_UPDATE_STATS";
+
+  net_Req_buffer[NET_SERVER_PIPELINE].name = "NET_SERVER_PIPELINE";
+  net_Req_buffer[NET_SERVER_QM_QUERY_EXECUTE_BATCH].name = "NET_SERVER_QM_QUERY_EXECUTE_BATCH";
 }
 
 /*
@@ -1056,6 +1062,167 @@ net_client_request (int request, char *argbuf, int argsize, char *replybuf, int
 				       replydatasize));
 }
 
+/*
+ * net_client_request_pipeline - send several requests at once and receive their replies
+ *
+ * return: error status of sending the requests and receiving their replies
+ *
+ *   requests(in/out): the requests; the error and reply data of each are set on return
+ *   num_requests(in): count of requests
+ *
+ * Note: The requests take a single round trip instead of one each. The server executes them in order, as if each was
+ *       sent by itself, so each may depend on the effects of the previous ones but not on their replies.
+ *       Only the requests the server allows in pipelines can be sent together: those with a single reply (and,
+ *       with has_replydata, the data block it announces), that need no data other than their arguments. If any is
+ *       not allowed, none of them is executed.
+ */
+int
+net_client_request_pipeline (NET_PIPELINED_REQUEST * requests, int num_requests)
+{
+  unsigned int rc;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  char *replybuf, *replydata;
+  char *argbuf = NULL, *ptr;
+  int argsize, size, replysize, reply_datasize, num_executed, i;
+  int error = NO_ERROR;
+
+  for (i = 0; i < num_requests; i++)
+    {
+      requests[i].replydata = NULL;
+      requests[i].replydatasize = 0;
+      requests[i].error = ER_FAILED;
+    }
+
+  if (net_Server_name[0] == '\0')
+    {
+      /* need to have a more appropriate "unexpected disconnect" message */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_CRASHED, 0);
+      return -1;
+    }
+
+  /* pack count, then code, size and arguments of each request */
+  argsize = OR_INT_SIZE;
+  for (i = 0; i < num_requests; i++)
+    {
+      argsize += OR_INT_SIZE + OR_INT_SIZE + DB_ALIGN (requests[i].argsize, INT_ALIGNMENT);
+    }
+  argbuf = (char *) malloc (argsize + MAX_ALIGNMENT);
+  if (argbuf == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (argsize + MAX_ALIGNMENT));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  ptr = PTR_ALIGN (argbuf, MAX_ALIGNMENT);
+  ptr = or_pack_int (ptr, num_requests);
+  for (i = 0; i < num_requests; i++)
+    {
+      ptr = or_pack_int (ptr, requests[i].request);
+      ptr = or_pack_int (ptr, requests[i].argsize);
+      if (requests[i].argsize > 0)
+	{
+	  memcpy (ptr, requests[i].argbuf, requests[i].argsize);
+	}
+      ptr += requests[i].argsize;
+      while (ptr != PTR_ALIGN (ptr, INT_ALIGNMENT))
+	{
+	  *ptr++ = 0;
+	}
+#if defined(HISTO)
+      if (net_Histo_setup)
+	{
+	  net_histo_add_entry (requests[i].request, requests[i].argsize);
+	}
+#endif /* HISTO */
+    }
+
+  rc = css_send_req_to_server (net_Server_host, NET_SERVER_PIPELINE, PTR_ALIGN (argbuf, MAX_ALIGNMENT), argsize,
+			       NULL, 0, reply, OR_INT_SIZE);
+  free_and_init (argbuf);
+  if (rc == 0)
+    {
+      return set_server_error (css_Errno);
+    }
+
+  /* the server first tells how many of the requests it executes: all, or none */
+  replysize = OR_INT_SIZE;
+  error = css_receive_data_from_server (rc, &replybuf, &size);
+  if (error != NO_ERROR)
+    {
+      COMPARE_AND_FREE_BUFFER (reply, replybuf);
+      return set_server_error (error);
+    }
+  error = COMPARE_SIZE_AND_BUFFER (&replysize, size, &reply, replybuf);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+  or_unpack_int (reply, &num_executed);
+  if (num_executed != num_requests)
+    {
+      assert (num_executed == 0);
+      error = er_errid ();
+      return (error != NO_ERROR) ? error : ER_NET_REQUEST_NOT_PIPELINED;
+    }
+
+  /* the replies come in the order of the requests */
+  for (i = 0; i < num_requests; i++)
+    {
+      replysize = requests[i].replysize;
+      css_queue_receive_data_buffer (rc, requests[i].replybuf, replysize);
+      error = css_receive_data_from_server (rc, &replybuf, &size);
+      if (error != NO_ERROR)
+	{
+	  COMPARE_AND_FREE_BUFFER (requests[i].replybuf, replybuf);
+	  requests[i].error = error;
+	  return set_server_error (error);
+	}
+      requests[i].error = COMPARE_SIZE_AND_BUFFER (&replysize, size, &requests[i].replybuf, replybuf);
+
+      if (!requests[i].has_replydata)
+	{
+	  continue;
+	}
+
+      /* here we assume that the first integer in the reply is the length of the following data block */
+      or_unpack_int (requests[i].replybuf, &reply_datasize);
+      if (reply_datasize > 0)
+	{
+	  replydata = (char *) malloc (reply_datasize);
+	  if (replydata == NULL)
+	    {
+	      requests[i].error = net_set_alloc_err_if_not_set (requests[i].error, ARG_FILE_LINE);
+	      net_consume_expected_packets (rc, 1);
+	      continue;
+	    }
+	  css_queue_receive_data_buffer (rc, replydata, reply_datasize);
+	  error = css_receive_data_from_server (rc, &replybuf, &size);
+	  if (error != NO_ERROR)
+	    {
+	      COMPARE_AND_FREE_BUFFER (replydata, replybuf);
+	      free_and_init (replydata);
+	      requests[i].error = error;
+	      return set_server_error (error);
+	    }
+	  requests[i].error = COMPARE_SIZE_AND_BUFFER (&reply_datasize, size, &replydata, replybuf);
+	  requests[i].replydata = replydata;
+	  requests[i].replydatasize = size;
+	}
+    }
+
+#if defined(HISTO)
+  if (net_Histo_setup)
+    {
+      for (i = 0; i < num_requests; i++)
+	{
+	  net_histo_request_finished (requests[i].request, requests[i].replysize + requests[i].replydatasize);
+	}
+    }
+#endif /* HISTO */
+
+  return NO_ERROR;
+}
+
 #if defined(ENABLE_UNUSED_FUNCTION)
 /*
  * net_client_request_send_large_data -
@@ -1288,9 +1455,7 @@ net_client_request2 (int request, char *argbuf, int argsize, char *replybuf, int
 		     char **replydata_ptr, int *replydatasize_ptr)
 {
   unsigned int rc;
-  int size;
-  int reply_datasize, error;
-  char *reply = NULL, *replydata;
+  int error;
 
   error = 0;
   *replydata_ptr = NULL;
@@ -1316,6 +1481,84 @@ net_client_request2 (int request, char *argbuf, int argsize, char *replybuf, int
       return set_server_error (error);
     }
 
+  return net_client_receive_reply2 (request, rc, replybuf, replysize, replydata_ptr, replydatasize_ptr);
+}
+
+/*
+ * net_client_request2_with_segments -
+ *
+ * return: error status
+ *
+ *   request(in): server request id
+ *   segments(in): pieces of the argument buffer, in order
+ *   segment_count(in): number of segments
+ *   replybuf(in): reply argument buffer (small)
+ *   replysize(in): size of reply argument buffer
+ *   replydata_ptr(in): receive data buffer (large)
+ *   replydatasize_ptr(in):  size of expected reply data
+ *
+ * Note: This is similar to net_client_request2, but the argument buffer is sent from segments packed by a packer
+ *    with references to large buffers, without copying them.
+ */
+int
+net_client_request2_with_segments (int request, const struct iovec *segments, int segment_count, char *replybuf,
+				   int replysize, char **replydata_ptr, int *replydatasize_ptr)
+{
+  unsigned int rc;
+  int error;
+
+  *replydata_ptr = NULL;
+  *replydatasize_ptr = 0;
+
+  if (net_Server_name[0] == '\0')
+    {
+      /* need to have a more appropriate "unexpected disconnect" message */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_CRASHED, 0);
+      error = -1;
+      return error;
+    }
+#if defined(HISTO)
+  if (net_Histo_setup)
+    {
+      int i, argsize = 0;
+
+      for (i = 0; i < segment_count; i++)
+	{
+	  argsize += (int) segments[i].iov_len;
+	}
+      net_histo_add_entry (request, argsize);
+    }
+#endif /* HISTO */
+  rc = css_send_req_to_server_with_segments (net_Server_host, request, segments, segment_count, replybuf, replysize);
+  if (rc == 0)
+    {
+      error = css_Errno;
+      return set_server_error (error);
+    }
+
+  return net_client_receive_reply2 (request, rc, replybuf, replysize, replydata_ptr, replydatasize_ptr);
+}
+
+/*
+ * net_client_receive_reply2 - receive the reply of a request sent by net_client_request2
+ *
+ * return: error status
+ *
+ *   request(in): server request id
+ *   rc(in): request entry id
+ *   replybuf(in): reply argument buffer (small)
+ *   replysize(in): size of reply argument buffer
+ *   replydata_ptr(out): receive data buffer (large)
+ *   replydatasize_ptr(out):  size of reply data
+ */
+static int
+net_client_receive_reply2 (int request, unsigned int rc, char *replybuf, int replysize, char **replydata_ptr,
+			   int *replydatasize_ptr)
+{
+  int size;
+  int reply_datasize, error;
+  char *reply = NULL, *replydata;
+
   error = css_receive_data_from_server (rc, &reply, &size);
 
   if (error != NO_ERROR || reply == NULL)
@@ -70,6 +70,11 @@
 #endif // SA_MODE
 #include "xasl.h"
 #include "lob_locator.hpp"
+#if defined (CS_MODE)
+#include "connection_support.h"
+#endif /* CS_MODE */
+
+#include "lz4.h"
 
 /*
  * Use db_clear_private_heap instead of db_destroy_private_heap
@@ -79,6 +84,9 @@
 #define NET_SENDRECV_BUFFSIZE (OR_INT_SIZE)
 
 #if defined (CS_MODE)
+/* loaddb batch content of at least this size is sent from where it is, without being packed */
+#define NET_LOADDB_REFERENCE_MIN_SIZE (16 * ONE_K)
+
 #define NET_DEFER_END_QUERIES_MAX 5
 static QUERY_ID net_Deferred_end_queries[NET_DEFER_END_QUERIES_MAX];
 static int net_Deferred_end_queries_count = 0;
@@ -2022,6 +2030,50 @@ tde_change_mk_on_server (int mk_index)
 #endif /* !CS_MODE */
 }
 
+/*
+ * tde_rotate_dk_on_server -
+ *
+ * return:
+ *
+ *   dk_gen(out): generation of the new perm data key
+ *
+ * NOTE:
+ */
+int
+tde_rotate_dk_on_server (int *dk_gen)
+{
+#if defined(CS_MODE)
+  int error = ER_NET_CLIENT_DATA_RECEIVE;
+  int req_error;
+  char *ptr;
+  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE) a_reply;
+  char *reply;
+
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  req_error =
+    net_client_request (NET_SERVER_TDE_ROTATE_DK_ON_SERVER, NULL, 0, reply, OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0,
+			NULL, 0);
+  if (!req_error)
+    {
+      ptr = or_unpack_errcode (reply, &error);
+      ptr = or_unpack_int (ptr, dk_gen);
+    }
+
+  return error;
+#else /* CS_MODE */
+  int success;
+
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  success = xtde_rotate_dk_without_flock (thread_p, dk_gen);
+
+  exit_server (*thread_p);
+
+  return success;
+#endif /* !CS_MODE */
+}
+
 /*
  * disk_get_total_numpages -
  *
@@ -2646,7 +2698,7 @@ tran_server_commit (bool retain_lock)
 {
 #if defined(CS_MODE)
   TRAN_STATE tran_state = TRAN_UNACTIVE_UNKNOWN;
-  int req_error, tran_state_int, should_conn_reset;
+  int req_error, tran_state_int, should_conn_reset, authorization_version;
   int i = 0;
   char *ptr;
   OR_ALIGNED_BUF (OR_INT_SIZE	/* retain_lock */
@@ -2656,7 +2708,7 @@ tran_server_commit (bool retain_lock)
 		  + MAX_ALIGNMENT	/* aligmnent */
     )a_request;
   char *request;
-  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE) a_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_reply;
   char *reply;
   int row_count = 0;
 
@@ -2695,6 +2747,8 @@ tran_server_commit (bool retain_lock)
 	  db_Connect_status = DB_CONNECTION_STATUS_RESET;
 	  er_log_debug (ARG_FILE_LINE, "tran_server_commit: DB_CONNECTION_STATUS_RESET\n");
 	}
+      ptr = or_unpack_int (ptr, &authorization_version);
+      tm_Tran_authorization_version = (unsigned int) authorization_version;
     }
 
   net_cleanup_client_queues ();
@@ -4598,6 +4652,84 @@ cleanup:
 #endif
 }
 
+/*
+ * csession_get_row_count_and_last_insert_id - get affected rows count and the value of the last update serial
+ * return   : error code or NO_ERROR
+ * rows (out) : the count of affected rows
+ * value (out) : the value of the last insert id
+ *
+ * NOTE: both requests are pipelined; it costs a single round trip to server.
+ */
+int
+csession_get_row_count_and_last_insert_id (int *rows, DB_VALUE * value)
+{
+#if defined (CS_MODE)
+  NET_PIPELINED_REQUEST requests[2];
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_row_count_request;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_row_count_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_lid_request;
+  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE) a_lid_reply;
+  int req_error;
+
+  db_make_null (value);
+
+  requests[0].request = NET_SERVER_SES_GET_ROW_COUNT;
+  requests[0].argbuf = OR_ALIGNED_BUF_START (a_row_count_request);
+  requests[0].argsize = OR_ALIGNED_BUF_SIZE (a_row_count_request);
+  requests[0].replybuf = OR_ALIGNED_BUF_START (a_row_count_reply);
+  requests[0].replysize = OR_ALIGNED_BUF_SIZE (a_row_count_reply);
+  requests[0].has_replydata = false;
+
+  requests[1].request = NET_SERVER_SES_GET_LAST_INSERT_ID;
+  requests[1].argbuf = OR_ALIGNED_BUF_START (a_lid_request);
+  requests[1].argsize = OR_ALIGNED_BUF_SIZE (a_lid_request);
+  requests[1].replybuf = OR_ALIGNED_BUF_START (a_lid_reply);
+  requests[1].replysize = OR_ALIGNED_BUF_SIZE (a_lid_reply);
+  requests[1].has_replydata = true;
+  (void) or_pack_int (requests[1].argbuf, 1);	/* update_last_insert_id */
+
+  req_error = net_client_request_pipeline (requests, 2);
+  if (req_error != NO_ERROR || requests[0].error != NO_ERROR || requests[1].error != NO_ERROR)
+    {
+      req_error = ER_FAILED;
+      goto cleanup;
+    }
+
+  or_unpack_int (requests[0].replybuf, rows);
+
+  /* data_size, then error */
+  (void) or_unpack_int (requests[1].replybuf + OR_INT_SIZE, &req_error);
+  if (req_error != NO_ERROR || requests[1].replydatasize == 0)
+    {
+      req_error = (req_error != NO_ERROR) ? req_error : ER_FAILED;
+      goto cleanup;
+    }
+
+  or_unpack_value (requests[1].replydata, value);
+
+cleanup:
+  if (requests[1].replydata != NULL)
+    {
+      free_and_init (requests[1].replydata);
+    }
+
+  return req_error;
+#else
+  int result = NO_ERROR;
+  THREAD_ENTRY *thread_p = enter_server ();
+
+  result = xsession_get_row_count (thread_p, rows);
+  if (result == NO_ERROR)
+    {
+      result = xsession_get_last_insert_id (thread_p, value, true);
+    }
+
+  exit_server (*thread_p);
+
+  return result;
+#endif
+}
+
 /*
  * csession_reset_cur_insert_id - reset cur insert id as NULL
  * return   : error code or NO_ERROR
@@ -6326,21 +6458,25 @@ btree_class_test_unique (char *buf, int buf_size)
  *   volid(in):
  *   pageid(in):
  *   buffer(in):
+ *   buffer_area_size(in): size of buffer; the server sends as many pages as fit
  *   buffer_size(in):
  *
  * NOTE:
  */
 int
-qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *buffer, int *buffer_size)
+qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *buffer, int buffer_area_size,
+			  int *buffer_size)
 {
 #if defined(CS_MODE)
   int error = ER_NET_CLIENT_DATA_RECEIVE;
   int req_error;
   char *ptr;
-  OR_ALIGNED_BUF (OR_PTR_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_request;
+  OR_ALIGNED_BUF (OR_PTR_SIZE + OR_INT_SIZE * 4) a_request;
   char *request;
-  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 3) a_reply;
   char *reply;
+  char *zip_buf;
+  int page_size;
 
   request = OR_ALIGNED_BUF_START (a_request);
   reply = OR_ALIGNED_BUF_START (a_reply);
@@ -6348,6 +6484,8 @@ qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *b
   ptr = or_pack_ptr (request, query_id);
   ptr = or_pack_int (ptr, (int) volid);
   ptr = or_pack_int (ptr, (int) pageid);
+  ptr = or_pack_int (ptr, buffer_area_size);
+  ptr = or_pack_int (ptr, prm_get_bool_value (PRM_ID_LIST_FETCH_COMPRESSION) ? 1 : 0);
 
   req_error =
     net_client_request2_no_malloc (NET_SERVER_LS_GET_LIST_FILE_PAGE, request, OR_ALIGNED_BUF_SIZE (a_request), reply,
@@ -6355,16 +6493,36 @@ qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *b
   if (!req_error)
     {
       ptr = or_unpack_int (&reply[OR_INT_SIZE], &error);
+      ptr = or_unpack_int (ptr, &page_size);
+
+      if (error == NO_ERROR && *buffer_size < page_size)
+	{
+	  /* pages are compressed; they can not be decompressed in place */
+	  zip_buf = (char *) malloc (*buffer_size);
+	  if (zip_buf == NULL)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) * buffer_size);
+	      return ER_OUT_OF_VIRTUAL_MEMORY;
+	    }
+	  memcpy (zip_buf, buffer, *buffer_size);
+
+	  if (LZ4_decompress_safe (zip_buf, buffer, *buffer_size, buffer_area_size) != page_size)
+	    {
+	      error = ER_NET_SERVER_DATA_RECEIVE;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+	    }
+	  free_and_init (zip_buf);
+	  *buffer_size = page_size;
+	}
     }
 
   return error;
 #else /* CS_MODE */
   int success;
-  int page_size;
 
   THREAD_ENTRY *thread_p = enter_server ();
 
-  success = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, buffer, &page_size);
+  success = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, buffer, buffer_area_size, buffer_size);
 
   exit_server (*thread_p);
 
@@ -6579,11 +6737,11 @@ qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt
   char *replydata_listid = NULL, *replydata_page = NULL, *replydata_plan = NULL, *ptr;
   OR_ALIGNED_BUF (OR_XASL_ID_SIZE + OR_INT_SIZE * 5 + OR_CACHE_TIME_SIZE
 		  + OR_PTR_SIZE * NET_DEFER_END_QUERIES_MAX + EXECUTE_QUERY_MAX_ARGUMENT_DATA_SIZE) a_request;
-  OR_ALIGNED_BUF (OR_INT_SIZE * 7 + OR_PTR_ALIGNED_SIZE + OR_CACHE_TIME_SIZE) a_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 8 + OR_PTR_ALIGNED_SIZE + OR_CACHE_TIME_SIZE) a_reply;
   int i, request_len;
   const DB_VALUE *dbval;
   CACHE_TIME local_srv_cache_time;
-  int should_conn_reset, end_query_result, tran_state;
+  int should_conn_reset, end_query_result, tran_state, authorization_version;
 
   request = OR_ALIGNED_BUF_START (a_request);
   reply = OR_ALIGNED_BUF_START (a_reply);
@@ -6704,12 +6862,17 @@ qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt
 	  ptr = or_unpack_int (ptr, &end_query_result);
 	  ptr = or_unpack_int (ptr, &tran_state);
 	  ptr = or_unpack_int (ptr, &should_conn_reset);
+	  ptr = or_unpack_int (ptr, &authorization_version);
 
 	  if (tran_state == TRAN_UNACTIVE_COMMITTED || tran_state == TRAN_UNACTIVE_COMMITTED_INFORMING_PARTICIPANTS
 	      || tran_state == TRAN_UNACTIVE_ABORTED || tran_state == TRAN_UNACTIVE_ABORTED_INFORMING_PARTICIPANTS)
 	    {
 	      net_cleanup_client_queues ();
 	    }
+	  if (tran_state == TRAN_UNACTIVE_COMMITTED || tran_state == TRAN_UNACTIVE_COMMITTED_INFORMING_PARTICIPANTS)
+	    {
+	      tm_Tran_authorization_version = (unsigned int) authorization_version;
+	    }
 
 	  tran_set_latest_query_status (end_query_result, tran_state, should_conn_reset);
 	}
@@ -6804,6 +6967,162 @@ cleanup:
 #endif /* !CS_MODE */
 }
 
+/*
+ * qmgr_execute_query_batch - Send a SERVER_QM_QUERY_EXECUTE_BATCH request to the server
+ *
+ * return: error code
+ *
+ *   stmt_count(in): number of statements
+ *   xasl_ids(in): XASL file ids of the prepared statements
+ *   dbval_cnts(in): number of parameter values of each statement
+ *   dbvals(in): parameter values of each statement
+ *   flag(in):
+ *   query_timeout(in):
+ *   results(out): row count, or error code, of each executed statement
+ *   executed_count(out): number of executed statements
+ *
+ * NOTE: Send the XASL file ids and parameter values of all statements in one request. The statements are executed
+ *       in order and their results are closed on the server; a failed statement does not stop the batch, unless it
+ *       aborted the transaction.
+ *       This function is a counter part to sqmgr_execute_query_batch().
+ */
+int
+qmgr_execute_query_batch (int stmt_count, const XASL_ID * xasl_ids, const int *dbval_cnts, const DB_VALUE ** dbvals,
+			  QUERY_FLAG flag, int query_timeout, int *results, int *executed_count)
+{
+#if defined(CS_MODE)
+  int error = NO_ERROR, req_error, senddata_size, replydata_size, page_size;
+  char *request, *reply, *senddata, *replydata = NULL, *replydata_page = NULL, *ptr;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 4) a_request;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 5) a_reply;
+  char *size_ptr, *values_ptr;
+  int i, j;
+
+  request = OR_ALIGNED_BUF_START (a_request);
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  *executed_count = 0;
+
+  /* XASL file id, number of values and values of each statement; values are aligned to be unpacked in place */
+  senddata_size = 0;
+  for (i = 0; i < stmt_count; i++)
+    {
+      senddata_size += OR_XASL_ID_SIZE + OR_INT_SIZE * 2 + MAX_ALIGNMENT;
+      for (j = 0; j < dbval_cnts[i]; j++)
+	{
+	  senddata_size += OR_VALUE_ALIGNED_SIZE ((DB_VALUE *) & dbvals[i][j]);
+	}
+    }
+
+  senddata = (char *) malloc (senddata_size);
+  if (senddata == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) senddata_size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  ptr = senddata;
+  for (i = 0; i < stmt_count; i++)
+    {
+      OR_PACK_XASL_ID (ptr, &xasl_ids[i]);
+      ptr = or_pack_int (ptr, dbval_cnts[i]);
+
+      size_ptr = ptr;
+      ptr = PTR_ALIGN (ptr + OR_INT_SIZE, MAX_ALIGNMENT);
+      values_ptr = ptr;
+      for (j = 0; j < dbval_cnts[i]; j++)
+	{
+	  ptr = or_pack_db_value (ptr, (DB_VALUE *) & dbvals[i][j]);
+	}
+      (void) or_pack_int (size_ptr, CAST_BUFLEN (ptr - values_ptr));
+    }
+  senddata_size = CAST_BUFLEN (ptr - senddata);
+
+  flag &= ~(EXECUTE_QUERY_WITH_COMMIT | EXECUTE_QUERY_WITHOUT_DATA_BUFFERS | TRAN_AUTO_COMMIT | RESULT_HOLDABLE);
+
+  ptr = or_pack_int (request, stmt_count);
+  ptr = or_pack_int (ptr, flag);
+  ptr = or_pack_int (ptr, query_timeout);
+  ptr = or_pack_int (ptr, senddata_size);
+
+  req_error = net_client_request_with_callback (NET_SERVER_QM_QUERY_EXECUTE_BATCH, request,
+						OR_ALIGNED_BUF_SIZE (a_request), reply, OR_ALIGNED_BUF_SIZE (a_reply),
+						senddata, senddata_size, NULL, 0, &replydata, &replydata_size,
+						&replydata_page, &page_size, NULL, NULL);
+  free_and_init (senddata);
+
+  if (req_error)
+    {
+      ASSERT_ERROR_AND_SET (error);
+    }
+  else
+    {
+      /* QUERY_END, size of results and two empty data sizes precede the number of executed statements */
+      (void) or_unpack_int (reply + OR_INT_SIZE * 4, executed_count);
+      assert (*executed_count <= stmt_count && replydata_size == OR_INT_SIZE * *executed_count);
+
+      ptr = replydata;
+      for (i = 0; i < *executed_count; i++)
+	{
+	  ptr = or_unpack_int (ptr, &results[i]);
+	}
+    }
+
+  if (replydata != NULL)
+    {
+      free_and_init (replydata);
+    }
+  if (replydata_page != NULL)
+    {
+      free_and_init (replydata_page);
+    }
+
+  return error;
+#else /* CS_MODE */
+  QFILE_LIST_ID *list_id;
+  QUERY_ID query_id;
+  int i;
+
+  *executed_count = 0;
+
+  flag &= ~(EXECUTE_QUERY_WITH_COMMIT | EXECUTE_QUERY_WITHOUT_DATA_BUFFERS | TRAN_AUTO_COMMIT | RESULT_HOLDABLE);
+
+  /* no round trips to save; execute the statements one by one */
+  for (i = 0; i < stmt_count; i++)
+    {
+      query_id = NULL_QUERY_ID;
+      list_id = qmgr_execute_query (&xasl_ids[i], &query_id, dbval_cnts[i], dbvals[i], flag, NULL, NULL, query_timeout);
+      if (list_id != NULL)
+	{
+	  results[i] = list_id->tuple_cnt;
+	  cursor_free_self_list_id (list_id);
+	}
+      else
+	{
+	  ASSERT_ERROR_AND_SET (results[i]);
+	  if (results[i] == NO_ERROR)
+	    {
+	      results[i] = ER_FAILED;
+	    }
+	}
+      if (query_id > 0)
+	{
+	  (void) qmgr_end_query (query_id);
+	}
+
+      (*executed_count)++;
+
+      if (results[i] == ER_LK_UNILATERALLY_ABORTED || results[i] == ER_DB_NO_MODIFICATIONS)
+	{
+	  /* transaction is aborted; the rest of the batch cannot be executed */
+	  return results[i];
+	}
+    }
+
+  return NO_ERROR;
+#endif /* !CS_MODE */
+}
+
 /*
  * qmgr_prepare_and_execute_query -
  *
@@ -10260,7 +10579,10 @@ loaddb_load_batch (const cubload::batch & batch, bool use_temp_batch, bool & is_
 
   packing_packer packer;
   cubmem::extensible_block eb;
+  std::vector<cubpacking::packed_segment> segments;
+  struct iovec iov[CSS_MAX_REQUEST_SEGMENTS];
 
+  packer.set_reference_min_size (NET_LOADDB_REFERENCE_MIN_SIZE);
   if (use_temp_batch)
     {
       packer.set_buffer_and_pack_all (eb, use_temp_batch);
@@ -10270,8 +10592,17 @@ loaddb_load_batch (const cubload::batch & batch, bool use_temp_batch, bool & is_
       packer.set_buffer_and_pack_all (eb, use_temp_batch, batch);
     }
 
-  int req_error = net_client_request2 (NET_SERVER_LD_LOAD_BATCH, eb.get_ptr (), (int) packer.get_current_size (), reply,
-				       OR_ALIGNED_BUF_SIZE (a_reply), NULL, 0, &data_reply, &data_reply_size);
+  /* batch content is referenced by one of the segments */
+  packer.get_segments (segments);
+  assert (!segments.empty () && segments.size () <= CSS_MAX_REQUEST_SEGMENTS);
+  for (size_t i = 0; i < segments.size (); i++)
+    {
+      iov[i].iov_base = (caddr_t) segments[i].m_ptr;
+      iov[i].iov_len = segments[i].m_size;
+    }
+
+  int req_error = net_client_request2_with_segments (NET_SERVER_LD_LOAD_BATCH, iov, (int) segments.size (), reply,
+						     OR_ALIGNED_BUF_SIZE (a_reply), &data_reply, &data_reply_size);
   if (req_error != NO_ERROR)
     {
       return req_error;
@@ -57,6 +57,7 @@ struct bo_restart_arg;
 struct compile_context;
 struct xasl_node_header;
 struct xasl_stream;
+struct iovec;
 
 /* killtran supporting structures and functions */
 typedef struct one_tran_info ONE_TRAN_INFO;
@@ -80,6 +81,21 @@ struct trans_info
   ONE_TRAN_INFO tran[1];	/* really [num_trans] */
 };
 
+/* one of the requests sent at once by net_client_request_pipeline */
+typedef struct net_pipelined_request NET_PIPELINED_REQUEST;
+struct net_pipelined_request
+{
+  int request;			/* server request id; the server must allow it in pipelines */
+  char *argbuf;			/* argument buffer (small) */
+  int argsize;			/* byte size of argbuf */
+  char *replybuf;		/* reply argument buffer (small) */
+  int replysize;		/* size of reply argument buffer */
+  bool has_replydata;		/* the first int of the reply is the size of a data block that follows it */
+  char *replydata;		/* out: the data block, if any; freed by caller */
+  int replydatasize;		/* out: size of replydata */
+  int error;			/* out: error status of the request */
+};
+
 extern int locator_fetch (OID * oidp, int chn, LOCK lock, LC_FETCH_VERSION_TYPE fetch_type, OID * class_oid,
 			  int class_chn, int prefetch, LC_COPYAREA ** fetch_copyarea);
 extern int locator_get_class (OID * class_oid, int class_chn, const OID * oid, LOCK lock, int prefetching,
@@ -128,6 +144,7 @@ extern int tde_get_data_keys ();
 extern int tde_get_mk_file_path (char *mk_path);
 extern int tde_get_mk_info (int *mk_index, time_t * created_time, time_t * set_time);
 extern int tde_change_mk_on_server (int mk_index);
+extern int tde_rotate_dk_on_server (int *dk_gen);
 extern DKNPAGES disk_get_total_numpages (VOLID volid);
 extern DKNPAGES disk_get_free_numpages (VOLID volid);
 extern char *disk_get_remarks (VOLID volid);
@@ -239,12 +256,16 @@ extern BTREE_SEARCH repl_btree_find_unique (BTID * btid, DB_VALUE * key, OID * c
 extern BTREE_SEARCH btree_find_multi_uniques (OID * class_oid, int pruning_type, BTID * btids, DB_VALUE * keys,
 					      int count, SCAN_OPERATION_TYPE op_type, OID ** oids, int *oids_count);
 extern int btree_class_test_unique (char *buf, int buf_size);
-extern int qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *buffer, int *buffer_size);
+extern int qfile_get_list_file_page (QUERY_ID query_id, VOLID volid, PAGEID pageid, char *buffer, int buffer_area_size,
+				     int *buffer_size);
 extern int qmgr_prepare_query (struct compile_context *context, xasl_stream * stream);
 
 extern QFILE_LIST_ID *qmgr_execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int dbval_cnt,
 					  const DB_VALUE * dbvals, QUERY_FLAG flag, CACHE_TIME * clt_cache_time,
 					  CACHE_TIME * srv_cache_time, int query_timeout);
+extern int qmgr_execute_query_batch (int stmt_count, const XASL_ID * xasl_ids, const int *dbval_cnts,
+				     const DB_VALUE ** dbvals, QUERY_FLAG flag, int query_timeout, int *results,
+				     int *executed_count);
 extern QFILE_LIST_ID *qmgr_prepare_and_execute_query (char *xasl_stream, int xasl_stream_size, QUERY_ID * query_id,
 						      int dbval_cnt, DB_VALUE * dbval_ptr, QUERY_FLAG flag,
 						      int query_timeout);
@@ -310,8 +331,12 @@ extern int net_client_request (int request, char *argbuf, int argsize, char *rep
 extern int net_client_request_send_large_data (int request, char *argbuf, int argsize, char *replybuf, int replysize,
 					       char *databuf, INT64 datasize, char *replydata, int replydatasize);
 #endif
+extern int net_client_request_pipeline (NET_PIPELINED_REQUEST * requests, int num_requests);
 extern int net_client_request2 (int request, char *argbuf, int argsize, char *replybuf, int replysize, char *databuf,
 				int datasize, char **replydata_ptr, int *replydatasize_ptr);
+extern int net_client_request2_with_segments (int request, const struct iovec *segments, int segment_count,
+					     char *replybuf, int replysize, char **replydata_ptr,
+					     int *replydatasize_ptr);
 extern int net_client_request2_no_malloc (int request, char *argbuf, int argsize, char *replybuf, int replysize,
 					  char *databuf, int datasize, char *replydata, int *replydatasize_ptr);
 extern int net_client_request_3_data (int request, char *argbuf, int argsize, char *databuf1, int datasize1,
@@ -402,6 +427,7 @@ extern int csession_end_session (SESSION_ID session_id);
 extern int csession_set_row_count (int rows);
 extern int csession_get_row_count (int *rows);
 extern int csession_get_last_insert_id (DB_VALUE * value, bool update_last_insert_id);
+extern int csession_get_row_count_and_last_insert_id (int *rows, DB_VALUE * value);
 extern int csession_reset_cur_insert_id (void);
 extern int csession_create_prepared_statement (const char *name, const char *alias_print, char *stmt_info,
 					       int info_length);
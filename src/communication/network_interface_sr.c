@@ -84,6 +84,8 @@
 #include "elo.h"
 #include "transaction_transient.hpp"
 
+#include "lz4.h"
+
 #if defined (SUPPRESS_STRLEN_WARNING)
 #define strlen(s1)  ((int) strlen(s1))
 #endif /* defined (SUPPRESS_STRLEN_WARNING) */
@@ -96,11 +98,24 @@
 
 #define NET_DEFER_END_QUERIES_MAX 10
 
+/* most list file pages a client can fetch at once */
+#define NET_LIST_FILE_FETCH_MAX_PAGES 64
+
 /* Query execution with commit. */
 #define QEWC_SAFE_GUARD_SIZE 1024
 // To have the safe area is just a safe guard to avoid potential issues of bad size calculation.
 #define QEWC_MAX_DATA_SIZE  (DB_PAGESIZE - QEWC_SAFE_GUARD_SIZE)
 
+/* Commit reply sent by log flush daemon once the commit is durable, see stran_server_commit. */
+typedef struct stran_deferred_commit_reply STRAN_DEFERRED_COMMIT_REPLY;
+struct stran_deferred_commit_reply
+{
+  CSS_CONN_ENTRY *conn;
+  int client_id;		/* to recognize the connection entry was not reused meanwhile */
+  unsigned int rid;
+  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_reply;
+};
+
 /* This file is only included in the server.  So set the on_server flag on */
 unsigned int db_on_server = 1;
 
@@ -116,6 +131,7 @@ STATIC_INLINE void stran_server_auto_commit_or_abort (THREAD_ENTRY * thread_p, u
 STATIC_INLINE int stran_can_end_after_query_execution (THREAD_ENTRY * thread_p, int query_flag, QFILE_LIST_ID * list_id,
 						       bool * can_end_transaction) __attribute__ ((ALWAYS_INLINE));
 
+static void stran_send_deferred_commit_reply (void *arg);
 static bool need_to_abort_tran (THREAD_ENTRY * thread_p, int *errid);
 static int server_capabilities (void);
 static int check_client_capabilities (THREAD_ENTRY * thread_p, int client_cap, int rel_compare,
@@ -2698,6 +2714,37 @@ stde_change_mk_on_server (THREAD_ENTRY * thread_p, unsigned int rid, char *reque
   css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
 }
 
+/*
+ * stde_rotate_dk_on_server -
+ *
+ * return:
+ *
+ *   rid(in):
+ *   request(in):
+ *   reqlen(in):
+ *
+ * NOTE:
+ */
+void
+stde_rotate_dk_on_server (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  int error;
+  char *ptr;
+  int dk_gen = -1;
+  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+
+  error = xtde_rotate_dk_without_flock (thread_p, &dk_gen);
+  if (error != NO_ERROR)
+    {
+      (void) return_error_to_client (thread_p, rid);
+    }
+
+  ptr = or_pack_errcode (reply, error);
+  ptr = or_pack_int (ptr, dk_gen);
+  css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
+}
+
 /*
  * stran_server_commit -
  *
@@ -2716,7 +2763,7 @@ stran_server_commit (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
   TRAN_STATE state;
   int xretain_lock;
   bool retain_lock, should_conn_reset = false;
-  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE) a_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE + OR_INT_SIZE + OR_INT_SIZE) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
   char *ptr;
   int row_count = DB_ROW_COUNT_NOT_SET;
@@ -2742,13 +2789,71 @@ stran_server_commit (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
   /* set row count */
   xsession_set_row_count (thread_p, row_count);
 
+  /* with log_commit_reply_deferred, this thread does not wait for the commit log flush */
+  thread_p->defer_commit_flush = prm_get_bool_value (PRM_ID_LOG_COMMIT_REPLY_DEFERRED);
+  LSA_SET_NULL (&thread_p->commit_flush_lsa);
+
   state = stran_server_commit_internal (thread_p, rid, retain_lock, &should_conn_reset);
 
+  thread_p->defer_commit_flush = false;
+
   ptr = or_pack_int (reply, (int) state);
   ptr = or_pack_int (ptr, (int) should_conn_reset);
+  ptr = or_pack_int (ptr, (int) logtb_get_authorization_version ());
+
+  if (!LSA_ISNULL (&thread_p->commit_flush_lsa))
+    {
+      STRAN_DEFERRED_COMMIT_REPLY *deferred_reply;
+
+      deferred_reply = (STRAN_DEFERRED_COMMIT_REPLY *) malloc (sizeof (STRAN_DEFERRED_COMMIT_REPLY));
+      if (deferred_reply == NULL)
+	{
+	  /* reply once committed */
+	  logpb_flush_pages (thread_p, &thread_p->commit_flush_lsa);
+	}
+      else
+	{
+	  /* the client gets the reply when the commit is durable, the thread is free meanwhile */
+	  deferred_reply->conn = thread_p->conn_entry;
+	  deferred_reply->client_id = thread_p->conn_entry->client_id;
+	  deferred_reply->rid = rid;
+	  memcpy (OR_ALIGNED_BUF_START (deferred_reply->a_reply), reply, OR_ALIGNED_BUF_SIZE (a_reply));
+
+	  logpb_add_flush_completion (thread_p, &thread_p->commit_flush_lsa, stran_send_deferred_commit_reply,
+				      deferred_reply);
+	  LSA_SET_NULL (&thread_p->commit_flush_lsa);
+	  return;
+	}
+      LSA_SET_NULL (&thread_p->commit_flush_lsa);
+    }
+
   css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply));
 }
 
+/*
+ * stran_send_deferred_commit_reply - send the reply of a commit whose log is flushed
+ *
+ * return: nothing
+ *
+ *   arg(in): STRAN_DEFERRED_COMMIT_REPLY, freed here
+ *
+ * NOTE: The reply is dropped if the client disconnected meanwhile.
+ */
+static void
+stran_send_deferred_commit_reply (void *arg)
+{
+  STRAN_DEFERRED_COMMIT_REPLY *deferred_reply = (STRAN_DEFERRED_COMMIT_REPLY *) arg;
+
+  if (deferred_reply->conn->status == CONN_OPEN && deferred_reply->conn->client_id == deferred_reply->client_id)
+    {
+      css_send_data_to_client (deferred_reply->conn, deferred_reply->rid,
+			       OR_ALIGNED_BUF_START (deferred_reply->a_reply),
+			       OR_ALIGNED_BUF_SIZE (deferred_reply->a_reply));
+    }
+
+  free_and_init (deferred_reply);
+}
+
 /*
  * stran_server_abort -
  *
@@ -4589,18 +4694,20 @@ sdk_vlabel (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen
  *   request(in):
  *   reqlen(in):
  *
- * NOTE:
+ * NOTE: As many pages as fit in the client buffer are sent, so the client asks again only after it has read them all.
+ *       If the client asks for it, the pages are compressed, unless that saves nothing.
  */
 void
 sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
 {
   QUERY_ID query_id;
-  int volid, pageid;
+  int volid, pageid, buffer_size, accept_compressed;
   char *ptr;
-  OR_ALIGNED_BUF (OR_INT_SIZE * 2) a_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 3) a_reply;
   char *reply = OR_ALIGNED_BUF_START (a_reply);
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_page_buf;
-  int page_size;
+  char *alloc_page_buf = NULL, *zip_buf = NULL, *send_buf;
+  int page_size, send_size, zip_size;
   int error = NO_ERROR;
 
   aligned_page_buf = PTR_ALIGN (page_buf, MAX_ALIGNMENT);
@@ -4608,13 +4715,39 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
   ptr = or_unpack_ptr (request, &query_id);
   ptr = or_unpack_int (ptr, &volid);
   ptr = or_unpack_int (ptr, &pageid);
+  ptr = or_unpack_int (ptr, &buffer_size);
+  ptr = or_unpack_int (ptr, &accept_compressed);
+
+  if (buffer_size < IO_MAX_PAGE_SIZE)
+    {
+      buffer_size = IO_MAX_PAGE_SIZE;
+    }
+  else if (buffer_size > DB_PAGESIZE * NET_LIST_FILE_FETCH_MAX_PAGES)
+    {
+      buffer_size = DB_PAGESIZE * NET_LIST_FILE_FETCH_MAX_PAGES;
+    }
 
   if (volid == NULL_VOLID && pageid == NULL_PAGEID)
     {
       goto empty_page;
     }
 
-  error = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, aligned_page_buf, &page_size);
+  if (buffer_size > IO_MAX_PAGE_SIZE)
+    {
+      alloc_page_buf = (char *) db_request_alloc (thread_p, buffer_size + MAX_ALIGNMENT);
+      if (alloc_page_buf == NULL)
+	{
+	  /* fall back to one network page */
+	  er_clear ();
+	  buffer_size = IO_MAX_PAGE_SIZE;
+	}
+      else
+	{
+	  aligned_page_buf = PTR_ALIGN (alloc_page_buf, MAX_ALIGNMENT);
+	}
+    }
+
+  error = xqfile_get_list_file_page (thread_p, query_id, volid, pageid, aligned_page_buf, buffer_size, &page_size);
   if (error != NO_ERROR)
     {
       (void) return_error_to_client (thread_p, rid);
@@ -4626,10 +4759,33 @@ sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *requ
       goto empty_page;
     }
 
-  ptr = or_pack_int (reply, page_size);
+  send_buf = aligned_page_buf;
+  send_size = page_size;
+  if (accept_compressed)
+    {
+      zip_buf = (char *) db_request_alloc (thread_p, LZ4_COMPRESSBOUND (page_size));
+      if (zip_buf != NULL)
+	{
+	  zip_size = LZ4_compress_default (aligned_page_buf, zip_buf, page_size, LZ4_COMPRESSBOUND (page_size));
+	  if (0 < zip_size && zip_size < page_size)
+	    {
+	      send_buf = zip_buf;
+	      send_size = zip_size;
+	    }
+	}
+      else
+	{
+	  /* send them uncompressed */
+	  er_clear ();
+	}
+    }
+
+  /* the client finds out the pages are compressed when the data is smaller than the pages */
+  ptr = or_pack_int (reply, send_size);
   ptr = or_pack_int (ptr, error);
-  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
-				     page_size);
+  ptr = or_pack_int (ptr, page_size);
+  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), send_buf,
+				     send_size);
   return;
 
 empty_page:
@@ -4638,6 +4794,7 @@ empty_page:
   page_size = QFILE_PAGE_HEADER_SIZE;
   ptr = or_pack_int (reply, page_size);
   ptr = or_pack_int (ptr, error);
+  ptr = or_pack_int (ptr, page_size);
   css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), aligned_page_buf,
 				     page_size);
 }
@@ -4952,7 +5109,7 @@ sqmgr_execute_query (THREAD_ENTRY * thread_p, unsigned int rid, char *request, i
   PAGE_PTR page_ptr;
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_page_buf;
   QUERY_FLAG query_flag;
-  OR_ALIGNED_BUF (OR_INT_SIZE * 7 + OR_PTR_ALIGNED_SIZE + OR_CACHE_TIME_SIZE) a_reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 8 + OR_PTR_ALIGNED_SIZE + OR_CACHE_TIME_SIZE) a_reply;
   CACHE_TIME clt_cache_time;
   CACHE_TIME srv_cache_time;
   int query_timeout;
@@ -5195,7 +5352,7 @@ null_list:
   if (0 < replydata_size)
     {
       /* pack list file id as a reply data */
-      replydata = (char *) db_private_alloc (thread_p, replydata_size);
+      replydata = (char *) db_request_alloc (thread_p, replydata_size);
       if (replydata != NULL)
 	{
 	  (void) or_pack_listid (replydata, list_id);
@@ -5322,6 +5479,7 @@ null_list:
       /* pack commit/abart/active result */
       ptr = or_pack_int (ptr, (int) tran_state);
       ptr = or_pack_int (ptr, (int) should_conn_reset);
+      ptr = or_pack_int (ptr, (int) logtb_get_authorization_version ());
     }
 
 #if !defined(NDEBUG)
@@ -5333,10 +5491,6 @@ null_list:
 				       replydata_size, page_ptr, page_size, queryinfo_string, queryinfo_string_length);
 
   /* free QFILE_LIST_ID duplicated by xqmgr_execute_query() */
-  if (replydata != NULL)
-    {
-      db_private_free_and_init (thread_p, replydata);
-    }
   if (list_id != NULL)
     {
       QFILE_FREE_AND_INIT_LIST_ID (list_id);
@@ -5361,6 +5515,134 @@ exit:
     }
 }
 
+/*
+ * sqmgr_execute_query_batch - Process a SERVER_QM_QUERY_EXECUTE_BATCH request
+ *
+ * return:
+ *
+ *   thrd(in):
+ *   rid(in):
+ *   request(in):
+ *   reqlen(in):
+ *
+ * NOTE:
+ * Receive the XASL file ids of several prepared statements with their parameter values and execute them one after
+ * the other. The results are not kept; each statement reports its row count, or its error code, and the batch goes on.
+ * The statements that are not executed after an error that aborted the transaction are not reported.
+ * This function is a counter part to qmgr_execute_query_batch().
+ */
+void
+sqmgr_execute_query_batch (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen)
+{
+  XASL_ID xasl_id;
+  QFILE_LIST_ID *list_id;
+  QUERY_ID query_id;
+  QUERY_FLAG query_flag, stmt_flag;
+  CACHE_TIME clt_cache_time, srv_cache_time;
+  XASL_CACHE_ENTRY *xasl_cache_entry_p;
+  int stmt_count, query_timeout, data_size, dbval_cnt, values_size;
+  int csserror, error_code, result, executed_count = 0;
+  char *ptr, *data = NULL, *results = NULL, *results_ptr, *reply;
+  OR_ALIGNED_BUF (OR_INT_SIZE * 5) a_reply;
+  int i;
+
+  reply = OR_ALIGNED_BUF_START (a_reply);
+
+  ptr = or_unpack_int (request, &stmt_count);
+  ptr = or_unpack_int (ptr, &query_flag);
+  ptr = or_unpack_int (ptr, &query_timeout);
+  ptr = or_unpack_int (ptr, &data_size);
+
+  /* receive XASL file ids and parameter values of all statements from the client */
+  csserror = css_receive_data_from_client (thread_p->conn_entry, rid, &data, &data_size);
+  if (csserror || data == NULL || stmt_count <= 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_DATA_RECEIVE, 0);
+      css_send_abort_to_client (thread_p->conn_entry, rid);
+      if (data)
+	{
+	  free_and_init (data);
+	}
+      return;
+    }
+
+  results = (char *) db_request_alloc (thread_p, OR_INT_SIZE * stmt_count);
+  if (results == NULL)
+    {
+      css_send_abort_to_client (thread_p->conn_entry, rid);
+      free_and_init (data);
+      return;
+    }
+
+  /* statements of a batch are neither committed with their execution nor kept open for fetching */
+  query_flag &= ~(EXECUTE_QUERY_WITH_COMMIT | EXECUTE_QUERY_WITHOUT_DATA_BUFFERS | TRAN_AUTO_COMMIT | RESULT_HOLDABLE);
+
+  ptr = data;
+  results_ptr = results;
+  for (i = 0; i < stmt_count; i++)
+    {
+      OR_UNPACK_XASL_ID (ptr, &xasl_id);
+      ptr = or_unpack_int (ptr, &dbval_cnt);
+      ptr = or_unpack_int (ptr, &values_size);
+      ptr = PTR_ALIGN (ptr, MAX_ALIGNMENT);
+
+      stmt_flag = query_flag;
+      query_id = NULL_QUERY_ID;
+      xasl_cache_entry_p = NULL;
+      CACHE_TIME_RESET (&clt_cache_time);
+      CACHE_TIME_RESET (&srv_cache_time);
+
+      list_id = xqmgr_execute_query (thread_p, &xasl_id, &query_id, dbval_cnt, ptr, &stmt_flag, &clt_cache_time,
+				     &srv_cache_time, query_timeout, &xasl_cache_entry_p);
+      ptr += values_size;
+
+      if (list_id != NULL)
+	{
+	  result = list_id->tuple_cnt;
+	  QFILE_FREE_AND_INIT_LIST_ID (list_id);
+	}
+      else
+	{
+	  ASSERT_ERROR_AND_SET (result);
+	  if (result == NO_ERROR)
+	    {
+	      result = ER_FAILED;
+	    }
+	}
+
+      if (xasl_cache_entry_p != NULL)
+	{
+	  xcache_unfix (thread_p, xasl_cache_entry_p);
+	  xasl_cache_entry_p = NULL;
+	}
+      if (query_id > 0)
+	{
+	  (void) xqmgr_end_query (thread_p, query_id);
+	}
+
+      results_ptr = or_pack_int (results_ptr, result);
+      executed_count++;
+
+      if (result < 0 && need_to_abort_tran (thread_p, &error_code))
+	{
+	  /* transaction is aborted; the rest of the batch cannot be executed */
+	  (void) return_error_to_client (thread_p, rid);
+	  break;
+	}
+    }
+
+  free_and_init (data);
+
+  ptr = or_pack_int (reply, QUERY_END);
+  ptr = or_pack_int (ptr, OR_INT_SIZE * executed_count);
+  ptr = or_pack_int (ptr, 0);
+  ptr = or_pack_int (ptr, 0);
+  ptr = or_pack_int (ptr, executed_count);
+
+  css_send_reply_and_data_to_client (thread_p->conn_entry, rid, reply, OR_ALIGNED_BUF_SIZE (a_reply), results,
+				     OR_INT_SIZE * executed_count);
+}
+
 /*
  * er_log_slow_query - log slow query to error log file
  * return:
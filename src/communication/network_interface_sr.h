@@ -87,6 +87,7 @@ extern void stde_get_data_keys (THREAD_ENTRY * thread_p, unsigned int rid, char
 extern void stde_get_mk_file_path (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void stde_get_mk_info (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void stde_change_mk_on_server (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
+extern void stde_rotate_dk_on_server (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void stran_server_commit (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void stran_server_abort (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void stran_server_has_updated (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
@@ -133,6 +134,7 @@ extern void sdk_vlabel (THREAD_ENTRY * thread_p, unsigned int rid, char *request
 extern void sqfile_get_list_file_page (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_prepare_query (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_execute_query (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
+extern void sqmgr_execute_query_batch (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_prepare_and_execute_query (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_end_query (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 extern void sqmgr_drop_all_query_plans (THREAD_ENTRY * thread_p, unsigned int rid, char *request, int reqlen);
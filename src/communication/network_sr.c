@@ -44,6 +44,7 @@
 #include "message_catalog.h"
 #include "network.h"
 #include "network_interface_sr.h"
+#include "object_representation.h"
 #include "perf_monitor.h"
 #include "query_list.h"
 #include "release_string.h"
@@ -66,6 +67,8 @@ enum net_req_act
   SET_DIAGNOSTICS_INFO = 0x0004,
   IN_TRANSACTION = 0x0008,
   OUT_TRANSACTION = 0x0010,
+  PIPELINED = 0x0020		/* can be sent in a NET_SERVER_PIPELINE request; it must send all its replies on rid,
+				 * without waiting for more data from client */
 };
 typedef void (*net_server_func) (THREAD_ENTRY * thrd, unsigned int rid, char *request, int reqlen);
 struct net_request
@@ -89,6 +92,7 @@ static void net_server_histo_add_entry (int request, int data_sent);
 
 static void net_server_init (void);
 static int net_server_request (THREAD_ENTRY * thread_p, unsigned int rid, int request, int size, char *buffer);
+static int net_server_pipeline (THREAD_ENTRY * thread_p, unsigned int rid, char *buffer, int size);
 static int net_server_conn_down (THREAD_ENTRY * thread_p, CSS_THREAD_ARG arg);
 
 
@@ -456,6 +460,10 @@ net_server_init (void)
   req_p->processing_function = stde_change_mk_on_server;
   req_p->name = "NET_SERVER_TDE_CHANGE_MK_ON_SERVER";
 
+  req_p = &net_Requests[NET_SERVER_TDE_ROTATE_DK_ON_SERVER];
+  req_p->processing_function = stde_rotate_dk_on_server;
+  req_p->name = "NET_SERVER_TDE_ROTATE_DK_ON_SERVER";
+
   /* log */
   req_p = &net_Requests[NET_SERVER_LOG_RESET_WAIT_MSECS];
   req_p->processing_function = slogtb_reset_wait_msecs;
@@ -592,13 +600,18 @@ net_server_init (void)
   req_p->processing_function = sqmgr_execute_query;
   req_p->name = "NET_SERVER_QM_QUERY_EXECUTE";
 
+  req_p = &net_Requests[NET_SERVER_QM_QUERY_EXECUTE_BATCH];
+  req_p->action_attribute = (SET_DIAGNOSTICS_INFO | IN_TRANSACTION);
+  req_p->processing_function = sqmgr_execute_query_batch;
+  req_p->name = "NET_SERVER_QM_QUERY_EXECUTE_BATCH";
+
   req_p = &net_Requests[NET_SERVER_QM_QUERY_PREPARE_AND_EXECUTE];
   req_p->action_attribute = (SET_DIAGNOSTICS_INFO | IN_TRANSACTION);
   req_p->processing_function = sqmgr_prepare_and_execute_query;
   req_p->name = "NET_SERVER_QM_QUERY_PREPARE_AND_EXECUTE";
 
   req_p = &net_Requests[NET_SERVER_QM_QUERY_END];
-  req_p->action_attribute = IN_TRANSACTION;
+  req_p->action_attribute = (IN_TRANSACTION | PIPELINED);
   req_p->processing_function = sqmgr_end_query;
   req_p->name = "NET_SERVER_QM_QUERY_END";
 
@@ -776,18 +789,22 @@ net_server_init (void)
   req_p->name = "NET_SERVER_END_SESSION";
 
   req_p = &net_Requests[NET_SERVER_SES_SET_ROW_COUNT];
+  req_p->action_attribute = PIPELINED;
   req_p->processing_function = ssession_set_row_count;
   req_p->name = "NET_SERVER_SET_ROW_COUNT";
 
   req_p = &net_Requests[NET_SERVER_SES_GET_ROW_COUNT];
+  req_p->action_attribute = PIPELINED;
   req_p->processing_function = ssession_get_row_count;
   req_p->name = "NET_SERVER_GET_ROW_COUNT";
 
   req_p = &net_Requests[NET_SERVER_SES_GET_LAST_INSERT_ID];
+  req_p->action_attribute = PIPELINED;
   req_p->processing_function = ssession_get_last_insert_id;
   req_p->name = "NET_SERVER_SES_GET_LAST_INSERT_ID";
 
   req_p = &net_Requests[NET_SERVER_SES_RESET_CUR_INSERT_ID];
+  req_p->action_attribute = PIPELINED;
   req_p->processing_function = ssession_reset_cur_insert_id;
   req_p->name = "NET_SERVER_SES_RESET_CUR_INSERT_ID";
 
@@ -885,6 +902,10 @@ net_server_init (void)
   req_p->processing_function = sloaddb_update_stats;
   req_p->name = "NET_SERVER_LD_UPDATE_STATS";
 
+  /* pipelined requests; dispatched by net_server_request itself */
+  req_p = &net_Requests[NET_SERVER_PIPELINE];
+  req_p->name = "NET_SERVER_PIPELINE";
+
   /* checksumdb replication */
   req_p = &net_Requests[NET_SERVER_CHKSUM_REPL];
   req_p->action_attribute = IN_TRANSACTION;
@@ -963,6 +984,90 @@ net_server_histo_add_entry (int request, int data_sent)
 }
 #endif /* CUBRID_DEBUG */
 
+/*
+ * net_server_pipeline () - execute the requests of a NET_SERVER_PIPELINE request
+ *   return: error status
+ *   thread_p(in): this thread handle
+ *   rid(in): CSS request id
+ *   buffer(in): packed requests
+ *   size(in): size of buffer
+ *
+ * Note: The buffer has the count of requests, then for each request its code, the size of its arguments and the
+ *       arguments, aligned to int. The requests are executed in order, as if each was sent by itself, and all of
+ *       them answer on rid. Before them, the client gets the count of requests that are executed: all of them, or
+ *       none if any of them is not PIPELINED.
+ */
+static int
+net_server_pipeline (THREAD_ENTRY * thread_p, unsigned int rid, char *buffer, int size)
+{
+  OR_ALIGNED_BUF (OR_INT_SIZE) a_reply;
+  char *reply = OR_ALIGNED_BUF_START (a_reply);
+  char *ptr, *end, *arg_buffer;
+  int num_requests = 0, request, arg_size, i;
+  int status = CSS_NO_ERRORS;
+
+  if (buffer == NULL || size < OR_INT_SIZE)
+    {
+      request = NET_SERVER_REQUEST_END;
+      goto reject;
+    }
+
+  /* check all requests first; the client is told how many replies to wait for before any of them is sent */
+  end = buffer + size;
+  ptr = or_unpack_int (buffer, &num_requests);
+  for (i = 0; i < num_requests; i++)
+    {
+      request = NET_SERVER_REQUEST_END;
+      arg_size = -1;
+      if (ptr + 2 * OR_INT_SIZE <= end)
+	{
+	  ptr = or_unpack_int (ptr, &request);
+	  ptr = or_unpack_int (ptr, &arg_size);
+	}
+      if (request <= NET_SERVER_REQUEST_START || request >= NET_SERVER_REQUEST_END
+	  || !(net_Requests[request].action_attribute & PIPELINED) || arg_size < 0 || arg_size > end - ptr)
+	{
+	  goto reject;
+	}
+      ptr = PTR_ALIGN (ptr + arg_size, INT_ALIGNMENT);
+    }
+
+  (void) or_pack_int (reply, num_requests);
+  css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_INT_SIZE);
+
+  ptr = or_unpack_int (buffer, &num_requests);
+  for (i = 0; i < num_requests && status == CSS_NO_ERRORS; i++)
+    {
+      ptr = or_unpack_int (ptr, &request);
+      ptr = or_unpack_int (ptr, &arg_size);
+
+      /* net_server_request frees the arguments of the request */
+      arg_buffer = NULL;
+      if (arg_size > 0)
+	{
+	  arg_buffer = (char *) malloc (arg_size);
+	  if (arg_buffer != NULL)
+	    {
+	      memcpy (arg_buffer, ptr, arg_size);
+	    }
+	}
+      ptr = PTR_ALIGN (ptr + arg_size, INT_ALIGNMENT);
+
+      status = net_server_request (thread_p, rid, request, arg_size, arg_buffer);
+    }
+
+  return status;
+
+reject:
+  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_NET_REQUEST_NOT_PIPELINED, 1,
+	  (request > NET_SERVER_REQUEST_START && request < NET_SERVER_REQUEST_END) ? net_Requests[request].name :
+	  "UNKNOWN");
+  return_error_to_client (thread_p, rid);
+  (void) or_pack_int (reply, 0);
+  css_send_data_to_client (thread_p->conn_entry, rid, reply, OR_INT_SIZE);
+  return status;
+}
+
 /*
  * net_server_request () - The main server request dispatch handler
  *   return: error status
@@ -994,6 +1099,11 @@ net_server_request (THREAD_ENTRY * thread_p, unsigned int rid, int request, int
       status = server_ping_with_handshake (thread_p, rid, buffer, size);
       goto end;
     }
+  else if (request == NET_SERVER_PIPELINE)
+    {
+      status = net_server_pipeline (thread_p, rid, buffer, size);
+      goto end;
+    }
   else if (request == NET_SERVER_SHUTDOWN)
     {
       er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_NET_SERVER_SHUTDOWN, 0);
@@ -1061,6 +1061,21 @@ db_get_last_insert_id (DB_VALUE * value)
   return csession_get_last_insert_id (value, true);
 }
 
+/*
+ * db_get_row_count_and_last_insert_id - get affected row count and the value of the last updated serial
+ *  return: error code
+ *  row_count (out) : row count
+ *  value (out) : the value of the last updated serial
+ *
+ *  note: it is the same as db_get_row_count followed by db_get_last_insert_id, in a single round trip to server.
+ */
+int
+db_get_row_count_and_last_insert_id (int *row_count, DB_VALUE * value)
+{
+  CHECK_CONNECT_ERROR ();
+  return csession_get_row_count_and_last_insert_id (row_count, value);
+}
+
 
 /*
  * db_get_variable () - get the value of a session variable
@@ -29,7 +29,10 @@
 #include <cerrno>
 #include <cstdlib>
 #include <limits>
+#include <list>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -52,6 +55,92 @@ static bool db_json_path_is_valid_identifier_start_char (unsigned char ch);
 static bool db_json_path_is_valid_identifier_char (unsigned char ch);
 static void db_json_remove_leading_zeros_index (std::string &index);
 static bool db_json_iszero (const unsigned char &ch);
+static std::string db_json_path_cache_key (const char *path);
+static bool db_json_path_cache_get (const std::string &key, std::vector<PATH_TOKEN> &tokens);
+static void db_json_path_cache_put (const std::string &key, const std::vector<PATH_TOKEN> &tokens);
+
+/*
+ * Process-wide LRU cache of parsed paths. The JSON functions parse their path arguments on every call, so a constant
+ * path (or one bound as host variable) is parsed once per row; the cache keeps the tokens of the recently parsed paths.
+ */
+using json_path_cache_lru = std::list<std::pair<std::string, std::vector<PATH_TOKEN>>>;
+
+static std::mutex json_Path_cache_mutex;
+static json_path_cache_lru json_Path_cache_lru;	/* most recently used first */
+static std::unordered_map<std::string, json_path_cache_lru::iterator> json_Path_cache_map;
+
+/*
+ * db_json_path_cache_key () - key of a path in the cache
+ *
+ * return    : the key
+ * path (in) : the path
+ *
+ * NOTE: the maximum array index is part of the key, since parsing rejects bigger indexes
+ */
+static std::string
+db_json_path_cache_key (const char *path)
+{
+  std::string key = std::to_string (prm_get_integer_value (PRM_ID_JSON_MAX_ARRAY_IDX));
+
+  key += ':';
+  key += path;
+
+  return key;
+}
+
+/*
+ * db_json_path_cache_get () - get the tokens of a parsed path from the cache
+ *
+ * return      : true if the path was found
+ * key (in)    : cache key of the path
+ * tokens (in/out) : the tokens of the path are appended
+ */
+static bool
+db_json_path_cache_get (const std::string &key, std::vector<PATH_TOKEN> &tokens)
+{
+  std::lock_guard<std::mutex> lock (json_Path_cache_mutex);
+
+  auto found = json_Path_cache_map.find (key);
+  if (found == json_Path_cache_map.end ())
+    {
+      return false;
+    }
+
+  json_Path_cache_lru.splice (json_Path_cache_lru.begin (), json_Path_cache_lru, found->second);
+  tokens.insert (tokens.end (), found->second->second.begin (), found->second->second.end ());
+  return true;
+}
+
+/*
+ * db_json_path_cache_put () - add the tokens of a parsed path to the cache
+ *
+ * key (in)    : cache key of the path
+ * tokens (in) : the tokens of the path
+ */
+static void
+db_json_path_cache_put (const std::string &key, const std::vector<PATH_TOKEN> &tokens)
+{
+  size_t max_size = (size_t) prm_get_integer_value (PRM_ID_JSON_PATH_CACHE_SIZE);
+  std::lock_guard<std::mutex> lock (json_Path_cache_mutex);
+
+  if (json_Path_cache_map.find (key) != json_Path_cache_map.end ())
+    {
+      return;
+    }
+
+  while (!json_Path_cache_lru.empty () && json_Path_cache_lru.size () >= max_size)
+    {
+      json_Path_cache_map.erase (json_Path_cache_lru.back ().first);
+      json_Path_cache_lru.pop_back ();
+    }
+  if (max_size == 0)
+    {
+      return;
+    }
+
+  json_Path_cache_lru.emplace_front (key, tokens);
+  json_Path_cache_map[key] = json_Path_cache_lru.begin ();
+}
 
 static bool
 db_json_iszero (const unsigned char &ch)
@@ -1134,26 +1223,38 @@ JSON_PATH::parent_exists (JSON_DOC &jd) const
 int
 JSON_PATH::parse (const char *path)
 {
+  std::string cache_key = db_json_path_cache_key (path);
+  bool is_cacheable = m_path_tokens.empty ();
+  if (is_cacheable && db_json_path_cache_get (cache_key, m_path_tokens))
+    {
+      return NO_ERROR;
+    }
+
   std::string sql_path_string (path);
   JSON_PATH_TYPE json_path_type = db_json_get_path_type (sql_path_string);
+  int error_code;
 
   if (json_path_type == JSON_PATH_TYPE::JSON_PATH_POINTER)
     {
       // path is not SQL path format; consider it JSON pointer.
-      int error_code = from_json_pointer (sql_path_string);
-      if (error_code != NO_ERROR)
-	{
-	  ASSERT_ERROR ();
-	}
-      return error_code;
+      error_code = from_json_pointer (sql_path_string);
+    }
+  else
+    {
+      error_code = validate_and_create_from_json_path (sql_path_string);
     }
 
-  int error_code = validate_and_create_from_json_path (sql_path_string);
   if (error_code != NO_ERROR)
     {
       ASSERT_ERROR ();
+      return error_code;
     }
-  return error_code;
+
+  if (is_cacheable)
+    {
+      db_json_path_cache_put (cache_key, m_path_tokens);
+    }
+  return NO_ERROR;
 }
 
 int
@@ -149,6 +149,7 @@ extern "C"
   extern void db_update_row_count_cache (const int row_count);
   extern int db_get_row_count (int *row_count);
   extern int db_get_last_insert_id (DB_VALUE * value);
+  extern int db_get_row_count_and_last_insert_id (int *row_count, DB_VALUE * value);
   extern int db_get_variable (DB_VALUE * name, DB_VALUE * value);
   extern int db_shutdown (void);
   extern int db_ping_server (int client_val, int *server_val);
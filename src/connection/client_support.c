@@ -338,6 +338,48 @@ css_send_req_to_server_with_large_data (char *host, int request, char *arg_buffe
 }
 #endif
 
+/*
+ * css_send_req_to_server_with_segments() - send a request to server; the argument buffer is sent from segments
+ *   return:
+ *   host(in): name of the remote host
+ *   request(in): the request to send to the server.
+ *   segments(in): pieces of the packed argument buffer, in order
+ *   segment_count(in): number of segments
+ *   reply_buffer(in): enroll a data buffer to hold the resulting data.
+ *   reply_buffer_size(in): The size of the reply buffer.
+ *
+ * Note: server receives the same request as from css_send_req_to_server with the argument buffer, but the segments
+ *       are not copied to one buffer.
+ */
+unsigned int
+css_send_req_to_server_with_segments (char *host, int request, const struct iovec *segments, int segment_count,
+				      char *reply_buffer, int reply_size)
+{
+  CSS_MAP_ENTRY *entry;
+  unsigned short rid;
+
+  entry = css_return_open_entry (host, &css_Client_anchor);
+  if (entry == NULL)
+    {
+      css_Errno = SERVER_WAS_NOT_FOUND;
+      return 0;
+    }
+
+  entry->conn->set_tran_index (tm_Tran_index);
+  entry->conn->invalidate_snapshot = tm_Tran_invalidate_snapshot;
+
+  css_Errno = css_send_req_with_segments (entry->conn, request, &rid, segments, segment_count, reply_buffer,
+					  reply_size);
+  if (css_Errno != NO_ERRORS)
+    {
+      css_remove_queued_connection_by_entry (entry, &css_Client_anchor);
+      return 0;
+    }
+
+  tm_Tran_invalidate_snapshot = 0;
+  return (css_make_eid (entry->id, rid));
+}
+
 /*
  * css_send_req_to_server_2_data() - send a request to server
  *   return:
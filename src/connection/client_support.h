@@ -28,6 +28,8 @@
 
 #include "connection_defs.h"
 
+struct iovec;
+
 extern int css_Errno;
 extern CSS_MAP_ENTRY *css_Client_anchor;
 
@@ -47,6 +49,8 @@ extern unsigned int css_send_req_to_server_with_large_data (char *host, int requ
 							    INT64 data_buffer_size, char *reply_buffer, int reply_size);
 #endif
 
+extern unsigned int css_send_req_to_server_with_segments (char *host, int request, const struct iovec *segments,
+							  int segment_count, char *reply_buffer, int reply_size);
 extern unsigned int css_send_req_to_server_2_data (char *host, int request, char *arg_buffer, int arg_buffer_size,
 						   char *data1_buffer, int data1_buffer_size, char *data2_buffer,
 						   int data2_buffer_size, char *reply_buffer, int reply_size);
@@ -1633,6 +1633,74 @@ css_send_req_with_2_buffers (CSS_CONN_ENTRY * conn, int request, unsigned short
 			 arg_buffer, arg_size, (char *) &data_header, sizeof (NET_HEADER), data_buffer, data_size));
 }
 
+/*
+ * css_send_req_with_segments () - transfer a request to the server; the argument buffer is sent from segments
+ *   return: enum css_error_code (See connection_defs.h)
+ *   conn(in):
+ *   request(in):
+ *   request_id(out):
+ *   segments(in): pieces of the argument buffer, in order
+ *   segment_count(in): number of segments, at most CSS_MAX_REQUEST_SEGMENTS
+ *   reply_buffer(in):
+ *   reply_size(in):
+ *
+ * Note: the server receives one argument buffer, the same as the one sent by css_send_request_with_data_buffer.
+ *       segments are gathered by writev, they are not copied to one buffer.
+ */
+int
+css_send_req_with_segments (CSS_CONN_ENTRY * conn, int request, unsigned short *request_id,
+			    const struct iovec *segments, int segment_count, char *reply_buffer, int reply_size)
+{
+  NET_HEADER local_header = DEFAULT_HEADER_DATA;
+  NET_HEADER data_header = DEFAULT_HEADER_DATA;
+  struct iovec iov[5 + CSS_MAX_REQUEST_SEGMENTS];
+  int templen1, templen2, templen3;
+  int arg_size = 0;
+  int total_len;
+  int i;
+
+  assert (segment_count > 0 && segment_count <= CSS_MAX_REQUEST_SEGMENTS);
+
+  if (!conn || conn->status != CONN_OPEN)
+    {
+      return CONNECTION_CLOSED;
+    }
+
+  for (i = 0; i < segment_count; i++)
+    {
+      arg_size += (int) segments[i].iov_len;
+    }
+
+  *request_id = css_get_request_id (conn);
+  css_set_net_header (&local_header, COMMAND_TYPE, request, *request_id, arg_size, conn->get_tran_index (),
+		      conn->invalidate_snapshot, conn->db_error);
+
+  if (reply_buffer && reply_size > 0)
+    {
+      css_queue_user_data_buffer (conn, *request_id, reply_size, reply_buffer);
+    }
+
+  css_set_net_header (&data_header, DATA_TYPE, 0, *request_id, arg_size, conn->get_tran_index (),
+		      conn->invalidate_snapshot, conn->db_error);
+
+  css_set_io_vector (&(iov[0]), &(iov[1]), (char *) &local_header, sizeof (NET_HEADER), &templen1);
+  css_set_io_vector (&(iov[2]), &(iov[3]), (char *) &data_header, sizeof (NET_HEADER), &templen2);
+
+  /* one length for all segments */
+  templen3 = htonl (arg_size);
+  iov[4].iov_base = (caddr_t) & templen3;
+  iov[4].iov_len = sizeof (int);
+  for (i = 0; i < segment_count; i++)
+    {
+      iov[5 + i] = segments[i];
+    }
+
+  total_len = sizeof (NET_HEADER) * 2 + arg_size + sizeof (int) * 3;
+
+  /* timeout in milli-second in css_send_io_vector() */
+  return css_send_io_vector (conn, iov, total_len, 5 + segment_count, -1);
+}
+
 /*
  * css_send_req_with_3_buffers () - transfer a request to the server
  *   return: enum css_error_code (See connection_defs.h)
@@ -46,6 +46,9 @@ typedef struct pollfd POLL_FD;
 extern int css_net_send_no_block (SOCKET fd, const char *buffer, int size);
 #endif
 
+/* maximum number of segments of a request argument buffer */
+#define CSS_MAX_REQUEST_SEGMENTS 16
+
 typedef void (*CSS_SERVER_TIMEOUT_FN) (void);
 /* check server alive */
 typedef bool (*CSS_CHECK_SERVER_ALIVE_FN) (const char *, const char *);
@@ -70,6 +73,9 @@ extern int css_send_request_no_reply (CSS_CONN_ENTRY * conn, int request, unsign
 extern int css_send_req_with_2_buffers (CSS_CONN_ENTRY * conn, int request, unsigned short *request_id,
 					char *arg_buffer, int arg_size, char *data_buffer, int data_size,
 					char *reply_buffer, int reply_size);
+extern int css_send_req_with_segments (CSS_CONN_ENTRY * conn, int request, unsigned short *request_id,
+				       const struct iovec *segments, int segment_count, char *reply_buffer,
+				       int reply_size);
 extern int css_send_req_with_3_buffers (CSS_CONN_ENTRY * conn, int request, unsigned short *request_id,
 					char *arg_buffer, int arg_size, char *data1_buffer, int data1_size,
 					char *data2_buffer, int data2_size, char *reply_buffer, int reply_size);
@@ -37,6 +37,9 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <algorithm>
+#include <mutex>
+#include <vector>
 #if !defined(WINDOWS)
 #include <signal.h>
 #include <unistd.h>
@@ -45,6 +48,9 @@
 #endif /* SOLARIS */
 #include <sys/socket.h>
 #include <fcntl.h>
+#if defined (LINUX)
+#include <sys/epoll.h>
+#endif /* LINUX */
 #include <netinet/in.h>
 #endif /* !WINDOWS */
 #include <assert.h>
@@ -202,6 +208,71 @@ private:
   CSS_CONN_ENTRY &m_conn;
 };
 
+// css_connection_down_task - runs the connection error handler of a connection dropped by a reactor; the handler
+//                            waits for the workers of the transaction and must not block the reactor
+class css_connection_down_task : public cubthread::entry_task
+{
+public:
+
+  css_connection_down_task (void) = delete;
+
+  css_connection_down_task (CSS_CONN_ENTRY & conn)
+  : m_conn (conn)
+  {
+    //
+  }
+
+  void execute (context_type & thread_ref) override final;
+
+  // retire not overwritten; task is automatically deleted
+
+private:
+  CSS_CONN_ENTRY &m_conn;
+};
+
+#if defined (LINUX)
+// css_reactor - one thread waiting on the sockets of many connections with epoll, instead of one thread for each
+//               connection. The requests it reads are queued and dispatched to the request workers exactly like the
+//               connection threads do, so the requests of a connection keep their order.
+struct css_reactor
+{
+  int epoll_fd;
+  std::mutex new_conns_mutex;
+  std::vector<CSS_CONN_ENTRY *> new_conns;	// added by css_internal_connection_handler, taken by the reactor
+  std::vector<CSS_CONN_ENTRY *> conns;		// only accessed by reactor thread
+
+  css_reactor ()
+    : epoll_fd (-1)
+    , new_conns_mutex ()
+    , new_conns ()
+    , conns ()
+  {
+  }
+};
+
+class css_reactor_task : public cubthread::entry_task
+{
+public:
+
+  css_reactor_task (void) = delete;
+
+  css_reactor_task (css_reactor & reactor)
+  : m_reactor (reactor)
+  {
+    //
+  }
+
+  void execute (context_type & thread_ref) override final;
+
+private:
+  css_reactor &m_reactor;
+};
+
+static css_reactor *css_Reactors = NULL;
+static int css_Num_reactors = 0;
+static int css_Next_reactor = 0;
+#endif /* LINUX */
+
 static const size_t CSS_JOB_QUEUE_SCAN_COLUMN_COUNT = 4;
 
 static void css_setup_server_loop (void);
@@ -220,6 +291,13 @@ static void css_process_get_eof_request (SOCKET master_fd);
 static void css_close_connection_to_master (void);
 static int css_reestablish_connection_to_master (void);
 static int css_connection_handler_thread (THREAD_ENTRY * thrd, CSS_CONN_ENTRY * conn);
+#if defined (LINUX)
+static int css_start_reactors (void);
+static void css_stop_reactors (void);
+static bool css_reactor_add_conn (CSS_CONN_ENTRY * conn);
+static void css_reactor_drop_conn (css_reactor & reactor, size_t index, bool call_error_handler);
+static void css_reactor_check_conns (THREAD_ENTRY & thread_ref, css_reactor & reactor, bool check_peers);
+#endif /* LINUX */
 static css_error_code css_internal_connection_handler (CSS_CONN_ENTRY * conn);
 static int css_internal_request_handler (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn_ref);
 static int css_test_for_client_errors (CSS_CONN_ENTRY * conn, unsigned int eid);
@@ -1130,6 +1208,274 @@ css_connection_handler_thread (THREAD_ENTRY * thread_p, CSS_CONN_ENTRY * conn)
   return 0;
 }
 
+#if defined (LINUX)
+/*
+ * css_start_reactors () - create the reactors that multiplex client connections, if configured; the reactor tasks
+ *                         run in connection worker pool
+ *   return: error code
+ */
+static int
+css_start_reactors (void)
+{
+  int num_reactors = prm_get_integer_value (PRM_ID_CONNECTION_REACTOR_THREADS);
+  int i;
+
+  css_Num_reactors = 0;
+  css_Next_reactor = 0;
+  if (num_reactors <= 0)
+    {
+      // one thread per connection
+      return NO_ERROR;
+    }
+
+  css_Reactors = new css_reactor[num_reactors];
+  for (i = 0; i < num_reactors; i++)
+    {
+      css_Reactors[i].epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+      if (css_Reactors[i].epoll_fd < 0)
+	{
+	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_CREATE, 0);
+	  css_stop_reactors ();
+	  return ER_CSS_PTHREAD_CREATE;
+	}
+    }
+
+  css_Num_reactors = num_reactors;
+  for (i = 0; i < num_reactors; i++)
+    {
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_reactor_task (css_Reactors[i]));
+    }
+  return NO_ERROR;
+}
+
+/*
+ * css_stop_reactors () - free the reactors; their tasks must be stopped
+ *   return: void
+ */
+static void
+css_stop_reactors (void)
+{
+  int i, num_reactors = prm_get_integer_value (PRM_ID_CONNECTION_REACTOR_THREADS);
+
+  if (css_Reactors == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < num_reactors; i++)
+    {
+      if (css_Reactors[i].epoll_fd >= 0)
+	{
+	  close (css_Reactors[i].epoll_fd);
+	}
+    }
+  delete[] css_Reactors;
+  css_Reactors = NULL;
+  css_Num_reactors = 0;
+}
+
+/*
+ * css_reactor_add_conn () - hand a new connection to a reactor
+ *   return: false if there are no reactors
+ *   conn(in): new connection
+ */
+static bool
+css_reactor_add_conn (CSS_CONN_ENTRY * conn)
+{
+  css_reactor *reactor;
+  int index;
+
+  if (css_Num_reactors <= 0)
+    {
+      return false;
+    }
+
+  // connections are accepted by only one thread
+  index = css_Next_reactor;
+  css_Next_reactor = (css_Next_reactor + 1) % css_Num_reactors;
+  reactor = &css_Reactors[index];
+
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (reactor->new_conns_mutex);
+  // *INDENT-ON*
+  reactor->new_conns.push_back (conn);
+  return true;
+}
+
+/*
+ * css_reactor_drop_conn () - stop waiting for the requests of a connection
+ *   return: void
+ *   reactor(in): reactor of connection
+ *   index(in): index of connection in reactor->conns
+ *   call_error_handler(in): true to let a connection worker run the connection error handler
+ */
+static void
+css_reactor_drop_conn (css_reactor & reactor, size_t index, bool call_error_handler)
+{
+  CSS_CONN_ENTRY *conn = reactor.conns[index];
+
+  if (!IS_INVALID_SOCKET (conn->fd))
+    {
+      (void) epoll_ctl (reactor.epoll_fd, EPOLL_CTL_DEL, conn->fd, NULL);
+    }
+  reactor.conns[index] = reactor.conns.back ();
+  reactor.conns.pop_back ();
+
+  if (call_error_handler)
+    {
+      cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_down_task (*conn));
+    }
+}
+
+/*
+ * css_reactor_check_conns () - do for all connections of a reactor the checks css_connection_handler_thread does for
+ *                              its connection when it is idle
+ *   return: void
+ *   thread_ref(in): reactor thread
+ *   reactor(in): reactor
+ *   check_peers(in): true to also check clients are alive and server HA state
+ */
+static void
+css_reactor_check_conns (THREAD_ENTRY & thread_ref, css_reactor & reactor, bool check_peers)
+{
+  CSS_CONN_ENTRY *conn;
+  volatile int conn_status;
+  size_t i = 0;
+
+  while (i < reactor.conns.size ())
+    {
+      conn = reactor.conns[i];
+
+      if (conn->stop_talk)
+	{
+	  // server is shutting down; just let go of the connection
+	  css_reactor_drop_conn (reactor, i, false);
+	  continue;
+	}
+
+      conn_status = conn->status;
+      if (conn_status == CONN_CLOSING)
+	{
+	  // see css_connection_handler_thread
+	  rmutex_lock (&thread_ref, &conn->rmutex);
+	  conn_status = conn->status;
+	  rmutex_unlock (&thread_ref, &conn->rmutex);
+	}
+      if (conn_status != CONN_OPEN)
+	{
+	  er_log_debug (ARG_FILE_LINE, "css_reactor_check_conns: conn->status (%d) is not CONN_OPEN.", conn_status);
+	  css_reactor_drop_conn (reactor, i, true);
+	  continue;
+	}
+
+      if (check_peers)
+	{
+	  if (CHECK_CLIENT_IS_ALIVE () && css_peer_alive (conn->fd, 5000) == false)
+	    {
+	      er_log_debug (ARG_FILE_LINE, "css_reactor_check_conns: css_peer_alive() error\n");
+	      css_reactor_drop_conn (reactor, i, true);
+	      continue;
+	    }
+	  if (ha_Server_state == HA_SERVER_STATE_TO_BE_STANDBY && conn->in_transaction == false
+	      && css_count_transaction_worker_threads (&thread_ref, conn->get_tran_index (), conn->client_id) == 0)
+	    {
+	      css_reactor_drop_conn (reactor, i, true);
+	      continue;
+	    }
+	}
+      i++;
+    }
+}
+
+/*
+ * css_reactor_task::execute () - wait for requests on all connections of the reactor, read them and dispatch them to
+ *                                request workers
+ *   return: void
+ *   thread_ref(in): reactor thread
+ */
+void
+css_reactor_task::execute (context_type & thread_ref)
+{
+  const int CSS_REACTOR_MAX_EVENTS = 64;
+  const int CSS_REACTOR_WAIT_MSECS = 100;
+  const int CSS_REACTOR_PEER_CHECK_LOOPS = 5000 / CSS_REACTOR_WAIT_MSECS;
+  struct epoll_event events[CSS_REACTOR_MAX_EVENTS];
+  struct epoll_event add_event;
+  CSS_CONN_ENTRY *conn;
+  int n, i, type, status;
+  int num_loop = 0;
+  size_t index;
+
+  thread_ref.type = TT_SERVER;
+
+  while (!thread_ref.shutdown)
+    {
+      // take new connections
+      {
+	// *INDENT-OFF*
+	std::unique_lock<std::mutex> ulock (m_reactor.new_conns_mutex);
+	// *INDENT-ON*
+	for (index = 0; index < m_reactor.new_conns.size (); index++)
+	  {
+	    conn = m_reactor.new_conns[index];
+
+	    add_event.events = EPOLLIN;
+	    add_event.data.ptr = conn;
+	    if (epoll_ctl (m_reactor.epoll_fd, EPOLL_CTL_ADD, conn->fd, &add_event) != 0)
+	      {
+		// cannot wait for it here; give it a thread of its own
+		cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_task (*conn));
+		continue;
+	      }
+	    m_reactor.conns.push_back (conn);
+	  }
+	m_reactor.new_conns.clear ();
+      }
+
+      n = epoll_wait (m_reactor.epoll_fd, events, CSS_REACTOR_MAX_EVENTS, CSS_REACTOR_WAIT_MSECS);
+      if (n < 0 && errno != EINTR)
+	{
+	  er_log_debug (ARG_FILE_LINE, "css_reactor_task: epoll_wait() error %d\n", errno);
+	}
+
+      for (i = 0; i < n; i++)
+	{
+	  conn = (CSS_CONN_ENTRY *) events[i].data.ptr;
+
+	  if (events[i].events & (EPOLLERR | EPOLLHUP))
+	    {
+	      status = ERROR_ON_READ;
+	    }
+	  else
+	    {
+	      // read command/data/etc request from socket, and enqueue it to appr. queue
+	      status = css_read_and_queue (conn, &type);
+	      if (status == NO_ERRORS && type == COMMAND_TYPE)
+		{
+		  css_push_server_task (*conn);
+		}
+	    }
+
+	  if (status != NO_ERRORS || (!conn->stop_talk && css_check_conn (conn) != NO_ERROR))
+	    {
+	      er_log_debug (ARG_FILE_LINE, "css_reactor_task: status %d conn { status %d transaction_id %d "
+			    "db_error %d stop_talk %d stop_phase %d }\n", status, conn->status,
+			    conn->get_tran_index (), conn->db_error, conn->stop_talk, conn->stop_phase);
+	      index = std::find (m_reactor.conns.begin (), m_reactor.conns.end (), conn) - m_reactor.conns.begin ();
+	      assert (index < m_reactor.conns.size ());
+	      css_reactor_drop_conn (m_reactor, index, true);
+	    }
+	}
+
+      if (++num_loop >= CSS_REACTOR_PEER_CHECK_LOOPS)
+	{
+	  num_loop = 0;
+	}
+      css_reactor_check_conns (thread_ref, m_reactor, num_loop == 0);
+    }
+}
+#endif /* LINUX */
+
 /*
  * css_block_all_active_conn() - Before shutdown, stop all server thread
  *   return:
@@ -1181,6 +1527,13 @@ css_internal_connection_handler (CSS_CONN_ENTRY * conn)
 {
   css_insert_into_active_conn_list (conn);
 
+#if defined (LINUX)
+  if (css_reactor_add_conn (conn))
+    {
+      return NO_ERRORS;
+    }
+#endif /* LINUX */
+
   // push connection handler task
   cubthread::get_manager ()->push_task (css_Connection_worker_pool, new css_connection_task (*conn));
 
@@ -1240,6 +1593,9 @@ css_internal_request_handler (THREAD_ENTRY & thread_ref, CSS_CONN_ENTRY & conn_r
       /* 3. Call server_request() function */
       status = css_Server_request_handler (&thread_ref, eid, request, size, buffer);
 
+      /* all memory of the request is released at once */
+      db_request_heap_release (&thread_ref);
+
       /* 4. reset thread transaction id(may be NULL_TRAN_INDEX) */
       css_set_thread_info (&thread_ref, -1, 0, local_tran_index, -1);
     }
@@ -1339,6 +1695,7 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
       status = ER_FAILED;
       goto shutdown;
     }
+  css_Server_request_worker_pool->set_work_stealing (prm_get_bool_value (PRM_ID_THREAD_WORKER_STEALING));
 
   // create connection worker pool
   css_Connection_worker_pool =
@@ -1354,6 +1711,13 @@ css_init (THREAD_ENTRY * thread_p, char *server_name, int name_length, int port_
       status = ER_FAILED;
       goto shutdown;
     }
+#if defined (LINUX)
+  status = css_start_reactors ();
+  if (status != NO_ERROR)
+    {
+      goto shutdown;
+    }
+#endif /* LINUX */
 
   css_Server_connection_socket = INVALID_SOCKET;
 
@@ -1423,6 +1787,9 @@ shutdown:
   // destroy thread worker pools
   thread_get_manager ()->destroy_worker_pool (css_Server_request_worker_pool);
   thread_get_manager ()->destroy_worker_pool (css_Connection_worker_pool);
+#if defined (LINUX)
+  css_stop_reactors ();
+#endif /* LINUX */
 
   if (!HA_DISABLED ())
     {
@@ -2731,6 +3098,8 @@ css_push_server_task (CSS_CONN_ENTRY &conn_ref)
   // note: cores are partitioned by connection index. this is particularly important in order to avoid having tasks
   //       randomly pushed to cores that are full. some of those tasks may belong to threads holding locks. as a
   //       consequence, lock waiters may wait longer or even indefinitely if we are really unlucky.
+  //       with thread_worker_stealing, a task queued on a full core is also taken by the first free worker of
+  //       another core.
   //
   conn_ref.add_pending_request ();
   thread_get_manager ()->push_task_on_core (css_Server_request_worker_pool, new css_server_task (conn_ref),
@@ -2795,6 +3164,19 @@ css_server_external_task::execute (context_type &thread_ref)
   thread_ref.conn_entry = NULL;
 }
 
+void
+css_connection_down_task::execute (context_type & thread_ref)
+{
+  thread_ref.conn_entry = &m_conn;
+  thread_ref.type = TT_SERVER;
+
+  // the connection error handler expects tran_index_lock to be locked
+  pthread_mutex_lock (&thread_ref.tran_index_lock);
+  (*css_Connection_error_handler) (&thread_ref, &m_conn);
+
+  thread_ref.conn_entry = NULL;
+}
+
 void
 css_connection_task::execute (context_type & thread_ref)
 {
@@ -248,11 +248,12 @@ get_name_from_class_oid (OID * class_oid)
  *    input_class_names(in): classes list
  *    input_class_length(in): classes list length
  *    max_processed_space(in): maximum space to process for one iteration
+ *    online_flag(in): skip reclaiming addresses, which locks every class exclusively
  */
 static int
 compactdb_start (bool verbose_flag, bool delete_old_repr_flag, char *input_filename, char **input_class_names,
 		 int input_class_length, int max_processed_space, int instance_lock_timeout, int class_lock_timeout,
-		 DB_TRAN_ISOLATION tran_isolation)
+		 DB_TRAN_ISOLATION tran_isolation, bool online_flag)
 {
   int status = NO_ERROR;
   OID **class_oids = NULL;
@@ -602,15 +603,26 @@ compactdb_start (bool verbose_flag, bool delete_old_repr_flag, char *input_filen
 	}
     }
 
-  if (verbose_flag)
+  if (online_flag)
     {
-      printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_COMPACTDB, COMPACTDB_MSG_PASS2));
+      /* reclaiming addresses needs an exclusive schema lock on each class; pass 3 still frees the pages left empty */
+      if (verbose_flag)
+	{
+	  printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_COMPACTDB, COMPACTDB_MSG_PASS2_SKIPPED));
+	}
     }
-  status = do_reclaim_addresses (class_oids, num_classes, &num_classes_fully_compacted, verbose_flag,
-				 class_lock_timeout);
-  if (status != NO_ERROR)
+  else
     {
-      goto error;
+      if (verbose_flag)
+	{
+	  printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_COMPACTDB, COMPACTDB_MSG_PASS2));
+	}
+      status = do_reclaim_addresses (class_oids, num_classes, &num_classes_fully_compacted, verbose_flag,
+				     class_lock_timeout);
+      if (status != NO_ERROR)
+	{
+	  goto error;
+	}
     }
 
   if (verbose_flag)
@@ -788,7 +800,7 @@ compactdb (UTIL_FUNCTION_ARG * arg)
   int error;
   int i, status = 0;
   const char *database_name;
-  bool verbose_flag = 0, delete_old_repr_flag = 0, standby_compactdb_flag = 0;
+  bool verbose_flag = 0, delete_old_repr_flag = 0, standby_compactdb_flag = 0, online_flag = 0;
   char *input_filename = NULL;
   int maximum_processed_space = 10 * DB_PAGESIZE, pages;
   int instance_lock_timeout, class_lock_timeout;
@@ -852,6 +864,7 @@ compactdb (UTIL_FUNCTION_ARG * arg)
     }
 
   delete_old_repr_flag = utility_get_option_bool_value (arg_map, COMPACT_DELETE_OLD_REPR_S);
+  online_flag = utility_get_option_bool_value (arg_map, COMPACT_ONLINE_S);
 
   maximum_processed_space = pages * DB_PAGESIZE;
 
@@ -906,7 +919,7 @@ compactdb (UTIL_FUNCTION_ARG * arg)
 	  status =
 	    compactdb_start (verbose_flag, delete_old_repr_flag, input_filename, tables, table_size - 1,
 			     maximum_processed_space, instance_lock_timeout, class_lock_timeout,
-			     TRAN_DEFAULT_ISOLATION_LEVEL ());
+			     TRAN_DEFAULT_ISOLATION_LEVEL (), online_flag);
 
 	  if (status == ER_FAILED)
 	    {
@@ -38,6 +38,7 @@
 #include <errno.h>
 #include <sys/wait.h>
 #include <assert.h>
+#include <math.h>
 
 #if !defined(WINDOWS)
 #include <unistd.h>
@@ -119,6 +120,8 @@ static bool hb_cluster_is_received_heartbeat_from_all (void);
 static bool hb_cluster_check_valid_ping_server (void);
 
 static int hb_cluster_calc_score (void);
+static double hb_cluster_node_phi (HB_NODE_ENTRY * node, struct timeval *now);
+static bool hb_cluster_is_master_suspected (void);
 
 static int hb_set_net_header (HBP_HEADER * header, unsigned char type, bool is_req, unsigned short len,
 			      unsigned int seq, char *dest_host_name);
@@ -717,17 +720,27 @@ hb_cluster_job_heartbeat (HB_JOB_ARG * arg)
 {
   int error, rv;
 
+  bool is_master_suspected;
+
   rv = pthread_mutex_lock (&hb_Cluster->lock);
 
   if (hb_Cluster->hide_to_demote == false)
     {
       hb_cluster_request_heartbeat_to_all ();
     }
+  is_master_suspected = hb_cluster_is_master_suspected ();
 
   pthread_mutex_unlock (&hb_Cluster->lock);
   error = hb_cluster_job_queue (HB_CJOB_HEARTBEAT, NULL, prm_get_integer_value (PRM_ID_HA_HEARTBEAT_INTERVAL_IN_MSECS));
   assert (error == NO_ERROR);
 
+  if (is_master_suspected == true)
+    {
+      /* don't wait for the next score calculation to find out that the master is gone */
+      MASTER_ER_LOG_DEBUG (ARG_FILE_LINE, "master node is suspected to have failed.");
+      hb_cluster_job_set_expire_and_reorder (HB_CJOB_CALC_SCORE, HB_JOB_TIMER_IMMEDIATELY);
+    }
+
   if (arg)
     {
       free_and_init (arg);
@@ -1461,7 +1474,9 @@ hb_cluster_calc_score (void)
 	  || (!HB_IS_INITIALIZED_TIME (node->last_recv_hbtime)
 	      && HB_GET_ELAPSED_TIME (now,
 				      node->last_recv_hbtime) >
-	      prm_get_integer_value (PRM_ID_HA_CALC_SCORE_INTERVAL_IN_MSECS)))
+	      prm_get_integer_value (PRM_ID_HA_CALC_SCORE_INTERVAL_IN_MSECS))
+	  || (prm_get_float_value (PRM_ID_HA_HEARTBEAT_PHI_THRESHOLD) > 0
+	      && hb_cluster_node_phi (node, &now) > prm_get_float_value (PRM_ID_HA_HEARTBEAT_PHI_THRESHOLD)))
 	{
 	  node->heartbeat_gap = 0;
 	  node->last_recv_hbtime.tv_sec = 0;
@@ -1511,6 +1526,59 @@ hb_cluster_calc_score (void)
   return num_master;
 }
 
+/*
+ * hb_cluster_node_phi() - suspicion level that the node has failed
+ *   return: phi, or 0 if nothing is known about the heartbeats of the node
+ *
+ *   node(in):
+ *   now(in):
+ *
+ * Note: phi accrual failure detection. phi is -log10 of the probability that a heartbeat of the node is still to
+ *       come after the time elapsed since the last one. Heartbeat arrivals are taken as exponentially distributed
+ *       around their moving average, so phi grows linearly with the elapsed time and it adapts to the network:
+ *       phi 1 means a 10% chance that the node is still alive, phi 2 means 1% and so on.
+ */
+static double
+hb_cluster_node_phi (HB_NODE_ENTRY * node, struct timeval *now)
+{
+  if (node->hbtime_interval_mean <= 0 || HB_IS_INITIALIZED_TIME (node->last_recv_hbtime))
+    {
+      return 0;
+    }
+
+  return HB_GET_ELAPSED_TIME ((*now), node->last_recv_hbtime) / (node->hbtime_interval_mean * M_LN10);
+}
+
+/*
+ * hb_cluster_is_master_suspected() - check whether the master node is suspected to have failed
+ *   return: true if the phi of the master node is over ha_heartbeat_phi_threshold
+ *
+ * Note: Called every heartbeat interval, so a failed master is found out well before the next score calculation.
+ */
+static bool
+hb_cluster_is_master_suspected (void)
+{
+  HB_NODE_ENTRY *node;
+  struct timeval now;
+  float threshold = prm_get_float_value (PRM_ID_HA_HEARTBEAT_PHI_THRESHOLD);
+
+  if (threshold <= 0 || hb_Cluster->state != HB_NSTATE_SLAVE)
+    {
+      return false;
+    }
+
+  gettimeofday (&now, NULL);
+  for (node = hb_Cluster->nodes; node; node = node->next)
+    {
+      if (node->state == HB_NSTATE_MASTER && hb_cluster_node_phi (node, &now) > threshold)
+	{
+	  return true;
+	}
+    }
+
+  return false;
+}
+
 /*
  * hb_cluster_request_heartbeat_to_all() -
  *   return: none
@@ -1629,6 +1697,8 @@ hb_cluster_receive_heartbeat (char *buffer, int len, struct sockaddr_in *from, s
   HB_UI_NODE_ENTRY *ui_node;
   char error_string[LINE_MAX] = "";
   char *p;
+  struct timeval now;
+  double interval;
 
   int state = 0;		/* HB_NODE_STATE_TYPE */
   bool is_state_changed = false;
@@ -1743,7 +1813,20 @@ hb_cluster_receive_heartbeat (char *buffer, int len, struct sockaddr_in *from, s
 
 	    node->state = hb_state;
 	    node->heartbeat_gap = MAX (0, (node->heartbeat_gap - 1));
-	    gettimeofday (&node->last_recv_hbtime, NULL);
+	    gettimeofday (&now, NULL);
+	    if (!HB_IS_INITIALIZED_TIME (node->last_recv_hbtime))
+	      {
+		interval = HB_GET_ELAPSED_TIME (now, node->last_recv_hbtime);
+		if (node->hbtime_interval_mean <= 0)
+		  {
+		    node->hbtime_interval_mean = interval;
+		  }
+		else
+		  {
+		    node->hbtime_interval_mean += (interval - node->hbtime_interval_mean) / 8;
+		  }
+	      }
+	    node->last_recv_hbtime = now;
 	  }
 	else
 	  {
@@ -2023,6 +2106,7 @@ hb_add_node_to_cluster (char *host_name, unsigned short priority)
       p->heartbeat_gap = 0;
       p->last_recv_hbtime.tv_sec = 0;
       p->last_recv_hbtime.tv_usec = 0;
+      p->hbtime_interval_mean = 0;
 
       p->next = NULL;
       p->prev = NULL;
@@ -5287,6 +5371,7 @@ hb_reload_config (void)
 	  new_node->heartbeat_gap = old_node->heartbeat_gap;
 	  new_node->last_recv_hbtime.tv_sec = old_node->last_recv_hbtime.tv_sec;
 	  new_node->last_recv_hbtime.tv_usec = old_node->last_recv_hbtime.tv_usec;
+	  new_node->hbtime_interval_mean = old_node->hbtime_interval_mean;
 
 	  /* mark node wouldn't deregister */
 	  old_node->host_name[0] = '\0';
@@ -209,6 +209,7 @@ struct hb_node_entry
   short heartbeat_gap;
 
   struct timeval last_recv_hbtime;	/* last received heartbeat time */
+  double hbtime_interval_mean;	/* moving average of milli-seconds between received heartbeats */
 };
 
 /* heartbeat ping host entries */
@@ -43,6 +43,7 @@
 #include "authenticate.h"
 #include "utility.h"
 #include "load_object.h"
+#include "load_common.hpp"
 #include "log_lsa.hpp"
 #include "file_hash.h"
 #include "db.h"
@@ -163,6 +164,12 @@ static int64_t total_approximate_class_objects = 0;
 #define MSG_FORMAT 		"    %-25s  |  %10ld (%3d%% / %5d%%)"
 static FILE *unloadlog_file = NULL;
 
+/* the object file of the current class has binary rows */
+static bool obj_out_is_binary = false;
+/* buffer where a binary row is packed */
+static char *binary_row_buffer = NULL;
+static int binary_row_buffer_size = 0;
+
 
 static int get_estimated_objs (HFID * hfid, int64_t *est_objects);
 static int set_referenced_subclasses (DB_OBJECT * class_);
@@ -173,6 +180,9 @@ static bool mark_referenced_domain (SM_CLASS * class_ptr, int *num_set);
 static void gauge_alarm_handler (int sig);
 static int process_class (int cl_no);
 static int process_object (DESC_OBJ * desc_obj, OID * obj_oid, int referenced_class);
+static int process_binary_object (DESC_OBJ * desc_obj);
+static bool is_binary_domain_supported (TP_DOMAIN * domain);
+static bool is_binary_class_supported (SM_CLASS * class_ptr);
 static int process_set (DB_SET * set);
 static int process_value (DB_VALUE * value);
 static void update_hash (OID * object_oid, OID * class_oid, int *data);
@@ -362,6 +372,8 @@ extractobjects_cleanup (void)
   free_and_init (class_requested);
   free_and_init (class_referenced);
   free_and_init (class_processed);
+  free_and_init (binary_row_buffer);
+  binary_row_buffer_size = 0;
   return;
 }
 
@@ -652,6 +664,12 @@ extract_objects (const char *exec_name, const char *output_dirname, const char *
 	      MARK_CLASS_REQUESTED (i);
 	    }
 
+	  if (unload_worker_count > 1 && i % unload_worker_count != unload_worker_id)
+	    {
+	      /* another worker process unloads the class */
+	      class_requested[i / 8] &= ~(1 << i % 8);
+	    }
+
 	  if (!datafile_per_class && (!required_class_only || IS_CLASS_REQUESTED (i)))
 	    {
 	      if (text_print
@@ -869,7 +887,15 @@ extract_objects (const char *exec_name, const char *output_dirname, const char *
    * Dump the object definitions
    */
   total_approximate_class_objects = est_objects;
-  snprintf (unloadlog_filename, sizeof (unloadlog_filename) - 1, "%s_unloaddb.log", output_prefix);
+  if (unload_worker_count > 1)
+    {
+      snprintf (unloadlog_filename, sizeof (unloadlog_filename) - 1, "%s_unloaddb_%d.log", output_prefix,
+		unload_worker_id);
+    }
+  else
+    {
+      snprintf (unloadlog_filename, sizeof (unloadlog_filename) - 1, "%s_unloaddb.log", output_prefix);
+    }
   unloadlog_file = fopen (unloadlog_filename, "w+");
   if (unloadlog_file != NULL)
     {
@@ -908,6 +934,26 @@ extract_objects (const char *exec_name, const char *output_dirname, const char *
 		      status = 1;
 		      goto end;
 		    }
+
+		  obj_out_is_binary = false;
+		  if (binary_objects)
+		    {
+		      if (is_binary_class_supported (class_ptr))
+			{
+			  obj_out_is_binary = true;
+			  if (text_print (obj_out, NULL, 0, "%s\n", LDR_BINARY_OBJECTS_MAGIC) != NO_ERROR)
+			    {
+			      status = 1;
+			      goto end;
+			    }
+			}
+		      else
+			{
+			  fprintf (stdout, "warning: class %s is unloaded in text format.\n",
+				   sm_ch_name ((MOBJ) class_ptr));
+			  fflush (stdout);
+			}
+		    }
 		}
 
 	      ret_val = process_class (i);
@@ -1406,6 +1452,11 @@ process_object (DESC_OBJ * desc_obj, OID * obj_oid, int referenced_class)
   int data;
   int v = 0;
 
+  if (obj_out_is_binary)
+    {
+      return process_binary_object (desc_obj);
+    }
+
   class_ptr = desc_obj->class_;
   class_oid = ws_oid (desc_obj->classop);
   if (!datafile_per_class && referenced_class)
@@ -1456,6 +1507,160 @@ exit_on_error:
 
 }
 
+/*
+ * process_binary_object - dump one object as a row of binary object file
+ *    return: NO_ERROR, if successful, error number, if not successful.
+ *    desc_obj(in): object data
+ * Note:
+ *    The values are packed with their domains, so loaddb does not have to parse and convert them.
+ */
+static int
+process_binary_object (DESC_OBJ * desc_obj)
+{
+  int error = NO_ERROR;
+  SM_ATTRIBUTE *attribute;
+  OR_BUF buf;
+  char row_header[1 + OR_INT_SIZE];
+  int row_size = OR_INT_SIZE;	/* number of values */
+  int v = 0;
+
+  for (attribute = desc_obj->class_->ordered_attributes; attribute; attribute = attribute->order_link)
+    {
+      if (attribute->header.name_space == ID_ATTRIBUTE)
+	{
+	  row_size += or_packed_value_size (&desc_obj->values[attribute->storage_order], 0, 1, 0);
+	  ++v;
+	}
+    }
+
+  if (row_size > binary_row_buffer_size)
+    {
+      char *new_buffer = (char *) realloc (binary_row_buffer, row_size);
+      if (new_buffer == NULL)
+	{
+	  error = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, (size_t) row_size);
+	  goto exit_on_error;
+	}
+      binary_row_buffer = new_buffer;
+      binary_row_buffer_size = row_size;
+    }
+
+  or_init (&buf, binary_row_buffer, row_size);
+  CHECK_PRINT_ERROR (or_put_int (&buf, v));
+  for (attribute = desc_obj->class_->ordered_attributes; attribute; attribute = attribute->order_link)
+    {
+      if (attribute->header.name_space == ID_ATTRIBUTE)
+	{
+	  CHECK_PRINT_ERROR (or_put_value (&buf, &desc_obj->values[attribute->storage_order], 0, 1, 0));
+	}
+    }
+  assert (buf.ptr == binary_row_buffer + row_size);
+
+  row_header[0] = LDR_BINARY_ROW_MARKER;
+  OR_PUT_INT (row_header + 1, row_size);
+  CHECK_PRINT_ERROR (text_print (obj_out, row_header, sizeof (row_header), NULL));
+
+  if (row_size < obj_out->iosize)
+    {
+      CHECK_PRINT_ERROR (text_print (obj_out, binary_row_buffer, row_size, NULL));
+    }
+  else
+    {
+      /* too large for the output buffer */
+      CHECK_PRINT_ERROR (text_print_flush (obj_out));
+      if (fwrite (binary_row_buffer, 1, row_size, obj_out->fp) != (size_t) row_size)
+	{
+	  error = ER_IO_WRITE;
+	  goto exit_on_error;
+	}
+    }
+
+exit_on_end:
+
+  return error;
+
+exit_on_error:
+
+  CHECK_EXIT_ERROR (error);
+  goto exit_on_end;
+}
+
+/*
+ * is_binary_domain_supported - check if values of domain can be written in binary object file
+ *    return: true if supported
+ *    domain(in): attribute domain
+ */
+static bool
+is_binary_domain_supported (TP_DOMAIN * domain)
+{
+  for (; domain != NULL; domain = domain->next)
+    {
+      switch (TP_DOMAIN_TYPE (domain))
+	{
+	case DB_TYPE_OBJECT:
+	case DB_TYPE_OID:
+	case DB_TYPE_VOBJ:
+	case DB_TYPE_BLOB:
+	case DB_TYPE_CLOB:
+	case DB_TYPE_VARIABLE:
+	case DB_TYPE_SUB:
+	  return false;
+
+	case DB_TYPE_SET:
+	case DB_TYPE_MULTISET:
+	case DB_TYPE_SEQUENCE:
+	  if (!is_binary_domain_supported (domain->setdomain))
+	    {
+	      return false;
+	    }
+	  break;
+
+	default:
+	  break;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * is_binary_class_supported - check if class can be written in binary object file
+ *    return: true if supported
+ *    class_ptr(in): class
+ * Note:
+ *    Server loader does not load object references, and class and shared attribute values are text rows.
+ */
+static bool
+is_binary_class_supported (SM_CLASS * class_ptr)
+{
+  SM_ATTRIBUTE *attribute;
+
+  for (attribute = class_ptr->shared; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
+    {
+      if (DB_VALUE_TYPE (&attribute->default_value.value) != DB_TYPE_NULL)
+	{
+	  return false;
+	}
+    }
+  for (attribute = class_ptr->class_attributes; attribute != NULL; attribute = (SM_ATTRIBUTE *) attribute->header.next)
+    {
+      if (DB_VALUE_TYPE (&attribute->default_value.value) != DB_TYPE_NULL)
+	{
+	  return false;
+	}
+    }
+  for (attribute = class_ptr->ordered_attributes; attribute != NULL; attribute = attribute->order_link)
+    {
+      if (attribute->header.name_space == ID_ATTRIBUTE && !is_binary_domain_supported (attribute->domain))
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+
 /*
  * process_set - dump a set in loader format
  *    return: NO_ERROR, if successful, error number, if not successful.
@@ -26,7 +26,14 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <errno.h>
 #include <assert.h>
+#if !defined (WINDOWS)
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif /* !WINDOWS */
 
 #include "porting.h"
 #include "authenticate.h"
@@ -59,6 +66,10 @@ bool include_references = false;
 
 bool required_class_only = false;
 bool datafile_per_class = false;
+/* a worker process unloads the requested classes whose order modulo unload_worker_count is unload_worker_id */
+int unload_worker_id = 0;
+int unload_worker_count = 1;
+bool binary_objects = false;
 LIST_MOPS *class_table = NULL;
 DB_OBJECT **req_class_table = NULL;
 
@@ -83,6 +94,163 @@ unload_usage (const char *argv0)
   util_log_write_errid (MSGCAT_UTIL_GENERIC_INVALID_ARGUMENT);
 }
 
+/*
+ * unload_get_class_tables() - get all classes and the requested ones
+ *   return: 0 if successful, non zero if error
+ */
+static int
+unload_get_class_tables (void)
+{
+  int i;
+
+  class_table = locator_get_all_mops (sm_Root_class_mop, DB_FETCH_READ, NULL);
+  if (input_filename)
+    {
+      /* It may not be needed */
+      if (locator_decache_all_lock_instances (sm_Root_class_mop) != NO_ERROR)
+	{
+	  util_log_write_errstr ("%s\n", db_error_string (3));
+	  return 1;
+	}
+    }
+
+  if (class_table == NULL)
+    {
+      util_log_write_errstr ("%s\n", db_error_string (3));
+      return 1;
+    }
+
+  req_class_table = (DB_OBJECT **) malloc (DB_SIZEOF (void *) * class_table->num);
+  if (req_class_table == NULL)
+    {
+      util_log_write_errid (MSGCAT_UTIL_GENERIC_NO_MEM);
+      return 1;
+    }
+
+  for (i = 0; i < class_table->num; ++i)
+    {
+      req_class_table[i] = NULL;
+    }
+
+  if (get_requested_classes (input_filename, req_class_table) != 0)
+    {
+      util_log_write_errstr ("%s\n", db_error_string (3));
+      return 1;
+    }
+
+  return 0;
+}
+
+static void
+unload_free_class_tables (void)
+{
+  if (class_table)
+    {
+      locator_free_list_mops (class_table);
+      class_table = NULL;
+    }
+  if (req_class_table)
+    {
+      free_and_init (req_class_table);
+    }
+}
+
+#if !defined (WINDOWS)
+/*
+ * unload_objects_worker() - unload the objects of a share of the classes in a connection of its own
+ *   return: 0 if successful, non zero if error
+ */
+static int
+unload_objects_worker (const char *exec_name, const char *user, const char *password, const char *output_prefix)
+{
+  int status = 0;
+  int au_save;
+
+  if (db_restart_ex (exec_name, database_name, user, password, NULL, DB_CLIENT_TYPE_ADMIN_UTILITY) != NO_ERROR)
+    {
+      PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
+      return 1;
+    }
+  db_set_lock_timeout (prm_get_integer_value (PRM_ID_UNLOADDB_LOCK_TIMEOUT));
+
+  status = unload_get_class_tables ();
+  if (!status)
+    {
+      AU_SAVE_AND_ENABLE (au_save);
+      if (extract_objects (exec_name, output_dirname, output_prefix))
+	{
+	  status = 1;
+	}
+      AU_RESTORE (au_save);
+    }
+
+  if (status && db_error_code () != NO_ERROR)
+    {
+      PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
+    }
+
+  unload_free_class_tables ();
+  if (db_shutdown () != NO_ERROR)
+    {
+      status = 1;
+    }
+
+  return status;
+}
+
+/*
+ * unload_objects_in_processes() - unload the objects by worker processes, each writing the object files of its
+ *				   classes
+ *   return: 0 if successful, non zero if error
+ *
+ *   note: client is not thread safe, so the classes are split among processes having their own connection.
+ */
+static int
+unload_objects_in_processes (const char *exec_name, const char *user, const char *password, const char *output_prefix)
+{
+  pid_t *pids;
+  int i, num_started, child_status;
+  int status = 0;
+
+  pids = (pid_t *) malloc (sizeof (pid_t) * unload_worker_count);
+  if (pids == NULL)
+    {
+      util_log_write_errid (MSGCAT_UTIL_GENERIC_NO_MEM);
+      return 1;
+    }
+
+  fflush (stdout);
+  fflush (stderr);
+
+  for (num_started = 0; num_started < unload_worker_count; num_started++)
+    {
+      pids[num_started] = fork ();
+      if (pids[num_started] < 0)
+	{
+	  PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, strerror (errno));
+	  status = 1;
+	  break;
+	}
+      if (pids[num_started] == 0)
+	{
+	  unload_worker_id = num_started;
+	  _exit (unload_objects_worker (exec_name, user, password, output_prefix));
+	}
+    }
+
+  for (i = 0; i < num_started; i++)
+    {
+      if (waitpid (pids[i], &child_status, 0) < 0 || !WIFEXITED (child_status) || WEXITSTATUS (child_status) != 0)
+	{
+	  status = 1;
+	}
+    }
+
+  free (pids);
+  return status;
+}
+#endif /* !WINDOWS */
+
 /*
  * unloaddb - main function
  *    return: 0 if successful, non zero if error.
@@ -126,6 +294,8 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
   database_name = utility_get_option_string_value (arg_map, OPTION_STRING_TABLE, 0);
   user = utility_get_option_string_value (arg_map, UNLOAD_USER_S, 0);
   password = utility_get_option_string_value (arg_map, UNLOAD_PASSWORD_S, 0);
+  unload_worker_count = utility_get_option_int_value (arg_map, UNLOAD_PROCESS_COUNT_S);
+  binary_objects = utility_get_option_bool_value (arg_map, UNLOAD_BINARY_OBJECTS_S);
   if (utility_get_option_bool_value (arg_map, UNLOAD_KEEP_STORAGE_ORDER_S))
     {
       order = FOLLOW_STORAGE_ORDER;
@@ -217,42 +387,32 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
       fprintf (stdout, "warning: '-ir' option is ignored.\n");
       fflush (stdout);
     }
-
-  class_table = locator_get_all_mops (sm_Root_class_mop, DB_FETCH_READ, NULL);
-  if (input_filename)
-    {
-      /* It may not be needed */
-      if (locator_decache_all_lock_instances (sm_Root_class_mop) != NO_ERROR)
-	{
-	  util_log_write_errstr ("%s\n", db_error_string (3));
-	  status = 1;
-	  goto end;
-	}
-    }
-
-  if (class_table == NULL)
+  if (unload_worker_count < 1)
     {
-      util_log_write_errstr ("%s\n", db_error_string (3));
-      status = 1;
-      goto end;
+      unload_worker_count = 1;
     }
-
-  req_class_table = (DB_OBJECT **) malloc (DB_SIZEOF (void *) * class_table->num);
-  if (req_class_table == NULL)
+  if (unload_worker_count > 1 && !datafile_per_class)
     {
-      util_log_write_errid (MSGCAT_UTIL_GENERIC_NO_MEM);
-      status = 1;
-      goto end;
+      /* classes share one object file otherwise */
+      unload_worker_count = 1;
+      fprintf (stdout, "warning: '--%s' option is ignored without '--%s'.\n", UNLOAD_PROCESS_COUNT_L,
+	       UNLOAD_DATAFILE_PER_CLASS_L);
+      fflush (stdout);
     }
-
-  for (i = 0; i < class_table->num; ++i)
+#if defined (WINDOWS)
+  unload_worker_count = 1;
+#endif /* WINDOWS */
+  if (binary_objects && !datafile_per_class)
     {
-      req_class_table[i] = NULL;
+      /* binary rows cannot reference objects of other classes in the same file */
+      binary_objects = false;
+      fprintf (stdout, "warning: '--%s' option is ignored without '--%s'.\n", UNLOAD_BINARY_OBJECTS_L,
+	       UNLOAD_DATAFILE_PER_CLASS_L);
+      fflush (stdout);
     }
 
-  if (get_requested_classes (input_filename, req_class_table) != 0)
+  if (unload_get_class_tables () != 0)
     {
-      util_log_write_errstr ("%s\n", db_error_string (3));
       status = 1;
       goto end;
     }
@@ -332,6 +492,24 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
       unload_context.clear_schema_workspace ();
     }
 
+#if !defined (WINDOWS)
+  if (!status && (do_objects || !do_schema) && unload_worker_count > 1)
+    {
+      /* each worker process connects by itself */
+      unload_free_class_tables ();
+      error = db_shutdown ();
+      if (error != NO_ERROR)
+	{
+	  PRINT_AND_LOG_ERR_MSG ("%s: %s\n", exec_name, db_error_string (3));
+	  status = error;
+	  goto end;
+	}
+
+      status = unload_objects_in_processes (exec_name, user, password, output_prefix);
+      goto end;
+    }
+#endif /* !WINDOWS */
+
   AU_SAVE_AND_ENABLE (au_save);
   if (!status && (do_objects || !do_schema))
     {
@@ -362,14 +540,7 @@ unloaddb (UTIL_FUNCTION_ARG * arg)
     }
 
 end:
-  if (class_table)
-    {
-      locator_free_list_mops (class_table);
-    }
-  if (req_class_table)
-    {
-      free_and_init (req_class_table);
-    }
+  unload_free_class_tables ();
 
   unload_context.clear_schema_workspace ();
 
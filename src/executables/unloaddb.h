@@ -48,6 +48,9 @@ extern bool do_objects;
 extern bool ignore_err_flag;
 extern bool required_class_only;
 extern bool datafile_per_class;
+extern int unload_worker_id;
+extern int unload_worker_count;
+extern bool binary_objects;
 extern LIST_MOPS *class_table;
 extern DB_OBJECT **req_class_table;
 extern int is_req_class (DB_OBJECT * class_);
@@ -474,6 +474,7 @@ static UTIL_ARG_MAP ua_Load_Option_Map[] = {
   {LOAD_SA_MODE_S, {ARG_BOOLEAN}, {(void *) 1}},
   {LOAD_TABLE_NAME_S, {ARG_STRING}, {0}},
   {LOAD_COMPARE_STORAGE_ORDER_S, {ARG_BOOLEAN}, {0}},
+  {LOAD_DEFER_INDEX_S, {ARG_BOOLEAN}, {0}},
   {0, {0}, {0}}
 };
 
@@ -498,6 +499,7 @@ static GETOPT_LONG ua_Load_Option[] = {
   {LOAD_SA_MODE_L, 0, 0, LOAD_SA_MODE_S},
   {LOAD_TABLE_NAME_L, 1, 0, LOAD_TABLE_NAME_S},
   {LOAD_COMPARE_STORAGE_ORDER_L, 0, 0, LOAD_COMPARE_STORAGE_ORDER_S},
+  {LOAD_DEFER_INDEX_L, 0, 0, LOAD_DEFER_INDEX_S},
   {0, 0, 0, 0}
 };
 
@@ -522,6 +524,8 @@ static UTIL_ARG_MAP ua_Unload_Option_Map[] = {
   {UNLOAD_USER_S, {ARG_STRING}, {0}},
   {UNLOAD_PASSWORD_S, {ARG_STRING}, {0}},
   {UNLOAD_KEEP_STORAGE_ORDER_S, {ARG_BOOLEAN}, {0}},
+  {UNLOAD_PROCESS_COUNT_S, {ARG_INTEGER}, {(void *) 1}},
+  {UNLOAD_BINARY_OBJECTS_S, {ARG_BOOLEAN}, {0}},
   {0, {0}, {0}}
 };
 
@@ -545,6 +549,8 @@ static GETOPT_LONG ua_Unload_Option[] = {
   {UNLOAD_USER_L, 1, 0, LOAD_USER_S},
   {UNLOAD_PASSWORD_L, 1, 0, LOAD_PASSWORD_S},
   {UNLOAD_KEEP_STORAGE_ORDER_L, 0, 0, UNLOAD_KEEP_STORAGE_ORDER_S},
+  {UNLOAD_PROCESS_COUNT_L, 1, 0, UNLOAD_PROCESS_COUNT_S},
+  {UNLOAD_BINARY_OBJECTS_L, 0, 0, UNLOAD_BINARY_OBJECTS_S},
   {0, 0, 0, 0}
 };
 
@@ -559,6 +565,7 @@ static UTIL_ARG_MAP ua_Compact_Option_Map[] = {
   {COMPACT_INSTANCE_LOCK_TIMEOUT_S, {ARG_INTEGER}, {(void *) 2}},
   {COMPACT_CLASS_LOCK_TIMEOUT_S, {ARG_INTEGER}, {(void *) 10}},
   {COMPACT_STANDBY_CS_MODE_S, {ARG_BOOLEAN}, {0}},
+  {COMPACT_ONLINE_S, {ARG_BOOLEAN}, {0}},
   {0, {0}, {0}}
 };
 
@@ -572,6 +579,7 @@ static GETOPT_LONG ua_Compact_Option[] = {
   {COMPACT_INSTANCE_LOCK_TIMEOUT_L, 1, 0, COMPACT_INSTANCE_LOCK_TIMEOUT_S},
   {COMPACT_CLASS_LOCK_TIMEOUT_L, 1, 0, COMPACT_CLASS_LOCK_TIMEOUT_S},
   {COMPACT_STANDBY_CS_MODE_L, 0, 0, COMPACT_STANDBY_CS_MODE_S},
+  {COMPACT_ONLINE_L, 0, 0, COMPACT_ONLINE_S},
   {0, 0, 0, 0}
 };
 
@@ -837,6 +845,7 @@ static UTIL_ARG_MAP ua_Tde_Option_Map[] = {
   {TDE_CS_MODE_S, {ARG_BOOLEAN}, {0}},
   {TDE_CHANGE_KEY_S, {ARG_INTEGER}, {(void *) -1}},
   {TDE_DELETE_KEY_S, {ARG_INTEGER}, {(void *) -1}},
+  {TDE_ROTATE_DATA_KEY_S, {ARG_BOOLEAN}, {0}},
   {TDE_DBA_PASSWORD_S, {ARG_STRING}, {(void *) ""}},
   {0, {0}, {0}}
 };
@@ -849,6 +858,7 @@ static GETOPT_LONG ua_Tde_Option[] = {
   {TDE_CS_MODE_L, 0, 0, TDE_CS_MODE_S},
   {TDE_CHANGE_KEY_L, 1, 0, TDE_CHANGE_KEY_S},
   {TDE_DELETE_KEY_L, 1, 0, TDE_DELETE_KEY_S},
+  {TDE_ROTATE_DATA_KEY_L, 0, 0, TDE_ROTATE_DATA_KEY_S},
   {TDE_DBA_PASSWORD_L, 1, 0, TDE_DBA_PASSWORD_S},
   {0, 0, 0, 0}
 };
@@ -3654,6 +3654,7 @@ tde (UTIL_FUNCTION_ARG * arg)
   bool gen_op;
   bool show_op;
   bool print_val;
+  bool rotate_op;
   int change_op_idx;
   int delete_op_idx;
   int op_cnt = 0;
@@ -3673,6 +3674,7 @@ tde (UTIL_FUNCTION_ARG * arg)
   show_op = utility_get_option_bool_value (arg_map, TDE_SHOW_KEYS_S);
   change_op_idx = utility_get_option_int_value (arg_map, TDE_CHANGE_KEY_S);
   delete_op_idx = utility_get_option_int_value (arg_map, TDE_DELETE_KEY_S);
+  rotate_op = utility_get_option_bool_value (arg_map, TDE_ROTATE_DATA_KEY_S);
 
   print_val = utility_get_option_bool_value (arg_map, TDE_PRINT_KEY_VALUE_S);
   dba_password = utility_get_option_string_value (arg_map, KILLTRAN_DBA_PASSWORD_S, 0);
@@ -3693,6 +3695,10 @@ tde (UTIL_FUNCTION_ARG * arg)
     {
       op_cnt++;
     }
+  if (rotate_op)
+    {
+      op_cnt++;
+    }
 
   if (op_cnt != 1)
     {
@@ -3910,6 +3916,28 @@ tde (UTIL_FUNCTION_ARG * arg)
       printf ("SUCCESS: ");
       printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_TDE, TDE_MSG_MK_DELETED), delete_op_idx);
     }
+  else if (rotate_op)
+    {
+      int dk_gen = -1;
+
+      /* the pages are re-encrypted with the new data key in background */
+      if (tde_rotate_dk_on_server (&dk_gen) != NO_ERROR)
+	{
+	  PRINT_AND_LOG_ERR_MSG ("FAILURE: %s\n", db_error_string (3));
+	  db_shutdown ();
+	  goto error_exit;
+	}
+
+      if (db_commit_transaction () != NO_ERROR)
+	{
+	  PRINT_AND_LOG_ERR_MSG ("FAILURE: %s\n", db_error_string (3));
+	  db_shutdown ();
+	  goto error_exit;
+	}
+
+      printf ("SUCCESS: ");
+      printf (msgcat_message (MSGCAT_CATALOG_UTILS, MSGCAT_UTIL_SET_TDE, TDE_MSG_DK_ROTATED), dk_gen);
+    }
 
   db_shutdown ();
 
@@ -419,7 +419,8 @@ typedef enum
   COMPACTDB_MSG_RECLAIM_ERROR = 43,
   COMPACTDB_MSG_PASS3 = 44,
   COMPACTDB_MSG_HEAP_COMPACT_FAILED = 45,
-  COMPACTDB_MSG_HEAP_COMPACT_SUCCEEDED = 46
+  COMPACTDB_MSG_HEAP_COMPACT_SUCCEEDED = 46,
+  COMPACTDB_MSG_PASS2_SKIPPED = 47
 } MSGCAT_COMPACTDB_MSG;
 
 /* Message id in the set MSGCAT_UTIL_SET_UNLOADDB */
@@ -699,6 +700,7 @@ typedef enum
   TDE_MSG_MK_SET_ON_DATABASE_DELETE = 28,
   TDE_MSG_MK_DELETED = 29,
   TDE_MSG_MK_GENERATED = 30,
+  TDE_MSG_DK_ROTATED = 31,
   TDE_MSG_USAGE = 60
 } MSGCAT_TDE_MSG;
 
@@ -1270,6 +1272,8 @@ typedef struct _ha_config
 #define LOAD_TABLE_NAME_L                       "table"
 #define LOAD_COMPARE_STORAGE_ORDER_S            11820
 #define LOAD_COMPARE_STORAGE_ORDER_L            "compare-storage-order"
+#define LOAD_DEFER_INDEX_S                      11821
+#define LOAD_DEFER_INDEX_L                      "defer-index"
 
 /* unloaddb option list */
 #define UNLOAD_INPUT_CLASS_FILE_S               'i'
@@ -1310,6 +1314,10 @@ typedef struct _ha_config
 #define UNLOAD_PASSWORD_L                       "password"
 #define UNLOAD_KEEP_STORAGE_ORDER_S		11918
 #define UNLOAD_KEEP_STORAGE_ORDER_L		"keep-storage-order"
+#define UNLOAD_PROCESS_COUNT_S			11919
+#define UNLOAD_PROCESS_COUNT_L			"process-count"
+#define UNLOAD_BINARY_OBJECTS_S			11920
+#define UNLOAD_BINARY_OBJECTS_L			"binary-objects"
 
 /* compactdb option list */
 #define COMPACT_VERBOSE_S                       'v'
@@ -1330,6 +1338,8 @@ typedef struct _ha_config
 #define COMPACT_CLASS_LOCK_TIMEOUT_L		"class-lock-timeout"
 #define COMPACT_STANDBY_CS_MODE_S               12000
 #define COMPACT_STANDBY_CS_MODE_L               "standby"
+#define COMPACT_ONLINE_S                        12001
+#define COMPACT_ONLINE_L                        "online"
 
 /* sqlx option list */
 #define CSQL_SA_MODE_S                          'S'
@@ -1611,6 +1621,8 @@ typedef struct _ha_config
 #define TDE_CHANGE_KEY_L      "change-key"
 #define TDE_DELETE_KEY_S      'd'
 #define TDE_DELETE_KEY_L      "delete-key"
+#define TDE_ROTATE_DATA_KEY_S 'r'
+#define TDE_ROTATE_DATA_KEY_L "rotate-data-key"
 #define TDE_DBA_PASSWORD_S    'p'
 #define TDE_DBA_PASSWORD_L    "dba-password"
 
@@ -83,6 +83,7 @@ public class ExecuteThread extends Thread {
 	private static final int REQ_CODE_INTERNAL_JDBC = 0x08;
 	private static final int REQ_CODE_DESTROY = 0x10;
 	private static final int REQ_CODE_END = 0x20;
+	private static final int REQ_CODE_INVOKE_SP_BATCH = 0x40;
 
 	private static final int REQ_CODE_UTIL_PING = 0xDE;
 	private static final int REQ_CODE_UTIL_STATUS = 0xEE;
@@ -197,6 +198,10 @@ public class ExecuteThread extends Thread {
 					processStoredProcedure();
 					break;
 				}
+				case REQ_CODE_INVOKE_SP_BATCH: {
+					processStoredProcedureBatch();
+					break;
+				}
 				case REQ_CODE_DESTROY: {
 					destroyJDBCResources();
 					Thread.currentThread().interrupt();
@@ -283,6 +288,42 @@ public class ExecuteThread extends Thread {
 	private void processStoredProcedure () throws Exception {
 		setStatus (ExecuteThreadStatus.PARSE);
 		StoredProcedure procedure = makeStoredProcedure();
+		invokeStoredProcedure(procedure, true);
+	}
+
+	/*
+	 * The calls of a batch are all read before the first is invoked, so the socket is free for the JDBC calls of the
+	 * procedure. Each call is answered as a single call; the results are flushed with the last one, or with the first
+	 * JDBC call. An error stops the batch.
+	 */
+	private void processStoredProcedureBatch () throws Exception {
+		setStatus (ExecuteThreadStatus.PARSE);
+		int methodSigLength = input.readInt();
+		byte[] methodSig = new byte[methodSigLength];
+		input.readFully(methodSig);
+
+		int paramCount = input.readInt();
+		int rowCount = input.readInt();
+		Value[][] rows = new Value[rowCount][];
+		for (int i = 0; i < rowCount; i++) {
+			rows[i] = readArguments(input, paramCount);
+		}
+
+		int returnType = input.readInt();
+
+		int endCode = input.readInt();
+		if (endCode != REQ_CODE_INVOKE_SP_BATCH) {
+			return;
+		}
+
+		String signature = new String(methodSig);
+		for (int i = 0; i < rowCount; i++) {
+			storedProcedure = new StoredProcedure(signature, rows[i], returnType);
+			invokeStoredProcedure(storedProcedure, i == rowCount - 1);
+		}
+	}
+
+	private void invokeStoredProcedure (StoredProcedure procedure, boolean flush) throws Exception {
 		Method m = procedure.getTarget().getMethod();
 
 		if (threadName == null || threadName.equalsIgnoreCase (m.getName())) {
@@ -301,7 +342,7 @@ public class ExecuteThread extends Thread {
 		/* send results */
 		setStatus (ExecuteThreadStatus.RESULT);
 		Value resolvedResult = procedure.makeReturnValue(result);
-		sendResult(resolvedResult, procedure);
+		sendResult(resolvedResult, procedure, flush);
 
 		setStatus (ExecuteThreadStatus.IDLE);
 	}
@@ -449,7 +490,7 @@ public class ExecuteThread extends Thread {
 		return sp.makeReturnValue(obj);
 	}
 
-	private void sendResult(Value result, StoredProcedure procedure) throws IOException, ExecuteException, TypeMismatchException {
+	private void sendResult(Value result, StoredProcedure procedure, boolean flush) throws IOException, ExecuteException, TypeMismatchException {
 		Object resolvedResult = null;
 		if (result != null) {
 			resolvedResult = toDbTypeValue(procedure.getReturnType(), result);
@@ -465,7 +506,9 @@ public class ExecuteThread extends Thread {
 		output.writeInt(byteBuf.size() + 4);
 		byteBuf.writeTo(output);
 		output.writeInt(REQ_CODE_RESULT);
-		output.flush();
+		if (flush) {
+			output.flush();
+		}
 	}
 
 	public void sendCall() throws IOException {
@@ -102,6 +102,8 @@ typedef struct
   int arg_mode[MAX_ARG_COUNT];
   int arg_type[MAX_ARG_COUNT];
   int return_type;
+  int num_rows;			/* number of calls; returnval has a value for each call */
+  DB_VALUE **row_args;		/* arg_count arguments of each call, when num_rows > 1 */
 } SP_ARGS;
 
 static SOCKET sock_fds[MAX_CALL_COUNT] = { INVALID_SOCKET };
@@ -164,13 +166,16 @@ extern void *libcas_get_db_result_set (int h_id);
 extern void libcas_srv_handle_free (int h_id);
 
 static int jsp_send_call_request (const SOCKET sockfd, const SP_ARGS * sp_args);
+static int jsp_send_batch_call_request (const SOCKET sockfd, const SP_ARGS * sp_args);
 static int jsp_alloc_response (const SOCKET sockfd, char *&buffer);
 static int jsp_receive_response (const SOCKET sockfd, const SP_ARGS * sp_args);
+static int jsp_receive_batch_response (const SOCKET sockfd, const SP_ARGS * sp_args);
 static int jsp_receive_result (char *&buffer, char *&ptr, const SP_ARGS * sp_args);
 static int jsp_receive_error (char *&buffer, char *&ptr, const SP_ARGS * sp_args);
 
 static int jsp_execute_stored_procedure (const SP_ARGS * args);
-static int jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const char *name);
+static int jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const char *name, int num_rows,
+					 DB_VALUE ** row_args);
 
 extern bool ssl_client;
 
@@ -403,7 +408,7 @@ jsp_call_stored_procedure (PARSER_CONTEXT * parser, PT_NODE * statement)
   else
     {
       /* call sp */
-      error = jsp_do_call_stored_procedure (&ret_value, value_list, proc);
+      error = jsp_do_call_stored_procedure (&ret_value, value_list, proc, 1, NULL);
     }
 
   vc = statement->info.method_call.arg_list;
@@ -1951,6 +1956,78 @@ exit:
   return error_code;
 }
 
+/*
+ * jsp_send_batch_call_request - send the calls of a stored procedure for several rows of arguments in one request
+ *   return: error code
+ *   sockfd(in): socket description
+ *   sp_args(in): jsp argument list, with the arguments of each call in row_args
+ *
+ * Note: The rows are packed as the arguments of a single call; javasp answers each call as a single call.
+ */
+
+static int
+jsp_send_batch_call_request (const SOCKET sockfd, const SP_ARGS * sp_args)
+{
+  int error_code = NO_ERROR;
+  int req_code, row, i, strlen;
+  int req_size, nbytes;
+  DB_VALUE **row_args;
+  char *buffer = NULL, *ptr = NULL;
+
+  assert (sp_args->num_rows > 1 && sp_args->row_args != NULL);
+
+  req_size = (int) sizeof (int) * 5 + or_packed_string_length (sp_args->name, &strlen);
+  for (i = 0; i < sp_args->num_rows * sp_args->arg_count; i++)
+    {
+      req_size += jsp_get_value_size (sp_args->row_args[i]);
+    }
+
+  buffer = (char *) malloc (req_size);
+  if (buffer == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) req_size);
+      error_code = er_errid ();
+      goto exit;
+    }
+
+  req_code = SP_CODE_INVOKE_BATCH;
+  ptr = or_pack_int (buffer, req_code);
+
+  ptr = or_pack_string_with_length (ptr, sp_args->name, strlen);
+
+  ptr = or_pack_int (ptr, sp_args->arg_count);
+  ptr = or_pack_int (ptr, sp_args->num_rows);
+
+  for (row = 0; row < sp_args->num_rows; row++)
+    {
+      row_args = &sp_args->row_args[row * sp_args->arg_count];
+      for (i = 0; i < sp_args->arg_count; i++)
+	{
+	  ptr = or_pack_int (ptr, sp_args->arg_mode[i]);
+	  ptr = or_pack_int (ptr, sp_args->arg_type[i]);
+	  ptr = jsp_pack_argument (ptr, row_args[i]);
+	}
+    }
+
+  ptr = or_pack_int (ptr, sp_args->return_type);
+  ptr = or_pack_int (ptr, req_code);
+
+  nbytes = jsp_writen (sockfd, buffer, req_size);
+  if (nbytes != req_size)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SP_NETWORK_ERROR, 1, nbytes);
+      error_code = er_errid ();
+      goto exit;
+    }
+
+exit:
+  if (buffer)
+    {
+      free_and_init (buffer);
+    }
+  return error_code;
+}
+
 /*
  * jsp_send_destroy_request_all -
  *   return: error code
@@ -2653,6 +2730,42 @@ exit:
   return error_code;
 }
 
+/*
+ * jsp_receive_batch_response - receive the response of each call of jsp_send_batch_call_request
+ *   return: error code
+ *   sockfd(in) : socket description
+ *   sp_args(in) : stored procedure argument list, with a return value for each row
+ *
+ * Note: The calls after a failed one are not executed by javasp.
+ */
+
+static int
+jsp_receive_batch_response (const SOCKET sockfd, const SP_ARGS * sp_args)
+{
+  SP_ARGS row_sp_args = *sp_args;
+  DB_ARG_LIST *p;
+  int row, i;
+  int error_code = NO_ERROR;
+
+  for (row = 0; row < sp_args->num_rows; row++)
+    {
+      /* OUT arguments are returned to the arguments of the row */
+      row_sp_args.returnval = &sp_args->returnval[row];
+      for (p = row_sp_args.args, i = 0; p != NULL; p = p->next, i++)
+	{
+	  p->val = sp_args->row_args[row * sp_args->arg_count + i];
+	}
+
+      error_code = jsp_receive_response (sockfd, &row_sp_args);
+      if (error_code != NO_ERROR)
+	{
+	  break;
+	}
+    }
+
+  return error_code;
+}
+
 static int
 jsp_alloc_response (const SOCKET sockfd, char *&buffer)
 {
@@ -2814,7 +2927,14 @@ retry:
       goto end;
     }
 
-  error = jsp_send_call_request (sock_fd, args);
+  if (args->num_rows > 1)
+    {
+      error = jsp_send_batch_call_request (sock_fd, args);
+    }
+  else
+    {
+      error = jsp_send_call_request (sock_fd, args);
+    }
 
   if (error != NO_ERROR)
     {
@@ -2832,7 +2952,14 @@ retry:
     }
 
   ssl_client = false;
-  error = jsp_receive_response (sock_fd, args);
+  if (args->num_rows > 1)
+    {
+      error = jsp_receive_batch_response (sock_fd, args);
+    }
+  else
+    {
+      error = jsp_receive_response (sock_fd, args);
+    }
   ssl_client = mode;
 
 end:
@@ -2850,15 +2977,18 @@ end:
 /*
  * jsp_do_call_stored_procedure -
  *   return: Error Code
- *   returnval(in/out):
+ *   returnval(in/out): num_rows return values
  *   args(in/out):
  *   name(in):
+ *   num_rows(in): number of calls
+ *   row_args(in/out): arguments of each call if num_rows > 1; args is the list of the arguments of a call
  *
  * Note:
  */
 
 static int
-jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const char *name)
+jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const char *name, int num_rows,
+			      DB_VALUE ** row_args)
 {
   DB_OBJECT *mop_p, *arg_mop_p;
   SP_ARGS sp_args;
@@ -2897,6 +3027,8 @@ jsp_do_call_stored_procedure (DB_VALUE * returnval, DB_ARG_LIST * args, const ch
     }
   sp_args.returnval = returnval;
   sp_args.args = args;
+  sp_args.num_rows = num_rows;
+  sp_args.row_args = row_args;
 
   err = db_get (mop_p, SP_ATTR_ARG_COUNT, &param_cnt_val);
   if (err != NO_ERROR)
@@ -2997,6 +3129,25 @@ error:
 
 int
 jsp_call_from_server (DB_VALUE * returnval, DB_VALUE ** argarray, const char *name, const int arg_cnt)
+{
+  return jsp_call_batch_from_server (returnval, argarray, 1, name, arg_cnt);
+}
+
+/*
+ * jsp_call_batch_from_server - call a stored procedure for several rows of arguments with one request to javasp
+ *   return: Error Code
+ *   returnvals(in/out) : jsp call result of each row
+ *   argarrays(in/out): arg_cnt arguments of each row
+ *   num_rows(in): number of rows
+ *   name(in): call jsp
+ *   arg_cnt(in):
+ *
+ * Note: The calls stop at the first error.
+ */
+
+int
+jsp_call_batch_from_server (DB_VALUE * returnvals, DB_VALUE ** argarrays, const int num_rows, const char *name,
+			    const int arg_cnt)
 {
   DB_ARG_LIST *val_list = 0, *vl, **next_val_list;
   int i;
@@ -3014,18 +3165,18 @@ jsp_call_from_server (DB_VALUE * returnval, DB_VALUE ** argarray, const char *na
 	}
       (*next_val_list)->next = (DB_ARG_LIST *) 0;
 
-      if (argarray[i] == NULL)
+      if (argarrays[i] == NULL)
 	{
 	  return -1;		/* error, clean */
 	}
-      db_val = argarray[i];
+      db_val = argarrays[i];
       (*next_val_list)->label = "";	/* check out mode in select statement */
       (*next_val_list)->val = db_val;
 
       next_val_list = &(*next_val_list)->next;
     }
 
-  error = jsp_do_call_stored_procedure (returnval, val_list, name);
+  error = jsp_do_call_stored_procedure (returnvals, val_list, name, num_rows, argarrays);
 
   while (val_list)
     {
@@ -85,6 +85,8 @@ extern MOP jsp_find_stored_procedure (const char *name);
 extern void jsp_set_prepare_call (void);
 extern void jsp_unset_prepare_call (void);
 extern int jsp_call_from_server (DB_VALUE * returnval, DB_VALUE ** argarray, const char *name, const int arg_cnt);
+extern int jsp_call_batch_from_server (DB_VALUE * returnvals, DB_VALUE ** argarrays, const int num_rows,
+				       const char *name, const int arg_cnt);
 
 extern void *jsp_get_db_result_set (int h_id);
 extern void jsp_srv_handle_free (int h_id);
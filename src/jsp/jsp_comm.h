@@ -46,6 +46,7 @@ typedef enum
   SP_CODE_ERROR = 0x04,
   SP_CODE_INTERNAL_JDBC = 0x08,
   SP_CODE_DESTROY = 0x10,
+  SP_CODE_INVOKE_BATCH = 0x40,
 
   SP_CODE_UTIL_PING = 0xDE,
   SP_CODE_UTIL_STATUS = 0xEE,
@@ -25,7 +25,9 @@
 #include "dbtype_def.h"
 #include "error_code.h"
 #include "intl_support.h"
+#include "object_representation.h"
 
+#include <cstring>
 #include <fstream>
 
 ///////////////////// Function declarations /////////////////////
@@ -36,7 +38,12 @@ namespace cubload
    * A wrapper function for calling batch handler. Used by split function and does some extra checks
    */
   int handle_batch (batch_handler &handler, class_id clsid, std::string &batch_content, batch_id &batch_id,
-		    int64_t line_offset, int64_t &rows);
+		    int64_t line_offset, int64_t &rows, bool is_binary = false);
+
+  /*
+   * Splits a binary object file, positioned after the magic line, into batches of a given size
+   */
+  int split_binary (int batch_size, std::ifstream &object_file, class_handler &c_handler, batch_handler &b_handler);
 
   /*
    * Check if a given string starts with a given prefix
@@ -64,16 +71,19 @@ namespace cubload
     , m_content ()
     , m_line_offset (0)
     , m_rows (0)
+    , m_is_binary (false)
   {
     //
   }
 
-  batch::batch (batch_id id, class_id clsid, std::string &content, int64_t line_offset, int64_t rows)
+  batch::batch (batch_id id, class_id clsid, std::string &content, int64_t line_offset, int64_t rows,
+		bool is_binary)
     : m_id (id)
     , m_clsid (clsid)
     , m_content (std::move (content))
     , m_line_offset (line_offset)
     , m_rows (rows)
+    , m_is_binary (is_binary)
   {
     //
   }
@@ -84,6 +94,7 @@ namespace cubload
     , m_content (std::move (other.m_content))
     , m_line_offset (other.m_line_offset)
     , m_rows (other.m_rows)
+    , m_is_binary (other.m_is_binary)
   {
     //
   }
@@ -96,6 +107,7 @@ namespace cubload
     m_content = std::move (other.m_content);
     m_line_offset = other.m_line_offset;
     m_rows = other.m_rows;
+    m_is_binary = other.m_is_binary;
 
     return *this;
   }
@@ -130,6 +142,12 @@ namespace cubload
     return m_rows;
   }
 
+  bool
+  batch::is_binary () const
+  {
+    return m_is_binary;
+  }
+
   void
   batch::pack (cubpacking::packer &serializator) const
   {
@@ -138,6 +156,7 @@ namespace cubload
     serializator.pack_string (m_content);
     serializator.pack_bigint (m_line_offset);
     serializator.pack_bigint (m_rows);
+    serializator.pack_bool (m_is_binary);
   }
 
   void
@@ -148,6 +167,7 @@ namespace cubload
     deserializator.unpack_string (m_content);
     deserializator.unpack_bigint (m_line_offset);
     deserializator.unpack_bigint (m_rows);
+    deserializator.unpack_bool (m_is_binary);
   }
 
   size_t
@@ -158,6 +178,7 @@ namespace cubload
     size += serializator.get_packed_string_size (m_content, size);
     size += serializator.get_packed_bigint_size (size); // m_line_offset
     size += serializator.get_packed_bigint_size (size); // m_rows
+    size += serializator.get_packed_bool_size (size); // m_is_binary
 
     return size;
   }
@@ -181,6 +202,7 @@ namespace cubload
     , error_file ()
     , ignore_logging (false)
     , compare_storage_order (false)
+    , defer_index (false)
     , table_name ()
     , ignore_class_file ()
     , ignore_classes ()
@@ -645,6 +667,25 @@ namespace cubload
 
     assert (batch_size > 0);
 
+    if (object_file.peek () == LDR_BINARY_OBJECTS_MAGIC[0])
+      {
+	std::string first_line;
+	std::streampos start = object_file.tellg ();
+
+	std::getline (object_file, first_line);
+	rtrim (first_line);
+	if (first_line == LDR_BINARY_OBJECTS_MAGIC)
+	  {
+	    error_code = split_binary (batch_size, object_file, c_handler, b_handler);
+	    object_file.close ();
+	    return error_code;
+	  }
+
+	// a text object file; start over
+	object_file.clear ();
+	object_file.seekg (start);
+      }
+
     for (std::string line; std::getline (object_file, line); ++lineno)
       {
 	bool is_id_line = starts_with (line, "%id") || starts_with (line, "%ID");
@@ -750,9 +791,113 @@ namespace cubload
     return error_code;
   }
 
+  int
+  split_binary (int batch_size, std::ifstream &object_file, class_handler &c_handler, batch_handler &b_handler)
+  {
+    int error_code;
+    int64_t batch_rows = 0;
+    int lineno = 1;		// the magic line is 0
+    int batch_start_offset = lineno;
+    class_id clsid = FIRST_CLASS_ID;
+    batch_id batch_id = NULL_BATCH_ID;
+    std::string batch_buffer;
+    bool class_is_ignored = false;
+    char row_header[1 + OR_INT_SIZE];
+
+    for (int c = object_file.peek (); c != EOF; c = object_file.peek (), ++lineno)
+      {
+	if (c != LDR_BINARY_ROW_MARKER)
+	  {
+	    // a command line
+	    std::string line;
+
+	    std::getline (object_file, line);
+	    rtrim (line);
+	    if (line.empty ())
+	      {
+		continue;
+	      }
+
+	    bool is_class_line = starts_with (line, "%class") || starts_with (line, "%CLASS");
+	    if (!is_class_line && !starts_with (line, "%id") && !starts_with (line, "%ID"))
+	      {
+		// rows are not text in binary object file
+		er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_INVALID_BINARY_OBJECT_FILE, 1, lineno + 1);
+		return ER_LDR_INVALID_BINARY_OBJECT_FILE;
+	      }
+
+	    if (is_class_line)
+	      {
+		error_code = handle_batch (b_handler, clsid, batch_buffer, batch_id, batch_start_offset, batch_rows, true);
+		if (error_code != NO_ERROR)
+		  {
+		    return error_code;
+		  }
+
+		++clsid;
+	      }
+
+	    line.append ("\n"); // feed lexer with new line
+	    batch c_batch (batch_id, clsid, line, lineno, 1);
+	    error_code = c_handler (c_batch, class_is_ignored);
+	    if (error_code != NO_ERROR)
+	      {
+		return error_code;
+	      }
+
+	    batch_start_offset = lineno + 1;
+	    continue;
+	  }
+
+	if (!object_file.read (row_header, sizeof (row_header)))
+	  {
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_INVALID_BINARY_OBJECT_FILE, 1, lineno + 1);
+	    return ER_LDR_INVALID_BINARY_OBJECT_FILE;
+	  }
+
+	int row_size = OR_GET_INT (row_header + 1);
+	if (row_size < OR_INT_SIZE || (row_size & (INT_ALIGNMENT - 1)) != 0)
+	  {
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_INVALID_BINARY_OBJECT_FILE, 1, lineno + 1);
+	    return ER_LDR_INVALID_BINARY_OBJECT_FILE;
+	  }
+
+	if (class_is_ignored)
+	  {
+	    object_file.ignore (row_size);
+	    continue;
+	  }
+
+	// a batch keeps the row size and the row, read straight into its buffer
+	std::size_t row_offset = batch_buffer.size ();
+	batch_buffer.resize (row_offset + OR_INT_SIZE + row_size);
+	std::memcpy (&batch_buffer[row_offset], row_header + 1, OR_INT_SIZE);
+	if (!object_file.read (&batch_buffer[row_offset + OR_INT_SIZE], row_size))
+	  {
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_INVALID_BINARY_OBJECT_FILE, 1, lineno + 1);
+	    return ER_LDR_INVALID_BINARY_OBJECT_FILE;
+	  }
+
+	++batch_rows;
+
+	if (batch_rows == batch_size)
+	  {
+	    error_code = handle_batch (b_handler, clsid, batch_buffer, batch_id, batch_start_offset, batch_rows, true);
+	    batch_start_offset = lineno + 1;
+	    if (error_code != NO_ERROR)
+	      {
+		return error_code;
+	      }
+	  }
+      }
+
+    // collect remaining rows
+    return handle_batch (b_handler, clsid, batch_buffer, batch_id, batch_start_offset, batch_rows, true);
+  }
+
   int
   handle_batch (batch_handler &handler, class_id clsid, std::string &batch_content, batch_id &batch_id, int64_t line_offset,
-		int64_t &rows)
+		int64_t &rows, bool is_binary)
   {
     if (batch_content.empty ())
       {
@@ -760,7 +905,7 @@ namespace cubload
 	return NO_ERROR;
       }
 
-    batch batch_ (++batch_id, clsid, batch_content, line_offset, rows);
+    batch batch_ (++batch_id, clsid, batch_content, line_offset, rows, is_binary);
     int error_code = handler (batch_);
 
     // prepare to start new batch for the class
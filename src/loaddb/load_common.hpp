@@ -33,6 +33,16 @@
 #define NUM_LDR_TYPES (LDR_TYPE_MAX + 1)
 #define NUM_DB_TYPES (DB_TYPE_LAST + 1)
 
+/*
+ * Binary object file, written by unloaddb --binary-objects and loaded without the lexer and the grammar. It starts
+ * with the LDR_BINARY_OBJECTS_MAGIC line, followed by %class lines, as in text object files, and rows. Each row is
+ * LDR_BINARY_ROW_MARKER, the row size as a 4 byte network order int and the row: the number of values and the values
+ * packed by or_put_value with their domains, in the order of the %class attributes.
+ * A batch of binary rows keeps the size and the row of each row.
+ */
+#define LDR_BINARY_OBJECTS_MAGIC "%binary_objects"
+#define LDR_BINARY_ROW_MARKER '\001'
+
 namespace cubload
 {
 
@@ -48,7 +58,8 @@ namespace cubload
   {
     public:
       batch ();
-      batch (batch_id id, class_id clsid, std::string &content, int64_t line_offset, int64_t rows);
+      batch (batch_id id, class_id clsid, std::string &content, int64_t line_offset, int64_t rows,
+	     bool is_binary = false);
 
       batch (batch &&other) noexcept; // MoveConstructible
       batch &operator= (batch &&other) noexcept; // MoveAssignable
@@ -61,6 +72,7 @@ namespace cubload
       int64_t get_line_offset () const;
       const std::string &get_content () const;
       int64_t get_rows_number () const;
+      bool is_binary () const;
 
       void pack (cubpacking::packer &serializator) const override;
       void unpack (cubpacking::unpacker &deserializator) override;
@@ -72,6 +84,7 @@ namespace cubload
       std::string m_content;
       int64_t m_line_offset;
       int64_t m_rows;
+      bool m_is_binary;   // content has binary rows instead of text lines
   };
 
   using batch_handler = std::function<int64_t (const batch &)>;
@@ -109,6 +122,7 @@ namespace cubload
     std::string error_file;
     bool ignore_logging;
     bool compare_storage_order;
+    bool defer_index;		// client only; indexes of the loaded classes are built after the load
     std::string table_name;
     std::string ignore_class_file;
     std::vector<std::string> ignore_classes;
@@ -399,6 +413,15 @@ namespace cubload
        */
       virtual void process_line (constant_type *cons) = 0;
 
+      /*
+       * Process and inserts a row of a binary object file. The row contains the packed values for each column.
+       *
+       *    return: void
+       *    row(in)     : packed row
+       *    row_size(in): size of the row
+       */
+      virtual void process_binary_line (const char *row, std::size_t row_size) = 0;
+
       /*
        * Called after process_line, should implement login for cleaning up data after insert if required.
        */
@@ -412,7 +435,7 @@ namespace cubload
 ///////////////////// common global functions /////////////////////
 
   /*
-   * Splits a loaddb object file into batches of a given size.
+   * Splits a loaddb object file, text or binary, into batches of a given size.
    *
    *    return: NO_ERROR in case of success or ER_FAILED if file does not exists
    *    batch_size(in)      : batch size
@@ -36,6 +36,7 @@
 #include "authenticate.h"
 #include "ddl_log.h"
 
+#include <chrono>
 #include <fstream>
 #include <thread>
 
@@ -70,6 +71,29 @@ static int load_has_authorization (const std::string & class_name, DB_AUTH au_ty
 /* *INDENT-ON* */
 static int load_object_file (load_args * args, int *exit_status);
 static void print_er_msg ();
+/* *INDENT-OFF* */
+static int ldr_defer_class_indexes (const std::string & class_name, bool verbose);
+/* *INDENT-ON* */
+static int ldr_build_deferred_indexes (void);
+
+/* *INDENT-OFF* */
+/*
+ * index dropped from a loaded class by --defer-index, created again after the objects are loaded, when it is built
+ * in bulk from the sorted keys instead of being maintained for each row
+ */
+struct ldr_deferred_index
+{
+  std::string class_name;
+  std::string index_name;
+  DB_CONSTRAINT_TYPE type;
+  std::vector<std::string> att_names;
+  std::vector<int> asc_desc;
+  std::vector<int> attrs_prefix_length;
+  std::string comment;
+};
+
+static std::vector<ldr_deferred_index> ldr_Deferred_indexes;
+/* *INDENT-ON* */
 
 /*
  * print_log_msg - print log message
@@ -759,6 +783,10 @@ loaddb_internal (UTIL_FUNCTION_ARG * arg, int dba_mode)
 	}
 
 #if defined (SA_MODE)
+      if (args.defer_index)
+	{
+	  print_log_msg (1, "The --defer-index option is ignored in stand-alone mode.\n");
+	}
       ldr_sa_load (&args, &status, &interrupted);
 #else // !SA_MODE = CS_MODE
       ldr_server_load (&args, &status, &interrupted);
@@ -1123,6 +1151,7 @@ get_loaddb_args (UTIL_ARG_MAP * arg_map, load_args * args)
   args->error_file = error_file ? error_file : empty;
   args->ignore_logging = utility_get_option_bool_value (arg_map, LOAD_IGNORE_LOGGING_S);
   args->compare_storage_order = utility_get_option_bool_value (arg_map, LOAD_COMPARE_STORAGE_ORDER_S);
+  args->defer_index = utility_get_option_bool_value (arg_map, LOAD_DEFER_INDEX_S);
   args->table_name = table_name ? table_name : empty;
   args->ignore_class_file = ignore_class_file ? ignore_class_file : empty;
 }
@@ -1208,6 +1237,12 @@ ldr_server_load (load_args * args, int *exit_status, bool * interrupted)
 		     last_stat.rows_committed, last_stat.rows_failed);
     }
 
+  // indexes are built again even if the load failed, the schema is left as it was
+  if (!ldr_Deferred_indexes.empty () && ldr_build_deferred_indexes () != NO_ERROR)
+    {
+      *exit_status = 3;
+    }
+
   if (!load_interrupted && !status.is_load_failed () && !args->syntax_check && error_code == NO_ERROR)
     {
       // Update class statistics
@@ -1338,7 +1373,7 @@ load_object_file (load_args * args, int *exit_status)
     return error_code;
   };
 
-  class_handler c_handler = [] (const batch &batch, bool &is_ignored) -> int
+  class_handler c_handler = [&] (const batch &batch, bool &is_ignored) -> int
   {
     std::string class_name;
     int error_code = loaddb_install_class (batch, is_ignored, class_name);
@@ -1351,6 +1386,11 @@ load_object_file (load_args * args, int *exit_status)
     if (!is_ignored && !class_name.empty ())
       {
 	error_code = load_has_authorization (class_name, AU_INSERT);
+	if (error_code == NO_ERROR && args->defer_index && !args->syntax_check)
+	  {
+	    // before the batches of the class are sent
+	    error_code = ldr_defer_class_indexes (class_name, args->verbose);
+	  }
       }
 
     return error_code;
@@ -1360,3 +1400,174 @@ load_object_file (load_args * args, int *exit_status)
   // here we are sure that object_file exists since it was validated by loaddb_internal function
   return split (args->periodic_commit, args->object_file, c_handler, b_handler);
 }
+
+/*
+ * ldr_defer_class_indexes - drop the indexes of a class that are built again after the objects are loaded
+ *    return: error code
+ *    class_name(in): loaded class
+ *    verbose(in): print the deferred indexes
+ * Note:
+ *    Only the plain non-unique indexes are deferred; unique indexes and keys still check the rows while they are
+ *    loaded, and filter and function indexes are kept. Classes in a hierarchy or partitioned are not changed.
+ */
+/* *INDENT-OFF* */
+static int
+ldr_defer_class_indexes (const std::string & class_name, bool verbose)
+{
+  DB_OBJECT *class_mop;
+  SM_CLASS *class_;
+  SM_CLASS_CONSTRAINT *con;
+  std::vector<ldr_deferred_index> deferred;
+  int error_code = NO_ERROR;
+
+  class_mop = db_find_class (class_name.c_str ());
+  if (class_mop == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+
+  error_code = au_fetch_class (class_mop, &class_, AU_FETCH_READ, AU_SELECT);
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  if (class_->partition != NULL || class_->inheritance != NULL || class_->users != NULL)
+    {
+      return NO_ERROR;
+    }
+
+  for (con = class_->constraints; con != NULL; con = con->next)
+    {
+      if ((con->type != SM_CONSTRAINT_INDEX && con->type != SM_CONSTRAINT_REVERSE_INDEX)
+	  || con->filter_predicate != NULL || con->func_index_info != NULL || con->index_status != SM_NORMAL_INDEX)
+	{
+	  continue;
+	}
+
+      ldr_deferred_index index;
+      int att_count = 0;
+
+      index.class_name = class_name;
+      index.index_name = con->name;
+      index.type = db_constraint_type (con);
+      for (SM_ATTRIBUTE **attp = con->attributes; *attp != NULL; attp++, att_count++)
+	{
+	  index.att_names.push_back ((*attp)->header.name);
+	}
+      if (con->asc_desc != NULL)
+	{
+	  index.asc_desc.assign (con->asc_desc, con->asc_desc + att_count);
+	}
+      if (con->attrs_prefix_length != NULL)
+	{
+	  index.attrs_prefix_length.assign (con->attrs_prefix_length, con->attrs_prefix_length + att_count);
+	}
+      if (con->comment != NULL)
+	{
+	  index.comment = con->comment;
+	}
+
+      deferred.push_back (std::move (index));
+    }
+
+  if (deferred.empty ())
+    {
+      return NO_ERROR;
+    }
+
+  // constraints of the class are changed by the drops; use the copies
+  for (const ldr_deferred_index &index : deferred)
+    {
+      error_code = sm_drop_index (class_mop, index.index_name.c_str ());
+      if (error_code != NO_ERROR)
+	{
+	  // keep all indexes of the class, they are maintained while the rows are loaded
+	  print_log_msg (1, "Indexes of %s are not deferred: %s\n", class_name.c_str (), db_error_string (3));
+	  er_clear ();
+	  db_abort_transaction ();
+	  return NO_ERROR;
+	}
+    }
+
+  // release the class before the loader transactions lock it
+  error_code = db_commit_transaction ();
+  if (error_code != NO_ERROR)
+    {
+      return error_code;
+    }
+
+  for (ldr_deferred_index &index : deferred)
+    {
+      print_log_msg (verbose, "Index %s of %s is built after loading the objects.\n", index.index_name.c_str (),
+		     class_name.c_str ());
+      ldr_Deferred_indexes.push_back (std::move (index));
+    }
+
+  return NO_ERROR;
+}
+/* *INDENT-ON* */
+
+/*
+ * ldr_build_deferred_indexes - create the indexes dropped by ldr_defer_class_indexes
+ *    return: error code of the last index that failed
+ * Note:
+ *    Each index is built by loading its sorted keys; the sort runs in parallel on server (see ib_sort_threads).
+ */
+static int
+ldr_build_deferred_indexes (void)
+{
+  int error_code = NO_ERROR;
+
+  /* *INDENT-OFF* */
+  for (const ldr_deferred_index &index : ldr_Deferred_indexes)
+    {
+      std::vector<const char *> att_names;
+      DB_OBJECT *class_mop;
+      int error;
+
+      for (const std::string &att_name : index.att_names)
+	{
+	  att_names.push_back (att_name.c_str ());
+	}
+      att_names.push_back (NULL);
+
+      auto start = std::chrono::steady_clock::now ();
+
+      class_mop = db_find_class (index.class_name.c_str ());
+      if (class_mop == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	}
+      else
+	{
+	  error = sm_add_constraint (class_mop, index.type, index.index_name.c_str (), att_names.data (),
+				     index.asc_desc.empty () ? NULL : index.asc_desc.data (),
+				     index.attrs_prefix_length.empty () ? NULL : index.attrs_prefix_length.data (), 0,
+				     NULL, NULL, index.comment.empty () ? NULL : index.comment.c_str (), SM_NORMAL_INDEX);
+	}
+      if (error == NO_ERROR)
+	{
+	  error = db_commit_transaction ();
+	}
+
+      if (error != NO_ERROR)
+	{
+	  print_log_msg (1, "Failed to build index %s of %s: %s\n", index.index_name.c_str (),
+			 index.class_name.c_str (), db_error_string (3));
+	  db_abort_transaction ();
+	  error_code = error;
+	  continue;
+	}
+
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+      print_log_msg (1, "Index %s of %s is built in %.3f seconds.\n", index.index_name.c_str (),
+		     index.class_name.c_str (), elapsed.count ());
+    }
+  /* *INDENT-ON* */
+
+  ldr_Deferred_indexes.clear ();
+
+  return error_code;
+}
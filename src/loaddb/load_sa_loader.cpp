@@ -918,6 +918,13 @@ error_exit:
       }
   }
 
+  void
+  sa_object_loader::process_binary_line (const char *row, std::size_t row_size)
+  {
+    // binary object files are loaded by server loader only, see ldr_sa_load
+    assert (false);
+  }
+
   /*
    * sa_object_loader::finish_line - Completes an instance line.
    *    return: void
@@ -6211,6 +6218,19 @@ ldr_sa_load (load_args *args, int *status, bool *interrupted)
   int ldr_init_ret = NO_ERROR;
 
   std::ifstream object_file (args->object_file);
+  std::string first_line;
+
+  if (std::getline (object_file, first_line)
+      && first_line.compare (0, sizeof (LDR_BINARY_OBJECTS_MAGIC) - 1, LDR_BINARY_OBJECTS_MAGIC) == 0)
+    {
+      // the rows of binary object file are inserted by server loader
+      print_log_msg (1, "\nBinary object file %s can only be loaded in client/server mode.\n",
+		     args->object_file.c_str ());
+      *status = 3;
+      return;
+    }
+  object_file.clear ();
+  object_file.seekg (0);
 
   ldr_init_driver ();
 
@@ -32,6 +32,7 @@
 #include "locator_sr.h"
 #include "memory_alloc.h"
 #include "object_primitive.h"
+#include "object_representation.h"
 #include "record_descriptor.hpp"
 #include "set_object.h"
 #include "string_opfunc.h"
@@ -478,6 +479,83 @@ namespace cubload
       }
   }
 
+  void
+  server_object_loader::process_binary_line (const char *row, std::size_t row_size)
+  {
+    if (m_session.is_failed ())
+      {
+	return;
+      }
+
+    if (m_session.get_args ().syntax_check)
+      {
+	++m_rows;
+      }
+
+    OR_BUF buf;
+    int error_code = NO_ERROR;
+    std::size_t attr_size = m_class_entry->get_attributes_size ();
+
+    or_init (&buf, const_cast<char *> (row), (int) row_size);
+    std::size_t value_count = (std::size_t) or_get_int (&buf, &error_code);
+    if (error_code != NO_ERROR)
+      {
+	m_error_handler.on_syntax_failure ();
+	return;
+      }
+
+    if (value_count > 0 && attr_size == 0)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_NO_CLASS_OR_NO_ATTRIBUTE, 0);
+	m_error_handler.on_syntax_failure ();
+	return;
+      }
+    if (value_count > attr_size)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_VALUE_OVERFLOW, 1, attr_size);
+	m_error_handler.on_syntax_failure ();
+	return;
+      }
+    if (value_count < attr_size)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_MISSING_ATTRIBUTES, 2, attr_size, value_count);
+	m_error_handler.on_syntax_failure ();
+	return;
+      }
+
+    for (std::size_t attr_index = 0; attr_index < attr_size; attr_index++)
+      {
+	const attribute &attr = m_class_entry->get_attribute (attr_index);
+	db_value &db_val = get_attribute_db_value (attr_index);
+
+	// values are tagged with their domains; no token to convert
+	error_code = or_get_value (&buf, &db_val, NULL, -1, true);
+	if (error_code != NO_ERROR)
+	  {
+	    m_error_handler.on_syntax_failure ();
+	    return;
+	  }
+
+	if (DB_IS_NULL (&db_val) && attr.get_repr ().is_notnull)
+	  {
+	    char class_attr[512];
+
+	    snprintf (class_attr, 512, "%s.%s", m_class_entry->get_class_name (), attr.get_name ());
+	    er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OBJ_ATTRIBUTE_CANT_BE_NULL, 1, class_attr);
+	    m_error_handler.on_syntax_failure ();
+	    return;
+	  }
+
+	// domain of the value is coerced to the one of the attribute, if they are different
+	error_code = heap_attrinfo_set (&m_class_entry->get_class_oid (), attr.get_repr ().id, &db_val, &m_attrinfo);
+	if (error_code != NO_ERROR)
+	  {
+	    m_error_handler.on_syntax_failure ();
+	    return;
+	  }
+      }
+  }
+
   void
   server_object_loader::finish_line ()
   {
@@ -80,6 +80,7 @@ namespace cubload
 
       void start_line (int object_id) override;
       void process_line (constant_type *cons) override;
+      void process_binary_line (const char *row, std::size_t row_size) override;
       void finish_line () override;
       void flush_records () override;
 
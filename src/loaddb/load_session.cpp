@@ -25,6 +25,7 @@
 #include "load_driver.hpp"
 #include "load_server_loader.hpp"
 #include "load_worker_manager.hpp"
+#include "object_representation.h"
 #include "resource_shared_pool.hpp"
 #include "xserver_interface.h"
 
@@ -37,6 +38,8 @@ namespace cubload
 
   bool invoke_parser (driver *driver, const batch &batch_);
 
+  bool invoke_binary_loader (driver *driver, const batch &batch_);
+
 }
 
 namespace cubload
@@ -73,6 +76,11 @@ namespace cubload
 	return false;
       }
 
+    if (batch_.is_binary ())
+      {
+	return invoke_binary_loader (driver, batch_);
+      }
+
     driver->get_object_loader ().init (batch_.get_class_id ());
     driver->get_class_installer ().set_class_id (batch_.get_class_id ());
 
@@ -85,6 +93,62 @@ namespace cubload
     return parser_result == 0;
   }
 
+  bool
+  invoke_binary_loader (driver *driver, const batch &batch_)
+  {
+    object_loader &obj_loader = driver->get_object_loader ();
+    const std::string &content = batch_.get_content ();
+    std::size_t offset = 0;
+    int lineno = (int) batch_.get_line_offset ();
+    bool is_valid = true;
+
+    obj_loader.init (batch_.get_class_id ());
+    driver->get_class_installer ().set_class_id (batch_.get_class_id ());
+
+    // rows are inserted as they are unpacked; no lexer and no grammar is involved
+    while (offset < content.size ())
+      {
+	std::size_t row_size;
+
+	if (content.size () - offset < OR_INT_SIZE)
+	  {
+	    is_valid = false;
+	    break;
+	  }
+	row_size = (std::size_t) OR_GET_INT (content.data () + offset);
+	offset += OR_INT_SIZE;
+	if (content.size () - offset < row_size)
+	  {
+	    is_valid = false;
+	    break;
+	  }
+
+	// line numbers of the rows are recorded as if they were the lines of a text object file
+	driver->get_scanner ().set_lineno (++lineno);
+	driver->update_start_line ();
+
+	obj_loader.start_line (-1);
+	obj_loader.process_binary_line (content.data () + offset, row_size);
+	obj_loader.finish_line ();
+
+	offset += row_size;
+      }
+
+    if (!is_valid)
+      {
+	er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LDR_INVALID_BINARY_OBJECT_FILE, 1, lineno);
+	driver->get_error_handler ().on_failure ();
+      }
+    else
+      {
+	obj_loader.flush_records ();
+      }
+
+    obj_loader.destroy ();
+
+    return is_valid;
+  }
+
   /*
    * cubload::load_worker
    *    extends cubthread::entry_task
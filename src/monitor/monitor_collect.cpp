@@ -18,6 +18,8 @@
 
 #include "monitor_collect.hpp"
 
+#include <cassert>
+
 namespace cubmonitor
 {
   void
@@ -26,4 +28,213 @@ namespace cubmonitor
     names.push_back (std::string (prefix) + basename);
   }
 
+  //////////////////////////////////////////////////////////////////////////
+  // histogram_statistic
+  //////////////////////////////////////////////////////////////////////////
+
+  histogram_statistic::histogram_statistic (void)
+  {
+    for (std::size_t shard_index = 0; shard_index < SHARD_COUNT; shard_index++)
+      {
+	for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+	  {
+	    m_shards[shard_index].m_buckets[bucket] = 0;
+	  }
+      }
+  }
+
+  void
+  histogram_statistic::collect (const time_rep &d)
+  {
+    std::int64_t usec = std::chrono::duration_cast<std::chrono::microseconds> (d).count ();
+
+    std::size_t bucket = get_bucket (usec > 0 ? (std::uint64_t) usec : 0);
+    m_shards[get_shard_index ()].m_buckets[bucket].fetch_add (1, std::memory_order_relaxed);
+  }
+
+  std::size_t
+  histogram_statistic::get_statistics_count (void) const
+  {
+    // count, p50, p90, p99, p99.9 and max
+    return 6;
+  }
+
+  void
+  histogram_statistic::fetch (statistic_value *destination, fetch_mode mode /* = FETCH_GLOBAL */) const
+  {
+    if (mode == FETCH_TRANSACTION_SHEET)
+      {
+	// no transaction sheet
+	return;
+      }
+
+    amount_rep buckets[BUCKET_COUNT];
+    amount_rep count = 0;
+
+    merge_buckets (buckets);
+    for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+      {
+	count += buckets[bucket];
+      }
+
+    destination[0] = statistic_value_cast (count);
+    destination[1] = get_percentile_usec (buckets, count, 50.0);
+    destination[2] = get_percentile_usec (buckets, count, 90.0);
+    destination[3] = get_percentile_usec (buckets, count, 99.0);
+    destination[4] = get_percentile_usec (buckets, count, 99.9);
+    destination[5] = get_percentile_usec (buckets, count, 100.0);
+  }
+
+  amount_rep
+  histogram_statistic::get_count (fetch_mode mode /* = FETCH_GLOBAL */) const
+  {
+    amount_rep count = 0;
+
+    if (mode == FETCH_TRANSACTION_SHEET)
+      {
+	return 0;
+      }
+
+    for (std::size_t shard_index = 0; shard_index < SHARD_COUNT; shard_index++)
+      {
+	for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+	  {
+	    count += m_shards[shard_index].m_buckets[bucket].load (std::memory_order_relaxed);
+	  }
+      }
+    return count;
+  }
+
+  time_rep
+  histogram_statistic::get_percentile (double percent, fetch_mode mode /* = FETCH_GLOBAL */) const
+  {
+    amount_rep buckets[BUCKET_COUNT];
+    amount_rep count = 0;
+
+    if (mode == FETCH_TRANSACTION_SHEET)
+      {
+	return time_rep ();
+      }
+
+    merge_buckets (buckets);
+    for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+      {
+	count += buckets[bucket];
+      }
+    return time_rep_cast (get_percentile_usec (buckets, count, percent));
+  }
+
+  void
+  histogram_statistic::register_to_monitor (monitor &mon, const char *basename) const
+  {
+    const char *count_prefix = "Num_";
+    const char *p50_prefix = "P50_time_";
+    const char *p90_prefix = "P90_time_";
+    const char *p99_prefix = "P99_time_";
+    const char *p999_prefix = "P99_9_time_";
+    const char *max_prefix = "Max_time_";
+    std::vector<std::string> names;
+    build_name_vector (names, basename, count_prefix, p50_prefix, p90_prefix, p99_prefix, p999_prefix, max_prefix);
+
+    assert (get_statistics_count () == names.size ());
+
+    auto fetch_func = [&] (statistic_value * destination, fetch_mode mode)
+    {
+      this->fetch (destination, mode);
+    };
+    mon.register_statistics (get_statistics_count (), fetch_func, names);
+  }
+
+  std::size_t
+  histogram_statistic::get_bucket (std::uint64_t usec)
+  {
+    if (usec < SUB_BUCKET_COUNT)
+      {
+	return (std::size_t) usec;
+      }
+
+    // split usec in its SUB_BUCKET_BITS + 1 most significant bits and a shift
+    std::size_t shift = 0;
+    while ((usec >> shift) >= (2 * SUB_BUCKET_COUNT))
+      {
+	shift++;
+      }
+    if (shift >= RANGE_COUNT)
+      {
+	return BUCKET_COUNT - 1;
+      }
+
+    std::size_t top = (std::size_t) (usec >> shift);
+    assert (top >= SUB_BUCKET_COUNT && top < 2 * SUB_BUCKET_COUNT);
+    return SUB_BUCKET_COUNT + shift * SUB_BUCKET_COUNT + (top - SUB_BUCKET_COUNT);
+  }
+
+  std::uint64_t
+  histogram_statistic::get_bucket_upper_bound (std::size_t bucket)
+  {
+    if (bucket < SUB_BUCKET_COUNT)
+      {
+	return bucket;
+      }
+
+    std::size_t shift = (bucket - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+    std::uint64_t top = SUB_BUCKET_COUNT + (bucket - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+    return ((top + 1) << shift) - 1;
+  }
+
+  std::size_t
+  histogram_statistic::get_shard_index (void)
+  {
+    static std::atomic<std::size_t> next_shard_index (0);
+    static thread_local std::size_t shard_index = next_shard_index.fetch_add (1) % SHARD_COUNT;
+
+    return shard_index;
+  }
+
+  void
+  histogram_statistic::merge_buckets (amount_rep *buckets) const
+  {
+    for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+      {
+	buckets[bucket] = 0;
+	for (std::size_t shard_index = 0; shard_index < SHARD_COUNT; shard_index++)
+	  {
+	    buckets[bucket] += m_shards[shard_index].m_buckets[bucket].load (std::memory_order_relaxed);
+	  }
+      }
+  }
+
+  std::uint64_t
+  histogram_statistic::get_percentile_usec (const amount_rep *buckets, amount_rep count, double percent)
+  {
+    if (count == 0)
+      {
+	return 0;
+      }
+
+    // rank of the event at percent, in 1..count
+    amount_rep rank = (amount_rep) (percent / 100.0 * (double) count + 0.5);
+    if (rank < 1)
+      {
+	rank = 1;
+      }
+    if (rank > count)
+      {
+	rank = count;
+      }
+
+    amount_rep seen = 0;
+    for (std::size_t bucket = 0; bucket < BUCKET_COUNT; bucket++)
+      {
+	seen += buckets[bucket];
+	if (seen >= rank)
+	  {
+	    return get_bucket_upper_bound (bucket);
+	  }
+      }
+
+    assert (false);
+    return get_bucket_upper_bound (BUCKET_COUNT - 1);
+  }
+
 }  // namespace cubmonitor
@@ -229,6 +229,60 @@ namespace cubmonitor
   template class counter_timer_max_statistic<transaction_statistic<amount_accumulator_atomic_statistic>,
       transaction_statistic<time_accumulator_atomic_statistic>, transaction_statistic<time_max_atomic_statistic>>;
 
+  //////////////////////////////////////////////////////////////////////////
+  // Histogram statistic - distribution of event durations, to get percentiles
+  //
+  // durations are counted in microseconds in log-linear buckets: the first SUB_BUCKET_COUNT buckets count one
+  // microsecond each, then every power of two range is split into SUB_BUCKET_COUNT buckets. a percentile is the upper
+  // bound of its bucket, which is at most 1 / SUB_BUCKET_COUNT more than the actual duration.
+  //
+  // buckets are atomic counters kept in SHARD_COUNT shards; each thread collects to one shard, so that concurrent
+  // threads do not share cache lines. shards are merged on fetch.
+  //
+  // there are no transaction sheets.
+  //////////////////////////////////////////////////////////////////////////
+  class histogram_statistic
+  {
+    public:
+      histogram_statistic (void);
+      histogram_statistic (const histogram_statistic &other) = delete;
+
+      void collect (const time_rep &d);             // count one event of duration d
+
+      // fetch interface - count and percentiles
+      std::size_t get_statistics_count (void) const;
+      void fetch (statistic_value *destination, fetch_mode mode = FETCH_GLOBAL) const;
+
+      // getters
+      amount_rep get_count (fetch_mode mode = FETCH_GLOBAL) const;
+      time_rep get_percentile (double percent, fetch_mode mode = FETCH_GLOBAL) const;
+
+      // register statistic to monitor
+      // count, 50th, 90th, 99th and 99.9th percentiles and max duration are registered
+      void register_to_monitor (monitor &mon, const char *basename) const;
+
+    private:
+      static const std::size_t SUB_BUCKET_BITS = 4;
+      static const std::size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+      static const std::size_t RANGE_COUNT = 36;     // up to 2^40 microseconds, longer durations go to last bucket
+      static const std::size_t BUCKET_COUNT = SUB_BUCKET_COUNT * (RANGE_COUNT + 1);
+      static const std::size_t SHARD_COUNT = 8;
+
+      struct alignas (64) shard
+      {
+	std::atomic<amount_rep> m_buckets[BUCKET_COUNT];
+      };
+
+      static std::size_t get_bucket (std::uint64_t usec);
+      static std::uint64_t get_bucket_upper_bound (std::size_t bucket);
+      static std::size_t get_shard_index (void);
+
+      void merge_buckets (amount_rep *buckets) const;
+      static std::uint64_t get_percentile_usec (const amount_rep *buckets, amount_rep count, double percent);
+
+      shard m_shards[SHARD_COUNT];
+  };
+
   //////////////////////////////////////////////////////////////////////////
   // template and inline implementation
   //////////////////////////////////////////////////////////////////////////
@@ -68,6 +68,7 @@
 #include "optimizer.h"
 #include "network_interface_cl.h"
 #include "printer.hpp"
+#include "transaction_cl.h"
 
 #if defined (SUPPRESS_STRLEN_WARNING)
 #define strlen(s1)  ((int) strlen(s1))
@@ -418,6 +419,18 @@ static int Au_cache_increment = 4;
  */
 static int Au_cache_index = -1;
 
+/*
+ * Au_cache_version
+ *
+ * The authorization version of the server that the caches are valid for,
+ * or 0 if they may not be valid after the current transaction.
+ * The server changes the version whenever a transaction that changed
+ * users, groups or grants commits. The caches are kept over the
+ * transactions that end with the same version as the previous one, instead
+ * of being computed again for every transaction.
+ */
+static unsigned int Au_cache_version = 0;
+
 static const char *auth_type_name[] = {
   "select", "insert", "update", "delete", "alter", "index", "execute"
 };
@@ -1001,9 +1014,9 @@ reset_cache_for_user_and_class (SM_CLASS * sm_class)
 }
 
 /*
- * au_reset_authorization_caches - This is called by ws_clear_all_hints()
- *                                 and ws_abort_mops() on transaction
- *                                 boundaries.
+ * au_reset_authorization_caches - This is called by ws_abort_mops() and
+ *                                 au_validate_authorization_caches() on
+ *                                 transaction boundaries.
  *   return: none
  *
  * Note: We reset all the authorization caches at this point.
@@ -1011,8 +1024,6 @@ reset_cache_for_user_and_class (SM_CLASS * sm_class)
  *       Normally this is done when the authorization for this
  *       class changes in some way.  The next time the cache is used, it
  *       will force the recomputation of the authorization bits.
- *       We should try to be smarter and flush the caches only when we know
- *       that the authorization catalogs have changed in some way.
  */
 
 void
@@ -1021,6 +1032,8 @@ au_reset_authorization_caches (void)
   AU_CLASS_CACHE *c;
   int i;
 
+  Au_cache_version = 0;
+
   for (c = Au_class_caches; c != NULL; c = c->next)
     {
       for (i = 0; i < Au_cache_depth; i++)
@@ -1030,6 +1043,35 @@ au_reset_authorization_caches (void)
     }
 }
 
+/*
+ * au_validate_authorization_caches - This is called by ws_clear_all_hints()
+ *                                    when a transaction is committed.
+ *   return: none
+ *
+ * Note: The caches are reset unless the server reported the same
+ *       authorization version at the end of this transaction and of the
+ *       previous one. No change of users, groups or grants was committed
+ *       in between then, and the cached bits are still right.
+ *       If the version is changed at the same time the next transaction
+ *       starts, that transaction may still use the bits computed before
+ *       the change, like a transaction whose caches were computed before
+ *       the change.
+ */
+void
+au_validate_authorization_caches (void)
+{
+  unsigned int version = tm_Tran_authorization_version;
+
+  tm_Tran_authorization_version = 0;
+
+  if (version == 0 || version != Au_cache_version)
+    {
+      au_reset_authorization_caches ();
+    }
+
+  Au_cache_version = version;
+}
+
 /*
  * remove_user_cache_reference - This is called when a user object is deleted.
  *   return: none
@@ -1069,6 +1111,7 @@ init_caches (void)
   Au_cache_max = 0;
   Au_cache_increment = 4;
   Au_cache_index = -1;
+  Au_cache_version = 0;
 }
 
 /*
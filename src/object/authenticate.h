@@ -212,6 +212,7 @@ extern int au_check_authorization (MOP op, DB_AUTH auth);
 /* class cache support */
 extern void au_free_authorization_cache (void *cache);
 extern void au_reset_authorization_caches (void);
+extern void au_validate_authorization_caches (void);
 
 /* misc utilities */
 extern int au_change_owner (MOP classmop, MOP owner);
@@ -2198,6 +2198,98 @@ pr_clone_value (const DB_VALUE * src, DB_VALUE * dest)
   return NO_ERROR;
 }
 
+/*
+ * pr_value_owns_contents - check that a value container owns everything it references, which means it can be moved
+ * by copying the container.
+ *    return: true if value owns its contents
+ *    value(in): value
+ */
+static bool
+pr_value_owns_contents (const DB_VALUE * value)
+{
+  if (DB_IS_NULL (value))
+    {
+      return true;
+    }
+
+  switch (DB_VALUE_DOMAIN_TYPE (value))
+    {
+    case DB_TYPE_VARCHAR:
+    case DB_TYPE_VARNCHAR:
+      if (value->data.ch.medium.compressed_buf != NULL && value->data.ch.info.compressed_need_clear == 0)
+	{
+	  /* peeked compressed string */
+	  return false;
+	}
+      /* fall through */
+    case DB_TYPE_CHAR:
+    case DB_TYPE_NCHAR:
+    case DB_TYPE_BIT:
+    case DB_TYPE_VARBIT:
+    case DB_TYPE_MIDXKEY:
+    case DB_TYPE_ENUMERATION:
+    case DB_TYPE_JSON:
+    case DB_TYPE_BLOB:
+    case DB_TYPE_CLOB:
+      return value->need_clear;
+
+    default:
+      /* sets hold a reference of their own; everything else is in the container */
+      return true;
+    }
+}
+
+/*
+ * pr_move_value - move the contents of one value container to another.
+ *    return: NO_ERROR if successful, error code otherwise
+ *    src(in/out): source value; it is cleared
+ *    dest(out): destination value; its previous contents are not freed
+ * Note:
+ *    When src owns its contents, the container is copied and src gives up the ownership; nothing is allocated or
+ *    freed. This replaces pr_clone_value followed by pr_clear_value of the source. When src peeks a buffer it does
+ *    not own, it is cloned and cleared.
+ */
+int
+pr_move_value (DB_VALUE * src, DB_VALUE * dest)
+{
+  int error = NO_ERROR;
+
+  assert (dest != NULL);
+
+  if (src == NULL)
+    {
+      db_make_null (dest);
+      return NO_ERROR;
+    }
+  if (src == dest)
+    {
+      return NO_ERROR;
+    }
+
+  if (!pr_value_owns_contents (src))
+    {
+      error = pr_clone_value (src, dest);
+      (void) pr_clear_value (src);
+      return error;
+    }
+
+  *dest = *src;
+
+  /* src no longer owns anything; pr_clear_value only resets it */
+  src->need_clear = false;
+  if (QSTR_IS_ANY_CHAR_OR_BIT (DB_VALUE_DOMAIN_TYPE (src)))
+    {
+      src->data.ch.info.compressed_need_clear = 0;
+    }
+  else if (pr_is_set_type (DB_VALUE_DOMAIN_TYPE (src)))
+    {
+      src->data.set = NULL;
+    }
+  (void) pr_clear_value (src);
+
+  return NO_ERROR;
+}
+
 /*
  * pr_copy_value - This creates a new internal value container with a copy
  * of the contents of the source container.
@@ -292,6 +292,7 @@ extern int pr_value_mem_size (const DB_VALUE * value);
 extern DB_VALUE *pr_make_value (void);
 extern DB_VALUE *pr_copy_value (DB_VALUE * var);
 extern int pr_clone_value (const DB_VALUE * src, DB_VALUE * dest);
+extern int pr_move_value (DB_VALUE * src, DB_VALUE * dest);
 extern int pr_clear_value (DB_VALUE * var);
 /* *INDENT-OFF* */
 void pr_clear_value_vector (std::vector<DB_VALUE> &value_vector);
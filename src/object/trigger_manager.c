@@ -85,6 +85,11 @@
 /* Should have something in ER for this */
 #define MAX_ERROR_STRING 2048
 
+/*
+ * Memory the executions of a compiled trigger activity may leave in its parser before the activity is compiled again.
+ */
+#define TR_MAX_PARSER_GROWTH (1024 * 1024)
+
 /*
  * IMPORTANT, while evaluating a trigger condition/action, we
  * set the effective user to the owner of the trigger.   This
@@ -209,6 +214,7 @@ static int object_to_trigger (DB_OBJECT * object, TR_TRIGGER * trigger);
 static void get_reference_names (TR_TRIGGER * trigger, TR_ACTIVITY * activity, const char **curname,
 				 const char **tempname);
 static int compile_trigger_activity (TR_TRIGGER * trigger, TR_ACTIVITY * activity, int with_evaluate);
+static void check_activity_parser (TR_ACTIVITY * activity);
 static int validate_trigger (TR_TRIGGER * trigger);
 
 static int register_user_trigger (DB_OBJECT * object);
@@ -342,6 +348,7 @@ make_activity (void)
   act->parser = NULL;
   act->statement = NULL;
   act->exec_cnt = 0;
+  act->compiled_size = 0;
 
   return act;
 }
@@ -1726,6 +1733,11 @@ compile_trigger_activity (TR_TRIGGER * trigger, TR_ACTIVITY * activity, int with
 	    }
 	}
 
+      if (activity->parser != NULL)
+	{
+	  activity->compiled_size = parser_get_memory_size ((PARSER_CONTEXT *) activity->parser);
+	}
+
       /* free the computed string */
       if (with_evaluate)
 	{
@@ -1736,6 +1748,40 @@ compile_trigger_activity (TR_TRIGGER * trigger, TR_ACTIVITY * activity, int with
   return error;
 }
 
+/*
+ * check_activity_parser() - This frees the parser of a compiled trigger activity if its executions left too much
+ *                           memory in it, the activity is compiled again when executed next.
+ *    return: none
+ *    activity(in): compiled activity
+ *
+ * Note:
+ *    The memory is checked every PRM_ID_RESET_TR_PARSER executions of the activity. The compiled statement
+ *    is kept as long as the executions reuse the memory of the parser, a simple condition or action is never
+ *    compiled again.
+ */
+static void
+check_activity_parser (TR_ACTIVITY * activity)
+{
+  if (tr_Current_depth > 1 || prm_get_integer_value (PRM_ID_RESET_TR_PARSER) <= 0)
+    {
+      return;
+    }
+  if (++activity->exec_cnt <= prm_get_integer_value (PRM_ID_RESET_TR_PARSER))
+    {
+      return;
+    }
+  activity->exec_cnt = 0;
+
+  if (activity->parser != NULL
+      && (parser_get_memory_size ((PARSER_CONTEXT *) activity->parser) - activity->compiled_size
+	  > TR_MAX_PARSER_GROWTH))
+    {
+      parser_free_parser ((PARSER_CONTEXT *) activity->parser);
+      activity->parser = NULL;
+      activity->statement = NULL;
+    }
+}
+
 /* TRIGGER STRUCTURE & OBJECT MAP */
 
 
@@ -4657,16 +4703,7 @@ eval_condition (TR_TRIGGER * trigger, DB_OBJECT * current, DB_OBJECT * temp, boo
   else
     {
       /* should have been done by now */
-      if (tr_Current_depth <= 1 && ++act->exec_cnt > prm_get_integer_value (PRM_ID_RESET_TR_PARSER)
-	  && prm_get_integer_value (PRM_ID_RESET_TR_PARSER) > 0)
-	{
-	  if (act->parser != NULL)
-	    {
-	      parser_free_parser ((PARSER_CONTEXT *) act->parser);
-	      act->parser = NULL;
-	    }
-	  act->exec_cnt = 0;
-	}
+      check_activity_parser (act);
 
       if (act->parser == NULL)
 	{
@@ -4860,16 +4897,7 @@ eval_action (TR_TRIGGER * trigger, DB_OBJECT * current, DB_OBJECT * temp, bool *
 
 	case TR_ACT_EXPRESSION:
 	compile_stmt_again:
-	  if (tr_Current_depth <= 1 && ++act->exec_cnt > prm_get_integer_value (PRM_ID_RESET_TR_PARSER)
-	      && prm_get_integer_value (PRM_ID_RESET_TR_PARSER) > 0)
-	    {
-	      if (act->parser != NULL)
-		{
-		  parser_free_parser ((PARSER_CONTEXT *) act->parser);
-		  act->parser = NULL;
-		}
-	      act->exec_cnt = 0;
-	    }
+	  check_activity_parser (act);
 	  if (act->parser == NULL)
 	    {
 	      error = compile_trigger_activity (trigger, act, 0);
@@ -135,6 +135,7 @@ struct tr_activity
   void *parser;			/* parser for statement */
   void *statement;		/* PT_NODE* of statement */
   int exec_cnt;			/* number of executions */
+  size_t compiled_size;		/* parser memory once the statement was compiled */
 };
 
 /*
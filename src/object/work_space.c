@@ -85,6 +85,16 @@ WS_MOP_TABLE_ENTRY *ws_Mop_table = NULL;
 
 unsigned int ws_Mop_table_size = 0;
 
+/*
+ * ws_Mop_table_count
+ *    Number of MOPs in the OID to MOP hash table. The table is grown when
+ *    the hash lists get too long on average.
+ */
+
+static unsigned int ws_Mop_table_count = 0;
+
+#define WS_MOP_TABLE_MAX_LOAD 2
+
 /*
  * ws_Resident_classes
  *    This is a global list of resident class objects.
@@ -182,6 +192,8 @@ static int ws_describe_mop (MOP mop, void *args);
 static int ws_check_hash_link (int slot);
 static void ws_insert_mop_on_hash_link (MOP mop, int slot);
 static void ws_insert_mop_on_hash_link_with_position (MOP mop, int slot, MOP prev);
+static unsigned int ws_mop_table_slot (MOP mop, unsigned int table_size);
+static void ws_grow_mop_table (void);
 
 #if !defined (NDEBUG)
 static void ws_examine_no_mop_has_cached_lock (void);
@@ -418,6 +430,8 @@ ws_insert_mop_on_hash_link (MOP mop, int slot)
   MOP prev = NULL;
   int c;
 
+  ws_Mop_table_count++;
+
   /* to find the appropriate position */
   p = ws_Mop_table[slot].tail;
   if (p)
@@ -516,6 +530,8 @@ ws_insert_mop_on_hash_link (MOP mop, int slot)
 static void
 ws_insert_mop_on_hash_link_with_position (MOP mop, int slot, MOP prev)
 {
+  ws_Mop_table_count++;
+
   if (prev == NULL)
     {
       if (ws_Mop_table[slot].tail == NULL)
@@ -538,6 +554,111 @@ ws_insert_mop_on_hash_link_with_position (MOP mop, int slot, MOP prev)
     }
 }
 
+/*
+ * ws_mop_table_slot () - Get the hash slot of a mop in a table of the given size.
+ *
+ * return	   : hash slot.
+ * mop (in)	   : mop in hash table.
+ * table_size (in) : hash table size.
+ */
+static unsigned int
+ws_mop_table_slot (MOP mop, unsigned int table_size)
+{
+  unsigned int slot;
+
+  if (mop->is_vid)
+    {
+      /* virtual mops are hashed by their keys, see ws_vmop () */
+      return (WS_VID_INFO (mop) != NULL) ? mht_valhash (&WS_VID_INFO (mop)->keys, table_size) : 0;
+    }
+
+  slot = OID_PSEUDO_KEY (WS_OID (mop));
+  if (slot >= table_size)
+    {
+      slot = slot % table_size;
+    }
+  return slot;
+}
+
+/*
+ * ws_grow_mop_table () - Double the size of the OID to MOP hash table when its hash lists get too long.
+ *
+ * return : void.
+ *
+ * NOTE: Must be called only when nobody is looking at a hash list; new mops are added here before their slot is
+ *	 computed. If memory cannot be allocated, the table keeps its size.
+ */
+static void
+ws_grow_mop_table (void)
+{
+  WS_MOP_TABLE_ENTRY *new_table;
+  unsigned int new_size;
+  unsigned int slot, new_slot;
+  MOP mop, next, p, prev;
+
+  if (ws_Mop_table_count <= ws_Mop_table_size * WS_MOP_TABLE_MAX_LOAD || ws_Mop_table_size > UINT_MAX / 4)
+    {
+      return;
+    }
+
+  new_size = ws_Mop_table_size * 2;
+  new_table = (WS_MOP_TABLE_ENTRY *) malloc (sizeof (WS_MOP_TABLE_ENTRY) * new_size);
+  if (new_table == NULL)
+    {
+      /* not critical; keep longer lists */
+      return;
+    }
+  for (new_slot = 0; new_slot < new_size; new_slot++)
+    {
+      new_table[new_slot].head = NULL;
+      new_table[new_slot].tail = NULL;
+    }
+
+  for (slot = 0; slot < ws_Mop_table_size; slot++)
+    {
+      for (mop = ws_Mop_table[slot].head; mop != NULL; mop = next)
+	{
+	  next = mop->hash_link;
+	  new_slot = ws_mop_table_slot (mop, new_size);
+
+	  /* keep lists ordered by OID. mops come in order from the old list, so they are usually appended; mops with
+	   * same OID keep their order. */
+	  p = new_table[new_slot].tail;
+	  if (p == NULL || oid_compare (WS_OID (mop), WS_OID (p)) >= 0)
+	    {
+	      prev = p;
+	    }
+	  else
+	    {
+	      for (prev = NULL, p = new_table[new_slot].head; p != NULL && oid_compare (WS_OID (mop), WS_OID (p)) >= 0;
+		   prev = p, p = p->hash_link)
+		{
+		  ;
+		}
+	    }
+
+	  if (prev == NULL)
+	    {
+	      mop->hash_link = new_table[new_slot].head;
+	      new_table[new_slot].head = mop;
+	    }
+	  else
+	    {
+	      mop->hash_link = prev->hash_link;
+	      prev->hash_link = mop;
+	    }
+	  if (mop->hash_link == NULL)
+	    {
+	      new_table[new_slot].tail = mop;
+	    }
+	}
+    }
+
+  free (ws_Mop_table);
+  ws_Mop_table = new_table;
+  ws_Mop_table_size = new_size;
+}
+
 /*
  * ws_mop_if_exists () - Get object mop if it exists in mop table.
  *
@@ -623,6 +744,9 @@ ws_mop (const OID * oid, MOP class_mop)
       return NULL;
     }
 
+  /* a new mop may be added */
+  ws_grow_mop_table ();
+
   /* look for existing entry */
   slot = OID_PSEUDO_KEY (oid);
   if (slot >= ws_Mop_table_size)
@@ -819,6 +943,9 @@ ws_vmop (MOP class_mop, int flags, DB_VALUE * keys)
       break;
     }
 
+  /* a new mop may be added */
+  ws_grow_mop_table ();
+
   slot = mht_valhash (keys, ws_Mop_table_size);
   if (!(flags & VID_NEW))
     {
@@ -1009,6 +1136,7 @@ ws_rehash_vmop (MOP mop, MOBJ classobj, DB_VALUE * newkey)
       /* I was the tail of the list */
       ws_Mop_table[slot].tail = prev;
     }
+  ws_Mop_table_count--;
 
   assert (ws_check_hash_link (slot) == NO_ERROR);
 
@@ -1047,6 +1175,8 @@ ws_new_mop (OID * oid, MOP class_mop)
       return NULL;
     }
 
+  ws_grow_mop_table ();
+
   slot = OID_PSEUDO_KEY (oid);
   if (slot >= ws_Mop_table_size)
     {
@@ -1190,6 +1320,7 @@ ws_update_oid (MOP mop, OID * newoid)
       /* I was the tail of the list */
       ws_Mop_table[slot].tail = prev;
     }
+  ws_Mop_table_count--;
 
   assert (ws_check_hash_link (slot) == NO_ERROR);
 
@@ -1484,6 +1615,7 @@ ws_cull_mops (void)
 		  /* I was the tail of the list */
 		  ws_Mop_table[slot].tail = prev;
 		}
+	      ws_Mop_table_count--;
 
 	      assert (ws_check_hash_link (slot) == NO_ERROR);
 
@@ -2362,6 +2494,7 @@ ws_init (void)
       ws_Mop_table[i].head = NULL;
       ws_Mop_table[i].tail = NULL;
     }
+  ws_Mop_table_count = 0;
 
   /* create the internal Null object mop */
   Null_object = ws_make_mop (NULL);
@@ -2479,6 +2612,7 @@ ws_final (void)
   /* clean up misc globals */
   ws_Mop_table = NULL;
   ws_Mop_table_size = 0;
+  ws_Mop_table_count = 0;
   Null_object = NULL;
   Ws_dirty = false;
 }
@@ -3299,7 +3433,7 @@ ws_clear_hints (MOP mop, bool leave_pinned)
  * Note:
  *    Called by the transaction manager to reset all hint flags in the mops
  *    after a transaction has been committeed.  Also reset the
- *    authorization cache.
+ *    authorization cache, if authorizations were changed.
  */
 void
 ws_clear_all_hints (bool retain_lock)
@@ -3312,7 +3446,7 @@ ws_clear_all_hints (bool retain_lock)
       return;
     }
 
-  au_reset_authorization_caches ();
+  au_validate_authorization_caches ();
 
   /* clear hints */
   mop = ws_Commit_mops;
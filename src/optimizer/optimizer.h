@@ -127,6 +127,7 @@ typedef struct
 				 * # of {a, b} ... pkeys[key_size-1] -> # of {a, b, ..., x} */
   bool valid_limits;
   bool is_indexed;
+  struct attr_value_stats *value_stats;	/* value distribution of the attribute; NULL if unknown */
 } QO_ATTR_CUM_STATS;
 
 typedef struct qo_plan QO_PLAN;
@@ -234,6 +234,7 @@ static void qo_seg_nodes (QO_ENV *, BITSET *, BITSET *);
 static QO_ENV *qo_env_new (PARSER_CONTEXT *, PT_NODE *);
 static void qo_discover_partitions (QO_ENV *);
 static void qo_discover_indexes (QO_ENV *);
+static void qo_correlate_node_sargs (QO_ENV * env, QO_NODE * nodep);
 static void qo_assign_eq_classes (QO_ENV *);
 static void qo_discover_edges (QO_ENV *);
 static void qo_classify_outerjoin_terms (QO_ENV *);
@@ -4625,6 +4626,7 @@ qo_alloc_index (QO_ENV * env, int n)
       entryp->first_sort_column = -1;
       entryp->orderby_skip = false;
       entryp->groupby_skip = false;
+      entryp->orderby_first_key = false;
       entryp->use_descending = false;
       entryp->statistics_attribute_name = NULL;
       entryp->key_limit = NULL;
@@ -4933,6 +4935,7 @@ qo_get_attr_info_func_index (QO_ENV * env, QO_SEGMENT * seg, const char *expr_st
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->value_stats = NULL;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5105,6 +5108,7 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
       cum_statsp->key_type = NULL;
       cum_statsp->pkeys_size = 0;
       cum_statsp->pkeys = NULL;
+      cum_statsp->value_stats = NULL;
 
       return attr_infop;
     }
@@ -5118,6 +5122,7 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
   cum_statsp->key_type = NULL;
   cum_statsp->pkeys_size = 0;
   cum_statsp->pkeys = NULL;
+  cum_statsp->value_stats = NULL;
 
   /* set the statistics from the class information(QO_CLASS_INFO_ENTRY) */
   for (i = 0; i < n; class_info_entryp++, i++)
@@ -5169,6 +5174,12 @@ qo_get_attr_info (QO_ENV * env, QO_SEGMENT * seg)
 	  cum_statsp->valid_limits = true;
 	}
 
+      /* the value statistics describe a single class; they are not combined for a class hierarchy */
+      if (n == 1 && attr_statsp->value_stats.null_ppm >= 0)
+	{
+	  cum_statsp->value_stats = &attr_statsp->value_stats;
+	}
+
       n_func_indexes = 0;
       n_unavail_indexes = 0;
       for (j = 0; j < attr_statsp->n_btstats; j++)
@@ -7555,6 +7566,7 @@ qo_discover_indexes (QO_ENV * env)
 		{
 		  /* collect statistics if discovers an usable index */
 		  qo_get_index_info (env, nodep);
+		  qo_correlate_node_sargs (env, nodep);
 		  continue;
 		}
 	      /* fall through */
@@ -7634,6 +7646,121 @@ qo_discover_indexes (QO_ENV * env)
 
 }
 
+/*
+ * qo_correlate_node_sargs () - correct the selectivity of the node for the correlated equal sargs
+ *   return: nothing
+ *   env(in): The current optimizer environment
+ *   nodep(in): A join graph node that has usable indexes
+ *
+ * Note: The selectivity of a node is the product of the selectivities of its sargs, as if the columns were
+ *	independent. When the leading columns of a multi column index are all compared to constants, the number of
+ *	distinct keys of that prefix (pkeys[] of the B-tree statistics) is the number of distinct values of the column
+ *	group, and the selectivity of the group is 1 / pkeys[k - 1] rather than the product. A column that does not add
+ *	any distinct key to the prefix before it (pkeys[j] == pkeys[j - 1]) is functionally dependent on that prefix,
+ *	and its term does not reduce the selectivity at all.
+ *	The correction only raises the product, never above the selectivity of the most selective term of the group,
+ *	and it is applied for the index with the longest group only, so that no term is corrected twice.
+ */
+static void
+qo_correlate_node_sargs (QO_ENV * env, QO_NODE * nodep)
+{
+  QO_NODE_INDEX *node_indexp;
+  QO_NODE_INDEX_ENTRY *ni_entryp;
+  QO_INDEX_ENTRY *index_entryp;
+  QO_ATTR_CUM_STATS *cum_statsp;
+  QO_TERM *termp, *col_termp;
+  BITSET_ITERATOR iter;
+  BITSET group_terms, best_terms;
+  double group_sel, min_sel, best_group_sel, sel, sel_limit;
+  int i, j, t, k, best_k;
+
+  node_indexp = QO_NODE_INDEXES (nodep);
+  if (node_indexp == NULL || bitset_cardinality (&(QO_NODE_SARGS (nodep))) < 2)
+    {
+      return;
+    }
+
+  bitset_init (&group_terms, env);
+  bitset_init (&best_terms, env);
+  best_k = 1;
+  best_group_sel = 1.0;
+
+  for (i = 0, ni_entryp = QO_NI_ENTRY (node_indexp, 0); i < QO_NI_N (node_indexp); i++, ni_entryp++)
+    {
+      index_entryp = ni_entryp->head;
+      cum_statsp = &(ni_entryp->cum_stats);
+      if (!QO_ENTRY_MULTI_COL (index_entryp) || index_entryp->is_func_index || cum_statsp->pkeys == NULL)
+	{
+	  continue;
+	}
+
+      /* find the longest prefix of the index columns compared to constants by an equal sarg */
+      BITSET_CLEAR (group_terms);
+      min_sel = 1.0;
+      for (k = 0; k < MIN (index_entryp->col_num, cum_statsp->pkeys_size); k++)
+	{
+	  if (index_entryp->seg_idxs[k] == -1)
+	    {
+	      break;
+	    }
+
+	  col_termp = NULL;
+	  for (t = bitset_iterate (&(QO_NODE_SARGS (nodep)), &iter); t != -1; t = bitset_next_member (&iter))
+	    {
+	      termp = QO_ENV_TERM (env, t);
+	      if (QO_TERM_CLASS (termp) == QO_TC_SARG && QO_TERM_IS_FLAGED (termp, QO_TERM_SINGLE_PRED)
+		  && QO_TERM_PT_EXPR (termp) != NULL && QO_TERM_PT_EXPR (termp)->info.expr.op == PT_EQ
+		  && bitset_cardinality (&(QO_TERM_SEGS (termp))) == 1
+		  && BITSET_MEMBER (QO_TERM_SEGS (termp), index_entryp->seg_idxs[k]))
+		{
+		  col_termp = termp;
+		  break;
+		}
+	    }
+	  if (col_termp == NULL || cum_statsp->pkeys[k] <= 1)
+	    {
+	      break;
+	    }
+
+	  bitset_add (&group_terms, QO_TERM_IDX (col_termp));
+	  min_sel = MIN (min_sel, QO_TERM_SELECTIVITY (col_termp));
+	}
+
+      if (k <= best_k)
+	{
+	  continue;
+	}
+
+      group_sel = MIN (1.0 / (double) cum_statsp->pkeys[k - 1], min_sel);
+      best_k = k;
+      best_group_sel = group_sel;
+      bitset_assign (&best_terms, &group_terms);
+    }
+
+  if (best_k > 1)
+    {
+      /* the product of the independent selectivities of the group */
+      sel = 1.0;
+      for (t = bitset_iterate (&best_terms, &iter); t != -1; t = bitset_next_member (&iter))
+	{
+	  sel *= QO_TERM_SELECTIVITY (QO_ENV_TERM (env, t));
+	}
+
+      if (sel > 0.0 && sel < best_group_sel)
+	{
+	  QO_NODE_SELECTIVITY (nodep) = MIN (QO_NODE_SELECTIVITY (nodep) / sel * best_group_sel, 1.0);
+	  sel_limit = (QO_NODE_NCARD (nodep) == 0) ? 0 : (1.0 / (double) QO_NODE_NCARD (nodep));
+	  if (QO_NODE_SELECTIVITY (nodep) < sel_limit)
+	    {
+	      QO_NODE_SELECTIVITY (nodep) = sel_limit;
+	    }
+	}
+    }
+
+  bitset_delset (&group_terms);
+  bitset_delset (&best_terms);
+}
+
 /*
  * qo_discover_partitions () -
  *   return:
@@ -148,6 +148,9 @@ struct qo_index_entry
   /* true if the index can skip the group by */
   bool groupby_skip;
 
+  /* true if the index cannot skip the order by, but returns the rows ordered by its first column */
+  bool orderby_first_key;
+
   /* true if the index will skip the order by or the group by with the usage of descending index */
   bool use_descending;
 
@@ -377,6 +377,9 @@ QO_PLAN_VTBL *all_vtbls[] = {
 #define DEFAULT_IN_SELECTIVITY (double) 0.01
 #define DEFAULT_RANGE_SELECTIVITY (double) 0.1
 
+/* lower bound of a selectivity computed from the value statistics, which are only a sample */
+#define QO_MIN_VALUE_SELECTIVITY (double) 0.000001
+
 /* Structural equivalence classes for expressions */
 
 typedef enum PRED_CLASS
@@ -410,6 +413,10 @@ static PRED_CLASS qo_classify (PT_NODE * attr);
 
 static int qo_index_cardinality (QO_ENV * env, PT_NODE * attr);
 
+static ATTR_VALUE_STATS *qo_attr_value_stats (QO_ENV * env, PT_NODE * attr);
+
+static double qo_value_equal_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * value);
+
 /*
  * log3 () -
  *   return:
@@ -1057,6 +1064,21 @@ qo_top_plan_new (QO_PLAN * plan)
 		  return plan;
 		}
 
+	      /* the index still returns the rows ordered by the first order by column: a top-n sort on the scan can stop
+	       * it once the first column of a row loses against all the rows kept */
+	      if (qo_is_iscan (plan) && plan->iscan_sort_list != NULL && all_distinct != PT_DISTINCT && !group_by
+		  && !(found_instnum && orderby_for) && !is_index_w_prefix && !tree->info.query.q.select.connect_by
+		  && !pt_has_analytic (parser, tree)
+		  && plan->iscan_sort_list->info.sort_spec.pos_descr.pos_no > 0
+		  && (plan->iscan_sort_list->info.sort_spec.pos_descr.pos_no
+		      == order_by->info.sort_spec.pos_descr.pos_no)
+		  && plan->iscan_sort_list->info.sort_spec.asc_or_desc == order_by->info.sort_spec.asc_or_desc
+		  && (plan->iscan_sort_list->info.sort_spec.nulls_first_or_last
+		      == order_by->info.sort_spec.nulls_first_or_last))
+		{
+		  plan->plan_un.scan.index->head->orderby_first_key = true;
+		}
+
 	      plan = qo_sort_new (plan, QO_UNORDERED, all_distinct == PT_DISTINCT ? SORT_DISTINCT : SORT_ORDERBY);
 	    }
 	}
@@ -1948,10 +1970,11 @@ qo_iscan_cost (QO_PLAN * planp)
 
       sel_limit = 0.0;		/* init */
 
-      /* set selectivity limit */
-      if (i < pkeys_num && cum_statsp->pkeys[i] > 1)
+      /* set selectivity limit; the first i columns have pkeys[i - 1] distinct keys, whatever the correlation of the
+       * columns, so the product of the term selectivities can not go below it */
+      if (i > 0 && i <= pkeys_num && cum_statsp->pkeys[i - 1] > 1)
 	{
-	  sel_limit = 1.0 / (double) cum_statsp->pkeys[i];
+	  sel_limit = 1.0 / (double) cum_statsp->pkeys[i - 1];
 	}
       else
 	{			/* can not use btree partial-key statistics */
@@ -6322,6 +6345,8 @@ qo_alloc_planner (QO_ENV * env)
       planner->node_mask = (unsigned long) DB_UINT32_MAX;
     }
   planner->join_unit = 0;
+  planner->n_visits = 0;
+  planner->max_visits = INT_MAX;
   planner->term = env->terms;
   planner->T = env->nterms;
   planner->segment = env->segs;
@@ -6490,6 +6515,13 @@ planner_visit_node (QO_PLANNER * planner, QO_PARTITION * partition, PT_HINT_ENUM
   BITSET info_terms;
   BITSET pinned_subqueries;
 
+  if (planner->n_visits >= planner->max_visits && planner->best_info != NULL)
+    {
+      /* out of search budget for this step; keep the best plan found so far */
+      return;
+    }
+  planner->n_visits++;
+
   bitset_init (&nl_join_terms, planner->env);
   bitset_init (&sm_join_terms, planner->env);
   bitset_init (&duj_terms, planner->env);
@@ -8431,6 +8463,10 @@ qo_clean_planner (QO_PLANNER * planner)
  * 38..          | 2
  * -------------------------------------------
  * Refer Sybase Ataptive Server
+ *
+ * Each search step may visit optimizer_join_search_budget permutations before it settles for the best plan found so
+ * far. A step that runs out of budget lowers the number of tables considered at a time for the next steps, down to 2
+ * (a greedy search), so that large join graphs are planned in bounded time.
  */
 
 /*
@@ -8458,8 +8494,14 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
   BITSET nested_path_nodes;
   BITSET remaining_nodes;
   BITSET remaining_terms;
+  int budget, start_visits;
+  bool is_budget_exceeded = false;
+  struct timeval start_time, end_time;
 
   env = planner->env;
+  budget = prm_get_integer_value (PRM_ID_OPTIMIZER_JOIN_SEARCH_BUDGET);
+  start_visits = planner->n_visits;
+  gettimeofday (&start_time, NULL);
   bitset_init (&visited_nodes, env);
   bitset_init (&visited_rel_nodes, env);
   bitset_init (&visited_terms, env);
@@ -8705,12 +8747,21 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
   while (1)
     {
       node_idx = -1;		/* init */
+      if (budget > 0 && planner->n_visits < INT_MAX - budget)
+	{
+	  planner->max_visits = planner->n_visits + budget;
+	}
+      else
+	{
+	  planner->max_visits = INT_MAX;
+	}
       (void) planner_permutate (planner, partition, hint, node,	/* previous head node */
 				&visited_nodes, &visited_rel_nodes, &visited_terms, &first_nodes, &nested_path_nodes,
 				&remaining_nodes, &remaining_terms, remaining_subqueries, num_path_inner,
 				(planner->join_unit < nodes_cnt) ? &node_idx
 				/* partial join search */
 				: NULL /* total join search */ );
+      is_budget_exceeded = (planner->n_visits >= planner->max_visits);
       if (planner->best_info)
 	{			/* OK */
 	  break;		/* found best total join plan */
@@ -8772,10 +8823,20 @@ qo_search_partition_join (QO_PLANNER * planner, QO_PARTITION * partition, BITSET
       bitset_assign (&visited_terms, &(visited_info->terms));
       bitset_difference (&remaining_terms, &(visited_info->terms));
 
-      planner->join_unit++;	/* increase join unit level */
+      /* when the step was out of budget, consider one table less at a time from now on */
+      if (!is_budget_exceeded || planner->join_unit - bitset_cardinality (&visited_nodes) < 2)
+	{
+	  planner->join_unit++;	/* increase join unit level */
+	}
 
     }
 
+  gettimeofday (&end_time, NULL);
+  er_log_debug (ARG_FILE_LINE, "qo_search_partition_join: %d tables, %d permutations visited in %ld msec,"
+		" last join unit %d, best plan cardinality %g\n", nodes_cnt, planner->n_visits - start_visits,
+		(long) timeval_diff_in_msec (&end_time, &start_time), planner->join_unit,
+		(planner->best_info != NULL) ? planner->best_info->cardinality : -1.0);
+
   bitset_delset (&visited_rel_nodes);
   bitset_delset (&visited_nodes);
   bitset_delset (&visited_terms);
@@ -9240,7 +9301,7 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
   PT_NODE *lhs, *rhs, *multi_attr;
   PRED_CLASS pc_lhs, pc_rhs;
   int lhs_icard, rhs_icard, icard;
-  double selectivity;
+  double selectivity, lhs_sel, rhs_sel;
 
   lhs = pt_expr->info.expr.arg1;
   rhs = pt_expr->info.expr.arg2;
@@ -9271,7 +9332,17 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	    }
 	  else
 	    {
-	      selectivity = DEFAULT_EQUIJOIN_SELECTIVITY;
+	      /* without indexes, use the distinct values of the attributes */
+	      lhs_sel = qo_value_equal_selectivity (env, lhs, NULL);
+	      rhs_sel = qo_value_equal_selectivity (env, rhs, NULL);
+	      if (lhs_sel >= 0 && rhs_sel >= 0)
+		{
+		  selectivity = MIN (lhs_sel, rhs_sel);
+		}
+	      else
+		{
+		  selectivity = DEFAULT_EQUIJOIN_SELECTIVITY;
+		}
 	    }
 
 	  break;
@@ -9283,6 +9354,13 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	case PC_OTHER:
 	  /* attr = const */
 
+	  /* the most common values know better than the index about a skewed attribute */
+	  selectivity = qo_value_equal_selectivity (env, lhs, rhs);
+	  if (selectivity >= 0)
+	    {
+	      break;
+	    }
+
 	  /* check for index on the attribute.  NOTE: For an equality predicate, we treat subqueries as constants. */
 	  lhs_icard = qo_index_cardinality (env, lhs);
 	  if (lhs_icard != 0)
@@ -9291,7 +9369,11 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	    }
 	  else
 	    {
-	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
+	      selectivity = qo_value_equal_selectivity (env, lhs, NULL);
+	      if (selectivity < 0)
+		{
+		  selectivity = DEFAULT_EQUAL_SELECTIVITY;
+		}
 	    }
 
 	  break;
@@ -9315,6 +9397,13 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	case PC_ATTR:
 	  /* const = attr */
 
+	  /* the most common values know better than the index about a skewed attribute */
+	  selectivity = qo_value_equal_selectivity (env, rhs, lhs);
+	  if (selectivity >= 0)
+	    {
+	      break;
+	    }
+
 	  /* check for index on the attribute.  NOTE: For an equality predicate, we treat subqueries as constants. */
 	  rhs_icard = qo_index_cardinality (env, rhs);
 	  if (rhs_icard != 0)
@@ -9323,7 +9412,11 @@ qo_equal_selectivity (QO_ENV * env, PT_NODE * pt_expr)
 	    }
 	  else
 	    {
-	      selectivity = DEFAULT_EQUAL_SELECTIVITY;
+	      selectivity = qo_value_equal_selectivity (env, rhs, NULL);
+	      if (selectivity < 0)
+		{
+		  selectivity = DEFAULT_EQUAL_SELECTIVITY;
+		}
 	    }
 
 	  break;
@@ -9864,6 +9957,114 @@ qo_index_cardinality (QO_ENV * env, PT_NODE * attr)
   return info->cum_stats.pkeys[0];
 }
 
+/*
+ * qo_attr_value_stats () - Find the value statistics of an attribute
+ *   return: the value statistics, or NULL if they were not gathered
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ */
+static ATTR_VALUE_STATS *
+qo_attr_value_stats (QO_ENV * env, PT_NODE * attr)
+{
+  PT_NODE *dummy;
+  QO_NODE *nodep;
+  QO_SEGMENT *segp;
+  QO_ATTR_INFO *info;
+
+  if (attr->node_type == PT_DOT_)
+    {
+      attr = attr->info.dot.arg2;
+    }
+
+  if (attr->node_type != PT_NAME || attr->info.name.meta_class == PT_RESERVED)
+    {
+      return NULL;
+    }
+
+  nodep = lookup_node (attr, env, &dummy);
+  if (nodep == NULL)
+    {
+      return NULL;
+    }
+
+  segp = lookup_seg (nodep, attr, env);
+  if (segp == NULL)
+    {
+      return NULL;
+    }
+
+  info = QO_SEG_INFO (segp);
+  if (info == NULL)
+    {
+      return NULL;
+    }
+
+  return info->cum_stats.value_stats;
+}
+
+/*
+ * qo_value_equal_selectivity () - Compute the selectivity of an equality predicate from the value statistics of the
+ *				   attribute
+ *   return: the selectivity, or -1 if it cannot be computed
+ *   env(in): optimizer environment
+ *   attr(in): pt node for the attribute
+ *   value(in): the other operand; NULL for any value
+ *
+ * Note: An integer literal is looked up in the most common values of the attribute; any other operand yields -1.
+ *       For any value, the rows having a value are shared evenly by the distinct values.
+ */
+static double
+qo_value_equal_selectivity (QO_ENV * env, PT_NODE * attr, PT_NODE * value)
+{
+  ATTR_VALUE_STATS *stats_p;
+  DB_BIGINT int_value;
+  double rows_fraction;
+  int i;
+
+  stats_p = qo_attr_value_stats (env, attr);
+  if (stats_p == NULL || stats_p->ndv <= 0)
+    {
+      return -1.0;
+    }
+
+  rows_fraction = 1.0 - stats_p->null_ppm / 1000000.0;
+  if (value == NULL)
+    {
+      return MAX (rows_fraction / stats_p->ndv, QO_MIN_VALUE_SELECTIVITY);
+    }
+
+  if (value->node_type != PT_VALUE || stats_p->n_mcv == 0)
+    {
+      return -1.0;
+    }
+
+  switch (value->type_enum)
+    {
+    case PT_TYPE_SMALLINT:
+    case PT_TYPE_INTEGER:
+      int_value = value->info.value.data_value.i;
+      break;
+    case PT_TYPE_BIGINT:
+      int_value = value->info.value.data_value.bigint;
+      break;
+    default:
+      return -1.0;
+    }
+
+  for (i = 0; i < stats_p->n_mcv; i++)
+    {
+      if (stats_p->mcv_values[i] == int_value)
+	{
+	  return MAX (stats_p->mcv_ppm[i] / 1000000.0, QO_MIN_VALUE_SELECTIVITY);
+	}
+      rows_fraction -= stats_p->mcv_ppm[i] / 1000000.0;
+    }
+
+  /* one of the less common values */
+  rows_fraction = MAX (rows_fraction, 0.0) / MAX (stats_p->ndv - stats_p->n_mcv, 1);
+  return MAX (rows_fraction, QO_MIN_VALUE_SELECTIVITY);
+}
+
 /*
  * qo_is_all_unique_index_columns_are_equi_terms () -
  *   check if the current plan uses and
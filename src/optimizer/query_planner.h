@@ -352,6 +352,13 @@ struct qo_planner
    * The last join level.
    */
   int join_unit;
+
+  /*
+   * The join permutations visited by the search, and the number after which the current search step stops as soon as
+   * it has a plan (optimizer_join_search_budget).
+   */
+  int n_visits;
+  int max_visits;
   unsigned int S;
   unsigned int EQ;
   unsigned int P;
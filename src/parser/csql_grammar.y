@@ -1541,6 +1541,7 @@ int g_original_buffer_len;
 %token <cptr> DENSE_RANK
 %token <cptr> DONT_REUSE_OID
 %token <cptr> ELT
+%token <cptr> EVENTS
 %token <cptr> EXPLAIN
 %token <cptr> FIRST_VALUE
 %token <cptr> FULLSCAN
@@ -1640,6 +1641,7 @@ int g_original_buffer_len;
 %token <cptr> REMOVE
 %token <cptr> REORGANIZE
 %token <cptr> REPEATABLE
+%token <cptr> RESIDENCY
 %token <cptr> RESPECT
 %token <cptr> RETAIN
 %token <cptr> REUSE_OID
@@ -1678,6 +1680,7 @@ int g_original_buffer_len;
 %token <cptr> VARIANCE
 %token <cptr> VISIBLE
 %token <cptr> VOLUME
+%token <cptr> WAIT
 %token <cptr> WEEK
 %token <cptr> WITHIN
 %token <cptr> WORKSPACE
@@ -5313,6 +5316,26 @@ alter_clause_for_alter_list
 				alter_node->info.alter.alter_clause.comment.tbl_comment = $1;
 			  }
 		DBG_PRINT}}
+	| class_encrypt_spec
+		{{
+			PT_NODE *alter_node = parser_get_alter_node();
+
+			if (alter_node != NULL && $1 != NULL)
+			  {
+				alter_node->info.alter.code = PT_CHANGE_TDE_ALGORITHM;
+				alter_node->info.alter.alter_clause.encrypt.tde_algo = $1->info.value.data_value.i;
+			  }
+		DBG_PRINT}}
+	| ENCRYPT opt_equalsign NONE
+		{{
+			PT_NODE *alter_node = parser_get_alter_node();
+
+			if (alter_node != NULL)
+			  {
+				alter_node->info.alter.code = PT_CHANGE_TDE_ALGORITHM;
+				alter_node->info.alter.alter_clause.encrypt.tde_algo = 0;	/* TDE_ALGORITHM_NONE */
+			  }
+		DBG_PRINT}}
 	;
 
 alter_clause_cubrid_specific
@@ -7104,6 +7127,10 @@ show_type
 		{{
 			$$ = SHOWSTMT_PAGE_BUFFER_STATUS;
 		}}
+	| PAGE BUFFER RESIDENCY
+		{{
+			$$ = SHOWSTMT_PAGE_BUFFER_RESIDENCY;
+		}}
 	| TIMEZONES
 		{{
 			$$ = SHOWSTMT_TIMEZONES;
@@ -7124,6 +7151,18 @@ show_type
 		{{
 			$$ = SHOWSTMT_THREADS;
 		}}
+	| WAIT STATISTICS
+		{{
+			$$ = SHOWSTMT_WAIT_STATISTICS;
+		}}
+	| WAIT EVENTS
+		{{
+			$$ = SHOWSTMT_WAIT_EVENTS;
+		}}
+	| VACUUM STATUS
+		{{
+			$$ = SHOWSTMT_VACUUM_STATUS;
+		}}
 	;
 
 show_type_of_like
@@ -21815,6 +21854,16 @@ identifier
 			$$ = p;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| EVENTS
+		{{
+
+			PT_NODE *p = parser_new_node (this_parser, PT_NAME);
+			if (p)
+			  p->info.name.original = $1;
+			$$ = p;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| EXPLAIN
 		{{
@@ -22657,6 +22706,16 @@ identifier
 			$$ = p;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| RESIDENCY
+		{{
+
+			PT_NODE *p = parser_new_node (this_parser, PT_NAME);
+			if (p)
+			  p->info.name.original = $1;
+			$$ = p;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| RETAIN
 		{{
@@ -22994,6 +23053,16 @@ identifier
 			$$ = p;
 			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
 
+		DBG_PRINT}}
+	| WAIT
+		{{
+
+			PT_NODE *p = parser_new_node (this_parser, PT_NAME);
+			if (p)
+			  p->info.name.original = $1;
+			$$ = p;
+			PARSER_SAVE_ERR_CONTEXT ($$, @$.buffer_pos)
+
 		DBG_PRINT}}
 	| WORKSPACE
 		{{
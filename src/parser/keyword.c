@@ -175,6 +175,7 @@ static KEYWORD_RECORD keywords[] = {
   {ENUM, "ENUM", 0},
   {ESCAPE, "ESCAPE", 0},
   {EVALUATE, "EVALUATE", 0},
+  {EVENTS, "EVENTS", 1},
   {EXCEPT, "EXCEPT", 0},
   {EXCEPTION, "EXCEPTION", 0},
   {EXEC, "EXEC", 0},
@@ -374,6 +375,7 @@ static KEYWORD_RECORD keywords[] = {
   {REORGANIZE, "REORGANIZE", 1},
   {REPEATABLE, "REPEATABLE", 1},
   {REPLACE, "REPLACE", 0},
+  {RESIDENCY, "RESIDENCY", 1},
   {RESIGNAL, "RESIGNAL", 0},
   {RESPECT, "RESPECT", 1},
   {RESTRICT, "RESTRICT", 0},
@@ -505,6 +507,7 @@ static KEYWORD_RECORD keywords[] = {
   {VCLASS, "VCLASS", 0},
   {VIEW, "VIEW", 0},
   {VOLUME, "VOLUME", 1},
+  {WAIT, "WAIT", 1},
   {WEEK, "WEEK", 1},
   {WHEN, "WHEN", 0},
   {WHENEVER, "WHENEVER", 0},
@@ -54,8 +54,8 @@
  * overhead for malloc headers plus string block header.
  */
 #define STRINGS_PER_BLOCK (8192-(4*sizeof(long)+sizeof(char *)+40))
-#define HASH_NUMBER 128
 #define NODES_PER_BLOCK 256
+#define STRING_OPEN_BLOCKS 8	/* string blocks searched for room before another block is made */
 
 typedef struct parser_node_block PARSER_NODE_BLOCK;
 struct parser_node_block
@@ -65,14 +65,6 @@ struct parser_node_block
   PT_NODE nodes[NODES_PER_BLOCK];
 };
 
-typedef struct parser_node_free_list PARSER_NODE_FREE_LIST;
-struct parser_node_free_list
-{
-  PARSER_NODE_FREE_LIST *next;
-  PT_NODE *node;
-  int parser_id;
-};
-
 typedef struct parser_string_block PARSER_STRING_BLOCK;
 struct parser_string_block
 {
@@ -88,6 +80,26 @@ struct parser_string_block
   } u;
 };
 
+/* bytes allocated for a string block; an unusually large string gets a larger block */
+#define PARSER_STRING_BLOCK_SIZE(block) \
+  (sizeof (PARSER_STRING_BLOCK) + (block)->block_end + 1 - STRINGS_PER_BLOCK)
+
+/*
+ * The memory of a parser: the nodes and the strings are carved from blocks that are only freed with the parser, by
+ * parser_free_parser. A parser is used by one thread, its memory needs no lock.
+ * New strings are only looked for room in the last few string blocks, so that an allocation does not walk all the
+ * blocks of a parser that compiles a large statement; the other blocks are kept aside until the parser is freed.
+ */
+struct parser_memory
+{
+  PT_NODE *free_nodes;		/* free list of nodes */
+  PARSER_NODE_BLOCK *node_blocks;	/* node blocks, to be freed */
+  PARSER_STRING_BLOCK *open_string_blocks;	/* string blocks new strings go to, newest first */
+  PARSER_STRING_BLOCK *full_string_blocks;	/* older string blocks, to be freed */
+  int n_open_string_blocks;
+  size_t size;			/* bytes of all the blocks */
+};
+
 /* Global reserved name table including info for each reserved name */
 PT_RESERVED_NAME pt_Reserved_name_table[] = {
 
@@ -179,16 +191,9 @@ PT_RESERVED_NAME pt_Reserved_name_table[] = {
 /* this is a kludge because many platforms do not handle extern
  * linking per ANSI. This should be deleted when nodes get used in server.
  */
-static pthread_mutex_t blocks_lock = PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t free_lists_lock = PTHREAD_MUTEX_INITIALIZER;
-static pthread_mutex_t parser_memory_lock = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t parser_id_lock = PTHREAD_MUTEX_INITIALIZER;
 #endif /* SERVER_MODE */
 
-static PARSER_NODE_BLOCK *parser_Node_blocks[HASH_NUMBER];
-static PARSER_NODE_FREE_LIST *parser_Node_free_lists[HASH_NUMBER];
-static PARSER_STRING_BLOCK *parser_String_blocks[HASH_NUMBER];
-
 static int parser_id = 1;
 
 static PT_NODE *parser_create_node_block (const PARSER_CONTEXT * parser);
@@ -206,18 +211,15 @@ static void pt_free_string_blocks (const PARSER_CONTEXT * parser);
 
 /*
  * pt_create_node_block () - creates a new block of nodes, links the block
- * on the hash list for the parser, and returns the free list of new nodes
+ * on the block list of the parser, and returns the free list of new nodes
  *   return:
  *   parser(in):
  */
 static PT_NODE *
 parser_create_node_block (const PARSER_CONTEXT * parser)
 {
-  int idhash, inode;
+  int inode;
   PARSER_NODE_BLOCK *block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
   block = (PARSER_NODE_BLOCK *) malloc (sizeof (PARSER_NODE_BLOCK));
 
@@ -238,13 +240,10 @@ parser_create_node_block (const PARSER_CONTEXT * parser)
   /* remember which parser allocated this block */
   block->parser_id = parser->id;
 
-  /* link blocks on the hash list for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&blocks_lock);
-#endif /* SERVER_MODE */
-  block->next = parser_Node_blocks[idhash];
-  parser_Node_blocks[idhash] = block;
+  /* link blocks on the list of the parser */
+  block->next = parser->memory->node_blocks;
+  parser->memory->node_blocks = block;
+  parser->memory->size += sizeof (PARSER_NODE_BLOCK);
 
   /* link nodes for free list */
   for (inode = 1; inode < NODES_PER_BLOCK; inode++)
@@ -253,9 +252,6 @@ parser_create_node_block (const PARSER_CONTEXT * parser)
     }
   block->nodes[NODES_PER_BLOCK - 1].next = NULL;
 
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&blocks_lock);
-#endif /* SERVER_MODE */
   /* return head of free list */
   return &block->nodes[0];
 }
@@ -270,48 +266,26 @@ parser_create_node_block (const PARSER_CONTEXT * parser)
 PT_NODE *
 parser_create_node (const PARSER_CONTEXT * parser)
 {
-  int idhash;
-  PARSER_NODE_FREE_LIST *free_list;
+  PARSER_MEMORY *memory = parser->memory;
   PT_NODE *node;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
-  /* find free list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&free_lists_lock);
-#endif /* SERVER_MODE */
-
-  free_list = parser_Node_free_lists[idhash];
-  while (free_list != NULL && free_list->parser_id != parser->id)
-    {
-      free_list = free_list->next;
-    }
 
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-
-  if (free_list == NULL)
+  if (memory == NULL)
     {
       /* this is an programming error ! The parser does not exist! */
       return NULL;
     }
 
-  if (free_list->node == NULL)
+  if (memory->free_nodes == NULL)
     {
-      /* do not need to use mutex : only used by one parser(and one thread) */
-      free_list->node = parser_create_node_block (parser);
-      if (free_list->node == NULL)
+      memory->free_nodes = parser_create_node_block (parser);
+      if (memory->free_nodes == NULL)
 	{
 	  return NULL;
 	}
     }
 
-  node = free_list->node;
-  free_list->node = free_list->node->next;
+  node = memory->free_nodes;
+  memory->free_nodes = node->next;
 
   node->parser_id = parser->id;	/* consistency check */
 
@@ -327,45 +301,21 @@ parser_create_node (const PARSER_CONTEXT * parser)
 static void
 pt_free_node_blocks (const PARSER_CONTEXT * parser)
 {
-  int idhash;
   PARSER_NODE_BLOCK *block;
-  PARSER_NODE_BLOCK **previous_block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
-  /* unlink blocks on the hash list for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&blocks_lock);
-#endif /* SERVER_MODE */
-  previous_block = &parser_Node_blocks[idhash];
-  block = *previous_block;
-
-  while (block != NULL)
+  while (parser->memory->node_blocks != NULL)
     {
-      if (block->parser_id == parser->id)
-	{
-	  /* remove it from list, and free it */
-	  *previous_block = block->next;
-	  free_and_init (block);
-	}
-      else
-	{
-	  /* keep it, and move to next block pointer */
-	  previous_block = &block->next;
-	}
-      /* re-establish invariant */
-      block = *previous_block;
+      block = parser->memory->node_blocks;
+      parser->memory->node_blocks = block->next;
+      parser->memory->size -= sizeof (PARSER_NODE_BLOCK);
+      free_and_init (block);
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&blocks_lock);
-#endif /* SERVER_MODE */
+  parser->memory->free_nodes = NULL;
 }
 
 /*
  * parser_create_string_block () - reates a new block of strings, links the block
- * on the hash list for the parser, and returns the block
+ * on the open block list of the parser, and returns the block
  *   return:
  *   parser(in):
  *   length(in):
@@ -373,11 +323,8 @@ pt_free_node_blocks (const PARSER_CONTEXT * parser)
 static PARSER_STRING_BLOCK *
 parser_create_string_block (const PARSER_CONTEXT * parser, const int length)
 {
-  int idhash;
-  PARSER_STRING_BLOCK *block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
+  PARSER_MEMORY *memory = parser->memory;
+  PARSER_STRING_BLOCK *block, *last;
 
   if (length < (int) STRINGS_PER_BLOCK)
     {
@@ -424,17 +371,23 @@ parser_create_string_block (const PARSER_CONTEXT * parser, const int length)
   block->last_string_start = -1;
   block->last_string_end = -1;
   block->u.chars[0] = 0;
+  memory->size += PARSER_STRING_BLOCK_SIZE (block);
 
-  /* link blocks on the hash list for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  block->next = parser_String_blocks[idhash];
-  parser_String_blocks[idhash] = block;
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
+  /* the new block is the first one new strings go to */
+  block->next = memory->open_string_blocks;
+  memory->open_string_blocks = block;
+  if (++memory->n_open_string_blocks > STRING_OPEN_BLOCKS)
+    {
+      /* put the oldest block aside */
+      for (last = block; last->next->next != NULL; last = last->next)
+	{
+	  ;
+	}
+      last->next->next = memory->full_string_blocks;
+      memory->full_string_blocks = last->next;
+      last->next = NULL;
+      memory->n_open_string_blocks--;
+    }
 
   return block;
 }
@@ -448,7 +401,7 @@ parser_create_string_block (const PARSER_CONTEXT * parser, const int length)
  *   align(in):
  *
  * Note :
- * First it tries to find length + 1 bytes in the parser's free strings list.
+ * First it tries to find length + 1 bytes in the parser's open string blocks.
  * If there is no room, it adds a new block of strings to the free
  * strings list, at least large enough to hold new length plus
  * 1 (for a null character). Thus, one can call it by
@@ -457,28 +410,14 @@ parser_create_string_block (const PARSER_CONTEXT * parser, const int length)
 void *
 parser_allocate_string_buffer (const PARSER_CONTEXT * parser, const int length, const int align)
 {
-  int idhash;
   PARSER_STRING_BLOCK *block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
-
-  /* find free string list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  block = parser_String_blocks[idhash];
-  while (block != NULL
-	 && (block->parser_id != parser->id
-	     || ((block->block_end - block->last_string_end) < (length + (align - 1) + 1))))
+  /* find room in the open string blocks of the parser */
+  block = parser->memory->open_string_blocks;
+  while (block != NULL && ((block->block_end - block->last_string_end) < (length + (align - 1) + 1)))
     {
       block = block->next;
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
 
   if (block == NULL)
     {
@@ -510,19 +449,11 @@ pt_free_a_string_block (const PARSER_CONTEXT * parser, PARSER_STRING_BLOCK * str
 {
   PARSER_STRING_BLOCK **previous_string;
   PARSER_STRING_BLOCK *string;
-  int idhash;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
-  /* find string holding old_string for for this parse_id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  previous_string = &parser_String_blocks[idhash];
+  /* only the open blocks are found by pt_find_string_block */
+  previous_string = &parser->memory->open_string_blocks;
   string = *previous_string;
-  while (string != string_to_free)
+  while (string != NULL && string != string_to_free)
     {
       previous_string = &string->next;
       string = *previous_string;
@@ -531,11 +462,10 @@ pt_free_a_string_block (const PARSER_CONTEXT * parser, PARSER_STRING_BLOCK * str
   if (string)
     {
       *previous_string = string->next;
+      parser->memory->n_open_string_blocks--;
+      parser->memory->size -= PARSER_STRING_BLOCK_SIZE (string);
       free_and_init (string);
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
 }
 
 /*
@@ -544,30 +474,19 @@ pt_free_a_string_block (const PARSER_CONTEXT * parser, PARSER_STRING_BLOCK * str
  *   return:
  *   parser(in):
  *   old_string(in):
+ *
+ * Note: only the open blocks are searched; a string at the end of a block put aside is copied when appended to.
  */
 static PARSER_STRING_BLOCK *
 pt_find_string_block (const PARSER_CONTEXT * parser, const char *old_string)
 {
   PARSER_STRING_BLOCK *string;
-  int idhash;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
-  /* find string holding old_string for for this parse_id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  string = parser_String_blocks[idhash];
-  while (string != NULL
-	 && (string->parser_id != parser->id || &(string->u.chars[string->last_string_start]) != old_string))
+  string = parser->memory->open_string_blocks;
+  while (string != NULL && &(string->u.chars[string->last_string_start]) != old_string)
     {
       string = string->next;
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
 
   return string;
 }
@@ -742,52 +661,16 @@ pt_append_bytes_for (const PARSER_CONTEXT * parser, PARSER_VARCHAR * old_string,
 static int
 pt_register_parser (const PARSER_CONTEXT * parser)
 {
-  int idhash;
-  PARSER_NODE_FREE_LIST *free_list;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
+  PARSER_MEMORY *memory;
 
-  /* find free list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&free_lists_lock);
-#endif /* SERVER_MODE */
-  free_list = parser_Node_free_lists[idhash];
-  while (free_list != NULL && free_list->parser_id != parser->id)
-    {
-      free_list = free_list->next;
-    }
-
-  if (free_list == NULL)
-    {
-      /* this is the first time this parser allocated a node. */
-      /* set up a free list. This will only be done once per parser. */
-
-      free_list = (PARSER_NODE_FREE_LIST *) calloc (sizeof (PARSER_NODE_FREE_LIST), 1);
-      if (free_list == NULL)
-	{
-#if defined(SERVER_MODE)
-	  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (PARSER_NODE_FREE_LIST));
-	  return ER_FAILED;
-	}
-      free_list->parser_id = parser->id;
-      free_list->next = parser_Node_free_lists[idhash];
-      parser_Node_free_lists[idhash] = free_list;
-    }
-  else
+  memory = (PARSER_MEMORY *) calloc (sizeof (PARSER_MEMORY), 1);
+  if (memory == NULL)
     {
-#if defined(SERVER_MODE)
-      pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (PARSER_MEMORY));
       return ER_FAILED;
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
+
+  ((PARSER_CONTEXT *) parser)->memory = memory;
   return NO_ERROR;
 }
 
@@ -800,35 +683,10 @@ pt_register_parser (const PARSER_CONTEXT * parser)
 static void
 pt_unregister_parser (const PARSER_CONTEXT * parser)
 {
-  int idhash;
-  PARSER_NODE_FREE_LIST *free_list;
-  PARSER_NODE_FREE_LIST **previous_free_list;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
-  /* find free list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&free_lists_lock);
-#endif /* SERVER_MODE */
-  previous_free_list = &parser_Node_free_lists[idhash];
-  free_list = *previous_free_list;
-  while (free_list != NULL && free_list->parser_id != parser->id)
-    {
-      previous_free_list = &free_list->next;
-      free_list = *previous_free_list;
-    }
-
-  if (free_list)
+  if (parser->memory != NULL)
     {
-      /* all is ok, remove the free list from the hash list of free lists. */
-      *previous_free_list = free_list->next;
-      free_and_init (free_list);
+      free_and_init (((PARSER_CONTEXT *) parser)->memory);
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
 }
 
 void
@@ -868,12 +726,6 @@ parser_free_node_resources (PT_NODE * node)
 void
 parser_free_node (const PARSER_CONTEXT * parser, PT_NODE * node)
 {
-  int idhash;
-  PARSER_NODE_FREE_LIST *free_list;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
-
   if (node == NULL)
     {
       assert_release (false);
@@ -888,23 +740,7 @@ parser_free_node (const PARSER_CONTEXT * parser, PT_NODE * node)
       return;
     }
 
-  /* find free list for for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&free_lists_lock);
-#endif /* SERVER_MODE */
-  free_list = parser_Node_free_lists[idhash];
-  while (free_list != NULL && free_list->parser_id != parser->id)
-    {
-      free_list = free_list->next;
-    }
-
-#if defined(SERVER_MODE)
-  /* we can unlock mutex, since this free_list is only used by one parser */
-  pthread_mutex_unlock (&free_lists_lock);
-#endif /* SERVER_MODE */
-
-  if (free_list == NULL)
+  if (parser->memory == NULL)
     {
       /* this is an programming error ! The parser does not exist! */
       return;
@@ -928,8 +764,8 @@ parser_free_node (const PARSER_CONTEXT * parser, PT_NODE * node)
    */
   node->node_type = PT_LAST_NODE_NUMBER;
 
-  node->next = free_list->node;
-  free_list->node = node;
+  node->next = parser->memory->free_nodes;
+  parser->memory->free_nodes = node;
 }
 
 
@@ -960,6 +796,19 @@ parser_alloc (const PARSER_CONTEXT * parser, const int length)
   return pointer;
 }
 
+/*
+ * parser_get_memory_size () - bytes of memory the parser allocated for its nodes and strings
+ *   return: size in bytes
+ *   parser(in):
+ *
+ * Note: the memory is only given back when the parser is freed, freed nodes are reused by the same parser.
+ */
+size_t
+parser_get_memory_size (const PARSER_CONTEXT * parser)
+{
+  return parser->memory->size;
+}
+
 /*
  * pt_append_string () - appends a tail to a string for a given parser
  *   return:
@@ -1122,40 +971,25 @@ pt_get_varchar_length (const PARSER_VARCHAR * string)
 static void
 pt_free_string_blocks (const PARSER_CONTEXT * parser)
 {
-  int idhash;
+  PARSER_MEMORY *memory = parser->memory;
   PARSER_STRING_BLOCK *block;
-  PARSER_STRING_BLOCK **previous_block;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
 
-  /* unlink blocks on the hash list for this id */
-  idhash = parser->id % HASH_NUMBER;
-#if defined(SERVER_MODE)
-  rv = pthread_mutex_lock (&parser_memory_lock);
-#endif /* SERVER_MODE */
-  previous_block = &parser_String_blocks[idhash];
-  block = *previous_block;
+  while (memory->open_string_blocks != NULL)
+    {
+      block = memory->open_string_blocks;
+      memory->open_string_blocks = block->next;
+      memory->size -= PARSER_STRING_BLOCK_SIZE (block);
+      free_and_init (block);
+    }
+  memory->n_open_string_blocks = 0;
 
-  while (block != NULL)
+  while (memory->full_string_blocks != NULL)
     {
-      if (block->parser_id == parser->id)
-	{
-	  /* remove it from list, and free it */
-	  *previous_block = block->next;
-	  free_and_init (block);
-	}
-      else
-	{
-	  /* keep it, and move to next block pointer */
-	  previous_block = &block->next;
-	}
-      /* re-establish invariant */
-      block = *previous_block;
+      block = memory->full_string_blocks;
+      memory->full_string_blocks = block->next;
+      memory->size -= PARSER_STRING_BLOCK_SIZE (block);
+      free_and_init (block);
     }
-#if defined(SERVER_MODE)
-  pthread_mutex_unlock (&parser_memory_lock);
-#endif /* SERVER_MODE */
 }
 
 
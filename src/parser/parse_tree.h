@@ -1275,7 +1275,8 @@ typedef enum
   PT_CHANGE_TABLE_COMMENT,
   PT_CHANGE_COLUMN_COMMENT,
   PT_CHANGE_INDEX_COMMENT,
-  PT_CHANGE_INDEX_STATUS
+  PT_CHANGE_INDEX_STATUS,
+  PT_CHANGE_TDE_ALGORITHM
 } PT_ALTER_CODE;
 
 /* Codes for trigger event type */
@@ -1569,6 +1570,7 @@ typedef enum
 typedef struct parser_varchar PARSER_VARCHAR;
 
 typedef struct parser_context PARSER_CONTEXT;
+typedef struct parser_memory PARSER_MEMORY;
 
 typedef struct parser_node PT_NODE;
 typedef struct pt_alter_info PT_ALTER_INFO;
@@ -1843,6 +1845,10 @@ struct pt_alter_info
     {
       PT_NODE *tbl_comment;	/* PT_VALUE, comment for table/view */
     } comment;
+    struct
+    {
+      int tde_algo;		/* tde algorithm for PT_CHANGE_TDE_ALGORITHM, -1 means the default algorithm */
+    } encrypt;
   } alter_clause;
   PT_NODE *constraint_list;	/* constraints from ADD and CHANGE clauses */
   PT_NODE *create_index;	/* PT_CREATE_INDEX from ALTER ADD INDEX */
@@ -3546,6 +3552,7 @@ struct parser_context
   PT_CASECMP_FUN casecmp;	/* for case insensitive comparisons */
 
   int id;			/* internal parser id */
+  PARSER_MEMORY *memory;	/* node and string blocks of the parser */
   int statement_number;		/* user-initialized, incremented by parser */
 
   const char *original_buffer;	/* pointer to the original parse buffer */
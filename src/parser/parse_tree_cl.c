@@ -5553,6 +5553,7 @@ pt_print_alter_one_clause (PARSER_CONTEXT * parser, PT_NODE * p)
   PT_NODE *names = NULL, *defaults = NULL, *attrs = NULL;
   bool close_parenthesis = false;
   unsigned int save_custom;
+  const char *tde_algo_name;
 
   switch (p->info.alter.code)
     {
@@ -5568,6 +5569,16 @@ pt_print_alter_one_clause (PARSER_CONTEXT * parser, PT_NODE * p)
       q = pt_append_nulstring (parser, q, " comment = ");
       q = pt_append_varchar (parser, q, r1);
       break;
+    case PT_CHANGE_TDE_ALGORITHM:
+      q = pt_append_nulstring (parser, q, " encrypt");
+      /* -1 (the default algorithm) has no name and is printed as a bare encrypt */
+      tde_algo_name = tde_get_algorithm_name ((TDE_ALGORITHM) p->info.alter.alter_clause.encrypt.tde_algo);
+      if (tde_algo_name != NULL)
+	{
+	  q = pt_append_nulstring (parser, q, " = ");
+	  q = pt_append_nulstring (parser, q, tde_algo_name);
+	}
+      break;
     case PT_CHANGE_COLLATION:
       if (p->info.alter.alter_clause.collation.charset != -1)
 	{
@@ -69,6 +69,7 @@ extern "C"
   extern void parser_init_func_vectors (void);
 
   extern PARSER_CONTEXT *parser_create_parser (void);
+  extern size_t parser_get_memory_size (const PARSER_CONTEXT * parser);
   extern void parser_free_parser (PARSER_CONTEXT * parser);
 
   extern PT_NODE **parser_parse_string (PARSER_CONTEXT * parser, const char *buffer);
@@ -5123,6 +5123,14 @@ pt_check_alter (PARSER_CONTEXT * parser, PT_NODE * alter)
 	    }
 	}
       break;
+    case PT_CHANGE_TDE_ALGORITHM:
+      /* only the files of a class can be encrypted */
+      if (type != PT_CLASS)
+	{
+	  PT_ERRORmf2 (parser, alter, MSGCAT_SET_PARSER_SEMANTIC, MSGCAT_SEMANTIC_IS_NOT_A, cls_nam,
+		       pt_show_misc_type (PT_CLASS));
+	}
+      break;
     default:
       break;
     }
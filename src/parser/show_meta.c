@@ -675,7 +675,9 @@ metadata_of_threads (void)
     {"Lockwait_state", "varchar(24)"},
     {"Next_wait_thread_index", "int"},
     {"Next_tran_wait_thread_index", "int"},
-    {"Next_worker_thread_index", "int"}
+    {"Next_worker_thread_index", "int"},
+    {"Wait_event", "varchar(16)"},
+    {"Wait_object", "varchar(64)"}
   };
 
   static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
@@ -725,6 +727,100 @@ metadata_of_page_buffer_status (void)
   return &md;
 }
 
+static SHOWSTMT_METADATA *
+metadata_of_page_buffer_residency (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Volume_purpose", "varchar(16)"},
+    {"Page_type", "varchar(16)"},
+    {"Num_pages", "int"},
+    {"Lru1_pages", "int"},
+    {"Lru2_pages", "int"},
+    {"Lru3_pages", "int"},
+    {"Dirty_pages", "int"},
+    {"Avg_age_in_secs", "bigint"}
+  };
+
+  static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
+    {3, ORDER_DESC}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_PAGE_BUFFER_RESIDENCY, true /* only_for_dba */ , "show page buffer residency",
+    cols, DIM (cols), orderby, DIM (orderby), NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
+static SHOWSTMT_METADATA *
+metadata_of_wait_statistics (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Wait_type", "varchar(8)"},
+    {"Resource_type", "varchar(16)"},
+    {"Lock_mode", "varchar(16)"},
+    {"Under_10us", "bigint"},
+    {"Under_100us", "bigint"},
+    {"Under_1ms", "bigint"},
+    {"Under_10ms", "bigint"},
+    {"Under_100ms", "bigint"},
+    {"Under_1s", "bigint"},
+    {"Over_1s", "bigint"},
+    {"Total_waits", "bigint"}
+  };
+
+  static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
+    {11, ORDER_DESC}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_WAIT_STATISTICS, true /* only_for_dba */ , "show wait statistics",
+    cols, DIM (cols), orderby, DIM (orderby), NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
+static SHOWSTMT_METADATA *
+metadata_of_wait_events (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Wait_event", "varchar(16)"},
+    {"Samples", "bigint"},
+    {"Avg_waiting_threads", "double"},
+    {"Waiting_threads", "int"}
+  };
+
+  static const SHOWSTMT_COLUMN_ORDERBY orderby[] = {
+    {2, ORDER_DESC}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_WAIT_EVENTS, true /* only_for_dba */ , "show wait events",
+    cols, DIM (cols), orderby, DIM (orderby), NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
+static SHOWSTMT_METADATA *
+metadata_of_vacuum_status (void)
+{
+  static const SHOWSTMT_COLUMN cols[] = {
+    {"Worker_index", "int"},
+    {"State", "varchar(16)"},
+    {"Current_blockid", "bigint"},
+    {"Current_block_log_pageid", "bigint"},
+    {"Vacuumed_blocks", "bigint"},
+    {"Job_time_usec", "bigint"},
+    {"Blocks_per_sec", "double"}
+  };
+
+  static SHOWSTMT_METADATA md = {
+    SHOWSTMT_VACUUM_STATUS, true /* only_for_dba */ , "show vacuum status",
+    cols, DIM (cols), NULL, 0, NULL, 0, NULL, NULL
+  };
+  return &md;
+}
+
 /*
  * showstmt_get_metadata() -  return show statement column infos
  *   return:-
@@ -967,6 +1063,10 @@ showstmt_metadata_init (void)
   show_Metas[SHOWSTMT_TRAN_TABLES] = metadata_of_tran_tables ();
   show_Metas[SHOWSTMT_THREADS] = metadata_of_threads ();
   show_Metas[SHOWSTMT_PAGE_BUFFER_STATUS] = metadata_of_page_buffer_status ();
+  show_Metas[SHOWSTMT_PAGE_BUFFER_RESIDENCY] = metadata_of_page_buffer_residency ();
+  show_Metas[SHOWSTMT_WAIT_STATISTICS] = metadata_of_wait_statistics ();
+  show_Metas[SHOWSTMT_WAIT_EVENTS] = metadata_of_wait_events ();
+  show_Metas[SHOWSTMT_VACUUM_STATUS] = metadata_of_vacuum_status ();
 
   for (i = 0; i < DIM (show_Metas); i++)
     {
@@ -11766,6 +11766,7 @@ pt_to_index_info (PARSER_CONTEXT * parser, DB_OBJECT * class_, PRED_EXPR * where
   indx_infop->use_desc_index = index_entryp->use_descending;
   indx_infop->orderby_skip = index_entryp->orderby_skip;
   indx_infop->groupby_skip = index_entryp->groupby_skip;
+  indx_infop->orderby_first_key = index_entryp->orderby_first_key;
 
   /* 0 for now, see gen optimized plan for its computation */
   indx_infop->orderby_desc = 0;
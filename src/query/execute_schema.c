@@ -75,6 +75,7 @@
 #define UNIQUE_SAVEPOINT_CHANGE_DEF_COLL "cHANGEdEFAULTcOLL"
 #define UNIQUE_SAVEPOINT_CHANGE_TBL_COMMENT "cHANGEtBLcOMMENT"
 #define UNIQUE_SAVEPOINT_CHANGE_COLUMN_COMMENT "cHANGEcOLUMNcOMMENT"
+#define UNIQUE_SAVEPOINT_CHANGE_TDE_ALGORITHM "cHANGEtDEaLGORITHM"
 #define UNIQUE_SAVEPOINT_CREATE_USER_ENTITY "cREATEuSEReNTITY"
 #define UNIQUE_SAVEPOINT_DROP_USER_ENTITY "dROPuSEReNTITY"
 #define UNIQUE_SAVEPOINT_ALTER_USER_ENTITY "aLTERuSEReNTITY"
@@ -262,6 +263,7 @@ static int do_alter_change_default_cs_coll (PARSER_CONTEXT * const parser, PT_NO
 
 static int do_alter_change_tbl_comment (PARSER_CONTEXT * const parser, PT_NODE * const alter);
 static int do_alter_change_col_comment (PARSER_CONTEXT * const parser, PT_NODE * const alter);
+static int do_alter_change_tde_algorithm (PARSER_CONTEXT * const parser, PT_NODE * const alter);
 
 static int do_change_att_schema_only (PARSER_CONTEXT * parser, DB_CTMPL * ctemplate, PT_NODE * attribute,
 				      PT_NODE * old_name_node, PT_NODE * constraints, SM_ATTR_PROP_CHG * attr_chg_prop,
@@ -1691,6 +1693,9 @@ do_alter (PARSER_CONTEXT * parser, PT_NODE * alter)
 	case PT_CHANGE_COLUMN_COMMENT:
 	  error_code = do_alter_change_col_comment (parser, crt_clause);
 	  break;
+	case PT_CHANGE_TDE_ALGORITHM:
+	  error_code = do_alter_change_tde_algorithm (parser, crt_clause);
+	  break;
 	default:
 	  /* This code might not correctly handle a list of ALTER clauses so we keep crt_clause->next to NULL during
 	   * its execution just to be on the safe side. */
@@ -10123,6 +10128,187 @@ exit:
   return error;
 }
 
+/*
+ * do_alter_change_tde_algorithm() - change the tde algorithm of the table
+ *   return: Error code
+ *   parser(in): Parser context
+ *   alter(in/out): Parse tree of a PT_CHANGE_TDE_ALGORITHM clause
+ *
+ * Note: The algorithm is changed in the class records of the class and its partitions first, then the files of each
+ *       one are encrypted or decrypted page by page on the server (see file_apply_tde_algorithm ()).
+ */
+static int
+do_alter_change_tde_algorithm (PARSER_CONTEXT * const parser, PT_NODE * const alter)
+{
+  int error = NO_ERROR;
+  const char *entity_name = NULL;
+  DB_OBJECT *class_obj = NULL;
+  DB_CTMPL *ctemplate = NULL;
+  PT_ALTER_INFO *alter_info;
+  bool tran_saved = false;
+  TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
+  TDE_ALGORITHM prev_tde_algo = TDE_ALGORITHM_NONE;
+  int i, is_partition = -1;
+  MOP *sub_partitions = NULL;
+
+  alter_info = &(alter->info.alter);
+  assert (alter_info->code == PT_CHANGE_TDE_ALGORITHM);
+
+  if (alter_info->alter_clause.encrypt.tde_algo == -1)
+    {
+      tde_algo = (TDE_ALGORITHM) prm_get_integer_value (PRM_ID_TDE_DEFAULT_ALGORITHM);
+    }
+  else
+    {
+      tde_algo = (TDE_ALGORITHM) alter_info->alter_clause.encrypt.tde_algo;
+    }
+
+  entity_name = alter_info->entity_name->info.name.original;
+  if (entity_name == NULL)
+    {
+      error = ER_UNEXPECTED;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 1, "Expecting a class name.");
+      goto exit;
+    }
+
+  error = tran_system_savepoint (UNIQUE_SAVEPOINT_CHANGE_TDE_ALGORITHM);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+  tran_saved = true;
+
+  class_obj = db_find_class (entity_name);
+  if (class_obj == NULL)
+    {
+      assert (er_errid () != NO_ERROR);
+      error = er_errid ();
+      goto exit;
+    }
+
+  error = locator_flush_class (class_obj);
+  if (error != NO_ERROR)
+    {
+      /* don't overwrite error */
+      goto exit;
+    }
+
+  /* get exclusive lock on class */
+  if (locator_fetch_class (class_obj, DB_FETCH_WRITE) == NULL)
+    {
+      error = ER_FAILED;
+      goto exit;
+    }
+
+  error = sm_get_class_tde_algorithm (class_obj, &prev_tde_algo);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  if (prev_tde_algo == tde_algo)
+    {
+      /* nothing to do */
+      goto exit;
+    }
+
+  ctemplate = dbt_edit_class (class_obj);
+  if (ctemplate == NULL)
+    {
+      /* when dbt_edit_class fails (e.g. because the server unilaterally aborts us), we must record the associated
+       * error message into the parser.  Otherwise, we may get a confusing error msg of the form: "so_and_so is not a
+       * class". */
+      pt_record_error (parser, parser->statement_number - 1, alter->line_number, alter->column_number, er_msg (), NULL);
+      error = er_errid ();
+      goto exit;
+    }
+
+  error = sm_set_class_tde_algorithm (ctemplate->op, tde_algo);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  error = sm_partitioned_class_type (ctemplate->op, &is_partition, NULL, &sub_partitions);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  if (is_partition == DB_PARTITIONED_CLASS)
+    {
+      for (i = 0; sub_partitions[i]; i++)
+	{
+	  error = sm_set_class_tde_algorithm (sub_partitions[i], tde_algo);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	}
+    }
+
+  /* force schema update to server */
+  class_obj = dbt_finish_class (ctemplate);
+  if (class_obj == NULL)
+    {
+      assert (er_errid () != NO_ERROR);
+      error = er_errid ();
+      goto exit;
+    }
+  /* set NULL, avoid 'abort_class' in case of error */
+  ctemplate = NULL;
+
+  /* the server reads the algorithm from the class records */
+  error = locator_flush_class (class_obj);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  error = file_apply_tde_to_class_files (&class_obj->oid_info.oid);
+  if (error != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  if (is_partition == DB_PARTITIONED_CLASS)
+    {
+      for (i = 0; sub_partitions[i]; i++)
+	{
+	  error = locator_flush_class (sub_partitions[i]);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+
+	  error = file_apply_tde_to_class_files (&sub_partitions[i]->oid_info.oid);
+	  if (error != NO_ERROR)
+	    {
+	      goto exit;
+	    }
+	}
+    }
+
+exit:
+  if (ctemplate != NULL)
+    {
+      dbt_abort_class (ctemplate);
+      ctemplate = NULL;
+    }
+
+  if (sub_partitions)
+    {
+      free_and_init (sub_partitions);
+    }
+
+  if (error != NO_ERROR && tran_saved && error != ER_LK_UNILATERALLY_ABORTED)
+    {
+      (void) tran_abort_upto_system_savepoint (UNIQUE_SAVEPOINT_CHANGE_TDE_ALGORITHM);
+    }
+
+  return error;
+}
+
 /*
  * do_alter_change_col_comment() - change the column comment
  *   return: Error code
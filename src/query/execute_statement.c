@@ -178,6 +178,8 @@ static int do_prepare_insert_internal (PARSER_CONTEXT * parser, PT_NODE * statem
 static int do_insert_template (PARSER_CONTEXT * parser, DB_OTMPL ** otemplate, PT_NODE * statement,
 			       const char **savepoint_name, int *row_count_ptr);
 static void init_compile_context (PARSER_CONTEXT * parser);
+static bool do_find_cached_xasl_id (const SHA1Hash * sha1, XASL_STREAM * stream);
+static void do_cache_xasl_id (const XASL_ID * xasl_id, int xasl_flag);
 
 static int do_select_internal (PARSER_CONTEXT * parser, PT_NODE * statement, bool for_ins_upd);
 
@@ -14065,6 +14067,279 @@ do_select_internal (PARSER_CONTEXT * parser, PT_NODE * statement, bool for_ins_u
   return error;
 }
 
+/*
+ * The client keeps the XASL_IDs the server returned for the prepared queries, keyed by the SHA-1 of the query string
+ * (printed after the rewrite and the auto-parameterization of the literals). Preparing again a query with the same
+ * string, even with other literals, then needs no request to the server. A cached XASL_ID can be stale, when the
+ * server dropped or replaced the entry: the execution fails with ER_QPROC_INVALID_XASLNODE, the cached XASL_ID is
+ * forgotten and the statement is prepared again.
+ * The cache is direct mapped, a new XASL_ID replaces the one in its slot.
+ */
+typedef struct do_xasl_id_cache_entry DO_XASL_ID_CACHE_ENTRY;
+struct do_xasl_id_cache_entry
+{
+  XASL_ID xasl_id;
+  int xasl_flag;		/* XASL header flag, to check the limit optimizations */
+  bool is_used;
+};
+
+static DO_XASL_ID_CACHE_ENTRY *do_Xasl_id_cache = NULL;
+static int do_Xasl_id_cache_size = 0;
+
+#define DO_XASL_ID_CACHE_SLOT(sha1) \
+  (&do_Xasl_id_cache[(unsigned int) (sha1)->h[0] % (unsigned int) do_Xasl_id_cache_size])
+
+/*
+ * The processes of a broker can share the cache through an area of the broker shared memory (see
+ * do_share_xasl_id_cache), so a new process, or one its clients just moved to, prepares the queries the others
+ * already prepared without asking the server. The shared entries are versioned: a writer makes the version odd while
+ * it changes the entry, and a reader that sees an odd or changed version misses. A writer that finds the entry being
+ * written does not wait and gives up, the cache is only a hint.
+ * XASL_IDs of different servers can be mixed, a server can only match its own (SHA-1 and time stored) and fails the
+ * others like stale ones.
+ */
+typedef struct do_shared_xasl_id_entry DO_SHARED_XASL_ID_ENTRY;
+struct do_shared_xasl_id_entry
+{
+  volatile UINT32 version;	/* odd while the entry is written */
+  int xasl_flag;
+  XASL_ID xasl_id;
+  bool is_used;
+};
+
+static DO_SHARED_XASL_ID_ENTRY *do_Shared_xasl_id_cache = NULL;
+static int do_Shared_xasl_id_cache_size = 0;
+
+#define DO_SHARED_XASL_ID_CACHE_SLOT(sha1) \
+  (&do_Shared_xasl_id_cache[(unsigned int) (sha1)->h[0] % (unsigned int) do_Shared_xasl_id_cache_size])
+
+static bool do_lock_shared_xasl_id_entry (DO_SHARED_XASL_ID_ENTRY * entry);
+static void do_unlock_shared_xasl_id_entry (DO_SHARED_XASL_ID_ENTRY * entry);
+static bool do_read_shared_xasl_id_entry (DO_SHARED_XASL_ID_ENTRY * entry, DO_SHARED_XASL_ID_ENTRY * copy);
+
+/*
+ * do_share_xasl_id_cache () - use an area of memory shared with other processes as the cache of XASL_IDs
+ *   return: nothing
+ *   area(in): zeroed shared memory; NULL stops sharing
+ *   area_size(in): size of area
+ *
+ * Note: the area has to be aligned for the entries and zeroed when it is created; the entries are never reset.
+ */
+void
+do_share_xasl_id_cache (void *area, int area_size)
+{
+  if (area == NULL || area_size < (int) sizeof (DO_SHARED_XASL_ID_ENTRY)
+      || prm_get_integer_value (PRM_ID_CLIENT_PLAN_CACHE_ENTRIES) <= 0)
+    {
+      do_Shared_xasl_id_cache = NULL;
+      do_Shared_xasl_id_cache_size = 0;
+      return;
+    }
+
+  do_Shared_xasl_id_cache = (DO_SHARED_XASL_ID_ENTRY *) area;
+  do_Shared_xasl_id_cache_size = area_size / (int) sizeof (DO_SHARED_XASL_ID_ENTRY);
+}
+
+static bool
+do_lock_shared_xasl_id_entry (DO_SHARED_XASL_ID_ENTRY * entry)
+{
+  UINT32 version = ATOMIC_LOAD (&entry->version);
+
+  if ((version & 1) != 0)
+    {
+      return false;
+    }
+  return ATOMIC_CAS_32 (&entry->version, version, version + 1);
+}
+
+static void
+do_unlock_shared_xasl_id_entry (DO_SHARED_XASL_ID_ENTRY * entry)
+{
+  MEMORY_BARRIER ();
+  (void) ATOMIC_INC_32 (&entry->version, 1);
+}
+
+/*
+ * do_read_shared_xasl_id_entry () - copy a shared entry
+ *   return: false if the entry was written meanwhile
+ */
+static bool
+do_read_shared_xasl_id_entry (DO_SHARED_XASL_ID_ENTRY * entry, DO_SHARED_XASL_ID_ENTRY * copy)
+{
+  UINT32 version = ATOMIC_LOAD (&entry->version);
+
+  if ((version & 1) != 0)
+    {
+      return false;
+    }
+
+  MEMORY_BARRIER ();
+  copy->xasl_flag = entry->xasl_flag;
+  XASL_ID_COPY (&copy->xasl_id, &entry->xasl_id);
+  copy->is_used = entry->is_used;
+  MEMORY_BARRIER ();
+
+  return ATOMIC_LOAD (&entry->version) == version;
+}
+
+/*
+ * do_find_cached_xasl_id () - find the XASL_ID of a query in the client cache
+ *   return: true if found
+ *   sha1(in): SHA-1 of the query string
+ *   stream(out): gets a copy of the XASL_ID and the XASL header flag
+ */
+static bool
+do_find_cached_xasl_id (const SHA1Hash * sha1, XASL_STREAM * stream)
+{
+  DO_XASL_ID_CACHE_ENTRY *entry;
+  DO_SHARED_XASL_ID_ENTRY shared_entry;
+  const XASL_ID *xasl_id;
+  int xasl_flag;
+
+  if (do_Shared_xasl_id_cache != NULL)
+    {
+      if (!do_read_shared_xasl_id_entry (DO_SHARED_XASL_ID_CACHE_SLOT (sha1), &shared_entry)
+	  || !shared_entry.is_used || SHA1Compare ((void *) &shared_entry.xasl_id.sha1, (void *) sha1) != 0)
+	{
+	  return false;
+	}
+      xasl_id = &shared_entry.xasl_id;
+      xasl_flag = shared_entry.xasl_flag;
+    }
+  else
+    {
+      if (do_Xasl_id_cache == NULL)
+	{
+	  return false;
+	}
+
+      entry = DO_XASL_ID_CACHE_SLOT (sha1);
+      if (!entry->is_used || SHA1Compare ((void *) &entry->xasl_id.sha1, (void *) sha1) != 0)
+	{
+	  return false;
+	}
+      xasl_id = &entry->xasl_id;
+      xasl_flag = entry->xasl_flag;
+    }
+
+  stream->xasl_id = (XASL_ID *) malloc (sizeof (XASL_ID));
+  if (stream->xasl_id == NULL)
+    {
+      /* just ask the server */
+      er_clear ();
+      return false;
+    }
+  XASL_ID_COPY (stream->xasl_id, xasl_id);
+  stream->xasl_header->xasl_flag = xasl_flag;
+
+  return true;
+}
+
+/*
+ * do_cache_xasl_id () - keep the XASL_ID of a prepared query in the client cache
+ *   return: nothing
+ *   xasl_id(in): XASL_ID returned by the server
+ *   xasl_flag(in): XASL header flag
+ */
+static void
+do_cache_xasl_id (const XASL_ID * xasl_id, int xasl_flag)
+{
+  DO_XASL_ID_CACHE_ENTRY *entry;
+
+  if (do_Shared_xasl_id_cache != NULL)
+    {
+      DO_SHARED_XASL_ID_ENTRY *shared_entry = DO_SHARED_XASL_ID_CACHE_SLOT (&xasl_id->sha1);
+
+      if (do_lock_shared_xasl_id_entry (shared_entry))
+	{
+	  XASL_ID_COPY (&shared_entry->xasl_id, xasl_id);
+	  shared_entry->xasl_flag = xasl_flag;
+	  shared_entry->is_used = true;
+	  do_unlock_shared_xasl_id_entry (shared_entry);
+	}
+      return;
+    }
+
+  if (do_Xasl_id_cache == NULL)
+    {
+      if (prm_get_integer_value (PRM_ID_CLIENT_PLAN_CACHE_ENTRIES) <= 0)
+	{
+	  return;
+	}
+
+      do_Xasl_id_cache_size = prm_get_integer_value (PRM_ID_CLIENT_PLAN_CACHE_ENTRIES);
+      do_Xasl_id_cache = (DO_XASL_ID_CACHE_ENTRY *) calloc (do_Xasl_id_cache_size, sizeof (DO_XASL_ID_CACHE_ENTRY));
+      if (do_Xasl_id_cache == NULL)
+	{
+	  /* not cached */
+	  do_Xasl_id_cache_size = 0;
+	  return;
+	}
+    }
+
+  entry = DO_XASL_ID_CACHE_SLOT (&xasl_id->sha1);
+  XASL_ID_COPY (&entry->xasl_id, xasl_id);
+  entry->xasl_flag = xasl_flag;
+  entry->is_used = true;
+}
+
+/*
+ * do_forget_cached_xasl_id () - remove an XASL_ID the server does not know anymore from the client cache
+ *   return: nothing
+ *   xasl_id(in): XASL_ID of the statement
+ */
+void
+do_forget_cached_xasl_id (const XASL_ID * xasl_id)
+{
+  DO_XASL_ID_CACHE_ENTRY *entry;
+
+  if (do_Shared_xasl_id_cache != NULL && xasl_id != NULL)
+    {
+      DO_SHARED_XASL_ID_ENTRY *shared_entry = DO_SHARED_XASL_ID_CACHE_SLOT (&xasl_id->sha1);
+
+      if (do_lock_shared_xasl_id_entry (shared_entry))
+	{
+	  if (shared_entry->is_used
+	      && SHA1Compare ((void *) &shared_entry->xasl_id.sha1, (void *) &xasl_id->sha1) == 0)
+	    {
+	      shared_entry->is_used = false;
+	    }
+	  do_unlock_shared_xasl_id_entry (shared_entry);
+	}
+      return;
+    }
+
+  if (do_Xasl_id_cache == NULL || xasl_id == NULL)
+    {
+      return;
+    }
+
+  entry = DO_XASL_ID_CACHE_SLOT (&xasl_id->sha1);
+  if (entry->is_used && SHA1Compare ((void *) &entry->xasl_id.sha1, (void *) &xasl_id->sha1) == 0)
+    {
+      entry->is_used = false;
+    }
+}
+
+/*
+ * do_final_xasl_id_cache () - free the client cache of XASL_IDs
+ *   return: nothing
+ *
+ * Note: the XASL_IDs are only valid on the server that returned them, the cache is freed when the client shuts down.
+ *       the client stops using a shared cache, which is left to the other processes.
+ */
+void
+do_final_xasl_id_cache (void)
+{
+  do_Shared_xasl_id_cache = NULL;
+  do_Shared_xasl_id_cache_size = 0;
+  if (do_Xasl_id_cache != NULL)
+    {
+      free_and_init (do_Xasl_id_cache);
+    }
+  do_Xasl_id_cache_size = 0;
+}
+
 /*
  * do_prepare_select() - Prepare the SELECT statement including optimization and
  *                       plan generation, and creating XASL as the result
@@ -14079,6 +14354,7 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
 {
   int err = NO_ERROR;
   int au_save;
+  int xasl_flag = 0;
 
   COMPILE_CONTEXT *contextp;
   XASL_STREAM stream;
@@ -14145,7 +14421,10 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
       XASL_NODE_HEADER xasl_header;
       stream.xasl_header = &xasl_header;
 
-      err = prepare_query (contextp, &stream);
+      if (!do_find_cached_xasl_id (&contextp->sha1, &stream))
+	{
+	  err = prepare_query (contextp, &stream);
+	}
       if (err != NO_ERROR)
 	{
 	  ASSERT_ERROR_AND_SET (err);
@@ -14162,6 +14441,7 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
 	{
 	  /* check xasl header */
 	  /* TODO: we can treat the different cases of MRO by hacking query string. */
+	  xasl_flag = stream.xasl_header->xasl_flag;
 	  if (pt_recompile_for_limit_optimizations (parser, statement, stream.xasl_header->xasl_flag))
 	    {
 	      contextp->recompile_xasl = true;
@@ -14190,6 +14470,7 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
 
       if (contextp->xasl && (err == NO_ERROR) && !pt_has_error (parser))
 	{
+	  xasl_flag = contextp->xasl->header.xasl_flag;
 	  /* convert the created XASL tree to the byte stream for transmission to the server */
 	  err = xts_map_xasl_to_stream (contextp->xasl, &stream);
 	  if (err != NO_ERROR)
@@ -14251,6 +14532,11 @@ do_prepare_select (PARSER_CONTEXT * parser, PT_NODE * statement)
 	}
     }
 
+  if (err == NO_ERROR && stream.xasl_id != NULL)
+    {
+      do_cache_xasl_id (stream.xasl_id, xasl_flag);
+    }
+
   /* save the XASL_ID that is allocated and returned by prepare_query() into 'statement->xasl_id' to be used by
    * do_execute_select() */
   statement->xasl_id = stream.xasl_id;
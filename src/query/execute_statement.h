@@ -58,6 +58,10 @@ typedef int (PT_DO_FUNC) (PARSER_CONTEXT *, PT_NODE *);
 
 extern bool do_Trigger_involved;
 
+extern void do_share_xasl_id_cache (void *area, int area_size);
+extern void do_forget_cached_xasl_id (const XASL_ID * xasl_id);
+extern void do_final_xasl_id_cache (void);
+
 extern int do_alter (PARSER_CONTEXT * parser, PT_NODE * statement);
 
 extern int do_alter_index (PARSER_CONTEXT * parser, const PT_NODE * statement);
@@ -3792,20 +3792,25 @@ fetch_peek_dbval (THREAD_ENTRY * thread_p, REGU_VARIABLE * regu_var, val_descr *
       REGU_VARIABLE_SET_FLAG (regu_var, REGU_VARIABLE_FETCH_NOT_CONST);
       assert (!REGU_VARIABLE_IS_FLAGED (regu_var, REGU_VARIABLE_FETCH_ALL_CONST));
       *peek_dbval = regu_var->value.attr_descr.cache_dbvalp;
-      if (*peek_dbval != NULL)
-	{
-	  /* we have a cached pointer already */
-	  break;
-	}
-      else
+      if (*peek_dbval == NULL)
 	{
 	  *peek_dbval = heap_attrinfo_access (regu_var->value.attr_descr.id, regu_var->value.attr_descr.cache_attrinfo);
 	  if (*peek_dbval == NULL)
 	    {
 	      goto exit_on_error;
 	    }
+	  regu_var->value.attr_descr.cache_dbvalp = *peek_dbval;	/* cache */
+	}
+      /* else, we have a cached pointer already */
+
+      if (regu_var->value.attr_descr.cache_attrinfo->lazy_recdes != NULL)
+	{
+	  /* the value may not be read from the record yet */
+	  if (heap_attrinfo_read_lazy_dbvalue (*peek_dbval, regu_var->value.attr_descr.cache_attrinfo) != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
 	}
-      regu_var->value.attr_descr.cache_dbvalp = *peek_dbval;	/* cache */
       break;
 
     case TYPE_OID:		/* fetch object identifier value */
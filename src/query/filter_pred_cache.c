@@ -25,6 +25,8 @@
 #include "binaryheap.h"
 #include "filter_pred_cache.h"
 #include "lock_free.h"
+#include "object_representation_sr.h"
+#include "perf_monitor.h"
 #include "query_executor.h"
 #include "stream_to_xasl.h"
 #include "system_parameter.h"
@@ -52,6 +54,8 @@ struct fpcache_ent
 
   PRED_EXPR_WITH_CONTEXT **clone_stack;
   INT32 clone_stack_head;
+  INT32 clone_stack_size;	/* current capacity of clone_stack; grows up to fpcache_Clone_stack_max */
+  INT32 n_clone_miss;		/* clone misses since clone_stack last grew */
 
   // *INDENT-OFF*
   fpcache_ent ();
@@ -76,6 +80,7 @@ static LF_FREELIST fpcache_Ht_freelist = LF_FREELIST_INITIALIZER;
 static volatile INT32 fpcache_Entry_counter = 0;
 static volatile INT32 fpcache_Clone_counter = 0;
 static int fpcache_Clone_stack_size;
+static int fpcache_Clone_stack_max;
 
 /* Cleanup */
 typedef struct fpcache_cleanup_candidate FPCACHE_CLEANUP_CANDIDATE;
@@ -101,6 +106,10 @@ static INT64 fpcache_Stat_clone_discard;
 static INT64 fpcache_Stat_clone_add;
 static INT64 fpcache_Stat_cleanup;
 static INT64 fpcache_Stat_cleanup_entry;
+static INT64 fpcache_Stat_clone_grow;
+static INT64 fpcache_Stat_unpack;
+static INT64 fpcache_Stat_unpack_usec;
+static INT64 fpcache_Stat_prewarm;
 
 /* fpcache_Entry_descriptor - used for latch-free hash table.
  * we have to declare member functions before instantiating fpcache_Entry_descriptor.
@@ -111,6 +120,8 @@ static int fpcache_entry_init (void *entry);
 static int fpcache_entry_uninit (void *entry);
 static int fpcache_copy_key (void *src, void *dest);
 static void fpcache_cleanup (THREAD_ENTRY * thread_p);
+static int fpcache_unpack (THREAD_ENTRY * thread_p, or_predicate * or_pred, pred_expr_with_context ** filter_pred);
+static bool fpcache_grow_clone_stack (FPCACHE_ENTRY * fpcache_entry);
 static BH_CMP_RESULT fpcache_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ingore_arg);
 
 static LF_ENTRY_DESCRIPTOR fpcache_Entry_descriptor = {
@@ -163,6 +174,8 @@ fpcache_initialize (THREAD_ENTRY * thread_p)
   fpcache_Clone_counter = 0;
 
   fpcache_Clone_stack_size = prm_get_integer_value (PRM_ID_FILTER_PRED_MAX_CACHE_CLONES);
+  fpcache_Clone_stack_max =
+    std::max (fpcache_Clone_stack_size, prm_get_integer_value (PRM_ID_FILTER_PRED_MAX_ADAPTIVE_CLONES));
 
   /* Cleanup */
   /* Use global heap to allocate binary heap. */
@@ -191,6 +204,10 @@ fpcache_initialize (THREAD_ENTRY * thread_p)
   fpcache_Stat_clone_discard = 0;
   fpcache_Stat_cleanup = 0;
   fpcache_Stat_cleanup_entry = 0;
+  fpcache_Stat_clone_grow = 0;
+  fpcache_Stat_unpack = 0;
+  fpcache_Stat_unpack_usec = 0;
+  fpcache_Stat_prewarm = 0;
 
   fpcache_Enabled = true;
   return NO_ERROR;
@@ -290,6 +307,8 @@ fpcache_entry_init (void *entry)
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
   fpcache_entry->clone_stack_head = -1;
+  fpcache_entry->clone_stack_size = fpcache_Clone_stack_size;
+  fpcache_entry->n_clone_miss = 0;
   return NO_ERROR;
 }
 
@@ -382,14 +401,17 @@ fpcache_claim (THREAD_ENTRY * thread_p, BTID * btid, or_predicate * or_pred, pre
 	  if (fpcache_entry->clone_stack_head >= 0)
 	    {
 	      /* Available filter predicate expression. */
-	      assert (fpcache_entry->clone_stack_head < fpcache_Clone_stack_size);
+	      assert (fpcache_entry->clone_stack_head < fpcache_entry->clone_stack_size);
 	      *filter_pred = fpcache_entry->clone_stack[fpcache_entry->clone_stack_head--];
 	      ATOMIC_INC_64 (&fpcache_Stat_clone_hit, 1);
 	      ATOMIC_INC_32 (&fpcache_Clone_counter, -1);
+	      perfmon_inc_stat (thread_p, PSTAT_FPC_NUM_CLONE_HIT);
 	    }
 	  else
 	    {
-	      /* No filter predicate expression is available. */
+	      /* No filter predicate expression is available. Remember it, so the entry keeps one more clone when this
+	       * one is retired. */
+	      fpcache_entry->n_clone_miss++;
 	      ATOMIC_INC_64 (&fpcache_Stat_clone_miss, 1);
 	    }
 	  /* Unlock hash-table entry. */
@@ -400,19 +422,88 @@ fpcache_claim (THREAD_ENTRY * thread_p, BTID * btid, or_predicate * or_pred, pre
   if (*filter_pred == NULL)
     {
       /* Allocate new filter predicate expression. */
-      /* Use global heap as other threads may also use this filter predicate expression. */
-      HL_HEAPID old_private_heap = db_change_private_heap (thread_p, 0);
-      error_code =
-	stx_map_stream_to_filter_pred (thread_p, filter_pred, or_pred->pred_stream, or_pred->pred_stream_size);
+      perfmon_inc_stat (thread_p, PSTAT_FPC_NUM_CLONE_MISS);
+      error_code = fpcache_unpack (thread_p, or_pred, filter_pred);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
 	}
-      (void) db_change_private_heap (thread_p, old_private_heap);
     }
   return NO_ERROR;
 }
 
+/*
+ * fpcache_unpack () - Unpack a new filter predicate expression from its stream.
+ *
+ * return            : Error code.
+ * thread_p (in)     : Thread entry.
+ * or_pred (in)      : Filter predicate (string and stream).
+ * filter_pred (out) : Filter predicate expression (with context - unpack buffer).
+ */
+static int
+fpcache_unpack (THREAD_ENTRY * thread_p, or_predicate * or_pred, pred_expr_with_context ** filter_pred)
+{
+  TSC_TICKS start_tick, end_tick;
+  UINT64 elapsed_usec;
+  HL_HEAPID old_private_heap;
+  int error_code;
+
+  tsc_getticks (&start_tick);
+
+  /* Use global heap as other threads may also use this filter predicate expression. */
+  old_private_heap = db_change_private_heap (thread_p, 0);
+  error_code = stx_map_stream_to_filter_pred (thread_p, filter_pred, or_pred->pred_stream, or_pred->pred_stream_size);
+  (void) db_change_private_heap (thread_p, old_private_heap);
+
+  /* The elapsed time is kept for fpcache_dump too, so it is measured even if perfmon is not tracking. */
+  tsc_getticks (&end_tick);
+  elapsed_usec = tsc_elapsed_utime (end_tick, start_tick);
+  if (perfmon_is_perf_tracking ())
+    {
+      perfmon_time_stat (thread_p, PSTAT_FPC_UNPACK_PRED, elapsed_usec);
+    }
+
+  ATOMIC_INC_64 (&fpcache_Stat_unpack, 1);
+  ATOMIC_INC_64 (&fpcache_Stat_unpack_usec, (INT64) elapsed_usec);
+  return error_code;
+}
+
+/*
+ * fpcache_grow_clone_stack () - Grow the clone stack of an entry that missed clones since it last grew. The stack
+ *                               is full when this is called and the capacity is doubled, up to
+ *                               fpcache_Clone_stack_max.
+ *
+ * return             : True if there is room for another clone.
+ * fpcache_entry (in) : Filter predicate cache entry (its mutex is locked).
+ */
+static bool
+fpcache_grow_clone_stack (FPCACHE_ENTRY * fpcache_entry)
+{
+  PRED_EXPR_WITH_CONTEXT **new_stack;
+  int new_size;
+
+  if (fpcache_entry->n_clone_miss == 0 || fpcache_entry->clone_stack_size >= fpcache_Clone_stack_max)
+    {
+      /* The clones we have were enough, or we cannot keep more. */
+      return false;
+    }
+
+  new_size = std::min (fpcache_Clone_stack_max, std::max (1, fpcache_entry->clone_stack_size * 2));
+  new_stack = (PRED_EXPR_WITH_CONTEXT **) realloc (fpcache_entry->clone_stack,
+						   new_size * sizeof (PRED_EXPR_WITH_CONTEXT *));
+  if (new_stack == NULL)
+    {
+      /* Not critical. Keep the current stack. */
+      return false;
+    }
+
+  fpcache_entry->clone_stack = new_stack;
+  fpcache_entry->clone_stack_size = new_size;
+  fpcache_entry->n_clone_miss = 0;
+  ATOMIC_INC_64 (&fpcache_Stat_clone_grow, 1);
+  return true;
+}
+
 /*
  * fpcache_retire () - Retire filter predicate expression; if the filter predicate hash entry is already at maximum
  *                     capacity, the predicate expression must be freed.
@@ -457,7 +548,8 @@ fpcache_retire (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid, pred_expr
 	      assert (OID_EQ (&fpcache_entry->class_oid, class_oid));
 	    }
 	  /* save filter_pred for later usage. */
-	  if (fpcache_entry->clone_stack_head < fpcache_Clone_stack_size - 1)
+	  if (fpcache_entry->clone_stack_head < fpcache_entry->clone_stack_size - 1
+	      || fpcache_grow_clone_stack (fpcache_entry))
 	    {
 	      /* Can save filter predicate expression. */
 	      fpcache_entry->clone_stack[++fpcache_entry->clone_stack_head] = filter_pred;
@@ -492,6 +584,68 @@ fpcache_retire (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid, pred_expr
   return error_code;
 }
 
+/*
+ * fpcache_prewarm () - Unpack one filter predicate expression for each filtered index of a class that has none in
+ *                      cache, so the first rows inserted or updated in the class do not pay for it.
+ *
+ * return         : Void.
+ * thread_p (in)  : Thread entry.
+ * class_oid (in) : Class OID.
+ * classrep (in)  : Class representation just loaded in cache.
+ *
+ * NOTE: Pre-warming is best-effort; a predicate that cannot be unpacked is left to fpcache_claim.
+ */
+void
+fpcache_prewarm (THREAD_ENTRY * thread_p, const OID * class_oid, OR_CLASSREP * classrep)
+{
+  FPCACHE_ENTRY *fpcache_entry = NULL;
+  PRED_EXPR_WITH_CONTEXT *filter_pred = NULL;
+  OR_INDEX *index = NULL;
+  OID oid;
+  int i;
+
+  if (!fpcache_Enabled || fpcache_Clone_stack_size <= 0 || classrep == NULL)
+    {
+      return;
+    }
+
+  /* The caller must not see errors of pre-warming. */
+  er_stack_push ();
+
+  COPY_OID (&oid, class_oid);
+  for (i = 0; i < classrep->n_indexes; i++)
+    {
+      index = &classrep->indexes[i];
+      if (index->filter_predicate == NULL || index->filter_predicate->pred_stream == NULL)
+	{
+	  continue;
+	}
+
+      fpcache_entry = fpcache_Hashmap.find (thread_p, index->btid);
+      if (fpcache_entry != NULL)
+	{
+	  bool has_clone = fpcache_entry->clone_stack_head >= 0;
+
+	  pthread_mutex_unlock (&fpcache_entry->mutex);
+	  if (has_clone)
+	    {
+	      /* Already warm. */
+	      continue;
+	    }
+	}
+
+      filter_pred = NULL;
+      if (fpcache_unpack (thread_p, index->filter_predicate, &filter_pred) != NO_ERROR || filter_pred == NULL)
+	{
+	  continue;
+	}
+      ATOMIC_INC_64 (&fpcache_Stat_prewarm, 1);
+      (void) fpcache_retire (thread_p, &oid, &index->btid, filter_pred);
+    }
+
+  er_stack_pop ();
+}
+
 /*
  * fpcache_remove_by_class () - Remove all filter predicate cache entries belonging to the given class.
  *
@@ -620,6 +774,10 @@ fpcache_dump (THREAD_ENTRY * thread_p, FILE * fp)
   fprintf (fp, "Clone adds:                 %lld\n", (long long) ATOMIC_LOAD_64 (&fpcache_Stat_clone_add));
   fprintf (fp, "Cleanups:                   %lld\n", (long long) ATOMIC_LOAD_64 (&fpcache_Stat_cleanup));
   fprintf (fp, "Cleaned entries:            %lld\n", (long long) ATOMIC_LOAD_64 (&fpcache_Stat_cleanup_entry));
+  fprintf (fp, "Clone stack grows:          %lld\n", (long long) ATOMIC_LOAD_64 (&fpcache_Stat_clone_grow));
+  fprintf (fp, "Unpacks:                    %lld\n", (long long) ATOMIC_LOAD_64 (&fpcache_Stat_unpack));
+  fprintf (fp, "Unpack time (usec):         %lld\n", (long long) ATOMIC_LOAD_64 (&fpcache_Stat_unpack_usec));
+  fprintf (fp, "Prewarmed clones:           %lld\n", (long long) ATOMIC_LOAD_64 (&fpcache_Stat_prewarm));
 
   fpcache_hashmap_iterator iter = { thread_p, fpcache_Hashmap };
   fprintf (fp, "\nEntries:\n");
@@ -627,7 +785,8 @@ fpcache_dump (THREAD_ENTRY * thread_p, FILE * fp)
     {
       fprintf (fp, "\n  BTID = %d, %d|%d\n", fpcache_entry->btid.root_pageid, fpcache_entry->btid.vfid.volid,
 	       fpcache_entry->btid.vfid.fileid);
-      fprintf (fp, "  Clones = %d\n", fpcache_entry->clone_stack_head + 1);
+      fprintf (fp, "  Clones = %d (capacity %d)\n", fpcache_entry->clone_stack_head + 1,
+	       fpcache_entry->clone_stack_size);
     }
   /* TODO: add more. */
 }
@@ -51,6 +51,7 @@ struct heap_attrvalue
   HEAP_ATTR_TYPE attr_type;	/* Instance, class, or shared attribute */
   OR_ATTRIBUTE *last_attrepr;	/* Used for default values */
   OR_ATTRIBUTE *read_attrepr;	/* Pointer to a desired attribute information */
+  bool is_unread;		/* Not read yet from lazy_recdes of the cache */
   DB_VALUE dbvalue;		/* DB values of the attribute in memory */
 };
 
@@ -68,6 +69,8 @@ struct heap_cache_attrinfo
   int inst_chn;			/* Current chn of instance object */
   int num_values;		/* Number of desired attribute values */
   HEAP_ATTRVALUE *values;	/* Value for the attributes */
+  RECDES *lazy_recdes;		/* Record of the values that are read only when accessed, or NULL. See
+				 * heap_attrinfo_start_lazy_read */
 };
 
 #else /* !defined (SERVER_MODE) && !defined (SA_MODE) */
@@ -85,7 +85,16 @@ typedef struct qfile_cleanup_candidate QFILE_CACHE_CLEANUP_CANDIDATE;
 struct qfile_cleanup_candidate
 {
   QFILE_LIST_CACHE_ENTRY *qcache;
-  INT64 weight;
+  double weight;		/* how much keeping the entry is worth; the lowest are removed first */
+};
+
+typedef struct qfile_partition_invalidation QFILE_PARTITION_INVALIDATION;
+struct qfile_partition_invalidation
+{
+  const OID *root_oid;		/* partitioned class whose partitions were modified */
+  const OID *modified_oids;	/* modified classes; the modified partitions are among them */
+  int n_modified_oids;
+  bool del;			/* marker for qfile_end_use_of_list_cache_entry */
 };
 
 typedef SCAN_CODE (*ADVANCE_FUCTION) (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID *, QFILE_TUPLE_RECORD *,
@@ -245,6 +254,9 @@ static QFILE_LIST_ID *qfile_union_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID *
 					int flag);
 
 static SORT_STATUS qfile_get_next_sort_item (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
+static bool qfile_is_key_prefix_type (DB_TYPE type);
+static UINT64 qfile_get_key_prefix (DB_TYPE type, char *data);
+static bool qfile_compare_key_prefix (SORTKEY_INFO * key_info_p, SORT_REC * k0, SORT_REC * k1, int *order);
 static int qfile_put_next_sort_item (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
 static SORT_INFO *qfile_initialize_sort_info (SORT_INFO * info, QFILE_LIST_ID * listid, SORT_LIST * sort_list);
 static void qfile_clear_sort_info (SORT_INFO * info);
@@ -276,6 +288,9 @@ static void qfile_add_uncommitted_list_cache_entry (int tran_index, QFILE_LIST_C
 static void qfile_delete_uncommitted_list_cache_entry (int tran_index, QFILE_LIST_CACHE_ENTRY * lent);
 static int qfile_delete_list_cache_entry (THREAD_ENTRY * thread_p, void *data);
 static int qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, void *data, void *args);
+static bool qfile_is_list_cache_entry_affected (const QFILE_LIST_CACHE_ENTRY * lent,
+						const QFILE_PARTITION_INVALIDATION * inval);
+static int qfile_end_use_of_list_cache_entry_by_partitions (THREAD_ENTRY * thread_p, void *data, void *args);
 static bool qfile_is_early_time (struct timeval *a, struct timeval *b);
 
 static int qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args);
@@ -293,8 +308,8 @@ static int qfile_compare_with_interpolation_domain (char *fp0, char *fp1, SUBKEY
 static BH_CMP_RESULT
 qfile_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ignore_arg)
 {
-  INT64 left_weight = ((QFILE_CACHE_CLEANUP_CANDIDATE *) left)->weight;
-  INT64 right_weight = ((QFILE_CACHE_CLEANUP_CANDIDATE *) right)->weight;
+  double left_weight = ((QFILE_CACHE_CLEANUP_CANDIDATE *) left)->weight;
+  double right_weight = ((QFILE_CACHE_CLEANUP_CANDIDATE *) right)->weight;
 
   if (left_weight < right_weight)
     {
@@ -347,9 +362,8 @@ qfile_list_cache_cleanup (THREAD_ENTRY * thread_p)
       MHT_TABLE *ht;
       HENTRY_PTR *hvector;
       HENTRY_PTR hentry;
-      INT64 page_ref;
-      INT64 lru_sec;
-      INT64 clr_cnt;
+      double cost;
+      double size;
 
       ht = qfile_List_cache.list_hts[n];
       for (hvector = ht->table, i = 0; i < ht->size; hvector++, i++)
@@ -367,16 +381,21 @@ qfile_list_cache_cleanup (THREAD_ENTRY * thread_p)
 		      // exclude in-transaction
 		      continue;
 		    }
-		  page_ref = candidate.qcache->list_id.page_cnt / (candidate.qcache->ref_count + 1);
-		  lru_sec = current_time.tv_sec - candidate.qcache->time_last_used.tv_sec;
-		  clr_cnt = candidate.qcache->xcache_entry->clr_count + 1;
-		  candidate.weight = page_ref * lru_sec * clr_cnt;
+		  /* a result is worth keeping when it was expensive to make, is often used and takes few pages; it is
+		   * worth less the longer it has not been used and the more often its plan was cleared */
+		  cost = (double) (candidate.qcache->exec_msec + 1) * (candidate.qcache->ref_count + 1);
+		  size = (double) (candidate.qcache->list_id.page_cnt + 1)
+		    * (current_time.tv_sec - candidate.qcache->time_last_used.tv_sec + 1)
+		    * (candidate.qcache->xcache_entry->clr_count + 1);
+		  candidate.weight = cost / size;
 		  (void) bh_try_insert (bh, &candidate, NULL);
 		}
 	    }
 	}
     }
 
+  /* remove the least worth first */
+  bh_to_sorted_array (bh);
   for (candidate_index = 0; candidate_index < bh->element_count; candidate_index++)
     {
       bh_element_at (bh, candidate_index, &candidate);
@@ -1318,7 +1337,7 @@ qfile_reopen_list_as_append_mode (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_
       /* The last page is in the membuf */
       assert_release (temp_file_p->membuf_last >= list_id_p->last_vpid.pageid);
       /* The page of last record in the membuf */
-      last_page_ptr = temp_file_p->membuf[list_id_p->last_vpid.pageid];
+      last_page_ptr = QMGR_GET_MEMBUF_PAGE (temp_file_p, list_id_p->last_vpid.pageid);
     }
   else
     {
@@ -2192,6 +2211,7 @@ qfile_destroy_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p)
  *   volid(in): List file page volume identifier
  *   pageid(in): List file page identifier
  *   page_bufp(out): Buffer to contain list file page content
+ *   page_buf_size(in): Size of the buffer; as many pages as fit are copied
  *   page_sizep(out):
  *
  * Note: This routine is basically called by the C/S communication
@@ -2202,7 +2222,7 @@ qfile_destroy_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p)
  */
 int
 xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol_id, PAGEID page_id, char *page_buf_p,
-			   int *page_size_p)
+			   int page_buf_size, int *page_size_p)
 {
   QMGR_QUERY_ENTRY *query_entry_p = NULL;
   QFILE_LIST_ID *list_id_p;
@@ -2262,8 +2282,8 @@ xqfile_get_list_file_page (THREAD_ENTRY * thread_p, QUERY_ID query_id, VOLID vol
     }
 
 get_page:
-  /* append pages until a network page is full */
-  while ((*page_size_p + DB_PAGESIZE) <= IO_MAX_PAGE_SIZE)
+  /* append pages until the buffer is full */
+  while ((*page_size_p + DB_PAGESIZE) <= page_buf_size)
     {
       page_p = qmgr_get_old_page (thread_p, &vpid, tfile_vfid_p);
       if (page_p == NULL)
@@ -2303,6 +2323,11 @@ get_page:
 
       memcpy ((page_buf_p + *page_size_p), page_p, one_page_size);
       qmgr_free_old_page_and_init (thread_p, page_p, tfile_vfid_p);
+      if (one_page_size < DB_PAGESIZE && next_vpid.pageid != NULL_PAGEID)
+	{
+	  /* do not ship garbage between appended pages */
+	  memset (page_buf_p + *page_size_p + one_page_size, 0, DB_PAGESIZE - one_page_size);
+	}
 
       *page_size_p += DB_PAGESIZE;
 
@@ -3083,6 +3108,126 @@ qfile_print_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p)
  * Sorting Related Routines
  */
 
+/*
+ * qfile_is_key_prefix_type () - can the values of a type be normalized in SORT_REC.key_prefix?
+ *   return: true if they can
+ *   type(in):
+ *
+ * Note: the normalized values must compare as the values do, and have no loss: equal prefixes are equal keys.
+ */
+static bool
+qfile_is_key_prefix_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SHORT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      return true;
+
+    default:
+      /* strings compare through their collation and numerics through their scale */
+      return false;
+    }
+}
+
+/*
+ * qfile_get_key_prefix () - normalize a value to compare as an unsigned integer
+ *   return: normalized value
+ *   type(in): type of the value; qfile_is_key_prefix_type (type) is true
+ *   data(in): disk image of the value
+ */
+static UINT64
+qfile_get_key_prefix (DB_TYPE type, char *data)
+{
+  UINT64 prefix;
+  DB_BIGINT bigint;
+  DB_DATETIME datetime;
+  double d;
+  float f;
+
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+      /* flip the sign bit, so that negative values are the smaller ones */
+      return ((UINT64) (INT64) OR_GET_INT (data)) ^ ((UINT64) 1 << 63);
+
+    case DB_TYPE_SHORT:
+      return ((UINT64) (INT64) OR_GET_SHORT (data)) ^ ((UINT64) 1 << 63);
+
+    case DB_TYPE_BIGINT:
+      OR_GET_BIGINT (data, &bigint);
+      return ((UINT64) bigint) ^ ((UINT64) 1 << 63);
+
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+      if (type == DB_TYPE_FLOAT)
+	{
+	  OR_GET_FLOAT (data, &f);
+	  d = f;
+	}
+      else
+	{
+	  OR_GET_DOUBLE (data, &d);
+	}
+      if (d == 0.0)
+	{
+	  /* -0.0 equals 0.0 */
+	  d = 0.0;
+	}
+      memcpy (&prefix, &d, sizeof (prefix));
+      /* the magnitude of negative values is reversed */
+      return (prefix & ((UINT64) 1 << 63)) ? ~prefix : (prefix | ((UINT64) 1 << 63));
+
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+      /* unsigned */
+      return (UINT64) (unsigned int) OR_GET_INT (data);
+
+    case DB_TYPE_DATETIME:
+      OR_GET_DATETIME (data, &datetime);
+      return (((UINT64) datetime.date) << 32) | (UINT64) datetime.time;
+
+    default:
+      assert (false);
+      return 0;
+    }
+}
+
+/*
+ * qfile_compare_key_prefix () - compare the first keys of sort records by their prefixes
+ *   return: true if the prefixes decide the order; false if the first keys are equal or NULL
+ *   key_info_p(in):
+ *   k0(in):
+ *   k1(in):
+ *   order(out): -1, 0, or 1, strcmp-style; set only if the prefixes decide the order
+ *
+ * Note: the caller knows whether the first keys are NULL.
+ */
+static bool
+qfile_compare_key_prefix (SORTKEY_INFO * key_info_p, SORT_REC * k0, SORT_REC * k1, int *order)
+{
+  if (k0->key_prefix == k1->key_prefix)
+    {
+      return false;
+    }
+
+  *order = (k0->key_prefix < k1->key_prefix) ? -1 : 1;
+  if (key_info_p->key[0].is_desc)
+    {
+      *order = -*order;
+    }
+
+  return true;
+}
+
 /* qfile_make_sort_key () -
  *   return:
  *   info(in):
@@ -3112,6 +3257,18 @@ qfile_make_sort_key (THREAD_ENTRY * thread_p, SORTKEY_INFO * key_info_p, RECDES
   sort_record_p = (SORT_REC *) key_record_p->data;
   sort_record_p->next = NULL;
 
+  if (key_info_p->use_key_prefix)
+    {
+      /* normalize the first key; it is compared first */
+      QFILE_GET_TUPLE_VALUE_HEADER_POSITION (tuple_record_p->tpl, key_info_p->key[0].col, field_data);
+      if (QFILE_GET_TUPLE_VALUE_FLAG (field_data) == V_BOUND)
+	{
+	  sort_record_p->key_prefix =
+	    qfile_get_key_prefix (TP_DOMAIN_TYPE (key_info_p->key[0].col_dom),
+				  field_data + QFILE_TUPLE_VALUE_HEADER_SIZE);
+	}
+    }
+
   if (key_info_p->use_original)
     {
       /* P_sort_key */
@@ -3533,7 +3690,22 @@ qfile_compare_partial_sort_record (const void *pk0, const void *pk1, void *arg)
   fp1 = &(k1->s.original.body[0]);
   fp1 = PTR_ALIGN (fp1, MAX_ALIGNMENT);
 
-  for (i = 0; i < n; i++)
+  i = 0;
+  if (key_info_p->use_key_prefix && n > 0 && QFILE_GET_TUPLE_VALUE_FLAG (fp0) == V_BOUND
+      && QFILE_GET_TUPLE_VALUE_FLAG (fp1) == V_BOUND)
+    {
+      if (qfile_compare_key_prefix (key_info_p, k0, k1, &order))
+	{
+	  return order;
+	}
+
+      /* the first keys are equal; go on with the second ones */
+      fp0 += QFILE_TUPLE_VALUE_HEADER_LENGTH + QFILE_GET_TUPLE_VALUE_LENGTH (fp0);
+      fp1 += QFILE_TUPLE_VALUE_HEADER_LENGTH + QFILE_GET_TUPLE_VALUE_LENGTH (fp1);
+      i = 1;
+    }
+
+  for (; i < n; i++)
     {
       if (QFILE_GET_TUPLE_VALUE_FLAG (fp0) == V_BOUND)
 	{
@@ -3603,7 +3775,19 @@ qfile_compare_all_sort_record (const void *pk0, const void *pk1, void *arg)
   k0 = *(SORT_REC **) pk0;
   k1 = *(SORT_REC **) pk1;
 
-  for (i = 0; i < n; i++)
+  i = 0;
+  if (key_info_p->use_key_prefix && n > 0 && k0->s.offset[0] && k1->s.offset[0])
+    {
+      if (qfile_compare_key_prefix (key_info_p, k0, k1, &order))
+	{
+	  return order;
+	}
+
+      /* the first keys are equal; go on with the second ones */
+      i = 1;
+    }
+
+  for (; i < n; i++)
     {
       o0 = k0->s.offset[i];
       o1 = k1->s.offset[i];
@@ -3752,6 +3936,7 @@ qfile_initialize_sort_key_info (SORTKEY_INFO * key_info_p, SORT_LIST * list_p, Q
   key_info_p->nkeys = n;
   key_info_p->use_original = (n != types->type_cnt);
   key_info_p->error = NO_ERROR;
+  key_info_p->use_key_prefix = false;
 
   if (n <= (int) DIM (key_info_p->default_keys))
     {
@@ -3819,6 +4004,12 @@ qfile_initialize_sort_key_info (SORTKEY_INFO * key_info_p, SORT_LIST * list_p, Q
 	}
     }
 
+  if (n > 0 && prm_get_bool_value (PRM_ID_SORT_KEY_PREFIX))
+    {
+      /* the sort compares the first keys as integers, and their values only when they are equal */
+      key_info_p->use_key_prefix = qfile_is_key_prefix_type (TP_DOMAIN_TYPE (key_info_p->key[0].col_dom));
+    }
+
   return key_info_p;
 }
 
@@ -3980,7 +4171,7 @@ qfile_sort_list_with_func (THREAD_ENTRY * thread_p, QFILE_LIST_ID * list_id_p, S
 
   sort_result =
     sort_listfile (thread_p, NULL_VOLID, estimated_pages, get_func, &info, put_func, &info, cmp_func, &info.key_info,
-		   dup_option, limit, srlist_id->tfile_vfid->tde_encrypted);
+		   dup_option, limit, srlist_id->tfile_vfid->tde_encrypted, prm_get_integer_value (PRM_ID_QUERY_SORT_THREADS));
 
   if (sort_result < 0)
     {
@@ -4351,6 +4542,11 @@ qfile_scan_next (THREAD_ENTRY * thread_p, QFILE_LIST_SCAN_ID * scan_id_p)
       else if (qfile_has_next_page (scan_id_p->curr_pgptr))
 	{
 	  QFILE_GET_NEXT_VPID (&next_vpid, scan_id_p->curr_pgptr);
+	  if (next_vpid.volid != NULL_VOLID)
+	    {
+	      /* not a membuf page */
+	      pgbuf_read_ahead_sequential (thread_p, &scan_id_p->read_ahead, &next_vpid);
+	    }
 	  next_page_p = qmgr_get_old_page (thread_p, &next_vpid, scan_id_p->list_id.tfile_vfid);
 	  if (next_page_p == NULL)
 	    {
@@ -4676,6 +4872,8 @@ qfile_open_list_scan (QFILE_LIST_ID * list_id_p, QFILE_LIST_SCAN_ID * scan_id_p)
   scan_id_p->tplrec.size = 0;
   scan_id_p->tplrec.tpl = NULL;
 
+  pgbuf_read_ahead_init (&scan_id_p->read_ahead, false);
+
   return NO_ERROR;
 }
 
@@ -5185,6 +5383,82 @@ qfile_clear_list_cache (THREAD_ENTRY * thread_p, int list_ht_no, bool release)
   return NO_ERROR;
 }
 
+/*
+ * qfile_clear_list_cache_by_partitions () - Clear out the entries of a list cache hash table which may have read a
+ *					     modified partition of a partitioned class
+ *   return:
+ *   list_ht_no(in)     :
+ *   root_oid(in)       : partitioned class
+ *   modified_oids(in)  : modified classes
+ *   n_modified_oids(in):
+ *
+ * Note: An entry is cleared if one of the partitions its query scanned after pruning is modified, or if it does not
+ *       know which partitions of the class it scanned.
+ */
+int
+qfile_clear_list_cache_by_partitions (THREAD_ENTRY * thread_p, int list_ht_no, const OID * root_oid,
+				      const OID * modified_oids, int n_modified_oids)
+{
+  QFILE_PARTITION_INVALIDATION inval;
+  int rc;
+  int cnt;
+
+  if (QFILE_IS_LIST_CACHE_DISABLED)
+    {
+      return ER_FAILED;
+    }
+
+  if (qfile_List_cache.n_hts == 0 || qfile_List_cache.ht_assigned[list_ht_no] == false)
+    {
+      return ER_FAILED;
+    }
+
+  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+    {
+      return ER_FAILED;
+    }
+
+  inval.root_oid = root_oid;
+  inval.modified_oids = modified_oids;
+  inval.n_modified_oids = n_modified_oids;
+  inval.del = true;
+
+  cnt = 0;
+  do
+    {
+      rc =
+	mht_map_no_key (thread_p, qfile_List_cache.list_hts[list_ht_no],
+			qfile_end_use_of_list_cache_entry_by_partitions, &inval);
+      if (rc != NO_ERROR)
+	{
+	  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+	  thread_sleep (10);	/* 10 msec */
+	  if (csect_enter (thread_p, CSECT_QPROC_LIST_CACHE, INF_WAIT) != NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+	}
+    }
+  while (rc != NO_ERROR && cnt++ < 10);
+
+  if (rc != NO_ERROR)
+    {
+      er_log_debug (ARG_FILE_LINE, "qfile_clear_list_cache_by_partitions: failed to delete all entries\n");
+    }
+
+  if (qfile_get_list_cache_number_of_entries (list_ht_no) == 0)
+    {
+      (void) mht_clear (qfile_List_cache.list_hts[list_ht_no], NULL, NULL);
+      /* release assigned memory hash table */
+      qfile_List_cache.ht_assigned[list_ht_no] = false;
+      qfile_List_cache.next_ht_no = list_ht_no;
+    }
+
+  csect_exit (thread_p, CSECT_QPROC_LIST_CACHE);
+
+  return NO_ERROR;
+}
+
 /*
  * qfile_allocate_list_cache_entry () - Allocate the entry or get one from the pool
  *   return:
@@ -5268,6 +5542,11 @@ qfile_free_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
     }
   (void) db_change_private_heap (thread_p, old_pri_heap_id);
 
+  if (lent->pruned_oids != NULL)
+    {
+      free_and_init (lent->pruned_oids);
+    }
+
   /* if this entry is from the pool return it, else free it */
   pent = POOLED_LIST_CACHE_ENTRY_FROM_LIST_CACHE_ENTRY (lent);
   if (pent->s.next == -2)
@@ -5383,6 +5662,8 @@ qfile_print_list_cache_entry (THREAD_ENTRY * thread_p, FILE * fp, const void *ke
       fprintf (fp, "  time_last_used = %s.%d\n", str, (int) ent->time_last_used.tv_usec);
 
       fprintf (fp, "  ref_count = %d\n", ent->ref_count);
+      fprintf (fp, "  exec_msec = %lld\n", (long long) ent->exec_msec);
+      fprintf (fp, "  n_pruned_oids = %d\n", ent->n_pruned_oids);
       fprintf (fp, "  deletion_marker = %s\n", (ent->deletion_marker) ? "true" : "false");
       fprintf (fp, "}\n");
     }
@@ -5640,6 +5921,66 @@ qfile_end_use_of_list_cache_entry_local (THREAD_ENTRY * thread_p, void *data, vo
   return qfile_end_use_of_list_cache_entry (thread_p, (QFILE_LIST_CACHE_ENTRY *) data, *((bool *) args));
 }
 
+/*
+ * qfile_is_list_cache_entry_affected () - may the entry have read a modified partition
+ *   return: false if the query of the entry scanned only unmodified partitions of the class
+ *   lent(in)   :
+ *   inval(in)  :
+ */
+static bool
+qfile_is_list_cache_entry_affected (const QFILE_LIST_CACHE_ENTRY * lent, const QFILE_PARTITION_INVALIDATION * inval)
+{
+  const OID *pair;
+  bool is_pruned = false;
+  int i, j;
+
+  for (i = 0, pair = lent->pruned_oids; i < lent->n_pruned_oids; i++, pair += 2)
+    {
+      if (!OID_EQ (&pair[0], inval->root_oid))
+	{
+	  continue;
+	}
+      is_pruned = true;
+
+      if (OID_ISNULL (&pair[1]))
+	{
+	  /* pruning left no partition */
+	  continue;
+	}
+      for (j = 0; j < inval->n_modified_oids; j++)
+	{
+	  if (OID_EQ (&pair[1], &inval->modified_oids[j]))
+	    {
+	      return true;
+	    }
+	}
+    }
+
+  return !is_pruned;
+}
+
+/*
+ * qfile_end_use_of_list_cache_entry_by_partitions () - end the use of the entry if it may have read a modified
+ *							partition
+ *                               Can be used by mht_map_no_key() function
+ *   return:
+ *   data(in)   :
+ *   args(in)   : QFILE_PARTITION_INVALIDATION
+ */
+static int
+qfile_end_use_of_list_cache_entry_by_partitions (THREAD_ENTRY * thread_p, void *data, void *args)
+{
+  QFILE_LIST_CACHE_ENTRY *lent = (QFILE_LIST_CACHE_ENTRY *) data;
+  QFILE_PARTITION_INVALIDATION *inval = (QFILE_PARTITION_INVALIDATION *) args;
+
+  if (!qfile_is_list_cache_entry_affected (lent, inval))
+    {
+      return NO_ERROR;
+    }
+
+  return qfile_end_use_of_list_cache_entry (thread_p, lent, inval->del);
+}
+
 /*
  * qfile_lookup_list_cache_entry () - Lookup the list cache with the parameter
  * values (DB_VALUE array) bound to the query
@@ -5897,6 +6238,9 @@ qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
  *   params(in) :
  *   list_id(in)        :
  *   query_string(in)   :
+ *   exec_msec(in)      : how long the query took to make the result
+ *   pruned_oids(in)    : (root class, partition) pairs of the partitions the query scanned after pruning
+ *   n_pruned_oids(in)  : number of the pairs
  *
  * Note: Put the query result into the proper hash table with the key of
  *       the parameter values (DB_VALUE array) and the data of LIST ID.
@@ -5905,7 +6249,8 @@ qfile_select_list_cache_entry (THREAD_ENTRY * thread_p, void *data, void *args)
  */
 QFILE_LIST_CACHE_ENTRY *
 qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, const DB_VALUE_ARRAY * params,
-			       const QFILE_LIST_ID * list_id, XASL_CACHE_ENTRY * xasl)
+			       const QFILE_LIST_ID * list_id, XASL_CACHE_ENTRY * xasl, INT64 exec_msec,
+			       const OID * pruned_oids, int n_pruned_oids)
 {
   QFILE_LIST_CACHE_ENTRY *lent, *old, **p, **q, **r;
   MHT_TABLE *ht;
@@ -6037,6 +6382,8 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
       goto end;
     }
   lent->list_ht_no = *list_ht_no_ptr;
+  lent->pruned_oids = NULL;
+  lent->n_pruned_oids = 0;
 #if defined(SERVER_MODE)
   lent->uncommitted_marker = true;
   lent->tran_isolation = tran_isolation;
@@ -6073,9 +6420,21 @@ qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr, con
   (void) gettimeofday (&lent->time_created, NULL);
   (void) gettimeofday (&lent->time_last_used, NULL);
   lent->ref_count = 0;
+  lent->exec_msec = exec_msec;
   lent->deletion_marker = false;
   lent->xcache_entry = xasl;
 
+  /* keep which partitions the result comes from; without them, any modified partition invalidates the entry */
+  if (n_pruned_oids > 0)
+    {
+      lent->pruned_oids = (OID *) malloc (n_pruned_oids * 2 * sizeof (OID));
+      if (lent->pruned_oids != NULL)
+	{
+	  memcpy (lent->pruned_oids, pruned_oids, n_pruned_oids * 2 * sizeof (OID));
+	  lent->n_pruned_oids = n_pruned_oids;
+	}
+    }
+
   /* record my transaction id into the entry */
 #if defined(SERVER_MODE)
   if (lent->last_ta_idx < (size_t) MAX_NTRANS)
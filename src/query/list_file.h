@@ -97,6 +97,9 @@ struct qfile_list_cache_entry
   struct timeval time_created;	/* when this entry created */
   struct timeval time_last_used;	/* when this entry used lastly */
   int ref_count;		/* how many times this query used */
+  INT64 exec_msec;		/* how long the query took to make this result */
+  OID *pruned_oids;		/* (root class, partition) pairs of the pruned scans; NULL partition if none is left */
+  int n_pruned_oids;		/* number of the pairs */
   bool deletion_marker;		/* this entry will be deleted if marker set */
 };
 
@@ -154,6 +157,8 @@ extern QFILE_LIST_ID *qfile_sort_list (THREAD_ENTRY * thread_p, QFILE_LIST_ID *
 extern int qfile_initialize_list_cache (THREAD_ENTRY * thread_p);
 extern int qfile_finalize_list_cache (THREAD_ENTRY * thread_p);
 extern int qfile_clear_list_cache (THREAD_ENTRY * thread_p, int list_ht_no, bool release);
+extern int qfile_clear_list_cache_by_partitions (THREAD_ENTRY * thread_p, int list_ht_no, const OID * root_oid,
+						const OID * modified_oids, int n_modified_oids);
 extern int qfile_dump_list_cache_internal (THREAD_ENTRY * thread_p, FILE * fp);
 #if defined (CUBRID_DEBUG)
 extern int qfile_dump_list_cache (THREAD_ENTRY * thread_p, const char *fname);
@@ -164,7 +169,8 @@ QFILE_LIST_CACHE_ENTRY *qfile_lookup_list_cache_entry (THREAD_ENTRY * thread_p,
 						       const DB_VALUE_ARRAY * params);
 QFILE_LIST_CACHE_ENTRY *qfile_update_list_cache_entry (THREAD_ENTRY * thread_p, int *list_ht_no_ptr,
 						       const DB_VALUE_ARRAY * params, const QFILE_LIST_ID * list_id,
-						       XASL_CACHE_ENTRY * xasl);
+						       XASL_CACHE_ENTRY * xasl, INT64 exec_msec, const OID * pruned_oids,
+						       int n_pruned_oids);
 int qfile_end_use_of_list_cache_entry (THREAD_ENTRY * thread_p, QFILE_LIST_CACHE_ENTRY * lent, bool marker);
 
 /* Scan related routines */
@@ -86,6 +86,14 @@ static double numeric_Pow_of_10[10] = {
   1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9
 };
 
+/* powers of 10 that fit in 64 bits; a numeric which is a bigint never reaches 10**19 */
+#define NUMERIC_BIGINT_MAX_EXP	19
+static const UINT64 numeric_Bigint_pow_of_10[NUMERIC_BIGINT_MAX_EXP] = {
+  1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+  10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+  10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL
+};
+
 typedef enum fp_value_type
 {
   FP_VALUE_TYPE_NUMBER,
@@ -123,6 +131,9 @@ static void numeric_shift_byte (DB_C_NUMERIC arg, int numbytes, DB_C_NUMERIC ans
 static bool numeric_is_zero (DB_C_NUMERIC arg);
 static bool numeric_is_long (DB_C_NUMERIC arg);
 static bool numeric_is_bigint (DB_C_NUMERIC arg);
+static UINT64 numeric_get_word (const unsigned char *arg);
+static void numeric_put_word (unsigned char *answer, UINT64 word);
+static UINT64 numeric_bigint_magnitude (DB_C_NUMERIC arg, bool * is_negative);
 static bool numeric_is_bit_set (DB_C_NUMERIC arg, int pos);
 static bool numeric_overflow (DB_C_NUMERIC arg, int exp);
 static void numeric_add (DB_C_NUMERIC arg1, DB_C_NUMERIC arg2, DB_C_NUMERIC answer, int size);
@@ -766,6 +777,64 @@ numeric_is_bigint (DB_C_NUMERIC arg)
   return (arg[digit] & 0x80) == (pad & 0x80) ? true : false;
 }
 
+/*
+ * numeric_get_word () -
+ *   return: UINT64
+ *   arg(in)    : 8 bytes of a DB_C_NUMERIC
+ *
+ * Note: This routine reads 8 bytes of a numeric (most significant first) as a machine word.
+ */
+static UINT64
+numeric_get_word (const unsigned char *arg)
+{
+  UINT64 word = 0;
+  int i;
+
+  for (i = 0; i < 8; i++)
+    {
+      word = (word << 8) | arg[i];
+    }
+
+  return word;
+}
+
+/*
+ * numeric_put_word () -
+ *   return:
+ *   answer(out): 8 bytes of a DB_C_NUMERIC
+ *   word(in)   : UINT64
+ *
+ * Note: This routine is the reverse of numeric_get_word.
+ */
+static void
+numeric_put_word (unsigned char *answer, UINT64 word)
+{
+  int i;
+
+  for (i = 7; i >= 0; i--)
+    {
+      answer[i] = (unsigned char) GET_LOWER_BYTE (word);
+      word >>= 8;
+    }
+}
+
+/*
+ * numeric_bigint_magnitude () -
+ *   return: absolute value of arg
+ *   arg(in)    : DB_C_NUMERIC for which numeric_is_bigint is true
+ *   is_negative(out): true, if arg is negative
+ */
+static UINT64
+numeric_bigint_magnitude (DB_C_NUMERIC arg, bool * is_negative)
+{
+  UINT64 word = numeric_get_word (arg + DB_NUMERIC_BUF_SIZE - sizeof (UINT64));
+
+  assert (numeric_is_bigint (arg));
+
+  *is_negative = ((INT64) word < 0);
+  return *is_negative ? (~word + 1) : word;
+}
+
 /*
  * numeric_is_bit_set () -
  *   return: bool
@@ -793,6 +862,18 @@ numeric_overflow (DB_C_NUMERIC arg, int exp)
 {
   unsigned char narg[DB_NUMERIC_BUF_SIZE];	/* copy of a DB_C_NUMERIC */
 
+  if (numeric_is_bigint (arg))
+    {
+      bool is_negative;
+
+      /* common case of DECIMAL(18, s) and smaller */
+      if (exp >= NUMERIC_BIGINT_MAX_EXP)
+	{
+	  return false;
+	}
+      return numeric_bigint_magnitude (arg, &is_negative) >= numeric_Bigint_pow_of_10[exp];
+    }
+
   if (numeric_is_negative (arg))
     {
       numeric_copy (narg, arg);
@@ -815,15 +896,29 @@ numeric_overflow (DB_C_NUMERIC arg, int exp)
  *
  * Note: This routine adds two numerics and returns the result.  It assumes
  *       that arg1 and arg2 have the same scaling.
+ *       The numerics are added 64 bits at a time; answer may be arg1 or arg2.
  */
 static void
 numeric_add (DB_C_NUMERIC arg1, DB_C_NUMERIC arg2, DB_C_NUMERIC answer, int size)
 {
   unsigned int answer_bit = 0;
+  UINT64 word1, word2, sum, carry = 0;
   int digit;
 
-  /* Loop through the characters setting answer */
-  for (digit = size - 1; digit >= 0; digit--)
+  /* Loop through the words setting answer */
+  for (digit = size - (int) sizeof (UINT64); digit >= 0; digit -= sizeof (UINT64))
+    {
+      word1 = numeric_get_word (arg1 + digit);
+      word2 = numeric_get_word (arg2 + digit);
+      sum = word1 + word2;
+      word1 = sum + carry;
+      carry = (sum < word2 || word1 < sum) ? 1 : 0;
+      numeric_put_word (answer + digit, word1);
+    }
+
+  /* Loop through the remaining characters setting answer */
+  answer_bit = (unsigned int) (carry << 8);
+  for (digit += sizeof (UINT64) - 1; digit >= 0; digit--)
     {
       answer_bit = (arg1[digit] + arg2[digit]) + CARRYOVER (answer_bit);
       answer[digit] = GET_LOWER_BYTE (answer_bit);
@@ -888,6 +983,34 @@ numeric_mul (DB_C_NUMERIC a1, DB_C_NUMERIC a2, bool * positive_ans, DB_C_NUMERIC
       return;
     }
 
+  if (numeric_is_bigint (a1) && numeric_is_bigint (a2))
+    {
+      /* common case of DECIMAL(18, s) and smaller: multiply the machine words, the product fits in 128 bits */
+      bool is_negative1, is_negative2;
+      UINT64 mag1 = numeric_bigint_magnitude (a1, &is_negative1);
+      UINT64 mag2 = numeric_bigint_magnitude (a2, &is_negative2);
+      UINT64 high, low;
+#if defined (__SIZEOF_INT128__)
+      unsigned __int128 product = (unsigned __int128) mag1 * mag2;
+
+      high = (UINT64) (product >> 64);
+      low = (UINT64) product;
+#else
+      UINT64 lo1 = mag1 & 0xffffffffULL, hi1 = mag1 >> 32;
+      UINT64 lo2 = mag2 & 0xffffffffULL, hi2 = mag2 >> 32;
+      UINT64 lolo = lo1 * lo2, hilo = hi1 * lo2, lohi = lo1 * hi2, hihi = hi1 * hi2;
+      UINT64 middle = (lolo >> 32) + (hilo & 0xffffffffULL) + (lohi & 0xffffffffULL);
+
+      high = hihi + (hilo >> 32) + (lohi >> 32) + (middle >> 32);
+      low = (middle << 32) | (lolo & 0xffffffffULL);
+#endif
+
+      numeric_put_word (answer + 2 * DB_NUMERIC_BUF_SIZE - 2 * sizeof (UINT64), high);
+      numeric_put_word (answer + 2 * DB_NUMERIC_BUF_SIZE - sizeof (UINT64), low);
+      *positive_ans = (is_negative1 == is_negative2);
+      return;
+    }
+
   /* If arg1 is negative, toggle sign and make arg1 positive */
   numeric_copy (arg1, a1);
   numeric_copy (arg2, a2);
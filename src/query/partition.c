@@ -89,6 +89,15 @@ static MHT_TABLE *db_Partition_Ht = NULL;
 
 #define PARTITION_IS_CACHE_INITIALIZED() (db_Partition_Ht != NULL)
 
+/* the bounds of a range partition; the ranges do not overlap, so sorting them by max also sorts them by min */
+typedef struct partition_range_bound PARTITION_RANGE_BOUND;
+struct partition_range_bound
+{
+  DB_VALUE min;			/* NULL for MINVALUE */
+  DB_VALUE max;			/* NULL for MAXVALUE; exclusive */
+  int index;			/* index of the partition in the pruning bitset */
+};
+
 typedef struct partition_cache_entry PARTITION_CACHE_ENTRY;
 struct partition_cache_entry
 {
@@ -98,6 +107,9 @@ struct partition_cache_entry
   int count;			/* number of partitions */
 
   ATTR_ID attr_id;		/* attribute id of the partitioning key */
+
+  PARTITION_RANGE_BOUND *range_bounds;	/* range partitions sorted by their bounds (or NULL) */
+  int range_bounds_count;	/* number of range bounds */
 };
 
 /* PRUNING_BITSET operations */
@@ -120,6 +132,11 @@ static int partition_free_cache_entry (PARTITION_CACHE_ENTRY * entry);
 static int partition_cache_pruning_context (PRUNING_CONTEXT * pinfo, bool * already_exists);
 static bool partition_load_context_from_cache (PRUNING_CONTEXT * pinfo, bool * is_modified);
 static int partition_cache_entry_to_pruning_context (PRUNING_CONTEXT * pinfo, PARTITION_CACHE_ENTRY * entry_p);
+static int partition_build_range_bounds (PARTITION_CACHE_ENTRY * entry_p);
+static void partition_free_range_bounds (PARTITION_CACHE_ENTRY * entry_p);
+static int partition_compare_range_bounds (const void *a, const void *b);
+static bool partition_find_range_bound (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, PRUNING_BITSET * pruned,
+					int *added);
 static PARTITION_CACHE_ENTRY *partition_pruning_context_to_cache_entry (PRUNING_CONTEXT * pinfo);
 static PRUNING_OP partition_rel_op_to_pruning_op (REL_OP op);
 static int partition_load_partition_predicate (PRUNING_CONTEXT * pinfo, OR_PARTITION * master);
@@ -421,6 +438,7 @@ partition_free_cache_entry (PARTITION_CACHE_ENTRY * entry)
 	    }
 	  free_and_init (entry->partitions);
 	}
+      partition_free_range_bounds (entry);
 
       free_and_init (entry);
     }
@@ -459,6 +477,8 @@ partition_cache_entry_to_pruning_context (PRUNING_CONTEXT * pinfo, PARTITION_CAC
     }
 
   pinfo->partitions = entry_p->partitions;
+  pinfo->range_bounds = entry_p->range_bounds;
+  pinfo->range_bounds_count = entry_p->range_bounds_count;
 
   pinfo->attr_id = entry_p->attr_id;
 
@@ -491,6 +511,8 @@ partition_pruning_context_to_cache_entry (PRUNING_CONTEXT * pinfo)
     }
   entry_p->partitions = NULL;
   entry_p->count = 0;
+  entry_p->range_bounds = NULL;
+  entry_p->range_bounds_count = 0;
 
   COPY_OID (&entry_p->class_oid, &pinfo->root_oid);
   entry_p->attr_id = pinfo->attr_id;
@@ -530,6 +552,12 @@ partition_pruning_context_to_cache_entry (PRUNING_CONTEXT * pinfo)
 	}
     }
 
+  if (pinfo->partition_type == DB_PARTITION_RANGE && partition_build_range_bounds (entry_p) != NO_ERROR)
+    {
+      pinfo->error_code = ER_FAILED;
+      goto error_return;
+    }
+
   /* restore heap id */
   db_change_private_heap (pinfo->thread_p, old_heap_id);
 
@@ -552,6 +580,7 @@ error_return:
 
 	  free_and_init (entry_p->partitions);
 	}
+      partition_free_range_bounds (entry_p);
 
       free_and_init (entry_p);
     }
@@ -564,6 +593,106 @@ error_return:
   return NULL;
 }
 
+/*
+ * partition_build_range_bounds () - build the sorted bounds of the range partitions of a cache entry
+ * return : error code or NO_ERROR
+ * entry_p (in/out) : cache entry
+ *
+ * Note: The caller has changed the private heap to 0, the bounds outlast the current thread heap too.
+ */
+static int
+partition_build_range_bounds (PARTITION_CACHE_ENTRY * entry_p)
+{
+  PARTITION_RANGE_BOUND *bounds;
+  int i, count = entry_p->count - 1;
+  int error = NO_ERROR;
+
+  if (count <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  bounds = (PARTITION_RANGE_BOUND *) malloc (count * sizeof (PARTITION_RANGE_BOUND));
+  if (bounds == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, count * sizeof (PARTITION_RANGE_BOUND));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  for (i = 0; i < count; i++)
+    {
+      db_make_null (&bounds[i].min);
+      db_make_null (&bounds[i].max);
+      bounds[i].index = i;
+    }
+  entry_p->range_bounds = bounds;
+  entry_p->range_bounds_count = count;
+
+  for (i = 0; i < count; i++)
+    {
+      error = db_set_get (entry_p->partitions[i + 1].values, 0, &bounds[i].min);
+      if (error == NO_ERROR)
+	{
+	  error = db_set_get (entry_p->partitions[i + 1].values, 1, &bounds[i].max);
+	}
+      if (error != NO_ERROR)
+	{
+	  return error;
+	}
+    }
+
+  qsort (bounds, count, sizeof (PARTITION_RANGE_BOUND), partition_compare_range_bounds);
+
+  return NO_ERROR;
+}
+
+/*
+ * partition_free_range_bounds () - free the range bounds of a cache entry
+ * return : void
+ * entry_p (in/out) : cache entry
+ *
+ * Note: The caller has changed the private heap to 0.
+ */
+static void
+partition_free_range_bounds (PARTITION_CACHE_ENTRY * entry_p)
+{
+  int i;
+
+  if (entry_p->range_bounds == NULL)
+    {
+      return;
+    }
+
+  for (i = 0; i < entry_p->range_bounds_count; i++)
+    {
+      pr_clear_value (&entry_p->range_bounds[i].min);
+      pr_clear_value (&entry_p->range_bounds[i].max);
+    }
+  free_and_init (entry_p->range_bounds);
+  entry_p->range_bounds_count = 0;
+}
+
+/*
+ * partition_compare_range_bounds () - qsort comparator of range bounds, by max value (MAXVALUE last)
+ * return : negative, zero or positive
+ * a (in) : range bound
+ * b (in) : range bound
+ */
+static int
+partition_compare_range_bounds (const void *a, const void *b)
+{
+  const PARTITION_RANGE_BOUND *bound_a = (const PARTITION_RANGE_BOUND *) a;
+  const PARTITION_RANGE_BOUND *bound_b = (const PARTITION_RANGE_BOUND *) b;
+  int cmp;
+
+  if (DB_IS_NULL (&bound_a->max) || DB_IS_NULL (&bound_b->max))
+    {
+      return (int) DB_IS_NULL (&bound_a->max) - (int) DB_IS_NULL (&bound_b->max);
+    }
+
+  cmp = tp_value_compare (&bound_a->max, &bound_b->max, 1, 1);
+  return (cmp == DB_LT) ? -1 : ((cmp == DB_GT) ? 1 : 0);
+}
+
 /*
  * partition_cache_pruning_context () - cache a pruning context
  * return : error code or NO_ERROR
@@ -1340,6 +1469,11 @@ partition_prune_range (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, const PRUN
   db_make_null (&min);
   db_make_null (&max);
 
+  if (op == PO_EQ && partition_find_range_bound (pinfo, val, pruned, &added))
+    {
+      return (added == 0) ? MATCH_NOT_FOUND : MATCH_OK;
+    }
+
   for (i = 0; i < PARTITIONS_COUNT (pinfo); i++)
     {
       part = &pinfo->partitions[i + 1];
@@ -1474,6 +1608,75 @@ cleanup:
   return status;
 }
 
+/*
+ * partition_find_range_bound () - find the range partition of a value by binary search in the sorted bounds
+ * return : true if the search was done, false if the partitions must be scanned
+ * pinfo (in)	   : pruning context
+ * val (in)	   : value to look for
+ * pruned (in/out) : pruned partitions
+ * added (out)	   : number of partitions added to pruned (0 or 1)
+ */
+static bool
+partition_find_range_bound (PRUNING_CONTEXT * pinfo, const DB_VALUE * val, PRUNING_BITSET * pruned, int *added)
+{
+  const PARTITION_RANGE_BOUND *bound;
+  int low = 0, high, mid, cmp;
+
+  *added = 0;
+  if (pinfo->range_bounds == NULL || pinfo->range_bounds_count != PARTITIONS_COUNT (pinfo))
+    {
+      return false;
+    }
+
+  /* find the first partition for which value < max */
+  high = pinfo->range_bounds_count;
+  while (low < high)
+    {
+      mid = low + (high - low) / 2;
+      bound = &pinfo->range_bounds[mid];
+      if (DB_IS_NULL (&bound->max))
+	{
+	  cmp = DB_LT;
+	}
+      else
+	{
+	  cmp = tp_value_compare (val, &bound->max, 1, 1);
+	}
+
+      if (cmp == DB_LT)
+	{
+	  high = mid;
+	}
+      else if (cmp == DB_EQ || cmp == DB_GT)
+	{
+	  low = mid + 1;
+	}
+      else
+	{
+	  /* not comparable */
+	  return false;
+	}
+    }
+
+  if (low < pinfo->range_bounds_count)
+    {
+      /* and check that min <= value */
+      bound = &pinfo->range_bounds[low];
+      cmp = DB_IS_NULL (&bound->min) ? DB_LT : tp_value_compare (&bound->min, val, 1, 1);
+      if (cmp == DB_UNK)
+	{
+	  return false;
+	}
+      if (cmp == DB_LT || cmp == DB_EQ)
+	{
+	  pruningset_add (pruned, bound->index);
+	  *added = 1;
+	}
+    }
+
+  return true;
+}
+
 /*
  * partition_prune_db_val () - prune partitions using the given DB_VALUE
  * return : match status
@@ -2172,6 +2375,8 @@ partition_init_pruning_context (PRUNING_CONTEXT * pinfo)
   OID_SET_NULL (&pinfo->root_oid);
   pinfo->thread_p = NULL;
   pinfo->partitions = NULL;
+  pinfo->range_bounds = NULL;
+  pinfo->range_bounds_count = 0;
   pinfo->selected_partition = NULL;
   pinfo->spec = NULL;
   pinfo->vd = NULL;
@@ -2396,6 +2601,8 @@ partition_clear_pruning_context (PRUNING_CONTEXT * pinfo)
     }
 
   pinfo->partitions = NULL;
+  pinfo->range_bounds = NULL;
+  pinfo->range_bounds_count = 0;
   pinfo->selected_partition = NULL;
   pinfo->count = 0;
 
@@ -34,6 +34,7 @@
 struct access_spec_node;
 struct func_pred;
 struct func_pred_unpack_info;
+struct partition_range_bound;
 struct val_descr;
 struct xasl_unpack_info;
 
@@ -78,6 +79,8 @@ struct pruning_context
 					 * holds the partition info */
   SCANCACHE_LIST *scan_cache_list;	/* caches for partitions affected by the query using this context */
   int count;			/* number of partitions */
+  partition_range_bound *range_bounds;	/* range partitions sorted by their bounds; referenced from the cache */
+  int range_bounds_count;	/* number of range bounds */
 
   xasl_unpack_info *fp_cache_context;	/* unpacking info */
   func_pred *partition_pred;	/* partition predicate */
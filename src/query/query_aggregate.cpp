@@ -296,6 +296,171 @@ qdata_aggregate_accumulator_to_accumulator (cubthread::entry *thread_p, cubxasl:
   return error;
 }
 
+/*
+ * qdata_is_aggregate_list_mergeable () - can partial states of aggregate list be merged
+ *   return: true if qdata_merge_aggregate_list can merge all functions of list
+ *   agg_list_p(in): aggregate list
+ *
+ * Note: Partial states are the accumulators (and distinct lists) of aggregate lists that evaluated disjoint parts of
+ *       the same input, e.g. one part each worker of a parallel scan.
+ */
+bool
+qdata_is_aggregate_list_mergeable (cubxasl::aggregate_list_node *agg_list_p)
+{
+  cubxasl::aggregate_list_node *agg_p;
+
+  for (agg_p = agg_list_p; agg_p != NULL; agg_p = agg_p->next)
+    {
+      if (agg_p->flag_agg_optimize)
+	{
+	  /* evaluated from index statistics, not from the scan */
+	  continue;
+	}
+
+      switch (agg_p->function)
+	{
+	case PT_GROUPBY_NUM:
+	case PT_COUNT_STAR:
+	case PT_COUNT:
+	case PT_MIN:
+	case PT_MAX:
+	case PT_SUM:
+	case PT_AVG:
+	case PT_AGG_BIT_AND:
+	case PT_AGG_BIT_OR:
+	case PT_AGG_BIT_XOR:
+	case PT_STDDEV:
+	case PT_STDDEV_POP:
+	case PT_STDDEV_SAMP:
+	case PT_VARIANCE:
+	case PT_VAR_POP:
+	case PT_VAR_SAMP:
+	case PT_JSON_ARRAYAGG:
+	case PT_JSON_OBJECTAGG:
+	case PT_GROUP_CONCAT:
+	case PT_CUME_DIST:
+	case PT_PERCENT_RANK:
+	  break;
+
+	default:
+	  /* interpolation functions keep per group state (percentile and domain of values) apart from their list */
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qdata_merge_aggregate_list () - merge partial states of an aggregate list into another
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   agg_list_p(in/out): aggregate list that receives the merged states
+ *   partial_list_p(in): aggregate list of the same functions, with the partial states to merge
+ *
+ * Note: Both lists were initialized with qdata_initialize_aggregate_list and have evaluated all their values, but
+ *       are not finalized yet; agg_list_p is then finalized as if it evaluated the values of both.
+ *       The values of partial list are only read; caller keeps and frees partial list.
+ */
+int
+qdata_merge_aggregate_list (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_list_p,
+			    cubxasl::aggregate_list_node *partial_list_p)
+{
+  cubxasl::aggregate_list_node *agg_p, *part_p;
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tuple_record = { NULL, 0 };
+  SCAN_CODE scan_code;
+  DB_VALUE dbval;
+  int error = NO_ERROR;
+
+  assert (qdata_is_aggregate_list_mergeable (agg_list_p));
+
+  for (agg_p = agg_list_p, part_p = partial_list_p; agg_p != NULL; agg_p = agg_p->next, part_p = part_p->next)
+    {
+      assert (part_p != NULL && part_p->function == agg_p->function);
+
+      if (agg_p->flag_agg_optimize || agg_p->function == PT_GROUPBY_NUM || part_p->accumulator.curr_cnt < 1)
+	{
+	  /* nothing to merge */
+	  continue;
+	}
+
+      if (agg_p->function == PT_CUME_DIST || agg_p->function == PT_PERCENT_RANK)
+	{
+	  /* the hypothetical row ranks after the larger rows of both parts */
+	  agg_p->info.dist_percent.nlargers += part_p->info.dist_percent.nlargers;
+	  agg_p->accumulator.curr_cnt += part_p->accumulator.curr_cnt;
+	}
+      else if (agg_p->option == Q_DISTINCT || agg_p->sort_list != NULL)
+	{
+	  /* values of both parts are distinct-ified or sorted together when list is finalized */
+	  assert (agg_p->list_id != NULL && part_p->list_id != NULL);
+
+	  qfile_close_list (thread_p, part_p->list_id);
+	  error = qfile_open_list_scan (part_p->list_id, &scan_id);
+	  if (error != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return error;
+	    }
+
+	  while ((scan_code = qfile_scan_list_next (thread_p, &scan_id, &tuple_record, PEEK)) == S_SUCCESS)
+	    {
+	      error = qfile_add_tuple_to_list (thread_p, agg_p->list_id, tuple_record.tpl);
+	      if (error != NO_ERROR)
+		{
+		  break;
+		}
+	    }
+	  qfile_close_scan (thread_p, &scan_id);
+
+	  if (error != NO_ERROR || scan_code == S_ERROR)
+	    {
+	      ASSERT_ERROR_AND_SET (error);
+	      return error;
+	    }
+
+	  agg_p->accumulator.curr_cnt += part_p->accumulator.curr_cnt;
+	}
+      else if (agg_p->function == PT_GROUP_CONCAT)
+	{
+	  /* concatenate the string of partial list after this one, with a separator */
+	  db_make_null (&dbval);
+	  if (pr_clone_value (part_p->accumulator.value, &dbval) != NO_ERROR)
+	    {
+	      return ER_FAILED;
+	    }
+
+	  if (agg_p->accumulator.curr_cnt < 1)
+	    {
+	      error = qdata_group_concat_first_value (thread_p, agg_p, &dbval);
+	    }
+	  else
+	    {
+	      error = qdata_group_concat_value (thread_p, agg_p, &dbval);
+	    }
+	  pr_clear_value (&dbval);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+
+	  agg_p->accumulator.curr_cnt += part_p->accumulator.curr_cnt;
+	}
+      else
+	{
+	  error = qdata_aggregate_accumulator_to_accumulator (thread_p, &agg_p->accumulator, &agg_p->accumulator_domain,
+							      agg_p->function, agg_p->domain, &part_p->accumulator);
+	  if (error != NO_ERROR)
+	    {
+	      return error;
+	    }
+	}
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * qdata_aggregate_value_to_accumulator () - aggregate a value to accumulator
  *   returns: error code or NO_ERROR
@@ -1061,13 +1226,12 @@ qdata_evaluate_aggregate_hierarchy (cubthread::entry *thread_p, cubxasl::aggrega
     }
 
   db_make_null (&result);
-  error = pr_clone_value (agg_p->accumulator.value, &result);
+  error = pr_move_value (agg_p->accumulator.value, &result);
   if (error != NO_ERROR)
     {
       return error;
     }
 
-  pr_clear_value (agg_p->accumulator.value);
   /* iterate through classes in the hierarchy and merge aggregate values */
   for (i = 0; i < helper->count && error == NO_ERROR; i++)
     {
@@ -1094,7 +1258,7 @@ qdata_evaluate_aggregate_hierarchy (cubthread::entry *thread_p, cubxasl::aggrega
 	case PT_MIN:
 	  if (DB_IS_NULL (&result))
 	    {
-	      error = pr_clone_value (agg_p->accumulator.value, &result);
+	      error = pr_move_value (agg_p->accumulator.value, &result);
 	      if (error != NO_ERROR)
 		{
 		  goto cleanup;
@@ -1108,7 +1272,7 @@ qdata_evaluate_aggregate_hierarchy (cubthread::entry *thread_p, cubxasl::aggrega
 		{
 		  /* agg_p->value is lower than result so make it the new minimum */
 		  pr_clear_value (&result);
-		  error = pr_clone_value (agg_p->accumulator.value, &result);
+		  error = pr_move_value (agg_p->accumulator.value, &result);
 		  if (error != NO_ERROR)
 		    {
 		      goto cleanup;
@@ -1120,7 +1284,7 @@ qdata_evaluate_aggregate_hierarchy (cubthread::entry *thread_p, cubxasl::aggrega
 	case PT_MAX:
 	  if (DB_IS_NULL (&result))
 	    {
-	      error = pr_clone_value (agg_p->accumulator.value, &result);
+	      error = pr_move_value (agg_p->accumulator.value, &result);
 	      if (error != NO_ERROR)
 		{
 		  goto cleanup;
@@ -1133,7 +1297,7 @@ qdata_evaluate_aggregate_hierarchy (cubthread::entry *thread_p, cubxasl::aggrega
 		{
 		  /* agg_p->value is greater than result so make it the new maximum */
 		  pr_clear_value (&result);
-		  error = pr_clone_value (agg_p->accumulator.value, &result);
+		  error = pr_move_value (agg_p->accumulator.value, &result);
 		  if (error != NO_ERROR)
 		    {
 		      goto cleanup;
@@ -1154,7 +1318,7 @@ qdata_evaluate_aggregate_hierarchy (cubthread::entry *thread_p, cubxasl::aggrega
     }
   else
     {
-      pr_clone_value (&result, agg_p->accumulator.value);
+      (void) pr_move_value (&result, agg_p->accumulator.value);
     }
 
 cleanup:
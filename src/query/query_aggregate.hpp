@@ -46,6 +46,13 @@ namespace cubxasl
   struct aggregate_list_node;
 } // namespace cubxasl
 
+/* groups spilled from a full aggregate hash table are split in that many partitions by their hash value */
+#define HASH_AGGREGATE_SPILL_PARTITION_BITS 3
+#define HASH_AGGREGATE_SPILL_PARTITIONS (1 << HASH_AGGREGATE_SPILL_PARTITION_BITS)
+/* a partition that does not fit in hash table is split again, up to this many times */
+#define HASH_AGGREGATE_SPILL_MAX_LEVELS 4
+#define HASH_AGGREGATE_SPILL_MAX_COUNT (HASH_AGGREGATE_SPILL_PARTITIONS * HASH_AGGREGATE_SPILL_MAX_LEVELS)
+
 namespace cubquery
 {
   /* aggregate evaluation hash value */
@@ -75,6 +82,7 @@ namespace cubquery
     AGGREGATE_HASH_STATE state;	/* state of hash aggregation */
     tp_domain **key_domains;	/* hash key domains */
     cubxasl::aggregate_accumulator_domain **accumulator_domains;	/* accumulator domains */
+    UINT64 mem_limit;		/* work memory granted to hash table; groups are spilled or written beyond it */
 
     /* runtime statistics stuff */
     int hash_size;		/* hash table size */
@@ -97,6 +105,14 @@ namespace cubquery
     aggregate_hash_value *curr_part_value;	/* current partial value */
     aggregate_hash_value *temp_part_value;	/* temporary partial value */
     int sorted_count;
+
+    /* spilled partitions stuff */
+    bool spill_enabled;		/* when hash table is full, tuples of new groups are spilled to partitions */
+    int spill_count;		/* number of partitions waiting to be aggregated */
+    int spill_base;		/* first of the partitions being filled, -1 if none */
+    qfile_list_id *spill_list_ids[HASH_AGGREGATE_SPILL_MAX_COUNT];	/* partitions of spilled tuples */
+    int spill_levels[HASH_AGGREGATE_SPILL_MAX_COUNT];	/* split level of each partition */
+    QFILE_TUPLE_RECORD spill_tuple;	/* tuple record used while spilling */
   };
 
 
@@ -119,6 +135,9 @@ int qdata_initialize_aggregate_list (cubthread::entry *thread_p, cubxasl::aggreg
 int qdata_aggregate_accumulator_to_accumulator (cubthread::entry *thread_p, cubxasl::aggregate_accumulator *acc,
     cubxasl::aggregate_accumulator_domain *acc_dom, FUNC_TYPE func_type,
     tp_domain *func_domain, cubxasl::aggregate_accumulator *new_acc);
+bool qdata_is_aggregate_list_mergeable (cubxasl::aggregate_list_node *agg_list);
+int qdata_merge_aggregate_list (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_list,
+				cubxasl::aggregate_list_node *partial_list);
 int qdata_evaluate_aggregate_list (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_list, val_descr *vd,
 				   cubxasl::aggregate_accumulator *alt_acc_list);
 int qdata_evaluate_aggregate_optimize (cubthread::entry *thread_p, cubxasl::aggregate_list_node *agg_ptr, HFID *hfid,
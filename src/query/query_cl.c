@@ -131,6 +131,33 @@ execute_query (const XASL_ID * xasl_id, QUERY_ID * query_idp, int var_cnt, const
   return ret;
 }
 
+/*
+ * execute_query_batch () - Execute several prepared queries in one request
+ *   return: Error code
+ *   stmt_count(in)     : number of queries
+ *   xasl_ids(in)       : XASL file ids that were results of prepare_query()
+ *   var_cnts(in)       : number of host variables of each query
+ *   varptrs(in)        : host variables of each query
+ *   flag(in)   : flag
+ *   results(out)       : row count, or error code, of each executed query
+ *   executed_count(out): number of executed queries
+ */
+int
+execute_query_batch (int stmt_count, const XASL_ID * xasl_ids, const int *var_cnts, const DB_VALUE ** varptrs,
+		     QUERY_FLAG flag, int *results, int *executed_count)
+{
+  *executed_count = 0;
+
+  /* if QO_PARAM_LEVEL indicate no execution, just return */
+  if (qo_need_skip_execution ())
+    {
+      return NO_ERROR;
+    }
+
+  return qmgr_execute_query_batch (stmt_count, xasl_ids, var_cnts, varptrs, flag, tran_get_query_timeout (), results,
+				   executed_count);
+}
+
 /*
  * prepare_and_execute_query () -
  *   return:
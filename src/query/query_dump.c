@@ -2881,7 +2881,7 @@ qdump_print_stats_json (xasl_node * xasl_p, json_t * parent)
 {
   ORDERBY_STATS *ostats;
   GROUPBY_STATS *gstats;
-  json_t *proc, *scan = NULL;
+  json_t *proc, *scan = NULL, *wait;
   json_t *subquery, *groupby, *orderby;
   json_t *left, *right, *outer, *inner;
   json_t *cte_non_recursive_part, *cte_recursive_part;
@@ -2911,8 +2911,16 @@ qdump_print_stats_json (xasl_node * xasl_p, json_t * parent)
     case CONNECTBY_PROC:
     case BUILD_SCHEMA_PROC:
       json_object_set_new (proc, "time", json_integer (TO_MSEC (xasl_p->xasl_stats.elapsed_time)));
+      json_object_set_new (proc, "cpu_time", json_integer (TO_MSEC (xasl_p->xasl_stats.cpu_time)));
       json_object_set_new (proc, "fetch", json_integer (xasl_p->xasl_stats.fetches));
       json_object_set_new (proc, "ioread", json_integer (xasl_p->xasl_stats.ioreads));
+      json_object_set_new (proc, "rows", json_integer (xasl_p->xasl_stats.rows));
+      json_object_set_new (proc, "temp_pages", json_integer (xasl_p->xasl_stats.temp_pages));
+      wait = json_object ();
+      json_object_set_new (wait, "io", json_integer (TO_MSEC (xasl_p->xasl_stats.io_waits)));
+      json_object_set_new (wait, "lock", json_integer (TO_MSEC (xasl_p->xasl_stats.lock_waits)));
+      json_object_set_new (wait, "latch", json_integer (TO_MSEC (xasl_p->xasl_stats.latch_waits)));
+      json_object_set_new (proc, "wait", wait);
       break;
 
     case UNION_PROC:
@@ -3200,9 +3208,13 @@ qdump_print_stats_text (FILE * fp, xasl_node * xasl_p, int indent)
     case DELETE_PROC:
     case CONNECTBY_PROC:
     case BUILD_SCHEMA_PROC:
-      fprintf (fp, "%s (time: %d, fetch: %lld, ioread: %lld)\n", qdump_xasl_type_string (xasl_p),
-	       TO_MSEC (xasl_p->xasl_stats.elapsed_time), (long long int) xasl_p->xasl_stats.fetches,
-	       (long long int) xasl_p->xasl_stats.ioreads);
+      fprintf (fp, "%s (time: %d, cpu_time: %d, fetch: %lld, ioread: %lld, rows: %lld, temp_pages: %lld, "
+	       "wait: io=%d, lock=%d, latch=%d)\n", qdump_xasl_type_string (xasl_p),
+	       TO_MSEC (xasl_p->xasl_stats.elapsed_time), TO_MSEC (xasl_p->xasl_stats.cpu_time),
+	       (long long int) xasl_p->xasl_stats.fetches, (long long int) xasl_p->xasl_stats.ioreads,
+	       (long long int) xasl_p->xasl_stats.rows, (long long int) xasl_p->xasl_stats.temp_pages,
+	       TO_MSEC (xasl_p->xasl_stats.io_waits), TO_MSEC (xasl_p->xasl_stats.lock_waits),
+	       TO_MSEC (xasl_p->xasl_stats.latch_waits));
       indent += 2;
       break;
 
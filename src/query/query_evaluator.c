@@ -2694,6 +2694,7 @@ eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES * recdesp, HEAP_SCA
   SCAN_PRED *scan_predp;
   SCAN_ATTRS *scan_attrsp;
   DB_LOGICAL ev_res;
+  bool is_lazy_read = false;
 
   if (!filterp)
     {
@@ -2709,8 +2710,18 @@ eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES * recdesp, HEAP_SCA
 
   if (scan_attrsp != NULL && scan_attrsp->attr_cache != NULL && scan_predp->regu_list != NULL)
     {
+      if (oid != NULL && recdesp != NULL && recdesp->data != NULL)
+	{
+	  /* read the predicate values from the record only when the predicates access them: the first false term
+	   * spares reading the attributes of the other terms */
+	  if (heap_attrinfo_start_lazy_read (thread_p, oid, recdesp, scan_cache, scan_attrsp->attr_cache) != NO_ERROR)
+	    {
+	      return V_ERROR;
+	    }
+	  is_lazy_read = true;
+	}
       /* read the predicate values from the heap into the attribute cache */
-      if (heap_attrinfo_read_dbvalues (thread_p, oid, recdesp, scan_cache, scan_attrsp->attr_cache) != NO_ERROR)
+      else if (heap_attrinfo_read_dbvalues (thread_p, oid, recdesp, scan_cache, scan_attrsp->attr_cache) != NO_ERROR)
 	{
 	  return V_ERROR;
 	}
@@ -2753,10 +2764,16 @@ eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES * recdesp, HEAP_SCA
       if (fetch_val_list (thread_p, scan_predp->regu_list, filterp->val_descr, filterp->class_oid, oid, NULL, PEEK) !=
 	  NO_ERROR)
 	{
-	  return V_ERROR;
+	  ev_res = V_ERROR;
 	}
     }
 
+  if (is_lazy_read)
+    {
+      /* the values of a qualified record were all read by fetch_val_list; the record may not be valid anymore */
+      heap_attrinfo_end_lazy_read (scan_attrsp->attr_cache);
+    }
+
   return ev_res;
 }
 
@@ -2959,3 +2976,626 @@ eval_key_filter (THREAD_ENTRY * thread_p, DB_VALUE * value, FILTER_INFO * filter
 
   return ev_res;
 }
+
+/*
+ * Batch evaluation of list scan predicates
+ *
+ * A conjunction of comparisons between a list file column and a constant, over the columns of integer, double,
+ * date or datetime type, is evaluated for all the tuples of a list file page at once: each column is decoded into a
+ * vector and each comparison runs as a loop over the vector, which the compiler can turn into SIMD code. The results
+ * of the page tuples are kept until the scan moves to another page.
+ */
+
+#define EVAL_BATCH_MAX_ROWS 1024
+#define EVAL_BATCH_MAX_TERMS 8
+
+typedef enum
+{
+  EVAL_BATCH_INT,		/* INTEGER, BIGINT, DATE and DATETIME; compared as INT64 */
+  EVAL_BATCH_DOUBLE		/* DOUBLE */
+} EVAL_BATCH_VECTOR_TYPE;
+
+typedef struct eval_batch_term EVAL_BATCH_TERM;
+struct eval_batch_term
+{
+  int pos_no;			/* list file column */
+  DB_TYPE col_type;		/* type of the column */
+  EVAL_BATCH_VECTOR_TYPE vec_type;	/* type of the vector of the column values */
+  REL_OP rel_op;		/* column rel_op constant */
+  regu_variable_node *constant;	/* constant compared to the column */
+};
+
+struct eval_batch_filter
+{
+  int n_terms;
+  EVAL_BATCH_TERM terms[EVAL_BATCH_MAX_TERMS];
+
+  /* results of the current page */
+  VPID vpid;			/* page evaluated; NULL if none */
+  int tuple_count;		/* number of tuples evaluated */
+  unsigned char is_false[EVAL_BATCH_MAX_ROWS];	/* V_FALSE for a term */
+  unsigned char is_unknown[EVAL_BATCH_MAX_ROWS];	/* V_UNKNOWN for a term */
+
+  /* work area */
+  QFILE_TUPLE tuples[EVAL_BATCH_MAX_ROWS];
+  unsigned char nulls[EVAL_BATCH_MAX_ROWS];
+  INT64 int_vector[EVAL_BATCH_MAX_ROWS];
+  double double_vector[EVAL_BATCH_MAX_ROWS];
+};
+
+static bool eval_batch_add_terms (const PRED_EXPR * pr, regu_variable_list_node * regu_list, qfile_list_id * list_id,
+				  EVAL_BATCH_FILTER * filter);
+static int eval_batch_get_column (regu_variable_node * regu, regu_variable_list_node * regu_list,
+				  qfile_list_id * list_id, DB_TYPE * col_type);
+static bool eval_batch_is_constant (regu_variable_node * regu, DB_TYPE col_type);
+static bool eval_batch_is_comparable (DB_TYPE col_type, DB_TYPE const_type);
+static void eval_batch_compare_int (EVAL_BATCH_FILTER * filter, REL_OP rel_op, INT64 constant, int n);
+static void eval_batch_compare_double (EVAL_BATCH_FILTER * filter, REL_OP rel_op, double constant, int n);
+
+/*
+ * eval_batch_get_column () - get the list file column read by a regu variable
+ *   return: column position or -1 if the regu variable is not a column of a batch type
+ *   regu(in): regu variable
+ *   regu_list(in): regu list fetching the predicate values from the tuples
+ *   list_id(in): list file scanned
+ *   col_type(out): type of the column
+ */
+static int
+eval_batch_get_column (regu_variable_node * regu, regu_variable_list_node * regu_list, qfile_list_id * list_id,
+		       DB_TYPE * col_type)
+{
+  regu_variable_list_node *p;
+  QFILE_TUPLE_VALUE_POSITION *pos_descr = NULL;
+  int pos_no;
+
+  if (regu->type == TYPE_POSITION)
+    {
+      pos_descr = &regu->value.pos_descr;
+    }
+  else if (regu->type == TYPE_CONSTANT)
+    {
+      /* value fetched from the tuple by the predicate regu list */
+      for (p = regu_list; p != NULL; p = p->next)
+	{
+	  if (p->value.type == TYPE_POSITION && p->value.vfetch_to == regu->value.dbvalptr)
+	    {
+	      pos_descr = &p->value.value.pos_descr;
+	      break;
+	    }
+	}
+    }
+
+  if (pos_descr == NULL)
+    {
+      return -1;
+    }
+
+  pos_no = pos_descr->pos_no;
+  if (pos_no < 0 || pos_no >= list_id->type_list.type_cnt || list_id->type_list.domp[pos_no] == NULL)
+    {
+      return -1;
+    }
+
+  *col_type = TP_DOMAIN_TYPE (list_id->type_list.domp[pos_no]);
+  if (pos_descr->dom != NULL && TP_DOMAIN_TYPE (pos_descr->dom) != *col_type)
+    {
+      /* value is converted when fetched */
+      return -1;
+    }
+  switch (*col_type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_DATE:
+    case DB_TYPE_DATETIME:
+      return pos_no;
+
+    default:
+      return -1;
+    }
+}
+
+/*
+ * eval_batch_is_constant () - can regu variable be compared to a column in batch?
+ *   return: true if regu variable is a constant of a type that compares exactly with the column type
+ *   regu(in): regu variable
+ *   col_type(in): type of the column
+ */
+static bool
+eval_batch_is_constant (regu_variable_node * regu, DB_TYPE col_type)
+{
+  /* values that do not change while the query is executed */
+  if (regu->type != TYPE_DBVAL && regu->type != TYPE_POS_VALUE)
+    {
+      return false;
+    }
+
+  return regu->domain != NULL && eval_batch_is_comparable (col_type, TP_DOMAIN_TYPE (regu->domain));
+}
+
+/*
+ * eval_batch_is_comparable () - can the values of two types be compared in batch?
+ *   return: true if batch comparison gives the same result as tp_value_compare
+ *   col_type(in): type of the column
+ *   const_type(in): type of the constant
+ */
+static bool
+eval_batch_is_comparable (DB_TYPE col_type, DB_TYPE const_type)
+{
+  switch (col_type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+      return const_type == DB_TYPE_INTEGER || const_type == DB_TYPE_BIGINT;
+
+    case DB_TYPE_DOUBLE:
+      return const_type == DB_TYPE_DOUBLE || const_type == DB_TYPE_INTEGER || const_type == DB_TYPE_BIGINT;
+
+    default:
+      return const_type == col_type;
+    }
+}
+
+/*
+ * eval_batch_add_terms () - add the terms of a predicate to a batch filter
+ *   return: true if all the terms of the predicate can be evaluated in batch
+ *   pr(in): predicate
+ *   regu_list(in): regu list fetching the predicate values from the tuples
+ *   list_id(in): list file scanned
+ *   filter(in/out): batch filter
+ */
+static bool
+eval_batch_add_terms (const PRED_EXPR * pr, regu_variable_list_node * regu_list, qfile_list_id * list_id,
+		      EVAL_BATCH_FILTER * filter)
+{
+  const COMP_EVAL_TERM *et_comp;
+  EVAL_BATCH_TERM *term;
+  regu_variable_node *column, *constant;
+  REL_OP rel_op;
+  DB_TYPE col_type = DB_TYPE_NULL;
+  int pos_no;
+
+  if (pr->type == T_PRED)
+    {
+      return (pr->pe.m_pred.bool_op == B_AND && eval_batch_add_terms (pr->pe.m_pred.lhs, regu_list, list_id, filter)
+	      && eval_batch_add_terms (pr->pe.m_pred.rhs, regu_list, list_id, filter));
+    }
+
+  if (pr->type != T_EVAL_TERM || pr->pe.m_eval_term.et_type != T_COMP_EVAL_TERM
+      || filter->n_terms >= EVAL_BATCH_MAX_TERMS)
+    {
+      return false;
+    }
+
+  et_comp = &pr->pe.m_eval_term.et.et_comp;
+  if (et_comp->lhs == NULL || et_comp->rhs == NULL)
+    {
+      return false;
+    }
+
+  column = et_comp->lhs;
+  constant = et_comp->rhs;
+  rel_op = et_comp->rel_op;
+  pos_no = eval_batch_get_column (column, regu_list, list_id, &col_type);
+  if (pos_no < 0)
+    {
+      /* constant rel_op column; swap the operands */
+      column = et_comp->rhs;
+      constant = et_comp->lhs;
+      switch (rel_op)
+	{
+	case R_LT:
+	  rel_op = R_GT;
+	  break;
+	case R_LE:
+	  rel_op = R_GE;
+	  break;
+	case R_GT:
+	  rel_op = R_LT;
+	  break;
+	case R_GE:
+	  rel_op = R_LE;
+	  break;
+	default:
+	  break;
+	}
+      pos_no = eval_batch_get_column (column, regu_list, list_id, &col_type);
+      if (pos_no < 0)
+	{
+	  return false;
+	}
+    }
+
+  switch (rel_op)
+    {
+    case R_EQ:
+    case R_NE:
+    case R_LT:
+    case R_LE:
+    case R_GT:
+    case R_GE:
+      break;
+
+    default:
+      return false;
+    }
+
+  if (!eval_batch_is_constant (constant, col_type))
+    {
+      return false;
+    }
+
+  term = &filter->terms[filter->n_terms++];
+  term->pos_no = pos_no;
+  term->col_type = col_type;
+  term->vec_type = (col_type == DB_TYPE_DOUBLE) ? EVAL_BATCH_DOUBLE : EVAL_BATCH_INT;
+  term->rel_op = rel_op;
+  term->constant = constant;
+
+  return true;
+}
+
+/*
+ * eval_batch_filter_create () - create the batch filter of a list scan predicate
+ *   return: batch filter or NULL if the predicate cannot be evaluated in batch
+ *   pr(in): predicate
+ *   regu_list(in): regu list fetching the predicate values from the tuples
+ *   list_id(in): list file scanned
+ */
+EVAL_BATCH_FILTER *
+eval_batch_filter_create (THREAD_ENTRY * thread_p, const PRED_EXPR * pr, regu_variable_list_node * regu_list,
+			  qfile_list_id * list_id)
+{
+  EVAL_BATCH_FILTER *filter;
+
+  if (pr == NULL || list_id == NULL)
+    {
+      return NULL;
+    }
+
+  filter = (EVAL_BATCH_FILTER *) db_private_alloc (thread_p, sizeof (EVAL_BATCH_FILTER));
+  if (filter == NULL)
+    {
+      /* the predicate is evaluated tuple by tuple */
+      er_clear ();
+      return NULL;
+    }
+
+  filter->n_terms = 0;
+  if (!eval_batch_add_terms (pr, regu_list, list_id, filter))
+    {
+      db_private_free (thread_p, filter);
+      return NULL;
+    }
+
+  eval_batch_filter_reset (filter);
+  return filter;
+}
+
+/*
+ * eval_batch_filter_free () - free batch filter
+ *   return: void
+ *   filter(in): batch filter
+ */
+void
+eval_batch_filter_free (THREAD_ENTRY * thread_p, EVAL_BATCH_FILTER * filter)
+{
+  if (filter != NULL)
+    {
+      db_private_free (thread_p, filter);
+    }
+}
+
+/*
+ * eval_batch_filter_reset () - forget the results of the page evaluated
+ *   return: void
+ *   filter(in): batch filter
+ *
+ * Note: must be called when the list file scanned may be refilled.
+ */
+void
+eval_batch_filter_reset (EVAL_BATCH_FILTER * filter)
+{
+  VPID_SET_NULL (&filter->vpid);
+  filter->tuple_count = 0;
+}
+
+/*
+ * eval_batch_filter_is_page_evaluated () - does batch filter have the result of a tuple?
+ *   return: true if the tuple is in the page evaluated
+ *   filter(in): batch filter
+ *   vpid(in): page of the tuple
+ *   tplno(in): tuple number in page
+ */
+bool
+eval_batch_filter_is_page_evaluated (EVAL_BATCH_FILTER * filter, const VPID * vpid, int tplno)
+{
+  return VPID_EQ (&filter->vpid, vpid) && tplno < filter->tuple_count;
+}
+
+/*
+ * eval_batch_compare_int () - compare a vector of integer values to a constant
+ *   return: void
+ *   filter(in/out): batch filter; the results of the tuples are updated
+ *   rel_op(in): relational operator
+ *   constant(in): constant
+ *   n(in): number of values
+ */
+static void
+eval_batch_compare_int (EVAL_BATCH_FILTER * filter, REL_OP rel_op, INT64 constant, int n)
+{
+  const INT64 *vec = filter->int_vector;
+  unsigned char *is_false = filter->is_false;
+  const unsigned char *nulls = filter->nulls;
+  int i;
+
+  /* a term is false for a tuple if its value is not null and the comparison fails */
+  switch (rel_op)
+    {
+    case R_EQ:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] != constant));
+	}
+      break;
+    case R_NE:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] == constant));
+	}
+      break;
+    case R_LT:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] >= constant));
+	}
+      break;
+    case R_LE:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] > constant));
+	}
+      break;
+    case R_GT:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] <= constant));
+	}
+      break;
+    case R_GE:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] < constant));
+	}
+      break;
+    default:
+      assert (false);
+      break;
+    }
+}
+
+/*
+ * eval_batch_compare_double () - compare a vector of double values to a constant
+ *   return: void
+ *   filter(in/out): batch filter; the results of the tuples are updated
+ *   rel_op(in): relational operator
+ *   constant(in): constant
+ *   n(in): number of values
+ */
+static void
+eval_batch_compare_double (EVAL_BATCH_FILTER * filter, REL_OP rel_op, double constant, int n)
+{
+  const double *vec = filter->double_vector;
+  unsigned char *is_false = filter->is_false;
+  const unsigned char *nulls = filter->nulls;
+  int i;
+
+  /* a term is false for a tuple if its value is not null and the comparison fails */
+  switch (rel_op)
+    {
+    case R_EQ:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] != constant));
+	}
+      break;
+    case R_NE:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] == constant));
+	}
+      break;
+    case R_LT:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] >= constant));
+	}
+      break;
+    case R_LE:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] > constant));
+	}
+      break;
+    case R_GT:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] <= constant));
+	}
+      break;
+    case R_GE:
+      for (i = 0; i < n; i++)
+	{
+	  is_false[i] |= (unsigned char) ((nulls[i] ^ 1) & (vec[i] < constant));
+	}
+      break;
+    default:
+      assert (false);
+      break;
+    }
+}
+
+/*
+ * eval_batch_filter_page () - evaluate batch filter for all the tuples of a list file page
+ *   return: error code or NO_ERROR
+ *   filter(in/out): batch filter
+ *   vd(in): value descriptor of the host variables
+ *   vpid(in): page identifier
+ *   page_p(in): page
+ *
+ * Note: a page with an overflow tuple or with too many tuples is not evaluated; its tuples must be evaluated one by
+ *       one (eval_batch_filter_is_page_evaluated returns false for them).
+ */
+int
+eval_batch_filter_page (THREAD_ENTRY * thread_p, EVAL_BATCH_FILTER * filter, val_descr * vd, const VPID * vpid,
+			PAGE_PTR page_p)
+{
+  EVAL_BATCH_TERM *term;
+  DB_VALUE *const_val;
+  DB_DATETIME datetime;
+  DB_DATE date;
+  QFILE_TUPLE tpl;
+  char *val_p;
+  INT64 int_const;
+  double double_const;
+  int tuple_count, i, t;
+
+  eval_batch_filter_reset (filter);
+
+  tuple_count = QFILE_GET_TUPLE_COUNT (page_p);
+  if (tuple_count <= 0 || tuple_count > EVAL_BATCH_MAX_ROWS || QFILE_GET_OVERFLOW_PAGE_ID (page_p) != NULL_PAGEID)
+    {
+      return NO_ERROR;
+    }
+
+  tpl = (char *) page_p + QFILE_PAGE_HEADER_SIZE;
+  for (i = 0; i < tuple_count; i++)
+    {
+      filter->tuples[i] = tpl;
+      filter->is_false[i] = 0;
+      filter->is_unknown[i] = 0;
+      tpl += QFILE_GET_TUPLE_LENGTH (tpl);
+    }
+
+  for (t = 0; t < filter->n_terms; t++)
+    {
+      term = &filter->terms[t];
+
+      if (fetch_peek_dbval (thread_p, term->constant, vd, NULL, NULL, NULL, &const_val) != NO_ERROR)
+	{
+	  assert (er_errid () != NO_ERROR);
+	  return er_errid ();
+	}
+      if (DB_IS_NULL (const_val))
+	{
+	  /* the term is unknown for all tuples */
+	  memset (filter->is_unknown, 1, tuple_count);
+	  continue;
+	}
+      if (!eval_batch_is_comparable (term->col_type, DB_VALUE_DOMAIN_TYPE (const_val)))
+	{
+	  /* host variable of another type; the page is evaluated tuple by tuple */
+	  return NO_ERROR;
+	}
+
+      /* decode the column values into a vector */
+      for (i = 0; i < tuple_count; i++)
+	{
+	  QFILE_GET_TUPLE_VALUE_HEADER_POSITION (filter->tuples[i], term->pos_no, val_p);
+	  filter->nulls[i] = (QFILE_GET_TUPLE_VALUE_FLAG (val_p) == V_UNBOUND);
+	  if (filter->nulls[i])
+	    {
+	      filter->is_unknown[i] = 1;
+	      filter->int_vector[i] = 0;
+	      filter->double_vector[i] = 0;
+	      continue;
+	    }
+
+	  val_p += QFILE_TUPLE_VALUE_HEADER_SIZE;
+	  switch (term->col_type)
+	    {
+	    case DB_TYPE_INTEGER:
+	      filter->int_vector[i] = OR_GET_INT (val_p);
+	      break;
+	    case DB_TYPE_BIGINT:
+	      OR_GET_BIGINT (val_p, &filter->int_vector[i]);
+	      break;
+	    case DB_TYPE_DOUBLE:
+	      OR_GET_DOUBLE (val_p, &filter->double_vector[i]);
+	      break;
+	    case DB_TYPE_DATE:
+	      OR_GET_DATE (val_p, &date);
+	      filter->int_vector[i] = date;
+	      break;
+	    case DB_TYPE_DATETIME:
+	      OR_GET_DATETIME (val_p, &datetime);
+	      filter->int_vector[i] = ((INT64) datetime.date << 32) | datetime.time;
+	      break;
+	    default:
+	      assert (false);
+	      return ER_FAILED;
+	    }
+	}
+
+      /* compare the vector to the constant */
+      switch (DB_VALUE_DOMAIN_TYPE (const_val))
+	{
+	case DB_TYPE_INTEGER:
+	  int_const = db_get_int (const_val);
+	  double_const = (double) int_const;
+	  break;
+	case DB_TYPE_BIGINT:
+	  int_const = db_get_bigint (const_val);
+	  double_const = (double) int_const;
+	  break;
+	case DB_TYPE_DOUBLE:
+	  int_const = 0;
+	  double_const = db_get_double (const_val);
+	  break;
+	case DB_TYPE_DATE:
+	  int_const = *db_get_date (const_val);
+	  double_const = 0;
+	  break;
+	case DB_TYPE_DATETIME:
+	  int_const = ((INT64) db_get_datetime (const_val)->date << 32) | db_get_datetime (const_val)->time;
+	  double_const = 0;
+	  break;
+	default:
+	  assert (false);
+	  return NO_ERROR;
+	}
+
+      if (term->vec_type == EVAL_BATCH_DOUBLE)
+	{
+	  eval_batch_compare_double (filter, term->rel_op, double_const, tuple_count);
+	}
+      else
+	{
+	  eval_batch_compare_int (filter, term->rel_op, int_const, tuple_count);
+	}
+    }
+
+  VPID_COPY (&filter->vpid, vpid);
+  filter->tuple_count = tuple_count;
+
+  return NO_ERROR;
+}
+
+/*
+ * eval_batch_filter_get_result () - get the result of the predicate for a tuple of the page evaluated
+ *   return: DB_LOGICAL (V_TRUE, V_FALSE or V_UNKNOWN)
+ *   filter(in): batch filter
+ *   tplno(in): tuple number in page
+ */
+DB_LOGICAL
+eval_batch_filter_get_result (EVAL_BATCH_FILTER * filter, int tplno)
+{
+  assert (tplno >= 0 && tplno < filter->tuple_count);
+
+  if (filter->is_false[tplno])
+    {
+      return V_FALSE;
+    }
+  return filter->is_unknown[tplno] ? V_UNKNOWN : V_TRUE;
+}
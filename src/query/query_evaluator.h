@@ -47,6 +47,7 @@ class regu_variable_node;
 struct val_descr;
 typedef struct val_descr VAL_DESCR;
 struct val_list_node;
+struct qfile_list_id;
 
 // *INDENT-OFF*
 namespace cubxasl
@@ -58,6 +59,9 @@ using PRED_EXPR = cubxasl::pred_expr;
 
 typedef DB_LOGICAL (*PR_EVAL_FNC) (THREAD_ENTRY * thread_p, const PRED_EXPR *, val_descr *, OID *);
 
+/* filter evaluating a predicate for all the tuples of a list file page at once */
+typedef struct eval_batch_filter EVAL_BATCH_FILTER;
+
 typedef enum
 {
   QPROC_QUALIFIED = 0,		/* fetch a qualified item; default */
@@ -146,5 +150,13 @@ extern DB_LOGICAL eval_data_filter (THREAD_ENTRY * thread_p, OID * oid, RECDES *
 				    FILTER_INFO * filter);
 extern DB_LOGICAL eval_key_filter (THREAD_ENTRY * thread_p, DB_VALUE * value, FILTER_INFO * filter);
 extern DB_LOGICAL update_logical_result (THREAD_ENTRY * thread_p, DB_LOGICAL ev_res, int *qualification);
+extern EVAL_BATCH_FILTER *eval_batch_filter_create (THREAD_ENTRY * thread_p, const PRED_EXPR * pr,
+						    regu_variable_list_node * regu_list, qfile_list_id * list_id);
+extern void eval_batch_filter_free (THREAD_ENTRY * thread_p, EVAL_BATCH_FILTER * filter);
+extern void eval_batch_filter_reset (EVAL_BATCH_FILTER * filter);
+extern bool eval_batch_filter_is_page_evaluated (EVAL_BATCH_FILTER * filter, const VPID * vpid, int tplno);
+extern int eval_batch_filter_page (THREAD_ENTRY * thread_p, EVAL_BATCH_FILTER * filter, val_descr * vd,
+				   const VPID * vpid, PAGE_PTR page_p);
+extern DB_LOGICAL eval_batch_filter_get_result (EVAL_BATCH_FILTER * filter, int tplno);
 
 #endif /* _QUERY_EVALUATOR_H_ */
@@ -65,6 +65,9 @@
 #include "btree_load.h"
 #include "query_dump.h"
 #if defined (SERVER_MODE)
+#include "event_log.h"
+#endif /* SERVER_MODE */
+#if defined (SERVER_MODE)
 #include "jansson.h"
 #endif /* defined (SERVER_MODE) */
 #if defined(ENABLE_SYSTEMTAP)
@@ -126,6 +129,13 @@ struct xasl_state
 /* maximum selectivity allowed for hash aggregate evaluation */
 #define HASH_AGGREGATE_VH_SELECTIVITY_THRESHOLD         0.5f
 
+/* part of the hash table memory limit that new groups may fill; the remainder is left for the growth of existing
+ * groups */
+#define HASH_AGGREGATE_SPILL_FILL_RATIO                 0.9f
+
+/* hash table memory granted even when the work memory of the server is exhausted (lower bound of max_agg_hash_size) */
+#define HASH_AGGREGATE_MIN_MEM_LIMIT                    (32 * 1024)
+
 
 #define QEXEC_CLEAR_AGG_LIST_VALUE(agg_list) \
   do \
@@ -298,6 +308,7 @@ struct analytic_state
 
   bool is_last_run;
   bool is_output_rec;
+  bool is_streamed;		/* are the results known when a tuple is read? no group pass is needed then */
 };
 
 /*
@@ -336,6 +347,20 @@ struct del_lob_info
   DEL_LOB_INFO *next;		/* next DEL_LOB_INFO in a list */
 };
 
+/* values when an XASL starts executing, to profile its execution */
+typedef struct xasl_stats_start XASL_STATS_START;
+struct xasl_stats_start
+{
+  TSC_TICKS start_tick;
+  struct timeval cpu_time;
+  struct timeval lock_waits;
+  struct timeval latch_waits;
+  struct timeval io_waits;
+  UINT64 fetches;
+  UINT64 ioreads;
+  UINT64 temp_pages;
+};
+
 /* used for internal update/delete execution */
 typedef struct upddel_class_info_internal UPDDEL_CLASS_INFO_INTERNAL;
 struct upddel_class_info_internal
@@ -443,6 +468,14 @@ static void qexec_gby_start_group (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbst
 static void qexec_gby_finalize_group_val_list (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, int N);
 static int qexec_gby_finalize_group_dim (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, const RECDES * recdes);
 static void qexec_gby_finalize_group (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, int N, bool keep_list_file);
+static int qexec_hash_gby_open_spills (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context,
+				       QFILE_LIST_ID * list_id, int level);
+static int qexec_hash_gby_spill_tuple (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context,
+				       AGGREGATE_HASH_KEY * key, int level, QFILE_TUPLE tpl);
+static int qexec_hash_gby_flush_spills (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context,
+					QFILE_LIST_ID * list_id);
+static int qexec_hash_gby_output_htable (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate);
+static int qexec_hash_gby_agg_spills (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, QFILE_LIST_ID * list_id);
 static SORT_STATUS qexec_hash_gby_get_next (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
 static int qexec_hash_gby_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
 static SORT_STATUS qexec_gby_get_next (THREAD_ENTRY * thread_p, RECDES * recdes, void *arg);
@@ -464,6 +497,9 @@ static SORT_STATUS qexec_analytic_get_next (THREAD_ENTRY * thread_p, RECDES * re
 static int qexec_analytic_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *arg);
 static int qexec_analytic_eval_instnum_pred (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_state,
 					     ANALYTIC_STAGE stage);
+static bool qexec_analytic_is_streamable (ANALYTIC_STATE * analytic_state);
+static int qexec_analytic_set_current_key (THREAD_ENTRY * thread_p, ANALYTIC_FUNCTION_STATE * func_state,
+					   const RECDES * key);
 static int qexec_analytic_start_group (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state,
 				       ANALYTIC_FUNCTION_STATE * func_state, const RECDES * key, bool reinit);
 static int qexec_analytic_finalize_group (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state,
@@ -664,6 +700,7 @@ static int qexec_evaluate_partition_aggregates (THREAD_ENTRY * thread_p, ACCESS_
 						AGGREGATE_TYPE * agg_list, bool * is_scan_needed);
 
 static int qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd);
+static bool qexec_is_topn_first_key_ordered (XASL_NODE * xasl);
 static BH_CMP_RESULT qexec_topn_compare (const void *left, const void *right, BH_CMP_ARG arg);
 static BH_CMP_RESULT qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec);
 static TOPN_STATUS qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * sort_stop,
@@ -682,7 +719,11 @@ static void qexec_clear_pred_xasl (THREAD_ENTRY * thread_p, PRED_EXPR * pred);
 
 #if defined(SERVER_MODE)
 static void qexec_set_xasl_trace_to_session (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
+static void qexec_log_slow_xasl_profile (THREAD_ENTRY * thread_p, XASL_NODE * xasl);
 #endif /* SERVER_MODE */
+static void qexec_get_thread_cpu_time (struct timeval *cpu_time);
+static void qexec_start_xasl_stats (THREAD_ENTRY * thread_p, XASL_STATS_START * start);
+static void qexec_end_xasl_stats (THREAD_ENTRY * thread_p, XASL_STATS_START * start, XASL_NODE * xasl);
 
 static int qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc, XASL_STATE * xasl_state);
 static void qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc);
@@ -3718,7 +3759,7 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   AGGREGATE_HASH_KEY *key = context->temp_key;
   AGGREGATE_HASH_VALUE *value;
   HENTRY_PTR hentry;
-  UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE);
+  UINT64 mem_limit = context->mem_limit;
   int rc = NO_ERROR;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
@@ -3743,7 +3784,44 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 
   /* probe hash table */
   value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
-  if (value == NULL)
+  if (value == NULL && context->spill_enabled
+      && context->hash_size >= (int) (mem_limit * HASH_AGGREGATE_SPILL_FILL_RATIO))
+    {
+      int tuple_size = tpldesc->tpl_size;
+
+      /* hash table is full; keep the tuple in the partition of its group, it is aggregated after the scan */
+      if (context->spill_count == 0)
+	{
+	  rc = qexec_hash_gby_open_spills (thread_p, context, groupby_list, 0);
+	  if (rc != NO_ERROR)
+	    {
+	      return rc;
+	    }
+	}
+
+      if (context->spill_tuple.size < tuple_size)
+	{
+	  if (qfile_reallocate_tuple (&context->spill_tuple, tuple_size) != NO_ERROR)
+	    {
+	      assert (er_errid () != NO_ERROR);
+	      return er_errid ();
+	    }
+	}
+      if (qfile_save_tuple (tpldesc, T_NORMAL, context->spill_tuple.tpl, &tuple_size) != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
+
+      rc = qexec_hash_gby_spill_tuple (thread_p, context, key, 0, context->spill_tuple.tpl);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+
+      /* tuple is in a partition, do not output it */
+      *output_tuple = false;
+    }
+  else if (value == NULL)
     {
       AGGREGATE_HASH_KEY *new_key;
       AGGREGATE_HASH_VALUE *new_value;
@@ -3833,6 +3911,17 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 	}
     }
 
+  if (context->hash_size > (int) mem_limit && context->spill_enabled)
+    {
+      /* groups cannot be removed from hash table while there are partitions of the other groups; move spilled tuples
+       * to groupby list and remove least recently used groups from now on */
+      rc = qexec_hash_gby_flush_spills (thread_p, context, groupby_list);
+      if (rc != NO_ERROR)
+	{
+	  return rc;
+	}
+    }
+
   /* keep hash table within memory limit */
   while (context->hash_size > (int) mem_limit)
     {
@@ -3887,6 +3976,13 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
 	  qdata_save_agg_htable_to_list (thread_p, context->hash_table, groupby_list, context->part_list_id,
 					 context->temp_dbval_array);
 
+	  /* spilled tuples are aggregated by sort too */
+	  rc = qexec_hash_gby_flush_spills (thread_p, context, groupby_list);
+	  if (rc != NO_ERROR)
+	    {
+	      return rc;
+	    }
+
 #if !defined(NDEBUG)
 	  er_log_debug (ARG_FILE_LINE, "hash aggregation abandoned: very high selectivity");
 #endif
@@ -3905,6 +4001,321 @@ qexec_hash_gby_agg_tuple (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE
   return NO_ERROR;
 }
 
+/*
+ * qexec_hash_gby_open_spills () - open the partitions of a split of spilled groups
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   context(in): hash context
+ *   list_id(in): list file with the format of spilled tuples
+ *   level(in): split level of the partitions
+ */
+static int
+qexec_hash_gby_open_spills (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context, QFILE_LIST_ID * list_id,
+			    int level)
+{
+  QFILE_LIST_ID *spill_list_id;
+  int i;
+
+  assert (level < HASH_AGGREGATE_SPILL_MAX_LEVELS);
+  assert (context->spill_count + HASH_AGGREGATE_SPILL_PARTITIONS <= HASH_AGGREGATE_SPILL_MAX_COUNT);
+
+  context->spill_base = context->spill_count;
+  for (i = 0; i < HASH_AGGREGATE_SPILL_PARTITIONS; i++)
+    {
+      spill_list_id = qfile_open_list (thread_p, &list_id->type_list, NULL, list_id->query_id, 0);
+      if (spill_list_id == NULL)
+	{
+	  assert (er_errid () != NO_ERROR);
+	  return er_errid ();
+	}
+
+      context->spill_list_ids[context->spill_count] = spill_list_id;
+      context->spill_levels[context->spill_count] = level;
+      context->spill_count++;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_gby_spill_tuple () - add a tuple to the partition of its group
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   context(in): hash context
+ *   key(in): group key of tuple
+ *   level(in): split level; selects the bits of key hash value that give the partition
+ *   tpl(in): tuple
+ */
+static int
+qexec_hash_gby_spill_tuple (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context, AGGREGATE_HASH_KEY * key,
+			    int level, QFILE_TUPLE tpl)
+{
+  unsigned int hash_val;
+  int part;
+
+  assert (context->spill_base >= 0 && context->spill_levels[context->spill_base] == level);
+
+  hash_val = qdata_hash_agg_hkey (key, INT_MAX);
+  part = (int) ((hash_val >> (level * HASH_AGGREGATE_SPILL_PARTITION_BITS)) & (HASH_AGGREGATE_SPILL_PARTITIONS - 1));
+
+  return qfile_add_tuple_to_list (thread_p, context->spill_list_ids[context->spill_base + part], tpl);
+}
+
+/*
+ * qexec_hash_gby_flush_spills () - move all spilled tuples to a list file and stop spilling
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   context(in): hash context
+ *   list_id(in): list file (opened) receiving the tuples
+ */
+static int
+qexec_hash_gby_flush_spills (THREAD_ENTRY * thread_p, AGGREGATE_HASH_CONTEXT * context, QFILE_LIST_ID * list_id)
+{
+  QFILE_LIST_ID *spill_list_id;
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE scan_code;
+  int error = NO_ERROR;
+
+  context->spill_enabled = false;
+  context->spill_base = -1;
+
+  while (context->spill_count > 0)
+    {
+      context->spill_count--;
+      spill_list_id = context->spill_list_ids[context->spill_count];
+      context->spill_list_ids[context->spill_count] = NULL;
+
+      qfile_close_list (thread_p, spill_list_id);
+      if (error == NO_ERROR && spill_list_id->tuple_cnt > 0)
+	{
+	  error = qfile_open_list_scan (spill_list_id, &scan_id);
+	  if (error == NO_ERROR)
+	    {
+	      while ((scan_code = qfile_scan_list_next (thread_p, &scan_id, &tplrec, PEEK)) == S_SUCCESS)
+		{
+		  error = qfile_add_tuple_to_list (thread_p, list_id, tplrec.tpl);
+		  if (error != NO_ERROR)
+		    {
+		      break;
+		    }
+		}
+	      if (scan_code == S_ERROR && error == NO_ERROR)
+		{
+		  ASSERT_ERROR_AND_SET (error);
+		}
+	      qfile_close_scan (thread_p, &scan_id);
+	    }
+	}
+
+      qfile_destroy_list (thread_p, spill_list_id);
+      qfile_free_list_id (spill_list_id);
+    }
+
+  return error;
+}
+
+/*
+ * qexec_hash_gby_output_htable () - output the groups of hash table
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): group by state
+ *
+ * Note: used when none of the groups in hash table has tuples left for sort-based aggregation.
+ */
+static int
+qexec_hash_gby_output_htable (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate)
+{
+  HENTRY_PTR head = gbstate->agg_hash_context->hash_table->act_head;
+  AGGREGATE_HASH_VALUE *value = NULL;
+
+  while (head && gbstate->state == NO_ERROR)
+    {
+      /* load entry into aggregate list */
+      value = (AGGREGATE_HASH_VALUE *) head->data;
+      if (value == NULL)
+	{
+	  /* should not happen */
+	  return ER_FAILED;
+	}
+
+      if (value->first_tuple.tpl == NULL)
+	{
+	  /* empty unsorted list and no first tuple? this should not happen ... */
+	  return ER_FAILED;
+	}
+
+      /* start new group and aggregate tuple; since unsorted list is empty we don't have rollup groups */
+      qexec_gby_start_group_dim (thread_p, gbstate, NULL);
+
+      /* load values in list and aggregate first tuple */
+      qdata_load_agg_hvalue_in_agg_list (value, gbstate->g_dim[0].d_agg_list, false);
+      qexec_gby_agg_tuple (thread_p, gbstate, value->first_tuple.tpl, PEEK);
+
+      /* finalize */
+      qexec_gby_finalize_group_dim (thread_p, gbstate, NULL);
+
+      /* next entry */
+      head = head->act_next;
+      gbstate->input_recs += value->tuple_count + 1;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * qexec_hash_gby_agg_spills () - aggregate the spilled partitions using hash table and output their groups
+ *   return: error code or NO_ERROR
+ *   thread_p(in): thread
+ *   gbstate(in): group by state
+ *   list_id(in): unsorted list (closed); receives the groups that are left to sort-based aggregation
+ *
+ * Note: hash table groups must be already output; hash table is empty on return. A partition that does not fit in
+ *       hash table is split again by other bits of the hash value. The partitions of the last split level that do
+ *       not fit either are left to sort-based aggregation.
+ */
+static int
+qexec_hash_gby_agg_spills (THREAD_ENTRY * thread_p, GROUPBY_STATE * gbstate, QFILE_LIST_ID * list_id)
+{
+  AGGREGATE_HASH_CONTEXT *context = gbstate->agg_hash_context;
+  BUILDLIST_PROC_NODE *proc = &gbstate->xasl->proc.buildlist;
+  VAL_DESCR *vd = &gbstate->xasl_state->vd;
+  AGGREGATE_HASH_KEY *key = context->temp_key;
+  AGGREGATE_HASH_KEY *new_key;
+  AGGREGATE_HASH_VALUE *value;
+  QFILE_LIST_ID *spill_list_id;
+  QFILE_LIST_SCAN_ID scan_id;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE scan_code = S_END;
+  UINT64 mem_limit = context->mem_limit;
+  bool is_list_reopened = false;
+  int level, tuple_size;
+  int error = NO_ERROR;
+
+  while (context->spill_count > 0 && error == NO_ERROR && gbstate->state == NO_ERROR)
+    {
+      /* start over with the groups of last partition */
+      (void) mht_clear (context->hash_table, qdata_free_agg_hentry, (void *) thread_p);
+      context->hash_size = 0;
+
+      context->spill_count--;
+      spill_list_id = context->spill_list_ids[context->spill_count];
+      level = context->spill_levels[context->spill_count];
+      context->spill_list_ids[context->spill_count] = NULL;
+      context->spill_base = -1;
+
+      qfile_close_list (thread_p, spill_list_id);
+      if (spill_list_id->tuple_cnt > 0)
+	{
+	  error = qfile_open_list_scan (spill_list_id, &scan_id);
+	}
+      while (error == NO_ERROR && spill_list_id->tuple_cnt > 0
+	     && (scan_code = qfile_scan_list_next (thread_p, &scan_id, &tplrec, PEEK)) == S_SUCCESS)
+	{
+	  error = qexec_build_agg_hkey (thread_p, gbstate->xasl_state, gbstate->g_hk_regu_list, tplrec.tpl, key);
+	  if (error != NO_ERROR)
+	    {
+	      break;
+	    }
+
+	  value = (AGGREGATE_HASH_VALUE *) mht_get (context->hash_table, (void *) key);
+	  if (value != NULL)
+	    {
+	      /* aggregate tuple in its group */
+	      value->tuple_count++;
+	      error = fetch_val_list (thread_p, gbstate->g_regu_list, vd, NULL, NULL, tplrec.tpl, PEEK);
+	      if (error == NO_ERROR)
+		{
+		  error = qdata_evaluate_aggregate_list (thread_p, proc->g_agg_list, vd, value->accumulators);
+		}
+	      context->hash_size += qdata_get_agg_hvalue_size (value, true);
+	    }
+	  else if (context->hash_size >= (int) (mem_limit * HASH_AGGREGATE_SPILL_FILL_RATIO))
+	    {
+	      if (level + 1 < HASH_AGGREGATE_SPILL_MAX_LEVELS)
+		{
+		  /* split partition again */
+		  if (context->spill_base < 0)
+		    {
+		      error = qexec_hash_gby_open_spills (thread_p, context, spill_list_id, level + 1);
+		    }
+		  if (error == NO_ERROR)
+		    {
+		      error = qexec_hash_gby_spill_tuple (thread_p, context, key, level + 1, tplrec.tpl);
+		    }
+		}
+	      else
+		{
+		  /* too many groups have the same hash bits; aggregate them by sort */
+		  if (!is_list_reopened)
+		    {
+		      error = qfile_reopen_list_as_append_mode (thread_p, list_id);
+		      is_list_reopened = (error == NO_ERROR);
+		    }
+		  if (error == NO_ERROR)
+		    {
+		      error = qfile_add_tuple_to_list (thread_p, list_id, tplrec.tpl);
+		    }
+		}
+	    }
+	  else
+	    {
+	      /* new group; like for the scan, its first tuple is kept and aggregated when the group is output */
+	      new_key = qdata_copy_agg_hkey (thread_p, key);
+	      value = qdata_alloc_agg_hvalue (thread_p, proc->g_func_count, proc->g_agg_list);
+	      tuple_size = QFILE_GET_TUPLE_LENGTH (tplrec.tpl);
+	      if (value != NULL)
+		{
+		  value->first_tuple.tpl = (QFILE_TUPLE) db_private_alloc (thread_p, tuple_size);
+		}
+	      if (new_key == NULL || value == NULL || value->first_tuple.tpl == NULL)
+		{
+		  qdata_free_agg_hkey (thread_p, new_key);
+		  qdata_free_agg_hvalue (thread_p, value);
+		  if (er_errid () == NO_ERROR)
+		    {
+		      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) tuple_size);
+		    }
+		  error = er_errid ();
+		  break;
+		}
+	      value->first_tuple.size = tuple_size;
+	      memcpy (value->first_tuple.tpl, tplrec.tpl, tuple_size);
+
+	      mht_put (context->hash_table, (void *) new_key, (void *) value);
+	      context->hash_size += qdata_get_agg_hkey_size (new_key);
+	      context->hash_size += qdata_get_agg_hvalue_size (value, false);
+	    }
+	}
+      if (scan_code == S_ERROR && error == NO_ERROR)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	}
+
+      if (spill_list_id->tuple_cnt > 0)
+	{
+	  qfile_close_scan (thread_p, &scan_id);
+	}
+      qfile_destroy_list (thread_p, spill_list_id);
+      qfile_free_list_id (spill_list_id);
+
+      if (error == NO_ERROR)
+	{
+	  error = qexec_hash_gby_output_htable (thread_p, gbstate);
+	}
+    }
+
+  (void) mht_clear (context->hash_table, qdata_free_agg_hentry, (void *) thread_p);
+  context->hash_size = 0;
+
+  if (is_list_reopened)
+    {
+      qfile_close_list (thread_p, list_id);
+    }
+
+  return error;
+}
+
 /*
  * qexec_hash_gby_get_next () - get next tuple in partial list
  *   return: sort status
@@ -4391,6 +4802,7 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
   QFILE_LIST_SCAN_ID input_scan_id;
   int ls_flag = 0;
   int estimated_pages;
+  int hash_output_recs = 0;
 
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
@@ -4501,47 +4913,34 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
       else if (gbstate.agg_hash_context->part_list_id->tuple_cnt == 0
 	       && !prm_get_bool_value (PRM_ID_AGG_HASH_RESPECT_ORDER))
 	{
-	  HENTRY_PTR head = gbstate.agg_hash_context->hash_table->act_head;
-	  AGGREGATE_HASH_VALUE *value = NULL;
-
 	  /* empty unsorted list and empty partial list; we can generate the output from the hash table */
-	  while (head)
+	  if (qexec_hash_gby_output_htable (thread_p, &gbstate) != NO_ERROR)
 	    {
-	      /* load entry into aggregate list */
-	      value = (AGGREGATE_HASH_VALUE *) head->data;
-	      if (value == NULL)
-		{
-		  /* should not happen */
-		  GOTO_EXIT_ON_ERROR;
-		}
-
-	      if (value->first_tuple.tpl == NULL)
-		{
-		  /* empty unsorted list and no first tuple? this should not happen ... */
-		  GOTO_EXIT_ON_ERROR;
-		}
-
-	      /* start new group and aggregate tuple; since unsorted list is empty we don't have rollup groups */
-	      qexec_gby_start_group_dim (thread_p, &gbstate, NULL);
+	      GOTO_EXIT_ON_ERROR;
+	    }
 
-	      /* load values in list and aggregate first tuple */
-	      qdata_load_agg_hvalue_in_agg_list (value, gbstate.g_dim[0].d_agg_list, false);
-	      qexec_gby_agg_tuple (thread_p, &gbstate, value->first_tuple.tpl, PEEK);
+	  /* then from the partitions of spilled groups */
+	  if (gbstate.agg_hash_context->spill_count > 0
+	      && qexec_hash_gby_agg_spills (thread_p, &gbstate, list_id) != NO_ERROR)
+	    {
+	      GOTO_EXIT_ON_ERROR;
+	    }
 
-	      /* finalize */
-	      qexec_gby_finalize_group_dim (thread_p, &gbstate, NULL);
+	  if (list_id->tuple_cnt == 0)
+	    {
+	      /* output generated; finalize */
+	      qfile_destroy_list (thread_p, list_id);
+	      qfile_close_list (thread_p, gbstate.output_file);
+	      qfile_copy_list_id (list_id, gbstate.output_file, true);
 
-	      /* next entry */
-	      head = head->act_next;
-	      gbstate.input_recs += value->tuple_count + 1;
+	      goto wrapup;
 	    }
 
-	  /* output generated; finalize */
-	  qfile_destroy_list (thread_p, list_id);
-	  qfile_close_list (thread_p, gbstate.output_file);
-	  qfile_copy_list_id (list_id, gbstate.output_file, true);
-
-	  goto wrapup;
+	  /* groups of a partition too large for hash table are left in unsorted list; hash table is empty and they are
+	   * aggregated by sort like any other group */
+	  assert (mht_count (gbstate.agg_hash_context->hash_table) == 0);
+	  hash_output_recs = gbstate.input_recs;
+	  gbstate.input_recs = 0;
 	}
     }
 
@@ -4603,7 +5002,8 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
       /* sort and aggregate partial results */
       if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_hash_gby_get_next, &gbstate,
 			 &qexec_hash_gby_put_next, &gbstate, cmp_fn, &gbstate.agg_hash_context->sort_key, SORT_DUP,
-			 NO_SORT_LIMIT, gbstate.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
+			 NO_SORT_LIMIT, gbstate.output_file->tfile_vfid->tde_encrypted,
+			 prm_get_integer_value (PRM_ID_QUERY_SORT_THREADS)) != NO_ERROR)
 	{
 	  GOTO_EXIT_ON_ERROR;
 	}
@@ -4684,7 +5084,7 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
 
   if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_gby_get_next, &gbstate, &qexec_gby_put_next,
 		     &gbstate, gbstate.cmp_fn, &gbstate.key_info, SORT_DUP, NO_SORT_LIMIT,
-		     gbstate.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
+		     gbstate.output_file->tfile_vfid->tde_encrypted, prm_get_integer_value (PRM_ID_QUERY_SORT_THREADS)) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
@@ -4698,6 +5098,7 @@ qexec_groupby (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_stat
     {
       qexec_gby_finalize_group_dim (thread_p, &gbstate, NULL);
     }
+  gbstate.input_recs += hash_output_recs;
 
   /* close output file */
   qfile_close_list (thread_p, gbstate.output_file);
@@ -7554,6 +7955,11 @@ qexec_prune_spec (THREAD_ENTRY * thread_p, ACCESS_SPEC_TYPE * spec, VAL_DESCR *
 	  ASSERT_ERROR_AND_SET (error);
 	  return error;
 	}
+      qmgr_add_pruned_partition (thread_p, &ACCESS_SPEC_CLS_OID (spec), &partition_spec->oid);
+    }
+  if (spec->parts == NULL)
+    {
+      qmgr_add_pruned_partition (thread_p, &ACCESS_SPEC_CLS_OID (spec), &oid_Null_oid);
     }
 
   return NO_ERROR;
@@ -8072,6 +8478,14 @@ qexec_intprt_fnc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE * xasl_s
 				    {
 				      return S_SUCCESS;
 				    }
+				  /* the rest of the scan block cannot enter the top-n heap; go to next block */
+				  if (xasl->topn_items != NULL && xasl->topn_items->is_scan_stopped)
+				    {
+				      xasl->topn_items->is_scan_stopped = false;
+				      qexec_clear_all_lists (thread_p, xasl);
+				      ls_scan = S_END;
+				      break;
+				    }
 				}
 			    }
 			}
@@ -13517,10 +13931,8 @@ qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state *
 			 UPDDEL_CLASS_INSTANCE_LOCK_INFO * p_class_instance_lock_info)
 {
   int error = NO_ERROR;
-  bool on_trace;
-  TSC_TICKS start_tick, end_tick;
-  TSCTIMEVAL tv_diff;
-  UINT64 old_fetches = 0, old_ioreads = 0;
+  bool on_profile;
+  XASL_STATS_START stats_start;
 
   if (thread_get_recursion_depth (thread_p) > prm_get_integer_value (PRM_ID_MAX_RECURSION_SQL_DEPTH))
     {
@@ -13530,25 +13942,17 @@ qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state *
     }
   thread_inc_recursion_depth (thread_p);
 
-  on_trace = thread_is_on_trace (thread_p);
-  if (on_trace)
+  on_profile = thread_is_on_profile (thread_p);
+  if (on_profile)
     {
-      tsc_getticks (&start_tick);
-
-      old_fetches = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES);
-      old_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
+      qexec_start_xasl_stats (thread_p, &stats_start);
     }
 
   error = qexec_execute_mainblock_internal (thread_p, xasl, xstate, p_class_instance_lock_info);
 
-  if (on_trace)
+  if (on_profile)
     {
-      tsc_getticks (&end_tick);
-      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-      TSC_ADD_TIMEVAL (xasl->xasl_stats.elapsed_time, tv_diff);
-
-      xasl->xasl_stats.fetches += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - old_fetches;
-      xasl->xasl_stats.ioreads += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS) - old_ioreads;
+      qexec_end_xasl_stats (thread_p, &stats_start, xasl);
     }
 
   thread_dec_recursion_depth (thread_p);
@@ -13556,6 +13960,90 @@ qexec_execute_mainblock (THREAD_ENTRY * thread_p, xasl_node * xasl, xasl_state *
   return error;
 }
 
+/*
+ * qexec_get_thread_cpu_time () - get cpu time used by current thread
+ *   return:
+ *   cpu_time(out): cpu time, or zero if it cannot be read
+ */
+static void
+qexec_get_thread_cpu_time (struct timeval *cpu_time)
+{
+#if !defined (WINDOWS)
+  struct timespec ts;
+
+  if (clock_gettime (CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+    {
+      cpu_time->tv_sec = ts.tv_sec;
+      cpu_time->tv_usec = ts.tv_nsec / 1000;
+      return;
+    }
+#endif /* !WINDOWS */
+
+  cpu_time->tv_sec = 0;
+  cpu_time->tv_usec = 0;
+}
+
+/*
+ * qexec_start_xasl_stats () - save the values the execution profile of an XASL is computed from
+ *   return:
+ *   start(out): values when XASL starts executing
+ */
+static void
+qexec_start_xasl_stats (THREAD_ENTRY * thread_p, XASL_STATS_START * start)
+{
+  tsc_getticks (&start->start_tick);
+  qexec_get_thread_cpu_time (&start->cpu_time);
+
+  start->lock_waits = thread_p->event_stats.lock_waits;
+  start->latch_waits = thread_p->event_stats.latch_waits;
+  start->io_waits = thread_p->event_stats.io_waits;
+  start->temp_pages = thread_p->event_stats.temp_alloc_pages;
+
+  start->fetches = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES);
+  start->ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
+}
+
+/*
+ * qexec_end_xasl_stats () - add the execution since start to the profile of XASL
+ *   return:
+ *   start(in): values when XASL started executing
+ *   xasl(in/out): XASL that executed
+ *
+ * Note: the profile of an XASL includes the XASLs executed by it.
+ */
+static void
+qexec_end_xasl_stats (THREAD_ENTRY * thread_p, XASL_STATS_START * start, XASL_NODE * xasl)
+{
+  XASL_STATS *xasl_stats = &xasl->xasl_stats;
+  TSC_TICKS end_tick;
+  TSCTIMEVAL tv_diff;
+  struct timeval cpu_time;
+
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv_diff, end_tick, start->start_tick);
+  TSC_ADD_TIMEVAL (xasl_stats->elapsed_time, tv_diff);
+
+  qexec_get_thread_cpu_time (&cpu_time);
+  perfmon_diff_timeval (&tv_diff, &start->cpu_time, &cpu_time);
+  TSC_ADD_TIMEVAL (xasl_stats->cpu_time, tv_diff);
+
+  perfmon_diff_timeval (&tv_diff, &start->lock_waits, &thread_p->event_stats.lock_waits);
+  TSC_ADD_TIMEVAL (xasl_stats->lock_waits, tv_diff);
+  perfmon_diff_timeval (&tv_diff, &start->latch_waits, &thread_p->event_stats.latch_waits);
+  TSC_ADD_TIMEVAL (xasl_stats->latch_waits, tv_diff);
+  perfmon_diff_timeval (&tv_diff, &start->io_waits, &thread_p->event_stats.io_waits);
+  TSC_ADD_TIMEVAL (xasl_stats->io_waits, tv_diff);
+  xasl_stats->temp_pages += thread_p->event_stats.temp_alloc_pages - start->temp_pages;
+
+  xasl_stats->fetches += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - start->fetches;
+  xasl_stats->ioreads += perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS) - start->ioreads;
+
+  if (xasl->list_id != NULL)
+    {
+      xasl_stats->rows += xasl->list_id->tuple_cnt;
+    }
+}
+
 /*
  * qexec_check_limit_clause () - checks validity of limit clause
  *   return: NO_ERROR, or ER_code
@@ -14314,20 +14802,13 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 	  /* process CONNECT BY xasl */
 	  if (XASL_IS_FLAGED (xasl, XASL_HAS_CONNECT_BY))
 	    {
-	      TSC_TICKS start_tick, end_tick;
-	      TSCTIMEVAL tv_diff;
+	      XASL_STATS_START stats_start;
+	      bool on_profile;
 
-	      UINT64 old_fetches = 0, old_ioreads = 0;
-	      XASL_STATS *xasl_stats;
-	      bool on_trace;
-
-	      on_trace = thread_is_on_trace (thread_p);
-	      if (on_trace)
+	      on_profile = thread_is_on_profile (thread_p);
+	      if (on_profile)
 		{
-		  tsc_getticks (&start_tick);
-
-		  old_fetches = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES);
-		  old_ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS);
+		  qexec_start_xasl_stats (thread_p, &stats_start);
 		}
 
 	      if (qexec_execute_connect_by (thread_p, xasl->connect_by_ptr, xasl_state, &tplrec) != NO_ERROR)
@@ -14346,16 +14827,9 @@ qexec_execute_mainblock_internal (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XAS
 	      /* clear CONNECT BY internal lists */
 	      qexec_clear_connect_by_lists (thread_p, xasl->connect_by_ptr);
 
-	      if (on_trace)
+	      if (on_profile)
 		{
-		  xasl_stats = &xasl->connect_by_ptr->xasl_stats;
-
-		  tsc_getticks (&end_tick);
-		  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-		  TSC_ADD_TIMEVAL (xasl_stats->elapsed_time, tv_diff);
-
-		  xasl_stats->fetches = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_FETCHES) - old_fetches;
-		  xasl_stats->ioreads = perfmon_get_from_statistic (thread_p, PSTAT_PB_NUM_IOREADS) - old_ioreads;
+		  qexec_end_xasl_stats (thread_p, &stats_start, xasl->connect_by_ptr);
 		}
 	    }
 	}
@@ -14832,6 +15306,10 @@ qexec_execute_query (THREAD_ENTRY * thread_p, xasl_node * xasl, int dbval_cnt, c
 	{
 	  qexec_set_xasl_trace_to_session (thread_p, xasl);
 	}
+      if (thread_p->event_stats.trace_slow_query == true)
+	{
+	  qexec_log_slow_xasl_profile (thread_p, xasl);
+	}
 #endif
 
       if (stat != NO_ERROR)
@@ -19407,7 +19885,8 @@ qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
 
   if (sort_listfile (thread_p, NULL_VOLID, estimated_pages, &qexec_analytic_get_next, &analytic_state,
 		     &qexec_analytic_put_next, &analytic_state, analytic_state.cmp_fn, &analytic_state.key_info,
-		     SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted) != NO_ERROR)
+		     SORT_DUP, NO_SORT_LIMIT, analytic_state.output_file->tfile_vfid->tde_encrypted,
+		     prm_get_integer_value (PRM_ID_QUERY_SORT_THREADS)) != NO_ERROR)
     {
       GOTO_EXIT_ON_ERROR;
     }
@@ -19429,7 +19908,12 @@ qexec_execute_analytic (THREAD_ENTRY * thread_p, XASL_NODE * xasl, XASL_STATE *
    * interface doesn't include a finalization function.  If so, finish
    * off that group.
    */
-  if (analytic_state.input_recs != 0)
+  if (analytic_state.input_recs != 0 && analytic_state.is_streamed)
+    {
+      /* all tuples were written to output while sorted */
+      finalized = true;
+    }
+  else if (analytic_state.input_recs != 0)
     {
       for (i = 0; i < analytic_state.func_count; i++)
 	{
@@ -19686,6 +20170,7 @@ qexec_initialize_analytic_state (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analy
       analytic_state->key_info.use_original = 1;
       analytic_state->key_info.key = NULL;
       analytic_state->key_info.error = NO_ERROR;
+      analytic_state->key_info.use_key_prefix = false;
     }
 
   /* build function states */
@@ -19712,6 +20197,7 @@ qexec_initialize_analytic_state (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analy
 	  return NULL;
 	}
     }
+  analytic_state->is_streamed = qexec_analytic_is_streamable (analytic_state);
 
   /* initialize runtime structure */
   for (func_p = a_func_list; func_p != NULL; func_p = func_p->next)
@@ -19947,7 +20433,13 @@ qexec_analytic_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *a
 		    }
 		}
 
-	      if (!is_same_group)
+	      if (!is_same_group && analytic_state->is_streamed)
+		{
+		  /* nothing to dump, the results of group were already written */
+		  pr_clear_value (func_state->func_p->value);
+		  qexec_analytic_start_group (thread_p, analytic_state->xasl_state, func_state, recdes, true);
+		}
+	      else if (!is_same_group)
 		{
 		  if (qexec_analytic_finalize_group (thread_p, analytic_state->xasl_state, func_state, false) !=
 		      NO_ERROR)
@@ -19957,6 +20449,14 @@ qexec_analytic_put_next (THREAD_ENTRY * thread_p, const RECDES * recdes, void *a
 		  pr_clear_value (func_state->func_p->value);
 		  qexec_analytic_start_group (thread_p, analytic_state->xasl_state, func_state, recdes, true);
 		}
+	      else if (analytic_state->is_streamed)
+		{
+		  /* the rank goes on through the sort keys of group */
+		  if (qexec_analytic_set_current_key (thread_p, func_state, recdes) != NO_ERROR)
+		    {
+		      goto exit_on_error;
+		    }
+		}
 	      else if (func_state->func_p->function != PT_NTILE
 		       && (!QPROC_IS_INTERPOLATION_FUNC (func_state->func_p) || func_state->func_p->option == Q_ALL))
 		{
@@ -20063,6 +20563,78 @@ qexec_analytic_eval_instnum_pred (THREAD_ENTRY * thread_p, ANALYTIC_STATE * anal
   return NO_ERROR;
 }
 
+/*
+ * qexec_analytic_is_streamable () - can the functions be evaluated in one pass over the sorted tuples
+ *   returns: true if the results of every function are known when its tuple is read
+ *   analytic_state(in): analytic state
+ *
+ * NOTE: ROW_NUMBER, RANK and DENSE_RANK of a tuple only depend on the tuples sorted before it, so their results can be
+ *	 written along with the tuple, without the intermediate file and the group pass that reads it again.
+ */
+static bool
+qexec_analytic_is_streamable (ANALYTIC_STATE * analytic_state)
+{
+  int i;
+
+  if (analytic_state->is_last_run && (analytic_state->xasl->instnum_flag & XASL_INSTNUM_FLAG_EVAL_DEFER))
+    {
+      /* selected INST_NUM() is evaluated in group pass */
+      return false;
+    }
+
+  for (i = 0; i < analytic_state->func_count; i++)
+    {
+      switch (analytic_state->func_state_list[i].func_p->function)
+	{
+	case PT_ROW_NUMBER:
+	case PT_RANK:
+	case PT_DENSE_RANK:
+	  break;
+
+	default:
+	  /* result depends on the following tuples of group or sort key */
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * qexec_analytic_set_current_key () - record the sort key of current tuple
+ *   returns: error code or NO_ERROR
+ *   thread_p(in): thread entry
+ *   func_state(in): function state
+ *   key(in): sort key of current tuple
+ */
+static int
+qexec_analytic_set_current_key (THREAD_ENTRY * thread_p, ANALYTIC_FUNCTION_STATE * func_state, const RECDES * key)
+{
+  /*
+   * Keep the key in SORT_KEY format so we can continue to use the SORTKEY_INFO version of the comparison functions.
+   *
+   * WARNING: the sort module doesn't seem to set key->area_size reliably, so the only thing we can rely on is
+   * key->length.
+   */
+  if (func_state->current_key.area_size < key->length)
+    {
+      void *tmp;
+
+      tmp = db_private_realloc (thread_p, func_state->current_key.data, key->area_size);
+      if (tmp == NULL)
+	{
+	  assert (er_errid () != NO_ERROR);
+	  return er_errid ();
+	}
+      func_state->current_key.data = (char *) tmp;
+      func_state->current_key.area_size = key->area_size;
+    }
+  memcpy (func_state->current_key.data, key->data, key->length);
+  func_state->current_key.length = key->length;
+
+  return NO_ERROR;
+}
+
 /*
  * qexec_analytic_start_group () -
  *   return:
@@ -20076,30 +20648,10 @@ qexec_analytic_start_group (THREAD_ENTRY * thread_p, XASL_STATE * xasl_state, AN
 {
   int error;
 
-  /*
-   * Record the new key; keep it in SORT_KEY format so we can continue
-   * to use the SORTKEY_INFO version of the comparison functions.
-   *
-   * WARNING: the sort module doesn't seem to set key->area_size
-   * reliably, so the only thing we can rely on is key->length.
-   */
-
-  if (key)
+  /* record the new key */
+  if (key && qexec_analytic_set_current_key (thread_p, func_state, key) != NO_ERROR)
     {
-      if (func_state->current_key.area_size < key->length)
-	{
-	  void *tmp;
-
-	  tmp = db_private_realloc (thread_p, func_state->current_key.data, key->area_size);
-	  if (tmp == NULL)
-	    {
-	      GOTO_EXIT_ON_ERROR;
-	    }
-	  func_state->current_key.data = (char *) tmp;
-	  func_state->current_key.area_size = key->area_size;
-	}
-      memcpy (func_state->current_key.data, key->data, key->length);
-      func_state->current_key.length = key->length;
+      GOTO_EXIT_ON_ERROR;
     }
 
   /*
@@ -20250,8 +20802,31 @@ qexec_analytic_add_tuple (THREAD_ENTRY * thread_p, ANALYTIC_STATE * analytic_sta
       analytic_state->func_state_list[i].curr_sort_key_tuple_count++;
     }
 
-  /* check if output */
-  if (analytic_state->is_output_rec)
+  if (analytic_state->is_streamed)
+    {
+      /* results are final, write tuple to output */
+      for (i = 0; i < analytic_state->func_count; i++)
+	{
+	  ANALYTIC_TYPE *func_p = analytic_state->func_state_list[i].func_p;
+
+	  if (func_p->function != PT_ROW_NUMBER)
+	    {
+	      /* row number is evaluated into output value, ranks are in function value */
+	      if (qdata_copy_db_value (func_p->out_value, func_p->value) != true)
+		{
+		  GOTO_EXIT_ON_ERROR;
+		}
+	    }
+	}
+
+      if (analytic_state->is_output_rec
+	  && qexec_insert_tuple_into_list (thread_p, analytic_state->output_file, analytic_state->a_outptr_list,
+					   &xasl_state->vd, analytic_state->output_tplrec) != NO_ERROR)
+	{
+	  GOTO_EXIT_ON_ERROR;
+	}
+    }
+  else if (analytic_state->is_output_rec)
     {
       /* records that did not pass the instnum() predicate evaluation are used for computing the function value, but
        * are not included in the intermediate file */
@@ -23991,6 +24566,8 @@ qexec_setup_topn_proc (THREAD_ENTRY * thread_p, XASL_NODE * xasl, VAL_DESCR * vd
   top_n->heap = heap;
   top_n->sort_items = xasl->orderby_list;
   top_n->values_count = count;
+  top_n->is_first_key_ordered = qexec_is_topn_first_key_ordered (xasl);
+  top_n->is_scan_stopped = false;
 
   xasl->topn_items = top_n;
 
@@ -24116,6 +24693,36 @@ qexec_topn_cmpval (DB_VALUE * left, DB_VALUE * right, SORT_LIST * sort_spec)
   return BH_CMP_ERROR;
 }
 
+/*
+ * qexec_is_topn_first_key_ordered () - check if the tuples of the top-n sort come ordered by its first sort item
+ * return : true if the scan returns the tuples ordered by the first sort item
+ * xasl (in) : xasl node
+ *
+ * Note: The optimizer marks the index which cannot skip the order by, but still returns the rows ordered by the first
+ *	 order by column. The order is kept only by a single range forward scan of that index.
+ */
+static bool
+qexec_is_topn_first_key_ordered (XASL_NODE * xasl)
+{
+  ACCESS_SPEC_TYPE *spec = xasl->spec_list;
+  INDX_INFO *indx_info;
+
+  if (xasl->scan_ptr != NULL || spec == NULL || spec->next != NULL || xasl->merge_spec != NULL
+      || spec->access != ACCESS_METHOD_INDEX || spec->indexptr == NULL || xasl->iscan_oid_order)
+    {
+      return false;
+    }
+
+  indx_info = spec->indexptr;
+  if (!indx_info->orderby_first_key || indx_info->use_desc_index || indx_info->use_iss
+      || indx_info->ils_prefix_len > 0 || indx_info->key_info.key_cnt != 1)
+    {
+      return false;
+    }
+
+  return (indx_info->range_type == R_KEY || indx_info->range_type == R_RANGE);
+}
+
 /*
  * qexec_add_tuple_to_topn () - add a new tuple to top-n tuples
  * return : TOPN_SUCCESS if tuple was successfully processed, TOPN_OVERFLOW if
@@ -24187,6 +24794,11 @@ qexec_add_tuple_to_topn (THREAD_ENTRY * thread_p, TOPN_TUPLES * topn_items, QFIL
 	}
       if (res == BH_LT)
 	{
+	  if (key == topn_items->sort_items && topn_items->is_first_key_ordered)
+	    {
+	      /* the tuples that follow are not smaller on the first key either */
+	      topn_items->is_scan_stopped = true;
+	    }
 	  /* skip this tuple */
 	  return TOPN_SUCCESS;
 	}
@@ -24666,6 +25278,40 @@ qexec_set_xasl_trace_to_session (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
       session_set_trace_stats (thread_p, trace_str, thread_p->trace_format);
     }
 }
+
+/*
+ * qexec_log_slow_xasl_profile() - log the execution profile of a slow query to event log
+ *   return:
+ *   xasl(in): executed XASL
+ *
+ * Note: the profile is logged before the SLOW_QUERY event of the same query.
+ */
+static void
+qexec_log_slow_xasl_profile (THREAD_ENTRY * thread_p, XASL_NODE * xasl)
+{
+  FILE *log_fp;
+  int trace_slow_msec;
+  int indent = 2;
+
+  trace_slow_msec = prm_get_integer_value (PRM_ID_SQL_TRACE_SLOW_MSECS);
+  if (trace_slow_msec < 0 || TO_MSEC (xasl->xasl_stats.elapsed_time) < trace_slow_msec)
+    {
+      return;
+    }
+
+  log_fp = event_log_start (thread_p, "SLOW_QUERY_PROFILE");
+  if (log_fp == NULL)
+    {
+      return;
+    }
+
+  event_log_print_client_info (LOG_FIND_THREAD_TRAN_INDEX (thread_p), indent);
+  fprintf (log_fp, "%*csql: %s\n", indent, ' ', xasl->query_alias ? xasl->query_alias : "(UNKNOWN)");
+  qdump_print_stats_text (log_fp, xasl, indent);
+  fprintf (log_fp, "\n");
+
+  event_log_end (thread_p);
+}
 #endif /* SERVER_MODE */
 
 /*
@@ -24756,6 +25402,11 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->curr_part_value = NULL;
   proc->agg_hash_context->sort_key.key = NULL;
   proc->agg_hash_context->sort_key.nkeys = 0;
+  proc->agg_hash_context->sort_key.use_key_prefix = false;
+  proc->agg_hash_context->spill_count = 0;
+  proc->agg_hash_context->spill_base = -1;
+  proc->agg_hash_context->spill_tuple.size = 0;
+  proc->agg_hash_context->spill_tuple.tpl = NULL;
 
   /*
    * create temporary dbvalue array
@@ -24853,6 +25504,7 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   /* create sort key */
   proc->agg_hash_context->sort_key.key = NULL;
   proc->agg_hash_context->sort_key.nkeys = 0;
+  proc->agg_hash_context->sort_key.use_key_prefix = false;
 
   /* create list files */
   proc->agg_hash_context->part_list_id = qfile_open_list (thread_p, &type_list, NULL, xasl_state->query_id, 0);
@@ -24967,6 +25619,16 @@ qexec_alloc_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * pro
   proc->agg_hash_context->sorted_count = 0;
   proc->agg_hash_context->state = HS_ACCEPT_ALL;
 
+  /* groups that do not fit in hash table are spilled to partitions, unless the first tuples of the groups are output
+   * by the scan or the order of the groups must follow the order of the tuples */
+  proc->agg_hash_context->spill_enabled = (!proc->g_output_first_tuple
+					   && !prm_get_bool_value (PRM_ID_AGG_HASH_RESPECT_ORDER));
+
+  /* the input size is not known; ask for the fixed limit and take less when the server is busy */
+  proc->agg_hash_context->mem_limit =
+    qmgr_grant_work_memory (prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE),
+			    prm_get_bigint_value (PRM_ID_MAX_AGG_HASH_SIZE), HASH_AGGREGATE_MIN_MEM_LIMIT);
+
   /* all ok */
   return NO_ERROR;
 
@@ -25031,6 +25693,12 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
       proc->agg_hash_context->hash_table = NULL;
     }
 
+  if (proc->agg_hash_context->mem_limit > 0)
+    {
+      qmgr_release_work_memory (proc->agg_hash_context->mem_limit);
+      proc->agg_hash_context->mem_limit = 0;
+    }
+
   /* close scan */
   qfile_close_scan (thread_p, &proc->agg_hash_context->part_scan_id);
 
@@ -25051,6 +25719,28 @@ qexec_free_agg_hash_context (THREAD_ENTRY * thread_p, BUILDLIST_PROC_NODE * proc
       proc->agg_hash_context->sorted_part_list_id = NULL;
     }
 
+  /* free partitions of spilled groups */
+  while (proc->agg_hash_context->spill_count > 0)
+    {
+      QFILE_LIST_ID *spill_list_id;
+
+      proc->agg_hash_context->spill_count--;
+      spill_list_id = proc->agg_hash_context->spill_list_ids[proc->agg_hash_context->spill_count];
+      proc->agg_hash_context->spill_list_ids[proc->agg_hash_context->spill_count] = NULL;
+
+      qfile_close_list (thread_p, spill_list_id);
+      qfile_destroy_list (thread_p, spill_list_id);
+      qfile_free_list_id (spill_list_id);
+    }
+  proc->agg_hash_context->spill_base = -1;
+
+  if (proc->agg_hash_context->spill_tuple.tpl != NULL)
+    {
+      db_private_free (thread_p, proc->agg_hash_context->spill_tuple.tpl);
+      proc->agg_hash_context->spill_tuple.tpl = NULL;
+      proc->agg_hash_context->spill_tuple.size = 0;
+    }
+
   /* free temp keys and values */
   if (proc->agg_hash_context->temp_key != NULL)
     {
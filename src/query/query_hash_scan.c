@@ -32,7 +32,18 @@
 #include "db_value_printer.hpp"
 #include "dbtype.h"
 
+/* a block of join filter is a cache line */
+#define HASH_SCAN_FILTER_BLOCK_WORDS 8
+#define HASH_SCAN_FILTER_BLOCK_BITS (HASH_SCAN_FILTER_BLOCK_WORDS * 64)
+/* bits per build key and bits set by each key; about 2% of the keys not in build list pass the filter */
+#define HASH_SCAN_FILTER_BITS_PER_KEY 10
+#define HASH_SCAN_FILTER_NUM_PROBES 5
+/* every so many probes, the filter is disabled if it rejected less than 1 / HASH_SCAN_FILTER_MIN_REJECT_RATIO */
+#define HASH_SCAN_FILTER_CHECK_PROBES 4096
+#define HASH_SCAN_FILTER_MIN_REJECT_RATIO 8
+
 static bool safe_memcpy (void *data, void *source, int size);
+static UINT64 *qdata_hscan_filter_block (HASH_SCAN_FILTER * filter, unsigned int hash_val, UINT64 * probe);
 static DB_VALUE_COMPARE_RESULT qdata_hscan_key_compare (HASH_SCAN_KEY * ckey1, HASH_SCAN_KEY * ckey2, int *diff_pos);
 
 /*
@@ -202,6 +213,75 @@ qdata_hscan_key_eq (const void *key1, const void *key2)
   return (qdata_hscan_key_compare ((HASH_SCAN_KEY *) key1, (HASH_SCAN_KEY *) key2, &decoy) == DB_EQ);
 }
 
+/*
+ * qdata_alloc_hscan_pos () - allocate new hash scan position
+ *   returns: pointer to new structure or NULL on error
+ *   thread_p(in): thread
+ *   hash_val(in): hash value of build key
+ *   tplpos(in): position of build tuple in list file
+ */
+HASH_SCAN_POS *
+qdata_alloc_hscan_pos (cubthread::entry * thread_p, unsigned int hash_val, QFILE_TUPLE_POSITION * tplpos)
+{
+  HASH_SCAN_POS *pos;
+
+  pos = (HASH_SCAN_POS *) db_private_alloc (thread_p, sizeof (HASH_SCAN_POS));
+  if (pos == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (HASH_SCAN_POS));
+      return NULL;
+    }
+
+  pos->hash_val = hash_val;
+  pos->vpid = tplpos->vpid;
+  pos->offset = tplpos->offset;
+  pos->tplno = tplpos->tplno;
+  return pos;
+}
+
+/*
+ * qdata_hash_scan_pos () - hash of hash scan position
+ *   returns: hash value
+ *   key(in): hash scan position
+ *   ht_size(in): hash table size (in buckets)
+ */
+unsigned int
+qdata_hash_scan_pos (const void *key, unsigned int ht_size)
+{
+  return ((HASH_SCAN_POS *) key)->hash_val % ht_size;
+}
+
+/*
+ * qdata_hscan_pos_eq () - check equality of the build keys of two hash scan positions
+ *   returns: true if hash values are equal, false otherwise
+ *   key1(in): first position
+ *   key2(in): second position
+ *
+ * Note: build keys are not kept by hybrid method; equal hash values may still be different keys, the scan
+ *       predicate, which has the hash terms, rejects them.
+ */
+int
+qdata_hscan_pos_eq (const void *key1, const void *key2)
+{
+  return ((HASH_SCAN_POS *) key1)->hash_val == ((HASH_SCAN_POS *) key2)->hash_val;
+}
+
+/*
+ * qdata_free_hscan_pos_entry () - free entry of hybrid hash list scan
+ *   returns: NO_ERROR
+ *   key(in): hash scan position, the same as data
+ *   data(in): hash scan position
+ *   args(in): thread
+ */
+int
+qdata_free_hscan_pos_entry (const void *key, void *data, void *args)
+{
+  assert (key == data);
+
+  db_private_free ((cubthread::entry *) args, data);
+  return NO_ERROR;
+}
+
 /*
  * qdata_build_hscan_key () - build aggregate key structure from reguvar list
  *   returns: NO_ERROR or error code
@@ -429,3 +509,154 @@ qdata_free_hscan_entry (const void *key, void *data, void *args)
   /* all ok */
   return NO_ERROR;
 }
+
+/*
+ * qdata_alloc_hscan_filter () - allocate the join filter of a hash list scan
+ *   returns: pointer to new filter or NULL on error
+ *   thread_p(in): thread
+ *   key_count(in): number of build keys
+ *
+ * Note: the filter is a compact image of the build keys: the probe side rejects with it the keys that do not join,
+ *       without looking up the hash table (or reading the build list, for the hybrid method).
+ */
+HASH_SCAN_FILTER *
+qdata_alloc_hscan_filter (cubthread::entry * thread_p, INT64 key_count)
+{
+  HASH_SCAN_FILTER *filter;
+  size_t size;
+
+  filter = (HASH_SCAN_FILTER *) db_private_alloc (thread_p, sizeof (HASH_SCAN_FILTER));
+  if (filter == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (HASH_SCAN_FILTER));
+      return NULL;
+    }
+
+  filter->num_blocks =
+    (unsigned int) CEIL_PTVDIV (MAX (key_count, 1) * HASH_SCAN_FILTER_BITS_PER_KEY, HASH_SCAN_FILTER_BLOCK_BITS);
+  size = (size_t) filter->num_blocks * HASH_SCAN_FILTER_BLOCK_WORDS * sizeof (UINT64);
+  filter->blocks = (UINT64 *) db_private_alloc (thread_p, size);
+  if (filter->blocks == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      db_private_free (thread_p, filter);
+      return NULL;
+    }
+  memset (filter->blocks, 0, size);
+
+  filter->probe_count = 0;
+  filter->reject_count = 0;
+  filter->is_enabled = true;
+
+  return filter;
+}
+
+/*
+ * qdata_free_hscan_filter () - free the join filter of a hash list scan
+ *   returns: void
+ *   thread_p(in): thread
+ *   filter(in): filter
+ */
+void
+qdata_free_hscan_filter (cubthread::entry * thread_p, HASH_SCAN_FILTER * filter)
+{
+  if (filter == NULL)
+    {
+      return;
+    }
+
+  db_private_free (thread_p, filter->blocks);
+  db_private_free (thread_p, filter);
+}
+
+/*
+ * qdata_add_hscan_filter () - add a build key to the join filter
+ *   returns: void
+ *   filter(in): filter
+ *   hash_val(in): hash value of build key, qdata_hash_scan_key (key, INT_MAX)
+ */
+void
+qdata_add_hscan_filter (HASH_SCAN_FILTER * filter, unsigned int hash_val)
+{
+  UINT64 *block;
+  UINT64 probe;
+  int bit, i;
+
+  block = qdata_hscan_filter_block (filter, hash_val, &probe);
+  for (i = 0; i < HASH_SCAN_FILTER_NUM_PROBES; i++)
+    {
+      /* the top 9 bits of each probe choose a bit of block */
+      probe *= 0x9e3779b97f4a7c15ULL;
+      bit = (int) (probe >> 55);
+      block[bit >> 6] |= 1ULL << (bit & 63);
+    }
+}
+
+/*
+ * qdata_hscan_filter_rejects () - is a probe key surely not in build list?
+ *   returns: true if the key is not in build list; false if it may be
+ *   filter(in): filter
+ *   hash_val(in): hash value of probe key, qdata_hash_scan_key (key, INT_MAX)
+ */
+bool
+qdata_hscan_filter_rejects (HASH_SCAN_FILTER * filter, unsigned int hash_val)
+{
+  UINT64 *block;
+  UINT64 probe;
+  int bit, i;
+
+  if (!filter->is_enabled)
+    {
+      return false;
+    }
+
+  if (++filter->probe_count >= HASH_SCAN_FILTER_CHECK_PROBES)
+    {
+      /* when most probe keys join, checking the filter only adds to the hash table lookups */
+      if (filter->reject_count < filter->probe_count / HASH_SCAN_FILTER_MIN_REJECT_RATIO)
+	{
+	  filter->is_enabled = false;
+	  return false;
+	}
+      filter->probe_count = 0;
+      filter->reject_count = 0;
+    }
+
+  block = qdata_hscan_filter_block (filter, hash_val, &probe);
+  for (i = 0; i < HASH_SCAN_FILTER_NUM_PROBES; i++)
+    {
+      probe *= 0x9e3779b97f4a7c15ULL;
+      bit = (int) (probe >> 55);
+      if ((block[bit >> 6] & (1ULL << (bit & 63))) == 0)
+	{
+	  filter->reject_count++;
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * qdata_hscan_filter_block () - get the block of a key in join filter
+ *   returns: block
+ *   filter(in): filter
+ *   hash_val(in): hash value of key
+ *   probe(out): seed of the bits of key in block
+ */
+static UINT64 *
+qdata_hscan_filter_block (HASH_SCAN_FILTER * filter, unsigned int hash_val, UINT64 * probe)
+{
+  UINT64 hash;
+
+  /* spread the hash value, the hash values of integers are close to the integers */
+  hash = (UINT64) hash_val;
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+
+  *probe = hash;
+  return filter->blocks + ((hash >> 32) % filter->num_blocks) * HASH_SCAN_FILTER_BLOCK_WORDS;
+}
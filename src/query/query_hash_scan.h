@@ -29,6 +29,14 @@
 
 #include "regu_var.hpp"
 
+/* hash list scan methods */
+typedef enum
+{
+  HASH_METH_NOT_USE = 0,	/* list scan without hash */
+  HASH_METH_IN_MEM,		/* keys and tuples of build list are copied to memory */
+  HASH_METH_HYBRID		/* only hash values and positions of build tuples are in memory */
+} HASH_METHOD;
+
 /* hash scan value */
 typedef struct hash_scan_value HASH_SCAN_VALUE;
 struct hash_scan_value
@@ -45,16 +53,41 @@ struct hash_scan_key
   db_value **values;		/* value array */
 };
 
+/* hash scan position; key and value of hybrid hash list scan */
+typedef struct hash_scan_pos HASH_SCAN_POS;
+struct hash_scan_pos
+{
+  unsigned int hash_val;	/* hash value of build key */
+  VPID vpid;			/* page of build tuple in list file */
+  int offset;			/* offset of build tuple in page */
+  int tplno;			/* number of build tuple in page */
+};
+
+/* join filter of hash list scan: a blocked Bloom filter of the hash values of build keys */
+typedef struct hash_scan_filter HASH_SCAN_FILTER;
+struct hash_scan_filter
+{
+  UINT64 *blocks;		/* bits; each key sets bits of a single block */
+  unsigned int num_blocks;	/* number of blocks */
+  int probe_count;		/* probes of current check interval */
+  int reject_count;		/* probes of current check interval the filter rejected */
+  bool is_enabled;		/* false once the filter rejects too few probes to pay for itself */
+};
+
 /* hash list scan */
 typedef struct hash_list_scan HASH_LIST_SCAN;
 struct hash_list_scan
 {
   bool hash_list_scan_yn;	/* Is hash list scan possible? */
+  HASH_METHOD hash_method;	/* how build list is kept in hash table */
   regu_variable_list_node *build_regu_list;	/* regulator variable list */
   regu_variable_list_node *probe_regu_list;	/* regulator variable list */
   mht_table *hash_table;	/* memory hash table for hash list scan */
   hash_scan_key *temp_key;	/* temp probe key */
+  HASH_SCAN_POS temp_pos;	/* temp probe position (hash value only) for hybrid method */
   HENTRY_PTR curr_hash_entry;	/* current hash entry */
+  HASH_SCAN_FILTER *join_filter;	/* rejects the probe keys that are not in build list; may be NULL */
+  UINT64 work_memory_size;	/* work memory granted to hash table, see qmgr_grant_work_memory */
 };
 
 HASH_SCAN_KEY *qdata_alloc_hscan_key (THREAD_ENTRY * thread_p, int val_cnt, bool alloc_vals);
@@ -66,6 +99,11 @@ int qdata_free_hscan_entry (const void *key, void *data, void *args);
 
 int qdata_hscan_key_eq (const void *key1, const void *key2);
 
+HASH_SCAN_POS *qdata_alloc_hscan_pos (THREAD_ENTRY * thread_p, unsigned int hash_val, QFILE_TUPLE_POSITION * tplpos);
+unsigned int qdata_hash_scan_pos (const void *key, unsigned int ht_size);
+int qdata_hscan_pos_eq (const void *key1, const void *key2);
+int qdata_free_hscan_pos_entry (const void *key, void *data, void *args);
+
 int qdata_build_hscan_key (THREAD_ENTRY * thread_p, val_descr * vd, REGU_VARIABLE_LIST regu_list, HASH_SCAN_KEY * key);
 unsigned int qdata_hash_scan_key (const void *key, unsigned int ht_size);
 HASH_SCAN_KEY *qdata_copy_hscan_key (THREAD_ENTRY * thread_p, HASH_SCAN_KEY * key,
@@ -73,4 +111,9 @@ HASH_SCAN_KEY *qdata_copy_hscan_key (THREAD_ENTRY * thread_p, HASH_SCAN_KEY * ke
 
 int qdata_print_hash_scan_entry (THREAD_ENTRY * thread_p, FILE * fp, const void *key, void *data, void *args);
 
+HASH_SCAN_FILTER *qdata_alloc_hscan_filter (THREAD_ENTRY * thread_p, INT64 key_count);
+void qdata_free_hscan_filter (THREAD_ENTRY * thread_p, HASH_SCAN_FILTER * filter);
+void qdata_add_hscan_filter (HASH_SCAN_FILTER * filter, unsigned int hash_val);
+bool qdata_hscan_filter_rejects (HASH_SCAN_FILTER * filter, unsigned int hash_val);
+
 #endif /* _QUERY_HASH_SCAN_H_ */
@@ -37,6 +37,7 @@
 #include "object_representation.h"
 #include "xserver_interface.h"
 #include "query_executor.h"
+#include "partition_sr.h"
 #include "stream_to_xasl.h"
 #include "session.h"
 #include "filter_pred_cache.h"
@@ -105,6 +106,7 @@ struct qmgr_tran_entry
   QMGR_QUERY_ENTRY *free_query_entry_list_p;	/* free query entry list */
 
   OID_BLOCK_LIST *modified_classes_p;	/* array of class OIDs */
+  OID_BLOCK_LIST *modified_roots_p;	/* array of the partitioned classes of the modified partitions */
 };
 
 typedef struct qmgr_temp_file_list QMGR_TEMP_FILE_LIST;
@@ -136,6 +138,21 @@ QMGR_QUERY_TABLE qmgr_Query_table = { NULL, 0, NULL,
   {{PTHREAD_MUTEX_INITIALIZER, NULL, 0}, {PTHREAD_MUTEX_INITIALIZER, NULL, 0}}
 };
 
+/*
+ * Server-wide budget of the work memory of query operators (sort buffers, aggregate hash tables and hash list scans).
+ * See qmgr_grant_work_memory.
+ */
+typedef struct qmgr_work_memory QMGR_WORK_MEMORY;
+struct qmgr_work_memory
+{
+  pthread_mutex_t mutex;
+  UINT64 granted_size;		/* memory granted to the operators that run now */
+  int num_grants;		/* number of operators holding a grant */
+  int num_queries;		/* number of query entries in use; access with atomic operations */
+};
+
+static QMGR_WORK_MEMORY qmgr_Work_memory = { PTHREAD_MUTEX_INITIALIZER, 0, 0, 0 };
+
 int xcache_invalidate_qcaches (THREAD_ENTRY * thread_p, const OID * arg);
 
 #if !defined(SERVER_MODE)
@@ -160,6 +177,7 @@ static void qmgr_free_tran_entries (void);
 static void qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry_p);
 static OID_BLOCK_LIST *qmgr_allocate_oid_block (THREAD_ENTRY * thread_p);
 static void qmgr_free_oid_block (THREAD_ENTRY * thread_p, OID_BLOCK_LIST * oid_block);
+static bool qmgr_add_oid_to_block_list (OID_BLOCK_LIST ** oid_block_list_p, const OID * oid_p);
 static int qmgr_init_external_file_page (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
 static PAGE_PTR qmgr_get_external_file_page (THREAD_ENTRY * thread_p, VPID * vpid, QMGR_TEMP_FILE * vfid);
 static int qmgr_free_query_temp_file_helper (THREAD_ENTRY * thread_p, QMGR_QUERY_ENTRY * query_p);
@@ -180,6 +198,8 @@ static void qmgr_initialize_temp_file_list (QMGR_TEMP_FILE_LIST * temp_file_list
 static void qmgr_finalize_temp_file_list (QMGR_TEMP_FILE_LIST * temp_file_list_p);
 static QMGR_TEMP_FILE *qmgr_get_temp_file_from_list (QMGR_TEMP_FILE_LIST * temp_file_list_p);
 static void qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p);
+static PAGE_PTR qmgr_get_membuf_ext_page (QMGR_TEMP_FILE * tfile_vfid_p, VPID * vpid_p);
+static int qmgr_get_membuf_ext_used_pages (QMGR_TEMP_FILE * tfile_vfid_p);
 
 static int copy_bind_value_to_tdes (THREAD_ENTRY * thread_p, int num_bind_vals, DB_VALUE * bind_vals);
 
@@ -197,7 +217,13 @@ qmgr_get_page_type (PAGE_PTR page_p, QMGR_TEMP_FILE * temp_file_p)
   PAGE_PTR begin_page = NULL, end_page = NULL;
 
   if (temp_file_p != NULL && temp_file_p->membuf_last >= 0 && temp_file_p->membuf && page_p >= temp_file_p->membuf[0]
-      && page_p <= temp_file_p->membuf[temp_file_p->membuf_last])
+      && page_p <= temp_file_p->membuf[MIN (temp_file_p->membuf_last, temp_file_p->membuf_npages - 1)])
+    {
+      return QMGR_MEMBUF_PAGE;
+    }
+
+  if (temp_file_p != NULL && temp_file_p->membuf_ext != NULL && page_p >= temp_file_p->membuf_ext
+      && page_p < temp_file_p->membuf_ext + temp_file_p->membuf_ext_npages * DB_PAGESIZE)
     {
       return QMGR_MEMBUF_PAGE;
     }
@@ -316,6 +342,8 @@ qmgr_allocate_query_entry (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry
 	}
 
       query_p->list_id = NULL;
+      query_p->pruned_oids = NULL;
+      query_p->pruned_oids_size = 0;
 
       tran_entry_p->num_query_entries++;
     }
@@ -353,6 +381,8 @@ qmgr_allocate_query_entry (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry
   query_p->temp_vfid = NULL;
   query_p->num_tmp = 0;
   query_p->total_count = 0;
+  query_p->membuf_budget = prm_get_integer_value (PRM_ID_TEMP_MEM_BUFFER_QUERY_PAGES);
+  query_p->n_pruned_oids = 0;
   XASL_ID_SET_NULL (&query_p->xasl_id);
   query_p->xasl_ent = NULL;
   query_p->list_id = NULL;
@@ -363,6 +393,8 @@ qmgr_allocate_query_entry (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry
   query_p->is_holdable = false;
   query_p->includes_tde_class = false;
 
+  ATOMIC_INC_32 (&qmgr_Work_memory.num_queries, 1);
+
 #if defined (NDEBUG)
   /* just a safe guard for a release build. I don't expect it will be hit. */
   if (usable == false)
@@ -399,6 +431,8 @@ qmgr_free_query_entry (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tran_entry_p,
       QFILE_FREE_AND_INIT_LIST_ID (query_p->list_id);
     }
 
+  ATOMIC_INC_32 (&qmgr_Work_memory.num_queries, -1);
+
   query_p->next = NULL;
 
   query_p->next = tran_entry_p->free_query_entry_list_p;
@@ -455,6 +489,11 @@ qmgr_deallocate_query_entries (QMGR_QUERY_ENTRY * query_p)
 	  QFILE_FREE_AND_INIT_LIST_ID (p->list_id);
 	}
 
+      if (p->pruned_oids)
+	{
+	  free_and_init (p->pruned_oids);
+	}
+
       free_and_init (p);
     }
 }
@@ -635,6 +674,7 @@ qmgr_initialize_tran_entry (QMGR_TRAN_ENTRY * tran_entry_p)
   tran_entry_p->query_entry_list_p = NULL;
   tran_entry_p->free_query_entry_list_p = NULL;
   tran_entry_p->modified_classes_p = NULL;
+  tran_entry_p->modified_roots_p = NULL;
 }
 
 /*
@@ -726,6 +766,7 @@ qmgr_free_tran_entries (void)
       qmgr_deallocate_query_entries (tran_entry_p->query_entry_list_p);
       qmgr_deallocate_query_entries (tran_entry_p->free_query_entry_list_p);
       qmgr_deallocate_oid_blocks (tran_entry_p->modified_classes_p);
+      qmgr_deallocate_oid_blocks (tran_entry_p->modified_roots_p);
 
       tran_entry_p++;
     }
@@ -1176,7 +1217,8 @@ qmgr_process_query (THREAD_ENTRY * thread_p, XASL_NODE * xasl_tree, char *xasl_s
     }
   else
     {
-      if (stx_map_stream_to_xasl (thread_p, &xasl_p, false, xasl_stream, xasl_stream_size, &xasl_buf_info) != NO_ERROR)
+      if (stx_map_stream_to_xasl (thread_p, &xasl_p, false, false, xasl_stream, xasl_stream_size, &xasl_buf_info)
+	  != NO_ERROR)
 	{
 	  goto exit_on_error;
 	}
@@ -1279,6 +1321,7 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
   int tran_index = -1;
   QMGR_TRAN_ENTRY *tran_entry_p;
   QFILE_LIST_ID *list_id_p, *tmp_list_id_p;
+  struct timeval exec_start_time, exec_end_time;
   bool cached_result;
   bool saved_is_stats_on;
   bool xasl_trace;
@@ -1322,6 +1365,8 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
     {
       thread_trace_on (thread_p);
       perfmon_start_watch (thread_p);
+      /* collect the waits for the trace */
+      thread_p->event_stats.trace_slow_query = true;
 
       if (IS_XASL_TRACE_TEXT (*flag_p))
 	{
@@ -1506,12 +1551,16 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 
   assert (cached_result == false);
 
+  gettimeofday (&exec_start_time, NULL);
   list_id_p =
     qmgr_process_query (thread_p, xclone.xasl, NULL, 0, dbval_count, dbvals_p, *flag_p, query_p, tran_entry_p);
   if (list_id_p == NULL)
     {
       goto exit_on_error;
     }
+  gettimeofday (&exec_end_time, NULL);
+
+  xcache_record_cardinality (thread_p, xasl_cache_entry_p, xclone.xasl, list_id_p->tuple_cnt);
 
   /* everything is ok, mark that the query is completed */
   qmgr_mark_query_as_completed (query_p);
@@ -1564,7 +1613,8 @@ xqmgr_execute_query (THREAD_ENTRY * thread_p, const XASL_ID * xasl_id_p, QUERY_I
 
 	  list_cache_entry_p =
 	    qfile_update_list_cache_entry (thread_p, &xasl_cache_entry_p->list_ht_no, &params, list_id_p,
-					   xasl_cache_entry_p);
+					   xasl_cache_entry_p, timeval_diff_in_msec (&exec_end_time, &exec_start_time),
+					   query_p->pruned_oids, MAX (query_p->n_pruned_oids, 0));
 
 	  if (list_cache_entry_p == NULL)
 	    {
@@ -1795,6 +1845,8 @@ xqmgr_prepare_and_execute_query (THREAD_ENTRY * thread_p, char *xasl_stream, int
     {
       thread_trace_on (thread_p);
       perfmon_start_watch (thread_p);
+      /* collect the waits for the trace */
+      thread_p->event_stats.trace_slow_query = true;
 
       if (IS_XASL_TRACE_TEXT (*flag_p))
 	{
@@ -2066,6 +2118,8 @@ qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tr
 {
   OID_BLOCK_LIST *oid_block_p;
   OID *class_oid_p;
+  OID *modified_oids = NULL;
+  int n_modified_oids = 0;
   int i;
 
   for (oid_block_p = tran_entry_p->modified_classes_p; oid_block_p; oid_block_p = oid_block_p->next)
@@ -2078,8 +2132,58 @@ qmgr_clear_relative_cache_entries (THREAD_ENTRY * thread_p, QMGR_TRAN_ENTRY * tr
 			    "qm_clear_trans_wakeup: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
 			    class_oid_p->pageid, class_oid_p->slotid, class_oid_p->volid);
 	    }
+	  n_modified_oids++;
 	}
     }
+
+  if (tran_entry_p->modified_roots_p == NULL || tran_entry_p->modified_roots_p->last_oid_idx == 0)
+    {
+      return;
+    }
+
+  if (prm_get_bool_value (PRM_ID_LIST_QUERY_CACHE_PARTITION_INVALIDATION) && n_modified_oids > 0)
+    {
+      /* gather the modified classes; the modified partitions of each partitioned class are among them */
+      modified_oids = (OID *) malloc (n_modified_oids * sizeof (OID));
+      if (modified_oids != NULL)
+	{
+	  n_modified_oids = 0;
+	  for (oid_block_p = tran_entry_p->modified_classes_p; oid_block_p; oid_block_p = oid_block_p->next)
+	    {
+	      memcpy (modified_oids + n_modified_oids, oid_block_p->oid_array,
+		      oid_block_p->last_oid_idx * sizeof (OID));
+	      n_modified_oids += oid_block_p->last_oid_idx;
+	    }
+	}
+    }
+
+  for (oid_block_p = tran_entry_p->modified_roots_p; oid_block_p; oid_block_p = oid_block_p->next)
+    {
+      for (i = 0, class_oid_p = oid_block_p->oid_array; i < oid_block_p->last_oid_idx; i++, class_oid_p++)
+	{
+	  int error;
+
+	  if (modified_oids != NULL)
+	    {
+	      error = xcache_invalidate_qcaches_by_partitions (thread_p, class_oid_p, modified_oids, n_modified_oids);
+	    }
+	  else
+	    {
+	      error = xcache_invalidate_qcaches (thread_p, class_oid_p);
+	    }
+	  if (error != NO_ERROR)
+	    {
+	      er_log_debug (ARG_FILE_LINE,
+			    "qm_clear_trans_wakeup: qexec_clear_list_cache_by_class failed for class { %d %d %d }\n",
+			    class_oid_p->pageid, class_oid_p->slotid, class_oid_p->volid);
+	    }
+	}
+    }
+
+  if (modified_oids != NULL)
+    {
+      free_and_init (modified_oids);
+    }
 }
 
 /*
@@ -2131,6 +2235,7 @@ qmgr_clear_trans_wakeup (THREAD_ENTRY * thread_p, int tran_index, bool is_tran_d
 	  qmgr_clear_relative_cache_entries (thread_p, tran_entry_p);
 	}
       qmgr_free_oid_block (thread_p, tran_entry_p->modified_classes_p);
+      qmgr_free_oid_block (thread_p, tran_entry_p->modified_roots_p);
     }
 
   if (tran_entry_p->query_entry_list_p == NULL)
@@ -2257,69 +2362,153 @@ qmgr_free_oid_block (THREAD_ENTRY * thread_p, OID_BLOCK_LIST * oid_block_p)
 }
 
 /*
- * qmgr_add_modified_class () -
- *   return:
- *   class_oid(in)      :
+ * qmgr_add_oid_to_block_list () -
+ *   return: true if the OID was added, false if it was already in the list or could not be added
+ *   oid_block_list_p(in/out)   :
+ *   oid_p(in)  :
  */
-void
-qmgr_add_modified_class (THREAD_ENTRY * thread_p, const OID * class_oid_p)
+static bool
+qmgr_add_oid_to_block_list (OID_BLOCK_LIST ** oid_block_list_p, const OID * oid_p)
 {
-  int tran_index;
-  QMGR_TRAN_ENTRY *tran_entry_p;
   OID_BLOCK_LIST *oid_block_p, *tmp_oid_block_p;
   OID *tmp_oid_p;
   int i;
-  bool found;
 
-  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
-  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
-  if (tran_entry_p->modified_classes_p == NULL)
+  if (*oid_block_list_p == NULL)
     {
-      tran_entry_p->modified_classes_p = (OID_BLOCK_LIST *) malloc (sizeof (OID_BLOCK_LIST));
-      if (tran_entry_p->modified_classes_p == NULL)
+      *oid_block_list_p = (OID_BLOCK_LIST *) malloc (sizeof (OID_BLOCK_LIST));
+      if (*oid_block_list_p == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (OID_BLOCK_LIST));
-	  return;
+	  return false;
 	}
-      tran_entry_p->modified_classes_p->last_oid_idx = 0;
-      tran_entry_p->modified_classes_p->next = NULL;
+      (*oid_block_list_p)->last_oid_idx = 0;
+      (*oid_block_list_p)->next = NULL;
     }
 
-  found = false;
-  tmp_oid_block_p = tran_entry_p->modified_classes_p;
+  tmp_oid_block_p = *oid_block_list_p;
   do
     {
       oid_block_p = tmp_oid_block_p;
       for (i = 0, tmp_oid_p = oid_block_p->oid_array; i < oid_block_p->last_oid_idx; i++, tmp_oid_p++)
 	{
-	  if (oid_compare (class_oid_p, tmp_oid_p) == 0)
+	  if (oid_compare (oid_p, tmp_oid_p) == 0)
 	    {
-	      found = true;
-	      break;
+	      return false;
 	    }
 	}
       tmp_oid_block_p = oid_block_p->next;
     }
   while (tmp_oid_block_p);
 
-  if (!found)
+  if (oid_block_p->last_oid_idx < OID_BLOCK_ARRAY_SIZE)
     {
-      if (oid_block_p->last_oid_idx < OID_BLOCK_ARRAY_SIZE)
-	{
-	  oid_block_p->oid_array[oid_block_p->last_oid_idx++] = *class_oid_p;
-	}
-      else if ((oid_block_p->next = (OID_BLOCK_LIST *) malloc (sizeof (OID_BLOCK_LIST))))
+      oid_block_p->oid_array[oid_block_p->last_oid_idx++] = *oid_p;
+    }
+  else if ((oid_block_p->next = (OID_BLOCK_LIST *) malloc (sizeof (OID_BLOCK_LIST))))
+    {
+      oid_block_p = oid_block_p->next;
+      oid_block_p->last_oid_idx = 0;
+      oid_block_p->next = NULL;
+      oid_block_p->oid_array[oid_block_p->last_oid_idx++] = *oid_p;
+    }
+  else
+    {
+      assert (false);
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * qmgr_add_modified_class () -
+ *   return:
+ *   class_oid(in)      :
+ *
+ * Note: The partitioned class of a modified partition is kept too, since the results of the queries on the
+ *       partitioned class are made from its partitions.
+ */
+void
+qmgr_add_modified_class (THREAD_ENTRY * thread_p, const OID * class_oid_p)
+{
+  int tran_index;
+  QMGR_TRAN_ENTRY *tran_entry_p;
+  OID root_oid;
+
+  tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+  tran_entry_p = &qmgr_Query_table.tran_entries_p[tran_index];
+
+  if (!qmgr_add_oid_to_block_list (&tran_entry_p->modified_classes_p, class_oid_p))
+    {
+      return;
+    }
+
+  if (partition_find_root_class_oid (thread_p, class_oid_p, &root_oid) != NO_ERROR)
+    {
+      er_clear ();
+      return;
+    }
+  if (!OID_ISNULL (&root_oid) && !OID_EQ (&root_oid, class_oid_p))
+    {
+      (void) qmgr_add_oid_to_block_list (&tran_entry_p->modified_roots_p, &root_oid);
+    }
+}
+
+/*
+ * qmgr_add_pruned_partition () - keep a partition the current query scans after pruning
+ *   return:
+ *   root_oid(in)       : partitioned class
+ *   partition_oid(in)  : partition, or NULL OID if pruning left no partition
+ *
+ * Note: The pairs are kept with the cached result of the query, so that modifying the other partitions of the class
+ *       does not invalidate it.
+ */
+void
+qmgr_add_pruned_partition (THREAD_ENTRY * thread_p, const OID * root_oid, const OID * partition_oid)
+{
+  QMGR_QUERY_ENTRY *query_p;
+  OID *pair, *new_oids;
+  int i, new_size;
+
+  if (QFILE_IS_LIST_CACHE_DISABLED || !prm_get_bool_value (PRM_ID_LIST_QUERY_CACHE_PARTITION_INVALIDATION))
+    {
+      return;
+    }
+
+  query_p =
+    qmgr_get_query_entry (thread_p, qmgr_get_current_query_id (thread_p), LOG_FIND_THREAD_TRAN_INDEX (thread_p));
+  if (query_p == NULL || query_p->n_pruned_oids < 0)
+    {
+      return;
+    }
+
+  for (i = 0, pair = query_p->pruned_oids; i < query_p->n_pruned_oids; i++, pair += 2)
+    {
+      if (OID_EQ (&pair[0], root_oid) && OID_EQ (&pair[1], partition_oid))
 	{
-	  oid_block_p = oid_block_p->next;
-	  oid_block_p->last_oid_idx = 0;
-	  oid_block_p->next = NULL;
-	  oid_block_p->oid_array[oid_block_p->last_oid_idx++] = *class_oid_p;
+	  return;
 	}
-      else
+    }
+
+  if (query_p->n_pruned_oids >= query_p->pruned_oids_size)
+    {
+      new_size = (query_p->pruned_oids_size == 0) ? 8 : query_p->pruned_oids_size * 2;
+      new_oids = (OID *) realloc (query_p->pruned_oids, new_size * 2 * sizeof (OID));
+      if (new_oids == NULL)
 	{
-	  assert (false);
+	  /* a partial list would keep the result after its partitions are modified */
+	  query_p->n_pruned_oids = -1;
+	  return;
 	}
+      query_p->pruned_oids = new_oids;
+      query_p->pruned_oids_size = new_size;
     }
+
+  pair = query_p->pruned_oids + query_p->n_pruned_oids * 2;
+  COPY_OID (&pair[0], root_oid);
+  COPY_OID (&pair[1], partition_oid);
+  query_p->n_pruned_oids++;
 }
 
 /*
@@ -2354,7 +2543,7 @@ qmgr_get_old_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
 
       if (vpid_p->pageid >= 0 && vpid_p->pageid <= tfile_vfid_p->membuf_last)
 	{
-	  page_p = tfile_vfid_p->membuf[vpid_p->pageid];
+	  page_p = QMGR_GET_MEMBUF_PAGE (tfile_vfid_p, vpid_p->pageid);
 
 	  /* interrupt check */
 #if defined (SERVER_MODE)
@@ -2492,7 +2681,14 @@ qmgr_get_new_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
       return tfile_vfid_p->membuf[tfile_vfid_p->membuf_last];
     }
 
-  /* memory buffer is exhausted; create temp file */
+  /* memory buffer is exhausted; take memory pages from the budget of the query while it lasts */
+  page_p = qmgr_get_membuf_ext_page (tfile_vfid_p, vpid_p);
+  if (page_p != NULL)
+    {
+      return page_p;
+    }
+
+  /* create temp file */
   if (VFID_ISNULL (&tfile_vfid_p->temp_vfid))
     {
       TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
@@ -2532,6 +2728,84 @@ qmgr_get_new_page (THREAD_ENTRY * thread_p, VPID * vpid_p, QMGR_TEMP_FILE * tfil
   return page_p;
 }
 
+/*
+ * qmgr_get_membuf_ext_page () - get a new memory page for a temporary file whose memory buffer is full
+ *   return: PAGE_PTR, or NULL if the file has to go on in a temp file
+ *   tfile_vfid_p(in): temporary file
+ *   vpid_p(out): set to the memory page identifier
+ *
+ * Note: The pages are taken from the memory budget of the query, so the small results of a query never get to the
+ *       page buffer. Once a file has pages on disk, it does not take memory pages anymore.
+ */
+static PAGE_PTR
+qmgr_get_membuf_ext_page (QMGR_TEMP_FILE * tfile_vfid_p, VPID * vpid_p)
+{
+  QFILE_PAGE_HEADER page_header = QFILE_PAGE_HEADER_INITIALIZER;
+  PAGE_PTR page_p;
+  int ext_pageid, npages;
+
+  if (tfile_vfid_p->membuf == NULL || tfile_vfid_p->membuf_type != TEMP_FILE_MEMBUF_NORMAL
+      || tfile_vfid_p->membuf_budget_p == NULL || !VFID_ISNULL (&tfile_vfid_p->temp_vfid))
+    {
+      return NULL;
+    }
+
+  if (tfile_vfid_p->membuf_ext == NULL)
+    {
+      npages = prm_get_integer_value (PRM_ID_TEMP_MEM_BUFFER_QUERY_PAGES);
+      if (npages <= 0 || *tfile_vfid_p->membuf_budget_p <= 0)
+	{
+	  return NULL;
+	}
+
+      /* the memory of a page is touched only when the page is used */
+      tfile_vfid_p->membuf_ext = (PAGE_PTR) malloc ((size_t) npages * DB_PAGESIZE);
+      if (tfile_vfid_p->membuf_ext == NULL)
+	{
+	  /* not an error; use the temp file */
+	  return NULL;
+	}
+      tfile_vfid_p->membuf_ext_npages = npages;
+    }
+
+  ext_pageid = tfile_vfid_p->membuf_last + 1 - tfile_vfid_p->membuf_npages;
+  if (ext_pageid >= tfile_vfid_p->membuf_ext_npages)
+    {
+      return NULL;
+    }
+
+  /* the temp files of a query may be built by several threads */
+  if (ATOMIC_INC_32 (tfile_vfid_p->membuf_budget_p, -1) < 0)
+    {
+      ATOMIC_INC_32 (tfile_vfid_p->membuf_budget_p, 1);
+      return NULL;
+    }
+
+  page_p = tfile_vfid_p->membuf_ext + ext_pageid * DB_PAGESIZE;
+  qmgr_put_page_header (page_p, &page_header);
+
+  vpid_p->volid = NULL_VOLID;
+  vpid_p->pageid = ++(tfile_vfid_p->membuf_last);
+
+  return page_p;
+}
+
+/*
+ * qmgr_get_membuf_ext_used_pages () - number of memory pages a temporary file took from the budget of its query
+ *   return: number of pages
+ *   tfile_vfid_p(in): temporary file
+ */
+static int
+qmgr_get_membuf_ext_used_pages (QMGR_TEMP_FILE * tfile_vfid_p)
+{
+  if (tfile_vfid_p->membuf_ext == NULL || tfile_vfid_p->membuf_last < tfile_vfid_p->membuf_npages)
+    {
+      return 0;
+    }
+
+  return tfile_vfid_p->membuf_last + 1 - tfile_vfid_p->membuf_npages;
+}
+
 /*
  * qmgr_init_external_file_page () - initialize new query result page
  *
@@ -2643,6 +2917,9 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
   tfile_vfid_p->temp_file_type = FILE_TEMP;
   tfile_vfid_p->membuf_npages = num_buffer_pages;
   tfile_vfid_p->membuf_type = membuf_type;
+  tfile_vfid_p->membuf_ext = NULL;
+  tfile_vfid_p->membuf_ext_npages = 0;
+  tfile_vfid_p->membuf_budget_p = NULL;
   tfile_vfid_p->preserved = false;
   tfile_vfid_p->tde_encrypted = false;
   tfile_vfid_p->membuf_last = -1;
@@ -2682,6 +2959,8 @@ qmgr_create_new_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP
       tfile_vfid_p->tde_encrypted = true;
     }
 
+  tfile_vfid_p->membuf_budget_p = &query_p->membuf_budget;
+
   /* chain allocated tfile_vfid to the query_entry */
   temp = query_p->temp_vfid;
   query_p->temp_vfid = tfile_vfid_p;
@@ -2745,6 +3024,9 @@ qmgr_create_result_file (THREAD_ENTRY * thread_p, QUERY_ID query_id)
   tfile_vfid_p->membuf = NULL;
   tfile_vfid_p->membuf_npages = 0;
   tfile_vfid_p->membuf_type = TEMP_FILE_MEMBUF_NONE;
+  tfile_vfid_p->membuf_ext = NULL;
+  tfile_vfid_p->membuf_ext_npages = 0;
+  tfile_vfid_p->membuf_budget_p = NULL;
   tfile_vfid_p->preserved = false;
   tfile_vfid_p->tde_encrypted = false;
 
@@ -3009,6 +3291,9 @@ qmgr_free_list_temp_file (THREAD_ENTRY * thread_p, QUERY_ID query_id, QMGR_TEMP_
 	    }
 	}
 
+      /* the query goes on; give back the memory pages of the file */
+      ATOMIC_INC_32 (&query_p->membuf_budget, qmgr_get_membuf_ext_used_pages (tfile_vfid_p));
+
       if (tfile_vfid_p->temp_file_type != FILE_QUERY_AREA)
 	{
 	  qmgr_put_temp_file_into_list (tfile_vfid_p);
@@ -3301,6 +3586,12 @@ qmgr_put_temp_file_into_list (QMGR_TEMP_FILE * temp_file_p)
     }
 
   temp_file_p->membuf_last = -1;
+  if (temp_file_p->membuf_ext != NULL)
+    {
+      free_and_init (temp_file_p->membuf_ext);
+      temp_file_p->membuf_ext_npages = 0;
+    }
+  temp_file_p->membuf_budget_p = NULL;
 
   if (QMGR_IS_VALID_MEMBUF_TYPE (temp_file_p->membuf_type))
     {
@@ -3528,3 +3819,76 @@ qmgr_get_query_sql_user_text (THREAD_ENTRY * thread_p, QUERY_ID query_id, int tr
 
   return query_str;
 }
+
+/*
+ * qmgr_grant_work_memory () - grant work memory to a query operator
+ *   return: granted size; it is never more than request_size, and may be 0
+ *   request_size(in): memory the operator could use, by the estimated size of its input
+ *   default_size(in): fixed memory limit of the operator, granted when query_work_memory_size is 0
+ *   min_size(in): memory the operator needs to run at all; granted even if the budget is exhausted
+ *
+ * Note: The budget is shared by the queries in use and by the operators that hold a grant, so an operator of a quiet
+ *       server may get more than its fixed limit and the operators of a busy server get less. A grant does not
+ *       change until it is released, the pressure of other queries limits only the grants that come after them.
+ *       Operators that spill use their grant as the spill threshold. Every grant is released with
+ *       qmgr_release_work_memory.
+ */
+UINT64
+qmgr_grant_work_memory (UINT64 request_size, UINT64 default_size, UINT64 min_size)
+{
+  UINT64 budget = prm_get_bigint_value (PRM_ID_QUERY_WORK_MEMORY_SIZE);
+  UINT64 share, available, grant_size;
+  int num_sharers;
+  int rv;
+
+  min_size = MIN (min_size, request_size);
+
+  if (budget == 0)
+    {
+      /* no budget; fixed limit of the operator */
+      return MAX (MIN (request_size, default_size), min_size);
+    }
+
+  rv = pthread_mutex_lock (&qmgr_Work_memory.mutex);
+
+  num_sharers = MAX (qmgr_Work_memory.num_queries, qmgr_Work_memory.num_grants + 1);
+  share = budget / (UINT64) MAX (num_sharers, 1);
+  available = (budget > qmgr_Work_memory.granted_size) ? budget - qmgr_Work_memory.granted_size : 0;
+
+  grant_size = MIN (request_size, MIN (share, available));
+  grant_size = MAX (grant_size, min_size);
+
+  if (grant_size > 0)
+    {
+      qmgr_Work_memory.granted_size += grant_size;
+      qmgr_Work_memory.num_grants++;
+    }
+
+  pthread_mutex_unlock (&qmgr_Work_memory.mutex);
+
+  return grant_size;
+}
+
+/*
+ * qmgr_release_work_memory () - give back the work memory granted by qmgr_grant_work_memory
+ *   return: void
+ *   grant_size(in): granted size
+ */
+void
+qmgr_release_work_memory (UINT64 grant_size)
+{
+  int rv;
+
+  if (grant_size == 0 || prm_get_bigint_value (PRM_ID_QUERY_WORK_MEMORY_SIZE) == 0)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&qmgr_Work_memory.mutex);
+
+  assert (qmgr_Work_memory.num_grants > 0 && qmgr_Work_memory.granted_size >= grant_size);
+  qmgr_Work_memory.granted_size -= MIN (grant_size, qmgr_Work_memory.granted_size);
+  qmgr_Work_memory.num_grants--;
+
+  pthread_mutex_unlock (&qmgr_Work_memory.mutex);
+}
@@ -72,6 +72,11 @@ typedef enum
   QMGR_TRAN_TERMINATED		/* Terminated transaction */
 } QMGR_TRAN_STATUS;
 
+/* page of the memory buffer of a temporary file, by its page id */
+#define QMGR_GET_MEMBUF_PAGE(temp_file_p, pageid) \
+  (((pageid) < (temp_file_p)->membuf_npages) ? (temp_file_p)->membuf[(pageid)] \
+   : (temp_file_p)->membuf_ext + ((pageid) - (temp_file_p)->membuf_npages) * DB_PAGESIZE)
+
 typedef struct qmgr_temp_file QMGR_TEMP_FILE;
 struct qmgr_temp_file
 {
@@ -83,6 +88,9 @@ struct qmgr_temp_file
   PAGE_PTR *membuf;
   int membuf_npages;
   QMGR_TEMP_FILE_MEMBUF_TYPE membuf_type;
+  PAGE_PTR membuf_ext;		/* memory pages taken from the budget of the query once membuf is full */
+  int membuf_ext_npages;	/* number of pages of membuf_ext */
+  int *membuf_budget_p;		/* memory page budget of the query, while the file is built */
   bool preserved;		/* if temp file is preserved */
   bool tde_encrypted;		/* whether the file of temp_vfid has to be encrypted when flushing (TDE) */
 };
@@ -131,6 +139,10 @@ struct qmgr_query_entry
   QMGR_TEMP_FILE *temp_vfid;	/* head of per query temp file VFID */
   int num_tmp;			/* number of tmpfiles allocated */
   int total_count;		/* total number of file pages alloc'd for the entire query */
+  int membuf_budget;		/* memory pages the temp files of the query may still take beyond their membuf */
+  OID *pruned_oids;		/* (root class, partition) pairs of the pruned scans; NULL partition if none is left */
+  int n_pruned_oids;		/* number of the pairs; -1 if some could not be kept */
+  int pruned_oids_size;		/* number of the pairs pruned_oids can hold */
   char *er_msg;			/* pointer to error message string of last error */
   int errid;			/* errid for last error of query */
   QMGR_QUERY_STATUS query_status;
@@ -151,6 +163,7 @@ extern void qmgr_set_tran_status (THREAD_ENTRY * thread_p, int tran_index, QMGR_
 extern int qmgr_get_query_error_with_entry (QMGR_QUERY_ENTRY * query_entryp);
 #endif /* ENABLE_UNUSED_FUNCTION */
 extern void qmgr_add_modified_class (THREAD_ENTRY * thread_p, const OID * class_oid);
+extern void qmgr_add_pruned_partition (THREAD_ENTRY * thread_p, const OID * root_oid, const OID * partition_oid);
 extern PAGE_PTR qmgr_get_old_page (THREAD_ENTRY * thread_p, VPID * vpidp, QMGR_TEMP_FILE * tfile_vfidp);
 extern void qmgr_free_old_page (THREAD_ENTRY * thread_p, PAGE_PTR page_ptr, QMGR_TEMP_FILE * tfile_vfidp);
 extern void qmgr_set_dirty_page (THREAD_ENTRY * thread_p, PAGE_PTR page_ptr, int free_page, LOG_DATA_ADDR * addrp,
@@ -175,4 +188,7 @@ extern struct drand48_data *qmgr_get_rand_buf (THREAD_ENTRY * thread_p);
 extern QUERY_ID qmgr_get_current_query_id (THREAD_ENTRY * thread_p);
 extern char *qmgr_get_query_sql_user_text (THREAD_ENTRY * thread_p, QUERY_ID query_id, int tran_index);
 
+extern UINT64 qmgr_grant_work_memory (UINT64 request_size, UINT64 default_size, UINT64 min_size);
+extern void qmgr_release_work_memory (UINT64 grant_size);
+
 #endif /* _QUERY_MANAGER_H_ */
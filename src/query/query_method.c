@@ -37,6 +37,7 @@
 #include "object_representation.h"
 #include "query_list.h"
 #include "regu_var.hpp"
+#include "system_parameter.h"
 
 static int method_initialize_vacomm_buffer (VACOMM_BUFFER * vacomm_buffer, unsigned int rc, char *host,
 					    char *server_name);
@@ -44,6 +45,10 @@ static void method_clear_vacomm_buffer (VACOMM_BUFFER * vacomm_buffer);
 static int method_send_value_to_server (DB_VALUE * dbval, VACOMM_BUFFER * vacomm_buffer);
 static int method_send_eof_to_server (VACOMM_BUFFER * vacomm_buffer);
 static void methid_sig_freemem (method_sig_node * meth_sig);
+static bool method_is_batch_callable (method_sig_list * method_sig_list_p);
+static int method_invoke_batch_for_server (CURSOR_ID * cursor_id_p, qfile_list_id * list_id_p,
+					   method_sig_list * method_sig_list_p, int value_count, int batch_size,
+					   VACOMM_BUFFER * vacomm_buffer_p);
 
 /*
  * method_clear_vacomm_buffer () - Clears the comm buffer
@@ -288,6 +293,7 @@ method_invoke_for_server (unsigned int rc, char *host_p, char *server_name_p, qf
   VACOMM_BUFFER vacomm_buffer;
   int count;
   DB_VALUE *value_p;
+  int batch_size;
 
   db_make_null (&value);
 
@@ -364,6 +370,16 @@ method_invoke_for_server (unsigned int rc, char *host_p, char *server_name_p, qf
 
   cursor_set_oid_columns (&cursor_id, oid_cols, method_sig_list_p->num_methods);
 
+  batch_size = prm_get_integer_value (PRM_ID_JAVA_STORED_PROCEDURE_BATCH_SIZE);
+  if (batch_size > 1 && method_is_batch_callable (method_sig_list_p))
+    {
+      /* java stored procedures are called for a batch of rows at once, instead of a round trip to javasp per row */
+      cursor_result =
+	method_invoke_batch_for_server (&cursor_id, list_id_p, method_sig_list_p, value_count, batch_size,
+					&vacomm_buffer);
+      goto end;
+    }
+
   while (true)
     {
       cursor_result = cursor_next_tuple (&cursor_id);
@@ -495,6 +511,201 @@ end:
     }
 }
 
+/*
+ * method_is_batch_callable () - check if all methods of the list are java stored procedures
+ *   return: true if method_invoke_batch_for_server can call them
+ *   method_sig_list_p(in): method signatures
+ */
+static bool
+method_is_batch_callable (method_sig_list * method_sig_list_p)
+{
+  METHOD_SIG *meth_sig_p;
+  int num_method;
+
+  for (num_method = 0, meth_sig_p = method_sig_list_p->method_sig; num_method < method_sig_list_p->num_methods;
+       ++num_method, meth_sig_p = meth_sig_p->next)
+    {
+      if (meth_sig_p->class_name != NULL)
+	{
+	  /* a method of a class is called on an object, one by one */
+	  return false;
+	}
+    }
+
+  return true;
+}
+
+/*
+ * method_invoke_batch_for_server () - call the java stored procedures for the rows of the list, a batch of rows at a
+ *				       time, and send the results to server
+ *   return: DB_CURSOR_END when all results were sent or server aborted the scan, -1 on error
+ *   cursor_id_p(in): cursor on the list of arguments
+ *   list_id_p(in): list of arguments
+ *   method_sig_list_p(in): method signatures, all of java stored procedures
+ *   value_count(in): number of values of a row
+ *   batch_size(in): maximum number of rows of a call
+ *   vacomm_buffer_p(in/out): buffer of the results sent to server
+ *
+ * Note: The results are sent in the same order as by calling the procedures row by row.
+ */
+static int
+method_invoke_batch_for_server (CURSOR_ID * cursor_id_p, qfile_list_id * list_id_p,
+				method_sig_list * method_sig_list_p, int value_count, int batch_size,
+				VACOMM_BUFFER * vacomm_buffer_p)
+{
+  DB_VALUE *row_vals_p = NULL;	/* value_count values of each row */
+  DB_VALUE **args_p = NULL;	/* arguments of a procedure for each row */
+  DB_VALUE *results_p = NULL;	/* batch_size results of each procedure */
+  DB_VALUE *value_p;
+  METHOD_SIG *meth_sig_p;
+  int num_methods = method_sig_list_p->num_methods;
+  int max_args = 1;
+  int num_rows, row, num_method, arg, count;
+  int cursor_result = DB_CURSOR_SUCCESS;
+  int turn_on_auth;
+  int error = NO_ERROR;
+
+  for (num_method = 0, meth_sig_p = method_sig_list_p->method_sig; num_method < num_methods;
+       ++num_method, meth_sig_p = meth_sig_p->next)
+    {
+      max_args = MAX (max_args, meth_sig_p->num_method_args);
+    }
+
+  row_vals_p = (DB_VALUE *) malloc (sizeof (DB_VALUE) * value_count * batch_size);
+  args_p = (DB_VALUE **) malloc (sizeof (DB_VALUE *) * max_args * batch_size);
+  results_p = (DB_VALUE *) malloc (sizeof (DB_VALUE) * num_methods * batch_size);
+  if (row_vals_p == NULL || args_p == NULL || results_p == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (sizeof (DB_VALUE) * (value_count + num_methods) + sizeof (DB_VALUE *) * max_args) * batch_size);
+      if (row_vals_p != NULL)
+	{
+	  free_and_init (row_vals_p);
+	}
+      if (args_p != NULL)
+	{
+	  free_and_init (args_p);
+	}
+      if (results_p != NULL)
+	{
+	  free_and_init (results_p);
+	}
+      return -1;
+    }
+
+  for (count = 0; count < value_count * batch_size; count++)
+    {
+      db_make_null (&row_vals_p[count]);
+    }
+  for (count = 0; count < num_methods * batch_size; count++)
+    {
+      db_make_null (&results_p[count]);
+    }
+
+  while (cursor_result == DB_CURSOR_SUCCESS)
+    {
+      /* read a batch of rows */
+      for (num_rows = 0; num_rows < batch_size; num_rows++)
+	{
+	  cursor_result = cursor_next_tuple (cursor_id_p);
+	  if (cursor_result != DB_CURSOR_SUCCESS)
+	    {
+	      break;
+	    }
+
+	  if (cursor_get_tuple_value_list (cursor_id_p, list_id_p->type_list.type_cnt,
+					   &row_vals_p[num_rows * value_count]) != NO_ERROR)
+	    {
+	      cursor_result = -1;
+	      goto end;
+	    }
+	}
+
+      if (cursor_result != DB_CURSOR_SUCCESS && cursor_result != DB_CURSOR_END)
+	{
+	  goto end;
+	}
+      if (num_rows == 0)
+	{
+	  break;
+	}
+
+      /* call each procedure for all rows of the batch */
+      for (num_method = 0, meth_sig_p = method_sig_list_p->method_sig; num_method < num_methods;
+	   ++num_method, meth_sig_p = meth_sig_p->next)
+	{
+	  for (row = 0; row < num_rows; row++)
+	    {
+	      for (arg = 0; arg < meth_sig_p->num_method_args; arg++)
+		{
+		  args_p[row * meth_sig_p->num_method_args + arg] =
+		    &row_vals_p[row * value_count + meth_sig_p->method_arg_pos[arg]];
+		}
+	    }
+
+	  turn_on_auth = 0;
+	  AU_ENABLE (turn_on_auth);
+	  db_disable_modification ();
+	  error = jsp_call_batch_from_server (&results_p[num_method * batch_size], args_p, num_rows,
+					      meth_sig_p->method_name, meth_sig_p->num_method_args);
+	  db_enable_modification ();
+	  AU_DISABLE (turn_on_auth);
+
+	  if (error != NO_ERROR)
+	    {
+	      cursor_result = -1;
+	      goto end;
+	    }
+	}
+
+      /* send the results row by row */
+      for (row = 0; row < num_rows; row++)
+	{
+	  for (num_method = 0; num_method < num_methods; num_method++)
+	    {
+	      value_p = &results_p[num_method * batch_size + row];
+	      if (DB_VALUE_TYPE (value_p) == DB_TYPE_ERROR)
+		{
+		  if (er_errid () == NO_ERROR)	/* caller has not set an error */
+		    {
+		      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 1);
+		    }
+		  cursor_result = -1;
+		  goto end;
+		}
+
+	      error = method_send_value_to_server (value_p, vacomm_buffer_p);
+	      if (error != NO_ERROR)
+		{
+		  cursor_result = (vacomm_buffer_p->action == VACOMM_BUFFER_ABORT) ? DB_CURSOR_END : -1;
+		  goto end;
+		}
+	      pr_clear_value (value_p);
+	    }
+	}
+
+      for (count = 0; count < num_rows * value_count; count++)
+	{
+	  pr_clear_value (&row_vals_p[count]);
+	}
+    }
+
+end:
+  for (count = 0; count < value_count * batch_size; count++)
+    {
+      pr_clear_value (&row_vals_p[count]);
+    }
+  for (count = 0; count < num_methods * batch_size; count++)
+    {
+      pr_clear_value (&results_p[count]);
+    }
+  free_and_init (row_vals_p);
+  free_and_init (results_p);
+  free_and_init (args_p);
+
+  return cursor_result;
+}
+
 /*
  * methid_sig_freemem () -
  *   return:
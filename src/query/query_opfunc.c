@@ -7595,7 +7595,7 @@ qdata_evaluate_sys_connect_by_path (THREAD_ENTRY * thread_p, void *xasl_p, regu_
 		{
 		  goto error2;
 		}
-	      if (pr_clone_value (save_values[i], valp->val) != NO_ERROR)
+	      if (pr_move_value (save_values[i], valp->val) != NO_ERROR)
 		{
 		  goto error2;
 		}
@@ -28,6 +28,8 @@
 
 #include <algorithm>
 
+#include <cstring>
+
 namespace cubscan
 {
   namespace json_table
@@ -100,7 +102,7 @@ namespace cubscan
       if (m_node->m_is_iterable_node)
 	{
 	  assert (db_json_get_type (m_input_doc.get_immutable ()) == DB_JSON_ARRAY);
-	  db_json_set_iterator (m_node->m_iterator, *m_input_doc.get_mutable ());
+	  db_json_set_iterator (m_node->m_iterator, *m_input_doc.get_immutable ());
 	}
     }
 
@@ -253,7 +255,7 @@ namespace cubscan
 
       if (db_value_type (value_p) == DB_TYPE_JSON)
 	{
-	  error_code = init_cursor (*db_get_json_document (value_p), *m_specp->m_root_node, m_scan_cursor[0]);
+	  error_code = init_root_cursor (db_get_json_document (value_p), false);
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
@@ -270,7 +272,7 @@ namespace cubscan
 	      ASSERT_ERROR ();
 	      return error_code;
 	    }
-	  error_code = init_cursor (*document.get_immutable (), *m_specp->m_root_node, m_scan_cursor[0]);
+	  error_code = init_root_cursor (document.release_mutable_reference (), true);
 	  if (error_code != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
@@ -392,6 +394,45 @@ namespace cubscan
       return set_input_document (cursor_out, node, doc);
     }
 
+    int
+    scanner::init_root_cursor (JSON_DOC *doc, bool is_owned)
+    {
+      cursor &root_cursor = m_scan_cursor[0];
+      cubxasl::json_table::node &root_node = *m_specp->m_root_node;
+      int error_code = NO_ERROR;
+
+      // '$' and '$[*]' of an array extract the whole input document. do not copy it for the cursor, it may be large
+      bool is_whole_doc = root_node.m_path != NULL
+			  && (std::strcmp (root_node.m_path, "$") == 0
+			      || (std::strcmp (root_node.m_path, "$[*]") == 0 && db_json_get_type (doc) == DB_JSON_ARRAY));
+      if (!is_whole_doc)
+	{
+	  error_code = init_cursor (*doc, root_node, root_cursor);
+	  if (is_owned)
+	    {
+	      db_json_delete_doc (doc);
+	    }
+	  return error_code;
+	}
+
+      root_cursor.m_is_row_fetched = false;
+      root_cursor.m_child = 0;
+      root_cursor.m_node = &root_node;
+
+      // input value outlives the scan of its row
+      if (is_owned)
+	{
+	  root_cursor.m_input_doc.set_mutable_reference (doc);
+	}
+      else
+	{
+	  root_cursor.m_input_doc.set_immutable_reference (doc);
+	}
+      root_cursor.start_json_iterator ();
+
+      return NO_ERROR;
+    }
+
     int
     scanner::set_next_cursor (const cursor &current_cursor, size_t next_depth)
     {
@@ -147,6 +147,9 @@ namespace cubscan
 	// cursor functions
 	int init_cursor (const JSON_DOC &doc, cubxasl::json_table::node &node, cursor &cursor_out);
 	int set_next_cursor (const cursor &current_cursor, size_t next_depth);
+	// root cursor uses the input document in place when root path selects all of it. if is_owned, doc is given to
+	// cursor or freed
+	int init_root_cursor (JSON_DOC *doc, bool is_owned);
 
 	// to start scanning a node, an input document is set
 	int set_input_document (cursor &cursor, const cubxasl::json_table::node &node, const JSON_DOC &document);
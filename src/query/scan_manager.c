@@ -138,6 +138,9 @@ static int scan_Iscan_oid_buf_list_count = 0;
 
 #define SCAN_ISCAN_OID_BUF_LIST_DEFAULT_SIZE 10
 
+/* smallest build list of hash list scan that gets a join filter; smaller hash tables are looked up as fast */
+#define SCAN_HASH_LIST_FILTER_MIN_KEYS 1024
+
 static void scan_init_scan_pred (SCAN_PRED * scan_pred_p, regu_variable_list_node * regu_list, PRED_EXPR * pred_expr,
 				 PR_EVAL_FNC pr_eval_fnc);
 static void scan_init_scan_attrs (SCAN_ATTRS * scan_attrs_p, int num_attrs, ATTR_ID * attr_ids,
@@ -163,6 +166,11 @@ static int scan_regu_key_to_index_key (THREAD_ENTRY * thread_p, KEY_RANGE * key_
 				       INDX_SCAN_ID * iscan_id, TP_DOMAIN * btree_domainp, VAL_DESCR * vd);
 static int scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_limit_upper,
 				  DB_BIGINT * key_limit_lower);
+static void scan_read_ahead_index_heap_pages (THREAD_ENTRY * thread_p, INDX_SCAN_ID * iscan_id);
+static void scan_add_zone_bounds (THREAD_ENTRY * thread_p, PRED_EXPR * pred_expr, VAL_DESCR * vd,
+				  HEAP_ZONE_FILTER * filter);
+static void scan_start_zone_filter (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
+static void scan_end_zone_filter (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp);
 static void scan_init_scan_id (SCAN_ID * scan_id, bool force_select_lock, SCAN_OPERATION_TYPE scan_op_type, int fixed,
 			       int grouped, QPROC_SINGLE_FETCH single_fetch, DB_VALUE * join_dbval,
 			       val_list_node * val_list, VAL_DESCR * vd);
@@ -203,7 +211,9 @@ static int scan_key_compare (DB_VALUE * val1, DB_VALUE * val2, int num_index_ter
 static SCAN_CODE scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_next_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id);
 static SCAN_CODE scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE * tuple);
-static bool check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_yn);
+static SCAN_CODE scan_hash_probe_get_tuple (THREAD_ENTRY * thread_p, LLIST_SCAN_ID * llsidp, HASH_SCAN_POS * pos,
+					    QFILE_TUPLE * tuple);
+static HASH_METHOD check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_yn);
 
 /*
  * scan_init_iss () - initialize index skip scan structure
@@ -2166,6 +2176,226 @@ scan_regu_key_to_index_key (THREAD_ENTRY * thread_p, KEY_RANGE * key_ranges, KEY
   return ret;
 }
 
+/*
+ * scan_read_ahead_index_heap_pages () - Request the heap pages of the OIDs read by the index scan to be read ahead
+ *   return:
+ *   iscan_id(in): Index scan identifier
+ *
+ * Note: Read-ahead is only a hint. If the VPID array can't be allocated, the pages are just read on demand.
+ */
+static void
+scan_read_ahead_index_heap_pages (THREAD_ENTRY * thread_p, INDX_SCAN_ID * iscan_id)
+{
+  VPID *vpids;
+  OID *oidp;
+  int i;
+
+  vpids = (VPID *) db_private_alloc (thread_p, iscan_id->oids_count * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      er_clear ();
+      return;
+    }
+
+  for (i = 0, oidp = iscan_id->oid_list->oidp; i < iscan_id->oids_count; i++, oidp++)
+    {
+      VPID_GET_FROM_OID (&vpids[i], oidp);
+    }
+
+  (void) pgbuf_read_ahead_pages (thread_p, vpids, iscan_id->oids_count);
+
+  db_private_free (thread_p, vpids);
+}
+
+/*
+ * scan_add_zone_bounds () - Add to zone filter the bounds of its attribute in the terms of a conjunctive predicate
+ *   return:
+ *   pred_expr(in): Data filter predicate
+ *   vd(in): Value descriptor of host variables
+ *   filter(in/out): Zone filter; its attribute is the one of the first term found, if it has no bounds yet
+ *
+ * Note: Only the terms that compare the attribute with a constant or a host variable are used. They have the same
+ *       value for the whole scan.
+ */
+static void
+scan_add_zone_bounds (THREAD_ENTRY * thread_p, PRED_EXPR * pred_expr, VAL_DESCR * vd, HEAP_ZONE_FILTER * filter)
+{
+  COMP_EVAL_TERM *et_comp;
+  REGU_VARIABLE *attr, *constant;
+  REL_OP rel_op;
+  DB_VALUE *value;
+  HEAP_ZONE_BOUND *bound;
+  DB_TYPE attr_type, value_type;
+
+  if (pred_expr == NULL)
+    {
+      return;
+    }
+  if (pred_expr->type == T_PRED)
+    {
+      if (pred_expr->pe.m_pred.bool_op == B_AND)
+	{
+	  scan_add_zone_bounds (thread_p, pred_expr->pe.m_pred.lhs, vd, filter);
+	  scan_add_zone_bounds (thread_p, pred_expr->pe.m_pred.rhs, vd, filter);
+	}
+      return;
+    }
+  if (pred_expr->type != T_EVAL_TERM || pred_expr->pe.m_eval_term.et_type != T_COMP_EVAL_TERM)
+    {
+      return;
+    }
+
+  et_comp = &pred_expr->pe.m_eval_term.et.et_comp;
+  rel_op = et_comp->rel_op;
+  attr = et_comp->lhs;
+  constant = et_comp->rhs;
+  if (attr == NULL || constant == NULL)
+    {
+      return;
+    }
+  if (attr->type != TYPE_ATTR_ID)
+    {
+      /* constant op attribute */
+      attr = et_comp->rhs;
+      constant = et_comp->lhs;
+      switch (rel_op)
+	{
+	case R_LT:
+	  rel_op = R_GT;
+	  break;
+	case R_LE:
+	  rel_op = R_GE;
+	  break;
+	case R_GT:
+	  rel_op = R_LT;
+	  break;
+	case R_GE:
+	  rel_op = R_LE;
+	  break;
+	default:
+	  break;
+	}
+    }
+  if (attr->type != TYPE_ATTR_ID || (constant->type != TYPE_DBVAL && constant->type != TYPE_POS_VALUE))
+    {
+      return;
+    }
+  if (rel_op != R_EQ && rel_op != R_LT && rel_op != R_LE && rel_op != R_GT && rel_op != R_GE)
+    {
+      return;
+    }
+  if (filter->num_bounds > 0 && filter->attrid != attr->value.attr_descr.id)
+    {
+      return;
+    }
+  if (filter->num_bounds + (rel_op == R_EQ ? 2 : 1) > HEAP_ZONE_FILTER_MAX_BOUNDS)
+    {
+      return;
+    }
+
+  if (fetch_peek_dbval (thread_p, constant, vd, NULL, NULL, NULL, &value) != NO_ERROR)
+    {
+      /* bounds are only a hint; the predicate is evaluated on each record anyway */
+      er_clear ();
+      return;
+    }
+  if (DB_IS_NULL (value))
+    {
+      return;
+    }
+  attr_type = attr->value.attr_descr.type;
+  value_type = DB_VALUE_DOMAIN_TYPE (value);
+  if (attr_type != value_type && !(TP_IS_NUMERIC_TYPE (attr_type) && TP_IS_NUMERIC_TYPE (value_type)))
+    {
+      /* the comparison of the predicate may coerce the values in a different way */
+      return;
+    }
+
+  filter->attrid = attr->value.attr_descr.id;
+  if (rel_op != R_LT && rel_op != R_LE)
+    {
+      bound = &filter->bounds[filter->num_bounds++];
+      pr_clone_value (value, &bound->value);
+      bound->is_lower = true;
+      bound->is_inclusive = (rel_op != R_GT);
+    }
+  if (rel_op != R_GT && rel_op != R_GE)
+    {
+      bound = &filter->bounds[filter->num_bounds++];
+      pr_clone_value (value, &bound->value);
+      bound->is_lower = false;
+      bound->is_inclusive = (rel_op != R_LT);
+    }
+}
+
+/*
+ * scan_start_zone_filter () - Start the zone filter of a heap scan, if the data filter bounds an attribute
+ *   return:
+ *   scan_id(in/out): Scan identifier
+ *
+ * Note: The filter is used only while the scan returns just the qualified records. The pages that it skips are still
+ *       fixed, but their records are not read.
+ */
+static void
+scan_start_zone_filter (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
+{
+  HEAP_SCAN_ID *hsidp = &scan_id->s.hsid;
+  HEAP_ZONE_FILTER *filter = &hsidp->zone_filter;
+  int i;
+
+  /* a scan that failed to start may not have ended its filter */
+  scan_end_zone_filter (thread_p, hsidp);
+
+  if (prm_get_integer_value (PRM_ID_HEAP_ZONE_MAP_PAGES) <= 0 || scan_id->type != S_HEAP_SCAN
+      || scan_id->scan_op_type != S_SELECT || scan_id->mvcc_select_lock_needed || OID_IS_ROOTOID (&hsidp->cls_oid))
+    {
+      return;
+    }
+
+  filter->num_bounds = 0;
+  filter->attrid = NULL_ATTRID;
+  scan_add_zone_bounds (thread_p, hsidp->scan_pred.pred_expr, scan_id->vd, filter);
+  if (filter->num_bounds == 0)
+    {
+      return;
+    }
+
+  if (heap_attrinfo_start (thread_p, &hsidp->cls_oid, 1, &filter->attrid, &filter->attr_info) != NO_ERROR)
+    {
+      er_clear ();
+      for (i = 0; i < filter->num_bounds; i++)
+	{
+	  pr_clear_value (&filter->bounds[i].value);
+	}
+      return;
+    }
+  hsidp->zone_filter_inited = true;
+}
+
+/*
+ * scan_end_zone_filter () - End the zone filter of a heap scan
+ *   return:
+ *   hsidp(in/out): Heap scan identifier
+ */
+static void
+scan_end_zone_filter (THREAD_ENTRY * thread_p, HEAP_SCAN_ID * hsidp)
+{
+  int i;
+
+  hsidp->scan_cache.zone_filter = NULL;
+  if (!hsidp->zone_filter_inited)
+    {
+      return;
+    }
+
+  heap_attrinfo_end (thread_p, &hsidp->zone_filter.attr_info);
+  for (i = 0; i < hsidp->zone_filter.num_bounds; i++)
+    {
+      pr_clear_value (&hsidp->zone_filter.bounds[i].value);
+    }
+  hsidp->zone_filter_inited = false;
+}
+
 /*
  * scan_get_index_oidset () - Fetch the next group of set of object identifiers
  * from the index associated with the scan identifier.
@@ -2680,6 +2910,13 @@ scan_get_index_oidset (THREAD_ENTRY * thread_p, SCAN_ID * s_id, DB_BIGINT * key_
       qsort (iscan_id->oid_list->oidp, iscan_id->oids_count, sizeof (OID), oid_compare);
     }
 
+  /* The heap pages of the OIDs are visited by scan_next_index_lookup_heap () next. */
+  if (iscan_id->oid_list != NULL && iscan_id->oid_list->oidp != NULL && iscan_id->oids_count > 1
+      && iscan_id->need_count_only == false && !SCAN_IS_INDEX_COVERED (iscan_id) && !SCAN_IS_INDEX_MRO (iscan_id))
+    {
+      scan_read_ahead_index_heap_pages (thread_p, iscan_id);
+    }
+
 end:
 
   if (key_limit_upper != NULL && *key_limit_upper == 0)
@@ -2846,12 +3083,38 @@ scan_open_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   hsidp->scancache_inited = false;
   hsidp->scanrange_inited = false;
 
+  /* a scan which can return n rows reads the heap sequentially to its end, the next pages can be read ahead */
+  hsidp->is_read_ahead_hinted = (single_fetch == QPROC_NO_SINGLE_INNER || single_fetch == QPROC_NO_SINGLE_OUTER);
+  hsidp->is_bulk_read = false;
+  hsidp->zone_filter_inited = false;
+  hsidp->parallel_cursor = NULL;
+
   hsidp->cache_recordinfo = cache_recordinfo;
   hsidp->recordinfo_regu_list = regu_list_recordinfo;
 
   return NO_ERROR;
 }
 
+/*
+ * scan_set_heap_parallel_cursor () - Make an opened heap scan read only the pages given by a parallel cursor.
+ *
+ * return	   : void.
+ * scan_id (in)	   : Heap scan identifier.
+ * cursor (in)	   : Parallel cursor shared by the scans of heap; it must outlive the scan.
+ *
+ * NOTE: The scans sharing a cursor return the objects of heap between them, each page being read by one scan only.
+ *	 Each scan must have its own scan identifier, predicates and attribute caches; only forward, not grouped scans
+ *	 can share a cursor.
+ */
+void
+scan_set_heap_parallel_cursor (SCAN_ID * scan_id, HEAP_PARALLEL_CURSOR * cursor)
+{
+  assert (scan_id->type == S_HEAP_SCAN && !scan_id->grouped);
+  assert (cursor == NULL || HFID_EQ (&cursor->hfid, &scan_id->s.hsid.hfid));
+
+  scan_id->s.hsid.parallel_cursor = cursor;
+}
+
 /*
  * scan_open_heap_page_scan () - Opens a page by page heap scan.
  *
@@ -3663,14 +3926,18 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
   /* regulator variable list for other than predicates */
   llsidp->rest_regu_list = regu_list_rest;
 
+  llsidp->batch_filter = NULL;
+
   /* init for hash list scan */
   /* regulator variable list for build, probe */
   llsidp->hlsid.build_regu_list = regu_list_build;
   llsidp->hlsid.probe_regu_list = regu_list_probe;
+  llsidp->hlsid.work_memory_size = 0;
 
   /* check if hash list scan is possible? */
   llsidp->hlsid.hash_list_scan_yn = false;
-  if (check_hash_list_scan (llsidp, &val_cnt, hash_list_scan_yn))
+  llsidp->hlsid.hash_method = check_hash_list_scan (llsidp, &val_cnt, hash_list_scan_yn);
+  if (llsidp->hlsid.hash_method != HASH_METH_NOT_USE)
     {
       bool on_trace;
       TSC_TICKS start_tick, end_tick;
@@ -3683,8 +3950,16 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 	}
 
       /* create hash table */
-      llsidp->hlsid.hash_table =
-	mht_create ("Hash List Scan", llsidp->list_id->tuple_cnt, qdata_hash_scan_key, qdata_hscan_key_eq);
+      if (llsidp->hlsid.hash_method == HASH_METH_IN_MEM)
+	{
+	  llsidp->hlsid.hash_table =
+	    mht_create ("Hash List Scan", llsidp->list_id->tuple_cnt, qdata_hash_scan_key, qdata_hscan_key_eq);
+	}
+      else
+	{
+	  llsidp->hlsid.hash_table =
+	    mht_create ("Hash List Scan", llsidp->list_id->tuple_cnt, qdata_hash_scan_pos, qdata_hscan_pos_eq);
+	}
       if (llsidp->hlsid.hash_table == NULL)
 	{
 	  return S_ERROR;
@@ -3692,6 +3967,18 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 
       /* alloc temp key */
       llsidp->hlsid.temp_key = qdata_alloc_hscan_key (thread_p, val_cnt, false);
+
+      /* the join filter is built with the hash table, and checked by the probes before they look it up */
+      llsidp->hlsid.join_filter = NULL;
+      if (llsidp->list_id->tuple_cnt >= SCAN_HASH_LIST_FILTER_MIN_KEYS)
+	{
+	  llsidp->hlsid.join_filter = qdata_alloc_hscan_filter (thread_p, llsidp->list_id->tuple_cnt);
+	  if (llsidp->hlsid.join_filter == NULL)
+	    {
+	      return S_ERROR;
+	    }
+	}
+
       if (scan_start_scan (thread_p, scan_id) != NO_ERROR)
 	{
 	  return S_ERROR;
@@ -3716,6 +4003,10 @@ scan_open_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
       llsidp->hlsid.hash_table = NULL;
       llsidp->hlsid.temp_key = NULL;
       llsidp->hlsid.curr_hash_entry = NULL;
+      llsidp->hlsid.join_filter = NULL;
+
+      /* evaluate the predicates of simple comparisons page by page */
+      llsidp->batch_filter = eval_batch_filter_create (thread_p, pr, regu_list_pred, list_id);
     }
 
   return NO_ERROR;
@@ -4030,6 +4321,11 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	      goto exit_on_error;
 	    }
 	  hsidp->scancache_inited = true;
+	  pgbuf_read_ahead_init (&hsidp->scan_cache.read_ahead, hsidp->is_read_ahead_hinted);
+	  /* the record is read only through the attribute caches, so big records are read only as far as needed */
+	  hsidp->scan_cache.read_ovf_prefix = (scan_id->type == S_HEAP_SCAN && scan_id->scan_op_type == S_SELECT
+					       && !scan_id->mvcc_select_lock_needed);
+	  scan_start_zone_filter (thread_p, scan_id);
 	}
       if (hsidp->caches_inited != true)
 	{
@@ -4060,6 +4356,12 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	    }
 	  hsidp->caches_inited = true;
 	}
+      if (!hsidp->is_bulk_read && hsidp->is_read_ahead_hinted && heap_is_bulk_read_scan (thread_p, &hsidp->hfid))
+	{
+	  /* keep the big table from sweeping the page buffer */
+	  pgbuf_start_bulk_read (thread_p);
+	  hsidp->is_bulk_read = true;
+	}
       break;
 
     case S_HEAP_PAGE_SCAN:
@@ -4218,6 +4520,11 @@ scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  goto exit_on_error;
 	}
       qfile_start_scan_fix (thread_p, &llsidp->lsid);
+      if (llsidp->batch_filter != NULL)
+	{
+	  /* list file may be rebuilt since previous scan */
+	  eval_batch_filter_reset (llsidp->batch_filter);
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -4389,6 +4696,10 @@ scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id)
       qfile_start_scan_fix (thread_p, &s_id->s.llsid.lsid);
       s_id->position = S_BEFORE;
       s_id->s.llsid.lsid.position = S_BEFORE;
+      if (s_id->s.llsid.batch_filter != NULL)
+	{
+	  eval_batch_filter_reset (s_id->s.llsid.batch_filter);
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -4604,6 +4915,12 @@ scan_end_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	      (void) heap_scancache_end (thread_p, &hsidp->scan_cache);
 	    }
 	}
+      if (hsidp->is_bulk_read)
+	{
+	  pgbuf_end_bulk_read (thread_p);
+	  hsidp->is_bulk_read = false;
+	}
+      scan_end_zone_filter (thread_p, hsidp);
 
       /* switch scan direction for further iterations */
       if (scan_id->direction == S_FORWARD)
@@ -4701,6 +5018,15 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
     {
     case S_HEAP_SCAN:
     case S_HEAP_SCAN_RECORD_INFO:
+      if (scan_id->s.hsid.is_bulk_read)
+	{
+	  /* scan was not ended */
+	  pgbuf_end_bulk_read (thread_p);
+	  scan_id->s.hsid.is_bulk_read = false;
+	}
+      scan_end_zone_filter (thread_p, &scan_id->s.hsid);
+      break;
+
     case S_HEAP_PAGE_SCAN:
     case S_CLASS_ATTR_SCAN:
     case S_VALUES_SCAN:
@@ -4815,15 +5141,34 @@ scan_close_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  printf ("temp file : tuple count = %d, file_size = %dK\n", llsidp->list_id->tuple_cnt,
 		  llsidp->list_id->page_cnt * 16);
 #endif
-	  mht_clear (llsidp->hlsid.hash_table, qdata_free_hscan_entry, (void *) thread_p);
+	  if (llsidp->hlsid.hash_method == HASH_METH_IN_MEM)
+	    {
+	      mht_clear (llsidp->hlsid.hash_table, qdata_free_hscan_entry, (void *) thread_p);
+	    }
+	  else
+	    {
+	      mht_clear (llsidp->hlsid.hash_table, qdata_free_hscan_pos_entry, (void *) thread_p);
+	    }
 	  mht_destroy (llsidp->hlsid.hash_table);
 	}
+      qmgr_release_work_memory (llsidp->hlsid.work_memory_size);
+      llsidp->hlsid.work_memory_size = 0;
       /* free temp keys and values */
       if (llsidp->hlsid.temp_key != NULL)
 	{
 	  qdata_free_hscan_key (thread_p, llsidp->hlsid.temp_key, llsidp->hlsid.temp_key->val_count);
 	  llsidp->hlsid.temp_key = NULL;
 	}
+      if (llsidp->hlsid.join_filter != NULL)
+	{
+	  qdata_free_hscan_filter (thread_p, llsidp->hlsid.join_filter);
+	  llsidp->hlsid.join_filter = NULL;
+	}
+      if (llsidp->batch_filter != NULL)
+	{
+	  eval_batch_filter_free (thread_p, llsidp->batch_filter);
+	  llsidp->batch_filter = NULL;
+	}
       break;
 
     case S_SHOWSTMT_SCAN:
@@ -5097,6 +5442,10 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   scan_init_filter_info (&data_filter, &hsidp->scan_pred, &hsidp->pred_attrs, scan_id->val_list, scan_id->vd,
 			 &hsidp->cls_oid, 0, NULL, NULL, NULL);
 
+  /* pages can be skipped only if the records that do not qualify are not returned */
+  hsidp->scan_cache.zone_filter = ((hsidp->zone_filter_inited && scan_id->qualification == QPROC_QUALIFIED)
+				   ? &hsidp->zone_filter : NULL);
+
   is_peeking = scan_id->fixed;
   if (scan_id->grouped)
     {
@@ -5133,7 +5482,13 @@ scan_next_heap_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	  if (scan_id->direction == S_FORWARD)
 	    {
 	      /* move forward */
-	      if (scan_id->type == S_HEAP_SCAN)
+	      if (scan_id->type == S_HEAP_SCAN && hsidp->parallel_cursor != NULL)
+		{
+		  sp_scan =
+		    heap_parallel_next (thread_p, hsidp->parallel_cursor, &hsidp->cls_oid, &hsidp->curr_oid, &recdes,
+					&hsidp->scan_cache, is_peeking);
+		}
+	      else if (scan_id->type == S_HEAP_SCAN)
 		{
 		  sp_scan =
 		    heap_next (thread_p, &hsidp->hfid, &hsidp->cls_oid, &hsidp->curr_oid, &recdes, &hsidp->scan_cache,
@@ -6318,8 +6673,9 @@ scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 {
   LLIST_SCAN_ID *llsidp;
   SCAN_CODE qp_scan;
-  DB_LOGICAL ev_res;
+  DB_LOGICAL ev_res = V_TRUE;
   QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  bool is_batch_evaluated;
 
   llsidp = &scan_id->s.llsid;
 
@@ -6330,6 +6686,31 @@ scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 
   while ((qp_scan = qfile_scan_list_next (thread_p, &llsidp->lsid, &tplrec, PEEK)) == S_SUCCESS)
     {
+      is_batch_evaluated = false;
+      if (llsidp->batch_filter != NULL)
+	{
+	  /* evaluate the predicate for all tuples of a page when the scan enters the page */
+	  if (!eval_batch_filter_is_page_evaluated (llsidp->batch_filter, &llsidp->lsid.curr_vpid,
+						    llsidp->lsid.curr_tplno)
+	      && eval_batch_filter_page (thread_p, llsidp->batch_filter, scan_id->vd, &llsidp->lsid.curr_vpid,
+					 llsidp->lsid.curr_pgptr) != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+
+	  is_batch_evaluated = eval_batch_filter_is_page_evaluated (llsidp->batch_filter, &llsidp->lsid.curr_vpid,
+								    llsidp->lsid.curr_tplno);
+	  if (is_batch_evaluated)
+	    {
+	      ev_res = eval_batch_filter_get_result (llsidp->batch_filter, llsidp->lsid.curr_tplno);
+	      if (ev_res != V_TRUE && scan_id->qualification == QPROC_QUALIFIED)
+		{
+		  /* no need to fetch the values of the tuple */
+		  scan_id->scan_stats.read_rows++;
+		  continue;
+		}
+	    }
+	}
 
       /* fetch the values for the predicate from the tuple */
       if (scan_id->val_list)
@@ -6344,13 +6725,16 @@ scan_next_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
       scan_id->scan_stats.read_rows++;
 
       /* evaluate the predicate to see if the tuple qualifies */
-      ev_res = V_TRUE;
-      if (llsidp->scan_pred.pr_eval_fnc && llsidp->scan_pred.pred_expr)
+      if (!is_batch_evaluated)
 	{
-	  ev_res = (*llsidp->scan_pred.pr_eval_fnc) (thread_p, llsidp->scan_pred.pred_expr, scan_id->vd, NULL);
-	  if (ev_res == V_ERROR)
+	  ev_res = V_TRUE;
+	  if (llsidp->scan_pred.pr_eval_fnc && llsidp->scan_pred.pred_expr)
 	    {
-	      return S_ERROR;
+	      ev_res = (*llsidp->scan_pred.pr_eval_fnc) (thread_p, llsidp->scan_pred.pred_expr, scan_id->vd, NULL);
+	      if (ev_res == V_ERROR)
+		{
+		  return S_ERROR;
+		}
 	    }
 	}
 
@@ -7667,7 +8051,9 @@ scan_print_stats_text (FILE * fp, SCAN_ID * scan_id)
     case S_LIST_SCAN:
       if (scan_id->s.llsid.hlsid.hash_list_scan_yn)
 	{
-	  fprintf (fp, "(hash temp buildtime : %d,", TO_MSEC (scan_id->scan_stats.elapsed_hash_build));
+	  fprintf (fp, "(hash temp%s buildtime : %d,",
+		   scan_id->s.llsid.hlsid.hash_method == HASH_METH_HYBRID ? "(h)" : "",
+		   TO_MSEC (scan_id->scan_stats.elapsed_hash_build));
 	}
       else
 	{
@@ -7758,8 +8144,11 @@ scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
   LLIST_SCAN_ID *llsidp;
   SCAN_CODE qp_scan;
   QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  QFILE_TUPLE_POSITION tplpos;
   HASH_SCAN_KEY *key, *new_key;
   HASH_SCAN_VALUE *new_value;
+  HASH_SCAN_POS *new_pos;
+  unsigned int hash_val;
 
   llsidp = &scan_id->s.llsid;
   key = llsidp->hlsid.temp_key;
@@ -7794,6 +8183,36 @@ scan_build_hash_list_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id)
 	{
 	  return S_ERROR;
 	}
+
+      if (llsidp->hlsid.hash_method == HASH_METH_HYBRID)
+	{
+	  /* keep only hash value of key and position of tuple; tuple is read again from list file when probed */
+	  hash_val = qdata_hash_scan_key (new_key, INT_MAX);
+	  qdata_free_hscan_key (thread_p, new_key, new_key->val_count);
+	  if (llsidp->hlsid.join_filter != NULL)
+	    {
+	      qdata_add_hscan_filter (llsidp->hlsid.join_filter, hash_val);
+	    }
+
+	  qfile_save_current_scan_tuple_position (&llsidp->lsid, &tplpos);
+	  new_pos = qdata_alloc_hscan_pos (thread_p, hash_val, &tplpos);
+	  if (new_pos == NULL)
+	    {
+	      return S_ERROR;
+	    }
+	  if (mht_put_orderly (llsidp->hlsid.hash_table, (void *) new_pos, (void *) new_pos) == NULL)
+	    {
+	      db_private_free (thread_p, new_pos);
+	      return S_ERROR;
+	    }
+	  continue;
+	}
+
+      if (llsidp->hlsid.join_filter != NULL)
+	{
+	  qdata_add_hscan_filter (llsidp->hlsid.join_filter, qdata_hash_scan_key (new_key, INT_MAX));
+	}
+
       /* create new value */
       new_value = qdata_alloc_hscan_value (thread_p, tplrec.tpl);
       if (new_value == NULL)
@@ -7924,12 +8343,76 @@ scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE *
   SCAN_CODE qp_scan;
   HASH_SCAN_KEY *key;
   HASH_SCAN_VALUE *hvalue;
+  HASH_SCAN_POS *pos;
+  HENTRY_PTR entry;
   QFILE_LIST_SCAN_ID *scan_id_p;
 
   llsidp = &scan_id->s.llsid;
   key = llsidp->hlsid.temp_key;
   scan_id_p = &llsidp->lsid;
 
+  if (llsidp->hlsid.hash_method == HASH_METH_HYBRID)
+    {
+      if (scan_id_p->position == S_BEFORE)
+	{
+	  if (llsidp->hlsid.hash_table->nentries == 0)
+	    {
+	      return S_END;
+	    }
+	  llsidp->hlsid.curr_hash_entry = NULL;
+	  if (qdata_build_hscan_key (thread_p, scan_id->vd, llsidp->hlsid.probe_regu_list, key) != NO_ERROR)
+	    {
+	      return S_ERROR;
+	    }
+	  llsidp->hlsid.temp_pos.hash_val = qdata_hash_scan_key (key, INT_MAX);
+	  if (llsidp->hlsid.join_filter != NULL
+	      && qdata_hscan_filter_rejects (llsidp->hlsid.join_filter, llsidp->hlsid.temp_pos.hash_val))
+	    {
+	      /* the key is not in build list */
+	      return S_END;
+	    }
+
+	  pos = (HASH_SCAN_POS *) mht_get2 (llsidp->hlsid.hash_table, &llsidp->hlsid.temp_pos,
+					    (void **) &llsidp->hlsid.curr_hash_entry);
+	  if (pos == NULL)
+	    {
+	      return S_END;
+	    }
+	  /* positions the list scan on the tuple */
+	  return scan_hash_probe_get_tuple (thread_p, llsidp, pos, tuple);
+	}
+      else if (scan_id_p->position == S_ON)
+	{
+	  /* entries of the same bucket follow; skip the ones with other hash values */
+	  for (entry = llsidp->hlsid.curr_hash_entry->next; entry != NULL; entry = entry->next)
+	    {
+	      pos = (HASH_SCAN_POS *) entry->data;
+	      if (pos->hash_val == llsidp->hlsid.temp_pos.hash_val)
+		{
+		  llsidp->hlsid.curr_hash_entry = entry;
+		  return scan_hash_probe_get_tuple (thread_p, llsidp, pos, tuple);
+		}
+	    }
+
+	  /* release the page of last tuple, list scan is reopened for next probe */
+	  if (scan_id_p->curr_pgptr != NULL)
+	    {
+	      qmgr_free_old_page_and_init (thread_p, scan_id_p->curr_pgptr, scan_id_p->list_id.tfile_vfid);
+	    }
+	  scan_id_p->position = S_AFTER;
+	  return S_END;
+	}
+      else if (scan_id_p->position == S_AFTER)
+	{
+	  return S_END;
+	}
+      else
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_QPROC_UNKNOWN_CRSPOS, 0);
+	  return S_ERROR;
+	}
+    }
+
   if (scan_id_p->position == S_BEFORE)
     {
       if (llsidp->hlsid.hash_table->nentries > 0)
@@ -7942,6 +8425,13 @@ scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE *
 	      return S_ERROR;
 	    }
 
+	  if (llsidp->hlsid.join_filter != NULL
+	      && qdata_hscan_filter_rejects (llsidp->hlsid.join_filter, qdata_hash_scan_key (key, INT_MAX)))
+	    {
+	      /* the key is not in build list */
+	      return S_END;
+	    }
+
 	  /* get value from hash table */
 	  hvalue =
 	    (HASH_SCAN_VALUE *) mht_get2 (llsidp->hlsid.hash_table, key, (void **) &llsidp->hlsid.curr_hash_entry);
@@ -7985,46 +8475,76 @@ scan_hash_probe_next (THREAD_ENTRY * thread_p, SCAN_ID * scan_id, QFILE_TUPLE *
   return qp_scan;
 }
 
+/*
+ * scan_hash_probe_get_tuple () - Read the build tuple of a hybrid hash list scan entry.
+ *   return: SCAN_CODE (S_SUCCESS, S_ERROR)
+ *   llsidp (in): list scan id pointer
+ *   pos (in): position of build tuple
+ *   tuple (out): tuple, peeked from list file page
+ *
+ * Note: the page of tuple is kept fixed by list scan until the next tuple is read.
+ */
+static SCAN_CODE
+scan_hash_probe_get_tuple (THREAD_ENTRY * thread_p, LLIST_SCAN_ID * llsidp, HASH_SCAN_POS * pos, QFILE_TUPLE * tuple)
+{
+  QFILE_TUPLE_POSITION tplpos;
+  QFILE_TUPLE_RECORD tplrec = { NULL, 0 };
+  SCAN_CODE qp_scan;
+
+  tplpos.status = S_STARTED;
+  tplpos.position = S_ON;
+  tplpos.vpid = pos->vpid;
+  tplpos.offset = pos->offset;
+  tplpos.tpl = NULL;
+  tplpos.tplno = pos->tplno;
+
+  qp_scan = qfile_jump_scan_tuple_position (thread_p, &llsidp->lsid, &tplpos, &tplrec, PEEK);
+  if (qp_scan != S_SUCCESS)
+    {
+      return S_ERROR;
+    }
+
+  *tuple = tplrec.tpl;
+  return S_SUCCESS;
+}
+
 /*
  * check_hash_list_scan () - Check if hash list scan is possible
- *   return: bool
+ *   return: hash method to use, HASH_METH_NOT_USE if hash list scan is not possible
  *   llsidp (in): list scan id pointer
  *   node :
  *      1. count of tuple of list file > 0
- *      2. list file size check
+ *      2. list file size check; if list file does not fit in memory, positions of tuples must fit (hybrid method).
+ *         it is checked last, since it takes work memory for the scan
  *      3. regu_list_build, regu_list_probe is not null
  *      4. The number of probe regu_var and build regu match
  *      5. type of regu var is not oid && vobj
  *      6. list file from dptr is not allowed
 */
-static bool
+static HASH_METHOD
 check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_yn)
 {
   int build_cnt;
   regu_variable_list_node *build, *probe;
   DB_TYPE vtype1, vtype2;
   UINT64 mem_limit = prm_get_bigint_value (PRM_ID_MAX_HASH_LIST_SCAN_SIZE);
+  UINT64 in_mem_size, hybrid_size;
 
   /* no_hash_list_scan sql hint check */
   if (hash_list_scan_yn == 0)
     {
-      return false;
+      return HASH_METH_NOT_USE;
     }
 
   /* count of tuple of list file > 0 */
   if (llsidp->list_id->tuple_cnt <= 0)
     {
-      return false;
-    }
-  /* list file size check */
-  if ((UINT64) llsidp->list_id->page_cnt * DB_PAGESIZE > mem_limit)
-    {
-      return false;
+      return HASH_METH_NOT_USE;
     }
   /* regu_list_build, regu_list_probe is not null */
   if (llsidp->hlsid.build_regu_list == NULL || llsidp->hlsid.probe_regu_list == NULL)
     {
-      return false;
+      return HASH_METH_NOT_USE;
     }
 
   build = llsidp->hlsid.build_regu_list;
@@ -8041,7 +8561,7 @@ check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_y
       if (((vtype1 == DB_TYPE_OBJECT || vtype1 == DB_TYPE_VOBJ) && vtype2 == DB_TYPE_OID) ||
 	  ((vtype2 == DB_TYPE_OBJECT || vtype2 == DB_TYPE_VOBJ) && vtype1 == DB_TYPE_OID))
 	{
-	  return false;
+	  return HASH_METH_NOT_USE;
 	}
       build = build->next;
       probe = probe->next;
@@ -8049,12 +8569,37 @@ check_hash_list_scan (LLIST_SCAN_ID * llsidp, int *val_cnt, int hash_list_scan_y
   /* The number of probe regu_var and build regu match */
   if (build != NULL || probe != NULL)
     {
-      return false;
+      return HASH_METH_NOT_USE;
     }
   *val_cnt = build_cnt;
 
   /* 6. list file from dptr is not allowed */
   /* Since dptr is searched after scan_open_scan, it is checked when llsidp->list_id->tuple_cnt <= 0 */
 
-  return true;
+  /* list file size check; the hash table is kept in work memory granted by the server, up to mem_limit when the
+   * server has no work memory budget */
+  in_mem_size = (UINT64) llsidp->list_id->page_cnt * DB_PAGESIZE;
+  llsidp->hlsid.work_memory_size = qmgr_grant_work_memory (in_mem_size, mem_limit, 0);
+  if (llsidp->hlsid.work_memory_size >= in_mem_size)
+    {
+      return HASH_METH_IN_MEM;
+    }
+  qmgr_release_work_memory (llsidp->hlsid.work_memory_size);
+  llsidp->hlsid.work_memory_size = 0;
+
+  /* hybrid method keeps hash values instead of keys; the scan predicate must check the keys of found tuples */
+  if (llsidp->scan_pred.pred_expr == NULL)
+    {
+      return HASH_METH_NOT_USE;
+    }
+  hybrid_size = (UINT64) llsidp->list_id->tuple_cnt * (sizeof (HENTRY) + sizeof (HASH_SCAN_POS));
+  llsidp->hlsid.work_memory_size = qmgr_grant_work_memory (hybrid_size, mem_limit, 0);
+  if (llsidp->hlsid.work_memory_size >= hybrid_size)
+    {
+      return HASH_METH_HYBRID;
+    }
+  qmgr_release_work_memory (llsidp->hlsid.work_memory_size);
+  llsidp->hlsid.work_memory_size = 0;
+
+  return HASH_METH_NOT_USE;
 }
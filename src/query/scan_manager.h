@@ -105,6 +105,11 @@ struct heap_scan_id
   bool caches_inited;		/* are the caches initialized?? */
   bool scancache_inited;
   bool scanrange_inited;
+  bool is_read_ahead_hinted;	/* are the heap pages expected to be all read? */
+  bool is_bulk_read;		/* is the scan a bulk read of the page buffer? */
+  HEAP_PARALLEL_CURSOR *parallel_cursor;	/* cursor giving the pages to scan, shared with other scans of heap */
+  HEAP_ZONE_FILTER zone_filter;	/* range of an attribute that data filter needs, to skip the pages out of it */
+  bool zone_filter_inited;
   DB_VALUE **cache_recordinfo;	/* cache for record information */
   regu_variable_list_node *recordinfo_regu_list;	/* regulator variable list for record info */
 };				/* Regular Heap File Scan Identifier */
@@ -251,6 +256,7 @@ struct llist_scan_id
   regu_variable_list_node *rest_regu_list;	/* regulator variable list */
   QFILE_TUPLE_RECORD *tplrecp;	/* tuple record pointer; output param */
   HASH_LIST_SCAN hlsid;		/* for hash scan */
+  EVAL_BATCH_FILTER *batch_filter;	/* page at a time evaluation of scan predicates */
 };
 
 typedef struct showstmt_scan_id SHOWSTMT_SCAN_ID;
@@ -461,6 +467,7 @@ extern int scan_open_method_scan (THREAD_ENTRY * thread_p, SCAN_ID * scan_id,
 				  val_list_node * val_list, val_descr * vd,
 				  /* */
 				  QFILE_LIST_ID * list_id, method_sig_list * meth_sig_list);
+extern void scan_set_heap_parallel_cursor (SCAN_ID * scan_id, HEAP_PARALLEL_CURSOR * cursor);
 extern int scan_start_scan (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern SCAN_CODE scan_reset_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
 extern SCAN_CODE scan_next_scan_block (THREAD_ENTRY * thread_p, SCAN_ID * s_id);
@@ -72,6 +72,11 @@ typedef enum
 
 #define NOT_FOUND -1
 
+/* a transaction reserves this part of the cached values of an auto increment serial at once */
+#define SERIAL_RESERVATION_DIVISOR 4
+/* reservation slots of a transaction; a serial always uses the same slot */
+#define SERIAL_TRAN_RESERVATIONS 4
+
 typedef struct serial_entry SERIAL_CACHE_ENTRY;
 struct serial_entry
 {
@@ -119,6 +124,32 @@ SERIAL_CACHE_POOL serial_Cache_pool = { NULL, NULL, NULL,
 
 #if defined (SERVER_MODE)
 BTID serial_Cached_btid = BTID_INITIALIZER;
+
+/* values of a cached serial reserved for one transaction. only the transaction uses them, without any lock. */
+typedef struct serial_reservation SERIAL_RESERVATION;
+struct serial_reservation
+{
+  OID oid;			/* serial object identifier; null if nothing is reserved */
+  int version;			/* serial_Reservations.version when the values were reserved */
+  int num_values;		/* number of reserved values not given yet */
+
+  /* serial object values */
+  DB_VALUE cur_val;		/* last value given */
+  DB_VALUE inc_val;
+  DB_VALUE max_val;
+  DB_VALUE min_val;
+  DB_VALUE cyclic;
+};
+
+typedef struct serial_reservations SERIAL_RESERVATIONS;
+struct serial_reservations
+{
+  SERIAL_RESERVATION *slots;	/* SERIAL_TRAN_RESERVATIONS slots for each transaction index */
+  int num_trans;		/* number of transaction indices with slots */
+  int version;			/* incremented when a serial is decached; older reservations are dropped */
+};
+
+SERIAL_RESERVATIONS serial_Reservations = { NULL, 0, 0 };
 #endif /* SERVER_MODE */
 
 ATTR_ID serial_Attrs_id[SERIAL_ATTR_MAX_INDEX];
@@ -143,6 +174,13 @@ static SERIAL_CACHE_AREA *serial_alloc_cache_area (int num);
 static int serial_load_attribute_info_of_db_serial (THREAD_ENTRY * thread_p);
 // *INDENT-OFF*
 static int serial_get_attrid (THREAD_ENTRY * thread_p, int attr_index, ATTR_ID &attrid);
+#if defined (SERVER_MODE)
+static SERIAL_RESERVATION *serial_get_reservation (THREAD_ENTRY * thread_p, const OID * serial_oidp);
+static bool serial_get_next_reserved_value (SERIAL_RESERVATION * reservation, const OID * serial_oidp,
+					    DB_VALUE * result_num);
+static int serial_reserve_cached_values (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry,
+					 SERIAL_RESERVATION * reservation, DB_VALUE * result_num);
+#endif /* SERVER_MODE */
 // *INDENT-ON*
 
 /*
@@ -286,7 +324,9 @@ xserial_get_next_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OI
   SERIAL_CACHE_ENTRY *entry;
   bool is_cache_mutex_locked = false;
   bool is_oid_locked = false;
+  bool is_reserved = false;
 #if defined (SERVER_MODE)
+  SERIAL_RESERVATION *reservation = NULL;
   int rc;
 #endif /* SERVER_MODE */
 
@@ -305,11 +345,25 @@ xserial_get_next_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OI
       return ER_FAILED;
     }
 
+#if defined (SERVER_MODE)
+  if (cached_num >= 2 * SERIAL_RESERVATION_DIVISOR && num_alloc == 1 && is_auto_increment == GENERATE_AUTO_INCREMENT)
+    {
+      /* the inserts of many transactions into one table do not wait for each other on serial cache pool */
+      reservation = serial_get_reservation (thread_p, oid_p);
+    }
+#endif /* SERVER_MODE */
+
   if (cached_num <= 1)
     {
       /* not used serial cache */
       ret = xserial_get_next_value_internal (thread_p, result_num, oid_p, num_alloc);
     }
+#if defined (SERVER_MODE)
+  else if (reservation != NULL && serial_get_next_reserved_value (reservation, oid_p, result_num))
+    {
+      /* got a value reserved by the transaction */
+    }
+#endif /* SERVER_MODE */
   else
     {
       /* used serial cache */
@@ -320,7 +374,25 @@ xserial_get_next_value (THREAD_ENTRY * thread_p, DB_VALUE * result_num, const OI
       is_cache_mutex_locked = true;
 
       entry = (SERIAL_CACHE_ENTRY *) mht_get (serial_Cache_pool.ht, oid_p);
-      if (entry != NULL)
+#if defined (SERVER_MODE)
+      if (entry != NULL && reservation != NULL)
+	{
+	  if (serial_reserve_cached_values (thread_p, entry, reservation, result_num) == NO_ERROR)
+	    {
+	      is_reserved = true;
+	    }
+	  else
+	    {
+	      /* e.g. the serial is too close to its limit to reserve values; go on with one value */
+	      er_clear ();
+	    }
+	}
+#endif /* SERVER_MODE */
+      if (is_reserved)
+	{
+	  /* the first of the values reserved by the transaction was given */
+	}
+      else if (entry != NULL)
 	{
 	  ret = serial_get_next_cached_value (thread_p, entry, num_alloc);
 	  if (ret != NO_ERROR)
@@ -406,6 +478,119 @@ exit:
   return ret;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * serial_get_reservation () - get the reservation slot of the transaction for a serial
+ *   return: reservation slot, or NULL if the transaction has no slots
+ *   serial_oidp(in) : serial object identifier
+ */
+static SERIAL_RESERVATION *
+serial_get_reservation (THREAD_ENTRY * thread_p, const OID * serial_oidp)
+{
+  int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+
+  if (serial_Reservations.slots == NULL || tran_index < 0 || tran_index >= serial_Reservations.num_trans)
+    {
+      /* the transaction table grew after the slots were allocated */
+      return NULL;
+    }
+
+  return &serial_Reservations.slots[tran_index * SERIAL_TRAN_RESERVATIONS
+				    + OID_PSEUDO_KEY (serial_oidp) % SERIAL_TRAN_RESERVATIONS];
+}
+
+/*
+ * serial_get_next_reserved_value () - get the next value reserved by the transaction
+ *   return: true if a reserved value was got, false if the serial cache has to be used
+ *   reservation(in/out) : reservation slot of the transaction
+ *   serial_oidp(in)     : serial object identifier
+ *   result_num(out)     : next value
+ *
+ * Note: The slot is used only by its transaction, so no lock is needed.
+ */
+static bool
+serial_get_next_reserved_value (SERIAL_RESERVATION * reservation, const OID * serial_oidp, DB_VALUE * result_num)
+{
+  DB_VALUE next_val;
+
+  if (reservation->num_values <= 0 || !OID_EQ (&reservation->oid, serial_oidp)
+      || reservation->version != ATOMIC_LOAD (&serial_Reservations.version))
+    {
+      /* nothing reserved for this serial, or the serial was changed since */
+      return false;
+    }
+
+  if (serial_get_nth_value (&reservation->inc_val, &reservation->cur_val, &reservation->min_val,
+			    &reservation->max_val, &reservation->cyclic, 1, &next_val) != NO_ERROR)
+    {
+      er_clear ();
+      reservation->num_values = 0;
+      return false;
+    }
+
+  pr_clone_value (&next_val, &reservation->cur_val);
+  reservation->num_values--;
+  pr_clone_value (&next_val, result_num);
+
+  return true;
+}
+
+/*
+ * serial_reserve_cached_values () - reserve cached values of a serial for the transaction and get the first one
+ *   return: NO_ERROR, or ER_status
+ *   entry(in/out)       : serial cache entry
+ *   reservation(in/out) : reservation slot of the transaction
+ *   result_num(out)     : first reserved value
+ *
+ * Note: The caller holds the mutex of serial cache pool. The values are taken from the cache in a block, the same way
+ *       as for a multi-row insert. Values left when a slot is taken by another serial or when a serial is decached are
+ *       not given, like the values left in serial cache at shutdown.
+ */
+static int
+serial_reserve_cached_values (THREAD_ENTRY * thread_p, SERIAL_CACHE_ENTRY * entry, SERIAL_RESERVATION * reservation,
+			      DB_VALUE * result_num)
+{
+  DB_VALUE start_val, first_val;
+  int num_values = entry->cached_num / SERIAL_RESERVATION_DIVISOR;
+  int error;
+
+  if (num_values < 2 || db_get_int (&entry->cyclic) != 0)
+    {
+      /* a block of cyclic serial may wrap around; it is not the same as taking its values one by one */
+      return ER_FAILED;
+    }
+
+  pr_clone_value (&entry->cur_val, &start_val);
+
+  error = serial_get_nth_value (&entry->inc_val, &start_val, &entry->min_val, &entry->max_val, &entry->cyclic, 1,
+				&first_val);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  /* the values after start_val up to the new cur_val of entry are given to the transaction */
+  error = serial_get_next_cached_value (thread_p, entry, num_values);
+  if (error != NO_ERROR)
+    {
+      return error;
+    }
+
+  reservation->oid = entry->oid;
+  reservation->version = ATOMIC_LOAD (&serial_Reservations.version);
+  reservation->num_values = num_values - 1;
+  pr_clone_value (&first_val, &reservation->cur_val);
+  pr_clone_value (&entry->inc_val, &reservation->inc_val);
+  pr_clone_value (&entry->max_val, &reservation->max_val);
+  pr_clone_value (&entry->min_val, &reservation->min_val);
+  pr_clone_value (&entry->cyclic, &reservation->cyclic);
+
+  pr_clone_value (&first_val, result_num);
+
+  return NO_ERROR;
+}
+#endif /* SERVER_MODE */
+
 /*
  * serial_get_next_cached_value () -
  *   return: NO_ERROR, or ER_status
@@ -1088,6 +1273,18 @@ serial_initialize_cache_pool (THREAD_ENTRY * thread_p)
 
   pthread_mutex_init (&serial_Cache_pool.cache_pool_mutex, NULL);
 
+#if defined (SERVER_MODE)
+  serial_Reservations.num_trans = logtb_get_number_of_total_tran_indices ();
+  serial_Reservations.slots =
+    (SERIAL_RESERVATION *) calloc ((size_t) serial_Reservations.num_trans * SERIAL_TRAN_RESERVATIONS,
+				   sizeof (SERIAL_RESERVATION));
+  if (serial_Reservations.slots == NULL)
+    {
+      /* not an error; values are not reserved for transactions */
+      serial_Reservations.num_trans = 0;
+    }
+#endif /* SERVER_MODE */
+
   serial_Cache_pool.ht = mht_create ("Serial cache pool hash table", NCACHE_OBJECTS * 8, oid_hash, oid_compare_equals);
   if (serial_Cache_pool.ht == NULL)
     {
@@ -1131,6 +1328,14 @@ serial_finalize_cache_pool (void)
 
   pthread_mutex_destroy (&serial_Cache_pool.cache_pool_mutex);
 
+#if defined (SERVER_MODE)
+  if (serial_Reservations.slots != NULL)
+    {
+      free_and_init (serial_Reservations.slots);
+    }
+  serial_Reservations.num_trans = 0;
+#endif /* SERVER_MODE */
+
   serial_Num_attrs = -1;
 }
 
@@ -1383,6 +1588,10 @@ xserial_decache (THREAD_ENTRY * thread_p, OID * oidp)
       entry->next = serial_Cache_pool.free_list;
       serial_Cache_pool.free_list = entry;
     }
+#if defined (SERVER_MODE)
+  /* the values reserved by transactions may not follow the changed serial */
+  ATOMIC_INC_32 (&serial_Reservations.version, 1);
+#endif /* SERVER_MODE */
   pthread_mutex_unlock (&serial_Cache_pool.cache_pool_mutex);
 }
 
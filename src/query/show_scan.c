@@ -46,6 +46,7 @@
 #include "slotted_page.h"
 #include "heap_file.h"
 #include "btree.h"
+#include "vacuum.h"
 #include "connection_support.h"
 #include "critical_section.h"
 #include "tz_support.h"
@@ -76,7 +77,7 @@ struct show_request
   END_SCAN_FUNC end_func;	/* end scan function */
 };
 
-const size_t THREAD_SCAN_COLUMN_COUNT = 26;
+const size_t THREAD_SCAN_COLUMN_COUNT = 28;
 
 static SCAN_CODE showstmt_array_next_scan (THREAD_ENTRY * thread_p, int cursor, DB_VALUE ** out_values, int out_cnt,
 					   void *ptr);
@@ -234,6 +235,30 @@ showstmt_scan_init (void)
   req->next_func = showstmt_array_next_scan;
   req->end_func = showstmt_array_end_scan;
 
+  req = &show_Requests[SHOWSTMT_PAGE_BUFFER_RESIDENCY];
+  req->show_type = SHOWSTMT_PAGE_BUFFER_RESIDENCY;
+  req->start_func = pgbuf_residency_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
+  req = &show_Requests[SHOWSTMT_WAIT_STATISTICS];
+  req->show_type = SHOWSTMT_WAIT_STATISTICS;
+  req->start_func = perfmon_wait_statistics_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
+  req = &show_Requests[SHOWSTMT_WAIT_EVENTS];
+  req->show_type = SHOWSTMT_WAIT_EVENTS;
+  req->start_func = thread_wait_events_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
+  req = &show_Requests[SHOWSTMT_VACUUM_STATUS];
+  req->show_type = SHOWSTMT_VACUUM_STATUS;
+  req->start_func = vacuum_status_start_scan;
+  req->next_func = showstmt_array_next_scan;
+  req->end_func = showstmt_array_end_scan;
+
   /* append to init other show statement scan function here */
 
 
@@ -515,6 +540,7 @@ thread_scan_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapper, THREAD_ENTRY
   time_t stime;
   int msecs;
   DB_DATETIME time_val;
+  THREAD_WAIT_EVENT wait_event;
 
   vals = showstmt_alloc_tuple_in_context (caller_thread_p, ctx);
   if (vals == NULL)
@@ -795,6 +821,59 @@ thread_scan_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapper, THREAD_ENTRY
     }
   idx++;
 
+  /* Wait_event */
+  wait_event = (THREAD_WAIT_EVENT) thrd->wait_event.load (std::memory_order_acquire);
+  if (wait_event != THREAD_WAIT_NONE)
+    {
+      db_make_string (&vals[idx], thread_wait_event_to_string (wait_event));
+    }
+  else
+    {
+      db_make_null (&vals[idx]);
+    }
+  idx++;
+
+  /* Wait_object */
+  buffer = OR_ALIGNED_BUF_START (a_buffer);
+  buf_len = 1024;
+
+  switch (wait_event)
+    {
+    case THREAD_WAIT_PAGE_LATCH:
+    case THREAD_WAIT_IO:
+    case THREAD_WAIT_CIPHER:
+      snprintf (buffer, buf_len, "%d|%d", VPID_AS_ARGS (&thrd->wait_object.vpid));
+      break;
+    case THREAD_WAIT_LOCK:
+      snprintf (buffer, buf_len, "%d|%d|%d", OID_AS_ARGS (&thrd->wait_object.oid));
+      break;
+    case THREAD_WAIT_CSECT:
+      snprintf (buffer, buf_len, "%s", thrd->wait_object.name != NULL ? thrd->wait_object.name : "");
+      break;
+    case THREAD_WAIT_LOG_FLUSH:
+      snprintf (buffer, buf_len, "%lld|%d", LSA_AS_ARGS (&thrd->wait_object.lsa));
+      break;
+    default:
+      buffer[0] = '\0';
+      break;
+    }
+
+  if (buffer[0] != '\0')
+    {
+      error = db_make_string_copy (&vals[idx], buffer);
+      if (error != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  stop_mapper = true;
+	  return;
+	}
+    }
+  else
+    {
+      db_make_null (&vals[idx]);
+    }
+  idx++;
+
   assert (idx == THREAD_SCAN_COLUMN_COUNT);
 }
 #endif // SERVER_MODE
@@ -843,3 +922,87 @@ thread_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, in
   return NO_ERROR;
 #endif // not SERVER_MODE
 }
+
+#if defined (SERVER_MODE)
+//
+// thread_wait_events_mapfunc () - mapper function to count the threads that wait for each wait event
+//
+// thread_ref (in)       : mapped thread entry
+// stop_mapper (out)     : output true to stop mapping
+// waiting_threads (out) : waiting threads count of each wait event
+//
+static void
+thread_wait_events_mapfunc (THREAD_ENTRY & thread_ref, bool & stop_mapper, int *waiting_threads)
+{
+  int event = thread_ref.wait_event.load (std::memory_order_relaxed);
+
+  if (event > THREAD_WAIT_NONE && event < THREAD_WAIT_EVENT_COUNT)
+    {
+      waiting_threads[event]++;
+    }
+}
+#endif // SERVER_MODE
+
+/*
+ * thread_wait_events_start_scan () -  start scan function for show wait events
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   type (in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ *
+ * Note: a row is made for each wait event, with the samples taken by the wait event sampler and the threads that
+ *       wait for it now.
+ */
+int
+thread_wait_events_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+#if defined(SERVER_MODE)
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  const int num_cols = 4;
+  std::uint64_t samples[THREAD_WAIT_EVENT_COUNT];
+  std::uint64_t rounds;
+  int waiting_threads[THREAD_WAIT_EVENT_COUNT] = { 0 };
+  DB_VALUE *vals = NULL;
+  int event;
+  int error = NO_ERROR;
+
+  *ptr = NULL;
+
+  rounds = thread_get_manager ()->get_wait_event_samples (samples);
+  thread_get_manager ()->map_entries (thread_wait_events_mapfunc, waiting_threads);
+
+  ctx = showstmt_alloc_array_context (thread_p, THREAD_WAIT_EVENT_COUNT - 1, num_cols);
+  if (ctx == NULL)
+    {
+      ASSERT_ERROR_AND_SET (error);
+      return error;
+    }
+
+  for (event = THREAD_WAIT_NONE + 1; event < THREAD_WAIT_EVENT_COUNT; event++)
+    {
+      vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+      if (vals == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error);
+	  showstmt_free_array_context (thread_p, ctx);
+	  return error;
+	}
+
+      /* Wait_event */
+      db_make_string (&vals[0], thread_wait_event_to_string ((THREAD_WAIT_EVENT) event));
+      /* Samples */
+      db_make_bigint (&vals[1], (DB_BIGINT) samples[event]);
+      /* Avg_waiting_threads */
+      db_make_double (&vals[2], rounds > 0 ? (double) samples[event] / (double) rounds : 0.0);
+      /* Waiting_threads */
+      db_make_int (&vals[3], waiting_threads[event]);
+    }
+
+  *ptr = ctx;
+#endif // SERVER_MODE
+
+  return NO_ERROR;
+}
@@ -42,5 +42,7 @@ extern void showstmt_free_array_context (THREAD_ENTRY * thread_p, SHOWSTMT_ARRAY
 extern DB_VALUE *showstmt_alloc_tuple_in_context (THREAD_ENTRY * thread_p, SHOWSTMT_ARRAY_CONTEXT * ctx);
 
 extern int thread_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ctx);
+extern int thread_wait_events_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt,
+					  void **ctx);
 
 #endif /* _SHOW_SCAN_H_ */
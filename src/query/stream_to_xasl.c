@@ -184,6 +184,8 @@ stx_map_stream_to_xasl_node_header (THREAD_ENTRY * thread_p, xasl_node_header *
  *   xasl_tree(in)      : pointer to where to return the
  *                        root of the unpacked XASL tree
  *   use_xasl_clone(in) : true, if XASL clone is used
+ *   is_stream_kept(in) : true, if xasl_stream is kept as long as the XASL tree; the constant strings of the tree then
+ *                        point into the stream instead of being copied
  *   xasl_stream(in)    : pointer to xasl stream
  *   xasl_stream_size(in)       : # of bytes in xasl_stream
  *   xasl_unpack_info_ptr(in)   : pointer to where to return the pack info
@@ -194,8 +196,8 @@ stx_map_stream_to_xasl_node_header (THREAD_ENTRY * thread_p, xasl_node_header *
  * xasl_unpack_info_ptr. The free function is free_xasl_unpack_info().
  */
 int
-stx_map_stream_to_xasl (THREAD_ENTRY * thread_p, xasl_node ** xasl_tree, bool use_xasl_clone, char *xasl_stream,
-			int xasl_stream_size, XASL_UNPACK_INFO ** xasl_unpack_info_ptr)
+stx_map_stream_to_xasl (THREAD_ENTRY * thread_p, xasl_node ** xasl_tree, bool use_xasl_clone, bool is_stream_kept,
+			char *xasl_stream, int xasl_stream_size, XASL_UNPACK_INFO ** xasl_unpack_info_ptr)
 {
   XASL_NODE *xasl;
   char *p;
@@ -212,6 +214,7 @@ stx_map_stream_to_xasl (THREAD_ENTRY * thread_p, xasl_node ** xasl_tree, bool us
   stx_init_xasl_unpack_info (thread_p, xasl_stream, xasl_stream_size);
   unpack_info_p = get_xasl_unpack_info_ptr (thread_p);
   unpack_info_p->use_xasl_clone = use_xasl_clone;
+  unpack_info_p->is_stream_kept = is_stream_kept;
   unpack_info_p->track_allocated_bufers = 1;
 
   /* calculate offset to XASL tree in the stream buffer */
@@ -4440,6 +4443,8 @@ stx_build_indx_info (THREAD_ENTRY * thread_p, char *ptr, INDX_INFO * indx_info)
 
   ptr = or_unpack_int (ptr, &indx_info->groupby_skip);
 
+  ptr = or_unpack_int (ptr, &indx_info->orderby_first_key);
+
   ptr = or_unpack_int (ptr, &indx_info->use_iss);
 
   ptr = or_unpack_int (ptr, &indx_info->ils_prefix_len);
@@ -5212,7 +5217,7 @@ stx_unpack_regu_variable_value (THREAD_ENTRY * thread_p, char *ptr, REGU_VARIABL
       break;
 
     case TYPE_DBVAL:
-      ptr = stx_build_db_value (thread_p, ptr, &regu_var->value.dbval);
+      ptr = stx_build_constant_db_value (thread_p, ptr, &regu_var->value.dbval);
       if (xasl_unpack_info_p->use_xasl_clone && !db_value_is_null (&regu_var->value.dbval))
 	{
 	  REGU_VARIABLE_SET_FLAG (regu_var, REGU_VARIABLE_CLEAR_AT_CLONE_DECACHE);
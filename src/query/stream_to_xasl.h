@@ -33,7 +33,8 @@ struct xasl_node_header;
 struct xasl_unpack_info;
 
 extern int stx_map_stream_to_xasl (THREAD_ENTRY * thread_p, xasl_node ** xasl_tree, bool use_xasl_clone,
-				   char *xasl_stream, int xasl_stream_size, xasl_unpack_info ** xasl_unpack_info_ptr);
+				   bool is_stream_kept, char *xasl_stream, int xasl_stream_size,
+				   xasl_unpack_info ** xasl_unpack_info_ptr);
 extern int stx_map_stream_to_filter_pred (THREAD_ENTRY * thread_p, pred_expr_with_context ** pred_expr_tree,
 					  char *pred_stream, int pred_stream_size);
 extern int stx_map_stream_to_func_pred (THREAD_ENTRY * thread_p, func_pred ** xasl, char *xasl_stream,
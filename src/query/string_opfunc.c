@@ -171,6 +171,11 @@ static int qstr_pad (MISC_OPERAND pad_operand, int pad_length, const unsigned ch
 		     int *result_length, int *result_size);
 static int qstr_eval_like (const char *tar, int tar_length, const char *expr, int expr_length, const char *escape,
 			   INTL_CODESET codeset, int coll_id);
+static bool qstr_is_bytewise_match (int coll_id, const unsigned char *str, int size);
+static const unsigned char *qstr_find_bytes (const unsigned char *src, int src_size, const unsigned char *sub,
+					     int sub_size);
+static bool qstr_eval_like_bytewise (const char *tar, int tar_length, const char *expr, int expr_length,
+				     const char *escape, int coll_id, int *result);
 #if defined(ENABLE_UNUSED_FUNCTION)
 static int kor_cmp (unsigned char *src, unsigned char *dest, int size);
 #endif
@@ -4442,6 +4447,12 @@ db_string_like (const DB_VALUE * src_string, const DB_VALUE * pattern, const DB_
   pattern_char_string_p = db_get_string (pattern);
   pattern_length = db_get_string_size (pattern);
 
+  if (qstr_eval_like_bytewise (src_char_string_p, src_length, pattern_char_string_p, pattern_length,
+			       (esc_char ? esc_char_p : NULL), coll_id, result))
+    {
+      return error_status;
+    }
+
   *result =
     qstr_eval_like (src_char_string_p, src_length, pattern_char_string_p, pattern_length,
 		    (esc_char ? esc_char_p : NULL), db_get_string_codeset (src_string), coll_id);
@@ -6009,6 +6020,139 @@ db_string_fix_string_size (DB_VALUE * src_string)
   return error_status;
 }
 
+/*
+ * qstr_is_bytewise_match () - can str be matched byte by byte in the collation
+ *   return: true, if a byte comparison of str gives the same result as the collation matching
+ *   coll_id(in): collation
+ *   str(in), size(in): the string to match
+ *
+ * Note: only the binary collations qualify. Except "binary", they match a space and a NUL byte as equal, so str
+ *	 must contain neither of them.
+ */
+static bool
+qstr_is_bytewise_match (int coll_id, const unsigned char *str, int size)
+{
+  if (coll_id == LANG_COLL_BINARY)
+    {
+      return true;
+    }
+
+  if (coll_id != LANG_COLL_ISO_BINARY && coll_id != LANG_COLL_UTF8_BINARY)
+    {
+      /* EUC-KR is not self-synchronizing: a byte match may start in the middle of a character */
+      return false;
+    }
+
+  return memchr (str, ' ', size) == NULL && memchr (str, '\0', size) == NULL;
+}
+
+/*
+ * qstr_find_bytes () - find the first occurrence of sub in src
+ *   return: pointer to the occurrence in src, or NULL
+ *   src(in), src_size(in): the string to search
+ *   sub(in), sub_size(in): the string to search for (not empty)
+ *
+ * Note: the candidates are found by their first byte with memchr, which the C library vectorizes, and are filtered by
+ *	 their last byte before being compared.
+ */
+static const unsigned char *
+qstr_find_bytes (const unsigned char *src, int src_size, const unsigned char *sub, int sub_size)
+{
+  const unsigned char *ptr, *last_start;
+  const unsigned char first = sub[0];
+  const unsigned char last = sub[sub_size - 1];
+
+  assert (sub_size > 0);
+
+  if (src_size < sub_size)
+    {
+      return NULL;
+    }
+
+  ptr = src;
+  last_start = src + (src_size - sub_size);
+  while (ptr <= last_start)
+    {
+      ptr = (const unsigned char *) memchr (ptr, first, CAST_BUFLEN (last_start - ptr) + 1);
+      if (ptr == NULL)
+	{
+	  return NULL;
+	}
+      if (ptr[sub_size - 1] == last && memcmp (ptr + 1, sub + 1, sub_size - 1) == 0)
+	{
+	  return ptr;
+	}
+      ptr++;
+    }
+
+  return NULL;
+}
+
+/*
+ * qstr_eval_like_bytewise () - evaluate LIKE by byte search when the pattern allows it
+ *   return: true, if the pattern was evaluated; false, if qstr_eval_like must be used
+ *   tar(in), tar_length(in): the string to match (size in bytes)
+ *   expr(in), expr_length(in): the pattern (size in bytes)
+ *   escape(in): escape character or NULL
+ *   coll_id(in): collation
+ *   result(out): V_TRUE or V_FALSE
+ *
+ * Note: the patterns 'literal%' and '%literal%' of the binary collations are matched by memcmp and by qstr_find_bytes.
+ *	 Any other pattern, including a literal with a wildcard or an escape in it, is left to qstr_eval_like.
+ */
+static bool
+qstr_eval_like_bytewise (const char *tar, int tar_length, const char *expr, int expr_length, const char *escape,
+			 int coll_id, int *result)
+{
+  const unsigned char *lit = REINTERPRET_CAST (const unsigned char *, expr);
+  const unsigned char *lit_end = lit + expr_length;
+  const unsigned char *utar = REINTERPRET_CAST (const unsigned char *, tar);
+  bool has_leading_percent = false;
+  int lit_size;
+
+  while (lit < lit_end && *lit == LIKE_WILDCARD_MATCH_MANY)
+    {
+      has_leading_percent = true;
+      lit++;
+    }
+  if (lit_end == lit || *(lit_end - 1) != LIKE_WILDCARD_MATCH_MANY)
+    {
+      return false;
+    }
+  while (lit_end > lit && *(lit_end - 1) == LIKE_WILDCARD_MATCH_MANY)
+    {
+      lit_end--;
+    }
+
+  lit_size = CAST_BUFLEN (lit_end - lit);
+  if (lit_size == 0 || memchr (lit, LIKE_WILDCARD_MATCH_MANY, lit_size) != NULL
+      || memchr (lit, LIKE_WILDCARD_MATCH_ONE, lit_size) != NULL)
+    {
+      return false;
+    }
+  if (escape != NULL
+      && (*escape == LIKE_WILDCARD_MATCH_MANY || *escape == LIKE_WILDCARD_MATCH_ONE
+	  || memchr (lit, (unsigned char) *escape, lit_size) != NULL))
+    {
+      return false;
+    }
+  if (!qstr_is_bytewise_match (coll_id, lit, lit_size))
+    {
+      return false;
+    }
+
+  if (has_leading_percent)
+    {
+      *result = (qstr_find_bytes (utar, tar_length, lit, lit_size) != NULL) ? V_TRUE : V_FALSE;
+    }
+  else
+    {
+      *result = (tar_length >= lit_size && memcmp (utar, lit, lit_size) == 0) ? V_TRUE : V_FALSE;
+    }
+
+  return true;
+}
+
 /*
  * qstr_eval_like () -
  */
@@ -10473,6 +10617,17 @@ qstr_position (const char *sub_string, const int sub_size, const int sub_length,
       const unsigned char *usrc_string = REINTERPRET_CAST (const unsigned char *, src_string);
       const unsigned char *usrc_string_bound = REINTERPRET_CAST (const unsigned char *, src_string_bound);
 
+      if (is_forward_search && qstr_is_bytewise_match (coll_id, usub_string, sub_size))
+	{
+	  ptr = qstr_find_bytes (usrc_string, CAST_BUFLEN (usrc_end - usrc_string), usub_string, sub_size);
+	  if (ptr != NULL)
+	    {
+	      intl_char_count (usrc_string, CAST_BUFLEN (ptr - usrc_string), codeset, &current_position);
+	      *position = current_position + 1;
+	    }
+	  return error_status;
+	}
+
       ptr = usrc_string;
       current_position = 0;
       result = 1;
@@ -26,13 +26,107 @@
 #include "error_manager.h"
 #include "memory_alloc.h"
 #include "language_support.h"
+#include "system_parameter.h"
 
 #include <algorithm>
+#include <list>
+#include <mutex>
 #include <regex>
 #include <string>
+#include <unordered_map>
 
 namespace cubregex
 {
+  /*
+   * regex_cache - process-wide LRU cache of compiled regular expressions
+   *
+   * The statements keep their compiled regex only while the pattern does not change, and the constant folding and the
+   * patterns bound as host variables throw it away after each evaluation. The cache keeps a master copy of each
+   * recently compiled pattern, keyed by pattern, flags and collation; a hit hands out a copy of it, which shares the
+   * automaton of the master copy, so the callers still own (and delete) the object they get.
+   */
+  class regex_cache
+  {
+    public:
+      regex_cache () = default;
+      ~regex_cache ();
+
+      cub_regex_object *get (const std::string &key);
+      void put (const std::string &key, const cub_regex_object &regex);
+
+    private:
+      using lru_list = std::list<std::pair<std::string, cub_regex_object *>>;
+
+      std::mutex m_mutex;
+      lru_list m_lru;	/* most recently used first */
+      std::unordered_map<std::string, lru_list::iterator> m_map;
+  };
+
+  static regex_cache regex_Cache;
+
+  regex_cache::~regex_cache ()
+  {
+    for (auto &it : m_lru)
+      {
+	delete it.second;
+      }
+  }
+
+  cub_regex_object *
+  regex_cache::get (const std::string &key)
+  {
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    auto found = m_map.find (key);
+    if (found == m_map.end ())
+      {
+	return NULL;
+      }
+
+    m_lru.splice (m_lru.begin (), m_lru, found->second);
+    return new cub_regex_object (*found->second->second);
+  }
+
+  void
+  regex_cache::put (const std::string &key, const cub_regex_object &regex)
+  {
+    size_t max_size = (size_t) prm_get_integer_value (PRM_ID_REGEXP_CACHE_SIZE);
+    std::lock_guard<std::mutex> lock (m_mutex);
+
+    if (m_map.find (key) != m_map.end ())
+      {
+	/* compiled concurrently by another thread */
+	return;
+      }
+
+    while (!m_lru.empty () && m_lru.size () >= max_size)
+      {
+	m_map.erase (m_lru.back ().first);
+	delete m_lru.back ().second;
+	m_lru.pop_back ();
+      }
+    if (max_size == 0)
+      {
+	return;
+      }
+
+    m_lru.emplace_front (key, new cub_regex_object (regex));
+    m_map[key] = m_lru.begin ();
+  }
+
+  static std::string
+  make_cache_key (const char *pattern, const std::regex_constants::syntax_option_type reg_flags,
+		  const LANG_COLLATION *collation)
+  {
+    std::string key = std::to_string (collation->coll.coll_id);
+
+    key += ':';
+    key += std::to_string ((int) reg_flags);
+    key += ':';
+    key += pattern;
+
+    return key;
+  }
 
   compiled_regex::compiled_regex () : regex (NULL), pattern (NULL)
   {}
@@ -188,6 +282,14 @@ namespace cubregex
 	if (compiled_regex != NULL)
 	  {
 	    delete compiled_regex;
+	    compiled_regex = NULL;
+	  }
+
+	std::string cache_key = make_cache_key (pattern, reg_flags, collation);
+	compiled_regex = regex_Cache.get (cache_key);
+	if (compiled_regex != NULL)
+	  {
+	    return NO_ERROR;
 	  }
 
 	compiled_regex = new cub_regex_object ();
@@ -200,6 +302,7 @@ namespace cubregex
 	    std::locale loc = cublocale::get_locale (std::string ("utf-8"), cublocale::get_lang_name (collation));
 	    compiled_regex->imbue (loc);
 	    compiled_regex->assign (pattern_wstring, reg_flags);
+	    regex_Cache.put (cache_key, *compiled_regex);
 	  }
       }
     catch (std::regex_error &e)
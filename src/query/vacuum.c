@@ -41,6 +41,7 @@
 #include "page_buffer.h"
 #include "perf_monitor.h"
 #include "resource_shared_pool.hpp"
+#include "show_scan.h"
 #include "thread_entry_task.hpp"
 #if defined (SERVER_MODE)
 #include "thread_daemon.hpp"
@@ -475,6 +476,12 @@ lockfree::circular_queue<VACUUM_LOG_BLOCKID> *vacuum_Finished_job_queue = NULL;
 
 #define VACUUM_FINISHED_JOB_QUEUE_CAPACITY  2048
 
+/* The most log blocks a worker job can merge before vacuuming their heap objects (vacuum_heap_batch_blocks). */
+#define VACUUM_HEAP_BATCH_MAX_BLOCKS 16
+
+/* With vacuum_worker_count_min, the vacuum master runs one worker for each so many unvacuumed log blocks. */
+#define VACUUM_ADAPTIVE_BLOCKS_PER_WORKER 4
+
 #define VACUUM_LOG_BLOCK_BUFFER_INVALID (-1)
 
 /* Convert vacuum worker TRANID to an index in vacuum worker's array */
@@ -671,7 +678,8 @@ static void vacuum_init_data_page_with_last_blockid (THREAD_ENTRY * thread_p, VA
 static int vacuum_recover_lost_block_data (THREAD_ENTRY * thread_p);
 
 static int vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * block_data,
-				     bool sa_mode_partial_block);
+				     bool sa_mode_partial_block, bool defer_heap);
+static void vacuum_process_log_block_batch (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * blocks, int n_blocks);
 static int vacuum_process_log_record (THREAD_ENTRY * thread_p, VACUUM_WORKER * worker, LOG_LSA * log_lsa_p,
 				      LOG_PAGE * log_page_p, LOG_DATA * log_record_data, MVCCID * mvccid,
 				      char **undo_data_ptr, int *undo_data_size, LOG_VACUUM_INFO * vacuum_info,
@@ -798,24 +806,39 @@ class vacuum_master_context_manager : public cubthread::daemon_entry_manager
     }
 };
 
+class vacuum_worker_task;
+
 class vacuum_master_task : public cubthread::entry_task
 {
   public:
-    vacuum_master_task () = default;
+    vacuum_master_task ()
+      : m_cursor ()
+      , m_oldest_visible_mvccid (MVCCID_NULL)
+      , m_pending_task (NULL)
+      , m_batch_blocks (1)
+      , m_worker_target (0)
+    {
+    }
 
     void execute (cubthread::entry &thread_ref) final;
 
   private:
     bool check_shutdown () const;
     bool is_task_queue_full () const;
+    bool is_worker_target_reached () const;
     bool should_interrupt_iteration () const;         // conditions to interrupt an iteration and go to sleep
+    void update_worker_target ();                     // adapt the number of running jobs to vacuum backlog
     bool is_cursor_entry_ready_to_vacuum () const;    // check if conditions to vacuum cursor entry are met
     bool is_cursor_entry_available () const;          // check if cursor entry is available and can generate a new job
-    void start_job_on_cursor_entry () const;          // start job on cursor entry
+    void start_job_on_cursor_entry ();                // start job on cursor entry
+    void push_pending_task ();                        // push the job still collecting blocks
     bool should_force_data_update () const;           // conditions to force a vacuum data update
 
     vacuum_job_cursor m_cursor;                       // cursor that iterates through vacuum data entries
     MVCCID m_oldest_visible_mvccid;                   // saved oldest visible mvccid (recomputed on each iteration)
+    vacuum_worker_task *m_pending_task;               // job collecting blocks for vacuum_heap_batch_blocks
+    int m_batch_blocks;                               // saved vacuum_heap_batch_blocks (read on each iteration)
+    int m_worker_target;                              // how many jobs may run at once; 0 if not adaptive
 };
 
 // class vacuum_worker_context_manager
@@ -896,25 +919,36 @@ class vacuum_worker_context_manager : public cubthread::entry_manager
 //  description:
 //    vacuum worker task
 //
+//    a task can carry several log blocks; their heap objects are merged and vacuumed together, so each heap page
+//    is fixed once per task instead of once per block
+//
 class vacuum_worker_task : public cubthread::entry_task
 {
   public:
     vacuum_worker_task (const VACUUM_DATA_ENTRY & entry_ref)
-      : m_data (entry_ref)
+      : m_count (1)
+    {
+      m_data[0] = entry_ref;
+    }
+
+    bool is_full (int max_blocks) const
     {
+      return m_count >= max_blocks || m_count >= VACUUM_HEAP_BATCH_MAX_BLOCKS;
     }
 
-    void execute (cubthread::entry & thread_ref) final
+    void add_block (const VACUUM_DATA_ENTRY & entry_ref)
     {
-      // safe-guard - check interrupt is always false
-      assert (!thread_ref.check_interrupt);
-      vacuum_process_log_block (&thread_ref, &m_data, false);
+      assert (m_count < VACUUM_HEAP_BATCH_MAX_BLOCKS);
+      m_data[m_count++] = entry_ref;
     }
 
+    void execute (cubthread::entry & thread_ref) final;
+
   private:
     vacuum_worker_task ();
 
-    VACUUM_DATA_ENTRY m_data;
+    VACUUM_DATA_ENTRY m_data[VACUUM_HEAP_BATCH_MAX_BLOCKS];
+    int m_count;
 };
 
 // vacuum master globals
@@ -924,6 +958,23 @@ static vacuum_master_context_manager *vacuum_Master_context_manager = NULL;  //
 // vacuum worker globals
 static cubthread::entry_workpool *vacuum_Worker_threads = NULL;              // thread pool
 static vacuum_worker_context_manager *vacuum_Worker_context_manager = NULL;  // context manager
+static std::atomic<int> vacuum_Worker_job_count (0);                        // jobs pushed and not yet finished
+
+void
+vacuum_worker_task::execute (cubthread::entry & thread_ref)
+{
+  // safe-guard - check interrupt is always false
+  assert (!thread_ref.check_interrupt);
+  if (m_count == 1)
+    {
+      vacuum_process_log_block (&thread_ref, &m_data[0], false, false);
+    }
+  else
+    {
+      vacuum_process_log_block_batch (&thread_ref, m_data, m_count);
+    }
+  --vacuum_Worker_job_count;
+}
 
 /* *INDENT-ON* */
 
@@ -940,7 +991,7 @@ vacuum_sa_run_job (THREAD_ENTRY * thread_p, const VACUUM_DATA_ENTRY & data_entry
   assert (save_type == thread_type::TT_VACUUM_MASTER);
 
   VACUUM_DATA_ENTRY copy_data_entry = data_entry;
-  vacuum_process_log_block (thread_p, &copy_data_entry, is_partial);
+  vacuum_process_log_block (thread_p, &copy_data_entry, is_partial, false);
 
   vacuum_convert_thread_to_master (thread_p, save_type);
   assert (save_type == thread_type::TT_VACUUM_WORKER);
@@ -1176,6 +1227,9 @@ vacuum_initialize (THREAD_ENTRY * thread_p, int vacuum_log_block_npages, VFID *
   vacuum_Master.prefetch_log_buffer = NULL;
   vacuum_Master.prefetch_first_pageid = NULL_PAGEID;
   vacuum_Master.prefetch_last_pageid = NULL_PAGEID;
+  vacuum_Master.current_blockid = VACUUM_NULL_LOG_BLOCKID;
+  vacuum_Master.n_vacuumed_blocks = 0;
+  vacuum_Master.job_time_usec = 0;
   vacuum_Master.allocated_resources = false;
 
   /* Initialize workers */
@@ -1192,6 +1246,9 @@ vacuum_initialize (THREAD_ENTRY * thread_p, int vacuum_log_block_npages, VFID *
       vacuum_Workers[i].prefetch_log_buffer = NULL;
       vacuum_Workers[i].prefetch_first_pageid = NULL_PAGEID;
       vacuum_Workers[i].prefetch_last_pageid = NULL_PAGEID;
+      vacuum_Workers[i].current_blockid = VACUUM_NULL_LOG_BLOCKID;
+      vacuum_Workers[i].n_vacuumed_blocks = 0;
+      vacuum_Workers[i].job_time_usec = 0;
       vacuum_Workers[i].allocated_resources = false;
     }
 
@@ -2942,6 +2999,9 @@ vacuum_master_task::execute (cubthread::entry &thread_ref)
   pgbuf_flush_if_requested (&thread_ref, (PAGE_PTR) vacuum_Data.first_page);
   pgbuf_flush_if_requested (&thread_ref, (PAGE_PTR) vacuum_Data.last_page);
 
+  m_batch_blocks = prm_get_integer_value (PRM_ID_VACUUM_HEAP_BATCH_BLOCKS);
+  update_worker_target ();
+
   m_cursor.force_data_update ();
   vacuum_er_log (VACUUM_ER_LOG_MASTER | VACUUM_ER_LOG_JOBS, "Start searching jobs at " vacuum_job_cursor_print_format,
                  vacuum_job_cursor_print_args (m_cursor));
@@ -2965,6 +3025,8 @@ vacuum_master_task::execute (cubthread::entry &thread_ref)
           m_cursor.force_data_update ();
         }
     }
+  // do not keep blocks waiting for the next iteration
+  push_pending_task ();
   m_cursor.unload ();
 #if !defined (NDEBUG)
   vacuum_verify_vacuum_data_page_fix_count (&thread_ref);
@@ -2996,10 +3058,89 @@ vacuum_master_task::is_task_queue_full() const
   return false;
 }
 
+bool
+vacuum_master_task::is_worker_target_reached () const
+{
+  if (m_worker_target > 0 && vacuum_Worker_job_count >= m_worker_target)
+    {
+      // let the running jobs finish before adding others
+      vacuum_er_log (VACUUM_ER_LOG_MASTER, "Interrupt iteration: %d jobs running", m_worker_target);
+      return true;
+    }
+  return false;
+}
+
 bool
 vacuum_master_task::should_interrupt_iteration () const
 {
-  return check_shutdown () || is_task_queue_full ();
+  return check_shutdown () || is_task_queue_full () || is_worker_target_reached ();
+}
+
+//
+// update_worker_target - adapt the number of jobs running at once to the vacuum backlog
+//
+// with vacuum_worker_count_min, the target is between vacuum_worker_count_min and vacuum_worker_count. it grows at
+// once to one worker for each VACUUM_ADAPTIVE_BLOCKS_PER_WORKER unvacuumed log blocks, but not while the system is
+// already busier than its processors; it shrinks by one worker on each iteration, so short pauses in the backlog do
+// not make it swing.
+//
+void
+vacuum_master_task::update_worker_target ()
+{
+  int min_workers = prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT_MIN);
+  int max_workers = prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT);
+  INT64 backlog_blocks;
+  int needed_workers;
+
+  if (min_workers <= 0 || min_workers >= max_workers)
+    {
+      // not adaptive
+      m_worker_target = 0;
+      return;
+    }
+  if (m_worker_target == 0)
+    {
+      m_worker_target = min_workers;
+    }
+
+  if (vacuum_Data.is_empty ())
+    {
+      backlog_blocks = 0;
+    }
+  else
+    {
+      backlog_blocks = vacuum_Data.get_last_blockid () - vacuum_Data.get_first_blockid () + 1;
+    }
+  if (vacuum_Data.oldest_unvacuumed_mvccid >= m_oldest_visible_mvccid)
+    {
+      // nothing can be vacuumed yet, no matter how many blocks wait
+      backlog_blocks = 0;
+    }
+  needed_workers = (int) MIN (CEIL_PTVDIV (backlog_blocks, VACUUM_ADAPTIVE_BLOCKS_PER_WORKER), max_workers);
+  needed_workers = MAX (needed_workers, min_workers);
+
+  if (needed_workers > m_worker_target)
+    {
+#if !defined (WINDOWS)
+      double loadavg;
+      long nprocs = sysconf (_SC_NPROCESSORS_ONLN);
+
+      if (getloadavg (&loadavg, 1) == 1 && nprocs > 0 && loadavg > (double) nprocs)
+	{
+	  // no headroom, keep the workers we have
+	  return;
+	}
+#endif /* !WINDOWS */
+      vacuum_er_log (VACUUM_ER_LOG_MASTER, "grow workers from %d to %d for %lld blocks", m_worker_target,
+		     needed_workers, (long long int) backlog_blocks);
+      m_worker_target = needed_workers;
+    }
+  else if (needed_workers < m_worker_target)
+    {
+      m_worker_target--;
+      vacuum_er_log (VACUUM_ER_LOG_MASTER, "shrink workers to %d for %lld blocks", m_worker_target,
+		     (long long int) backlog_blocks);
+    }
 }
 
 bool
@@ -3052,11 +3193,32 @@ vacuum_master_task::is_cursor_entry_available () const
 }
 
 void
-vacuum_master_task::start_job_on_cursor_entry () const
+vacuum_master_task::start_job_on_cursor_entry ()
 {
   m_cursor.start_job_on_current_entry ();
-  cubthread::get_manager ()->push_task (vacuum_Worker_threads,
-                                        new vacuum_worker_task (m_cursor.get_current_entry ()));
+  if (m_pending_task == NULL)
+    {
+      m_pending_task = new vacuum_worker_task (m_cursor.get_current_entry ());
+    }
+  else
+    {
+      m_pending_task->add_block (m_cursor.get_current_entry ());
+    }
+  if (m_pending_task->is_full (m_batch_blocks))
+    {
+      push_pending_task ();
+    }
+}
+
+void
+vacuum_master_task::push_pending_task ()
+{
+  if (m_pending_task != NULL)
+    {
+      ++vacuum_Worker_job_count;
+      cubthread::get_manager ()->push_task (vacuum_Worker_threads, m_pending_task);
+      m_pending_task = NULL;
+    }
 }
 
 bool
@@ -3114,9 +3276,12 @@ vacuum_rv_redo_vacuum_complete (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
  * block_log_buffer (in)      : Block log page buffer identifier
  * sa_mode_partial_block (in) : True when SA_MODE vacuum based on partial block information from log header.
  *				Logging is skipped if true.
+ * defer_heap (in)	      : True to only add the heap objects to the ones collected by worker. Caller vacuums them
+ *				and notifies the block is finished (see vacuum_process_log_block_batch).
  */
 static int
-vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, bool sa_mode_partial_block)
+vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, bool sa_mode_partial_block,
+			  bool defer_heap)
 {
   VACUUM_WORKER *worker = vacuum_get_vacuum_worker (thread_p);
   LOG_LSA log_lsa;
@@ -3142,9 +3307,12 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
   bool vacuum_complete = false;
   bool was_interrupted = false;
   bool is_file_dropped = false;
+  bool skip_insert_records = prm_get_bool_value (PRM_ID_VACUUM_SKIP_INSERT_RECORDS);
 
   PERF_UTIME_TRACKER perf_tracker;
   PERF_UTIME_TRACKER job_time_tracker;
+  TSC_TICKS job_start_tick;
+  TSC_TICKS job_end_tick;
 #if defined (SA_MODE)
   bool dummy_continue_check = false;
 #endif /* SA_MODE */
@@ -3162,6 +3330,9 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
   PERF_UTIME_TRACKER_START (thread_p, &perf_tracker);
   PERF_UTIME_TRACKER_START (thread_p, &job_time_tracker);
 
+  tsc_getticks (&job_start_tick);
+  worker->current_blockid = data->get_blockid ();
+
   /* Initialize log_vacuum */
   LSA_SET_NULL (&log_vacuum.prev_mvcc_op_log_lsa);
   VFID_SET_NULL (&log_vacuum.vfid);
@@ -3186,6 +3357,7 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
       error_code = vacuum_log_prefetch_vacuum_block (thread_p, data);
       if (error_code != NO_ERROR)
 	{
+	  worker->current_blockid = VACUUM_NULL_LOG_BLOCKID;
 	  return error_code;
 	}
     }
@@ -3195,7 +3367,10 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
     }
 
   /* Initialize stored heap objects. */
-  worker->n_heap_objects = 0;
+  if (!defer_heap)
+    {
+      worker->n_heap_objects = 0;
+    }
 
   /* set was_interrupted flag to tell vacuum_heap_page that some safe-guard have to behave differently. interruptions
    * are usually marked in blockid, however sa_mode_partial_block can also be interrupted and will no flag is set in
@@ -3273,6 +3448,14 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
 	}
 #endif /* !NDEBUG */
 
+      if (skip_insert_records && log_record_data.rcvindex == RVHF_MVCC_INSERT)
+	{
+	  /* The only thing vacuum would do is to remove the insert MVCCID from the new record. That MVCCID is older
+	   * than any snapshot, so the record is visible as it is: an insert-only heap does not need to be visited at
+	   * all. The heap page stays with a pending vacuum, which is the conservative state for later operations. */
+	  perfmon_inc_stat (thread_p, PSTAT_VAC_NUM_SKIPPED_INSERT_RECORDS);
+	  continue;
+	}
       if (LOG_IS_MVCC_HEAP_OPERATION (log_record_data.rcvindex))
 	{
 	  /* Collect heap object to be vacuumed at the end of the job. */
@@ -3427,6 +3610,12 @@ vacuum_process_log_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * data, boo
   assert (worker->state == VACUUM_WORKER_STATE_EXECUTE);
   assert (!LOG_FIND_CURRENT_TDES (thread_p)->is_under_sysop ());
 
+  if (defer_heap)
+    {
+      /* heap objects are vacuumed by caller, together with the ones of the other blocks */
+      goto end;
+    }
+
   error_code = vacuum_heap (thread_p, worker, threshold_mvccid, was_interrupted);
   if (error_code != NO_ERROR)
     {
@@ -3445,7 +3634,18 @@ end:
   assert (!LOG_FIND_CURRENT_TDES (thread_p)->is_under_sysop ());
 
   worker->state = VACUUM_WORKER_STATE_INACTIVE;
-  if (!sa_mode_partial_block)
+  if (!defer_heap)
+    {
+      /* a batch of blocks accounts its progress when the heap objects of all its blocks are vacuumed */
+      tsc_getticks (&job_end_tick);
+      worker->job_time_usec += (INT64) tsc_elapsed_utime (job_end_tick, job_start_tick);
+      worker->current_blockid = VACUUM_NULL_LOG_BLOCKID;
+      if (vacuum_complete)
+	{
+	  worker->n_vacuumed_blocks++;
+	}
+    }
+  if (!sa_mode_partial_block && !defer_heap)
     {
       /* TODO: Check that if start_lsa can be set to a different value when vacuum is not complete, to avoid processing
        * the same log data again. */
@@ -3465,6 +3665,88 @@ end:
   return error_code;
 }
 
+/*
+ * vacuum_process_log_block_batch () - Vacuum several log blocks and then the heap objects collected from all of them.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * blocks (in)	 : Blocks data.
+ * n_blocks (in) : Number of blocks.
+ *
+ * NOTE: Blocks are processed one by one up to the heap objects, which are merged and vacuumed at the end. Sorted
+ *	 together, the objects of all blocks that belong to same heap page are vacuumed by one fix of that page. No
+ *	 block is reported as vacuumed before its heap objects are. If one block fails, all the blocks that are not
+ *	 vacuumed are reported as interrupted and will be run again.
+ */
+static void
+vacuum_process_log_block_batch (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * blocks, int n_blocks)
+{
+  VACUUM_WORKER *worker = vacuum_get_vacuum_worker (thread_p);
+  MVCCID threshold_mvccid;
+  bool was_interrupted = false;
+  bool vacuum_complete = false;
+  int error_code = NO_ERROR;
+  int i;
+  TSC_TICKS job_start_tick;
+  TSC_TICKS job_end_tick;
+
+  assert (worker != NULL);
+  assert (n_blocks > 1 && n_blocks <= VACUUM_HEAP_BATCH_MAX_BLOCKS);
+
+  if (prm_get_bool_value (PRM_ID_DISABLE_VACUUM))
+    {
+      return;
+    }
+
+  tsc_getticks (&job_start_tick);
+
+  worker->n_heap_objects = 0;
+  for (i = 0; i < n_blocks; i++)
+    {
+      was_interrupted = was_interrupted || blocks[i].was_interrupted ();
+      error_code = vacuum_process_log_block (thread_p, &blocks[i], false, true);
+      if (error_code != NO_ERROR || thread_p->shutdown)
+	{
+	  goto end;
+	}
+    }
+
+  /* all blocks were ready with an older oldest visible MVCCID, so the current one is safe for all of them */
+  threshold_mvccid = log_Gl.mvcc_table.get_global_oldest_visible ();
+
+  error_code = vacuum_heap (thread_p, worker, threshold_mvccid, was_interrupted);
+  if (error_code != NO_ERROR)
+    {
+      vacuum_check_shutdown_interruption (thread_p, error_code);
+      goto end;
+    }
+  assert (!LOG_FIND_CURRENT_TDES (thread_p)->is_under_sysop ());
+
+  perfmon_add_stat (thread_p, PSTAT_VAC_NUM_VACUUMED_LOG_PAGES, n_blocks * vacuum_Data.log_block_npages);
+
+  vacuum_complete = true;
+
+end:
+  worker->state = VACUUM_WORKER_STATE_INACTIVE;
+
+  tsc_getticks (&job_end_tick);
+  worker->job_time_usec += (INT64) tsc_elapsed_utime (job_end_tick, job_start_tick);
+  worker->current_blockid = VACUUM_NULL_LOG_BLOCKID;
+  if (vacuum_complete)
+    {
+      worker->n_vacuumed_blocks += n_blocks;
+    }
+
+  for (i = 0; i < n_blocks; i++)
+    {
+      vacuum_finished_block_vacuum (thread_p, &blocks[i], vacuum_complete);
+    }
+
+#if defined (SERVER_MODE)
+  pgbuf_unfix_all (thread_p);
+#endif /* SERVER_MODE */
+}
+
 /*
  * vacuum_worker_allocate_resources () - Assign a vacuum worker to current thread.
  *
@@ -7040,6 +7322,9 @@ vacuum_log_prefetch_vacuum_block (THREAD_ENTRY * thread_p, VACUUM_DATA_ENTRY * e
 		 VACUUM_PREFETCH_LOG_BLOCK_BUFFER_PAGES, (long long int) worker->prefetch_first_pageid,
 		 (long long int) worker->prefetch_last_pageid);
 
+  /* blocks are mostly vacuumed in order; if vacuum is behind into archives, the next block is read meanwhile */
+  logpb_archive_read_ahead (thread_p, worker->prefetch_last_pageid + 1);
+
 end:
   return error;
 }
@@ -7622,6 +7907,190 @@ vacuum_sa_reflect_last_blockid (THREAD_ENTRY * thread_p)
   vacuum_data_unload_first_and_last_page (thread_p);
 }
 
+/*
+ * vacuum_peek_stats () - Get the vacuum lag statistics.
+ *
+ * return                            : Void.
+ * pending_blocks (out)              : Log blocks in vacuum data that are not removed yet.
+ * oldest_unvacuumed_mvccid (out)    : Global oldest MVCCID not vacuumed.
+ * oldest_unvacuumed_mvccid_age (out) : MVCCIDs generated since the oldest unvacuumed MVCCID.
+ * kept_archive_pages (out)          : Archived log pages that cannot be removed because vacuum needs them.
+ * dropped_files (out)               : Dropped files not yet cleaned up.
+ *
+ * Note: the values are read without synchronization, they are only used for monitoring.
+ */
+void
+vacuum_peek_stats (UINT64 * pending_blocks, UINT64 * oldest_unvacuumed_mvccid, UINT64 * oldest_unvacuumed_mvccid_age,
+		   UINT64 * kept_archive_pages, UINT64 * dropped_files)
+{
+  LOG_PAGEID keep_pageid;
+  LOG_PAGEID next_archive_pageid = log_Gl.hdr.nxarv_pageid;
+  VACUUM_LOG_BLOCKID last_blockid = vacuum_Data.get_last_blockid ();
+  MVCCID oldest_mvccid = vacuum_Data.oldest_unvacuumed_mvccid;
+  MVCCID next_mvccid = log_Gl.hdr.mvcc_next_id;
+
+  *pending_blocks = 0;
+  *oldest_unvacuumed_mvccid = 0;
+  *oldest_unvacuumed_mvccid_age = 0;
+  *kept_archive_pages = 0;
+  *dropped_files = (UINT64) MAX (vacuum_Dropped_files_count, 0);
+
+  if (!vacuum_Data.is_loaded)
+    {
+      return;
+    }
+
+  /* keep_from_log_pageid is the first page of the first block not vacuumed yet */
+  if (vacuum_Data.keep_from_log_pageid != NULL_PAGEID && last_blockid != VACUUM_NULL_LOG_BLOCKID)
+    {
+      VACUUM_LOG_BLOCKID first_blockid = vacuum_get_log_blockid (vacuum_Data.keep_from_log_pageid);
+      if (last_blockid >= first_blockid)
+	{
+	  *pending_blocks = (UINT64) (last_blockid - first_blockid + 1);
+	}
+    }
+
+  if (MVCCID_IS_VALID (oldest_mvccid))
+    {
+      *oldest_unvacuumed_mvccid = oldest_mvccid;
+      if (MVCC_ID_PRECEDES (oldest_mvccid, next_mvccid))
+	{
+	  *oldest_unvacuumed_mvccid_age = next_mvccid - oldest_mvccid;
+	}
+    }
+
+  keep_pageid = vacuum_min_log_pageid_to_keep (NULL);
+  if (keep_pageid != NULL_PAGEID && next_archive_pageid > keep_pageid)
+    {
+      *kept_archive_pages = (UINT64) (next_archive_pageid - keep_pageid);
+    }
+}
+
+/*
+ * vacuum_worker_state_name () - Get the name of vacuum worker state.
+ *
+ * return     : State name.
+ * state (in) : Vacuum worker state.
+ */
+static const char *
+vacuum_worker_state_name (VACUUM_WORKER_STATE state)
+{
+  switch (state)
+    {
+    case VACUUM_WORKER_STATE_INACTIVE:
+      return "INACTIVE";
+    case VACUUM_WORKER_STATE_PROCESS_LOG:
+      return "PROCESS_LOG";
+    case VACUUM_WORKER_STATE_EXECUTE:
+      return "EXECUTE";
+    default:
+      assert (false);
+      return "UNKNOWN";
+    }
+}
+
+/*
+ * vacuum_status_start_scan () - start scan function for show vacuum status
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   type (in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ *
+ * Note: one row is shown for every vacuum worker. The progress of the workers is read without synchronization.
+ */
+int
+vacuum_status_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  const int num_cols = 7;
+  int num_workers;
+  VACUUM_WORKER *worker;
+  VACUUM_LOG_BLOCKID current_blockid;
+  INT64 n_vacuumed_blocks;
+  INT64 job_time_usec;
+  int i;
+  int idx;
+  int error = NO_ERROR;
+  DB_VALUE *vals = NULL;
+
+  *ptr = NULL;
+
+  num_workers = MIN (prm_get_integer_value (PRM_ID_VACUUM_WORKER_COUNT), VACUUM_MAX_WORKER_COUNT);
+
+  ctx = showstmt_alloc_array_context (thread_p, MAX (num_workers, 1), num_cols);
+  if (ctx == NULL)
+    {
+      error = er_errid ();
+      return error;
+    }
+
+  for (i = 0; i < num_workers; i++)
+    {
+      worker = &vacuum_Workers[i];
+
+      /* copy the progress; the worker changes it while we read it */
+      current_blockid = worker->current_blockid;
+      n_vacuumed_blocks = worker->n_vacuumed_blocks;
+      job_time_usec = worker->job_time_usec;
+
+      vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+      if (vals == NULL)
+	{
+	  error = er_errid ();
+	  goto exit_on_error;
+	}
+
+      idx = 0;
+
+      db_make_int (&vals[idx], i);
+      idx++;
+
+      db_make_string (&vals[idx], vacuum_worker_state_name (worker->state));
+      idx++;
+
+      if (current_blockid == VACUUM_NULL_LOG_BLOCKID)
+	{
+	  db_make_null (&vals[idx]);
+	  idx++;
+	  db_make_null (&vals[idx]);
+	  idx++;
+	}
+      else
+	{
+	  db_make_bigint (&vals[idx], current_blockid);
+	  idx++;
+	  db_make_bigint (&vals[idx], VACUUM_FIRST_LOG_PAGEID_IN_BLOCK (current_blockid));
+	  idx++;
+	}
+
+      db_make_bigint (&vals[idx], n_vacuumed_blocks);
+      idx++;
+
+      db_make_bigint (&vals[idx], job_time_usec);
+      idx++;
+
+      db_make_double (&vals[idx], job_time_usec > 0 ? (double) n_vacuumed_blocks * 1000000 / job_time_usec : 0);
+      idx++;
+
+      assert (idx == num_cols);
+    }
+
+  *ptr = ctx;
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (ctx != NULL)
+    {
+      showstmt_free_array_context (thread_p, ctx);
+    }
+
+  return error;
+}
+
 static void
 vacuum_data_empty_update_last_blockid (THREAD_ENTRY * thread_p)
 {
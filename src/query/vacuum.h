@@ -125,6 +125,11 @@ struct vacuum_worker
   LOG_PAGEID prefetch_first_pageid;	/* first prefetched log pageid */
   LOG_PAGEID prefetch_last_pageid;	/* last prefetch log pageid */
 
+  /* Progress of worker, shown by SHOW VACUUM STATUS. */
+  VACUUM_LOG_BLOCKID current_blockid;	/* Block of the job in progress, VACUUM_NULL_LOG_BLOCKID if none */
+  INT64 n_vacuumed_blocks;	/* Number of blocks vacuumed by worker */
+  INT64 job_time_usec;		/* Time spent by worker in vacuum jobs */
+
   bool allocated_resources;
 };
 
@@ -277,4 +282,9 @@ extern void vacuum_notify_es_deleted (THREAD_ENTRY * thread_p, const char *uri);
 extern int vacuum_reset_data_after_copydb (THREAD_ENTRY * thread_p);
 
 extern void vacuum_sa_reflect_last_blockid (THREAD_ENTRY * thread_p);
+
+extern void vacuum_peek_stats (UINT64 * pending_blocks, UINT64 * oldest_unvacuumed_mvccid,
+			       UINT64 * oldest_unvacuumed_mvccid_age, UINT64 * kept_archive_pages, UINT64 * dropped_files);
+extern int vacuum_status_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt,
+				     void **ptr);
 #endif /* _VACUUM_H_ */
@@ -890,8 +890,14 @@ struct groupby_stat
 struct xasl_stat
 {
   struct timeval elapsed_time;
+  struct timeval cpu_time;	/* cpu time of thread */
+  struct timeval lock_waits;
+  struct timeval latch_waits;
+  struct timeval io_waits;
   UINT64 fetches;
   UINT64 ioreads;
+  UINT64 rows;			/* tuples in the result list */
+  UINT64 temp_pages;		/* temp file pages allocated, when results or sorts spill from memory */
 };
 
 /* top-n sorting object */
@@ -903,6 +909,8 @@ struct topn_tuples
   int values_count;		/* number of values in a tuple */
   UINT64 total_size;		/* size in bytes of stored tuples */
   UINT64 max_size;		/* maximum size which tuples may occupy */
+  bool is_first_key_ordered;	/* the scan returns the tuples ordered by the first sort item */
+  bool is_scan_stopped;		/* no other tuple of the current scan block can enter the heap */
 };
 
 struct topn_tuple
@@ -149,6 +149,11 @@ XCACHE xcache_Global;
 #define xcache_Cleanup_bh xcache_Global.cleanup_bh
 #define xcache_Cleanup_array xcache_Global.cleanup_array
 
+/* States of a clone slot. A slot is busy only while a clone is being put in or taken out of it. */
+#define XCACHE_CLONE_SLOT_EMPTY 0
+#define XCACHE_CLONE_SLOT_BUSY 1
+#define XCACHE_CLONE_SLOT_FULL 2
+
 /* Statistics */
 #define XCACHE_STAT_GET(name) ATOMIC_LOAD_64 (&xcache_Global.stats.name)
 #define XCACHE_STAT_INC(name) ATOMIC_INC_64 (&xcache_Global.stats.name, 1)
@@ -262,6 +267,12 @@ static bool xcache_entry_mark_deleted (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY
 static bool xcache_entry_set_request_recompile_flag (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry,
 						     bool set_flag);
 static void xcache_clone_decache (THREAD_ENTRY * thread_p, XASL_CLONE * xclone);
+static XCACHE_CLONE_SLOT *xcache_clone_slot (XASL_CACHE_ENTRY * xcache_entry, int index, bool alloc);
+static bool xcache_clone_checkout (XASL_CACHE_ENTRY * xcache_entry, XASL_CLONE * xclone);
+static bool xcache_clone_checkin (XASL_CACHE_ENTRY * xcache_entry, XASL_CLONE * xclone);
+static void xcache_clone_start_use (XASL_CACHE_ENTRY * xcache_entry);
+static void xcache_decache_all_clones (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
+static void xcache_free_clone_chunks (XASL_CACHE_ENTRY * xcache_entry);
 static void xcache_cleanup (THREAD_ENTRY * thread_p);
 static BH_CMP_RESULT xcache_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_ARG ignore_arg);
 static bool xcache_check_recompilation_threshold (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry);
@@ -296,6 +307,8 @@ xcache_initialize (THREAD_ENTRY * thread_p)
     }
 
   xcache_Max_clones = prm_get_integer_value (PRM_ID_XASL_CACHE_MAX_CLONES);
+  assert (xcache_Max_clones <= XCACHE_CLONE_CHUNK_SIZE * XCACHE_CLONE_MAX_CHUNKS);
+  xcache_Max_clones = MIN (xcache_Max_clones, XCACHE_CLONE_CHUNK_SIZE * XCACHE_CLONE_MAX_CHUNKS);
 
   const int freelist_block_count = 2;
   const int freelist_block_size = std::max (1, xcache_Soft_capacity / freelist_block_count);
@@ -370,24 +383,24 @@ xcache_finalize (THREAD_ENTRY * thread_p)
 // *INDENT-OFF*
 xasl_cache_ent::xasl_cache_ent ()
 {
-  pthread_mutex_init (&cache_clones_mutex, NULL);
   init_clone_cache ();
 }
 
 xasl_cache_ent::~xasl_cache_ent ()
 {
-  assert (cache_clones == NULL || cache_clones == &one_clone);
-  pthread_mutex_destroy (&cache_clones_mutex);
+  assert (n_cache_clones == 0);
 }
 
 void
 xasl_cache_ent::init_clone_cache ()
 {
-  cache_clones = &one_clone;
-  one_clone.xasl = NULL;
-  one_clone.xasl_buf = NULL;
-  cache_clones_capacity = 1;
+  for (int i = 0; i < XCACHE_CLONE_MAX_CHUNKS; i++)
+    {
+      clone_chunks[i] = NULL;
+    }
   n_cache_clones = 0;
+  n_used_clones = 0;
+  max_used_clones = 0;
 }
 // *INDENT-ON*
 
@@ -405,7 +418,6 @@ xcache_entry_alloc (void)
       return NULL;
     }
   xcache_entry->init_clone_cache ();
-  pthread_mutex_init (&xcache_entry->cache_clones_mutex, NULL);
   return xcache_entry;
 }
 
@@ -420,13 +432,9 @@ xcache_entry_free (void *entry)
 {
   XASL_CACHE_ENTRY *xcache_entry = (XASL_CACHE_ENTRY *) entry;
 
-  if (xcache_entry->cache_clones != &xcache_entry->one_clone)
-    {
-      /* Should be already freed? */
-      assert (false);
-      free (xcache_entry->cache_clones);
-    }
-  pthread_mutex_destroy (&xcache_entry->cache_clones_mutex);
+  /* Clones should be already freed. */
+  assert (xcache_entry->n_cache_clones == 0);
+  xcache_free_clone_chunks (xcache_entry);
   free (entry);
   return NO_ERROR;
 }
@@ -459,6 +467,8 @@ xcache_entry_init (void *entry)
   xcache_entry->initialized = true;
 
   assert (xcache_entry->n_cache_clones == 0);
+  xcache_entry->n_used_clones = 0;
+  xcache_entry->max_used_clones = 0;
   return NO_ERROR;
 }
 
@@ -510,21 +520,8 @@ xcache_entry_uninit (void *entry)
       /* Free XASL clones. */
       assert (xcache_entry->n_cache_clones == 0
 	      || (xcache_Max_clones > 0 && xcache_entry->n_cache_clones <= xcache_Max_clones));
-      assert (xcache_entry->n_cache_clones == 0 || xcache_entry->cache_clones != NULL);
-      while (xcache_entry->n_cache_clones > 0)
-	{
-	  xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-	}
-      if (xcache_entry->cache_clones != &xcache_entry->one_clone)
-	{
-	  /* Free cache clones. */
-	  assert (xcache_entry->cache_clones_capacity > 0);
-	  free (xcache_entry->cache_clones);
-	  xcache_entry->cache_clones = &xcache_entry->one_clone;
-	  xcache_entry->one_clone.xasl = NULL;
-	  xcache_entry->one_clone.xasl_buf = NULL;
-	  xcache_entry->cache_clones_capacity = 1;
-	}
+      xcache_decache_all_clones (thread_p, xcache_entry);
+      xcache_free_clone_chunks (xcache_entry);
       if (xcache_entry->stream.buffer != NULL)
 	{
 	  free_and_init (xcache_entry->stream.buffer);
@@ -888,6 +885,7 @@ xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, X
   int oid_index;
   int lock_result;
   bool use_xasl_clone = false;
+  PERF_UTIME_TRACKER time_track = PERF_UTIME_TRACKER_INITIALIZER;
   xasl_cache_rt_check_result recompile_due_to_threshold = XASL_CACHE_RECOMPILE_NOT_NEEDED;
 
   assert (xid != NULL);
@@ -998,43 +996,33 @@ xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, X
     {
       use_xasl_clone = true;
       /* Try to fetch a cached clone. */
-      if ((*xcache_entry)->cache_clones == NULL)
-	{
-	  assert_release (false);
-	  /* Fall through. */
-	}
-      else
+      xcache_clone_start_use (*xcache_entry);
+      if (xcache_clone_checkout (*xcache_entry, xclone))
 	{
-	  (void) pthread_mutex_lock (&(*xcache_entry)->cache_clones_mutex);
-	  assert ((*xcache_entry)->n_cache_clones <= xcache_Max_clones);
-	  if ((*xcache_entry)->n_cache_clones > 0)
-	    {
-	      /* A clone is available. */
-	      *xclone = (*xcache_entry)->cache_clones[--(*xcache_entry)->n_cache_clones];
-	      (void) pthread_mutex_unlock (&(*xcache_entry)->cache_clones_mutex);
-
-	      assert (xclone->xasl != NULL && xclone->xasl_buf != NULL);
-
-	      xcache_log ("found cached clone: \n"
-			  XCACHE_LOG_ENTRY_TEXT ("entry")
-			  XCACHE_LOG_XASL_ID_TEXT ("lookup xasl_id")
-			  XCACHE_LOG_CLONE
-			  XCACHE_LOG_TRAN_TEXT,
-			  XCACHE_LOG_ENTRY_ARGS (*xcache_entry),
-			  XCACHE_LOG_XASL_ID_ARGS (xid),
-			  XCACHE_LOG_CLONE_ARGS (xclone), XCACHE_LOG_TRAN_ARGS (thread_p));
-	      return NO_ERROR;
-	    }
-	  (void) pthread_mutex_unlock (&(*xcache_entry)->cache_clones_mutex);
+	  /* A clone is available. */
+	  assert (xclone->xasl != NULL && xclone->xasl_buf != NULL);
+
+	  xcache_log ("found cached clone: \n"
+		      XCACHE_LOG_ENTRY_TEXT ("entry")
+		      XCACHE_LOG_XASL_ID_TEXT ("lookup xasl_id")
+		      XCACHE_LOG_CLONE
+		      XCACHE_LOG_TRAN_TEXT,
+		      XCACHE_LOG_ENTRY_ARGS (*xcache_entry),
+		      XCACHE_LOG_XASL_ID_ARGS (xid),
+		      XCACHE_LOG_CLONE_ARGS (xclone), XCACHE_LOG_TRAN_ARGS (thread_p));
+	  return NO_ERROR;
 	}
       /* Clone not found. */
+      perfmon_inc_stat (thread_p, PSTAT_PC_NUM_CLONE_MISS);
       /* When clones are activated, we use global heap to generate the XASL's; this way, other threads can use the
        * clone. */
       save_heapid = db_change_private_heap (thread_p, 0);
     }
+  PERF_UTIME_TRACKER_START (thread_p, &time_track);
   error_code =
-    stx_map_stream_to_xasl (thread_p, &xclone->xasl, use_xasl_clone, (*xcache_entry)->stream.buffer,
+    stx_map_stream_to_xasl (thread_p, &xclone->xasl, use_xasl_clone, true, (*xcache_entry)->stream.buffer,
 			    (*xcache_entry)->stream.buffer_size, &xclone->xasl_buf);
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_PC_UNPACK_XASL);
   if (save_heapid != 0)
     {
       /* Restore heap id. */
@@ -1044,6 +1032,11 @@ xcache_find_xasl_id_for_execute (THREAD_ENTRY * thread_p, const XASL_ID * xid, X
     {
       ASSERT_ERROR ();
       assert (xclone->xasl == NULL && xclone->xasl_buf == NULL);
+      if (use_xasl_clone)
+	{
+	  /* the clone will not be retired */
+	  ATOMIC_INC_32 (&(*xcache_entry)->n_used_clones, -1);
+	}
       xcache_unfix (thread_p, *xcache_entry);
       *xcache_entry = NULL;
 
@@ -1145,11 +1138,8 @@ xcache_unfix (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
       xcache_log ("delete entry from hash after unfix: \n"
 		  XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
 		  XCACHE_LOG_ENTRY_ARGS (xcache_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
-      /* No need to acquire the clone mutex, since I'm the unique user. */
-      while (xcache_entry->n_cache_clones > 0)
-	{
-	  xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-	}
+      /* No other thread can use the clones, since I'm the unique user. */
+      xcache_decache_all_clones (thread_p, xcache_entry);
 
       if (!xcache_Hashmap.erase (thread_p, xcache_entry->xasl_id))
 	{
@@ -1467,6 +1457,7 @@ xcache_insert (THREAD_ENTRY * thread_p, const compile_context * context, XASL_ST
       (*xcache_entry)->sql_info.sql_plan_text = sql_plan_text;
       (*xcache_entry)->stream = *stream;
       (*xcache_entry)->time_last_rt_check = (INT64) time_stored.tv_sec;
+      (*xcache_entry)->n_drifted_runs = 0;
       (*xcache_entry)->time_last_used = time_stored;
 
       /* Now that new entry is initialized, we can try to insert it. */
@@ -1731,6 +1722,69 @@ xcache_invalidate_qcaches (THREAD_ENTRY * thread_p, const OID * oid)
   return res;
 }
 
+/*
+ * xcache_invalidate_qcaches_by_partitions () - Invalidate the query cache entries of a partitioned class which may
+ *						have read one of its modified partitions.
+ *
+ * return		 : Error code.
+ * thread_p (in)	 : Thread entry.
+ * root_oid (in)	 : Partitioned class.
+ * modified_oids (in)	 : Modified classes; the modified partitions of root_oid are among them.
+ * n_modified_oids (in)	 : Number of modified classes.
+ */
+int
+xcache_invalidate_qcaches_by_partitions (THREAD_ENTRY * thread_p, const OID * root_oid, const OID * modified_oids,
+					 int n_modified_oids)
+{
+  int res = NO_ERROR;
+  bool finished = false;
+  XASL_CACHE_ENTRY *xcache_entry = NULL;
+
+  if (!xcache_Enabled)
+    {
+      return NO_ERROR;
+    }
+
+  xcache_hashmap_iterator iter = { thread_p, xcache_Hashmap };
+
+  while (!finished)
+    {
+      /* make sure to start from beginning */
+      iter.restart ();
+
+      while (true)
+	{
+	  xcache_entry = iter.iterate ();
+	  if (xcache_entry == NULL)
+	    {
+	      finished = true;
+	      break;
+	    }
+	  if (xcache_entry->list_ht_no < 0)
+	    {
+	      continue;
+	    }
+	  if (xcache_entry_is_related_to_oid (xcache_entry, root_oid))
+	    {
+	      res =
+		qfile_clear_list_cache_by_partitions (thread_p, xcache_entry->list_ht_no, root_oid, modified_oids,
+						      n_modified_oids);
+	      if (res != NO_ERROR)
+		{
+		  finished = true;
+		  break;
+		}
+	      if (qfile_get_list_cache_number_of_entries (xcache_entry->list_ht_no) == 0)
+		{
+		  xcache_entry->list_ht_no = -1;
+		}
+	    }
+	}
+    }
+
+  return res;
+}
+
 /*
  * xcache_invalidate_entries () - Invalidate all cache entries which pass the invalidation check. If there is no
  *				  invalidation check, all cache entries are removed.
@@ -1793,12 +1847,9 @@ xcache_invalidate_entries (THREAD_ENTRY * thread_p, bool (*invalidate_check) (XA
 		{
 		  /*
 		   * Successfully marked for delete. Save it to delete after the iteration.
-		   * No need to acquire the clone mutex, since I'm the unique user.
+		   * No other thread can use the clones, since I'm the unique user.
 		   */
-		  while (xcache_entry->n_cache_clones > 0)
-		    {
-		      xcache_clone_decache (thread_p, &xcache_entry->cache_clones[--xcache_entry->n_cache_clones]);
-		    }
+		  xcache_decache_all_clones (thread_p, xcache_entry);
 		  delete_xids[n_delete_xids++] = xcache_entry->xasl_id;
 		}
 	    }
@@ -2042,53 +2093,13 @@ xcache_retire_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, X
 
   if (xcache_uses_clones ())
     {
-      pthread_mutex_lock (&xcache_entry->cache_clones_mutex);
-      if (xcache_entry->n_cache_clones < xcache_Max_clones)
+      ATOMIC_INC_32 (&xcache_entry->n_used_clones, -1);
+      if (xcache_clone_checkin (xcache_entry, xclone))
 	{
-	  if (xcache_entry->n_cache_clones == xcache_entry->cache_clones_capacity
-	      && xcache_entry->cache_clones_capacity < xcache_Max_clones)
-	    {
-	      /* Extend cache clone buffer. */
-	      XASL_CLONE *new_clones = NULL;
-	      int new_capacity = MIN (xcache_Max_clones, xcache_entry->cache_clones_capacity * 2);
-	      if (xcache_entry->cache_clones == &xcache_entry->one_clone)
-		{
-		  assert (xcache_entry->cache_clones_capacity == 1);
-		  new_clones = (XASL_CLONE *) malloc (new_capacity * sizeof (XASL_CLONE));
-		  if (new_clones != NULL)
-		    {
-		      new_clones[0].xasl = xcache_entry->cache_clones[0].xasl;
-		      new_clones[0].xasl_buf = xcache_entry->cache_clones[0].xasl_buf;
-		    }
-		}
-	      else
-		{
-		  new_clones = (XASL_CLONE *) realloc (xcache_entry->cache_clones, new_capacity * sizeof (XASL_CLONE));
-		}
-	      if (new_clones == NULL)
-		{
-		  /* Out of memory? */
-		  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
-			  new_capacity * sizeof (XASL_CLONE));
-		  assert (false);
-		  pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
-
-		  /* Free the clone. */
-		  xcache_clone_decache (thread_p, xclone);
-		  return;
-		}
-	      xcache_entry->cache_clones = new_clones;
-	      xcache_entry->cache_clones_capacity = new_capacity;
-	    }
-	  assert (xcache_entry->cache_clones_capacity > xcache_entry->n_cache_clones);
-	  xcache_entry->cache_clones[xcache_entry->n_cache_clones++] = *xclone;
-	  pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
-
 	  xclone->xasl = NULL;
 	  xclone->xasl_buf = NULL;
 	  return;
 	}
-      pthread_mutex_unlock (&xcache_entry->cache_clones_mutex);
 
       /* No more room. */
       xcache_clone_decache (thread_p, xclone);
@@ -2099,6 +2110,200 @@ xcache_retire_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, X
   xclone->xasl = NULL;
 }
 
+/*
+ * xcache_clone_slot () - Get a clone slot of XASL cache entry.
+ *
+ * return	     : The slot, or NULL if its chunk is not allocated (or could not be).
+ * xcache_entry (in) : XASL cache entry.
+ * index (in)	     : Slot index.
+ * alloc (in)	     : Allocate the chunk of the slot if it is not allocated yet.
+ *
+ * Note: The chunks are allocated in order, so a missing chunk means all next ones are missing too.
+ */
+static XCACHE_CLONE_SLOT *
+xcache_clone_slot (XASL_CACHE_ENTRY * xcache_entry, int index, bool alloc)
+{
+  XCACHE_CLONE_SLOT **chunk_p = &xcache_entry->clone_chunks[index / XCACHE_CLONE_CHUNK_SIZE];
+  XCACHE_CLONE_SLOT *chunk;
+
+  assert (index < XCACHE_CLONE_CHUNK_SIZE * XCACHE_CLONE_MAX_CHUNKS);
+
+  chunk = ATOMIC_LOAD (chunk_p);
+  if (chunk == NULL)
+    {
+      if (!alloc)
+	{
+	  return NULL;
+	}
+      /* all slots are empty, which calloc gives */
+      chunk = (XCACHE_CLONE_SLOT *) calloc (XCACHE_CLONE_CHUNK_SIZE, sizeof (XCACHE_CLONE_SLOT));
+      if (chunk == NULL)
+	{
+	  return NULL;
+	}
+      if (!ATOMIC_CAS_ADDR (chunk_p, (XCACHE_CLONE_SLOT *) NULL, chunk))
+	{
+	  /* allocated by another thread */
+	  free (chunk);
+	  chunk = ATOMIC_LOAD (chunk_p);
+	}
+    }
+
+  return &chunk[index % XCACHE_CLONE_CHUNK_SIZE];
+}
+
+/*
+ * xcache_clone_checkout () - Take a cached clone of XASL cache entry.
+ *
+ * return	     : True if a clone was taken.
+ * xcache_entry (in) : XASL cache entry.
+ * xclone (out)	     : The clone.
+ */
+static bool
+xcache_clone_checkout (XASL_CACHE_ENTRY * xcache_entry, XASL_CLONE * xclone)
+{
+  XCACHE_CLONE_SLOT *slot;
+  int n_slots;
+  int i;
+
+  if (ATOMIC_INC_32 (&xcache_entry->n_cache_clones, 0) <= 0)
+    {
+      return false;
+    }
+
+  n_slots = MIN (ATOMIC_INC_32 (&xcache_entry->max_used_clones, 0), xcache_Max_clones);
+  for (i = 0; i < n_slots; i++)
+    {
+      slot = xcache_clone_slot (xcache_entry, i, false);
+      if (slot == NULL)
+	{
+	  break;
+	}
+      if (slot->state == XCACHE_CLONE_SLOT_FULL
+	  && ATOMIC_CAS_32 (&slot->state, XCACHE_CLONE_SLOT_FULL, XCACHE_CLONE_SLOT_BUSY))
+	{
+	  *xclone = slot->clone;
+	  slot->clone.xasl = NULL;
+	  slot->clone.xasl_buf = NULL;
+	  ATOMIC_TAS_32 (&slot->state, XCACHE_CLONE_SLOT_EMPTY);
+	  ATOMIC_INC_32 (&xcache_entry->n_cache_clones, -1);
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * xcache_clone_checkin () - Cache a clone in an empty slot of XASL cache entry.
+ *
+ * return	     : True if the clone was cached.
+ * xcache_entry (in) : XASL cache entry.
+ * xclone (in)	     : The clone.
+ *
+ * Note: Only as many slots as the most clones of the entry executed at once are used; the clones beyond would never
+ *	 be taken again.
+ */
+static bool
+xcache_clone_checkin (XASL_CACHE_ENTRY * xcache_entry, XASL_CLONE * xclone)
+{
+  XCACHE_CLONE_SLOT *slot;
+  int n_slots;
+  int i;
+
+  n_slots = MIN (ATOMIC_INC_32 (&xcache_entry->max_used_clones, 0), xcache_Max_clones);
+  for (i = 0; i < n_slots; i++)
+    {
+      slot = xcache_clone_slot (xcache_entry, i, true);
+      if (slot == NULL)
+	{
+	  /* Out of memory? */
+	  break;
+	}
+      if (slot->state == XCACHE_CLONE_SLOT_EMPTY
+	  && ATOMIC_CAS_32 (&slot->state, XCACHE_CLONE_SLOT_EMPTY, XCACHE_CLONE_SLOT_BUSY))
+	{
+	  slot->clone = *xclone;
+	  ATOMIC_TAS_32 (&slot->state, XCACHE_CLONE_SLOT_FULL);
+	  ATOMIC_INC_32 (&xcache_entry->n_cache_clones, 1);
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+/*
+ * xcache_clone_start_use () - Count a clone of XASL cache entry being executed, until it is retired.
+ *
+ * return	     : Void.
+ * xcache_entry (in) : XASL cache entry.
+ */
+static void
+xcache_clone_start_use (XASL_CACHE_ENTRY * xcache_entry)
+{
+  int n_used = ATOMIC_INC_32 (&xcache_entry->n_used_clones, 1);
+  int max_used;
+
+  do
+    {
+      max_used = ATOMIC_INC_32 (&xcache_entry->max_used_clones, 0);
+      if (n_used <= max_used)
+	{
+	  return;
+	}
+    }
+  while (!ATOMIC_CAS_32 (&xcache_entry->max_used_clones, max_used, n_used));
+}
+
+/*
+ * xcache_decache_all_clones () - Free all cached clones of XASL cache entry.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry. The caller must be its unique user.
+ */
+static void
+xcache_decache_all_clones (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry)
+{
+  XCACHE_CLONE_SLOT *slot;
+  int i;
+
+  for (i = 0; i < XCACHE_CLONE_CHUNK_SIZE * XCACHE_CLONE_MAX_CHUNKS && xcache_entry->n_cache_clones > 0; i++)
+    {
+      slot = xcache_clone_slot (xcache_entry, i, false);
+      if (slot == NULL)
+	{
+	  break;
+	}
+      assert (slot->state != XCACHE_CLONE_SLOT_BUSY);
+      if (slot->state == XCACHE_CLONE_SLOT_FULL)
+	{
+	  xcache_clone_decache (thread_p, &slot->clone);
+	  slot->state = XCACHE_CLONE_SLOT_EMPTY;
+	  xcache_entry->n_cache_clones--;
+	}
+    }
+  assert (xcache_entry->n_cache_clones == 0);
+}
+
+/*
+ * xcache_free_clone_chunks () - Free the clone slots of XASL cache entry.
+ *
+ * return	     : Void.
+ * xcache_entry (in) : XASL cache entry. Its clones must be already freed.
+ */
+static void
+xcache_free_clone_chunks (XASL_CACHE_ENTRY * xcache_entry)
+{
+  int i;
+
+  for (i = 0; i < XCACHE_CLONE_MAX_CHUNKS && xcache_entry->clone_chunks[i] != NULL; i++)
+    {
+      free_and_init (xcache_entry->clone_chunks[i]);
+    }
+}
+
 /*
  * xcache_cleanup () - Cleanup xasl cache when soft capacity is exceeded.
  *
@@ -2333,6 +2538,53 @@ xcache_compare_cleanup_candidates (const void *left, const void *right, BH_CMP_A
     }
 }
 
+/*
+ * xcache_record_cardinality () - Compare the result cardinality of an execution of the entry with the estimate of its
+ *				  plan.
+ *
+ * return	     : Void.
+ * thread_p (in)     : Thread entry.
+ * xcache_entry (in) : XASL cache entry.
+ * xasl (in)	     : The executed XASL (clone of the entry).
+ * result_rows (in)  : Number of rows of the query result.
+ *
+ * Note: Only a list of rows selected by the plan is compared: grouping, analytic functions, DISTINCT, LIMIT and
+ *	 hierarchical queries change the number of rows after the plan estimated it. When the factor between the
+ *	 estimate and the result exceeds plan_cache_feedback_factor for plan_cache_feedback_runs executions in a row,
+ *	 xcache_check_recompilation_threshold requests the recompilation of the entry.
+ */
+void
+xcache_record_cardinality (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, const XASL_NODE * xasl,
+			   INT64 result_rows)
+{
+  int factor = prm_get_integer_value (PRM_ID_PLAN_CACHE_FEEDBACK_FACTOR);
+  double estimated, actual;
+
+  if (factor <= 0 || xcache_entry == NULL || xasl == NULL)
+    {
+      return;
+    }
+
+  if (xasl->type != BUILDLIST_PROC || xasl->spec_list == NULL || xasl->proc.buildlist.groupby_list != NULL
+      || xasl->proc.buildlist.a_eval_list != NULL || xasl->option == Q_DISTINCT || xasl->instnum_pred != NULL
+      || xasl->ordbynum_pred != NULL || xasl->orderby_limit != NULL || xasl->limit_row_count != NULL
+      || xasl->connect_by_ptr != NULL)
+    {
+      return;
+    }
+
+  estimated = MAX (xasl->cardinality, 1.0);
+  actual = MAX ((double) result_rows, 1.0);
+  if (actual > estimated * factor || estimated > actual * factor)
+    {
+      (void) ATOMIC_INC_32 (&xcache_entry->n_drifted_runs, 1);
+    }
+  else if (ATOMIC_LOAD (&xcache_entry->n_drifted_runs) != 0)
+    {
+      ATOMIC_STORE (&xcache_entry->n_drifted_runs, 0);
+    }
+}
+
 /*
  * xcache_check_recompilation_threshold () - Check if one of the related classes suffered big changes and if we should
  *					     try to recompile the query.
@@ -2372,6 +2624,20 @@ xcache_check_recompilation_threshold (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY
       xcache_entry_set_request_recompile_flag (thread_p, xcache_entry, false);
     }
 
+  if (prm_get_integer_value (PRM_ID_PLAN_CACHE_FEEDBACK_FACTOR) > 0
+      && ATOMIC_LOAD (&xcache_entry->n_drifted_runs) >= prm_get_integer_value (PRM_ID_PLAN_CACHE_FEEDBACK_RUNS))
+    {
+      /* the plan estimates were wrong for the last executions; recompile it with the current statistics */
+      ATOMIC_STORE (&xcache_entry->n_drifted_runs, 0);
+      xcache_log ("request recompile of entry with drifted cardinality: \n"
+		  XCACHE_LOG_ENTRY_TEXT ("entry") XCACHE_LOG_TRAN_TEXT,
+		  XCACHE_LOG_ENTRY_ARGS (xcache_entry), XCACHE_LOG_TRAN_ARGS (thread_p));
+      if (xcache_entry_set_request_recompile_flag (thread_p, xcache_entry, true))
+	{
+	  return true;
+	}
+    }
+
   for (relobj = 0; relobj < xcache_entry->n_related_objects; relobj++)
     {
       if (xcache_entry->related_objects[relobj].tcard < 0)
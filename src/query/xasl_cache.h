@@ -67,6 +67,19 @@ struct xasl_clone
 #define XASL_CLONE_INITIALIZER { NULL, NULL }
 #define XASL_CLONE_AS_ARGS(clone) (clone)->xasl, (clone)->xasl_buf
 
+/* The cached clones of an entry are kept in slots that are taken and given back with atomic operations only. The slots
+ * are allocated by chunks, as more clones of the entry are used at once, and are kept until the entry is freed.
+ */
+#define XCACHE_CLONE_CHUNK_SIZE 32
+#define XCACHE_CLONE_MAX_CHUNKS 64	/* enough for the upper limit of max_plan_cache_clones */
+
+typedef struct xcache_clone_slot XCACHE_CLONE_SLOT;
+struct xcache_clone_slot
+{
+  volatile int state;		/* XCACHE_CLONE_SLOT_EMPTY, _BUSY or _FULL */
+  XASL_CLONE clone;
+};
+
 /*
  * EXECUTION_INFO: query strings: user text, hash string and dumped plan.
  */
@@ -116,14 +129,14 @@ struct xasl_cache_ent
   bool free_data_on_uninit;	/* set to free entry data on uninit. */
 
   /* Cache clones */
-  XASL_CLONE *cache_clones;
-  XASL_CLONE one_clone;
-  int n_cache_clones;
-  int cache_clones_capacity;
-  pthread_mutex_t cache_clones_mutex;
+  XCACHE_CLONE_SLOT *clone_chunks[XCACHE_CLONE_MAX_CHUNKS];
+  int n_cache_clones;		/* clones in the slots */
+  int n_used_clones;		/* clones of this entry being executed */
+  int max_used_clones;		/* most clones of this entry executed at once; the slots beyond are not used */
 
   /* RT check */
   INT64 time_last_rt_check;
+  int n_drifted_runs;		/* consecutive executions whose result cardinality was far from the estimate */
 
   bool initialized;
 
@@ -167,11 +180,15 @@ extern void xcache_drop_all (THREAD_ENTRY * thread_p);
 extern void xcache_dump (THREAD_ENTRY * thread_p, FILE * fp);
 
 extern bool xcache_can_entry_cache_list (XASL_CACHE_ENTRY * xcache_entry);
+extern void xcache_record_cardinality (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry,
+				       const XASL_NODE * xasl, INT64 result_rows);
 
 extern void xcache_retire_clone (THREAD_ENTRY * thread_p, XASL_CACHE_ENTRY * xcache_entry, XASL_CLONE * xclone);
 extern int xcache_get_entry_count (void);
 extern bool xcache_uses_clones (void);
 
 extern int xcache_invalidate_qcaches (THREAD_ENTRY * thread_p, const OID * oid);
+extern int xcache_invalidate_qcaches_by_partitions (THREAD_ENTRY * thread_p, const OID * root_oid,
+						    const OID * modified_oids, int n_modified_oids);
 
 #endif /* _XASL_CACHE_H_ */
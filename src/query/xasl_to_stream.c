@@ -4464,6 +4464,8 @@ xts_process_indx_info (char *ptr, const INDX_INFO * indx_info)
 
   ptr = or_pack_int (ptr, indx_info->groupby_skip);
 
+  ptr = or_pack_int (ptr, indx_info->orderby_first_key);
+
   ptr = or_pack_int (ptr, indx_info->use_iss);
 
   ptr = or_pack_int (ptr, indx_info->ils_prefix_len);
@@ -6579,6 +6581,7 @@ xts_sizeof_indx_info (const INDX_INFO * indx_info)
 	   + OR_INT_SIZE	/* use_desc_index */
 	   + OR_INT_SIZE	/* orderby_skip */
 	   + OR_INT_SIZE	/* groupby_skip */
+	   + OR_INT_SIZE	/* orderby_first_key */
 	   + OR_INT_SIZE	/* use_iss boolean (int) */
 	   + OR_INT_SIZE	/* ils_prefix_len (int) */
 	   + OR_INT_SIZE	/* func_idx_col_id (int) */
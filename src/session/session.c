@@ -66,6 +66,8 @@ static int rv;
 #define SESSIONS_HASH_SIZE 1000
 #define MAX_SESSION_VARIABLES_COUNT 20
 #define MAX_PREPARED_STATEMENTS_COUNT 20
+/* prepared statements of a session are kept in an open addressing table; keep it a power of 2, well above max count */
+#define PREPARED_STATEMENTS_TABLE_SIZE 32
 
 typedef struct session_info SESSION_INFO;
 struct session_info
@@ -90,7 +92,7 @@ struct prepared_statement
   SHA1Hash sha1;
   int info_length;
   char *info;
-  PREPARED_STATEMENT *next;
+  unsigned int name_hash;	/* case insensitive hash of name */
 };
 typedef struct session_query_entry SESSION_QUERY_ENTRY;
 struct session_query_entry
@@ -121,7 +123,8 @@ struct session_state
   DB_VALUE last_insert_id;
   int row_count;
   SESSION_VARIABLE *session_variables;
-  PREPARED_STATEMENT *statements;
+  PREPARED_STATEMENT *statements[PREPARED_STATEMENTS_TABLE_SIZE];	/* linear probing table of prepared statements */
+  int statements_count;
   SESSION_QUERY_ENTRY *queries;
   time_t active_time;
   SESSION_PARAM *session_parameters;
@@ -180,12 +183,14 @@ typedef struct active_sessions
   session_hashmap_type states_hashmap;
   SESSION_ID last_session_id;
   int num_holdable_cursors;
+  time_t min_active_time;	/* no session was active before this time at last sweep */
 
   // *INDENT-OFF*
   active_sessions ()
     : states_hashmap {}
     , last_session_id (0)
     , num_holdable_cursors (0)
+    , min_active_time (0)
   {
   }
   // *INDENT-ON*
@@ -199,6 +204,8 @@ static int session_remove_expired_sessions (THREAD_ENTRY * thread_p);
 static int session_check_timeout (SESSION_STATE * session_p, SESSION_INFO * active_sessions, bool * remove);
 
 static void session_free_prepared_statement (PREPARED_STATEMENT * stmt_p);
+static int session_find_prepared_statement_slot (SESSION_STATE * state_p, const char *name, unsigned int name_hash);
+static void session_remove_prepared_statement_slot (SESSION_STATE * state_p, int slot);
 
 static int session_add_variable (SESSION_STATE * state_p, const DB_VALUE * name, DB_VALUE * value);
 
@@ -300,7 +307,8 @@ session_state_init (void *st)
   session_p->is_last_insert_id_generated = false;
   session_p->row_count = -1;
   session_p->session_variables = NULL;
-  session_p->statements = NULL;
+  memset (session_p->statements, 0, sizeof (session_p->statements));
+  session_p->statements_count = 0;
   session_p->queries = NULL;
   session_p->session_parameters = NULL;
   session_p->trace_stats = NULL;
@@ -324,10 +332,9 @@ session_state_uninit (void *st)
 {
   SESSION_STATE *session = (SESSION_STATE *) st;
   SESSION_VARIABLE *vcurent = NULL, *vnext = NULL;
-  PREPARED_STATEMENT *pcurent = NULL, *pnext = NULL;
   THREAD_ENTRY *thread_p = thread_get_thread_entry_info ();
   SESSION_QUERY_ENTRY *qcurent = NULL, *qnext = NULL;
-  int cnt = 0;
+  int cnt = 0, slot;
 
   if (session == NULL)
     {
@@ -350,14 +357,15 @@ session_state_uninit (void *st)
   session->session_variables = NULL;
 
   /* free session statements */
-  pcurent = session->statements;
-  while (pcurent != NULL)
+  for (slot = 0; slot < PREPARED_STATEMENTS_TABLE_SIZE; slot++)
     {
-      pnext = pcurent->next;
-      session_free_prepared_statement (pcurent);
-      pcurent = pnext;
+      if (session->statements[slot] != NULL)
+	{
+	  session_free_prepared_statement (session->statements[slot]);
+	  session->statements[slot] = NULL;
+	}
     }
-  session->statements = NULL;
+  session->statements_count = 0;
 
   /* free holdable queries */
   qcurent = session->queries;
@@ -530,6 +538,70 @@ session_free_prepared_statement (PREPARED_STATEMENT * stmt_p)
   free_and_init (stmt_p);
 }
 
+/*
+ * session_find_prepared_statement_slot () - find the slot of a prepared statement
+ * return : slot of the statement, or the free slot where it would be added
+ * state_p (in)	  : session state object
+ * name (in)	  : name of the prepared statement
+ * name_hash (in) : case insensitive hash of name
+ *
+ * Note: the table has always free slots, since it is larger than the max count of statements.
+ */
+static int
+session_find_prepared_statement_slot (SESSION_STATE * state_p, const char *name, unsigned int name_hash)
+{
+  int slot = (int) (name_hash & (PREPARED_STATEMENTS_TABLE_SIZE - 1));
+  PREPARED_STATEMENT *stmt_p;
+
+  assert (state_p->statements_count < PREPARED_STATEMENTS_TABLE_SIZE);
+
+  while ((stmt_p = state_p->statements[slot]) != NULL)
+    {
+      if (stmt_p->name_hash == name_hash && intl_identifier_casecmp (stmt_p->name, name) == 0)
+	{
+	  break;
+	}
+      slot = (slot + 1) & (PREPARED_STATEMENTS_TABLE_SIZE - 1);
+    }
+
+  return slot;
+}
+
+/*
+ * session_remove_prepared_statement_slot () - free the prepared statement of a slot
+ * return : void
+ * state_p (in) : session state object
+ * slot (in)	: used slot
+ *
+ * Note: the statements that follow in the same probe sequence are shifted back, so that lookups never have to skip
+ *	 deleted slots.
+ */
+static void
+session_remove_prepared_statement_slot (SESSION_STATE * state_p, int slot)
+{
+  int next, home;
+
+  assert (state_p->statements[slot] != NULL);
+
+  session_free_prepared_statement (state_p->statements[slot]);
+  state_p->statements[slot] = NULL;
+  state_p->statements_count--;
+
+  for (next = (slot + 1) & (PREPARED_STATEMENTS_TABLE_SIZE - 1); state_p->statements[next] != NULL;
+       next = (next + 1) & (PREPARED_STATEMENTS_TABLE_SIZE - 1))
+    {
+      home = (int) (state_p->statements[next]->name_hash & (PREPARED_STATEMENTS_TABLE_SIZE - 1));
+
+      /* move the statement into the hole, unless its home slot is cyclically between the hole and its slot */
+      if ((next > slot && (home <= slot || home > next)) || (next < slot && home <= slot && home > next))
+	{
+	  state_p->statements[slot] = state_p->statements[next];
+	  state_p->statements[next] = NULL;
+	  slot = next;
+	}
+    }
+}
+
 // *INDENT-OFF*
 #if defined (SERVER_MODE)
 void
@@ -583,6 +655,7 @@ session_states_init (THREAD_ENTRY * thread_p)
 {
   sessions.last_session_id = 0;
   sessions.num_holdable_cursors = 0;
+  sessions.min_active_time = 0;
 
 #if defined (SESSION_DEBUG)
   er_log_debug (ARG_FILE_LINE, "creating session states table\n");
@@ -893,6 +966,14 @@ session_remove_expired_sessions (THREAD_ENTRY * thread_p)
   int n_expired_sids = 0;
   int sid_index;
   bool finished = false;
+  time_t min_active_time = time (NULL);
+
+  /* Active times only grow and new sessions start active now, so no session can be expired before the oldest active
+   * time seen by last sweep is timed out. Skip the sweeps that could not find any. */
+  if (min_active_time - sessions.min_active_time < prm_get_integer_value (PRM_ID_SESSION_STATE_TIMEOUT))
+    {
+      return NO_ERROR;
+    }
 
   active_sessions.count = -1;
   active_sessions.session_ids = NULL;
@@ -922,7 +1003,14 @@ session_remove_expired_sessions (THREAD_ENTRY * thread_p)
 	      goto exit_on_end;
 	    }
 
-	  if (is_expired)
+	  if (!is_expired)
+	    {
+	      if (state->active_time < min_active_time)
+		{
+		  min_active_time = state->active_time;
+		}
+	    }
+	  else
 	    {
 	      expired_sid_buffer[n_expired_sids++] = state->id;
 	      if (n_expired_sids == EXPIRED_SESSION_BUFFER_SIZE)
@@ -953,6 +1041,8 @@ session_remove_expired_sessions (THREAD_ENTRY * thread_p)
       n_expired_sids = 0;
     }
 
+  sessions.min_active_time = min_active_time;
+
 exit_on_end:
   if (active_sessions.session_ids != NULL)
     {
@@ -1656,7 +1746,7 @@ session_set_session_parameters (THREAD_ENTRY * thread_p, SESSION_PARAM * session
 
 /*
  * session_create_prepared_statement () - create a prepared statement and add
- *					  it to the prepared statements list
+ *					  it to the prepared statements table
  * return : NO_ERROR or error code
  * thread_p (in)	: thread entry
  * name (in)		: the name of the statement
@@ -1677,6 +1767,7 @@ session_create_prepared_statement (THREAD_ENTRY * thread_p, char *name, char *al
   SESSION_STATE *state_p = NULL;
   PREPARED_STATEMENT *stmt_p = NULL;
   int err = NO_ERROR;
+  int slot;
 
   stmt_p = (PREPARED_STATEMENT *) malloc (sizeof (PREPARED_STATEMENT));
   if (stmt_p == NULL)
@@ -1691,7 +1782,7 @@ session_create_prepared_statement (THREAD_ENTRY * thread_p, char *name, char *al
   stmt_p->sha1 = *sha1;
   stmt_p->info_length = info_len;
   stmt_p->info = info;
-  stmt_p->next = NULL;
+  stmt_p->name_hash = intl_identifier_mht_1strlowerhash (name, UINT_MAX);
 
   state_p = session_get_session_state (thread_p);
   if (state_p == NULL)
@@ -1704,56 +1795,23 @@ session_create_prepared_statement (THREAD_ENTRY * thread_p, char *name, char *al
   er_log_debug (ARG_FILE_LINE, "create statement %s(%d)\n", name, state_p->id);
 #endif /* SESSION_DEBUG */
 
-  if (state_p->statements == NULL)
+  slot = session_find_prepared_statement_slot (state_p, name, stmt_p->name_hash);
+  if (state_p->statements[slot] != NULL)
+    {
+      /* replace the prepared statement with the same name */
+      session_free_prepared_statement (state_p->statements[slot]);
+    }
+  else if (state_p->statements_count >= MAX_PREPARED_STATEMENTS_COUNT)
     {
-      state_p->statements = stmt_p;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SES_TOO_MANY_STATEMENTS, 0);
+      err = ER_FAILED;
+      goto error;
     }
   else
     {
-      /* find and remove prepared statements with the same name */
-      int cnt = 0;
-      PREPARED_STATEMENT *current = NULL, *prev = NULL;
-
-      current = state_p->statements;
-      while (current != NULL)
-	{
-	  if (intl_identifier_casecmp (current->name, name) == 0)
-	    {
-	      /* we need to remove it */
-	      if (prev == NULL)
-		{
-		  state_p->statements = current->next;
-		}
-	      else
-		{
-		  prev->next = current->next;
-		}
-	      current->next = NULL;
-	      session_free_prepared_statement (current);
-	      break;
-	    }
-	  cnt++;
-	  prev = current;
-	  current = current->next;
-	}
-
-      if (cnt >= MAX_PREPARED_STATEMENTS_COUNT)
-	{
-	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_SES_TOO_MANY_STATEMENTS, 0);
-	  err = ER_FAILED;
-	  goto error;
-	}
-      else if (state_p->statements == NULL)
-	{
-	  /* add the new statement at the beginning of the list */
-	  state_p->statements = stmt_p;
-	}
-      else
-	{
-	  stmt_p->next = state_p->statements;
-	  state_p->statements = stmt_p;
-	}
+      state_p->statements_count++;
     }
+  state_p->statements[slot] = stmt_p;
 
 #if defined (SESSION_DEBUG)
   er_log_debug (ARG_FILE_LINE, "success %s(%d)\n", name, state_p->id);
@@ -1791,6 +1849,7 @@ session_get_prepared_statement (THREAD_ENTRY * thread_p, const char *name, char
   int err = NO_ERROR;
   const char *alias_print;
   char *data = NULL;
+  int slot;
 
   assert (xasl_entry != NULL);
   state_p = session_get_session_state (thread_p);
@@ -1798,14 +1857,8 @@ session_get_prepared_statement (THREAD_ENTRY * thread_p, const char *name, char
     {
       return ER_FAILED;
     }
-  for (stmt_p = state_p->statements; stmt_p != NULL; stmt_p = stmt_p->next)
-    {
-      if (intl_identifier_casecmp (stmt_p->name, name) == 0)
-	{
-	  break;
-	}
-    }
-
+  slot = session_find_prepared_statement_slot (state_p, name, intl_identifier_mht_1strlowerhash (name, UINT_MAX));
+  stmt_p = state_p->statements[slot];
   if (stmt_p == NULL)
     {
       /* prepared statement not found */
@@ -1865,8 +1918,7 @@ int
 session_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name)
 {
   SESSION_STATE *state_p = NULL;
-  PREPARED_STATEMENT *stmt_p = NULL, *prev = NULL;
-  bool found = false;
+  int slot;
 
   state_p = session_get_session_state (thread_p);
   if (state_p == NULL)
@@ -1878,32 +1930,16 @@ session_delete_prepared_statement (THREAD_ENTRY * thread_p, const char *name)
   er_log_debug (ARG_FILE_LINE, "dropping %s from session_id %d\n", name, state_p->id);
 #endif /* SESSION_DEBUG */
 
-  for (stmt_p = state_p->statements, prev = NULL; stmt_p != NULL; prev = stmt_p, stmt_p = stmt_p->next)
-    {
-      if (intl_identifier_casecmp (stmt_p->name, name) == 0)
-	{
-	  if (prev == NULL)
-	    {
-	      state_p->statements = stmt_p->next;
-	    }
-	  else
-	    {
-	      prev->next = stmt_p->next;
-	    }
-	  stmt_p->next = NULL;
-	  session_free_prepared_statement (stmt_p);
-	  found = true;
-	  break;
-	}
-    }
-
-  if (!found)
+  slot = session_find_prepared_statement_slot (state_p, name, intl_identifier_mht_1strlowerhash (name, UINT_MAX));
+  if (state_p->statements[slot] == NULL)
     {
       /* prepared statement not found */
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IT_PREPARED_NAME_NOT_FOUND, 1, name);
       return ER_FAILED;
     }
 
+  session_remove_prepared_statement_slot (state_p, slot);
+
   return NO_ERROR;
 }
 
@@ -2231,8 +2267,8 @@ static int
 session_dump_session (SESSION_STATE * session)
 {
   SESSION_VARIABLE *vcurent, *vnext;
-  PREPARED_STATEMENT *pcurent, *pnext;
   DB_VALUE v;
+  int slot;
 
   fprintf (stdout, "SESSION ID = %d\n", session->id);
 
@@ -2254,12 +2290,12 @@ session_dump_session (SESSION_STATE * session)
     }
 
   fprintf (stdout, "\tPREPRARE STATEMENTS\n");
-  pcurent = session->statements;
-  while (pcurent != NULL)
+  for (slot = 0; slot < PREPARED_STATEMENTS_TABLE_SIZE; slot++)
     {
-      pnext = pcurent->next;
-      session_dump_prepared_statement (pcurent);
-      pcurent = pnext;
+      if (session->statements[slot] != NULL)
+	{
+	  session_dump_prepared_statement (session->statements[slot]);
+	}
     }
 
   fprintf (stdout, "\n");
@@ -25,6 +25,7 @@
 #include "btree.h"
 
 #include "btree_load.h"
+#include "btree_bloom.h"
 #include "config.h"
 #include "db_value_printer.hpp"
 #include "file_manager.h"
@@ -46,6 +47,7 @@
 #include "object_primitive.h"
 #include "object_representation.h"
 #include "perf_monitor.h"
+#include "perf_hotpath.hpp"
 #include "regu_var.hpp"
 #include "fault_injection.h"
 #include "dbtype.h"
@@ -74,6 +76,9 @@
 #define BTREE_SPLIT_MAX_PIVOT (1.0f - BTREE_SPLIT_MIN_PIVOT)
 
 #define BTREE_SPLIT_DEFAULT_PIVOT 0.5f
+
+/* Number of slots around the size based split point (on each side) searched for a shorter leaf separator. */
+#define BTREE_SPLIT_SEPARATOR_WINDOW 4
 #define DISK_PAGE_BITS  (DB_PAGESIZE * CHAR_BIT)	/* Num of bits per page */
 
 #define BTREE_NODE_MAX_SPLIT_SIZE(thread_p, page_ptr) \
@@ -1293,6 +1298,8 @@ static int btree_read_record_without_decompression (THREAD_ENTRY * thread_p, BTI
 static PAGE_PTR btree_get_new_page (THREAD_ENTRY * thread_p, BTID_INT * btid, VPID * vpid, VPID * near_vpid);
 static int btree_search_nonleaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, DB_VALUE * key,
 				      INT16 * slot_id, VPID * child_vpid, page_key_boundary * page_bounds);
+static DB_VALUE_COMPARE_RESULT btree_leaf_compare_int_key (BTID_INT * btid, RECDES * rec, DB_TYPE key_type,
+							   DB_BIGINT key);
 static int btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, DB_VALUE * key,
 				   BTREE_SEARCH_KEY_HELPER * search_key);
 static int btree_leaf_is_key_between_min_max (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf,
@@ -1322,6 +1329,10 @@ static DB_VALUE *btree_find_split_point (THREAD_ENTRY * thread_p, BTID_INT * bti
 					 DB_VALUE * key, BTREE_INSERT_HELPER * helper, bool * clear_midkey);
 static int btree_split_next_pivot (BTREE_NODE_SPLIT_INFO * split_info, float new_value, int max_index);
 static int btree_split_find_pivot (int total, BTREE_NODE_SPLIT_INFO * split_info);
+static int btree_split_separator_size (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, int slot_id);
+static void btree_split_find_shortest_separator (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr,
+						 int start_with, int stop_at, int left_min_size, int left_max_size,
+						 int *mid_slot, int *left_size_p);
 static int btree_split_node (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR Q, PAGE_PTR R,
 			     VPID * P_vpid, VPID * Q_vpid, VPID * R_vpid, INT16 p_slot_id, BTREE_NODE_TYPE node_type,
 			     DB_VALUE * key, BTREE_INSERT_HELPER * helper, VPID * child_vpid);
@@ -1337,6 +1348,7 @@ static PAGE_PTR btree_find_AR_sampling_leaf (THREAD_ENTRY * thread_p, BTID * bti
 					     BTREE_STATS * stat_info_p, bool * found_p);
 static PAGE_PTR btree_find_boundary_leaf (THREAD_ENTRY * thread_p, BTID * btid, VPID * pg_vpid, BTREE_STATS * stat_info,
 					  BTREE_BOUNDARY where);
+static void btree_bloom_build (THREAD_ENTRY * thread_p, BTID * btid);
 static int btree_find_next_index_record (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_find_next_index_record_holding_current (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, RECDES * peek_rec);
 static int btree_find_next_index_record_holding_current_helper (THREAD_ENTRY * thread_p, BTREE_SCAN * bts,
@@ -1506,6 +1518,9 @@ static int btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID *
 static int btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
 				    PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
 				    bool * stop, bool * restart, void *other_args);
+static int btree_fix_root_child_with_copy (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int,
+					   bool reuse_btid_int, DB_VALUE * key, PAGE_PTR * child_page);
+static void btree_save_root_copy (THREAD_ENTRY * thread_p, BTID * btid, PAGE_PTR root_page);
 static int btree_advance_and_find_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 				       PAGE_PTR * crt_page, PAGE_PTR * advance_to_page, bool * is_leaf,
 				       BTREE_SEARCH_KEY_HELPER * search_key, bool * stop, bool * restart,
@@ -1541,6 +1556,7 @@ static int btree_record_satisfies_snapshot (THREAD_ENTRY * thread_p, BTID_INT *
 
 static int btree_range_scan_read_record (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
+static void btree_range_scan_read_ahead_next_leaf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
 static int btree_range_scan_descending_fix_prev_leaf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts, int *key_count,
 						      BTREE_NODE_HEADER ** node_header_ptr, VPID * next_vpid);
 static int btree_range_scan_start (THREAD_ENTRY * thread_p, BTREE_SCAN * bts);
@@ -1565,6 +1581,11 @@ static int btree_undo_delete_physical (THREAD_ENTRY * thread_p, BTID * btid, DB_
 static int btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, DB_VALUE * key,
 				      PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
 				      bool * stop, bool * restart, void *other_args);
+static THREAD_BTREE_INSERT_HINT *btree_get_insert_hint (THREAD_ENTRY * thread_p, BTID_INT * btid_int, bool create);
+static int btree_insert_try_leaf_hint (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
+				       PAGE_PTR * root_page, bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key,
+				       BTREE_INSERT_HELPER * insert_helper);
+static void btree_insert_save_leaf_hint (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_page);
 static int btree_split_node_and_advance (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key,
 					 PAGE_PTR * crt_page, PAGE_PTR * advance_to_page, bool * is_leaf,
 					 BTREE_SEARCH_KEY_HELPER * search_key, bool * stop, bool * restart,
@@ -5019,7 +5040,9 @@ btree_search_nonleaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR pa
     }
 #endif
 
-  key_cnt = btree_node_number_of_keys (thread_p, page_ptr);
+  /* page_ptr may also be a private copy of a root page (see btree_fix_root_child_with_copy), so only slotted page
+   * functions can be used on it. */
+  key_cnt = spage_number_of_records (page_ptr) - 1;
   assert (key_cnt > 0);
 
   if (key_cnt <= 0)
@@ -5316,6 +5339,65 @@ btree_leaf_is_key_between_min_max (THREAD_ENTRY * thread_p, BTID_INT * btid_int,
   return NO_ERROR;
 }
 
+/*
+ * btree_leaf_compare_int_key () - compare an integer key with the key of a leaf record, reading the key image in place
+ *
+ * return	 : DB_LT, DB_EQ or DB_GT, as btree_compare_key (key, record key).
+ * btid (in)	 : B-tree info.
+ * rec (in)	 : Leaf record.
+ * key_type (in) : DB_TYPE_INTEGER or DB_TYPE_BIGINT, the type of the index key.
+ * key (in)	 : Searched key value.
+ *
+ * NOTE: The key image follows the instance OID, the class OID (unique indexes, if flagged) and the MVCCIDs that are
+ *	 flagged in the first object. It is stored as raw memory, the way the index_readval functions read it.
+ */
+static DB_VALUE_COMPARE_RESULT
+btree_leaf_compare_int_key (BTID_INT * btid, RECDES * rec, DB_TYPE key_type, DB_BIGINT key)
+{
+  int offset = OR_OID_SIZE;
+  DB_BIGINT rec_key;
+  DB_VALUE_COMPARE_RESULT c;
+
+  assert (!btree_leaf_is_flaged (rec, BTREE_LEAF_RECORD_OVERFLOW_KEY));
+
+  if (BTREE_IS_UNIQUE (btid->unique_pk) && btree_leaf_is_flaged (rec, BTREE_LEAF_RECORD_CLASS_OID))
+    {
+      offset += OR_OID_SIZE;
+    }
+  if (btree_record_object_is_flagged (rec->data, BTREE_OID_HAS_MVCC_INSID))
+    {
+      offset += OR_MVCCID_SIZE;
+    }
+  if (btree_record_object_is_flagged (rec->data, BTREE_OID_HAS_MVCC_DELID))
+    {
+      offset += OR_MVCCID_SIZE;
+    }
+
+  if (key_type == DB_TYPE_INTEGER)
+    {
+      int i;
+
+      assert (offset + tp_Integer.disksize <= rec->length);
+      memcpy (&i, rec->data + offset, tp_Integer.disksize);
+      rec_key = i;
+    }
+  else
+    {
+      assert (offset + tp_Bigint.disksize <= rec->length);
+      memcpy (&rec_key, rec->data + offset, tp_Bigint.disksize);
+    }
+
+  c = (key < rec_key) ? DB_LT : ((key > rec_key) ? DB_GT : DB_EQ);
+
+  /* for single-column desc index */
+  if (btid->key_type->is_desc)
+    {
+      c = ((c == DB_GT) ? DB_LT : (c == DB_LT) ? DB_GT : c);
+    }
+
+  return c;
+}
+
 /*
  * btree_search_leaf_page () - Search key in page and return result.
  *   return	      : Error code.
@@ -5354,6 +5436,9 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
   RECDES rec;
   bool is_record_read = false;
   LEAF_REC leaf_pnt;
+  DB_TYPE key_dbtype;
+  bool is_int_key;
+  DB_BIGINT int_key = 0;
   int error = NO_ERROR;
 
   /* Assert expected arguments. */
@@ -5364,6 +5449,15 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
 
   btree_init_temp_key_value (&clear_key, &temp_key);
 
+  /* Single column integer keys (most primary keys) are compared in place, without decoding each probed key. */
+  key_dbtype = DB_VALUE_DOMAIN_TYPE (key);
+  is_int_key = (TP_DOMAIN_TYPE (btid->key_type) == key_dbtype
+		&& (key_dbtype == DB_TYPE_INTEGER || key_dbtype == DB_TYPE_BIGINT));
+  if (is_int_key)
+    {
+      int_key = (key_dbtype == DB_TYPE_INTEGER) ? db_get_int (key) : db_get_bigint (key);
+    }
+
   /* Initialize search results. */
   search_key->result = BTREE_KEY_NOTFOUND;
   search_key->slotid = NULL_SLOTID;
@@ -5433,28 +5527,35 @@ btree_search_leaf_page (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
 	  return ER_FAILED;
 	}
 
-      error =
-	btree_read_record_without_decompression (thread_p, btid, &rec, &temp_key, &leaf_pnt, BTREE_LEAF_NODE,
-						 &clear_key, &offset, PEEK_KEY_VALUE);
-      if (error != NO_ERROR)
-	{
-	  /* Error! */
-	  ASSERT_ERROR ();
-	  return error;
-	}
-
       is_record_read = true;
 
-      if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
+      if (is_int_key)
 	{
-	  start_col = MIN (left_start_col, right_start_col);
+	  c = btree_leaf_compare_int_key (btid, &rec, key_dbtype, int_key);
 	}
+      else
+	{
+	  error =
+	    btree_read_record_without_decompression (thread_p, btid, &rec, &temp_key, &leaf_pnt, BTREE_LEAF_NODE,
+						     &clear_key, &offset, PEEK_KEY_VALUE);
+	  if (error != NO_ERROR)
+	    {
+	      /* Error! */
+	      ASSERT_ERROR ();
+	      return error;
+	    }
 
-      /* Compare searched key with current middle key. */
-      c = btree_compare_key (key, &temp_key, btid->key_type, 1, 1, &start_col);
+	  if (DB_VALUE_DOMAIN_TYPE (key) == DB_TYPE_MIDXKEY)
+	    {
+	      start_col = MIN (left_start_col, right_start_col);
+	    }
 
-      /* Clear current middle key. */
-      btree_clear_key_value (&clear_key, &temp_key);
+	  /* Compare searched key with current middle key. */
+	  c = btree_compare_key (key, &temp_key, btid->key_type, 1, 1, &start_col);
+
+	  /* Clear current middle key. */
+	  btree_clear_key_value (&clear_key, &temp_key);
+	}
 
       if (c == DB_UNK)
 	{
@@ -5733,6 +5834,7 @@ xbtree_delete_index (THREAD_ENTRY * thread_p, BTID * btid)
     }
   file_postpone_destroy (thread_p, &btid->vfid);
 
+  btree_bloom_remove (btid);
 
   btid->root_pageid = NULL_PAGEID;
 
@@ -10118,6 +10220,12 @@ btree_merge_node (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR P, PAGE_PTR
   right_header = btree_get_node_header (thread_p, right_pg);
   assert (left_header != NULL && right_header != NULL);
 
+  if (left_header->node_level == 1 && BTREE_IS_UNIQUE (btid->unique_pk))
+    {
+      /* the keys of right page go left, behind a build scan of key filter that may be between the pages */
+      btree_bloom_keys_moved (btid->sys_btid);
+    }
+
   btree_init_temp_key_value (&left_fence_key_clear, &left_fence_key);
   btree_init_temp_key_value (&right_fence_key_clear, &right_fence_key);
 
@@ -12075,6 +12183,29 @@ btree_find_split_point (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_
 #endif /* !NDEBUG */
     }
 
+  if (node_type == BTREE_LEAF_NODE && mid_size == CEIL_PTVDIV (tot_rec, 2)
+      && (slot_id < *mid_slot - BTREE_SPLIT_SEPARATOR_WINDOW || slot_id > *mid_slot + BTREE_SPLIT_SEPARATOR_WINDOW + 1))
+    {
+      /* Random inserts split in the middle: any slot near the middle is as good as the middle one, so pick the one
+       * with the shortest separator. Long keys sharing long prefixes then give short fences and parent keys. The new
+       * key is out of the window and stays on its side; sequential split pivots are left alone. */
+      int window_left_size = 0;
+
+      for (i = start_with; i <= *mid_slot; i++)
+	{
+	  window_left_size += spage_get_space_for_record (thread_p, page_ptr, i);
+	}
+      if (is_key_added_to_left)
+	{
+	  window_left_size += new_ent_size;
+	}
+      btree_split_find_shortest_separator (thread_p, btid, page_ptr, start_with, stop_at, left_min_size, left_max_size,
+					   mid_slot, &window_left_size);
+#if !defined (NDEBUG)
+      left_size = window_left_size;
+#endif /* !NDEBUG */
+    }
+
   /* Safe guard: Rule #2. */
   assert (left_size <= left_max_size);
   assert (left_size >= left_min_size);
@@ -12263,6 +12394,128 @@ success:
   return mid_key;
 }
 
+/*
+ * btree_split_separator_size () - get the disk size of the separator between two adjacent leaf keys
+ *   return: separator size, or -1 if the separator can not be computed cheaply
+ *   btid(in): B-tree info
+ *   page_ptr(in): leaf page
+ *   slot_id(in): the last slot of the left leaf; the separator is between its key and the next one
+ */
+static int
+btree_split_separator_size (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, int slot_id)
+{
+  RECDES rec;
+  DB_VALUE left_key, right_key, prefix_key;
+  bool left_clear_key = false, right_clear_key = false;
+  LEAF_REC leaf_pnt;
+  int offset;
+  int size = -1;
+
+  btree_init_temp_key_value (&left_clear_key, &left_key);
+  btree_init_temp_key_value (&right_clear_key, &right_key);
+  db_make_null (&prefix_key);
+
+  if (spage_get_record (thread_p, page_ptr, slot_id, &rec, PEEK) != S_SUCCESS
+      || btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_OVERFLOW_KEY)
+      || btree_read_record (thread_p, btid, page_ptr, &rec, &left_key, &leaf_pnt, BTREE_LEAF_NODE, &left_clear_key,
+			    &offset, PEEK_KEY_VALUE, NULL) != NO_ERROR)
+    {
+      goto end;
+    }
+
+  if (spage_get_record (thread_p, page_ptr, slot_id + 1, &rec, PEEK) != S_SUCCESS
+      || btree_leaf_is_flaged (&rec, BTREE_LEAF_RECORD_OVERFLOW_KEY)
+      || btree_read_record (thread_p, btid, page_ptr, &rec, &right_key, &leaf_pnt, BTREE_LEAF_NODE, &right_clear_key,
+			    &offset, PEEK_KEY_VALUE, NULL) != NO_ERROR)
+    {
+      goto end;
+    }
+
+  if (btree_get_prefix_separator (&left_key, &right_key, &prefix_key, btid->key_type) == NO_ERROR)
+    {
+      size = btree_get_disk_size_of_key (&prefix_key);
+    }
+
+end:
+  btree_clear_key_value (&left_clear_key, &left_key);
+  btree_clear_key_value (&right_clear_key, &right_key);
+  pr_clear_value (&prefix_key);
+
+  return size;
+}
+
+/*
+ * btree_split_find_shortest_separator () - move the leaf split point to the slot with the shortest separator
+ *   return: void
+ *   btid(in): B-tree info
+ *   page_ptr(in): leaf page being split
+ *   start_with(in): first non-fence slot
+ *   stop_at(in): last non-fence slot
+ *   left_min_size(in): minimum size of left leaf
+ *   left_max_size(in): maximum size of left leaf
+ *   mid_slot(in/out): last slot of left leaf
+ *   left_size_p(in/out): size of left leaf
+ *
+ * Note: Only slots within BTREE_SPLIT_SEPARATOR_WINDOW of the split point are considered, and only if both leaves
+ *	 stay within the size limits and keep at least one record. Ties are won by the slot nearer to the split point.
+ */
+static void
+btree_split_find_shortest_separator (THREAD_ENTRY * thread_p, BTID_INT * btid, PAGE_PTR page_ptr, int start_with,
+				     int stop_at, int left_min_size, int left_max_size, int *mid_slot, int *left_size_p)
+{
+  DB_TYPE key_type = TP_DOMAIN_TYPE (btid->key_type);
+  int best_slot, best_size, best_left_size;
+  int first, last, slot, size, left_size;
+
+  if (key_type != DB_TYPE_MIDXKEY && !pr_is_string_type (key_type))
+    {
+      /* separator is the next key itself */
+      return;
+    }
+
+  best_slot = *mid_slot;
+  best_left_size = *left_size_p;
+  best_size = btree_split_separator_size (thread_p, btid, page_ptr, best_slot);
+  if (best_size < 0)
+    {
+      return;
+    }
+
+  first = MAX (start_with, *mid_slot - BTREE_SPLIT_SEPARATOR_WINDOW);
+  last = MIN (stop_at - 1, *mid_slot + BTREE_SPLIT_SEPARATOR_WINDOW);
+
+  /* left leaf size when it ends with first - 1 */
+  left_size = *left_size_p;
+  for (slot = *mid_slot; slot >= first; slot--)
+    {
+      left_size -= spage_get_space_for_record (thread_p, page_ptr, slot);
+    }
+
+  for (slot = first; slot <= last; slot++)
+    {
+      left_size += spage_get_space_for_record (thread_p, page_ptr, slot);
+      if (slot == *mid_slot || left_size < left_min_size || left_size > left_max_size)
+	{
+	  continue;
+	}
+
+      size = btree_split_separator_size (thread_p, btid, page_ptr, slot);
+      if (size < 0)
+	{
+	  continue;
+	}
+      if (size < best_size || (size == best_size && abs (slot - *mid_slot) < abs (best_slot - *mid_slot)))
+	{
+	  best_slot = slot;
+	  best_size = size;
+	  best_left_size = left_size;
+	}
+    }
+
+  *mid_slot = best_slot;
+  *left_size_p = best_left_size;
+}
+
 /*
  * btree_split_find_pivot () -
  *   return:
@@ -22501,6 +22754,7 @@ btree_search_key_and_apply_functions (THREAD_ENTRY * thread_p, BTID * btid, BTID
 				      BTREE_PROCESS_KEY_FUNCTION * key_function, void *process_key_args,
 				      BTREE_SEARCH_KEY_HELPER * search_key, PAGE_PTR * leaf_page_ptr)
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_BTREE_SEARCH);
   PAGE_PTR crt_page = NULL;	/* Currently fixed page. */
   PAGE_PTR advance_page = NULL;	/* Next level page. */
   int error_code = NO_ERROR;	/* Error code. */
@@ -22682,6 +22936,143 @@ error:
   return error_code;
 }
 
+/*
+ * btree_fix_root_child_with_copy () - Route key with the private copy of b-tree root and fix the child node, without
+ *				       latching the root.
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * btid (in)	       : B-tree identifier.
+ * btid_int (out)      : BTID_INT (B-tree data).
+ * reuse_btid_int (in) : True if btid_int is already filled.
+ * key (in)	       : Key value.
+ * child_page (out)    : Output child of root following key (read latched), or NULL if the copy cannot be used.
+ *
+ * Note: The copy can be used only while the root keeps the version it had when copied. The version is checked again
+ *	 after the child is latched: a root that was changed meanwhile may not point to this child anymore.
+ */
+static int
+btree_fix_root_child_with_copy (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_int, bool reuse_btid_int,
+				DB_VALUE * key, PAGE_PTR * child_page)
+{
+  THREAD_BTREE_ROOT_COPY *copy;
+  BTREE_ROOT_HEADER *root_header;
+  RECDES header_record;
+  VPID root_vpid, child_vpid;
+  INT16 slotid;
+  int error_code = NO_ERROR;
+
+  *child_page = NULL;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  copy = &thread_p->btree_root_copy;
+
+  root_vpid.volid = btid->vfid.volid;
+  root_vpid.pageid = btid->root_pageid;
+  if (!VPID_EQ (&copy->root_vpid, &root_vpid)
+      || !pgbuf_is_page_version_current (copy->bcb, &root_vpid, copy->version))
+    {
+      /* No copy of this root, or the root was changed since it was copied. */
+      return NO_ERROR;
+    }
+
+  if (spage_get_record (thread_p, copy->page, HEADER, &header_record, PEEK) != S_SUCCESS)
+    {
+      assert_release (false);
+      return ER_FAILED;
+    }
+  root_header = (BTREE_ROOT_HEADER *) header_record.data;
+  /* Only non-leaf roots are copied. */
+  assert (root_header->node.node_level > 1);
+
+  if (!reuse_btid_int)
+    {
+      btid_int->sys_btid = btid;
+      error_code = btree_glean_root_header_info (thread_p, root_header, btid_int);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+    }
+
+  if (DB_VALUE_TYPE (key) == DB_TYPE_MIDXKEY && key->data.midxkey.domain == NULL)
+    {
+      /* Use domain from b-tree info. */
+      key->data.midxkey.domain = btid_int->key_type;
+    }
+
+  error_code = btree_search_nonleaf_page (thread_p, btid_int, copy->page, key, &slotid, &child_vpid, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  assert (!VPID_ISNULL (&child_vpid));
+
+  /* The child may have been deallocated after the root was copied. */
+  error_code =
+    pgbuf_fix_if_not_deallocated (thread_p, &child_vpid, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH, child_page);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  if (*child_page == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  if (!pgbuf_is_page_version_current (copy->bcb, &root_vpid, copy->version))
+    {
+      /* The root was changed while the child was fixed. */
+      pgbuf_unfix_and_init (thread_p, *child_page);
+      return NO_ERROR;
+    }
+
+  perfmon_inc_stat (thread_p, PSTAT_BT_NUM_ROOT_COPY_SEARCHES);
+  return NO_ERROR;
+}
+
+/*
+ * btree_save_root_copy () - Save a private copy of b-tree root (not leaf), for btree_fix_root_child_with_copy.
+ *
+ * return	  : Void.
+ * thread_p (in)  : Thread entry.
+ * btid (in)	  : B-tree identifier.
+ * root_page (in) : Read latched root page.
+ */
+static void
+btree_save_root_copy (THREAD_ENTRY * thread_p, BTID * btid, PAGE_PTR root_page)
+{
+  THREAD_BTREE_ROOT_COPY *copy;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+  copy = &thread_p->btree_root_copy;
+
+  if (copy->area == NULL)
+    {
+      copy->area = (char *) malloc (IO_MAX_PAGE_SIZE + MAX_ALIGNMENT);
+      if (copy->area == NULL)
+	{
+	  /* Not an error, searches just latch the root. */
+	  return;
+	}
+      copy->page = PTR_ALIGN (copy->area, MAX_ALIGNMENT);
+    }
+
+  memcpy (copy->page, root_page, DB_PAGESIZE);
+  copy->version = pgbuf_get_page_version (root_page, &copy->bcb);
+  copy->root_vpid.volid = btid->vfid.volid;
+  copy->root_vpid.pageid = btid->root_pageid;
+}
+
 /*
  * btree_get_root_with_key () - BTREE_ROOT_WITH_KEY_FUNCTION used by default to read root page header and get b-tree
  * 				data from header.
@@ -22704,6 +23095,7 @@ btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_i
 			 bool * restart, void *other_args)
 {
   BTREE_ROOT_HEADER *root_header = NULL;
+  BTREE_NODE_HEADER *node_header = NULL;
   int error_code = NO_ERROR;
 
   /* Assert expected arguments. */
@@ -22715,6 +23107,35 @@ btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_i
 
   bool reuse_btid_int = other_args ? *((bool *) other_args) : false;
 
+  /* Try to skip root first: the root is latched by each search and is the most contended page of the b-tree. */
+  error_code = btree_fix_root_child_with_copy (thread_p, btid, btid_int, reuse_btid_int, key, root_page);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+  if (*root_page != NULL)
+    {
+      /* Start from the child of root instead. */
+      node_header = btree_get_node_header (thread_p, *root_page);
+      if (node_header == NULL)
+	{
+	  assert_release (false);
+	  return ER_FAILED;
+	}
+      *is_leaf = (node_header->node_level == 1);
+      if (*is_leaf)
+	{
+	  error_code = btree_search_leaf_page (thread_p, btid_int, *root_page, key, search_key);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	}
+      return NO_ERROR;
+    }
+
   /* Get root page and BTID_INT. */
   *root_page =
     btree_fix_root_with_info (thread_p, btid, PGBUF_LATCH_READ, NULL, &root_header, (reuse_btid_int ? NULL : btid_int));
@@ -22743,6 +23164,11 @@ btree_get_root_with_key (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid_i
 	  return error_code;
 	}
     }
+  else
+    {
+      /* Next searches can route the key with a copy, until root is changed. */
+      btree_save_root_copy (thread_p, btid, *root_page);
+    }
   /* Success. */
   return NO_ERROR;
 }
@@ -23975,6 +24401,123 @@ btree_record_satisfies_snapshot (THREAD_ENTRY * thread_p, BTID_INT * btid_int, R
   return NO_ERROR;
 }
 
+/*
+ * btree_bloom_build () - Build the key filter of unique index.
+ *
+ * return	  : Void. The filter is not built if an error occurs.
+ * thread_p (in)  : Thread entry.
+ * btid (in)	  : B-tree identifier.
+ *
+ * NOTE: Caller must have a lock on class, so the index cannot be dropped.
+ *	 The filter gets the new keys as soon as the build is started, so each key is either added by its inserter or
+ *	 found in its leaf by the scan below. Leaves are scanned left to right, latching the next before unfixing the
+ *	 current; keys only move right on splits, and merges throw the build away.
+ */
+static void
+btree_bloom_build (THREAD_ENTRY * thread_p, BTID * btid)
+{
+  BTID_INT btid_int;
+  BTREE_ROOT_HEADER *root_header = NULL;
+  BTREE_NODE_HEADER *node_header = NULL;
+  PAGE_PTR page = NULL, next_page = NULL;
+  VPID vpid;
+  RECDES record;
+  LEAF_REC leaf_rec;
+  DB_VALUE key;
+  bool clear_key = false;
+  int num_oids, num_nulls, num_keys;
+  int key_cnt, slotid, offset;
+  int error_code = NO_ERROR;
+
+  btid_int.sys_btid = btid;
+  vpid.volid = btid->vfid.volid;
+  vpid.pageid = btid->root_pageid;
+  page = pgbuf_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (page == NULL)
+    {
+      ASSERT_ERROR ();
+      er_clear ();
+      btree_bloom_end_build (btid, false);
+      return;
+    }
+  root_header = btree_get_root_header (thread_p, page);
+  if (root_header == NULL || btree_glean_root_header_info (thread_p, root_header, &btid_int) != NO_ERROR)
+    {
+      pgbuf_unfix_and_init (thread_p, page);
+      er_clear ();
+      btree_bloom_end_build (btid, false);
+      return;
+    }
+  num_keys = root_header->num_keys;
+  pgbuf_unfix_and_init (thread_p, page);
+
+  if (logtb_get_global_unique_stats (thread_p, btid, &num_oids, &num_nulls, &num_keys) != NO_ERROR)
+    {
+      er_clear ();
+    }
+
+  if (!btree_bloom_start_build (btid, btid_int.key_type, num_keys))
+    {
+      return;
+    }
+
+  page = btree_find_boundary_leaf (thread_p, btid, &vpid, NULL, BTREE_BOUNDARY_FIRST);
+  if (page == NULL)
+    {
+      error_code = ER_FAILED;
+    }
+  while (page != NULL)
+    {
+      key_cnt = btree_node_number_of_keys (thread_p, page);
+      for (slotid = 1; slotid <= key_cnt; slotid++)
+	{
+	  if (spage_get_record (thread_p, page, slotid, &record, PEEK) != S_SUCCESS)
+	    {
+	      error_code = ER_FAILED;
+	      break;
+	    }
+	  if (btree_leaf_is_flaged (&record, BTREE_LEAF_RECORD_FENCE))
+	    {
+	      continue;
+	    }
+	  error_code =
+	    btree_read_record (thread_p, &btid_int, page, &record, &key, &leaf_rec, BTREE_LEAF_NODE, &clear_key,
+			       &offset, PEEK_KEY_VALUE, NULL);
+	  if (error_code != NO_ERROR)
+	    {
+	      break;
+	    }
+	  btree_bloom_add_key (btid, &key);
+	  btree_clear_key_value (&clear_key, &key);
+	}
+
+      node_header = btree_get_node_header (thread_p, page);
+      if (error_code != NO_ERROR || node_header == NULL || VPID_ISNULL (&node_header->next_vpid))
+	{
+	  error_code = (node_header == NULL) ? ER_FAILED : error_code;
+	  pgbuf_unfix_and_init (thread_p, page);
+	  break;
+	}
+
+      next_page = pgbuf_fix (thread_p, &node_header->next_vpid, OLD_PAGE, PGBUF_LATCH_READ,
+			     PGBUF_UNCONDITIONAL_LATCH);
+      pgbuf_unfix_and_init (thread_p, page);
+      if (next_page == NULL)
+	{
+	  error_code = ER_FAILED;
+	  break;
+	}
+      page = next_page;
+      next_page = NULL;
+    }
+
+  if (error_code != NO_ERROR)
+    {
+      er_clear ();
+    }
+  btree_bloom_end_build (btid, error_code == NO_ERROR);
+}
+
 /*
  * xbtree_find_unique () - Find (and sometimes lock) object in key of unique index.
  *
@@ -24091,6 +24634,13 @@ xbtree_find_unique (THREAD_ENTRY * thread_p, BTID * btid, SCAN_OPERATION_TYPE sc
       (void) logtb_get_mvcc_snapshot (thread_p);
     }
 
+  if (btree_bloom_is_key_absent (btid, key))
+    {
+      /* No version of key is in index, visible or not. */
+      perfmon_inc_stat (thread_p, PSTAT_BT_NUM_UNIQUE_FILTER_SKIPS);
+      return BTREE_KEY_NOTFOUND;
+    }
+
   /* Find unique key and object. */
   error_code =
     btree_search_key_and_apply_functions (thread_p, btid, NULL, key, NULL, NULL, advance_function, NULL, key_function,
@@ -24138,6 +24688,12 @@ xbtree_find_unique (THREAD_ENTRY * thread_p, BTID * btid, SCAN_OPERATION_TYPE sc
   /* Safe guard: no lock is kept if object was not found. */
   assert (OID_ISNULL (&find_unique_helper.locked_oid));
 #endif /* SERVER_MODE */
+
+  if (btree_bloom_count_miss (btid, key))
+    {
+      /* The index misses often enough to have a key filter. The class lock keeps the index while it is scanned. */
+      btree_bloom_build (thread_p, btid);
+    }
   return BTREE_KEY_NOTFOUND;
 }
 
@@ -24289,9 +24845,43 @@ btree_range_scan_start (THREAD_ENTRY * thread_p, BTREE_SCAN * bts)
 
   /* Start scanning */
   bts->is_scan_started = true;
+
+  if (bts->C_page != NULL && !bts->end_scan)
+    {
+      btree_range_scan_read_ahead_next_leaf (thread_p, bts);
+    }
   return NO_ERROR;
 }
 
+/*
+ * btree_range_scan_read_ahead_next_leaf () - Request the leaf after the current one in scan direction to be read
+ *					       ahead, so it is in the page buffer when the scan gets there.
+ *
+ * return	 : Void.
+ * thread_p (in) : Thread entry.
+ * bts (in)	 : B-tree scan helper.
+ */
+static void
+btree_range_scan_read_ahead_next_leaf (THREAD_ENTRY * thread_p, BTREE_SCAN * bts)
+{
+  BTREE_NODE_HEADER *node_header;
+  VPID next_vpid;
+
+  assert (bts != NULL && bts->C_page != NULL);
+
+  node_header = btree_get_node_header (thread_p, bts->C_page);
+  if (node_header == NULL)
+    {
+      return;
+    }
+
+  next_vpid = bts->use_desc_index ? node_header->prev_vpid : node_header->next_vpid;
+  if (!VPID_ISNULL (&next_vpid))
+    {
+      (void) pgbuf_read_ahead_pages (thread_p, &next_vpid, 1);
+    }
+}
+
 /*
  * btree_range_scan_resume () - Function used to resume range scans after being interrupted. It will try to resume from
  *				saved leaf node (if possible). Otherwise, current key must looked up starting from
@@ -24592,6 +25182,7 @@ btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN
 		  /* Failed to continue descending scan. Restart from root. */
 		  return NO_ERROR;
 		}
+	      btree_range_scan_read_ahead_next_leaf (thread_p, bts);
 	    }
 	  else
 	    {
@@ -24615,6 +25206,7 @@ btree_range_scan_advance_over_filtered_keys (THREAD_ENTRY * thread_p, BTREE_SCAN
 	      /* Ascending scan: start from first key in page and then advance to next page. */
 	      bts->slot_id = 1;
 	      next_vpid = node_header->next_vpid;
+	      btree_range_scan_read_ahead_next_leaf (thread_p, bts);
 	    }
 	}
 
@@ -26079,6 +26671,7 @@ btree_insert_internal (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID
   BTREE_INSERT_HELPER insert_helper;
   /* Processing key function: can insert an object or just a delete MVCCID. */
   BTREE_PROCESS_KEY_FUNCTION *key_insert_func = NULL;
+  PAGE_PTR leaf_page = NULL;	/* Leaf where data was inserted. */
 
   /* Assert expected arguments. */
   assert (btid != NULL);
@@ -26148,7 +26741,15 @@ btree_insert_internal (THREAD_ENTRY * thread_p, BTID * btid, DB_VALUE * key, OID
   error_code =
     btree_search_key_and_apply_functions (thread_p, btid, &btid_int, key, btree_fix_root_for_insert, &insert_helper,
 					  btree_split_node_and_advance, &insert_helper, key_insert_func, &insert_helper,
-					  &search_key, NULL);
+					  &search_key, &leaf_page);
+  if (leaf_page != NULL)
+    {
+      if (error_code == NO_ERROR && purpose == BTREE_OP_INSERT_NEW_OBJECT)
+	{
+	  btree_insert_save_leaf_hint (thread_p, &btid_int, leaf_page);
+	}
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+    }
 
   /* Free allocated resources. */
   if (insert_helper.printed_key != NULL)
@@ -26494,6 +27095,18 @@ btree_fix_root_for_insert (THREAD_ENTRY * thread_p, BTID * btid, BTID_INT * btid
 
   insert_helper->key_len_in_page = BTREE_GET_KEY_LEN_IN_PAGE (key_len);
 
+  if (insert_helper->purpose == BTREE_OP_INSERT_NEW_OBJECT && root_header->node.node_level > 1
+      && insert_helper->key_len_in_page <= root_header->node.max_key_len)
+    {
+      /* Maybe the key goes to the same leaf as the previous insert of this thread. */
+      error_code = btree_insert_try_leaf_hint (thread_p, btid_int, key, root_page, is_leaf, search_key, insert_helper);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto error;
+	}
+    }
+
   /* Success. */
   return NO_ERROR;
 
@@ -26507,6 +27120,176 @@ error:
   return error_code;
 }
 
+/*
+ * btree_get_insert_hint () - get the insert leaf hint of this thread for an index
+ *
+ * return	  : the hint, or NULL if there's none and create is false.
+ * thread_p (in)  : Thread entry.
+ * btid_int (in)  : B-tree info.
+ * create (in)	  : true to replace the oldest hint if there's none for the index.
+ */
+static THREAD_BTREE_INSERT_HINT *
+btree_get_insert_hint (THREAD_ENTRY * thread_p, BTID_INT * btid_int, bool create)
+{
+  THREAD_BTREE_INSERT_HINT *hint;
+  VPID root_vpid;
+  int i;
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  root_vpid.volid = btid_int->sys_btid->vfid.volid;
+  root_vpid.pageid = btid_int->sys_btid->root_pageid;
+
+  for (i = 0; i < THREAD_BTREE_INSERT_HINT_COUNT; i++)
+    {
+      if (VPID_EQ (&thread_p->btree_insert_hints[i].root_vpid, &root_vpid))
+	{
+	  return &thread_p->btree_insert_hints[i];
+	}
+    }
+
+  if (!create)
+    {
+      return NULL;
+    }
+
+  hint = &thread_p->btree_insert_hints[thread_p->btree_insert_hint_next];
+  thread_p->btree_insert_hint_next = (thread_p->btree_insert_hint_next + 1) % THREAD_BTREE_INSERT_HINT_COUNT;
+
+  hint->root_vpid = root_vpid;
+  VPID_SET_NULL (&hint->leaf_vpid);
+  LSA_SET_NULL (&hint->leaf_lsa);
+  hint->is_warm = false;
+
+  return hint;
+}
+
+/*
+ * btree_insert_try_leaf_hint () - go directly from root to the leaf of the previous insert, if the key belongs there
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * btid_int (in)       : B-tree info.
+ * key (in)	       : Inserted key.
+ * root_page (in/out)  : Root page; replaced by the leaf if the hint is used.
+ * is_leaf (out)       : Set to true if the hint is used.
+ * search_key (out)    : Key search result in leaf if the hint is used.
+ * insert_helper (in)  : B-tree insert helper.
+ *
+ * NOTE: Sorted or clustered inserts (multi-row INSERT, loaddb) put many keys in a row in the same leaf. While the leaf
+ *	 keeps the LSA of our last insert nobody changed it, so it is still the leaf of the same index and it covers
+ *	 the keys between its first and last ones. The key can then be inserted there without the descent, as long as
+ *	 the leaf needs neither a split nor a max key length update (that are done on the way down).
+ *	 The hint is tried only while warm (the previous insert went to the same leaf), so random inserts don't pay
+ *	 for it, and only if the leaf is in buffer and latched without waiting while still holding root.
+ */
+static int
+btree_insert_try_leaf_hint (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE * key, PAGE_PTR * root_page,
+			    bool * is_leaf, BTREE_SEARCH_KEY_HELPER * search_key, BTREE_INSERT_HELPER * insert_helper)
+{
+  THREAD_BTREE_INSERT_HINT *hint;
+  PAGE_PTR leaf_page;
+  BTREE_NODE_HEADER *node_header;
+  int max_new_data_size;
+  int error_code = NO_ERROR;
+
+  hint = btree_get_insert_hint (thread_p, btid_int, false);
+  if (hint == NULL || !hint->is_warm)
+    {
+      return NO_ERROR;
+    }
+  /* if it is not used now, it is missed; a descent ending in the same leaf warms it up again */
+  hint->is_warm = false;
+
+  leaf_page = pgbuf_fix (thread_p, &hint->leaf_vpid, OLD_PAGE_IF_IN_BUFFER, PGBUF_LATCH_WRITE,
+			 PGBUF_CONDITIONAL_LATCH);
+  if (leaf_page == NULL)
+    {
+      er_clear ();
+      return NO_ERROR;
+    }
+
+  if (!LSA_EQ (&hint->leaf_lsa, pgbuf_get_lsa (leaf_page)) || !BTREE_IS_PAGE_VALID_LEAF (thread_p, leaf_page))
+    {
+      goto not_used;
+    }
+
+  node_header = btree_get_node_header (thread_p, leaf_page);
+  if (node_header == NULL || insert_helper->key_len_in_page > node_header->max_key_len)
+    {
+      goto not_used;
+    }
+
+  max_new_data_size =
+    btree_get_max_new_data_size (thread_p, btid_int, leaf_page, BTREE_LEAF_NODE, node_header->max_key_len,
+				 insert_helper, false);
+  if (max_new_data_size > spage_get_free_space_without_saving (thread_p, leaf_page, NULL))
+    {
+      /* needs split */
+      goto not_used;
+    }
+
+  error_code = btree_search_leaf_page (thread_p, btid_int, leaf_page, key, search_key);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      pgbuf_unfix_and_init (thread_p, leaf_page);
+      return error_code;
+    }
+  if (search_key->result != BTREE_KEY_FOUND && search_key->result != BTREE_KEY_BETWEEN)
+    {
+      /* key may belong to a neighbour leaf */
+      search_key->result = BTREE_KEY_NOTFOUND;
+      search_key->slotid = NULL_SLOTID;
+      goto not_used;
+    }
+
+  /* Use the leaf. */
+  pgbuf_unfix_and_init (thread_p, *root_page);
+  *root_page = leaf_page;
+  *is_leaf = true;
+  insert_helper->is_root = false;
+  insert_helper->is_crt_node_write_latched = true;
+
+  perfmon_inc_stat (thread_p, PSTAT_BT_NUM_INSERT_LEAF_HINTS);
+
+  return NO_ERROR;
+
+not_used:
+  pgbuf_unfix_and_init (thread_p, leaf_page);
+  return NO_ERROR;
+}
+
+/*
+ * btree_insert_save_leaf_hint () - remember the leaf of an insert for the next insert of this thread in the index
+ *
+ * return	  : void
+ * thread_p (in)  : Thread entry.
+ * btid_int (in)  : B-tree info.
+ * leaf_page (in) : Leaf page where the object was inserted.
+ */
+static void
+btree_insert_save_leaf_hint (THREAD_ENTRY * thread_p, BTID_INT * btid_int, PAGE_PTR leaf_page)
+{
+  THREAD_BTREE_INSERT_HINT *hint;
+  VPID *leaf_vpid;
+
+  if (!BTREE_IS_PAGE_VALID_LEAF (thread_p, leaf_page))
+    {
+      return;
+    }
+
+  hint = btree_get_insert_hint (thread_p, btid_int, true);
+  leaf_vpid = pgbuf_get_vpid_ptr (leaf_page);
+
+  hint->is_warm = VPID_EQ (&hint->leaf_vpid, leaf_vpid);
+  hint->leaf_vpid = *leaf_vpid;
+  LSA_COPY (&hint->leaf_lsa, pgbuf_get_lsa (leaf_page));
+}
+
 /*
  * btree_get_max_new_data_size () - Get new data size required based on node type and operation.
  *
@@ -27497,6 +28280,12 @@ btree_key_insert_new_key (THREAD_ENTRY * thread_p, BTID_INT * btid_int, DB_VALUE
 
   FI_TEST (thread_p, FI_TEST_BTREE_MANAGER_RANDOM_EXIT, 0);
 
+  if (BTREE_IS_UNIQUE (btid_int->unique_pk))
+    {
+      /* the key filter must have the key before the key can be found in leaf */
+      btree_bloom_add_key (btid_int->sys_btid, key);
+    }
+
   /* Nothing should fail after spage_insert_at! */
   if (spage_insert_at (thread_p, leaf_page, search_key->slotid, &record) != SP_SUCCESS)
     {
@@ -32950,6 +33739,9 @@ btree_create_file (THREAD_ENTRY * thread_p, const OID * class_oid, int attrid, B
   btid->root_pageid = vpid_root.pageid;
 
   log_sysop_commit (thread_p);
+
+  /* the identifier may be the one of a dropped index */
+  btree_bloom_remove (btid);
   return NO_ERROR;
 }
 
@@ -0,0 +1,812 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * btree_bloom.c - in-memory key filters of unique indexes
+ */
+
+#ident "$Id$"
+
+#include "config.h"
+
+#include <string.h>
+#include <assert.h>
+
+#include "btree_bloom.h"
+#include "critical_section.h"
+#include "dbtype.h"
+#include "error_manager.h"
+#include "memory_alloc.h"
+#include "object_primitive.h"
+#include "porting.h"
+#include "system_parameter.h"
+
+/* at most this many indexes are followed, filtered or not */
+#define BTREE_BLOOM_MAX_FILTERS 64
+/* a block is one cache line of 512 bits; all the bits of a key are in the same block */
+#define BTREE_BLOOM_BLOCK_WORDS 8
+#define BTREE_BLOOM_BLOCK_BITS (BTREE_BLOOM_BLOCK_WORDS * 64)
+/* 12 bits and 8 probes per key make about 1% of false positives */
+#define BTREE_BLOOM_BITS_PER_KEY 12
+#define BTREE_BLOOM_NUM_PROBES 8
+/* the filter is sized for twice the keys of the index, and at least for this many */
+#define BTREE_BLOOM_MIN_KEYS 1024
+/* unique lookups that must miss the index before its filter is built */
+#define BTREE_BLOOM_BUILD_MISSES 1000
+
+#define BTREE_BLOOM_SIZE(num_blocks) ((UINT64) (num_blocks) * BTREE_BLOOM_BLOCK_WORDS * sizeof (UINT64))
+
+typedef enum
+{
+  BTREE_BLOOM_COUNTING,		/* no filter, lookups that miss are counted */
+  BTREE_BLOOM_CLAIMED,		/* a thread is about to build the filter */
+  BTREE_BLOOM_BUILDING,		/* new keys are added, the keys already in index are being scanned */
+  BTREE_BLOOM_READY,		/* the filter has all the keys */
+  BTREE_BLOOM_UNSUPPORTED	/* the keys of index cannot be filtered */
+} BTREE_BLOOM_STATE;
+
+typedef struct btree_bloom_filter BTREE_BLOOM_FILTER;
+struct btree_bloom_filter
+{
+  BTID btid;
+  BTREE_BLOOM_STATE state;	/* changed only with filters lock in write mode */
+  TP_DOMAIN *key_type;
+  volatile UINT64 *blocks;
+  UINT64 num_blocks;
+  INT64 max_keys;		/* keys the filter was sized for */
+  volatile INT64 num_keys;	/* keys added, including the ones removed from index since */
+  volatile int num_misses;
+  volatile int is_invalid;	/* a key could not be added, or keys moved while building */
+};
+
+typedef struct btree_bloom_global BTREE_BLOOM_GLOBAL;
+struct btree_bloom_global
+{
+  SYNC_RWLOCK rwlock;		/* readers use the filters, writers add, remove, allocate or free them */
+  BTREE_BLOOM_FILTER *filters[BTREE_BLOOM_MAX_FILTERS];
+  volatile int num_allocated;	/* filters having blocks, the keys of their indexes must be added */
+  volatile int num_ready;
+  UINT64 size;			/* memory used by the blocks of all filters */
+  UINT64 max_size;
+  bool is_enabled;
+};
+
+static BTREE_BLOOM_GLOBAL btree_bloom_Gl;
+
+static BTREE_BLOOM_FILTER *btree_bloom_find (const BTID * btid);
+static void btree_bloom_free_blocks (BTREE_BLOOM_FILTER * filter);
+static bool btree_bloom_is_type_supported (DB_TYPE type);
+static bool btree_bloom_is_domain_supported (TP_DOMAIN * key_type);
+static UINT64 btree_bloom_mix (UINT64 hash, UINT64 value);
+static bool btree_bloom_hash_value (DB_VALUE * value, UINT64 * hash);
+static bool btree_bloom_hash_key (TP_DOMAIN * key_type, DB_VALUE * key, UINT64 * hash);
+static bool btree_bloom_probe (const BTREE_BLOOM_FILTER * filter, UINT64 hash, bool is_set);
+
+/*
+ * btree_bloom_initialize () - initialize the key filters
+ *   return: NO_ERROR, or ER_code
+ *
+ * Note: The filters are enabled only for a not null unique_key_filter_size.
+ */
+int
+btree_bloom_initialize (void)
+{
+  int error_code;
+
+  if (btree_bloom_Gl.is_enabled)
+    {
+      return NO_ERROR;
+    }
+
+  memset (btree_bloom_Gl.filters, 0, sizeof (btree_bloom_Gl.filters));
+  btree_bloom_Gl.num_allocated = 0;
+  btree_bloom_Gl.num_ready = 0;
+  btree_bloom_Gl.size = 0;
+  btree_bloom_Gl.max_size = prm_get_bigint_value (PRM_ID_BT_UNIQUE_FILTER_SIZE);
+  if (btree_bloom_Gl.max_size == 0)
+    {
+      return NO_ERROR;
+    }
+
+  error_code = rwlock_initialize (&btree_bloom_Gl.rwlock, "BTREE_BLOOM_FILTERS");
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  btree_bloom_Gl.is_enabled = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * btree_bloom_finalize () - free all key filters
+ *   return: void
+ */
+void
+btree_bloom_finalize (void)
+{
+  int i;
+
+  if (!btree_bloom_Gl.is_enabled)
+    {
+      return;
+    }
+
+  btree_bloom_Gl.is_enabled = false;
+  for (i = 0; i < BTREE_BLOOM_MAX_FILTERS; i++)
+    {
+      if (btree_bloom_Gl.filters[i] != NULL)
+	{
+	  btree_bloom_free_blocks (btree_bloom_Gl.filters[i]);
+	  free_and_init (btree_bloom_Gl.filters[i]);
+	}
+    }
+
+  (void) rwlock_finalize (&btree_bloom_Gl.rwlock);
+}
+
+/*
+ * btree_bloom_is_enabled () - are key filters enabled?
+ *   return: true if enabled
+ */
+bool
+btree_bloom_is_enabled (void)
+{
+  return btree_bloom_Gl.is_enabled;
+}
+
+/*
+ * btree_bloom_is_key_absent () - can the filter of index prove the key is not in index?
+ *   return: true if key is surely not in index, false if it may be
+ *   btid(in): unique index identifier
+ *   key(in): key value, of the index key type
+ */
+bool
+btree_bloom_is_key_absent (const BTID * btid, DB_VALUE * key)
+{
+  BTREE_BLOOM_FILTER *filter;
+  UINT64 hash;
+  bool is_absent = false;
+
+  if (!btree_bloom_Gl.is_enabled || ATOMIC_INC_32 (&btree_bloom_Gl.num_ready, 0) == 0)
+    {
+      return false;
+    }
+
+  if (rwlock_read_lock (&btree_bloom_Gl.rwlock) != NO_ERROR)
+    {
+      er_clear ();
+      return false;
+    }
+
+  filter = btree_bloom_find (btid);
+  if (filter != NULL && filter->state == BTREE_BLOOM_READY && !ATOMIC_INC_32 (&filter->is_invalid, 0)
+      && ATOMIC_INC_64 (&filter->num_keys, 0) <= 2 * filter->max_keys)
+    {
+      if (btree_bloom_hash_key (filter->key_type, key, &hash))
+	{
+	  is_absent = !btree_bloom_probe (filter, hash, false);
+	}
+    }
+
+  (void) rwlock_read_unlock (&btree_bloom_Gl.rwlock);
+
+  return is_absent;
+}
+
+/*
+ * btree_bloom_count_miss () - count a unique lookup that did not find its key
+ *   return: true if the caller must build the filter of index
+ *   btid(in): unique index identifier
+ *   key(in): key value
+ *
+ * Note: When true is returned, the caller must call btree_bloom_start_build, and btree_bloom_end_build if the build
+ *       was started.
+ */
+bool
+btree_bloom_count_miss (const BTID * btid, DB_VALUE * key)
+{
+  BTREE_BLOOM_FILTER *filter;
+  bool is_write_needed = false;
+  bool is_build_needed = false;
+  int i, free_index = -1;
+
+  if (!btree_bloom_Gl.is_enabled || !btree_bloom_is_type_supported (DB_VALUE_DOMAIN_TYPE (key)))
+    {
+      return false;
+    }
+
+  if (rwlock_read_lock (&btree_bloom_Gl.rwlock) != NO_ERROR)
+    {
+      er_clear ();
+      return false;
+    }
+  filter = btree_bloom_find (btid);
+  if (filter == NULL)
+    {
+      is_write_needed = true;
+    }
+  else if (filter->state == BTREE_BLOOM_COUNTING)
+    {
+      is_write_needed = ATOMIC_INC_32 (&filter->num_misses, 1) >= BTREE_BLOOM_BUILD_MISSES;
+    }
+  else if (filter->state == BTREE_BLOOM_READY)
+    {
+      /* too many keys or a key not added; build it again */
+      is_write_needed = (ATOMIC_INC_32 (&filter->is_invalid, 0)
+			 || ATOMIC_INC_64 (&filter->num_keys, 0) > 2 * filter->max_keys);
+    }
+  (void) rwlock_read_unlock (&btree_bloom_Gl.rwlock);
+
+  if (!is_write_needed)
+    {
+      return false;
+    }
+
+  if (rwlock_write_lock (&btree_bloom_Gl.rwlock) != NO_ERROR)
+    {
+      er_clear ();
+      return false;
+    }
+  filter = btree_bloom_find (btid);
+  if (filter == NULL)
+    {
+      /* follow the index, in a free slot or in the one of a less missed index without filter */
+      for (i = 0; i < BTREE_BLOOM_MAX_FILTERS; i++)
+	{
+	  if (btree_bloom_Gl.filters[i] == NULL)
+	    {
+	      free_index = i;
+	      break;
+	    }
+	  if (btree_bloom_Gl.filters[i]->state == BTREE_BLOOM_COUNTING
+	      && (free_index == -1
+		  || btree_bloom_Gl.filters[i]->num_misses < btree_bloom_Gl.filters[free_index]->num_misses))
+	    {
+	      free_index = i;
+	    }
+	}
+      if (free_index != -1)
+	{
+	  filter = btree_bloom_Gl.filters[free_index];
+	  if (filter == NULL)
+	    {
+	      filter = (BTREE_BLOOM_FILTER *) malloc (sizeof (BTREE_BLOOM_FILTER));
+	    }
+	  if (filter != NULL)
+	    {
+	      memset (filter, 0, sizeof (BTREE_BLOOM_FILTER));
+	      BTID_COPY (&filter->btid, btid);
+	      filter->state = BTREE_BLOOM_COUNTING;
+	      filter->num_misses = 1;
+	      btree_bloom_Gl.filters[free_index] = filter;
+	    }
+	}
+    }
+  else if (filter->state == BTREE_BLOOM_COUNTING && filter->num_misses >= BTREE_BLOOM_BUILD_MISSES)
+    {
+      filter->state = BTREE_BLOOM_CLAIMED;
+      is_build_needed = true;
+    }
+  else if (filter->state == BTREE_BLOOM_READY
+	   && (filter->is_invalid || filter->num_keys > 2 * filter->max_keys))
+    {
+      btree_bloom_Gl.num_ready--;
+      btree_bloom_free_blocks (filter);
+      filter->state = BTREE_BLOOM_CLAIMED;
+      is_build_needed = true;
+    }
+  (void) rwlock_write_unlock (&btree_bloom_Gl.rwlock);
+
+  return is_build_needed;
+}
+
+/*
+ * btree_bloom_start_build () - allocate the filter of index; from now on, every new key of index is added
+ *   return: true if the keys of index must be scanned and btree_bloom_end_build called, false otherwise
+ *   btid(in): unique index identifier
+ *   key_type(in): key type of index
+ *   expected_keys(in): number of keys in index
+ */
+bool
+btree_bloom_start_build (const BTID * btid, TP_DOMAIN * key_type, INT64 expected_keys)
+{
+  BTREE_BLOOM_FILTER *filter;
+  BTREE_BLOOM_STATE next_state = BTREE_BLOOM_BUILDING;
+  volatile UINT64 *blocks = NULL;
+  UINT64 num_blocks = 0;
+  INT64 max_keys;
+  bool is_started = false;
+
+  max_keys = MAX (2 * expected_keys, BTREE_BLOOM_MIN_KEYS);
+  if (!btree_bloom_is_domain_supported (key_type))
+    {
+      next_state = BTREE_BLOOM_UNSUPPORTED;
+    }
+  else
+    {
+      num_blocks = CEIL_PTVDIV ((UINT64) max_keys * BTREE_BLOOM_BITS_PER_KEY, BTREE_BLOOM_BLOCK_BITS);
+      blocks = (volatile UINT64 *) calloc (num_blocks * BTREE_BLOOM_BLOCK_WORDS, sizeof (UINT64));
+      if (blocks == NULL)
+	{
+	  /* try again later */
+	  next_state = BTREE_BLOOM_COUNTING;
+	}
+    }
+
+  if (rwlock_write_lock (&btree_bloom_Gl.rwlock) != NO_ERROR)
+    {
+      er_clear ();
+      free ((void *) blocks);
+      return false;
+    }
+  filter = btree_bloom_find (btid);
+  if (filter == NULL || filter->state != BTREE_BLOOM_CLAIMED)
+    {
+      assert (false);
+    }
+  else if (next_state == BTREE_BLOOM_BUILDING
+	   && btree_bloom_Gl.size + BTREE_BLOOM_SIZE (num_blocks) > btree_bloom_Gl.max_size)
+    {
+      /* out of budget, try again later */
+      filter->state = BTREE_BLOOM_COUNTING;
+      filter->num_misses = 0;
+    }
+  else if (next_state != BTREE_BLOOM_BUILDING)
+    {
+      filter->state = next_state;
+      filter->num_misses = 0;
+    }
+  else
+    {
+      filter->key_type = key_type;
+      filter->blocks = blocks;
+      filter->num_blocks = num_blocks;
+      filter->max_keys = max_keys;
+      filter->num_keys = 0;
+      filter->is_invalid = false;
+      filter->state = BTREE_BLOOM_BUILDING;
+      btree_bloom_Gl.size += BTREE_BLOOM_SIZE (num_blocks);
+      /* the keys inserted from now on are added; the keys already in index are added by the build scan */
+      ATOMIC_INC_32 (&btree_bloom_Gl.num_allocated, 1);
+      blocks = NULL;
+      is_started = true;
+    }
+  (void) rwlock_write_unlock (&btree_bloom_Gl.rwlock);
+
+  free ((void *) blocks);
+  return is_started;
+}
+
+/*
+ * btree_bloom_end_build () - end the build of filter of index
+ *   return: void
+ *   btid(in): unique index identifier
+ *   is_success(in): true if all the keys of index were scanned and added
+ *
+ * Note: Also called, with is_success false, when the build claimed by btree_bloom_count_miss could not be started.
+ */
+void
+btree_bloom_end_build (const BTID * btid, bool is_success)
+{
+  BTREE_BLOOM_FILTER *filter;
+
+  if (rwlock_write_lock (&btree_bloom_Gl.rwlock) != NO_ERROR)
+    {
+      /* the filter stays building; it is never used and is freed with index */
+      er_clear ();
+      return;
+    }
+  filter = btree_bloom_find (btid);
+  if (filter != NULL && filter->state == BTREE_BLOOM_BUILDING)
+    {
+      if (is_success && !filter->is_invalid)
+	{
+	  filter->state = BTREE_BLOOM_READY;
+	  ATOMIC_INC_32 (&btree_bloom_Gl.num_ready, 1);
+	}
+      else
+	{
+	  /* try again later */
+	  btree_bloom_free_blocks (filter);
+	  filter->state = BTREE_BLOOM_COUNTING;
+	  filter->num_misses = 0;
+	}
+    }
+  else if (filter != NULL && filter->state == BTREE_BLOOM_CLAIMED)
+    {
+      /* the build was not started */
+      assert (!is_success);
+      filter->state = BTREE_BLOOM_COUNTING;
+      filter->num_misses = 0;
+    }
+  (void) rwlock_write_unlock (&btree_bloom_Gl.rwlock);
+}
+
+/*
+ * btree_bloom_add_key () - add a new key of index to its filter
+ *   return: void
+ *   btid(in): index identifier
+ *   key(in): key value
+ *
+ * Note: The key must be added before it is put in its leaf, while the leaf is latched.
+ */
+void
+btree_bloom_add_key (const BTID * btid, DB_VALUE * key)
+{
+  BTREE_BLOOM_FILTER *filter;
+  UINT64 hash;
+
+  if (!btree_bloom_Gl.is_enabled || ATOMIC_INC_32 (&btree_bloom_Gl.num_allocated, 0) == 0)
+    {
+      return;
+    }
+
+  if (rwlock_read_lock (&btree_bloom_Gl.rwlock) != NO_ERROR)
+    {
+      /* cannot tell whether the index has a filter */
+      assert (false);
+      er_clear ();
+      return;
+    }
+  filter = btree_bloom_find (btid);
+  if (filter != NULL && (filter->state == BTREE_BLOOM_BUILDING || filter->state == BTREE_BLOOM_READY))
+    {
+      if (btree_bloom_hash_key (filter->key_type, key, &hash))
+	{
+	  (void) btree_bloom_probe (filter, hash, true);
+	  ATOMIC_INC_64 (&filter->num_keys, 1);
+	}
+      else
+	{
+	  /* the key is missing, filter cannot be used anymore */
+	  ATOMIC_TAS_32 (&filter->is_invalid, true);
+	}
+    }
+  (void) rwlock_read_unlock (&btree_bloom_Gl.rwlock);
+}
+
+/*
+ * btree_bloom_keys_moved () - keys of index were moved to a leaf the build scan may have passed
+ *   return: void
+ *   btid(in): index identifier
+ */
+void
+btree_bloom_keys_moved (const BTID * btid)
+{
+  BTREE_BLOOM_FILTER *filter;
+
+  if (!btree_bloom_Gl.is_enabled || ATOMIC_INC_32 (&btree_bloom_Gl.num_allocated, 0) == 0)
+    {
+      return;
+    }
+
+  if (rwlock_read_lock (&btree_bloom_Gl.rwlock) != NO_ERROR)
+    {
+      assert (false);
+      er_clear ();
+      return;
+    }
+  filter = btree_bloom_find (btid);
+  if (filter != NULL && filter->state == BTREE_BLOOM_BUILDING)
+    {
+      ATOMIC_TAS_32 (&filter->is_invalid, true);
+    }
+  (void) rwlock_read_unlock (&btree_bloom_Gl.rwlock);
+}
+
+/*
+ * btree_bloom_remove () - forget the index and free its filter
+ *   return: void
+ *   btid(in): index identifier
+ *
+ * Note: Called when the index is created or destroyed, so a reused identifier does not get an old filter.
+ */
+void
+btree_bloom_remove (const BTID * btid)
+{
+  int i;
+
+  if (!btree_bloom_Gl.is_enabled)
+    {
+      return;
+    }
+
+  if (rwlock_write_lock (&btree_bloom_Gl.rwlock) != NO_ERROR)
+    {
+      assert (false);
+      er_clear ();
+      return;
+    }
+  for (i = 0; i < BTREE_BLOOM_MAX_FILTERS; i++)
+    {
+      if (btree_bloom_Gl.filters[i] != NULL && BTID_IS_EQUAL (&btree_bloom_Gl.filters[i]->btid, btid))
+	{
+	  if (btree_bloom_Gl.filters[i]->state == BTREE_BLOOM_READY)
+	    {
+	      btree_bloom_Gl.num_ready--;
+	    }
+	  btree_bloom_free_blocks (btree_bloom_Gl.filters[i]);
+	  free_and_init (btree_bloom_Gl.filters[i]);
+	  break;
+	}
+    }
+  (void) rwlock_write_unlock (&btree_bloom_Gl.rwlock);
+}
+
+/*
+ * btree_bloom_find () - find the filter of index
+ *   return: filter or NULL
+ *   btid(in): index identifier
+ *
+ * Note: The caller holds the filters lock.
+ */
+static BTREE_BLOOM_FILTER *
+btree_bloom_find (const BTID * btid)
+{
+  int i;
+
+  for (i = 0; i < BTREE_BLOOM_MAX_FILTERS; i++)
+    {
+      if (btree_bloom_Gl.filters[i] != NULL && BTID_IS_EQUAL (&btree_bloom_Gl.filters[i]->btid, btid))
+	{
+	  return btree_bloom_Gl.filters[i];
+	}
+    }
+  return NULL;
+}
+
+/*
+ * btree_bloom_free_blocks () - free the blocks of filter
+ *   return: void
+ *   filter(in): filter
+ *
+ * Note: The caller holds the filters lock in write mode.
+ */
+static void
+btree_bloom_free_blocks (BTREE_BLOOM_FILTER * filter)
+{
+  if (filter->blocks == NULL)
+    {
+      return;
+    }
+
+  free ((void *) filter->blocks);
+  filter->blocks = NULL;
+  btree_bloom_Gl.size -= BTREE_BLOOM_SIZE (filter->num_blocks);
+  filter->num_blocks = 0;
+  btree_bloom_Gl.num_allocated--;
+}
+
+/*
+ * btree_bloom_is_type_supported () - can the values of type be filtered?
+ *   return: true if the equal values of type have the same image
+ *   type(in): value type
+ */
+static bool
+btree_bloom_is_type_supported (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_SHORT:
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+    case DB_TYPE_OID:
+    case DB_TYPE_MIDXKEY:
+      return true;
+    default:
+      return false;
+    }
+}
+
+/*
+ * btree_bloom_is_domain_supported () - can the keys of index be filtered?
+ *   return: true if all key columns have supported types
+ *   key_type(in): index key type
+ */
+static bool
+btree_bloom_is_domain_supported (TP_DOMAIN * key_type)
+{
+  TP_DOMAIN *dom;
+
+  if (TP_DOMAIN_TYPE (key_type) != DB_TYPE_MIDXKEY)
+    {
+      return btree_bloom_is_type_supported (TP_DOMAIN_TYPE (key_type));
+    }
+
+  for (dom = key_type->setdomain; dom != NULL; dom = dom->next)
+    {
+      if (TP_DOMAIN_TYPE (dom) == DB_TYPE_MIDXKEY || !btree_bloom_is_type_supported (TP_DOMAIN_TYPE (dom)))
+	{
+	  return false;
+	}
+    }
+  return key_type->setdomain != NULL;
+}
+
+/*
+ * btree_bloom_mix () - mix a value into hash
+ *   return: new hash
+ *   hash(in): hash
+ *   value(in): value
+ */
+static UINT64
+btree_bloom_mix (UINT64 hash, UINT64 value)
+{
+  hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+/*
+ * btree_bloom_hash_value () - hash a single value
+ *   return: false if the value type is not supported
+ *   value(in): value, not null
+ *   hash(in/out): hash the value is mixed into
+ */
+static bool
+btree_bloom_hash_value (DB_VALUE * value, UINT64 * hash)
+{
+  UINT64 image;
+
+  switch (DB_VALUE_TYPE (value))
+    {
+    case DB_TYPE_SHORT:
+      /* the integers of all sizes hash alike */
+      image = (UINT64) (INT64) db_get_short (value);
+      break;
+    case DB_TYPE_INTEGER:
+      image = (UINT64) (INT64) db_get_int (value);
+      break;
+    case DB_TYPE_BIGINT:
+      image = (UINT64) db_get_bigint (value);
+      break;
+    case DB_TYPE_DATE:
+      image = *db_get_date (value);
+      break;
+    case DB_TYPE_TIME:
+      image = *db_get_time (value);
+      break;
+    case DB_TYPE_TIMESTAMP:
+      image = *db_get_timestamp (value);
+      break;
+    case DB_TYPE_DATETIME:
+      image = ((UINT64) db_get_datetime (value)->date << 32) | db_get_datetime (value)->time;
+      break;
+    case DB_TYPE_OID:
+      image = ((UINT64) (UINT32) db_get_oid (value)->pageid << 32);
+      image |= ((UINT64) (UINT16) db_get_oid (value)->volid << 16) | (UINT16) db_get_oid (value)->slotid;
+      break;
+    default:
+      return false;
+    }
+
+  *hash = btree_bloom_mix (*hash, image);
+  return true;
+}
+
+/*
+ * btree_bloom_hash_key () - hash a key
+ *   return: false if the key cannot be hashed as a key of index
+ *   key_type(in): index key type
+ *   key(in): key value
+ *   hash(out): key hash
+ *
+ * Note: The key must have the type of index (or its columns must), to be sure equal keys get equal hashes.
+ */
+static bool
+btree_bloom_hash_key (TP_DOMAIN * key_type, DB_VALUE * key, UINT64 * hash)
+{
+  DB_MIDXKEY *midxkey;
+  DB_VALUE elem;
+  TP_DOMAIN *dom;
+  int prev_index = 0;
+  char *prev_ptr = NULL;
+  int i;
+
+  *hash = 0;
+  if (DB_IS_NULL (key) || DB_VALUE_DOMAIN_TYPE (key) != TP_DOMAIN_TYPE (key_type))
+    {
+      return false;
+    }
+
+  if (TP_DOMAIN_TYPE (key_type) != DB_TYPE_MIDXKEY)
+    {
+      return btree_bloom_hash_value (key, hash);
+    }
+
+  midxkey = db_get_midxkey (key);
+  if (midxkey == NULL || midxkey->domain == NULL)
+    {
+      return false;
+    }
+
+  for (i = 0, dom = key_type->setdomain; dom != NULL; i++, dom = dom->next)
+    {
+      if (i >= midxkey->ncolumns
+	  || pr_midxkey_get_element_nocopy (midxkey, i, &elem, &prev_index, &prev_ptr) != NO_ERROR)
+	{
+	  er_clear ();
+	  return false;
+	}
+      if (DB_IS_NULL (&elem))
+	{
+	  *hash = btree_bloom_mix (*hash, (UINT64) i);
+	}
+      else if (DB_VALUE_DOMAIN_TYPE (&elem) != TP_DOMAIN_TYPE (dom) || !btree_bloom_hash_value (&elem, hash))
+	{
+	  return false;
+	}
+    }
+
+  return i == midxkey->ncolumns;
+}
+
+/*
+ * btree_bloom_probe () - test or set the bits of a hash
+ *   return: true if all bits were set (before setting them)
+ *   filter(in): filter having blocks
+ *   hash(in): key hash
+ *   is_set(in): true to set the bits
+ */
+static bool
+btree_bloom_probe (const BTREE_BLOOM_FILTER * filter, UINT64 hash, bool is_set)
+{
+  volatile UINT64 *block;
+  UINT64 word, mask, probe;
+  bool is_found = true;
+  int bit, i;
+
+  assert (filter->blocks != NULL && filter->num_blocks > 0);
+
+  block = filter->blocks + ((hash >> 32) % filter->num_blocks) * BTREE_BLOOM_BLOCK_WORDS;
+  probe = hash;
+  for (i = 0; i < BTREE_BLOOM_NUM_PROBES; i++)
+    {
+      /* the top 9 bits of each probe choose a bit of block */
+      probe *= 0x9e3779b97f4a7c15ULL;
+      bit = (int) (probe >> 55);
+      mask = 1ULL << (bit & 63);
+
+      word = block[bit >> 6];
+      if ((word & mask) != 0)
+	{
+	  continue;
+	}
+
+      is_found = false;
+      if (!is_set)
+	{
+	  break;
+	}
+      while ((word & mask) == 0 && !ATOMIC_CAS_64 (&block[bit >> 6], word, word | mask))
+	{
+	  word = block[bit >> 6];
+	}
+    }
+
+  return is_found;
+}
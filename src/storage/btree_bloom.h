@@ -0,0 +1,52 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * btree_bloom.h - in-memory key filters of unique indexes
+ */
+
+#ifndef _BTREE_BLOOM_H_
+#define _BTREE_BLOOM_H_
+
+#ident "$Id$"
+
+#include "dbtype_def.h"
+#include "object_domain.h"
+#include "storage_common.h"
+
+/*
+ * A key filter is a blocked Bloom filter of all the keys of a unique index, kept in memory only. It can prove a key
+ * is not in the index, which lets a unique lookup that misses skip the descent of the b-tree.
+ * The filter of an index is built, by its own lookups, once the index has missed often enough (again after each
+ * restart). It must never miss a key: every new key is added before it is put in its leaf, and a build is thrown away
+ * if keys are moved between leaves while the build scans them. Keys are never removed; when the filter has too many
+ * keys for its size, it is dropped and built again.
+ * Only the keys of integer, date/time and OID types are filtered: their equal values have equal images.
+ */
+extern int btree_bloom_initialize (void);
+extern void btree_bloom_finalize (void);
+extern bool btree_bloom_is_enabled (void);
+extern bool btree_bloom_is_key_absent (const BTID * btid, DB_VALUE * key);
+extern bool btree_bloom_count_miss (const BTID * btid, DB_VALUE * key);
+extern bool btree_bloom_start_build (const BTID * btid, TP_DOMAIN * key_type, INT64 expected_keys);
+extern void btree_bloom_end_build (const BTID * btid, bool is_success);
+extern void btree_bloom_add_key (const BTID * btid, DB_VALUE * key);
+extern void btree_bloom_keys_moved (const BTID * btid);
+extern void btree_bloom_remove (const BTID * btid);
+
+#endif /* _BTREE_BLOOM_H_ */
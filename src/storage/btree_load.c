@@ -2929,7 +2929,9 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
 {
   int i;
   bool includes_tde_class = false;
+  bool is_bulk_read = false;
   TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
+  int error_code = NO_ERROR;
 
   for (i = 0; i < sort_args->n_classes; i++)
     {
@@ -2944,9 +2946,31 @@ btree_index_sort (THREAD_ENTRY * thread_p, SORT_ARGS * sort_args, SORT_PUT_FUNC
 	}
     }
 
-  return sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0 /* TODO - support parallelism */ ,
-			&btree_sort_get_next, sort_args, out_func, out_args, compare_driver, sort_args, SORT_DUP,
-			NO_SORT_LIMIT, includes_tde_class);
+  for (i = 0; i < sort_args->n_classes; i++)
+    {
+      if (!HFID_IS_NULL (&sort_args->hfids[i]) && heap_is_bulk_read_scan (thread_p, &sort_args->hfids[i]))
+	{
+	  /* every heap page is read only once, keep them from sweeping the page buffer */
+	  is_bulk_read = true;
+	  break;
+	}
+    }
+
+  if (is_bulk_read)
+    {
+      pgbuf_start_bulk_read (thread_p);
+    }
+
+  error_code = sort_listfile (thread_p, sort_args->hfids[0].vfid.volid, 0, &btree_sort_get_next, sort_args, out_func,
+			      out_args, compare_driver, sort_args, SORT_DUP, NO_SORT_LIMIT, includes_tde_class,
+			      prm_get_integer_value (PRM_ID_IB_SORT_THREADS));
+
+  if (is_bulk_read)
+    {
+      pgbuf_end_bulk_read (thread_p);
+    }
+
+  return error_code;
 }
 
 /*
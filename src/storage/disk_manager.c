@@ -207,6 +207,11 @@ static DISK_CACHE *disk_Cache = NULL;
 
 static DKNSECTS disk_Temp_max_sects = -2;
 
+/* temporary volumes striped across temp_volume_path directories; reservations start from a different volume each
+ * time. protected by temporary purpose reserve lock. */
+static int disk_Temp_nstripes = 1;
+static int disk_Temp_stripe_next = 0;
+
 /************************************************************************/
 /* Disk allocation table section                                        */
 /************************************************************************/
@@ -429,6 +434,8 @@ STATIC_INLINE void disk_reserve_from_cache_vols (DB_VOLTYPE type, DISK_RESERVE_C
   __attribute__ ((ALWAYS_INLINE));
 static int disk_extend (THREAD_ENTRY * thread_p, DISK_EXTEND_INFO * expand_info,
 			DISK_RESERVE_CONTEXT * reserve_context);
+static int disk_extend_last_volume (THREAD_ENTRY * thread_p, DISK_EXTEND_INFO * extend_info, DKNSECTS nsect_extend,
+				    DISK_RESERVE_CONTEXT * reserve_context, DKNSECTS * nsect_extended_out);
 static int disk_volume_expand (THREAD_ENTRY * thread_p, VOLID volid, DB_VOLTYPE voltype, DKNSECTS nsect_extend,
 			       DKNSECTS * nsect_extended_out);
 static int disk_add_volume (THREAD_ENTRY * thread_p, DBDEF_VOL_EXT_INFO * extinfo, VOLID * volid_out,
@@ -477,7 +484,41 @@ STATIC_INLINE bool disk_compatible_type_and_purpose (DB_VOLTYPE type, DB_VOLPURP
 STATIC_INLINE void disk_check_own_reserve_for_purpose (DB_VOLPURPOSE purpose) __attribute__ ((ALWAYS_INLINE));
 static DISK_ISVALID disk_check_volume (THREAD_ENTRY * thread_p, INT16 volid, bool repair);
 
+#if defined (SERVER_MODE)
+/* allocation rate sampled by auto volume expansion */
+typedef struct disk_auto_expand_rate DISK_AUTO_EXPAND_RATE;
+struct disk_auto_expand_rate
+{
+  DKNSECTS nsect_used_prev;	/* used sectors at previous sample, -1 before first sample */
+  double nsect_per_sec;		/* smoothed sector allocations per second */
+};
+
+#define DISK_AUTO_EXPAND_INTERVAL_MSECS 1000
+
+static DISK_AUTO_EXPAND_RATE disk_Auto_expand_perm_rate = { -1, 0 };
+static DISK_AUTO_EXPAND_RATE disk_Auto_expand_temp_rate = { -1, 0 };
+#endif /* SERVER_MODE */
+
 // *INDENT-OFF*
+#if defined (SERVER_MODE)
+class disk_auto_volume_expansion_daemon_context_manager : public cubthread::daemon_entry_manager
+{
+  private:
+    void on_daemon_create (cubthread::entry &context) final
+    {
+      /* to log volume expansions */
+      context.claim_system_worker ();
+      context.check_interrupt = false;
+    }
+
+    void on_daemon_retire (cubthread::entry &context) final
+    {
+      context.retire_system_worker ();
+    }
+};
+
+static disk_auto_volume_expansion_daemon_context_manager *disk_Auto_volume_expansion_daemon_context_manager = NULL;
+#endif /* SERVER_MODE */
 static cubthread::daemon *disk_Auto_volume_expansion_daemon = NULL;
 
 static void disk_auto_volume_expansion_daemon_init ();
@@ -1716,51 +1757,18 @@ disk_extend (THREAD_ENTRY * thread_p, DISK_EXTEND_INFO * extend_info, DISK_RESER
   if (total < max)
     {
       /* first expand last volume to its capacity */
-      DKNSECTS to_expand;
-
-      assert (extend_info->volid_extend != NULL_VOLID);
-
-      to_expand = MIN (nsect_extend, max - total);
-
-      log_sysop_start (thread_p);
-
-      (void) logtb_set_check_interrupt (thread_p, false);
-      error_code = disk_volume_expand (thread_p, extend_info->volid_extend, voltype, to_expand, &nsect_free_new);
-      (void) logtb_set_check_interrupt (thread_p, check_interrupt);
+      error_code =
+	disk_extend_last_volume (thread_p, extend_info, MIN (nsect_extend, max - total), reserve_context,
+				 &nsect_free_new);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
-	  log_sysop_abort (thread_p);
 	  return error_code;
 	}
 
-      log_sysop_commit (thread_p);
-      assert (nsect_free_new >= to_expand);
-
-      if (extend_info->nsect_total == extend_info->nsect_max)
-	{
-	  /* this cannot be extended any longer. make sure it's not going to be used for that. */
-	  extend_info->volid_extend = NULL_VOLID;
-	}
-
-      disk_log ("disk_extend", "expanded volume %d by %d sectors for %s.", extend_info->volid_extend, nsect_free_new,
-		disk_type_to_string (extend_info->voltype));
-
       /* subtract from what we need to expand */
       nsect_extend -= nsect_free_new;
 
-      /* no one else modifies total, it is protected by expand mutex */
-      extend_info->nsect_total += nsect_free_new;
-
-      disk_cache_lock_reserve (extend_info);
-      disk_cache_update_vol_free (extend_info->volid_extend, nsect_free_new);
-
-      if (reserve_context != NULL && reserve_context->n_cache_reserve_remaining > 0)
-	{
-	  disk_reserve_from_cache_volume (extend_info->volid_extend, reserve_context);
-	}
-      disk_cache_unlock_reserve (extend_info);
-
 #if defined (SERVER_MODE)
       DISK_EXTEND_TEMP_COLLECT (nsect_free_new);
 #endif /* SERVER_MODE */
@@ -1804,6 +1812,12 @@ disk_extend (THREAD_ENTRY * thread_p, DISK_EXTEND_INFO * extend_info, DISK_RESER
       volext.nsect_total = MIN (volext.nsect_max, volext.nsect_total);
       /* and it cannot be lower than a minimum size */
       volext.nsect_total = MAX (volext.nsect_total, DISK_MIN_VOLUME_SECTS);
+      if (voltype == DB_TEMPORARY_VOLTYPE && disk_Temp_nstripes > 1)
+	{
+	  /* striped temporary volumes are never extended. each is added at full size in next directory, so the space
+	   * stays spread across all directories. temporary volumes only write their last page when formatted. */
+	  volext.nsect_total = volext.nsect_max;
+	}
       /* we always keep rounded number of sectors */
       volext.nsect_total = DISK_SECTS_ROUND_UP (volext.nsect_total);
 
@@ -1869,6 +1883,66 @@ disk_extend (THREAD_ENTRY * thread_p, DISK_EXTEND_INFO * extend_info, DISK_RESER
 #endif /* SERVER_MODE */
 }
 
+/*
+ * disk_extend_last_volume () - expand the volume used for auto extend and add its new sectors to disk cache
+ *
+ * return                   : error code
+ * thread_p (in)            : thread entry
+ * extend_info (in)         : disk extend info
+ * nsect_extend (in)        : desired extension, no larger than what the volume can still grow
+ * reserve_context (in)     : reserve context (can be NULL)
+ * nsect_extended_out (out) : extended size (rounded up desired extension)
+ */
+static int
+disk_extend_last_volume (THREAD_ENTRY * thread_p, DISK_EXTEND_INFO * extend_info, DKNSECTS nsect_extend,
+			 DISK_RESERVE_CONTEXT * reserve_context, DKNSECTS * nsect_extended_out)
+{
+  bool check_interrupt = logtb_get_check_interrupt (thread_p);
+  VOLID volid_extend = extend_info->volid_extend;
+  int error_code = NO_ERROR;
+
+  assert (disk_Cache->owner_extend == thread_get_entry_index (thread_p));
+  assert (volid_extend != NULL_VOLID);
+  assert (nsect_extend > 0 && nsect_extend <= extend_info->nsect_max - extend_info->nsect_total);
+
+  log_sysop_start (thread_p);
+
+  (void) logtb_set_check_interrupt (thread_p, false);
+  error_code = disk_volume_expand (thread_p, volid_extend, extend_info->voltype, nsect_extend, nsect_extended_out);
+  (void) logtb_set_check_interrupt (thread_p, check_interrupt);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      log_sysop_abort (thread_p);
+      return error_code;
+    }
+
+  log_sysop_commit (thread_p);
+  assert (*nsect_extended_out >= nsect_extend);
+
+  disk_log ("disk_extend_last_volume", "expanded volume %d by %d sectors for %s.", volid_extend,
+	    *nsect_extended_out, disk_type_to_string (extend_info->voltype));
+
+  /* no one else modifies total, it is protected by expand mutex */
+  extend_info->nsect_total += *nsect_extended_out;
+  if (extend_info->nsect_total >= extend_info->nsect_max)
+    {
+      /* this cannot be extended any longer. make sure it's not going to be used for that. */
+      extend_info->volid_extend = NULL_VOLID;
+    }
+
+  disk_cache_lock_reserve (extend_info);
+  disk_cache_update_vol_free (volid_extend, *nsect_extended_out);
+
+  if (reserve_context != NULL && reserve_context->n_cache_reserve_remaining > 0)
+    {
+      disk_reserve_from_cache_volume (volid_extend, reserve_context);
+    }
+  disk_cache_unlock_reserve (extend_info);
+
+  return NO_ERROR;
+}
+
 /*
  * disk_volume_expand () - expand disk space for volume
  *
@@ -2453,18 +2527,111 @@ exit:
 }
 
 #if defined (SERVER_MODE)
+/*
+ * disk_auto_expand_type () - extend last volume of given type ahead of need, based on its sector allocation rate
+ *
+ * return        : error code
+ * thread_p (in) : thread entry
+ * extend_info (in) : disk extend info of permanent or temporary volumes
+ * rate (in/out) : allocation rate sampled so far
+ * ahead_secs (in) : seconds of allocations that should find free sectors
+ */
+static int
+disk_auto_expand_type (THREAD_ENTRY * thread_p, DISK_EXTEND_INFO * extend_info, DISK_AUTO_EXPAND_RATE * rate,
+		       int ahead_secs)
+{
+  DKNSECTS nsect_used;
+  DKNSECTS nsect_ahead;
+  DKNSECTS nsect_extend;
+  DKNSECTS nsect_free_new;
+  double sample = 0;
+  int error_code = NO_ERROR;
+
+  /* sample allocation rate. freed sectors do not count, the rate only follows growth. */
+  disk_cache_lock_reserve (extend_info);
+  nsect_used = extend_info->nsect_total - extend_info->nsect_free;
+  disk_cache_unlock_reserve (extend_info);
+
+  if (rate->nsect_used_prev >= 0 && nsect_used > rate->nsect_used_prev)
+    {
+      sample = (double) (nsect_used - rate->nsect_used_prev) * 1000 / DISK_AUTO_EXPAND_INTERVAL_MSECS;
+    }
+  rate->nsect_per_sec = (rate->nsect_per_sec + sample) / 2;
+  rate->nsect_used_prev = nsect_used;
+
+  nsect_ahead = (DKNSECTS) (rate->nsect_per_sec * ahead_secs);
+
+  /* extend in steps, so a worker that still has to extend does not wait for the whole extension */
+  while (extend_info->nsect_free < nsect_ahead)
+    {
+      disk_lock_extend ();
+
+      /* adding new volumes is left to workers. if the last volume is at its maximum size, there is nothing to do. */
+      if (extend_info->volid_extend == NULL_VOLID || extend_info->nsect_total >= extend_info->nsect_max)
+	{
+	  disk_unlock_extend ();
+	  break;
+	}
+
+      nsect_extend = MIN (nsect_ahead - extend_info->nsect_free, DISK_MIN_VOLUME_SECTS);
+      nsect_extend = MIN (nsect_extend, extend_info->nsect_max - extend_info->nsect_total);
+      if (extend_info->voltype == DB_TEMPORARY_VOLTYPE)
+	{
+	  nsect_extend = MIN (nsect_extend, disk_Temp_max_sects - extend_info->nsect_total);
+	}
+      if (nsect_extend <= 0)
+	{
+	  disk_unlock_extend ();
+	  break;
+	}
+
+      disk_log ("disk_auto_expand_type", "extend %s disk by %d sectors ahead of need; allocation rate is %.1f "
+		"sectors per second.", disk_type_to_string (extend_info->voltype), nsect_extend, rate->nsect_per_sec);
+
+      error_code = disk_extend_last_volume (thread_p, extend_info, nsect_extend, NULL, &nsect_free_new);
+      disk_unlock_extend ();
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
 int
 disk_auto_expand (THREAD_ENTRY * thread_p)
 {
+  int ahead_secs = prm_get_integer_value (PRM_ID_VOLUME_PREEXTEND_SECONDS);
   int error_code = NO_ERROR;
 
-  /* todo: we cannot expand the volumes unless we have a transaction descriptor. we might allocate a special tdes for
-   *       auto-volume expansion thread, similar to how vacuum works. otherwise, it can be limited to extend last
-   *       volume only.
-   * for now, do nothing. we'll think about it later.
-   */
+  /* the expansion thread is a system worker; it only extends the last volume of each type, which does not touch
+   * boot_Db_parm. new volumes are still added by the workers that run out of space. */
+  if (ahead_secs <= 0)
+    {
+      return NO_ERROR;
+    }
 
-  return error_code;
+  error_code =
+    disk_auto_expand_type (thread_p, &disk_Cache->perm_purpose_info.extend_info, &disk_Auto_expand_perm_rate,
+			   ahead_secs);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  error_code =
+    disk_auto_expand_type (thread_p, &disk_Cache->temp_purpose_info.extend_info, &disk_Auto_expand_temp_rate,
+			   ahead_secs);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  return NO_ERROR;
 }
 #endif /* SERVER_MODE */
 
@@ -2479,7 +2646,11 @@ disk_auto_expansion_execute (cubthread::entry & thread_ref)
       return;
     }
 
-  disk_auto_expand (&thread_ref);
+  if (disk_auto_expand (&thread_ref) != NO_ERROR)
+    {
+      /* workers still extend the volumes when they need to; try again next time */
+      er_clear ();
+    }
 }
 #endif /* SERVER_MODE */
 
@@ -2490,15 +2661,14 @@ disk_auto_expansion_execute (cubthread::entry & thread_ref)
 static void
 disk_auto_volume_expansion_daemon_init ()
 {
-  // disk auto volume expansion is not yet implemented, uncomment below code when functionality will be available
-  // see disk_auto_expand (THREAD_ENTRY *) function for more details
-  /*
   assert (disk_Auto_volume_expansion_daemon == NULL);
 
-  std::chrono::seconds interval_time = std::chrono::seconds (60);
+  std::chrono::milliseconds interval_time = std::chrono::milliseconds (DISK_AUTO_EXPAND_INTERVAL_MSECS);
+  disk_Auto_volume_expansion_daemon_context_manager = new disk_auto_volume_expansion_daemon_context_manager ();
   disk_Auto_volume_expansion_daemon = cubthread::get_manager ()->create_daemon (cubthread::looper (interval_time),
-				      new cubthread::entry_callable_task (disk_auto_expansion_execute));
-  */
+				      new cubthread::entry_callable_task (disk_auto_expansion_execute),
+				      "disk_auto_volume_expansion",
+				      disk_Auto_volume_expansion_daemon_context_manager);
 }
 #endif /* SERVER_MODE */
 
@@ -2509,11 +2679,9 @@ disk_auto_volume_expansion_daemon_init ()
 static void
 disk_auto_volume_expansion_daemon_destroy ()
 {
-  // disk auto volume expansion is not yet implemented, uncomment below code when functionality will be available
-  // see disk_auto_expand (THREAD_ENTRY *) function for more details
-  /*
-    cubthread::get_manager ()->destroy_daemon (disk_Auto_volume_expansion_daemon);
-  */
+  cubthread::get_manager ()->destroy_daemon (disk_Auto_volume_expansion_daemon);
+  delete disk_Auto_volume_expansion_daemon_context_manager;
+  disk_Auto_volume_expansion_daemon_context_manager = NULL;
 }
 #endif /* SERVER_MODE */
 // *INDENT-ON*
@@ -4543,24 +4711,28 @@ STATIC_INLINE void
 disk_reserve_from_cache_vols (DB_VOLTYPE type, DISK_RESERVE_CONTEXT * context)
 {
   VOLID volid_iter;
-  VOLID start_iter, end_iter, incr;
+  int nvols;
+  int iter;
+  int offset = 0;
   DKNSECTS min_free;
 
   assert (disk_compatible_type_and_purpose (type, context->purpose));
 
   if (type == DB_PERMANENT_VOLTYPE)
     {
-      start_iter = 0;
-      end_iter = disk_Cache->nvols_perm;
-      incr = 1;
+      nvols = disk_Cache->nvols_perm;
 
       min_free = MIN (context->nsect_total, disk_Cache->perm_purpose_info.extend_info.nsect_vol_max) / 2;
     }
   else
     {
-      start_iter = LOG_MAX_DBVOLID;
-      end_iter = LOG_MAX_DBVOLID - disk_Cache->nvols_temp;
-      incr = -1;
+      nvols = disk_Cache->nvols_temp;
+      if (disk_Temp_nstripes > 1 && nvols > 1)
+	{
+	  /* stripe temporary data: start from next volume each time */
+	  offset = disk_Temp_stripe_next % nvols;
+	  disk_Temp_stripe_next = offset + 1;
+	}
 
       min_free = MIN (context->nsect_total, disk_Cache->temp_purpose_info.extend_info.nsect_vol_max) / 2;
     }
@@ -4568,8 +4740,9 @@ disk_reserve_from_cache_vols (DB_VOLTYPE type, DISK_RESERVE_CONTEXT * context)
   /* make sure we search for at least one sector */
   min_free = MAX (min_free, 1);
 
-  for (volid_iter = start_iter; volid_iter != end_iter && context->n_cache_reserve_remaining > 0; volid_iter += incr)
+  for (iter = 0; iter < nvols && context->n_cache_reserve_remaining > 0; iter++)
     {
+      volid_iter = (type == DB_PERMANENT_VOLTYPE) ? iter : LOG_MAX_DBVOLID - (offset + iter) % nvols;
       if (disk_Cache->vols[volid_iter].purpose != context->purpose)
 	{
 	  /* not the right purpose. */
@@ -4943,6 +5116,8 @@ disk_manager_init (THREAD_ENTRY * thread_p, bool load_from_disk)
     {
       disk_Temp_max_sects = disk_Temp_max_sects / DISK_SECTOR_NPAGES;
     }
+  disk_Temp_nstripes = boot_get_temp_volume_stripe_count ();
+  disk_Temp_stripe_next = 0;
 
   disk_Logging = prm_get_bool_value (PRM_ID_DISK_LOGGING);
 
@@ -25,6 +25,9 @@
 #include <assert.h>
 #include <math.h>
 
+#include <condition_variable>
+#include <mutex>
+
 #include "double_write_buffer.h"
 
 #include "system_parameter.h"
@@ -48,17 +51,20 @@
 #define DWB_MIN_BLOCKS			    1
 #define DWB_MAX_BLOCKS			    32
 
+/* Runs of 2^DWB_INSTANCE_PAGE_RUN_SHIFT consecutive pages go to the same instance. */
+#define DWB_INSTANCE_PAGE_RUN_SHIFT	    6
+
 /* The total number of blocks. */
-#define DWB_NUM_TOTAL_BLOCKS	   (dwb_Global.num_blocks)
+#define DWB_NUM_TOTAL_BLOCKS(dwb)	   ((dwb)->num_blocks)
 
 /* The total number of pages. */
-#define DWB_NUM_TOTAL_PAGES	   (dwb_Global.num_pages)
+#define DWB_NUM_TOTAL_PAGES(dwb)	   ((dwb)->num_pages)
 
 /* The number of pages in each block. */
-#define DWB_BLOCK_NUM_PAGES	   (dwb_Global.num_block_pages)
+#define DWB_BLOCK_NUM_PAGES(dwb)	   ((dwb)->num_block_pages)
 
 /* LOG2 from total number of blocks. */
-#define DWB_LOG2_BLOCK_NUM_PAGES	   (dwb_Global.log2_num_block_pages)
+#define DWB_LOG2_BLOCK_NUM_PAGES(dwb)	   ((dwb)->log2_num_block_pages)
 
 
 /* Position mask. */
@@ -93,8 +99,8 @@
   ((position_with_flags) & DWB_BLOCKS_STATUS_MASK)
 
 /* Get block number from DWB position. */
-#define DWB_GET_BLOCK_NO_FROM_POSITION(position_with_flags) \
-  ((unsigned int) DWB_GET_POSITION (position_with_flags) >> (DWB_LOG2_BLOCK_NUM_PAGES))
+#define DWB_GET_BLOCK_NO_FROM_POSITION(dwb, position_with_flags) \
+  ((unsigned int) DWB_GET_POSITION (position_with_flags) >> (DWB_LOG2_BLOCK_NUM_PAGES (dwb)))
 
 /* Checks whether writing in a DWB block was started. */
 #define DWB_IS_BLOCK_WRITE_STARTED(position_with_flags, block_no) \
@@ -142,25 +148,25 @@
   (((position_with_flags) & DWB_CREATE_OR_MODIFY_MASK) != DWB_CREATE)
 
 /* Get next DWB position with flags. */
-#define DWB_GET_NEXT_POSITION_WITH_FLAGS(position_with_flags) \
-  ((DWB_GET_POSITION (position_with_flags)) == (DWB_NUM_TOTAL_PAGES - 1) \
+#define DWB_GET_NEXT_POSITION_WITH_FLAGS(dwb, position_with_flags) \
+  ((DWB_GET_POSITION (position_with_flags)) == (DWB_NUM_TOTAL_PAGES (dwb) - 1) \
    ? ((position_with_flags) & DWB_FLAG_MASK) : ((position_with_flags) + 1))
 
 /* Get position in DWB block from DWB position with flags. */
-#define DWB_GET_POSITION_IN_BLOCK(position_with_flags) \
-  ((DWB_GET_POSITION (position_with_flags)) & (DWB_BLOCK_NUM_PAGES - 1))
+#define DWB_GET_POSITION_IN_BLOCK(dwb, position_with_flags) \
+  ((DWB_GET_POSITION (position_with_flags)) & (DWB_BLOCK_NUM_PAGES (dwb) - 1))
 
 /* Get DWB previous block number. */
-#define DWB_GET_PREV_BLOCK_NO(block_no) \
-  ((block_no) > 0 ? ((block_no) - 1) : (DWB_NUM_TOTAL_BLOCKS - 1))
+#define DWB_GET_PREV_BLOCK_NO(dwb, block_no) \
+  ((block_no) > 0 ? ((block_no) - 1) : (DWB_NUM_TOTAL_BLOCKS (dwb) - 1))
 
 /* Get DWB previous block. */
-#define DWB_GET_PREV_BLOCK(block_no) \
-  (&(dwb_Global.blocks[DWB_GET_PREV_BLOCK_NO(block_no)]))
+#define DWB_GET_PREV_BLOCK(dwb, block_no) \
+  (&((dwb)->blocks[DWB_GET_PREV_BLOCK_NO (dwb, block_no)]))
 
 /* Get DWB next block number. */
-#define DWB_GET_NEXT_BLOCK_NO(block_no) \
-  ((block_no) == (DWB_NUM_TOTAL_BLOCKS - 1) ? 0 : ((block_no) + 1))
+#define DWB_GET_NEXT_BLOCK_NO(dwb, block_no) \
+  ((block_no) == (DWB_NUM_TOTAL_BLOCKS (dwb) - 1) ? 0 : ((block_no) + 1))
 
 /* Get block version. */
 #define DWB_GET_BLOCK_VERSION(block) \
@@ -258,7 +264,7 @@ using dwb_hashmap_type = cubthread::lockfree_hashmap<VPID, dwb_slots_hash_entry>
 typedef struct double_write_buffer DOUBLE_WRITE_BUFFER;
 struct double_write_buffer
 {
-  bool logging_enabled;
+  unsigned int instance_no;	/* The instance number. */
   DWB_BLOCK *blocks;		/* The blocks in DWB. */
   unsigned int num_blocks;	/* The total number of blocks in DWB - power of 2. */
   unsigned int num_pages;	/* The total number of pages in DWB - power of 2. */
@@ -273,14 +279,19 @@ struct double_write_buffer
   UINT64 volatile position_with_flags;	/* The current position in double write buffer and flags. Flags keep the
 					 * state of each block (started, ended), create DWB status, modify DWB status.
 					 */
-  dwb_hashmap_type slots_hashmap;	/* The slots hash. */
   int vdes;			/* The volume file descriptor. */
 
   DWB_BLOCK *volatile file_sync_helper_block;	/* The block that will be sync by helper thread. */
+  char volume_name[PATH_MAX];	/* The volume name. */
 
   // *INDENT-OFF*
+#if defined (SERVER_MODE)
+  cubthread::daemon *flush_block_daemon;	/* Flushes the full blocks of the instance. */
+  cubthread::daemon *file_sync_helper_daemon;	/* Synchronizes the volumes of the flushed blocks. */
+#endif /* SERVER_MODE */
+
   double_write_buffer ()
-    : logging_enabled (false)
+    : instance_no (0)
     , blocks (NULL)
     , num_blocks (0)
     , num_pages (0)
@@ -291,21 +302,28 @@ struct double_write_buffer
     , mutex PTHREAD_MUTEX_INITIALIZER
     , wait_queue DWB_WAIT_QUEUE_INITIALIZER
     , position_with_flags (0)
-    , slots_hashmap {}
     , vdes (NULL_VOLDES)
     , file_sync_helper_block (NULL)
+#if defined (SERVER_MODE)
+    , flush_block_daemon (NULL)
+    , file_sync_helper_daemon (NULL)
+#endif /* SERVER_MODE */
   {
+    volume_name[0] = '\0';
   }
   // *INDENT-ON*
 };
 
-/* DWB volume name. */
-char dwb_Volume_name[PATH_MAX];
+/* DWB instances. Each one has its own volume, blocks and daemons; a page always goes to the same instance. */
+static DOUBLE_WRITE_BUFFER dwb_Instances[DWB_MAX_INSTANCES];
+
+/* The number of instances in use, set when DWB is created. */
+static unsigned int dwb_Num_instances = 1;
 
-/* DWB. */
-static DOUBLE_WRITE_BUFFER dwb_Global;
+/* Hash that stores the pages of all instances. */
+static dwb_hashmap_type dwb_Slots_hashmap;
 
-#define dwb_Log dwb_Global.logging_enabled
+static bool dwb_Log = false;
 
 #define dwb_check_logging() (dwb_Log = prm_get_bool_value (PRM_ID_DWB_LOGGING))
 #define dwb_log(...) if (dwb_Log) _er_log_debug (ARG_FILE_LINE, "DWB: " __VA_ARGS__)
@@ -339,8 +357,8 @@ STATIC_INLINE void dwb_destroy_wait_queue (DWB_WAIT_QUEUE * wait_queue, pthread_
 /* DWB functions */
 STATIC_INLINE void dwb_adjust_write_buffer_values (unsigned int *p_double_write_buffer_size,
 						   unsigned int *p_num_blocks) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE int dwb_wait_for_block_completion (THREAD_ENTRY * thread_p, unsigned int block_no)
-  __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int dwb_wait_for_block_completion (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb,
+						 unsigned int block_no) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int dwb_signal_waiting_thread (void *data) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int dwb_set_status_resumed (void *data) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void dwb_signal_block_completion (THREAD_ENTRY * thread_p, DWB_BLOCK * dwb_block)
@@ -350,38 +368,55 @@ STATIC_INLINE int dwb_block_create_ordered_slots (DWB_BLOCK * block, DWB_SLOT **
 static int dwb_compare_vol_fd (const void *v1, const void *v2);
 STATIC_INLINE FLUSH_VOLUME_INFO *dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
 								     int vol_fd) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE int dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_slots,
-				   unsigned int ordered_slots_length, bool file_sync_helper_can_flush,
-				   bool remove_from_hash) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE int dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_helper_can_flush,
-				   UINT64 * current_position_with_flags) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE void dwb_init_slot (DWB_SLOT * slot) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE int dwb_acquire_next_slot (THREAD_ENTRY * thread_p, bool can_wait, DWB_SLOT ** p_dwb_slot)
+STATIC_INLINE int dwb_write_block (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, DWB_BLOCK * block,
+				   DWB_SLOT * p_dwb_slots, unsigned int ordered_slots_length,
+				   bool file_sync_helper_can_flush, bool remove_from_hash)
   __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int dwb_remove_block_pages_from_hash (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
+						   DWB_SLOT * p_dwb_ordered_slots);
+#if defined (SERVER_MODE)
+static int dwb_write_and_sync_block_by_volume (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
+					       DWB_SLOT * p_dwb_ordered_slots, bool * is_done);
+#endif /* SERVER_MODE */
+STATIC_INLINE int dwb_flush_block (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, DWB_BLOCK * block,
+				   bool file_sync_helper_can_flush, UINT64 * current_position_with_flags)
+  __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void dwb_init_slot (DWB_SLOT * slot) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int dwb_acquire_next_slot (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, bool can_wait,
+					 DWB_SLOT ** p_dwb_slot) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void dwb_set_slot_data (THREAD_ENTRY * thread_p, DWB_SLOT * dwb_slot,
 				      FILEIO_PAGE * io_page_p) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE int dwb_wait_for_strucure_modification (THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE void dwb_signal_structure_modificated (THREAD_ENTRY * thread_p) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE int dwb_starts_structure_modification (THREAD_ENTRY * thread_p, UINT64 * current_position_with_flags)
+STATIC_INLINE int dwb_wait_for_strucure_modification (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb)
   __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE void dwb_ends_structure_modification (THREAD_ENTRY * thread_p, UINT64 current_position_with_flags)
+STATIC_INLINE void dwb_signal_structure_modificated (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb)
   __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE void dwb_destroy_internal (THREAD_ENTRY * thread_p, UINT64 * current_position_with_flags)
+STATIC_INLINE int dwb_starts_structure_modification (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb,
+						     UINT64 * current_position_with_flags)
   __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void dwb_ends_structure_modification (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb,
+						    UINT64 current_position_with_flags) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void dwb_destroy_internal (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb,
+					 UINT64 * current_position_with_flags) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void dwb_initialize_slot (DWB_SLOT * slot, FILEIO_PAGE * io_page,
-					unsigned int position_in_block, unsigned int block_no)
+					unsigned int position_in_block, unsigned int block_no, unsigned int instance_no)
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void dwb_initialize_block (DWB_BLOCK * block, unsigned int block_no,
 					 unsigned int count_wb_pages, char *write_buffer, DWB_SLOT * slots,
 					 FLUSH_VOLUME_INFO * flush_volumes_info, unsigned int count_flush_volumes_info,
 					 unsigned int max_to_flush_vdes) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE int dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned int num_block_pages,
-				     DWB_BLOCK ** p_blocks) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int instance_no, unsigned int num_blocks,
+				     unsigned int num_block_pages, DWB_BLOCK ** p_blocks)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void dwb_finalize_block (DWB_BLOCK * block) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE int dwb_create_internal (THREAD_ENTRY * thread_p, const char *dwb_volume_name,
+STATIC_INLINE int dwb_create_internal (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb,
 				       UINT64 * current_position_with_flags) __attribute__ ((ALWAYS_INLINE));
-STATIC_INLINE void dwb_get_next_block_for_flush (THREAD_ENTRY * thread_p, unsigned int *block_no)
-  __attribute__ ((ALWAYS_INLINE));
+static int dwb_starts_structure_modification_all (THREAD_ENTRY * thread_p, UINT64 * current_positions_with_flags);
+static void dwb_ends_structure_modification_all (THREAD_ENTRY * thread_p, UINT64 * current_positions_with_flags);
+static int dwb_create_all_internal (THREAD_ENTRY * thread_p, UINT64 * current_positions_with_flags);
+static void dwb_destroy_all_internal (THREAD_ENTRY * thread_p, UINT64 * current_positions_with_flags);
+STATIC_INLINE DOUBLE_WRITE_BUFFER *dwb_get_instance (const VPID * vpid) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void dwb_get_next_block_for_flush (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb,
+						 unsigned int *block_no) __attribute__ ((ALWAYS_INLINE));
 
 /* Slots hash functions. */
 static void *dwb_slots_hash_entry_alloc (void);
@@ -397,19 +432,22 @@ STATIC_INLINE int dwb_slots_hash_delete (THREAD_ENTRY * thread_p, DWB_SLOT * slo
 
 // *INDENT-OFF*
 #if defined (SERVER_MODE)
-static cubthread::daemon *dwb_flush_block_daemon = NULL;
-static cubthread::daemon *dwb_file_sync_helper_daemon = NULL;
+static cubthread::entry_workpool *dwb_Volume_flush_workers = NULL;
 #endif
 // *INDENT-ON*
 
-static bool dwb_is_flush_block_daemon_available (void);
-static bool dwb_is_file_sync_helper_daemon_available (void);
+static bool dwb_is_flush_block_daemon_available (DOUBLE_WRITE_BUFFER * dwb);
+static bool dwb_is_file_sync_helper_daemon_available (DOUBLE_WRITE_BUFFER * dwb);
 
-static bool dwb_flush_block_daemon_is_running (void);
-static bool dwb_file_sync_helper_daemon_is_running (void);
+static bool dwb_flush_block_daemon_is_running (DOUBLE_WRITE_BUFFER * dwb);
+static bool dwb_file_sync_helper_daemon_is_running (DOUBLE_WRITE_BUFFER * dwb);
 
-static int dwb_file_sync_helper (THREAD_ENTRY * thread_p);
-static int dwb_flush_next_block (THREAD_ENTRY * thread_p);
+static int dwb_file_sync_helper (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb);
+static int dwb_flush_next_block (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb);
+static int dwb_add_page_to_instance (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, FILEIO_PAGE * io_page_p,
+				     VPID * vpid, DWB_SLOT ** p_dwb_slot);
+static int dwb_flush_force_instance (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, bool * all_sync);
+static int dwb_load_and_recover_volume (THREAD_ENTRY * thread_p, const char *dwb_volume_name);
 
 #if !defined (NDEBUG)
 static int dwb_debug_check_dwb (THREAD_ENTRY * thread_p, DWB_SLOT * p_dwb_ordered_slots, unsigned int num_pages);
@@ -804,7 +842,8 @@ dwb_adjust_write_buffer_values (unsigned int *p_double_write_buffer_size, unsign
  *  Note: This function must be called before changing structure of DWB.
  */
 STATIC_INLINE int
-dwb_starts_structure_modification (THREAD_ENTRY * thread_p, UINT64 * current_position_with_flags)
+dwb_starts_structure_modification (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb,
+				   UINT64 * current_position_with_flags)
 {
   UINT64 local_current_position_with_flags, new_position_with_flags, min_version;
   unsigned int block_no;
@@ -816,7 +855,7 @@ dwb_starts_structure_modification (THREAD_ENTRY * thread_p, UINT64 * current_pos
 
   do
     {
-      local_current_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+      local_current_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
       if (DWB_IS_MODIFYING_STRUCTURE (local_current_position_with_flags))
 	{
 	  /* Only one thread can change the structure */
@@ -826,11 +865,11 @@ dwb_starts_structure_modification (THREAD_ENTRY * thread_p, UINT64 * current_pos
       new_position_with_flags = DWB_STARTS_MODIFYING_STRUCTURE (local_current_position_with_flags);
       /* Start structure modifications, the threads that want to flush afterwards, have to wait. */
     }
-  while (!ATOMIC_CAS_64 (&dwb_Global.position_with_flags, local_current_position_with_flags, new_position_with_flags));
+  while (!ATOMIC_CAS_64 (&dwb->position_with_flags, local_current_position_with_flags, new_position_with_flags));
 
 #if defined(SERVER_MODE)
-  while ((ATOMIC_INC_32 (&dwb_Global.blocks_flush_counter, 0) > 0)
-	 || dwb_flush_block_daemon_is_running () || dwb_file_sync_helper_daemon_is_running ())
+  while ((ATOMIC_INC_32 (&dwb->blocks_flush_counter, 0) > 0)
+	 || dwb_flush_block_daemon_is_running (dwb) || dwb_file_sync_helper_daemon_is_running (dwb))
     {
       /* Can't modify structure while flush thread can access DWB. */
       thread_sleep (20);
@@ -838,28 +877,28 @@ dwb_starts_structure_modification (THREAD_ENTRY * thread_p, UINT64 * current_pos
 #endif
 
   /* Since we set the modify structure flag, I'm the only thread that access the DWB. */
-  file_sync_helper_block = dwb_Global.file_sync_helper_block;
+  file_sync_helper_block = dwb->file_sync_helper_block;
   if (file_sync_helper_block != NULL)
     {
       /* All remaining blocks are flushed by me. */
-      (void) ATOMIC_TAS_ADDR (&dwb_Global.file_sync_helper_block, (DWB_BLOCK *) NULL);
+      (void) ATOMIC_TAS_ADDR (&dwb->file_sync_helper_block, (DWB_BLOCK *) NULL);
       dwb_log ("Structure modification, needs to flush DWB block = %d having version %lld\n",
 	       file_sync_helper_block->block_no, file_sync_helper_block->version);
     }
 
-  local_current_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  local_current_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
 
   /* Need to flush incomplete blocks, ordered by version. */
-  start_block_no = DWB_NUM_TOTAL_BLOCKS;
+  start_block_no = DWB_NUM_TOTAL_BLOCKS (dwb);
   min_version = 0xffffffffffffffff;
   blocks_count = 0;
-  for (block_no = 0; block_no < DWB_NUM_TOTAL_BLOCKS; block_no++)
+  for (block_no = 0; block_no < DWB_NUM_TOTAL_BLOCKS (dwb); block_no++)
     {
       if (DWB_IS_BLOCK_WRITE_STARTED (local_current_position_with_flags, block_no))
 	{
-	  if (dwb_Global.blocks[block_no].version < min_version)
+	  if (dwb->blocks[block_no].version < min_version)
 	    {
-	      min_version = dwb_Global.blocks[block_no].version;
+	      min_version = dwb->blocks[block_no].version;
 	      start_block_no = block_no;
 	    }
 	  blocks_count++;
@@ -873,24 +912,24 @@ dwb_starts_structure_modification (THREAD_ENTRY * thread_p, UINT64 * current_pos
 	{
 	  /* Flush all pages from current block. I must flush all remaining data. */
 	  error_code =
-	    dwb_flush_block (thread_p, &dwb_Global.blocks[block_no], false, &local_current_position_with_flags);
+	    dwb_flush_block (thread_p, dwb, &dwb->blocks[block_no], false, &local_current_position_with_flags);
 	  if (error_code != NO_ERROR)
 	    {
 	      /* Something wrong happened. */
 	      dwb_log_error ("Can't flush block = %d having version %lld\n", block_no,
-			     dwb_Global.blocks[block_no].version);
+			     dwb->blocks[block_no].version);
 
 	      return error_code;
 	    }
 
-	  dwb_log_error ("DWB flushed %d block having version %lld\n", block_no, dwb_Global.blocks[block_no].version);
+	  dwb_log_error ("DWB flushed %d block having version %lld\n", block_no, dwb->blocks[block_no].version);
 	  blocks_count--;
 	}
 
-      block_no = (block_no + 1) % DWB_NUM_TOTAL_BLOCKS;
+      block_no = (block_no + 1) % DWB_NUM_TOTAL_BLOCKS (dwb);
     }
 
-  local_current_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  local_current_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
   assert (DWB_GET_BLOCK_STATUS (local_current_position_with_flags) == 0);
 
   *current_position_with_flags = local_current_position_with_flags;
@@ -906,19 +945,19 @@ dwb_starts_structure_modification (THREAD_ENTRY * thread_p, UINT64 * current_pos
  * current_position_with_flags(in): The current position with flags.
  */
 STATIC_INLINE void
-dwb_ends_structure_modification (THREAD_ENTRY * thread_p, UINT64 current_position_with_flags)
+dwb_ends_structure_modification (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, UINT64 current_position_with_flags)
 {
   UINT64 new_position_with_flags;
 
   new_position_with_flags = DWB_ENDS_MODIFYING_STRUCTURE (current_position_with_flags);
 
   /* Ends structure modifications. */
-  assert (dwb_Global.position_with_flags == current_position_with_flags);
+  assert (dwb->position_with_flags == current_position_with_flags);
 
-  ATOMIC_TAS_64 (&dwb_Global.position_with_flags, new_position_with_flags);
+  ATOMIC_TAS_64 (&dwb->position_with_flags, new_position_with_flags);
 
   /* Signal the other threads. */
-  dwb_signal_structure_modificated (thread_p);
+  dwb_signal_structure_modificated (thread_p, dwb);
 }
 
 /*
@@ -929,9 +968,11 @@ dwb_ends_structure_modification (THREAD_ENTRY * thread_p, UINT64 current_positio
  * io_page (in) : The page.
  * position_in_block(in): The position in DWB block.
  * block_no(in): The number of the block where the slot reside.
+ * instance_no(in): The DWB instance owning the block.
  */
 STATIC_INLINE void
-dwb_initialize_slot (DWB_SLOT * slot, FILEIO_PAGE * io_page, unsigned int position_in_block, unsigned int block_no)
+dwb_initialize_slot (DWB_SLOT * slot, FILEIO_PAGE * io_page, unsigned int position_in_block, unsigned int block_no,
+		     unsigned int instance_no)
 {
   assert (slot != NULL && io_page != NULL);
 
@@ -944,6 +985,7 @@ dwb_initialize_slot (DWB_SLOT * slot, FILEIO_PAGE * io_page, unsigned int positi
 
   slot->position_in_block = position_in_block;
   slot->block_no = block_no;
+  slot->instance_no = instance_no;
 }
 
 /*
@@ -986,13 +1028,14 @@ dwb_initialize_block (DWB_BLOCK * block, unsigned int block_no, unsigned int cou
  *
  * return   : Error code.
  * thread_p (in) : The thread entry.
+ * instance_no(in): The DWB instance owning the blocks.
  * num_blocks(in): The number of blocks.
  * num_block_pages(in): The number of block pages.
  * p_blocks(out): The created blocks.
  */
 STATIC_INLINE int
-dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned int num_block_pages,
-		   DWB_BLOCK ** p_blocks)
+dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int instance_no, unsigned int num_blocks,
+		   unsigned int num_block_pages, DWB_BLOCK ** p_blocks)
 {
   DWB_BLOCK *blocks = NULL;
   char *blocks_write_buffer[DWB_MAX_BLOCKS];
@@ -1025,7 +1068,7 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
   block_buffer_size = num_block_pages * IO_PAGESIZE;
   for (i = 0; i < num_blocks; i++)
     {
-      blocks_write_buffer[i] = (char *) malloc (block_buffer_size * sizeof (char));
+      blocks_write_buffer[i] = (char *) fileio_alloc_aligned_buffer (block_buffer_size * sizeof (char));
       if (blocks_write_buffer[i] == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, block_buffer_size * sizeof (char));
@@ -1068,7 +1111,7 @@ dwb_create_blocks (THREAD_ENTRY * thread_p, unsigned int num_blocks, unsigned in
 	  io_page = (FILEIO_PAGE *) (blocks_write_buffer[i] + j * IO_PAGESIZE);
 
 	  fileio_initialize_res (thread_p, io_page, IO_PAGESIZE);
-	  dwb_initialize_slot (&slots[i][j], io_page, j, i);
+	  dwb_initialize_slot (&slots[i][j], io_page, j, i, instance_no);
 	}
 
       dwb_initialize_block (&blocks[i], i, 0, blocks_write_buffer[i], slots[i], flush_volumes_info[i], 0,
@@ -1135,17 +1178,18 @@ dwb_finalize_block (DWB_BLOCK * block)
 }
 
 /*
- * dwb_create_internal () - Create double write buffer.
+ * dwb_create_internal () - Create a double write buffer instance.
  *
  * return   : Error code.
  * thread_p (in): The thread entry.
- * dwb_volume_name (in) : The double write buffer volume name.
+ * dwb (in/out): The DWB instance, having the volume name set.
  * current_position_with_flags (in/out): Current position with flags.
  *
  *  Note: Is user responsibility to ensure that no other transaction can access DWB structure, during creation.
+ *    The buffer size given by the user is shared by all instances.
  */
 STATIC_INLINE int
-dwb_create_internal (THREAD_ENTRY * thread_p, const char *dwb_volume_name, UINT64 * current_position_with_flags)
+dwb_create_internal (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, UINT64 * current_position_with_flags)
 {
   int error_code = NO_ERROR;
   unsigned int double_write_buffer_size, num_blocks = 0;
@@ -1153,11 +1197,9 @@ dwb_create_internal (THREAD_ENTRY * thread_p, const char *dwb_volume_name, UINT6
   int vdes = NULL_VOLDES;
   DWB_BLOCK *blocks = NULL;
   UINT64 new_position_with_flags;
+  const char *dwb_volume_name = dwb->volume_name;
 
-  const int freelist_block_count = 2;
-  const int freelist_block_size = DWB_SLOTS_FREE_LIST_SIZE;
-
-  assert (dwb_volume_name != NULL && current_position_with_flags != NULL);
+  assert (current_position_with_flags != NULL);
 
   double_write_buffer_size = prm_get_integer_value (PRM_ID_DWB_SIZE);
   num_blocks = prm_get_integer_value (PRM_ID_DWB_BLOCKS);
@@ -1167,6 +1209,8 @@ dwb_create_internal (THREAD_ENTRY * thread_p, const char *dwb_volume_name, UINT6
       return NO_ERROR;
     }
 
+  double_write_buffer_size /= dwb_Num_instances;
+
   dwb_adjust_write_buffer_values (&double_write_buffer_size, &num_blocks);
 
   num_pages = double_write_buffer_size / IO_PAGESIZE;
@@ -1189,31 +1233,28 @@ dwb_create_internal (THREAD_ENTRY * thread_p, const char *dwb_volume_name, UINT6
   fileio_synchronize_all (thread_p, false);
 
   /* Create DWB blocks */
-  error_code = dwb_create_blocks (thread_p, num_blocks, num_block_pages, &blocks);
+  error_code = dwb_create_blocks (thread_p, dwb->instance_no, num_blocks, num_block_pages, &blocks);
   if (error_code != NO_ERROR)
     {
       goto exit_on_error;
     }
 
-  dwb_Global.blocks = blocks;
-  dwb_Global.num_blocks = num_blocks;
-  dwb_Global.num_pages = num_pages;
-  dwb_Global.num_block_pages = num_block_pages;
-  dwb_Global.log2_num_block_pages = (unsigned int) (log ((float) num_block_pages) / log ((float) 2));
-  dwb_Global.blocks_flush_counter = 0;
-  dwb_Global.next_block_to_flush = 0;
-  pthread_mutex_init (&dwb_Global.mutex, NULL);
-  dwb_init_wait_queue (&dwb_Global.wait_queue);
-  dwb_Global.vdes = vdes;
-  dwb_Global.file_sync_helper_block = NULL;
-
-  dwb_Global.slots_hashmap.init (dwb_slots_Ts, THREAD_TS_DWB_SLOTS, DWB_SLOTS_HASH_SIZE, freelist_block_size,
-				 freelist_block_count, slots_entry_Descriptor);
+  dwb->blocks = blocks;
+  dwb->num_blocks = num_blocks;
+  dwb->num_pages = num_pages;
+  dwb->num_block_pages = num_block_pages;
+  dwb->log2_num_block_pages = (unsigned int) (log ((float) num_block_pages) / log ((float) 2));
+  dwb->blocks_flush_counter = 0;
+  dwb->next_block_to_flush = 0;
+  pthread_mutex_init (&dwb->mutex, NULL);
+  dwb_init_wait_queue (&dwb->wait_queue);
+  dwb->vdes = vdes;
+  dwb->file_sync_helper_block = NULL;
 
   /* Set creation flag. */
   new_position_with_flags = DWB_RESET_POSITION (*current_position_with_flags);
   new_position_with_flags = DWB_STARTS_CREATION (new_position_with_flags);
-  if (!ATOMIC_CAS_64 (&dwb_Global.position_with_flags, *current_position_with_flags, new_position_with_flags))
+  if (!ATOMIC_CAS_64 (&dwb->position_with_flags, *current_position_with_flags, new_position_with_flags))
     {
       /* Impossible. */
       assert (false);
@@ -1241,6 +1282,149 @@ exit_on_error:
   return error_code;
 }
 
+/*
+ * dwb_starts_structure_modification_all () - Starts structure modifications of all DWB instances.
+ *
+ * return   : Error code
+ * thread_p (in): The thread entry.
+ * current_positions_with_flags(out): The current position with flags of each instance.
+ */
+static int
+dwb_starts_structure_modification_all (THREAD_ENTRY * thread_p, UINT64 * current_positions_with_flags)
+{
+  unsigned int i;
+  int error_code;
+
+  for (i = 0; i < DWB_MAX_INSTANCES; i++)
+    {
+      error_code = dwb_starts_structure_modification (thread_p, &dwb_Instances[i], &current_positions_with_flags[i]);
+      if (error_code != NO_ERROR)
+	{
+	  /* Release the instances already modified by me. */
+	  while (i-- > 0)
+	    {
+	      dwb_ends_structure_modification (thread_p, &dwb_Instances[i], current_positions_with_flags[i]);
+	    }
+	  return error_code;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * dwb_ends_structure_modification_all () - Ends structure modifications of all DWB instances.
+ *
+ * return   : Nothing.
+ * thread_p (in): The thread entry.
+ * current_positions_with_flags(in): The current position with flags of each instance.
+ */
+static void
+dwb_ends_structure_modification_all (THREAD_ENTRY * thread_p, UINT64 * current_positions_with_flags)
+{
+  unsigned int i;
+
+  for (i = 0; i < DWB_MAX_INSTANCES; i++)
+    {
+      dwb_ends_structure_modification (thread_p, &dwb_Instances[i], current_positions_with_flags[i]);
+    }
+}
+
+/*
+ * dwb_create_all_internal () - Create the DWB instances and the slots hash.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * current_positions_with_flags (in/out): Current position with flags of each instance.
+ *
+ *  Note: The structure of all instances must be under modification.
+ */
+static int
+dwb_create_all_internal (THREAD_ENTRY * thread_p, UINT64 * current_positions_with_flags)
+{
+  const int freelist_block_count = 2;
+  const int freelist_block_size = DWB_SLOTS_FREE_LIST_SIZE;
+  unsigned int i;
+  int error_code;
+
+  dwb_Num_instances = (unsigned int) prm_get_integer_value (PRM_ID_DWB_INSTANCES);
+  assert (dwb_Num_instances >= 1 && dwb_Num_instances <= DWB_MAX_INSTANCES);
+
+  for (i = 0; i < dwb_Num_instances; i++)
+    {
+      error_code = dwb_create_internal (thread_p, &dwb_Instances[i], &current_positions_with_flags[i]);
+      if (error_code != NO_ERROR)
+	{
+	  while (i-- > 0)
+	    {
+	      if (DWB_IS_CREATED (current_positions_with_flags[i]))
+		{
+		  dwb_destroy_internal (thread_p, &dwb_Instances[i], &current_positions_with_flags[i]);
+		}
+	    }
+	  return error_code;
+	}
+    }
+
+  if (DWB_IS_CREATED (current_positions_with_flags[0]))
+    {
+      dwb_Slots_hashmap.init (dwb_slots_Ts, THREAD_TS_DWB_SLOTS, DWB_SLOTS_HASH_SIZE, freelist_block_size,
+			      freelist_block_count, slots_entry_Descriptor);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * dwb_destroy_all_internal () - Destroy the DWB instances and the slots hash.
+ *
+ * return   : Nothing.
+ * thread_p (in): The thread entry.
+ * current_positions_with_flags (in/out): Current position with flags of each instance.
+ *
+ *  Note: The structure of all instances must be under modification.
+ */
+static void
+dwb_destroy_all_internal (THREAD_ENTRY * thread_p, UINT64 * current_positions_with_flags)
+{
+  unsigned int i;
+
+  assert (DWB_IS_CREATED (current_positions_with_flags[0]));
+
+  for (i = 0; i < DWB_MAX_INSTANCES; i++)
+    {
+      if (DWB_IS_CREATED (current_positions_with_flags[i]))
+	{
+	  dwb_destroy_internal (thread_p, &dwb_Instances[i], &current_positions_with_flags[i]);
+	}
+    }
+
+  dwb_Slots_hashmap.destroy ();
+}
+
+/*
+ * dwb_get_instance () - Get the DWB instance of a page.
+ *
+ * return   : The DWB instance.
+ * vpid (in): The page identifier.
+ *
+ *  Note: A page must always go to the same instance, so that its versions are flushed in order. Consecutive pages
+ *    are kept together to preserve the sequential writes of a block.
+ */
+STATIC_INLINE DOUBLE_WRITE_BUFFER *
+dwb_get_instance (const VPID * vpid)
+{
+  unsigned int hash;
+
+  if (dwb_Num_instances == 1 || VPID_ISNULL (vpid))
+    {
+      return &dwb_Instances[0];
+    }
+
+  hash = (unsigned int) vpid->volid * 31 + ((unsigned int) vpid->pageid >> DWB_INSTANCE_PAGE_RUN_SHIFT);
+  return &dwb_Instances[hash % dwb_Num_instances];
+}
+
 /*
  * dwb_slots_hash_entry_alloc () - Allocate a new entry in slots hash.
  *
@@ -1373,7 +1557,7 @@ dwb_slots_hash_insert (THREAD_ENTRY * thread_p, VPID * vpid, DWB_SLOT * slot, bo
 
   assert (vpid != NULL && slot != NULL && inserted != NULL);
 
-  *inserted = dwb_Global.slots_hashmap.find_or_insert (thread_p, *vpid, slots_hash_entry);
+  *inserted = dwb_Slots_hashmap.find_or_insert (thread_p, *vpid, slots_hash_entry);
 
   assert (VPID_EQ (&slots_hash_entry->vpid, &slot->vpid));
   assert (slots_hash_entry->vpid.pageid == slot->io_page->prv.pageid
@@ -1416,8 +1600,9 @@ dwb_slots_hash_insert (THREAD_ENTRY * thread_p, VPID * vpid, DWB_SLOT * slot, bo
 	      if (old_block_no > 0)
 		{
 		  /* Be sure that the block containing old page version is flushed first. */
-		  DWB_BLOCK *old_block = &dwb_Global.blocks[old_block_no];
-		  DWB_BLOCK *new_block = &dwb_Global.blocks[slot->block_no];
+		  DOUBLE_WRITE_BUFFER *dwb = &dwb_Instances[slot->instance_no];
+		  DWB_BLOCK *old_block = &dwb->blocks[old_block_no];
+		  DWB_BLOCK *new_block = &dwb->blocks[slot->block_no];
 
 		  /* Maybe we will check that the slot is still in old block. */
 		  assert ((old_block->version < new_block->version)
@@ -1449,46 +1634,45 @@ dwb_slots_hash_insert (THREAD_ENTRY * thread_p, VPID * vpid, DWB_SLOT * slot, bo
 }
 
 /*
- * dwb_destroy_internal () - Destroy DWB.
+ * dwb_destroy_internal () - Destroy a DWB instance.
  *
  * return   : Error code.
  * thread_p (in): The thread entry.
+ * dwb (in/out): The DWB instance.
  *
  *  Note: Is user responsibility to ensure that no other transaction can access DWB structure, during destroy.
  */
 STATIC_INLINE void
-dwb_destroy_internal (THREAD_ENTRY * thread_p, UINT64 * current_position_with_flags)
+dwb_destroy_internal (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, UINT64 * current_position_with_flags)
 {
   UINT64 new_position_with_flags;
   unsigned int block_no;
 
   assert (current_position_with_flags != NULL);
 
-  dwb_destroy_wait_queue (&dwb_Global.wait_queue, &dwb_Global.mutex);
-  pthread_mutex_destroy (&dwb_Global.mutex);
+  dwb_destroy_wait_queue (&dwb->wait_queue, &dwb->mutex);
+  pthread_mutex_destroy (&dwb->mutex);
 
-  if (dwb_Global.blocks != NULL)
+  if (dwb->blocks != NULL)
     {
-      for (block_no = 0; block_no < DWB_NUM_TOTAL_BLOCKS; block_no++)
+      for (block_no = 0; block_no < DWB_NUM_TOTAL_BLOCKS (dwb); block_no++)
 	{
-	  dwb_finalize_block (&dwb_Global.blocks[block_no]);
+	  dwb_finalize_block (&dwb->blocks[block_no]);
 	}
-      free_and_init (dwb_Global.blocks);
+      free_and_init (dwb->blocks);
     }
 
-  dwb_Global.slots_hashmap.destroy ();
-
-  if (dwb_Global.vdes != NULL_VOLDES)
+  if (dwb->vdes != NULL_VOLDES)
     {
-      fileio_dismount (thread_p, dwb_Global.vdes);
-      dwb_Global.vdes = NULL_VOLDES;
-      fileio_unformat (thread_p, dwb_Volume_name);
+      fileio_dismount (thread_p, dwb->vdes);
+      dwb->vdes = NULL_VOLDES;
+      fileio_unformat (thread_p, dwb->volume_name);
     }
 
   /* Set creation flag. */
   new_position_with_flags = DWB_RESET_POSITION (*current_position_with_flags);
   new_position_with_flags = DWB_ENDS_CREATION (new_position_with_flags);
-  if (!ATOMIC_CAS_64 (&dwb_Global.position_with_flags, *current_position_with_flags, new_position_with_flags))
+  if (!ATOMIC_CAS_64 (&dwb->position_with_flags, *current_position_with_flags, new_position_with_flags))
     {
       /* Impossible. */
       assert (false);
@@ -1535,7 +1719,7 @@ dwb_set_status_resumed (void *data)
  * dwb_block (in): The DWB block number.
  */
 STATIC_INLINE int
-dwb_wait_for_block_completion (THREAD_ENTRY * thread_p, unsigned int block_no)
+dwb_wait_for_block_completion (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, unsigned int block_no)
 {
 #if defined (SERVER_MODE)
   int error_code = NO_ERROR;
@@ -1548,17 +1732,17 @@ dwb_wait_for_block_completion (THREAD_ENTRY * thread_p, unsigned int block_no)
   struct timespec to;
   bool save_check_interrupt;
 
-  assert (thread_p != NULL && block_no < DWB_NUM_TOTAL_BLOCKS);
+  assert (thread_p != NULL && block_no < DWB_NUM_TOTAL_BLOCKS (dwb));
 
   PERF_UTIME_TRACKER_START (thread_p, &time_track);
 
-  dwb_block = &dwb_Global.blocks[block_no];
+  dwb_block = &dwb->blocks[block_no];
   (void) pthread_mutex_lock (&dwb_block->mutex);
 
   thread_lock_entry (thread_p);
 
   /* Check again after acquiring mutexes. */
-  current_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  current_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
   if (!DWB_IS_BLOCK_WRITE_STARTED (current_position_with_flags, block_no))
     {
       thread_unlock_entry (thread_p);
@@ -1674,10 +1858,10 @@ dwb_signal_block_completion (THREAD_ENTRY * thread_p, DWB_BLOCK * dwb_block)
  * thread_p (in): The thread entry.
  */
 STATIC_INLINE void
-dwb_signal_structure_modificated (THREAD_ENTRY * thread_p)
+dwb_signal_structure_modificated (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb)
 {
   /* There are blocked threads. Destroy the wait queue and release the blocked threads. */
-  dwb_signal_waiting_threads (&dwb_Global.wait_queue, &dwb_Global.mutex);
+  dwb_signal_waiting_threads (&dwb->wait_queue, &dwb->mutex);
 }
 
 /*
@@ -1687,7 +1871,7 @@ dwb_signal_structure_modificated (THREAD_ENTRY * thread_p)
  * thread_p (in): The thread entry.
  */
 STATIC_INLINE int
-dwb_wait_for_strucure_modification (THREAD_ENTRY * thread_p)
+dwb_wait_for_strucure_modification (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb)
 {
 #if defined (SERVER_MODE)
   int error_code = NO_ERROR;
@@ -1698,30 +1882,30 @@ dwb_wait_for_strucure_modification (THREAD_ENTRY * thread_p)
   struct timespec to;
   bool save_check_interrupt;
 
-  (void) pthread_mutex_lock (&dwb_Global.mutex);
+  (void) pthread_mutex_lock (&dwb->mutex);
 
   /* Check the actual flags, to avoids unnecessary waits. */
-  current_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  current_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
   if (!DWB_IS_MODIFYING_STRUCTURE (current_position_with_flags))
     {
-      pthread_mutex_unlock (&dwb_Global.mutex);
+      pthread_mutex_unlock (&dwb->mutex);
       return NO_ERROR;
     }
 
   thread_lock_entry (thread_p);
 
-  double_write_queue_entry = dwb_block_add_wait_queue_entry (&dwb_Global.wait_queue, thread_p);
+  double_write_queue_entry = dwb_block_add_wait_queue_entry (&dwb->wait_queue, thread_p);
   if (double_write_queue_entry == NULL)
     {
       /* allocation error */
       thread_unlock_entry (thread_p);
-      pthread_mutex_unlock (&dwb_Global.mutex);
+      pthread_mutex_unlock (&dwb->mutex);
 
       ASSERT_ERROR_AND_SET (error_code);
       return error_code;
     }
 
-  pthread_mutex_unlock (&dwb_Global.mutex);
+  pthread_mutex_unlock (&dwb->mutex);
 
   save_check_interrupt = logtb_set_check_interrupt (thread_p, false);
   /* Waits for maximum 10 milliseconds. */
@@ -1735,7 +1919,7 @@ dwb_wait_for_strucure_modification (THREAD_ENTRY * thread_p)
   if (r == ER_CSS_PTHREAD_COND_TIMEDOUT)
     {
       /* timeout, remove the entry from queue */
-      dwb_remove_wait_queue_entry (&dwb_Global.wait_queue, &dwb_Global.mutex, thread_p, NULL);
+      dwb_remove_wait_queue_entry (&dwb->wait_queue, &dwb->mutex, thread_p, NULL);
       return r;
     }
   else if (thread_p->resume_status != THREAD_DWB_QUEUE_RESUMED)
@@ -1743,7 +1927,7 @@ dwb_wait_for_strucure_modification (THREAD_ENTRY * thread_p)
       /* interruption, remove the entry from queue */
       assert (thread_p->resume_status == THREAD_RESUME_DUE_TO_SHUTDOWN);
 
-      dwb_remove_wait_queue_entry (&dwb_Global.wait_queue, &dwb_Global.mutex, thread_p, NULL);
+      dwb_remove_wait_queue_entry (&dwb->wait_queue, &dwb->mutex, thread_p, NULL);
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
       return ER_INTERRUPTED;
     }
@@ -1880,7 +2064,7 @@ dwb_slots_hash_delete (THREAD_ENTRY * thread_p, DWB_SLOT * slot)
     }
 
   /* Remove the old vpid from hash. */
-  slots_hash_entry = dwb_Global.slots_hashmap.find (thread_p, *vpid);
+  slots_hash_entry = dwb_Slots_hashmap.find (thread_p, *vpid);
   if (slots_hash_entry == NULL)
     {
       /* Already removed from hash by others, nothing to do. */
@@ -1896,7 +2080,7 @@ dwb_slots_hash_delete (THREAD_ENTRY * thread_p, DWB_SLOT * slot)
       assert (slots_hash_entry->slot->io_page->prv.pageid == vpid->pageid
 	      && slots_hash_entry->slot->io_page->prv.volid == vpid->volid);
 
-      if (!dwb_Global.slots_hashmap.erase_locked (thread_p, *vpid, slots_hash_entry))
+      if (!dwb_Slots_hashmap.erase_locked (thread_p, *vpid, slots_hash_entry))
 	{
 	  assert_release (false);
 	  /* Should not happen. */
@@ -1974,6 +2158,81 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
   return flush_new_volume_info;
 }
 
+/*
+ * dwb_write_block_pages_batch () - Write all block pages with one batched request.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * block(in): The block that is written.
+ * p_dwb_ordered_slots(in): The slots that gives the pages flush order.
+ * is_written(out): True, if the pages were written.
+ *
+ *  Note: The slots are ordered by VPID, so adjacent pages of a volume are merged into vectored writes, or are
+ *        submitted together to io_uring when it is enabled. The caller does the flush bookkeeping afterwards.
+ */
+STATIC_INLINE int
+dwb_write_block_pages_batch (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
+			     bool * is_written)
+{
+  FILEIO_PAGE_REQUEST *requests;
+  VOLID last_volid = NULL_VOLID;
+  int vol_fd = NULL_VOLDES;
+  unsigned int i;
+  int count = 0;
+  VPID *vpid;
+  int error_code;
+
+  *is_written = false;
+
+  requests = (FILEIO_PAGE_REQUEST *) malloc (block->count_wb_pages * sizeof (FILEIO_PAGE_REQUEST));
+  if (requests == NULL)
+    {
+      /* not fatal, the pages are written one by one */
+      return NO_ERROR;
+    }
+
+  for (i = 0; i < block->count_wb_pages; i++)
+    {
+      vpid = &p_dwb_ordered_slots[i].vpid;
+      if (VPID_ISNULL (vpid))
+	{
+	  continue;
+	}
+
+      if (last_volid != vpid->volid)
+	{
+	  last_volid = vpid->volid;
+	  vol_fd = fileio_get_volume_descriptor (vpid->volid);
+	}
+      if (vol_fd == NULL_VOLDES)
+	{
+	  /* probably it was removed meanwhile. skip it! */
+	  continue;
+	}
+
+      requests[count].vol_fd = vol_fd;
+      requests[count].io_page_p = p_dwb_ordered_slots[i].io_page;
+      requests[count].page_id = vpid->pageid;
+      requests[count].page_size = IO_PAGESIZE;
+      requests[count].error = 0;
+      count++;
+    }
+
+  error_code = fileio_write_page_batch (thread_p, requests, count, FILEIO_WRITE_NO_COMPENSATE_WRITE);
+  free (requests);
+
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      dwb_log_error ("DWB batch write of %d pages failed with %d error\n", count, error_code);
+      assert (false);
+      return error_code;
+    }
+
+  *is_written = true;
+  return NO_ERROR;
+}
+
 /*
  * dwb_write_block () - Write block pages in specified order.
  *
@@ -1988,7 +2247,7 @@ dwb_add_volume_to_block_flush_area (THREAD_ENTRY * thread_p, DWB_BLOCK * block,
  *  Note: This function fills to_flush_vdes array with the volumes that must be flushed.
  */
 STATIC_INLINE int
-dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
+dwb_write_block (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
 		 unsigned int ordered_slots_length, bool file_sync_helper_can_flush, bool remove_from_hash)
 {
   VOLID last_written_volid;
@@ -1999,6 +2258,7 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   int count_writes = 0, num_pages_to_sync;
   FLUSH_VOLUME_INFO *current_flush_volume_info = NULL;
   bool can_flush_volume = false;
+  bool is_batch_written = false;
 
   assert (block != NULL && p_dwb_ordered_slots != NULL);
 
@@ -2013,6 +2273,13 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 
   num_pages_to_sync = prm_get_integer_value (PRM_ID_PB_SYNC_ON_NFLUSH);
 
+  error_code = dwb_write_block_pages_batch (thread_p, block, p_dwb_ordered_slots, &is_batch_written);
+  if (error_code != NO_ERROR)
+    {
+      /* Something wrong happened. */
+      return ER_FAILED;
+    }
+
   last_written_volid = NULL_VOLID;
   last_written_vol_fd = NULL_VOLDES;
 
@@ -2057,8 +2324,9 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
       assert (p_dwb_ordered_slots[i].vpid.pageid == p_dwb_ordered_slots[i].io_page->prv.pageid
 	      && p_dwb_ordered_slots[i].vpid.volid == p_dwb_ordered_slots[i].io_page->prv.volid);
 
-      /* Write the data. */
-      if (fileio_write (thread_p, last_written_vol_fd, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
+      /* Write the data, unless it was already written in batch. */
+      if (!is_batch_written
+	  && fileio_write (thread_p, last_written_vol_fd, p_dwb_ordered_slots[i].io_page, vpid->pageid, IO_PAGESIZE,
 			FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
 	{
 	  ASSERT_ERROR ();
@@ -2081,11 +2349,11 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
       count_writes++;
 
       if (file_sync_helper_can_flush && (count_writes >= num_pages_to_sync || can_flush_volume == true)
-	  && dwb_is_file_sync_helper_daemon_available ())
+	  && dwb_is_file_sync_helper_daemon_available (dwb))
 	{
-	  if (ATOMIC_CAS_ADDR (&dwb_Global.file_sync_helper_block, (DWB_BLOCK *) NULL, block))
+	  if (ATOMIC_CAS_ADDR (&dwb->file_sync_helper_block, (DWB_BLOCK *) NULL, block))
 	    {
-	      dwb_file_sync_helper_daemon->wakeup ();
+	      dwb->file_sync_helper_daemon->wakeup ();
 	    }
 
 	  /* Add statistics. */
@@ -2111,14 +2379,14 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
 #endif
 
 #if defined (SERVER_MODE)
-  if (file_sync_helper_can_flush && (dwb_Global.file_sync_helper_block == NULL)
+  if (file_sync_helper_can_flush && (dwb->file_sync_helper_block == NULL)
       && (block->count_flush_volumes_info > 0))
     {
       /* If file_sync_helper_block is NULL, it means that the file sync helper thread does not run and was not woken yet. */
-      if (dwb_is_file_sync_helper_daemon_available ()
-	  && ATOMIC_CAS_ADDR (&dwb_Global.file_sync_helper_block, (DWB_BLOCK *) NULL, block))
+      if (dwb_is_file_sync_helper_daemon_available (dwb)
+	  && ATOMIC_CAS_ADDR (&dwb->file_sync_helper_block, (DWB_BLOCK *) NULL, block))
 	{
-	  dwb_file_sync_helper_daemon->wakeup ();
+	  dwb->file_sync_helper_daemon->wakeup ();
 	}
     }
 #endif
@@ -2129,31 +2397,270 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
   /* Remove the corresponding entries from hash. */
   if (remove_from_hash)
     {
-      PERF_UTIME_TRACKER time_track;
+      return dwb_remove_block_pages_from_hash (thread_p, block, p_dwb_ordered_slots);
+    }
 
-      PERF_UTIME_TRACKER_START (thread_p, &time_track);
+  return NO_ERROR;
+}
 
-      for (i = 0; i < block->count_wb_pages; i++)
+/*
+ * dwb_remove_block_pages_from_hash () - Remove the written pages of a block from slots hash.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * block(in): The block that was written.
+ * p_dwb_ordered_slots(in): The ordered slots of the block.
+ */
+STATIC_INLINE int
+dwb_remove_block_pages_from_hash (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots)
+{
+  PERF_UTIME_TRACKER time_track;
+  unsigned int i;
+  int error_code;
+
+  PERF_UTIME_TRACKER_START (thread_p, &time_track);
+
+  for (i = 0; i < block->count_wb_pages; i++)
+    {
+      if (VPID_ISNULL (&p_dwb_ordered_slots[i].vpid))
+	{
+	  continue;
+	}
+
+      assert (p_dwb_ordered_slots[i].position_in_block < block->count_wb_pages);
+      error_code = dwb_slots_hash_delete (thread_p, &block->slots[p_dwb_ordered_slots[i].position_in_block]);
+      if (error_code != NO_ERROR)
 	{
-	  vpid = &p_dwb_ordered_slots[i].vpid;
-	  if (VPID_ISNULL (vpid))
+	  return error_code;
+	}
+    }
+
+  PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_DWB_DECACHE_PAGES_AFTER_WRITE);
+
+  return NO_ERROR;
+}
+
+#if defined (SERVER_MODE)
+/* The pages of one volume of a block, written and synchronized by a volume flush worker. */
+typedef struct dwb_volume_flush_group DWB_VOLUME_FLUSH_GROUP;
+struct dwb_volume_flush_group
+{
+  FLUSH_VOLUME_INFO *volume_info;	/* The volume flush information of the block. */
+  FILEIO_PAGE_REQUEST *requests;	/* The pages of the volume, ordered by page identifier. */
+  int count_requests;		/* The number of pages. */
+  int error_code;		/* The write or sync result. */
+};
+
+// *INDENT-OFF*
+/* Lets the block flush thread wait for all volume groups of a block. */
+struct dwb_volume_flush_waiter
+{
+  std::mutex mutex;
+  std::condition_variable cond;
+  int count_pending;
+};
+// *INDENT-ON*
+
+/*
+ * dwb_write_and_sync_volume () - Write and synchronize the pages of one volume of a block.
+ *
+ * return   : void
+ * thread_ref (in): The thread entry.
+ * group(in/out): The volume pages; the result is saved in group.
+ * waiter(in): Notified when the volume is done.
+ */
+static void
+dwb_write_and_sync_volume (cubthread::entry & thread_ref, DWB_VOLUME_FLUSH_GROUP * group,
+			   dwb_volume_flush_waiter * waiter)
+{
+  int vdes = group->volume_info->vdes;
+
+  group->error_code =
+    fileio_write_page_batch (&thread_ref, group->requests, group->count_requests, FILEIO_WRITE_NO_COMPENSATE_WRITE);
+  if (group->error_code == NO_ERROR && fileio_synchronize (&thread_ref, vdes, NULL, FILEIO_SYNC_ONLY) != vdes)
+    {
+      group->error_code = ER_FAILED;
+    }
+  dwb_log ("dwb_write_and_sync_volume: %d pages written and synchronized on volume %d with result %d\n",
+	   group->count_requests, vdes, group->error_code);
+
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (waiter->mutex);
+  // *INDENT-ON*
+  if (--waiter->count_pending == 0)
+    {
+      waiter->cond.notify_one ();
+    }
+}
+
+/*
+ * dwb_write_and_sync_block_by_volume () - Write block pages and synchronize the volumes in parallel, one volume per
+ *					   worker.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * block(in): The block that is written.
+ * p_dwb_ordered_slots(in): The slots that gives the pages flush order.
+ * is_done(out): True, if the block was written and all its volumes synchronized. False if the block has a single
+ *		 volume or the workers are not available; the caller writes it the usual way.
+ *
+ *  Note: The slots are ordered by VPID, so the pages of a volume are consecutive. Each volume group is written and
+ *	  synchronized by its own worker and the block is complete when all groups are done. The file sync helper is
+ *	  not involved, every volume is synchronized before returning.
+ */
+static int
+dwb_write_and_sync_block_by_volume (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_ordered_slots,
+				    bool * is_done)
+{
+  DWB_VOLUME_FLUSH_GROUP *groups = NULL;
+  FILEIO_PAGE_REQUEST *requests = NULL;
+  DWB_VOLUME_FLUSH_GROUP *group = NULL;
+  VOLID last_volid = NULL_VOLID;
+  int vol_fd = NULL_VOLDES;
+  int count_groups = 0, count_requests = 0;
+  unsigned int i;
+  int g, error_code = NO_ERROR;
+  VPID *vpid;
+  // *INDENT-OFF*
+  dwb_volume_flush_waiter waiter;
+  // *INDENT-ON*
+
+  *is_done = false;
+
+  if (dwb_Volume_flush_workers == NULL)
+    {
+      return NO_ERROR;
+    }
+
+  /* Count the volumes first, a single volume gains nothing. */
+  for (i = 0; i < block->count_wb_pages; i++)
+    {
+      vpid = &p_dwb_ordered_slots[i].vpid;
+      if (!VPID_ISNULL (vpid) && vpid->volid != last_volid)
+	{
+	  last_volid = vpid->volid;
+	  count_groups++;
+	}
+    }
+  if (count_groups <= 1)
+    {
+      return NO_ERROR;
+    }
+
+  groups = (DWB_VOLUME_FLUSH_GROUP *) malloc (count_groups * sizeof (DWB_VOLUME_FLUSH_GROUP));
+  requests = (FILEIO_PAGE_REQUEST *) malloc (block->count_wb_pages * sizeof (FILEIO_PAGE_REQUEST));
+  if (groups == NULL || requests == NULL)
+    {
+      /* not fatal, the block is written serially */
+      goto end;
+    }
+
+  count_groups = 0;
+  last_volid = NULL_VOLID;
+  for (i = 0; i < block->count_wb_pages; i++)
+    {
+      vpid = &p_dwb_ordered_slots[i].vpid;
+      if (VPID_ISNULL (vpid))
+	{
+	  continue;
+	}
+
+      if (vpid->volid != last_volid)
+	{
+	  last_volid = vpid->volid;
+	  group = NULL;
+
+	  vol_fd = fileio_get_volume_descriptor (vpid->volid);
+	  if (vol_fd == NULL_VOLDES)
 	    {
+	      /* probably it was removed meanwhile. skip it! */
 	      continue;
 	    }
 
-	  assert (p_dwb_ordered_slots[i].position_in_block < DWB_BLOCK_NUM_PAGES);
-	  error_code = dwb_slots_hash_delete (thread_p, &block->slots[p_dwb_ordered_slots[i].position_in_block]);
-	  if (error_code != NO_ERROR)
-	    {
-	      return error_code;
-	    }
+	  group = &groups[count_groups++];
+	  group->volume_info = dwb_add_volume_to_block_flush_area (thread_p, block, vol_fd);
+	  /* The worker synchronizes the volume, the file sync helper must not. */
+	  group->volume_info->flushed_status = VOLUME_FLUSHED_BY_DWB_FLUSH_THREAD;
+	  group->requests = &requests[count_requests];
+	  group->count_requests = 0;
+	  group->error_code = NO_ERROR;
 	}
 
-      PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_DWB_DECACHE_PAGES_AFTER_WRITE);
+      if (group == NULL)
+	{
+	  continue;
+	}
+
+      assert (p_dwb_ordered_slots[i].io_page->prv.p_reserve_2 == 0);
+      assert (vpid->pageid == p_dwb_ordered_slots[i].io_page->prv.pageid
+	      && vpid->volid == p_dwb_ordered_slots[i].io_page->prv.volid);
+
+      requests[count_requests].vol_fd = vol_fd;
+      requests[count_requests].io_page_p = p_dwb_ordered_slots[i].io_page;
+      requests[count_requests].page_id = vpid->pageid;
+      requests[count_requests].page_size = IO_PAGESIZE;
+      requests[count_requests].error = 0;
+      count_requests++;
+      group->count_requests++;
     }
 
-  return NO_ERROR;
+  waiter.count_pending = count_groups;
+  for (g = 0; g < count_groups; g++)
+    {
+      // *INDENT-OFF*
+      cubthread::entry_callable_task *task =
+        new cubthread::entry_callable_task (std::bind (dwb_write_and_sync_volume, std::placeholders::_1, &groups[g],
+                                                       &waiter));
+      // *INDENT-ON*
+      thread_get_manager ()->push_task (dwb_Volume_flush_workers, task);
+    }
+
+  {
+    // *INDENT-OFF*
+    std::unique_lock<std::mutex> ulock (waiter.mutex);
+    waiter.cond.wait (ulock, [&waiter] { return waiter.count_pending == 0; });
+    // *INDENT-ON*
+  }
+
+  for (g = 0; g < count_groups; g++)
+    {
+      groups[g].volume_info->num_pages = 0;
+      groups[g].volume_info->all_pages_written = true;
+      if (groups[g].error_code != NO_ERROR)
+	{
+	  dwb_log_error ("DWB write and sync of volume %d failed with %d error\n", groups[g].volume_info->vdes,
+			 groups[g].error_code);
+	  error_code = ER_FAILED;
+	}
+    }
+  if (error_code != NO_ERROR)
+    {
+      assert (false);
+      goto end;
+    }
+
+  perfmon_add_stat (thread_p, PSTAT_PB_NUM_IOWRITES, count_requests);
+
+  error_code = dwb_remove_block_pages_from_hash (thread_p, block, p_dwb_ordered_slots);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  *is_done = true;
+
+end:
+  if (groups != NULL)
+    {
+      free_and_init (groups);
+    }
+  if (requests != NULL)
+    {
+      free_and_init (requests);
+    }
+  return error_code;
 }
+#endif /* SERVER_MODE */
 
 /*
  * dwb_flush_block () - Flush pages from specified block.
@@ -2167,7 +2674,7 @@ dwb_write_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, DWB_SLOT * p_dwb_or
  *  Note: The block pages can't be modified by others during flush.
  */
 STATIC_INLINE int
-dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_helper_can_flush,
+dwb_flush_block (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, DWB_BLOCK * block, bool file_sync_helper_can_flush,
 		 UINT64 * current_position_with_flags)
 {
   UINT64 local_current_position_with_flags, new_position_with_flags;
@@ -2180,6 +2687,7 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
   int max_pages_to_sync;
 #if defined (SERVER_MODE)
   bool flush = false;
+  bool written_by_volume = false;
   PERF_UTIME_TRACKER time_track_file_sync_helper;
 #endif
 #if !defined (NDEBUG)
@@ -2192,8 +2700,8 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
   PERF_UTIME_TRACKER_START (thread_p, &time_track);
 
   /* Currently we allow only one block to be flushed. */
-  ATOMIC_INC_32 (&dwb_Global.blocks_flush_counter, 1);
-  assert (dwb_Global.blocks_flush_counter <= 1);
+  ATOMIC_INC_32 (&dwb->blocks_flush_counter, 1);
+  assert (dwb->blocks_flush_counter <= 1);
 
   /* Order slots by VPID, to flush faster. */
   error_code = dwb_block_create_ordered_slots (block, &p_dwb_ordered_slots, &ordered_slots_length);
@@ -2222,7 +2730,7 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
 
 	  VPID_SET_NULL (&s1->vpid);
 
-	  assert (s1->position_in_block < DWB_BLOCK_NUM_PAGES);
+	  assert (s1->position_in_block < DWB_BLOCK_NUM_PAGES (dwb));
 	  VPID_SET_NULL (&(block->slots[s1->position_in_block].vpid));
 
 	  fileio_initialize_res (thread_p, s1->io_page, IO_PAGESIZE);
@@ -2242,18 +2750,18 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
   PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_DWB_FLUSH_BLOCK_SORT_TIME_COUNTERS);
 
 #if !defined (NDEBUG)
-  saved_file_sync_helper_block = (DWB_BLOCK *) dwb_Global.file_sync_helper_block;
+  saved_file_sync_helper_block = (DWB_BLOCK *) dwb->file_sync_helper_block;
 #endif
 
 #if defined (SERVER_MODE)
   PERF_UTIME_TRACKER_START (thread_p, &time_track_file_sync_helper);
 
-  while (dwb_Global.file_sync_helper_block != NULL)
+  while (dwb->file_sync_helper_block != NULL)
     {
       flush = true;
 
       /* Be sure that the previous block was written on disk, before writing the current block. */
-      if (dwb_is_file_sync_helper_daemon_available ())
+      if (dwb_is_file_sync_helper_daemon_available (dwb))
 	{
 	  /* Wait for file sync helper. */
 	  thread_sleep (1);
@@ -2261,21 +2769,21 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
       else
 	{
 	  /* Helper not available, flush the volumes from previous block. */
-	  for (i = 0; i < dwb_Global.file_sync_helper_block->count_flush_volumes_info; i++)
+	  for (i = 0; i < dwb->file_sync_helper_block->count_flush_volumes_info; i++)
 	    {
-	      assert (dwb_Global.file_sync_helper_block->flush_volumes_info[i].vdes != NULL_VOLDES);
+	      assert (dwb->file_sync_helper_block->flush_volumes_info[i].vdes != NULL_VOLDES);
 
-	      if (ATOMIC_INC_32 (&(dwb_Global.file_sync_helper_block->flush_volumes_info[i].num_pages), 0) >= 0)
+	      if (ATOMIC_INC_32 (&(dwb->file_sync_helper_block->flush_volumes_info[i].num_pages), 0) >= 0)
 		{
 		  (void) fileio_synchronize (thread_p,
-					     dwb_Global.file_sync_helper_block->flush_volumes_info[i].vdes, NULL,
+					     dwb->file_sync_helper_block->flush_volumes_info[i].vdes, NULL,
 					     FILEIO_SYNC_ONLY);
 
 		  dwb_log ("dwb_flush_block: Synchronized volume %d\n",
-			   dwb_Global.file_sync_helper_block->flush_volumes_info[i].vdes);
+			   dwb->file_sync_helper_block->flush_volumes_info[i].vdes);
 		}
 	    }
-	  (void) ATOMIC_TAS_ADDR (&dwb_Global.file_sync_helper_block, (DWB_BLOCK *) NULL);
+	  (void) ATOMIC_TAS_ADDR (&dwb->file_sync_helper_block, (DWB_BLOCK *) NULL);
 	}
     }
 
@@ -2300,7 +2808,7 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
   block->all_pages_written = false;
 
   /* First, write and flush the double write file buffer. */
-  if (fileio_write_pages (thread_p, dwb_Global.vdes, block->write_buffer, 0, block->count_wb_pages,
+  if (fileio_write_pages (thread_p, dwb->vdes, block->write_buffer, 0, block->count_wb_pages,
 			  IO_PAGESIZE, FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
     {
       /* Something wrong happened. */
@@ -2312,7 +2820,7 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
   /* Increment statistics after writing in double write volume. */
   perfmon_add_stat (thread_p, PSTAT_PB_NUM_IOWRITES, block->count_wb_pages);
 
-  if (fileio_synchronize (thread_p, dwb_Global.vdes, dwb_Volume_name, FILEIO_SYNC_ONLY) != dwb_Global.vdes)
+  if (fileio_synchronize (thread_p, dwb->vdes, dwb->volume_name, FILEIO_SYNC_ONLY) != dwb->vdes)
     {
       assert (false);
       /* Something wrong happened. */
@@ -2321,9 +2829,23 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
     }
   dwb_log ("dwb_flush_block: DWB synchronized\n");
 
+#if defined (SERVER_MODE)
+  /* Write and flush the original locations of the volumes in parallel, if possible. */
+  error_code = dwb_write_and_sync_block_by_volume (thread_p, block, p_dwb_ordered_slots, &written_by_volume);
+  if (error_code != NO_ERROR)
+    {
+      assert (false);
+      goto end;
+    }
+  if (written_by_volume)
+    {
+      goto block_written;
+    }
+#endif /* SERVER_MODE */
+
   /* Now, write and flush the original location. */
   error_code =
-    dwb_write_block (thread_p, block, p_dwb_ordered_slots, ordered_slots_length, file_sync_helper_can_flush, true);
+    dwb_write_block (thread_p, dwb, block, p_dwb_ordered_slots, ordered_slots_length, file_sync_helper_can_flush, true);
   if (error_code != NO_ERROR)
     {
       assert (false);
@@ -2347,16 +2869,16 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
 #if defined (SERVER_MODE)
       if (file_sync_helper_can_flush == true)
 	{
-	  if ((num_pages > max_pages_to_sync) && dwb_is_file_sync_helper_daemon_available ())
+	  if ((num_pages > max_pages_to_sync) && dwb_is_file_sync_helper_daemon_available (dwb))
 	    {
 	      /* Let the helper thread to flush volumes having many pages. */
-	      assert (dwb_Global.file_sync_helper_block != NULL);
+	      assert (dwb->file_sync_helper_block != NULL);
 	      continue;
 	    }
 	}
       else
 	{
-	  assert (dwb_Global.file_sync_helper_block == NULL);
+	  assert (dwb->file_sync_helper_block == NULL);
 	}
 #endif
 
@@ -2375,6 +2897,9 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
       dwb_log ("dwb_flush_block: Synchronized volume %d\n", block->flush_volumes_info[i].vdes);
     }
 
+#if defined (SERVER_MODE)
+block_written:
+#endif /* SERVER_MODE */
   /* Allow to file sync helper thread to finish. */
   block->all_pages_written = true;
 
@@ -2384,28 +2909,28 @@ dwb_flush_block (THREAD_ENTRY * thread_p, DWB_BLOCK * block, bool file_sync_help
     }
 
   /* The block is full or there is only one thread that access DWB. */
-  assert (block->count_wb_pages == DWB_BLOCK_NUM_PAGES
-	  || DWB_IS_MODIFYING_STRUCTURE (ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0LL)));
+  assert (block->count_wb_pages == DWB_BLOCK_NUM_PAGES (dwb)
+	  || DWB_IS_MODIFYING_STRUCTURE (ATOMIC_INC_64 (&dwb->position_with_flags, 0LL)));
 
   ATOMIC_TAS_32 (&block->count_wb_pages, 0);
   ATOMIC_INC_64 (&block->version, 1ULL);
 
   /* Reset block bit, since the block was flushed. */
 reset_bit_position:
-  local_current_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0LL);
+  local_current_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0LL);
   new_position_with_flags = DWB_ENDS_BLOCK_WRITING (local_current_position_with_flags, block->block_no);
 
-  if (!ATOMIC_CAS_64 (&dwb_Global.position_with_flags, local_current_position_with_flags, new_position_with_flags))
+  if (!ATOMIC_CAS_64 (&dwb->position_with_flags, local_current_position_with_flags, new_position_with_flags))
     {
       /* The position was changed by others, try again. */
       goto reset_bit_position;
     }
 
   /* Advance flushing to next block. */
-  current_block_to_flush = dwb_Global.next_block_to_flush;
-  next_block_to_flush = DWB_GET_NEXT_BLOCK_NO (current_block_to_flush);
+  current_block_to_flush = dwb->next_block_to_flush;
+  next_block_to_flush = DWB_GET_NEXT_BLOCK_NO (dwb, current_block_to_flush);
 
-  if (!ATOMIC_CAS_32 (&dwb_Global.next_block_to_flush, current_block_to_flush, next_block_to_flush))
+  if (!ATOMIC_CAS_32 (&dwb->next_block_to_flush, current_block_to_flush, next_block_to_flush))
     {
       /* I'm the only thread that can advance next block to flush. */
       assert_release (false);
@@ -2419,7 +2944,7 @@ reset_bit_position:
     }
 
 end:
-  ATOMIC_INC_32 (&dwb_Global.blocks_flush_counter, -1);
+  ATOMIC_INC_32 (&dwb->blocks_flush_counter, -1);
 
   if (p_dwb_ordered_slots != NULL)
     {
@@ -2440,7 +2965,7 @@ end:
  * p_dwb_slot(out): The pointer to the next slot in DWB.
  */
 STATIC_INLINE int
-dwb_acquire_next_slot (THREAD_ENTRY * thread_p, bool can_wait, DWB_SLOT ** p_dwb_slot)
+dwb_acquire_next_slot (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, bool can_wait, DWB_SLOT ** p_dwb_slot)
 {
   UINT64 current_position_with_flags, current_position_with_block_write_started, new_position_with_flags;
   unsigned int current_block_no, position_in_current_block;
@@ -2452,7 +2977,7 @@ dwb_acquire_next_slot (THREAD_ENTRY * thread_p, bool can_wait, DWB_SLOT ** p_dwb
 
 start:
   /* Get the current position in double write buffer. */
-  current_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  current_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
 
   if (DWB_NOT_CREATED_OR_MODIFYING (current_position_with_flags))
     {
@@ -2465,7 +2990,7 @@ start:
 	    }
 
 	  /* DWB structure change started, needs to wait. */
-	  error_code = dwb_wait_for_strucure_modification (thread_p);
+	  error_code = dwb_wait_for_strucure_modification (thread_p, dwb);
 	  if (error_code != NO_ERROR)
 	    {
 	      if (error_code == ER_CSS_PTHREAD_COND_TIMEDOUT)
@@ -2497,10 +3022,10 @@ start:
 	}
     }
 
-  current_block_no = DWB_GET_BLOCK_NO_FROM_POSITION (current_position_with_flags);
-  position_in_current_block = DWB_GET_POSITION_IN_BLOCK (current_position_with_flags);
+  current_block_no = DWB_GET_BLOCK_NO_FROM_POSITION (dwb, current_position_with_flags);
+  position_in_current_block = DWB_GET_POSITION_IN_BLOCK (dwb, current_position_with_flags);
 
-  assert (current_block_no < DWB_NUM_TOTAL_BLOCKS && position_in_current_block < DWB_BLOCK_NUM_PAGES);
+  assert (current_block_no < DWB_NUM_TOTAL_BLOCKS (dwb) && position_in_current_block < DWB_BLOCK_NUM_PAGES (dwb));
 
   if (position_in_current_block == 0)
     {
@@ -2513,13 +3038,13 @@ start:
 	    }
 
 	  dwb_log ("Waits for flushing block=%d having version=%lld) \n",
-		   current_block_no, dwb_Global.blocks[current_block_no].version);
+		   current_block_no, dwb->blocks[current_block_no].version);
 
 	  /*
 	   * The previous iteration didn't finished, needs to wait, in order to avoid buffer overwriting.
 	   * Should happens relative rarely, except the case when the buffer consist in only one block.
 	   */
-	  error_code = dwb_wait_for_block_completion (thread_p, current_block_no);
+	  error_code = dwb_wait_for_block_completion (thread_p, dwb, current_block_no);
 	  if (error_code != NO_ERROR)
 	    {
 	      if (error_code == ER_CSS_PTHREAD_COND_TIMEDOUT)
@@ -2529,7 +3054,7 @@ start:
 		}
 
 	      dwb_log_error ("Error %d while waiting for flushing block=%d having version %lld \n",
-			     error_code, current_block_no, dwb_Global.blocks[current_block_no].version);
+			     error_code, current_block_no, dwb->blocks[current_block_no].version);
 	      return error_code;
 	    }
 
@@ -2543,26 +3068,26 @@ start:
       current_position_with_block_write_started =
 	DWB_STARTS_BLOCK_WRITING (current_position_with_flags, current_block_no);
 
-      new_position_with_flags = DWB_GET_NEXT_POSITION_WITH_FLAGS (current_position_with_block_write_started);
+      new_position_with_flags = DWB_GET_NEXT_POSITION_WITH_FLAGS (dwb, current_position_with_block_write_started);
     }
   else
     {
       /* I'm sure that nobody else can delete the buffer */
-      assert (DWB_IS_CREATED (dwb_Global.position_with_flags));
-      assert (!DWB_IS_MODIFYING_STRUCTURE (dwb_Global.position_with_flags));
+      assert (DWB_IS_CREATED (dwb->position_with_flags));
+      assert (!DWB_IS_MODIFYING_STRUCTURE (dwb->position_with_flags));
 
       /* Compute the next position with flags */
-      new_position_with_flags = DWB_GET_NEXT_POSITION_WITH_FLAGS (current_position_with_flags);
+      new_position_with_flags = DWB_GET_NEXT_POSITION_WITH_FLAGS (dwb, current_position_with_flags);
     }
 
   /* Compute and advance the global position in double write buffer. */
-  if (!ATOMIC_CAS_64 (&dwb_Global.position_with_flags, current_position_with_flags, new_position_with_flags))
+  if (!ATOMIC_CAS_64 (&dwb->position_with_flags, current_position_with_flags, new_position_with_flags))
     {
       /* Someone else advanced the global position in double write buffer, try again. */
       goto start;
     }
 
-  block = dwb_Global.blocks + current_block_no;
+  block = dwb->blocks + current_block_no;
 
   *p_dwb_slot = block->slots + position_in_current_block;
 
@@ -2625,23 +3150,23 @@ dwb_init_slot (DWB_SLOT * slot)
  *
  * returns: Nothing
  * thread_p (in): The thread entry.
- * block_no(out): The next block for flush if found, otherwise DWB_NUM_TOTAL_BLOCKS.
+ * block_no(out): The next block for flush if found, otherwise DWB_NUM_TOTAL_BLOCKS (dwb).
  */
 STATIC_INLINE void
-dwb_get_next_block_for_flush (THREAD_ENTRY * thread_p, unsigned int *block_no)
+dwb_get_next_block_for_flush (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, unsigned int *block_no)
 {
   assert (block_no != NULL);
 
-  *block_no = DWB_NUM_TOTAL_BLOCKS;
+  *block_no = DWB_NUM_TOTAL_BLOCKS (dwb);
 
   /* check whether the next block can be flushed. */
-  if (dwb_Global.blocks[dwb_Global.next_block_to_flush].count_wb_pages != DWB_BLOCK_NUM_PAGES)
+  if (dwb->blocks[dwb->next_block_to_flush].count_wb_pages != DWB_BLOCK_NUM_PAGES (dwb))
     {
       /* Next block is not full yet. */
       return;
     }
 
-  *block_no = dwb_Global.next_block_to_flush;
+  *block_no = dwb->next_block_to_flush;
 }
 
 /*
@@ -2656,12 +3181,14 @@ dwb_get_next_block_for_flush (THREAD_ENTRY * thread_p, unsigned int *block_no)
 int
 dwb_set_data_on_next_slot (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, bool can_wait, DWB_SLOT ** p_dwb_slot)
 {
+  VPID vpid;
   int error_code;
 
   assert (p_dwb_slot != NULL && io_page_p != NULL);
 
-  /* Acquire the slot before setting the data. */
-  error_code = dwb_acquire_next_slot (thread_p, can_wait, p_dwb_slot);
+  /* Acquire the slot before setting the data, in the instance owning the page. */
+  VPID_SET (&vpid, io_page_p->prv.volid, io_page_p->prv.pageid);
+  error_code = dwb_acquire_next_slot (thread_p, dwb_get_instance (&vpid), can_wait, p_dwb_slot);
   if (error_code != NO_ERROR)
     {
       return error_code;
@@ -2681,18 +3208,20 @@ dwb_set_data_on_next_slot (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, boo
 }
 
 /*
- * dwb_add_page () - Add page content to DWB.
+ * dwb_add_page_to_instance () - Add page content to a DWB instance.
  *
  * return   : Error code.
  * thread_p (in): The thread entry.
+ * dwb (in): The DWB instance.
  * io_page_p(in): In-memory address where the current content of page resides.
  * vpid(in): Page identifier.
  * p_dwb_slot(in/out): DWB slot where the page content must be added.
  *
  *  Note: thread may flush the block, if flush thread is not available or we are in stand alone.
  */
-int
-dwb_add_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, VPID * vpid, DWB_SLOT ** p_dwb_slot)
+static int
+dwb_add_page_to_instance (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, FILEIO_PAGE * io_page_p, VPID * vpid,
+			  DWB_SLOT ** p_dwb_slot)
 {
   unsigned int count_wb_pages;
   int error_code = NO_ERROR;
@@ -2701,16 +3230,9 @@ dwb_add_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, VPID * vpid, DWB
   DWB_SLOT *dwb_slot = NULL;
   bool needs_flush;
 
-  assert (p_dwb_slot != NULL && (io_page_p != NULL || (*p_dwb_slot)->io_page != NULL) && vpid != NULL);
-
-  if (thread_p == NULL)
-    {
-      thread_p = thread_get_thread_entry_info ();
-    }
-
   if (*p_dwb_slot == NULL)
     {
-      error_code = dwb_set_data_on_next_slot (thread_p, io_page_p, true, p_dwb_slot);
+      error_code = dwb_acquire_next_slot (thread_p, dwb, true, p_dwb_slot);
       if (error_code != NO_ERROR)
 	{
 	  return error_code;
@@ -2720,8 +3242,12 @@ dwb_add_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, VPID * vpid, DWB
 	{
 	  return NO_ERROR;
 	}
+
+      dwb_set_slot_data (thread_p, *p_dwb_slot, io_page_p);
     }
 
+  assert ((*p_dwb_slot)->instance_no == dwb->instance_no);
+
   dwb_slot = *p_dwb_slot;
 
   assert (VPID_EQ (vpid, &dwb_slot->vpid));
@@ -2744,11 +3270,11 @@ dwb_add_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, VPID * vpid, DWB
   dwb_log ("dwb_add_page: added page = (%d,%d) on block (%d) position (%d)\n", vpid->volid, vpid->pageid,
 	   dwb_slot->block_no, dwb_slot->position_in_block);
 
-  block = &dwb_Global.blocks[dwb_slot->block_no];
+  block = &dwb->blocks[dwb_slot->block_no];
   count_wb_pages = ATOMIC_INC_32 (&block->count_wb_pages, 1);
-  assert_release (count_wb_pages <= DWB_BLOCK_NUM_PAGES);
+  assert_release (count_wb_pages <= DWB_BLOCK_NUM_PAGES (dwb));
 
-  if (count_wb_pages < DWB_BLOCK_NUM_PAGES)
+  if (count_wb_pages < DWB_BLOCK_NUM_PAGES (dwb))
     {
       needs_flush = false;
     }
@@ -2773,17 +3299,17 @@ dwb_add_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, VPID * vpid, DWB
    * Wake ups flush block thread to flush the current block. The current block will be flushed after flushing the
    * previous block.
    */
-  if (dwb_is_flush_block_daemon_available ())
+  if (dwb_is_flush_block_daemon_available (dwb))
     {
       /* Wakeup the thread that will flush the block. */
-      dwb_flush_block_daemon->wakeup ();
+      dwb->flush_block_daemon->wakeup ();
 
       return NO_ERROR;
     }
 #endif /* SERVER_MODE */
 
   /* Flush all pages from current block */
-  error_code = dwb_flush_block (thread_p, block, false, NULL);
+  error_code = dwb_flush_block (thread_p, dwb, block, false, NULL);
   if (error_code != NO_ERROR)
     {
       dwb_log_error ("Can't flush block = %d having version %lld\n", block->block_no, block->version);
@@ -2796,6 +3322,41 @@ dwb_add_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, VPID * vpid, DWB
   return NO_ERROR;
 }
 
+/*
+ * dwb_add_page () - Add page content to DWB.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * io_page_p(in): In-memory address where the current content of page resides.
+ * vpid(in): Page identifier.
+ * p_dwb_slot(in/out): DWB slot where the page content must be added.
+ *
+ *  Note: The page goes to the instance owning the slot or, if no slot was acquired yet, to the instance owning it.
+ */
+int
+dwb_add_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, VPID * vpid, DWB_SLOT ** p_dwb_slot)
+{
+  DOUBLE_WRITE_BUFFER *dwb;
+
+  assert (p_dwb_slot != NULL && (io_page_p != NULL || (*p_dwb_slot)->io_page != NULL) && vpid != NULL);
+
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  if (*p_dwb_slot != NULL)
+    {
+      dwb = &dwb_Instances[(*p_dwb_slot)->instance_no];
+    }
+  else
+    {
+      dwb = dwb_get_instance (vpid);
+    }
+
+  return dwb_add_page_to_instance (thread_p, dwb, io_page_p, vpid, p_dwb_slot);
+}
+
 /*
  * dwb_is_created () - Checks whether double write buffer was created.
  *
@@ -2804,7 +3365,7 @@ dwb_add_page (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page_p, VPID * vpid, DWB
 bool
 dwb_is_created (void)
 {
-  UINT64 position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  UINT64 position_with_flags = ATOMIC_INC_64 (&dwb_Instances[0].position_with_flags, 0ULL);
 
   return DWB_IS_CREATED (position_with_flags);
 }
@@ -2820,10 +3381,11 @@ dwb_is_created (void)
 int
 dwb_create (THREAD_ENTRY * thread_p, const char *dwb_path_p, const char *db_name_p)
 {
-  UINT64 current_position_with_flags;
+  UINT64 current_positions_with_flags[DWB_MAX_INSTANCES];
+  unsigned int i;
   int error_code = NO_ERROR;
 
-  error_code = dwb_starts_structure_modification (thread_p, &current_position_with_flags);
+  error_code = dwb_starts_structure_modification_all (thread_p, current_positions_with_flags);
   if (error_code != NO_ERROR)
     {
       dwb_log_error ("Can't create DWB: error = %d\n", error_code);
@@ -2831,15 +3393,19 @@ dwb_create (THREAD_ENTRY * thread_p, const char *dwb_path_p, const char *db_name
     }
 
   /* DWB structure modification started, no other transaction can modify the global position with flags */
-  if (DWB_IS_CREATED (current_position_with_flags))
+  if (DWB_IS_CREATED (current_positions_with_flags[0]))
     {
       /* Already created, restore the modification flag. */
       goto end;
     }
 
-  fileio_make_dwb_name (dwb_Volume_name, dwb_path_p, db_name_p);
+  for (i = 0; i < DWB_MAX_INSTANCES; i++)
+    {
+      dwb_Instances[i].instance_no = i;
+      fileio_make_dwb_instance_name (dwb_Instances[i].volume_name, dwb_path_p, db_name_p, i);
+    }
 
-  error_code = dwb_create_internal (thread_p, dwb_Volume_name, &current_position_with_flags);
+  error_code = dwb_create_all_internal (thread_p, current_positions_with_flags);
   if (error_code != NO_ERROR)
     {
       dwb_log_error ("Can't create DWB: error = %d\n", error_code);
@@ -2848,7 +3414,7 @@ dwb_create (THREAD_ENTRY * thread_p, const char *dwb_path_p, const char *db_name
 
 end:
   /* Ends the modification, allowing to others to modify global position with flags. */
-  dwb_ends_structure_modification (thread_p, current_position_with_flags);
+  dwb_ends_structure_modification_all (thread_p, current_positions_with_flags);
 
   return error_code;
 }
@@ -2863,26 +3429,26 @@ int
 dwb_recreate (THREAD_ENTRY * thread_p)
 {
   int error_code = NO_ERROR;
-  UINT64 current_position_with_flags;
+  UINT64 current_positions_with_flags[DWB_MAX_INSTANCES];
 
   if (thread_p == NULL)
     {
       thread_p = thread_get_thread_entry_info ();
     }
 
-  error_code = dwb_starts_structure_modification (thread_p, &current_position_with_flags);
+  error_code = dwb_starts_structure_modification_all (thread_p, current_positions_with_flags);
   if (error_code != NO_ERROR)
     {
       return error_code;
     }
 
   /* DWB structure modification started, no other transaction can modify the global position with flags */
-  if (DWB_IS_CREATED (current_position_with_flags))
+  if (DWB_IS_CREATED (current_positions_with_flags[0]))
     {
-      dwb_destroy_internal (thread_p, &current_position_with_flags);
+      dwb_destroy_all_internal (thread_p, current_positions_with_flags);
     }
 
-  error_code = dwb_create_internal (thread_p, dwb_Volume_name, &current_position_with_flags);
+  error_code = dwb_create_all_internal (thread_p, current_positions_with_flags);
   if (error_code != NO_ERROR)
     {
       goto end;
@@ -2890,7 +3456,7 @@ dwb_recreate (THREAD_ENTRY * thread_p)
 
 end:
   /* Ends the modification, allowing to others to modify global position with flags. */
-  dwb_ends_structure_modification (thread_p, current_position_with_flags);
+  dwb_ends_structure_modification_all (thread_p, current_positions_with_flags);
 
   return error_code;
 }
@@ -3080,19 +3646,17 @@ dwb_check_data_page_is_sane (THREAD_ENTRY * thread_p, DWB_BLOCK * rcv_block, DWB
 }
 
 /*
- * dwb_load_and_recover_pages () - Load and recover pages from DWB.
+ * dwb_load_and_recover_volume () - Load and recover pages from a DWB instance volume.
  *
  * return   : Error code.
  * thread_p (in): The thread entry.
- * dwb_path_p (in): The double write buffer path.
- * db_name_p (in): The database name.
+ * dwb_volume_name (in): The DWB instance volume name.
  *
- *  Note: This function is called at recovery. The corrupted pages are recovered from double write volume buffer disk.
- *    Then, double write volume buffer disk is recreated according to user specifications.
+ *  Note: The corrupted pages are recovered from the volume, then the volume is destroyed.
  *    Currently we use a DWB block in memory to recover corrupted page.
  */
-int
-dwb_load_and_recover_pages (THREAD_ENTRY * thread_p, const char *dwb_path_p, const char *db_name_p)
+static int
+dwb_load_and_recover_volume (THREAD_ENTRY * thread_p, const char *dwb_volume_name)
 {
   int error_code = NO_ERROR, read_fd = NULL_VOLDES;
   unsigned int num_dwb_pages, ordered_slots_length, i;
@@ -3101,16 +3665,10 @@ dwb_load_and_recover_pages (THREAD_ENTRY * thread_p, const char *dwb_path_p, con
   FILEIO_PAGE *iopage;
   int num_recoverable_pages;
 
-  assert (dwb_Global.vdes == NULL_VOLDES);
-
-  dwb_check_logging ();
-
-  fileio_make_dwb_name (dwb_Volume_name, dwb_path_p, db_name_p);
-
-  if (fileio_is_volume_exist (dwb_Volume_name))
+  if (fileio_is_volume_exist (dwb_volume_name))
     {
       /* Open DWB volume first */
-      read_fd = fileio_mount (thread_p, boot_db_full_name (), dwb_Volume_name, LOG_DBDWB_VOLID, false, false);
+      read_fd = fileio_mount (thread_p, boot_db_full_name (), dwb_volume_name, LOG_DBDWB_VOLID, false, false);
       if (read_fd == NULL_VOLDES)
 	{
 	  return ER_IO_MOUNT_FAIL;
@@ -3130,7 +3688,7 @@ dwb_load_and_recover_pages (THREAD_ENTRY * thread_p, const char *dwb_path_p, con
       if ((num_dwb_pages > 0) && IS_POWER_OF_2 (num_dwb_pages))
 	{
 	  /* Create DWB block for recovery purpose. */
-	  error_code = dwb_create_blocks (thread_p, 1, num_dwb_pages, &rcv_block);
+	  error_code = dwb_create_blocks (thread_p, 0, 1, num_dwb_pages, &rcv_block);
 	  if (error_code != NO_ERROR)
 	    {
 	      goto end;
@@ -3231,8 +3789,8 @@ dwb_load_and_recover_pages (THREAD_ENTRY * thread_p, const char *dwb_path_p, con
 	  if (0 < num_recoverable_pages)
 	    {
 	      /* Replace the corrupted pages in data volume with the DWB content. */
-	      error_code =
-		dwb_write_block (thread_p, rcv_block, p_dwb_ordered_slots, ordered_slots_length, false, false);
+	      error_code = dwb_write_block (thread_p, &dwb_Instances[0], rcv_block, p_dwb_ordered_slots,
+					    ordered_slots_length, false, false);
 	      if (error_code != NO_ERROR)
 		{
 		  goto end;
@@ -3262,17 +3820,10 @@ dwb_load_and_recover_pages (THREAD_ENTRY * thread_p, const char *dwb_path_p, con
       fileio_dismount (thread_p, read_fd);
 
       /* Destroy the old file, since data recovered. */
-      fileio_unformat (thread_p, dwb_Volume_name);
+      fileio_unformat (thread_p, dwb_volume_name);
       read_fd = NULL_VOLDES;
     }
 
-  /* Since old file destroyed, now we can rebuild the new double write buffer with user specifications. */
-  error_code = dwb_create (thread_p, dwb_path_p, db_name_p);
-  if (error_code != NO_ERROR)
-    {
-      dwb_log_error ("Can't create DWB \n");
-    }
-
 end:
   /* Do not remove the old file if an error occurs. */
   if (p_dwb_ordered_slots != NULL)
@@ -3289,6 +3840,50 @@ end:
   return error_code;
 }
 
+/*
+ * dwb_load_and_recover_pages () - Load and recover pages from DWB.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * dwb_path_p (in): The double write buffer path.
+ * db_name_p (in): The database name.
+ *
+ *  Note: This function is called at recovery. The corrupted pages are recovered from double write volume buffer disk.
+ *    Then, double write volume buffer disk is recreated according to user specifications.
+ *    Every DWB instance volume left by the previous run is recovered, whatever the current number of instances.
+ */
+int
+dwb_load_and_recover_pages (THREAD_ENTRY * thread_p, const char *dwb_path_p, const char *db_name_p)
+{
+  char dwb_volume_name[PATH_MAX];
+  int error_code = NO_ERROR;
+  int i;
+
+  assert (dwb_Instances[0].vdes == NULL_VOLDES);
+
+  dwb_check_logging ();
+
+  for (i = 0; i < DWB_MAX_INSTANCES; i++)
+    {
+      fileio_make_dwb_instance_name (dwb_volume_name, dwb_path_p, db_name_p, i);
+
+      error_code = dwb_load_and_recover_volume (thread_p, dwb_volume_name);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+    }
+
+  /* Since old files destroyed, now we can rebuild the new double write buffer with user specifications. */
+  error_code = dwb_create (thread_p, dwb_path_p, db_name_p);
+  if (error_code != NO_ERROR)
+    {
+      dwb_log_error ("Can't create DWB \n");
+    }
+
+  return error_code;
+}
+
 /*
  * dwb_destroy () - Destroy DWB.
  *
@@ -3299,26 +3894,26 @@ int
 dwb_destroy (THREAD_ENTRY * thread_p)
 {
   int error_code = NO_ERROR;
-  UINT64 current_position_with_flags;
+  UINT64 current_positions_with_flags[DWB_MAX_INSTANCES];
 
-  error_code = dwb_starts_structure_modification (thread_p, &current_position_with_flags);
+  error_code = dwb_starts_structure_modification_all (thread_p, current_positions_with_flags);
   if (error_code != NO_ERROR)
     {
       return error_code;
     }
 
   /* DWB structure modification started, no other transaction can modify the global position with flags */
-  if (!DWB_IS_CREATED (current_position_with_flags))
+  if (!DWB_IS_CREATED (current_positions_with_flags[0]))
     {
       /* Not created, nothing to destroy, restore the modification flag. */
       goto end;
     }
 
-  dwb_destroy_internal (thread_p, &current_position_with_flags);
+  dwb_destroy_all_internal (thread_p, current_positions_with_flags);
 
 end:
   /* Ends the modification, allowing to others to modify global position with flags. */
-  dwb_ends_structure_modification (thread_p, current_position_with_flags);
+  dwb_ends_structure_modification_all (thread_p, current_positions_with_flags);
 
   /* DWB is destroyed, */
 #if defined(SERVER_MODE)
@@ -3337,7 +3932,7 @@ dwb_get_volume_name (void)
 {
   if (dwb_is_created ())
     {
-      return dwb_Volume_name;
+      return dwb_Instances[0].volume_name;
     }
   else
     {
@@ -3352,7 +3947,7 @@ dwb_get_volume_name (void)
  * thread_p (in): The thread entry.
  */
 static int
-dwb_flush_next_block (THREAD_ENTRY * thread_p)
+dwb_flush_next_block (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb)
 {
   unsigned int block_no;
   DWB_BLOCK *flush_block = NULL;
@@ -3360,31 +3955,31 @@ dwb_flush_next_block (THREAD_ENTRY * thread_p)
   UINT64 position_with_flags;
 
 start:
-  position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
   if (!DWB_IS_CREATED (position_with_flags) || DWB_IS_MODIFYING_STRUCTURE (position_with_flags))
     {
       return NO_ERROR;
     }
 
-  dwb_get_next_block_for_flush (thread_p, &block_no);
-  if (block_no < DWB_NUM_TOTAL_BLOCKS)
+  dwb_get_next_block_for_flush (thread_p, dwb, &block_no);
+  if (block_no < DWB_NUM_TOTAL_BLOCKS (dwb))
     {
-      flush_block = &dwb_Global.blocks[block_no];
+      flush_block = &dwb->blocks[block_no];
 
       /* Flush all pages from current block */
-      assert (flush_block != NULL && flush_block->count_wb_pages == DWB_BLOCK_NUM_PAGES);
+      assert (flush_block != NULL && flush_block->count_wb_pages == DWB_BLOCK_NUM_PAGES (dwb));
 
-      if (DWB_GET_PREV_BLOCK (flush_block->block_no)->version < flush_block->version
-	  || ((DWB_GET_PREV_BLOCK (flush_block->block_no)->version == flush_block->version)
-	      && (flush_block->block_no > DWB_GET_PREV_BLOCK_NO (flush_block->block_no))))
+      if (DWB_GET_PREV_BLOCK (dwb, flush_block->block_no)->version < flush_block->version
+	  || ((DWB_GET_PREV_BLOCK (dwb, flush_block->block_no)->version == flush_block->version)
+	      && (flush_block->block_no > DWB_GET_PREV_BLOCK_NO (dwb, flush_block->block_no))))
 	{
-	  if (DWB_GET_PREV_BLOCK (flush_block->block_no)->count_wb_pages != 0)
+	  if (DWB_GET_PREV_BLOCK (dwb, flush_block->block_no)->count_wb_pages != 0)
 	    {
 	      assert_release (false);
 	    }
 	}
 
-      error_code = dwb_flush_block (thread_p, flush_block, true, NULL);
+      error_code = dwb_flush_block (thread_p, dwb, flush_block, true, NULL);
       if (error_code != NO_ERROR)
 	{
 	  /* Something wrong happened. */
@@ -3404,18 +3999,19 @@ start:
 }
 
 /*
- * dwb_flush_force () - Force flushing the current content of DWB.
+ * dwb_flush_force_instance () - Force flushing the current content of a DWB instance.
  *
  * return   : Error code.
  * thread_p (in): The thread entry.
+ * dwb (in): The DWB instance.
  * all_sync (out): True, if everything synchronized.
  */
-int
-dwb_flush_force (THREAD_ENTRY * thread_p, bool * all_sync)
+static int
+dwb_flush_force_instance (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb, bool * all_sync)
 {
   UINT64 initial_position_with_flags, current_position_with_flags, prev_position_with_flags;
   UINT64 initial_block_version, current_block_version;
-  int initial_block_no, current_block_no = DWB_NUM_TOTAL_BLOCKS;
+  int initial_block_no, current_block_no = DWB_NUM_TOTAL_BLOCKS (dwb);
   char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
   FILEIO_PAGE *iopage = NULL;
   VPID null_vpid = { NULL_VOLID, NULL_PAGEID };
@@ -3433,16 +4029,16 @@ dwb_flush_force (THREAD_ENTRY * thread_p, bool * all_sync)
   *all_sync = false;
 
 start:
-  initial_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  initial_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
   dwb_log ("dwb_flush_force: Started with initital position = %lld\n", initial_position_with_flags);
 
 #if !defined (NDEBUG)
-  if (dwb_Global.blocks != NULL)
+  if (dwb->blocks != NULL)
     {
-      for (block_no = 0; block_no < (int) DWB_NUM_TOTAL_BLOCKS; block_no++)
+      for (block_no = 0; block_no < (int) DWB_NUM_TOTAL_BLOCKS (dwb); block_no++)
 	{
 	  dwb_log_error ("dwb_flush_force start: Block %d, Num pages = %d, version = %lld\n",
-			 block_no, dwb_Global.blocks[block_no].count_wb_pages, dwb_Global.blocks[block_no].version);
+			 block_no, dwb->blocks[block_no].count_wb_pages, dwb->blocks[block_no].version);
 	}
     }
 #endif
@@ -3452,7 +4048,7 @@ start:
       if (!DWB_IS_CREATED (initial_position_with_flags))
 	{
 	  /* Nothing to do. Everything flushed. */
-	  assert (dwb_Global.file_sync_helper_block == NULL);
+	  assert (dwb->file_sync_helper_block == NULL);
 	  dwb_log ("dwb_flush_force: Everything flushed\n");
 	  goto end;
 	}
@@ -3460,7 +4056,7 @@ start:
       if (DWB_IS_MODIFYING_STRUCTURE (initial_position_with_flags))
 	{
 	  /* DWB structure change started, needs to wait for flush. */
-	  error_code = dwb_wait_for_strucure_modification (thread_p);
+	  error_code = dwb_wait_for_strucure_modification (thread_p, dwb);
 	  if (error_code != NO_ERROR)
 	    {
 	      if (error_code == ER_CSS_PTHREAD_COND_TIMEDOUT)
@@ -3469,7 +4065,7 @@ start:
 		  goto start;
 		}
 	      dwb_log_error ("dwb_flush_force : Error %d while waiting for structure modification=%lld\n",
-			     error_code, ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL));
+			     error_code, ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL));
 	      return error_code;
 	    }
 	}
@@ -3478,8 +4074,8 @@ start:
   if (DWB_GET_BLOCK_STATUS (initial_position_with_flags) == 0)
     {
       /* Check helper flush block. */
-      initial_block_no = DWB_GET_BLOCK_NO_FROM_POSITION (initial_position_with_flags);
-      initial_block = dwb_Global.file_sync_helper_block;
+      initial_block_no = DWB_GET_BLOCK_NO_FROM_POSITION (dwb, initial_position_with_flags);
+      initial_block = dwb->file_sync_helper_block;
       if (initial_block == NULL)
 	{
 	  /* Nothing to flush. */
@@ -3492,28 +4088,28 @@ start:
   /* Search for latest not flushed block - not flushed yet, having highest version. */
   initial_block_no = -1;
   initial_block_version = 0;
-  for (block_no = 0; block_no < (int) DWB_NUM_TOTAL_BLOCKS; block_no++)
+  for (block_no = 0; block_no < (int) DWB_NUM_TOTAL_BLOCKS (dwb); block_no++)
     {
       if (DWB_IS_BLOCK_WRITE_STARTED (initial_position_with_flags, block_no)
-	  && (dwb_Global.blocks[block_no].version >= initial_block_version))
+	  && (dwb->blocks[block_no].version >= initial_block_version))
 	{
 	  initial_block_no = block_no;
-	  initial_block_version = dwb_Global.blocks[initial_block_no].version;
+	  initial_block_version = dwb->blocks[initial_block_no].version;
 	}
     }
 
   /* At least one block was not flushed. */
   assert (initial_block_no != -1);
 
-  initial_num_pages = dwb_Global.blocks[initial_block_no].count_wb_pages;
-  if (initial_position_with_flags != ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL))
+  initial_num_pages = dwb->blocks[initial_block_no].count_wb_pages;
+  if (initial_position_with_flags != ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL))
     {
       /* The position_with_flags was modified meanwhile by concurrent threads. */
       goto start;
     }
   prev_position_with_flags = initial_position_with_flags;
 
-  max_pages_to_add = DWB_BLOCK_NUM_PAGES - initial_num_pages;
+  max_pages_to_add = DWB_BLOCK_NUM_PAGES (dwb) - initial_num_pages;
 
   iopage = (FILEIO_PAGE *) PTR_ALIGN (page_buf, MAX_ALIGNMENT);
   memset (iopage, 0, IO_MAX_PAGE_SIZE);
@@ -3526,12 +4122,12 @@ start:
 check_flushed_blocks:
 
   assert (initial_block_no >= 0);
-  if ((ATOMIC_INC_32 (&dwb_Global.blocks_flush_counter, 0) > 0)
-      && (ATOMIC_INC_32 (&dwb_Global.next_block_to_flush, 0) == (unsigned int) initial_block_no)
-      && (ATOMIC_INC_32 (&dwb_Global.blocks[initial_block_no].count_wb_pages, 0) == DWB_BLOCK_NUM_PAGES))
+  if ((ATOMIC_INC_32 (&dwb->blocks_flush_counter, 0) > 0)
+      && (ATOMIC_INC_32 (&dwb->next_block_to_flush, 0) == (unsigned int) initial_block_no)
+      && (ATOMIC_INC_32 (&dwb->blocks[initial_block_no].count_wb_pages, 0) == DWB_BLOCK_NUM_PAGES (dwb)))
     {
       /* The initial block is currently flushing, wait for it. */
-      error_code = dwb_wait_for_block_completion (thread_p, initial_block_no);
+      error_code = dwb_wait_for_block_completion (thread_p, dwb, initial_block_no);
       if (error_code != NO_ERROR)
 	{
 	  if (error_code == ER_CSS_PTHREAD_COND_TIMEDOUT)
@@ -3541,7 +4137,7 @@ check_flushed_blocks:
 	    }
 
 	  dwb_log_error ("dwb_flush_force : Error %d while waiting for block completion = %lld\n",
-			 error_code, ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL));
+			 error_code, ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL));
 	  return error_code;
 	}
 
@@ -3549,13 +4145,13 @@ check_flushed_blocks:
     }
 
   /* Read again the current position and check whether initial block was flushed. */
-  current_position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  current_position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
   if (DWB_NOT_CREATED_OR_MODIFYING (current_position_with_flags))
     {
       if (!DWB_IS_CREATED (current_position_with_flags))
 	{
 	  /* Nothing to do. Everything flushed. */
-	  assert (dwb_Global.file_sync_helper_block == NULL);
+	  assert (dwb->file_sync_helper_block == NULL);
 	  dwb_log ("dwb_flush_force: Everything flushed\n");
 	  goto end;
 	}
@@ -3563,7 +4159,7 @@ check_flushed_blocks:
       if (DWB_IS_MODIFYING_STRUCTURE (current_position_with_flags))
 	{
 	  /* DWB structure change started, needs to wait for flush. */
-	  error_code = dwb_wait_for_strucure_modification (thread_p);
+	  error_code = dwb_wait_for_strucure_modification (thread_p, dwb);
 	  if (error_code != NO_ERROR)
 	    {
 	      if (error_code == ER_CSS_PTHREAD_COND_TIMEDOUT)
@@ -3573,7 +4169,7 @@ check_flushed_blocks:
 		}
 
 	      dwb_log_error ("dwb_flush_force : Error %d while waiting for structure modification = %lld\n",
-			     error_code, ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL));
+			     error_code, ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL));
 	      return error_code;
 	    }
 	}
@@ -3586,8 +4182,8 @@ check_flushed_blocks:
     }
 
   /* Check whether initial block content was overwritten. */
-  current_block_no = DWB_GET_BLOCK_NO_FROM_POSITION (current_position_with_flags);
-  current_block_version = dwb_Global.blocks[current_block_no].version;
+  current_block_no = DWB_GET_BLOCK_NO_FROM_POSITION (dwb, current_position_with_flags);
+  current_block_version = dwb->blocks[current_block_no].version;
 
   if ((current_block_no == initial_block_no) && (current_block_version != initial_block_version))
     {
@@ -3602,19 +4198,19 @@ check_flushed_blocks:
       /* The system didn't advanced, add null pages to force flush block. */
       dwb_slot = NULL;
 
-      error_code = dwb_add_page (thread_p, iopage, &null_vpid, &dwb_slot);
+      error_code = dwb_add_page_to_instance (thread_p, dwb, iopage, &null_vpid, &dwb_slot);
       if (error_code != NO_ERROR)
 	{
 	  dwb_log_error ("dwb_flush_force : Error %d while adding page = %lld\n",
-			 error_code, ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL));
+			 error_code, ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL));
 	  return error_code;
 	}
       else if (dwb_slot == NULL)
 	{
 	  /* DWB disabled meanwhile, everything flushed. */
-	  assert (dwb_Global.file_sync_helper_block == NULL);
-	  assert (!DWB_IS_CREATED (ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL)));
-	  dwb_log ("dwb_flush_force: DWB disabled = %lld\n", ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL));
+	  assert (dwb->file_sync_helper_block == NULL);
+	  assert (!DWB_IS_CREATED (ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL)));
+	  dwb_log ("dwb_flush_force: DWB disabled = %lld\n", ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL));
 	  goto end;
 	}
 
@@ -3625,11 +4221,11 @@ check_flushed_blocks:
   goto check_flushed_blocks;
 
 wait_for_file_sync_helper_block:
-  dwb_log ("dwb_flush_force: Wait for helper flush = %lld\n", ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL));
-  initial_block = &dwb_Global.blocks[initial_block_no];
+  dwb_log ("dwb_flush_force: Wait for helper flush = %lld\n", ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL));
+  initial_block = &dwb->blocks[initial_block_no];
 
 #if defined (SERVER_MODE)
-  while (dwb_Global.file_sync_helper_block == initial_block)
+  while (dwb->file_sync_helper_block == initial_block)
     {
       /* Wait for file sync helper thread to finish. */
       thread_sleep (1);
@@ -3639,16 +4235,16 @@ wait_for_file_sync_helper_block:
 end:
   *all_sync = true;
 
-  dwb_log ("dwb_flush_force: Ended with position = %lld\n", ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL));
+  dwb_log ("dwb_flush_force: Ended with position = %lld\n", ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL));
   PERF_UTIME_TRACKER_TIME_AND_RESTART (thread_p, &time_track, PSTAT_DWB_FLUSH_FORCE_TIME_COUNTERS);
 
 #if !defined (NDEBUG)
-  if (dwb_Global.blocks != NULL)
+  if (dwb->blocks != NULL)
     {
-      for (block_no = 0; block_no < (int) DWB_NUM_TOTAL_BLOCKS; block_no++)
+      for (block_no = 0; block_no < (int) DWB_NUM_TOTAL_BLOCKS (dwb); block_no++)
 	{
 	  dwb_log_error ("dwb_flush_force end: Block %d, Num pages = %d, version = %lld\n",
-			 block_no, dwb_Global.blocks[block_no].count_wb_pages, dwb_Global.blocks[block_no].version);
+			 block_no, dwb->blocks[block_no].count_wb_pages, dwb->blocks[block_no].version);
 	}
     }
 #endif
@@ -3656,6 +4252,38 @@ end:
   return NO_ERROR;
 }
 
+/*
+ * dwb_flush_force () - Force flushing the current content of DWB.
+ *
+ * return   : Error code.
+ * thread_p (in): The thread entry.
+ * all_sync (out): True, if everything synchronized.
+ */
+int
+dwb_flush_force (THREAD_ENTRY * thread_p, bool * all_sync)
+{
+  unsigned int i;
+  bool instance_sync;
+  int error_code;
+
+  assert (all_sync != NULL);
+
+  *all_sync = true;
+  for (i = 0; i < dwb_Num_instances; i++)
+    {
+      error_code = dwb_flush_force_instance (thread_p, &dwb_Instances[i], &instance_sync);
+      if (error_code != NO_ERROR)
+	{
+	  *all_sync = false;
+	  return error_code;
+	}
+
+      *all_sync = *all_sync && instance_sync;
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * dwb_file_sync_helper () - Helps file sync.
  *
@@ -3663,7 +4291,7 @@ end:
  * thread_p (in): Thread entry.
  */
 static int
-dwb_file_sync_helper (THREAD_ENTRY * thread_p)
+dwb_file_sync_helper (THREAD_ENTRY * thread_p, DOUBLE_WRITE_BUFFER * dwb)
 {
   unsigned int i;
   int num_pages, num_pages2, num_pages_to_sync;
@@ -3679,14 +4307,14 @@ dwb_file_sync_helper (THREAD_ENTRY * thread_p)
   PERF_UTIME_TRACKER_START (thread_p, &time_track);
   num_pages_to_sync = prm_get_integer_value (PRM_ID_PB_SYNC_ON_NFLUSH);
 
-  position_with_flags = ATOMIC_INC_64 (&dwb_Global.position_with_flags, 0ULL);
+  position_with_flags = ATOMIC_INC_64 (&dwb->position_with_flags, 0ULL);
   if (!DWB_IS_CREATED (position_with_flags) || DWB_IS_MODIFYING_STRUCTURE (position_with_flags))
     {
       /* Needs to modify structure. Stop flushing. */
       return NO_ERROR;
     }
 
-  block = (DWB_BLOCK *) dwb_Global.file_sync_helper_block;
+  block = (DWB_BLOCK *) dwb->file_sync_helper_block;
   if (block == NULL)
     {
       return NO_ERROR;
@@ -3848,8 +4476,8 @@ dwb_file_sync_helper (THREAD_ENTRY * thread_p)
 #endif
 
   /* Be sure that the helper flush block was not changed by other thread. */
-  assert (block == dwb_Global.file_sync_helper_block);
-  (void) ATOMIC_TAS_ADDR (&dwb_Global.file_sync_helper_block, (DWB_BLOCK *) NULL);
+  assert (block == dwb->file_sync_helper_block);
+  (void) ATOMIC_TAS_ADDR (&dwb->file_sync_helper_block, (DWB_BLOCK *) NULL);
 
   PERF_UTIME_TRACKER_TIME (thread_p, &time_track, PSTAT_DWB_FILE_SYNC_HELPER_TIME_COUNTERS);
 
@@ -3881,7 +4509,7 @@ dwb_read_page (THREAD_ENTRY * thread_p, const VPID * vpid, void *io_page, bool *
     }
 
   VPID key_vpid = *vpid;
-  slots_hash_entry = dwb_Global.slots_hashmap.find (thread_p, key_vpid);
+  slots_hash_entry = dwb_Slots_hashmap.find (thread_p, key_vpid);
   if (slots_hash_entry != NULL)
     {
       assert (slots_hash_entry->slot->io_page != NULL);
@@ -3915,9 +4543,11 @@ class dwb_flush_block_daemon_task: public cubthread::entry_task
 {
   private:
     PERF_UTIME_TRACKER m_perf_track;
+    DOUBLE_WRITE_BUFFER *m_dwb;
 
   public:
-    dwb_flush_block_daemon_task ()
+    dwb_flush_block_daemon_task (DOUBLE_WRITE_BUFFER *dwb)
+      : m_dwb (dwb)
     {
       PERF_UTIME_TRACKER_START (NULL, &m_perf_track);
     }
@@ -3936,7 +4566,7 @@ class dwb_flush_block_daemon_task: public cubthread::entry_task
       /* flush pages as long as necessary */
       if (prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true)
         {
-	  if (dwb_flush_next_block (&thread_ref) != NO_ERROR)
+	  if (dwb_flush_next_block (&thread_ref, m_dwb) != NO_ERROR)
 	    {
 	      assert_release (false);
 	    }
@@ -3952,7 +4582,7 @@ class dwb_flush_block_daemon_task: public cubthread::entry_task
 //    dwb file sync helper daemon task
 //
 void
-dwb_file_sync_helper_execute (cubthread::entry &thread_ref)
+dwb_file_sync_helper_execute (cubthread::entry &thread_ref, DOUBLE_WRITE_BUFFER *dwb)
 {
   if (!BO_IS_SERVER_RESTARTED ())
     {
@@ -3963,32 +4593,34 @@ dwb_file_sync_helper_execute (cubthread::entry &thread_ref)
   /* flush pages as long as necessary */
   if (prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true)
     {
-      dwb_file_sync_helper (&thread_ref);
+      dwb_file_sync_helper (&thread_ref, dwb);
     }
 }
 
 /*
- * dwb_flush_block_daemon_init () - initialize DWB flush block daemon thread
+ * dwb_flush_block_daemon_init () - initialize DWB flush block daemon thread of an instance
  */
 void
-dwb_flush_block_daemon_init ()
+dwb_flush_block_daemon_init (DOUBLE_WRITE_BUFFER *dwb)
 {
   cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (1));
-  dwb_flush_block_daemon_task *daemon_task = new dwb_flush_block_daemon_task ();
+  dwb_flush_block_daemon_task *daemon_task = new dwb_flush_block_daemon_task (dwb);
 
-  dwb_flush_block_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task);
+  dwb->flush_block_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "dwb_flush_block");
 }
 
 /*
- * dwb_file_sync_helper_daemon_init () - initialize DWB file sync helper daemon thread
+ * dwb_file_sync_helper_daemon_init () - initialize DWB file sync helper daemon thread of an instance
  */
 void
-dwb_file_sync_helper_daemon_init ()
+dwb_file_sync_helper_daemon_init (DOUBLE_WRITE_BUFFER *dwb)
 {
   cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (10));
-  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (dwb_file_sync_helper_execute);
+  cubthread::entry_callable_task *daemon_task =
+    new cubthread::entry_callable_task (std::bind (dwb_file_sync_helper_execute, std::placeholders::_1, dwb));
 
-  dwb_file_sync_helper_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task);
+  dwb->file_sync_helper_daemon =
+    cubthread::get_manager ()->create_daemon (looper, daemon_task, "dwb_file_sync_helper");
 }
 
 /*
@@ -3997,8 +4629,21 @@ dwb_file_sync_helper_daemon_init ()
 void
 dwb_daemons_init ()
 {
-  dwb_flush_block_daemon_init ();
-  dwb_file_sync_helper_daemon_init ();
+  int num_volume_flush_threads = prm_get_integer_value (PRM_ID_DWB_VOLUME_FLUSH_THREADS);
+  unsigned int i;
+
+  for (i = 0; i < dwb_Num_instances; i++)
+    {
+      dwb_flush_block_daemon_init (&dwb_Instances[i]);
+      dwb_file_sync_helper_daemon_init (&dwb_Instances[i]);
+    }
+
+  if (num_volume_flush_threads > 0)
+    {
+      dwb_Volume_flush_workers =
+	thread_get_manager ()->create_worker_pool (num_volume_flush_threads, num_volume_flush_threads,
+						   "dwb_volume_flush_workers", NULL, 1, false);
+    }
 }
 
 /*
@@ -4007,8 +4652,18 @@ dwb_daemons_init ()
 void
 dwb_daemons_destroy ()
 {
-  cubthread::get_manager ()->destroy_daemon (dwb_flush_block_daemon);
-  cubthread::get_manager ()->destroy_daemon (dwb_file_sync_helper_daemon);
+  unsigned int i;
+
+  for (i = 0; i < DWB_MAX_INSTANCES; i++)
+    {
+      cubthread::get_manager ()->destroy_daemon (dwb_Instances[i].flush_block_daemon);
+      cubthread::get_manager ()->destroy_daemon (dwb_Instances[i].file_sync_helper_daemon);
+    }
+  if (dwb_Volume_flush_workers != NULL)
+    {
+      thread_get_manager ()->destroy_worker_pool (dwb_Volume_flush_workers);
+      dwb_Volume_flush_workers = NULL;
+    }
 }
 #endif /* SERVER_MODE */
 // *INDENT-ON*
@@ -4016,12 +4671,13 @@ dwb_daemons_destroy ()
 /*
  * dwb_is_flush_block_daemon_available () - Check if flush block daemon is available
  * return: true if flush block daemon is available, false otherwise
+ * dwb (in): The DWB instance.
  */
 static bool
-dwb_is_flush_block_daemon_available (void)
+dwb_is_flush_block_daemon_available (DOUBLE_WRITE_BUFFER * dwb)
 {
 #if defined (SERVER_MODE)
-  return prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true && dwb_flush_block_daemon != NULL;
+  return prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true && dwb->flush_block_daemon != NULL;
 #else
   return false;
 #endif
@@ -4030,12 +4686,13 @@ dwb_is_flush_block_daemon_available (void)
 /*
  * dwb_is_file_sync_helper_daemon_available () - Check if file sync helper daemon is available
  * return: true if file sync helper daemon is available, false otherwise
+ * dwb (in): The DWB instance.
  */
 static bool
-dwb_is_file_sync_helper_daemon_available (void)
+dwb_is_file_sync_helper_daemon_available (DOUBLE_WRITE_BUFFER * dwb)
 {
 #if defined (SERVER_MODE)
-  return prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true && dwb_file_sync_helper_daemon != NULL;
+  return prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true && dwb->file_sync_helper_daemon != NULL;
 #else
   return false;
 #endif
@@ -4045,13 +4702,14 @@ dwb_is_file_sync_helper_daemon_available (void)
  * dwb_flush_block_daemon_is_running () - Check whether flush block daemon is running
  *
  *   return: true, if flush block thread is running
+ *   dwb (in): The DWB instance.
  */
 static bool
-dwb_flush_block_daemon_is_running (void)
+dwb_flush_block_daemon_is_running (DOUBLE_WRITE_BUFFER * dwb)
 {
 #if defined (SERVER_MODE)
-  return (prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true && (dwb_flush_block_daemon != NULL)
-	  && (dwb_flush_block_daemon->is_running ()));
+  return (prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true && (dwb->flush_block_daemon != NULL)
+	  && (dwb->flush_block_daemon->is_running ()));
 #else
   return false;
 #endif /* SERVER_MODE */
@@ -4061,13 +4719,14 @@ dwb_flush_block_daemon_is_running (void)
  * dwb_file_sync_helper_daemon_is_running () - Check whether file sync helper daemon is running
  *
  *   return: true, if file sync helper thread is running
+ *   dwb (in): The DWB instance.
  */
 static bool
-dwb_file_sync_helper_daemon_is_running (void)
+dwb_file_sync_helper_daemon_is_running (DOUBLE_WRITE_BUFFER * dwb)
 {
 #if defined (SERVER_MODE)
-  return (prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true && (dwb_file_sync_helper_daemon != NULL)
-	  && (dwb_file_sync_helper_daemon->is_running ()));
+  return (prm_get_bool_value (PRM_ID_ENABLE_DWB_FLUSH_THREAD) == true && (dwb->file_sync_helper_daemon != NULL)
+	  && (dwb->file_sync_helper_daemon->is_running ()));
 #else
   return false;
 #endif /* SERVER_MODE */
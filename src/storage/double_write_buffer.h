@@ -28,6 +28,9 @@
 #include "file_io.h"
 #include "log_lsa.hpp"
 
+/* The maximum number of independent double write buffer instances. */
+#define DWB_MAX_INSTANCES		    8
+
 /* The double write slot type */
 typedef struct double_write_slot DWB_SLOT;
 struct double_write_slot
@@ -37,6 +40,7 @@ struct double_write_slot
   LOG_LSA lsa;			/* The page LSA */
   unsigned int position_in_block;	/* The position in block. */
   unsigned int block_no;	/* The number of the block where the slot reside. */
+  unsigned int instance_no;	/* The DWB instance owning the block. */
 };
 
 /* double write buffer interface */
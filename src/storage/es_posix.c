@@ -52,6 +52,9 @@
 /* es_posix_base_dir - */
 static char es_base_dir[PATH_MAX];
 
+/* least amount of the file that is read ahead after a read; the client reads a LOB in a sequence of small requests */
+#define ES_POSIX_READ_AHEAD_SIZE	(256 * 1024)	/* 256K */
+
 static void es_get_unique_name (char *dirname1, char *dirname2, const char *metaname, char *filename);
 static int es_make_dirs (const char *dirname1, const char *dirname2);
 static void es_rename_path (char *src, char *tgt, char *metaname);
@@ -377,6 +380,11 @@ xes_posix_write_file (const char *path, const void *buf, size_t count, off_t off
       buf = (char *) buf + nbytes;
       total += nbytes;
     }
+
+#if defined (HAVE_SYNC_FILE_RANGE)
+  /* start writing the data back now instead of leaving a large LOB dirty in the page cache; this does not wait */
+  (void) sync_file_range (fd, offset - total, total, SYNC_FILE_RANGE_WRITE);
+#endif /* HAVE_SYNC_FILE_RANGE */
   close (fd);
 
   return total;
@@ -416,8 +424,13 @@ xes_posix_read_file (const char *path, void *buf, size_t count, off_t offset)
 	}
     }
 
+#if !defined (WINDOWS)
+  (void) posix_fadvise (fd, offset, count, POSIX_FADV_SEQUENTIAL);
+#endif /* !WINDOWS */
+
   while (count > 0)
     {
+#if defined (WINDOWS)
       if (lseek (fd, offset, SEEK_SET) != offset)
 	{
 	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_ES_GENERAL, 2, "POSIX", path);
@@ -426,6 +439,9 @@ xes_posix_read_file (const char *path, void *buf, size_t count, off_t offset)
 	}
 
       nbytes = read (fd, buf, (unsigned) count);
+#else /* WINDOWS */
+      nbytes = pread (fd, buf, count, offset);
+#endif /* !WINDOWS */
       if (nbytes < 0)
 	{
 	  switch (errno)
@@ -451,6 +467,14 @@ xes_posix_read_file (const char *path, void *buf, size_t count, off_t offset)
       buf = (char *) buf + nbytes;
       total += nbytes;
     }
+
+#if !defined (WINDOWS)
+  if (count == 0)
+    {
+      /* the next request of the client most likely reads on from here; have the kernel read it meanwhile */
+      (void) posix_fadvise (fd, offset, MAX (total, ES_POSIX_READ_AHEAD_SIZE), POSIX_FADV_WILLNEED);
+    }
+#endif /* !WINDOWS */
   close (fd);
 
   return total;
@@ -490,9 +514,13 @@ int
 xes_posix_copy_file (const char *src_path, char *metaname, char *new_path)
 {
 #define ES_POSIX_COPY_BUFSIZE		(4096 * 4)	/* 16K */
+#define ES_POSIX_COPY_RANGE_SIZE	(64 * 1024 * 1024)	/* 64M */
 
   int rd_fd, wr_fd, n;
   ssize_t ret;
+#if defined (HAVE_COPY_FILE_RANGE)
+  ssize_t copied;
+#endif /* HAVE_COPY_FILE_RANGE */
   char dirname1[NAME_MAX], dirname2[NAME_MAX], filename[NAME_MAX];
   char buf[ES_POSIX_COPY_BUFSIZE];
 
@@ -560,6 +588,35 @@ retry:
       return ER_ES_GENERAL;
     }
 
+#if defined (HAVE_COPY_FILE_RANGE)
+  /* copy in the kernel; file systems that support it share the extents (reflink) instead of copying the data */
+  copied = 0;
+  do
+    {
+      ret = copy_file_range (rd_fd, NULL, wr_fd, NULL, ES_POSIX_COPY_RANGE_SIZE, 0);
+      if (ret > 0)
+	{
+	  copied += ret;
+	}
+    }
+  while (ret > 0 || (ret < 0 && errno == EINTR));
+
+  if (ret == 0)
+    {
+      close (rd_fd);
+      close (wr_fd);
+      return NO_ERROR;
+    }
+  else if (copied > 0 || (errno != EXDEV && errno != ENOSYS && errno != EINVAL && errno != EOPNOTSUPP))
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_ES_GENERAL, 2, "POSIX", new_path);
+      close (rd_fd);
+      close (wr_fd);
+      return ER_ES_GENERAL;
+    }
+  /* not supported between these files; copy through the buffer */
+#endif /* HAVE_COPY_FILE_RANGE */
+
   /* copy data */
   do
     {
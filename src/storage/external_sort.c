@@ -41,6 +41,7 @@
 #include "slotted_page.h"
 #include "overflow_file.h"
 #include "boot_sr.h"
+#include "query_manager.h"
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
@@ -117,6 +118,9 @@ struct vol_list
   VOL_INFO *vol_info;		/* array of volume information */
 };
 
+/* size of the packed error a sort worker hands to the sorting thread */
+#define SORT_PX_ERROR_AREA_SIZE 512
+
 /* Parallel eXecution and communition node */
 typedef struct px_tree_node PX_TREE_NODE;
 struct px_tree_node
@@ -124,6 +128,7 @@ struct px_tree_node
   int px_id;			/* node ID */
 #if defined(SERVER_MODE)
   int px_status;		/* node status; access through px_mtx */
+  bool px_started;		/* false while the node waits for a sort worker; access through px_mtx */
 #endif				/* SERVER_MODE */
 
   int px_height;		/* tournament tree: node level */
@@ -149,12 +154,14 @@ struct sort_param
   FILE_CONTENTS file_contents[2 * SORT_MAX_HALF_FILES];	/* Contents of each temporary file */
 
   bool tde_encrypted;		/* whether related temp files are encrypted (TDE) or not */
+  TDE_ALGORITHM tde_algo;	/* tde algorithm applied to the temp files, so writes need not fix the file header */
 
   VOL_LIST vol_list;		/* Temporary volume information list */
   char *internal_memory;	/* Internal_memory used for internal sorting phase and as input/output buffers for temp
 				 * files during merging phase */
   int tot_runs;			/* Total number of runs */
   int tot_buffers;		/* Size of internal memory used in terms of number of buffers it occupies */
+  UINT64 work_memory_size;	/* work memory granted to the sort, see qmgr_grant_work_memory */
   int tot_tempfiles;		/* Total number of temporary files */
   int half_files;		/* Half number of temporary files */
   int in_half;			/* Which half of temp files is for input */
@@ -179,19 +186,29 @@ struct sort_param
   /* support parallelism */
 #if defined(SERVER_MODE)
   pthread_mutex_t px_mtx;	/* px_node status mutex */
+  pthread_cond_t px_cond;	/* signaled when a px_node is done; wait on px_mtx */
+  int px_task_count;		/* tasks pushed to sort workers and not finished; access through px_mtx */
+  bool px_failed;		/* a partition failed, the others stop; set under px_mtx */
+  int px_error;			/* error of the first partition that failed */
+  int px_error_area_size;	/* size of px_error_area; 0 if the error was not set on the failing thread */
+  char px_error_area[SORT_PX_ERROR_AREA_SIZE];	/* packed error of the first partition that failed */
 #endif
   int px_height_max;		/* px_node tournament tree max level */
   int px_array_size;		/* px_node array size */
   PX_TREE_NODE *px_array;	/* px_node array */
 };
 
-typedef struct sort_rec_list SORT_REC_LIST;
-struct sort_rec_list
+typedef struct sort_loser_tree SORT_LOSER_TREE;
+struct sort_loser_tree
 {
-  struct sort_rec_list *next;	/* next sorted record item */
-  int rec_pos;			/* record position */
-  bool is_duplicated;		/* duplicated sort_key record flag */
-};				/* Sort record list */
+  int count;			/* number of merged input runs, the leaves of the tree */
+  int winner;			/* input run having the smallest current record */
+  int loser[SORT_MAX_HALF_FILES];	/* input run losing the match of each node; nodes are 1 .. count - 1 */
+  char **key[SORT_MAX_HALF_FILES];	/* current record of each input run; NULL once the run is finished */
+  bool is_duplicated[SORT_MAX_HALF_FILES];	/* current record of the input run equals a record that wins */
+  SORT_CMP_FUNC *compare;
+  void *compare_arg;
+};				/* Tournament of the current records of merged input runs */
 
 typedef struct slotted_pheader SLOTTED_PAGE_HEADER;
 struct slotted_pheader
@@ -241,26 +258,43 @@ struct sort_stack
 typedef void FIND_RUN_FN (char **, long *, SORT_STACK *, long, SORT_CMP_FUNC *, void *);
 typedef void MERGE_RUN_FN (char **, char **, SORT_STACK *, SORT_CMP_FUNC *, void *);
 
+#if defined(SERVER_MODE)
+// *INDENT-OFF*
+/* workers sorting the right-side partitions of all sorts */
+static cubthread::entry_workpool *sort_Px_workpool = NULL;
+// *INDENT-ON*
+#endif /* SERVER_MODE */
+
 #if !defined(NDEBUG)
 static int sort_validate (char **vector, long size, SORT_CMP_FUNC * compare, void *comp_arg);
 #endif
 static PX_TREE_NODE *px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, char **px_buff,
 				     char **px_vector, long px_vector_size, int px_height, int px_myself);
 static int px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
+static void px_sort_reset (SORT_PARAM * sort_param);
+static int px_sort_get_height (int parallelism);
 #if defined(SERVER_MODE)
-static int px_sort_communicate (PX_TREE_NODE * px_node);
+static bool px_sort_communicate (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
+static bool px_sort_is_stopped (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node);
+static void px_sort_set_error (SORT_PARAM * sort_param, int error);
 #endif
 
 static int sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FUNC * get_next,
 			      void *arguments, unsigned int *total_numrecs);
 static int sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param);
 static int sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param);
+static void sort_loser_tree_build (SORT_LOSER_TREE * tree, int count, SORT_CMP_FUNC * compare, void *compare_arg);
+static int sort_loser_tree_replay (SORT_LOSER_TREE * tree);
+static int sort_loser_tree_compare_losers (SORT_LOSER_TREE * tree, char **data);
+static int sort_loser_tree_play (SORT_LOSER_TREE * tree, int node);
+static int sort_loser_tree_match (SORT_LOSER_TREE * tree, int run1, int run2);
 static int sort_get_avg_numpages_of_nonempty_tmpfile (SORT_PARAM * sort_param);
 static void sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param);
 static int sort_add_new_file (THREAD_ENTRY * thread_p, VFID * vfid, int file_pg_cnt_est, bool force_alloc,
 			      bool tde_encrypted);
 
-static int sort_write_area (THREAD_ENTRY * thread_p, VFID * vfid, int first_page, INT32 num_pages, char *area_start);
+static int sort_write_area (THREAD_ENTRY * thread_p, VFID * vfid, int first_page, INT32 num_pages, char *area_start,
+			    TDE_ALGORITHM tde_algo);
 static int sort_read_area (THREAD_ENTRY * thread_p, VFID * vfid, int first_page, INT32 num_pages, char *area_start);
 
 static int sort_get_num_half_tmpfiles (int tot_buffers, int input_pages);
@@ -1340,21 +1374,20 @@ sort_run_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, char **base, lo
  *   includes_tde_class(in): whether tde-configured class data is included or not,
  *                           it determines whehter internal temp files are 
  *                           encrypted or not.
+ *   parallelism(in): number of threads that may sort the in-memory runs (server only); 1 sorts serially.
  */
 int
 sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GET_FUNC * get_fn, void *get_arg,
 	       SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn, void *cmp_arg, SORT_DUP_OPTION option,
-	       int limit, bool includes_tde_class)
+	       int limit, bool includes_tde_class, int parallelism)
 {
   int error = NO_ERROR;
   SORT_PARAM *sort_param = NULL;
-  bool prm_enable_sort_parallel = false;	/* TODO - PRM_SORT_PARALLEL_SORT */
   INT32 input_pages;
   int i;
   int file_pg_cnt_est;
   unsigned int total_numrecs = 0;
 #if defined(SERVER_MODE)
-  int num_cpus;
   int rv;
 #endif /* SERVER_MODE */
 
@@ -1383,6 +1416,19 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
 
       return error;
     }
+
+  rv = pthread_cond_init (&(sort_param->px_cond), NULL);
+  if (rv != 0)
+    {
+      error = ER_CSS_PTHREAD_COND_INIT;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
+
+      pthread_mutex_destroy (&(sort_param->px_mtx));
+      free_and_init (sort_param);
+
+      return error;
+    }
+  sort_param->px_task_count = 0;
 #endif /* SERVER_MODE */
 
   sort_param->cmp_fn = cmp_fn;
@@ -1402,6 +1448,7 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
       sort_param->file_contents[i].num_pages = NULL;
     }
   sort_param->internal_memory = NULL;
+  sort_param->work_memory_size = 0;
   sort_param->px_height_max = sort_param->px_array_size = 0;
   sort_param->px_array = NULL;
 
@@ -1427,8 +1474,12 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
       input_pages = prm_get_integer_value (PRM_ID_SR_NBUFFERS);
     }
 
-  /* The size of a sort buffer is limited to PRM_SR_NBUFFERS. */
-  sort_param->tot_buffers = MIN (prm_get_integer_value (PRM_ID_SR_NBUFFERS), input_pages);
+  /* The size of a sort buffer is granted from the work memory of the server; it is limited to PRM_SR_NBUFFERS when
+   * there is no such budget. */
+  sort_param->work_memory_size =
+    qmgr_grant_work_memory ((UINT64) input_pages * DB_PAGESIZE,
+			    (UINT64) prm_get_integer_value (PRM_ID_SR_NBUFFERS) * DB_PAGESIZE, 4 * DB_PAGESIZE);
+  sort_param->tot_buffers = (int) (sort_param->work_memory_size / DB_PAGESIZE);
   sort_param->tot_buffers = MAX (4, sort_param->tot_buffers);
 
   sort_param->internal_memory = (char *) malloc ((size_t) sort_param->tot_buffers * (size_t) DB_PAGESIZE);
@@ -1474,29 +1525,25 @@ sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GE
   sort_param->tmp_file_pgs = MAX (1, sort_param->tmp_file_pgs);
 
   sort_param->tde_encrypted = includes_tde_class;
+  sort_param->tde_algo = TDE_ALGORITHM_NONE;
+  if (sort_param->tde_encrypted)
+    {
+      sort_param->tde_algo = (TDE_ALGORITHM) prm_get_integer_value (PRM_ID_TDE_DEFAULT_ALGORITHM);
+    }
 
   sort_param->px_height_max = 0;	/* init */
   sort_param->px_array_size = 1;	/* init */
 
-#if 1				/* TODO - currently, disable parallelism */
-  prm_enable_sort_parallel = false;
-#endif
-
 #if !defined(NDEBUG)
   er_log_debug (ARG_FILE_LINE, "TDE: sort_listfile(): tde_encrypted = %d\n", sort_param->tde_encrypted);
 #endif /* !NDEBUG */
 
 #if defined(SERVER_MODE)
-  if (prm_enable_sort_parallel == true)
+  if (parallelism > 1 && sort_Px_workpool != NULL)
     {
-      /* TODO - calc n, 2^^n get the number of CPUs TODO - fileio_os_sysconf really get #cores instead of #CPUs -
-       * NEED MORE CONSIDERATION */
-      num_cpus = fileio_os_sysconf ();
-
-      sort_param->px_height_max = (int) sqrt ((double) num_cpus);	/* n */
-      sort_param->px_array_size = num_cpus;	/* 2^^n */
-
-      assert_release (sort_param->px_array_size == pow ((double) 2, (double) sort_param->px_height_max));
+      /* the caller sorts the left-most partition itself, the right-side partitions go to the sort workers */
+      sort_param->px_height_max = px_sort_get_height (parallelism);
+      sort_param->px_array_size = 1 << sort_param->px_height_max;	/* 2^^n */
     }
 #endif /* SERVER_MODE */
 
@@ -1660,6 +1707,7 @@ px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, cha
 #endif
 
   px_node->px_status = 0;
+  px_node->px_started = true;
 
   pthread_mutex_unlock (&(sort_param->px_mtx));
 #else /* SERVER_MODE */
@@ -1699,21 +1747,44 @@ px_sort_assign (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int px_id, cha
 static void
 px_sort_myself_execute (cubthread::entry &thread_ref, PX_TREE_NODE * px_node)
 {
-  (void) px_sort_myself (&thread_ref, px_node);
+  SORT_PARAM *sort_param = (SORT_PARAM *) (px_node->px_arg);
+  bool is_started;
+  int rv;
+
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  is_started = px_node->px_started;
+  px_node->px_started = true;
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
+  if (!is_started)
+    {
+      /* run on behalf of the sorting transaction; the worker context clears it when the task is retired */
+      thread_ref.tran_index = px_node->px_tran_index;
+
+      (void) px_sort_myself (&thread_ref, px_node);
+    }
+  /* else, the parent did not wait for a worker and sorted the partition itself */
+
+  /* sort_param must not be accessed once the count is down */
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  sort_param->px_task_count--;
+  pthread_cond_broadcast (&(sort_param->px_cond));
+  pthread_mutex_unlock (&(sort_param->px_mtx));
 }
 
 /*
- * px_sort_communicate() -
- *   return:
+ * px_sort_communicate() - hand a partition to the sort workers
+ *   return: true if a worker sorts the partition, false if the caller must sort it
  *   thread_p(in):
  *   px_node(in):
  *
  * NOTE: support parallelism
  */
-static int
-px_sort_communicate (PX_TREE_NODE * px_node)
+static bool
+px_sort_communicate (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 {
   SORT_PARAM *sort_param;
+  int rv;
 
   assert_release (px_node != NULL);
   assert_release (px_node->px_arg != NULL);
@@ -1723,14 +1794,181 @@ px_sort_communicate (PX_TREE_NODE * px_node)
   assert_release (px_node->px_id < sort_param->px_array_size);
   assert_release (px_node->px_vector_size > 1);
 
+  if (sort_Px_workpool == NULL)
+    {
+      return false;
+    }
+
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  px_node->px_started = false;
+  sort_param->px_task_count++;
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+
   cubthread::entry_callable_task *task =
     new cubthread::entry_callable_task (std::bind (px_sort_myself_execute, std::placeholders::_1, px_node));
-  css_push_external_task (css_get_current_conn_entry (), task);
+  if (!thread_get_manager ()->try_task (*thread_p, sort_Px_workpool, task))
+    {
+      /* all sort workers are busy */
+      task->retire ();
 
-  return NO_ERROR;
+      rv = pthread_mutex_lock (&(sort_param->px_mtx));
+      px_node->px_started = true;
+      sort_param->px_task_count--;
+      pthread_mutex_unlock (&(sort_param->px_mtx));
+
+      return false;
+    }
+
+  return true;
 }
 // *INDENT-ON*
+
+/*
+ * px_sort_is_stopped () - should the partition sort stop?
+ *   return: true if the sort is interrupted or another partition failed
+ *   thread_p(in):
+ *   px_node(in):
+ */
+static bool
+px_sort_is_stopped (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
+{
+  SORT_PARAM *sort_param = (SORT_PARAM *) (px_node->px_arg);
+  bool continue_checking = true;
+
+  if (sort_param->px_failed)
+    {
+      /* the error of the partition that failed is reported */
+      return true;
+    }
+
+  if (logtb_is_interrupted_tran (thread_p, false, &continue_checking, px_node->px_tran_index))
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+      return true;
+    }
+
+  return false;
+}
+
+/*
+ * px_sort_set_error () - save the error of a partition that failed
+ *   return: void
+ *   sort_param(in):
+ *   error(in): error code
+ *
+ * Note: only the first error is saved; it is reported by the sorting thread whichever thread had it.
+ */
+static void
+px_sort_set_error (SORT_PARAM * sort_param, int error)
+{
+  int rv;
+
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  if (!sort_param->px_failed)
+    {
+      sort_param->px_failed = true;
+      sort_param->px_error = error;
+      sort_param->px_error_area_size = 0;
+      if (er_errid () != NO_ERROR)
+	{
+	  sort_param->px_error_area_size = SORT_PX_ERROR_AREA_SIZE;
+	  (void) er_get_area_error (sort_param->px_error_area, &sort_param->px_error_area_size);
+	}
+    }
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+}
+#endif /* SERVER_MODE */
+
+/*
+ * px_sort_reset () - prepare the px_node tree for sorting a run
+ *   return: void
+ *   sort_param(in):
+ */
+static void
+px_sort_reset (SORT_PARAM * sort_param)
+{
+#if defined(SERVER_MODE)
+  int i;
+  int rv;
+
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  assert (rv == NO_ERROR);
+
+  for (i = 0; i < sort_param->px_array_size; i++)
+    {
+      sort_param->px_array[i].px_status = 0;	/* init */
+    }
+  sort_param->px_failed = false;
+  sort_param->px_error = NO_ERROR;
+  sort_param->px_error_area_size = 0;
+
+  pthread_mutex_unlock (&(sort_param->px_mtx));
 #endif /* SERVER_MODE */
+}
+
+/*
+ * px_sort_get_height () - get the height of the px_node tree for a parallelism
+ *   return: n, the tournament tree has 2^^n leaves
+ *   parallelism(in): maximum number of threads sorting a run
+ */
+static int
+px_sort_get_height (int parallelism)
+{
+  int height = 0;
+
+  /* use the largest n that does not exceed the requested parallelism */
+  while ((2 << height) <= parallelism)
+    {
+      height++;
+    }
+
+  return height;
+}
+
+/*
+ * sort_workers_initialize () - create the workers sorting the partitions of in-memory runs
+ *   return: NO_ERROR
+ *
+ * Note: without workers (SA_MODE or no parallelism configured), runs are sorted serially.
+ */
+int
+sort_workers_initialize (void)
+{
+#if defined(SERVER_MODE)
+  int parallelism, worker_count;
+
+  if (sort_Px_workpool != NULL)
+    {
+      return NO_ERROR;
+    }
+
+  parallelism = MAX (prm_get_integer_value (PRM_ID_IB_SORT_THREADS), prm_get_integer_value (PRM_ID_QUERY_SORT_THREADS));
+  worker_count = (1 << px_sort_get_height (parallelism)) - 1;
+  if (worker_count > 0)
+    {
+      /* sorts share the workers; a partition that does not find an idle worker is sorted by its parent */
+      sort_Px_workpool =
+	thread_get_manager ()->create_worker_pool (worker_count, worker_count, "sort_partition_workers", NULL, 1, false);
+    }
+#endif /* SERVER_MODE */
+
+  return NO_ERROR;
+}
+
+/*
+ * sort_workers_finalize () - destroy the sort workers
+ *   return: void
+ */
+void
+sort_workers_finalize (void)
+{
+#if defined(SERVER_MODE)
+  if (sort_Px_workpool != NULL)
+    {
+      thread_get_manager ()->destroy_worker_pool (sort_Px_workpool);
+    }
+#endif /* SERVER_MODE */
+}
 
 /*
  * px_sort_myself() -
@@ -1751,7 +1989,7 @@ px_sort_communicate (PX_TREE_NODE * px_node)
 static int
 px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 {
-#define SORT_PARTITION_RUN_SIZE_MIN (ONE_M)
+#define SORT_PARTITION_RUN_SIZE_MIN (8 * ONE_K)
 
   int ret = NO_ERROR;
   bool old_check_interrupt;
@@ -1767,6 +2005,7 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
 #endif /* SERVER_MODE */
 
   SORT_PARAM *sort_param;
+  bool is_root;
 
   char **buff;
   char **vector;
@@ -1785,15 +2024,9 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
     }
 
   sort_param = (SORT_PARAM *) (px_node->px_arg);
+  is_root = (px_node->px_id == 0 && px_node->px_height == sort_param->px_height_max);
 
 #if defined(SERVER_MODE)
-  if (px_node->px_id > 0)
-    {
-      /* is new childs */
-      thread_p->tran_index = px_node->px_tran_index;
-      pthread_mutex_unlock (&thread_p->tran_index_lock);
-    }
-
 #if !defined(NDEBUG)
   rv = pthread_mutex_lock (&(sort_param->px_mtx));
   assert (rv == NO_ERROR);
@@ -1848,6 +2081,11 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
       goto exit_on_end;
     }
 
+  if (px_sort_is_stopped (thread_p, px_node))
+    {
+      goto exit_on_error;
+    }
+
   if (px_node->px_height > 0 && vector_size > SORT_PARTITION_RUN_SIZE_MIN)
     {
       long left_vector_size, right_vector_size;
@@ -1874,9 +2112,10 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
       if (right_vector_size > 1)
 	{
 	  /* launch new worker */
-	  if (px_sort_communicate (right_px_node) != NO_ERROR)
+	  if (!px_sort_communicate (thread_p, right_px_node))
 	    {
-	      goto exit_on_error;
+	      /* no idle worker; sort it here */
+	      ret = px_sort_myself (thread_p, right_px_node);
 	    }
 	}
       else
@@ -1911,34 +2150,42 @@ px_sort_myself (THREAD_ENTRY * thread_p, PX_TREE_NODE * px_node)
       pthread_mutex_unlock (&(sort_param->px_mtx));
 #endif
 
-      if (left_vector_size > 1)
+      if (left_vector_size > 1 && ret == NO_ERROR)
 	{
-	  if (px_sort_myself (thread_p, left_px_node) != NO_ERROR)
-	    {
-	      goto exit_on_error;
-	    }
+	  /* on error, still wait for the right-child; it is working on our buffers */
+	  ret = px_sort_myself (thread_p, left_px_node);
 	}
 
       /* wait for right-child finished */
-      do
-	{
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
+      rv = pthread_mutex_lock (&(sort_param->px_mtx));
+      assert (rv == NO_ERROR);
 
-	  if (right_px_node->px_status != 0)
+      while (right_px_node->px_status == 0)
+	{
+	  if (!right_px_node->px_started)
 	    {
-	      assert (right_px_node->px_status == 1);
+	      /* its task still waits for a worker; do not wait for it, sort it here */
+	      right_px_node->px_started = true;
 	      pthread_mutex_unlock (&(sort_param->px_mtx));
-	      break;
+
+	      if (px_sort_myself (thread_p, right_px_node) != NO_ERROR && ret == NO_ERROR)
+		{
+		  ret = ER_FAILED;
+		}
+
+	      rv = pthread_mutex_lock (&(sort_param->px_mtx));
+	      continue;
 	    }
+	  pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
+	}
+      assert (right_px_node->px_status == 1);
 
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
+      pthread_mutex_unlock (&(sort_param->px_mtx));
 
-#if 1				/* TODO */
-	  thread_sleep (10);	/* 10 msec */
-#endif
+      if (ret != NO_ERROR || px_sort_is_stopped (thread_p, px_node))
+	{
+	  goto exit_on_error;
 	}
-      while (1);
 
       assert_release (px_node == left_px_node);
 #if !defined(NDEBUG)
@@ -2132,11 +2379,24 @@ exit_on_end:
 
       assert_release (px_node->px_status == 0);
       px_node->px_status = 1;	/* done */
+      pthread_cond_broadcast (&(sort_param->px_cond));
 
       pthread_mutex_unlock (&(sort_param->px_mtx));
     }
 #endif /* SERVER_MODE */
 
+#if defined(SERVER_MODE)
+  if (is_root && ret != NO_ERROR)
+    {
+      /* report the error of the first partition that failed, which may come from a sort worker */
+      if (sort_param->px_error_area_size > 0)
+	{
+	  (void) er_set_area_error (sort_param->px_error_area);
+	}
+      ret = sort_param->px_error;
+    }
+#endif /* SERVER_MODE */
+
   (void) logtb_set_check_interrupt (thread_p, old_check_interrupt);
 
   return ret;
@@ -2148,6 +2408,10 @@ exit_on_error:
 
   ret = (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 
+#if defined(SERVER_MODE)
+  px_sort_set_error (sort_param, ret);
+#endif /* SERVER_MODE */
+
   goto exit_on_end;
 }
 
@@ -2188,9 +2452,6 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
   int error = NO_ERROR;
 
   PX_TREE_NODE *px_node;
-#if defined (SERVER_MODE)
-  int rv = NO_ERROR;
-#endif /* SERVER_MODE */
 
   assert (sort_param->half_files <= SORT_MAX_HALF_FILES);
 
@@ -2272,17 +2533,7 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 		{
 		  assert (sort_param->px_height_max >= 0);
 		  assert (sort_param->px_array_size >= 1);
-#if defined(SERVER_MODE)
-		  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-		  assert (rv == NO_ERROR);
-
-		  for (i = 0; i < sort_param->px_array_size; i++)
-		    {
-		      sort_param->px_array[i].px_status = 0;	/* init */
-		    }
-
-		  pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif /* SERVER_MODE */
+		  px_sort_reset (sort_param);
 
 		  px_node = px_sort_assign (thread_p, sort_param, 0, index_buff, index_area, numrecs,
 					    sort_param->px_height_max, 0 /* px_myself: set as root */ );
@@ -2527,17 +2778,7 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 	{
 	  assert (sort_param->px_height_max >= 0);
 	  assert (sort_param->px_array_size >= 1);
-#if defined(SERVER_MODE)
-	  rv = pthread_mutex_lock (&(sort_param->px_mtx));
-	  assert (rv == NO_ERROR);
-
-	  for (i = 0; i < sort_param->px_array_size; i++)
-	    {
-	      sort_param->px_array[i].px_status = 0;	/* init */
-	    }
-
-	  pthread_mutex_unlock (&(sort_param->px_mtx));
-#endif /* SERVER_MODE */
+	  px_sort_reset (sort_param);
 
 	  px_node = px_sort_assign (thread_p, sort_param, 0, index_buff, index_area, numrecs, sort_param->px_height_max,
 				    0 /* px_myself: set as root */ );
@@ -2547,9 +2788,9 @@ sort_inphase_sort (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, SORT_GET_FU
 	      goto exit_on_error;
 	    }
 
-	  if (px_sort_myself (thread_p, px_node) != NO_ERROR)
+	  error = px_sort_myself (thread_p, px_node);
+	  if (error != NO_ERROR)
 	    {
-	      error = ER_FAILED;
 	      goto exit_on_error;
 	    }
 
@@ -2743,7 +2984,8 @@ sort_run_flush (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int out_file,
 	  if (sort_spage_insert (output_buffer, &out_recdes) == NULL_SLOTID)
 	    {
 	      /* Output buffer is full */
-	      error = sort_write_area (thread_p, &sort_param->temp[out_file], cur_page[out_file], 1, output_buffer);
+	      error = sort_write_area (thread_p, &sort_param->temp[out_file], cur_page[out_file], 1, output_buffer,
+				       sort_param->tde_algo);
 	      if (error != NO_ERROR)
 		{
 		  return error;
@@ -2769,7 +3011,8 @@ sort_run_flush (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param, int out_file,
   if (sort_spage_get_numrecs (output_buffer))
     {
       /* Flush the partially full output page */
-      error = sort_write_area (thread_p, &sort_param->temp[out_file], cur_page[out_file], 1, output_buffer);
+      error = sort_write_area (thread_p, &sort_param->temp[out_file], cur_page[out_file], 1, output_buffer,
+			       sort_param->tde_algo);
       if (error != NO_ERROR)
 	{
 	  return error;
@@ -2884,13 +3127,11 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
   bool very_last_run = false;
   int act;
   int cp_pages;
-  int cmp;
 
   SORT_CMP_FUNC *compare;
   void *compare_arg;
 
-  SORT_REC_LIST sr_list[SORT_MAX_HALF_FILES], *min_p, *s, *p;
-  int tmp_var;
+  SORT_LOSER_TREE tree;
   RECDES last_elem_ptr;		/* last element pointer in one page of input section */
   RECDES last_long_recdes;
 
@@ -2899,7 +3140,7 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
    * except last element */
   int last_elem_cmp;
 
-  char **data1, **data2;
+  char **data1;
   SORT_REC *sort_rec;
   int first_run;
 
@@ -3064,7 +3305,7 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 			  cur_page[act] += read_pages;
 			  error =
 			    sort_write_area (thread_p, &sort_param->temp[cur_outfile], cur_page[cur_outfile],
-					     read_pages, sort_param->internal_memory);
+					     read_pages, sort_param->internal_memory, sort_param->tde_algo);
 			  if (error != NO_ERROR)
 			    {
 			      goto bailout;
@@ -3149,71 +3390,22 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		}
 	    }
 
-	  /* linkage & init nodes */
-	  for (i = 0, p = sr_list; i < (act_infiles - 1); p = p->next)
-	    {
-	      p->next = (SORT_REC_LIST *) ((char *) p + sizeof (SORT_REC_LIST));
-	      p->rec_pos = i++;
-	      p->is_duplicated = false;
-	    }
-
-	  p->next = NULL;
-	  p->rec_pos = i;
-	  p->is_duplicated = false;
-
-	  /* sort sr_list */
-	  for (s = sr_list; s; s = s->next)
-	    {
-	      for (p = s->next; p; p = p->next)
-		{
-		  /* compare s, p */
-		  data1 = ((smallest_elem_ptr[s->rec_pos].type == REC_BIGONE)
-			   ? &(long_recdes[s->rec_pos].data) : &(smallest_elem_ptr[s->rec_pos].data));
-
-		  data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-			   ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-		  cmp = (*compare) (data1, data2, compare_arg);
-		  if (cmp > 0)
-		    {
-		      /* swap s, p's rec_pos */
-		      tmp_var = s->rec_pos;
-		      s->rec_pos = p->rec_pos;
-		      p->rec_pos = tmp_var;
-		    }
-		}
-	    }
-
-	  /* find duplicate */
-	  for (s = sr_list; s && s->next; s = s->next)
+	  /* build the tournament of the first records of the input runs; it marks the duplicated ones */
+	  for (i = 0; i < act_infiles; i++)
 	    {
-	      p = s->next;
-
-	      data1 = ((smallest_elem_ptr[s->rec_pos].type == REC_BIGONE)
-		       ? &(long_recdes[s->rec_pos].data) : &(smallest_elem_ptr[s->rec_pos].data));
-
-	      data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-		       ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-	      cmp = (*compare) (data1, data2, compare_arg);
-	      if (cmp == 0)
-		{
-		  p->is_duplicated = true;
-		}
+	      tree.key[i] = ((smallest_elem_ptr[i].type == REC_BIGONE)
+			     ? &(long_recdes[i].data) : &(smallest_elem_ptr[i].data));
 	    }
-
-	  /* set min_p to point the minimum record */
-	  min_p = sr_list;	/* min_p->rec_pos is the min record */
+	  sort_loser_tree_build (&tree, act_infiles, compare, compare_arg);
 
 	  /* last element comparison */
 	  last_elem_cmp = 1;
-	  p = min_p->next;	/* second smallest element */
 
-	  if (p)
+	  if (act_infiles > 1)
 	    {
 	      /* STEP 1: get last_elem */
-	      if (sort_spage_get_record (in_cur_bufaddr[min_p->rec_pos], (last_slot[min_p->rec_pos] - 1),
-					 &last_elem_ptr, PEEK) != S_SUCCESS)
+	      if (sort_spage_get_record (in_cur_bufaddr[tree.winner], (last_slot[tree.winner] - 1), &last_elem_ptr,
+					 PEEK) != S_SUCCESS)
 		{
 		  error = ER_SORT_TEMP_PAGE_CORRUPTED;
 		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
@@ -3231,13 +3423,10 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		    }
 		}
 
-	      /* STEP 2: compare last, p */
+	      /* STEP 2: compare last, the records beaten by the minimum record */
 	      data1 = ((last_elem_ptr.type == REC_BIGONE) ? &(last_long_recdes.data) : &(last_elem_ptr.data));
 
-	      data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-		       ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-	      last_elem_cmp = (*compare) (data1, data2, compare_arg);
+	      last_elem_cmp = sort_loser_tree_compare_losers (&tree, data1);
 	    }
 
 	  /* INITIALIZE OUTPUT SECTION AND OUTPUT VARIABLES */
@@ -3257,10 +3446,10 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 	      /* OUTPUT A RECORD */
 
 	      /* FIND MINIMUM RECORD IN THE INPUT AREA */
-	      min = min_p->rec_pos;
+	      min = tree.winner;
 
-	      /* min_p->is_duplicated == 1 then skip duplicated sort_key record */
-	      if (min_p->is_duplicated == false)
+	      /* skip the records equal to one already output */
+	      if (tree.is_duplicated[min] == false)
 		{
 		  /* we found first unique sort_key record */
 
@@ -3322,7 +3511,7 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 			      /* Flush output section */
 			      error =
 				sort_write_area (thread_p, &sort_param->temp[cur_outfile], cur_page[cur_outfile],
-						 out_sectsize, out_sectaddr);
+						 out_sectsize, out_sectaddr, sort_param->tde_algo);
 			      if (error != NO_ERROR)
 				{
 				  goto bailout;
@@ -3413,9 +3602,9 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		      else
 			{
 			  /* Current input run on this input file has finished */
-			  min_p = min_p->next;
+			  tree.key[min] = NULL;
 
-			  if (min_p == NULL)
+			  if (sort_loser_tree_replay (&tree) < 0)
 			    {
 			      /* all "smallest_elem_ptr" are NULL; so break */
 			      break;
@@ -3451,14 +3640,17 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		    }
 		}
 
-	      if ((act_slot[min_p->rec_pos] == last_slot[min_p->rec_pos] - 1) && (last_elem_cmp == 0))
+	      tree.key[min] = ((smallest_elem_ptr[min].type == REC_BIGONE)
+			       ? &(long_recdes[min].data) : &(smallest_elem_ptr[min].data));
+
+	      if ((act_slot[min] == last_slot[min] - 1) && (last_elem_cmp == 0))
 		{
 		  /* last duplicated element in input section page enters */
-		  min_p->is_duplicated = true;
+		  tree.is_duplicated[min] = true;
 		}
 	      else
 		{
-		  min_p->is_duplicated = false;
+		  tree.is_duplicated[min] = false;
 		}
 
 	      /* find minimum */
@@ -3469,56 +3661,17 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		}
 	      else
 		{
-		  for (s = min_p; s; s = s->next)
-		    {
-		      p = s->next;
-		      if (p == NULL)
-			{
-			  /* there is only one record */
-			  break;
-			}
-
-		      /* compare s, p */
-		      data1 = ((smallest_elem_ptr[s->rec_pos].type == REC_BIGONE)
-			       ? &(long_recdes[s->rec_pos].data) : &(smallest_elem_ptr[s->rec_pos].data));
-
-		      data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-			       ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-		      cmp = (*compare) (data1, data2, compare_arg);
-		      if (cmp > 0)
-			{
-			  /* swap s, p's rec_pos */
-			  tmp_var = s->rec_pos;
-			  s->rec_pos = p->rec_pos;
-			  p->rec_pos = tmp_var;
-
-			  /* swap s, p's is_duplicated */
-			  tmp_var = (int) s->is_duplicated;
-			  s->is_duplicated = p->is_duplicated;
-			  p->is_duplicated = (bool) tmp_var;
-			}
-		      else
-			{
-			  if (cmp == 0)
-			    {
-			      p->is_duplicated = true;	/* duplicated */
-			    }
-
-			  /* sr_list is completely sorted */
-			  break;
-			}
-		    }
+		  /* replay the matches of the input run; the records found equal to a winner are marked */
+		  (void) sort_loser_tree_replay (&tree);
 
 		  /* new input page is entered */
-		  if (act_slot[min_p->rec_pos] == 0)
+		  if (act_slot[tree.winner] == 0)
 		    {
 		      /* last element comparison */
-		      p = min_p->next;	/* second smallest element */
-		      if (p)
+		      if (act_infiles > 1)
 			{
 			  /* STEP 1: get last_elem */
-			  if (sort_spage_get_record (in_cur_bufaddr[min_p->rec_pos], (last_slot[min_p->rec_pos] - 1),
+			  if (sort_spage_get_record (in_cur_bufaddr[tree.winner], (last_slot[tree.winner] - 1),
 						     &last_elem_ptr, PEEK) != S_SUCCESS)
 			    {
 			      error = ER_SORT_TEMP_PAGE_CORRUPTED;
@@ -3537,14 +3690,11 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 				}
 			    }
 
-			  /* STEP 2: compare last, p */
+			  /* STEP 2: compare last, the records beaten by the minimum record */
 			  data1 = ((last_elem_ptr.type == REC_BIGONE)
 				   ? &(last_long_recdes.data) : &(last_elem_ptr.data));
 
-			  data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-				   ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-			  last_elem_cmp = (*compare) (data1, data2, compare_arg);
+			  last_elem_cmp = sort_loser_tree_compare_losers (&tree, data1);
 			}
 		    }
 		}
@@ -3557,7 +3707,7 @@ sort_exphase_merge_elim_dup (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 
 	      error =
 		sort_write_area (thread_p, &sort_param->temp[cur_outfile], cur_page[cur_outfile], out_act_bufno,
-				 out_sectaddr);
+				 out_sectaddr, sort_param->tde_algo);
 	      if (error != NO_ERROR)
 		{
 		  goto bailout;
@@ -3667,18 +3817,15 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
   SORT_CMP_FUNC *compare;
   void *compare_arg;
 
-  SORT_REC_LIST sr_list[SORT_MAX_HALF_FILES], *min_p, *s, *p;
-  int tmp_pos;			/* temporary value for rec_pos swapping */
-  bool do_swap;			/* rec_pos swapping indicator */
+  SORT_LOSER_TREE tree;
 
   RECDES last_elem_ptr;		/* last element pointers in one page of input section */
   RECDES last_long_recdes;
   bool last_elem_is_min;	/* false: must find min record true: last element in the current input section is min
 				 * record. no need to find min */
-  char **data1, **data2;
+  char **data1;
   SORT_REC *sort_rec;
   int first_run;
-  int cmp;
 
   error = NO_ERROR;
 
@@ -3843,7 +3990,7 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 			  cur_page[act] += read_pages;
 			  error =
 			    sort_write_area (thread_p, &sort_param->temp[cur_outfile], cur_page[cur_outfile],
-					     read_pages, sort_param->internal_memory);
+					     read_pages, sort_param->internal_memory, sort_param->tde_algo);
 			  if (error != NO_ERROR)
 			    {
 			      goto bailout;
@@ -3928,53 +4075,22 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		}
 	    }
 
-	  for (i = 0, p = sr_list; i < (act_infiles - 1); p = p->next)
+	  /* build the tournament of the first records of the input runs */
+	  for (i = 0; i < act_infiles; i++)
 	    {
-	      p->next = (SORT_REC_LIST *) ((char *) p + sizeof (SORT_REC_LIST));
-	      p->rec_pos = i++;
+	      tree.key[i] = ((smallest_elem_ptr[i].type == REC_BIGONE)
+			     ? &(long_recdes[i].data) : &(smallest_elem_ptr[i].data));
 	    }
-	  p->next = NULL;
-	  p->rec_pos = i;
-
-	  for (s = sr_list; s; s = s->next)
-	    {
-	      for (p = s->next; p; p = p->next)
-		{
-		  do_swap = false;
-
-		  data1 = ((smallest_elem_ptr[s->rec_pos].type == REC_BIGONE)
-			   ? &(long_recdes[s->rec_pos].data) : &(smallest_elem_ptr[s->rec_pos].data));
-
-		  data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-			   ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-		  cmp = (*compare) (data1, data2, compare_arg);
-		  if (cmp > 0)
-		    {
-		      do_swap = true;
-		    }
-
-		  if (do_swap)
-		    {
-		      tmp_pos = s->rec_pos;
-		      s->rec_pos = p->rec_pos;
-		      p->rec_pos = tmp_pos;
-		    }
-		}
-	    }
-
-	  /* set min_p to point minimum record */
-	  min_p = sr_list;	/* min_p->rec_pos is min record */
+	  sort_loser_tree_build (&tree, act_infiles, compare, compare_arg);
 
 	  /* last element comparison */
 	  last_elem_is_min = false;
-	  p = min_p->next;	/* second smallest element */
 
-	  if (p)
+	  if (act_infiles > 1)
 	    {
 	      /* STEP 1: get last_elem */
-	      if (sort_spage_get_record (in_cur_bufaddr[min_p->rec_pos], (last_slot[min_p->rec_pos] - 1),
-					 &last_elem_ptr, PEEK) != S_SUCCESS)
+	      if (sort_spage_get_record (in_cur_bufaddr[tree.winner], (last_slot[tree.winner] - 1), &last_elem_ptr,
+					 PEEK) != S_SUCCESS)
 		{
 		  error = ER_SORT_TEMP_PAGE_CORRUPTED;
 		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, error, 0);
@@ -3992,14 +4108,10 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		    }
 		}
 
-	      /* STEP 2: compare last, p */
+	      /* STEP 2: compare last, the records beaten by the minimum record */
 	      data1 = ((last_elem_ptr.type == REC_BIGONE) ? &(last_long_recdes.data) : &(last_elem_ptr.data));
 
-	      data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-		       ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-	      cmp = (*compare) (data1, data2, compare_arg);
-	      if (cmp <= 0)
+	      if (sort_loser_tree_compare_losers (&tree, data1) <= 0)
 		{
 		  last_elem_is_min = true;
 		}
@@ -4022,7 +4134,7 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 	      /* OUTPUT A RECORD */
 
 	      /* FIND MINIMUM RECORD IN THE INPUT AREA */
-	      min = min_p->rec_pos;
+	      min = tree.winner;
 
 	      if (very_last_run)
 		{
@@ -4081,7 +4193,7 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 			  /* Flush output section */
 			  error =
 			    sort_write_area (thread_p, &sort_param->temp[cur_outfile], cur_page[cur_outfile],
-					     out_sectsize, out_sectaddr);
+					     out_sectsize, out_sectaddr, sort_param->tde_algo);
 			  if (error != NO_ERROR)
 			    {
 			      goto bailout;
@@ -4166,9 +4278,9 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 			  /* Current input run on this input file has finished */
 
 			  /* remove current input run in input section. proceed to next minimum record. */
-			  min_p = min_p->next;
+			  tree.key[min] = NULL;
 
-			  if (min_p == NULL)
+			  if (sort_loser_tree_replay (&tree) < 0)
 			    {
 			      /* all "smallest_elem_ptr" are NULL; so break */
 			      break;
@@ -4204,6 +4316,9 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		    }
 		}
 
+	      tree.key[min] = ((smallest_elem_ptr[min].type == REC_BIGONE)
+			       ? &(long_recdes[min].data) : &(smallest_elem_ptr[min].data));
+
 	      /* find minimum */
 	      if (last_elem_is_min == true)
 		{
@@ -4212,52 +4327,17 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 		}
 	      else
 		{
-		  for (s = min_p; s; s = s->next)
-		    {
-		      p = s->next;
-		      if (p == NULL)
-			{
-			  /* there is only one record */
-			  break;
-			}
-
-		      do_swap = false;
-
-		      data1 = ((smallest_elem_ptr[s->rec_pos].type == REC_BIGONE)
-			       ? &(long_recdes[s->rec_pos].data) : &(smallest_elem_ptr[s->rec_pos].data));
-
-		      data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-			       ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-		      cmp = (*compare) (data1, data2, compare_arg);
-		      if (cmp > 0)
-			{
-			  do_swap = true;
-			}
-
-		      if (do_swap)
-			{
-			  /* swap s, p */
-			  tmp_pos = s->rec_pos;
-			  s->rec_pos = p->rec_pos;
-			  p->rec_pos = tmp_pos;
-			}
-		      else
-			{
-			  /* sr_list is completely sorted */
-			  break;
-			}
-		    }
+		  /* replay the matches of the input run */
+		  (void) sort_loser_tree_replay (&tree);
 
 		  /* new input page is entered */
-		  if (act_slot[min_p->rec_pos] == 0)
+		  if (act_slot[tree.winner] == 0)
 		    {
 		      /* last element comparison */
-		      p = min_p->next;	/* second smallest element */
-		      if (p)
+		      if (act_infiles > 1)
 			{
 			  /* STEP 1: get last_elem */
-			  if (sort_spage_get_record (in_cur_bufaddr[min_p->rec_pos], (last_slot[min_p->rec_pos] - 1),
+			  if (sort_spage_get_record (in_cur_bufaddr[tree.winner], (last_slot[tree.winner] - 1),
 						     &last_elem_ptr, PEEK) != S_SUCCESS)
 			    {
 			      error = ER_SORT_TEMP_PAGE_CORRUPTED;
@@ -4276,15 +4356,11 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 				}
 			    }
 
-			  /* STEP 2: compare last, p */
+			  /* STEP 2: compare last, the records beaten by the minimum record */
 			  data1 =
 			    ((last_elem_ptr.type == REC_BIGONE) ? &(last_long_recdes.data) : &(last_elem_ptr.data));
 
-			  data2 = ((smallest_elem_ptr[p->rec_pos].type == REC_BIGONE)
-				   ? &(long_recdes[p->rec_pos].data) : &(smallest_elem_ptr[p->rec_pos].data));
-
-			  cmp = (*compare) (data1, data2, compare_arg);
-			  if (cmp <= 0)
+			  if (sort_loser_tree_compare_losers (&tree, data1) <= 0)
 			    {
 			      last_elem_is_min = true;
 			    }
@@ -4300,7 +4376,7 @@ sort_exphase_merge (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 	      out_act_bufno++;	/* Since 0 refers to the first active buffer */
 	      error =
 		sort_write_area (thread_p, &sort_param->temp[cur_outfile], cur_page[cur_outfile], out_act_bufno,
-				 out_sectaddr);
+				 out_sectaddr, sort_param->tde_algo);
 	      if (error != NO_ERROR)
 		{
 		  goto bailout;
@@ -4357,6 +4433,164 @@ bailout:
   return (error == SORT_PUT_STOP) ? NO_ERROR : error;
 }
 
+/*
+ * sort_loser_tree_build () - build the tournament of the current records of the merged input runs
+ *   return: void
+ *   tree(in/out): tournament; the keys of the input runs are set by the caller
+ *   count(in): number of input runs
+ *   compare(in): comparison function of the records
+ *   compare_arg(in): argument of compare
+ *
+ * Note: the tree is a loser tree: each node keeps the input run losing the match between the winners of its subtrees,
+ *       so the next minimum record is found with log2 (count) comparisons, replaying the matches of the run that won.
+ */
+static void
+sort_loser_tree_build (SORT_LOSER_TREE * tree, int count, SORT_CMP_FUNC * compare, void *compare_arg)
+{
+  int i;
+
+  assert (count >= 1 && count <= SORT_MAX_HALF_FILES);
+
+  tree->count = count;
+  tree->compare = compare;
+  tree->compare_arg = compare_arg;
+  for (i = 0; i < count; i++)
+    {
+      tree->is_duplicated[i] = false;
+    }
+
+  /* node 1 is the root; the leaves, count .. 2 * count - 1, are the input runs */
+  tree->winner = sort_loser_tree_play (tree, 1);
+}
+
+/*
+ * sort_loser_tree_replay () - find the minimum record after the key of the winner changed
+ *   return: input run of the minimum record, or -1 if all input runs are finished
+ *   tree(in/out): tournament
+ */
+static int
+sort_loser_tree_replay (SORT_LOSER_TREE * tree)
+{
+  int candidate = tree->winner;
+  int winner;
+  int node;
+
+  /* only the matches on the path of the winner are replayed; the other results did not change */
+  for (node = (tree->count + candidate) / 2; node >= 1; node /= 2)
+    {
+      winner = sort_loser_tree_match (tree, candidate, tree->loser[node]);
+      if (winner != candidate)
+	{
+	  tree->loser[node] = candidate;
+	  candidate = winner;
+	}
+    }
+
+  tree->winner = candidate;
+
+  return (tree->key[candidate] == NULL) ? -1 : candidate;
+}
+
+/*
+ * sort_loser_tree_compare_losers () - compare a record with the records beaten by the minimum record
+ *   return: > 0 if any of them is smaller than data, 0 if the smallest of them equals data, < 0 otherwise
+ *   tree(in): tournament
+ *   data(in): record
+ *
+ * Note: the records beaten by the minimum record are the winners of the other subtrees, so the second smallest
+ *       record is one of them. The records of the winning input run up to data are the next minimum records when
+ *       data is not greater than all of them.
+ */
+static int
+sort_loser_tree_compare_losers (SORT_LOSER_TREE * tree, char **data)
+{
+  int result = -1;
+  int node;
+  int run;
+  int cmp;
+
+  for (node = (tree->count + tree->winner) / 2; node >= 1; node /= 2)
+    {
+      run = tree->loser[node];
+      if (tree->key[run] == NULL)
+	{
+	  /* finished input run */
+	  continue;
+	}
+
+      cmp = (*tree->compare) (data, tree->key[run], tree->compare_arg);
+      if (cmp > 0)
+	{
+	  return 1;
+	}
+      else if (cmp == 0)
+	{
+	  result = 0;
+	}
+    }
+
+  return result;
+}
+
+/*
+ * sort_loser_tree_play () - play the matches of a subtree of the tournament
+ *   return: input run winning the subtree
+ *   tree(in/out): tournament
+ *   node(in): root of the subtree
+ */
+static int
+sort_loser_tree_play (SORT_LOSER_TREE * tree, int node)
+{
+  int left, right, winner;
+
+  if (node >= tree->count)
+    {
+      /* leaf */
+      return node - tree->count;
+    }
+
+  left = sort_loser_tree_play (tree, 2 * node);
+  right = sort_loser_tree_play (tree, 2 * node + 1);
+
+  winner = sort_loser_tree_match (tree, left, right);
+  tree->loser[node] = (winner == left) ? right : left;
+
+  return winner;
+}
+
+/*
+ * sort_loser_tree_match () - compare the current records of two input runs
+ *   return: input run of the smaller record; run1 if they are equal
+ *   tree(in/out): tournament
+ *   run1(in):
+ *   run2(in):
+ *
+ * Note: a finished input run loses every match. When the records are equal, the one of run2 is marked duplicated:
+ *       it can not win before the record of run1 is output.
+ */
+static int
+sort_loser_tree_match (SORT_LOSER_TREE * tree, int run1, int run2)
+{
+  int cmp;
+
+  if (tree->key[run2] == NULL)
+    {
+      return run1;
+    }
+  if (tree->key[run1] == NULL)
+    {
+      return run2;
+    }
+
+  cmp = (*tree->compare) (tree->key[run1], tree->key[run2], tree->compare_arg);
+  if (cmp == 0)
+    {
+      tree->is_duplicated[run2] = true;
+    }
+
+  return (cmp <= 0) ? run1 : run2;
+}
+
 /* AUXILIARY FUNCTIONS */
 
 /*
@@ -4417,6 +4651,12 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
       free_and_init (sort_param->internal_memory);
     }
 
+  if (sort_param->work_memory_size > 0)
+    {
+      qmgr_release_work_memory (sort_param->work_memory_size);
+      sort_param->work_memory_size = 0;
+    }
+
   for (k = 0; k < sort_param->tot_tempfiles; k++)
     {
       if (sort_param->temp[k].volid != NULL_VOLID)
@@ -4438,6 +4678,16 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
 	}
     }
 
+#if defined(SERVER_MODE)
+  /* partitions sorted by their parents may still have their task in the queue of sort workers */
+  rv = pthread_mutex_lock (&(sort_param->px_mtx));
+  while (sort_param->px_task_count > 0)
+    {
+      pthread_cond_wait (&(sort_param->px_cond), &(sort_param->px_mtx));
+    }
+  pthread_mutex_unlock (&(sort_param->px_mtx));
+#endif
+
   if (sort_param->px_array)
     {
       free_and_init (sort_param->px_array);
@@ -4450,6 +4700,12 @@ sort_return_used_resources (THREAD_ENTRY * thread_p, SORT_PARAM * sort_param)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_MUTEX_DESTROY, 0);
     }
+
+  rv = pthread_cond_destroy (&(sort_param->px_cond));
+  if (rv != 0)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_CSS_PTHREAD_COND_DESTROY, 0);
+    }
 #endif
 
   free_and_init (sort_param);
@@ -4528,28 +4784,38 @@ sort_add_new_file (THREAD_ENTRY * thread_p, VFID * vfid, int file_pg_cnt_est, bo
  *   num_pages(in): size of the memory area in terms of number of pages it
  *                  accommodates
  *   area_start(in): beginning address of the area
+ *   tde_algo(in): tde algorithm applied to the file
  *
  * Note: This function writes the contents of the given memory area to the
  *       specified file starting from the given page. Before doing so, however,
  *       it checks the size of the file and, if necessary, allocates new pages.
  *       If new pages are needed but the disk is full, an error code is
  *       returned.
+ *
+ *       The pages are kept as plaintext in the page buffer. They are encrypted only when a victimized page is
+ *       actually flushed to the temp volume, so runs that never leave the buffer pool are never encrypted.
  */
 static int
-sort_write_area (THREAD_ENTRY * thread_p, VFID * vfid, int first_page, INT32 num_pages, char *area_start)
+sort_write_area (THREAD_ENTRY * thread_p, VFID * vfid, int first_page, INT32 num_pages, char *area_start,
+		 TDE_ALGORITHM tde_algo)
 {
   PAGE_PTR page_ptr = NULL;
   VPID vpid;
   INT32 page_no;
   int i;
   int ret = NO_ERROR;
-  TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
 
-  ret = file_get_tde_algorithm (thread_p, vfid, PGBUF_UNCONDITIONAL_LATCH, &tde_algo);
-  if (ret != NO_ERROR)
-    {
-      return ret;
-    }
+#if !defined(NDEBUG)
+  {
+    TDE_ALGORITHM file_tde_algo = TDE_ALGORITHM_NONE;
+
+    if (file_get_tde_algorithm (thread_p, vfid, PGBUF_UNCONDITIONAL_LATCH, &file_tde_algo) == NO_ERROR)
+      {
+	assert (file_tde_algo == tde_algo);
+      }
+  }
+#endif /* !NDEBUG */
+
   /* initializations */
   page_no = first_page;
 
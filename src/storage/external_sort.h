@@ -68,6 +68,8 @@ typedef struct SORT_INFO SORT_INFO;
 struct SORT_REC
 {
   SORT_REC *next;		/* forward link for duplicate sort_key value */
+  UINT64 key_prefix;		/* value of the first key normalized to compare as an unsigned integer; set only if
+				 * SORTKEY_INFO.use_key_prefix and the first key is not NULL */
   union
   {
     /* Bread crumbs back to the original tuple, so that we can go straight there after the keys have been sorted. */
@@ -128,6 +130,7 @@ struct SORTKEY_INFO
   SUBKEY_INFO *key;		/* Points to `default_keys' if `nkeys' <= 8; otherwise it points to malloc'ed space. */
   SUBKEY_INFO default_keys[8];	/* Default storage; this ought to work for most cases. */
   int error;			/* median domain convert errors */
+  bool use_key_prefix;		/* true iff the first key is normalized in SORT_REC.key_prefix */
 };
 
 struct SORT_INFO
@@ -144,6 +147,8 @@ struct SORT_INFO
 
 extern int sort_listfile (THREAD_ENTRY * thread_p, INT16 volid, int est_inp_pg_cnt, SORT_GET_FUNC * get_fn,
 			  void *get_arg, SORT_PUT_FUNC * put_fn, void *put_arg, SORT_CMP_FUNC * cmp_fn, void *cmp_arg,
-			  SORT_DUP_OPTION option, int limit, bool includes_tde_class);
+			  SORT_DUP_OPTION option, int limit, bool includes_tde_class, int parallelism);
+extern int sort_workers_initialize (void);
+extern void sort_workers_finalize (void);
 
 #endif /* _EXTERNAL_SORT_H_ */
@@ -70,6 +70,7 @@
 #include "chartype.h"
 #include "connection_globals.h"
 #include "file_io.h"
+#include "file_io_uring.h"
 #include "storage_common.h"
 #include "memory_alloc.h"
 #include "error_manager.h"
@@ -83,6 +84,7 @@
 #include "connection_error.h"
 #include "release_string.h"
 #include "log_common_impl.h"
+#include "log_storage.hpp"
 #include "log_volids.hpp"
 #include "fault_injection.h"
 #if defined (SERVER_MODE)
@@ -104,6 +106,7 @@
 #if !defined (CS_MODE)
 #include "double_write_buffer.h"
 #include "page_buffer.h"
+#include "page_track.h"
 #include "xserver_interface.h"
 #endif /* !defined (CS_MODE) */
 
@@ -157,6 +160,7 @@
 #define MSGCAT_FILEIO_BKUP_HDR_BKUP_PAGESIZE        27
 #define MSGCAT_FILEIO_BKUP_HDR_ZIP_INFO             28
 #define MSGCAT_FILEIO_BKUP_HDR_INC_ACTIVELOG        29
+#define MSGCAT_FILEIO_BKUP_HDR_TDE_MK               30
 
 #ifdef L_cuserid
 #define FILEIO_USER_NAME_SIZE L_cuserid
@@ -185,9 +189,17 @@
 #define FILEIO_GET_FILE_SIZE(pagesize, npages)  \
   (((off_t)(pagesize)) * ((off_t)(npages)))
 
+/* Untorn page writes need statx () to report the atomic write unit and pwritev2 () to request it */
+#if defined (LINUX) && defined (O_DIRECT) && defined (STATX_WRITE_ATOMIC) && defined (RWF_ATOMIC)
+#define FILEIO_ATOMIC_WRITE
+#endif /* LINUX && O_DIRECT && STATX_WRITE_ATOMIC && RWF_ATOMIC */
+
 #define FILEIO_BACKUP_NO_ZIP_HEADER_VERSION        1
-#define FILEIO_BACKUP_CURRENT_HEADER_VERSION       2
+#define FILEIO_BACKUP_NO_TDE_HEADER_VERSION        2
+#define FILEIO_BACKUP_CURRENT_HEADER_VERSION       3
 #define FILEIO_CHECK_FOR_INTERRUPT_INTERVAL       100
+/* pages the backup read threads may have read and compressed while the write thread is behind */
+#define FILEIO_BACKUP_MAX_QUEUED_NODES(r_threads)  ((r_threads) * 4)
 
 #define FILEIO_PAGE_SIZE_FULL_LEVEL (IO_PAGESIZE * FILEIO_FULL_LEVEL_EXP)
 #define FILEIO_BACKUP_PAGE_OVERHEAD \
@@ -384,6 +396,7 @@ struct fileio_volinfo
   VOLID volid;
   int vdes;
   FILEIO_LOCKF_TYPE lockf_type;
+  bool is_atomic_write;		/* pages are written untorn by the device, no need of double write buffer */
 #if defined(SERVER_MODE) && defined(WINDOWS)
   pthread_mutex_t vol_mutex;	/* for fileio_read()/fileio_write() */
 #endif				/* SERVER_MODE && WINDOWS */
@@ -510,6 +523,20 @@ static bool fileio_is_terminated_process (int pid);
 
 static ssize_t fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
 static ssize_t fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset);
+#if defined (LINUX) && defined (O_DIRECT)
+static ssize_t fileio_os_read_unaligned (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count,
+					 off_t offset);
+static ssize_t fileio_os_write_unaligned (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count,
+					  off_t offset);
+#endif /* LINUX && O_DIRECT */
+static ssize_t fileio_os_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, int npages,
+				 size_t page_size, off_t offset);
+static void *fileio_write_page_run (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id,
+				    int npages, size_t page_size, FILEIO_WRITE_MODE write_mode);
+static bool fileio_is_direct_io_volume (VOLID vol_id);
+static int fileio_open_volume (const char *vol_label_p, int flags, int mode, VOLID vol_id);
+static bool fileio_is_atomic_write_capable (int vol_fd);
+static FILEIO_VOLUME_INFO *fileio_get_volume_info (VOLID vol_id);
 #if !defined (WINDOWS)
 static ssize_t pwrite_with_injected_fault (THREAD_ENTRY * thread_p, int fd, const void *buf, size_t count,
 					   off_t offset);
@@ -523,7 +550,8 @@ static FILEIO_LOCKF_TYPE fileio_get_lockf_type (int vdes);
 
 static int fileio_get_primitive_way_max (const char *path, long int *filename_max, long int *pathname_max);
 static int fileio_flush_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session);
-static ssize_t fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, int pageid);
+static ssize_t fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, FILEIO_BACKUP_PAGE * area,
+				   int pageid);
 static int fileio_write_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, ssize_t towrite_nbytes);
 static int fileio_write_backup_header (FILEIO_BACKUP_SESSION * session);
 
@@ -552,7 +580,12 @@ static int fileio_decompress_restore_volume (THREAD_ENTRY * thread_p, FILEIO_BAC
 static FILEIO_NODE *fileio_allocate_node (FILEIO_QUEUE * qp, FILEIO_BACKUP_HEADER * backup_hdr);
 static FILEIO_NODE *fileio_free_node (FILEIO_QUEUE * qp, FILEIO_NODE * node);
 static FILEIO_NODE *fileio_delete_queue_head (FILEIO_QUEUE * qp);
-static int fileio_compress_backup_node (FILEIO_NODE * node, FILEIO_BACKUP_HEADER * backup_hdr);
+static int fileio_compress_backup_node (FILEIO_NODE * node, FILEIO_BACKUP_HEADER * backup_hdr, bool is_tde_page);
+static bool fileio_is_tde_backup_node (FILEIO_BACKUP_SESSION * session_p, FILEIO_NODE * node_p);
+#if !defined (CS_MODE)
+static bool fileio_is_unchanged_backup_page (FILEIO_BACKUP_SESSION * session_p, bool is_only_updated_pages,
+					     int page_id);
+#endif /* !CS_MODE */
 static int fileio_write_backup_node (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session, FILEIO_NODE * node,
 				     FILEIO_BACKUP_HEADER * backup_hdr);
 static char *fileio_ctime (INT64 * clock, char *buf);
@@ -578,7 +611,6 @@ static FILEIO_NODE *fileio_append_queue (FILEIO_QUEUE * qp, FILEIO_NODE * node);
 
 static void fileio_compensate_flush (THREAD_ENTRY * thread_p, int fd, int npage);
 static int fileio_increase_flushed_page_count (int npages);
-static int fileio_flush_control_get_token (THREAD_ENTRY * thread_p, int ntoken);
 static int fileio_flush_control_get_desired_rate (TOKEN_BUCKET * tb);
 static int fileio_synchronize_bg_archive_volume (THREAD_ENTRY * thread_p);
 
@@ -725,9 +757,10 @@ fileio_flush_control_finalize (void)
  *
  *   returns:
  *
- * Note:
+ * Note: Waits for ntoken flush tokens. Besides the compensate flush, it paces
+ *       the re-encryption by TDE data key rotation the same way.
  */
-static int
+int
 fileio_flush_control_get_token (THREAD_ENTRY * thread_p, int ntoken)
 {
 #if !defined(SERVER_MODE)
@@ -1004,6 +1037,7 @@ fileio_allocate_and_initialize_volume_info (FILEIO_VOLUME_HEADER * header_p, int
       vol_info_p[i].volid = NULL_VOLID;
       vol_info_p[i].vdes = NULL_VOLDES;
       vol_info_p[i].lockf_type = FILEIO_NOT_LOCKF;
+      vol_info_p[i].is_atomic_write = false;
       vol_info_p[i].vlabel[0] = '\0';
 #if defined(WINDOWS)
       pthread_mutex_init (&vol_info_p[i].vol_mutex, NULL);
@@ -1992,6 +2026,180 @@ fileio_open (const char *vol_label_p, int flags, int mode)
   return vol_fd;
 }
 
+/*
+ * fileio_is_direct_io_enabled () - is direct I/O used for the data and log volumes ?
+ *   return: true if use_direct_io is on and the platform supports it
+ */
+bool
+fileio_is_direct_io_enabled (void)
+{
+#if defined (LINUX) && defined (O_DIRECT)
+  return prm_get_bool_value (PRM_ID_USE_DIRECT_IO);
+#else /* LINUX && O_DIRECT */
+  return false;
+#endif /* LINUX && O_DIRECT */
+}
+
+/*
+ * fileio_is_direct_io_volume () - is the volume opened for direct I/O ?
+ *   return: true for permanent and temporary data volumes, active and archive logs and the double write volume when
+ *           direct I/O is enabled
+ *   vol_id(in): volume identifier
+ */
+static bool
+fileio_is_direct_io_volume (VOLID vol_id)
+{
+  if (!fileio_is_direct_io_enabled ())
+    {
+      return false;
+    }
+
+  return (vol_id >= LOG_DBFIRST_VOLID || vol_id == LOG_DBLOG_ACTIVE_VOLID || vol_id == LOG_DBLOG_ARCHIVE_VOLID
+	  || vol_id == LOG_DBLOG_BG_ARCHIVE_VOLID || vol_id == LOG_DBDWB_VOLID);
+}
+
+/*
+ * fileio_open_volume () - Open a volume, bypassing the OS page cache when direct I/O is enabled for it
+ *   return: volume descriptor identifier on success, NULL_VOLDES on failure
+ *   vol_label_p(in): Volume label
+ *   flags(in): open the volume as specified by the flags
+ *   mode(in): used when the volume is created
+ *   vol_id(in): Volume identifier
+ *
+ * Note: A file system that refuses O_DIRECT (tmpfs, for instance) gets a buffered descriptor instead.
+ */
+static int
+fileio_open_volume (const char *vol_label_p, int flags, int mode, VOLID vol_id)
+{
+#if defined (LINUX) && defined (O_DIRECT)
+  int vol_fd;
+
+  if (fileio_is_direct_io_volume (vol_id))
+    {
+      vol_fd = fileio_open (vol_label_p, flags | O_DIRECT, mode);
+      if (vol_fd != NULL_VOLDES || errno != EINVAL)
+	{
+	  return vol_fd;
+	}
+    }
+#endif /* LINUX && O_DIRECT */
+
+  return fileio_open (vol_label_p, flags, mode);
+}
+
+/*
+ * fileio_alloc_aligned_buffer () - Allocate a buffer that can be used for direct I/O
+ *   return: buffer aligned to FILEIO_DIRECT_IO_ALIGNMENT or NULL. Release it with free ().
+ *   size(in): size of the buffer
+ */
+void *
+fileio_alloc_aligned_buffer (size_t size)
+{
+#if defined (LINUX)
+  void *ptr = NULL;
+
+  if (posix_memalign (&ptr, FILEIO_DIRECT_IO_ALIGNMENT, size) != 0)
+    {
+      return NULL;
+    }
+  return ptr;
+#else /* LINUX */
+  return malloc (size);
+#endif /* LINUX */
+}
+
+/*
+ * fileio_is_atomic_write_capable () - can the device write a whole page of the volume untorn ?
+ *   return: true if the double write buffer may be bypassed for the volume
+ *   vol_fd(in): Volume descriptor
+ *
+ * Note: The kernel guarantees untorn writes only for direct I/O requests flagged with RWF_ATOMIC whose size lies
+ *       within the atomic write unit limits that statx () reports for the file.
+ */
+static bool
+fileio_is_atomic_write_capable (int vol_fd)
+{
+#if defined (FILEIO_ATOMIC_WRITE)
+  struct statx stx;
+  int flags;
+
+  if (!prm_get_bool_value (PRM_ID_DWB_ATOMIC_WRITE_BYPASS))
+    {
+      return false;
+    }
+
+  flags = fcntl (vol_fd, F_GETFL);
+  if (flags == -1 || (flags & O_DIRECT) == 0)
+    {
+      /* the file system refused direct I/O, or it is not enabled */
+      return false;
+    }
+
+  if (statx (vol_fd, "", AT_EMPTY_PATH, STATX_WRITE_ATOMIC, &stx) != 0 || (stx.stx_mask & STATX_WRITE_ATOMIC) == 0)
+    {
+      return false;
+    }
+
+  return (stx.stx_atomic_write_unit_min <= (unsigned int) IO_PAGESIZE
+	  && (unsigned int) IO_PAGESIZE <= stx.stx_atomic_write_unit_max);
+#else /* FILEIO_ATOMIC_WRITE */
+  return false;
+#endif /* FILEIO_ATOMIC_WRITE */
+}
+
+/*
+ * fileio_get_volume_info () - get the cached information of a permanent volume
+ *   return: volume information or NULL
+ *   vol_id(in): Volume identifier
+ */
+static FILEIO_VOLUME_INFO *
+fileio_get_volume_info (VOLID vol_id)
+{
+  FILEIO_CHECK_AND_INITIALIZE_VOLUME_HEADER_CACHE (NULL);
+
+  if (vol_id < LOG_DBFIRST_VOLID || vol_id >= fileio_Vol_info_header.next_temp_volid
+      || vol_id >= fileio_Vol_info_header.max_perm_vols)
+    {
+      return NULL;
+    }
+
+  return &fileio_Vol_info_header.volinfo[vol_id / FILEIO_VOLINFO_INCREMENT][vol_id % FILEIO_VOLINFO_INCREMENT];
+}
+
+/*
+ * fileio_is_volume_atomic_write () - are the pages of the volume written atomically ?
+ *   return: true if pages of the volume are written with fileio_write_atomic
+ *   vol_id(in): Volume identifier
+ */
+bool
+fileio_is_volume_atomic_write (VOLID vol_id)
+{
+  FILEIO_VOLUME_INFO *vol_info_p = fileio_get_volume_info (vol_id);
+
+  return vol_info_p != NULL && vol_info_p->is_atomic_write;
+}
+
+/*
+ * fileio_get_num_atomic_write_volumes () - count the mounted volumes whose pages are written atomically
+ *   return: number of volumes
+ */
+int
+fileio_get_num_atomic_write_volumes (void)
+{
+  VOLID vol_id;
+  int count = 0;
+
+  for (vol_id = LOG_DBFIRST_VOLID; vol_id < fileio_Vol_info_header.next_perm_volid; vol_id++)
+    {
+      if (fileio_is_volume_atomic_write (vol_id))
+	{
+	  count++;
+	}
+    }
+
+  return count;
+}
+
 #if !defined(WINDOWS)
 /*
  * fileio_set_permission () -
@@ -2160,7 +2368,7 @@ fileio_create (THREAD_ENTRY * thread_p, const char *db_full_name_p, const char *
 	}
     }
 
-  vol_fd = fileio_open (vol_label_p, FILEIO_DISK_FORMAT_MODE | o_sync, FILEIO_DISK_PROTECTION_MODE);
+  vol_fd = fileio_open_volume (vol_label_p, FILEIO_DISK_FORMAT_MODE | o_sync, FILEIO_DISK_PROTECTION_MODE, vol_id);
   if (vol_fd == NULL_VOLDES)
     {
       er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_FORMAT_FAIL, 3, vol_label_p, -1, -1LL);
@@ -2397,7 +2605,7 @@ fileio_format (THREAD_ENTRY * thread_p, const char *db_full_name_p, const char *
       return NULL_VOLDES;
     }
 
-  malloc_io_page_p = (FILEIO_PAGE *) malloc (page_size);
+  malloc_io_page_p = (FILEIO_PAGE *) fileio_alloc_aligned_buffer (page_size);
   if (malloc_io_page_p == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, page_size);
@@ -2832,7 +3040,7 @@ fileio_copy_volume (THREAD_ENTRY * thread_p, int from_vol_desc, DKNPAGES npages,
     }
 
   /* Don't read the pages from the page buffer pool but directly from disk */
-  malloc_io_page_p = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
+  malloc_io_page_p = (FILEIO_PAGE *) fileio_alloc_aligned_buffer (IO_PAGESIZE);
   if (malloc_io_page_p == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
@@ -2908,7 +3116,7 @@ fileio_reset_volume (THREAD_ENTRY * thread_p, int vol_fd, const char *vlabel, DK
   int success = NO_ERROR;
   bool skip_flush = false;
 
-  malloc_io_page_p = (FILEIO_PAGE *) malloc (IO_PAGESIZE);
+  malloc_io_page_p = (FILEIO_PAGE *) fileio_alloc_aligned_buffer (IO_PAGESIZE);
   if (malloc_io_page_p == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) IO_PAGESIZE);
@@ -3024,7 +3232,7 @@ fileio_mount (THREAD_ENTRY * thread_p, const char *db_full_name_p, const char *v
 
   /* OPEN THE DISK VOLUME PARTITION OR FILE SIMULATED VOLUME */
 start:
-  vol_fd = fileio_open (vol_label_p, O_RDWR | o_sync, 0600);
+  vol_fd = fileio_open_volume (vol_label_p, O_RDWR | o_sync, 0600, vol_id);
   if (vol_fd == NULL_VOLDES)
     {
       er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_MOUNT_FAIL, 1, vol_label_p);
@@ -3884,6 +4092,13 @@ fileio_get_volume_mutex (THREAD_ENTRY * thread_p, int vdes)
 static ssize_t
 fileio_os_read (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
 {
+#if defined (LINUX) && defined (O_DIRECT)
+  if (!FILEIO_IS_DIRECT_IO_ALIGNED (io_page_p) && fileio_is_direct_io_enabled ())
+    {
+      return fileio_os_read_unaligned (thread_p, vol_fd, io_page_p, count, offset);
+    }
+#endif /* LINUX && O_DIRECT */
+
 #if !defined (SERVER_MODE)
   /* Locate the desired page */
   if (lseek (vol_fd, offset, SEEK_SET) != offset)
@@ -4086,6 +4301,13 @@ fileio_write_or_add_to_dwb (THREAD_ENTRY * thread_p, int vol_fd, FILEIO_PAGE * i
 static ssize_t
 fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
 {
+#if defined (LINUX) && defined (O_DIRECT)
+  if (!FILEIO_IS_DIRECT_IO_ALIGNED (io_page_p) && fileio_is_direct_io_enabled ())
+    {
+      return fileio_os_write_unaligned (thread_p, vol_fd, io_page_p, count, offset);
+    }
+#endif /* LINUX && O_DIRECT */
+
 #if !defined (SERVER_MODE)
   if (lseek (vol_fd, offset, SEEK_SET) != offset)
     {
@@ -4134,6 +4356,121 @@ fileio_os_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t co
 #endif
 }
 
+#if defined (LINUX) && defined (O_DIRECT)
+/*
+ * fileio_os_read_unaligned () - helper for fileio_os_read when the caller's buffer is not aligned for direct I/O
+ *   return: the number of bytes read is returned. On error, error code.
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(out): Address where content of page is stored. Must be of page_size long
+ *   count(in): the number of bytes to be read
+ *   offset(in): starting file offset
+ *
+ * Note: The page, log and double write buffers are aligned; callers that read into their own page copies go
+ *       through an aligned bounce buffer.
+ */
+static ssize_t
+fileio_os_read_unaligned (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
+{
+  void *aligned_page_p;
+  ssize_t nbytes;
+
+  aligned_page_p = fileio_alloc_aligned_buffer (count);
+  if (aligned_page_p == NULL)
+    {
+      errno = ENOMEM;
+      return ER_FAILED;
+    }
+
+  nbytes = fileio_os_read (thread_p, vol_fd, aligned_page_p, count, offset);
+  if (nbytes > 0)
+    {
+      memcpy (io_page_p, aligned_page_p, nbytes);
+    }
+
+  free (aligned_page_p);
+  return nbytes;
+}
+
+/*
+ * fileio_os_write_unaligned () - helper for fileio_os_write when the caller's buffer is not aligned for direct I/O
+ *   return: the number of bytes written is returned. On error, error code.
+ *   vol_fd(in): Volume descriptor
+ *   io_page_p(in): In-memory address where the current content of page resides
+ *   count(in): the number of bytes to be written
+ *   offset(in): starting file offset
+ */
+static ssize_t
+fileio_os_write_unaligned (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, size_t count, off_t offset)
+{
+  void *aligned_page_p;
+  ssize_t nbytes;
+
+  aligned_page_p = fileio_alloc_aligned_buffer (count);
+  if (aligned_page_p == NULL)
+    {
+      errno = ENOMEM;
+      return ER_FAILED;
+    }
+
+  memcpy (aligned_page_p, io_page_p, count);
+  nbytes = fileio_os_write (thread_p, vol_fd, aligned_page_p, count, offset);
+
+  free (aligned_page_p);
+  return nbytes;
+}
+#endif /* LINUX && O_DIRECT */
+
+/*
+ * fileio_os_writev () - helper for fileio_write_page_run
+ *   return: the number of bytes written is returned. On error, or when a vectored write can't be used, ER_FAILED.
+ *   vol_fd(in): Volume descriptor
+ *   io_page_array(in): Pages to write
+ *   npages(in): Number of pages, at most FILEIO_WRITEV_MAX_PAGES
+ *   page_size(in): Page size
+ *   offset(in): starting file offset
+ */
+static ssize_t
+fileio_os_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, int npages, size_t page_size,
+		  off_t offset)
+{
+#if defined (WINDOWS)
+  return ER_FAILED;
+#else /* WINDOWS */
+  struct iovec iov[FILEIO_WRITEV_MAX_PAGES];
+  ssize_t nbytes;
+  int i;
+
+  assert (npages <= FILEIO_WRITEV_MAX_PAGES);
+
+#if defined (SERVER_MODE) && !defined (NDEBUG)
+  if (FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS1) || FI_INSERTED (FI_TEST_FILE_IO_WRITE_PARTS2))
+    {
+      /* let the page writes inject their partial writes */
+      return ER_FAILED;
+    }
+#endif /* SERVER_MODE && !NDEBUG */
+
+  for (i = 0; i < npages; i++)
+    {
+      if (!FILEIO_IS_DIRECT_IO_ALIGNED (io_page_array[i]) && fileio_is_direct_io_enabled ())
+	{
+	  /* unaligned pages go through the bounce buffer of fileio_os_write */
+	  return ER_FAILED;
+	}
+      iov[i].iov_base = io_page_array[i];
+      iov[i].iov_len = page_size;
+    }
+
+  do
+    {
+      nbytes = pwritev (vol_fd, iov, npages, offset);
+    }
+  while (nbytes < 0 && errno == EINTR);
+
+  return nbytes;
+#endif /* WINDOWS */
+}
+
 /*
  * fileio_write () - WRITE A PAGE TO DISK
  *   return: io_page_p on success, NULL on failure
@@ -4220,6 +4557,154 @@ fileio_write (THREAD_ENTRY * thread_p, int vol_fd, void *io_page_p, PAGEID page_
   return io_page_p;
 }
 
+/*
+ * fileio_write_atomic () - WRITE A PAGE TO DISK WITHOUT THE RISK OF A TORN WRITE
+ *   return: io_page_p on success, NULL on failure
+ *   vol_id(in): Volume identifier, reported by fileio_is_volume_atomic_write ()
+ *   io_page_p(in): In-memory address where the current content of page resides
+ *   page_id(in): Page identifier
+ *   page_size(in): Page size
+ *
+ * Note: If the device refuses the atomic write, the volume loses the property and NULL is returned without setting
+ *       an error. The caller must then write the page with the protection of the double write buffer.
+ */
+void *
+fileio_write_atomic (THREAD_ENTRY * thread_p, VOLID vol_id, void *io_page_p, PAGEID page_id, size_t page_size)
+{
+#if defined (FILEIO_ATOMIC_WRITE)
+  FILEIO_VOLUME_INFO *vol_info_p = fileio_get_volume_info (vol_id);
+  void *aligned_page_p = NULL;
+  struct iovec iov;
+  ssize_t nbytes_written;
+  off_t offset = FILEIO_GET_FILE_SIZE (page_size, page_id);
+
+  if (vol_info_p == NULL || !vol_info_p->is_atomic_write)
+    {
+      assert (false);
+      return NULL;
+    }
+
+  iov.iov_base = io_page_p;
+  iov.iov_len = page_size;
+  if (!FILEIO_IS_DIRECT_IO_ALIGNED (io_page_p))
+    {
+      aligned_page_p = fileio_alloc_aligned_buffer (page_size);
+      if (aligned_page_p == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, page_size);
+	  return NULL;
+	}
+      memcpy (aligned_page_p, io_page_p, page_size);
+      iov.iov_base = aligned_page_p;
+    }
+
+  do
+    {
+      nbytes_written = pwritev2 (vol_info_p->vdes, &iov, 1, offset, RWF_ATOMIC);
+    }
+  while (nbytes_written < 0 && errno == EINTR);
+
+  if (aligned_page_p != NULL)
+    {
+      free (aligned_page_p);
+    }
+
+  if (nbytes_written != (ssize_t) page_size)
+    {
+      if (nbytes_written < 0 && (errno == EOPNOTSUPP || errno == EINVAL))
+	{
+	  /* the device no longer accepts atomic writes; give the volume back to the double write buffer */
+	  vol_info_p->is_atomic_write = false;
+	  return NULL;
+	}
+      else if (nbytes_written < 0 && errno == ENOSPC)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE_OUT_OF_SPACE, 2, page_id, vol_info_p->vlabel);
+	  return NULL;
+	}
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, page_id, vol_info_p->vlabel);
+      return NULL;
+    }
+
+  fileio_compensate_flush (thread_p, vol_info_p->vdes, 1);
+  perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_IOWRITES);
+
+  return io_page_p;
+#else /* FILEIO_ATOMIC_WRITE */
+  assert (false);
+  return NULL;
+#endif /* FILEIO_ATOMIC_WRITE */
+}
+
+/*
+ * fileio_write_page_batch () - WRITE A BATCH OF INDEPENDENT PAGES TO DISK
+ *   return: NO_ERROR or error code
+ *   thread_p(in): Thread entry
+ *   requests(in/out): Pages to write; the pages may belong to different volumes
+ *   count(in): Number of pages
+ *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush
+ *
+ * Note: When data_volume_io_uring is on the pages are submitted to io_uring together and the kernel writes them
+ *       concurrently. Pages the engine could not write, or every page when the engine is off or busy, are written
+ *       one by one with fileio_write which reports the error.
+ */
+int
+fileio_write_page_batch (THREAD_ENTRY * thread_p, FILEIO_PAGE_REQUEST * requests, int count,
+			 FILEIO_WRITE_MODE write_mode)
+{
+  void *run_pages[FILEIO_WRITEV_MAX_PAGES];
+  bool is_submitted = false;
+  int i, j, run_end, error_code = NO_ERROR;
+
+  if (count > 1 && fileio_uring_submit (thread_p, requests, count, true) == NO_ERROR)
+    {
+      is_submitted = true;
+    }
+
+  for (i = 0; i < count; i = run_end)
+    {
+      run_end = i + 1;
+
+      if (is_submitted && requests[i].error == 0)
+	{
+	  if (write_mode == FILEIO_WRITE_DEFAULT_WRITE)
+	    {
+	      fileio_compensate_flush (thread_p, requests[i].vol_fd, 1);
+	    }
+	  perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_IOWRITES);
+	  continue;
+	}
+
+      if (!is_submitted)
+	{
+	  /* adjacent pages of the same volume are written together */
+	  while (run_end < count && run_end - i < FILEIO_WRITEV_MAX_PAGES && requests[run_end].vol_fd == requests[i].vol_fd
+		 && requests[run_end].page_size == requests[i].page_size
+		 && requests[run_end].page_id == requests[run_end - 1].page_id + 1)
+	    {
+	      run_end++;
+	    }
+	}
+
+      for (j = i; j < run_end; j++)
+	{
+	  run_pages[j - i] = requests[j].io_page_p;
+	}
+      if (fileio_write_page_run (thread_p, requests[i].vol_fd, run_pages, requests[i].page_id, run_end - i,
+				 requests[i].page_size, write_mode) == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+      for (j = i; j < run_end; j++)
+	{
+	  requests[j].error = 0;
+	}
+    }
+
+  return NO_ERROR;
+}
+
 /*
  * fileio_read_pages () -
  */
@@ -4395,29 +4880,74 @@ fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEI
  * fileio_writev () - WRITE A SET OF CONTIGUOUS PAGES TO DISK
  *   return: io_pgptr on success, NULL on failure
  *   vol_fd(in): Volume descriptor
- *   arrayof_io_pgptr(in): An array address to address where the current content of pages reside
- *   start_page_id(in): Page identifier of first page
- *   npages(in): Number of consecutive pages
+ *   arrayof_io_pgptr(in): An array address to address where the current content of pages reside
+ *   start_page_id(in): Page identifier of first page
+ *   npages(in): Number of consecutive pages
+ *   page_size(in): Page size
+ *
+ * Note: Write the content of the consecutive pages described by start_pageid to disk. The content of the pages are
+ *       address by the io_pgptr array. Each io_pgptr buffer is page size long.
+ *
+ *            io_pgptr[0]  -->> start_pageid
+ *            io_pgptr[1]  -->> start_pageid + 1
+ *                        ...
+ *            io_pgptr[npages - 1] -->> start_pageid + npages - 1
+ */
+void *
+fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id, DKNPAGES npages,
+	       size_t page_size)
+{
+  int i, run_npages;
+  FILEIO_WRITE_MODE write_mode = FILEIO_WRITE_DEFAULT_WRITE;
+
+#if !defined (CS_MODE)
+  write_mode = dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE;
+#endif
+
+  for (i = 0; i < npages; i += run_npages)
+    {
+      run_npages = MIN (npages - i, FILEIO_WRITEV_MAX_PAGES);
+      if (fileio_write_page_run (thread_p, vol_fd, &io_page_array[i], start_page_id + i, run_npages, page_size,
+				 write_mode) == NULL)
+	{
+	  return NULL;
+	}
+    }
+
+  return io_page_array[0];
+}
+
+/*
+ * fileio_write_page_run () - write pages that are adjacent on disk with one vectored write
+ *   return: io_page_array[0] on success, NULL on failure
+ *   vol_fd(in): Volume descriptor
+ *   io_page_array(in): Pages to write; they may be anywhere in memory
+ *   start_page_id(in): Page identifier of the first page
+ *   npages(in): Number of pages, at most FILEIO_WRITEV_MAX_PAGES
  *   page_size(in): Page size
+ *   write_mode(in): FILEIO_WRITE_NO_COMPENSATE_WRITE skips page flush
  *
- * Note: Write the content of the consecutive pages described by start_pageid to disk. The content of the pages are
- *       address by the io_pgptr array. Each io_pgptr buffer is page size long.
- *
- *            io_pgptr[0]  -->> start_pageid
- *            io_pgptr[1]  -->> start_pageid + 1
- *                        ...
- *            io_pgptr[npages - 1] -->> start_pageid + npages - 1
+ * Note: If the vectored write is not possible or does not complete, the pages are written again one by one, which
+ *       also reports the error.
  */
-void *
-fileio_writev (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id, DKNPAGES npages,
-	       size_t page_size)
+static void *
+fileio_write_page_run (THREAD_ENTRY * thread_p, int vol_fd, void **io_page_array, PAGEID start_page_id, int npages,
+		       size_t page_size, FILEIO_WRITE_MODE write_mode)
 {
   int i;
-  FILEIO_WRITE_MODE write_mode = FILEIO_WRITE_DEFAULT_WRITE;
 
-#if !defined (CS_MODE)
-  write_mode = dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE;
-#endif
+  if (npages > 1
+      && fileio_os_writev (thread_p, vol_fd, io_page_array, npages, page_size,
+			   FILEIO_GET_FILE_SIZE (page_size, start_page_id)) == (ssize_t) (page_size * npages))
+    {
+      if (write_mode == FILEIO_WRITE_DEFAULT_WRITE)
+	{
+	  fileio_compensate_flush (thread_p, vol_fd, npages);
+	}
+      perfmon_add_stat (thread_p, PSTAT_FILE_NUM_IOWRITES, npages);
+      perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_IOWRITEVS);
+      return io_page_array[0];
+    }
 
   for (i = 0; i < npages; i++)
     {
@@ -5818,6 +6348,25 @@ fileio_make_log_info_name (char *log_info_name_p, const char *log_path_p, const
 	   FILEIO_SUFFIX_LOGINFO);
 }
 
+/*
+ * fileio_make_restart_stats_name () - Build the name of the file the restart statistics of crash recovery are
+ *                                     appended to
+ *   return: void
+ *   stats_name_p(out):
+ *   log_path_p(in):
+ *   db_name_p(in):
+ *
+ * Note: The caller must have enough space to store the name of the file
+ *       that is constructed(sprintf). It is recommended to have at least
+ *       DB_MAX_PATH_LENGTH length.
+ */
+void
+fileio_make_restart_stats_name (char *stats_name_p, const char *log_path_p, const char *db_name_p)
+{
+  sprintf (stats_name_p, "%s%s%s%s", log_path_p, FILEIO_PATH_SEPARATOR (log_path_p), db_name_p,
+	   FILEIO_SUFFIX_RESTART_STATS);
+}
+
 /*
  * fileio_make_backup_volume_info_name () - Build the name of volumes
  *   return: void
@@ -5883,6 +6432,29 @@ fileio_make_dwb_name (char *dwb_name_p, const char *dwb_path_p, const char *db_n
   sprintf (dwb_name_p, "%s%s%s%s", dwb_path_p, FILEIO_PATH_SEPARATOR (dwb_path_p), db_name_p, FILEIO_SUFFIX_DWB);
 }
 
+/*
+ * fileio_make_dwb_instance_name () - Build the name of a DWB instance volume
+ *   return: void
+ *   dwb_name_p(out): the name of DWB instance volume
+ *   dwb_path_p(in): double write buffer path
+ *   dbname(in): database name
+ *   instance_no(in): the DWB instance number
+ *
+ * Note: The first instance uses the name of DWB volume, so that a single DWB keeps its name.
+ */
+void
+fileio_make_dwb_instance_name (char *dwb_name_p, const char *dwb_path_p, const char *db_name_p, int instance_no)
+{
+  if (instance_no == 0)
+    {
+      fileio_make_dwb_name (dwb_name_p, dwb_path_p, db_name_p);
+      return;
+    }
+
+  sprintf (dwb_name_p, "%s%s%s%s%d", dwb_path_p, FILEIO_PATH_SEPARATOR (dwb_path_p), db_name_p, FILEIO_SUFFIX_DWB,
+	   instance_no);
+}
+
 /*
  * fileio_make_keys_name () - Build the name of KEYS file  (for TDE Master Key)
  *   return: void
@@ -5916,23 +6488,37 @@ fileio_make_keys_name_given_path (char *keys_name_p, const char *keys_path_p, co
   sprintf (keys_name_p, "%s%s%s%s", keys_path_p, FILEIO_PATH_SEPARATOR (keys_path_p), db_name_p, FILEIO_SUFFIX_KEYS);
 }
 
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
 /*
- * fileio_make_ha_sock_name () - Build the name of HA socket name (for sharing TDE Data keys)
+ * fileio_make_pgbuf_warmup_name () - Build the name of the page buffer warm-up file
  *   return: void
- *   keys_name_p(out): the name of KEYS volume
- *   dbname(in): database name
+ *   warmup_name_p(out): the name of the page buffer warm-up file
+ *   db_full_name_p(in): database full path
  *
- * Note: The caller must have enough space to store the name of the volume
+ * Note: The caller must have enough space to store the name of the file
+ *       that is constructed(sprintf). It is recommended to have at least
+ *       DB_MAX_PATH_LENGTH length.
+ */
+void
+fileio_make_pgbuf_warmup_name (char *warmup_name_p, const char *db_full_name_p)
+{
+  sprintf (warmup_name_p, "%s%s", db_full_name_p, FILEIO_SUFFIX_PGBUF_WARMUP);
+}
+
+/*
+ * fileio_make_backup_page_track_name () - Build the name of the file saving the pages changed since the last backups
+ *   return: void
+ *   track_name_p(out): the name of the changed page tracking file
+ *   db_full_name_p(in): database full path
+ *
+ * Note: The caller must have enough space to store the name of the file
  *       that is constructed(sprintf). It is recommended to have at least
  *       DB_MAX_PATH_LENGTH length.
  */
 void
-fileio_make_ha_sock_name (char *sock_path_p, const char *base_path_p, const char *sock_name_p)
+fileio_make_backup_page_track_name (char *track_name_p, const char *db_full_name_p)
 {
-  sprintf (sock_path_p, "%s%s%s", base_path_p, FILEIO_PATH_SEPARATOR (base_path_p), sock_name_p);
+  sprintf (track_name_p, "%s%s", db_full_name_p, FILEIO_SUFFIX_BACKUP_PAGE_TRACK);
 }
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
 
 /*
  * fileio_cache () - Cache information related to a mounted volume
@@ -5983,6 +6569,7 @@ fileio_cache (VOLID vol_id, const char *vol_label_p, int vol_fd, FILEIO_LOCKF_TY
       vol_info_p->volid = vol_id;
       vol_info_p->vdes = vol_fd;
       vol_info_p->lockf_type = lockf_type;
+      vol_info_p->is_atomic_write = is_permanent_volume && fileio_is_atomic_write_capable (vol_fd);
       strncpy (vol_info_p->vlabel, vol_label_p, PATH_MAX);
       /* modify next volume id */
       rv = pthread_mutex_lock (&fileio_Vol_info_header.mutex);
@@ -6137,6 +6724,7 @@ fileio_decache (THREAD_ENTRY * thread_p, int vol_fd)
       vol_info_p->volid = NULL_VOLID;
       vol_info_p->vdes = NULL_VOLDES;
       vol_info_p->lockf_type = FILEIO_NOT_LOCKF;
+      vol_info_p->is_atomic_write = false;
       vol_info_p->vlabel[0] = '\0';
 #if defined(SERVER_MODE) && defined(WINDOWS)
       pthread_mutex_destroy (&vol_info_p->vol_mutex);
@@ -6164,6 +6752,7 @@ fileio_decache (THREAD_ENTRY * thread_p, int vol_fd)
       vol_info_p->volid = NULL_VOLID;
       vol_info_p->vdes = NULL_VOLDES;
       vol_info_p->lockf_type = FILEIO_NOT_LOCKF;
+      vol_info_p->is_atomic_write = false;
       vol_info_p->vlabel[0] = '\0';
 #if defined(SERVER_MODE) && defined(WINDOWS)
       pthread_mutex_destroy (&vol_info_p->vol_mutex);
@@ -6879,6 +7468,10 @@ fileio_initialize_backup (const char *db_full_name_p, const char *backup_destina
   memset (session_p->bkup.bkuphdr->db_next_bkvolname, 0, sizeof (session_p->bkup.bkuphdr->db_next_bkvolname));
   session_p->bkup.bkuphdr->zip_method = FILEIO_ZIP_NONE_METHOD;
   session_p->bkup.bkuphdr->zip_level = FILEIO_ZIP_NONE_LEVEL;
+  session_p->bkup.bkuphdr->tde_mk_index = -1;
+  session_p->bkup.bkuphdr->tde_dk_perm_gen = 0;
+  session_p->bkup.bkuphdr->tde_mk_created_time = 0;
+  memset (session_p->bkup.bkuphdr->tde_mk_hash, 0, sizeof (session_p->bkup.bkuphdr->tde_mk_hash));
   /* Initialize database file related information */
   LSA_SET_NULL (&session_p->dbfile.lsa);
   session_p->dbfile.vlabel = NULL;
@@ -7649,14 +8242,110 @@ fileio_delete_queue_head (FILEIO_QUEUE * queue_p)
   return node;
 }
 
+/*
+ * fileio_is_tde_backup_node () - Check if the pages read into a backup node are all TDE-encrypted pages
+ *   return: true if all the pages are encrypted
+ *   session_p(in):
+ *   node_p(in): node which has the pages read from the volume being backed up
+ *
+ * Note: The pages are backed up as they are on disk, so TDE-encrypted pages stay encrypted in the backup.
+ *       A backup page may have several database pages (see FILEIO_FULL_LEVEL_EXP).
+ */
+static bool
+fileio_is_tde_backup_node (FILEIO_BACKUP_SESSION * session_p, FILEIO_NODE * node_p)
+{
+  char *page_p;
+  ssize_t pagesize, offset;
+  bool is_log_volume;
+
+  if (session_p->dbfile.volid >= LOG_DBFIRST_VOLID)
+    {
+      is_log_volume = false;
+      pagesize = IO_PAGESIZE;
+    }
+  else if (session_p->dbfile.volid == LOG_DBLOG_ACTIVE_VOLID || session_p->dbfile.volid == LOG_DBLOG_ARCHIVE_VOLID)
+    {
+      is_log_volume = true;
+      pagesize = LOG_PAGESIZE;
+    }
+  else
+    {
+      /* other files have no TDE-encrypted pages */
+      return false;
+    }
+
+  if (node_p->nread < pagesize)
+    {
+      return false;
+    }
+
+  for (offset = 0; offset + pagesize <= node_p->nread; offset += pagesize)
+    {
+      page_p = (char *) &node_p->area->iopage + offset;
+      if (is_log_volume)
+	{
+	  if ((((LOG_PAGE *) page_p)->hdr.flags & LOG_HDRPAGE_FLAG_ENCRYPTED_MASK) == 0)
+	    {
+	      return false;
+	    }
+	}
+      else
+	{
+	  if ((((FILEIO_PAGE *) page_p)->prv.pflag & FILEIO_PAGE_FLAG_ENCRYPTED_MASK) == 0)
+	    {
+	      return false;
+	    }
+	}
+    }
+
+  return true;
+}
+
+#if !defined (CS_MODE)
+/*
+ * fileio_is_unchanged_backup_page () - Check if an incremental backup can skip a page without reading it
+ *   return: true if no database page of the backup page was written since the base backup
+ *   session_p(in):
+ *   is_only_updated_pages(in): true for an incremental backup of the volume
+ *   page_id(in): backup page
+ *
+ * Note: The pages that are read are still compared with the LSA of the base backup.
+ */
+static bool
+fileio_is_unchanged_backup_page (FILEIO_BACKUP_SESSION * session_p, bool is_only_updated_pages, int page_id)
+{
+  FILEIO_BACKUP_HEADER *backup_header_p = session_p->bkup.bkuphdr;
+  int npages = backup_header_p->bkpagesize / IO_PAGESIZE;
+  VPID vpid;
+
+  if (is_only_updated_pages == false || session_p->dbfile.volid < LOG_DBFIRST_VOLID
+      || LSA_ISNULL (&session_p->dbfile.lsa) || !pgtrack_is_tracked (backup_header_p->level))
+    {
+      return false;
+    }
+
+  vpid.volid = session_p->dbfile.volid;
+  for (vpid.pageid = page_id * npages; vpid.pageid < (page_id + 1) * npages; vpid.pageid++)
+    {
+      if (pgtrack_is_changed (backup_header_p->level, &vpid))
+	{
+	  return false;
+	}
+    }
+
+  return true;
+}
+#endif /* !CS_MODE */
+
 /*
  * fileio_compress_backup_node () -
  *   return:
  *   node(in):
  *   backup_hdr(in):
+ *   is_tde_page(in): true if the node has only TDE-encrypted pages, which are not compressible
  */
 static int
-fileio_compress_backup_node (FILEIO_NODE * node_p, FILEIO_BACKUP_HEADER * backup_header_p)
+fileio_compress_backup_node (FILEIO_NODE * node_p, FILEIO_BACKUP_HEADER * backup_header_p, bool is_tde_page)
 {
   int error = NO_ERROR, local_buf_len;
   FILEIO_ZIP_PAGE *zip_page;
@@ -7670,6 +8359,14 @@ fileio_compress_backup_node (FILEIO_NODE * node_p, FILEIO_BACKUP_HEADER * backup
 
   zip_page = &node_p->zip_info->zip_page;
 
+  if (is_tde_page && backup_header_p->zip_method == FILEIO_ZIP_LZ4_METHOD)
+    {
+      /* the ciphertext does not compress, don't waste time to try it. write uncompressed block */
+      zip_page->buf_len = (int) node_p->nread;
+      memcpy (zip_page->buf, node_p->area, node_p->nread);
+      goto exit_on_end;
+    }
+
   switch (backup_header_p->zip_method)
     {
     case FILEIO_ZIP_LZ4_METHOD:
@@ -7802,8 +8499,8 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
   FILEIO_NODE *node_p = NULL;
   int rv;
   bool need_unlock = false;
+  bool is_tde_page = false;
   FILEIO_BACKUP_HEADER *backup_header_p;
-  FILEIO_BACKUP_PAGE *save_area_p;
 
   if (thread_p == NULL)
     {
@@ -7829,50 +8526,28 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
   fprintf (stdout, "start io_backup_volume_read, session = %p\n", session_p);
 #endif /* CUBRID_DEBUG */
   backup_header_p = session_p->bkup.bkuphdr;
-  node_p = NULL;		/* init */
   while (1)
     {
       rv = pthread_mutex_lock (&thread_info_p->mtx);
-      while (thread_info_p->io_type == FILEIO_WRITE)
+      need_unlock = true;
+
+      /* do not read too far ahead of the write thread */
+      while (thread_info_p->io_type != FILEIO_ERROR_INTERRUPT
+	     && queue_p->size >= FILEIO_BACKUP_MAX_QUEUED_NODES (thread_info_p->act_r_threads))
 	{
 	  pthread_cond_wait (&thread_info_p->rcv, &thread_info_p->mtx);
 	}
 
       if (thread_info_p->io_type == FILEIO_ERROR_INTERRUPT)
 	{
-	  need_unlock = true;
-	  node_p = NULL;
 	  goto exit_on_error;
 	}
 
-      /* get one page from queue head and do write */
-      if (node_p)
-	{
-	  node_p->writeable = true;
-	  thread_info_p->io_type = FILEIO_WRITE;
-	  pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
-	  while (thread_info_p->io_type == FILEIO_WRITE)
-	    {
-	      pthread_cond_wait (&thread_info_p->rcv, &thread_info_p->mtx);
-	    }
-
-	  if (thread_info_p->io_type == FILEIO_ERROR_INTERRUPT)
-	    {
-	      need_unlock = true;
-	      node_p = NULL;
-	      goto exit_on_error;
-	    }
-	}
-
       /* check EOF */
       if (thread_info_p->pageid >= thread_info_p->from_npages)
 	{
 	  thread_info_p->end_r_threads++;
-	  if (thread_info_p->end_r_threads >= thread_info_p->act_r_threads)
-	    {
-	      thread_info_p->io_type = FILEIO_WRITE;
-	      pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
-	    }
+	  pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
 	  pthread_mutex_unlock (&thread_info_p->mtx);
 	  break;
 	}
@@ -7881,42 +8556,47 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
       node_p = fileio_allocate_node (queue_p, backup_header_p);
       if (node_p == NULL)
 	{
-	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	  need_unlock = true;
 	  goto exit_on_error;
 	}
 
-      /* read one page from Disk sequentially */
-
-      save_area_p = session_p->dbfile.area;	/* save link */
-      session_p->dbfile.area = node_p->area;
+      /* the node is queued before it is read, so the pages are written in order while they are read in parallel */
       node_p->pageid = thread_info_p->pageid;
-      node_p->writeable = false;	/* init */
-      node_p->nread = fileio_read_backup (thread_p, session_p, node_p->pageid);
-      session_p->dbfile.area = save_area_p;	/* restore link */
+      node_p->writeable = false;
+      (void) fileio_append_queue (queue_p, node_p);
+      thread_info_p->pageid++;
+      pthread_mutex_unlock (&thread_info_p->mtx);
+      need_unlock = false;
+
+#if defined(CUBRID_DEBUG)
+      fprintf (stdout, "read_thread from_npages = %d, pageid = %d\n", thread_info_p->from_npages, node_p->pageid);
+#endif /* CUBRID_DEBUG */
+
+      if (fileio_is_unchanged_backup_page (session_p, thread_info_p->only_updated_pages, node_p->pageid))
+	{
+	  /* not written since the base backup; skipped by write thread */
+	  node_p->nread = 0;
+	  goto node_is_ready;
+	}
+
+      /* read one page from Disk */
+      node_p->nread = fileio_read_backup (thread_p, session_p, node_p->area, node_p->pageid);
       if (node_p->nread == -1)
 	{
-	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	  need_unlock = true;
 	  goto exit_on_error;
 	}
       else if (node_p->nread == 0)
 	{
 	  /* This could be an error since we estimated more pages. End of file/volume. */
-	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	  need_unlock = true;
 	  goto exit_on_error;
 	}
 
       /* Have to allow other threads to run and check for interrupts from the user (i.e. Ctrl-C ) */
-      if ((thread_info_p->pageid % FILEIO_CHECK_FOR_INTERRUPT_INTERVAL) == 0
+      if ((node_p->pageid % FILEIO_CHECK_FOR_INTERRUPT_INTERVAL) == 0
 	  && pgbuf_is_log_check_for_interrupts (thread_p) == true)
 	{
 #if defined(CUBRID_DEBUG)
 	  fprintf (stdout, "io_backup_volume_read interrupt\n");
 #endif /* CUBRID_DEBUG */
-	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	  need_unlock = true;
 	  goto exit_on_error;
 	}
 
@@ -7929,24 +8609,9 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
       if (thread_info_p->only_updated_pages == false || LSA_ISNULL (&session_p->dbfile.lsa)
 	  || LSA_LT (&session_p->dbfile.lsa, &node_p->area->iopage.prv.lsa))
 	{
-	  /* Backup the content of this page along with its page identifier add alloced node to the queue */
-	  (void) fileio_append_queue (queue_p, node_p);
-	}
-      else
-	{
-	  /* free node */
-	  (void) fileio_free_node (queue_p, node_p);
-	  node_p = NULL;
-	}
+	  is_tde_page = fileio_is_tde_backup_node (session_p, node_p);
 
-#if defined(CUBRID_DEBUG)
-      fprintf (stdout, "read_thread from_npages = %d, pageid = %d\n", thread_info_p->from_npages,
-	       thread_info_p->pageid);
-#endif /* CUBRID_DEBUG */
-      thread_info_p->pageid++;
-      pthread_mutex_unlock (&thread_info_p->mtx);
-      if (node_p)
-	{
+	  /* Backup the content of this page along with its page identifier */
 	  node_p->nread += FILEIO_BACKUP_PAGE_OVERHEAD;
 	  FILEIO_SET_BACKUP_PAGE_ID_COPY (node_p->area, node_p->pageid, backup_header_p->bkpagesize);
 
@@ -7958,14 +8623,26 @@ fileio_read_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * sess
 #endif
 
 	  if (backup_header_p->zip_method != FILEIO_ZIP_NONE_METHOD
-	      && fileio_compress_backup_node (node_p, backup_header_p) != NO_ERROR)
+	      && fileio_compress_backup_node (node_p, backup_header_p, is_tde_page) != NO_ERROR)
 	    {
-	      thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	      need_unlock = false;
-	      node_p = NULL;
 	      goto exit_on_error;
 	    }
 	}
+      else
+	{
+	  /* skipped by write thread */
+	  node_p->nread = 0;
+	}
+
+    node_is_ready:
+      rv = pthread_mutex_lock (&thread_info_p->mtx);
+      node_p->writeable = true;
+      if (node_p == queue_p->head)
+	{
+	  pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
+	}
+      pthread_mutex_unlock (&thread_info_p->mtx);
+      node_p = NULL;
     }
 
 exit_on_end:
@@ -7976,28 +8653,24 @@ exit_on_end:
   return;
 exit_on_error:
 
+  if (!need_unlock)
+    {
+      rv = pthread_mutex_lock (&thread_info_p->mtx);
+    }
+
   /* set error info */
-  if (thread_info_p->errid == NO_ERROR)
+  if (thread_info_p->errid == NO_ERROR && thread_info_p->io_type != FILEIO_ERROR_INTERRUPT)
     {
       assert (er_errid () != NO_ERROR);
       thread_info_p->errid = er_errid ();
     }
+  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
 
+  /* a queued node is freed with the queue */
   thread_info_p->end_r_threads++;
-  if (thread_info_p->end_r_threads >= thread_info_p->act_r_threads)
-    {
-      pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
-    }
-
-  if (need_unlock)
-    {
-      pthread_mutex_unlock (&thread_info_p->mtx);
-    }
-
-  if (node_p != NULL)
-    {
-      (void) fileio_free_node (queue_p, node_p);
-    }
+  pthread_cond_broadcast (&thread_info_p->rcv);	/* wake up read threads waiting for the queue */
+  pthread_cond_signal (&thread_info_p->wcv);	/* wake up write thread */
+  pthread_mutex_unlock (&thread_info_p->mtx);
 
   goto exit_on_end;
 }
@@ -8014,6 +8687,7 @@ fileio_write_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * ses
   FILEIO_QUEUE *queue_p;
   FILEIO_NODE *node_p;
   int rv;
+  int error;
   bool need_unlock = false;
   FILEIO_BACKUP_HEADER *backup_header_p;
   FILEIO_BACKUP_PAGE *save_area_p;
@@ -8032,7 +8706,10 @@ fileio_write_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * ses
   rv = pthread_mutex_lock (&thread_info_p->mtx);
   while (1)
     {
-      while (thread_info_p->io_type == FILEIO_READ)
+      /* wait for the next page in order; read threads may be done with the pages after it */
+      while (thread_info_p->io_type != FILEIO_ERROR_INTERRUPT
+	     && (queue_p->head == NULL || queue_p->head->writeable == false)
+	     && thread_info_p->end_r_threads < thread_info_p->act_r_threads)
 	{
 	  pthread_cond_wait (&thread_info_p->wcv, &thread_info_p->mtx);
 	}
@@ -8043,57 +8720,47 @@ fileio_write_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * ses
 	  goto exit_on_error;
 	}
 
-      /* do write */
-      while (queue_p->head && queue_p->head->writeable == true)
+      if (queue_p->head == NULL)
 	{
-	  /* delete the head node of the queue */
-	  node_p = fileio_delete_queue_head (queue_p);
-	  if (node_p == NULL)
-	    {
-	      thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-	    }
-	  else
-	    {
-	      save_area_p = session_p->dbfile.area;	/* save link */
-	      rv = fileio_write_backup_node (thread_p, session_p, node_p, backup_header_p);
-	      if (rv != NO_ERROR)
-		{
-		  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
-		}
-	      session_p->dbfile.area = save_area_p;	/* restore link */
-#if defined(CUBRID_DEBUG)
-	      fprintf (stdout, "write_thread node->pageid = %d, node->nread = %d\n", node_p->pageid, node_p->nread);
-#endif /* CUBRID_DEBUG */
-	      if (session_p->verbose_fp && thread_info_p->from_npages >= 25
-		  && node_p->pageid >= thread_info_p->check_npages)
-		{
-		  fprintf (session_p->verbose_fp, "#");
-		  thread_info_p->check_ratio++;
-		  thread_info_p->check_npages =
-		    (int) (((float) thread_info_p->from_npages / 25.0) * thread_info_p->check_ratio);
-		}
+	  /* check EOF; only write thread alive */
+	  assert (thread_info_p->end_r_threads >= thread_info_p->act_r_threads);
+	  pthread_mutex_unlock (&thread_info_p->mtx);
+	  break;
+	}
 
-	      /* free node */
-	      (void) fileio_free_node (queue_p, node_p);
-	    }
+      /* delete the head node of the queue */
+      node_p = fileio_delete_queue_head (queue_p);
+      pthread_cond_broadcast (&thread_info_p->rcv);	/* wake up read threads waiting for the queue */
+      pthread_mutex_unlock (&thread_info_p->mtx);
 
-	  if (thread_info_p->io_type == FILEIO_ERROR_INTERRUPT)
-	    {
-	      need_unlock = true;
-	      goto exit_on_error;
-	    }
+      /* do write, while read threads go on */
+      error = NO_ERROR;
+      if (node_p->nread > 0)
+	{
+	  save_area_p = session_p->dbfile.area;	/* save link */
+	  error = fileio_write_backup_node (thread_p, session_p, node_p, backup_header_p);
+	  session_p->dbfile.area = save_area_p;	/* restore link */
+#if defined(CUBRID_DEBUG)
+	  fprintf (stdout, "write_thread node->pageid = %d, node->nread = %d\n", node_p->pageid, node_p->nread);
+#endif /* CUBRID_DEBUG */
 	}
-
-      thread_info_p->io_type = FILEIO_READ;	/* reset */
-      /* check EOF */
-      if (thread_info_p->end_r_threads >= thread_info_p->act_r_threads)
+      if (session_p->verbose_fp && thread_info_p->from_npages >= 25 && node_p->pageid >= thread_info_p->check_npages)
 	{
-	  /* only write thread alive */
-	  pthread_mutex_unlock (&thread_info_p->mtx);
-	  break;
+	  fprintf (session_p->verbose_fp, "#");
+	  thread_info_p->check_ratio++;
+	  thread_info_p->check_npages =
+	    (int) (((float) thread_info_p->from_npages / 25.0) * thread_info_p->check_ratio);
 	}
 
-      pthread_cond_broadcast (&thread_info_p->rcv);	/* wake up all read threads */
+      rv = pthread_mutex_lock (&thread_info_p->mtx);
+      /* free node */
+      (void) fileio_free_node (queue_p, node_p);
+      if (error != NO_ERROR)
+	{
+	  thread_info_p->io_type = FILEIO_ERROR_INTERRUPT;
+	  need_unlock = true;
+	  goto exit_on_error;
+	}
     }
 
 #if defined(CUBRID_DEBUG)
@@ -8128,8 +8795,11 @@ exit_on_error:
     }
 
   /* wake up all read threads and wait for all killed */
-  pthread_cond_broadcast (&thread_info_p->rcv);
-  pthread_cond_wait (&thread_info_p->wcv, &thread_info_p->mtx);
+  while (thread_info_p->end_r_threads < thread_info_p->act_r_threads)
+    {
+      pthread_cond_broadcast (&thread_info_p->rcv);
+      pthread_cond_wait (&thread_info_p->wcv, &thread_info_p->mtx);
+    }
   pthread_mutex_unlock (&thread_info_p->mtx);
   goto exit_on_end;
 }
@@ -8228,6 +8898,7 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
   FILEIO_BACKUP_HEADER *backup_header_p;
   int rv;
   bool is_need_vol_closed;
+  bool is_tde_page;
 
 #if (defined(WINDOWS) || !defined(SERVER_MODE))
   off_t saved_act_log_fp = (off_t) - 1;
@@ -8381,6 +9052,12 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	      goto error;
 	    }
 
+	  if (fileio_is_unchanged_backup_page (session_p, is_only_updated_pages, page_id))
+	    {
+	      /* not written since the base backup */
+	      goto check_progress;
+	    }
+
 	  /* alloc queue node */
 	  node_p = fileio_allocate_node (queue_p, backup_header_p);
 	  if (node_p == NULL)
@@ -8389,11 +9066,8 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	    }
 
 	  /* read one page sequentially */
-	  save_area_p = session_p->dbfile.area;	/* save link */
-	  session_p->dbfile.area = node_p->area;
 	  node_p->pageid = page_id;
-	  node_p->nread = fileio_read_backup (thread_p, session_p, node_p->pageid);
-	  session_p->dbfile.area = save_area_p;	/* restore link */
+	  node_p->nread = fileio_read_backup (thread_p, session_p, node_p->area, node_p->pageid);
 	  if (node_p->nread == -1)
 	    {
 	      goto error;
@@ -8417,6 +9091,7 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 	    {
 	      /* Backup the content of this page along with its page identifier */
 
+	      is_tde_page = fileio_is_tde_backup_node (session_p, node_p);
 	      node_p->nread += FILEIO_BACKUP_PAGE_OVERHEAD;
 	      FILEIO_SET_BACKUP_PAGE_ID_COPY (node_p->area, node_p->pageid, backup_header_p->bkpagesize);
 
@@ -8427,7 +9102,7 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 #endif
 
 	      if (backup_header_p->zip_method != FILEIO_ZIP_NONE_METHOD
-		  && fileio_compress_backup_node (node_p, backup_header_p) != NO_ERROR)
+		  && fileio_compress_backup_node (node_p, backup_header_p, is_tde_page) != NO_ERROR)
 		{
 		  goto error;
 		}
@@ -8441,6 +9116,7 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 		}
 	    }
 
+	check_progress:
 	  if (session_p->verbose_fp && from_npages >= 25 && page_id >= check_npages)
 	    {
 	      fprintf (session_p->verbose_fp, "#");
@@ -8474,7 +9150,7 @@ fileio_backup_volume (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p
 #endif
 
   if (backup_header_p->zip_method != FILEIO_ZIP_NONE_METHOD
-      && fileio_compress_backup_node (node_p, backup_header_p) != NO_ERROR)
+      && fileio_compress_backup_node (node_p, backup_header_p, false) != NO_ERROR)
     {
       goto error;
     }
@@ -8711,6 +9387,7 @@ fileio_flush_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p)
  *                     volume/file that is backed up
  *   return:
  *   session(in/out): The session array
+ *   area(out): The backup page read; it is not shared, so read threads can read at the same time
  *   pageid(in): The page from which we are reading
  *
  * Note: If we run into an end of file, we filled the page with nulls. This is
@@ -8719,7 +9396,8 @@ fileio_flush_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p)
  *       the whole volume/file is backed up.
  */
 static ssize_t
-fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p, int page_id)
+fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p, FILEIO_BACKUP_PAGE * area_p,
+		    int page_id)
 {
   int io_page_size = session_p->bkup.bkuphdr->bkpagesize;
 #if defined(WINDOWS)
@@ -8731,15 +9409,15 @@ fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
 
   /* Read until you acumulate io_pagesize or the EOF mark is reached. */
   nread = 0;
-  FILEIO_SET_BACKUP_PAGE_ID (session_p->dbfile.area, page_id, io_page_size);
+  FILEIO_SET_BACKUP_PAGE_ID (area_p, page_id, io_page_size);
 
 #if defined(CUBRID_DEBUG)
-  fprintf (stdout, "fileio_read_backup: %d\t%d,\t%d\n", ((FILEIO_BACKUP_PAGE *) (session_p->dbfile.area))->iopageid,
-	   *(PAGEID *) (((char *) (session_p->dbfile.area)) + offsetof (FILEIO_BACKUP_PAGE, iopage) + io_page_size),
+  fprintf (stdout, "fileio_read_backup: %d\t%d,\t%d\n", ((FILEIO_BACKUP_PAGE *) (area_p))->iopageid,
+	   *(PAGEID *) (((char *) (area_p)) + offsetof (FILEIO_BACKUP_PAGE, iopage) + io_page_size),
 	   io_page_size);
 #endif
 
-  buffer_p = (char *) &session_p->dbfile.area->iopage;
+  buffer_p = (char *) &area_p->iopage;
   while (nread < io_page_size)
     {
       /* Read the desired amount of bytes */
@@ -8757,7 +9435,7 @@ fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
 	  if (errno != EINTR)
 	    {
 	      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_READ, 2,
-				   FILEIO_GET_BACKUP_PAGE_ID (session_p->dbfile.area), session_p->dbfile.vlabel);
+				   FILEIO_GET_BACKUP_PAGE_ID (area_p), session_p->dbfile.vlabel);
 	      return -1;
 	    }
 	}
@@ -8810,6 +9488,8 @@ fileio_read_backup (THREAD_ENTRY * thread_p, FILEIO_BACKUP_SESSION * session_p,
       if (sleep_msecs > 0)
 	{
 	  sleep_msecs = (int) (((double) sleep_msecs) / (ONE_M / io_page_size));
+	  /* read threads sleep concurrently; keep the same total read rate */
+	  sleep_msecs *= MAX (session_p->read_thread_info.act_r_threads, 1);
 
 	  if (sleep_msecs > 0)
 	    {
@@ -9233,6 +9913,15 @@ fileio_read_restore_header (FILEIO_BACKUP_SESSION * session_p)
       backup_header_p->zip_level = FILEIO_ZIP_NONE_LEVEL;
     }
 
+  /* OLD version: no TDE key information */
+  if (backup_header_p->bk_hdr_version <= FILEIO_BACKUP_NO_TDE_HEADER_VERSION)
+    {
+      backup_header_p->tde_mk_index = -1;
+      backup_header_p->tde_dk_perm_gen = 0;
+      backup_header_p->tde_mk_created_time = 0;
+      memset (backup_header_p->tde_mk_hash, 0, sizeof (backup_header_p->tde_mk_hash));
+    }
+
   if (to_read_nbytes > 0)
     {
       return ER_FAILED;
@@ -9760,6 +10449,13 @@ fileio_list_restore (THREAD_ENTRY * thread_p, const char *db_full_name_p, char *
 	   backup_header_p->zip_level, fileio_get_zip_level_string (backup_header_p->zip_level));
   fprintf (stdout, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_IO, MSGCAT_FILEIO_BKUP_HDR_INC_ACTIVELOG),
 	   backup_header_p->skip_activelog ? "NO" : "YES");
+  if (backup_header_p->tde_mk_index >= 0)
+    {
+      tmp_time = (time_t) backup_header_p->tde_mk_created_time;
+      (void) ctime_r (&tmp_time, time_val);
+      fprintf (stdout, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_IO, MSGCAT_FILEIO_BKUP_HDR_TDE_MK),
+	       backup_header_p->tde_mk_index, time_val, backup_header_p->tde_dk_perm_gen);
+    }
 
   for (i = FILEIO_BACKUP_FULL_LEVEL; i < FILEIO_BACKUP_UNDEFINED_LEVEL && backup_header_p->previnfo[i].at_time > 0; i++)
     {
@@ -11581,7 +12277,7 @@ fileio_initialize_res (THREAD_ENTRY * thread_p, FILEIO_PAGE * io_page, PGLENGTH
 
   io_page->prv.ptype = '\0';
   io_page->prv.pflag = '\0';
-  io_page->prv.p_reserve_1 = 0;
+  io_page->prv.tde_dk_gen = 0;
   io_page->prv.p_reserve_2 = 0;
   io_page->prv.tde_nonce = 0;
 }
@@ -65,6 +65,12 @@
 
 #define FILEIO_PAGE_FLAG_ENCRYPTED_MASK 0x3
 
+/* set only on the encrypted image of a slotted page: the contiguous free area is zero-filled, not encrypted */
+#define FILEIO_PAGE_FLAG_TDE_FREE_HOLE 0x4
+
+/* the length of the TDE master key hash kept in the backup header, same as TDE_MASTER_KEY_LENGTH */
+#define FILEIO_BACKUP_TDE_MK_HASH_LENGTH 32
+
 #if defined(WINDOWS)
 #define STR_PATH_SEPARATOR "\\"
 #else /* WINDOWS */
@@ -91,6 +97,9 @@
 #define FILEIO_VOLLOCK_SUFFIX        "__lock"
 #define FILEIO_SUFFIX_DWB            "_dwb"
 #define FILEIO_SUFFIX_KEYS           "_keys"
+#define FILEIO_SUFFIX_PGBUF_WARMUP   "_pgbuf_warmup"
+#define FILEIO_SUFFIX_BACKUP_PAGE_TRACK "_bkpgtrk"
+#define FILEIO_SUFFIX_RESTART_STATS  "_rvstat"
 #define FILEIO_MAX_SUFFIX_LENGTH     7
 
 typedef enum
@@ -167,6 +176,24 @@ typedef enum
   FILEIO_WRITE_NO_COMPENSATE_WRITE	/* skips */
 } FILEIO_WRITE_MODE;
 
+/* Buffers of volumes opened for direct I/O must be aligned to the logical block size of the device; 4K suits all */
+#define FILEIO_DIRECT_IO_ALIGNMENT 4096
+#define FILEIO_IS_DIRECT_IO_ALIGNED(ptr) ((((UINTPTR) (ptr)) & (FILEIO_DIRECT_IO_ALIGNMENT - 1)) == 0)
+
+/* Maximum number of adjacent pages merged into one vectored write */
+#define FILEIO_WRITEV_MAX_PAGES 64
+
+/* One page of a batched I/O request (see fileio_write_page_batch) */
+typedef struct fileio_page_request FILEIO_PAGE_REQUEST;
+struct fileio_page_request
+{
+  int vol_fd;
+  void *io_page_p;
+  PAGEID page_id;
+  size_t page_size;
+  int error;			/* errno of the request; 0 on success */
+};
+
 /* Reserved area of FILEIO_PAGE */
 typedef struct fileio_page_reserved FILEIO_PAGE_RESERVED;
 struct fileio_page_reserved
@@ -176,7 +203,7 @@ struct fileio_page_reserved
   INT16 volid;			/* Volume identifier where the page reside */
   unsigned char ptype;		/* Page type */
   unsigned char pflag;
-  INT32 p_reserve_1;
+  INT32 tde_dk_gen;		/* generation of the perm data key the page is encrypted with */
   INT32 p_reserve_2;		/* unused - Reserved field */
   INT64 tde_nonce;		/* tde nonce. atomic counter for temp pages, lsa for perm pages */
 };
@@ -316,6 +343,13 @@ struct fileio_backup_header
   FILEIO_ZIP_METHOD zip_method;	/* compression method */
   FILEIO_ZIP_LEVEL zip_level;	/* compression level */
   int skip_activelog;
+
+  /* TDE key information of the database when it was backed up. It is for restore to check the keys file given.
+   * The space for it is within FILEIO_BACKUP_HEADER_IO_SIZE of the older headers. */
+  int tde_mk_index;		/* index of the master key in the keys file, -1 if unknown */
+  int tde_dk_perm_gen;		/* generation of the perm data key */
+  INT64 tde_mk_created_time;	/* creation time of the master key */
+  unsigned char tde_mk_hash[FILEIO_BACKUP_TDE_MK_HASH_LENGTH];	/* hash of the master key */
 };
 
 /* Shouldn't this structure should use int and such? */
@@ -488,6 +522,14 @@ extern void *fileio_read_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pa
 				size_t page_size);
 extern void *fileio_write_pages (THREAD_ENTRY * thread_p, int vol_fd, char *io_pages_p, PAGEID page_id, int num_pages,
 				 size_t page_size, FILEIO_WRITE_MODE write_mode);
+extern bool fileio_is_direct_io_enabled (void);
+extern void *fileio_alloc_aligned_buffer (size_t size);
+extern bool fileio_is_volume_atomic_write (VOLID vol_id);
+extern int fileio_get_num_atomic_write_volumes (void);
+extern void *fileio_write_atomic (THREAD_ENTRY * thread_p, VOLID vol_id, void *io_page_p, PAGEID page_id,
+				  size_t page_size);
+extern int fileio_write_page_batch (THREAD_ENTRY * thread_p, FILEIO_PAGE_REQUEST * requests, int count,
+				    FILEIO_WRITE_MODE write_mode);
 extern void *fileio_writev (THREAD_ENTRY * thread_p, int vdes, void **arrayof_io_pgptr, PAGEID start_pageid,
 			    DKNPAGES npages, size_t page_size);
 extern int fileio_synchronize (THREAD_ENTRY * thread_p, int vdes, const char *vlabel,
@@ -536,16 +578,18 @@ extern void fileio_make_removed_log_archive_name (char *logarchive_name, const c
 extern void fileio_make_log_archive_temp_name (char *log_archive_temp_name_p, const char *log_path_p,
 					       const char *db_name_p);
 extern void fileio_make_log_info_name (char *loginfo_name, const char *log_path, const char *dbname);
+extern void fileio_make_restart_stats_name (char *stats_name, const char *log_path, const char *dbname);
 extern void fileio_make_backup_volume_info_name (char *backup_volinfo_name, const char *backinfo_path,
 						 const char *dbname);
 extern void fileio_make_backup_name (char *backup_name, const char *nopath_volname, const char *backup_path,
 				     FILEIO_BACKUP_LEVEL level, int unit_num);
 extern void fileio_make_dwb_name (char *dwb_name_p, const char *dwb_path_p, const char *db_name_p);
+extern void fileio_make_dwb_instance_name (char *dwb_name_p, const char *dwb_path_p, const char *db_name_p,
+					   int instance_no);
 extern void fileio_make_keys_name (char *keys_name_p, const char *db_name_p);
 extern void fileio_make_keys_name_given_path (char *keys_name_p, const char *keys_path_p, const char *db_name_p);
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-extern void fileio_make_ha_sock_name (char *sock_path_p, const char *base_path_p, const char *sock_name_p);
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
+extern void fileio_make_pgbuf_warmup_name (char *warmup_name_p, const char *db_full_name_p);
+extern void fileio_make_backup_page_track_name (char *track_name_p, const char *db_full_name_p);
 extern void fileio_remove_all_backup (THREAD_ENTRY * thread_p, int level);
 extern FILEIO_BACKUP_SESSION *fileio_initialize_backup (const char *db_fullname, const char *backup_destination,
 							FILEIO_BACKUP_SESSION * session, FILEIO_BACKUP_LEVEL level,
@@ -613,6 +657,7 @@ extern int fileio_flush_control_initialize (void);
 extern void fileio_flush_control_finalize (void);
 
 /* flush token management */
+extern int fileio_flush_control_get_token (THREAD_ENTRY * thread_p, int ntoken);
 extern int fileio_flush_control_add_tokens (THREAD_ENTRY * thread_p, INT64 diff_usec, int *token_gen,
 					    int *token_consumed);
 
@@ -0,0 +1,395 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * file_io_uring.c - io_uring engine for batched page I/O
+ */
+
+#ident "$Id$"
+
+#include "config.h"
+
+#include <errno.h>
+#include <string.h>
+
+#if defined (LINUX) && defined (HAVE_LINUX_IO_URING_H)
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+#endif /* LINUX && HAVE_LINUX_IO_URING_H */
+
+#include "file_io_uring.h"
+#include "error_manager.h"
+#include "memory_alloc.h"
+#include "perf_monitor.h"
+#include "system_parameter.h"
+
+#if defined (LINUX) && defined (HAVE_LINUX_IO_URING_H)
+
+/* glibc does not always export the io_uring system call numbers; they are the same on every supported architecture */
+#if !defined (__NR_io_uring_setup)
+#define __NR_io_uring_setup 425
+#endif
+#if !defined (__NR_io_uring_enter)
+#define __NR_io_uring_enter 426
+#endif
+
+/* rings are not shared by concurrent submitters; a thread that finds all of them busy does synchronous I/O */
+#define FILEIO_URING_NUM_RINGS 8
+
+typedef struct fileio_uring FILEIO_URING;
+struct fileio_uring
+{
+  pthread_mutex_t mutex;
+  int ring_fd;
+  unsigned int num_entries;
+  bool is_broken;		/* an io_uring_enter failure left requests in flight; the ring is not used again */
+
+  /* submission queue */
+  void *sq_ring;
+  size_t sq_ring_size;
+  unsigned int *sq_tail;
+  unsigned int *sq_mask;
+  unsigned int *sq_array;
+  struct io_uring_sqe *sqes;
+  size_t sqes_size;
+
+  /* completion queue */
+  void *cq_ring;
+  size_t cq_ring_size;
+  unsigned int *cq_head;
+  unsigned int *cq_tail;
+  unsigned int *cq_mask;
+  struct io_uring_cqe *cqes;
+
+  struct iovec *iovecs;		/* one per submission entry */
+};
+
+static FILEIO_URING fileio_Urings[FILEIO_URING_NUM_RINGS];
+static int fileio_Uring_count = 0;
+static volatile bool fileio_Uring_is_initialized = false;
+static pthread_mutex_t fileio_Uring_init_mutex = PTHREAD_MUTEX_INITIALIZER;
+static unsigned int fileio_Uring_next = 0;
+
+static void fileio_uring_initialize (void);
+static int fileio_uring_setup (FILEIO_URING * ring, unsigned int num_entries);
+static void fileio_uring_teardown (FILEIO_URING * ring);
+static int fileio_uring_execute (FILEIO_URING * ring, FILEIO_PAGE_REQUEST * requests, int count, bool is_write);
+
+/*
+ * fileio_uring_setup () - create one ring and map its queues
+ *   return: NO_ERROR or ER_FAILED (errno is set)
+ *   ring(out): ring to set up
+ *   num_entries(in): requested submission queue size
+ */
+static int
+fileio_uring_setup (FILEIO_URING * ring, unsigned int num_entries)
+{
+  struct io_uring_params params;
+  char *sq_ptr, *cq_ptr;
+
+  memset (ring, 0, sizeof (*ring));
+  memset (&params, 0, sizeof (params));
+
+  ring->ring_fd = (int) syscall (__NR_io_uring_setup, num_entries, &params);
+  if (ring->ring_fd < 0)
+    {
+      return ER_FAILED;
+    }
+  ring->num_entries = params.sq_entries;
+
+  ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof (unsigned int);
+  ring->sq_ring = mmap (NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd,
+			IORING_OFF_SQ_RING);
+  if (ring->sq_ring == MAP_FAILED)
+    {
+      ring->sq_ring = NULL;
+      goto error;
+    }
+
+  ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof (struct io_uring_cqe);
+  ring->cq_ring = mmap (NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->ring_fd,
+			IORING_OFF_CQ_RING);
+  if (ring->cq_ring == MAP_FAILED)
+    {
+      ring->cq_ring = NULL;
+      goto error;
+    }
+
+  ring->sqes_size = params.sq_entries * sizeof (struct io_uring_sqe);
+  ring->sqes = (struct io_uring_sqe *) mmap (NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+					     ring->ring_fd, IORING_OFF_SQES);
+  if (ring->sqes == MAP_FAILED)
+    {
+      ring->sqes = NULL;
+      goto error;
+    }
+
+  ring->iovecs = (struct iovec *) malloc (params.sq_entries * sizeof (struct iovec));
+  if (ring->iovecs == NULL)
+    {
+      errno = ENOMEM;
+      goto error;
+    }
+
+  sq_ptr = (char *) ring->sq_ring;
+  ring->sq_tail = (unsigned int *) (sq_ptr + params.sq_off.tail);
+  ring->sq_mask = (unsigned int *) (sq_ptr + params.sq_off.ring_mask);
+  ring->sq_array = (unsigned int *) (sq_ptr + params.sq_off.array);
+
+  cq_ptr = (char *) ring->cq_ring;
+  ring->cq_head = (unsigned int *) (cq_ptr + params.cq_off.head);
+  ring->cq_tail = (unsigned int *) (cq_ptr + params.cq_off.tail);
+  ring->cq_mask = (unsigned int *) (cq_ptr + params.cq_off.ring_mask);
+  ring->cqes = (struct io_uring_cqe *) (cq_ptr + params.cq_off.cqes);
+
+  pthread_mutex_init (&ring->mutex, NULL);
+
+  return NO_ERROR;
+
+error:
+  {
+    int save_errno = errno;
+
+    fileio_uring_teardown (ring);
+    errno = save_errno;
+  }
+  return ER_FAILED;
+}
+
+/*
+ * fileio_uring_teardown () - unmap the queues and close the ring
+ *   return: void
+ *   ring(in): ring to release
+ */
+static void
+fileio_uring_teardown (FILEIO_URING * ring)
+{
+  if (ring->sqes != NULL)
+    {
+      munmap (ring->sqes, ring->sqes_size);
+    }
+  if (ring->cq_ring != NULL)
+    {
+      munmap (ring->cq_ring, ring->cq_ring_size);
+    }
+  if (ring->sq_ring != NULL)
+    {
+      munmap (ring->sq_ring, ring->sq_ring_size);
+    }
+  if (ring->iovecs != NULL)
+    {
+      free_and_init (ring->iovecs);
+    }
+  if (ring->ring_fd >= 0)
+    {
+      close (ring->ring_fd);
+    }
+  memset (ring, 0, sizeof (*ring));
+  ring->ring_fd = -1;
+}
+
+/*
+ * fileio_uring_initialize () - set up the rings once per process
+ *   return: void
+ *
+ * Note: a kernel without io_uring (or with io_uring disabled) leaves fileio_Uring_count at zero, which makes every
+ *       submission fall back to synchronous I/O.
+ */
+static void
+fileio_uring_initialize (void)
+{
+  unsigned int num_entries;
+  int i;
+
+  pthread_mutex_lock (&fileio_Uring_init_mutex);
+  if (fileio_Uring_is_initialized)
+    {
+      pthread_mutex_unlock (&fileio_Uring_init_mutex);
+      return;
+    }
+
+  num_entries = (unsigned int) prm_get_integer_value (PRM_ID_IO_URING_QUEUE_DEPTH);
+  for (i = 0; i < FILEIO_URING_NUM_RINGS; i++)
+    {
+      if (fileio_uring_setup (&fileio_Urings[i], num_entries) != NO_ERROR)
+	{
+	  if (i == 0)
+	    {
+	      er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_IO_URING_SETUP_FAIL, 1, strerror (errno));
+	    }
+	  break;
+	}
+    }
+  fileio_Uring_count = i;
+
+  fileio_Uring_is_initialized = true;
+  pthread_mutex_unlock (&fileio_Uring_init_mutex);
+}
+
+/*
+ * fileio_uring_execute () - run a batch of page requests on a ring
+ *   return: NO_ERROR, or ER_FAILED if the ring became unusable
+ *   ring(in): ring owned by the caller
+ *   requests(in/out): page requests; error is set for every request
+ *   count(in): number of requests
+ *   is_write(in): write or read the pages
+ *
+ * Note: requests are submitted in chunks of the submission queue size, each chunk with one io_uring_enter call that
+ *       also waits for all of its completions.
+ */
+static int
+fileio_uring_execute (FILEIO_URING * ring, FILEIO_PAGE_REQUEST * requests, int count, bool is_write)
+{
+  FILEIO_PAGE_REQUEST *req;
+  struct io_uring_sqe *sqe;
+  struct io_uring_cqe *cqe;
+  unsigned int tail, head, idx, num_chunk, num_submitted, num_completed, i;
+  int done, ret;
+
+  for (done = 0; done < count; done += (int) num_chunk)
+    {
+      num_chunk = MIN ((unsigned int) (count - done), ring->num_entries);
+
+      /* only the ring owner moves the submission tail */
+      tail = *ring->sq_tail;
+      for (i = 0; i < num_chunk; i++)
+	{
+	  req = &requests[done + i];
+	  req->error = EINPROGRESS;
+
+	  ring->iovecs[i].iov_base = req->io_page_p;
+	  ring->iovecs[i].iov_len = req->page_size;
+
+	  idx = (tail + i) & *ring->sq_mask;
+	  sqe = &ring->sqes[idx];
+	  memset (sqe, 0, sizeof (*sqe));
+	  sqe->opcode = is_write ? IORING_OP_WRITEV : IORING_OP_READV;
+	  sqe->fd = req->vol_fd;
+	  sqe->addr = (unsigned long) &ring->iovecs[i];
+	  sqe->len = 1;
+	  sqe->off = (unsigned long long) req->page_size * (unsigned long long) req->page_id;
+	  sqe->user_data = (unsigned long long) (done + i);
+	  ring->sq_array[idx] = idx;
+	}
+      /* publish the entries before the kernel can see the new tail */
+      __atomic_store_n (ring->sq_tail, tail + num_chunk, __ATOMIC_RELEASE);
+
+      num_submitted = 0;
+      num_completed = 0;
+      while (num_completed < num_chunk)
+	{
+	  ret = (int) syscall (__NR_io_uring_enter, ring->ring_fd, num_chunk - num_submitted,
+			       num_chunk - num_completed, IORING_ENTER_GETEVENTS, NULL, 0);
+	  if (ret < 0)
+	    {
+	      if (errno == EINTR)
+		{
+		  continue;
+		}
+	      /* the requests left in EINPROGRESS are redone by the caller */
+	      ring->is_broken = true;
+	      return ER_FAILED;
+	    }
+	  num_submitted += (unsigned int) ret;
+
+	  head = *ring->cq_head;
+	  while (head != __atomic_load_n (ring->cq_tail, __ATOMIC_ACQUIRE))
+	    {
+	      cqe = &ring->cqes[head & *ring->cq_mask];
+	      req = &requests[cqe->user_data];
+	      if (cqe->res == (int) req->page_size)
+		{
+		  req->error = 0;
+		}
+	      else
+		{
+		  /* a short transfer is redone synchronously as well */
+		  req->error = (cqe->res < 0) ? -cqe->res : EIO;
+		}
+	      head++;
+	      num_completed++;
+	    }
+	  __atomic_store_n (ring->cq_head, head, __ATOMIC_RELEASE);
+	}
+    }
+
+  return NO_ERROR;
+}
+#endif /* LINUX && HAVE_LINUX_IO_URING_H */
+
+/*
+ * fileio_uring_submit () - read or write a batch of pages through io_uring
+ *   return: NO_ERROR if the batch was run (check each request's error), ER_FAILED if the engine is disabled,
+ *           unavailable or busy and the caller must do the I/O synchronously
+ *   thread_p(in): thread entry
+ *   requests(in/out): page requests
+ *   count(in): number of requests
+ *   is_write(in): write or read the pages
+ */
+int
+fileio_uring_submit (THREAD_ENTRY * thread_p, FILEIO_PAGE_REQUEST * requests, int count, bool is_write)
+{
+#if defined (LINUX) && defined (HAVE_LINUX_IO_URING_H)
+  FILEIO_URING *ring;
+  unsigned int start;
+  int i, error_code;
+
+  if (count <= 0 || !prm_get_bool_value (PRM_ID_IO_URING))
+    {
+      return ER_FAILED;
+    }
+
+  if (!fileio_Uring_is_initialized)
+    {
+      fileio_uring_initialize ();
+    }
+  if (fileio_Uring_count == 0)
+    {
+      return ER_FAILED;
+    }
+
+  start = __atomic_fetch_add (&fileio_Uring_next, 1, __ATOMIC_RELAXED);
+  for (i = 0; i < fileio_Uring_count; i++)
+    {
+      ring = &fileio_Urings[(start + i) % fileio_Uring_count];
+      if (pthread_mutex_trylock (&ring->mutex) != 0)
+	{
+	  continue;
+	}
+      if (ring->is_broken)
+	{
+	  pthread_mutex_unlock (&ring->mutex);
+	  continue;
+	}
+
+      error_code = fileio_uring_execute (ring, requests, count, is_write);
+      pthread_mutex_unlock (&ring->mutex);
+
+      perfmon_inc_stat (thread_p, PSTAT_FILE_NUM_IO_URING_SUBMITS);
+      return error_code;
+    }
+
+  return ER_FAILED;
+#else /* LINUX && HAVE_LINUX_IO_URING_H */
+  return ER_FAILED;
+#endif /* LINUX && HAVE_LINUX_IO_URING_H */
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * file_io_uring.h - io_uring engine for batched page I/O
+ */
+
+#ifndef _FILE_IO_URING_H_
+#define _FILE_IO_URING_H_
+
+#ident "$Id$"
+
+#include "file_io.h"
+
+/*
+ * The engine submits a batch of independent page requests with a single system call and reaps their completions.
+ * It never reports errors itself: every request gets its errno in FILEIO_PAGE_REQUEST.error (0 on success) and
+ * the caller redoes the failed ones through the synchronous path, which owns the error reporting.
+ */
+extern int fileio_uring_submit (THREAD_ENTRY * thread_p, FILEIO_PAGE_REQUEST * requests, int count, bool is_write);
+
+#endif /* _FILE_IO_URING_H_ */
@@ -285,8 +285,11 @@ struct file_partial_sector
 /************************************************************************/
 
 /* Table space default macro's */
-#define FILE_TABLESPACE_DEFAULT_RATIO_EXPAND ((float) 0.01)	/* 1% of current size */
-#define FILE_TABLESPACE_DEFAULT_MIN_EXPAND (DISK_SECTOR_NPAGES * DB_PAGESIZE);	/* one sector */
+/* growth of new permanent files: file_expand_ratio of current size (default 1%), but at least
+ * file_expand_min_sectors (default one sector) */
+#define FILE_TABLESPACE_DEFAULT_RATIO_EXPAND prm_get_float_value (PRM_ID_FILE_EXPAND_RATIO)
+#define FILE_TABLESPACE_DEFAULT_MIN_EXPAND \
+  (prm_get_integer_value (PRM_ID_FILE_EXPAND_MIN_SECTORS) * DISK_SECTOR_NPAGES * DB_PAGESIZE)
 #define FILE_TABLESPACE_DEFAULT_MAX_EXPAND (DISK_SECTOR_NPAGES * DB_PAGESIZE * 1024);	/* 1k sectors */
 
 #define FILE_TABLESPACE_FOR_PERM_NPAGES(tabspace, npages) \
@@ -430,14 +433,37 @@ struct file_map_context
   void *args;
 };
 
-/* FILE_SET_TDE_ALGORITHM_ARGS - args varaible for file_apply_tde_algorithm() */
-typedef struct file_set_tde_algorithm_args FILE_SET_TDE_ALGORITHM_ARGS;
-struct file_set_tde_algorithm_args
+/* FILE_TDE_SECTOR_COLLECTOR - allocated sectors collected by file_tde_map_user_pages(). Full sectors are collected
+ * with a full page bitmap. */
+typedef struct file_tde_sector_collector FILE_TDE_SECTOR_COLLECTOR;
+struct file_tde_sector_collector
+{
+  int nsects;
+  FILE_PARTIAL_SECTOR *partsects;
+};
+
+/* FILE_TDE_PAGE_FUNC - function applied to each user page by file_tde_map_user_pages() */
+typedef int (*FILE_TDE_PAGE_FUNC) (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
+
+/* FILE_TDE_APPLY_ARGS - arguments for file_tde_set_page_algorithm() */
+typedef struct file_tde_apply_args FILE_TDE_APPLY_ARGS;
+struct file_tde_apply_args
 {
-  bool skip_logging;
   TDE_ALGORITHM tde_algo;
+  bool skip_logging;
+};
+
+/* FILE_TDE_REKEY_ARGS - arguments for file_tde_rekey_page() */
+typedef struct file_tde_rekey_args FILE_TDE_REKEY_ARGS;
+struct file_tde_rekey_args
+{
+  int dk_gen;			/* the current generation of the perm data key */
+  int n_pages_rekeyed;
 };
 
+/* number of pages file_tde_map_user_pages() visits between checking interrupts and throttling */
+#define FILE_TDE_APPLY_BATCH_NPAGES 128
+
 /************************************************************************/
 /* Numerable files section                                              */
 /************************************************************************/
@@ -492,6 +518,7 @@ struct file_tempcache
 #endif				/* !NDEBUG */
 
   FILE_TEMPCACHE_ENTRY **tran_files;	/* transaction temporary files */
+  int *tran_npages;		/* user pages allocated in transaction temporary files */
 
   /* space info */
   SPACEDB_FILES spacedb_temp;
@@ -704,7 +731,7 @@ static int file_table_collect_vsid (THREAD_ENTRY * thread_p, const void *item,
 				    int index_unused, bool * stop, void *args);
 STATIC_INLINE int file_table_collect_all_vsids (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead,
 						FILE_VSID_COLLECTOR * collector_out) __attribute__ ((ALWAYS_INLINE));
-static int file_perm_expand (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead);
+static int file_perm_expand (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, int npages_needed);
 static int file_table_move_partial_sectors_to_header (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead,
 						      FILE_ALLOC_TYPE alloc_type, VPID * vpid_alloc_out);
 static int file_table_append_full_sector_page (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, const VPID * vpid_new);
@@ -744,6 +771,14 @@ static int file_sector_map_dealloc (THREAD_ENTRY * thread_p, const void *data, i
 static int file_set_tde_algorithm (THREAD_ENTRY * thread_p, const VFID * vfid, TDE_ALGORITHM tde_algo);
 static TDE_ALGORITHM file_get_tde_algorithm_internal (const FILE_HEADER * fhead);
 static void file_set_tde_algorithm_internal (FILE_HEADER * fhead, TDE_ALGORITHM tde_algo);
+static int file_tde_collect_partial_sector (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop,
+					    void *args);
+static int file_tde_collect_full_sector (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop,
+					 void *args);
+static int file_tde_map_user_pages (THREAD_ENTRY * thread_p, const VFID * vfid, PAGE_PTR page_fhead,
+				    FILE_TDE_PAGE_FUNC func, void *args, bool flush_control);
+static int file_tde_set_page_algorithm (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
+static int file_tde_rekey_page (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
 
 /************************************************************************/
 /* Numerable files section.                                             */
@@ -794,6 +829,8 @@ STATIC_INLINE FILE_TEMPCACHE_ENTRY *file_tempcache_pop_tran_file (THREAD_ENTRY *
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void file_tempcache_push_tran_file (THREAD_ENTRY * thread_p, FILE_TEMPCACHE_ENTRY * entry)
   __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void file_tempcache_unaccount_tran_pages (THREAD_ENTRY * thread_p, const VFID * vfid)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void file_tempcache_dump (FILE * fp) __attribute__ ((ALWAYS_INLINE));
 
 /************************************************************************/
@@ -4352,6 +4389,8 @@ file_temp_retire_internal (THREAD_ENTRY * thread_p, const VFID * vfid, bool was_
     {
       entry = file_tempcache_pop_tran_file (thread_p, vfid);
       assert (entry != NULL);
+
+      file_tempcache_unaccount_tran_pages (thread_p, vfid);
     }
 
   if (entry != NULL && file_tempcache_put (thread_p, entry))
@@ -4487,12 +4526,14 @@ file_rv_perm_expand_redo (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 /*
  * file_perm_expand () - Expand permanent file by reserving new sectors.
  *
- * return	   : Error code
- * thread_p (in)   : Thread entry
- * page_fhead (in) : File header page
+ * return	      : Error code
+ * thread_p (in)      : Thread entry
+ * page_fhead (in)    : File header page
+ * npages_needed (in) : Pages the caller is about to allocate; the file is expanded for all of them at once, up to the
+ *			maximum expansion size
  */
 static int
-file_perm_expand (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead)
+file_perm_expand (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, int npages_needed)
 {
   FILE_HEADER *fhead = NULL;
   int expand_min_size_in_sectors;
@@ -4519,10 +4560,13 @@ file_perm_expand (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead)
   expand_min_size_in_sectors = MAX (fhead->tablespace.expand_min_size / DB_SECTORSIZE, 1);
   expand_max_size_in_sectors =
     MIN (fhead->tablespace.expand_max_size / DB_SECTORSIZE, file_extdata_remaining_capacity (extdata_part_ftab));
-  assert (expand_min_size_in_sectors <= expand_max_size_in_sectors);
+  assert (expand_max_size_in_sectors >= 1);
+  /* minimum may be configured larger than the room left in header partial table */
+  expand_min_size_in_sectors = MIN (expand_min_size_in_sectors, expand_max_size_in_sectors);
 
   expand_size_in_sectors = (int) ((float) fhead->n_sector_total * fhead->tablespace.expand_ratio);
   expand_size_in_sectors = MAX (expand_size_in_sectors, expand_min_size_in_sectors);
+  expand_size_in_sectors = MAX (expand_size_in_sectors, CEIL_PTVDIV (npages_needed, DISK_SECTOR_NPAGES));
   expand_size_in_sectors = MIN (expand_size_in_sectors, expand_max_size_in_sectors);
 
   file_log ("file_perm_expand",
@@ -5053,7 +5097,7 @@ file_perm_alloc (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, FILE_ALLOC_TYPE a
   if (fhead->n_page_free == 0)
     {
       /* no free pages. we need to expand file. */
-      error_code = file_perm_expand (thread_p, page_fhead);
+      error_code = file_perm_expand (thread_p, page_fhead, 1);
       if (error_code != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
@@ -5299,6 +5343,10 @@ file_alloc (THREAD_ENTRY * thread_p, const VFID * vfid, FILE_INIT_PAGE_FUNC f_in
 	  ASSERT_ERROR ();
 	  goto exit;
 	}
+      if (thread_p != NULL)
+	{
+	  thread_p->event_stats.temp_alloc_pages++;
+	}
     }
   else
     {
@@ -5481,6 +5529,17 @@ file_alloc_multiple (THREAD_ENTRY * thread_p, const VFID * vfid,
 
   for (iter = 0; iter < npages; iter++)
     {
+      if (!is_temp && fhead->n_page_free == 0)
+	{
+	  /* reserve sectors for all remaining pages at once, instead of one expansion for each sector */
+	  error_code = file_perm_expand (thread_p, page_fhead, npages - iter);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto exit;
+	    }
+	}
+
       vpid_iter = vpids_out ? vpids_out + iter : &local_vpid;
       error_code = file_alloc (thread_p, vfid, f_init, f_init_args, vpid_iter, NULL);
       if (error_code != NO_ERROR)
@@ -5832,14 +5891,239 @@ file_get_tde_algorithm_internal (const FILE_HEADER * fhead)
     }
 }
 
+/*
+ * file_tde_collect_partial_sector () - FILE_EXTDATA_ITEM_FUNC to collect a partial sector for file_tde_map_user_pages
+ *
+ * return        : NO_ERROR
+ * thread_p (in) : thread entry
+ * data (in)     : FILE_PARTIAL_SECTOR *
+ * index (in)    : unused
+ * stop (in)     : unused
+ * args (in)     : FILE_TDE_SECTOR_COLLECTOR *
+ */
+static int
+file_tde_collect_partial_sector (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args)
+{
+  FILE_TDE_SECTOR_COLLECTOR *collector = (FILE_TDE_SECTOR_COLLECTOR *) args;
+
+  collector->partsects[collector->nsects++] = *(FILE_PARTIAL_SECTOR *) data;
+  return NO_ERROR;
+}
+
+/*
+ * file_tde_collect_full_sector () - FILE_EXTDATA_ITEM_FUNC to collect a full sector for file_tde_map_user_pages
+ *
+ * return        : NO_ERROR
+ * thread_p (in) : thread entry
+ * data (in)     : VSID *
+ * index (in)    : unused
+ * stop (in)     : unused
+ * args (in)     : FILE_TDE_SECTOR_COLLECTOR *
+ */
 static int
-file_file_map_set_tde_algorithm (THREAD_ENTRY * thread_p, PAGE_PTR * page, bool * stop, void *args)
+file_tde_collect_full_sector (THREAD_ENTRY * thread_p, const void *data, int index, bool * stop, void *args)
 {
-  FILE_SET_TDE_ALGORITHM_ARGS *tde_args = (FILE_SET_TDE_ALGORITHM_ARGS *) args;
-  pgbuf_set_tde_algorithm (thread_p, *page, tde_args->tde_algo, tde_args->skip_logging);
+  FILE_TDE_SECTOR_COLLECTOR *collector = (FILE_TDE_SECTOR_COLLECTOR *) args;
+
+  collector->partsects[collector->nsects].vsid = *(VSID *) data;
+  collector->partsects[collector->nsects].page_bitmap = FILE_FULL_PAGE_BITMAP;
+  collector->nsects++;
   return NO_ERROR;
 }
 
+/*
+ * file_tde_map_user_pages () - apply a function to each user page of a file, one page latched at a time
+ *
+ * return           : NO_ERROR, or ER_code
+ * thread_p (in)    : Thread entry
+ * vfid (in)        : File identifier
+ * page_fhead (in)  : File header page, fixed by caller. It is always unfixed by this function.
+ * func (in)        : Function applied to each user page, which is fixed with write latch
+ * args (in)        : Arguments for func
+ * flush_control (in) : Whether to pace by the flush tokens besides tde_apply_throttle_in_msecs
+ *
+ * NOTE: The allocated sectors are collected and the header is released before the user pages are visited, so
+ *       the file can be used by other threads meanwhile. Each page is latched alone, which cannot dead-latch, and
+ *       pages deallocated in the meantime are skipped.
+ *       Every FILE_TDE_APPLY_BATCH_NPAGES pages, interrupts are checked and the thread sleeps
+ *       tde_apply_throttle_in_msecs, not to flood the page buffer and the log when a large file is visited.
+ *       With flush_control, it also waits for the flush tokens of the batch, so it doesn't make dirty pages faster
+ *       than the page flush can write them.
+ */
+static int
+file_tde_map_user_pages (THREAD_ENTRY * thread_p, const VFID * vfid, PAGE_PTR page_fhead, FILE_TDE_PAGE_FUNC func,
+			 void *args, bool flush_control)
+{
+  int error_code = NO_ERROR;
+  VPID vpid;
+  PAGE_PTR page = NULL;
+  FILE_HEADER *fhead = NULL;
+  FILE_EXTENSIBLE_DATA *extdata_ftab;
+  FILE_FTAB_COLLECTOR ftab_collector = FILE_FTAB_COLLECTOR_INITIALIZER;
+  FILE_TDE_SECTOR_COLLECTOR sect_collector = { 0, NULL };
+  bool continue_check_interrupt = true;
+  int n_pages_visited = 0;
+  int n_page_user;
+  int throttle_msecs;
+  int i, iter;
+
+  assert (page_fhead != NULL);
+
+  fhead = (FILE_HEADER *) page_fhead;
+  n_page_user = fhead->n_page_user;
+
+  if (n_page_user == 0)
+    {
+      /* newly created file */
+      goto exit;
+    }
+
+  /* collect table pages */
+  error_code = file_table_collect_ftab_pages (thread_p, page_fhead, true, &ftab_collector);
+  if (error_code != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  /* collect allocated sectors */
+  sect_collector.partsects =
+    (FILE_PARTIAL_SECTOR *) db_private_alloc (thread_p, fhead->n_sector_total * sizeof (FILE_PARTIAL_SECTOR));
+  if (sect_collector.partsects == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, fhead->n_sector_total * sizeof (FILE_PARTIAL_SECTOR));
+      goto exit;
+    }
+
+  FILE_HEADER_GET_PART_FTAB (fhead, extdata_ftab);
+  error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_tde_collect_partial_sector,
+					 &sect_collector, false, NULL, NULL);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto exit;
+    }
+
+  if (!FILE_IS_TEMPORARY (fhead))
+    {
+      FILE_HEADER_GET_FULL_FTAB (fhead, extdata_ftab);
+      error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_tde_collect_full_sector,
+					     &sect_collector, false, NULL, NULL);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit;
+	}
+    }
+
+  /* release the header; user pages are latched one at a time from now on */
+  fhead = NULL;
+  pgbuf_unfix_and_init (thread_p, page_fhead);
+
+  for (i = 0; i < sect_collector.nsects; i++)
+    {
+      FILE_PARTIAL_SECTOR *partsect = &sect_collector.partsects[i];
+
+      vpid.volid = partsect->vsid.volid;
+      for (iter = 0, vpid.pageid = SECTOR_FIRST_PAGEID (partsect->vsid.sectid); iter < FILE_ALLOC_BITMAP_NBITS;
+	   iter++, vpid.pageid++)
+	{
+	  if (!file_partsect_is_bit_set (partsect, iter))
+	    {
+	      /* not allocated */
+	      continue;
+	    }
+	  if (file_table_collector_has_page (&ftab_collector, &vpid))
+	    {
+	      /* skip table pages */
+	      continue;
+	    }
+
+	  page = pgbuf_fix (thread_p, &vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
+	  if (page == NULL)
+	    {
+	      if (er_errid () == ER_PB_BAD_PAGEID)
+		{
+		  /* deallocated after the sectors were collected */
+		  er_clear ();
+		  continue;
+		}
+	      ASSERT_ERROR_AND_SET (error_code);
+	      goto exit;
+	    }
+
+	  error_code = func (thread_p, page, args);
+	  pgbuf_unfix_and_init (thread_p, page);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      goto exit;
+	    }
+
+	  if (++n_pages_visited % FILE_TDE_APPLY_BATCH_NPAGES == 0)
+	    {
+	      file_log ("file_tde_map_user_pages", "file %d|%d, %d of %d user pages visited", VFID_AS_ARGS (vfid),
+			n_pages_visited, n_page_user);
+
+	      if (logtb_is_interrupted (thread_p, true, &continue_check_interrupt)
+#if defined (SERVER_MODE)
+		  || thread_p->shutdown
+#endif /* SERVER_MODE */
+		)
+		{
+		  error_code = ER_INTERRUPTED;
+		  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 0);
+		  goto exit;
+		}
+
+	      if (flush_control)
+		{
+		  (void) fileio_flush_control_get_token (thread_p, FILE_TDE_APPLY_BATCH_NPAGES);
+		}
+	      throttle_msecs = prm_get_integer_value (PRM_ID_TDE_APPLY_THROTTLE_MSECS);
+	      if (throttle_msecs > 0)
+		{
+		  thread_sleep (throttle_msecs);
+		}
+	    }
+	}
+    }
+
+  assert (error_code == NO_ERROR);
+
+exit:
+  if (page_fhead != NULL)
+    {
+      pgbuf_unfix (thread_p, page_fhead);
+    }
+  if (ftab_collector.partsect_ftab != NULL)
+    {
+      db_private_free (thread_p, ftab_collector.partsect_ftab);
+    }
+  if (sect_collector.partsects != NULL)
+    {
+      db_private_free (thread_p, sect_collector.partsects);
+    }
+
+  return error_code;
+}
+
+/*
+ * file_tde_set_page_algorithm () - FILE_TDE_PAGE_FUNC to set encryption algorithm of a page
+ *
+ * return        : NO_ERROR
+ * thread_p (in) : Thread entry
+ * page (in)     : User page
+ * args (in)     : FILE_TDE_APPLY_ARGS *
+ */
+static int
+file_tde_set_page_algorithm (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args)
+{
+  FILE_TDE_APPLY_ARGS *apply_args = (FILE_TDE_APPLY_ARGS *) args;
+
+  pgbuf_set_tde_algorithm (thread_p, page, apply_args->tde_algo, apply_args->skip_logging);
+  return NO_ERROR;
+}
 
 /*
  * file_apply_tde_algorithm () - set encryption algorithm to file and user pages belonging to the file 
@@ -5849,19 +6133,18 @@ file_file_map_set_tde_algorithm (THREAD_ENTRY * thread_p, PAGE_PTR * page, bool
  * vfid (in)      : File identifier
  * tde_algo (in) : encryption algorithm - NONE, AES, ARIA
  *
- * NOTE: The iterating pages part is the same as file_map_pages(). To set TDE to all the pages, unconditional latch has to be latched, but file_map_pages() doesn't support unconditional latch in SERVER_MODE. Becuase this function uses PGBUF_UNCONDITIONAL_LATCH, this has to be called before the file(vfid) is accessed by other thread, or it can cause dead lock (see: file_map_pages()).
- *
+ * NOTE: The algorithm is first set in the file header, so pages allocated from now on get it from file_alloc ().
+ *       Then the user pages are changed by file_tde_map_user_pages (), which is throttled not to flood the page
+ *       buffer and the log when a large file is changed (ALTER TABLE ... ENCRYPT).
  */
 int
 file_apply_tde_algorithm (THREAD_ENTRY * thread_p, const VFID * vfid, const TDE_ALGORITHM tde_algo)
 {
   int error_code = NO_ERROR;
-  FILE_SET_TDE_ALGORITHM_ARGS args;
   VPID vpid_fhead;
   PAGE_PTR page_fhead = NULL;
   FILE_HEADER *fhead = NULL;
-  FILE_EXTENSIBLE_DATA *extdata_ftab;
-  FILE_MAP_CONTEXT context;
+  FILE_TDE_APPLY_ARGS apply_args;
   TDE_ALGORITHM prev_tde_algo = TDE_ALGORITHM_NONE;
 
   assert (vfid != NULL && !VFID_ISNULL (vfid));
@@ -5900,62 +6183,106 @@ file_apply_tde_algorithm (THREAD_ENTRY * thread_p, const VFID * vfid, const TDE_
       return error_code;
     }
 
-  /* init map context */
-  args.skip_logging = FILE_IS_TEMPORARY (fhead);
-  args.tde_algo = tde_algo;
-  context.func = file_file_map_set_tde_algorithm;
-  context.args = &args;
-  context.latch_cond = PGBUF_UNCONDITIONAL_LATCH;
-  context.latch_mode = PGBUF_LATCH_WRITE;
-  context.stop = false;
-  context.ftab_collector.partsect_ftab = NULL;
+  apply_args.tde_algo = tde_algo;
+  apply_args.skip_logging = FILE_IS_TEMPORARY (fhead);
 
-  /* collect table pages */
-  error_code = file_table_collect_ftab_pages (thread_p, page_fhead, true, &context.ftab_collector);
-  if (error_code != NO_ERROR)
+  /* page_fhead is unfixed in it */
+  return file_tde_map_user_pages (thread_p, vfid, page_fhead, file_tde_set_page_algorithm, &apply_args, false);
+}
+
+/*
+ * file_tde_rekey_page () - FILE_TDE_PAGE_FUNC to make a page encrypted with an old perm data key written again
+ *
+ * return        : NO_ERROR
+ * thread_p (in) : Thread entry
+ * page (in)     : User page
+ * args (in)     : FILE_TDE_REKEY_ARGS *
+ */
+static int
+file_tde_rekey_page (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args)
+{
+  FILE_TDE_REKEY_ARGS *rekey_args = (FILE_TDE_REKEY_ARGS *) args;
+
+  if (pgbuf_get_tde_algorithm (page) == TDE_ALGORITHM_NONE || pgbuf_get_tde_dk_gen (page) == rekey_args->dk_gen)
     {
-      goto exit;
+      return NO_ERROR;
     }
 
-  /* map over partial sectors table */
-  FILE_HEADER_GET_PART_FTAB (fhead, extdata_ftab);
-  context.is_partial = true;
-  error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_map_pages, &context, false,
-					 NULL, NULL);
-  if (error_code != NO_ERROR)
+  /* the content is not changed, it is just encrypted with the current key when it is flushed */
+  pgbuf_set_dirty (thread_p, page, DONT_FREE);
+  rekey_args->n_pages_rekeyed++;
+
+  return NO_ERROR;
+}
+
+/*
+ * file_tde_rekey () - make the encrypted pages of a file, which are of an old perm data key, re-encrypted
+ *                     with the current one
+ *
+ * return                : NO_ERROR, or ER_code
+ * thread_p (in)         : Thread entry
+ * vfid (in)             : File identifier
+ * dk_gen (in)           : The current generation of the perm data key
+ * n_pages_rekeyed (out) : The number of pages to be re-encrypted
+ *
+ * NOTE: The pages are only dirtied here, the page flush encrypts them with the current key.
+ *       Not only the files with encrypted header, but all the file types that can be encrypted are visited,
+ *       because some pages may remain encrypted when ALTER TABLE ... ENCRYPT = NONE was interrupted.
+ *       It is paced by the flush tokens not to compete with the page flush.
+ */
+int
+file_tde_rekey (THREAD_ENTRY * thread_p, const VFID * vfid, int dk_gen, int *n_pages_rekeyed)
+{
+  int error_code = NO_ERROR;
+  VPID vpid_fhead;
+  PAGE_PTR page_fhead = NULL;
+  FILE_HEADER *fhead = NULL;
+  FILE_TDE_REKEY_ARGS rekey_args;
+
+  assert (vfid != NULL && !VFID_ISNULL (vfid));
+  assert (n_pages_rekeyed != NULL);
+
+  *n_pages_rekeyed = 0;
+
+  FILE_GET_HEADER_VPID (vfid, &vpid_fhead);
+  page_fhead = pgbuf_fix (thread_p, &vpid_fhead, OLD_PAGE, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+  if (page_fhead == NULL)
     {
-      goto exit;
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
     }
 
-  if (!FILE_IS_TEMPORARY (fhead))
+  fhead = (FILE_HEADER *) page_fhead;
+  file_header_sanity_check (thread_p, fhead);
+
+  switch (fhead->type)
     {
-      /* map over full table */
-      context.is_partial = false;
-      FILE_HEADER_GET_FULL_FTAB (fhead, extdata_ftab);
-      error_code = file_extdata_apply_funcs (thread_p, extdata_ftab, NULL, NULL, file_sector_map_pages, &context,
-					     false, NULL, NULL);
-      if (error_code != NO_ERROR)
+    case FILE_HEAP:
+    case FILE_HEAP_REUSE_SLOTS:
+    case FILE_MULTIPAGE_OBJECT_HEAP:
+    case FILE_BTREE:
+    case FILE_BTREE_OVERFLOW_KEY:
+      if (!FILE_IS_TEMPORARY (fhead))
 	{
-	  goto exit;
+	  break;
 	}
+      /* fall through */
+    default:
+      /* never encrypted by the perm data key */
+      pgbuf_unfix (thread_p, page_fhead);
+      return NO_ERROR;
     }
 
-  assert (error_code == NO_ERROR);
+  rekey_args.dk_gen = dk_gen;
+  rekey_args.n_pages_rekeyed = 0;
 
-exit:
-  if (page_fhead != NULL)
-    {
-      pgbuf_unfix (thread_p, page_fhead);
-    }
-  if (context.ftab_collector.partsect_ftab != NULL)
-    {
-      db_private_free (thread_p, context.ftab_collector.partsect_ftab);
-    }
+  /* page_fhead is unfixed in it */
+  error_code = file_tde_map_user_pages (thread_p, vfid, page_fhead, file_tde_rekey_page, &rekey_args, true);
 
+  *n_pages_rekeyed = rekey_args.n_pages_rekeyed;
   return error_code;
 }
 
-
 /*
  * file_dealloc () - Deallocate a file page.
  *
@@ -8443,6 +8770,19 @@ file_temp_alloc (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, FILE_ALLOC_TYPE a
 
   file_log ("file_temp_alloc", "%s", FILE_ALLOC_TYPE_STRING (alloc_type));
 
+  if (alloc_type == FILE_ALLOC_USER_PAGE)
+    {
+      /* stop runaway queries before they take all temporary space */
+      int quota = prm_get_integer_value (PRM_ID_TEMP_FILE_MAX_PAGES_PER_TRAN);
+
+      if (quota >= 0 && file_Tempcache->tran_npages[file_get_tempcache_entry_index (thread_p)] >= quota)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_FILE_TRAN_TEMP_QUOTA_EXCEEDED, 1, quota);
+	  error_code = ER_FILE_TRAN_TEMP_QUOTA_EXCEEDED;
+	  goto exit;
+	}
+    }
+
   FILE_GET_HEADER_VPID (&fhead->self, &vpid_fhead);
 
   /* get page for last allocated partial table */
@@ -8626,6 +8966,7 @@ file_temp_alloc (THREAD_ENTRY * thread_p, PAGE_PTR page_fhead, FILE_ALLOC_TYPE a
   if (alloc_type == FILE_ALLOC_USER_PAGE)
     {
       ATOMIC_INC_32 (&file_Tempcache->spacedb_temp.npage_user, 1);
+      file_Tempcache->tran_npages[file_get_tempcache_entry_index (thread_p)]++;
     }
   else
     {
@@ -8894,6 +9235,9 @@ file_temp_preserve (THREAD_ENTRY * thread_p, const VFID * vfid)
     {
       file_tempcache_retire_entry (entry);
     }
+
+  /* preserved file outlives transaction */
+  file_tempcache_unaccount_tran_pages (thread_p, vfid);
 }
 
 /************************************************************************/
@@ -8956,6 +9300,19 @@ file_tempcache_init (void)
     }
   memset (file_Tempcache->tran_files, 0, memsize);
 
+  /* allocate transaction temporary pages counters */
+  memsize = ntrans * sizeof (int);
+  file_Tempcache->tran_npages = (int *) malloc (memsize);
+  if (file_Tempcache->tran_npages == NULL)
+    {
+      free_and_init (file_Tempcache->tran_files);
+      pthread_mutex_destroy (&file_Tempcache->mutex);
+      free_and_init (file_Tempcache);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, memsize);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (file_Tempcache->tran_npages, 0, memsize);
+
   /* stats */
   memset (&file_Tempcache->spacedb_temp, 0, sizeof (file_Tempcache->spacedb_temp));
 
@@ -8997,6 +9354,7 @@ file_tempcache_final (void)
 	}
     }
   free_and_init (file_Tempcache->tran_files);
+  free_and_init (file_Tempcache->tran_npages);
 
   /* temporary volumes are removed, we don't have to destroy files */
   file_tempcache_free_entry_list (&file_Tempcache->cached_not_numerable);
@@ -9387,6 +9745,37 @@ file_tempcache_drop_tran_temp_files (THREAD_ENTRY * thread_p)
       file_tempcache_cache_or_drop_entries (thread_p,
 					    &file_Tempcache->tran_files[file_get_tempcache_entry_index (thread_p)]);
     }
+
+  /* next transaction starts its temporary space quota from zero */
+  file_Tempcache->tran_npages[file_get_tempcache_entry_index (thread_p)] = 0;
+}
+
+/*
+ * file_tempcache_unaccount_tran_pages () - remove user pages of temporary file from transaction temporary pages count
+ *
+ * return        : void
+ * thread_p (in) : thread entry
+ * vfid (in)     : file identifier
+ */
+STATIC_INLINE void
+file_tempcache_unaccount_tran_pages (THREAD_ENTRY * thread_p, const VFID * vfid)
+{
+  int *tran_npages_p = &file_Tempcache->tran_npages[file_get_tempcache_entry_index (thread_p)];
+  FILE_HEADER fhead;
+
+  if (*tran_npages_p == 0)
+    {
+      return;
+    }
+  if (file_header_copy (thread_p, vfid, &fhead) != NO_ERROR)
+    {
+      /* count is only used for quota */
+      er_clear ();
+      return;
+    }
+
+  /* count was reset if transaction ended meanwhile; never go below zero */
+  *tran_npages_p = MAX (*tran_npages_p - fhead.n_page_user, 0);
 }
 
 /*
@@ -11520,8 +11909,7 @@ xfile_apply_tde_to_class_files (THREAD_ENTRY * thread_p, const OID * class_oid)
       goto exit;
     }
 
-  /* It is expected for flags in the class record to be set in advance */
-  assert (tde_algo != TDE_ALGORITHM_NONE);
+  /* It is expected for flags in the class record to be set in advance. TDE_ALGORITHM_NONE decrypts the files. */
 
   /* apply to heap file and heap overflow file */
   error_code = heap_get_class_info (thread_p, class_oid, &hfid, NULL, NULL);
@@ -62,6 +62,7 @@
 #include "stream_to_xasl.h"
 #include "query_opfunc.h"
 #include "set_object.h"
+#include "perf_hotpath.hpp"
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
 #endif /* ENABLE_SYSTEMTAP */
@@ -71,6 +72,8 @@
 #include "log_append.hpp"
 #include "string_buffer.hpp"
 #include "tde.h"
+#include "tsc_timer.h"
+#include "filter_pred_cache.h"
 
 #include <set>
 
@@ -97,6 +100,8 @@ static int rv;
 
 #define HEAP_STATS_ENTRY_MHT_EST_SIZE 1000
 #define HEAP_STATS_ENTRY_FREELIST_SIZE 1000
+/* The best space cache is split by page, so concurrent inserts take different locks and different pages. */
+#define HEAP_STATS_BESTSPACE_SHARD_COUNT 16
 
 /* A good space to accept insertions */
 #define HEAP_DROP_FREE_SPACE (int)(DB_PAGESIZE * 0.3)
@@ -311,7 +316,7 @@ struct heap_classrepr_entry
   pthread_mutex_t mutex;
   int idx;			/* Cache index. Used to pass the index when a class representation is in the cache */
   int fcnt;			/* How many times this structure has been fixed. It cannot be deallocated until this
-				 * value is zero.  */
+				 * value is zero. Changed atomically; it goes from zero or to zero only under mutex. */
   int zone;			/* ZONE_VOID, ZONE_LRU, ZONE_FREE */
   int force_decache;
 
@@ -478,6 +483,44 @@ struct heap_stats_bestspace_cache
   pthread_mutex_t bestspace_mutex;
 };
 
+/* Zone map: the smallest and the greatest value of an attribute in a heap page, cached for the heap scans to skip the
+ * pages that cannot have qualified records. Page buffer counts the changes of the pages in change stamps; a zone is
+ * valid only while the stamp of its page is the same, so the changes of page only make it stale and the next scan
+ * computes it again. A valid zone also tells the next page and the visibility of page, so the scan can skip the page
+ * without fixing it. The map is direct-mapped; a zone replaces the one of another page hashed to the same entry. */
+typedef enum
+{
+  HEAP_ZONE_EMPTY,		/* no record of page has a not null value */
+  HEAP_ZONE_RANGE,		/* the not null values are in [min_value, max_value] */
+  HEAP_ZONE_UNKNOWN		/* some values are not in page or cannot be compared */
+} HEAP_ZONE_STATE;
+
+typedef struct heap_zone HEAP_ZONE;
+struct heap_zone
+{
+  VPID vpid;			/* page of zone, or null if entry is not used */
+  ATTR_ID attrid;
+  LOG_LSA page_lsa;		/* page LSA when zone was computed */
+  int change_stamp;		/* change stamp of page when zone was computed */
+  VPID next_vpid;		/* next page of heap */
+  MVCCID max_mvccid;		/* newest MVCC operation in page */
+  bool is_vacuumed;		/* vacuum did all the work that the MVCC operations in page required */
+  HEAP_ZONE_STATE state;
+  DB_VALUE min_value;
+  DB_VALUE max_value;
+};
+
+#define HEAP_ZONE_MAP_MUTEX_COUNT 64
+
+typedef struct heap_zone_map HEAP_ZONE_MAP;
+struct heap_zone_map
+{
+  HEAP_ZONE *zones;
+  int num_zones;
+  int *change_stamps;		/* change counters of the pages hashed to each entry */
+  pthread_mutex_t zone_mutex[HEAP_ZONE_MAP_MUTEX_COUNT];	/* zone i is protected by zone_mutex[i % count] */
+};
+
 typedef struct heap_show_scan_ctx HEAP_SHOW_SCAN_CTX;
 struct heap_show_scan_ctx
 {
@@ -496,10 +539,9 @@ static HEAP_CHNGUESS heap_Guesschn_area = { NULL, NULL, NULL, false, 0,
 
 static HEAP_CHNGUESS *heap_Guesschn = NULL;
 
-static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area =
-  { 0, NULL, NULL, 0, 0, 0, NULL, PTHREAD_MUTEX_INITIALIZER };
+static HEAP_STATS_BESTSPACE_CACHE heap_Bestspace_cache_area[HEAP_STATS_BESTSPACE_SHARD_COUNT];
 
-static HEAP_STATS_BESTSPACE_CACHE *heap_Bestspace = NULL;
+static HEAP_STATS_BESTSPACE_CACHE *heap_Bestspace = NULL;	/* the shards: a page is cached only in its own shard */
 
 static HEAP_HFID_TABLE heap_Hfid_table_area = { LF_HASH_TABLE_INITIALIZER, LF_ENTRY_DESCRIPTOR_INITIALIZER,
   LF_FREELIST_INITIALIZER, false
@@ -507,6 +549,8 @@ static HEAP_HFID_TABLE heap_Hfid_table_area = { LF_HASH_TABLE_INITIALIZER, LF_EN
 
 static HEAP_HFID_TABLE *heap_Hfid_table = NULL;
 
+static HEAP_ZONE_MAP heap_Zone_map;
+
 #define heap_hfid_table_log(thp, oidp, msg, ...) \
   if (heap_Hfid_table->logging) \
     er_print_callstack (ARG_FILE_LINE, "HEAP_INFO_CACHE[thr(%d),tran(%d,%d),OID(%d|%d|%d)]: " msg "\n", \
@@ -611,6 +655,7 @@ static int heap_classrepr_dump_cache (bool simple_dump);
 static int heap_classrepr_entry_reset (HEAP_CLASSREPR_ENTRY * cache_entry);
 static int heap_classrepr_entry_remove_from_LRU (HEAP_CLASSREPR_ENTRY * cache_entry);
 static HEAP_CLASSREPR_ENTRY *heap_classrepr_entry_alloc (void);
+static OR_CLASSREP *heap_classrepr_get_if_fixed (const OID * class_oid, REPR_ID reprid, int *idx_incache);
 static int heap_classrepr_entry_free (HEAP_CLASSREPR_ENTRY * cache_entry);
 
 static OR_CLASSREP *heap_classrepr_get_from_record (THREAD_ENTRY * thread_p, REPR_ID * last_reprid,
@@ -637,6 +682,7 @@ static int heap_get_last_page (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_
 			       HEAP_SCANCACHE * scan_cache, VPID * last_vpid, PGBUF_WATCHER * pg_watcher);
 
 static int heap_vpid_init_new (THREAD_ENTRY * thread_p, PAGE_PTR page, void *args);
+static void heap_init_new_page_chain (HEAP_CHAIN * chain, OID class_oid);
 static int heap_vpid_alloc (THREAD_ENTRY * thread_p, const HFID * hfid, PAGE_PTR hdr_pgptr, HEAP_HDR_STATS * heap_hdr,
 			    HEAP_SCANCACHE * scan_cache, PGBUF_WATCHER * new_pg_watcher);
 static VPID *heap_vpid_remove (THREAD_ENTRY * thread_p, const HFID * hfid, HEAP_HDR_STATS * heap_hdr, VPID * rm_vpid);
@@ -657,6 +703,10 @@ static SCAN_CODE heap_ovf_get (THREAD_ENTRY * thread_p, const OID * ovf_oid, REC
 			       MVCC_SNAPSHOT * mvcc_snapshot);
 static int heap_ovf_get_capacity (THREAD_ENTRY * thread_p, const OID * ovf_oid, int *ovf_len, int *ovf_num_pages,
 				  int *ovf_overhead, int *ovf_free_space);
+static SCAN_CODE heap_ovf_get_prefix (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const OID * ovf_oid,
+				      RECDES * recdes);
+static int heap_ovf_read_attrinfo_part (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_SCANCACHE * scan_cache,
+					HEAP_CACHE_ATTRINFO * attr_info);
 
 static int heap_scancache_check_with_hfid (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
 					   HEAP_SCANCACHE ** scan_cache);
@@ -735,6 +785,8 @@ static bool heap_is_reusable_oid (const FILE_TYPE file_type);
 static SCAN_CODE heap_attrinfo_transform_to_disk_internal (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info,
 							   RECDES * old_recdes, record_descriptor * new_recdes,
 							   int lob_create_flag);
+STATIC_INLINE HEAP_STATS_BESTSPACE_CACHE *heap_stats_bestspace_shard (const VPID * vpid)
+  __attribute__ ((ALWAYS_INLINE));
 static int heap_stats_del_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid);
 static int heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid);
 #if defined (ENABLE_UNUSED_FUNCTION)
@@ -764,7 +816,9 @@ static SCAN_CODE heap_get_record_info (THREAD_ENTRY * thread_p, const OID oid, R
 				       DB_VALUE ** record_info);
 static SCAN_CODE heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 				     RECDES * recdes, HEAP_SCANCACHE * scan_cache, bool ispeeking,
-				     bool reversed_direction, DB_VALUE ** cache_recordinfo);
+				     bool reversed_direction, DB_VALUE ** cache_recordinfo,
+				     HEAP_PARALLEL_CURSOR * parallel_cursor);
+static int heap_parallel_cursor_claim (THREAD_ENTRY * thread_p, HEAP_PARALLEL_CURSOR * cursor, VPID * vpid);
 
 static SCAN_CODE heap_get_page_info (THREAD_ENTRY * thread_p, const OID * cls_oid, const HFID * hfid, const VPID * vpid,
 				     const PAGE_PTR pgptr, DB_VALUE ** page_info);
@@ -855,6 +909,16 @@ static int heap_get_class_info_from_record (THREAD_ENTRY * thread_p, const OID *
 					    char **classname_out);
 
 static void heap_page_update_chain_after_mvcc_op (THREAD_ENTRY * thread_p, PAGE_PTR heap_page, MVCCID mvccid);
+static bool heap_page_is_all_visible (THREAD_ENTRY * thread_p, PAGE_PTR heap_page, MVCC_SNAPSHOT * snapshot);
+static int heap_zone_map_initialize (void);
+static void heap_zone_map_finalize (void);
+static bool heap_zone_is_comparable_type (DB_TYPE type);
+static unsigned int heap_zone_map_hash (const VPID * vpid, ATTR_ID attrid);
+static void heap_zone_compute (THREAD_ENTRY * thread_p, PAGE_PTR heap_page, HEAP_ZONE_FILTER * filter,
+			       HEAP_ZONE * zone);
+static bool heap_zone_is_skipped (const HEAP_ZONE * zone, const HEAP_ZONE_FILTER * filter, MVCC_SNAPSHOT * snapshot);
+static bool heap_zone_filter_skips_page (THREAD_ENTRY * thread_p, PAGE_PTR heap_page, HEAP_SCANCACHE * scan_cache);
+static void heap_zone_filter_skip_pages (HEAP_SCANCACHE * scan_cache, VPID * vpid);
 static void heap_page_rv_chain_update (THREAD_ENTRY * thread_p, PAGE_PTR heap_page, MVCCID mvccid,
 				       bool vacuum_status_change);
 
@@ -956,34 +1020,47 @@ heap_compare_hfid (const void *key_hfid1, const void *key_hfid2)
   return HFID_EQ (hfid1, hfid2);
 }
 
+/*
+ * heap_stats_bestspace_shard () - get the best space cache shard of a page
+ *   return: shard
+ *   vpid(in): page
+ */
+STATIC_INLINE HEAP_STATS_BESTSPACE_CACHE *
+heap_stats_bestspace_shard (const VPID * vpid)
+{
+  return &heap_Bestspace[heap_hash_vpid (vpid, HEAP_STATS_BESTSPACE_SHARD_COUNT)];
+}
+
 /*
  * heap_stats_entry_free () - release all memory occupied by an best space
  *   return:  NO_ERROR
  *   data(in): a best space associated with the key
- *   args(in): NULL (not used here, but needed by mht_map)
+ *   args(in): the best space cache shard of the entry
  */
 static int
 heap_stats_entry_free (THREAD_ENTRY * thread_p, void *data, void *args)
 {
   HEAP_STATS_ENTRY *ent;
+  HEAP_STATS_BESTSPACE_CACHE *shard = (HEAP_STATS_BESTSPACE_CACHE *) args;
 
   ent = (HEAP_STATS_ENTRY *) data;
   assert_release (ent != NULL);
+  assert (shard != NULL);
 
   if (ent)
     {
-      if (heap_Bestspace->free_list_count < HEAP_STATS_ENTRY_FREELIST_SIZE)
+      if (shard->free_list_count < HEAP_STATS_ENTRY_FREELIST_SIZE / HEAP_STATS_BESTSPACE_SHARD_COUNT)
 	{
-	  ent->next = heap_Bestspace->free_list;
-	  heap_Bestspace->free_list = ent;
+	  ent->next = shard->free_list;
+	  shard->free_list = ent;
 
-	  heap_Bestspace->free_list_count++;
+	  shard->free_list_count++;
 	}
       else
 	{
 	  free_and_init (ent);
 
-	  heap_Bestspace->num_free++;
+	  shard->num_free++;
 	}
     }
 
@@ -996,7 +1073,9 @@ heap_stats_entry_free (THREAD_ENTRY * thread_p, void *data, void *args)
 static HEAP_STATS_ENTRY *
 heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpid, int freespace)
 {
+  HEAP_STATS_BESTSPACE_CACHE *shard;
   HEAP_STATS_ENTRY *ent;
+  int max_shard_entries;
   int rc;
   PERF_UTIME_TRACKER time_best_space = PERF_UTIME_TRACKER_INITIALIZER;
 
@@ -1004,9 +1083,13 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
 
   PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
 
-  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+  shard = heap_stats_bestspace_shard (vpid);
+  max_shard_entries =
+    MAX (prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) / HEAP_STATS_BESTSPACE_SHARD_COUNT, 1);
+
+  rc = pthread_mutex_lock (&shard->bestspace_mutex);
 
-  ent = (HEAP_STATS_ENTRY *) mht_get (heap_Bestspace->vpid_ht, vpid);
+  ent = (HEAP_STATS_ENTRY *) mht_get (shard->vpid_ht, vpid);
 
   if (ent)
     {
@@ -1014,7 +1097,7 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
       goto end;
     }
 
-  if (heap_Bestspace->num_stats_entries >= prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES))
+  if (shard->num_stats_entries >= max_shard_entries)
     {
       er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_HF_MAX_BESTSPACE_ENTRIES, 1,
 	      prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES));
@@ -1025,19 +1108,19 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
       goto end;
     }
 
-  if (heap_Bestspace->free_list_count > 0)
+  if (shard->free_list_count > 0)
     {
-      assert_release (heap_Bestspace->free_list != NULL);
+      assert_release (shard->free_list != NULL);
 
-      ent = heap_Bestspace->free_list;
+      ent = shard->free_list;
       if (ent == NULL)
 	{
 	  goto end;
 	}
-      heap_Bestspace->free_list = ent->next;
+      shard->free_list = ent->next;
       ent->next = NULL;
 
-      heap_Bestspace->free_list_count--;
+      shard->free_list_count--;
     }
   else
     {
@@ -1049,7 +1132,7 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
 	  goto end;
 	}
 
-      heap_Bestspace->num_alloc++;
+      shard->num_alloc++;
     }
 
   HFID_COPY (&ent->hfid, hfid);
@@ -1057,30 +1140,30 @@ heap_stats_add_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, VPID * vpi
   ent->best.freespace = freespace;
   ent->next = NULL;
 
-  if (mht_put (heap_Bestspace->vpid_ht, &ent->best.vpid, ent) == NULL)
+  if (mht_put (shard->vpid_ht, &ent->best.vpid, ent) == NULL)
     {
       assert_release (false);
-      (void) heap_stats_entry_free (thread_p, ent, NULL);
+      (void) heap_stats_entry_free (thread_p, ent, shard);
       ent = NULL;
       goto end;
     }
 
-  if (mht_put_new (heap_Bestspace->hfid_ht, &ent->hfid, ent) == NULL)
+  if (mht_put_new (shard->hfid_ht, &ent->hfid, ent) == NULL)
     {
       assert_release (false);
-      (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
-      (void) heap_stats_entry_free (thread_p, ent, NULL);
+      (void) mht_rem (shard->vpid_ht, &ent->best.vpid, NULL, NULL);
+      (void) heap_stats_entry_free (thread_p, ent, shard);
       ent = NULL;
       goto end;
     }
 
-  heap_Bestspace->num_stats_entries++;
+  shard->num_stats_entries++;
 
 end:
 
-  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
+  assert (mht_count (shard->vpid_ht) == mht_count (shard->hfid_ht));
 
-  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+  pthread_mutex_unlock (&shard->bestspace_mutex);
 
   PERF_UTIME_TRACKER_TIME (thread_p, &time_best_space, PSTAT_HF_BEST_SPACE_ADD);
 
@@ -1096,31 +1179,40 @@ end:
 static int
 heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 {
+  HEAP_STATS_BESTSPACE_CACHE *shard;
   HEAP_STATS_ENTRY *ent;
-  int del_cnt = 0;
+  int del_cnt = 0, shard_del_cnt;
+  int i;
   int rc;
   PERF_UTIME_TRACKER time_best_space = PERF_UTIME_TRACKER_INITIALIZER;
 
   PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
 
-  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
-
-  while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, NULL)) != NULL)
+  for (i = 0; i < HEAP_STATS_BESTSPACE_SHARD_COUNT; i++)
     {
-      (void) mht_rem2 (heap_Bestspace->hfid_ht, &ent->hfid, ent, NULL, NULL);
-      (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
-      (void) heap_stats_entry_free (thread_p, ent, NULL);
-      ent = NULL;
+      shard = &heap_Bestspace[i];
+      shard_del_cnt = 0;
 
-      del_cnt++;
-    }
+      rc = pthread_mutex_lock (&shard->bestspace_mutex);
+
+      while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (shard->hfid_ht, hfid, NULL)) != NULL)
+	{
+	  (void) mht_rem2 (shard->hfid_ht, &ent->hfid, ent, NULL, NULL);
+	  (void) mht_rem (shard->vpid_ht, &ent->best.vpid, NULL, NULL);
+	  (void) heap_stats_entry_free (thread_p, ent, shard);
+	  ent = NULL;
+
+	  shard_del_cnt++;
+	}
 
-  assert (del_cnt <= heap_Bestspace->num_stats_entries);
+      assert (shard_del_cnt <= shard->num_stats_entries);
 
-  heap_Bestspace->num_stats_entries -= del_cnt;
+      shard->num_stats_entries -= shard_del_cnt;
+      del_cnt += shard_del_cnt;
 
-  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
-  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+      assert (mht_count (shard->vpid_ht) == mht_count (shard->hfid_ht));
+      pthread_mutex_unlock (&shard->bestspace_mutex);
+    }
 
   PERF_UTIME_TRACKER_TIME (thread_p, &time_best_space, PSTAT_HF_BEST_SPACE_DEL);
 
@@ -1136,30 +1228,32 @@ heap_stats_del_bestspace_by_hfid (THREAD_ENTRY * thread_p, const HFID * hfid)
 static int
 heap_stats_del_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
 {
+  HEAP_STATS_BESTSPACE_CACHE *shard;
   HEAP_STATS_ENTRY *ent;
   int rc;
   PERF_UTIME_TRACKER time_best_space = PERF_UTIME_TRACKER_INITIALIZER;
 
   PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
-  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+  shard = heap_stats_bestspace_shard (vpid);
+  rc = pthread_mutex_lock (&shard->bestspace_mutex);
 
-  ent = (HEAP_STATS_ENTRY *) mht_get (heap_Bestspace->vpid_ht, vpid);
+  ent = (HEAP_STATS_ENTRY *) mht_get (shard->vpid_ht, vpid);
   if (ent == NULL)
     {
       goto end;
     }
 
-  (void) mht_rem2 (heap_Bestspace->hfid_ht, &ent->hfid, ent, NULL, NULL);
-  (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
-  (void) heap_stats_entry_free (thread_p, ent, NULL);
+  (void) mht_rem2 (shard->hfid_ht, &ent->hfid, ent, NULL, NULL);
+  (void) mht_rem (shard->vpid_ht, &ent->best.vpid, NULL, NULL);
+  (void) heap_stats_entry_free (thread_p, ent, shard);
   ent = NULL;
 
-  heap_Bestspace->num_stats_entries -= 1;
+  shard->num_stats_entries -= 1;
 
 end:
-  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
+  assert (mht_count (shard->vpid_ht) == mht_count (shard->hfid_ht));
 
-  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+  pthread_mutex_unlock (&shard->bestspace_mutex);
 
   PERF_UTIME_TRACKER_TIME (thread_p, &time_best_space, PSTAT_HF_BEST_SPACE_DEL);
 
@@ -1176,6 +1270,7 @@ end:
 static HEAP_BESTSPACE
 heap_stats_get_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
 {
+  HEAP_STATS_BESTSPACE_CACHE *shard = heap_stats_bestspace_shard (vpid);
   HEAP_STATS_ENTRY *ent;
   HEAP_BESTSPACE best;
   int rc;
@@ -1183,9 +1278,9 @@ heap_stats_get_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
   best.freespace = -1;
   VPID_SET_NULL (&best.vpid);
 
-  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
+  rc = pthread_mutex_lock (&shard->bestspace_mutex);
 
-  ent = (HEAP_STATS_ENTRY *) mht_get (heap_Bestspace->vpid_ht, vpid);
+  ent = (HEAP_STATS_ENTRY *) mht_get (shard->vpid_ht, vpid);
   if (ent == NULL)
     {
       goto end;
@@ -1194,9 +1289,9 @@ heap_stats_get_bestspace_by_vpid (THREAD_ENTRY * thread_p, VPID * vpid)
   best = ent->best;
 
 end:
-  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
+  assert (mht_count (shard->vpid_ht) == mht_count (shard->hfid_ht));
 
-  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+  pthread_mutex_unlock (&shard->bestspace_mutex);
 
   return best;
 }
@@ -1904,9 +1999,18 @@ heap_classrepr_free (OR_CLASSREP * classrep, int *idx_incache)
 
   cache_entry = &heap_Classrepr_cache.area[*idx_incache];
 
+  /* others still have it fixed; nothing else to do */
+  for (int fcnt = cache_entry->fcnt; fcnt > 1; fcnt = cache_entry->fcnt)
+    {
+      if (ATOMIC_CAS_32 (&cache_entry->fcnt, fcnt, fcnt - 1))
+	{
+	  *idx_incache = -1;
+	  return NO_ERROR;
+	}
+    }
+
   rv = pthread_mutex_lock (&cache_entry->mutex);
-  cache_entry->fcnt--;
-  if (cache_entry->fcnt == 0)
+  if (ATOMIC_INC_32 (&cache_entry->fcnt, -1) == 0)
     {
       /*
        * Is this entry declared to be decached
@@ -2233,6 +2337,74 @@ heap_classrepr_entry_free (HEAP_CLASSREPR_ENTRY * cache_entry)
   return NO_ERROR;
 }
 
+/*
+ * heap_classrepr_get_if_fixed () - Get a cached class representation without any mutex, if others have it fixed
+ *   return: classrepr, or NULL if it cannot be fixed this way
+ *
+ *   class_oid(in): The class identifier
+ *   reprid(in): Representation of the class or NULL_REPRID for last one
+ *   idx_incache(out): index of the cache entry
+ *
+ * Note: Representations of hot classes are fixed all the time. Such an entry cannot be reset or reused while its fix
+ *	 count is not zero, so it is fixed by an atomic increment of a non-zero fix count and checked afterwards. The
+ *	 hash chain is walked without its mutex: entries are never freed and are moved only under the mutex, so a
+ *	 racing walk may only miss the entry, and the locked search is done then.
+ */
+static OR_CLASSREP *
+heap_classrepr_get_if_fixed (const OID * class_oid, REPR_ID reprid, int *idx_incache)
+{
+  HEAP_CLASSREPR_ENTRY *cache_entry;
+  OR_CLASSREP *repr;
+  int fcnt;
+
+  for (cache_entry = VOLATILE_ACCESS (heap_Classrepr->hash_table[REPR_HASH (class_oid)].hash_next,
+				      HEAP_CLASSREPR_ENTRY *);
+       cache_entry != NULL; cache_entry = VOLATILE_ACCESS (cache_entry->hash_next, HEAP_CLASSREPR_ENTRY *))
+    {
+      if (OID_EQ (class_oid, &cache_entry->class_oid))
+	{
+	  break;
+	}
+    }
+  if (cache_entry == NULL)
+    {
+      return NULL;
+    }
+
+  do
+    {
+      fcnt = VOLATILE_ACCESS (cache_entry->fcnt, int);
+      if (fcnt <= 0)
+	{
+	  /* not fixed by anyone; it may be reused meanwhile */
+	  return NULL;
+	}
+    }
+  while (!ATOMIC_CAS_32 (&cache_entry->fcnt, fcnt, fcnt + 1));
+
+  /* the entry is fixed now; check it is still the one of the class */
+  *idx_incache = cache_entry->idx;
+  repr = NULL;
+  if (OID_EQ (class_oid, &cache_entry->class_oid) && !cache_entry->force_decache)
+    {
+      if (reprid == NULL_REPRID)
+	{
+	  reprid = cache_entry->last_reprid;
+	}
+      if (reprid > NULL_REPRID && reprid <= cache_entry->last_reprid && reprid < cache_entry->max_reprid)
+	{
+	  repr = VOLATILE_ACCESS (cache_entry->repr[reprid], OR_CLASSREP *);
+	}
+    }
+
+  if (repr == NULL)
+    {
+      /* not usable; unfix and let the locked search handle it */
+      (void) heap_classrepr_free (NULL, idx_incache);
+    }
+  return repr;
+}
+
 /*
  * heap_classrepr_get_from_record ()
  *   return: classrepr
@@ -2305,10 +2477,17 @@ heap_classrepr_get (THREAD_ENTRY * thread_p, const OID * class_oid, RECDES * cla
   OR_CLASSREP *repr_from_record = NULL;
   OR_CLASSREP *repr_last = NULL;
   REPR_ID last_reprid;
+  bool is_loaded = false;
   int r;
 
   *idx_incache = -1;
 
+  repr = heap_classrepr_get_if_fixed (class_oid, reprid, idx_incache);
+  if (repr != NULL)
+    {
+      return repr;
+    }
+
   hash_anchor = &heap_Classrepr->hash_table[REPR_HASH (class_oid)];
 
   /* search entry with class_oid from hash chain */
@@ -2528,6 +2707,7 @@ search_begin:
 
       heap_classrepr_log_stack ("heap_classrepr_get %d|%d|%d add repr %p to cache_entry %p", OID_AS_ARGS (class_oid),
 				repr, cache_entry);
+      is_loaded = true;
     }
   else
     {
@@ -2574,12 +2754,13 @@ search_begin:
 	      cache_entry->repr[reprid] = repr_from_record;
 	      repr = repr_from_record;
 	      repr_from_record = NULL;
+	      is_loaded = true;
 
 	      /* fall through */
 	    }
 	}
 
-      cache_entry->fcnt++;
+      ATOMIC_INC_32 (&cache_entry->fcnt, 1);
       *idx_incache = cache_entry->idx;
     }
   pthread_mutex_unlock (&cache_entry->mutex);
@@ -2593,6 +2774,11 @@ exit:
     {
       or_free_classrep (repr_last);
     }
+  if (is_loaded && repr != NULL)
+    {
+      /* The representation was just read from disk; get the filter predicates of its indexes ready too. */
+      fpcache_prewarm (thread_p, class_oid, repr);
+    }
   return repr;
 }
 
@@ -3246,11 +3432,13 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   HEAP_FINDSPACE found;
   int old_wait_msecs;
   int notfound_cnt;
+  HEAP_STATS_BESTSPACE_CACHE *shard;
   HEAP_STATS_ENTRY *ent;
   HEAP_BESTSPACE best;
   int rc;
   int idx_worstspace;
   int i, best_array_index = -1;
+  int shard_index, first_shard_index;
   bool hash_is_available;
   bool best_hint_is_used;
   PERF_UTIME_TRACKER time_best_space = PERF_UTIME_TRACKER_INITIALIZER;
@@ -3273,6 +3461,8 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
   notfound_cnt = 0;
   best_array_index = 0;
   hash_is_available = prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0;
+  /* each thread starts from its own shard and takes pages from the other shards only when its shard has none */
+  first_shard_index = thread_get_entry_index (thread_p) % HEAP_STATS_BESTSPACE_SHARD_COUNT;
 
   while (found == HEAP_FINDSPACE_NOTFOUND)
     {
@@ -3282,30 +3472,38 @@ heap_stats_find_page_in_bestspace (THREAD_ENTRY * thread_p, const HFID * hfid, H
       if (hash_is_available)
 	{
 	  PERF_UTIME_TRACKER_START (thread_p, &time_best_space);
-	  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
 
-	  while (notfound_cnt < BEST_PAGE_SEARCH_MAX_COUNT
-		 && (ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, NULL)) != NULL)
+	  for (i = 0; i < HEAP_STATS_BESTSPACE_SHARD_COUNT && best.freespace == -1; i++)
 	    {
-	      if (ent->best.freespace >= needed_space)
+	      shard_index = (first_shard_index + i) % HEAP_STATS_BESTSPACE_SHARD_COUNT;
+	      shard = &heap_Bestspace[shard_index];
+
+	      rc = pthread_mutex_lock (&shard->bestspace_mutex);
+
+	      while (notfound_cnt < BEST_PAGE_SEARCH_MAX_COUNT
+		     && (ent = (HEAP_STATS_ENTRY *) mht_get2 (shard->hfid_ht, hfid, NULL)) != NULL)
 		{
-		  best = ent->best;
-		  assert (best.freespace > 0 && best.freespace <= PGLENGTH_MAX);
-		  break;
-		}
+		  if (ent->best.freespace >= needed_space)
+		    {
+		      best = ent->best;
+		      assert (best.freespace > 0 && best.freespace <= PGLENGTH_MAX);
+		      break;
+		    }
 
-	      /* remove in memory bestspace */
-	      (void) mht_rem2 (heap_Bestspace->hfid_ht, &ent->hfid, ent, NULL, NULL);
-	      (void) mht_rem (heap_Bestspace->vpid_ht, &ent->best.vpid, NULL, NULL);
-	      (void) heap_stats_entry_free (thread_p, ent, NULL);
-	      ent = NULL;
+		  /* remove in memory bestspace */
+		  (void) mht_rem2 (shard->hfid_ht, &ent->hfid, ent, NULL, NULL);
+		  (void) mht_rem (shard->vpid_ht, &ent->best.vpid, NULL, NULL);
+		  (void) heap_stats_entry_free (thread_p, ent, shard);
+		  ent = NULL;
 
-	      heap_Bestspace->num_stats_entries--;
+		  shard->num_stats_entries--;
 
-	      notfound_cnt++;
+		  notfound_cnt++;
+		}
+
+	      pthread_mutex_unlock (&shard->bestspace_mutex);
 	    }
 
-	  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
 	  PERF_UTIME_TRACKER_TIME (thread_p, &time_best_space, PSTAT_HF_BEST_SPACE_FIND);
 	}
 
@@ -5098,6 +5296,12 @@ heap_manager_initialize (void)
 
   /* Initialize class OID->HFID cache */
   ret = heap_initialize_hfid_table ();
+  if (ret != NO_ERROR)
+    {
+      return ret;
+    }
+
+  ret = heap_zone_map_initialize ();
 
   return ret;
 }
@@ -5132,6 +5336,8 @@ heap_manager_finalize (void)
 
   heap_finalize_hfid_table ();
 
+  heap_zone_map_finalize ();
+
   return ret;
 }
 
@@ -6633,6 +6839,137 @@ heap_ovf_get (THREAD_ENTRY * thread_p, const OID * ovf_oid, RECDES * recdes, int
   return scan;
 }
 
+/*
+ * heap_ovf_get_prefix () - get the part of a multipage object kept in the first overflow page into the area of scan
+ *			    cache
+ *   return: SCAN_CODE (Either of S_SUCCESS, S_ERROR)
+ *   scan_cache(in/out): Scan cache
+ *   ovf_oid(in): Overflow address
+ *   recdes(out): Record descriptor assigned to the area of scan cache
+ *
+ * Note: The area is reserved for the whole object, so the values already read from the prefix stay valid when the
+ *	 rest is read with heap_ovf_read_attrinfo_part.
+ */
+static SCAN_CODE
+heap_ovf_get_prefix (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, const OID * ovf_oid, RECDES * recdes)
+{
+  VPID ovf_vpid;
+  int length, rest_length;
+  SCAN_CODE scan;
+
+  length = heap_ovf_get_length (thread_p, ovf_oid);
+  if (length < 0)
+    {
+      ASSERT_ERROR ();
+      return S_ERROR;
+    }
+
+  scan_cache->assign_recdes_to_area (*recdes, (size_t) length);
+
+  ovf_vpid.pageid = ovf_oid->pageid;
+  ovf_vpid.volid = ovf_oid->volid;
+  scan = overflow_get_nbytes (thread_p, &ovf_vpid, recdes, 0, overflow_get_first_page_length (), &rest_length, NULL);
+  if (scan != S_SUCCESS)
+    {
+      return scan;
+    }
+
+  if (rest_length > 0)
+    {
+      COPY_OID (&scan_cache->ovf_oid, ovf_oid);
+      scan_cache->ovf_length = length;
+    }
+
+  return S_SUCCESS;
+}
+
+/*
+ * heap_ovf_read_attrinfo_part () - read the part of an overflow object that holds the attributes of attr_info, if
+ *				    only its prefix was read by heap_ovf_get_prefix
+ *   return: NO_ERROR, or error code
+ *   recdes(in/out): Instance record descriptor
+ *   scan_cache(in/out): Scan cache
+ *   attr_info(in): The attribute information structure, with read_classrepr of the record
+ *
+ * Note: The overflow pages after the last byte of the attributes are not fixed. A variable attribute ends where the
+ *	 next one starts, so the whole value of the attribute is read.
+ */
+static int
+heap_ovf_read_attrinfo_part (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_SCANCACHE * scan_cache,
+			     HEAP_CACHE_ATTRINFO * attr_info)
+{
+  OR_CLASSREP *classrepr = attr_info->read_classrepr;
+  HEAP_ATTRVALUE *value;
+  RECDES rest_recdes;
+  VPID ovf_vpid;
+  int fixed_offset, end_offset = 0, attr_end;
+  int rest_length;
+  int i;
+  int error_code;
+
+  if (scan_cache == NULL || OID_ISNULL (&scan_cache->ovf_oid) || !scan_cache->is_recdes_assigned_to_area (*recdes)
+      || recdes->length >= scan_cache->ovf_length)
+    {
+      /* the record is whole */
+      return NO_ERROR;
+    }
+
+  assert (classrepr != NULL);
+
+  fixed_offset = OR_FIXED_ATTRIBUTES_OFFSET_BY_OBJ (recdes->data, classrepr->n_variable);
+  if (fixed_offset > recdes->length)
+    {
+      /* the variable offset table itself is not in the prefix */
+      end_offset = scan_cache->ovf_length;
+    }
+
+  for (i = 0; i < attr_info->num_values && end_offset < scan_cache->ovf_length; i++)
+    {
+      value = &attr_info->values[i];
+      if (value->read_attrepr == NULL || value->attr_type != HEAP_INSTANCE_ATTR)
+	{
+	  /* not in the record */
+	  continue;
+	}
+
+      if (value->read_attrepr->is_fixed != 0)
+	{
+	  /* fixed attributes and their bound bits */
+	  attr_end = fixed_offset + classrepr->fixed_length
+	    + OR_BOUND_BIT_BYTES (classrepr->n_attributes - classrepr->n_variable);
+	}
+      else
+	{
+	  attr_end = OR_VAR_OFFSET (recdes->data, value->read_attrepr->location + 1);
+	}
+      end_offset = MAX (end_offset, attr_end);
+    }
+
+  end_offset = MIN (end_offset, scan_cache->ovf_length);
+  if (end_offset <= recdes->length)
+    {
+      return NO_ERROR;
+    }
+
+  /* append the missing bytes to the prefix; the area was reserved for the whole object */
+  assert (recdes->area_size >= scan_cache->ovf_length);
+  rest_recdes.data = recdes->data + recdes->length;
+  rest_recdes.area_size = recdes->area_size - recdes->length;
+  rest_recdes.length = 0;
+
+  ovf_vpid.pageid = scan_cache->ovf_oid.pageid;
+  ovf_vpid.volid = scan_cache->ovf_oid.volid;
+  if (overflow_get_nbytes (thread_p, &ovf_vpid, &rest_recdes, recdes->length, end_offset - recdes->length,
+			   &rest_length, NULL) != S_SUCCESS)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      return error_code;
+    }
+  recdes->length += rest_recdes.length;
+
+  return NO_ERROR;
+}
+
 /*
  * heap_ovf_get_capacity () - Find space consumed oveflow object
  *   return: NO_ERROR
@@ -6793,6 +7130,11 @@ heap_scancache_start_internal (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_ca
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = mvcc_snapshot;
   scan_cache->partition_list = NULL;
+  pgbuf_read_ahead_init (&scan_cache->read_ahead, false);
+  scan_cache->read_ovf_prefix = false;
+  OID_SET_NULL (&scan_cache->ovf_oid);
+  scan_cache->ovf_length = 0;
+  scan_cache->zone_filter = NULL;
 
   return ret;
 
@@ -7093,6 +7435,11 @@ heap_scancache_quick_start_internal (HEAP_SCANCACHE * scan_cache, const HFID * h
   scan_cache->debug_initpattern = HEAP_DEBUG_SCANCACHE_INITPATTERN;
   scan_cache->mvcc_snapshot = NULL;
   scan_cache->partition_list = NULL;
+  pgbuf_read_ahead_init (&scan_cache->read_ahead, false);
+  scan_cache->read_ovf_prefix = false;
+  OID_SET_NULL (&scan_cache->ovf_oid);
+  scan_cache->ovf_length = 0;
+  scan_cache->zone_filter = NULL;
 
   return NO_ERROR;
 }
@@ -7770,11 +8117,15 @@ heap_get_record_data_when_all_ready (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT *
  *			       be NULL COPY when the object is copied.
  * cache_recordinfo (in/out) : DB_VALUE pointer array that caches record
  *			       information values.
+ * parallel_cursor (in)	     : Cursor that gives the pages to scan, or NULL to
+ *			       scan all pages of the heap.
  */
 static SCAN_CODE
 heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
-		    HEAP_SCANCACHE * scan_cache, bool ispeeking, bool reversed_direction, DB_VALUE ** cache_recordinfo)
+		    HEAP_SCANCACHE * scan_cache, bool ispeeking, bool reversed_direction, DB_VALUE ** cache_recordinfo,
+		    HEAP_PARALLEL_CURSOR * parallel_cursor)
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_HEAP_NEXT);
   VPID vpid;
   VPID *vpidptr_incache;
   INT16 type = REC_UNKNOWN;
@@ -7814,9 +8165,28 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
   PGBUF_INIT_WATCHER (&curr_page_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
   PGBUF_INIT_WATCHER (&old_page_watcher, PGBUF_ORDERED_HEAP_NORMAL, hfid);
 
+  assert (parallel_cursor == NULL || !reversed_direction);
+
   if (OID_ISNULL (next_oid))
     {
-      if (reversed_direction)
+      if (parallel_cursor != NULL)
+	{
+	  /* Retrieve the first object of the first page given by cursor */
+	  if (heap_parallel_cursor_claim (thread_p, parallel_cursor, &vpid) != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return S_ERROR;
+	    }
+	  if (VPID_ISNULL (&vpid))
+	    {
+	      /* other scans took all the pages */
+	      return S_END;
+	    }
+	  oid.volid = vpid.volid;
+	  oid.pageid = vpid.pageid;
+	  oid.slotid = -1;
+	}
+      else if (reversed_direction)
 	{
 	  /* Retrieve the last record of the file. */
 	  if (heap_get_last_vpid (thread_p, hfid, &vpid) != NO_ERROR)
@@ -7894,7 +8264,13 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 		}
 	    }
 
-	  if (get_rec_info)
+	  if (scan_cache->zone_filter != NULL && !get_rec_info && oid.slotid <= 0
+	      && heap_zone_filter_skips_page (thread_p, curr_page_watcher.pgptr, scan_cache))
+	    {
+	      /* no record of page can qualify; go to next page */
+	      scan = S_END;
+	    }
+	  else if (get_rec_info)
 	    {
 	      /* Getting record information means that we need to scan all slots even if they store no object. */
 	      if (reversed_direction)
@@ -7955,15 +8331,34 @@ heap_next_internal (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid,
 	      if (scan == S_END)
 		{
 		  /* Find next page of heap and continue scanning */
-		  if (reversed_direction)
+		  if (parallel_cursor != NULL)
+		    {
+		      /* the next page is the next one given by cursor; do not keep a latch while waiting for it */
+		      pgbuf_ordered_unfix (thread_p, &curr_page_watcher);
+		      if (heap_parallel_cursor_claim (thread_p, parallel_cursor, &vpid) != NO_ERROR)
+			{
+			  ASSERT_ERROR ();
+			  return S_ERROR;
+			}
+		    }
+		  else if (reversed_direction)
 		    {
 		      (void) heap_vpid_prev (thread_p, hfid, curr_page_watcher.pgptr, &vpid);
 		    }
 		  else
 		    {
 		      (void) heap_vpid_next (thread_p, hfid, curr_page_watcher.pgptr, &vpid);
+		      if (scan_cache->zone_filter != NULL && !get_rec_info)
+			{
+			  /* go past the pages known to have no qualified records, without fixing them */
+			  heap_zone_filter_skip_pages (scan_cache, &vpid);
+			}
+		      pgbuf_read_ahead_sequential (thread_p, &scan_cache->read_ahead, &vpid);
+		    }
+		  if (curr_page_watcher.pgptr != NULL)
+		    {
+		      pgbuf_replace_watcher (thread_p, &curr_page_watcher, &old_page_watcher);
 		    }
-		  pgbuf_replace_watcher (thread_p, &curr_page_watcher, &old_page_watcher);
 		  oid.volid = vpid.volid;
 		  oid.pageid = vpid.pageid;
 		  oid.slotid = -1;
@@ -9049,6 +9444,33 @@ heap_estimate (THREAD_ENTRY * thread_p, const HFID * hfid, int *npages, int *nob
   return *npages;
 }
 
+/*
+ * heap_is_bulk_read_scan () - Is a full scan of the heap a bulk read of the page buffer?
+ *   return: true if the heap is big compared to the page buffer
+ *   hfid(in): Object heap file identifier
+ *
+ * Note: The size of the heap file is estimated by its user page count.
+ */
+bool
+heap_is_bulk_read_scan (THREAD_ENTRY * thread_p, const HFID * hfid)
+{
+  int npages = 0;
+
+  if (!prm_get_bool_value (PRM_ID_PB_BULK_READ_SCANS))
+    {
+      /* don't fix the file header for nothing */
+      return false;
+    }
+
+  if (file_get_num_user_pages (thread_p, &hfid->vfid, &npages) != NO_ERROR)
+    {
+      er_clear ();
+      return false;
+    }
+
+  return pgbuf_is_bulk_read_size (npages);
+}
+
 /*
  * heap_estimate_num_objects () - Estimate the number of objects
  *   return: number of records estimated or -1 in case of an error
@@ -9467,6 +9889,7 @@ heap_attrinfo_start (THREAD_ENTRY * thread_p, const OID * class_oid, int request
   OID_SET_NULL (&attr_info->inst_oid);
   attr_info->inst_chn = NULL_CHN;
   attr_info->values = NULL;
+  attr_info->lazy_recdes = NULL;
   attr_info->num_values = -1;	/* initialize attr_info */
 
   /*
@@ -10002,6 +10425,7 @@ heap_attrinfo_end (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * attr_info)
       db_private_free_and_init (thread_p, attr_info->values);
     }
   OID_SET_NULL (&attr_info->class_oid);
+  attr_info->lazy_recdes = NULL;
 
   /*
    * Bash this so that we ensure that heap_attrinfo_end is idempotent.
@@ -10365,6 +10789,12 @@ heap_attrinfo_read_dbvalues (THREAD_ENTRY * thread_p, const OID * inst_oid, RECD
 	      goto exit_on_error;
 	    }
 	}
+
+      ret = heap_ovf_read_attrinfo_part (thread_p, recdes, scan_cache, attr_info);
+      if (ret != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
     }
 
   /*
@@ -10397,42 +10827,159 @@ exit_on_error:
   return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
 }
 
+/*
+ * heap_attrinfo_start_lazy_read () - Like heap_attrinfo_read_dbvalues, but the values are read from the record only
+ *				      when they are accessed, until heap_attrinfo_end_lazy_read.
+ *   return: NO_ERROR
+ *   inst_oid(in): The instance oid
+ *   recdes(in): The instance Record descriptor, valid until heap_attrinfo_end_lazy_read
+ *   scan_cache(in/out): Scan cache the record was read with, or NULL
+ *   attr_info(in/out): The attribute information structure which describe the desired attributes
+ *
+ * Note: A predicate rejects most records by reading a few of its attributes; the others are not read at all.
+ *       The values must be accessed through heap_attrinfo_read_lazy_dbvalue (that is, by fetch_peek_dbval).
+ *       Values never read before (the first record) are read right away.
+ */
 int
-heap_attrinfo_read_dbvalues_without_oid (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_CACHE_ATTRINFO * attr_info)
+heap_attrinfo_start_lazy_read (THREAD_ENTRY * thread_p, const OID * inst_oid, RECDES * recdes,
+			       HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info)
 {
   int i;
   REPR_ID reprid;		/* The disk representation of the object */
   HEAP_ATTRVALUE *value;	/* Disk value Attr info for a particular attr */
   int ret = NO_ERROR;
 
+  assert (inst_oid != NULL && recdes != NULL && recdes->data != NULL);
+
   /* check to make sure the attr_info has been used */
   if (attr_info->num_values == -1)
     {
       return NO_ERROR;
     }
+  assert (attr_info->lazy_recdes == NULL);
 
-  /*
-   * Make sure that we have the needed cached representation.
-   */
+  reprid = or_rep_id (recdes);
+  if (attr_info->read_classrepr == NULL || attr_info->read_classrepr->id != reprid)
+    {
+      /* Get the needed representation */
+      ret = heap_attrinfo_recache (thread_p, reprid, attr_info);
+      if (ret != NO_ERROR)
+	{
+	  goto exit_on_error;
+	}
+    }
 
-  if (recdes != NULL)
+  /* an overflow record must hold any value that is accessed */
+  ret = heap_ovf_read_attrinfo_part (thread_p, recdes, scan_cache, attr_info);
+  if (ret != NO_ERROR)
     {
-      reprid = or_rep_id (recdes);
+      goto exit_on_error;
+    }
 
-      if (attr_info->read_classrepr == NULL || attr_info->read_classrepr->id != reprid)
+  for (i = 0; i < attr_info->num_values; i++)
+    {
+      value = &attr_info->values[i];
+      if (value->state == HEAP_UNINIT_ATTRVALUE)
 	{
-	  /* Get the needed representation */
-	  ret = heap_attrinfo_recache (thread_p, reprid, attr_info);
+	  /* no value to access yet */
+	  ret = heap_attrvalue_read (recdes, value, attr_info);
 	  if (ret != NO_ERROR)
 	    {
 	      goto exit_on_error;
 	    }
+	  value->is_unread = false;
+	}
+      else
+	{
+	  value->is_unread = true;
 	}
     }
 
-  /*
-   * Go over each attribute and read it
-   */
+  attr_info->lazy_recdes = recdes;
+
+  attr_info->inst_chn = or_chn (recdes);
+  attr_info->inst_oid = *inst_oid;
+
+  return ret;
+
+exit_on_error:
+
+  return (ret == NO_ERROR && (ret = er_errid ()) == NO_ERROR) ? ER_FAILED : ret;
+}
+
+/*
+ * heap_attrinfo_read_lazy_dbvalue () - Read an attribute value from the record of heap_attrinfo_start_lazy_read, if
+ *					it was not read yet.
+ *   return: NO_ERROR
+ *   dbvalue(in): Value of attr_info, as returned by heap_attrinfo_access
+ *   attr_info(in/out): The attribute information structure
+ */
+int
+heap_attrinfo_read_lazy_dbvalue (DB_VALUE * dbvalue, HEAP_CACHE_ATTRINFO * attr_info)
+{
+  HEAP_ATTRVALUE *value;
+
+  assert (attr_info->lazy_recdes != NULL);
+
+  value = (HEAP_ATTRVALUE *) ((char *) dbvalue - offsetof (HEAP_ATTRVALUE, dbvalue));
+  assert (value >= attr_info->values && value < attr_info->values + attr_info->num_values);
+
+  if (!value->is_unread)
+    {
+      return NO_ERROR;
+    }
+  value->is_unread = false;
+
+  return heap_attrvalue_read (attr_info->lazy_recdes, value, attr_info);
+}
+
+/*
+ * heap_attrinfo_end_lazy_read () - End heap_attrinfo_start_lazy_read. The values that were not accessed are not read.
+ *   return: void
+ *   attr_info(in/out): The attribute information structure
+ */
+void
+heap_attrinfo_end_lazy_read (HEAP_CACHE_ATTRINFO * attr_info)
+{
+  attr_info->lazy_recdes = NULL;
+}
+
+int
+heap_attrinfo_read_dbvalues_without_oid (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_CACHE_ATTRINFO * attr_info)
+{
+  int i;
+  REPR_ID reprid;		/* The disk representation of the object */
+  HEAP_ATTRVALUE *value;	/* Disk value Attr info for a particular attr */
+  int ret = NO_ERROR;
+
+  /* check to make sure the attr_info has been used */
+  if (attr_info->num_values == -1)
+    {
+      return NO_ERROR;
+    }
+
+  /*
+   * Make sure that we have the needed cached representation.
+   */
+
+  if (recdes != NULL)
+    {
+      reprid = or_rep_id (recdes);
+
+      if (attr_info->read_classrepr == NULL || attr_info->read_classrepr->id != reprid)
+	{
+	  /* Get the needed representation */
+	  ret = heap_attrinfo_recache (thread_p, reprid, attr_info);
+	  if (ret != NO_ERROR)
+	    {
+	      goto exit_on_error;
+	    }
+	}
+    }
+
+  /*
+   * Go over each attribute and read it
+   */
 
   for (i = 0; i < attr_info->num_values; i++)
     {
@@ -12110,6 +12657,7 @@ heap_attrinfo_start_with_index (THREAD_ENTRY * thread_p, OID * class_oid, RECDES
       attr_info->read_classrepr = NULL;
       OID_SET_NULL (&attr_info->inst_oid);
       attr_info->inst_chn = NULL_CHN;
+      attr_info->lazy_recdes = NULL;
       attr_info->num_values = num_found_attrs;
 
       if (num_found_attrs <= 0)
@@ -13902,30 +14450,36 @@ heap_check_all_pages (THREAD_ENTRY * thread_p, HFID * hfid)
 #if defined(SA_MODE)
       if (prm_get_integer_value (PRM_ID_HF_MAX_BESTSPACE_ENTRIES) > 0)
 	{
+	  HEAP_STATS_BESTSPACE_CACHE *shard;
 	  HEAP_STATS_ENTRY *ent;
 	  void *last;
 	  int rc;
 
-	  rc = pthread_mutex_lock (&heap_Bestspace->bestspace_mutex);
-
-	  last = NULL;
-	  while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (heap_Bestspace->hfid_ht, hfid, &last)) != NULL)
+	  for (i = 0; i < HEAP_STATS_BESTSPACE_SHARD_COUNT && valid_pg == DISK_VALID; i++)
 	    {
-	      assert_release (!VPID_ISNULL (&ent->best.vpid));
-	      if (!VPID_ISNULL (&ent->best.vpid))
+	      shard = &heap_Bestspace[i];
+
+	      rc = pthread_mutex_lock (&shard->bestspace_mutex);
+
+	      last = NULL;
+	      while ((ent = (HEAP_STATS_ENTRY *) mht_get2 (shard->hfid_ht, hfid, &last)) != NULL)
 		{
-		  valid_pg = file_check_vpid (thread_p, &hfid->vfid, &ent->best.vpid);
-		  if (valid_pg != DISK_VALID)
+		  assert_release (!VPID_ISNULL (&ent->best.vpid));
+		  if (!VPID_ISNULL (&ent->best.vpid))
 		    {
-		      break;
+		      valid_pg = file_check_vpid (thread_p, &hfid->vfid, &ent->best.vpid);
+		      if (valid_pg != DISK_VALID)
+			{
+			  break;
+			}
 		    }
+		  assert_release (ent->best.freespace > 0);
 		}
-	      assert_release (ent->best.freespace > 0);
-	    }
 
-	  assert (mht_count (heap_Bestspace->vpid_ht) == mht_count (heap_Bestspace->hfid_ht));
+	      assert (mht_count (shard->vpid_ht) == mht_count (shard->hfid_ht));
 
-	  pthread_mutex_unlock (&heap_Bestspace->bestspace_mutex);
+	      pthread_mutex_unlock (&shard->bestspace_mutex);
+	    }
 	}
 #endif
 
@@ -15022,6 +15576,8 @@ heap_chnguess_finalize (void)
 static int
 heap_stats_bestspace_initialize (void)
 {
+  HEAP_STATS_BESTSPACE_CACHE *shard;
+  int i;
   int ret = NO_ERROR;
 
   if (heap_Bestspace != NULL)
@@ -15033,30 +15589,37 @@ heap_stats_bestspace_initialize (void)
 	}
     }
 
-  heap_Bestspace = &heap_Bestspace_cache_area;
+  heap_Bestspace = heap_Bestspace_cache_area;
+
+  for (i = 0; i < HEAP_STATS_BESTSPACE_SHARD_COUNT; i++)
+    {
+      shard = &heap_Bestspace[i];
 
-  pthread_mutex_init (&heap_Bestspace->bestspace_mutex, NULL);
+      pthread_mutex_init (&shard->bestspace_mutex, NULL);
 
-  heap_Bestspace->num_stats_entries = 0;
+      shard->num_stats_entries = 0;
 
-  heap_Bestspace->hfid_ht =
-    mht_create ("Memory hash HFID to {bestspace}", HEAP_STATS_ENTRY_MHT_EST_SIZE, heap_hash_hfid, heap_compare_hfid);
-  if (heap_Bestspace->hfid_ht == NULL)
-    {
-      goto exit_on_error;
-    }
+      shard->hfid_ht =
+	mht_create ("Memory hash HFID to {bestspace}", HEAP_STATS_ENTRY_MHT_EST_SIZE / HEAP_STATS_BESTSPACE_SHARD_COUNT,
+		    heap_hash_hfid, heap_compare_hfid);
+      if (shard->hfid_ht == NULL)
+	{
+	  goto exit_on_error;
+	}
 
-  heap_Bestspace->vpid_ht =
-    mht_create ("Memory hash VPID to {bestspace}", HEAP_STATS_ENTRY_MHT_EST_SIZE, heap_hash_vpid, heap_compare_vpid);
-  if (heap_Bestspace->vpid_ht == NULL)
-    {
-      goto exit_on_error;
-    }
+      shard->vpid_ht =
+	mht_create ("Memory hash VPID to {bestspace}", HEAP_STATS_ENTRY_MHT_EST_SIZE / HEAP_STATS_BESTSPACE_SHARD_COUNT,
+		    heap_hash_vpid, heap_compare_vpid);
+      if (shard->vpid_ht == NULL)
+	{
+	  goto exit_on_error;
+	}
 
-  heap_Bestspace->num_alloc = 0;
-  heap_Bestspace->num_free = 0;
-  heap_Bestspace->free_list_count = 0;
-  heap_Bestspace->free_list = NULL;
+      shard->num_alloc = 0;
+      shard->num_free = 0;
+      shard->free_list_count = 0;
+      shard->free_list = NULL;
+    }
 
   return ret;
 
@@ -15074,7 +15637,9 @@ exit_on_error:
 static int
 heap_stats_bestspace_finalize (void)
 {
+  HEAP_STATS_BESTSPACE_CACHE *shard;
   HEAP_STATS_ENTRY *ent;
+  int i;
   int ret = NO_ERROR;
 
   if (heap_Bestspace == NULL)
@@ -15082,37 +15647,42 @@ heap_stats_bestspace_finalize (void)
       return NO_ERROR;
     }
 
-  if (heap_Bestspace->vpid_ht != NULL)
+  for (i = 0; i < HEAP_STATS_BESTSPACE_SHARD_COUNT; i++)
     {
-      (void) mht_map_no_key (NULL, heap_Bestspace->vpid_ht, heap_stats_entry_free, NULL);
-      while (heap_Bestspace->free_list_count > 0)
+      shard = &heap_Bestspace[i];
+
+      if (shard->vpid_ht != NULL)
 	{
-	  ent = heap_Bestspace->free_list;
-	  assert_release (ent != NULL);
+	  (void) mht_map_no_key (NULL, shard->vpid_ht, heap_stats_entry_free, shard);
+	  while (shard->free_list_count > 0)
+	    {
+	      ent = shard->free_list;
+	      assert_release (ent != NULL);
 
-	  heap_Bestspace->free_list = ent->next;
-	  ent->next = NULL;
+	      shard->free_list = ent->next;
+	      ent->next = NULL;
 
-	  free (ent);
+	      free (ent);
 
-	  heap_Bestspace->free_list_count--;
+	      shard->free_list_count--;
+	    }
+	  assert_release (shard->free_list == NULL);
 	}
-      assert_release (heap_Bestspace->free_list == NULL);
-    }
 
-  if (heap_Bestspace->vpid_ht != NULL)
-    {
-      mht_destroy (heap_Bestspace->vpid_ht);
-      heap_Bestspace->vpid_ht = NULL;
-    }
+      if (shard->vpid_ht != NULL)
+	{
+	  mht_destroy (shard->vpid_ht);
+	  shard->vpid_ht = NULL;
+	}
 
-  if (heap_Bestspace->hfid_ht != NULL)
-    {
-      mht_destroy (heap_Bestspace->hfid_ht);
-      heap_Bestspace->hfid_ht = NULL;
-    }
+      if (shard->hfid_ht != NULL)
+	{
+	  mht_destroy (shard->hfid_ht);
+	  shard->hfid_ht = NULL;
+	}
 
-  pthread_mutex_destroy (&heap_Bestspace->bestspace_mutex);
+      pthread_mutex_destroy (&shard->bestspace_mutex);
+    }
 
   heap_Bestspace = NULL;
 
@@ -16749,6 +17319,10 @@ heap_get_class_info (THREAD_ENTRY * thread_p, const OID * class_oid, HFID * hfid
  * heap_compact_pages () - compact all pages from hfid of specified class OID
  *   return: error_code
  *   class_oid(out):  the class oid
+ *
+ * Note: Only page latches are held while a page is compacted. The pages left empty in a heap file with reusable
+ *	 OIDs are removed from the heap and deallocated, as vacuum does. The pages compacted per second are limited by
+ *	 compactdb_max_pages_per_sec; no page is latched while waiting.
  */
 int
 heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
@@ -16758,8 +17332,21 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
   VPID next_vpid;
   LOG_DATA_ADDR addr;
   HFID hfid;
+  FILE_TYPE ftype = FILE_UNKNOWN_TYPE;
   PGBUF_WATCHER pg_watcher;
   PGBUF_WATCHER old_pg_watcher;
+  PAGE_PTR empty_page = NULL;
+  bool is_chain_guarded = true;	/* false if no page of the chain is latched while the next page is fixed */
+#if defined (SERVER_MODE)
+  int count_of_page_for_a_sleep = 10;
+  INT64 allowed_millis_for_a_sleep = 0;
+  INT64 previous_elapsed_millis;
+  INT64 time_to_sleep;
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
+  int page_count_per_sec;
+  int page_count = 0;
+#endif /* SERVER_MODE */
 
   if (class_oid == NULL)
     {
@@ -16771,7 +17358,7 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
       return ER_FAILED;
     }
 
-  ret = heap_get_class_info (thread_p, class_oid, &hfid, NULL, NULL);
+  ret = heap_get_class_info (thread_p, class_oid, &hfid, &ftype, NULL);
   if (ret != NO_ERROR || HFID_IS_NULL (&hfid))
     {
       lock_unlock_object (thread_p, class_oid, oid_Root_class_oid, IS_LOCK, true);
@@ -16807,20 +17394,67 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
     }
   pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
 
+#if defined (SERVER_MODE)
+  page_count_per_sec = prm_get_integer_value (PRM_ID_COMPACTDB_MAX_PAGES_PER_SEC);
+  if (page_count_per_sec > 0)
+    {
+      if (page_count_per_sec < count_of_page_for_a_sleep)
+	{
+	  count_of_page_for_a_sleep = page_count_per_sec;
+	}
+      allowed_millis_for_a_sleep = count_of_page_for_a_sleep * 1000LL / page_count_per_sec;
+
+      tsc_getticks (&start_tick);
+    }
+#endif /* SERVER_MODE */
+
   while (!VPID_ISNULL (&next_vpid))
     {
+#if defined (SERVER_MODE)
+      if (page_count_per_sec > 0 && ++page_count % count_of_page_for_a_sleep == 0)
+	{
+	  tsc_getticks (&end_tick);
+	  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+
+	  previous_elapsed_millis = (tv_diff.tv_sec * 1000LL) + (tv_diff.tv_usec / 1000LL);
+
+	  time_to_sleep = allowed_millis_for_a_sleep - previous_elapsed_millis;
+	  if (time_to_sleep > 0)
+	    {
+	      /* do not block the page while sleeping */
+	      if (old_pg_watcher.pgptr != NULL)
+		{
+		  pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
+		  is_chain_guarded = false;
+		}
+	      thread_sleep ((double) time_to_sleep);
+	    }
+
+	  tsc_getticks (&start_tick);
+	}
+#endif /* SERVER_MODE */
+
+      /* the next page may have been deallocated meanwhile if no page of the chain was latched */
       vpid = next_vpid;
       pg_watcher.pgptr =
-	heap_scan_pb_lock_and_fetch (thread_p, &vpid, OLD_PAGE_PREVENT_DEALLOC, X_LOCK, NULL, &pg_watcher);
+	heap_scan_pb_lock_and_fetch (thread_p, &vpid, is_chain_guarded ? OLD_PAGE_PREVENT_DEALLOC
+				     : OLD_PAGE_MAYBE_DEALLOCATED, X_LOCK, NULL, &pg_watcher);
       if (old_pg_watcher.pgptr != NULL)
 	{
 	  pgbuf_ordered_unfix (thread_p, &old_pg_watcher);
 	}
       if (pg_watcher.pgptr == NULL)
 	{
+	  if (!is_chain_guarded && er_errid () == ER_PB_BAD_PAGEID)
+	    {
+	      /* lost track of the chain; leave the rest of the pages as they are */
+	      er_clear ();
+	      break;
+	    }
 	  ret = ER_FAILED;
 	  goto exit_on_error;
 	}
+      is_chain_guarded = true;
 
       ret = heap_vpid_next (thread_p, &hfid, pg_watcher.pgptr, &next_vpid);
       if (ret != NO_ERROR)
@@ -16839,6 +17473,27 @@ heap_compact_pages (THREAD_ENTRY * thread_p, OID * class_oid)
       addr.pgptr = pg_watcher.pgptr;
       log_skip_logging (thread_p, &addr);
       pgbuf_set_dirty (thread_p, pg_watcher.pgptr, DONT_FREE);
+
+      if (ftype == FILE_HEAP_REUSE_SLOTS && spage_number_of_records (pg_watcher.pgptr) <= 1
+	  && !pgbuf_has_any_waiters (pg_watcher.pgptr))
+	{
+	  /* no OID can refer to the page; remove it from the heap like vacuum does. it is fixed once more without
+	   * watcher, as the removal attaches its own one. */
+	  empty_page = pgbuf_fix (thread_p, &vpid, OLD_PAGE, PGBUF_LATCH_WRITE, PGBUF_UNCONDITIONAL_LATCH);
+	  pgbuf_ordered_unfix (thread_p, &pg_watcher);
+	  if (empty_page == NULL)
+	    {
+	      ret = ER_FAILED;
+	      goto exit_on_error;
+	    }
+
+	  /* the page is unfixed whether it is removed or not */
+	  (void) heap_remove_page_on_vacuum (thread_p, &empty_page, &hfid);
+	  assert (empty_page == NULL);
+	  is_chain_guarded = false;
+	  continue;
+	}
+
       pgbuf_replace_watcher (thread_p, &pg_watcher, &old_pg_watcher);
     }
 
@@ -18622,7 +19277,7 @@ SCAN_CODE
 heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false, NULL, NULL);
 }
 
 /*
@@ -18649,7 +19304,106 @@ heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_o
 		       HEAP_SCANCACHE * scan_cache, int ispeeking, DB_VALUE ** cache_recordinfo)
 {
   return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false,
-			     cache_recordinfo);
+			     cache_recordinfo, NULL);
+}
+
+/*
+ * heap_parallel_cursor_start () - Start a cursor that gives the pages of a heap to the scans sharing it.
+ *
+ * return	   : void.
+ * cursor (out)	   : Parallel cursor.
+ * hfid (in)	   : Heap file identifier.
+ */
+void
+heap_parallel_cursor_start (HEAP_PARALLEL_CURSOR * cursor, const HFID * hfid)
+{
+  assert (cursor != NULL && hfid != NULL && !HFID_IS_NULL (hfid));
+
+  HFID_COPY (&cursor->hfid, hfid);
+  pthread_mutex_init (&cursor->mutex, NULL);
+  cursor->next_vpid.volid = hfid->vfid.volid;
+  cursor->next_vpid.pageid = hfid->hpgid;
+}
+
+/*
+ * heap_parallel_cursor_end () - End a parallel cursor. No scan may use it anymore.
+ *
+ * return	   : void.
+ * cursor (in)	   : Parallel cursor.
+ */
+void
+heap_parallel_cursor_end (HEAP_PARALLEL_CURSOR * cursor)
+{
+  assert (cursor != NULL);
+
+  pthread_mutex_destroy (&cursor->mutex);
+  VPID_SET_NULL (&cursor->next_vpid);
+}
+
+/*
+ * heap_parallel_cursor_claim () - Take the next page of a parallel cursor.
+ *
+ * return	   : Error code.
+ * thread_p (in)   : Thread entry.
+ * cursor (in)	   : Parallel cursor.
+ * vpid (out)	   : Page taken, or NULL when all pages of heap were taken.
+ *
+ * NOTE: Caller must not keep any page fixed; page of cursor is fixed while holding cursor mutex.
+ */
+static int
+heap_parallel_cursor_claim (THREAD_ENTRY * thread_p, HEAP_PARALLEL_CURSOR * cursor, VPID * vpid)
+{
+  PAGE_PTR pgptr;
+  int rc;
+  int error_code = NO_ERROR;
+
+  rc = pthread_mutex_lock (&cursor->mutex);
+
+  *vpid = cursor->next_vpid;
+  if (!VPID_ISNULL (vpid))
+    {
+      /* move cursor to next page in chain */
+      pgptr = pgbuf_fix (thread_p, vpid, OLD_PAGE_PREVENT_DEALLOC, PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+      if (pgptr == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  VPID_SET_NULL (vpid);
+	}
+      else
+	{
+	  (void) heap_vpid_next (thread_p, &cursor->hfid, pgptr, &cursor->next_vpid);
+	  pgbuf_unfix_and_init (thread_p, pgptr);
+	}
+    }
+
+  pthread_mutex_unlock (&cursor->mutex);
+
+  return error_code;
+}
+
+/*
+ * heap_parallel_next () - Retrieve or peek next object, scanning only the pages given by a parallel cursor.
+ *
+ * return	       : SCAN_CODE (Either of S_SUCCESS, S_DOESNT_FIT, S_END, S_ERROR)
+ * thread_p (in)       : Thread entry.
+ * cursor (in)	       : Parallel cursor shared by all scans of heap.
+ * class_oid (in)      : Class Object identifier.
+ * next_oid (in/out)   : Object identifier of current record, NULL to start the scan.
+ * recdes (in/out)     : Record descriptor.
+ * scan_cache (in/out) : Scan cache.
+ * ispeeking (in)      : PEEK/COPY.
+ *
+ * NOTE: Scans sharing a cursor scan each page of heap only once between them; together they return what one heap_next
+ *	 scan would, in no particular order.
+ */
+SCAN_CODE
+heap_parallel_next (THREAD_ENTRY * thread_p, HEAP_PARALLEL_CURSOR * cursor, OID * class_oid, OID * next_oid,
+		    RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking)
+{
+  assert (cursor != NULL && HFID_EQ (&cursor->hfid, &scan_cache->node.hfid));
+
+  return heap_next_internal (thread_p, &cursor->hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, false,
+			     NULL, cursor);
 }
 
 /*
@@ -18671,7 +19425,7 @@ SCAN_CODE
 heap_prev (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid, RECDES * recdes,
 	   HEAP_SCANCACHE * scan_cache, int ispeeking)
 {
-  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, NULL);
+  return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true, NULL, NULL);
 }
 
 /*
@@ -18698,7 +19452,7 @@ heap_prev_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_o
 		       HEAP_SCANCACHE * scan_cache, int ispeeking, DB_VALUE ** cache_recordinfo)
 {
   return heap_next_internal (thread_p, hfid, class_oid, next_oid, recdes, scan_cache, ispeeking, true,
-			     cache_recordinfo);
+			     cache_recordinfo, NULL);
 }
 
 /*
@@ -18786,8 +19540,18 @@ heap_get_bigone_content (THREAD_ENTRY * thread_p, HEAP_SCANCACHE * scan_cache, b
   SCAN_CODE scan = S_SUCCESS;
 
   /* Try to reuse the previously allocated area No need to check the snapshot since was already checked */
-  if (scan_cache != NULL
+  if (scan_cache != NULL && scan_cache->read_ovf_prefix
       && (ispeeking == PEEK || recdes->data == NULL || scan_cache->is_recdes_assigned_to_area (*recdes)))
+    {
+      /* the attributes needed are read from the rest later */
+      scan = heap_ovf_get_prefix (thread_p, scan_cache, forward_oid, recdes);
+      if (scan != S_SUCCESS)
+	{
+	  recdes->data = NULL;
+	}
+    }
+  else if (scan_cache != NULL
+	   && (ispeeking == PEEK || recdes->data == NULL || scan_cache->is_recdes_assigned_to_area (*recdes)))
     {
       scan_cache->assign_recdes_to_area (*recdes);
 
@@ -22475,6 +23239,8 @@ heap_insert_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context,
 	}
     }
 
+  logtb_set_authorization_change (thread_p, &context->class_oid);
+
 #if defined(ENABLE_SYSTEMTAP)
   CUBRID_OBJ_INSERT_START (&context->class_oid);
 #endif /* ENABLE_SYSTEMTAP */
@@ -22676,6 +23442,8 @@ heap_delete_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
   is_mvcc_op = false;
 #endif /* SERVER_MODE */
 
+  logtb_set_authorization_change (thread_p, &context->class_oid);
+
 #if defined(ENABLE_SYSTEMTAP)
   CUBRID_OBJ_DELETE_START (&context->class_oid);
 #endif /* ENABLE_SYSTEMTAP */
@@ -22848,6 +23616,8 @@ heap_update_logical (THREAD_ENTRY * thread_p, HEAP_OPERATION_CONTEXT * context)
   /* the update in place concept should be changed in terms of mvcc */
 #endif /* SERVER_MODE */
 
+  logtb_set_authorization_change (thread_p, &context->class_oid);
+
 #if defined(ENABLE_SYSTEMTAP)
   CUBRID_OBJ_UPDATE_START (&context->class_oid);
 #endif /* ENABLE_SYSTEMTAP */
@@ -23819,6 +24589,437 @@ heap_page_get_max_mvccid (THREAD_ENTRY * thread_p, PAGE_PTR heap_page)
   return chain->max_mvccid;
 }
 
+/*
+ * heap_page_is_all_visible () - Is every record of heap page visible to snapshot without checking its MVCC header?
+ *
+ * return	  : True if all records are visible.
+ * thread_p (in)  : Thread entry.
+ * heap_page (in) : Heap page.
+ * snapshot (in)  : MVCC snapshot.
+ *
+ * NOTE: The page chain is the visibility summary of the page. Vacuum status none means that vacuum did all the work
+ *	 the MVCC operations on the page required, so no deleted record is left. And if the newest MVCC operation
+ *	 precedes all transactions active for snapshot, all inserters committed before them.
+ */
+static bool
+heap_page_is_all_visible (THREAD_ENTRY * thread_p, PAGE_PTR heap_page, MVCC_SNAPSHOT * snapshot)
+{
+  HEAP_CHAIN *chain;
+  RECDES chain_recdes;
+
+  assert (heap_page != NULL && snapshot != NULL);
+
+  if (spage_get_record (thread_p, heap_page, HEAP_HEADER_AND_CHAIN_SLOTID, &chain_recdes, PEEK) != S_SUCCESS
+      || chain_recdes.length != sizeof (HEAP_CHAIN))
+    {
+      return false;
+    }
+  chain = (HEAP_CHAIN *) chain_recdes.data;
+
+  return (HEAP_PAGE_GET_VACUUM_STATUS (chain) == HEAP_PAGE_VACUUM_NONE
+	  && MVCC_ID_PRECEDES (chain->max_mvccid, snapshot->lowest_active_mvccid));
+}
+
+/*
+ * heap_zone_map_initialize () - Allocate the zone map of heap pages.
+ *
+ * return : Error code.
+ */
+static int
+heap_zone_map_initialize (void)
+{
+  int num_zones = prm_get_integer_value (PRM_ID_HEAP_ZONE_MAP_PAGES);
+  int i;
+
+  heap_Zone_map.zones = NULL;
+  heap_Zone_map.num_zones = 0;
+  heap_Zone_map.change_stamps = NULL;
+  if (num_zones <= 0)
+    {
+      /* zones are not cached */
+      return NO_ERROR;
+    }
+
+  heap_Zone_map.zones = (HEAP_ZONE *) malloc (num_zones * sizeof (HEAP_ZONE));
+  if (heap_Zone_map.zones == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, num_zones * sizeof (HEAP_ZONE));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  heap_Zone_map.change_stamps = (int *) calloc (num_zones, sizeof (int));
+  if (heap_Zone_map.change_stamps == NULL)
+    {
+      free_and_init (heap_Zone_map.zones);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, num_zones * sizeof (int));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  for (i = 0; i < num_zones; i++)
+    {
+      VPID_SET_NULL (&heap_Zone_map.zones[i].vpid);
+    }
+  for (i = 0; i < HEAP_ZONE_MAP_MUTEX_COUNT; i++)
+    {
+      pthread_mutex_init (&heap_Zone_map.zone_mutex[i], NULL);
+    }
+  heap_Zone_map.num_zones = num_zones;
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_zone_map_finalize () - Free the zone map of heap pages.
+ */
+static void
+heap_zone_map_finalize (void)
+{
+  int i;
+
+  if (heap_Zone_map.zones == NULL)
+    {
+      return;
+    }
+
+  /* zones have only values of fixed size types, which need no clear */
+  for (i = 0; i < HEAP_ZONE_MAP_MUTEX_COUNT; i++)
+    {
+      pthread_mutex_destroy (&heap_Zone_map.zone_mutex[i]);
+    }
+  heap_Zone_map.num_zones = 0;
+  free_and_init (heap_Zone_map.change_stamps);
+  free_and_init (heap_Zone_map.zones);
+}
+
+/*
+ * heap_zone_map_set_changed () - Count a change of page in its change stamp.
+ *
+ * vpid (in) : Changed page.
+ *
+ * NOTE: Page buffer calls it whenever a page is set dirty, while the changer holds the write latch on page.
+ */
+void
+heap_zone_map_set_changed (const VPID * vpid)
+{
+  unsigned int index;
+
+  if (heap_Zone_map.change_stamps == NULL)
+    {
+      return;
+    }
+
+  index = heap_zone_map_hash (vpid, 0);
+  ATOMIC_INC_32 (&heap_Zone_map.change_stamps[index], 1);
+}
+
+/*
+ * heap_zone_map_hash () - Hash a page and an attribute to an entry of zone map.
+ *
+ * return      : Entry index.
+ * vpid (in)   : Page.
+ * attrid (in) : Attribute, or 0 for the change stamp of page.
+ */
+static unsigned int
+heap_zone_map_hash (const VPID * vpid, ATTR_ID attrid)
+{
+  return ((((unsigned int) vpid->volid * 31 + (unsigned int) vpid->pageid) * 31 + (unsigned int) attrid)
+	  % (unsigned int) heap_Zone_map.num_zones);
+}
+
+/*
+ * heap_zone_is_comparable_type () - Can the values of type be kept in a zone?
+ *
+ * return    : True for the types of fixed size that are in total order.
+ * type (in) : Value type.
+ */
+static bool
+heap_zone_is_comparable_type (DB_TYPE type)
+{
+  switch (type)
+    {
+    case DB_TYPE_INTEGER:
+    case DB_TYPE_SMALLINT:
+    case DB_TYPE_BIGINT:
+    case DB_TYPE_FLOAT:
+    case DB_TYPE_DOUBLE:
+    case DB_TYPE_NUMERIC:
+    case DB_TYPE_MONETARY:
+    case DB_TYPE_DATE:
+    case DB_TYPE_TIME:
+    case DB_TYPE_TIMESTAMP:
+    case DB_TYPE_DATETIME:
+      return true;
+    default:
+      return false;
+    }
+}
+
+/*
+ * heap_zone_compute () - Compute the zone of the filter attribute in heap page.
+ *
+ * thread_p (in)  : Thread entry.
+ * heap_page (in) : Heap page.
+ * filter (in)	  : Zone filter.
+ * zone (out)	  : Zone of page.
+ *
+ * NOTE: The values of the records of page are read from page, so the zone is unknown if a record of page is stored in
+ *	 another page.
+ */
+static void
+heap_zone_compute (THREAD_ENTRY * thread_p, PAGE_PTR heap_page, HEAP_ZONE_FILTER * filter, HEAP_ZONE * zone)
+{
+  OID oid;
+  RECDES recdes;
+  INT16 type;
+  DB_VALUE *value;
+  HEAP_CHAIN *chain;
+
+  zone->vpid = *pgbuf_get_vpid_ptr (heap_page);
+  zone->attrid = filter->attrid;
+  LSA_COPY (&zone->page_lsa, pgbuf_get_lsa (heap_page));
+  /* the page is latched, so its stamp changes only by the pages hashed to the same entry, which makes zone stale */
+  zone->change_stamp = ATOMIC_INC_32 (&heap_Zone_map.change_stamps[heap_zone_map_hash (&zone->vpid, 0)], 0);
+  VPID_SET_NULL (&zone->next_vpid);
+  zone->max_mvccid = MVCCID_NULL;
+  zone->is_vacuumed = false;
+  zone->state = HEAP_ZONE_EMPTY;
+
+  if (spage_get_record (thread_p, heap_page, HEAP_HEADER_AND_CHAIN_SLOTID, &recdes, PEEK) != S_SUCCESS
+      || recdes.length != sizeof (HEAP_CHAIN))
+    {
+      /* header page */
+      zone->state = HEAP_ZONE_UNKNOWN;
+      return;
+    }
+  chain = (HEAP_CHAIN *) recdes.data;
+  zone->next_vpid = chain->next_vpid;
+  zone->max_mvccid = chain->max_mvccid;
+  zone->is_vacuumed = (HEAP_PAGE_GET_VACUUM_STATUS (chain) == HEAP_PAGE_VACUUM_NONE);
+
+  oid.volid = zone->vpid.volid;
+  oid.pageid = zone->vpid.pageid;
+  oid.slotid = NULL_SLOTID;
+  while (spage_next_record (heap_page, &oid.slotid, &recdes, PEEK) == S_SUCCESS)
+    {
+      if (oid.slotid == HEAP_HEADER_AND_CHAIN_SLOTID)
+	{
+	  continue;
+	}
+      type = spage_get_record_type (heap_page, oid.slotid);
+      if (type == REC_NEWHOME || type == REC_ASSIGN_ADDRESS || type == REC_UNKNOWN)
+	{
+	  /* not an object of page */
+	  continue;
+	}
+      if (type != REC_HOME)
+	{
+	  /* the object is stored in other pages */
+	  zone->state = HEAP_ZONE_UNKNOWN;
+	  return;
+	}
+
+      if (heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, NULL, &filter->attr_info) != NO_ERROR)
+	{
+	  /* the zone is only a hint; the scan reads the record again and handles the error */
+	  er_clear ();
+	  zone->state = HEAP_ZONE_UNKNOWN;
+	  return;
+	}
+      value = heap_attrinfo_access (filter->attrid, &filter->attr_info);
+      if (value == NULL || (!DB_IS_NULL (value) && !heap_zone_is_comparable_type (DB_VALUE_DOMAIN_TYPE (value))))
+	{
+	  zone->state = HEAP_ZONE_UNKNOWN;
+	  return;
+	}
+      if (DB_IS_NULL (value))
+	{
+	  continue;
+	}
+
+      if (zone->state == HEAP_ZONE_EMPTY)
+	{
+	  zone->min_value = *value;
+	  zone->max_value = *value;
+	  zone->state = HEAP_ZONE_RANGE;
+	  continue;
+	}
+      switch (tp_value_compare (value, &zone->min_value, 0, 1))
+	{
+	case DB_LT:
+	  zone->min_value = *value;
+	  break;
+	case DB_UNK:
+	  zone->state = HEAP_ZONE_UNKNOWN;
+	  return;
+	default:
+	  break;
+	}
+      switch (tp_value_compare (value, &zone->max_value, 0, 1))
+	{
+	case DB_GT:
+	  zone->max_value = *value;
+	  break;
+	case DB_UNK:
+	  zone->state = HEAP_ZONE_UNKNOWN;
+	  return;
+	default:
+	  break;
+	}
+    }
+}
+
+/*
+ * heap_zone_is_skipped () - Can a heap scan skip the page of zone because none of its records qualifies?
+ *
+ * return	 : True if page can be skipped.
+ * zone (in)	 : Valid zone of page.
+ * filter (in)	 : Zone filter of scan.
+ * snapshot (in) : MVCC snapshot of scan.
+ *
+ * NOTE: The zone has the values of the last versions in page. The scan sees only these versions if all page records
+ *	 are visible to its snapshot; otherwise it may read older versions from log. See heap_page_is_all_visible.
+ */
+static bool
+heap_zone_is_skipped (const HEAP_ZONE * zone, const HEAP_ZONE_FILTER * filter, MVCC_SNAPSHOT * snapshot)
+{
+  DB_VALUE_COMPARE_RESULT cmp;
+  int i;
+
+  if (snapshot == NULL || !zone->is_vacuumed || !MVCC_ID_PRECEDES (zone->max_mvccid, snapshot->lowest_active_mvccid))
+    {
+      return false;
+    }
+
+  switch (zone->state)
+    {
+    case HEAP_ZONE_EMPTY:
+      /* a null value is never within a bound */
+      return true;
+    case HEAP_ZONE_UNKNOWN:
+      return false;
+    default:
+      break;
+    }
+
+  for (i = 0; i < filter->num_bounds; i++)
+    {
+      const HEAP_ZONE_BOUND *bound = &filter->bounds[i];
+
+      if (bound->is_lower)
+	{
+	  cmp = tp_value_compare (&zone->max_value, &bound->value, 1, 0);
+	  if (cmp == DB_LT || (cmp == DB_EQ && !bound->is_inclusive))
+	    {
+	      return true;
+	    }
+	}
+      else
+	{
+	  cmp = tp_value_compare (&zone->min_value, &bound->value, 1, 0);
+	  if (cmp == DB_GT || (cmp == DB_EQ && !bound->is_inclusive))
+	    {
+	      return true;
+	    }
+	}
+    }
+
+  return false;
+}
+
+/*
+ * heap_zone_filter_skips_page () - Can heap scan skip the fixed page because none of its records qualifies?
+ *
+ * return	   : True if page can be skipped.
+ * thread_p (in)   : Thread entry.
+ * heap_page (in)  : Heap page being scanned.
+ * scan_cache (in) : Scan cache having the zone filter.
+ *
+ * NOTE: The zone of page is computed if it is not cached or it is stale.
+ */
+static bool
+heap_zone_filter_skips_page (THREAD_ENTRY * thread_p, PAGE_PTR heap_page, HEAP_SCANCACHE * scan_cache)
+{
+  HEAP_ZONE_FILTER *filter = scan_cache->zone_filter;
+  HEAP_ZONE zone;
+  HEAP_ZONE *entry;
+  const VPID *vpid;
+  unsigned int index;
+  pthread_mutex_t *mutex;
+
+  assert (filter != NULL);
+
+  if (heap_Zone_map.zones == NULL || scan_cache->mvcc_snapshot == NULL)
+    {
+      return false;
+    }
+
+  vpid = pgbuf_get_vpid_ptr (heap_page);
+  index = heap_zone_map_hash (vpid, filter->attrid);
+  entry = &heap_Zone_map.zones[index];
+  mutex = &heap_Zone_map.zone_mutex[index % HEAP_ZONE_MAP_MUTEX_COUNT];
+
+  (void) pthread_mutex_lock (mutex);
+  zone = *entry;
+  pthread_mutex_unlock (mutex);
+
+  if (!VPID_EQ (&zone.vpid, vpid) || zone.attrid != filter->attrid
+      || zone.change_stamp != ATOMIC_INC_32 (&heap_Zone_map.change_stamps[heap_zone_map_hash (vpid, 0)], 0)
+      || !LSA_EQ (&zone.page_lsa, pgbuf_get_lsa (heap_page)))
+    {
+      /* page changed since zone was computed, or it was never computed */
+      heap_zone_compute (thread_p, heap_page, filter, &zone);
+
+      (void) pthread_mutex_lock (mutex);
+      *entry = zone;
+      pthread_mutex_unlock (mutex);
+    }
+
+  return heap_zone_is_skipped (&zone, filter, scan_cache->mvcc_snapshot);
+}
+
+/*
+ * heap_zone_filter_skip_pages () - Go past the pages that heap scan can skip without fixing them.
+ *
+ * scan_cache (in) : Scan cache having the zone filter.
+ * vpid (in/out)   : Next page to scan; it is moved past the pages that have valid zones that are skipped.
+ *
+ * NOTE: The stamp of a page changes before the changer releases its latch, so the changes committed before the scan
+ *	 snapshot make the zone stale. The scan does not see the changes that are not committed yet.
+ */
+static void
+heap_zone_filter_skip_pages (HEAP_SCANCACHE * scan_cache, VPID * vpid)
+{
+  HEAP_ZONE_FILTER *filter = scan_cache->zone_filter;
+  HEAP_ZONE zone;
+  unsigned int index;
+  pthread_mutex_t *mutex;
+
+  assert (filter != NULL);
+
+  if (heap_Zone_map.zones == NULL || scan_cache->mvcc_snapshot == NULL)
+    {
+      return;
+    }
+
+  while (!VPID_ISNULL (vpid))
+    {
+      index = heap_zone_map_hash (vpid, filter->attrid);
+      mutex = &heap_Zone_map.zone_mutex[index % HEAP_ZONE_MAP_MUTEX_COUNT];
+
+      (void) pthread_mutex_lock (mutex);
+      zone = heap_Zone_map.zones[index];
+      pthread_mutex_unlock (mutex);
+
+      if (!VPID_EQ (&zone.vpid, vpid) || zone.attrid != filter->attrid
+	  || zone.change_stamp != ATOMIC_INC_32 (&heap_Zone_map.change_stamps[heap_zone_map_hash (vpid, 0)], 0)
+	  || !heap_zone_is_skipped (&zone, filter, scan_cache->mvcc_snapshot))
+	{
+	  /* the page must be fixed */
+	  return;
+	}
+
+      *vpid = zone.next_vpid;
+    }
+}
+
 /*
  * heap_page_get_vacuum_status () - Get heap page vacuum status.
  *
@@ -24372,6 +25573,14 @@ heap_get_visible_version_internal (THREAD_ENTRY * thread_p, HEAP_GET_CONTEXT * c
       mvcc_snapshot = context->scan_cache->mvcc_snapshot;
     }
 
+  if (mvcc_snapshot != NULL && mvcc_snapshot->snapshot_fnc == mvcc_satisfies_snapshot
+      && context->record_type == REC_HOME && context->old_chn == NULL_CHN
+      && heap_page_is_all_visible (thread_p, context->home_page_watcher.pgptr, mvcc_snapshot))
+    {
+      /* page is all visible, the record header does not need to be checked */
+      mvcc_snapshot = NULL;
+    }
+
   if (mvcc_snapshot != NULL || context->old_chn != NULL_CHN)
     {
       /* mvcc header is needed for visibility check or chn check */
@@ -24828,7 +26037,15 @@ heap_rv_undo_ovf_update (THREAD_ENTRY * thread_p, LOG_RCV * rcv)
 int
 heap_get_best_space_num_stats_entries (void)
 {
-  return heap_Bestspace->num_stats_entries;
+  int num_stats_entries = 0;
+  int i;
+
+  for (i = 0; i < HEAP_STATS_BESTSPACE_SHARD_COUNT; i++)
+    {
+      num_stats_entries += heap_Bestspace[i].num_stats_entries;
+    }
+
+  return num_stats_entries;
 }
 
 /*
@@ -24972,6 +26189,7 @@ void
 heap_scancache::assign_recdes_to_area (RECDES & recdes, size_t size /* = 0 */)
 {
   reserve_area (size);
+  OID_SET_NULL (&ovf_oid);	// area gets a new record
 
   recdes.data = m_area->get_ptr ();
   recdes.area_size = (int) m_area->get_size ();
@@ -24990,6 +26208,24 @@ heap_scancache::get_area_block_allocator ()
   return m_area->get_block_allocator ();
 }
 
+/*
+ * heap_init_new_page_chain () - Init the chain of a heap page that is allocated but not yet linked to the heap.
+ *
+ * return	    : Void.
+ * chain (out)	    : Page chain.
+ * class_oid (in)   : Class identifier.
+ */
+static void
+heap_init_new_page_chain (HEAP_CHAIN * chain, OID class_oid)
+{
+  chain->class_oid = class_oid;
+  VPID_SET_NULL (&chain->prev_vpid);
+  VPID_SET_NULL (&chain->next_vpid);
+  chain->max_mvccid = MVCCID_NULL;
+  chain->flags = 0;
+  HEAP_PAGE_SET_VACUUM_STATUS (chain, HEAP_PAGE_VACUUM_NONE);
+}
+
 int
 heap_alloc_new_page (THREAD_ENTRY * thread_p, HFID * hfid, OID class_oid, PGBUF_WATCHER * home_hint_p,
 		     VPID * new_page_vpid)
@@ -25001,13 +26237,7 @@ heap_alloc_new_page (THREAD_ENTRY * thread_p, HFID * hfid, OID class_oid, PGBUF_
   assert (hfid != NULL && home_hint_p != NULL && new_page_vpid != NULL);
 
   PGBUF_INIT_WATCHER (home_hint_p, PGBUF_ORDERED_HEAP_NORMAL, hfid);
-  // Init the heap page chain
-  new_page_chain.class_oid = class_oid;
-  VPID_SET_NULL (&new_page_chain.prev_vpid);
-  VPID_SET_NULL (&new_page_chain.next_vpid);
-  new_page_chain.max_mvccid = MVCCID_NULL;
-  new_page_chain.flags = 0;
-  HEAP_PAGE_SET_VACUUM_STATUS (&new_page_chain, HEAP_PAGE_VACUUM_NONE);
+  heap_init_new_page_chain (&new_page_chain, class_oid);
 
   VPID_SET_NULL (new_page_vpid);
 
@@ -25028,6 +26258,76 @@ heap_alloc_new_page (THREAD_ENTRY * thread_p, HFID * hfid, OID class_oid, PGBUF_
   return error_code;
 }
 
+/*
+ * heap_alloc_new_pages () - Allocate several new heap pages at once, to be filled with heap_fix_new_page. Like
+ *			     heap_alloc_new_page, the pages are not linked to the heap.
+ *
+ * return	       : Error code.
+ * thread_p (in)       : Thread entry.
+ * hfid (in)	       : Heap file identifier.
+ * class_oid (in)      : Class identifier.
+ * npages (in)	       : Number of pages to allocate.
+ * new_page_vpids (out): Allocated pages.
+ *
+ * Note: The file header is fixed once for all pages, which also makes them likely to be contiguous.
+ */
+int
+heap_alloc_new_pages (THREAD_ENTRY * thread_p, HFID * hfid, OID class_oid, int npages, VPID * new_page_vpids)
+{
+  int error_code = NO_ERROR;
+  HEAP_CHAIN new_page_chain;
+
+  assert (hfid != NULL && new_page_vpids != NULL && npages > 0);
+
+  heap_init_new_page_chain (&new_page_chain, class_oid);
+
+  log_sysop_start (thread_p);
+
+  error_code = file_alloc_multiple (thread_p, &hfid->vfid, heap_vpid_init_new, &new_page_chain, npages,
+				    new_page_vpids);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      log_sysop_abort (thread_p);
+      return error_code;
+    }
+
+  // The pages belong to the transaction, like the ones of heap_alloc_new_page.
+  log_sysop_attach_to_outer (thread_p);
+
+  return NO_ERROR;
+}
+
+/*
+ * heap_fix_new_page () - Fix a page allocated by heap_alloc_new_pages.
+ *
+ * return	     : Error code.
+ * thread_p (in)     : Thread entry.
+ * hfid (in)	     : Heap file identifier.
+ * new_page_vpid (in): Page allocated by heap_alloc_new_pages.
+ * home_hint_p (out) : Watcher of the write latched page.
+ */
+int
+heap_fix_new_page (THREAD_ENTRY * thread_p, HFID * hfid, const VPID * new_page_vpid, PGBUF_WATCHER * home_hint_p)
+{
+  int error_code = NO_ERROR;
+
+  assert (hfid != NULL && home_hint_p != NULL && new_page_vpid != NULL);
+
+  PGBUF_INIT_WATCHER (home_hint_p, PGBUF_ORDERED_HEAP_NORMAL, hfid);
+
+  error_code = pgbuf_ordered_fix (thread_p, new_page_vpid, OLD_PAGE, PGBUF_LATCH_WRITE, home_hint_p);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  (void) pgbuf_check_page_ptype (thread_p, home_hint_p->pgptr, PAGE_HEAP);
+
+  return NO_ERROR;
+}
+
 int
 heap_nonheader_page_capacity ()
 {
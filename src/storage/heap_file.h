@@ -135,6 +135,29 @@ struct heap_scancache_node_list
   HEAP_SCANCACHE_NODE_LIST *next;
 };
 
+/* A bound that every qualified value of the attribute of a heap zone filter is within. */
+typedef struct heap_zone_bound HEAP_ZONE_BOUND;
+struct heap_zone_bound
+{
+  DB_VALUE value;
+  bool is_lower;		/* value is a lower bound, otherwise an upper one */
+  bool is_inclusive;		/* value itself is within bound */
+};
+
+#define HEAP_ZONE_FILTER_MAX_BOUNDS 4
+
+/* The range of an attribute that the qualified records of a heap scan are in. heap_next () skips the pages whose zone,
+ * the smallest and the greatest value of attribute in page, is out of range. The zones are cached only if
+ * heap_zone_map_pages is set. */
+typedef struct heap_zone_filter HEAP_ZONE_FILTER;
+struct heap_zone_filter
+{
+  HEAP_CACHE_ATTRINFO attr_info;	/* cache of attrid, to read it from the records of page */
+  ATTR_ID attrid;
+  int num_bounds;
+  HEAP_ZONE_BOUND bounds[HEAP_ZONE_FILTER_MAX_BOUNDS];
+};
+
 // *INDENT-OFF*
 typedef struct heap_scancache HEAP_SCANCACHE;
 struct heap_scancache
@@ -154,6 +177,12 @@ struct heap_scancache
     MVCC_SNAPSHOT *mvcc_snapshot;	/* mvcc snapshot */
     HEAP_SCANCACHE_NODE_LIST *partition_list;	/* list holding the heap file information for partition nodes involved
 						 * in the scan */
+    PGBUF_READ_AHEAD read_ahead;	/* sequential read-ahead of heap_next () */
+    bool read_ovf_prefix;	/* read only the first page of overflow records into area; the rest is read when the
+				 * attributes of heap_attrinfo_read_dbvalues need it */
+    OID ovf_oid;		/* overflow record whose prefix is in area, or null */
+    int ovf_length;		/* whole length of ovf_oid record */
+    HEAP_ZONE_FILTER *zone_filter;	/* filter of the pages to scan, or null */
 
 
     void start_area ();
@@ -182,6 +211,15 @@ struct heap_scanrange
   HEAP_SCANCACHE scan_cache;	/* Current cached information from previous scan */
 };
 
+typedef struct heap_parallel_cursor HEAP_PARALLEL_CURSOR;
+struct heap_parallel_cursor
+{				/* Shared position in the pages of a heap, for scans that split the pages between them.
+				 * Each page is given to one scan only. */
+  HFID hfid;			/* heap file */
+  pthread_mutex_t mutex;	/* protects next_vpid */
+  VPID next_vpid;		/* next page to give, NULL when all pages were given */
+};
+
 typedef struct heap_hfid_table HEAP_HFID_TABLE;
 struct heap_hfid_table
 {
@@ -417,6 +455,10 @@ extern void heap_scancache_end_modify (THREAD_ENTRY * thread_p, HEAP_SCANCACHE *
 extern SCAN_CODE heap_get_class_oid (THREAD_ENTRY * thread_p, const OID * oid, OID * class_oid);
 extern SCAN_CODE heap_next (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 			    RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking);
+extern void heap_parallel_cursor_start (HEAP_PARALLEL_CURSOR * cursor, const HFID * hfid);
+extern void heap_parallel_cursor_end (HEAP_PARALLEL_CURSOR * cursor);
+extern SCAN_CODE heap_parallel_next (THREAD_ENTRY * thread_p, HEAP_PARALLEL_CURSOR * cursor, OID * class_oid,
+				     OID * next_oid, RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking);
 extern SCAN_CODE heap_next_record_info (THREAD_ENTRY * thread_p, const HFID * hfid, OID * class_oid, OID * next_oid,
 					RECDES * recdes, HEAP_SCANCACHE * scan_cache, int ispeeking,
 					DB_VALUE ** cache_recordinfo);
@@ -454,6 +496,7 @@ extern int heap_get_num_objects (THREAD_ENTRY * thread_p, const HFID * hfid, int
 
 extern int heap_estimate (THREAD_ENTRY * thread_p, const HFID * hfid, int *npages, int *nobjs, int *avg_length);
 extern int heap_estimate_num_objects (THREAD_ENTRY * thread_p, const HFID * hfid);
+extern bool heap_is_bulk_read_scan (THREAD_ENTRY * thread_p, const HFID * hfid);
 
 extern int heap_get_class_name (THREAD_ENTRY * thread_p, const OID * class_oid, char **class_name);
 extern int heap_get_class_name_alloc_if_diff (THREAD_ENTRY * thread_p, const OID * class_oid, char *guess_classname,
@@ -472,6 +515,10 @@ extern void heap_attrinfo_end (THREAD_ENTRY * thread_p, HEAP_CACHE_ATTRINFO * at
 extern int heap_attrinfo_clear_dbvalues (HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_read_dbvalues (THREAD_ENTRY * thread_p, const OID * inst_oid, RECDES * recdes,
 					HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_attrinfo_start_lazy_read (THREAD_ENTRY * thread_p, const OID * inst_oid, RECDES * recdes,
+					  HEAP_SCANCACHE * scan_cache, HEAP_CACHE_ATTRINFO * attr_info);
+extern int heap_attrinfo_read_lazy_dbvalue (DB_VALUE * dbvalue, HEAP_CACHE_ATTRINFO * attr_info);
+extern void heap_attrinfo_end_lazy_read (HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_read_dbvalues_without_oid (THREAD_ENTRY * thread_p, RECDES * recdes,
 						    HEAP_CACHE_ATTRINFO * attr_info);
 extern int heap_attrinfo_delete_lob (THREAD_ENTRY * thread_p, RECDES * recdes, HEAP_CACHE_ATTRINFO * attr_info);
@@ -644,6 +691,7 @@ extern int heap_delete_hfid_from_cache (THREAD_ENTRY * thread_p, OID * class_oid
 extern void heap_page_set_vacuum_status_none (THREAD_ENTRY * thread_p, PAGE_PTR heap_page);
 extern MVCCID heap_page_get_max_mvccid (THREAD_ENTRY * thread_p, PAGE_PTR heap_page);
 extern HEAP_PAGE_VACUUM_STATUS heap_page_get_vacuum_status (THREAD_ENTRY * thread_p, PAGE_PTR heap_page);
+extern void heap_zone_map_set_changed (const VPID * vpid);
 extern bool heap_remove_page_on_vacuum (THREAD_ENTRY * thread_p, PAGE_PTR * page_ptr, HFID * hfid);
 
 extern int heap_rv_nop (THREAD_ENTRY * thread_p, LOG_RCV * rcv);
@@ -682,6 +730,10 @@ extern bool heap_is_page_header (THREAD_ENTRY * thread_p, PAGE_PTR page);
 
 extern int heap_alloc_new_page (THREAD_ENTRY * thread_p, HFID * hfid, OID class_oid, PGBUF_WATCHER * home_hint_p,
 				VPID * new_page_vpid);
+extern int heap_alloc_new_pages (THREAD_ENTRY * thread_p, HFID * hfid, OID class_oid, int npages,
+				 VPID * new_page_vpids);
+extern int heap_fix_new_page (THREAD_ENTRY * thread_p, HFID * hfid, const VPID * new_page_vpid,
+			      PGBUF_WATCHER * home_hint_p);
 
 extern int heap_nonheader_page_capacity ();
 
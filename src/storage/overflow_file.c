@@ -720,6 +720,17 @@ overflow_get_length (THREAD_ENTRY * thread_p, const VPID * ovf_vpid)
   return length;
 }
 
+/*
+ * overflow_get_first_page_length () - get the number of bytes of an overflow record kept in its first page
+ *
+ *   return: bytes of the first page
+ */
+int
+overflow_get_first_page_length (void)
+{
+  return DB_PAGESIZE - (int) offsetof (OVERFLOW_FIRST_PART, data);
+}
+
 /*
  * overflow_get_nbytes () - GET A PORTION OF THE CONTENT OF AN OVERFLOW RECORD
  *   return: scan status
@@ -28,6 +28,9 @@
 #include <stddef.h>
 #include <string.h>
 #include <assert.h>
+#if defined (SERVER_MODE) && defined (LINUX)
+#include <sched.h>
+#endif /* SERVER_MODE && LINUX */
 
 #include "page_buffer.h"
 
@@ -45,8 +48,10 @@
 #include "memory_hash.h"
 #include "critical_section.h"
 #include "perf_monitor.h"
+#include "perf_hotpath.hpp"
 #include "porting_inline.hpp"
 #include "environment_variable.h"
+#include "thread_affinity.hpp"
 #include "thread_daemon.hpp"
 #include "thread_entry_task.hpp"
 #include "thread_manager.hpp"
@@ -55,8 +60,11 @@
 #include "query_manager.h"
 #include "xserver_interface.h"
 #include "btree_load.h"
+#include "heap_file.h"
 #include "boot_sr.h"
 #include "double_write_buffer.h"
+#include "page_track.h"
+#include "page_zcache.h"
 #include "resource_tracker.hpp"
 #include "tde.h"
 #include "show_scan.h"
@@ -108,9 +116,11 @@ static int rv;
 
 /* size of one buffer page <BCB, page> */
 #define PGBUF_BCB_SIZEOF       (sizeof (PGBUF_BCB))
-#define PGBUF_IOPAGE_BUFFER_SIZE \
+#define PGBUF_IOPAGE_BUFFER_MIN_SIZE \
   ((size_t)(offsetof (PGBUF_IOPAGE_BUFFER, iopage) + \
   SIZEOF_IOPAGE_PAGESIZE_AND_GUARD()))
+/* with direct I/O every io page starts on an aligned boundary, so each buffer is padded to the alignment */
+#define PGBUF_IOPAGE_BUFFER_SIZE (pgbuf_Pool.iopage_buffer_size)
 /* size of buffer hash entry */
 #define PGBUF_BUFFER_HASH_SIZEOF       (sizeof (PGBUF_BUFFER_HASH))
 /* size of buffer lock record */
@@ -269,8 +279,9 @@ typedef enum
 #define PGBUF_AOUT_NOT_FOUND  -2
 
 #if defined (SERVER_MODE)
-/* vacuum workers and checkpoint thread should not contribute to promoting a bcb as active/hot */
-#define PGBUF_THREAD_SHOULD_IGNORE_UNFIX(th) VACUUM_IS_THREAD_VACUUM_WORKER (th)
+/* vacuum workers, checkpoint thread and bulk reads should not contribute to promoting a bcb as active/hot */
+#define PGBUF_THREAD_SHOULD_IGNORE_UNFIX(th) \
+  (VACUUM_IS_THREAD_VACUUM_WORKER (th) || ((th) != NULL && (th)->pgbuf_bulk_read_count > 0))
 #else
 #define PGBUF_THREAD_SHOULD_IGNORE_UNFIX(th) false
 #endif
@@ -294,6 +305,20 @@ typedef enum
 
 #define PGBUF_NEIGHBOR_POS(idx) (PGBUF_NEIGHBOR_PAGES - 1 + (idx))
 
+/* Flush feedback controller: the victim flush boost grows while threads wait for direct victims longer than the
+ * target and decays back to 1 otherwise. It is held while the page writes are much slower than usual.
+ */
+#define PGBUF_FLUSH_FEEDBACK_MAX_BOOST 8.0f
+#define PGBUF_FLUSH_FEEDBACK_BOOST_UP 1.5f
+#define PGBUF_FLUSH_FEEDBACK_BOOST_DOWN 0.8f
+/* writes slower than their smoothed latency by this factor mean the device is saturated */
+#define PGBUF_FLUSH_FEEDBACK_SATURATED_MULT 4.0f
+/* weight of the last period in the smoothed write latency */
+#define PGBUF_FLUSH_FEEDBACK_LATENCY_WEIGHT 0.125f
+
+/* flush victims from private lists having more than this ratio of their quota (divided by flush boost) */
+#define PGBUF_LRU_VICT_TARGET_QUOTA_RATIO 0.9f
+
 /* maximum number of simultaneous fixes a thread may have on the same page */
 #define PGBUF_MAX_PAGE_WATCHERS 64
 /* maximum number of simultaneous fixed pages from a single thread */
@@ -306,6 +331,11 @@ typedef enum
 /* default pages to flush in each interval during log checkpoint */
 #define PGBUF_CHKPT_BURST_PAGES 16
 
+/* incremental checkpoint runs this many times in a checkpoint interval; each run flushes the pages dirtied before
+ * the previous run */
+#define PGBUF_INCR_CHKPT_STEPS 8
+#define PGBUF_INCR_CHKPT_MIN_INTERVAL_SECS 1
+
 #define INIT_HOLDER_STAT(perf_stat) \
   do \
     { \
@@ -366,6 +396,8 @@ typedef struct pgbuf_status PGBUF_STATUS;
 typedef struct pgbuf_status_snapshot PGBUF_STATUS_SNAPSHOT;
 typedef struct pgbuf_status_old PGBUF_STATUS_OLD;
 
+typedef struct pgbuf_residency PGBUF_RESIDENCY;
+
 struct pgbuf_status
 {
   unsigned long long num_hit;
@@ -498,6 +530,10 @@ struct pgbuf_bcb
 
   LOG_LSA oldest_unflush_lsa;	/* The oldest LSA record of the page that has not been written to disk */
   PGBUF_IOPAGE_BUFFER *iopage_buffer;	/* pointer to iopage buffer structure */
+
+  PGBUF_RESIDENCY *residency;	/* residency counters the bcb is accounted in while in lru lists */
+  INT64 lru_enter_time;		/* time when bcb entered lru lists */
+  volatile INT64 version;	/* incremented when a write latch is released and when the bcb gets another page */
 };
 
 /* iopage buffer structure */
@@ -647,11 +683,24 @@ struct pgbuf_seq_flusher
   bool burst_mode;		/* config : flush in burst or flush one page and wait */
 };
 
+/* residency counters of the bcb's in lru lists, per volume purpose and page type. a bcb is accounted with the page
+ * type it had when it entered lru lists. */
+struct pgbuf_residency
+{
+  volatile int lru1_cnt;	/* bcb's in lru 1 zone */
+  volatile int lru2_cnt;	/* bcb's in lru 2 zone */
+  volatile int lru3_cnt;	/* bcb's in lru 3 zone */
+  volatile int dirty_cnt;	/* dirty bcb's in any lru zone */
+  volatile INT64 sum_lru_enter_time;	/* sum of bcb lru_enter_time, to compute average age */
+};
+
 typedef struct pgbuf_page_monitor PGBUF_PAGE_MONITOR;
 struct pgbuf_page_monitor
 {
   INT64 dirties_cnt;		/* Number of dirty buffers. */
 
+  PGBUF_RESIDENCY residency[2][PAGE_LAST + 1];	/* permanent/temporary and page type residency counters */
+
   int *lru_hits;		/* Current hits in LRU1 per LRU */
   int *lru_activity;		/* Activity level per LRU */
 
@@ -669,6 +718,19 @@ struct pgbuf_page_monitor
 				 * value. */
 };
 
+typedef struct pgbuf_flush_feedback PGBUF_FLUSH_FEEDBACK;
+struct pgbuf_flush_feedback
+{
+  /* Collected since last adjustment: */
+  INT64 victim_wait_usec;	/* time threads waited for direct victims */
+  int victim_wait_cnt;		/* number of waits for direct victims */
+  INT64 write_usec;		/* time spent writing flushed pages */
+  int write_cnt;		/* number of written pages */
+
+  float avg_write_usec;		/* smoothed page write latency */
+  float boost;			/* victim flush boost; 1 means no boost */
+};
+
 typedef struct pgbuf_page_quota PGBUF_PAGE_QUOTA;
 struct pgbuf_page_quota
 {
@@ -692,6 +754,10 @@ struct pgbuf_page_quota
   int is_adjusting;
 };
 
+/* NUMA partitions */
+#define PGBUF_NUMA_MAX_NODES 8
+#define PGBUF_NUMA_MIN_BUFFERS_PER_NODE 4096
+
 #if defined (SERVER_MODE)
 /* PGBUF_DIRECT_VICTIM - system used to optimize the victim assignment without searching and burning CPU uselessly.
  * threads are waiting to be assigned a victim directly and woken up.
@@ -706,6 +772,35 @@ struct pgbuf_direct_victim
   /* *INDENT-ON* */
 };
 #define PGBUF_FLUSHED_BCBS_BUFFER_SIZE (8 * 1024)	/* 8k */
+
+
+/* bulk read: a scan of a file bigger than 1/PGBUF_BULK_READ_BUFFER_RATIO of the buffer is a bulk read */
+#define PGBUF_BULK_READ_BUFFER_RATIO 4
+
+/* read-ahead */
+#define PGBUF_READ_AHEAD_VPIDS_BUFFER_SIZE (4 * 1024)	/* 4k */
+#define PGBUF_READ_AHEAD_SEQ_THRESHOLD 2	/* consecutive pages before a scan is considered sequential */
+
+/* warm-up */
+#define PGBUF_WARMUP_FILE_MAGIC 0x50475755	/* "PGWU" */
+#define PGBUF_WARMUP_ZONE_WEIGHT (1 << 16)	/* hotness of a BCB is its zone first, then its fix count */
+#define PGBUF_WARMUP_MIN_PAGES_PER_THREAD 1024
+#define PGBUF_WARMUP_LOAD_INTERVAL_SECS 1	/* daemon interval until the warm-up file is loaded */
+
+typedef struct pgbuf_warmup_file_header PGBUF_WARMUP_FILE_HEADER;
+struct pgbuf_warmup_file_header
+{
+  int magic;
+  int db_pagesize;
+  int count;			/* number of VPIDs following the header */
+};
+
+typedef struct pgbuf_warmup_entry PGBUF_WARMUP_ENTRY;
+struct pgbuf_warmup_entry
+{
+  VPID vpid;			/* must be first, entries are sorted with pgbuf_compare_vpid */
+  int hotness;
+};
 #endif /* SERVER_MODE */
 
 /* The buffer Pool */
@@ -720,6 +815,10 @@ struct pgbuf_buffer_pool
   PGBUF_BUFFER_HASH *buf_hash_table;	/* buffer hash table */
   PGBUF_BUFFER_LOCK *buf_lock_table;	/* buffer lock table */
   PGBUF_IOPAGE_BUFFER *iopage_table;	/* IO page table */
+  size_t iopage_buffer_size;	/* distance between two io page buffers */
+  void *iopage_area;		/* allocated area that holds iopage_table */
+  size_t iopage_table_size;	/* allocated size of iopage_area */
+  OS_HUGE_PAGES_TYPE iopage_table_huge_pages;	/* how iopage_table is backed */
   int num_LRU_list;		/* number of shared LRU lists */
   float ratio_lru1;		/* ratio for lru 1 zone */
   float ratio_lru2;		/* ratio for lru 2 zone */
@@ -728,10 +827,15 @@ struct pgbuf_buffer_pool
 				 * the last 'num_private_LRU_list' are private lists.
 				 * When page quota is disabled only shared lists are used */
   PGBUF_AOUT_LIST buf_AOUT_list;	/* Aout list */
-  PGBUF_INVALID_LIST buf_invalid_list;	/* buffer invalid BCB list */
+  /* NUMA partitions: the BCBs are split into ranges allocated on each node, every range has its own invalid list.
+   * without NUMA partitions, there is a single range. */
+  int num_numa_nodes;
+  int numa_first_bcb[PGBUF_NUMA_MAX_NODES + 1];	/* first BCB of each range; the last entry is num_buffers */
+  PGBUF_INVALID_LIST buf_invalid_list[PGBUF_NUMA_MAX_NODES];	/* buffer invalid BCB lists */
 
   PGBUF_VICTIM_CANDIDATE_LIST *victim_cand_list;
   PGBUF_SEQ_FLUSHER seq_chkpt_flusher;
+  PGBUF_SEQ_FLUSHER seq_incr_chkpt_flusher;	/* used by incremental checkpoint daemon */
 
   PGBUF_PAGE_MONITOR monitor;
   PGBUF_PAGE_QUOTA quota;
@@ -773,7 +877,9 @@ struct pgbuf_buffer_pool
   /* *INDENT-OFF* */
 #if defined (SERVER_MODE)
   PGBUF_DIRECT_VICTIM direct_victims;	/* direct victim assignment */
+  PGBUF_FLUSH_FEEDBACK flush_feedback;	/* adapts victim flush to direct victim waits */
   lockfree::circular_queue<PGBUF_BCB *> *flushed_bcbs;	/* post-flush processing */
+  lockfree::circular_queue<VPID> *read_ahead_vpids;	/* pages requested to be read ahead */
 #endif				/* SERVER_MODE */
   lockfree::circular_queue<int> *private_lrus_with_victims;
   lockfree::circular_queue<int> *big_private_lrus_with_victims;
@@ -1000,7 +1106,8 @@ STATIC_INLINE int pgbuf_latch_bcb_upon_fix (THREAD_ENTRY * thread_p, PGBUF_BCB *
 static int pgbuf_latch_idle_page (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE request_mode);
 
 STATIC_INLINE PGBUF_BCB *pgbuf_search_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor,
-						  const VPID * vpid) __attribute__ ((ALWAYS_INLINE));
+						  const VPID * vpid, bool hold_anchor_if_not_found)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_insert_into_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor,
 						PGBUF_BCB * bufptr) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_delete_from_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
@@ -1012,6 +1119,7 @@ static PGBUF_BCB *pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_
 static PGBUF_BCB *pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE fetch_mode,
 					   PGBUF_BUFFER_HASH * hash_anchor, PGBUF_FIX_PERF * perf, bool * try_again);
 static int pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
+static void pgbuf_zcache_put_victim (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
 static int pgbuf_bcb_safe_flush_internal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool synchronous, bool * locked);
 static int pgbuf_invalidate_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr);
 static int pgbuf_bcb_safe_flush_force_lock (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool synchronous);
@@ -1124,6 +1232,9 @@ STATIC_INLINE void pgbuf_add_watch_instance_internal (PGBUF_HOLDER * holder, PAG
 #endif
 static PGBUF_HOLDER *pgbuf_get_holder (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
 static void pgbuf_remove_watcher (PGBUF_HOLDER * holder, PGBUF_WATCHER * watcher_object);
+static int pgbuf_flush_upto_lsa (THREAD_ENTRY * thread_p, PGBUF_SEQ_FLUSHER * seq_flusher,
+				 const LOG_LSA * flush_upto_lsa, const LOG_LSA * prev_chkpt_redo_lsa,
+				 LOG_LSA * smallest_lsa, int *flushed_page_cnt);
 static int pgbuf_flush_chkpt_seq_list (THREAD_ENTRY * thread_p, PGBUF_SEQ_FLUSHER * seq_flusher,
 				       const LOG_LSA * prev_chkpt_redo_lsa, LOG_LSA * chkpt_smallest_lsa);
 static int pgbuf_flush_seq_list (THREAD_ENTRY * thread_p, PGBUF_SEQ_FLUSHER * seq_flusher, struct timeval *limit_time,
@@ -1135,6 +1246,13 @@ static const char *pgbuf_zone_str (PGBUF_ZONE zone);
 static const char *pgbuf_consistent_str (int consistent);
 
 static void pgbuf_compute_lru_vict_target (float *lru_sum_flush_priority);
+STATIC_INLINE float pgbuf_get_flush_boost (void) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int pgbuf_get_neighbor_flush_pages (void) __attribute__ ((ALWAYS_INLINE));
+#if defined (SERVER_MODE)
+static void pgbuf_flush_feedback_adjust (void);
+STATIC_INLINE void pgbuf_flush_feedback_add_time (INT64 * time_usec, int *count, TSC_TICKS start_tick)
+  __attribute__ ((ALWAYS_INLINE));
+#endif /* SERVER_MODE */
 
 STATIC_INLINE bool pgbuf_is_bcb_victimizable (PGBUF_BCB * bcb, bool has_mutex_lock) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE bool pgbuf_is_bcb_fixed_by_any (PGBUF_BCB * bcb, bool has_mutex_lock) __attribute__ ((ALWAYS_INLINE));
@@ -1162,6 +1280,11 @@ STATIC_INLINE void pgbuf_bcb_update_flags (THREAD_ENTRY * thread_p, PGBUF_BCB *
   __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE void pgbuf_bcb_change_zone (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int lru_idx, PGBUF_ZONE zone)
   __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_set_residency (PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_residency_add (PGBUF_BCB * bcb, int flags, bool enters_lru)
+  __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void pgbuf_bcb_residency_remove (PGBUF_BCB * bcb, int flags, bool leaves_lru)
+  __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE PGBUF_ZONE pgbuf_bcb_get_zone (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_bcb_get_lru_index (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int pgbuf_bcb_get_pool_index (const PGBUF_BCB * bcb) __attribute__ ((ALWAYS_INLINE));
@@ -1195,6 +1318,10 @@ static int pgbuf_bcbmon_trylock (PGBUF_BCB * bcb, int caller_line);
 static void pgbuf_bcbmon_unlock (PGBUF_BCB * bcb);
 static void pgbuf_bcbmon_check_own (PGBUF_BCB * bcb);
 static void pgbuf_bcbmon_check_mutex_leaks (void);
+
+static bool pgbuf_read_ahead_page (THREAD_ENTRY * thread_p, const VPID * vpid);
+static int pgbuf_warmup_dump (THREAD_ENTRY * thread_p);
+static int pgbuf_warmup_load (THREAD_ENTRY * thread_p);
 #endif /* SERVER_MODE */
 
 STATIC_INLINE bool pgbuf_lfcq_add_lru_with_victims (PGBUF_LRU_LIST * lru_list) __attribute__ ((ALWAYS_INLINE));
@@ -1213,6 +1340,7 @@ static bool pgbuf_is_temp_lsa (const log_lsa & lsa);
 static void pgbuf_init_temp_page_lsa (FILEIO_PAGE * io_page, PGLENGTH page_size);
 
 static void pgbuf_scan_bcb_table (THREAD_ENTRY * thread_p);
+static const char *pgbuf_page_type_name (int page_type);
 
 #if defined (SERVER_MODE)
 // *INDENT-OFF*
@@ -1220,11 +1348,23 @@ static cubthread::daemon *pgbuf_Page_maintenance_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Page_post_flush_daemon = NULL;
 static cubthread::daemon *pgbuf_Flush_control_daemon = NULL;
+static cubthread::daemon *pgbuf_Page_read_ahead_daemon = NULL;
+static cubthread::daemon *pgbuf_Warmup_daemon = NULL;
+static cubthread::daemon *pgbuf_Incremental_checkpoint_daemon = NULL;
+static std::atomic<bool> pgbuf_Warmup_stop (false);
 // *INDENT-ON*
 #endif /* SERVER_MODE */
 
 static bool pgbuf_is_page_flush_daemon_available ();
 
+static void pgbuf_initialize_bcb_range (int first, int last, bool touch_pages);
+#if defined (SERVER_MODE) && defined (LINUX)
+static bool pgbuf_numa_initialize_bcb_table (void);
+#endif /* SERVER_MODE && LINUX */
+STATIC_INLINE int pgbuf_numa_get_local_node (void) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE int pgbuf_numa_get_bcb_node (const PGBUF_BCB * bufptr) __attribute__ ((ALWAYS_INLINE));
+static int pgbuf_get_invalid_count (void);
+
 /*
  * pgbuf_hash_func_mirror () - Hash VPID into hash anchor
  *   return: hash value
@@ -1395,6 +1535,9 @@ pgbuf_initialize (void)
     }
 
   pgbuf_Pool.check_for_interrupts = false;
+#if defined (SERVER_MODE)
+  pgbuf_Pool.flush_feedback.boost = 1.0f;
+#endif /* SERVER_MODE */
 
   pgbuf_Pool.victim_cand_list =
     ((PGBUF_VICTIM_CANDIDATE_LIST *) malloc (pgbuf_Pool.num_buffers * sizeof (PGBUF_VICTIM_CANDIDATE_LIST)));
@@ -1419,10 +1562,15 @@ pgbuf_initialize (void)
       {
 	goto error;
       }
+    if (pgbuf_initialize_seq_flusher (&(pgbuf_Pool.seq_incr_chkpt_flusher), NULL, cnt) != NO_ERROR)
+      {
+	goto error;
+      }
   }
 
   /* TODO[arnia] : not required, if done in monitor initialization */
   pgbuf_Pool.monitor.dirties_cnt = 0;
+  memset (pgbuf_Pool.monitor.residency, 0, sizeof (pgbuf_Pool.monitor.residency));
 
 #if defined (SERVER_MODE)
   pgbuf_Pool.direct_victims.bcb_victims = (PGBUF_BCB **) malloc (thread_num_total_threads () * sizeof (PGBUF_BCB *));
@@ -1462,6 +1610,15 @@ pgbuf_initialize (void)
       ASSERT_ERROR ();
       goto error;
     }
+
+  /* *INDENT-OFF* */
+  pgbuf_Pool.read_ahead_vpids = new lockfree::circular_queue<VPID> (PGBUF_READ_AHEAD_VPIDS_BUFFER_SIZE);
+  /* *INDENT-ON* */
+  if (pgbuf_Pool.read_ahead_vpids == NULL)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
 #endif /* SERVER_MODE */
 
   if (PGBUF_PAGE_QUOTA_IS_ENABLED)
@@ -1494,6 +1651,18 @@ pgbuf_initialize (void)
       goto error;
     }
 
+  if (zcache_initialize () != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
+
+  if (pgtrack_initialize () != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      goto error;
+    }
+
   pgbuf_Pool.show_status = (PGBUF_STATUS *) malloc (sizeof (PGBUF_STATUS) * (MAX_NTRANS + 1));
   if (pgbuf_Pool.show_status == NULL)
     {
@@ -1565,9 +1734,12 @@ pgbuf_finalize (void)
       pgbuf_Pool.num_buffers = 0;
     }
 
-  if (pgbuf_Pool.iopage_table != NULL)
+  if (pgbuf_Pool.iopage_area != NULL)
     {
-      free_and_init (pgbuf_Pool.iopage_table);
+      os_free_huge_pages (pgbuf_Pool.iopage_area, pgbuf_Pool.iopage_table_size, pgbuf_Pool.iopage_table_huge_pages);
+      pgbuf_Pool.iopage_area = NULL;
+      pgbuf_Pool.iopage_table = NULL;
+      pgbuf_Pool.iopage_table_huge_pages = OS_HUGE_PAGES_NONE;
     }
 
   /* final task for LRU list */
@@ -1580,8 +1752,11 @@ pgbuf_finalize (void)
       free_and_init (pgbuf_Pool.buf_LRU_list);
     }
 
-  /* final task for invalid BCB list */
-  pthread_mutex_destroy (&pgbuf_Pool.buf_invalid_list.invalid_mutex);
+  /* final task for invalid BCB lists */
+  for (i = 0; i < pgbuf_Pool.num_numa_nodes; i++)
+    {
+      pthread_mutex_destroy (&pgbuf_Pool.buf_invalid_list[i].invalid_mutex);
+    }
 
   /* final task for thrd_holder_info */
   if (pgbuf_Pool.thrd_holder_info != NULL)
@@ -1636,6 +1811,10 @@ pgbuf_finalize (void)
     {
       free_and_init (pgbuf_Pool.seq_chkpt_flusher.flush_list);
     }
+  if (pgbuf_Pool.seq_incr_chkpt_flusher.flush_list != NULL)
+    {
+      free_and_init (pgbuf_Pool.seq_incr_chkpt_flusher.flush_list);
+    }
 
   /* Free quota structure data */
   if (pgbuf_Pool.quota.lru_victim_flush_priority_per_lru != NULL)
@@ -1682,6 +1861,11 @@ pgbuf_finalize (void)
       delete pgbuf_Pool.flushed_bcbs;
       pgbuf_Pool.flushed_bcbs = NULL;
     }
+  if (pgbuf_Pool.read_ahead_vpids != NULL)
+    {
+      delete pgbuf_Pool.read_ahead_vpids;
+      pgbuf_Pool.read_ahead_vpids = NULL;
+    }
 #endif /* SERVER_MODE */
 
   if (pgbuf_Pool.private_lrus_with_victims != NULL)
@@ -1700,6 +1884,9 @@ pgbuf_finalize (void)
       pgbuf_Pool.shared_lrus_with_victims = NULL;
     }
 
+  zcache_finalize ();
+  pgtrack_finalize ();
+
   if (pgbuf_Pool.show_status != NULL)
     {
       free (pgbuf_Pool.show_status);
@@ -1794,6 +1981,7 @@ pgbuf_fix_release (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_MODE f
 		   PGBUF_LATCH_MODE request_mode, PGBUF_LATCH_CONDITION condition)
 #endif				/* NDEBUG */
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_PGBUF_FIX);
   PGBUF_BUFFER_HASH *hash_anchor;
   PGBUF_BCB *bufptr;
   PAGE_PTR pgptr;
@@ -1886,7 +2074,7 @@ try_again:
   hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)];
 
   buf_lock_acquired = false;
-  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
+  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid, fetch_mode != OLD_PAGE_IF_IN_BUFFER);
   if (bufptr != NULL && pgbuf_bcb_is_direct_victim (bufptr))
     {
       /* we need to notify the thread that is waiting for this bcb to victimize that it cannot use it. */
@@ -1912,8 +2100,7 @@ try_again:
     }
   else if (fetch_mode == OLD_PAGE_IF_IN_BUFFER)
     {
-      /* we don't need to fix page */
-      pthread_mutex_unlock (&hash_anchor->hash_mutex);
+      /* we don't need to fix page; the hash anchor mutex was not taken */
       return NULL;
     }
   else
@@ -1982,11 +2169,8 @@ try_again:
       pgbuf_bcb_register_avoid_deallocation (bufptr);
     }
 
-  /* At this place, the caller is holding bufptr->mutex */
-  if (perf.is_perf_tracking)
-    {
-      tsc_getticks (&perf.start_holder_tick);
-    }
+  /* At this place, the caller is holding bufptr->mutex. The latch wait histogram is always collected. */
+  tsc_getticks (&perf.start_holder_tick);
 
   /* Latch Pass */
 #if !defined (NDEBUG)
@@ -2021,7 +2205,7 @@ try_again:
   pgbuf_add_fixed_at (pgbuf_find_thrd_holder (thread_p, bufptr), caller_file, caller_line, !had_holder);
 #endif /* NDEBUG */
 
-  if (perf.is_perf_tracking && is_latch_wait)
+  if (is_latch_wait)
     {
       tsc_getticks (&perf.end_tick);
       tsc_elapsed_time_usec (&perf.tv_diff, perf.end_tick, perf.start_holder_tick);
@@ -2122,6 +2306,12 @@ try_again:
 
   show_status->num_page_request++;
 
+  if (is_latch_wait)
+    {
+      perf.perf_page_type = pgbuf_get_page_type_for_stat (thread_p, pgptr);
+      perfmon_pbx_latch_wait_histogram (thread_p, perf.perf_page_type, perf.holder_wait_time);
+    }
+
   /* Record number of fetches in statistics */
   if (perf.is_perf_tracking)
     {
@@ -2447,6 +2637,7 @@ void
 pgbuf_unfix (THREAD_ENTRY * thread_p, PAGE_PTR pgptr)
 #endif				/* NDEBUG */
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_PGBUF_UNFIX);
   PGBUF_BCB *bufptr;
   int holder_status;
   PERF_HOLDER_LATCH perf_holder_latch;
@@ -2859,6 +3050,9 @@ pgbuf_invalidate_all (THREAD_ENTRY * thread_p, VOLID volid)
   VPID temp_vpid;
   int bufid;
 
+  /* the pages which are not in buffer may be in compressed cache */
+  zcache_remove_volume (volid);
+
   /*
    * While searching all the buffer pages or corresponding buffer pages,
    * the caller flushes each buffer page if it is dirty and
@@ -3333,7 +3527,7 @@ pgbuf_flush_victim_candidates (THREAD_ENTRY * thread_p, float flush_ratio, PERF_
       lru_dynamic_flush_adj = 1.0f;
     }
 
-  check_count_lru = (int) (cfg_check_cnt * lru_dynamic_flush_adj);
+  check_count_lru = (int) (cfg_check_cnt * lru_dynamic_flush_adj * pgbuf_get_flush_boost ());
   /* limit the checked BCBs to equivalent of 200 M */
   check_count_lru = MIN (check_count_lru, (200 * 1024 * 1024) / db_page_size ());
 
@@ -3445,7 +3639,7 @@ repeat:
 	  continue;
 	}
 
-      if (PGBUF_NEIGHBOR_PAGES > 1)
+      if (pgbuf_get_neighbor_flush_pages () > 1)
 	{
 	  error = pgbuf_flush_page_and_neighbors_fb (thread_p, bufptr, &flushed_pages);
 	  /* BCB mutex already unlocked by neighbor flush function */
@@ -3551,18 +3745,46 @@ end:
 int
 pgbuf_flush_checkpoint (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa, const LOG_LSA * prev_chkpt_redo_lsa,
 			LOG_LSA * smallest_lsa, int *flushed_page_cnt)
+{
+  int error;
+
+#if defined (SERVER_MODE)
+  pgbuf_Pool.is_checkpoint = true;
+#endif
+
+  error = pgbuf_flush_upto_lsa (thread_p, &pgbuf_Pool.seq_chkpt_flusher, flush_upto_lsa, prev_chkpt_redo_lsa,
+				smallest_lsa, flushed_page_cnt);
+
+#if defined (SERVER_MODE)
+  pgbuf_Pool.is_checkpoint = false;
+#endif
+
+  return error;
+}
+
+/*
+ * pgbuf_flush_upto_lsa () - Flush any unfixed dirty page whose oldest unflushed lsa is not after flush_upto_lsa
+ *   return:error code or NO_ERROR
+ *   seq_flusher(in): flusher to use; checkpoint and incremental checkpoint have their own
+ *   flush_upto_lsa(in):
+ *   prev_chkpt_redo_lsa(in): Redo_LSA of previous checkpoint
+ *   smallest_lsa(out): Smallest LSA of a dirty buffer in buffer pool
+ *   flushed_page_cnt(out): The number of flushed pages
+ */
+static int
+pgbuf_flush_upto_lsa (THREAD_ENTRY * thread_p, PGBUF_SEQ_FLUSHER * seq_flusher, const LOG_LSA * flush_upto_lsa,
+		      const LOG_LSA * prev_chkpt_redo_lsa, LOG_LSA * smallest_lsa, int *flushed_page_cnt)
 {
 #define detailed_er_log(...) if (detailed_logging) _er_log_debug (ARG_FILE_LINE, __VA_ARGS__)
   PGBUF_BCB *bufptr;
   int bufid;
   int flushed_page_cnt_local = 0;
-  PGBUF_SEQ_FLUSHER *seq_flusher;
   PGBUF_VICTIM_CANDIDATE_LIST *f_list;
   int collected_bcbs;
   int error = NO_ERROR;
   bool detailed_logging = prm_get_bool_value (PRM_ID_LOG_CHKPT_DETAILED);
 
-  detailed_er_log ("pgbuf_flush_checkpoint start : flush_upto_LSA:%d, prev_chkpt_redo_LSA:%d\n",
+  detailed_er_log ("pgbuf_flush_upto_lsa start : flush_upto_LSA:%d, prev_chkpt_redo_LSA:%d\n",
 		   flush_upto_lsa->pageid, (prev_chkpt_redo_lsa ? prev_chkpt_redo_lsa->pageid : -1));
 
   if (flushed_page_cnt != NULL)
@@ -3574,19 +3796,14 @@ pgbuf_flush_checkpoint (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa,
   logpb_flush_log_for_wal (thread_p, flush_upto_lsa);
   LSA_SET_NULL (smallest_lsa);
 
-  seq_flusher = &(pgbuf_Pool.seq_chkpt_flusher);
   f_list = seq_flusher->flush_list;
 
   LSA_COPY (&seq_flusher->flush_upto_lsa, flush_upto_lsa);
 
-  detailed_er_log ("pgbuf_flush_checkpoint start : start\n");
+  detailed_er_log ("pgbuf_flush_upto_lsa start : start\n");
 
   collected_bcbs = 0;
 
-#if defined (SERVER_MODE)
-  pgbuf_Pool.is_checkpoint = true;
-#endif
-
   for (bufid = 0; bufid < pgbuf_Pool.num_buffers; bufid++)
     {
       if (collected_bcbs >= seq_flusher->flush_max_size)
@@ -3600,9 +3817,6 @@ pgbuf_flush_checkpoint (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa,
 	  error = pgbuf_flush_chkpt_seq_list (thread_p, seq_flusher, prev_chkpt_redo_lsa, smallest_lsa);
 	  if (error != NO_ERROR)
 	    {
-#if defined (SERVER_MODE)
-	      pgbuf_Pool.is_checkpoint = false;
-#endif
 	      return error;
 	    }
 
@@ -3646,7 +3860,6 @@ pgbuf_flush_checkpoint (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa,
 #if defined(SERVER_MODE)
       if (thread_p != NULL && thread_p->shutdown == true)
 	{
-	  pgbuf_Pool.is_checkpoint = false;
 	  return ER_FAILED;
 	}
 #endif
@@ -3664,11 +3877,7 @@ pgbuf_flush_checkpoint (THREAD_ENTRY * thread_p, const LOG_LSA * flush_upto_lsa,
       flushed_page_cnt_local += seq_flusher->flushed_pages;
     }
 
-#if defined (SERVER_MODE)
-  pgbuf_Pool.is_checkpoint = false;
-#endif
-
-  detailed_er_log ("pgbuf_flush_checkpoint END flushed:%d\n", flushed_page_cnt_local);
+  detailed_er_log ("pgbuf_flush_upto_lsa END flushed:%d\n", flushed_page_cnt_local);
 
   if (flushed_page_cnt != NULL)
     {
@@ -4089,7 +4298,7 @@ pgbuf_copy_to_area (THREAD_ENTRY * thread_p, const VPID * vpid, int start_offset
 
   /* Is this a resident page ? */
   hash_anchor = &(pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)]);
-  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
+  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid, true);
 
   if (bufptr == NULL)
     {
@@ -4204,7 +4413,7 @@ pgbuf_copy_from_area (THREAD_ENTRY * thread_p, const VPID * vpid, int start_offs
 
   /* Is this a resident page ? */
   hash_anchor = &(pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (vpid)]);
-  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid);
+  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, vpid, true);
 
   if (bufptr == NULL)
     {
@@ -4569,6 +4778,21 @@ pgbuf_get_tde_algorithm (PAGE_PTR pgptr)
     }
 }
 
+/*
+ * pgbuf_get_tde_dk_gen () - get the generation of the perm data key the page is encrypted with on disk
+ *   return: generation of the data key
+ *   pgptr(in): Page pointer
+ */
+int
+pgbuf_get_tde_dk_gen (PAGE_PTR pgptr)
+{
+  FILEIO_PAGE *iopage = NULL;
+
+  CAST_PGPTR_TO_IOPGPTR (iopage, pgptr);
+
+  return iopage->prv.tde_dk_gen;
+}
+
 /*
  * pgbuf_get_vpid () - Find the volume and page identifier associated with the passed buffer
  *   return: void
@@ -4648,6 +4872,56 @@ pgbuf_get_latch_mode (PAGE_PTR pgptr)
   return bufptr->latch_mode;
 }
 
+/*
+ * pgbuf_get_page_version () - get the version of a fixed page
+ *   return: page version
+ *   pgptr(in): page pointer, fixed with read or write latch
+ *   bcb_handle(out): handle of the page buffer, for pgbuf_is_page_version_current
+ *
+ * Note: The version changes whenever the page may have been modified or the buffer got another page.
+ */
+INT64
+pgbuf_get_page_version (PAGE_PTR pgptr, void **bcb_handle)
+{
+  PGBUF_BCB *bufptr;
+
+  CAST_PGPTR_TO_BFPTR (bufptr, pgptr);
+  assert (bufptr->latch_mode == PGBUF_LATCH_READ || bufptr->latch_mode == PGBUF_LATCH_WRITE);
+
+  *bcb_handle = bufptr;
+  return ATOMIC_INC_64 (&bufptr->version, 0);
+}
+
+/*
+ * pgbuf_is_page_version_current () - is the page still the one of the given version?
+ *   return: true if the page is in the buffer, has the version and is not write latched
+ *   bcb_handle(in): handle from pgbuf_get_page_version
+ *   vpid(in): page identifier
+ *   version(in): page version from pgbuf_get_page_version
+ *
+ * Note: The page does not need to be fixed. A true answer means the page had not changed, at least until the check
+ *       started; a copy of the page taken with the version is then as good as the page itself.
+ */
+bool
+pgbuf_is_page_version_current (void *bcb_handle, const VPID * vpid, INT64 version)
+{
+  PGBUF_BCB *bufptr = (PGBUF_BCB *) bcb_handle;
+
+  assert (bufptr != NULL);
+
+  /* a writer releases the latch after incrementing the version, so check latch first */
+  if (*((volatile PGBUF_LATCH_MODE *) &bufptr->latch_mode) == PGBUF_LATCH_WRITE)
+    {
+      return false;
+    }
+  if (ATOMIC_INC_64 (&bufptr->version, 0) != version)
+    {
+      return false;
+    }
+  /* the version is incremented before the buffer gets another page */
+  return VPID_EQ (&bufptr->vpid, vpid);
+}
+
 /*
  * pgbuf_get_page_id () - Find the page identifier associated with the passed buffer
  *   return: PAGEID
@@ -4828,7 +5102,7 @@ pgbuf_set_bcb_page_vpid (PGBUF_BCB * bufptr, bool force_set_vpid)
 	  bufptr->iopage_buffer->iopage.prv.volid = bufptr->vpid.volid;
 
 	  bufptr->iopage_buffer->iopage.prv.ptype = '\0';
-	  bufptr->iopage_buffer->iopage.prv.p_reserve_1 = 0;
+	  bufptr->iopage_buffer->iopage.prv.tde_dk_gen = 0;
 	  bufptr->iopage_buffer->iopage.prv.p_reserve_2 = 0;
 	  bufptr->iopage_buffer->iopage.prv.tde_nonce = 0;
 	}
@@ -4923,9 +5197,6 @@ pgbuf_is_temporary_volume (VOLID volid)
 static int
 pgbuf_initialize_bcb_table (void)
 {
-  PGBUF_BCB *bufptr;
-  PGBUF_IOPAGE_BUFFER *ioptr;
-  int i;
   long long unsigned alloc_size;
 
   /* allocate space for page buffer BCB table */
@@ -4943,7 +5214,17 @@ pgbuf_initialize_bcb_table (void)
     }
 
   /* allocate space for io page buffers */
+  pgbuf_Pool.iopage_buffer_size = PGBUF_IOPAGE_BUFFER_MIN_SIZE;
+  if (fileio_is_direct_io_enabled ())
+    {
+      pgbuf_Pool.iopage_buffer_size = DB_ALIGN (PGBUF_IOPAGE_BUFFER_MIN_SIZE, FILEIO_DIRECT_IO_ALIGNMENT);
+    }
   alloc_size = (long long unsigned) pgbuf_Pool.num_buffers * PGBUF_IOPAGE_BUFFER_SIZE;
+  if (fileio_is_direct_io_enabled ())
+    {
+      /* room to move the first io page to an aligned address */
+      alloc_size += FILEIO_DIRECT_IO_ALIGNMENT;
+    }
   if (!MEM_SIZE_IS_VALID (alloc_size))
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_PRM_BAD_VALUE, 1, "data_buffer_pages");
@@ -4953,8 +5234,21 @@ pgbuf_initialize_bcb_table (void)
 	}
       return ER_PRM_BAD_VALUE;
     }
-  pgbuf_Pool.iopage_table = (PGBUF_IOPAGE_BUFFER *) malloc ((size_t) alloc_size);
-  if (pgbuf_Pool.iopage_table == NULL)
+  pgbuf_Pool.iopage_table_size = (size_t) alloc_size;
+  if (prm_get_bool_value (PRM_ID_USE_HUGE_PAGES))
+    {
+      /* the page area is the biggest arena of the server, huge pages save most of its TLB entries */
+      pgbuf_Pool.iopage_area =
+	os_alloc_huge_pages (&pgbuf_Pool.iopage_table_size,
+			     (size_t) prm_get_integer_value (PRM_ID_HUGE_PAGE_SIZE_KB) * ONE_K,
+			     &pgbuf_Pool.iopage_table_huge_pages);
+    }
+  else
+    {
+      pgbuf_Pool.iopage_area = malloc ((size_t) alloc_size);
+      pgbuf_Pool.iopage_table_huge_pages = OS_HUGE_PAGES_NONE;
+    }
+  if (pgbuf_Pool.iopage_area == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) alloc_size);
       if (pgbuf_Pool.BCB_table != NULL)
@@ -4963,9 +5257,48 @@ pgbuf_initialize_bcb_table (void)
 	}
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
+  pgbuf_Pool.iopage_table = (PGBUF_IOPAGE_BUFFER *) pgbuf_Pool.iopage_area;
+  if (fileio_is_direct_io_enabled ())
+    {
+      pgbuf_Pool.iopage_table =
+	(PGBUF_IOPAGE_BUFFER *) ((char *) DB_ALIGN ((UINTPTR) pgbuf_Pool.iopage_area +
+						    offsetof (PGBUF_IOPAGE_BUFFER, iopage),
+						    FILEIO_DIRECT_IO_ALIGNMENT) - offsetof (PGBUF_IOPAGE_BUFFER, iopage));
+    }
 
-  /* initialize each entry of the buffer BCB table */
-  for (i = 0; i < pgbuf_Pool.num_buffers; i++)
+  pgbuf_Pool.num_numa_nodes = 1;
+  pgbuf_Pool.numa_first_bcb[0] = 0;
+  pgbuf_Pool.numa_first_bcb[1] = pgbuf_Pool.num_buffers;
+
+#if defined (SERVER_MODE) && defined (LINUX)
+  if (prm_get_bool_value (PRM_ID_PB_NUMA_PARTITIONS) && pgbuf_numa_initialize_bcb_table ())
+    {
+      return NO_ERROR;
+    }
+#endif /* SERVER_MODE && LINUX */
+
+  pgbuf_initialize_bcb_range (0, pgbuf_Pool.num_buffers, false);
+
+  return NO_ERROR;
+}
+
+/*
+ * pgbuf_initialize_bcb_range () - Initializes a range of the page buffer BCB table
+ *   return: void
+ *   first(in): first BCB of the range
+ *   last(in): end of the range (excluded)
+ *   touch_pages(in): also write the whole io pages
+ *
+ * Note: The BCBs of the range are linked for the invalid list of the range.
+ */
+static void
+pgbuf_initialize_bcb_range (int first, int last, bool touch_pages)
+{
+  PGBUF_BCB *bufptr;
+  PGBUF_IOPAGE_BUFFER *ioptr;
+  int i;
+
+  for (i = first; i < last; i++)
     {
       bufptr = PGBUF_FIND_BCB_PTR (i);
       pthread_mutex_init (&bufptr->mutex, NULL);
@@ -4983,7 +5316,7 @@ pgbuf_initialize_bcb_table (void)
       bufptr->hash_next = NULL;
       bufptr->prev_BCB = NULL;
 
-      if (i == (pgbuf_Pool.num_buffers - 1))
+      if (i == (last - 1))
 	{
 	  bufptr->next_BCB = NULL;
 	}
@@ -4995,13 +5328,21 @@ pgbuf_initialize_bcb_table (void)
       bufptr->flags = PGBUF_BCB_INIT_FLAGS;
       bufptr->count_fix_and_avoid_dealloc = 0;
       bufptr->hit_age = 0;
+      bufptr->version = 0;
       LSA_SET_NULL (&bufptr->oldest_unflush_lsa);
+      bufptr->residency = NULL;
+      bufptr->lru_enter_time = 0;
 
       bufptr->tick_lru3 = 0;
       bufptr->tick_lru_list = 0;
 
       /* link BCB and iopage buffer */
       ioptr = PGBUF_FIND_IOPAGE_PTR (i);
+      if (touch_pages)
+	{
+	  /* first touch allocates the memory on the node of this thread */
+	  memset (&ioptr->iopage, 0, IO_PAGESIZE);
+	}
 
       fileio_init_lsa_of_page (&ioptr->iopage, IO_PAGESIZE);
 
@@ -5011,7 +5352,7 @@ pgbuf_initialize_bcb_table (void)
 
       ioptr->iopage.prv.ptype = '\0';
       ioptr->iopage.prv.pflag = '\0';
-      ioptr->iopage.prv.p_reserve_1 = 0;
+      ioptr->iopage.prv.tde_dk_gen = 0;
       ioptr->iopage.prv.p_reserve_2 = 0;
       ioptr->iopage.prv.tde_nonce = 0;
 
@@ -5025,7 +5366,114 @@ pgbuf_initialize_bcb_table (void)
 #endif /* CUBRID_DEBUG */
     }
 
-  return NO_ERROR;
+}
+
+#if defined (SERVER_MODE) && defined (LINUX)
+/*
+ * pgbuf_numa_initialize_bcb_table () - Split the page buffer BCB table into NUMA partitions
+ *   return: true if the BCB table was initialized by partitions, false if there is no NUMA
+ *
+ * Note: The BCB table and the io pages of each partition are initialized by a thread bound to the CPUs of its node,
+ *       so the first touch allocates them on the node. The workers bound to a node (see thread_numa_placement) then
+ *       take the BCBs, and the private LRU lists of their transactions fill, from the partition of their node.
+ */
+static bool
+pgbuf_numa_initialize_bcb_table (void)
+{
+  int num_nodes, node;
+
+  num_nodes = (int) MIN (cubthread::get_numa_node_count (), (size_t) PGBUF_NUMA_MAX_NODES);
+
+  if (num_nodes < 2 || pgbuf_Pool.num_buffers / num_nodes < PGBUF_NUMA_MIN_BUFFERS_PER_NODE)
+    {
+      /* not worth it */
+      return false;
+    }
+
+  pgbuf_Pool.num_numa_nodes = num_nodes;
+  for (node = 0; node <= num_nodes; node++)
+    {
+      pgbuf_Pool.numa_first_bcb[node] = (int) (((INT64) pgbuf_Pool.num_buffers * node) / num_nodes);
+    }
+
+  // *INDENT-OFF*
+  std::thread node_threads[PGBUF_NUMA_MAX_NODES];
+  for (node = 0; node < num_nodes; node++)
+    {
+      node_threads[node] = std::thread ([node] ()
+        {
+          /* if it can't be bound, the partition is still initialized, only not on its node */
+          (void) cubthread::bind_thread_to_numa_node (node);
+          pgbuf_initialize_bcb_range (pgbuf_Pool.numa_first_bcb[node], pgbuf_Pool.numa_first_bcb[node + 1], true);
+        });
+    }
+  for (node = 0; node < num_nodes; node++)
+    {
+      node_threads[node].join ();
+    }
+  // *INDENT-ON*
+
+  return true;
+}
+#endif /* SERVER_MODE && LINUX */
+
+/*
+ * pgbuf_numa_get_local_node () - NUMA partition of the CPU the thread is running on
+ */
+STATIC_INLINE int
+pgbuf_numa_get_local_node (void)
+{
+#if defined (SERVER_MODE) && defined (LINUX)
+  if (pgbuf_Pool.num_numa_nodes > 1)
+    {
+      return (int) (cubthread::get_current_numa_node () % pgbuf_Pool.num_numa_nodes);
+    }
+#endif /* SERVER_MODE && LINUX */
+
+  return 0;
+}
+
+/*
+ * pgbuf_numa_get_bcb_node () - NUMA partition of a BCB
+ */
+STATIC_INLINE int
+pgbuf_numa_get_bcb_node (const PGBUF_BCB * bufptr)
+{
+  int bcb_index;
+  int node;
+
+  if (pgbuf_Pool.num_numa_nodes == 1)
+    {
+      return 0;
+    }
+
+  bcb_index = (int) (((const char *) bufptr - (const char *) pgbuf_Pool.BCB_table) / PGBUF_BCB_SIZEOF);
+  for (node = pgbuf_Pool.num_numa_nodes - 1; node > 0; node--)
+    {
+      if (bcb_index >= pgbuf_Pool.numa_first_bcb[node])
+	{
+	  break;
+	}
+    }
+
+  return node;
+}
+
+/*
+ * pgbuf_get_invalid_count () - number of BCBs in all invalid lists
+ */
+static int
+pgbuf_get_invalid_count (void)
+{
+  int count = 0;
+  int node;
+
+  for (node = 0; node < pgbuf_Pool.num_numa_nodes; node++)
+    {
+      count += pgbuf_Pool.buf_invalid_list[node].invalid_cnt;
+    }
+
+  return count;
 }
 
 /*
@@ -5271,10 +5719,16 @@ error_return:
 static int
 pgbuf_initialize_invalid_list (void)
 {
-  /* initialize the invalid BCB list */
-  pthread_mutex_init (&pgbuf_Pool.buf_invalid_list.invalid_mutex, NULL);
-  pgbuf_Pool.buf_invalid_list.invalid_top = PGBUF_FIND_BCB_PTR (0);
-  pgbuf_Pool.buf_invalid_list.invalid_cnt = pgbuf_Pool.num_buffers;
+  int node;
+
+  /* initialize the invalid BCB list of each range */
+  for (node = 0; node < pgbuf_Pool.num_numa_nodes; node++)
+    {
+      pthread_mutex_init (&pgbuf_Pool.buf_invalid_list[node].invalid_mutex, NULL);
+      pgbuf_Pool.buf_invalid_list[node].invalid_top = PGBUF_FIND_BCB_PTR (pgbuf_Pool.numa_first_bcb[node]);
+      pgbuf_Pool.buf_invalid_list[node].invalid_cnt =
+	pgbuf_Pool.numa_first_bcb[node + 1] - pgbuf_Pool.numa_first_bcb[node];
+    }
 
   return NO_ERROR;
 }
@@ -6213,6 +6667,11 @@ pgbuf_unlatch_bcb_upon_unfix (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, int h
 	    }
 	}
 
+      if (bufptr->latch_mode == PGBUF_LATCH_WRITE)
+	{
+	  /* the page may have changed; the new version must be visible before the latch is released */
+	  ATOMIC_INC_64 (&bufptr->version, 1);
+	}
       bufptr->latch_mode = PGBUF_NO_LATCH;
 #if defined(SERVER_MODE)
       pgbuf_wakeup_reader_writer (thread_p, bufptr);
@@ -6456,6 +6915,8 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
 	}
     }
 
+  thread_wait_event_begin_page (thread_p, THREAD_WAIT_PAGE_LATCH, &bufptr->vpid);
+
   if (request_mode == PGBUF_LATCH_FLUSH)
     {
       /* is it safe to use infinite wait instead of timed sleep? */
@@ -6486,6 +6947,7 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
 
 		  thrd_entry->next_wait_thrd = NULL;
 		  PGBUF_BCB_UNLOCK (bufptr);
+		  thread_wait_event_end (thread_p);
 		  return ER_FAILED;
 		}
 
@@ -6507,6 +6969,7 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
        */
       if (pgbuf_timed_sleep (thread_p, bufptr, cur_thrd_entry) != NO_ERROR)
 	{
+	  thread_wait_event_end (thread_p);
 	  return ER_FAILED;
 	}
 
@@ -6515,6 +6978,8 @@ pgbuf_block_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, PGBUF_LATCH_MODE r
       assert (0 < bufptr->fcnt);
 #endif
     }
+
+  thread_wait_event_end (thread_p);
 #endif /* SERVER_MODE */
 
   return NO_ERROR;
@@ -6893,9 +7358,16 @@ pgbuf_wakeup_reader_writer (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
  *   return: if success, BCB pointer, otherwise NULL
  *   hash_anchor(in):
  *   vpid(in):
+ *   hold_anchor_if_not_found(in): if the page is not found, search again holding the hash anchor mutex and keep it
+ *
+ * Note: The chain is first searched without the hash anchor mutex. The BCBs are never freed, so the search is safe;
+ *       a BCB found is validated once its mutex is held. A concurrent change may hide the page from this first
+ *       search, so a miss is only certain under the hash anchor mutex. Callers that only need a hint (fix if in
+ *       buffer, neighbor flush) don't ask for it and never touch the hash anchor mutex.
  */
 STATIC_INLINE PGBUF_BCB *
-pgbuf_search_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid)
+pgbuf_search_hash_chain (THREAD_ENTRY * thread_p, PGBUF_BUFFER_HASH * hash_anchor, const VPID * vpid,
+			 bool hold_anchor_if_not_found)
 {
   PGBUF_BCB *bufptr;
   int mbw_cnt;
@@ -6968,6 +7440,12 @@ one_phase:
 two_phase:
 #endif
 
+  if (!hold_anchor_if_not_found)
+    {
+      /* not found; a miss is not critical for the caller */
+      return NULL;
+    }
+
 try_again:
 
   if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_PB_HASH_ANCHOR))
@@ -7411,6 +7889,7 @@ pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid)
   int r = 0;
   PERF_STAT_ID pstat_cond_wait;
   bool high_priority = false;
+  TSC_TICKS victim_wait_start_tick;
 #endif /* SERVER_MODE */
 
   /* how it works: we need to free a bcb for new VPID.
@@ -7519,7 +7998,10 @@ pgbuf_allocate_bcb (THREAD_ENTRY * thread_p, const VPID * src_vpid)
 
       show_status->num_flusher_waiting_threads++;
 
+      tsc_getticks (&victim_wait_start_tick);
       r = thread_suspend_timeout_wakeup_and_unlock_entry (thread_p, &to, THREAD_ALLOC_BCB_SUSPENDED);
+      pgbuf_flush_feedback_add_time (&pgbuf_Pool.flush_feedback.victim_wait_usec,
+				     &pgbuf_Pool.flush_feedback.victim_wait_cnt, victim_wait_start_tick);
 
       show_status->num_flusher_waiting_threads--;
 
@@ -7621,8 +8103,13 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   PAGE_PTR pgptr = NULL;
   TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
   bool success;
+  bool is_zcache_dirty = false;
   int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   PGBUF_STATUS *show_status = &pgbuf_Pool.show_status[tran_index];
+  int error;
+  bool trace_io_wait = false;
+  TSC_TICKS start_tick, end_tick;
+  TSCTIMEVAL tv_diff;
 
 #if defined (ENABLE_SYSTEMTAP)
   bool monitored = false;
@@ -7687,6 +8174,7 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
   /* Currently, caller has one allocated BCB and is holding mutex */
 
   /* initialize the BCB */
+  ATOMIC_INC_64 (&bufptr->version, 1);
   bufptr->vpid = *vpid;
   assert (!pgbuf_bcb_avoid_victim (bufptr));
   bufptr->latch_mode = PGBUF_NO_LATCH;
@@ -7709,21 +8197,35 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	}
 #endif /* ENABLE_SYSTEMTAP */
 
+      trace_io_wait = thread_p != NULL && thread_p->event_stats.trace_slow_query;
+      if (trace_io_wait)
+	{
+	  tsc_getticks (&start_tick);
+	}
+
+      thread_wait_event_begin_page (thread_p, THREAD_WAIT_IO, vpid);
       if (dwb_read_page (thread_p, vpid, &bufptr->iopage_buffer->iopage, &success) != NO_ERROR)
 	{
 	  /* Should not happen */
 	  assert (false);
+	  thread_wait_event_end (thread_p);
 	  return NULL;
 	}
       else if (success == true)
 	{
-	  /* Nothing to do, copied from DWB */
+	  /* Copied from DWB, the compressed cache can only have the same image. */
+	  zcache_remove (vpid);
+	}
+      else if (zcache_get (thread_p, vpid, &bufptr->iopage_buffer->iopage, &is_zcache_dirty))
+	{
+	  /* Nothing to do, copied from compressed cache */
 	}
       else if (fileio_read (thread_p, fileio_get_volume_descriptor (vpid->volid), &bufptr->iopage_buffer->iopage,
 			    vpid->pageid, IO_PAGESIZE) == NULL)
 	{
 	  /* There was an error in reading the page. Clean the buffer... since it may have been corrupted */
 	  ASSERT_ERROR ();
+	  thread_wait_event_end (thread_p);
 
 	  /* bufptr->mutex will be released in following function. */
 	  pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
@@ -7746,13 +8248,29 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	  return NULL;
 	}
 
+      thread_wait_event_end (thread_p);
+
+      if (trace_io_wait)
+	{
+	  tsc_getticks (&end_tick);
+	  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+	  TSC_ADD_TIMEVAL (thread_p->event_stats.io_waits, tv_diff);
+	}
+
+      if (log_is_in_crash_recovery ())
+	{
+	  log_rv_restart_stats_add (LOG_RV_RESTART_DATA_PAGES_READ, 1);
+	}
+
       CAST_IOPGPTR_TO_PGPTR (pgptr, &bufptr->iopage_buffer->iopage);
       tde_algo = pgbuf_get_tde_algorithm (pgptr);
       if (tde_algo != TDE_ALGORITHM_NONE)
 	{
-	  if (tde_decrypt_data_page
-	      (&bufptr->iopage_buffer->iopage, tde_algo, pgbuf_is_temporary_volume (vpid->volid),
-	       &bufptr->iopage_buffer->iopage) != NO_ERROR)
+	  thread_wait_event_begin_page (thread_p, THREAD_WAIT_CIPHER, vpid);
+	  error = tde_decrypt_data_page (&bufptr->iopage_buffer->iopage, tde_algo,
+					 pgbuf_is_temporary_volume (vpid->volid), &bufptr->iopage_buffer->iopage);
+	  thread_wait_event_end (thread_p);
+	  if (error != NO_ERROR)
 	    {
 	      ASSERT_ERROR ();
 	      pgbuf_put_bcb_into_invalid_list (thread_p, bufptr);
@@ -7776,6 +8294,11 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 	      pgbuf_init_temp_page_lsa (&bufptr->iopage_buffer->iopage, IO_PAGESIZE);
 	      pgbuf_set_dirty_buffer_ptr (thread_p, bufptr);
 	    }
+	  else if (is_zcache_dirty)
+	    {
+	      /* the compressed cache had the only image of the page */
+	      pgbuf_set_dirty_buffer_ptr (thread_p, bufptr);
+	    }
 	}
 
 #if !defined (NDEBUG)
@@ -7802,6 +8325,9 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
     {
       /* the caller is holding bufptr->mutex */
 
+      /* the page content is new, drop the image the compressed cache may have */
+      zcache_remove (vpid);
+
 #if defined(CUBRID_DEBUG)
       pgbuf_scramble (&bufptr->iopage_buffer->iopage);
 #endif /* CUBRID_DEBUG */
@@ -7844,6 +8370,8 @@ pgbuf_claim_bcb_for_fix (THREAD_ENTRY * thread_p, const VPID * vpid, PAGE_FETCH_
 static int
 pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 {
+  VPID victim_vpid;
+
 #if defined(SERVER_MODE)
   if (thread_p == NULL)
     {
@@ -7868,9 +8396,14 @@ pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
     }
   assert (bufptr->latch_mode == PGBUF_NO_LATCH);
 
+  /* keep the page in compressed cache before it leaves page buffer, so a fix that misses page buffer finds it */
+  victim_vpid = bufptr->vpid;
+  pgbuf_zcache_put_victim (thread_p, bufptr);
+
   /* a safe victim */
   if (pgbuf_delete_from_hash_chain (thread_p, bufptr) != NO_ERROR)
     {
+      zcache_remove (&victim_vpid);
       return ER_FAILED;
     }
 
@@ -7883,6 +8416,51 @@ pgbuf_victimize_bcb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
   return NO_ERROR;
 }
 
+/*
+ * pgbuf_zcache_put_victim () - Store a victim page in compressed cache, as the page is on disk
+ *   return: void
+ *   bufptr(in): victim BCB
+ *
+ * Note: The caller is holding bufptr->mutex, the page cannot be fixed again before it leaves page buffer.
+ */
+static void
+pgbuf_zcache_put_victim (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
+{
+  char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  FILEIO_PAGE *iopage;
+  PAGE_PTR pgptr;
+  TDE_ALGORITHM tde_algo;
+
+  if (!zcache_is_enabled () || pgbuf_is_temporary_volume (bufptr->vpid.volid) || pgbuf_bcb_is_dirty (bufptr))
+    {
+      return;
+    }
+
+  CAST_BFPTR_TO_PGPTR (pgptr, bufptr);
+  tde_algo = pgbuf_get_tde_algorithm (pgptr);
+  if (tde_algo == TDE_ALGORITHM_NONE)
+    {
+      zcache_put (thread_p, &bufptr->vpid, &bufptr->iopage_buffer->iopage);
+      return;
+    }
+
+  /* encrypted pages stay encrypted in compressed cache */
+  iopage = (FILEIO_PAGE *) PTR_ALIGN (page_buf, MAX_ALIGNMENT);
+  if (tde_encrypt_data_page (&bufptr->iopage_buffer->iopage, tde_algo, false, iopage) != NO_ERROR)
+    {
+      er_clear ();
+      return;
+    }
+  if (iopage->prv.tde_dk_gen != bufptr->iopage_buffer->iopage.prv.tde_dk_gen)
+    {
+      /* the page on disk is of an old data key and still has to be rekeyed; an image of the current key would hide
+       * it from file_tde_rekey () */
+      return;
+    }
+
+  zcache_put (thread_p, &bufptr->vpid, iopage);
+}
+
 /*
  * pgbuf_invalidate_bcb () - Invalidates BCB
  *   return: NO_ERROR, or ER_code
@@ -8087,32 +8665,43 @@ static PGBUF_BCB *
 pgbuf_get_bcb_from_invalid_list (THREAD_ENTRY * thread_p)
 {
   PGBUF_BCB *bufptr;
+  PGBUF_INVALID_LIST *invalid_list = NULL;
+  int node, i;
 #if defined(SERVER_MODE)
   int rv;
 #endif /* SERVER_MODE */
 
-  /* check if invalid BCB list is empty (step 1) */
-  if (pgbuf_Pool.buf_invalid_list.invalid_top == NULL)
+  /* check if invalid BCB list is empty (step 1); prefer the list of the local NUMA node */
+  node = pgbuf_numa_get_local_node ();
+  for (i = 0; i < pgbuf_Pool.num_numa_nodes; i++, node = (node + 1) % pgbuf_Pool.num_numa_nodes)
+    {
+      if (pgbuf_Pool.buf_invalid_list[node].invalid_top != NULL)
+	{
+	  invalid_list = &pgbuf_Pool.buf_invalid_list[node];
+	  break;
+	}
+    }
+  if (invalid_list == NULL)
     {
       return NULL;
     }
 
-  rv = pthread_mutex_lock (&pgbuf_Pool.buf_invalid_list.invalid_mutex);
+  rv = pthread_mutex_lock (&invalid_list->invalid_mutex);
 
   /* check if invalid BCB list is empty (step 2) */
-  if (pgbuf_Pool.buf_invalid_list.invalid_top == NULL)
+  if (invalid_list->invalid_top == NULL)
     {
       /* invalid BCB list is empty */
-      pthread_mutex_unlock (&pgbuf_Pool.buf_invalid_list.invalid_mutex);
+      pthread_mutex_unlock (&invalid_list->invalid_mutex);
       return NULL;
     }
   else
     {
       /* invalid BCB list is not empty */
-      bufptr = pgbuf_Pool.buf_invalid_list.invalid_top;
-      pgbuf_Pool.buf_invalid_list.invalid_top = bufptr->next_BCB;
-      pgbuf_Pool.buf_invalid_list.invalid_cnt -= 1;
-      pthread_mutex_unlock (&pgbuf_Pool.buf_invalid_list.invalid_mutex);
+      bufptr = invalid_list->invalid_top;
+      invalid_list->invalid_top = bufptr->next_BCB;
+      invalid_list->invalid_cnt -= 1;
+      pthread_mutex_unlock (&invalid_list->invalid_mutex);
 
       PGBUF_BCB_LOCK (bufptr);
       bufptr->next_BCB = NULL;
@@ -8135,6 +8724,7 @@ pgbuf_get_bcb_from_invalid_list (THREAD_ENTRY * thread_p)
 static int
 pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 {
+  PGBUF_INVALID_LIST *invalid_list;
 #if defined(SERVER_MODE)
   int rv;
 #endif /* SERVER_MODE */
@@ -8146,12 +8736,15 @@ pgbuf_put_bcb_into_invalid_list (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
   pgbuf_bcb_change_zone (thread_p, bufptr, 0, PGBUF_INVALID_ZONE);
   pgbuf_bcb_check_and_reset_fix_and_avoid_dealloc (bufptr, ARG_FILE_LINE);
 
-  rv = pthread_mutex_lock (&pgbuf_Pool.buf_invalid_list.invalid_mutex);
-  bufptr->next_BCB = pgbuf_Pool.buf_invalid_list.invalid_top;
-  pgbuf_Pool.buf_invalid_list.invalid_top = bufptr;
-  pgbuf_Pool.buf_invalid_list.invalid_cnt += 1;
+  /* back to the invalid list of its NUMA node */
+  invalid_list = &pgbuf_Pool.buf_invalid_list[pgbuf_numa_get_bcb_node (bufptr)];
+
+  rv = pthread_mutex_lock (&invalid_list->invalid_mutex);
+  bufptr->next_BCB = invalid_list->invalid_top;
+  invalid_list->invalid_top = bufptr;
+  invalid_list->invalid_cnt += 1;
   PGBUF_BCB_UNLOCK (bufptr);
-  pthread_mutex_unlock (&pgbuf_Pool.buf_invalid_list.invalid_mutex);
+  pthread_mutex_unlock (&invalid_list->invalid_mutex);
 
   return NO_ERROR;
 }
@@ -9905,7 +10498,7 @@ pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_p
   QUERY_ID query_id = NULL_QUERY_ID;
   bool monitored = false;
 #endif /* ENABLE_SYSTEMTAP */
-  bool was_dirty = false, uses_dwb;
+  bool was_dirty = false, uses_dwb, uses_atomic_write;
   DWB_SLOT *dwb_slot = NULL;
   LOG_LSA lsa;
   FILEIO_WRITE_MODE write_mode;
@@ -9913,6 +10506,9 @@ pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_p
   TDE_ALGORITHM tde_algo = TDE_ALGORITHM_NONE;
   int tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
   PGBUF_STATUS *show_status = &pgbuf_Pool.show_status[tran_index];
+#if defined (SERVER_MODE)
+  TSC_TICKS write_start_tick;
+#endif /* SERVER_MODE */
 
 
   PGBUF_BCB_CHECK_OWN (bufptr);
@@ -9966,6 +10562,12 @@ pgbuf_bcb_flush_with_wal (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr, bool is_p
   was_dirty = pgbuf_bcb_mark_is_flushing (thread_p, bufptr);
 
   uses_dwb = dwb_is_created () && !is_temp;
+  /* a page the device writes untorn needs no double write; the home location is written directly */
+  uses_atomic_write = uses_dwb && fileio_is_volume_atomic_write (bufptr->vpid.volid);
+  if (uses_atomic_write)
+    {
+      uses_dwb = false;
+    }
 
 start_copy_page:
   iopage = (FILEIO_PAGE *) PTR_ALIGN (page_buf, MAX_ALIGNMENT);
@@ -9973,12 +10575,16 @@ start_copy_page:
   tde_algo = pgbuf_get_tde_algorithm (pgptr);
   if (tde_algo != TDE_ALGORITHM_NONE)
     {
+      thread_wait_event_begin_page (thread_p, THREAD_WAIT_CIPHER, &bufptr->vpid);
       error = tde_encrypt_data_page (&bufptr->iopage_buffer->iopage, tde_algo, is_temp, iopage);
+      thread_wait_event_end (thread_p);
       if (error != NO_ERROR)
 	{
 	  ASSERT_ERROR ();
 	  return error;
 	}
+      /* keep the generation of the data key which the page on disk is encrypted with, see file_tde_rekey () */
+      bufptr->iopage_buffer->iopage.prv.tde_dk_gen = iopage->prv.tde_dk_gen;
     }
   else
     {
@@ -10006,6 +10612,12 @@ copy_unflushed_lsa:
   PGBUF_BCB_UNLOCK (bufptr);
   *is_bcb_locked = false;
 
+  if (!is_temp)
+    {
+      /* the next incremental backups read it */
+      pgtrack_set_changed (&bufptr->vpid);
+    }
+
   if (!LSA_ISNULL (&oldest_unflush_lsa))
     {
       /* confirm WAL protocol */
@@ -10030,6 +10642,12 @@ copy_unflushed_lsa:
     }
 #endif /* ENABLE_SYSTEMTAP */
 
+#if defined (SERVER_MODE)
+  tsc_getticks (&write_start_tick);
+#endif /* SERVER_MODE */
+
+  thread_wait_event_begin_page (thread_p, THREAD_WAIT_IO, &bufptr->vpid);
+
   /* Activating/deactivating DWB while the server is alive, needs additional work. For now, we don't care about
    * this case, we can use it to test performance differences.
    */
@@ -10048,6 +10666,26 @@ copy_unflushed_lsa:
 	    }
 	}
     }
+  else if (uses_atomic_write)
+    {
+      show_status->num_pages_written++;
+
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOWRITES);
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_ATOMIC_IOWRITES);
+      if (fileio_write_atomic (thread_p, bufptr->vpid.volid, iopage, bufptr->vpid.pageid, IO_PAGESIZE) == NULL)
+	{
+	  if (!fileio_is_volume_atomic_write (bufptr->vpid.volid))
+	    {
+	      /* The device refused the atomic write, try again with DWB. */
+	      uses_atomic_write = false;
+	      uses_dwb = true;
+	      PGBUF_BCB_LOCK (bufptr);
+	      *is_bcb_locked = true;
+	      goto start_copy_page;
+	    }
+	  error = ER_FAILED;
+	}
+    }
   else
     {
       show_status->num_pages_written++;
@@ -10055,14 +10693,23 @@ copy_unflushed_lsa:
       /* Record number of writes in statistics */
       write_mode = (dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE);
 
-      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOWRITES);
-      if (fileio_write (thread_p, fileio_get_volume_descriptor (bufptr->vpid.volid), iopage, bufptr->vpid.pageid,
-			IO_PAGESIZE, write_mode) == NULL)
+      if (is_temp && zcache_put_temp (thread_p, &bufptr->vpid, iopage))
 	{
-	  error = ER_FAILED;
+	  /* kept in compressed cache; written only when the cache drops it */
+	}
+      else
+	{
+	  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOWRITES);
+	  if (fileio_write (thread_p, fileio_get_volume_descriptor (bufptr->vpid.volid), iopage, bufptr->vpid.pageid,
+			    IO_PAGESIZE, write_mode) == NULL)
+	    {
+	      error = ER_FAILED;
+	    }
 	}
     }
 
+  thread_wait_event_end (thread_p);
+
 #if defined(ENABLE_SYSTEMTAP)
   if (monitored == true)
     {
@@ -10070,6 +10717,11 @@ copy_unflushed_lsa:
     }
 #endif /* ENABLE_SYSTEMTAP */
 
+#if defined (SERVER_MODE)
+  pgbuf_flush_feedback_add_time (&pgbuf_Pool.flush_feedback.write_usec, &pgbuf_Pool.flush_feedback.write_cnt,
+				 write_start_tick);
+#endif /* SERVER_MODE */
+
   if (error != NO_ERROR)
     {
       PGBUF_BCB_LOCK (bufptr);
@@ -10429,7 +11081,6 @@ pgbuf_check_bcb_page_vpid (PGBUF_BCB * bufptr, bool maybe_deallocated)
 	      || (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
 		  && bufptr->vpid.volid == bufptr->iopage_buffer->iopage.prv.volid));
 
-      assert (bufptr->iopage_buffer->iopage.prv.p_reserve_1 == 0);
       assert (bufptr->iopage_buffer->iopage.prv.p_reserve_2 == 0);
 
       return (bufptr->vpid.pageid == bufptr->iopage_buffer->iopage.prv.pageid
@@ -10464,7 +11115,7 @@ pgbuf_scramble (FILEIO_PAGE * iopage)
 
   iopage->prv.ptype = '\0';
   iopage->prv.pflag = '\0';
-  iopage->prv.p_reserve_1 = 0;
+  iopage->prv.tde_dk_gen = 0;
   iopage->prv.p_reserve_2 = 0;
   iopage->prv.tde_nonce = 0;
 }
@@ -10824,6 +11475,9 @@ pgbuf_set_dirty_buffer_ptr (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr)
 
   pgbuf_bcb_set_dirty (thread_p, bufptr);
 
+  /* the zones of heap scans computed from the page are stale now */
+  heap_zone_map_set_changed (&bufptr->vpid);
+
   holder = pgbuf_find_thrd_holder (thread_p, bufptr);
   assert (bufptr->latch_mode == PGBUF_LATCH_WRITE);
   assert (holder != NULL);
@@ -10991,6 +11645,7 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
   int written_pages;
   int abort_reason;
   bool was_page_flushed = false;
+  int neighbor_pages = pgbuf_get_neighbor_flush_pages ();
 #if defined(ENABLE_SYSTEMTAP)
   QUERY_ID query_id = -1;
   bool monitored = false;
@@ -11022,7 +11677,7 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
   forward = true;
   search_nondirty = false;
   abort_reason = 0;
-  for (i = 1; i < PGBUF_NEIGHBOR_PAGES;)
+  for (i = 1; i < neighbor_pages;)
     {
       if (forward == true)
 	{
@@ -11057,11 +11712,10 @@ pgbuf_flush_page_and_neighbors_fb (THREAD_ENTRY * thread_p, PGBUF_BCB * bufptr,
 
       hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (&vpid)];
 
-      bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, &vpid);
+      bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, &vpid, false);
       if (bufptr == NULL)
 	{
 	  /* Page not found: change direction or abandon batch */
-	  pthread_mutex_unlock (&hash_anchor->hash_mutex);
 	  if (search_nondirty == true)
 	    {
 	      if (forward == false)
@@ -12177,7 +12831,7 @@ exit:
 	{
 	  /* we need to remove prevent deallocate. */
 	  PGBUF_BUFFER_HASH *hash_anchor = &pgbuf_Pool.buf_hash_table[PGBUF_HASH_VALUE (&ordered_holders_info[i].vpid)];
-	  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, &ordered_holders_info[i].vpid);
+	  bufptr = pgbuf_search_hash_chain (thread_p, hash_anchor, &ordered_holders_info[i].vpid, true);
 
 	  if (bufptr == NULL)
 	    {
@@ -12930,6 +13584,8 @@ pgbuf_compute_lru_vict_target (float *lru_sum_flush_priority)
 
   int total_prv_target = 0;
   int this_prv_target = 0;
+  /* a boosted flush targets lists further below their quota */
+  float target_quota_ratio = PGBUF_LRU_VICT_TARGET_QUOTA_RATIO / pgbuf_get_flush_boost ();
 
   PGBUF_LRU_LIST *lru_list;
 
@@ -12955,7 +13611,7 @@ pgbuf_compute_lru_vict_target (float *lru_sum_flush_priority)
        * (I tried), because you may find yourself in the peculiar case where quota's are on par with list size, while
        * shared are right below minimum desired size... and flush will not find anything.
        */
-      this_prv_target = PGBUF_LRU_LIST_COUNT (lru_list) - (int) (lru_list->quota * 0.9);
+      this_prv_target = PGBUF_LRU_LIST_COUNT (lru_list) - (int) (lru_list->quota * target_quota_ratio);
       this_prv_target = MIN (this_prv_target, lru_list->count_lru3);
       if (this_prv_target > 0)
 	{
@@ -12975,7 +13631,7 @@ pgbuf_compute_lru_vict_target (float *lru_sum_flush_priority)
 	   * private bcb's must be less than 90% of buffer. that means shared bcb's have to be 10% or more of buffer.
 	   * PGBUF_MIN_SHARED_LIST_ADJUST_SIZE is currently set to 50, which is 5% to targeted 1k shared list size.
 	   * we shouldn't be here unless I messed up the calculus. */
-	  if (pgbuf_Pool.buf_invalid_list.invalid_cnt > 0)
+	  if (pgbuf_get_invalid_count () > 0)
 	    {
 	      /* This is not really an interesting case.
 	       * Probably both shared and private are small and most of buffers in invalid list.
@@ -13018,7 +13674,7 @@ pgbuf_compute_lru_vict_target (float *lru_sum_flush_priority)
 	      else
 		{
 		  /* use bcb's over 90% of quota as flush target */
-		  this_prv_target = PGBUF_LRU_LIST_COUNT (lru_list) - (int) (lru_list->quota * 0.9);
+		  this_prv_target = PGBUF_LRU_LIST_COUNT (lru_list) - (int) (lru_list->quota * target_quota_ratio);
 		  this_prv_target = MIN (this_prv_target, lru_list->count_lru3);
 		}
 	      if (this_prv_target > 0)
@@ -13223,7 +13879,7 @@ pgbuf_adjust_quotas (THREAD_ENTRY * thread_p)
     {
       /* compute all_private_quota in number of bcb's */
       all_private_quota =
-	(int) ((pgbuf_Pool.num_buffers - pgbuf_Pool.buf_invalid_list.invalid_cnt) * quota->private_pages_ratio);
+	(int) ((pgbuf_Pool.num_buffers - pgbuf_get_invalid_count ()) * quota->private_pages_ratio);
 
       /* split private bcb's quota's based on activity */
       for (i = PGBUF_SHARED_LRU_COUNT; i < PGBUF_TOTAL_LRU_COUNT; i++)
@@ -13538,6 +14194,16 @@ pgbuf_has_prevent_dealloc (PAGE_PTR pgptr)
 #endif
 }
 
+/*
+ * pgbuf_get_huge_pages_type () - how the page area of the page buffer is backed
+ *   return: OS_HUGE_PAGES_TYPE
+ */
+int
+pgbuf_get_huge_pages_type (void)
+{
+  return (int) pgbuf_Pool.iopage_table_huge_pages;
+}
+
 void
 pgbuf_peek_stats (UINT64 * fixed_cnt, UINT64 * dirty_cnt, UINT64 * lru1_cnt, UINT64 * lru2_cnt, UINT64 * lru3_cnt,
 		  UINT64 * victim_candidates, UINT64 * avoid_dealloc_cnt, UINT64 * avoid_victim_cnt,
@@ -13678,6 +14344,126 @@ pgbuf_flush_control_from_dirty_ratio (void)
   return adapt_flush_rate;
 }
 
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_flush_feedback_add_time () - Add the time elapsed since start_tick to a flush feedback counter.
+ *
+ * return          : void
+ * time_usec (in)  : accumulated time
+ * count (in)      : accumulated count
+ * start_tick (in) : start of measured event
+ */
+STATIC_INLINE void
+pgbuf_flush_feedback_add_time (INT64 * time_usec, int *count, TSC_TICKS start_tick)
+{
+  TSC_TICKS end_tick;
+
+  tsc_getticks (&end_tick);
+  ATOMIC_INC_64 (time_usec, (INT64) tsc_elapsed_utime (end_tick, start_tick));
+  ATOMIC_INC_32 (count, 1);
+}
+
+/*
+ * pgbuf_flush_feedback_adjust () - Adjust the victim flush boost based on direct victim waits and page write latency
+ *				    observed since last adjustment.
+ *
+ * return : void
+ *
+ * note: threads stalling on direct victims mean that flush is behind, even if the dirty ratio still looks healthy.
+ *	 the boost is then increased multiplicatively, and it decays once the waits are back under target. if page
+ *	 writes are much slower than usual, the device is saturated and flushing harder won't produce victims faster;
+ *	 the boost is held.
+ */
+static void
+pgbuf_flush_feedback_adjust (void)
+{
+  PGBUF_FLUSH_FEEDBACK *feedback = &pgbuf_Pool.flush_feedback;
+  INT64 victim_wait_usec, write_usec;
+  int victim_wait_cnt, write_cnt;
+  INT64 wait_target_usec;
+  float avg_write_usec;
+  bool is_saturated = false;
+
+  victim_wait_usec = ATOMIC_TAS_64 (&feedback->victim_wait_usec, 0);
+  victim_wait_cnt = ATOMIC_TAS_32 (&feedback->victim_wait_cnt, 0);
+  write_usec = ATOMIC_TAS_64 (&feedback->write_usec, 0);
+  write_cnt = ATOMIC_TAS_32 (&feedback->write_cnt, 0);
+
+  if (!prm_get_bool_value (PRM_ID_PB_FLUSH_FEEDBACK))
+    {
+      feedback->boost = 1.0f;
+      return;
+    }
+
+  if (write_cnt > 0)
+    {
+      avg_write_usec = (float) write_usec / (float) write_cnt;
+      if (feedback->avg_write_usec == 0.0f)
+	{
+	  feedback->avg_write_usec = avg_write_usec;
+	}
+      else
+	{
+	  is_saturated = avg_write_usec > feedback->avg_write_usec * PGBUF_FLUSH_FEEDBACK_SATURATED_MULT;
+	  feedback->avg_write_usec += (avg_write_usec - feedback->avg_write_usec) * PGBUF_FLUSH_FEEDBACK_LATENCY_WEIGHT;
+	}
+    }
+
+  wait_target_usec = prm_get_integer_value (PRM_ID_PB_FLUSH_FEEDBACK_VICTIM_WAIT_USECS);
+  if (victim_wait_cnt > 0 && victim_wait_usec > wait_target_usec * victim_wait_cnt)
+    {
+      if (!is_saturated)
+	{
+	  feedback->boost = MIN (feedback->boost * PGBUF_FLUSH_FEEDBACK_BOOST_UP, PGBUF_FLUSH_FEEDBACK_MAX_BOOST);
+	}
+    }
+  else
+    {
+      feedback->boost = MAX (feedback->boost * PGBUF_FLUSH_FEEDBACK_BOOST_DOWN, 1.0f);
+    }
+}
+#endif /* SERVER_MODE */
+
+/*
+ * pgbuf_get_flush_boost () - Get the victim flush boost of flush feedback controller.
+ *
+ * return : flush boost, 1 if no boost
+ */
+STATIC_INLINE float
+pgbuf_get_flush_boost (void)
+{
+#if defined (SERVER_MODE)
+  return pgbuf_Pool.flush_feedback.boost;
+#else /* !SERVER_MODE */
+  return 1.0f;
+#endif /* !SERVER_MODE */
+}
+
+/*
+ * pgbuf_get_flush_feedback_boost () - Get the victim flush boost in percents, for statistics.
+ *
+ * return : flush boost in percents
+ */
+int
+pgbuf_get_flush_feedback_boost (void)
+{
+  return (int) (pgbuf_get_flush_boost () * 100);
+}
+
+/*
+ * pgbuf_get_neighbor_flush_pages () - Get the number of pages to flush with their neighbors.
+ *
+ * return : neighbor flush width
+ *
+ * note: the width shrinks when flush is boosted. each neighbor flushed with a victim delays the next victims, and the
+ *	 threads stalling on direct victims need those first.
+ */
+STATIC_INLINE int
+pgbuf_get_neighbor_flush_pages (void)
+{
+  return MAX (1, (int) (PGBUF_NEIGHBOR_PAGES / pgbuf_get_flush_boost ()));
+}
+
 /*
  * pgbuf_rv_flush_page () - Flush page during recovery. Some changes must be flushed immediately to provide
  *			    consistency, in case server crashes again during recovery.
@@ -14586,6 +15372,7 @@ pgbuf_bcb_update_flags (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int set_flags,
   int old_flags;
   int new_flags;
   bool old_dirty, new_dirty;
+  PGBUF_RESIDENCY *residency;
 
   /* sanity checks */
   assert (bcb != NULL);
@@ -14596,6 +15383,8 @@ pgbuf_bcb_update_flags (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int set_flags,
   do
     {
       old_flags = bcb->flags;
+      /* residency is changed only outside lru zones; it is the one of old_flags if they are in lru zones. */
+      residency = bcb->residency;
       new_flags = old_flags | set_flags;
       new_flags = new_flags & (~clear_flags);
 
@@ -14640,16 +15429,121 @@ pgbuf_bcb_update_flags (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int set_flags,
     {
       /* cleared dirty flag. */
       ATOMIC_INC_64 (&pgbuf_Pool.monitor.dirties_cnt, -1);
+      if (old_flags & PGBUF_LRU_ZONE_MASK)
+	{
+	  ATOMIC_INC_32 (&residency->dirty_cnt, -1);
+	}
     }
   else if (!old_dirty && new_dirty)
     {
       /* added dirty flag */
       ATOMIC_INC_64 (&pgbuf_Pool.monitor.dirties_cnt, 1);
+      if (old_flags & PGBUF_LRU_ZONE_MASK)
+	{
+	  ATOMIC_INC_32 (&residency->dirty_cnt, 1);
+	}
     }
 
   assert (pgbuf_Pool.monitor.dirties_cnt >= 0 && pgbuf_Pool.monitor.dirties_cnt <= pgbuf_Pool.num_buffers);
 }
 
+/*
+ * pgbuf_bcb_set_residency () - set the residency counters of a bcb that enters lru lists
+ *
+ * return   : void
+ * bcb (in) : bcb
+ */
+STATIC_INLINE void
+pgbuf_bcb_set_residency (PGBUF_BCB * bcb)
+{
+  int ptype = bcb->iopage_buffer->iopage.prv.ptype;
+
+  if (ptype > PAGE_LAST)
+    {
+      /* page was not initialized yet */
+      ptype = PAGE_UNKNOWN;
+    }
+
+  bcb->residency = &pgbuf_Pool.monitor.residency[pgbuf_is_temporary_volume (bcb->vpid.volid) ? 1 : 0][ptype];
+  bcb->lru_enter_time = (INT64) time (NULL);
+}
+
+/*
+ * pgbuf_bcb_residency_add () - account bcb in the residency counters of its new lru zone
+ *
+ * return          : void
+ * bcb (in)        : bcb
+ * flags (in)      : bcb flags with the new zone
+ * enters_lru (in) : true if bcb was not in lru lists
+ */
+STATIC_INLINE void
+pgbuf_bcb_residency_add (PGBUF_BCB * bcb, int flags, bool enters_lru)
+{
+  PGBUF_RESIDENCY *residency = bcb->residency;
+
+  switch (PGBUF_GET_ZONE (flags))
+    {
+    case PGBUF_LRU_1_ZONE:
+      ATOMIC_INC_32 (&residency->lru1_cnt, 1);
+      break;
+    case PGBUF_LRU_2_ZONE:
+      ATOMIC_INC_32 (&residency->lru2_cnt, 1);
+      break;
+    case PGBUF_LRU_3_ZONE:
+      ATOMIC_INC_32 (&residency->lru3_cnt, 1);
+      break;
+    default:
+      assert (false);
+      return;
+    }
+  if (flags & PGBUF_BCB_DIRTY_FLAG)
+    {
+      ATOMIC_INC_32 (&residency->dirty_cnt, 1);
+    }
+  if (enters_lru)
+    {
+      ATOMIC_INC_64 (&residency->sum_lru_enter_time, bcb->lru_enter_time);
+    }
+}
+
+/*
+ * pgbuf_bcb_residency_remove () - remove bcb from the residency counters of its old lru zone
+ *
+ * return          : void
+ * bcb (in)        : bcb
+ * flags (in)      : bcb flags with the old zone
+ * leaves_lru (in) : true if bcb is no longer in lru lists
+ */
+STATIC_INLINE void
+pgbuf_bcb_residency_remove (PGBUF_BCB * bcb, int flags, bool leaves_lru)
+{
+  PGBUF_RESIDENCY *residency = bcb->residency;
+
+  switch (PGBUF_GET_ZONE (flags))
+    {
+    case PGBUF_LRU_1_ZONE:
+      ATOMIC_INC_32 (&residency->lru1_cnt, -1);
+      break;
+    case PGBUF_LRU_2_ZONE:
+      ATOMIC_INC_32 (&residency->lru2_cnt, -1);
+      break;
+    case PGBUF_LRU_3_ZONE:
+      ATOMIC_INC_32 (&residency->lru3_cnt, -1);
+      break;
+    default:
+      assert (false);
+      return;
+    }
+  if (flags & PGBUF_BCB_DIRTY_FLAG)
+    {
+      ATOMIC_INC_32 (&residency->dirty_cnt, -1);
+    }
+  if (leaves_lru)
+    {
+      ATOMIC_INC_64 (&residency->sum_lru_enter_time, -bcb->lru_enter_time);
+    }
+}
+
 /*
  * pgbuf_bcb_change_zone () - change the zone and lru index of bcb, but keep the bcb flags. also handles the zone
  *                            counters, victim counter and victim hint for lru lists.
@@ -14694,6 +15588,12 @@ pgbuf_bcb_change_zone (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int new_lru_idx
   assert (new_lru_idx == 0 || new_zone == PGBUF_LRU_1_ZONE || new_zone == PGBUF_LRU_2_ZONE
 	  || new_zone == PGBUF_LRU_3_ZONE);
 
+  if ((bcb->flags & PGBUF_LRU_ZONE_MASK) == 0 && (new_zone & PGBUF_LRU_ZONE_MASK))
+    {
+      /* bcb enters lru lists. set its residency before the zone change makes it visible to pgbuf_bcb_update_flags. */
+      pgbuf_bcb_set_residency (bcb);
+    }
+
   /* update bcb->flags. make sure we are only changing the values for zone and lru index, but we preserve the flags. */
   do
     {
@@ -14726,6 +15626,8 @@ pgbuf_bcb_change_zone (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int new_lru_idx
 	  ATOMIC_INC_32 (&pgbuf_Pool.monitor.lru_shared_pgs_cnt, -1);
 	}
 
+      pgbuf_bcb_residency_remove (bcb, old_flags, (new_zone & PGBUF_LRU_ZONE_MASK) == 0);
+
       switch (PGBUF_GET_ZONE (old_flags))
 	{
 	case PGBUF_LRU_1_ZONE:
@@ -14756,6 +15658,8 @@ pgbuf_bcb_change_zone (THREAD_ENTRY * thread_p, PGBUF_BCB * bcb, int new_lru_idx
 	  ATOMIC_INC_32 (&pgbuf_Pool.monitor.lru_shared_pgs_cnt, 1);
 	}
 
+      pgbuf_bcb_residency_add (bcb, new_flags, (old_flags & PGBUF_LRU_ZONE_MASK) == 0);
+
       switch (new_zone)
 	{
 	case PGBUF_LRU_1_ZONE:
@@ -15771,8 +16675,9 @@ pgbuf_get_page_flush_interval (bool & is_timed_wait, cubthread::delta_time & per
   if (page_flush_interval_msecs > 0)
     {
       // if page_flush_interval_msecs > 0 (zero) then loop for fixed interval
+      // shorten the interval when flush is boosted
       is_timed_wait = true;
-      period = std::chrono::milliseconds (page_flush_interval_msecs);
+      period = std::chrono::milliseconds (MAX (1, (int) (page_flush_interval_msecs / pgbuf_get_flush_boost ())));
     }
   else
     {
@@ -15797,6 +16702,9 @@ pgbuf_page_maintenance_execute (cubthread::entry & thread_ref)
 
   /* search lists and assign victims directly */
   pgbuf_direct_victims_maintenance (&thread_ref);
+
+  /* adapt victim flush to the waits on direct victims */
+  pgbuf_flush_feedback_adjust ();
 }
 #endif /* SERVER_MODE */
 
@@ -15879,27 +16787,354 @@ pgbuf_page_post_flush_execute (cubthread::entry & thread_ref)
 #endif /* SERVER_MODE */
 
 #if defined (SERVER_MODE)
-// class pgbuf_flush_control_daemon_task
-//
-//  description:
-//    flush control daemon task
-//
-class pgbuf_flush_control_daemon_task : public cubthread::entry_task
+/*
+ * pgbuf_page_read_ahead_execute () - read the requested pages into the page buffer
+ *
+ * The pages are only fixed and unfixed, so they are in the buffer when the scan reaches them. Pages which can't be
+ * read right away (deallocated or latched exclusively) are skipped, read-ahead is only a hint.
+ */
+static void
+pgbuf_page_read_ahead_execute (cubthread::entry & thread_ref)
 {
-  private:
-    struct timeval m_end;
-    bool m_first_run;
+  VPID vpid;
+  PAGE_PTR pgptr;
 
-  public:
-    pgbuf_flush_control_daemon_task ()
-      : m_end ({0, 0})
-      , m_first_run (true)
+  if (!BO_IS_SERVER_RESTARTED ())
     {
+      // wait for boot to finish
+      return;
     }
 
-    int initialize ()
+  while (pgbuf_Pool.read_ahead_vpids->consume (vpid))
     {
-      return fileio_flush_control_initialize ();
+      if (pgbuf_read_ahead_page (&thread_ref, &vpid))
+	{
+	  perfmon_inc_stat (&thread_ref, PSTAT_PB_NUM_READ_AHEAD_PAGES);
+	}
+    }
+}
+
+/*
+ * pgbuf_read_ahead_page () - read a page into the page buffer, if it is not there already
+ *   return: true if the page was read, false otherwise
+ *   vpid(in): page identifier
+ *
+ * Note: Pages which can't be read right away (deallocated or latched exclusively) are skipped.
+ */
+static bool
+pgbuf_read_ahead_page (THREAD_ENTRY * thread_p, const VPID * vpid)
+{
+  PAGE_PTR pgptr;
+
+  if (pgbuf_is_valid_page (thread_p, vpid, true, NULL, NULL) != DISK_VALID)
+    {
+      /* not reserved or beyond the end of the volume */
+      er_clear ();
+      return false;
+    }
+
+  pgptr = pgbuf_fix (thread_p, vpid, OLD_PAGE_IF_IN_BUFFER, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+  if (pgptr != NULL)
+    {
+      /* already in buffer */
+      pgbuf_unfix_and_init (thread_p, pgptr);
+      return false;
+    }
+
+  pgptr = pgbuf_fix (thread_p, vpid, OLD_PAGE_MAYBE_DEALLOCATED, PGBUF_LATCH_READ, PGBUF_CONDITIONAL_LATCH);
+  er_clear ();
+  if (pgptr == NULL)
+    {
+      return false;
+    }
+
+  pgbuf_unfix_and_init (thread_p, pgptr);
+  return true;
+}
+
+/*
+ * pgbuf_warmup_max_pages () - maximum number of pages saved to and restored from the warm-up file
+ */
+static int
+pgbuf_warmup_max_pages (void)
+{
+  return (int) (pgbuf_Pool.num_buffers * prm_get_float_value (PRM_ID_PB_WARMUP_RATIO));
+}
+
+/*
+ * pgbuf_warmup_compare_hotness () - compare warm-up entries, hottest first
+ */
+static int
+pgbuf_warmup_compare_hotness (const void *p1, const void *p2)
+{
+  const PGBUF_WARMUP_ENTRY *entry1 = (const PGBUF_WARMUP_ENTRY *) p1;
+  const PGBUF_WARMUP_ENTRY *entry2 = (const PGBUF_WARMUP_ENTRY *) p2;
+
+  return entry2->hotness - entry1->hotness;
+}
+
+/*
+ * pgbuf_warmup_dump () - save the VPIDs of the hottest pages of the buffer to the warm-up file
+ *   return: error code
+ *
+ * Note: The BCBs are read without their mutex. A BCB that changes meanwhile only makes the snapshot a worse hint.
+ *       The file is written aside and renamed, so a crash never leaves a truncated warm-up file.
+ */
+static int
+pgbuf_warmup_dump (THREAD_ENTRY * thread_p)
+{
+  PGBUF_WARMUP_ENTRY *entries = NULL;
+  PGBUF_WARMUP_FILE_HEADER header;
+  PGBUF_BCB *bufptr;
+  VPID vpid;
+  char warmup_name[PATH_MAX];
+  char tmp_name[PATH_MAX];
+  FILE *fp;
+  int max_pages, count = 0, zone_rank, hotness, i;
+  size_t size;
+  int error_code = NO_ERROR;
+
+  max_pages = pgbuf_warmup_max_pages ();
+  if (max_pages <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  size = pgbuf_Pool.num_buffers * sizeof (PGBUF_WARMUP_ENTRY);
+  entries = (PGBUF_WARMUP_ENTRY *) malloc (size);
+  if (entries == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = 0; i < pgbuf_Pool.num_buffers; i++)
+    {
+      bufptr = PGBUF_FIND_BCB_PTR (i);
+      switch (PGBUF_GET_ZONE (bufptr->flags))
+	{
+	case PGBUF_LRU_1_ZONE:
+	  zone_rank = 3;
+	  break;
+	case PGBUF_LRU_2_ZONE:
+	  zone_rank = 2;
+	  break;
+	case PGBUF_LRU_3_ZONE:
+	  zone_rank = 1;
+	  break;
+	default:
+	  /* not in use */
+	  continue;
+	}
+
+      vpid = bufptr->vpid;
+      if (VPID_ISNULL (&vpid) || pgbuf_is_temp_lsa (bufptr->iopage_buffer->iopage.prv.lsa)
+	  || pgbuf_is_temporary_volume (vpid.volid))
+	{
+	  /* temporary pages don't survive a restart */
+	  continue;
+	}
+
+      hotness = (bufptr->count_fix_and_avoid_dealloc >> PGBUF_BCB_COUNT_FIX_SHIFT_BITS) + bufptr->fcnt;
+      entries[count].vpid = vpid;
+      entries[count].hotness = zone_rank * PGBUF_WARMUP_ZONE_WEIGHT + MIN (hotness, PGBUF_WARMUP_ZONE_WEIGHT - 1);
+      count++;
+    }
+
+  if (count > max_pages)
+    {
+      qsort (entries, count, sizeof (PGBUF_WARMUP_ENTRY), pgbuf_warmup_compare_hotness);
+      count = max_pages;
+    }
+  /* saved in VPID order, so they are read sequentially */
+  qsort (entries, count, sizeof (PGBUF_WARMUP_ENTRY), pgbuf_compare_vpid);
+
+  fileio_make_pgbuf_warmup_name (warmup_name, boot_db_full_name ());
+  snprintf (tmp_name, sizeof (tmp_name), "%s.tmp", warmup_name);
+
+  fp = fopen (tmp_name, "wb");
+  if (fp == NULL)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, tmp_name);
+      error_code = ER_IO_WRITE;
+      goto exit;
+    }
+
+  header.magic = PGBUF_WARMUP_FILE_MAGIC;
+  header.db_pagesize = DB_PAGESIZE;
+  header.count = count;
+  if (fwrite (&header, sizeof (header), 1, fp) != 1)
+    {
+      error_code = ER_IO_WRITE;
+    }
+  for (i = 0; i < count && error_code == NO_ERROR; i++)
+    {
+      if (fwrite (&entries[i].vpid, sizeof (VPID), 1, fp) != 1)
+	{
+	  error_code = ER_IO_WRITE;
+	}
+    }
+  if (fclose (fp) != 0)
+    {
+      error_code = ER_IO_WRITE;
+    }
+
+  if (error_code != NO_ERROR)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, tmp_name);
+      (void) remove (tmp_name);
+      goto exit;
+    }
+
+  if (os_rename_file (tmp_name, warmup_name) != 0)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, warmup_name);
+      (void) remove (tmp_name);
+      error_code = ER_IO_WRITE;
+      goto exit;
+    }
+
+exit:
+  free (entries);
+  return error_code;
+}
+
+/*
+ * pgbuf_warmup_load_pages () - warm-up worker task, read a range of pages restored from the warm-up file
+ *   return: void
+ *   vpids(in): pages to read, in VPID order
+ *   count(in): number of pages
+ *   tasks_done(in/out): incremented when the task is finished
+ *
+ * Note: Warm-up never evicts pages; it stops once the buffer has no free BCBs left.
+ */
+static void
+pgbuf_warmup_load_pages (cubthread::entry & thread_ref, const VPID * vpids, int count, std::atomic<int> &tasks_done)
+{
+  int i;
+
+  for (i = 0; i < count; i++)
+    {
+      if (pgbuf_Warmup_stop || thread_ref.shutdown || pgbuf_get_invalid_count () <= 0)
+	{
+	  break;
+	}
+
+      if (pgbuf_read_ahead_page (&thread_ref, &vpids[i]))
+	{
+	  perfmon_inc_stat (&thread_ref, PSTAT_PB_NUM_WARMUP_PAGES);
+	}
+    }
+
+  tasks_done++;
+}
+
+/*
+ * pgbuf_warmup_load () - read the pages saved in the warm-up file into the page buffer
+ *   return: error code
+ *
+ * Note: The pages are split into ranges of consecutive VPIDs that are read in parallel by a temporary worker pool.
+ *       A missing or invalid warm-up file is not an error, the buffer just warms up on demand.
+ */
+static int
+pgbuf_warmup_load (THREAD_ENTRY * thread_p)
+{
+  PGBUF_WARMUP_FILE_HEADER header;
+  VPID *vpids = NULL;
+  char warmup_name[PATH_MAX];
+  FILE *fp;
+  int max_pages, count, nthreads, start, end, i;
+  std::atomic<int> tasks_done (0);
+  cubthread::entry_workpool *workpool = NULL;
+
+  max_pages = pgbuf_warmup_max_pages ();
+  if (max_pages <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  fileio_make_pgbuf_warmup_name (warmup_name, boot_db_full_name ());
+  fp = fopen (warmup_name, "rb");
+  if (fp == NULL)
+    {
+      /* nothing saved yet */
+      return NO_ERROR;
+    }
+
+  if (fread (&header, sizeof (header), 1, fp) != 1 || header.magic != PGBUF_WARMUP_FILE_MAGIC
+      || header.db_pagesize != DB_PAGESIZE || header.count <= 0)
+    {
+      fclose (fp);
+      return NO_ERROR;
+    }
+
+  /* the buffer may have been resized since the file was saved */
+  count = MIN (header.count, max_pages);
+  vpids = (VPID *) malloc (count * sizeof (VPID));
+  if (vpids == NULL)
+    {
+      fclose (fp);
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) (count * sizeof (VPID)));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  count = (int) fread (vpids, sizeof (VPID), count, fp);
+  fclose (fp);
+
+  nthreads = MIN (prm_get_integer_value (PRM_ID_PB_WARMUP_THREADS), count / PGBUF_WARMUP_MIN_PAGES_PER_THREAD + 1);
+  if (nthreads > 1)
+    {
+      workpool = thread_get_manager ()->create_worker_pool (nthreads, nthreads, "pgbuf_warmup_loaders", NULL, 1, false);
+    }
+
+  for (i = 0, start = 0; i < nthreads; i++, start = end)
+    {
+      end = (int) (((INT64) count * (i + 1)) / nthreads);
+
+      /* *INDENT-OFF* */
+      cubthread::entry_callable_task *task =
+        new cubthread::entry_callable_task (std::bind (pgbuf_warmup_load_pages, std::placeholders::_1, vpids + start,
+                                                       end - start, std::ref (tasks_done)));
+      /* *INDENT-ON* */
+
+      /* without a worker pool, the task is executed by this thread */
+      thread_get_manager ()->push_task (workpool, task);
+    }
+
+  while (tasks_done < nthreads)
+    {
+      thread_sleep (10);
+    }
+
+  thread_get_manager ()->destroy_worker_pool (workpool);
+  free (vpids);
+
+  return NO_ERROR;
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+// class pgbuf_flush_control_daemon_task
+//
+//  description:
+//    flush control daemon task
+//
+class pgbuf_flush_control_daemon_task : public cubthread::entry_task
+{
+  private:
+    struct timeval m_end;
+    bool m_first_run;
+
+  public:
+    pgbuf_flush_control_daemon_task ()
+      : m_end ({0, 0})
+      , m_first_run (true)
+    {
+    }
+
+    int initialize ()
+    {
+      return fileio_flush_control_initialize ();
     }
 
     void execute (cubthread::entry & thread_ref) override
@@ -15937,6 +17172,118 @@ class pgbuf_flush_control_daemon_task : public cubthread::entry_task
 };
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+// class pgbuf_warmup_daemon_task
+//
+//  description:
+//    restores the pages of the warm-up file once the server is restarted, then saves the hottest pages periodically
+//
+class pgbuf_warmup_daemon_task : public cubthread::entry_task
+{
+  private:
+    bool m_is_loaded;
+
+  public:
+    pgbuf_warmup_daemon_task ()
+      : m_is_loaded (false)
+    {
+    }
+
+    void get_warmup_interval (bool & is_timed_wait, cubthread::delta_time & period)
+    {
+      is_timed_wait = true;
+      if (m_is_loaded)
+	{
+	  period = std::chrono::seconds (prm_get_integer_value (PRM_ID_PB_WARMUP_INTERVAL_SECS));
+	}
+      else
+	{
+	  period = std::chrono::seconds (PGBUF_WARMUP_LOAD_INTERVAL_SECS);
+	}
+    }
+
+    void execute (cubthread::entry & thread_ref) override
+    {
+      if (!BO_IS_SERVER_RESTARTED ())
+	{
+	  // wait for boot and recovery to finish
+	  return;
+	}
+
+      if (!m_is_loaded)
+	{
+	  // load first, a dump taken before would overwrite the saved pages with a cold buffer
+	  (void) pgbuf_warmup_load (&thread_ref);
+	  m_is_loaded = true;
+	}
+      else
+	{
+	  (void) pgbuf_warmup_dump (&thread_ref);
+	}
+      er_clear ();
+    }
+};
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+// class pgbuf_incremental_checkpoint_daemon_task
+//
+//  description:
+//    trickle-flushes the oldest dirty pages between checkpoints, so checkpoint finds few pages left to flush. every
+//    run flushes the pages dirtied before the previous run, the flushed up to LSA advancing with the log.
+//
+class pgbuf_incremental_checkpoint_daemon_task : public cubthread::entry_task
+{
+  private:
+    LOG_LSA m_next_flush_upto_lsa;
+
+  public:
+    pgbuf_incremental_checkpoint_daemon_task ()
+      : m_next_flush_upto_lsa (NULL_LSA)
+    {
+    }
+
+    void get_interval (bool & is_timed_wait, cubthread::delta_time & period)
+    {
+      int interval_secs = prm_get_integer_value (PRM_ID_LOG_CHECKPOINT_INTERVAL_SECS) / PGBUF_INCR_CHKPT_STEPS;
+
+      is_timed_wait = true;
+      period = std::chrono::seconds (MAX (interval_secs, PGBUF_INCR_CHKPT_MIN_INTERVAL_SECS));
+    }
+
+    void execute (cubthread::entry & thread_ref) override
+    {
+      LOG_LSA flush_upto_lsa;
+      LOG_LSA smallest_lsa;
+      int flushed_page_cnt = 0;
+
+      if (!BO_IS_SERVER_RESTARTED () || !prm_get_bool_value (PRM_ID_LOG_CHECKPOINT_INCREMENTAL))
+	{
+	  m_next_flush_upto_lsa.set_null ();
+	  return;
+	}
+
+      flush_upto_lsa = m_next_flush_upto_lsa;
+      m_next_flush_upto_lsa = *log_get_append_lsa ();
+      if (flush_upto_lsa.is_null ())
+	{
+	  // first run, the pages dirtied from now on are flushed by next run
+	  return;
+	}
+
+      (void) pgbuf_flush_upto_lsa (&thread_ref, &pgbuf_Pool.seq_incr_chkpt_flusher, &flush_upto_lsa, NULL,
+				   &smallest_lsa, &flushed_page_cnt);
+      er_clear ();
+
+      if (prm_get_bool_value (PRM_ID_LOG_CHKPT_DETAILED))
+	{
+	  _er_log_debug (ARG_FILE_LINE, "incremental checkpoint: flushed %d pages up to LSA %lld|%d\n",
+			 flushed_page_cnt, LSA_AS_ARGS (&flush_upto_lsa));
+	}
+    }
+};
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * pgbuf_page_maintenance_daemon_init () - initialize page maintenance daemon thread
@@ -16016,6 +17363,74 @@ pgbuf_flush_control_daemon_init ()
 }
 #endif /* SERVER_MODE */
 
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_page_read_ahead_daemon_init () - initialize page read-ahead daemon thread
+ */
+void
+pgbuf_page_read_ahead_daemon_init ()
+{
+  assert (pgbuf_Page_read_ahead_daemon == NULL);
+
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (10));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (pgbuf_page_read_ahead_execute);
+
+  pgbuf_Page_read_ahead_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task,
+                                                                           "pgbuf_page_read_ahead");
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_warmup_daemon_init () - initialize page buffer warm-up daemon thread
+ */
+void
+pgbuf_warmup_daemon_init ()
+{
+  assert (pgbuf_Warmup_daemon == NULL);
+
+  if (prm_get_integer_value (PRM_ID_PB_WARMUP_INTERVAL_SECS) <= 0)
+    {
+      // warm-up is disabled
+      return;
+    }
+
+  pgbuf_warmup_daemon_task *daemon_task = new pgbuf_warmup_daemon_task ();
+  cubthread::period_function setup_period_function = std::bind (
+      &pgbuf_warmup_daemon_task::get_warmup_interval,
+      daemon_task,
+      std::placeholders::_1,
+      std::placeholders::_2);
+
+  cubthread::looper looper = cubthread::looper (setup_period_function);
+  pgbuf_Warmup_stop = false;
+  pgbuf_Warmup_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "pgbuf_warmup");
+}
+#endif /* SERVER_MODE */
+
+#if defined (SERVER_MODE)
+/*
+ * pgbuf_incremental_checkpoint_daemon_init () - initialize incremental checkpoint daemon thread
+ */
+void
+pgbuf_incremental_checkpoint_daemon_init ()
+{
+  assert (pgbuf_Incremental_checkpoint_daemon == NULL);
+
+  // the daemon always runs, checkpoint_incremental may be changed while server is running
+  pgbuf_incremental_checkpoint_daemon_task *daemon_task = new pgbuf_incremental_checkpoint_daemon_task ();
+  cubthread::period_function setup_period_function = std::bind (
+      &pgbuf_incremental_checkpoint_daemon_task::get_interval,
+      daemon_task,
+      std::placeholders::_1,
+      std::placeholders::_2);
+
+  cubthread::looper looper = cubthread::looper (setup_period_function);
+  pgbuf_Incremental_checkpoint_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task,
+                                                                                  "pgbuf_incremental_checkpoint");
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * pgbuf_daemons_init () - initialize page buffer daemon threads
@@ -16027,6 +17442,9 @@ pgbuf_daemons_init ()
   pgbuf_page_flush_daemon_init ();
   pgbuf_page_post_flush_daemon_init ();
   pgbuf_flush_control_daemon_init ();
+  pgbuf_page_read_ahead_daemon_init ();
+  pgbuf_warmup_daemon_init ();
+  pgbuf_incremental_checkpoint_daemon_init ();
 }
 #endif /* SERVER_MODE */
 
@@ -16041,6 +17459,11 @@ pgbuf_daemons_destroy ()
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Page_post_flush_daemon);
   cubthread::get_manager ()->destroy_daemon (pgbuf_Flush_control_daemon);
+  cubthread::get_manager ()->destroy_daemon (pgbuf_Page_read_ahead_daemon);
+  // interrupt a warm-up load still in progress
+  pgbuf_Warmup_stop = true;
+  cubthread::get_manager ()->destroy_daemon (pgbuf_Warmup_daemon);
+  cubthread::get_manager ()->destroy_daemon (pgbuf_Incremental_checkpoint_daemon);
 }
 #endif /* SERVER_MODE */
 
@@ -16090,6 +17513,212 @@ pgbuf_is_page_flush_daemon_available ()
 #endif
 }
 
+/*
+ * pgbuf_is_bulk_read_size () - is a scan over npages pages big enough to be a bulk read?
+ *
+ * return      : true if the scan should use pgbuf_start_bulk_read ()
+ * npages (in) : the number of pages the scan reads
+ */
+bool
+pgbuf_is_bulk_read_size (int npages)
+{
+#if defined (SERVER_MODE)
+  return (prm_get_bool_value (PRM_ID_PB_BULK_READ_SCANS)
+	  && npages >= pgbuf_Pool.num_buffers / PGBUF_BULK_READ_BUFFER_RATIO);
+#else /* SERVER_MODE */
+  return false;
+#endif /* SERVER_MODE */
+}
+
+/*
+ * pgbuf_start_bulk_read () - the pages the thread fixes from now on are read once, e.g. by a scan of a big table
+ *
+ * thread_p (in) : thread entry
+ *
+ * While a bulk read is on, the unfixes of the thread don't boost bcbs into the hot zones, and bcbs about to be
+ * victimized are handed directly to the threads waiting for victims, like the bcbs unfixed by vacuum workers. The
+ * pages of a large scan cycle through a few bcbs of the thread's private list instead of sweeping the working set of
+ * other transactions out of the LRU lists.
+ * Calls must be paired with pgbuf_end_bulk_read () and can be nested.
+ */
+void
+pgbuf_start_bulk_read (THREAD_ENTRY * thread_p)
+{
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  assert (thread_p->pgbuf_bulk_read_count >= 0);
+  thread_p->pgbuf_bulk_read_count++;
+#endif /* SERVER_MODE */
+}
+
+/*
+ * pgbuf_end_bulk_read () - end the bulk read started by pgbuf_start_bulk_read ()
+ *
+ * thread_p (in) : thread entry
+ */
+void
+pgbuf_end_bulk_read (THREAD_ENTRY * thread_p)
+{
+#if defined (SERVER_MODE)
+  if (thread_p == NULL)
+    {
+      thread_p = thread_get_thread_entry_info ();
+    }
+
+  assert (thread_p->pgbuf_bulk_read_count > 0);
+  if (thread_p->pgbuf_bulk_read_count > 0)
+    {
+      thread_p->pgbuf_bulk_read_count--;
+    }
+#endif /* SERVER_MODE */
+}
+
+/*
+ * pgbuf_read_ahead_init () - initialize the read-ahead state of a scan
+ *
+ * read_ahead (out) : read-ahead state
+ * is_hinted (in)   : true if the scan is known to read its pages sequentially, e.g. a full heap scan
+ */
+void
+pgbuf_read_ahead_init (PGBUF_READ_AHEAD * read_ahead, bool is_hinted)
+{
+  VPID_SET_NULL (&read_ahead->last_vpid);
+  VPID_SET_NULL (&read_ahead->ahead_vpid);
+  read_ahead->seq_count = 0;
+  read_ahead->is_hinted = is_hinted;
+}
+
+/*
+ * pgbuf_read_ahead_sequential () - request the pages following the next page of a scan to be read ahead
+ *
+ * thread_p (in)       : thread entry
+ * read_ahead (in/out) : read-ahead state of the scan
+ * vpid (in)           : the page the scan reads next
+ *
+ * Once the scan reads consecutive pages of a volume (or it is hinted to be sequential), the next pages given by
+ * data_buffer_read_ahead_pages are requested to the read-ahead daemon. They are requested again when the scan has
+ * consumed half of them. Pages of the sectors not reserved are skipped by the daemon.
+ */
+void
+pgbuf_read_ahead_sequential (THREAD_ENTRY * thread_p, PGBUF_READ_AHEAD * read_ahead, const VPID * vpid)
+{
+#if defined (SERVER_MODE)
+  VPID ahead_vpid;
+  int npages, first_pageid, end_pageid, pageid;
+  bool is_requested = false;
+
+  if (vpid->volid == read_ahead->last_vpid.volid && vpid->pageid == read_ahead->last_vpid.pageid + 1)
+    {
+      read_ahead->seq_count++;
+    }
+  else
+    {
+      read_ahead->seq_count = 0;
+    }
+  read_ahead->last_vpid = *vpid;
+
+  npages = prm_get_integer_value (PRM_ID_PB_READ_AHEAD_PAGES);
+  if (npages <= 0 || pgbuf_Page_read_ahead_daemon == NULL || VPID_ISNULL (vpid))
+    {
+      return;
+    }
+  if (!read_ahead->is_hinted && read_ahead->seq_count < PGBUF_READ_AHEAD_SEQ_THRESHOLD)
+    {
+      return;
+    }
+
+  first_pageid = vpid->pageid + 1;
+  if (read_ahead->ahead_vpid.volid == vpid->volid && read_ahead->ahead_vpid.pageid > vpid->pageid)
+    {
+      if (read_ahead->ahead_vpid.pageid - vpid->pageid > npages / 2)
+	{
+	  /* enough pages are still ahead */
+	  return;
+	}
+      first_pageid = read_ahead->ahead_vpid.pageid;
+    }
+  end_pageid = vpid->pageid + 1 + npages;
+
+  ahead_vpid.volid = vpid->volid;
+  for (pageid = first_pageid; pageid < end_pageid; pageid++)
+    {
+      ahead_vpid.pageid = pageid;
+      if (!pgbuf_Pool.read_ahead_vpids->produce (ahead_vpid))
+	{
+	  /* the daemon is behind, the rest is read by the scan itself */
+	  break;
+	}
+      is_requested = true;
+    }
+
+  if (is_requested)
+    {
+      read_ahead->ahead_vpid.volid = vpid->volid;
+      read_ahead->ahead_vpid.pageid = pageid;
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_READ_AHEAD_REQUESTS);
+      pgbuf_Page_read_ahead_daemon->wakeup ();
+    }
+#endif /* SERVER_MODE */
+}
+
+/*
+ * pgbuf_read_ahead_pages () - request pages to be read ahead, e.g. the pages an index scan visits next
+ *
+ * return         : the number of pages requested
+ * thread_p (in)  : thread entry
+ * vpids (in/out) : pages to read ahead, sorted in place
+ * count (in)     : the number of pages
+ *
+ * The pages are requested in order of VPID, duplicated ones once. Read-ahead is disabled by setting
+ * data_buffer_read_ahead_pages to 0.
+ */
+int
+pgbuf_read_ahead_pages (THREAD_ENTRY * thread_p, VPID * vpids, int count)
+{
+#if defined (SERVER_MODE)
+  int nrequested = 0;
+  int i;
+
+  if (count <= 0 || prm_get_integer_value (PRM_ID_PB_READ_AHEAD_PAGES) <= 0 || pgbuf_Page_read_ahead_daemon == NULL)
+    {
+      return 0;
+    }
+
+  if (count > 1)
+    {
+      qsort (vpids, count, sizeof (VPID), pgbuf_compare_vpid);
+    }
+
+  for (i = 0; i < count; i++)
+    {
+      if (VPID_ISNULL (&vpids[i]) || (i > 0 && VPID_EQ (&vpids[i], &vpids[i - 1])))
+	{
+	  continue;
+	}
+      if (!pgbuf_Pool.read_ahead_vpids->produce (vpids[i]))
+	{
+	  /* the daemon is behind */
+	  break;
+	}
+      nrequested++;
+    }
+
+  if (nrequested > 0)
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_NUM_READ_AHEAD_REQUESTS);
+      pgbuf_Page_read_ahead_daemon->wakeup ();
+    }
+
+  return nrequested;
+#else /* SERVER_MODE */
+  return 0;
+#endif /* SERVER_MODE */
+}
+
 static bool
 pgbuf_is_temp_lsa (const log_lsa & lsa)
 {
@@ -16186,6 +17815,150 @@ pgbuf_scan_bcb_table ()
     }
 }
 
+/*
+ * pgbuf_page_type_name () - name of page type for show page buffer residency
+ *   return: page type name
+ *   page_type(in):
+ */
+static const char *
+pgbuf_page_type_name (int page_type)
+{
+  switch (page_type)
+    {
+    case PAGE_UNKNOWN:
+      return "UNKNOWN";
+    case PAGE_FTAB:
+      return "FTAB";
+    case PAGE_HEAP:
+      return "HEAP";
+    case PAGE_VOLHEADER:
+      return "VOLHEADER";
+    case PAGE_VOLBITMAP:
+      return "VOLBITMAP";
+    case PAGE_QRESULT:
+      return "QRESULT";
+    case PAGE_EHASH:
+      return "EHASH";
+    case PAGE_OVERFLOW:
+      return "OVERFLOW";
+    case PAGE_AREA:
+      return "AREA";
+    case PAGE_CATALOG:
+      return "CATALOG";
+    case PAGE_BTREE:
+      return "BTREE";
+    case PAGE_LOG:
+      return "LOG";
+    case PAGE_DROPPED_FILES:
+      return "DROPPED_FILES";
+    case PAGE_VACUUM_DATA:
+      return "VACUUM_DATA";
+    default:
+      return "ERROR";
+    }
+}
+
+/*
+ * pgbuf_residency_start_scan () - start scan function for show page buffer residency
+ *   return: NO_ERROR, or ER_code
+ *
+ *   thread_p(in):
+ *   type (in):
+ *   arg_values(in):
+ *   arg_cnt(in):
+ *   ptr(in/out):
+ *
+ * Note: the counters are kept up to date by pgbuf_bcb_change_zone and pgbuf_bcb_update_flags, no bcb is visited here.
+ */
+int
+pgbuf_residency_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr)
+{
+  SHOWSTMT_ARRAY_CONTEXT *ctx = NULL;
+  const int num_cols = 8;
+  PGBUF_RESIDENCY residency;
+  INT64 now = (INT64) time (NULL);
+  INT64 avg_age;
+  int num_pages;
+  int is_temp, ptype;
+  int idx;
+  int error = NO_ERROR;
+  DB_VALUE *vals = NULL;
+
+  *ptr = NULL;
+
+  ctx = showstmt_alloc_array_context (thread_p, 2 * (PAGE_LAST + 1), num_cols);
+  if (ctx == NULL)
+    {
+      error = er_errid ();
+      return error;
+    }
+
+  for (is_temp = 0; is_temp < 2; is_temp++)
+    {
+      for (ptype = PAGE_UNKNOWN; ptype <= PAGE_LAST; ptype++)
+	{
+	  /* copy the counters; they change while we read them, so clamp what cannot be negative. */
+	  residency = pgbuf_Pool.monitor.residency[is_temp][ptype];
+	  residency.lru1_cnt = MAX (residency.lru1_cnt, 0);
+	  residency.lru2_cnt = MAX (residency.lru2_cnt, 0);
+	  residency.lru3_cnt = MAX (residency.lru3_cnt, 0);
+	  num_pages = residency.lru1_cnt + residency.lru2_cnt + residency.lru3_cnt;
+	  if (num_pages == 0)
+	    {
+	      continue;
+	    }
+
+	  vals = showstmt_alloc_tuple_in_context (thread_p, ctx);
+	  if (vals == NULL)
+	    {
+	      error = er_errid ();
+	      goto exit_on_error;
+	    }
+
+	  idx = 0;
+
+	  db_make_string (&vals[idx], is_temp ? "TEMPORARY" : "PERMANENT");
+	  idx++;
+
+	  db_make_string (&vals[idx], pgbuf_page_type_name (ptype));
+	  idx++;
+
+	  db_make_int (&vals[idx], num_pages);
+	  idx++;
+
+	  db_make_int (&vals[idx], residency.lru1_cnt);
+	  idx++;
+
+	  db_make_int (&vals[idx], residency.lru2_cnt);
+	  idx++;
+
+	  db_make_int (&vals[idx], residency.lru3_cnt);
+	  idx++;
+
+	  db_make_int (&vals[idx], MIN (MAX (residency.dirty_cnt, 0), num_pages));
+	  idx++;
+
+	  avg_age = now - residency.sum_lru_enter_time / num_pages;
+	  db_make_bigint (&vals[idx], MAX (avg_age, 0));
+	  idx++;
+
+	  assert (idx == num_cols);
+	}
+    }
+
+  *ptr = ctx;
+  return NO_ERROR;
+
+exit_on_error:
+
+  if (ctx != NULL)
+    {
+      showstmt_free_array_context (thread_p, ctx);
+    }
+
+  return error;
+}
+
 /*
  * pgbuf_start_scan () - start scan function for show page buffer status
  *   return: NO_ERROR, or ER_code
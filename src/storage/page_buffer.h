@@ -358,9 +358,12 @@ extern void pgbuf_set_tde_algorithm (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, TD
 				     bool skip_logging);
 extern int pgbuf_rv_set_tde_algorithm (THREAD_ENTRY * thread_p, LOG_RCV * rcv);
 extern TDE_ALGORITHM pgbuf_get_tde_algorithm (PAGE_PTR pgptr);
+extern int pgbuf_get_tde_dk_gen (PAGE_PTR pgptr);
 extern void pgbuf_get_vpid (PAGE_PTR pgptr, VPID * vpid);
 extern VPID *pgbuf_get_vpid_ptr (PAGE_PTR pgptr);
 extern PGBUF_LATCH_MODE pgbuf_get_latch_mode (PAGE_PTR pgptr);
+extern INT64 pgbuf_get_page_version (PAGE_PTR pgptr, void **bcb_handle);
+extern bool pgbuf_is_page_version_current (void *bcb_handle, const VPID * vpid, INT64 version);
 extern PAGEID pgbuf_get_page_id (PAGE_PTR pgptr);
 extern PAGE_TYPE pgbuf_get_page_ptype (THREAD_ENTRY * thread_p, PAGE_PTR pgptr);
 extern VOLID pgbuf_get_volume_id (PAGE_PTR pgptr);
@@ -404,6 +407,8 @@ extern void pgbuf_attach_watcher (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, PGBUF
 extern bool pgbuf_has_any_waiters (PAGE_PTR pgptr);
 extern bool pgbuf_has_any_non_vacuum_waiters (PAGE_PTR pgptr);
 extern bool pgbuf_has_prevent_dealloc (PAGE_PTR pgptr);
+extern int pgbuf_get_huge_pages_type (void);
+extern int pgbuf_get_flush_feedback_boost (void);
 extern void pgbuf_peek_stats (UINT64 * fixed_cnt, UINT64 * dirty_cnt, UINT64 * lru1_cnt, UINT64 * lru2_cnt,
 			      UINT64 * lru3_cnt, UINT64 * vict_candidates, UINT64 * avoid_dealloc_cnt,
 			      UINT64 * avoid_victim_cnt, UINT64 * private_quota, UINT64 * private_cnt,
@@ -452,6 +457,14 @@ extern bool pgbuf_assign_flushed_pages (THREAD_ENTRY * thread_p);
 #endif /* !SERVER_MODE */
 
 extern void pgbuf_notify_vacuum_follows (THREAD_ENTRY * thread_p, PAGE_PTR page);
+
+extern bool pgbuf_is_bulk_read_size (int npages);
+extern void pgbuf_start_bulk_read (THREAD_ENTRY * thread_p);
+extern void pgbuf_end_bulk_read (THREAD_ENTRY * thread_p);
+
+extern void pgbuf_read_ahead_init (PGBUF_READ_AHEAD * read_ahead, bool is_hinted);
+extern void pgbuf_read_ahead_sequential (THREAD_ENTRY * thread_p, PGBUF_READ_AHEAD * read_ahead, const VPID * vpid);
+extern int pgbuf_read_ahead_pages (THREAD_ENTRY * thread_p, VPID * vpids, int count);
 extern bool pgbuf_is_io_stressful (void);
 
 #if defined (SERVER_MODE)
@@ -460,5 +473,7 @@ extern void pgbuf_daemons_destroy ();
 #endif /* SERVER_MODE */
 
 extern int pgbuf_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt, void **ptr);
+extern int pgbuf_residency_start_scan (THREAD_ENTRY * thread_p, int type, DB_VALUE ** arg_values, int arg_cnt,
+				       void **ptr);
 
 #endif /* _PAGE_BUFFER_H_ */
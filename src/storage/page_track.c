@@ -0,0 +1,502 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * page_track.c - tracking of the pages changed since the last backups
+ */
+
+#ident "$Id$"
+
+#include "config.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+
+#include "page_track.h"
+#include "error_manager.h"
+#include "porting.h"
+#include "system_parameter.h"
+
+#include <vector>
+
+#if !defined(SERVER_MODE)
+#define pthread_mutex_init(a, b)
+#define pthread_mutex_destroy(a)
+#define pthread_mutex_lock(a)	0
+#define pthread_mutex_unlock(a)
+#endif /* !SERVER_MODE */
+
+#define PGTRACK_FILE_MAGIC 0x504b5442	/* "PKTB" */
+
+/* bitmaps of the pages changed since a base backup: since the last full backup, used by level 1 backups, and since the
+ * last full or level 1 backup, used by level 2 backups */
+#define PGTRACK_NUM_BASES 2
+#define PGTRACK_BASE_OF_INCREMENT(level) ((int) (level) - 1)
+
+#define PGTRACK_BITS_PER_WORD 64
+
+typedef struct pgtrack_file_header PGTRACK_FILE_HEADER;
+struct pgtrack_file_header
+{
+  int magic;
+  int db_pagesize;
+  INT64 db_creation;
+  LOG_LSA base_lsa[PGTRACK_NUM_BASES];	/* start of the base backups when the bitmaps were saved */
+  int is_valid[PGTRACK_NUM_BASES];	/* a valid bitmap follows the header, by volume: number of words, words */
+};
+
+/* *INDENT-OFF* */
+/* words of the page bits, by volume */
+typedef std::vector<std::vector<UINT64>> PGTRACK_BITMAP;
+/* *INDENT-ON* */
+
+typedef struct pgtrack_global PGTRACK_GLOBAL;
+struct pgtrack_global
+{
+  pthread_mutex_t mutex;
+  bool is_enabled;
+  bool is_valid[PGTRACK_NUM_BASES];	/* pages were marked since the base backup started */
+  PGTRACK_BITMAP changed[PGTRACK_NUM_BASES];
+  bool is_backup_started;	/* a full or level 1 backup is in progress */
+  PGTRACK_BITMAP started;	/* pages changed since the backup in progress started */
+};
+
+static PGTRACK_GLOBAL pgtrack_Gl;
+
+static void pgtrack_set_bit (PGTRACK_BITMAP & bitmap, const VPID * vpid);
+static bool pgtrack_get_bit (const PGTRACK_BITMAP & bitmap, const VPID * vpid);
+static int pgtrack_write_bitmap (FILE * fp, const PGTRACK_BITMAP & bitmap);
+static int pgtrack_read_bitmap (FILE * fp, PGTRACK_BITMAP & bitmap);
+
+/*
+ * pgtrack_initialize () - initialize changed page tracking
+ *   return: NO_ERROR
+ *
+ * Note: Pages are tracked only if backup_track_changed_pages is set. The bitmaps are not valid until they are loaded
+ *       or a base backup is done.
+ */
+int
+pgtrack_initialize (void)
+{
+  int i;
+
+  pthread_mutex_init (&pgtrack_Gl.mutex, NULL);
+  pgtrack_Gl.is_enabled = prm_get_bool_value (PRM_ID_BACKUP_TRACK_CHANGED_PAGES);
+  for (i = 0; i < PGTRACK_NUM_BASES; i++)
+    {
+      pgtrack_Gl.is_valid[i] = false;
+      pgtrack_Gl.changed[i].clear ();
+    }
+  pgtrack_Gl.is_backup_started = false;
+  pgtrack_Gl.started.clear ();
+
+  return NO_ERROR;
+}
+
+/*
+ * pgtrack_finalize () - free the bitmaps
+ *   return: void
+ */
+void
+pgtrack_finalize (void)
+{
+  int i;
+
+  for (i = 0; i < PGTRACK_NUM_BASES; i++)
+    {
+      pgtrack_Gl.is_valid[i] = false;
+      PGTRACK_BITMAP ().swap (pgtrack_Gl.changed[i]);
+    }
+  pgtrack_Gl.is_backup_started = false;
+  PGTRACK_BITMAP ().swap (pgtrack_Gl.started);
+  pgtrack_Gl.is_enabled = false;
+  pthread_mutex_destroy (&pgtrack_Gl.mutex);
+}
+
+/*
+ * pgtrack_load () - load the bitmaps saved on the last shutdown
+ *   return: void
+ *   db_fullname(in): database full path
+ *   db_creation(in): database creation time
+ *   level0_lsa(in): start of the last full backup
+ *   level1_lsa(in): start of the last level 1 backup
+ *   is_shutdown(in): false if the database is recovered; the pages written since the file was saved are not known
+ *
+ * Note: The file is removed once it is read, so it is never loaded after a crash. A missing or stale file is not an
+ *       error; the bitmaps are just not valid until the next base backup.
+ */
+void
+pgtrack_load (const char *db_fullname, INT64 db_creation, const LOG_LSA * level0_lsa, const LOG_LSA * level1_lsa,
+	      bool is_shutdown)
+{
+  PGTRACK_FILE_HEADER header;
+  char track_name[PATH_MAX];
+  const LOG_LSA *base_lsa[PGTRACK_NUM_BASES] = { level0_lsa, level1_lsa };
+  FILE *fp;
+  int i;
+
+  fileio_make_backup_page_track_name (track_name, db_fullname);
+  fp = fopen (track_name, "rb");
+  if (fp == NULL)
+    {
+      return;
+    }
+
+  if (is_shutdown && pgtrack_Gl.is_enabled && fread (&header, sizeof (header), 1, fp) == 1
+      && header.magic == PGTRACK_FILE_MAGIC && header.db_pagesize == DB_PAGESIZE && header.db_creation == db_creation)
+    {
+      for (i = 0; i < PGTRACK_NUM_BASES; i++)
+	{
+	  if (!header.is_valid[i])
+	    {
+	      continue;
+	    }
+	  if (pgtrack_read_bitmap (fp, pgtrack_Gl.changed[i]) != NO_ERROR)
+	    {
+	      break;
+	    }
+	  /* a backup taken without tracking pages changed the base */
+	  pgtrack_Gl.is_valid[i] = !LSA_ISNULL (base_lsa[i]) && LSA_EQ (&header.base_lsa[i], base_lsa[i]);
+	  if (!pgtrack_Gl.is_valid[i])
+	    {
+	      pgtrack_Gl.changed[i].clear ();
+	    }
+	}
+      if (i < PGTRACK_NUM_BASES)
+	{
+	  /* truncated file */
+	  pgtrack_Gl.is_valid[0] = pgtrack_Gl.is_valid[1] = false;
+	}
+    }
+
+  fclose (fp);
+  (void) remove (track_name);
+}
+
+/*
+ * pgtrack_save () - save the valid bitmaps, on shutdown once all pages are flushed
+ *   return: error code
+ *   db_fullname(in): database full path
+ *   db_creation(in): database creation time
+ *   level0_lsa(in): start of the last full backup
+ *   level1_lsa(in): start of the last level 1 backup
+ *
+ * Note: The file is written aside and renamed, so a crash never leaves a truncated file.
+ */
+int
+pgtrack_save (const char *db_fullname, INT64 db_creation, const LOG_LSA * level0_lsa, const LOG_LSA * level1_lsa)
+{
+  PGTRACK_FILE_HEADER header;
+  char track_name[PATH_MAX];
+  char tmp_name[PATH_MAX];
+  FILE *fp;
+  int i;
+  int error_code = NO_ERROR;
+
+  if (!pgtrack_Gl.is_enabled || (!pgtrack_Gl.is_valid[0] && !pgtrack_Gl.is_valid[1]))
+    {
+      return NO_ERROR;
+    }
+
+  fileio_make_backup_page_track_name (track_name, db_fullname);
+  snprintf (tmp_name, sizeof (tmp_name), "%s.tmp", track_name);
+
+  fp = fopen (tmp_name, "wb");
+  if (fp == NULL)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, tmp_name);
+      return ER_IO_WRITE;
+    }
+
+  memset (&header, 0, sizeof (header));
+  header.magic = PGTRACK_FILE_MAGIC;
+  header.db_pagesize = DB_PAGESIZE;
+  header.db_creation = db_creation;
+  LSA_COPY (&header.base_lsa[0], level0_lsa);
+  LSA_COPY (&header.base_lsa[1], level1_lsa);
+  for (i = 0; i < PGTRACK_NUM_BASES; i++)
+    {
+      header.is_valid[i] = pgtrack_Gl.is_valid[i];
+    }
+
+  if (fwrite (&header, sizeof (header), 1, fp) != 1)
+    {
+      error_code = ER_IO_WRITE;
+    }
+  for (i = 0; i < PGTRACK_NUM_BASES && error_code == NO_ERROR; i++)
+    {
+      if (pgtrack_Gl.is_valid[i])
+	{
+	  error_code = pgtrack_write_bitmap (fp, pgtrack_Gl.changed[i]);
+	}
+    }
+  if (fclose (fp) != 0)
+    {
+      error_code = ER_IO_WRITE;
+    }
+
+  if (error_code != NO_ERROR)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, tmp_name);
+      (void) remove (tmp_name);
+      return error_code;
+    }
+
+  if (os_rename_file (tmp_name, track_name) != 0)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_WRITE, 2, 0, track_name);
+      (void) remove (tmp_name);
+      return ER_IO_WRITE;
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * pgtrack_set_changed () - mark a permanent page written to disk
+ *   return: void
+ *   vpid(in): page identifier
+ *
+ * Note: Called by page buffer before the page is written.
+ */
+void
+pgtrack_set_changed (const VPID * vpid)
+{
+  int i;
+  int rv;
+
+  if (!pgtrack_Gl.is_enabled)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&pgtrack_Gl.mutex);
+  for (i = 0; i < PGTRACK_NUM_BASES; i++)
+    {
+      if (pgtrack_Gl.is_valid[i])
+	{
+	  pgtrack_set_bit (pgtrack_Gl.changed[i], vpid);
+	}
+    }
+  if (pgtrack_Gl.is_backup_started)
+    {
+      pgtrack_set_bit (pgtrack_Gl.started, vpid);
+    }
+  pthread_mutex_unlock (&pgtrack_Gl.mutex);
+}
+
+/*
+ * pgtrack_start_backup () - start marking pages for a new base backup
+ *   return: void
+ *   level(in): backup level
+ *
+ * Note: Must be called before the backup reads any page. Level 2 backups are not a base of other backups.
+ */
+void
+pgtrack_start_backup (FILEIO_BACKUP_LEVEL level)
+{
+  int rv;
+
+  if (!pgtrack_Gl.is_enabled || level == FILEIO_BACKUP_SMALL_INCREMENT_LEVEL)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&pgtrack_Gl.mutex);
+  pgtrack_Gl.started.clear ();
+  pgtrack_Gl.is_backup_started = true;
+  pthread_mutex_unlock (&pgtrack_Gl.mutex);
+}
+
+/*
+ * pgtrack_end_backup () - end a backup; a full or level 1 backup becomes the base of the next backups
+ *   return: void
+ *   level(in): backup level
+ *   is_success(in): true if the log header has the new base backup
+ */
+void
+pgtrack_end_backup (FILEIO_BACKUP_LEVEL level, bool is_success)
+{
+  int rv;
+
+  if (!pgtrack_Gl.is_enabled)
+    {
+      return;
+    }
+
+  rv = pthread_mutex_lock (&pgtrack_Gl.mutex);
+  if (pgtrack_Gl.is_backup_started && is_success)
+    {
+      switch (level)
+	{
+	case FILEIO_BACKUP_FULL_LEVEL:
+	  /* both bases are the full backup */
+	  pgtrack_Gl.changed[1] = pgtrack_Gl.started;
+	  pgtrack_Gl.changed[0].swap (pgtrack_Gl.started);
+	  pgtrack_Gl.is_valid[0] = pgtrack_Gl.is_valid[1] = true;
+	  break;
+	case FILEIO_BACKUP_BIG_INCREMENT_LEVEL:
+	  pgtrack_Gl.changed[1].swap (pgtrack_Gl.started);
+	  pgtrack_Gl.is_valid[1] = true;
+	  break;
+	default:
+	  break;
+	}
+    }
+  pgtrack_Gl.is_backup_started = false;
+  pgtrack_Gl.started.clear ();
+  pthread_mutex_unlock (&pgtrack_Gl.mutex);
+}
+
+/*
+ * pgtrack_is_tracked () - can an incremental backup read only the changed pages
+ *   return: true if the bitmap of its base backup is valid
+ *   level(in): backup level
+ */
+bool
+pgtrack_is_tracked (FILEIO_BACKUP_LEVEL level)
+{
+  if (!pgtrack_Gl.is_enabled || level == FILEIO_BACKUP_FULL_LEVEL || level >= FILEIO_BACKUP_UNDEFINED_LEVEL)
+    {
+      return false;
+    }
+
+  return pgtrack_Gl.is_valid[PGTRACK_BASE_OF_INCREMENT (level)];
+}
+
+/*
+ * pgtrack_is_changed () - was a page written since the base backup of an incremental backup
+ *   return: true if changed, or not known
+ *   level(in): backup level
+ *   vpid(in): page identifier
+ */
+bool
+pgtrack_is_changed (FILEIO_BACKUP_LEVEL level, const VPID * vpid)
+{
+  bool is_changed;
+  int rv;
+
+  if (!pgtrack_is_tracked (level))
+    {
+      return true;
+    }
+
+  rv = pthread_mutex_lock (&pgtrack_Gl.mutex);
+  is_changed = pgtrack_get_bit (pgtrack_Gl.changed[PGTRACK_BASE_OF_INCREMENT (level)], vpid);
+  pthread_mutex_unlock (&pgtrack_Gl.mutex);
+
+  return is_changed;
+}
+
+/*
+ * pgtrack_set_bit () - set the bit of a page, growing the bitmap as needed
+ */
+static void
+pgtrack_set_bit (PGTRACK_BITMAP & bitmap, const VPID * vpid)
+{
+  size_t word = (size_t) vpid->pageid / PGTRACK_BITS_PER_WORD;
+
+  assert (vpid->volid >= 0 && vpid->pageid >= 0);
+
+  if ((size_t) vpid->volid >= bitmap.size ())
+    {
+      bitmap.resize (vpid->volid + 1);
+    }
+  /* *INDENT-OFF* */
+  std::vector<UINT64> &words = bitmap[vpid->volid];
+  /* *INDENT-ON* */
+  if (word >= words.size ())
+    {
+      words.resize (word + 1, 0);
+    }
+  words[word] |= (UINT64) 1 << (vpid->pageid % PGTRACK_BITS_PER_WORD);
+}
+
+/*
+ * pgtrack_get_bit () - get the bit of a page
+ */
+static bool
+pgtrack_get_bit (const PGTRACK_BITMAP & bitmap, const VPID * vpid)
+{
+  size_t word = (size_t) vpid->pageid / PGTRACK_BITS_PER_WORD;
+
+  if ((size_t) vpid->volid >= bitmap.size () || word >= bitmap[vpid->volid].size ())
+    {
+      return false;
+    }
+
+  return (bitmap[vpid->volid][word] & ((UINT64) 1 << (vpid->pageid % PGTRACK_BITS_PER_WORD))) != 0;
+}
+
+/*
+ * pgtrack_write_bitmap () - write a bitmap: number of volumes, then the number of words and the words of each
+ */
+static int
+pgtrack_write_bitmap (FILE * fp, const PGTRACK_BITMAP & bitmap)
+{
+  int count = (int) bitmap.size ();
+  size_t volid;
+
+  if (fwrite (&count, sizeof (count), 1, fp) != 1)
+    {
+      return ER_IO_WRITE;
+    }
+  for (volid = 0; volid < bitmap.size (); volid++)
+    {
+      count = (int) bitmap[volid].size ();
+      if (fwrite (&count, sizeof (count), 1, fp) != 1
+	  || (count > 0 && fwrite (bitmap[volid].data (), sizeof (UINT64), count, fp) != (size_t) count))
+	{
+	  return ER_IO_WRITE;
+	}
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * pgtrack_read_bitmap () - read a bitmap written by pgtrack_write_bitmap
+ */
+static int
+pgtrack_read_bitmap (FILE * fp, PGTRACK_BITMAP & bitmap)
+{
+  int num_vols, count;
+  int volid;
+
+  if (fread (&num_vols, sizeof (num_vols), 1, fp) != 1 || num_vols < 0 || num_vols > VOLID_MAX)
+    {
+      return ER_FAILED;
+    }
+  bitmap.resize (num_vols);
+  for (volid = 0; volid < num_vols; volid++)
+    {
+      if (fread (&count, sizeof (count), 1, fp) != 1 || count < 0
+	  || count > VOL_MAX_NPAGES (IO_PAGESIZE) / PGTRACK_BITS_PER_WORD + 1)
+	{
+	  return ER_FAILED;
+	}
+      bitmap[volid].resize (count);
+      if (count > 0 && fread (bitmap[volid].data (), sizeof (UINT64), count, fp) != (size_t) count)
+	{
+	  return ER_FAILED;
+	}
+    }
+
+  return NO_ERROR;
+}
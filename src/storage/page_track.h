@@ -0,0 +1,54 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * page_track.h - tracking of the pages changed since the last backups
+ */
+
+#ifndef _PAGE_TRACK_H_
+#define _PAGE_TRACK_H_
+
+#ident "$Id$"
+
+#include "file_io.h"
+#include "log_lsa.hpp"
+#include "storage_common.h"
+
+/*
+ * Page buffer marks every permanent page it writes to disk in a bitmap of the pages changed since the last full backup
+ * and in one of the pages changed since the last full or level 1 backup. An incremental backup then reads only the
+ * pages marked in the bitmap of its base backup, instead of reading every page to compare its LSA.
+ * Marking starts before a full or level 1 backup reads any page. Every page written after that is marked, and a page
+ * that is not marked is the same on disk as in the backup. The new bitmap replaces the old one when the backup ends.
+ * A bitmap is valid only if the pages were marked since its base backup started. The bitmaps are saved on a clean
+ * shutdown and loaded on the next restart. After a crash, or before the next base backup, incremental backups read
+ * every page as before.
+ */
+extern int pgtrack_initialize (void);
+extern void pgtrack_finalize (void);
+extern void pgtrack_load (const char *db_fullname, INT64 db_creation, const LOG_LSA * level0_lsa,
+			  const LOG_LSA * level1_lsa, bool is_shutdown);
+extern int pgtrack_save (const char *db_fullname, INT64 db_creation, const LOG_LSA * level0_lsa,
+			 const LOG_LSA * level1_lsa);
+extern void pgtrack_set_changed (const VPID * vpid);
+extern void pgtrack_start_backup (FILEIO_BACKUP_LEVEL level);
+extern void pgtrack_end_backup (FILEIO_BACKUP_LEVEL level, bool is_success);
+extern bool pgtrack_is_tracked (FILEIO_BACKUP_LEVEL level);
+extern bool pgtrack_is_changed (FILEIO_BACKUP_LEVEL level, const VPID * vpid);
+
+#endif /* _PAGE_TRACK_H_ */
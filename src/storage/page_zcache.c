@@ -0,0 +1,616 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * page_zcache.c - compressed cache of the clean pages evicted from page buffer
+ *
+ * Note: Using lz4 library
+ */
+
+#ident "$Id$"
+
+#include "config.h"
+
+#include <string.h>
+#include <assert.h>
+
+#include "page_zcache.h"
+#include "error_manager.h"
+#include "memory_alloc.h"
+#include "perf_monitor.h"
+#include "porting.h"
+#include "system_parameter.h"
+#include "lz4.h"
+
+#if !defined(SERVER_MODE)
+#define pthread_mutex_init(a, b)
+#define pthread_mutex_destroy(a)
+#define pthread_mutex_lock(a)	0
+#define pthread_mutex_unlock(a)
+#endif /* !SERVER_MODE */
+
+/* the cache is split in partitions, each having its own mutex, LRU list and share of the memory budget */
+#define ZCACHE_NUM_PARTITIONS 64
+/* hash buckets of a partition */
+#define ZCACHE_PARTITION_HASH_SIZE 1024
+
+#define ZCACHE_HASH_VALUE(vpid) \
+  ((unsigned int) (vpid)->pageid * 31 + (unsigned int) (vpid)->volid)
+#define ZCACHE_GET_PARTITION(vpid) \
+  (&zcache_Gl.partitions[ZCACHE_HASH_VALUE (vpid) % ZCACHE_NUM_PARTITIONS])
+#define ZCACHE_GET_BUCKET(vpid) \
+  ((ZCACHE_HASH_VALUE (vpid) / ZCACHE_NUM_PARTITIONS) % ZCACHE_PARTITION_HASH_SIZE)
+
+/* the memory an entry is accounted for */
+#define ZCACHE_ENTRY_SIZE(length) ((INT64) offsetof (ZCACHE_ENTRY, data) + (length))
+
+typedef struct zcache_entry ZCACHE_ENTRY;
+struct zcache_entry
+{
+  VPID vpid;
+  ZCACHE_ENTRY *hash_next;
+  ZCACHE_ENTRY *lru_prev;	/* more recently stored entry */
+  ZCACHE_ENTRY *lru_next;	/* less recently stored entry */
+  int length;			/* length of data */
+  bool is_compressed;		/* false if the page did not compress and is stored as it is */
+  bool is_dirty;		/* image of a temporary page newer than the disk one; written back when dropped */
+  char data[1];
+};
+
+typedef struct zcache_partition ZCACHE_PARTITION;
+struct zcache_partition
+{
+  pthread_mutex_t mutex;
+  ZCACHE_ENTRY *hash_table[ZCACHE_PARTITION_HASH_SIZE];
+  ZCACHE_ENTRY *lru_top;	/* most recently stored entry */
+  ZCACHE_ENTRY *lru_bottom;	/* least recently stored entry, the first to be dropped */
+  INT64 size;			/* memory used by the entries */
+  INT64 max_size;		/* memory budget of partition */
+};
+
+typedef struct zcache_global ZCACHE_GLOBAL;
+struct zcache_global
+{
+  ZCACHE_PARTITION *partitions;
+  bool is_enabled;
+  bool is_temp_enabled;		/* flushed temporary pages are kept instead of written */
+};
+
+static ZCACHE_GLOBAL zcache_Gl = { NULL, false, false };
+
+static bool zcache_store (THREAD_ENTRY * thread_p, const VPID * vpid, const FILEIO_PAGE * io_page, bool is_dirty);
+static void zcache_link_entry (ZCACHE_PARTITION * partition, ZCACHE_ENTRY * entry);
+static bool zcache_write_back (THREAD_ENTRY * thread_p, ZCACHE_ENTRY * entry);
+
+static ZCACHE_ENTRY *zcache_detach_entry (ZCACHE_PARTITION * partition, const VPID * vpid);
+static void zcache_unlink_entry (ZCACHE_PARTITION * partition, ZCACHE_ENTRY * entry);
+static void zcache_free_entries (ZCACHE_ENTRY * entries);
+
+/*
+ * zcache_initialize () - initialize compressed cache
+ *   return: NO_ERROR, or ER_code
+ *
+ * Note: The cache is enabled only for a not null data_buffer_compressed_cache_size.
+ */
+int
+zcache_initialize (void)
+{
+  UINT64 max_size = prm_get_bigint_value (PRM_ID_PB_COMPRESSED_CACHE_SIZE);
+  int i;
+
+  assert (zcache_Gl.partitions == NULL);
+
+  zcache_Gl.is_enabled = false;
+  zcache_Gl.is_temp_enabled = false;
+  if (max_size == 0)
+    {
+      return NO_ERROR;
+    }
+
+  zcache_Gl.partitions = (ZCACHE_PARTITION *) malloc (ZCACHE_NUM_PARTITIONS * sizeof (ZCACHE_PARTITION));
+  if (zcache_Gl.partitions == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      (size_t) (ZCACHE_NUM_PARTITIONS * sizeof (ZCACHE_PARTITION)));
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  memset (zcache_Gl.partitions, 0, ZCACHE_NUM_PARTITIONS * sizeof (ZCACHE_PARTITION));
+  for (i = 0; i < ZCACHE_NUM_PARTITIONS; i++)
+    {
+      pthread_mutex_init (&zcache_Gl.partitions[i].mutex, NULL);
+      zcache_Gl.partitions[i].max_size = (INT64) (max_size / ZCACHE_NUM_PARTITIONS);
+    }
+
+  zcache_Gl.is_enabled = true;
+  zcache_Gl.is_temp_enabled = prm_get_bool_value (PRM_ID_PB_COMPRESSED_CACHE_TEMP_PAGES);
+
+  return NO_ERROR;
+}
+
+/*
+ * zcache_finalize () - drop all pages and free compressed cache
+ *   return: void
+ */
+void
+zcache_finalize (void)
+{
+  ZCACHE_PARTITION *partition;
+  int i;
+
+  if (zcache_Gl.partitions == NULL)
+    {
+      return;
+    }
+
+  zcache_Gl.is_enabled = false;
+  zcache_Gl.is_temp_enabled = false;
+  for (i = 0; i < ZCACHE_NUM_PARTITIONS; i++)
+    {
+      partition = &zcache_Gl.partitions[i];
+
+      zcache_free_entries (partition->lru_top);
+      pthread_mutex_destroy (&partition->mutex);
+    }
+
+  free_and_init (zcache_Gl.partitions);
+}
+
+/*
+ * zcache_is_enabled () - is compressed cache enabled?
+ *   return: true if enabled
+ */
+bool
+zcache_is_enabled (void)
+{
+  return zcache_Gl.is_enabled;
+}
+
+/*
+ * zcache_put () - store the image of a clean page evicted from page buffer
+ *   return: void
+ *   thread_p(in): thread entry
+ *   vpid(in): page identifier
+ *   io_page(in): page image, as it is on disk
+ *
+ * Note: The cache is only a hint; the page is not stored if memory is missing. The least recently stored pages of
+ *       the partition are dropped to make room.
+ */
+void
+zcache_put (THREAD_ENTRY * thread_p, const VPID * vpid, const FILEIO_PAGE * io_page)
+{
+  if (!zcache_Gl.is_enabled)
+    {
+      return;
+    }
+
+  if (zcache_store (thread_p, vpid, io_page, false))
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_ZCACHE_STORES);
+    }
+}
+
+/*
+ * zcache_put_temp () - keep the image of a flushed temporary page instead of writing it
+ *   return: true if the page was stored and does not have to be written
+ *   thread_p(in): thread entry
+ *   vpid(in): page identifier
+ *   io_page(in): page image, as it would be on disk
+ *
+ * Note: The image is written to disk only when it is dropped to make room. The page may stay in page buffer; it is
+ *       only clean there. If the page is not stored, the caller writes it.
+ */
+bool
+zcache_put_temp (THREAD_ENTRY * thread_p, const VPID * vpid, const FILEIO_PAGE * io_page)
+{
+  if (!zcache_Gl.is_temp_enabled)
+    {
+      return false;
+    }
+
+  if (zcache_store (thread_p, vpid, io_page, true))
+    {
+      perfmon_inc_stat (thread_p, PSTAT_PB_ZCACHE_TEMP_STORES);
+      return true;
+    }
+
+  /* an older image of the page must not be written back over the one the caller writes */
+  zcache_remove (vpid);
+  return false;
+}
+
+/*
+ * zcache_get () - take the image of a page out of compressed cache
+ *   return: true if the page was found
+ *   thread_p(in): thread entry
+ *   vpid(in): page identifier
+ *   io_page(out): page image, as it is on disk
+ *   is_dirty(out): true if the disk does not have the image; the page must be flushed again
+ *
+ * Note: The page leaves the cache; it goes back to page buffer.
+ */
+bool
+zcache_get (THREAD_ENTRY * thread_p, const VPID * vpid, FILEIO_PAGE * io_page, bool * is_dirty)
+{
+  ZCACHE_PARTITION *partition;
+  ZCACHE_ENTRY *entry;
+  bool found = false;
+
+  *is_dirty = false;
+  if (!zcache_Gl.is_enabled)
+    {
+      return false;
+    }
+
+  partition = ZCACHE_GET_PARTITION (vpid);
+
+  (void) pthread_mutex_lock (&partition->mutex);
+  entry = zcache_detach_entry (partition, vpid);
+  pthread_mutex_unlock (&partition->mutex);
+
+  if (entry != NULL)
+    {
+      if (!entry->is_compressed)
+	{
+	  memcpy (io_page, entry->data, IO_PAGESIZE);
+	  found = true;
+	}
+      else if (LZ4_decompress_safe (entry->data, (char *) io_page, entry->length, IO_PAGESIZE) == IO_PAGESIZE)
+	{
+	  found = true;
+	}
+      else
+	{
+	  /* the disk has it anyway */
+	  assert (false);
+	}
+
+      *is_dirty = entry->is_dirty;
+      free (entry);
+    }
+
+  perfmon_inc_stat (thread_p, found ? PSTAT_PB_ZCACHE_HITS : PSTAT_PB_ZCACHE_MISSES);
+
+  return found;
+}
+
+/*
+ * zcache_remove () - drop a page from compressed cache, if it is there
+ *   return: void
+ *   vpid(in): page identifier
+ */
+void
+zcache_remove (const VPID * vpid)
+{
+  ZCACHE_PARTITION *partition;
+  ZCACHE_ENTRY *entry;
+
+  if (!zcache_Gl.is_enabled)
+    {
+      return;
+    }
+
+  partition = ZCACHE_GET_PARTITION (vpid);
+
+  (void) pthread_mutex_lock (&partition->mutex);
+  entry = zcache_detach_entry (partition, vpid);
+  pthread_mutex_unlock (&partition->mutex);
+
+  if (entry != NULL)
+    {
+      free (entry);
+    }
+}
+
+/*
+ * zcache_remove_volume () - drop all pages of a volume from compressed cache
+ *   return: void
+ *   volid(in): volume identifier or NULL_VOLID for all volumes
+ */
+void
+zcache_remove_volume (VOLID volid)
+{
+  ZCACHE_PARTITION *partition;
+  ZCACHE_ENTRY *entry, *next_entry, *dropped_entries;
+  int i;
+
+  if (!zcache_Gl.is_enabled)
+    {
+      return;
+    }
+
+  for (i = 0; i < ZCACHE_NUM_PARTITIONS; i++)
+    {
+      partition = &zcache_Gl.partitions[i];
+      dropped_entries = NULL;
+
+      (void) pthread_mutex_lock (&partition->mutex);
+      for (entry = partition->lru_top; entry != NULL; entry = next_entry)
+	{
+	  next_entry = entry->lru_next;
+	  if (volid == NULL_VOLID || entry->vpid.volid == volid)
+	    {
+	      zcache_unlink_entry (partition, entry);
+	      entry->lru_next = dropped_entries;
+	      dropped_entries = entry;
+	    }
+	}
+      pthread_mutex_unlock (&partition->mutex);
+
+      zcache_free_entries (dropped_entries);
+    }
+}
+
+/*
+ * zcache_get_size () - get the memory used by compressed cache
+ *   return: memory size in bytes
+ */
+UINT64
+zcache_get_size (void)
+{
+  UINT64 size = 0;
+  int i;
+
+  if (!zcache_Gl.is_enabled)
+    {
+      return 0;
+    }
+
+  for (i = 0; i < ZCACHE_NUM_PARTITIONS; i++)
+    {
+      size += (UINT64) zcache_Gl.partitions[i].size;
+    }
+
+  return size;
+}
+
+/*
+ * zcache_store () - compress and store the image of a page, replacing the old one
+ *   return: true if the page was stored
+ *   thread_p(in): thread entry
+ *   vpid(in): page identifier
+ *   io_page(in): page image
+ *   is_dirty(in): true if the disk does not have the image
+ *
+ * Note: The least recently stored pages of the partition are dropped to make room; the dirty ones are written first.
+ *       They are written while the partition is locked, so no newer image of the page can get to disk before.
+ */
+static bool
+zcache_store (THREAD_ENTRY * thread_p, const VPID * vpid, const FILEIO_PAGE * io_page, bool is_dirty)
+{
+  char zip_buf[LZ4_COMPRESSBOUND (IO_MAX_PAGE_SIZE)];
+  ZCACHE_PARTITION *partition;
+  ZCACHE_ENTRY *entry, *old_entry, *dropped_entries = NULL;
+  int zip_len;
+
+  partition = ZCACHE_GET_PARTITION (vpid);
+
+  zip_len = LZ4_compress_default ((const char *) io_page, zip_buf, IO_PAGESIZE, (int) sizeof (zip_buf));
+  if (zip_len <= 0 || zip_len >= IO_PAGESIZE)
+    {
+      /* not compressible, like encrypted pages are */
+      zip_len = 0;
+    }
+
+  if (ZCACHE_ENTRY_SIZE (zip_len > 0 ? zip_len : IO_PAGESIZE) > partition->max_size)
+    {
+      return false;
+    }
+
+  entry = (ZCACHE_ENTRY *) malloc (ZCACHE_ENTRY_SIZE (zip_len > 0 ? zip_len : IO_PAGESIZE));
+  if (entry == NULL)
+    {
+      return false;
+    }
+
+  VPID_COPY (&entry->vpid, vpid);
+  entry->is_dirty = is_dirty;
+  if (zip_len > 0)
+    {
+      entry->length = zip_len;
+      entry->is_compressed = true;
+      memcpy (entry->data, zip_buf, zip_len);
+    }
+  else
+    {
+      entry->length = IO_PAGESIZE;
+      entry->is_compressed = false;
+      memcpy (entry->data, io_page, IO_PAGESIZE);
+    }
+
+  (void) pthread_mutex_lock (&partition->mutex);
+
+  old_entry = zcache_detach_entry (partition, vpid);
+
+  /* make room */
+  while (partition->lru_bottom != NULL && partition->size + ZCACHE_ENTRY_SIZE (entry->length) > partition->max_size)
+    {
+      ZCACHE_ENTRY *victim = partition->lru_bottom;
+
+      if (victim->is_dirty && !zcache_write_back (thread_p, victim))
+	{
+	  /* keep the only image of the page, even beyond the budget */
+	  er_clear ();
+	  break;
+	}
+
+      zcache_unlink_entry (partition, victim);
+      victim->lru_next = dropped_entries;
+      dropped_entries = victim;
+    }
+
+  zcache_link_entry (partition, entry);
+
+  pthread_mutex_unlock (&partition->mutex);
+
+  if (old_entry != NULL)
+    {
+      free (old_entry);
+    }
+  zcache_free_entries (dropped_entries);
+
+  return true;
+}
+
+/*
+ * zcache_link_entry () - link an entry in the hash chain and on top of the LRU list of its partition
+ *   return: void
+ *   partition(in): partition of the entry
+ *   entry(in): new entry
+ *
+ * Note: The caller holds the partition mutex.
+ */
+static void
+zcache_link_entry (ZCACHE_PARTITION * partition, ZCACHE_ENTRY * entry)
+{
+  int bucket = ZCACHE_GET_BUCKET (&entry->vpid);
+
+  entry->hash_next = partition->hash_table[bucket];
+  partition->hash_table[bucket] = entry;
+  entry->lru_prev = NULL;
+  entry->lru_next = partition->lru_top;
+  if (partition->lru_top != NULL)
+    {
+      partition->lru_top->lru_prev = entry;
+    }
+  partition->lru_top = entry;
+  if (partition->lru_bottom == NULL)
+    {
+      partition->lru_bottom = entry;
+    }
+  partition->size += ZCACHE_ENTRY_SIZE (entry->length);
+}
+
+/*
+ * zcache_write_back () - write the image of a dirty entry to disk
+ *   return: true if written
+ *   thread_p(in): thread entry
+ *   entry(in): dirty entry
+ */
+static bool
+zcache_write_back (THREAD_ENTRY * thread_p, ZCACHE_ENTRY * entry)
+{
+  char page_buf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT];
+  FILEIO_PAGE *io_page = (FILEIO_PAGE *) PTR_ALIGN (page_buf, MAX_ALIGNMENT);
+  const void *image = entry->data;
+
+  assert (entry->is_dirty);
+
+  if (entry->is_compressed)
+    {
+      if (LZ4_decompress_safe (entry->data, (char *) io_page, entry->length, IO_PAGESIZE) != IO_PAGESIZE)
+	{
+	  assert (false);
+	  return false;
+	}
+      image = io_page;
+    }
+
+  perfmon_inc_stat (thread_p, PSTAT_PB_ZCACHE_WRITE_BACKS);
+  perfmon_inc_stat (thread_p, PSTAT_PB_NUM_IOWRITES);
+  if (fileio_write (thread_p, fileio_get_volume_descriptor (entry->vpid.volid), (void *) image, entry->vpid.pageid,
+		    IO_PAGESIZE, FILEIO_WRITE_DEFAULT_WRITE) == NULL)
+    {
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * zcache_detach_entry () - find the entry of a page and unlink it from its partition
+ *   return: entry or NULL if page is not cached
+ *   partition(in): partition of the page
+ *   vpid(in): page identifier
+ *
+ * Note: The caller holds the partition mutex.
+ */
+static ZCACHE_ENTRY *
+zcache_detach_entry (ZCACHE_PARTITION * partition, const VPID * vpid)
+{
+  ZCACHE_ENTRY *entry;
+
+  for (entry = partition->hash_table[ZCACHE_GET_BUCKET (vpid)]; entry != NULL; entry = entry->hash_next)
+    {
+      if (VPID_EQ (&entry->vpid, vpid))
+	{
+	  zcache_unlink_entry (partition, entry);
+	  return entry;
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * zcache_unlink_entry () - unlink an entry from the hash chain and LRU list of its partition
+ *   return: void
+ *   partition(in): partition of the entry
+ *   entry(in): cached entry
+ *
+ * Note: The caller holds the partition mutex.
+ */
+static void
+zcache_unlink_entry (ZCACHE_PARTITION * partition, ZCACHE_ENTRY * entry)
+{
+  ZCACHE_ENTRY **link;
+
+  for (link = &partition->hash_table[ZCACHE_GET_BUCKET (&entry->vpid)]; *link != entry; link = &(*link)->hash_next)
+    {
+      assert (*link != NULL);
+    }
+  *link = entry->hash_next;
+
+  if (entry->lru_prev != NULL)
+    {
+      entry->lru_prev->lru_next = entry->lru_next;
+    }
+  else
+    {
+      partition->lru_top = entry->lru_next;
+    }
+  if (entry->lru_next != NULL)
+    {
+      entry->lru_next->lru_prev = entry->lru_prev;
+    }
+  else
+    {
+      partition->lru_bottom = entry->lru_prev;
+    }
+
+  partition->size -= ZCACHE_ENTRY_SIZE (entry->length);
+  assert (partition->size >= 0);
+}
+
+/*
+ * zcache_free_entries () - free a list of entries linked by lru_next
+ *   return: void
+ *   entries(in): first entry of the list
+ */
+static void
+zcache_free_entries (ZCACHE_ENTRY * entries)
+{
+  ZCACHE_ENTRY *next_entry;
+
+  while (entries != NULL)
+    {
+      next_entry = entries->lru_next;
+      free (entries);
+      entries = next_entry;
+    }
+}
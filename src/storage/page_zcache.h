@@ -0,0 +1,50 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * page_zcache.h - compressed cache of the clean pages evicted from page buffer
+ */
+
+#ifndef _PAGE_ZCACHE_H_
+#define _PAGE_ZCACHE_H_
+
+#ident "$Id$"
+
+#include "file_io.h"
+#include "storage_common.h"
+
+/*
+ * The compressed cache is a second tier between page buffer and disk. It keeps the images of the clean pages the
+ * page buffer evicted, exactly as they are on disk (encrypted pages stay encrypted), so a miss in page buffer can be
+ * served without reading the disk.
+ * A page is in compressed cache only while it is not in page buffer: page buffer takes it back (or drops it) whenever
+ * it allocates a buffer for the page, so the image in cache can never be older than the disk one.
+ * Optionally, the flushed temporary pages are kept too, instead of being written: their images are newer than the disk
+ * ones and are written only when the cache drops them, so a spilled query result may never reach the temp volumes.
+ */
+extern int zcache_initialize (void);
+extern void zcache_finalize (void);
+extern bool zcache_is_enabled (void);
+extern void zcache_put (THREAD_ENTRY * thread_p, const VPID * vpid, const FILEIO_PAGE * io_page);
+extern bool zcache_put_temp (THREAD_ENTRY * thread_p, const VPID * vpid, const FILEIO_PAGE * io_page);
+extern bool zcache_get (THREAD_ENTRY * thread_p, const VPID * vpid, FILEIO_PAGE * io_page, bool * is_dirty);
+extern void zcache_remove (const VPID * vpid);
+extern void zcache_remove_volume (VOLID volid);
+extern UINT64 zcache_get_size (void);
+
+#endif /* _PAGE_ZCACHE_H_ */
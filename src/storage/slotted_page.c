@@ -38,6 +38,7 @@
 #include "memory_hash.h"
 #include "object_representation.h"
 #include "page_buffer.h"
+#include "perf_hotpath.hpp"
 #include "porting_inline.hpp"
 #include "log_manager.h"
 #include "critical_section.h"
@@ -63,6 +64,10 @@ static int rv;
 #define SPAGE_SEARCH_NEXT       1
 #define SPAGE_SEARCH_PREV       -1
 
+/* Free holes between records are searched in units of the maximum alignment */
+#define SPAGE_HOLE_UNIT         MAX_ALIGNMENT
+#define SPAGE_HOLE_MAX_UNITS    (IO_MAX_PAGE_SIZE / SPAGE_HOLE_UNIT)
+
 static PGLENGTH spage_User_page_size;
 
 #define SPAGE_DB_PAGESIZE \
@@ -180,6 +185,7 @@ static int spage_compare_slot_offset (const void *arg1, const void *arg2);
 static bool spage_is_slotted_page_type (PAGE_TYPE ptype);
 
 static int spage_check_space (THREAD_ENTRY * thread_p, PAGE_PTR page_p, SPAGE_HEADER * page_header_p, int space);
+static int spage_find_free_hole (PAGE_PTR page_p, SPAGE_HEADER * page_header_p, int space);
 static void spage_set_slot (SPAGE_SLOT * slot_p, int offset, int length, INT16 type);
 static int spage_find_empty_slot (THREAD_ENTRY * thread_p, PAGE_PTR pgptr, int length, INT16 type, SPAGE_SLOT ** sptr,
 				  int *space, PGSLOTID * slotid);
@@ -1363,6 +1369,82 @@ spage_check_space (THREAD_ENTRY * thread_p, PAGE_PTR page_p, SPAGE_HEADER * page
   return SP_SUCCESS;
 }
 
+/*
+ * spage_find_free_hole () - Find the smallest free area between the records of page that fits the given space
+ *   return: offset of free area, or SPAGE_EMPTY_OFFSET if no area fits
+ *
+ *   page_p(in): Pointer to slotted page
+ *   page_header_p(in): Pointer to header of slotted page
+ *   space(in): Length of record, including its alignment waste
+ *
+ * Note: The areas of deleted, shrunk or moved records are left between the other records until the page is
+ *       compacted. Putting a record in one of them saves the compaction, which moves all records of page. The areas
+ *       are found from the slots, in units of the maximum alignment; a unit used in part by a record is not free.
+ */
+static int
+spage_find_free_hole (PAGE_PTR page_p, SPAGE_HEADER * page_header_p, int space)
+{
+  UINT64 used_units[SPAGE_HOLE_MAX_UNITS / 64];
+  SPAGE_SLOT *slot_p;
+  int first_unit, end_unit, needed_units;
+  int unit, run_start, run_length;
+  int best_start = -1, best_length = 0;
+  int i;
+
+  SPAGE_VERIFY_HEADER (page_header_p);
+
+  if (page_header_p->total_free - page_header_p->cont_free < space)
+    {
+      /* the free areas between records are not that big all together */
+      return SPAGE_EMPTY_OFFSET;
+    }
+
+  first_unit = CEIL_PTVDIV (sizeof (SPAGE_HEADER), SPAGE_HOLE_UNIT);
+  end_unit = page_header_p->offset_to_free_area / SPAGE_HOLE_UNIT;
+  needed_units = CEIL_PTVDIV (space, SPAGE_HOLE_UNIT);
+  assert (end_unit <= SPAGE_HOLE_MAX_UNITS);
+
+  memset (used_units, 0, sizeof (used_units));
+  slot_p = spage_find_slot (page_p, page_header_p, 0, false);
+  for (i = 0; i < page_header_p->num_slots; slot_p--, i++)
+    {
+      if (slot_p->offset_to_record == SPAGE_EMPTY_OFFSET || slot_p->record_length == 0)
+	{
+	  continue;
+	}
+      for (unit = slot_p->offset_to_record / SPAGE_HOLE_UNIT;
+	   unit < CEIL_PTVDIV (slot_p->offset_to_record + slot_p->record_length, SPAGE_HOLE_UNIT) && unit < end_unit;
+	   unit++)
+	{
+	  used_units[unit / 64] |= ((UINT64) 1) << (unit % 64);
+	}
+    }
+
+  /* best fit: the smallest run of free units that fits */
+  run_start = first_unit;
+  for (unit = first_unit; unit <= end_unit; unit++)
+    {
+      if (unit < end_unit && (used_units[unit / 64] & (((UINT64) 1) << (unit % 64))) == 0)
+	{
+	  continue;
+	}
+
+      run_length = unit - run_start;
+      if (run_length >= needed_units && (best_start < 0 || run_length < best_length))
+	{
+	  best_start = run_start;
+	  best_length = run_length;
+	  if (run_length == needed_units)
+	    {
+	      break;
+	    }
+	}
+      run_start = unit + 1;
+    }
+
+  return best_start < 0 ? SPAGE_EMPTY_OFFSET : best_start * SPAGE_HOLE_UNIT;
+}
+
 /*
  * spage_set_slot () -
  *   return:
@@ -1405,6 +1487,7 @@ spage_find_empty_slot (THREAD_ENTRY * thread_p, PAGE_PTR page_p, int record_leng
   SPAGE_SLOT *slot_p;
   PGSLOTID slot_id;
   int waste, space, status;
+  int hole_offset;
 
   assert (page_p != NULL);
   assert (out_slot_p != NULL);
@@ -1445,15 +1528,25 @@ spage_find_empty_slot (THREAD_ENTRY * thread_p, PAGE_PTR page_p, int record_leng
       return SP_ERROR;
     }
 
+  hole_offset = SPAGE_EMPTY_OFFSET;
   if (slot_id == page_header_p->num_slots)
     {
       /* We are allocating a new slotid. Check for available space again */
       space += sizeof (SPAGE_SLOT);
 
-      status = spage_check_space (thread_p, page_p, page_header_p, space);
-      if (status != SP_SUCCESS)
+      if (space > page_header_p->cont_free && (int) sizeof (SPAGE_SLOT) <= page_header_p->cont_free
+	  && spage_has_enough_total_space (thread_p, page_p, page_header_p, space))
 	{
-	  return status;
+	  /* the new slot is taken from the contiguous free area, the record may fit between other records */
+	  hole_offset = spage_find_free_hole (page_p, page_header_p, record_length + waste);
+	}
+      if (hole_offset == SPAGE_EMPTY_OFFSET)
+	{
+	  status = spage_check_space (thread_p, page_p, page_header_p, space);
+	  if (status != SP_SUCCESS)
+	    {
+	      return status;
+	    }
 	}
 
       /* Adjust the number of slots */
@@ -1462,20 +1555,38 @@ spage_find_empty_slot (THREAD_ENTRY * thread_p, PAGE_PTR page_p, int record_leng
   else
     {
       /* We already know that there is total space available since the slot is reused and the space was checked above */
-      if (spage_has_enough_contiguous_space (thread_p, page_p, page_header_p, space) == false)
+      if (space > page_header_p->cont_free)
+	{
+	  hole_offset = spage_find_free_hole (page_p, page_header_p, space);
+	}
+      if (hole_offset == SPAGE_EMPTY_OFFSET
+	  && spage_has_enough_contiguous_space (thread_p, page_p, page_header_p, space) == false)
 	{
 	  return SP_ERROR;
 	}
     }
 
-  /* Now separate an empty area for the record */
-  spage_set_slot (slot_p, page_header_p->offset_to_free_area, record_length, record_type);
+  if (hole_offset != SPAGE_EMPTY_OFFSET)
+    {
+      /* Put the record between other records, instead of compacting the page */
+      spage_set_slot (slot_p, hole_offset, record_length, record_type);
+      ASSERT_ALIGN ((char *) page_p + hole_offset, page_header_p->alignment);
 
-  /* Adjust the header */
-  page_header_p->num_records++;
-  page_header_p->total_free -= space;
-  page_header_p->cont_free -= space;
-  page_header_p->offset_to_free_area += (record_length + waste);
+      page_header_p->num_records++;
+      page_header_p->total_free -= space;
+      page_header_p->cont_free -= (space - record_length - waste);
+    }
+  else
+    {
+      /* Now separate an empty area for the record */
+      spage_set_slot (slot_p, page_header_p->offset_to_free_area, record_length, record_type);
+
+      /* Adjust the header */
+      page_header_p->num_records++;
+      page_header_p->total_free -= space;
+      page_header_p->cont_free -= space;
+      page_header_p->offset_to_free_area += (record_length + waste);
+    }
 
   ASSERT_ALIGN ((char *) page_p + page_header_p->offset_to_free_area, page_header_p->alignment);
 
@@ -1776,6 +1887,7 @@ spage_check_record_for_insert (RECDES * record_descriptor_p)
 int
 spage_insert (THREAD_ENTRY * thread_p, PAGE_PTR page_p, RECDES * record_descriptor_p, PGSLOTID * out_slot_id_p)
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_SPAGE_INSERT);
   SPAGE_SLOT *slot_p;
   int used_space;
   int status;
@@ -2473,6 +2585,7 @@ spage_update_record_after_compact (THREAD_ENTRY * thread_p, PAGE_PTR page_p, SPA
 				   int new_waste)
 {
   int old_offset;
+  int hole_offset;
 
   SPAGE_VERIFY_HEADER (page_header_p);
 
@@ -2499,6 +2612,26 @@ spage_update_record_after_compact (THREAD_ENTRY * thread_p, PAGE_PTR page_p, SPA
     }
   else if (record_descriptor_p->length + new_waste > page_header_p->cont_free)
     {
+      hole_offset = spage_find_free_hole (page_p, page_header_p, record_descriptor_p->length + new_waste);
+      if (hole_offset != SPAGE_EMPTY_OFFSET)
+	{
+	  /* Put the record between other records, instead of compacting the page. The old area is a free hole now. */
+	  spage_set_slot (slot_p, hole_offset, record_descriptor_p->length, slot_p->record_type);
+	  ASSERT_ALIGN ((char *) page_p + hole_offset, page_header_p->alignment);
+	  if (SPAGE_OVERFLOW (hole_offset + record_descriptor_p->length))
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	      assert_release (false);
+	      return SP_ERROR;
+	    }
+	  memcpy (((char *) page_p + hole_offset), record_descriptor_p->data, record_descriptor_p->length);
+	  page_header_p->total_free -= space;
+
+	  spage_verify_header (page_p);
+
+	  return SP_SUCCESS;
+	}
+
       /*
        * Full compaction: eliminate record from compaction (like a quick
        * delete). Compaction always finish with the correct amount of free
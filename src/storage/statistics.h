@@ -43,6 +43,9 @@
 
 #define STATS_MIN_MAX_SIZE    sizeof(DB_DATA)
 
+/* most common values kept for each column */
+#define STATS_MCV_NUM         3
+
 /* free_and_init routine */
 #define stats_free_statistics_and_init(stats) \
   do \
@@ -71,6 +74,17 @@ struct btree_stats
 #endif
 };
 
+/* Value distribution of the attribute, gathered from a sample of the heap of the class */
+typedef struct attr_value_stats ATTR_VALUE_STATS;
+struct attr_value_stats
+{
+  int null_ppm;			/* rows having NULL, in parts per million; -1 if the statistics were never gathered */
+  int ndv;			/* estimated number of distinct non-NULL values; 0 if unknown */
+  int n_mcv;			/* number of the most common values; only counted for integer types */
+  DB_BIGINT mcv_values[STATS_MCV_NUM];	/* the most common values */
+  int mcv_ppm[STATS_MCV_NUM];	/* rows having each of the most common values, in parts per million */
+};
+
 /* Statistical Information about the attribute */
 typedef struct attr_stats ATTR_STATS;
 struct attr_stats
@@ -79,6 +93,7 @@ struct attr_stats
   DB_TYPE type;
   int n_btstats;		/* number of B+tree statistics information */
   BTREE_STATS *bt_stats;	/* pointer to array of BTREE_STATS[n_btstats] */
+  ATTR_VALUE_STATS value_stats;	/* value distribution */
 };
 
 /* Statistical Information about the class */
@@ -150,6 +150,23 @@ stats_client_unpack_statistics (char *buf_p)
       attr_stats_p->n_btstats = OR_GET_INT (buf_p);
       buf_p += OR_INT_SIZE;
 
+      attr_stats_p->value_stats.null_ppm = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      attr_stats_p->value_stats.ndv = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      attr_stats_p->value_stats.n_mcv = OR_GET_INT (buf_p);
+      buf_p += OR_INT_SIZE;
+
+      assert (attr_stats_p->value_stats.n_mcv >= 0 && attr_stats_p->value_stats.n_mcv <= STATS_MCV_NUM);
+      for (j = 0; j < STATS_MCV_NUM; j++)
+	{
+	  OR_GET_BIGINT (buf_p, &attr_stats_p->value_stats.mcv_values[j]);
+	  attr_stats_p->value_stats.mcv_ppm[j] = OR_GET_INT (buf_p + OR_BIGINT_SIZE);
+	  buf_p += OR_BIGINT_SIZE + OR_INT_SIZE;
+	}
+
       if (attr_stats_p->n_btstats <= 0)
 	{
 	  attr_stats_p->bt_stats = NULL;
@@ -479,6 +496,19 @@ stats_dump (const char *class_name_p, FILE * file_p)
 	  break;
 	}
 
+      if (attr_stats_p->value_stats.null_ppm >= 0)
+	{
+	  fprintf (file_p, "    Value statistics:\n");
+	  fprintf (file_p, "        Null fraction: %.6f , Distinct values: %d\n",
+		   attr_stats_p->value_stats.null_ppm / 1000000.0, attr_stats_p->value_stats.ndv);
+	  for (j = 0; j < attr_stats_p->value_stats.n_mcv; j++)
+	    {
+	      fprintf (file_p, "        Most common value: %lld , Fraction: %.6f\n",
+		       (long long) attr_stats_p->value_stats.mcv_values[j],
+		       attr_stats_p->value_stats.mcv_ppm[j] / 1000000.0);
+	    }
+	}
+
       if (attr_stats_p->n_btstats > 0)
 	{
 	  fprintf (file_p, "    B+tree statistics:\n");
@@ -35,12 +35,34 @@
 #include "boot_sr.h"
 #include "partition_sr.h"
 #include "object_primitive.h"
+#include "dbtype.h"
 #include "object_representation.h"
 #include "thread_entry.hpp"
 #include "system_parameter.h"
+#if defined (SERVER_MODE)
+#include "thread_daemon.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_looper.hpp"
+#include "thread_manager.hpp"
+#endif /* SERVER_MODE */
 
 #define SQUARE(n) ((n)*(n))
 
+/* heap pages decoded to gather the value statistics of a class, in blocks of STATS_SAMPLING_LEAFS_MAX pages */
+#define STATS_VALUE_SAMPLING_PAGES  1024
+
+/* distinct values counted for each column; a power of 2 */
+#define STATS_VALUE_TABLE_BITS      12
+#define STATS_VALUE_TABLE_SIZE      (1 << STATS_VALUE_TABLE_BITS)
+#define STATS_VALUE_TABLE_FULL      (STATS_VALUE_TABLE_SIZE / 4 * 3)
+
+/* classes whose modified rows are counted; a class that finds no free slot among its probes is not counted */
+#define STATS_MOD_TABLE_SIZE        4096
+#define STATS_MOD_TABLE_PROBES      8
+
+/* modified rows below which the refresher does not look at a class */
+#define STATS_REFRESH_MIN_ROWS      100
+
 /* Used by the "stats_update_all_statistics" routine to create the list of all
    classes from the extensible hashing directory used by the catalog manager. */
 typedef struct class_id_list CLASS_ID_LIST;
@@ -50,6 +72,40 @@ struct class_id_list
   CLASS_ID_LIST *next;
 };
 
+/* Counts the values of one column of the sampled rows */
+typedef struct stats_value_counter STATS_VALUE_COUNTER;
+struct stats_value_counter
+{
+  DISK_ATTR *disk_attr;
+  int n_nulls;			/* sampled rows having NULL */
+  int n_values;			/* sampled rows having a value */
+  int n_distinct;		/* distinct values in the table */
+  int n_values_at_full;		/* n_values when the table got full; 0 while it is not */
+  DB_BIGINT *values;		/* open addressing table of the values; NULL if the type is not counted */
+  int *counts;			/* the rows having each value of the table; 0 for an empty slot */
+};
+
+/* Rows modified in a class since its statistics were last updated, counted in memory only */
+typedef struct stats_mod_slot STATS_MOD_SLOT;
+struct stats_mod_slot
+{
+  OID class_oid;		/* written before is_used is set, never changed while it is set */
+  volatile INT64 n_modified;
+  volatile int is_used;
+};
+
+/* The indexes of a class whose statistics are gathered by the stats workers */
+typedef struct stats_btree_work STATS_BTREE_WORK;
+struct stats_btree_work
+{
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  int tran_index;		/* transaction updating the statistics */
+  bool with_fullscan;
+  int n_running;		/* indexes given to workers and not done yet */
+  int error_code;		/* first error of the workers */
+};
+
 typedef struct partition_stats_acumulator PARTITION_STATS_ACUMULATOR;
 struct partition_stats_acumulator
 {
@@ -70,8 +126,51 @@ static int stats_compare_utime (DB_UTIME * utime1, DB_UTIME * utime2);
 static int stats_compare_datetime (DB_DATETIME * datetime1_p, DB_DATETIME * datetime2_p);
 static int stats_compare_money (DB_MONETARY * mn1, DB_MONETARY * mn2);
 #endif
+static int stats_gather_value_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p,
+					  DISK_REPR * disk_repr_p, int npages, bool with_fullscan);
+static void stats_count_value (STATS_VALUE_COUNTER * counter_p, DB_BIGINT value);
+static void stats_set_value_statistics (STATS_VALUE_COUNTER * counter_p, int n_rows, double sampled_ratio);
+static int stats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_fullscan, bool is_incremental,
+				    bool is_background);
+static int stats_update_btree_and_value_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, CLS_INFO * cls_info_p,
+						    DISK_REPR * disk_repr_p, int npages, bool with_fullscan);
+static STATS_MOD_SLOT *stats_find_mod_slot (const OID * class_oid, bool is_add);
+static void stats_add_modifications (const OID * class_oid, INT64 n_modified);
+static bool stats_is_stale (const OID * class_id_p, const CLS_INFO * cls_info_p);
+static void stats_reset_modifications (const OID * class_id_p);
 static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_oid, OID * partitions, int count,
-						bool with_fullscan);
+						bool with_fullscan, bool is_incremental, bool is_background);
+
+static STATS_MOD_SLOT stats_Mod_table[STATS_MOD_TABLE_SIZE];
+static pthread_mutex_t stats_Mod_table_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+#if defined (SERVER_MODE)
+// *INDENT-OFF*
+static cubthread::entry_workpool *stats_Workpool = NULL;
+
+class stats_refresh_daemon_context_manager : public cubthread::daemon_entry_manager
+{
+  private:
+    void on_daemon_create (cubthread::entry &context) final
+    {
+      /* to log the catalog updates */
+      context.claim_system_worker ();
+    }
+
+    void on_daemon_retire (cubthread::entry &context) final
+    {
+      context.retire_system_worker ();
+    }
+};
+
+static cubthread::daemon *stats_Refresh_daemon = NULL;
+static stats_refresh_daemon_context_manager *stats_Refresh_daemon_context_manager = NULL;
+// *INDENT-ON*
+
+static void stats_refresh_execute (cubthread::entry & thread_ref);
+static void stats_btree_stats_execute (cubthread::entry & thread_ref, STATS_BTREE_WORK * work_p,
+				       BTREE_STATS * btree_stats_p);
+#endif /* SERVER_MODE */
 
 /*
  * xstats_update_statistics () -  Updates the statistics for the objects
@@ -103,16 +202,31 @@ static int stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * c
  */
 int
 xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_fullscan)
+{
+  bool is_incremental = !with_fullscan && prm_get_bool_value (PRM_ID_STATS_INCREMENTAL_UPDATE);
+
+  return stats_update_statistics (thread_p, class_id_p, with_fullscan, is_incremental, false);
+}
+
+/*
+ * stats_update_statistics () - Updates the statistics of a class
+ *   return: NO_ERROR or error code
+ *   class_id_p(in): Identifier of the class
+ *   with_fullscan(in): true iff WITH FULLSCAN
+ *   is_incremental(in): keep the statistics of a heap, or of a partition, with few rows modified since they were
+ *			 updated
+ *   is_background(in): run by the refresher, which has no transaction to release its locks at commit
+ */
+static int
+stats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_fullscan, bool is_incremental,
+			 bool is_background)
 {
   CLS_INFO *cls_info_p = NULL;
   REPR_ID repr_id;
   DISK_REPR *disk_repr_p = NULL;
-  DISK_ATTR *disk_attr_p = NULL;
-  BTREE_STATS *btree_stats_p = NULL;
   OID dir_oid;
   int npages, estimated_nobjs;
   char *class_name = NULL;
-  int i, j;
   OID *partitions = NULL;
   int count = 0, error_code = NO_ERROR;
   int lk_grant_code = 0;
@@ -201,13 +315,21 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
       /* Update statistics for all partitions and the partitioned class */
       assert (partitions != NULL);
       catalog_free_class_info_and_init (cls_info_p);
-      error_code = stats_update_partitioned_statistics (thread_p, class_id_p, partitions, count, with_fullscan);
+      error_code = stats_update_partitioned_statistics (thread_p, class_id_p, partitions, count, with_fullscan,
+							is_incremental, is_background);
       db_private_free (thread_p, partitions);
       if (error_code != NO_ERROR)
 	{
 	  goto error;
 	}
+      stats_reset_modifications (class_id_p);
+
+      goto end;
+    }
 
+  if (is_incremental && cls_info_p->ci_time_stamp > 0 && !stats_is_stale (class_id_p, cls_info_p))
+    {
+      /* few rows were modified since the statistics were updated; keep them */
       goto end;
     }
 
@@ -250,33 +372,13 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
       cls_info_p->ci_tot_objects = estimated_nobjs;
     }
 
-  /* update the index statistics for each attribute */
-
-  for (i = 0; i < disk_repr_p->n_fixed + disk_repr_p->n_variable; i++)
+  /* update the index statistics and the value statistics of each attribute */
+  error_code = stats_update_btree_and_value_statistics (thread_p, class_id_p, cls_info_p, disk_repr_p, npages,
+							with_fullscan);
+  if (error_code != NO_ERROR)
     {
-      if (i < disk_repr_p->n_fixed)
-	{
-	  disk_attr_p = disk_repr_p->fixed + i;
-	}
-      else
-	{
-	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
-	}
-
-      for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
-	{
-	  assert_release (!BTID_IS_NULL (&btree_stats_p->btid));
-	  assert_release (btree_stats_p->pkeys_size > 0);
-	  assert_release (btree_stats_p->pkeys_size <= BTREE_STATS_PKEYS_NUM);
-
-	  if (btree_get_stats (thread_p, btree_stats_p, with_fullscan) != NO_ERROR)
-	    {
-	      goto error;
-	    }
-
-	  assert_release (btree_stats_p->keys >= 0);
-	}			/* for (j = 0; ...) */
-    }				/* for (i = 0; ...) */
+      goto error;
+    }
 
   error_code = catalog_start_access_with_dir_oid (thread_p, &catalog_access_info, X_LOCK);
   if (error_code != NO_ERROR)
@@ -301,12 +403,14 @@ xstats_update_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, bool with_f
     {
       goto error;
     }
+  stats_reset_modifications (class_id_p);
 
 end:
 
   (void) catalog_end_access_with_dir_oid (thread_p, &catalog_access_info, error_code);
 
-  lock_unlock_object (thread_p, class_id_p, oid_Root_class_oid, SCH_S_LOCK, false);
+  /* the refresher releases the lock at once, having no commit to release it */
+  lock_unlock_object (thread_p, class_id_p, oid_Root_class_oid, SCH_S_LOCK, is_background);
 
   if (disk_repr_p)
     {
@@ -340,6 +444,859 @@ error:
   goto end;
 }
 
+/*
+ * stats_gather_value_statistics () - Gathers the value distribution of the attributes of a class from a sample of
+ *				      its heap
+ *   return: NO_ERROR or error code
+ *   class_id_p(in): Identifier of the class
+ *   hfid_p(in): heap file of the class
+ *   disk_repr_p(in/out): disk representation whose value statistics are set
+ *   npages(in): number of pages of the heap file
+ *   with_fullscan(in): true iff WITH FULLSCAN
+ *
+ * Note: The heap is sampled by blocks of STATS_SAMPLING_LEAFS_MAX consecutive pages, one block out of every few, so
+ *       that about STATS_VALUE_SAMPLING_PAGES pages are decoded. Every page is still fixed to find the next one, but
+ *       only the rows of the sampled blocks are decoded and counted. The NULL fraction is gathered for all the
+ *       attributes; the number of distinct values and the most common values only for the integer ones.
+ */
+static int
+stats_gather_value_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, HFID * hfid_p, DISK_REPR * disk_repr_p,
+			       int npages, bool with_fullscan)
+{
+  STATS_VALUE_COUNTER *counters = NULL, *counter_p;
+  ATTR_ID *attr_ids = NULL;
+  HEAP_CACHE_ATTRINFO attr_info;
+  HEAP_SCANCACHE scan_cache;
+  MVCC_SNAPSHOT *mvcc_snapshot;
+  RECDES recdes = RECDES_INITIALIZER;
+  OID oid;
+  VPID cur_vpid;
+  DB_VALUE *value_p;
+  SCAN_CODE scan_code;
+  bool is_attr_info_started = false, is_scan_cache_started = false;
+  bool is_sampled_page = false, continue_checking = true;
+  int n_attrs, n_pages_seen, n_pages_sampled, n_rows, block_stride;
+  int i, error_code = NO_ERROR;
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+  if (n_attrs <= 0)
+    {
+      return NO_ERROR;
+    }
+
+  /* the refresher runs in the system transaction, which has no snapshot; it counts every version of the rows */
+  mvcc_snapshot = logtb_get_mvcc_snapshot (thread_p);
+
+  counters = (STATS_VALUE_COUNTER *) db_private_alloc (thread_p, n_attrs * sizeof (STATS_VALUE_COUNTER));
+  attr_ids = (ATTR_ID *) db_private_alloc (thread_p, n_attrs * sizeof (ATTR_ID));
+  if (counters == NULL || attr_ids == NULL)
+    {
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, n_attrs * sizeof (STATS_VALUE_COUNTER));
+      goto end;
+    }
+  memset (counters, 0, n_attrs * sizeof (STATS_VALUE_COUNTER));
+
+  for (i = 0, counter_p = counters; i < n_attrs; i++, counter_p++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  counter_p->disk_attr = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  counter_p->disk_attr = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+      attr_ids[i] = counter_p->disk_attr->id;
+
+      switch (counter_p->disk_attr->type)
+	{
+	case DB_TYPE_SHORT:
+	case DB_TYPE_INTEGER:
+	case DB_TYPE_BIGINT:
+	  counter_p->values = (DB_BIGINT *) db_private_alloc (thread_p, STATS_VALUE_TABLE_SIZE * sizeof (DB_BIGINT));
+	  counter_p->counts = (int *) db_private_alloc (thread_p, STATS_VALUE_TABLE_SIZE * sizeof (int));
+	  if (counter_p->values == NULL || counter_p->counts == NULL)
+	    {
+	      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, STATS_VALUE_TABLE_SIZE * sizeof (DB_BIGINT));
+	      goto end;
+	    }
+	  memset (counter_p->counts, 0, STATS_VALUE_TABLE_SIZE * sizeof (int));
+	  break;
+
+	default:
+	  break;
+	}
+    }
+
+  /* sample one block of pages out of every block_stride */
+  if (with_fullscan || npages <= STATS_VALUE_SAMPLING_PAGES)
+    {
+      block_stride = 1;
+    }
+  else
+    {
+      block_stride = CEIL_PTVDIV (npages, STATS_VALUE_SAMPLING_PAGES);
+    }
+
+  error_code = heap_attrinfo_start (thread_p, class_id_p, n_attrs, attr_ids, &attr_info);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  is_attr_info_started = true;
+
+  error_code = heap_scancache_start (thread_p, &scan_cache, hfid_p, class_id_p, true, false, mvcc_snapshot);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+  is_scan_cache_started = true;
+
+  n_pages_seen = n_pages_sampled = n_rows = 0;
+  VPID_SET_NULL (&cur_vpid);
+  OID_SET_NULL (&oid);
+  oid.volid = hfid_p->vfid.volid;
+
+  while ((scan_code = heap_next (thread_p, hfid_p, class_id_p, &oid, &recdes, &scan_cache, PEEK)) == S_SUCCESS)
+    {
+      if (oid.pageid != cur_vpid.pageid || oid.volid != cur_vpid.volid)
+	{
+	  /* the first row of another page */
+	  cur_vpid.volid = oid.volid;
+	  cur_vpid.pageid = oid.pageid;
+	  is_sampled_page = ((n_pages_seen / STATS_SAMPLING_LEAFS_MAX) % block_stride) == 0;
+	  n_pages_seen++;
+	  if (is_sampled_page)
+	    {
+	      n_pages_sampled++;
+	    }
+
+	  if (logtb_is_interrupted (thread_p, true, &continue_checking))
+	    {
+	      error_code = ER_INTERRUPTED;
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 0);
+	      goto end;
+	    }
+	}
+
+      if (!is_sampled_page)
+	{
+	  continue;
+	}
+
+      error_code = heap_attrinfo_read_dbvalues (thread_p, &oid, &recdes, NULL, &attr_info);
+      if (error_code != NO_ERROR)
+	{
+	  goto end;
+	}
+      n_rows++;
+
+      for (i = 0, counter_p = counters; i < n_attrs; i++, counter_p++)
+	{
+	  value_p = heap_attrinfo_access (counter_p->disk_attr->id, &attr_info);
+	  if (value_p == NULL || DB_IS_NULL (value_p))
+	    {
+	      counter_p->n_nulls++;
+	      continue;
+	    }
+
+	  counter_p->n_values++;
+	  if (counter_p->values == NULL)
+	    {
+	      continue;
+	    }
+
+	  switch (DB_VALUE_TYPE (value_p))
+	    {
+	    case DB_TYPE_SHORT:
+	      stats_count_value (counter_p, db_get_short (value_p));
+	      break;
+	    case DB_TYPE_INTEGER:
+	      stats_count_value (counter_p, db_get_int (value_p));
+	      break;
+	    case DB_TYPE_BIGINT:
+	      stats_count_value (counter_p, db_get_bigint (value_p));
+	      break;
+	    default:
+	      break;
+	    }
+	}
+    }
+
+  if (scan_code == S_ERROR)
+    {
+      ASSERT_ERROR_AND_SET (error_code);
+      goto end;
+    }
+
+  if (n_rows > 0)
+    {
+      for (i = 0; i < n_attrs; i++)
+	{
+	  stats_set_value_statistics (&counters[i], n_rows, (double) n_pages_sampled / n_pages_seen);
+	}
+    }
+
+end:
+  if (is_scan_cache_started)
+    {
+      (void) heap_scancache_end (thread_p, &scan_cache);
+    }
+  if (is_attr_info_started)
+    {
+      heap_attrinfo_end (thread_p, &attr_info);
+    }
+
+  if (counters != NULL)
+    {
+      for (i = 0; i < n_attrs; i++)
+	{
+	  if (counters[i].values != NULL)
+	    {
+	      db_private_free_and_init (thread_p, counters[i].values);
+	    }
+	  if (counters[i].counts != NULL)
+	    {
+	      db_private_free_and_init (thread_p, counters[i].counts);
+	    }
+	}
+      db_private_free_and_init (thread_p, counters);
+    }
+  if (attr_ids != NULL)
+    {
+      db_private_free_and_init (thread_p, attr_ids);
+    }
+
+  return error_code;
+}
+
+/*
+ * stats_count_value () - Counts a value of a column in the table of its counter
+ *   return: nothing
+ *   counter_p(in/out): counter of the column
+ *   value(in): the value
+ *
+ * Note: Once the table is full, the values already in it are still counted but the new ones are not.
+ */
+static void
+stats_count_value (STATS_VALUE_COUNTER * counter_p, DB_BIGINT value)
+{
+  unsigned int slot;
+
+  slot = (unsigned int) (((UINT64) value * 0x9E3779B97F4A7C15ULL) >> (64 - STATS_VALUE_TABLE_BITS));
+  while (counter_p->counts[slot] != 0)
+    {
+      if (counter_p->values[slot] == value)
+	{
+	  counter_p->counts[slot]++;
+	  return;
+	}
+      slot = (slot + 1) & (STATS_VALUE_TABLE_SIZE - 1);
+    }
+
+  if (counter_p->n_distinct >= STATS_VALUE_TABLE_FULL)
+    {
+      if (counter_p->n_values_at_full == 0)
+	{
+	  counter_p->n_values_at_full = counter_p->n_values;
+	}
+      return;
+    }
+
+  counter_p->values[slot] = value;
+  counter_p->counts[slot] = 1;
+  counter_p->n_distinct++;
+}
+
+/*
+ * stats_set_value_statistics () - Sets the value statistics of a column from the counts of the sample
+ *   return: nothing
+ *   counter_p(in/out): counter of the column; the value statistics of its disk attribute are set
+ *   n_rows(in): number of sampled rows
+ *   sampled_ratio(in): fraction of the heap that was sampled
+ */
+static void
+stats_set_value_statistics (STATS_VALUE_COUNTER * counter_p, int n_rows, double sampled_ratio)
+{
+  ATTR_VALUE_STATS *stats_p = &counter_p->disk_attr->value_stats;
+  int mcv_counts[STATS_MCV_NUM];
+  double n_values, n_total_values, ndv;
+  int n_singletons, count, i, j;
+
+  assert (n_rows > 0 && sampled_ratio > 0);
+
+  stats_p->null_ppm = (int) ((double) counter_p->n_nulls * 1000000 / n_rows);
+  stats_p->ndv = 0;
+  stats_p->n_mcv = 0;
+
+  if (counter_p->values == NULL || counter_p->n_values == 0)
+    {
+      /* the distinct values are not counted */
+      return;
+    }
+
+  n_values = counter_p->n_values;
+  n_total_values = n_values / sampled_ratio;
+  if (counter_p->n_values_at_full > 0)
+    {
+      /* too many distinct values to count them all; assume the new ones keep coming at the same rate */
+      ndv = counter_p->n_distinct * n_total_values / counter_p->n_values_at_full;
+    }
+  else
+    {
+      /* Haas and Stokes' Duj1 estimator: the values seen only once in the sample hint at the ones never seen */
+      n_singletons = 0;
+      for (i = 0; i < STATS_VALUE_TABLE_SIZE; i++)
+	{
+	  if (counter_p->counts[i] == 1)
+	    {
+	      n_singletons++;
+	    }
+	}
+      ndv = (n_values * counter_p->n_distinct) / (n_values - n_singletons + n_singletons * sampled_ratio);
+    }
+  ndv = MAX (ndv, counter_p->n_distinct);
+  ndv = MIN (ndv, n_total_values);
+  stats_p->ndv = (int) MIN (ndv, (double) DB_INT32_MAX);
+
+  /* keep the values notably more common than the average one, the most common first */
+  for (i = 0; i < STATS_VALUE_TABLE_SIZE; i++)
+    {
+      count = counter_p->counts[i];
+      if (count < 2 || count * ndv <= 1.25 * n_values)
+	{
+	  continue;
+	}
+
+      j = stats_p->n_mcv;
+      if (j == STATS_MCV_NUM)
+	{
+	  if (mcv_counts[j - 1] >= count)
+	    {
+	      continue;
+	    }
+	  j--;
+	}
+      else
+	{
+	  stats_p->n_mcv++;
+	}
+
+      for (; j > 0 && mcv_counts[j - 1] < count; j--)
+	{
+	  mcv_counts[j] = mcv_counts[j - 1];
+	  stats_p->mcv_values[j] = stats_p->mcv_values[j - 1];
+	}
+      mcv_counts[j] = count;
+      stats_p->mcv_values[j] = counter_p->values[i];
+    }
+
+  for (i = 0; i < stats_p->n_mcv; i++)
+    {
+      stats_p->mcv_ppm[i] = (int) ((double) mcv_counts[i] * 1000000 / n_rows);
+    }
+}
+
+/*
+ * stats_update_btree_and_value_statistics () - Updates the index statistics and the value statistics of the
+ *						attributes of a class
+ *   return: NO_ERROR or error code
+ *   class_id_p(in): Identifier of the class
+ *   cls_info_p(in): class information
+ *   disk_repr_p(in/out): disk representation whose statistics are updated
+ *   npages(in): number of pages of the heap file
+ *   with_fullscan(in): true iff WITH FULLSCAN
+ *
+ * Note: The indexes are handed to the stats workers, one task each, while this thread samples the heap. An index that
+ *       finds no idle worker is done by this thread afterwards.
+ */
+static int
+stats_update_btree_and_value_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, CLS_INFO * cls_info_p,
+					 DISK_REPR * disk_repr_p, int npages, bool with_fullscan)
+{
+  DISK_ATTR *disk_attr_p;
+  BTREE_STATS *btree_stats_p;
+  bool *is_given = NULL;
+  int n_attrs, n_btstats, btree_index;
+  int i, j, error_code = NO_ERROR;
+#if defined (SERVER_MODE)
+  STATS_BTREE_WORK work;
+  bool is_work_started = false;
+#endif /* SERVER_MODE */
+
+  n_attrs = disk_repr_p->n_fixed + disk_repr_p->n_variable;
+  n_btstats = 0;
+  for (i = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+      n_btstats += disk_attr_p->n_btstats;
+    }
+
+  if (n_btstats > 0)
+    {
+      is_given = (bool *) db_private_alloc (thread_p, n_btstats * sizeof (bool));
+      if (is_given == NULL)
+	{
+	  error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, error_code, 1, n_btstats * sizeof (bool));
+	  return error_code;
+	}
+      memset (is_given, 0, n_btstats * sizeof (bool));
+    }
+
+#if defined (SERVER_MODE)
+  if (stats_Workpool != NULL && n_btstats > 0)
+    {
+      pthread_mutex_init (&work.mutex, NULL);
+      pthread_cond_init (&work.cond, NULL);
+      work.tran_index = LOG_FIND_THREAD_TRAN_INDEX (thread_p);
+      work.with_fullscan = with_fullscan;
+      work.n_running = 0;
+      work.error_code = NO_ERROR;
+      is_work_started = true;
+
+      for (i = 0, btree_index = 0; i < n_attrs; i++)
+	{
+	  if (i < disk_repr_p->n_fixed)
+	    {
+	      disk_attr_p = disk_repr_p->fixed + i;
+	    }
+	  else
+	    {
+	      disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	    }
+	  for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats;
+	       j++, btree_stats_p++, btree_index++)
+	    {
+	      // *INDENT-OFF*
+	      cubthread::entry_callable_task *task =
+		new cubthread::entry_callable_task (std::bind (stats_btree_stats_execute, std::placeholders::_1, &work,
+							       btree_stats_p));
+	      // *INDENT-ON*
+
+	      pthread_mutex_lock (&work.mutex);
+	      work.n_running++;
+	      pthread_mutex_unlock (&work.mutex);
+
+	      if (!thread_get_manager ()->try_task (*thread_p, stats_Workpool, task))
+		{
+		  /* all stats workers are busy; the rest of the indexes are left to this thread */
+		  task->retire ();
+
+		  pthread_mutex_lock (&work.mutex);
+		  work.n_running--;
+		  pthread_mutex_unlock (&work.mutex);
+		  break;
+		}
+	      is_given[btree_index] = true;
+	    }
+
+	  if (j < disk_attr_p->n_btstats)
+	    {
+	      break;
+	    }
+	}
+    }
+#endif /* SERVER_MODE */
+
+  error_code = stats_gather_value_statistics (thread_p, class_id_p, &cls_info_p->ci_hfid, disk_repr_p, npages,
+					      with_fullscan);
+  if (error_code != NO_ERROR)
+    {
+      goto end;
+    }
+
+  for (i = 0, btree_index = 0; i < n_attrs; i++)
+    {
+      if (i < disk_repr_p->n_fixed)
+	{
+	  disk_attr_p = disk_repr_p->fixed + i;
+	}
+      else
+	{
+	  disk_attr_p = disk_repr_p->variable + (i - disk_repr_p->n_fixed);
+	}
+      for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats;
+	   j++, btree_stats_p++, btree_index++)
+	{
+	  assert_release (!BTID_IS_NULL (&btree_stats_p->btid));
+	  assert_release (btree_stats_p->pkeys_size > 0);
+	  assert_release (btree_stats_p->pkeys_size <= BTREE_STATS_PKEYS_NUM);
+
+	  if (is_given[btree_index])
+	    {
+	      continue;
+	    }
+
+	  error_code = btree_get_stats (thread_p, btree_stats_p, with_fullscan);
+	  if (error_code != NO_ERROR)
+	    {
+	      goto end;
+	    }
+
+	  assert_release (btree_stats_p->keys >= 0);
+	}
+    }
+
+end:
+#if defined (SERVER_MODE)
+  if (is_work_started)
+    {
+      /* the workers use the disk representation; it must not be freed before they are done */
+      pthread_mutex_lock (&work.mutex);
+      while (work.n_running > 0)
+	{
+	  pthread_cond_wait (&work.cond, &work.mutex);
+	}
+      pthread_mutex_unlock (&work.mutex);
+
+      if (error_code == NO_ERROR && work.error_code != NO_ERROR)
+	{
+	  /* the error was set in the context of the worker */
+	  error_code = work.error_code;
+	  if (error_code == ER_INTERRUPTED)
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_INTERRUPTED, 0);
+	    }
+	  else
+	    {
+	      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_GENERIC_ERROR, 0);
+	    }
+	}
+
+      pthread_cond_destroy (&work.cond);
+      pthread_mutex_destroy (&work.mutex);
+    }
+#endif /* SERVER_MODE */
+
+  if (is_given != NULL)
+    {
+      db_private_free_and_init (thread_p, is_given);
+    }
+
+  return error_code;
+}
+
+#if defined (SERVER_MODE)
+/*
+ * stats_btree_stats_execute () - Gathers the statistics of an index on a stats worker
+ *   return: nothing
+ *   thread_ref(in): worker thread
+ *   work_p(in/out): the indexes of the class
+ *   btree_stats_p(in/out): statistics of the index
+ */
+static void
+stats_btree_stats_execute (cubthread::entry & thread_ref, STATS_BTREE_WORK * work_p, BTREE_STATS * btree_stats_p)
+{
+  int error_code;
+
+  /* run on behalf of the updating transaction; the worker context clears it when the task is retired */
+  thread_ref.tran_index = work_p->tran_index;
+
+  error_code = btree_get_stats (&thread_ref, btree_stats_p, work_p->with_fullscan);
+  assert_release (error_code != NO_ERROR || btree_stats_p->keys >= 0);
+
+  /* work_p must not be accessed once the count is down */
+  pthread_mutex_lock (&work_p->mutex);
+  if (error_code != NO_ERROR && work_p->error_code == NO_ERROR)
+    {
+      work_p->error_code = error_code;
+    }
+  work_p->n_running--;
+  pthread_cond_broadcast (&work_p->cond);
+  pthread_mutex_unlock (&work_p->mutex);
+}
+#endif /* SERVER_MODE */
+
+/*
+ * stats_find_mod_slot () - Finds the slot counting the modified rows of a class
+ *   return: the slot, or NULL if the class has none
+ *   class_oid(in): class
+ *   is_add(in): give the class a free slot if it has none
+ */
+static STATS_MOD_SLOT *
+stats_find_mod_slot (const OID * class_oid, bool is_add)
+{
+  STATS_MOD_SLOT *slot_p, *free_slot_p = NULL;
+  unsigned int hash;
+  int i;
+
+  hash = (unsigned int) OID_PSEUDO_KEY (class_oid);
+  for (i = 0; i < STATS_MOD_TABLE_PROBES; i++)
+    {
+      slot_p = &stats_Mod_table[(hash + i) % STATS_MOD_TABLE_SIZE];
+      if (ATOMIC_LOAD (&slot_p->is_used) && OID_EQ (&slot_p->class_oid, class_oid))
+	{
+	  return slot_p;
+	}
+    }
+
+  if (!is_add)
+    {
+      return NULL;
+    }
+
+  pthread_mutex_lock (&stats_Mod_table_mutex);
+  for (i = 0; i < STATS_MOD_TABLE_PROBES; i++)
+    {
+      slot_p = &stats_Mod_table[(hash + i) % STATS_MOD_TABLE_SIZE];
+      if (!slot_p->is_used)
+	{
+	  if (free_slot_p == NULL)
+	    {
+	      free_slot_p = slot_p;
+	    }
+	}
+      else if (OID_EQ (&slot_p->class_oid, class_oid))
+	{
+	  /* added by another thread */
+	  free_slot_p = slot_p;
+	  break;
+	}
+    }
+  if (free_slot_p != NULL && !free_slot_p->is_used)
+    {
+      COPY_OID (&free_slot_p->class_oid, class_oid);
+      free_slot_p->n_modified = 0;
+      ATOMIC_STORE (&free_slot_p->is_used, 1);
+    }
+  pthread_mutex_unlock (&stats_Mod_table_mutex);
+
+  return free_slot_p;
+}
+
+/*
+ * stats_add_modifications () - Counts rows modified in a class
+ *   return: nothing
+ *   class_oid(in): class
+ *   n_modified(in): number of modified rows
+ */
+static void
+stats_add_modifications (const OID * class_oid, INT64 n_modified)
+{
+  STATS_MOD_SLOT *slot_p;
+
+  slot_p = stats_find_mod_slot (class_oid, true);
+  if (slot_p != NULL)
+    {
+      (void) ATOMIC_INC (&slot_p->n_modified, n_modified);
+    }
+}
+
+/*
+ * stats_note_modification () - Counts a row inserted, updated or deleted in a class
+ *   return: nothing
+ *   class_oid(in): class of the row
+ *
+ * Note: The counts are kept in memory only and start again from zero when the server restarts.
+ */
+void
+stats_note_modification (const OID * class_oid)
+{
+  stats_add_modifications (class_oid, 1);
+}
+
+/*
+ * stats_is_stale () - Have enough rows of a class been modified since its statistics were updated?
+ *   return: true if its statistics should be updated
+ *   class_id_p(in): class
+ *   cls_info_p(in): class information
+ */
+static bool
+stats_is_stale (const OID * class_id_p, const CLS_INFO * cls_info_p)
+{
+  STATS_MOD_SLOT *slot_p;
+  INT64 threshold;
+
+  slot_p = stats_find_mod_slot (class_id_p, false);
+  if (slot_p == NULL)
+    {
+      return false;
+    }
+
+  threshold = (INT64) cls_info_p->ci_tot_objects * prm_get_integer_value (PRM_ID_STATS_REFRESH_THRESHOLD) / 100;
+  return ATOMIC_LOAD (&slot_p->n_modified) >= MAX (threshold, 1);
+}
+
+/*
+ * stats_reset_modifications () - Forgets the rows modified in a class, once its statistics are updated
+ *   return: nothing
+ *   class_id_p(in): class
+ */
+static void
+stats_reset_modifications (const OID * class_id_p)
+{
+  STATS_MOD_SLOT *slot_p;
+
+  slot_p = stats_find_mod_slot (class_id_p, false);
+  if (slot_p != NULL)
+    {
+      ATOMIC_STORE (&slot_p->n_modified, 0);
+    }
+}
+
+/*
+ * stats_workers_initialize () - Creates the workers gathering the statistics of the indexes
+ *   return: NO_ERROR
+ *
+ * Note: without workers (SA_MODE or stats_update_threads is 0), the indexes are done serially.
+ */
+int
+stats_workers_initialize (void)
+{
+#if defined (SERVER_MODE)
+  int worker_count;
+
+  if (stats_Workpool != NULL)
+    {
+      return NO_ERROR;
+    }
+
+  worker_count = prm_get_integer_value (PRM_ID_STATS_UPDATE_THREADS);
+  if (worker_count > 0)
+    {
+      /* updates share the workers; an index that does not find an idle worker is done by its updater */
+      stats_Workpool =
+	thread_get_manager ()->create_worker_pool (worker_count, worker_count, "stats_update_workers", NULL, 1, false);
+    }
+#endif /* SERVER_MODE */
+
+  return NO_ERROR;
+}
+
+/*
+ * stats_workers_finalize () - Destroys the stats workers
+ *   return: nothing
+ */
+void
+stats_workers_finalize (void)
+{
+#if defined (SERVER_MODE)
+  if (stats_Workpool != NULL)
+    {
+      thread_get_manager ()->destroy_worker_pool (stats_Workpool);
+    }
+#endif /* SERVER_MODE */
+}
+
+#if defined (SERVER_MODE)
+/*
+ * stats_refresh_execute () - Execute function of the statistics refresher daemon
+ *   return: nothing
+ *   thread_ref(in): daemon thread
+ *
+ * Note: The statistics of a class are updated, by sampling, once stats_refresh_threshold percent of its rows were
+ *       modified. The rows modified in a partition count for its partitioned class as well once the partition is
+ *       refreshed, so the partitioned class is refreshed in turn and only re-samples the stale partitions.
+ */
+static void
+stats_refresh_execute (cubthread::entry & thread_ref)
+{
+  STATS_MOD_SLOT *slot_p;
+  OID class_oid, root_oid;
+  INT64 n_modified;
+  int i, error_code;
+
+  if (!BO_IS_SERVER_RESTARTED ())
+    {
+      return;
+    }
+
+  for (i = 0; i < STATS_MOD_TABLE_SIZE; i++)
+    {
+      slot_p = &stats_Mod_table[i];
+      if (!ATOMIC_LOAD (&slot_p->is_used))
+	{
+	  continue;
+	}
+      n_modified = ATOMIC_LOAD (&slot_p->n_modified);
+      if (n_modified < STATS_REFRESH_MIN_ROWS)
+	{
+	  continue;
+	}
+      COPY_OID (&class_oid, &slot_p->class_oid);
+
+      error_code = stats_update_statistics (&thread_ref, &class_oid, STATS_WITH_SAMPLING, true, true);
+      if (error_code == NO_ERROR)
+	{
+	  if (ATOMIC_LOAD (&slot_p->n_modified) < n_modified
+	      && partition_find_root_class_oid (&thread_ref, &class_oid, &root_oid) == NO_ERROR
+	      && !OID_ISNULL (&root_oid) && !OID_EQ (&root_oid, &class_oid))
+	    {
+	      /* the partition was refreshed; its partitioned class is now stale too */
+	      stats_add_modifications (&root_oid, n_modified);
+	    }
+	  er_clear ();
+	}
+      else
+	{
+	  if (error_code != ER_UPDATE_STAT_CANNOT_GET_LOCK)
+	    {
+	      /* most likely the class was dropped; stop counting it */
+	      pthread_mutex_lock (&stats_Mod_table_mutex);
+	      ATOMIC_STORE (&slot_p->is_used, 0);
+	      pthread_mutex_unlock (&stats_Mod_table_mutex);
+	    }
+	  /* else, try again at the next wakeup */
+	  er_clear ();
+	}
+    }
+}
+
+/*
+ * stats_refresh_daemon_init () - Creates the statistics refresher daemon, if stats_auto_refresh_interval is set
+ *   return: nothing
+ */
+void
+stats_refresh_daemon_init (void)
+{
+  int interval_secs;
+
+  assert (stats_Refresh_daemon == NULL);
+
+  interval_secs = prm_get_integer_value (PRM_ID_STATS_AUTO_REFRESH_INTERVAL);
+  if (interval_secs <= 0)
+    {
+      return;
+    }
+
+  // *INDENT-OFF*
+  cubthread::looper looper = cubthread::looper (std::chrono::seconds (interval_secs));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (stats_refresh_execute);
+  // *INDENT-ON*
+
+  stats_Refresh_daemon_context_manager = new stats_refresh_daemon_context_manager ();
+  stats_Refresh_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "stats_refresh",
+								   stats_Refresh_daemon_context_manager);
+}
+
+/*
+ * stats_refresh_daemon_destroy () - Destroys the statistics refresher daemon
+ *   return: nothing
+ */
+void
+stats_refresh_daemon_destroy (void)
+{
+  if (stats_Refresh_daemon == NULL)
+    {
+      return;
+    }
+
+  cubthread::get_manager ()->destroy_daemon (stats_Refresh_daemon);
+  delete stats_Refresh_daemon_context_manager;
+  stats_Refresh_daemon_context_manager = NULL;
+}
+#endif /* SERVER_MODE */
+
 /*
  * xstats_update_all_statistics () - Updates the statistics
  *                                   for all the classes of the database
@@ -555,6 +1512,8 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
 	  + (OR_INT_SIZE	/* id of DISK_ATTR */
 	     + OR_INT_SIZE	/* type of DISK_ATTR */
 	     + OR_INT_SIZE	/* n_btstats of DISK_ATTR */
+	     + OR_INT_SIZE * 3	/* null_ppm, ndv, n_mcv of ATTR_VALUE_STATS */
+	     + (OR_BIGINT_SIZE + OR_INT_SIZE) * STATS_MCV_NUM	/* mcv_values[], mcv_ppm[] of ATTR_VALUE_STATS */
 	  ) * n_attrs);		/* number of attributes */
 
   size += ((OR_BTID_ALIGNED_SIZE	/* btid of BTREE_STATS */
@@ -664,6 +1623,26 @@ xstats_get_statistics_from_server (THREAD_ENTRY * thread_p, OID * class_id_p, un
       OR_PUT_INT (buf_p, disk_attr_p->n_btstats);
       buf_p += OR_INT_SIZE;
 
+      OR_PUT_INT (buf_p, disk_attr_p->value_stats.null_ppm);
+      buf_p += OR_INT_SIZE;
+
+      OR_PUT_INT (buf_p, disk_attr_p->value_stats.ndv);
+      buf_p += OR_INT_SIZE;
+
+      OR_PUT_INT (buf_p, disk_attr_p->value_stats.n_mcv);
+      buf_p += OR_INT_SIZE;
+
+      for (j = 0; j < STATS_MCV_NUM; j++)
+	{
+	  /* the unused ones are zeroed by the memset of the buffer */
+	  if (j < disk_attr_p->value_stats.n_mcv)
+	    {
+	      OR_PUT_BIGINT (buf_p, &disk_attr_p->value_stats.mcv_values[j]);
+	      OR_PUT_INT (buf_p + OR_BIGINT_SIZE, disk_attr_p->value_stats.mcv_ppm[j]);
+	    }
+	  buf_p += OR_BIGINT_SIZE + OR_INT_SIZE;
+	}
+
       for (j = 0, btree_stats_p = disk_attr_p->bt_stats; j < disk_attr_p->n_btstats; j++, btree_stats_p++)
 	{
 	  /* collect maximum unique keys info */
@@ -1206,6 +2185,8 @@ stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp)
  * partitions (in) : oids of partitions
  * int partitions_count (in) : number of partitions
  * with_fullscan(in): true iff WITH FULLSCAN
+ * is_incremental(in): keep the statistics of the partitions with few rows modified
+ * is_background(in): run by the refresher
  *
  * Note: Since, during plan generation we only have access to the partitioned
  * class, we have to keep an estimate of average statistics in this class. We
@@ -1221,7 +2202,7 @@ stats_dump_class_statistics (CLASS_STATS * class_stats, FILE * fpp)
  */
 static int
 stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p, OID * partitions, int partitions_count,
-				     bool with_fullscan)
+				     bool with_fullscan, bool is_incremental, bool is_background)
 {
   int i, j, k, btree_iter, m;
   int error = NO_ERROR;
@@ -1247,7 +2228,7 @@ stats_update_partitioned_statistics (THREAD_ENTRY * thread_p, OID * class_id_p,
 
   for (i = 0; i < partitions_count; i++)
     {
-      error = xstats_update_statistics (thread_p, &partitions[i], with_fullscan);
+      error = stats_update_statistics (thread_p, &partitions[i], with_fullscan, is_incremental, is_background);
       if (error != NO_ERROR)
 	{
 	  goto cleanup;
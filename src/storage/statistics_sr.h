@@ -36,6 +36,13 @@
 #include "object_representation_sr.h"
 
 extern unsigned int stats_get_time_stamp (void);
+extern void stats_note_modification (const OID * class_oid);
+extern int stats_workers_initialize (void);
+extern void stats_workers_finalize (void);
+#if defined (SERVER_MODE)
+extern void stats_refresh_daemon_init (void);
+extern void stats_refresh_daemon_destroy (void);
+#endif /* SERVER_MODE */
 extern const BTREE_STATS *stats_find_inherited_index_stats (OR_CLASSREP * cls_rep, OR_CLASSREP * subcls_rep,
 							    DISK_ATTR * subcls_attr, BTID * cls_btid);
 #if defined(CUBRID_DEBUG)
@@ -141,6 +141,16 @@ struct btree_node_split_info
 
 typedef char *PAGE_PTR;		/* Pointer to a page */
 
+/* Sequential read-ahead state of a page scan, see pgbuf_read_ahead_sequential () */
+typedef struct pgbuf_read_ahead PGBUF_READ_AHEAD;
+struct pgbuf_read_ahead
+{
+  VPID last_vpid;		/* the last page of the scan */
+  VPID ahead_vpid;		/* the pages before it are already requested */
+  int seq_count;		/* the number of consecutive pages read in a row */
+  bool is_hinted;		/* the scan is known to read the pages sequentially */
+};
+
 /* TODO - PAGE_TYPE is used for debugging */
 typedef enum
 {
@@ -1054,6 +1064,10 @@ typedef enum
   SHOWSTMT_TRAN_TABLES,
   SHOWSTMT_THREADS,
   SHOWSTMT_PAGE_BUFFER_STATUS,
+  SHOWSTMT_PAGE_BUFFER_RESIDENCY,
+  SHOWSTMT_WAIT_STATISTICS,
+  SHOWSTMT_WAIT_EVENTS,
+  SHOWSTMT_VACUUM_STATUS,
 
   /* append the new show statement types in here */
 
@@ -111,8 +111,19 @@ static int rv;
 #define CATALOG_DISK_ATTR_POSITION_OFF   16
 #define CATALOG_DISK_ATTR_CLASSOID_OFF   20
 #define CATALOG_DISK_ATTR_N_BTSTATS_OFF  28
+#define CATALOG_DISK_ATTR_VSTATS_OFF     32	/* value statistics; the rest of the attribute was never written */
 #define CATALOG_DISK_ATTR_SIZE           80
 
+/* The value statistics are valid only if tagged: the upper half of the first word is the magic, the lower half is the
+   number of the most common values. An attribute written before the value statistics existed is never tagged. */
+#define CATALOG_VSTATS_MAGIC_N_MCV_OFF   0
+#define CATALOG_VSTATS_NULL_PPM_OFF      4
+#define CATALOG_VSTATS_NDV_OFF           8
+#define CATALOG_VSTATS_MCV_VALUES_OFF    12
+#define CATALOG_VSTATS_MCV_PPM_OFF       (CATALOG_VSTATS_MCV_VALUES_OFF + OR_BIGINT_SIZE * STATS_MCV_NUM)
+#define CATALOG_VSTATS_SIZE              (CATALOG_VSTATS_MCV_PPM_OFF + OR_INT_SIZE * STATS_MCV_NUM)
+#define CATALOG_VSTATS_MAGIC             0x5653
+
 #define CATALOG_BT_STATS_BTID_OFF        0
 #define CATALOG_BT_STATS_LEAFS_OFF       OR_BTID_ALIGNED_SIZE
 #define CATALOG_BT_STATS_PAGES_OFF       16
@@ -368,6 +379,8 @@ static void catalog_get_disk_representation (DISK_REPR * disk_repr_p, char *rec_
 static void catalog_put_disk_representation (char *rec_p, DISK_REPR * disk_repr_p);
 static void catalog_get_disk_attribute (DISK_ATTR * attr_p, char *rec_p);
 static void catalog_put_disk_attribute (char *rec_p, DISK_ATTR * attr_p);
+static void catalog_get_value_statistics (ATTR_VALUE_STATS * stats_p, char *rec_p);
+static void catalog_put_value_statistics (char *rec_p, ATTR_VALUE_STATS * stats_p);
 static void catalog_put_btree_statistics (char *rec_p, BTREE_STATS * stat_p);
 static void catalog_get_class_info_from_record (CLS_INFO * class_info_p, char *rec_p);
 static void catalog_put_class_info_to_record (char *rec_p, CLS_INFO * class_info_p);
@@ -431,6 +444,34 @@ catalog_get_disk_attribute (DISK_ATTR * attr_p, char *rec_p)
   OR_GET_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   attr_p->n_btstats = OR_GET_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF);
   attr_p->bt_stats = NULL;
+  catalog_get_value_statistics (&attr_p->value_stats, rec_p + CATALOG_DISK_ATTR_VSTATS_OFF);
+}
+
+static void
+catalog_get_value_statistics (ATTR_VALUE_STATS * stats_p, char *rec_p)
+{
+  int magic_n_mcv, i;
+
+  magic_n_mcv = OR_GET_INT (rec_p + CATALOG_VSTATS_MAGIC_N_MCV_OFF);
+  stats_p->n_mcv = magic_n_mcv & 0xffff;
+  stats_p->null_ppm = OR_GET_INT (rec_p + CATALOG_VSTATS_NULL_PPM_OFF);
+  stats_p->ndv = OR_GET_INT (rec_p + CATALOG_VSTATS_NDV_OFF);
+
+  if ((magic_n_mcv >> 16) != CATALOG_VSTATS_MAGIC || stats_p->n_mcv > STATS_MCV_NUM || stats_p->null_ppm < 0
+      || stats_p->null_ppm > 1000000 || stats_p->ndv < 0)
+    {
+      /* never gathered */
+      stats_p->null_ppm = -1;
+      stats_p->ndv = 0;
+      stats_p->n_mcv = 0;
+      return;
+    }
+
+  for (i = 0; i < stats_p->n_mcv; i++)
+    {
+      OR_GET_BIGINT (rec_p + CATALOG_VSTATS_MCV_VALUES_OFF + (OR_BIGINT_SIZE * i), &stats_p->mcv_values[i]);
+      stats_p->mcv_ppm[i] = OR_GET_INT (rec_p + CATALOG_VSTATS_MCV_PPM_OFF + (OR_INT_SIZE * i));
+    }
 }
 
 static void
@@ -468,6 +509,30 @@ catalog_put_disk_attribute (char *rec_p, DISK_ATTR * attr_p)
 
   OR_PUT_OID (rec_p + CATALOG_DISK_ATTR_CLASSOID_OFF, &attr_p->classoid);
   OR_PUT_INT (rec_p + CATALOG_DISK_ATTR_N_BTSTATS_OFF, attr_p->n_btstats);
+  catalog_put_value_statistics (rec_p + CATALOG_DISK_ATTR_VSTATS_OFF, &attr_p->value_stats);
+}
+
+static void
+catalog_put_value_statistics (char *rec_p, ATTR_VALUE_STATS * stats_p)
+{
+  int i;
+
+  memset (rec_p, 0, CATALOG_VSTATS_SIZE);
+  if (stats_p->null_ppm < 0)
+    {
+      /* not gathered; leave it untagged */
+      return;
+    }
+
+  assert (stats_p->n_mcv >= 0 && stats_p->n_mcv <= STATS_MCV_NUM);
+  OR_PUT_INT (rec_p + CATALOG_VSTATS_MAGIC_N_MCV_OFF, (CATALOG_VSTATS_MAGIC << 16) | stats_p->n_mcv);
+  OR_PUT_INT (rec_p + CATALOG_VSTATS_NULL_PPM_OFF, stats_p->null_ppm);
+  OR_PUT_INT (rec_p + CATALOG_VSTATS_NDV_OFF, stats_p->ndv);
+  for (i = 0; i < stats_p->n_mcv; i++)
+    {
+      OR_PUT_BIGINT (rec_p + CATALOG_VSTATS_MCV_VALUES_OFF + (OR_BIGINT_SIZE * i), &stats_p->mcv_values[i]);
+      OR_PUT_INT (rec_p + CATALOG_VSTATS_MCV_PPM_OFF + (OR_INT_SIZE * i), stats_p->mcv_ppm[i]);
+    }
 }
 
 static void
@@ -2513,6 +2578,10 @@ catalog_copy_disk_attributes (DISK_ATTR * new_attrs_p, int new_attr_count, DISK_
 
 	  catalog_copy_btree_statistic (new_attr_p->bt_stats, new_attr_p->n_btstats, pre_attr_p->bt_stats,
 					pre_attr_p->n_btstats);
+	  if (new_attr_p->type == pre_attr_p->type)
+	    {
+	      new_attr_p->value_stats = pre_attr_p->value_stats;
+	    }
 	}
     }
 }
@@ -26,6 +26,7 @@
 #include <assert.h>
 
 #include <openssl/conf.h>
+#include <openssl/engine.h>
 #include <openssl/evp.h>
 #include <openssl/err.h>
 #include <openssl/sha.h>
@@ -45,8 +46,22 @@
 #include "system_parameter.h"
 #include "boot_sr.h"
 #include "file_io.h"
+#include "file_manager.h"
+#include "lock_manager.h"
+#include "log_manager.h"
+#include "page_buffer.h"
+#include "slotted_page.h"
+#include "perf_monitor.h"
+#include "perf_hotpath.hpp"
 #endif /* !CS_MODE */
 
+#if defined (SERVER_MODE)
+#include "thread_daemon.hpp"
+#include "thread_entry_task.hpp"
+#include "thread_looper.hpp"
+#include "thread_manager.hpp"
+#endif /* SERVER_MODE */
+
 #include "error_manager.h"
 #include "error_code.h"
 #include "log_storage.hpp"
@@ -71,21 +86,27 @@ TDE_CIPHER tde_Cipher;		/* global var for TDE Module */
 static OID tde_Keyinfo_oid = OID_INITIALIZER;	/* Location of keys */
 static HFID tde_Keyinfo_hfid = HFID_INITIALIZER;
 
+/* serializes the updates of the keyinfo: changing the master key, rotating and finishing rekeying the data key */
+static pthread_mutex_t tde_Keyinfo_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 static int tde_generate_keyinfo (TDE_KEYINFO * keyinfo, int mk_index, const unsigned char *master_key,
-				 const time_t created_time, const TDE_DATA_KEY_SET * dks);
-static int tde_update_keyinfo (THREAD_ENTRY * thread_p, const TDE_KEYINFO * keyinfo);
+				 const time_t created_time, const TDE_DATA_KEY_SET * dks, int dk_perm_gen,
+				 const unsigned char *perm_key_prev);
+static int tde_update_keyinfo (THREAD_ENTRY * thread_p, const TDE_KEYINFO * keyinfo,
+			       UPDATE_INPLACE_STYLE update_inplace);
+static int tde_finish_rekeying (THREAD_ENTRY * thread_p);
 
 static int tde_create_keys_file (const char *keyfile_fullname);
 static bool tde_validate_mk (const unsigned char *master_key, const unsigned char *mk_hash);
 static void tde_make_mk_hash (const unsigned char *master_key, unsigned char *mk_hash);
 static int tde_load_dks (const unsigned char *master_key, const TDE_KEYINFO * keyinfo);
 static int tde_create_dk (unsigned char *data_key);
-static int tde_encrypt_dk (const unsigned char *dk_plain, TDE_DATA_KEY_TYPE dk_type, const unsigned char *master_key,
-			   unsigned char *dk_cipher);
-static int tde_decrypt_dk (const unsigned char *dk_cipher, TDE_DATA_KEY_TYPE dk_type, const unsigned char *master_key,
-			   unsigned char *dk_plain);
+static int tde_encrypt_dk (const unsigned char *dk_plain, TDE_DATA_KEY_TYPE dk_type, int dk_gen,
+			   const unsigned char *master_key, unsigned char *dk_cipher);
+static int tde_decrypt_dk (const unsigned char *dk_cipher, TDE_DATA_KEY_TYPE dk_type, int dk_gen,
+			   const unsigned char *master_key, unsigned char *dk_plain);
 
-static void tde_dk_nonce (TDE_DATA_KEY_TYPE dk_type, unsigned char *dk_nonce);
+static void tde_dk_nonce (TDE_DATA_KEY_TYPE dk_type, int dk_gen, unsigned char *dk_nonce);
 
 /*
  * TDE internal functions for encrpytion and decryption. All the en/decryption go through it.
@@ -95,6 +116,149 @@ static int tde_encrypt_internal (const unsigned char *plain_buffer, int length,
 static int tde_decrypt_internal (const unsigned char *cipher_buffer, int length, TDE_ALGORITHM tde_algo,
 				 const unsigned char *key, const unsigned char *nonce, unsigned char *plain_buffer);
 
+/*
+ * Cipher contexts already keyed with the data keys, kept per thread.
+ * A page en/decryption only resets the nonce (IV) of a cached context instead of allocating a new context
+ * and expanding the key every time. The contexts are re-keyed when tde_Cipher.dks_version changes.
+ * The perm key has a context for each generation slot, which is re-keyed when its generation changes.
+ */
+#define TDE_CTX_CACHE_DK_COUNT        (TDE_PERM_KEY_SLOT_COUNT + 2)	/* perm slots, TEMP, LOG */
+#define TDE_CTX_CACHE_ALGORITHM_COUNT 3	/* indexed by TDE_ALGORITHM */
+
+#define TDE_CTX_CACHE_DK_INDEX(dk_type, dk_gen) \
+  ((dk_type) == TDE_DATA_KEY_TYPE_PERM ? TDE_PERM_KEY_SLOT (dk_gen) \
+   : (dk_type) == TDE_DATA_KEY_TYPE_TEMP ? TDE_PERM_KEY_SLOT_COUNT : TDE_PERM_KEY_SLOT_COUNT + 1)
+
+// *INDENT-OFF*
+struct tde_cipher_ctx_cache
+{
+  EVP_CIPHER_CTX *enc_ctx[TDE_CTX_CACHE_DK_COUNT][TDE_CTX_CACHE_ALGORITHM_COUNT];
+  EVP_CIPHER_CTX *dec_ctx[TDE_CTX_CACHE_DK_COUNT][TDE_CTX_CACHE_ALGORITHM_COUNT];
+  int perm_key_gen[TDE_PERM_KEY_SLOT_COUNT];	/* generation of the perm key each slot is keyed with */
+  int64_t dks_version;		/* tde_Cipher.dks_version the contexts are keyed with */
+
+  tde_cipher_ctx_cache ();
+  ~tde_cipher_ctx_cache ();
+  void clear ();
+};
+
+static thread_local tde_cipher_ctx_cache tde_Ctx_cache;
+// *INDENT-ON*
+
+/*
+ * Nonces for temp pages are reserved from tde_Cipher.temp_write_counter by ranges, kept per thread.
+ * The global counter is touched once per range instead of once per page. Every nonce is still used only once.
+ */
+#define TDE_TEMP_NONCE_RANGE_SIZE (64 * 1024)
+
+/* the block size of the CTR mode ciphers, the counter in the nonce is increased by one per block */
+#define TDE_CIPHER_BLOCK_SIZE 16
+
+/*
+ * The free hole of a slotted page is not encrypted when tde_encrypt_used_region_only is set.
+ * The slotted page header is encrypted alone first, since the hole is found from it on decryption.
+ */
+#define TDE_DATA_PAGE_HDR_ENC_LENGTH (DB_ALIGN (sizeof (SPAGE_HEADER), TDE_CIPHER_BLOCK_SIZE))
+#define TDE_DATA_PAGE_FREE_HOLE_MIN_LENGTH 256
+
+typedef struct tde_temp_nonce_range
+{
+  int64_t next;			/* next nonce to use */
+  int64_t end;			/* the range is [next, end) */
+  int64_t dks_version;		/* tde_Cipher.dks_version the range is reserved with */
+} TDE_TEMP_NONCE_RANGE;
+
+// *INDENT-OFF*
+static thread_local TDE_TEMP_NONCE_RANGE tde_Temp_nonce_range = { 0, 0, -1 };
+// *INDENT-ON*
+
+static int64_t tde_reserve_temp_nonces (int count);
+static bool tde_find_data_page_free_hole (const FILEIO_PAGE * iopage_plain, int *hole_offset, int *hole_end);
+static int tde_crypt_data_page_range (const FILEIO_PAGE * iopage_in, int from, int to, TDE_ALGORITHM tde_algo,
+				      TDE_DATA_KEY_TYPE dk_type, int dk_gen, const unsigned char *nonce, bool is_encrypt,
+				      FILEIO_PAGE * iopage_out);
+
+static EVP_CIPHER_CTX *tde_get_dk_cipher_ctx (TDE_DATA_KEY_TYPE dk_type, int dk_gen, TDE_ALGORITHM tde_algo,
+					      bool is_encrypt);
+static int tde_encrypt_with_dk (const unsigned char *plain_buffer, int length, TDE_ALGORITHM tde_algo,
+				TDE_DATA_KEY_TYPE dk_type, int dk_gen, const unsigned char *nonce,
+				unsigned char *cipher_buffer);
+static int tde_decrypt_with_dk (const unsigned char *cipher_buffer, int length, TDE_ALGORITHM tde_algo,
+				TDE_DATA_KEY_TYPE dk_type, int dk_gen, const unsigned char *nonce,
+				unsigned char *plain_buffer);
+
+/*
+ * The crypto engine of OpenSSL given by tde_cipher_engine, e.g., the engine of a hardware accelerator.
+ * The data key contexts are created with it for the algorithms it implements, and with the built-in implementation
+ * of OpenSSL (which already uses AES-NI if the CPU has it) for the others.
+ */
+static ENGINE *tde_Cipher_engine = NULL;
+static ENGINE *tde_Cipher_algo_engines[TDE_CTX_CACHE_ALGORITHM_COUNT];	/* indexed by TDE_ALGORITHM, NULL for built-in */
+
+static void tde_load_cipher_engine (void);
+
+/* statistics of en/decryption by the data key type, indexed by TDE_DATA_KEY_TYPE */
+static const PERF_STAT_ID tde_Encrypt_pstat_ids[] = {
+  PSTAT_TDE_ENCRYPT_PERM_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_ENCRYPT_TEMP_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_ENCRYPT_LOG_PAGE_TIME_COUNTERS
+};
+
+static const PERF_STAT_ID tde_Decrypt_pstat_ids[] = {
+  PSTAT_TDE_DECRYPT_PERM_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_DECRYPT_TEMP_PAGE_TIME_COUNTERS,
+  PSTAT_TDE_DECRYPT_LOG_PAGE_TIME_COUNTERS
+};
+
+#if defined (SERVER_MODE)
+/*
+ * Keystream precomputed for the upcoming log append pages.
+ * A log page uses its logical page id as the nonce, so the keystream of the next pages is known before they are
+ * filled. The log flush only has to XOR it into the page if it is prepared, see tde_prefetch_log_keystream ().
+ */
+#define TDE_LOG_KEYSTREAM_COUNT 16
+
+typedef struct tde_log_keystream
+{
+  pthread_mutex_t mutex;
+  LOG_PAGEID pageid;		/* logical page id the keystream is made for, NULL_PAGEID if not prepared */
+  TDE_ALGORITHM tde_algo;
+  int64_t dks_version;		/* tde_Cipher.dks_version the keystream is made with */
+  unsigned char *keystream;	/* TDE_LOG_PAGE_ENC_LENGTH bytes */
+} TDE_LOG_KEYSTREAM;
+
+static TDE_LOG_KEYSTREAM tde_Log_keystreams[TDE_LOG_KEYSTREAM_COUNT];
+static bool tde_Log_keystream_mutex_initialized = false;
+static volatile bool tde_Log_keystream_enabled = false;
+
+static bool tde_apply_log_keystream (const LOG_PAGE * logpage_in, TDE_ALGORITHM tde_algo, LOG_PAGE * logpage_out);
+
+/* The daemon to re-encrypt perm pages after the perm data key is rotated */
+#define TDE_REKEY_DAEMON_INTERVAL_MSECS (10 * 1000)
+
+// *INDENT-OFF*
+class tde_rekey_daemon_context_manager : public cubthread::daemon_entry_manager
+{
+  private:
+    void on_daemon_create (cubthread::entry &context) final
+    {
+      /* to log the keyinfo update */
+      context.claim_system_worker ();
+    }
+
+    void on_daemon_retire (cubthread::entry &context) final
+    {
+      context.retire_system_worker ();
+    }
+};
+
+static cubthread::daemon *tde_Rekey_daemon = NULL;
+static tde_rekey_daemon_context_manager *tde_Rekey_daemon_context_manager = NULL;
+// *INDENT-ON*
+
+static void tde_rekey_execute (cubthread::entry & thread_ref);
+#endif /* SERVER_MODE */
+
 /*
  * tde_initialize () - Initialize the tde module, which is called during initializing server.
  *
@@ -186,7 +350,7 @@ tde_initialize (THREAD_ENTRY * thread_p, HFID * keyinfo_hfid)
       goto exit;
     }
 
-  err = tde_generate_keyinfo (&keyinfo, mk_index, default_mk, created_time, &dks);
+  err = tde_generate_keyinfo (&keyinfo, mk_index, default_mk, created_time, &dks, 0, NULL);
   if (err != NO_ERROR)
     {
       goto exit;
@@ -291,6 +455,11 @@ tde_cipher_initialize (THREAD_ENTRY * thread_p, const HFID * keyinfo_hfid, const
 
   tde_Cipher.temp_write_counter = 0;
 
+  tde_load_cipher_engine ();
+
+  /* data keys may have been changed, the cipher contexts cached by threads have to be re-keyed */
+  ATOMIC_INC_64 (&tde_Cipher.dks_version, 1);
+
   tde_Cipher.is_loaded = true;
 
 exit:
@@ -515,32 +684,51 @@ tde_make_keys_file_fullname (char *keys_vol_fullname, const char *db_full_name,
  * master_key (in)    : Master key
  * created_time (in)  : Creation time of the master key
  * dks (in)           : Data key set
+ * dk_perm_gen (in)   : Generation of dks->perm_key
+ * perm_key_prev (in) : The perm key of the previous generation if it is still needed, or NULL
  */
 static int
 tde_generate_keyinfo (TDE_KEYINFO * keyinfo, int mk_index, const unsigned char *master_key,
-		      const time_t created_time, const TDE_DATA_KEY_SET * dks)
+		      const time_t created_time, const TDE_DATA_KEY_SET * dks, int dk_perm_gen,
+		      const unsigned char *perm_key_prev)
 {
   int err = NO_ERROR;
 
+  memset (keyinfo, 0, sizeof (TDE_KEYINFO));
+
   keyinfo->mk_index = mk_index;
   tde_make_mk_hash (master_key, keyinfo->mk_hash);
 
-  err = tde_encrypt_dk (dks->perm_key, TDE_DATA_KEY_TYPE_PERM, master_key, keyinfo->dk_perm);
+  err = tde_encrypt_dk (dks->perm_key, TDE_DATA_KEY_TYPE_PERM, dk_perm_gen, master_key, keyinfo->dk_perm);
   if (err != NO_ERROR)
     {
       return err;
     }
-  err = tde_encrypt_dk (dks->temp_key, TDE_DATA_KEY_TYPE_TEMP, master_key, keyinfo->dk_temp);
+  err = tde_encrypt_dk (dks->temp_key, TDE_DATA_KEY_TYPE_TEMP, 0, master_key, keyinfo->dk_temp);
   if (err != NO_ERROR)
     {
       return err;
     }
-  err = tde_encrypt_dk (dks->log_key, TDE_DATA_KEY_TYPE_LOG, master_key, keyinfo->dk_log);
+  err = tde_encrypt_dk (dks->log_key, TDE_DATA_KEY_TYPE_LOG, 0, master_key, keyinfo->dk_log);
   if (err != NO_ERROR)
     {
       return err;
     }
 
+  keyinfo->dk_perm_gen = dk_perm_gen;
+  if (perm_key_prev != NULL)
+    {
+      assert (dk_perm_gen > 0);
+
+      err = tde_encrypt_dk (perm_key_prev, TDE_DATA_KEY_TYPE_PERM, dk_perm_gen - 1, master_key,
+			    keyinfo->dk_perm_prev);
+      if (err != NO_ERROR)
+	{
+	  return err;
+	}
+      keyinfo->is_rekeying = true;
+    }
+
   keyinfo->created_time = created_time;
   keyinfo->set_time = time (NULL);
   return err;
@@ -567,6 +755,8 @@ tde_get_keyinfo (THREAD_ENTRY * thread_p, TDE_KEYINFO * keyinfo)
   recdes.length = recdes.area_size = sizeof (recdes_buffer);
   recdes.data = (char *) recdes_buffer;
 
+  memset (keyinfo, 0, sizeof (TDE_KEYINFO));
+
   heap_scancache_quick_start_with_class_hfid (thread_p, &scan_cache, &tde_Keyinfo_hfid);
   scan = heap_first (thread_p, &tde_Keyinfo_hfid, NULL, &tde_Keyinfo_oid, &recdes, &scan_cache, COPY);
   heap_scancache_end (thread_p, &scan_cache);
@@ -579,20 +769,23 @@ tde_get_keyinfo (THREAD_ENTRY * thread_p, TDE_KEYINFO * keyinfo)
 
   /* HACK: the front of the record if dummy int to prevent the record from adjuestment
    *  in vacuum_rv_check_at_undo() while UNDOing, refer to tde_insert_keyinfo() */
-  memcpy (keyinfo, recdes_buffer + sizeof (int), sizeof (TDE_KEYINFO));
+  /* The record of an older database doesn't have the fields for the data key rotation, which stay zero */
+  assert (recdes.length > (int) sizeof (int) && recdes.length <= (int) sizeof (recdes_buffer));
+  memcpy (keyinfo, recdes_buffer + sizeof (int), recdes.length - sizeof (int));
 
   return NO_ERROR;
 }
 
 /*
- * tde_get_keyinfo () - Get keyinfo from key info heap file 
+ * tde_update_keyinfo () - Update keyinfo in key info heap file 
  *
- * return           : Error code
- * thread_p (in)    : Thread entry
- * keyinfo (in)     : keyinfo to update that in the keyinfo heap
+ * return              : Error code
+ * thread_p (in)       : Thread entry
+ * keyinfo (in)        : keyinfo to update that in the keyinfo heap
+ * update_inplace (in) : UPDATE_INPLACE_OLD_MVCCID if the update is not to be undone with the transaction
  */
 static int
-tde_update_keyinfo (THREAD_ENTRY * thread_p, const TDE_KEYINFO * keyinfo)
+tde_update_keyinfo (THREAD_ENTRY * thread_p, const TDE_KEYINFO * keyinfo, UPDATE_INPLACE_STYLE update_inplace)
 {
   HEAP_SCANCACHE scan_cache;
   HEAP_OPERATION_CONTEXT update_context;
@@ -626,7 +819,7 @@ tde_update_keyinfo (THREAD_ENTRY * thread_p, const TDE_KEYINFO * keyinfo)
   /* hack the class to avoid heap_scancache_check_with_hfid. */
   scan_cache.node.class_oid = *oid_Root_class_oid;
   heap_create_update_context (&update_context, &tde_Keyinfo_hfid, &tde_Keyinfo_oid, oid_Root_class_oid, &recdes,
-			      &scan_cache, UPDATE_INPLACE_CURRENT_MVCCID);
+			      &scan_cache, update_inplace);
   error_code = heap_update_logical (thread_p, &update_context);
   if (error_code != NO_ERROR)
     {
@@ -649,7 +842,7 @@ int
 tde_change_mk (THREAD_ENTRY * thread_p, const int mk_index, const unsigned char *master_key, const time_t created_time)
 {
   TDE_KEYINFO keyinfo;
-  TDE_DATA_KEY_SET dks;
+  int dk_gen;
   int err = NO_ERROR;
 
   if (!tde_Cipher.is_loaded)
@@ -659,17 +852,21 @@ tde_change_mk (THREAD_ENTRY * thread_p, const int mk_index, const unsigned char
       return err;
     }
 
+  pthread_mutex_lock (&tde_Keyinfo_mutex);
+
   /* generate keyinfo from tde_Cipher and update heap (on Disk) */
-  err = tde_generate_keyinfo (&keyinfo, mk_index, master_key, created_time, &tde_Cipher.data_keys);
+  dk_gen = tde_Cipher.perm_key_gen;
+  err = tde_generate_keyinfo (&keyinfo, mk_index, master_key, created_time, &tde_Cipher.data_keys, dk_gen,
+			      tde_Cipher.is_rekeying ? tde_Cipher.perm_keys[TDE_PERM_KEY_SLOT (dk_gen - 1)] : NULL);
   if (err != NO_ERROR)
     {
-      return err;
+      goto exit;
     }
 
-  err = tde_update_keyinfo (thread_p, &keyinfo);
+  err = tde_update_keyinfo (thread_p, &keyinfo, UPDATE_INPLACE_CURRENT_MVCCID);
   if (err != NO_ERROR)
     {
-      return err;
+      goto exit;
     }
 
   /* heap_flush() is mandatory. Without this, it cannot be guaranteed
@@ -678,6 +875,257 @@ tde_change_mk (THREAD_ENTRY * thread_p, const int mk_index, const unsigned char
    */
   heap_flush (thread_p, &tde_Keyinfo_oid);
 
+exit:
+  pthread_mutex_unlock (&tde_Keyinfo_mutex);
+  return err;
+}
+
+/*
+ * tde_rotate_perm_dk () - Replace the permanent data key with a new one
+ *
+ * return             : Error code
+ * thread_p (in)      : Thread entry
+ * master_key (in)    : The master key set on the database
+ * dk_gen (out)       : Generation of the new perm data key
+ *
+ * Only the perm data key is rotated. The temp data key is created again at every restart anyway,
+ * and the log data key has to stay to read archived logs and the logs shipped to the slaves.
+ *
+ * The new key is set on the database first, and the new pages are written with it from then on.
+ * The previous key is kept on the keyinfo until all the perm pages are re-encrypted, see tde_rekey_perm_pages ().
+ */
+int
+tde_rotate_perm_dk (THREAD_ENTRY * thread_p, const unsigned char *master_key, int *dk_gen)
+{
+  TDE_KEYINFO keyinfo;
+  TDE_KEYINFO new_keyinfo;
+  TDE_DATA_KEY_SET dks;
+  int new_gen;
+  int err = NO_ERROR;
+
+  assert (dk_gen != NULL);
+
+  if (!tde_Cipher.is_loaded)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_CIPHER_IS_NOT_LOADED, 0);
+      return ER_TDE_CIPHER_IS_NOT_LOADED;
+    }
+
+#if !defined (SERVER_MODE)
+  if (tde_Cipher.is_rekeying)
+    {
+      /* there is no daemon to finish the previous rotation */
+      err = tde_rekey_perm_pages (thread_p);
+      if (err != NO_ERROR)
+	{
+	  return err;
+	}
+    }
+#endif /* !SERVER_MODE */
+
+  pthread_mutex_lock (&tde_Keyinfo_mutex);
+
+  if (tde_Cipher.is_rekeying)
+    {
+      /* the key of two generations before would be needed to read some pages */
+      err = ER_TDE_DATA_KEY_ROTATION_IN_PROGRESS;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DATA_KEY_ROTATION_IN_PROGRESS, 1, tde_Cipher.perm_key_gen);
+      goto exit;
+    }
+
+  err = tde_get_keyinfo (thread_p, &keyinfo);
+  if (err != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  new_gen = tde_Cipher.perm_key_gen + 1;
+
+  memcpy (&dks, &tde_Cipher.data_keys, sizeof (TDE_DATA_KEY_SET));
+  err = tde_create_dk (dks.perm_key);
+  if (err != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  err = tde_generate_keyinfo (&new_keyinfo, keyinfo.mk_index, master_key, keyinfo.created_time, &dks, new_gen,
+			      tde_Cipher.data_keys.perm_key);
+  if (err != NO_ERROR)
+    {
+      goto exit;
+    }
+  /* the master key is not changed */
+  new_keyinfo.set_time = keyinfo.set_time;
+
+  /* the new key must not be rolled back with the transaction once pages are encrypted with it */
+  log_sysop_start (thread_p);
+  err = tde_update_keyinfo (thread_p, &new_keyinfo, UPDATE_INPLACE_OLD_MVCCID);
+  if (err != NO_ERROR)
+    {
+      log_sysop_abort (thread_p);
+      goto exit;
+    }
+  log_sysop_commit (thread_p);
+
+  /* The keyinfo has to be on disk before any page is written with the new key */
+  heap_flush (thread_p, &tde_Keyinfo_oid);
+
+  memcpy (tde_Cipher.perm_keys[TDE_PERM_KEY_SLOT (new_gen)], dks.perm_key, TDE_DATA_KEY_LENGTH);
+  memcpy (tde_Cipher.data_keys.perm_key, dks.perm_key, TDE_DATA_KEY_LENGTH);
+  /* is_rekeying first, pages of the previous generation are still readable when the new generation is seen */
+  tde_Cipher.is_rekeying = true;
+  ATOMIC_TAS_32 (&tde_Cipher.perm_key_gen, new_gen);
+  ATOMIC_INC_64 (&tde_Cipher.dks_version, 1);
+
+  *dk_gen = new_gen;
+
+exit:
+  memset (&dks, 0, sizeof (TDE_DATA_KEY_SET));
+  pthread_mutex_unlock (&tde_Keyinfo_mutex);
+
+  if (err != NO_ERROR)
+    {
+      return err;
+    }
+
+#if defined (SERVER_MODE)
+  if (tde_Rekey_daemon != NULL)
+    {
+      tde_Rekey_daemon->wakeup ();
+    }
+#else /* SERVER_MODE */
+  err = tde_rekey_perm_pages (thread_p);
+#endif /* !SERVER_MODE */
+
+  return err;
+}
+
+/*
+ * tde_rekey_perm_pages () - Re-encrypt all the perm pages of the previous generation with the current perm data key
+ *
+ * return             : Error code
+ * thread_p (in)      : Thread entry
+ *
+ * Pages are just made dirty, they are encrypted with the current key when flushed.
+ * Files of which the class is locked exclusively are skipped, and the pass has to be done again later.
+ * When a pass visits all the files, the previous key is removed.
+ */
+int
+tde_rekey_perm_pages (THREAD_ENTRY * thread_p)
+{
+  VFID vfid = VFID_INITIALIZER;
+  OID class_oid = OID_INITIALIZER;
+  int dk_gen;
+  int n_pages_rekeyed = 0;
+  int n_pages_total = 0;
+  bool is_complete = true;
+  int err = NO_ERROR;
+
+  if (!tde_Cipher.is_loaded || !tde_Cipher.is_rekeying)
+    {
+      return NO_ERROR;
+    }
+
+  dk_gen = ATOMIC_LOAD (&tde_Cipher.perm_key_gen);
+
+  while (true)
+    {
+      er_clear ();
+      err = file_tracker_interruptable_iterate (thread_p, FILE_UNKNOWN_TYPE, &vfid, &class_oid);
+      if (err != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit;
+	}
+      if (er_errid () == ER_CANNOT_CHECK_FILE)
+	{
+	  /* some files are skipped */
+	  is_complete = false;
+	  er_clear ();
+	}
+      if (VFID_ISNULL (&vfid))
+	{
+	  break;
+	}
+
+      err = file_tde_rekey (thread_p, &vfid, dk_gen, &n_pages_rekeyed);
+      if (err != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+	  goto exit;
+	}
+      n_pages_total += n_pages_rekeyed;
+    }
+  assert (OID_ISNULL (&class_oid));
+
+  er_log_debug (ARG_FILE_LINE, "TDE: %d pages are re-encrypted with the perm data key of generation %d%s\n",
+		n_pages_total, dk_gen, is_complete ? "" : ", some files are skipped");
+
+  if (!is_complete)
+    {
+      return NO_ERROR;
+    }
+
+  /* no page of the previous generation must remain on disk */
+  err = pgbuf_flush_all (thread_p, NULL_VOLID);
+  if (err != NO_ERROR)
+    {
+      return err;
+    }
+
+  return tde_finish_rekeying (thread_p);
+
+exit:
+  if (!OID_ISNULL (&class_oid))
+    {
+      lock_unlock_object (thread_p, &class_oid, oid_Root_class_oid, SCH_S_LOCK, true);
+    }
+  return err;
+}
+
+/*
+ * tde_finish_rekeying () - Remove the previous perm data key after all the perm pages are re-encrypted
+ *
+ * return             : Error code
+ * thread_p (in)      : Thread entry
+ */
+static int
+tde_finish_rekeying (THREAD_ENTRY * thread_p)
+{
+  TDE_KEYINFO keyinfo;
+  int dk_gen;
+  int err = NO_ERROR;
+
+  pthread_mutex_lock (&tde_Keyinfo_mutex);
+
+  err = tde_get_keyinfo (thread_p, &keyinfo);
+  if (err != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  dk_gen = tde_Cipher.perm_key_gen;
+  assert (keyinfo.is_rekeying && keyinfo.dk_perm_gen == dk_gen);
+
+  keyinfo.is_rekeying = false;
+  memset (keyinfo.dk_perm_prev, 0, TDE_DATA_KEY_LENGTH);
+
+  log_sysop_start (thread_p);
+  err = tde_update_keyinfo (thread_p, &keyinfo, UPDATE_INPLACE_OLD_MVCCID);
+  if (err != NO_ERROR)
+    {
+      log_sysop_abort (thread_p);
+      goto exit;
+    }
+  log_sysop_commit (thread_p);
+
+  heap_flush (thread_p, &tde_Keyinfo_oid);
+
+  tde_Cipher.is_rekeying = false;
+  memset (tde_Cipher.perm_keys[TDE_PERM_KEY_SLOT (dk_gen - 1)], 0, TDE_DATA_KEY_LENGTH);
+
+exit:
+  pthread_mutex_unlock (&tde_Keyinfo_mutex);
   return err;
 }
 
@@ -729,24 +1177,42 @@ tde_load_mk (int vdes, const TDE_KEYINFO * keyinfo, unsigned char *master_key)
 static int
 tde_load_dks (const unsigned char *master_key, const TDE_KEYINFO * keyinfo)
 {
+  int dk_gen = keyinfo->dk_perm_gen;
   int err = NO_ERROR;
 
-  err = tde_decrypt_dk (keyinfo->dk_perm, TDE_DATA_KEY_TYPE_PERM, master_key, tde_Cipher.data_keys.perm_key);
+  assert (dk_gen >= 0);
+
+  err = tde_decrypt_dk (keyinfo->dk_perm, TDE_DATA_KEY_TYPE_PERM, dk_gen, master_key, tde_Cipher.data_keys.perm_key);
   if (err != NO_ERROR)
     {
       return err;
     }
-  err = tde_decrypt_dk (keyinfo->dk_temp, TDE_DATA_KEY_TYPE_TEMP, master_key, tde_Cipher.data_keys.temp_key);
+  err = tde_decrypt_dk (keyinfo->dk_temp, TDE_DATA_KEY_TYPE_TEMP, 0, master_key, tde_Cipher.data_keys.temp_key);
   if (err != NO_ERROR)
     {
       return err;
     }
-  err = tde_decrypt_dk (keyinfo->dk_log, TDE_DATA_KEY_TYPE_LOG, master_key, tde_Cipher.data_keys.log_key);
+  err = tde_decrypt_dk (keyinfo->dk_log, TDE_DATA_KEY_TYPE_LOG, 0, master_key, tde_Cipher.data_keys.log_key);
   if (err != NO_ERROR)
     {
       return err;
     }
 
+  memcpy (tde_Cipher.perm_keys[TDE_PERM_KEY_SLOT (dk_gen)], tde_Cipher.data_keys.perm_key, TDE_DATA_KEY_LENGTH);
+  if (keyinfo->is_rekeying)
+    {
+      assert (dk_gen > 0);
+
+      err = tde_decrypt_dk (keyinfo->dk_perm_prev, TDE_DATA_KEY_TYPE_PERM, dk_gen - 1, master_key,
+			    tde_Cipher.perm_keys[TDE_PERM_KEY_SLOT (dk_gen - 1)]);
+      if (err != NO_ERROR)
+	{
+	  return err;
+	}
+    }
+  tde_Cipher.perm_key_gen = dk_gen;
+  tde_Cipher.is_rekeying = keyinfo->is_rekeying;
+
   return err;
 }
 
@@ -819,16 +1285,17 @@ tde_create_dk (unsigned char *data_key)
  * return             : error code
  * dk_plain (in)      : data key to encrypt
  * dk_type (in)       : data key type
+ * dk_gen (in)        : generation of the data key, only for the perm data key
  * master_key (in)    : a master key to encrypt the data key
  * dk_cipher (out)    : encrypted data key
  */
 static int
-tde_encrypt_dk (const unsigned char *dk_plain, TDE_DATA_KEY_TYPE dk_type, const unsigned char *master_key,
-		unsigned char *dk_cipher)
+tde_encrypt_dk (const unsigned char *dk_plain, TDE_DATA_KEY_TYPE dk_type, int dk_gen,
+		const unsigned char *master_key, unsigned char *dk_cipher)
 {
   unsigned char dk_nonce[TDE_DK_NONCE_LENGTH] = { 0, };
 
-  tde_dk_nonce (dk_type, dk_nonce);
+  tde_dk_nonce (dk_type, dk_gen, dk_nonce);
 
   return tde_encrypt_internal (dk_plain, TDE_DATA_KEY_LENGTH, TDE_DK_ALGORITHM, master_key, dk_nonce, dk_cipher);
 }
@@ -839,16 +1306,17 @@ tde_encrypt_dk (const unsigned char *dk_plain, TDE_DATA_KEY_TYPE dk_type, const
  * return             : Error code
  * dk_cipher (in)     : Data key to decrypt
  * dk_type (in)       : Data key type
+ * dk_gen (in)        : Generation of the data key, only for the perm data key
  * master_key (in)    : A master key to encrypt the data key
  * dk_plain (out)     : Decrypted data key
  */
 static int
-tde_decrypt_dk (const unsigned char *dk_cipher, TDE_DATA_KEY_TYPE dk_type, const unsigned char *master_key,
-		unsigned char *dk_plain)
+tde_decrypt_dk (const unsigned char *dk_cipher, TDE_DATA_KEY_TYPE dk_type, int dk_gen,
+		const unsigned char *master_key, unsigned char *dk_plain)
 {
   unsigned char dk_nonce[TDE_DK_NONCE_LENGTH] = { 0, };
 
-  tde_dk_nonce (dk_type, dk_nonce);
+  tde_dk_nonce (dk_type, dk_gen, dk_nonce);
 
   return tde_decrypt_internal (dk_cipher, TDE_DATA_KEY_LENGTH, TDE_DK_ALGORITHM, master_key, dk_nonce, dk_plain);
 }
@@ -857,10 +1325,14 @@ tde_decrypt_dk (const unsigned char *dk_cipher, TDE_DATA_KEY_TYPE dk_type, const
  * tde_dk_nonce () - Get a data key nonce according to dk_type
  *
  * dk_type (in)       : Data key type
+ * dk_gen (in)        : Generation of the data key, only for the perm data key
  * dk_nonce (out)     : A nonce for dk_type
+ *
+ * Every generation of the perm data key is encrypted with the same master key,
+ * so the generation is a part of the nonce not to reuse the keystream. The nonce of generation 0 is all zero as before.
  */
 static inline void
-tde_dk_nonce (TDE_DATA_KEY_TYPE dk_type, unsigned char *dk_nonce)
+tde_dk_nonce (TDE_DATA_KEY_TYPE dk_type, int dk_gen, unsigned char *dk_nonce)
 {
   assert (dk_nonce != NULL);
 
@@ -868,6 +1340,7 @@ tde_dk_nonce (TDE_DATA_KEY_TYPE dk_type, unsigned char *dk_nonce)
     {
     case TDE_DATA_KEY_TYPE_PERM:
       memset (dk_nonce, 0, TDE_DK_NONCE_LENGTH);
+      memcpy (dk_nonce, &dk_gen, sizeof (dk_gen));
       break;
     case TDE_DATA_KEY_TYPE_TEMP:
       memset (dk_nonce, 1, TDE_DK_NONCE_LENGTH);
@@ -896,10 +1369,39 @@ int
 tde_encrypt_data_page (const FILEIO_PAGE * iopage_plain, TDE_ALGORITHM tde_algo, bool is_temp,
 		       FILEIO_PAGE * iopage_cipher)
 {
+  return tde_encrypt_data_pages (&iopage_plain, &tde_algo, is_temp, &iopage_cipher, 1);
+}
+
+/*
+ * tde_encrypt_data_pages () - Encrypt a batch of data pages in one pass.
+ *
+ * return               : Error code
+ * iopages_plain (in)   : Data pages to encrypt
+ * tde_algos (in)       : Encryption algorithm of each page
+ * is_temp (in)         : Whether the pages are for temp file
+ * iopages_cipher (out) : Encrpyted data pages
+ * count (in)           : The number of pages
+ *
+ * Every page still gets its own nonce, so the pages are independent CTR streams. The nonces of temp pages are
+ * reserved from the counter all at once for the batch.
+ */
+int
+tde_encrypt_data_pages (const FILEIO_PAGE ** iopages_plain, const TDE_ALGORITHM * tde_algos, bool is_temp,
+			FILEIO_PAGE ** iopages_cipher, int count)
+{
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_TDE_ENCRYPT);
   int err = NO_ERROR;
   unsigned char nonce[TDE_DATA_PAGE_NONCE_LENGTH] = { 0, };
-  const unsigned char *data_key;
-  int64_t tmp_nonce;
+  TDE_DATA_KEY_TYPE dk_type;
+  const FILEIO_PAGE *iopage_plain;
+  FILEIO_PAGE *iopage_cipher;
+  int64_t tmp_nonce = 0;
+  int dk_gen = 0;
+  bool use_free_hole;
+  int hole_offset, hole_end;
+  int i;
+
+  assert (count > 0);
 
   if (tde_Cipher.is_loaded == false)
     {
@@ -909,49 +1411,139 @@ tde_encrypt_data_page (const FILEIO_PAGE * iopage_plain, TDE_ALGORITHM tde_algo,
 
   if (is_temp)
     {
-      // temporary file: atomic counter for nonce
-      data_key = tde_Cipher.data_keys.temp_key;
-      tmp_nonce = ATOMIC_INC_64 (&tde_Cipher.temp_write_counter, 1);
-      memcpy (nonce, &tmp_nonce, sizeof (tmp_nonce));
+      // temporary file: atomic counter for nonce, [tmp_nonce, tmp_nonce + count) is reserved for the batch
+      dk_type = TDE_DATA_KEY_TYPE_TEMP;
+      tmp_nonce = tde_reserve_temp_nonces (count);
     }
   else
     {
-      // permanent file: page lsa as nonce
-      data_key = tde_Cipher.data_keys.perm_key;
-      memcpy (nonce, &iopage_plain->prv.lsa, sizeof (iopage_plain->prv.lsa));
+      // permanent file: page lsa as nonce, the current generation of perm key
+      dk_type = TDE_DATA_KEY_TYPE_PERM;
+      dk_gen = ATOMIC_LOAD (&tde_Cipher.perm_key_gen);
     }
 
-  /* copy FILEIO_PAGE_RESERVED */
-  memcpy (iopage_cipher, iopage_plain, TDE_DATA_PAGE_ENC_OFFSET);
-  /* copy FILEIO_PAGE_WATERMARK */
-  memcpy ((char *) iopage_cipher + TDE_DATA_PAGE_ENC_OFFSET + TDE_DATA_PAGE_ENC_LENGTH,
-	  (char *) iopage_plain + TDE_DATA_PAGE_ENC_OFFSET + TDE_DATA_PAGE_ENC_LENGTH, sizeof (FILEIO_PAGE_WATERMARK));
+  use_free_hole = prm_get_bool_value (PRM_ID_TDE_ENCRYPT_USED_REGION_ONLY);
 
-  memcpy (&iopage_cipher->prv.tde_nonce, nonce, sizeof (iopage_cipher->prv.tde_nonce));
+  for (i = 0; i < count; i++)
+    {
+      iopage_plain = iopages_plain[i];
+      iopage_cipher = iopages_cipher[i];
 
-  err = tde_encrypt_internal (((const unsigned char *) iopage_plain) + TDE_DATA_PAGE_ENC_OFFSET,
-			      TDE_DATA_PAGE_ENC_LENGTH, tde_algo, data_key, nonce,
-			      ((unsigned char *) iopage_cipher) + TDE_DATA_PAGE_ENC_OFFSET);
+      assert (tde_algos[i] != TDE_ALGORITHM_NONE);
 
-  return err;
-}
+      if (is_temp)
+	{
+	  memcpy (nonce, &tmp_nonce, sizeof (tmp_nonce));
+	  tmp_nonce++;
+	}
+      else
+	{
+	  memcpy (nonce, &iopage_plain->prv.lsa, sizeof (iopage_plain->prv.lsa));
+	}
 
-/*
- * tde_decrypt_data_page () - Decrypt a data page. 
- *
- * return               : Error code
- * iopage_cipher (in)   : Data page to decrypt
- * tde_algo (in)        : Encryption algorithm
- * is_temp (in)         : Whether the page is for temp file
- * iopage_plain (out)   : Decrypted data page
- */
-int
+      /* copy FILEIO_PAGE_RESERVED */
+      memcpy (iopage_cipher, iopage_plain, TDE_DATA_PAGE_ENC_OFFSET);
+      /* copy FILEIO_PAGE_WATERMARK */
+      memcpy ((char *) iopage_cipher + TDE_DATA_PAGE_ENC_OFFSET + TDE_DATA_PAGE_ENC_LENGTH,
+	      (char *) iopage_plain + TDE_DATA_PAGE_ENC_OFFSET + TDE_DATA_PAGE_ENC_LENGTH,
+	      sizeof (FILEIO_PAGE_WATERMARK));
+
+      memcpy (&iopage_cipher->prv.tde_nonce, nonce, sizeof (iopage_cipher->prv.tde_nonce));
+      if (!is_temp)
+	{
+	  iopage_cipher->prv.tde_dk_gen = dk_gen;
+	}
+
+      iopage_cipher->prv.pflag &= ~FILEIO_PAGE_FLAG_TDE_FREE_HOLE;
+      if (use_free_hole && tde_find_data_page_free_hole (iopage_plain, &hole_offset, &hole_end))
+	{
+	  /* the header, records and slots are encrypted and the free hole between them is zero-filled */
+	  iopage_cipher->prv.pflag |= FILEIO_PAGE_FLAG_TDE_FREE_HOLE;
+
+	  err = tde_crypt_data_page_range (iopage_plain, 0, hole_offset, tde_algos[i], dk_type, dk_gen, nonce, true,
+					   iopage_cipher);
+	  if (err != NO_ERROR)
+	    {
+	      return err;
+	    }
+	  memset (iopage_cipher->page + hole_offset, 0, hole_end - hole_offset);
+	  err = tde_crypt_data_page_range (iopage_plain, hole_end, TDE_DATA_PAGE_ENC_LENGTH, tde_algos[i], dk_type,
+					   dk_gen, nonce, true, iopage_cipher);
+	}
+      else
+	{
+	  err = tde_encrypt_with_dk (((const unsigned char *) iopage_plain) + TDE_DATA_PAGE_ENC_OFFSET,
+				     TDE_DATA_PAGE_ENC_LENGTH, tde_algos[i], dk_type, dk_gen, nonce,
+				     ((unsigned char *) iopage_cipher) + TDE_DATA_PAGE_ENC_OFFSET);
+	}
+      if (err != NO_ERROR)
+	{
+	  return err;
+	}
+    }
+
+  return err;
+}
+
+/*
+ * tde_reserve_temp_nonces () - Reserve consecutive nonces for temp pages
+ *
+ * return             : The first nonce of [return, return + count)
+ * count (in)         : The number of nonces to reserve
+ *
+ * The nonces are taken from the range of the current thread. The range is refilled from the global counter
+ * when it is exhausted or the data keys are reloaded.
+ */
+static int64_t
+tde_reserve_temp_nonces (int count)
+{
+  TDE_TEMP_NONCE_RANGE *range = &tde_Temp_nonce_range;
+  int64_t dks_version = ATOMIC_LOAD_64 (&tde_Cipher.dks_version);
+  int64_t first;
+
+  assert (count > 0);
+
+  if (count > TDE_TEMP_NONCE_RANGE_SIZE)
+    {
+      /* too many for a range, reserve directly */
+      return ATOMIC_INC_64 (&tde_Cipher.temp_write_counter, count) - count + 1;
+    }
+
+  if (range->dks_version != dks_version || range->end - range->next < count)
+    {
+      /* the rest of the old range is discarded, nonces don't need to be contiguous among pages */
+      range->end = ATOMIC_INC_64 (&tde_Cipher.temp_write_counter, TDE_TEMP_NONCE_RANGE_SIZE) + 1;
+      range->next = range->end - TDE_TEMP_NONCE_RANGE_SIZE;
+      range->dks_version = dks_version;
+    }
+
+  first = range->next;
+  range->next += count;
+
+  return first;
+}
+
+/*
+ * tde_decrypt_data_page () - Decrypt a data page. 
+ *
+ * return               : Error code
+ * iopage_cipher (in)   : Data page to decrypt
+ * tde_algo (in)        : Encryption algorithm
+ * is_temp (in)         : Whether the page is for temp file
+ * iopage_plain (out)   : Decrypted data page
+ */
+int
 tde_decrypt_data_page (const FILEIO_PAGE * iopage_cipher, TDE_ALGORITHM tde_algo, bool is_temp,
 		       FILEIO_PAGE * iopage_plain)
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_TDE_DECRYPT);
   int err = NO_ERROR;
   unsigned char nonce[TDE_DATA_PAGE_NONCE_LENGTH] = { 0, };
-  const unsigned char *data_key;
+  TDE_DATA_KEY_TYPE dk_type;
+  int dk_gen = 0;
+  int cur_gen;
+  bool has_free_hole;
+  int hole_offset, hole_end;
 
   if (tde_Cipher.is_loaded == false)
     {
@@ -962,12 +1554,20 @@ tde_decrypt_data_page (const FILEIO_PAGE * iopage_cipher, TDE_ALGORITHM tde_algo
   if (is_temp)
     {
       // temporary file: atomic counter for nonce
-      data_key = tde_Cipher.data_keys.temp_key;
+      dk_type = TDE_DATA_KEY_TYPE_TEMP;
     }
   else
     {
-      // permanent file: page lsa for nonce
-      data_key = tde_Cipher.data_keys.perm_key;
+      // permanent file: page lsa for nonce, the generation of perm key is recorded in the page
+      dk_type = TDE_DATA_KEY_TYPE_PERM;
+      dk_gen = iopage_cipher->prv.tde_dk_gen;
+      cur_gen = ATOMIC_LOAD (&tde_Cipher.perm_key_gen);
+      if (dk_gen != cur_gen && !(dk_gen == cur_gen - 1 && tde_Cipher.is_rekeying))
+	{
+	  /* the key of the generation is not kept anymore */
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DECRYPTION_ERROR, 0);
+	  return ER_TDE_DECRYPTION_ERROR;
+	}
     }
 
   /* copy FILEIO_PAGE_RESERVED */
@@ -978,13 +1578,140 @@ tde_decrypt_data_page (const FILEIO_PAGE * iopage_cipher, TDE_ALGORITHM tde_algo
 
   memcpy (nonce, &iopage_cipher->prv.tde_nonce, sizeof (iopage_cipher->prv.tde_nonce));
 
-  err = tde_decrypt_internal (((const unsigned char *) iopage_cipher) + TDE_DATA_PAGE_ENC_OFFSET,
-			      TDE_DATA_PAGE_ENC_LENGTH, tde_algo, data_key, nonce,
-			      ((unsigned char *) iopage_plain) + TDE_DATA_PAGE_ENC_OFFSET);
+  /* iopage_cipher and iopage_plain can be the same */
+  has_free_hole = (iopage_cipher->prv.pflag & FILEIO_PAGE_FLAG_TDE_FREE_HOLE) != 0;
+  if (!has_free_hole)
+    {
+      err = tde_decrypt_with_dk (((const unsigned char *) iopage_cipher) + TDE_DATA_PAGE_ENC_OFFSET,
+				 TDE_DATA_PAGE_ENC_LENGTH, tde_algo, dk_type, dk_gen, nonce,
+				 ((unsigned char *) iopage_plain) + TDE_DATA_PAGE_ENC_OFFSET);
+      return err;
+    }
+
+  /* the flag is only for the page on disk */
+  iopage_plain->prv.pflag &= ~FILEIO_PAGE_FLAG_TDE_FREE_HOLE;
+
+  /* decrypt the slotted page header first to find the free hole */
+  err = tde_crypt_data_page_range (iopage_cipher, 0, TDE_DATA_PAGE_HDR_ENC_LENGTH, tde_algo, dk_type, dk_gen, nonce,
+				   false, iopage_plain);
+  if (err != NO_ERROR)
+    {
+      return err;
+    }
+  if (!tde_find_data_page_free_hole (iopage_plain, &hole_offset, &hole_end))
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DECRYPTION_ERROR, 0);
+      return ER_TDE_DECRYPTION_ERROR;
+    }
+
+  err = tde_crypt_data_page_range (iopage_cipher, TDE_DATA_PAGE_HDR_ENC_LENGTH, hole_offset, tde_algo, dk_type,
+				   dk_gen, nonce, false, iopage_plain);
+  if (err != NO_ERROR)
+    {
+      return err;
+    }
+  memset (iopage_plain->page + hole_offset, 0, hole_end - hole_offset);
+  err = tde_crypt_data_page_range (iopage_cipher, hole_end, TDE_DATA_PAGE_ENC_LENGTH, tde_algo, dk_type, dk_gen,
+				   nonce, false, iopage_plain);
 
   return err;
 }
 
+/*
+ * tde_find_data_page_free_hole () - Find the contiguous free area of a slotted data page
+ *
+ * return               : Whether the page has a free hole large enough to skip
+ * iopage_plain (in)    : Data page, its slotted page header has to be plain
+ * hole_offset (out)    : The start of the hole from the user page area
+ * hole_end (out)       : The end of the hole from the user page area
+ *
+ * The free area of a slotted page is between the records and the slot directory (see spage_compact ()).
+ * The hole is shrunk to the cipher blocks inside it, so that the encrypted bytes are the same as when the whole
+ * page is encrypted.
+ */
+static bool
+tde_find_data_page_free_hole (const FILEIO_PAGE * iopage_plain, int *hole_offset, int *hole_end)
+{
+  const SPAGE_HEADER *sphdr;
+  int free_start, free_end, slots_start;
+
+  if (iopage_plain->prv.ptype != PAGE_HEAP && iopage_plain->prv.ptype != PAGE_BTREE)
+    {
+      return false;
+    }
+
+  sphdr = (const SPAGE_HEADER *) iopage_plain->page;
+
+  free_start = sphdr->offset_to_free_area;
+  free_end = free_start + sphdr->cont_free;
+  slots_start = DB_PAGESIZE - sphdr->num_slots * (int) sizeof (SPAGE_SLOT);
+  if (sphdr->num_slots < 0 || sphdr->cont_free < 0 || free_start < (int) sizeof (SPAGE_HEADER)
+      || free_end > slots_start)
+    {
+      /* not a valid slotted page, e.g. not initialized yet */
+      return false;
+    }
+
+  *hole_offset = MAX (DB_ALIGN (free_start, TDE_CIPHER_BLOCK_SIZE), (int) TDE_DATA_PAGE_HDR_ENC_LENGTH);
+  *hole_end = DB_ALIGN_BELOW (free_end, TDE_CIPHER_BLOCK_SIZE);
+
+  return *hole_end - *hole_offset >= TDE_DATA_PAGE_FREE_HOLE_MIN_LENGTH;
+}
+
+/*
+ * tde_crypt_data_page_range () - Encrypt or decrypt a part of the user page area
+ *
+ * return               : Error code
+ * iopage_in (in)       : Data page to encrypt or decrypt
+ * from (in)            : The start of the range from the user page area, aligned to the cipher block
+ * to (in)              : The end of the range from the user page area
+ * tde_algo (in)        : Encryption algorithm
+ * dk_type (in)         : Data key type
+ * dk_gen (in)          : The generation of the perm data key
+ * nonce (in)           : The nonce of the page, the counter of the first block
+ * is_encrypt (in)      : Encrypt if true, decrypt otherwise
+ * iopage_out (out)     : Data page to write the result
+ *
+ * The counter of the nonce is advanced to the block of 'from', as OpenSSL does for a 128 bit big endian counter.
+ */
+static int
+tde_crypt_data_page_range (const FILEIO_PAGE * iopage_in, int from, int to, TDE_ALGORITHM tde_algo,
+			   TDE_DATA_KEY_TYPE dk_type, int dk_gen, const unsigned char *nonce, bool is_encrypt,
+			   FILEIO_PAGE * iopage_out)
+{
+  unsigned char range_nonce[TDE_DATA_PAGE_NONCE_LENGTH];
+  unsigned int carry;
+  int i;
+
+  assert (from % TDE_CIPHER_BLOCK_SIZE == 0);
+  assert (from <= to && to <= TDE_DATA_PAGE_ENC_LENGTH);
+
+  if (from == to)
+    {
+      return NO_ERROR;
+    }
+
+  memcpy (range_nonce, nonce, TDE_DATA_PAGE_NONCE_LENGTH);
+  carry = (unsigned int) (from / TDE_CIPHER_BLOCK_SIZE);
+  for (i = TDE_DATA_PAGE_NONCE_LENGTH - 1; i >= 0 && carry != 0; i--)
+    {
+      carry += range_nonce[i];
+      range_nonce[i] = (unsigned char) (carry & 0xff);
+      carry >>= 8;
+    }
+
+  if (is_encrypt)
+    {
+      return tde_encrypt_with_dk ((const unsigned char *) iopage_in->page + from, to - from, tde_algo, dk_type,
+				  dk_gen, range_nonce, (unsigned char *) iopage_out->page + from);
+    }
+  else
+    {
+      return tde_decrypt_with_dk ((const unsigned char *) iopage_in->page + from, to - from, tde_algo, dk_type,
+				  dk_gen, range_nonce, (unsigned char *) iopage_out->page + from);
+    }
+}
+
 /*
  * tde_encrypt_log_page () - Encrypt a log page. 
  *
@@ -996,8 +1723,8 @@ tde_decrypt_data_page (const FILEIO_PAGE * iopage_cipher, TDE_ALGORITHM tde_algo
 int
 tde_encrypt_log_page (const LOG_PAGE * logpage_plain, TDE_ALGORITHM tde_algo, LOG_PAGE * logpage_cipher)
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_TDE_ENCRYPT);
   unsigned char nonce[TDE_LOG_PAGE_NONCE_LENGTH] = { 0, };
-  const unsigned char *data_key;
 
   if (tde_Cipher.is_loaded == false)
     {
@@ -1005,14 +1732,19 @@ tde_encrypt_log_page (const LOG_PAGE * logpage_plain, TDE_ALGORITHM tde_algo, LO
       return ER_TDE_CIPHER_IS_NOT_LOADED;
     }
 
-  data_key = tde_Cipher.data_keys.log_key;
-
   memcpy (nonce, &logpage_plain->hdr.logical_pageid, sizeof (logpage_plain->hdr.logical_pageid));
   memcpy (logpage_cipher, logpage_plain, TDE_LOG_PAGE_ENC_OFFSET);
 
-  return tde_encrypt_internal (((const unsigned char *) logpage_plain) + TDE_LOG_PAGE_ENC_OFFSET,
-			       TDE_LOG_PAGE_ENC_LENGTH, tde_algo, data_key, nonce,
-			       ((unsigned char *) logpage_cipher) + TDE_LOG_PAGE_ENC_OFFSET);
+#if defined (SERVER_MODE)
+  if (tde_apply_log_keystream (logpage_plain, tde_algo, logpage_cipher))
+    {
+      return NO_ERROR;
+    }
+#endif /* SERVER_MODE */
+
+  return tde_encrypt_with_dk (((const unsigned char *) logpage_plain) + TDE_LOG_PAGE_ENC_OFFSET,
+			      TDE_LOG_PAGE_ENC_LENGTH, tde_algo, TDE_DATA_KEY_TYPE_LOG, 0, nonce,
+			      ((unsigned char *) logpage_cipher) + TDE_LOG_PAGE_ENC_OFFSET);
 }
 
 /*
@@ -1026,8 +1758,8 @@ tde_encrypt_log_page (const LOG_PAGE * logpage_plain, TDE_ALGORITHM tde_algo, LO
 int
 tde_decrypt_log_page (const LOG_PAGE * logpage_cipher, TDE_ALGORITHM tde_algo, LOG_PAGE * logpage_plain)
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_TDE_DECRYPT);
   unsigned char nonce[TDE_LOG_PAGE_NONCE_LENGTH] = { 0, };
-  const unsigned char *data_key;
 
   if (tde_Cipher.is_loaded == false)
     {
@@ -1035,14 +1767,19 @@ tde_decrypt_log_page (const LOG_PAGE * logpage_cipher, TDE_ALGORITHM tde_algo, L
       return ER_TDE_CIPHER_IS_NOT_LOADED;
     }
 
-  data_key = tde_Cipher.data_keys.log_key;
-
   memcpy (nonce, &logpage_cipher->hdr.logical_pageid, sizeof (logpage_cipher->hdr.logical_pageid));
   memcpy (logpage_plain, logpage_cipher, TDE_LOG_PAGE_ENC_OFFSET);
 
-  return tde_decrypt_internal (((const unsigned char *) logpage_cipher) + TDE_LOG_PAGE_ENC_OFFSET,
-			       TDE_LOG_PAGE_ENC_LENGTH, tde_algo, data_key, nonce,
-			       ((unsigned char *) logpage_plain) + TDE_LOG_PAGE_ENC_OFFSET);
+#if defined (SERVER_MODE)
+  if (tde_apply_log_keystream (logpage_cipher, tde_algo, logpage_plain))
+    {
+      return NO_ERROR;
+    }
+#endif /* SERVER_MODE */
+
+  return tde_decrypt_with_dk (((const unsigned char *) logpage_cipher) + TDE_LOG_PAGE_ENC_OFFSET,
+			      TDE_LOG_PAGE_ENC_LENGTH, tde_algo, TDE_DATA_KEY_TYPE_LOG, 0, nonce,
+			      ((unsigned char *) logpage_plain) + TDE_LOG_PAGE_ENC_OFFSET);
 }
 
 /*
@@ -1201,6 +1938,571 @@ exit:
   return err;
 }
 
+// *INDENT-OFF*
+tde_cipher_ctx_cache::tde_cipher_ctx_cache ()
+  : dks_version (-1)
+{
+  memset (enc_ctx, 0, sizeof (enc_ctx));
+  memset (dec_ctx, 0, sizeof (dec_ctx));
+  for (int i = 0; i < TDE_PERM_KEY_SLOT_COUNT; i++)
+    {
+      perm_key_gen[i] = -1;
+    }
+}
+
+tde_cipher_ctx_cache::~tde_cipher_ctx_cache ()
+{
+  clear ();
+}
+
+void
+tde_cipher_ctx_cache::clear ()
+{
+  for (int i = 0; i < TDE_CTX_CACHE_DK_COUNT; i++)
+    {
+      for (int j = 0; j < TDE_CTX_CACHE_ALGORITHM_COUNT; j++)
+        {
+          if (enc_ctx[i][j] != NULL)
+            {
+              EVP_CIPHER_CTX_free (enc_ctx[i][j]);
+              enc_ctx[i][j] = NULL;
+            }
+          if (dec_ctx[i][j] != NULL)
+            {
+              EVP_CIPHER_CTX_free (dec_ctx[i][j]);
+              dec_ctx[i][j] = NULL;
+            }
+        }
+    }
+  for (int i = 0; i < TDE_PERM_KEY_SLOT_COUNT; i++)
+    {
+      perm_key_gen[i] = -1;
+    }
+  dks_version = -1;
+}
+// *INDENT-ON*
+
+/*
+ * tde_load_cipher_engine () - Load the crypto engine given by tde_cipher_engine for the data key contexts
+ *
+ * If the engine can't be used, the built-in implementation is used with a warning.
+ */
+static void
+tde_load_cipher_engine (void)
+{
+  const char *engine_id;
+  ENGINE *engine;
+  bool is_used = false;
+
+  engine_id = prm_get_string_value (PRM_ID_TDE_CIPHER_ENGINE);
+  if (engine_id == NULL || engine_id[0] == '\0' || tde_Cipher_engine != NULL)
+    {
+      /* built-in, or already loaded */
+      return;
+    }
+
+  ENGINE_load_builtin_engines ();
+
+  engine = ENGINE_by_id (engine_id);
+  if (engine == NULL)
+    {
+      goto fail;
+    }
+
+  /* get the functional reference, the structural one from ENGINE_by_id () is not needed any more */
+  if (ENGINE_init (engine) != 1)
+    {
+      ENGINE_free (engine);
+      goto fail;
+    }
+  ENGINE_free (engine);
+
+  tde_Cipher_algo_engines[TDE_ALGORITHM_NONE] = NULL;
+  tde_Cipher_algo_engines[TDE_ALGORITHM_AES] = ENGINE_get_cipher (engine, NID_aes_256_ctr) != NULL ? engine : NULL;
+  tde_Cipher_algo_engines[TDE_ALGORITHM_ARIA] = ENGINE_get_cipher (engine, NID_aria_256_ctr) != NULL ? engine : NULL;
+  is_used = (tde_Cipher_algo_engines[TDE_ALGORITHM_AES] != NULL || tde_Cipher_algo_engines[TDE_ALGORITHM_ARIA] != NULL);
+
+  if (!is_used)
+    {
+      /* no algorithm of TDE is implemented by the engine */
+      ENGINE_finish (engine);
+      goto fail;
+    }
+
+  tde_Cipher_engine = engine;
+  return;
+
+fail:
+  ERR_clear_error ();
+  er_set (ER_WARNING_SEVERITY, ARG_FILE_LINE, ER_TDE_CIPHER_ENGINE_LOAD_FAIL, 1, engine_id);
+}
+
+/*
+ * tde_get_dk_cipher_ctx () - Get the cipher context of the current thread keyed with a data key
+ *
+ * return             : Cipher context, NULL if it fails
+ * dk_type (in)       : Data key type
+ * dk_gen (in)        : Generation of the data key, only for the perm data key
+ * tde_algo (in)      : Encryption algorithm
+ * is_encrypt (in)    : Whether the context is for encryption or decryption
+ *
+ * The context is created and keyed at the first use. After that, only the nonce has to be set to use it.
+ */
+static EVP_CIPHER_CTX *
+tde_get_dk_cipher_ctx (TDE_DATA_KEY_TYPE dk_type, int dk_gen, TDE_ALGORITHM tde_algo, bool is_encrypt)
+{
+  EVP_CIPHER_CTX **ctx_p;
+  const EVP_CIPHER *cipher_type;
+  const unsigned char *data_key;
+  int64_t dks_version;
+  int dk_idx = TDE_CTX_CACHE_DK_INDEX (dk_type, dk_gen);
+  int slot, i;
+
+  assert (dk_type >= TDE_DATA_KEY_TYPE_PERM && dk_type <= TDE_DATA_KEY_TYPE_LOG);
+
+  switch (tde_algo)
+    {
+    case TDE_ALGORITHM_AES:
+      cipher_type = EVP_aes_256_ctr ();
+      break;
+    case TDE_ALGORITHM_ARIA:
+      cipher_type = EVP_aria_256_ctr ();
+      break;
+    case TDE_ALGORITHM_NONE:
+    default:
+      assert (false);
+      return NULL;
+    }
+
+  dks_version = ATOMIC_LOAD_64 (&tde_Cipher.dks_version);
+  if (tde_Ctx_cache.dks_version != dks_version)
+    {
+      /* data keys are reloaded, drop all the contexts keyed with the old ones */
+      tde_Ctx_cache.clear ();
+      tde_Ctx_cache.dks_version = dks_version;
+    }
+
+  if (dk_type == TDE_DATA_KEY_TYPE_PERM)
+    {
+      slot = TDE_PERM_KEY_SLOT (dk_gen);
+      if (tde_Ctx_cache.perm_key_gen[slot] != dk_gen)
+	{
+	  /* the slot is reused by another generation, drop the contexts of the slot */
+	  for (i = 0; i < TDE_CTX_CACHE_ALGORITHM_COUNT; i++)
+	    {
+	      EVP_CIPHER_CTX_free (tde_Ctx_cache.enc_ctx[dk_idx][i]);
+	      tde_Ctx_cache.enc_ctx[dk_idx][i] = NULL;
+	      EVP_CIPHER_CTX_free (tde_Ctx_cache.dec_ctx[dk_idx][i]);
+	      tde_Ctx_cache.dec_ctx[dk_idx][i] = NULL;
+	    }
+	  tde_Ctx_cache.perm_key_gen[slot] = dk_gen;
+	}
+    }
+
+  ctx_p = is_encrypt ? &tde_Ctx_cache.enc_ctx[dk_idx][tde_algo] : &tde_Ctx_cache.dec_ctx[dk_idx][tde_algo];
+  if (*ctx_p != NULL)
+    {
+      return *ctx_p;
+    }
+
+  switch (dk_type)
+    {
+    case TDE_DATA_KEY_TYPE_PERM:
+      data_key = tde_Cipher.perm_keys[TDE_PERM_KEY_SLOT (dk_gen)];
+      break;
+    case TDE_DATA_KEY_TYPE_TEMP:
+      data_key = tde_Cipher.data_keys.temp_key;
+      break;
+    case TDE_DATA_KEY_TYPE_LOG:
+      data_key = tde_Cipher.data_keys.log_key;
+      break;
+    default:
+      assert (false);
+      return NULL;
+    }
+
+  if ((*ctx_p = EVP_CIPHER_CTX_new ()) == NULL)
+    {
+      return NULL;
+    }
+
+  if (EVP_CipherInit_ex (*ctx_p, cipher_type, tde_Cipher_algo_engines[tde_algo], data_key, NULL, is_encrypt ? 1 : 0)
+      != 1)
+    {
+      EVP_CIPHER_CTX_free (*ctx_p);
+      *ctx_p = NULL;
+      return NULL;
+    }
+
+  return *ctx_p;
+}
+
+/*
+ * tde_encrypt_with_dk () - Encryption with a data key, using the cipher context cached in the current thread
+ *
+ * return               : Error code
+ * plain_buffer (in)    : Data to encrypt
+ * length (in)          : The length of data
+ * tde_algo (in)        : Encryption algorithm
+ * dk_type (in)         : Data key type
+ * dk_gen (in)          : Generation of the data key, only for the perm data key
+ * nonce (in)           : nonce, which has to be unique in time and space
+ * cipher_buffer (out)  : Encrypted data
+ */
+static int
+tde_encrypt_with_dk (const unsigned char *plain_buffer, int length, TDE_ALGORITHM tde_algo, TDE_DATA_KEY_TYPE dk_type,
+		     int dk_gen, const unsigned char *nonce, unsigned char *cipher_buffer)
+{
+  EVP_CIPHER_CTX *ctx;
+  int len;
+  int cipher_len;
+  PERF_UTIME_TRACKER time_track;
+
+  PERF_UTIME_TRACKER_START (NULL, &time_track);
+
+  ctx = tde_get_dk_cipher_ctx (dk_type, dk_gen, tde_algo, true);
+  if (ctx == NULL)
+    {
+      goto error;
+    }
+
+  /* the key schedule is kept, only the nonce is reset */
+  if (EVP_EncryptInit_ex (ctx, NULL, NULL, NULL, nonce) != 1)
+    {
+      goto error;
+    }
+
+  if (EVP_EncryptUpdate (ctx, cipher_buffer, &len, plain_buffer, length) != 1)
+    {
+      goto error;
+    }
+  cipher_len = len;
+
+  if (EVP_EncryptFinal_ex (ctx, cipher_buffer + len, &len) != 1)
+    {
+      goto error;
+    }
+  cipher_len += len;
+
+  assert (cipher_len == length);
+
+  PERF_UTIME_TRACKER_TIME (NULL, &time_track, tde_Encrypt_pstat_ids[dk_type]);
+  perfmon_add_stat (NULL, PSTAT_TDE_NUM_ENCRYPTED_BYTES, length);
+
+  return NO_ERROR;
+
+error:
+  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_ENCRYPTION_ERROR, 0);
+  return ER_TDE_ENCRYPTION_ERROR;
+}
+
+/*
+ * tde_decrypt_with_dk () - Decryption with a data key, using the cipher context cached in the current thread
+ *
+ * return               : Error code
+ * cipher_buffer (in)   : Data to decrypt
+ * length (in)          : The length of data
+ * tde_algo (in)        : Encryption algorithm
+ * dk_type (in)         : Data key type
+ * dk_gen (in)          : Generation of the data key, only for the perm data key
+ * nonce (in)           : nonce used during encryption
+ * plain_buffer (out)   : Decrypted data
+ */
+static int
+tde_decrypt_with_dk (const unsigned char *cipher_buffer, int length, TDE_ALGORITHM tde_algo, TDE_DATA_KEY_TYPE dk_type,
+		     int dk_gen, const unsigned char *nonce, unsigned char *plain_buffer)
+{
+  EVP_CIPHER_CTX *ctx;
+  int len;
+  int plain_len;
+  PERF_UTIME_TRACKER time_track;
+
+  PERF_UTIME_TRACKER_START (NULL, &time_track);
+
+  ctx = tde_get_dk_cipher_ctx (dk_type, dk_gen, tde_algo, false);
+  if (ctx == NULL)
+    {
+      goto error;
+    }
+
+  /* the key schedule is kept, only the nonce is reset */
+  if (EVP_DecryptInit_ex (ctx, NULL, NULL, NULL, nonce) != 1)
+    {
+      goto error;
+    }
+
+  if (EVP_DecryptUpdate (ctx, plain_buffer, &len, cipher_buffer, length) != 1)
+    {
+      goto error;
+    }
+  plain_len = len;
+
+  if (EVP_DecryptFinal_ex (ctx, plain_buffer + len, &len) != 1)
+    {
+      goto error;
+    }
+  plain_len += len;
+
+  assert (plain_len == length);
+
+  PERF_UTIME_TRACKER_TIME (NULL, &time_track, tde_Decrypt_pstat_ids[dk_type]);
+  perfmon_add_stat (NULL, PSTAT_TDE_NUM_DECRYPTED_BYTES, length);
+
+  return NO_ERROR;
+
+error:
+  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DECRYPTION_ERROR, 0);
+  return ER_TDE_DECRYPTION_ERROR;
+}
+
+#if defined (SERVER_MODE)
+/*
+ * tde_log_keystream_init () - Prepare the keystream buffers for the log append pages
+ *
+ * return             : Error code
+ */
+int
+tde_log_keystream_init (void)
+{
+  TDE_LOG_KEYSTREAM *ks;
+  int i;
+
+  assert (!tde_Log_keystream_enabled);
+
+  if (!tde_Log_keystream_mutex_initialized)
+    {
+      for (i = 0; i < TDE_LOG_KEYSTREAM_COUNT; i++)
+	{
+	  pthread_mutex_init (&tde_Log_keystreams[i].mutex, NULL);
+	  tde_Log_keystreams[i].keystream = NULL;
+	}
+      tde_Log_keystream_mutex_initialized = true;
+    }
+
+  for (i = 0; i < TDE_LOG_KEYSTREAM_COUNT; i++)
+    {
+      ks = &tde_Log_keystreams[i];
+
+      pthread_mutex_lock (&ks->mutex);
+      ks->pageid = NULL_PAGEID;
+      ks->tde_algo = TDE_ALGORITHM_NONE;
+      ks->dks_version = -1;
+      ks->keystream = (unsigned char *) malloc (TDE_LOG_PAGE_ENC_LENGTH);
+      pthread_mutex_unlock (&ks->mutex);
+
+      if (ks->keystream == NULL)
+	{
+	  tde_log_keystream_final ();
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) TDE_LOG_PAGE_ENC_LENGTH);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+
+  tde_Log_keystream_enabled = true;
+
+  return NO_ERROR;
+}
+
+/*
+ * tde_log_keystream_final () - Release the keystream buffers for the log append pages
+ *
+ * The mutexes are kept, a flusher may still try a slot while it is being released.
+ */
+void
+tde_log_keystream_final (void)
+{
+  TDE_LOG_KEYSTREAM *ks;
+  int i;
+
+  tde_Log_keystream_enabled = false;
+
+  if (!tde_Log_keystream_mutex_initialized)
+    {
+      return;
+    }
+
+  for (i = 0; i < TDE_LOG_KEYSTREAM_COUNT; i++)
+    {
+      ks = &tde_Log_keystreams[i];
+
+      pthread_mutex_lock (&ks->mutex);
+      if (ks->keystream != NULL)
+	{
+	  free (ks->keystream);
+	  ks->keystream = NULL;
+	}
+      ks->pageid = NULL_PAGEID;
+      pthread_mutex_unlock (&ks->mutex);
+    }
+}
+
+/*
+ * tde_prefetch_log_keystream () - Make the keystreams of the log pages from start_pageid ahead of time
+ *
+ * start_pageid (in)  : The first logical page id to prepare, usually the current append page
+ * tde_algo (in)      : Encryption algorithm the pages will be encrypted with
+ *
+ * The keystream is the encryption of a zero page with the nonce of the page. It is made outside of the log flush,
+ * usually by a daemon.
+ */
+void
+tde_prefetch_log_keystream (LOG_PAGEID start_pageid, TDE_ALGORITHM tde_algo)
+{
+  unsigned char nonce[TDE_LOG_PAGE_NONCE_LENGTH] = { 0, };
+  TDE_LOG_KEYSTREAM *ks;
+  LOG_PAGEID pageid;
+  int64_t dks_version;
+
+  if (!tde_Log_keystream_enabled || !tde_Cipher.is_loaded || start_pageid < 0 || tde_algo == TDE_ALGORITHM_NONE)
+    {
+      return;
+    }
+
+  dks_version = ATOMIC_LOAD_64 (&tde_Cipher.dks_version);
+
+  for (pageid = start_pageid; pageid < start_pageid + TDE_LOG_KEYSTREAM_COUNT; pageid++)
+    {
+      ks = &tde_Log_keystreams[pageid % TDE_LOG_KEYSTREAM_COUNT];
+
+      pthread_mutex_lock (&ks->mutex);
+      if (ks->keystream == NULL
+	  || (ks->pageid == pageid && ks->tde_algo == tde_algo && ks->dks_version == dks_version))
+	{
+	  /* released or already prepared */
+	  pthread_mutex_unlock (&ks->mutex);
+	  continue;
+	}
+
+      memset (nonce, 0, TDE_LOG_PAGE_NONCE_LENGTH);
+      memcpy (nonce, &pageid, sizeof (pageid));
+      memset (ks->keystream, 0, TDE_LOG_PAGE_ENC_LENGTH);
+
+      if (tde_encrypt_with_dk (ks->keystream, TDE_LOG_PAGE_ENC_LENGTH, tde_algo, TDE_DATA_KEY_TYPE_LOG, 0, nonce,
+			       ks->keystream) != NO_ERROR)
+	{
+	  /* not critical, the page will be encrypted as usual */
+	  er_clear ();
+	  ks->pageid = NULL_PAGEID;
+	  pthread_mutex_unlock (&ks->mutex);
+	  return;
+	}
+
+      ks->pageid = pageid;
+      ks->tde_algo = tde_algo;
+      ks->dks_version = dks_version;
+      pthread_mutex_unlock (&ks->mutex);
+    }
+}
+
+/*
+ * tde_apply_log_keystream () - En/decrypt a log page with its precomputed keystream if it is prepared
+ *
+ * return             : true if the page is processed, false if the keystream isn't available
+ * logpage_in (in)    : Log page to en/decrypt
+ * tde_algo (in)      : Encryption algorithm
+ * logpage_out (out)  : En/decrypted log page. The header has to be copied by the caller.
+ *
+ * CTR mode is symmetric, so the same keystream is used for both encryption and decryption.
+ * It never waits for the slot; if the prefetcher is holding it, the caller does the cipher work by itself.
+ */
+static bool
+tde_apply_log_keystream (const LOG_PAGE * logpage_in, TDE_ALGORITHM tde_algo, LOG_PAGE * logpage_out)
+{
+  LOG_PAGEID pageid = logpage_in->hdr.logical_pageid;
+  const unsigned char *in = ((const unsigned char *) logpage_in) + TDE_LOG_PAGE_ENC_OFFSET;
+  unsigned char *out = ((unsigned char *) logpage_out) + TDE_LOG_PAGE_ENC_OFFSET;
+  TDE_LOG_KEYSTREAM *ks;
+  UINT64 word, ks_word;
+  int length = TDE_LOG_PAGE_ENC_LENGTH;
+  int i;
+
+  if (!tde_Log_keystream_enabled || pageid < 0)
+    {
+      return false;
+    }
+
+  ks = &tde_Log_keystreams[pageid % TDE_LOG_KEYSTREAM_COUNT];
+  if (pthread_mutex_trylock (&ks->mutex) != 0)
+    {
+      return false;
+    }
+
+  if (ks->keystream == NULL || ks->pageid != pageid || ks->tde_algo != tde_algo
+      || ks->dks_version != ATOMIC_LOAD_64 (&tde_Cipher.dks_version))
+    {
+      pthread_mutex_unlock (&ks->mutex);
+      return false;
+    }
+
+  for (i = 0; i + (int) sizeof (UINT64) <= length; i += sizeof (UINT64))
+    {
+      memcpy (&word, in + i, sizeof (UINT64));
+      memcpy (&ks_word, ks->keystream + i, sizeof (UINT64));
+      word ^= ks_word;
+      memcpy (out + i, &word, sizeof (UINT64));
+    }
+  for (; i < length; i++)
+    {
+      out[i] = in[i] ^ ks->keystream[i];
+    }
+
+  pthread_mutex_unlock (&ks->mutex);
+
+  return true;
+}
+
+/*
+ * tde_rekey_execute () - Execute function of the TDE rekey daemon
+ *
+ * thread_ref (in)    : Thread entry
+ */
+static void
+tde_rekey_execute (cubthread::entry & thread_ref)
+{
+  if (!BO_IS_SERVER_RESTARTED () || !tde_Cipher.is_loaded || !tde_Cipher.is_rekeying)
+    {
+      return;
+    }
+
+  if (tde_rekey_perm_pages (&thread_ref) != NO_ERROR)
+    {
+      /* try again at the next wakeup */
+      er_clear ();
+    }
+}
+
+/*
+ * tde_rekey_daemon_init () - Initialize the TDE rekey daemon
+ *
+ * A rotation interrupted by shutdown is resumed, since the keyinfo says it is still rekeying.
+ */
+void
+tde_rekey_daemon_init (void)
+{
+  assert (tde_Rekey_daemon == NULL);
+
+  // *INDENT-OFF*
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (TDE_REKEY_DAEMON_INTERVAL_MSECS));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (tde_rekey_execute);
+  // *INDENT-ON*
+
+  tde_Rekey_daemon_context_manager = new tde_rekey_daemon_context_manager ();
+  tde_Rekey_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "tde_rekey",
+							       tde_Rekey_daemon_context_manager);
+}
+
+/*
+ * tde_rekey_daemon_destroy () - Destroy the TDE rekey daemon
+ */
+void
+tde_rekey_daemon_destroy (void)
+{
+  cubthread::get_manager ()->destroy_daemon (tde_Rekey_daemon);
+  delete tde_Rekey_daemon_context_manager;
+  tde_Rekey_daemon_context_manager = NULL;
+}
+#endif /* SERVER_MODE */
+
 /*
  * xtde_get_mk_info () - Get some information of the master key set on the database
  *
@@ -1298,6 +2600,53 @@ exit:
   return err;
 }
 
+/*
+ * xtde_rotate_dk_without_flock () - Rotate the perm data key on the database.
+ *                                   It mounts the key file without file lock to load the master key.
+ *
+ * return             : Error code
+ * thread_p (in)      : Thread entry
+ * dk_gen (out)       : Generation of the new perm data key
+ */
+int
+xtde_rotate_dk_without_flock (THREAD_ENTRY * thread_p, int *dk_gen)
+{
+  char mk_path[PATH_MAX] = { 0, };
+  TDE_KEYINFO keyinfo;
+  unsigned char master_key[TDE_MASTER_KEY_LENGTH] = { 0, };
+  int vdes;
+  int err = NO_ERROR;
+
+  tde_make_keys_file_fullname (mk_path, boot_db_full_name (), false);
+
+  /* Without file lock: It is because it must've already been locked in client-side: tde() */
+  vdes = fileio_open (mk_path, O_RDONLY, 0);
+  if (vdes == NULL_VOLDES)
+    {
+      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_IO_MOUNT_FAIL, 1, mk_path);
+      return ER_IO_MOUNT_FAIL;
+    }
+
+  err = tde_get_keyinfo (thread_p, &keyinfo);
+  if (err != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  err = tde_load_mk (vdes, &keyinfo, master_key);
+  if (err != NO_ERROR)
+    {
+      goto exit;
+    }
+
+  err = tde_rotate_perm_dk (thread_p, master_key, dk_gen);
+
+exit:
+  memset (master_key, 0, TDE_MASTER_KEY_LENGTH);
+  fileio_close (vdes);
+  return err;
+}
+
 #endif /* !CS_MODE */
 
 /*
@@ -54,6 +54,14 @@ typedef log_page LOG_PAGE;
 #define TDE_MASTER_KEY_LENGTH 32
 #define TDE_DATA_KEY_LENGTH   32
 
+/*
+ * The permanent data key can be rotated. Each perm page records the generation of the key it is encrypted with
+ * (prv.tde_dk_gen), and the keys of the current and the previous generation are kept.
+ * The key of a generation is in the slot of TDE_PERM_KEY_SLOT (gen).
+ */
+#define TDE_PERM_KEY_SLOT_COUNT 2
+#define TDE_PERM_KEY_SLOT(gen)  ((gen) % TDE_PERM_KEY_SLOT_COUNT)
+
 /* TDE Key file item locations */
 #define TDE_MK_FILE_CONTENTS_START  CUBRID_MAGIC_MAX_LENGTH
 #define TDE_MK_FILE_ITEM_SIZE       (sizeof (TDE_MK_FILE_ITEM))
@@ -95,12 +103,6 @@ typedef struct tde_mk_file_item
   unsigned char master_key[TDE_MASTER_KEY_LENGTH];
 } TDE_MK_FILE_ITEM;
 
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-#if defined(CS_MODE)
-#define TDE_HA_SOCK_NAME ".ha_sock"
-#endif /* CS_MODE */
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
-
 #if !defined(CS_MODE)
 
 /* Is log record contains User Data */
@@ -146,8 +148,12 @@ typedef struct tde_mk_file_item
 typedef struct tde_cipher
 {
   bool is_loaded;
-  TDE_DATA_KEY_SET data_keys;	/* data keys decrypted from tde keyinfo heap, which is constant */
-  int64_t temp_write_counter;	/* used as nonce for temp file page, it has to be dealt atomically */
+  TDE_DATA_KEY_SET data_keys;	/* data keys decrypted from tde keyinfo heap, perm_key is of the current generation */
+  unsigned char perm_keys[TDE_PERM_KEY_SLOT_COUNT][TDE_DATA_KEY_LENGTH];	/* perm keys by generation slot */
+  int perm_key_gen;		/* the current generation of the perm data key */
+  bool is_rekeying;		/* perm pages of the previous generation may remain */
+  int64_t temp_write_counter;	/* used as nonce for temp file page, threads reserve ranges of it atomically */
+  int64_t dks_version;		/* increased whenever data_keys are loaded, invalidates cached cipher contexts */
 } TDE_CIPHER;
 
 extern TDE_CIPHER tde_Cipher;	/* global var for TDE Module */
@@ -164,6 +170,10 @@ typedef struct tde_keyinfo
   unsigned char dk_perm[TDE_DATA_KEY_LENGTH];
   unsigned char dk_temp[TDE_DATA_KEY_LENGTH];
   unsigned char dk_log[TDE_DATA_KEY_LENGTH];
+  /* appended for the perm data key rotation, zero in the keyinfo of older databases */
+  int dk_perm_gen;		/* generation of dk_perm */
+  bool is_rekeying;		/* dk_perm_prev is still needed to read some pages */
+  unsigned char dk_perm_prev[TDE_DATA_KEY_LENGTH];	/* dk_perm of the generation (dk_perm_gen - 1) */
 } TDE_KEYINFO;
 
 extern int tde_initialize (THREAD_ENTRY * thread_p, HFID * keyinfo_hfid);
@@ -181,11 +191,23 @@ extern int tde_load_mk (int vdes, const TDE_KEYINFO * keyinfo, unsigned char *ma
 extern int tde_change_mk (THREAD_ENTRY * thread_p, const int mk_index, const unsigned char *master_key,
 			  const time_t created_time);
 
+/*
+ * tde functions for the perm data key rotation
+ */
+extern int tde_rotate_perm_dk (THREAD_ENTRY * thread_p, const unsigned char *master_key, int *dk_gen);
+extern int tde_rekey_perm_pages (THREAD_ENTRY * thread_p);
+#if defined (SERVER_MODE)
+extern void tde_rekey_daemon_init (void);
+extern void tde_rekey_daemon_destroy (void);
+#endif /* SERVER_MODE */
+
 /*
  * TDE functions for encrpytion and decryption
  */
 extern int tde_encrypt_data_page (const FILEIO_PAGE * iopage_plain, TDE_ALGORITHM tde_algo, bool is_temp,
 				  FILEIO_PAGE * iopage_cipher);
+extern int tde_encrypt_data_pages (const FILEIO_PAGE ** iopages_plain, const TDE_ALGORITHM * tde_algos, bool is_temp,
+				   FILEIO_PAGE ** iopages_cipher, int count);
 extern int tde_decrypt_data_page (const FILEIO_PAGE * iopage_cipher, TDE_ALGORITHM tde_algo, bool is_temp,
 				  FILEIO_PAGE * iopage_plain);
 /* 
@@ -195,6 +217,15 @@ extern int tde_decrypt_data_page (const FILEIO_PAGE * iopage_cipher, TDE_ALGORIT
 extern int tde_encrypt_log_page (const LOG_PAGE * logpage_plain, TDE_ALGORITHM tde_algo, LOG_PAGE * logpage_cipher);
 extern int tde_decrypt_log_page (const LOG_PAGE * logpage_cipher, TDE_ALGORITHM tde_algo, LOG_PAGE * logpage_plain);
 
+#if defined (SERVER_MODE)
+/*
+ * Keystream precomputation for log append pages
+ */
+extern int tde_log_keystream_init (void);
+extern void tde_log_keystream_final (void);
+extern void tde_prefetch_log_keystream (LOG_PAGEID start_pageid, TDE_ALGORITHM tde_algo);
+#endif /* SERVER_MODE */
+
 #endif /* !CS_MODE */
 
 /*
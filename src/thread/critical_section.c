@@ -91,6 +91,12 @@ static const char *csect_Names[] = {
   "ACCESS_STATUS"
 };
 
+/* read-mostly critical sections whose readers count themselves in per-thread reader slots */
+static const int csect_Big_reader_sections[] = {
+  CSECT_LOCATOR_SR_CLASSNAME_TABLE,
+  CSECT_CT_OID_TABLE
+};
+
 static const char *
 csect_name (SYNC_CRITICAL_SECTION * c)
 {
@@ -131,6 +137,11 @@ static int csect_wakeup_waiting_promoter (SYNC_CRITICAL_SECTION * csect);
 static int csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs);
 static int csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs);
 static int csect_check_own_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect);
+static int csect_initialize_reader_slots (SYNC_CRITICAL_SECTION * csect);
+static SYNC_READER_SLOT *csect_get_reader_slot (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect);
+static bool csect_has_writer (SYNC_CRITICAL_SECTION * csect);
+static bool csect_enter_as_fast_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect);
+static void csect_wait_fast_readers (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect);
 
 static SYNC_STATS_CHUNK *sync_allocate_sync_stats_chunk (void);
 static int sync_initialize_sync_stats_chunk (SYNC_STATS_CHUNK * sync_stats_chunk);
@@ -180,6 +191,7 @@ csect_initialize_critical_section (SYNC_CRITICAL_SECTION * csect, const char *na
   csect->waiting_writers = 0;
   csect->waiting_writers_queue = NULL;
   csect->waiting_promoters_queue = NULL;
+  csect->reader_slots = NULL;
 
   csect->stats = sync_allocate_sync_stats (SYNC_TYPE_CSECT, name);
   if (csect->stats == NULL)
@@ -226,6 +238,11 @@ csect_finalize_critical_section (SYNC_CRITICAL_SECTION * csect)
   csect->waiting_writers_queue = NULL;
   csect->waiting_promoters_queue = NULL;
 
+  if (csect->reader_slots != NULL)
+    {
+      free_and_init (csect->reader_slots);
+    }
+
   error_code = sync_deallocate_sync_stats (csect->stats);
   csect->stats = NULL;
 
@@ -255,6 +272,11 @@ csect_initialize_static_critical_sections (void)
       csect->cs_index = i;
     }
 
+  for (i = 0; i < (int) DIM (csect_Big_reader_sections) && error_code == NO_ERROR; i++)
+    {
+      error_code = csect_initialize_reader_slots (&csectgl_Critical_sections[csect_Big_reader_sections[i]]);
+    }
+
   return error_code;
 }
 
@@ -285,6 +307,127 @@ csect_finalize_static_critical_sections (void)
   return error_code;
 }
 
+/*
+ * csect_initialize_reader_slots() - make a critical section a big-reader one
+ *   return: 0 if success, or error code
+ *   csect(in): critical section
+ *
+ * Note: readers of a big-reader csect enter it by incrementing their own reader slot, without taking its monitor lock,
+ *       as long as no writer owns the csect or waits for it. A writer has to wait all the slots drain once it owns
+ *       the csect. This suits only the csects that are read much more often than written.
+ */
+static int
+csect_initialize_reader_slots (SYNC_CRITICAL_SECTION * csect)
+{
+  size_t size = CSECT_READER_SLOT_COUNT * sizeof (SYNC_READER_SLOT);
+
+  assert (csect->reader_slots == NULL);
+
+  csect->reader_slots = (SYNC_READER_SLOT *) malloc (size);
+  if (csect->reader_slots == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+  memset (csect->reader_slots, 0, size);
+
+  return NO_ERROR;
+}
+
+/*
+ * csect_get_reader_slot() - get the reader slot of current thread
+ *   return: reader slot or NULL if csect is not big-reader or thread has no slot
+ *   thread_p(in): thread entry
+ *   csect(in): critical section
+ */
+static SYNC_READER_SLOT *
+csect_get_reader_slot (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect)
+{
+  if (csect->reader_slots == NULL || thread_p->index < 0 || thread_p->index >= CSECT_READER_SLOT_COUNT)
+    {
+      return NULL;
+    }
+  return &csect->reader_slots[thread_p->index];
+}
+
+/*
+ * csect_has_writer() - does a writer own the csect or wait for it?
+ *   return: true if readers must take the monitor lock
+ *   csect(in): critical section
+ *
+ * Note: it is read without the monitor lock. Readers, then, must check it again after they announced themselves.
+ */
+static bool
+csect_has_writer (SYNC_CRITICAL_SECTION * csect)
+{
+  return *(volatile int *) &csect->rwlock < 0 || *(volatile unsigned int *) &csect->waiting_writers > 0;
+}
+
+/*
+ * csect_enter_as_fast_reader() - try to enter a big-reader csect as a reader without taking its monitor lock
+ *   return: true if entered, false if caller must take the shared path
+ *   thread_p(in): thread entry
+ *   csect(in): critical section
+ *
+ * Note: the reads entered this way are not counted in the csect statistics; counting them would bring back writes to
+ *       the shared cache line.
+ */
+static bool
+csect_enter_as_fast_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect)
+{
+  SYNC_READER_SLOT *slot = csect_get_reader_slot (thread_p, csect);
+
+  if (slot == NULL || csect_has_writer (csect))
+    {
+      return false;
+    }
+
+  /* announce the read first (this is a full barrier), then check no writer came meanwhile. writers do the opposite. */
+  ATOMIC_INC_32 (&slot->count, 1);
+  if (csect_has_writer (csect))
+    {
+      ATOMIC_INC_32 (&slot->count, -1);
+      return false;
+    }
+
+  return true;
+}
+
+/*
+ * csect_wait_fast_readers() - wait all readers that entered a big-reader csect without its monitor lock to exit
+ *   return: void
+ *   thread_p(in): thread entry of the writer
+ *   csect(in): critical section, owned by writer
+ *
+ * Note: called with monitor lock held, right after the writer made rwlock negative; new readers take the monitor
+ *       lock and wait the writer from now on.
+ */
+static void
+csect_wait_fast_readers (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect)
+{
+  SYNC_READER_SLOT *my_slot;
+  int i;
+
+  if (csect->reader_slots == NULL)
+    {
+      return;
+    }
+
+  /* a writer must not have entered as a reader; it would wait itself */
+  my_slot = csect_get_reader_slot (thread_p, csect);
+  assert (my_slot == NULL || my_slot->count == 0);
+
+  MEMORY_BARRIER ();
+
+  for (i = 0; i < CSECT_READER_SLOT_COUNT; i++)
+    {
+      while (csect->reader_slots[i].count > 0)
+	{
+	  std::this_thread::yield ();
+	}
+    }
+}
+
 static int
 csect_wait_on_writer_queue (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int timeout, struct timespec *to)
 {
@@ -315,7 +458,9 @@ csect_wait_on_writer_queue (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * cse
 
   while (true)
     {
+      thread_wait_event_begin_csect (thread_p, csect->name);
       err = thread_suspend_with_other_mutex (thread_p, &csect->lock, timeout, to, THREAD_CSECT_WRITER_SUSPENDED);
+      thread_wait_event_end (thread_p);
 
       if (thread_p->resume_status == THREAD_RESUME_DUE_TO_INTERRUPT && thread_p->interrupted)
 	{
@@ -384,7 +529,9 @@ csect_wait_on_promoter_queue (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
 
   while (1)
     {
+      thread_wait_event_begin_csect (thread_p, csect->name);
       err = thread_suspend_with_other_mutex (thread_p, &csect->lock, timeout, to, THREAD_CSECT_PROMOTER_SUSPENDED);
+      thread_wait_event_end (thread_p);
 
       if (thread_p->resume_status == THREAD_RESUME_DUE_TO_INTERRUPT && thread_p->interrupted)
 	{
@@ -621,6 +768,10 @@ csect_enter_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * c
 
   /* rwlock will be < 0. It denotes that a writer owns the csect. */
   csect->rwlock--;
+  if (csect->rwlock == -1)
+    {
+      csect_wait_fast_readers (thread_p, csect);
+    }
 
   /* record that I am the writer of the csect. */
   csect->owner = thread_p->get_id ();
@@ -705,6 +856,12 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
       thread_p = thread_get_thread_entry_info ();
     }
 
+  if (csect_enter_as_fast_reader (thread_p, csect))
+    {
+      thread_p->get_csect_tracker ().on_enter_as_reader (csect->cs_index);
+      return NO_ERROR;
+    }
+
   csect->stats->nenter++;
 
   tsc_getticks (&start_tick);
@@ -740,7 +897,9 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
 		  tsc_getticks (&wait_start_tick);
 		}
 
+	      thread_wait_event_begin_csect (thread_p, csect->name);
 	      error_code = pthread_cond_wait (&csect->readers_ok, &csect->lock);
+	      thread_wait_event_end (thread_p);
 	      if (thread_p->event_stats.trace_slow_query == true)
 		{
 		  tsc_getticks (&wait_end_tick);
@@ -789,7 +948,9 @@ csect_enter_critical_section_as_reader (THREAD_ENTRY * thread_p, SYNC_CRITICAL_S
 		  tsc_getticks (&wait_start_tick);
 		}
 
+	      thread_wait_event_begin_csect (thread_p, csect->name);
 	      error_code = pthread_cond_timedwait (&csect->readers_ok, &csect->lock, &to);
+	      thread_wait_event_end (thread_p);
 	      if (thread_p->event_stats.trace_slow_query == true)
 		{
 		  tsc_getticks (&wait_end_tick);
@@ -983,7 +1144,9 @@ csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 		  tsc_getticks (&wait_start_tick);
 		}
 
+	      thread_wait_event_begin_csect (thread_p, csect->name);
 	      error_code = pthread_cond_wait (&csect->readers_ok, &csect->lock);
+	      thread_wait_event_end (thread_p);
 	      if (thread_p->event_stats.trace_slow_query == true)
 		{
 		  tsc_getticks (&wait_end_tick);
@@ -1032,7 +1195,9 @@ csect_demote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 		  tsc_getticks (&wait_start_tick);
 		}
 
+	      thread_wait_event_begin_csect (thread_p, csect->name);
 	      error_code = pthread_cond_timedwait (&csect->readers_ok, &csect->lock, &to);
+	      thread_wait_event_end (thread_p);
 	      if (thread_p->event_stats.trace_slow_query == true)
 		{
 		  tsc_getticks (&wait_end_tick);
@@ -1167,6 +1332,7 @@ static int
 csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect, int wait_secs)
 {
   int error_code = NO_ERROR, r;
+  SYNC_READER_SLOT *slot;
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
   TSC_TICKS wait_start_tick, wait_end_tick;
@@ -1191,6 +1357,18 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
       return ER_CSS_PTHREAD_MUTEX_LOCK;
     }
 
+  slot = csect_get_reader_slot (thread_p, csect);
+  if (slot != NULL && slot->count > 0)
+    {
+      /*
+       * I entered as a reader without the monitor lock. No writer can own the csect while I hold the monitor lock,
+       * since writers wait fast readers with it held. Turn my read into a regular one.
+       */
+      assert (csect->rwlock >= 0);
+      csect->rwlock++;
+      ATOMIC_INC_32 (&slot->count, -1);
+    }
+
   if (csect->rwlock > 0)
     {
       /*
@@ -1309,6 +1487,10 @@ csect_promote_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION *
 
   /* rwlock will be < 0. It denotes that a writer owns the csect. */
   csect->rwlock--;
+  if (csect->rwlock == -1)
+    {
+      csect_wait_fast_readers (thread_p, csect);
+    }
   /* record that I am the writer of the csect. */
   csect->owner = thread_p->get_id ();
   csect->tran_index = thread_p->tran_index;
@@ -1374,6 +1556,7 @@ csect_exit_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * cs
 {
   int error_code = NO_ERROR;
   bool ww, wr, wp;
+  SYNC_READER_SLOT *slot;
 
   assert (csect != NULL);
 
@@ -1382,6 +1565,15 @@ csect_exit_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * cs
       thread_p = thread_get_thread_entry_info ();
     }
 
+  slot = csect_get_reader_slot (thread_p, csect);
+  if (slot != NULL && slot->count > 0)
+    {
+      /* I entered as a reader without the monitor lock. A writer may be waiting my slot to drain. */
+      ATOMIC_INC_32 (&slot->count, -1);
+      thread_p->get_csect_tracker ().on_exit (csect->cs_index);
+      return NO_ERROR;
+    }
+
   error_code = pthread_mutex_lock (&csect->lock);
   if (error_code != NO_ERROR)
     {
@@ -1567,12 +1759,20 @@ static int
 csect_check_own_critical_section (THREAD_ENTRY * thread_p, SYNC_CRITICAL_SECTION * csect)
 {
   int error_code = NO_ERROR, return_code;
+  SYNC_READER_SLOT *slot;
 
   if (thread_p == NULL)
     {
       thread_p = thread_get_thread_entry_info ();
     }
 
+  slot = csect_get_reader_slot (thread_p, csect);
+  if (slot != NULL && slot->count > 0)
+    {
+      /* has the read lock, entered without the monitor lock */
+      return 2;
+    }
+
   error_code = pthread_mutex_lock (&csect->lock);
   if (error_code != NO_ERROR)
     {
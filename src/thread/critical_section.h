@@ -106,6 +106,19 @@ typedef struct sync_stats
   struct timeval max_elapsed;	/* max elapsed time to acquire the synchronization primitive */
 } SYNC_STATS;
 
+/*
+ * Reader slot of a big-reader critical section. Each thread counts its own fast-path reads in its own slot, padded to
+ * a cache line, so concurrent readers never write the same line; a writer has to scan all the slots.
+ */
+#define CSECT_READER_SLOT_COUNT 1024
+#define CSECT_READER_SLOT_SIZE 64
+
+typedef union sync_reader_slot
+{
+  volatile int count;		/* # of times the owner thread entered as a reader on the fast path */
+  char pad[CSECT_READER_SLOT_SIZE];
+} SYNC_READER_SLOT;
+
 typedef struct sync_critical_section
 {
   const char *name;
@@ -120,6 +133,7 @@ typedef struct sync_critical_section
   thread_id_t owner;		/* CS owner writer */
   int tran_index;		/* transaction id acquiring CS */
   SYNC_STATS *stats;
+  SYNC_READER_SLOT *reader_slots;	/* per-thread reader slots of a big-reader csect, NULL otherwise */
 } SYNC_CRITICAL_SECTION;
 
 typedef struct sync_rwlock
@@ -0,0 +1,220 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * thread_affinity - implementation of thread placement on NUMA nodes and CPUs
+ */
+
+#include "thread_affinity.hpp"
+
+#if defined (LINUX)
+#include <pthread.h>
+#include <sched.h>
+#endif // LINUX
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+namespace cubthread
+{
+#if defined (LINUX)
+  static const std::size_t NUMA_MAX_NODES = 64;
+
+  struct numa_topology
+  {
+    std::size_t m_node_count;
+    cpu_set_t m_node_cpus[NUMA_MAX_NODES];
+    unsigned char m_cpu_node[CPU_SETSIZE];
+
+    numa_topology ();
+  };
+
+  /*
+   * parse_cpu_list () - parse a list of CPUs, like "0-7,16-23"
+   *   return: true if the list is valid and has at least one CPU
+   *   cpu_list (in): list of CPUs
+   *   cpus_out (out): CPU set
+   */
+  static bool
+  parse_cpu_list (const char *cpu_list, cpu_set_t &cpus_out)
+  {
+    const char *p = cpu_list;
+    char *end;
+    long first_cpu, last_cpu, cpu;
+
+    CPU_ZERO (&cpus_out);
+    if (p == NULL)
+      {
+	return false;
+      }
+
+    while (true)
+      {
+	first_cpu = strtol (p, &end, 10);
+	if (end == p || first_cpu < 0)
+	  {
+	    return false;
+	  }
+	last_cpu = first_cpu;
+	if (*end == '-')
+	  {
+	    p = end + 1;
+	    last_cpu = strtol (p, &end, 10);
+	    if (end == p || last_cpu < first_cpu)
+	      {
+		return false;
+	      }
+	  }
+	for (cpu = first_cpu; cpu <= last_cpu && cpu < CPU_SETSIZE; cpu++)
+	  {
+	    CPU_SET (cpu, &cpus_out);
+	  }
+	if (*end != ',')
+	  {
+	    break;
+	  }
+	p = end + 1;
+      }
+
+    return CPU_COUNT (&cpus_out) > 0;
+  }
+
+  numa_topology::numa_topology ()
+    : m_node_count (0)
+  {
+    char path[256];
+    char cpulist[1024];
+    FILE *fp;
+    char *p;
+
+    for (std::size_t cpu = 0; cpu < CPU_SETSIZE; cpu++)
+      {
+	m_cpu_node[cpu] = 0;
+      }
+
+    for (; m_node_count < NUMA_MAX_NODES; m_node_count++)
+      {
+	snprintf (path, sizeof (path), "/sys/devices/system/node/node%zu/cpulist", m_node_count);
+	fp = fopen (path, "r");
+	if (fp == NULL)
+	  {
+	    break;
+	  }
+	p = fgets (cpulist, sizeof (cpulist), fp);
+	fclose (fp);
+	if (p == NULL || !parse_cpu_list (cpulist, m_node_cpus[m_node_count]))
+	  {
+	    // a node without CPUs (memory only) ends the numbering too, its threads would have nowhere to run
+	    break;
+	  }
+	for (std::size_t cpu = 0; cpu < CPU_SETSIZE; cpu++)
+	  {
+	    if (CPU_ISSET (cpu, &m_node_cpus[m_node_count]))
+	      {
+		m_cpu_node[cpu] = (unsigned char) m_node_count;
+	      }
+	  }
+      }
+
+    if (m_node_count == 0)
+      {
+	// no NUMA; a single node with all CPUs
+	m_node_count = 1;
+	if (sched_getaffinity (0, sizeof (cpu_set_t), &m_node_cpus[0]) != 0)
+	  {
+	    CPU_ZERO (&m_node_cpus[0]);
+	  }
+      }
+  }
+
+  static const numa_topology &
+  get_numa_topology (void)
+  {
+    // initialized once, on first use
+    static numa_topology topology;
+    return topology;
+  }
+#endif // LINUX
+
+  std::size_t
+  get_numa_node_count (void)
+  {
+#if defined (LINUX)
+    return get_numa_topology ().m_node_count;
+#else // not LINUX
+    return 1;
+#endif // not LINUX
+  }
+
+  std::size_t
+  get_current_numa_node (void)
+  {
+#if defined (LINUX)
+    const numa_topology &topology = get_numa_topology ();
+    int cpu;
+
+    if (topology.m_node_count > 1)
+      {
+	cpu = sched_getcpu ();
+	if (cpu >= 0 && cpu < CPU_SETSIZE)
+	  {
+	    return topology.m_cpu_node[cpu];
+	  }
+      }
+#endif // LINUX
+
+    return 0;
+  }
+
+  bool
+  bind_thread_to_numa_node (std::size_t node)
+  {
+#if defined (LINUX)
+    const numa_topology &topology = get_numa_topology ();
+
+    if (node >= topology.m_node_count || CPU_COUNT (&topology.m_node_cpus[node]) == 0)
+      {
+	assert (node < topology.m_node_count);
+	return false;
+      }
+    return pthread_setaffinity_np (pthread_self (), sizeof (cpu_set_t), &topology.m_node_cpus[node]) == 0;
+#else // not LINUX
+    (void) node;
+    return false;
+#endif // not LINUX
+  }
+
+  bool
+  bind_thread_to_cpu_list (std::thread &thread_arg, const char *cpu_list)
+  {
+#if defined (LINUX)
+    cpu_set_t cpus;
+
+    if (!parse_cpu_list (cpu_list, cpus))
+      {
+	return false;
+      }
+    return pthread_setaffinity_np (thread_arg.native_handle (), sizeof (cpu_set_t), &cpus) == 0;
+#else // not LINUX
+    (void) thread_arg;
+    (void) cpu_list;
+    return false;
+#endif // not LINUX
+  }
+} // namespace cubthread
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * thread_affinity - placement of threads on NUMA nodes and CPUs
+ */
+
+#ifndef _THREAD_AFFINITY_HPP_
+#define _THREAD_AFFINITY_HPP_
+
+#include <thread>
+
+#include <cstddef>
+
+namespace cubthread
+{
+  // NUMA topology
+  //
+  //  the NUMA nodes and their CPUs are read once, from sysfs. if the machine has no NUMA (or on platforms other than
+  //  Linux), there is a single node that has all the CPUs.
+  //
+  //  the node of a thread is the node of the CPU it is running on, and it can change at any time unless the thread is
+  //  bound to the CPUs of its node.
+  //
+
+  const std::size_t NUMA_NODE_NONE = static_cast<std::size_t> (-1);
+
+  // get the number of NUMA nodes
+  std::size_t get_numa_node_count (void);
+  // get the NUMA node of the CPU current thread is running on
+  std::size_t get_current_numa_node (void);
+  // bind current thread to the CPUs of the given NUMA node; returns false if it could not be bound
+  bool bind_thread_to_numa_node (std::size_t node);
+  // bind given thread to the CPUs in cpu_list, given like "0-3,8"; returns false if the list is not valid or if the
+  //  thread could not be bound
+  bool bind_thread_to_cpu_list (std::thread &thread_arg, const char *cpu_list);
+} // namespace cubthread
+
+#endif // _THREAD_AFFINITY_HPP_
@@ -23,6 +23,8 @@
 // own header
 #include "thread_daemon.hpp"
 
+#include "thread_affinity.hpp"
+
 // module headers
 #include "thread_task.hpp"
 
@@ -138,6 +140,12 @@ namespace cubthread
     return m_waiter.is_running ();
   }
 
+  bool
+  daemon::set_cpu_affinity (const char *cpu_list)
+  {
+    return bind_thread_to_cpu_list (m_thread, cpu_list);
+  }
+
   std::size_t
   daemon::get_stats_value_count (void)
   {
@@ -106,6 +106,9 @@ namespace cubthread
       void get_stats (cubperf::stat_value *stats_out);
       bool is_running (void);    // true, if running
 
+      // bind daemon thread to the CPUs in cpu_list (like "0-3,8"); returns false if it could not be bound
+      bool set_cpu_affinity (const char *cpu_list);
+
     private:
 
       // loop functions invoked by spawned daemon thread
@@ -88,6 +88,8 @@ namespace cubthread
     , th_entry_lock ()
     , wakeup_cond ()
     , private_heap_id (0)
+    , request_heap_id (0)
+    , request_heap_base (NULL)
     , cnv_adj_buffer ()
     , conn_entry (NULL)
     , xasl_unpack_info_ptr (NULL)
@@ -99,6 +101,7 @@ namespace cubthread
     , request_latch_mode (PGBUF_NO_LATCH)
     , request_fix_count (0)
     , victim_request_fail (false)
+    , pgbuf_bulk_read_count (0)
     , interrupted (false)
     , shutdown (false)
     , check_interrupt (true)
@@ -116,10 +119,17 @@ namespace cubthread
     , log_data_ptr (NULL)
     , log_data_length (0)
     , no_logging (false)
+    , defer_commit_flush (false)
+    , commit_flush_lsa (NULL_LSA)
     , net_request_index (-1)
     , vacuum_worker (NULL)
     , sort_stats_active (false)
+    , btree_insert_hints ()
+    , btree_insert_hint_next (0)
+    , btree_root_copy ()
     , event_stats ()
+    , wait_event (THREAD_WAIT_NONE)
+    , wait_object ()
     , trace_format (0)
     , on_trace (false)
     , clear_trace (false)
@@ -170,6 +180,16 @@ namespace cubthread
     srand48_r ((long) t.tv_usec, &rand_buf);
 
     std::memset (&event_stats, 0, sizeof (event_stats));
+    VPID_SET_NULL (&wait_object.vpid);
+    OID_SET_NULL (&wait_object.oid);
+    wait_object.name = NULL;
+
+    for (THREAD_BTREE_INSERT_HINT &hint : btree_insert_hints)
+      {
+	VPID_SET_NULL (&hint.root_vpid);
+	hint.is_warm = false;
+      }
+    VPID_SET_NULL (&btree_root_copy.root_vpid);
 
     /* lock-free transaction entries */
     tran_entries[THREAD_TS_SPAGE_SAVING] = NULL;
@@ -253,12 +273,22 @@ namespace cubthread
       {
 	free (log_data_ptr);
       }
+    if (btree_root_copy.area != NULL)
+      {
+	free (btree_root_copy.area);
+	btree_root_copy.area = NULL;
+	btree_root_copy.page = NULL;
+	VPID_SET_NULL (&btree_root_copy.root_vpid);
+      }
 
     no_logging = false;
 
     end_resource_tracks ();
 
     db_destroy_private_heap (this, private_heap_id);
+#if defined (SERVER_MODE)
+    db_request_heap_destroy (this);
+#endif // SERVER_MODE
 
 #if !defined (NDEBUG)
     for (int i = 0; i < THREAD_TS_COUNT; i++)
@@ -802,3 +832,33 @@ thread_resume_status_to_string (thread_resume_suspend_status resume_status)
     }
   return "UNKNOWN";
 }
+
+/*
+ * thread_wait_event_to_string () - Translate thread wait event into string representation
+ *   return:
+ *   event(in): wait event
+ */
+const char *
+thread_wait_event_to_string (THREAD_WAIT_EVENT event)
+{
+  switch (event)
+    {
+    case THREAD_WAIT_NONE:
+      return "NONE";
+    case THREAD_WAIT_PAGE_LATCH:
+      return "PAGE_LATCH";
+    case THREAD_WAIT_LOCK:
+      return "LOCK";
+    case THREAD_WAIT_CSECT:
+      return "CSECT";
+    case THREAD_WAIT_LOG_FLUSH:
+      return "LOG_FLUSH";
+    case THREAD_WAIT_IO:
+      return "IO";
+    case THREAD_WAIT_CIPHER:
+      return "CIPHER";
+    case THREAD_WAIT_EVENT_COUNT:
+      break;
+    }
+  return "UNKNOWN";
+}
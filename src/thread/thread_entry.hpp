@@ -27,8 +27,10 @@
 #error Wrong module
 #endif // not SERVER_MODE and not SA_MODE
 
+#include "dbtype_def.h"        // for VPID
 #include "error_context.hpp"
 #include "lockfree_transaction_def.hpp"
+#include "log_lsa.hpp"
 #include "porting.h"        // for pthread_mutex_t, drand48_data
 #include "system.h"         // for UINTPTR, INT64, HL_HEAPID
 
@@ -93,6 +95,51 @@ enum
 #define THREAD_TS_COUNT  THREAD_TS_LAST
 struct lf_tran_entry;
 
+/* the leaf a thread inserted into last in one index, so inserts of clustered keys can skip the descent */
+#define THREAD_BTREE_INSERT_HINT_COUNT 4
+typedef struct thread_btree_insert_hint THREAD_BTREE_INSERT_HINT;
+struct thread_btree_insert_hint
+{
+  VPID root_vpid;		/* identifies the index; NULL if the hint is not used */
+  VPID leaf_vpid;		/* leaf of the last insert */
+  log_lsa leaf_lsa;		/* leaf LSA after the last insert; the hint is valid only while the leaf keeps it */
+  bool is_warm;			/* the last two inserts went to this leaf */
+};
+
+/* a private copy of the root page a thread searched last, so searches can route keys without latching the root */
+typedef struct thread_btree_root_copy THREAD_BTREE_ROOT_COPY;
+struct thread_btree_root_copy
+{
+  VPID root_vpid;		/* NULL if there is no copy */
+  void *bcb;			/* page buffer the root was copied from */
+  INT64 version;		/* root page version when copied; the copy is valid only while the root keeps it */
+  char *page;			/* the copy, aligned in area */
+  char *area;			/* allocated with the first copy */
+};
+
+/* what a thread waits for; set at the wait points, shown by SHOW THREADS and sampled for SHOW WAIT EVENTS */
+typedef enum
+{
+  THREAD_WAIT_NONE = 0,
+  THREAD_WAIT_PAGE_LATCH,	/* page latch, on wait_object.vpid */
+  THREAD_WAIT_LOCK,		/* object lock, on wait_object.oid */
+  THREAD_WAIT_CSECT,		/* critical section, on wait_object.name */
+  THREAD_WAIT_LOG_FLUSH,	/* log flush, up to wait_object.lsa */
+  THREAD_WAIT_IO,		/* page read or write, on wait_object.vpid */
+  THREAD_WAIT_CIPHER,		/* page encryption or decryption, on wait_object.vpid */
+  THREAD_WAIT_EVENT_COUNT
+} THREAD_WAIT_EVENT;
+
+/* the object of a wait; only the member of the wait event is set */
+typedef struct thread_wait_object THREAD_WAIT_OBJECT;
+struct thread_wait_object
+{
+  VPID vpid;
+  OID oid;
+  const char *name;
+  log_lsa lsa;
+};
+
 // for what?? - FIXME
 /* stats for event logging */
 typedef struct event_stat EVENT_STAT;
@@ -103,12 +150,16 @@ struct event_stat
   struct timeval cs_waits;
   struct timeval lock_waits;
   struct timeval latch_waits;
+  struct timeval io_waits;
 
   /* temp volume expand stats */
   struct timeval temp_expand_time;
   int temp_expand_pages;
 
-  /* save PRM_ID_SQL_TRACE_SLOW_MSECS for performance */
+  /* temp file pages allocated, by query results and sorts that do not fit in memory */
+  UINT64 temp_alloc_pages;
+
+  /* save PRM_ID_SQL_TRACE_SLOW_MSECS for performance; also set when query is traced, to collect its waits */
   bool trace_slow_query;
 
   /* log flush thread wait time */
@@ -222,6 +273,8 @@ namespace cubthread
       pthread_cond_t wakeup_cond;	/* wakeup condition */
 
       HL_HEAPID private_heap_id;	/* id of thread private memory allocator */
+      HL_HEAPID request_heap_id;	/* obstack of the memory released at the end of each request */
+      void *request_heap_base;		/* first memory allocated in request heap by current request */
       adj_array *cnv_adj_buffer[3];	/* conversion buffer */
 
       css_conn_entry *conn_entry;	/* conn entry ptr */
@@ -237,6 +290,7 @@ namespace cubthread
       int request_latch_mode;	/* for page latch support */
       int request_fix_count;
       bool victim_request_fail;
+      int pgbuf_bulk_read_count;	/* nesting count of bulk reads, see pgbuf_start_bulk_read () */
       bool interrupted;		/* is this request/transaction interrupted ? */
       std::atomic_bool shutdown;		/* is server going down? */
       bool check_interrupt;		/* check_interrupt == false, during fl_alloc* function call. */
@@ -258,14 +312,29 @@ namespace cubthread
 
       bool no_logging;
 
+      /* commit does not wait for its log flush then, and leaves the LSA to flush in commit_flush_lsa */
+      bool defer_commit_flush;
+      log_lsa commit_flush_lsa;
+
       int net_request_index;	/* request index of net server functions */
 
       struct vacuum_worker *vacuum_worker;	/* Vacuum worker info */
 
       bool sort_stats_active;
 
+      /* see btree_fix_root_for_insert () */
+      THREAD_BTREE_INSERT_HINT btree_insert_hints[THREAD_BTREE_INSERT_HINT_COUNT];
+      int btree_insert_hint_next;	/* next hint to replace */
+      /* see btree_get_root_with_key () */
+      THREAD_BTREE_ROOT_COPY btree_root_copy;
+
       EVENT_STAT event_stats;
 
+      /* current wait, see thread_wait_event_begin_page (); other threads read it without latch, a wait that begins
+       * meanwhile may change the object they read */
+      std::atomic<int> wait_event;	/* THREAD_WAIT_EVENT */
+      THREAD_WAIT_OBJECT wait_object;
+
       /* for query profile */
       int trace_format;
       bool on_trace;
@@ -411,6 +480,13 @@ thread_is_on_trace (cubthread::entry *thread_p)
   return thread_p->on_trace;
 }
 
+// execution profile of query is collected for the query trace and for the slow query log
+inline bool
+thread_is_on_profile (cubthread::entry *thread_p)
+{
+  return thread_p->on_trace || thread_p->event_stats.trace_slow_query;
+}
+
 inline void
 thread_set_clear_trace (cubthread::entry *thread_p, bool clear)
 {
@@ -459,7 +535,64 @@ void thread_wakeup_already_had_mutex (cubthread::entry *p, thread_resume_suspend
 int thread_suspend_with_other_mutex (cubthread::entry *p, pthread_mutex_t *mutexp, int timeout, struct timespec *to,
 				     thread_resume_suspend_status suspended_reason);
 
+inline void
+thread_wait_event_begin (cubthread::entry *thread_p, THREAD_WAIT_EVENT event)
+{
+  thread_p->wait_event.store (event, std::memory_order_release);
+}
+
+/* page latch, I/O and cipher waits */
+inline void
+thread_wait_event_begin_page (cubthread::entry *thread_p, THREAD_WAIT_EVENT event, const VPID *vpid)
+{
+  if (thread_p != NULL)
+    {
+      thread_p->wait_object.vpid = *vpid;
+      thread_wait_event_begin (thread_p, event);
+    }
+}
+
+inline void
+thread_wait_event_begin_lock (cubthread::entry *thread_p, const OID *oid)
+{
+  if (thread_p != NULL)
+    {
+      thread_p->wait_object.oid = *oid;
+      thread_wait_event_begin (thread_p, THREAD_WAIT_LOCK);
+    }
+}
+
+inline void
+thread_wait_event_begin_csect (cubthread::entry *thread_p, const char *csect_name)
+{
+  if (thread_p != NULL)
+    {
+      thread_p->wait_object.name = csect_name;
+      thread_wait_event_begin (thread_p, THREAD_WAIT_CSECT);
+    }
+}
+
+inline void
+thread_wait_event_begin_log_flush (cubthread::entry *thread_p, const log_lsa *flush_lsa)
+{
+  if (thread_p != NULL)
+    {
+      thread_p->wait_object.lsa = *flush_lsa;
+      thread_wait_event_begin (thread_p, THREAD_WAIT_LOG_FLUSH);
+    }
+}
+
+inline void
+thread_wait_event_end (cubthread::entry *thread_p)
+{
+  if (thread_p != NULL)
+    {
+      thread_p->wait_event.store (THREAD_WAIT_NONE, std::memory_order_relaxed);
+    }
+}
+
 const char *thread_type_to_string (thread_type type);
 const char *thread_status_to_string (cubthread::entry::status status);
 const char *thread_resume_status_to_string (thread_resume_suspend_status resume_status);
+const char *thread_wait_event_to_string (THREAD_WAIT_EVENT event);
 #endif // _THREAD_ENTRY_HPP_
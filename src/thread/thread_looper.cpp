@@ -40,6 +40,9 @@ namespace cubthread
     cubperf::stat_definition (STAT_LOOPER_RESET_COUNT, cubperf::stat_definition::COUNTER, "looper_reset_count")
   };
 
+  // timer wheel shared by all loopers
+  static std::atomic<timer_wheel *> Looper_timer_wheel (NULL);
+
   //////////////////////////////////////////////////////////////////////////
   // looper implementation
   //////////////////////////////////////////////////////////////////////////
@@ -52,6 +55,7 @@ namespace cubthread
     , m_was_woken_up (false)
     , m_setup_period ()
     , m_start_execution_time ()
+    , m_timer ()
     , m_stats (*Looper_statistics.create_statset ())
     , m_wait_type (INF_WAITS)
   {
@@ -147,7 +151,15 @@ namespace cubthread
 	    wait_time = period - execution_time;
 	  }
 
-	m_was_woken_up = waiter_arg.wait_for (wait_time);
+	timer_wheel *wheel = Looper_timer_wheel;
+	if (wheel != NULL && wait_time > delta_time (0))
+	  {
+	    m_was_woken_up = waiter_arg.wait_on_timer (*wheel, m_timer, std::chrono::system_clock::now () + wait_time);
+	  }
+	else
+	  {
+	    m_was_woken_up = waiter_arg.wait_for (wait_time);
+	  }
       }
     else
       {
@@ -227,6 +239,12 @@ namespace cubthread
     Looper_statistics.get_stat_values_with_converted_timers<std::chrono::microseconds> (m_stats, stats_out);
   }
 
+  void
+  looper::set_timer_wheel (timer_wheel *wheel)
+  {
+    Looper_timer_wheel = wheel;
+  }
+
   std::size_t
   looper::get_stats_value_count (void)
   {
@@ -24,6 +24,7 @@
 #define _THREAD_LOOPER_HPP_
 
 #include "perf_def.hpp"
+#include "thread_timer_wheel.hpp"
 
 #include <array>
 #include <atomic>
@@ -127,6 +128,9 @@ namespace cubthread
 
       void get_stats (cubperf::stat_value *stats_out);
 
+      // timed waits of all loopers are driven by given timer wheel; NULL to let each waiter time its own waits
+      static void set_timer_wheel (timer_wheel *wheel);
+
     private:
 
       enum wait_type
@@ -154,6 +158,9 @@ namespace cubthread
       // used by put_to_sleep function in order to sleep for difference between period interval and task execution time
       std::chrono::system_clock::time_point m_start_execution_time;
 
+      // wake-up scheduled on the timer wheel, if loopers use one
+      wheel_timer m_timer;
+
       // statistics
       cubperf::statset &m_stats;
 
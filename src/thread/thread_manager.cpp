@@ -41,6 +41,7 @@
 #include "system_parameter.h"
 
 #include <cassert>
+#include <cstring>
 
 namespace cubthread
 {
@@ -57,9 +58,17 @@ namespace cubthread
     , m_entry_manager (NULL)
     , m_daemon_entry_manager (NULL)
     , m_lf_tran_sys (NULL)
+    , m_timer_wheel (NULL)
+    , m_wait_event_sampler (NULL)
+    , m_wait_event_rounds (0)
   {
     m_entry_manager = new entry_manager ();
     m_daemon_entry_manager = new daemon_entry_manager();
+
+    for (std::atomic<std::uint64_t> &samples : m_wait_event_samples)
+      {
+	samples = 0;
+      }
   }
 
   manager::~manager ()
@@ -67,9 +76,18 @@ namespace cubthread
     // pool container should be empty by now
     assert (m_available_entries_count == m_max_threads);
 
+    // sampler reads all entries
+    destroy_daemon_without_entry (m_wait_event_sampler);
+
     // make sure that we stop and free all
     check_all_killed ();
 
+#if defined (SERVER_MODE)
+    // no looper sleeps anymore
+    looper::set_timer_wheel (NULL);
+    delete m_timer_wheel;
+#endif // SERVER_MODE
+
     delete m_entry_dispatcher;
     delete [] m_all_entries;
     delete m_entry_manager;
@@ -107,6 +125,71 @@ namespace cubthread
       }
   }
 
+  void
+  manager::init_timer_wheel (void)
+  {
+#if defined (SERVER_MODE)
+    int tick_msecs = prm_get_integer_value (PRM_ID_THREAD_DAEMON_TIMER_TICK);
+
+    assert (m_timer_wheel == NULL);
+    if (tick_msecs <= 0)
+      {
+	// each daemon times its own waits
+	return;
+      }
+
+    m_timer_wheel = new timer_wheel (std::chrono::milliseconds (tick_msecs));
+    looper::set_timer_wheel (m_timer_wheel);
+#endif // SERVER_MODE
+  }
+
+  void
+  manager::init_wait_event_sampler (void)
+  {
+#if defined (SERVER_MODE)
+    int interval_msecs = prm_get_integer_value (PRM_ID_THREAD_WAIT_EVENT_SAMPLE_INTERVAL);
+
+    assert (m_wait_event_sampler == NULL);
+    if (interval_msecs <= 0)
+      {
+	// waits are still shown by SHOW THREADS, but they are not sampled
+	return;
+      }
+
+    looper sample_looper = looper (std::chrono::milliseconds (interval_msecs));
+    m_wait_event_sampler = create_daemon_without_entry (sample_looper,
+			   new callable_task<void> (std::bind (&manager::sample_wait_events, this)),
+			   "wait_event_sampler");
+#endif // SERVER_MODE
+  }
+
+  void
+  manager::sample_wait_events (void)
+  {
+    for (std::size_t it = 0; it < m_max_threads; it++)
+      {
+	int event = m_all_entries[it].wait_event.load (std::memory_order_relaxed);
+	if (event != THREAD_WAIT_NONE)
+	  {
+	    assert (event > THREAD_WAIT_NONE && event < THREAD_WAIT_EVENT_COUNT);
+	    // only the sampler writes the samples
+	    m_wait_event_samples[event].store (m_wait_event_samples[event].load (std::memory_order_relaxed) + 1,
+					       std::memory_order_relaxed);
+	  }
+      }
+    m_wait_event_rounds.store (m_wait_event_rounds.load (std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  std::uint64_t
+  manager::get_wait_event_samples (std::uint64_t *samples) const
+  {
+    for (int event = 0; event < THREAD_WAIT_EVENT_COUNT; event++)
+      {
+	samples[event] = m_wait_event_samples[event].load (std::memory_order_relaxed);
+      }
+    return m_wait_event_rounds.load (std::memory_order_relaxed);
+  }
+
   void
   manager::init_lockfree_system ()
   {
@@ -152,6 +235,45 @@ namespace cubthread
     return new_res;
   }
 
+#if defined (SERVER_MODE)
+  //
+  // pin_daemon - bind the thread of a latency sensitive daemon to the CPUs reserved for daemons
+  //
+  // daemons are pinned if they are listed by name in thread_pinned_daemons and if thread_daemon_cpus is set
+  //
+  static void
+  pin_daemon (daemon *daemon_arg, const char *daemon_name)
+  {
+    const char *cpu_list = prm_get_string_value (PRM_ID_THREAD_DAEMON_CPUS);
+    const char *pinned_names = prm_get_string_value (PRM_ID_THREAD_PINNED_DAEMONS);
+    std::size_t name_len;
+    const char *p;
+
+    if (daemon_arg == NULL || daemon_name == NULL || cpu_list == NULL || *cpu_list == '\0' || pinned_names == NULL)
+      {
+	return;
+      }
+
+    name_len = std::strlen (daemon_name);
+    if (name_len == 0)
+      {
+	return;
+      }
+    for (p = std::strstr (pinned_names, daemon_name); p != NULL; p = std::strstr (p + 1, daemon_name))
+      {
+	// match whole names of the comma separated list
+	if ((p == pinned_names || p[-1] == ',' || p[-1] == ' ') && (p[name_len] == '\0' || p[name_len] == ','))
+	  {
+	    if (!daemon_arg->set_cpu_affinity (cpu_list))
+	      {
+		er_log_debug (ARG_FILE_LINE, "could not bind daemon %s to cpus %s\n", daemon_name, cpu_list);
+	      }
+	    return;
+	  }
+      }
+  }
+#endif // SERVER_MODE
+
   entry_workpool *
   manager::create_worker_pool (size_t pool_size, size_t task_max_count, const char *name,
 			       entry_manager *context_manager, std::size_t core_count, bool debug_logging,
@@ -169,8 +291,14 @@ namespace cubthread
 	    context_manager = m_entry_manager;
 	  }
 	// reserve pool_size entries and add to m_worker_pools
-	return create_and_track_resource (m_worker_pools, pool_size, pool_size, task_max_count, *context_manager,
-					  name, core_count, debug_logging, pool_threads, wait_for_task_time);
+	entry_workpool *new_pool =
+		create_and_track_resource (m_worker_pools, pool_size, pool_size, task_max_count, *context_manager, name,
+					   core_count, debug_logging, pool_threads, wait_for_task_time);
+	if (new_pool != NULL && prm_get_bool_value (PRM_ID_THREAD_NUMA_PLACEMENT))
+	  {
+	    new_pool->set_numa_placement (true);
+	  }
+	return new_pool;
       }
 #else // not SERVER_MODE = SA_MODE
     return NULL;
@@ -194,7 +322,9 @@ namespace cubthread
 	    context_manager = m_daemon_entry_manager;
 	  }
 	// reserve 1 entry and add to m_daemons
-	return create_and_track_resource (m_daemons, 1, looper_arg, context_manager, exec_p, daemon_name);
+	daemon *new_daemon = create_and_track_resource (m_daemons, 1, looper_arg, context_manager, exec_p, daemon_name);
+	pin_daemon (new_daemon, daemon_name);
+	return new_daemon;
       }
 #else // not SERVER_MODE = SA_MODE
     assert (false);
@@ -214,7 +344,9 @@ namespace cubthread
     else
       {
 	// reserve no entry and add to m_daemons_without_entries
-	return create_and_track_resource (m_daemons_without_entries, 0, looper_arg, exec_p, daemon_name);
+	daemon *new_daemon = create_and_track_resource (m_daemons_without_entries, 0, looper_arg, exec_p, daemon_name);
+	pin_daemon (new_daemon, daemon_name);
+	return new_daemon;
       }
 #else // not SERVER_MODE = SA_MODE
     assert (false);
@@ -539,6 +671,7 @@ namespace cubthread
 
     Manager->set_max_thread_count_from_config ();
     Manager->alloc_entries ();
+    Manager->init_timer_wheel ();
 #endif // SERVER_MODE
 
     // note: even though SA_MODE does not really need to synchronize access on lock-free structures, it is better to
@@ -559,6 +692,9 @@ namespace cubthread
       }
 
     Manager->init_entries (with_lock_free);
+#if defined (SERVER_MODE)
+    Manager->init_wait_event_sampler ();
+#endif // SERVER_MODE
 
     return NO_ERROR;
   }
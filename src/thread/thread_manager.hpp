@@ -36,9 +36,12 @@
 // other module includes
 #include "base_flag.hpp"
 
+#include <atomic>
 #include <mutex>
 #include <vector>
 
+#include <cstdint>
+
 // forward definitions
 template <typename T>
 class resource_shared_pool;
@@ -208,6 +211,13 @@ namespace cubthread
       void set_max_thread_count_from_config ();
       void set_max_thread_count (std::size_t count);
 
+      // create the timer wheel that drives the timed waits of daemons, if configured
+      void init_timer_wheel (void);
+      // create the daemon that samples the wait events of all threads, if configured
+      void init_wait_event_sampler (void);
+      // get the samples of each wait event, THREAD_WAIT_EVENT_COUNT values; returns the number of sampling rounds
+      std::uint64_t get_wait_event_samples (std::uint64_t *samples) const;
+
       void return_lock_free_transaction_entries (void);
       entry *find_by_tid (thread_id_t tid);
 
@@ -266,6 +276,16 @@ namespace cubthread
 
       // lock-free transaction system
       lockfree::tran::system *m_lf_tran_sys;
+
+      // timer wheel of daemon loopers
+      timer_wheel *m_timer_wheel;
+
+      // wait event sampler; every round counts a sample of the current wait event of each waiting thread
+      void sample_wait_events (void);
+
+      daemon *m_wait_event_sampler;
+      std::atomic<std::uint64_t> m_wait_event_rounds;
+      std::atomic<std::uint64_t> m_wait_event_samples[THREAD_WAIT_EVENT_COUNT];
   };
 
   //////////////////////////////////////////////////////////////////////////
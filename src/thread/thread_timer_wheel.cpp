@@ -0,0 +1,360 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * thread_timer_wheel - implementation of the shared timer that wakes up sleeping waiters
+ */
+
+#include "thread_timer_wheel.hpp"
+
+#include "thread_waiter.hpp"
+
+#include <algorithm>
+
+#include <cassert>
+
+namespace cubthread
+{
+  //////////////////////////////////////////////////////////////////////////
+  // wheel_timer
+  //////////////////////////////////////////////////////////////////////////
+
+  wheel_timer::wheel_timer ()
+    : m_waiter (NULL)
+    , m_expiry_tick (0)
+    , m_level (0)
+    , m_slot (0)
+    , m_prev (NULL)
+    , m_next (NULL)
+    , m_is_pending (false)
+  {
+  }
+
+  //////////////////////////////////////////////////////////////////////////
+  // timer_wheel
+  //////////////////////////////////////////////////////////////////////////
+
+  timer_wheel::timer_wheel (const clock::duration &tick)
+    : m_tick (tick)
+    , m_start (clock::now ())
+    , m_current_tick (0)
+    , m_sleep_tick (NO_TICK)
+    , m_levels ()
+    , m_mutex ()
+    , m_condvar ()
+    , m_fire_condvar ()
+    , m_is_firing (false)
+    , m_stop (false)
+    , m_thread ()
+  {
+    assert (m_tick > clock::duration (0));
+
+    m_thread = std::thread (&timer_wheel::run, this);
+  }
+
+  timer_wheel::~timer_wheel ()
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+    m_stop = true;
+    lock.unlock ();
+    m_condvar.notify_one ();
+
+    m_thread.join ();
+
+    // all sleepers should have been woken up by now
+    assert (is_empty ());
+  }
+
+  void
+  timer_wheel::schedule (wheel_timer &timer_arg, waiter &waiter_arg, const clock::time_point &deadline)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+
+    assert (!timer_arg.m_is_pending);
+
+    if (is_empty ())
+      {
+	// wheel thread did not turn the wheel while it was empty
+	m_current_tick = std::max (m_current_tick, get_tick_at (clock::now ()));
+      }
+
+    // round up to tick, so waiter is never woken up before deadline
+    timer_arg.m_waiter = &waiter_arg;
+    timer_arg.m_expiry_tick = get_tick_at (deadline);
+    if (m_start + m_tick * (clock::rep) timer_arg.m_expiry_tick < deadline)
+      {
+	timer_arg.m_expiry_tick++;
+      }
+    if (timer_arg.m_expiry_tick <= m_current_tick)
+      {
+	timer_arg.m_expiry_tick = m_current_tick + 1;
+      }
+
+    insert (timer_arg);
+
+    if (timer_arg.m_expiry_tick < m_sleep_tick)
+      {
+	// wheel thread has to wake up earlier
+	m_sleep_tick = timer_arg.m_expiry_tick;
+	lock.unlock ();
+	m_condvar.notify_one ();
+      }
+  }
+
+  bool
+  timer_wheel::cancel (wheel_timer &timer_arg)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+
+    // fired timers are used out of mutex until all are woken up
+    m_fire_condvar.wait (lock, [this] { return !m_is_firing; });
+
+    if (!timer_arg.m_is_pending)
+      {
+	return false;
+      }
+
+    unlink (timer_arg);
+    return true;
+  }
+
+  void
+  timer_wheel::run (void)
+  {
+    std::unique_lock<std::mutex> lock (m_mutex);
+
+    while (!m_stop)
+      {
+	wheel_timer *fired = NULL;
+
+	advance (fired);
+
+	if (fired != NULL)
+	  {
+	    // wake up waiters out of mutex; they may be scheduling other timers meanwhile
+	    m_is_firing = true;
+	    lock.unlock ();
+
+	    for (wheel_timer *timer_p = fired; timer_p != NULL; timer_p = timer_p->m_next)
+	      {
+		timer_p->m_waiter->wakeup ();
+	      }
+
+	    lock.lock ();
+	    m_is_firing = false;
+	    m_fire_condvar.notify_all ();
+	    continue;
+	  }
+
+	m_sleep_tick = get_next_tick ();
+	if (m_sleep_tick == NO_TICK)
+	  {
+	    m_condvar.wait (lock);
+	  }
+	else
+	  {
+	    m_condvar.wait_until (lock, m_start + m_tick * (clock::rep) m_sleep_tick);
+	  }
+      }
+  }
+
+  bool
+  timer_wheel::is_empty (void) const
+  {
+    for (std::size_t level_index = 0; level_index < LEVEL_COUNT; level_index++)
+      {
+	if (m_levels[level_index].m_occupied != 0)
+	  {
+	    return false;
+	  }
+      }
+    return true;
+  }
+
+  std::uint64_t
+  timer_wheel::get_tick_at (const clock::time_point &tp) const
+  {
+    if (tp <= m_start)
+      {
+	return 0;
+      }
+    return (std::uint64_t) ((tp - m_start) / m_tick);
+  }
+
+  void
+  timer_wheel::insert (wheel_timer &timer_arg)
+  {
+    std::uint64_t distance = timer_arg.m_expiry_tick - m_current_tick;
+    std::uint64_t position = timer_arg.m_expiry_tick;
+    std::size_t level_index = 0;
+
+    assert (timer_arg.m_expiry_tick > m_current_tick);
+
+    while (level_index < LEVEL_COUNT - 1 && distance >= ((std::uint64_t) 1 << (SLOT_BITS * (level_index + 1))))
+      {
+	level_index++;
+      }
+    if (distance >= ((std::uint64_t) 1 << (SLOT_BITS * LEVEL_COUNT)))
+      {
+	// beyond wheel reach; park it in the farthest slot, it is placed again when cascaded
+	position = m_current_tick + ((std::uint64_t) 1 << (SLOT_BITS * LEVEL_COUNT)) - 1;
+      }
+
+    level &lvl = m_levels[level_index];
+    std::size_t slot = (std::size_t) ((position >> (SLOT_BITS * level_index)) & (SLOT_COUNT - 1));
+
+    timer_arg.m_level = level_index;
+    timer_arg.m_slot = slot;
+    timer_arg.m_prev = NULL;
+    timer_arg.m_next = lvl.m_slots[slot];
+    if (timer_arg.m_next != NULL)
+      {
+	timer_arg.m_next->m_prev = &timer_arg;
+      }
+    lvl.m_slots[slot] = &timer_arg;
+    lvl.m_occupied |= (std::uint64_t) 1 << slot;
+    timer_arg.m_is_pending = true;
+  }
+
+  void
+  timer_wheel::unlink (wheel_timer &timer_arg)
+  {
+    level &lvl = m_levels[timer_arg.m_level];
+
+    assert (timer_arg.m_is_pending);
+
+    if (timer_arg.m_prev != NULL)
+      {
+	timer_arg.m_prev->m_next = timer_arg.m_next;
+      }
+    else
+      {
+	assert (lvl.m_slots[timer_arg.m_slot] == &timer_arg);
+	lvl.m_slots[timer_arg.m_slot] = timer_arg.m_next;
+      }
+    if (timer_arg.m_next != NULL)
+      {
+	timer_arg.m_next->m_prev = timer_arg.m_prev;
+      }
+    if (lvl.m_slots[timer_arg.m_slot] == NULL)
+      {
+	lvl.m_occupied &= ~((std::uint64_t) 1 << timer_arg.m_slot);
+      }
+
+    timer_arg.m_prev = NULL;
+    timer_arg.m_next = NULL;
+    timer_arg.m_is_pending = false;
+  }
+
+  void
+  timer_wheel::advance (wheel_timer *&fired)
+  {
+    std::uint64_t now_tick = get_tick_at (clock::now ());
+
+    if (is_empty ())
+      {
+	// nothing to cascade or fire; skip the ticks
+	m_current_tick = std::max (m_current_tick, now_tick);
+	return;
+      }
+
+    while (m_current_tick < now_tick)
+      {
+	m_current_tick++;
+
+	// when a level turns, cascade the slot of the level above; cascade higher levels first, since their timers may
+	// be moved to the slots cascaded next
+	std::size_t top_level = 0;
+	while (top_level < LEVEL_COUNT - 1
+	       && (m_current_tick & (((std::uint64_t) 1 << (SLOT_BITS * (top_level + 1))) - 1)) == 0)
+	  {
+	    top_level++;
+	  }
+	for (std::size_t level_index = top_level; level_index > 0; level_index--)
+	  {
+	    move_slot (level_index, (m_current_tick >> (SLOT_BITS * level_index)) & (SLOT_COUNT - 1), fired);
+	  }
+
+	move_slot (0, m_current_tick & (SLOT_COUNT - 1), fired);
+      }
+  }
+
+  void
+  timer_wheel::move_slot (std::size_t level_index, std::size_t slot, wheel_timer *&fired)
+  {
+    level &lvl = m_levels[level_index];
+    wheel_timer *timer_p;
+
+    while ((timer_p = lvl.m_slots[slot]) != NULL)
+      {
+	unlink (*timer_p);
+
+	if (timer_p->m_expiry_tick <= m_current_tick)
+	  {
+	    // due; fired list is linked through m_next
+	    timer_p->m_next = fired;
+	    fired = timer_p;
+	  }
+	else
+	  {
+	    insert (*timer_p);
+	  }
+      }
+  }
+
+  std::uint64_t
+  timer_wheel::get_next_tick (void) const
+  {
+    std::uint64_t next_tick = NO_TICK;
+
+    for (std::size_t level_index = 0; level_index < LEVEL_COUNT; level_index++)
+      {
+	const level &lvl = m_levels[level_index];
+	if (lvl.m_occupied == 0)
+	  {
+	    continue;
+	  }
+
+	// a slot is processed when its level turns to it
+	std::uint64_t group = m_current_tick >> (SLOT_BITS * level_index);
+	std::size_t current_slot = (std::size_t) (group & (SLOT_COUNT - 1));
+
+	for (std::size_t slot = 0; slot < SLOT_COUNT; slot++)
+	  {
+	    if ((lvl.m_occupied & ((std::uint64_t) 1 << slot)) == 0)
+	      {
+		continue;
+	      }
+
+	    std::uint64_t groups_ahead = (slot - current_slot) & (SLOT_COUNT - 1);
+	    if (groups_ahead == 0)
+	      {
+		groups_ahead = SLOT_COUNT;
+	      }
+
+	    std::uint64_t slot_tick = (group + groups_ahead) << (SLOT_BITS * level_index);
+	    if (slot_tick < next_tick)
+	      {
+		next_tick = slot_tick;
+	      }
+	  }
+      }
+
+    return next_tick;
+  }
+} // namespace cubthread
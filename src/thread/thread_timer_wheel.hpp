@@ -0,0 +1,134 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * thread_timer_wheel - shared timer that wakes up sleeping waiters when their time is due
+ */
+
+#ifndef _THREAD_TIMER_WHEEL_HPP_
+#define _THREAD_TIMER_WHEEL_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cubthread
+{
+  // forward def
+  class waiter;
+  class timer_wheel;
+
+  // cubthread::wheel_timer
+  //
+  // description
+  //    a pending wake-up of a waiter in a timer wheel. it is owned by the one that puts the waiter to sleep and it is
+  //    reused for every sleep.
+  //
+  class wheel_timer
+  {
+    public:
+      wheel_timer ();
+      wheel_timer (const wheel_timer &other) = delete;
+
+    private:
+      friend class timer_wheel;
+
+      waiter *m_waiter;             // waiter to wake up
+      std::uint64_t m_expiry_tick;  // tick when waiter is woken up
+      std::size_t m_level;          // wheel level of the slot holding the timer
+      std::size_t m_slot;           // slot holding the timer
+      wheel_timer *m_prev;          // slot list links
+      wheel_timer *m_next;
+      bool m_is_pending;            // true while in a slot
+  };
+
+  // cubthread::timer_wheel
+  //
+  // description
+  //    a hierarchical timer wheel with its own thread. waiters that sleep for a period of time are scheduled on the
+  //    wheel instead of each doing its own timed wait; the wheel thread sleeps until the first due tick and wakes up
+  //    all waiters due by then.
+  //
+  //    deadlines are rounded up to the tick, so the waiters that are due in the same tick are woken up together, and
+  //    never before their deadline.
+  //
+  //    each level has 64 slots, each level slot spans all the slots of the level below. a timer is kept in the lowest
+  //    level that can reach its expiry and it is moved down (cascaded) as the wheel turns.
+  //
+  // how to use
+  //
+  //    // waiter::wait_on_timer schedules the timer, sleeps and cancels the timer
+  //    bool woken_up = waiter.wait_on_timer (wheel, timer, std::chrono::system_clock::now () + period);
+  //
+  class timer_wheel
+  {
+    public:
+      using clock = std::chrono::system_clock;
+
+      timer_wheel (const clock::duration &tick);
+      ~timer_wheel ();
+
+      // schedule timer to wake up waiter at deadline
+      void schedule (wheel_timer &timer_arg, waiter &waiter_arg, const clock::time_point &deadline);
+      // cancel timer; returns true if it did not fire. once cancel returns, wheel no longer uses timer or its waiter
+      bool cancel (wheel_timer &timer_arg);
+
+    private:
+      static const std::size_t LEVEL_COUNT = 4;
+      static const std::size_t SLOT_BITS = 6;
+      static const std::size_t SLOT_COUNT = 1 << SLOT_BITS;
+      static const std::uint64_t NO_TICK = ~static_cast<std::uint64_t> (0);
+
+      struct level
+      {
+	wheel_timer *m_slots[SLOT_COUNT];
+	std::uint64_t m_occupied;         // bit for each non-empty slot
+      };
+
+      void run (void);
+
+      bool is_empty (void) const;
+      std::uint64_t get_tick_at (const clock::time_point &tp) const;   // last tick before time point
+      void insert (wheel_timer &timer_arg);
+      void unlink (wheel_timer &timer_arg);
+      void advance (wheel_timer *&fired);
+      void move_slot (std::size_t level_index, std::size_t slot, wheel_timer *&fired);
+      std::uint64_t get_next_tick (void) const;
+
+      clock::duration m_tick;
+      clock::time_point m_start;
+      std::uint64_t m_current_tick;     // last tick processed
+      std::uint64_t m_sleep_tick;       // tick the wheel thread sleeps until
+
+      level m_levels[LEVEL_COUNT];
+
+      std::mutex m_mutex;
+      std::condition_variable m_condvar;          // wheel thread sleeps on it
+      std::condition_variable m_fire_condvar;     // cancel waits on it while firing
+      bool m_is_firing;                           // true while fired waiters are woken up, out of mutex
+      bool m_stop;
+
+      std::thread m_thread;
+  };
+} // namespace cubthread
+
+#endif // _THREAD_TIMER_WHEEL_HPP_
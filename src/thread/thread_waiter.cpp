@@ -239,6 +239,34 @@ namespace cubthread
     return ret;
   }
 
+  bool
+  waiter::wait_on_timer (timer_wheel &wheel, wheel_timer &timer_arg,
+			 const std::chrono::system_clock::time_point &timeout_time)
+  {
+    bool ret;
+
+    std::unique_lock<std::mutex> lock (m_mutex);    // mutex is also locked
+    goto_sleep ();
+
+    // schedule while sleeping, so the wake-up from wheel cannot be missed
+    wheel.schedule (timer_arg, *this, timeout_time);
+
+    m_condvar.wait (lock, [this] { return m_status == AWAKENING; });
+
+    run ();
+
+    // wheel wakes up waiters without its mutex but with ours; cancel only after unlocking
+    lock.unlock ();
+
+    ret = wheel.cancel (timer_arg);
+    if (!ret)
+      {
+	Waiter_statistics.increment (m_stats, STAT_TIMEOUT_COUNT);
+      }
+
+    return ret;
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // waiter stats
   //////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 #define _THREAD_WAITER_HPP_
 
 #include "perf_def.hpp"
+#include "thread_timer_wheel.hpp"
 
 #include <atomic>
 #include <chrono>
@@ -65,6 +66,9 @@ namespace cubthread
       bool wait_for (const std::chrono::system_clock::duration &delta);   // wait for period of time or until wakeup
       // returns true if woke up before timeout
       bool wait_until (const std::chrono::system_clock::time_point &timeout_time);  // wait until time or until wakeup
+      // wait until wheel fires timer at given time or until wakeup
+      bool wait_on_timer (timer_wheel &wheel, wheel_timer &timer_arg,
+			  const std::chrono::system_clock::time_point &timeout_time);
       // returns true if woke up before timeout
 
       // statistics
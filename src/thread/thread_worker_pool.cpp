@@ -66,7 +66,9 @@ namespace cubthread
     cubperf::stat_definition (Wpstat_recycle_context, cubperf::stat_definition::COUNTER_AND_TIMER,
 			      "Counter_recycle_context", "Timer_recycle_context"),
     cubperf::stat_definition (Wpstat_retire_context, cubperf::stat_definition::COUNTER_AND_TIMER,
-			      "Counter_retire_context", "Timer_retire_context")
+			      "Counter_retire_context", "Timer_retire_context"),
+    cubperf::stat_definition (Wpstat_stolen_task, cubperf::stat_definition::COUNTER_AND_TIMER,
+			      "Counter_stolen_task", "Timer_stolen_task")
   };
 
   cubperf::statset &
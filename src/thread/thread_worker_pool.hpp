@@ -24,6 +24,7 @@
 #define _THREAD_WORKER_POOL_HPP_
 
 // same module include
+#include "thread_affinity.hpp"
 #include "thread_task.hpp"
 #include "thread_waiter.hpp"
 
@@ -114,14 +115,19 @@ namespace cubthread
   //          - first checks free active list
   //          - if no free active worker is found, it checks inactive list
   //          - if a worker is found, then it is assigned the task
+  //          - if work stealing is enabled, it tries the available workers of sibling cores
   //          - if no worker is found, task is saved in queue
   //
   //      3. Task is executed by worker in one of three ways:
   //          3.1. worker was inactive and starts a new thread to execute the task
   //               after it finishes its first task, it tries to find new ones:
   //          3.2. gets a queued task on its parent core
-  //          3.3. if there is no queue task, notifies core of its status (free and active) and waits for new task.
-  //          note: 3.2. and 3.3. together is an atomic operation (protected by mutex)
+  //          3.3. if work stealing is enabled and there is no queued task on its parent core, takes the oldest task
+  //               queued on a sibling core. siblings are only tried (their mutex is not waited for), so the task of a
+  //               busy core does not wait behind long-running tasks while other cores are idle.
+  //          3.4. if there is no queue task, notifies core of its status (free and active) and waits for new task.
+  //          note: 3.2. and 3.4. together is an atomic operation (protected by mutex); if any sibling task was
+  //                queued during 3.3., it waits for the workers of its core
   //          Worker stops if waiting for new task times out (and becomes inactive).
   //
   //    NOTE: core class is private nested to worker pool and cannot be instantiated outside it.
@@ -162,6 +168,16 @@ namespace cubthread
       // stop worker pool; stop all running threads; discard any tasks in queue
       void stop_execution (void);
 
+      // enable/disable work stealing: workers without tasks on their core take the tasks queued on sibling cores.
+      // note: the core a task is pushed on (see execute_on_core) is where it runs, unless all workers of that core are
+      //       busy and a worker of another core becomes free first.
+      void set_work_stealing (bool enable);
+
+      // enable/disable NUMA placement: the cores are spread round robin over NUMA nodes and their workers run only on
+      // the CPUs of the node of their core.
+      // note: it should be set before the first tasks are pushed; workers bind their threads before executing tasks.
+      void set_numa_placement (bool enable);
+
       // start all worker threads to be ready for future tasks
       void start_all_workers (void);
 
@@ -232,6 +248,11 @@ namespace cubthread
       // get next core by round robin scheduling
       std::size_t get_round_robin_core_hash (void);
 
+      // take a task queued on a core other than thief; returns NULL if none is found
+      task_type *steal_task (const core &thief);
+      // give task to an available worker of a core other than home; returns false if none is found
+      bool execute_on_sibling_core (const core &home, task_type *task_p, cubperf::time_point push_time);
+
       // maximum number of concurrent workers
       std::size_t m_max_workers;
 
@@ -246,6 +267,7 @@ namespace cubthread
       core *m_core_array;                                   // all cores
       std::size_t m_core_count;                             // core count
       std::atomic<std::size_t> m_round_robin_counter;       // round robin counter used to dispatch tasks on cores
+      std::atomic<bool> m_work_stealing;                    // true if free workers steal tasks from sibling cores
 
       // set to true when stopped
       std::atomic<bool> m_stopped;
@@ -305,7 +327,12 @@ namespace cubthread
       void finished_task_notification (void);
       // worker management
       // get a task or add worker to free active list (still running, but ready to execute another task)
-      task_type *get_task_or_become_available (worker &worker_arg);
+      // is_stolen is output true if task was taken from a sibling core
+      task_type *get_task_or_become_available (worker &worker_arg, bool &is_stolen);
+      // take oldest queued task, unless core mutex is already locked
+      task_type *try_steal_task (void);
+      // assign task to an available worker, unless core mutex is already locked or no worker is available
+      bool try_execute_task (task_type *task_p, cubperf::time_point push_time);
       void become_available (worker &worker_arg);
       // is worker available?
       void check_worker_not_available (const worker &worker_arg);
@@ -314,6 +341,8 @@ namespace cubthread
 
       // getters
       std::size_t get_max_worker_count (void) const;
+      // get the NUMA node the workers of this core run on, or NUMA_NODE_NONE if they can run on any CPU
+      std::size_t get_numa_node (void) const;
       inline worker_pool_type *get_parent_pool (void) const
       {
 	return m_parent_pool;
@@ -334,6 +363,7 @@ namespace cubthread
       std::size_t m_available_count;
       std::queue<task_type *> m_task_queue;           // list of tasks pushed while all workers were occupied
       std::mutex m_workers_mutex;                     // mutex to synchronize activity on worker lists
+      std::atomic<std::size_t> m_numa_node;           // NUMA node of core workers (see set_numa_placement)
   };
 
   // worker_pool<Context>::worker
@@ -464,6 +494,8 @@ namespace cubthread
       void retire_current_task (void);
       // get new task from 1. worker pool task queue or 2. wait for incoming tasks
       bool get_new_task (void);
+      // bind thread to the NUMA node of parent core, if it is not already bound to it
+      void bind_to_numa_node (std::size_t &bound_node);
 
       core_type *m_parent_core;               // parent core
       Context *m_context_p;                   // execution context (same lifetime as spawned thread)
@@ -495,6 +527,7 @@ namespace cubthread
   static const cubperf::stat_id Wpstat_wakeup_with_task = 5;
   static const cubperf::stat_id Wpstat_recycle_context = 6;
   static const cubperf::stat_id Wpstat_retire_context = 7;
+  static const cubperf::stat_id Wpstat_stolen_task = 8;
 
   cubperf::statset &wp_worker_statset_create (void);
   void wp_worker_statset_destroy (cubperf::statset &stats);
@@ -543,6 +576,7 @@ namespace cubthread
     , m_core_array (NULL)
     , m_core_count (core_count)
     , m_round_robin_counter (0)
+    , m_work_stealing (false)
     , m_stopped (false)
     , m_log (debug_log)
     , m_pool_threads (pool_threads)
@@ -688,6 +722,26 @@ namespace cubthread
       }
   }
 
+  template <typename Context>
+  void
+  worker_pool<Context>::set_work_stealing (bool enable)
+  {
+    m_work_stealing = enable;
+  }
+
+  template <typename Context>
+  void
+  worker_pool<Context>::set_numa_placement (bool enable)
+  {
+    std::size_t node_count = get_numa_node_count ();
+
+    for (std::size_t it = 0; it < m_core_count; it++)
+      {
+	// with a single node there is nothing to gain by binding workers
+	m_core_array[it].m_numa_node = (enable && node_count > 1) ? it % node_count : NUMA_NODE_NONE;
+      }
+  }
+
   template <typename Context>
   void
   worker_pool<Context>::start_all_workers (void)
@@ -829,6 +883,41 @@ namespace cubthread
     return index;
   }
 
+  template <typename Context>
+  typename worker_pool<Context>::task_type *
+  worker_pool<Context>::steal_task (const core &thief)
+  {
+    std::size_t thief_index = &thief - m_core_array;
+    task_type *task_p;
+
+    // start with next core, so thieves of different cores do not all go for same one
+    for (std::size_t it = 1; it < m_core_count; it++)
+      {
+	task_p = m_core_array[(thief_index + it) % m_core_count].try_steal_task ();
+	if (task_p != NULL)
+	  {
+	    return task_p;
+	  }
+      }
+    return NULL;
+  }
+
+  template <typename Context>
+  bool
+  worker_pool<Context>::execute_on_sibling_core (const core &home, task_type *task_p, cubperf::time_point push_time)
+  {
+    std::size_t home_index = &home - m_core_array;
+
+    for (std::size_t it = 1; it < m_core_count; it++)
+      {
+	if (m_core_array[(home_index + it) % m_core_count].try_execute_task (task_p, push_time))
+	  {
+	    return true;
+	  }
+      }
+    return false;
+  }
+
   //////////////////////////////////////////////////////////////////////////
   // worker_pool::core
   //////////////////////////////////////////////////////////////////////////
@@ -842,6 +931,7 @@ namespace cubthread
     , m_available_count (0)
     , m_task_queue ()
     , m_workers_mutex ()
+    , m_numa_node (NUMA_NODE_NONE)
   {
     //
   }
@@ -924,33 +1014,123 @@ namespace cubthread
 
 	assert (refp != NULL);
 	refp->assign_task (task_p, push_time);
+	return;
       }
-    else
+
+    if (m_parent_pool->m_work_stealing && m_parent_pool->m_core_count > 1)
       {
-	// save to queue
-	m_task_queue.push (task_p);
+	// all my workers are busy; rather than queue the task behind them, look for a free worker on sibling cores.
+	// don't hold my mutex while looking at siblings
+	ulock.unlock ();
+	if (m_parent_pool->execute_on_sibling_core (*this, task_p, push_time))
+	  {
+	    return;
+	  }
+	ulock.lock ();
+
+	if (m_parent_pool->m_stopped)
+	  {
+	    // reject task
+	    task_p->retire ();
+	    return;
+	  }
+	if (m_available_count > 0)
+	  {
+	    // one of my workers became available meanwhile
+	    refp = m_available_workers[--m_available_count];
+	    ulock.unlock ();
+
+	    assert (refp != NULL);
+	    refp->assign_task (task_p, push_time);
+	    return;
+	  }
+      }
+
+    // save to queue
+    m_task_queue.push (task_p);
+  }
+
+  template <typename Context>
+  bool
+  worker_pool<Context>::core::try_execute_task (task_type *task_p, cubperf::time_point push_time)
+  {
+    worker *refp = NULL;
+    std::unique_lock<std::mutex> ulock (m_workers_mutex, std::try_to_lock);
+
+    if (!ulock.owns_lock () || m_available_count == 0 || m_parent_pool->m_stopped)
+      {
+	return false;
       }
+
+    refp = m_available_workers[--m_available_count];
+    ulock.unlock ();
+
+    assert (refp != NULL);
+    refp->assign_task (task_p, push_time);
+    return true;
   }
 
   template <typename Context>
   typename worker_pool<Context>::core::task_type *
-  worker_pool<Context>::core::get_task_or_become_available (worker &worker_arg)
+  worker_pool<Context>::core::get_task_or_become_available (worker &worker_arg, bool &is_stolen)
   {
     std::unique_lock<std::mutex> ulock (m_workers_mutex);
+    task_type *task_p;
+
+    is_stolen = false;
 
     if (!m_task_queue.empty ())
       {
-	task_type *task_p = m_task_queue.front ();
+	task_p = m_task_queue.front ();
 	assert (task_p != NULL);
 	m_task_queue.pop ();
 	return task_p;
       }
 
+    if (m_parent_pool->m_work_stealing && m_parent_pool->m_core_count > 1 && !m_parent_pool->m_stopped)
+      {
+	// don't hold my mutex while looking at siblings
+	ulock.unlock ();
+	task_p = m_parent_pool->steal_task (*this);
+	if (task_p != NULL)
+	  {
+	    is_stolen = true;
+	    return task_p;
+	  }
+	ulock.lock ();
+
+	// check again my queue; a task may have been queued meanwhile
+	if (!m_task_queue.empty ())
+	  {
+	    task_p = m_task_queue.front ();
+	    assert (task_p != NULL);
+	    m_task_queue.pop ();
+	    return task_p;
+	  }
+      }
+
     m_available_workers[m_available_count++] = &worker_arg;
     assert (m_available_count <= m_max_workers);
     return NULL;
   }
 
+  template <typename Context>
+  typename worker_pool<Context>::core::task_type *
+  worker_pool<Context>::core::try_steal_task (void)
+  {
+    std::unique_lock<std::mutex> ulock (m_workers_mutex, std::try_to_lock);
+
+    if (!ulock.owns_lock () || m_task_queue.empty ())
+      {
+	return NULL;
+      }
+
+    task_type *task_p = m_task_queue.front ();
+    assert (task_p != NULL);
+    m_task_queue.pop ();
+    return task_p;
+  }
+
   template <typename Context>
   void
   worker_pool<Context>::core::become_available (worker &worker_arg)
@@ -988,6 +1168,13 @@ namespace cubthread
     return m_max_workers;
   }
 
+  template <typename Context>
+  std::size_t
+  worker_pool<Context>::core::get_numa_node (void) const
+  {
+    return m_numa_node.load (std::memory_order_relaxed);
+  }
+
   template <typename Context>
   template <typename Func, typename ... Args>
   void
@@ -1329,10 +1516,11 @@ namespace cubthread
 	// note: returned task cannot be saved directly to m_task_p. if worker is added to wait queue and NULL is returned,
 	//       current thread may be preempted. worker is then claimed from free active list and worker is assigned
 	//       a task. this changes expected behavior and can have unwanted consequences.
-	task_type *task_p = m_parent_core->get_task_or_become_available (*this);
+	bool is_stolen;
+	task_type *task_p = m_parent_core->get_task_or_become_available (*this, is_stolen);
 	if (task_p != NULL)
 	  {
-	    wp_worker_statset_time_and_increment (m_statistics, Wpstat_found_in_queue);
+	    wp_worker_statset_time_and_increment (m_statistics, is_stolen ? Wpstat_stolen_task : Wpstat_found_in_queue);
 
 	    // it is safe to set here
 	    m_task_p = task_p;
@@ -1388,11 +1576,26 @@ namespace cubthread
       }
   }
 
+  template <typename Context>
+  void
+  worker_pool<Context>::core::worker::bind_to_numa_node (std::size_t &bound_node)
+  {
+    std::size_t node = m_parent_core->get_numa_node ();
+
+    if (node != bound_node && node != NUMA_NODE_NONE)
+      {
+	// if it can't be bound, don't try again; the thread just runs anywhere
+	(void) bind_thread_to_numa_node (node);
+	bound_node = node;
+      }
+  }
+
   template <typename Context>
   void
   worker_pool<Context>::core::worker::run (void)
   {
     task_type *task_p = NULL;
+    std::size_t bound_node = NUMA_NODE_NONE;    // this thread's NUMA node
 
     init_run ();    // do stuff at the beginning like creating context
 
@@ -1410,6 +1613,7 @@ namespace cubthread
 	// loop and execute as many tasks as possible
 	do
 	  {
+	    bind_to_numa_node (bound_node);
 	    execute_current_task ();
 	  }
 	while (get_new_task ());
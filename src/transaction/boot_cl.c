@@ -70,6 +70,7 @@
 #include "language_support.h"
 #include "message_catalog.h"
 #include "parser.h"
+#include "execute_statement.h"
 #include "perf_monitor.h"
 #include "set_object.h"
 #include "cnv.h"
@@ -1558,6 +1559,7 @@ boot_client_all_finalize (bool is_er_final)
       tran_free_savepoint_list ();
       sm_flush_static_methods ();
       set_final ();
+      do_final_xasl_id_cache ();
       parser_final ();
       tr_final ();
       au_final ();
@@ -47,9 +47,11 @@
 
 #include "area_alloc.h"
 #include "btree.h"
+#include "btree_bloom.h"
 #include "chartype.h"
 #include "dbtran_def.h"
 #include "error_manager.h"
+#include "external_sort.h"
 #include "system_parameter.h"
 #include "object_primitive.h"
 #include "locator_sr.h"
@@ -81,6 +83,7 @@
 #include "log_volids.hpp"
 #include "vacuum.h"
 #include "tde.h"
+#include "statistics_sr.h"
 #include "porting.h"
 
 #if defined(SERVER_MODE)
@@ -177,6 +180,7 @@ static int boot_remove_temp_volume (THREAD_ENTRY * thread_p, VOLID volid, const
 static int boot_remove_all_temp_volumes (THREAD_ENTRY * thread_p, REMOVE_TEMP_VOL_ACTION delete_action);
 static int boot_xremove_temp_volume (THREAD_ENTRY * thread_p, VOLID volid, const char *vlabel);
 static void boot_make_temp_volume_fullname (char *temp_vol_fullname, VOLID temp_volid);
+static void boot_get_temp_volume_stripe_path (char *temp_path, VOLID temp_volid);
 static void boot_remove_unknown_temp_volumes (THREAD_ENTRY * thread_p);
 static int boot_parse_add_volume_extensions (THREAD_ENTRY * thread_p, const char *filename_addmore_vols);
 static int boot_find_rest_volumes (THREAD_ENTRY * thread_p, BO_RESTART_ARG * r_args, VOLID volid,
@@ -955,37 +959,106 @@ boot_xremove_temp_volume (THREAD_ENTRY * thread_p, VOLID volid, const char *vlab
   return boot_remove_temp_volume (thread_p, volid, vlabel);
 }
 
-static void
-boot_make_temp_volume_fullname (char *temp_vol_fullname, VOLID temp_volid)
+/*
+ * boot_get_temp_volume_stripe_count () - get the number of directories temporary volumes are striped across
+ *
+ * return : number of directories in temp_volume_path, 1 if it is not set
+ */
+int
+boot_get_temp_volume_stripe_count (void)
 {
-  const char *temp_path;
-  const char *temp_name;
-  char *alloc_tempath = NULL;
+  const char *temp_paths = prm_get_string_value (PRM_ID_IO_TEMP_VOLUME_PATH);
+  int count = 1;
 
-  assert (temp_vol_fullname != NULL);
+  if (temp_paths == NULL)
+    {
+      return 1;
+    }
+  for (; *temp_paths != '\0'; temp_paths++)
+    {
+      if (*temp_paths == ',')
+	{
+	  count++;
+	}
+    }
+  return count;
+}
 
-  temp_vol_fullname[0] = '\0';
+/*
+ * boot_get_temp_volume_stripe_path () - get the directory of a temporary volume
+ *
+ * return : void
+ *
+ *   temp_path(out): directory of temporary volume (PATH_MAX buffer)
+ *   temp_volid(in): temporary volume identifier
+ *
+ * Note: temp_volume_path may be a comma separated list of directories. Temporary volumes are created round-robin in
+ *       these directories, in the order of their identifiers, so temporary files are spread across devices.
+ */
+static void
+boot_get_temp_volume_stripe_path (char *temp_path, VOLID temp_volid)
+{
+  const char *temp_paths = prm_get_string_value (PRM_ID_IO_TEMP_VOLUME_PATH);
+  const char *start;
+  const char *end;
+  int stripe;
+  size_t len;
 
-  alloc_tempath = (char *) malloc (strlen (boot_Db_full_name) + 1);
-  if (alloc_tempath == NULL)
+  temp_path[0] = '\0';
+  if (temp_paths == NULL || temp_paths[0] == '\0')
     {
+      if (fileio_get_directory_path (temp_path, boot_Db_full_name) == NULL)
+	{
+	  temp_path[0] = '\0';
+	}
       return;
     }
-  temp_path = (char *) prm_get_string_value (PRM_ID_IO_TEMP_VOLUME_PATH);
-  if (temp_path == NULL || temp_path[0] == '\0')
+
+  /* temporary volumes are numbered down from LOG_MAX_DBVOLID */
+  stripe = (LOG_MAX_DBVOLID - temp_volid) % boot_get_temp_volume_stripe_count ();
+  for (start = temp_paths; stripe > 0; stripe--)
     {
-      temp_path = fileio_get_directory_path (alloc_tempath, boot_Db_full_name);
+      start = strchr (start, ',') + 1;
     }
-  temp_name = fileio_get_base_file_name (boot_Db_full_name);
+  end = strchr (start, ',');
+  len = (end != NULL) ? (size_t) (end - start) : strlen (start);
 
-  fileio_make_volume_temp_name (temp_vol_fullname, temp_path, temp_name, temp_volid);
+  /* trim blanks around directory */
+  while (len > 0 && char_isspace (*start))
+    {
+      start++;
+      len--;
+    }
+  while (len > 0 && char_isspace (start[len - 1]))
+    {
+      len--;
+    }
+  len = MIN (len, PATH_MAX - 1);
 
-  if (alloc_tempath)
+  memcpy (temp_path, start, len);
+  temp_path[len] = '\0';
+  if (len == 0 && fileio_get_directory_path (temp_path, boot_Db_full_name) == NULL)
     {
-      free_and_init (alloc_tempath);
+      temp_path[0] = '\0';
     }
 }
 
+static void
+boot_make_temp_volume_fullname (char *temp_vol_fullname, VOLID temp_volid)
+{
+  char temp_path[PATH_MAX];
+  const char *temp_name;
+
+  assert (temp_vol_fullname != NULL);
+
+  temp_vol_fullname[0] = '\0';
+
+  boot_get_temp_volume_stripe_path (temp_path, temp_volid);
+  temp_name = fileio_get_base_file_name (boot_Db_full_name);
+
+  fileio_make_volume_temp_name (temp_vol_fullname, temp_path, temp_name, temp_volid);
+}
+
 /*
  * boot_remove_unknown_temp_volumes () -
  *
@@ -1168,29 +1241,9 @@ boot_find_rest_temp_volumes (THREAD_ENTRY * thread_p, VOLID volid,
 {
   VOLID temp_volid;
   char temp_vol_fullname[PATH_MAX];
-  const char *temp_path;
-  const char *temp_name;
-  char *alloc_tempath = NULL;
   int num_vols;
   bool go_to_access;
 
-  /*
-   * Get the name of the extension: ext_path|dbname|"ext"|volid
-   */
-
-  /* Use the directory where the primary volume is located */
-  alloc_tempath = (char *) malloc (strlen (boot_Db_full_name) + 1);
-  if (alloc_tempath == NULL)
-    {
-      return;
-    }
-  temp_path = (char *) prm_get_string_value (PRM_ID_IO_TEMP_VOLUME_PATH);
-  if (temp_path == NULL || temp_path[0] == '\0')
-    {
-      temp_path = fileio_get_directory_path (alloc_tempath, boot_Db_full_name);
-    }
-  temp_name = fileio_get_base_file_name (boot_Db_full_name);
-
   if (boot_Db_parm->temp_nvols > 0)
     {
       /* Cycle over all temporarily volumes, skip the given one */
@@ -1202,7 +1255,7 @@ boot_find_rest_temp_volumes (THREAD_ENTRY * thread_p, VOLID volid,
 	      if (temp_volid != volid)
 		{
 		  /* Find the name of the volume */
-		  fileio_make_volume_temp_name (temp_vol_fullname, temp_path, temp_name, temp_volid);
+		  boot_make_temp_volume_fullname (temp_vol_fullname, temp_volid);
 		  go_to_access = false;
 		  if (check_before_access)
 		    {
@@ -1230,7 +1283,7 @@ boot_find_rest_temp_volumes (THREAD_ENTRY * thread_p, VOLID volid,
 	      if (temp_volid != volid)
 		{
 		  /* Find the name of the volume */
-		  fileio_make_volume_temp_name (temp_vol_fullname, temp_path, temp_name, temp_volid);
+		  boot_make_temp_volume_fullname (temp_vol_fullname, temp_volid);
 		  go_to_access = false;
 		  if (check_before_access)
 		    {
@@ -1251,11 +1304,6 @@ boot_find_rest_temp_volumes (THREAD_ENTRY * thread_p, VOLID volid,
 	    }
 	}
     }
-
-  if (alloc_tempath)
-    {
-      free_and_init (alloc_tempath);
-    }
 }
 
 /*
@@ -2068,6 +2116,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
   char *mk_path;
   int jsp_port;
   bool jsp;
+  TSC_TICKS start_tick, end_tick;
 
   /* language data is loaded in context of server */
   if (lang_init () != NO_ERROR)
@@ -2362,6 +2411,21 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 
   spage_boot (thread_p);
   error_code = heap_manager_initialize ();
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+  error_code = btree_bloom_initialize ();
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+  error_code = sort_workers_initialize ();
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+  error_code = stats_workers_initialize ();
   if (error_code != NO_ERROR)
     {
       goto error;
@@ -2459,6 +2523,7 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
   if (prm_get_bool_value (PRM_ID_DISABLE_VACUUM) == false)
     {
       /* We need to load vacuum data and initialize vacuum routine before recovery. */
+      tsc_getticks (&start_tick);
       error_code =
 	vacuum_initialize (thread_p, boot_Db_parm->vacuum_log_block_npages, &boot_Db_parm->vacuum_data_vfid,
 			   &boot_Db_parm->dropped_files_vfid, r_args != NULL && r_args->is_restore_from_backup);
@@ -2466,17 +2531,22 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
 	{
 	  goto error;
 	}
+      tsc_getticks (&end_tick);
+      log_rv_restart_stats_add (LOG_RV_RESTART_VACUUM_LOAD_TIME, tsc_elapsed_utime (end_tick, start_tick));
     }
 
   oid_set_root (&boot_Db_parm->rootclass_oid);
 
   /* Load and recover data pages before log recovery */
+  tsc_getticks (&start_tick);
   error_code = dwb_load_and_recover_pages (thread_p, log_path, log_prefix);
   if (error_code != NO_ERROR)
     {
       ASSERT_ERROR ();
       goto error;
     }
+  tsc_getticks (&end_tick);
+  log_rv_restart_stats_add (LOG_RV_RESTART_DWB_RECOVER_TIME, tsc_elapsed_utime (end_tick, start_tick));
 
   /*
    * Now restart the recovery manager and execute any recovery actions
@@ -2504,6 +2574,14 @@ boot_restart_server (THREAD_ENTRY * thread_p, bool print_restart, const char *db
       goto error;
     }
 
+#if defined(SERVER_MODE)
+  /* resumes re-encrypting pages if the perm data key rotation has not been finished */
+  tde_rekey_daemon_init ();
+
+  /* keeps the statistics of the modified classes fresh */
+  stats_refresh_daemon_init ();
+#endif /* SERVER_MODE */
+
   /*
    * Initialize the catalog manager, the query evaluator, and install meta
    * classes
@@ -2800,6 +2878,11 @@ error:
   session_states_finalize (thread_p);
   logtb_finalize_global_unique_stats_table (thread_p);
 
+#if defined(SERVER_MODE)
+  tde_rekey_daemon_destroy ();
+  stats_refresh_daemon_destroy ();
+#endif /* SERVER_MODE */
+
   vacuum_stop_workers (thread_p);
   vacuum_stop_master (thread_p);
 
@@ -3091,6 +3174,10 @@ xboot_shutdown_server (REFPTR (THREAD_ENTRY, thread_p), ER_FINAL_CODE is_er_fina
   /* Shutdown the system with the system transaction */
   logtb_set_to_system_tran_index (thread_p);
   log_abort_all_active_transaction (thread_p);
+#if defined(SERVER_MODE)
+  tde_rekey_daemon_destroy ();
+  stats_refresh_daemon_destroy ();
+#endif /* SERVER_MODE */
   vacuum_stop_workers (thread_p);
 
   /* before removing temp vols */
@@ -3868,6 +3955,9 @@ boot_server_all_finalize (THREAD_ENTRY * thread_p, ER_FINAL_CODE is_er_final,
   catalog_finalize ();
   qmgr_finalize (thread_p);
   (void) heap_manager_finalize ();
+  btree_bloom_finalize ();
+  sort_workers_finalize ();
+  stats_workers_finalize ();
   perfmon_finalize ();
   fileio_dismount_all (thread_p);
   disk_manager_final ();
@@ -4913,6 +5003,11 @@ boot_create_all_volumes (THREAD_ENTRY * thread_p, const BOOT_CLIENT_CREDENTIAL *
 
   spage_boot (thread_p);
   error_code = heap_manager_initialize ();
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+  error_code = btree_bloom_initialize ();
   if (error_code != NO_ERROR)
     {
       goto error;
@@ -5486,6 +5581,11 @@ xboot_emergency_patch (const char *db_name, bool recreate_log, DKNPAGES log_npag
 
   spage_boot (thread_p);
   error_code = heap_manager_initialize ();
+  if (error_code != NO_ERROR)
+    {
+      goto error_exit;
+    }
+  error_code = btree_bloom_initialize ();
   if (error_code != NO_ERROR)
     {
       goto error_exit;
@@ -6051,13 +6151,7 @@ boot_get_new_volume_name_and_id (THREAD_ENTRY * thread_p, DB_VOLTYPE voltype, co
 	}
       assert (given_path == NULL && given_name == NULL);
 
-      temp_path = (char *) prm_get_string_value (PRM_ID_IO_TEMP_VOLUME_PATH);
-      if (temp_path == NULL || temp_path[0] == '\0')
-	{
-	  temp_path = fileio_get_directory_path (buf_temp_path, boot_Db_full_name);
-	}
-      temp_name = fileio_get_base_file_name (boot_Db_full_name);
-      fileio_make_volume_temp_name (fullname_newvol_out, temp_path, temp_name, *volid_newvol_out);
+      boot_make_temp_volume_fullname (fullname_newvol_out, *volid_newvol_out);
     }
 
   return NO_ERROR;
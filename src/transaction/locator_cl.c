@@ -2415,6 +2415,20 @@ locator_fetch_instance (MOP mop, DB_FETCH_MODE purpose, LC_FETCH_VERSION_TYPE fe
 
   inst = NULL;
   lock = locator_fetch_mode_to_lock (purpose, LC_INSTANCE, fetch_version_type);
+
+  if (prm_get_bool_value (PRM_ID_WS_PREFETCH_REFERENCES) && purpose == DB_FETCH_READ
+      && fetch_version_type == LC_FETCH_MVCC_VERSION && ws_find (mop, &inst) == WS_FIND_MOP_NOTDELETED && inst == NULL)
+    {
+      /* The object is not cached. Bring it along with its direct references in one request, so that following the
+       * references does not cost a request for each object. This is only a prefetch; on failure, fetch the object
+       * alone. */
+      if (locator_lock_nested (mop, lock, 1, false, NULL, NULL) != NO_ERROR)
+	{
+	  er_clear ();
+	}
+      inst = NULL;
+    }
+
   if (locator_lock (mop, LC_INSTANCE, lock, fetch_version_type) != NO_ERROR)
     {
       return NULL;
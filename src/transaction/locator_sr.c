@@ -59,6 +59,7 @@
 #endif /* ENABLE_SYSTEMTAP */
 #include "record_descriptor.hpp"
 #include "slotted_page.h"
+#include "statistics_sr.h"
 #include "xasl_cache.h"
 #include "xasl_predicate.hpp"
 #include "thread_manager.hpp"	// for thread_get_thread_entry_info
@@ -73,6 +74,14 @@ static const int LOCATOR_GUESS_NUM_NESTED_REFERENCES = 100;
 
 #define CLASSNAME_CACHE_SIZE            1024
 
+/* Pages of the copy areas that objects of a lockset are returned in. Many requested objects are sent in a few large
+ * areas instead of a round trip for every page of objects. */
+#define LOCATOR_LOCKSET_COPYAREA_NPAGES 4
+
+/* Class names each thread remembers the OIDs of. Lookups of a remembered name do not enter the classname table
+ * critical section. */
+#define LOCATOR_CLASSNAME_THREAD_CACHE_SIZE 32
+
 /* flag for INSERT/UPDATE/DELETE statement */
 typedef enum
 {
@@ -121,6 +130,24 @@ bool locator_Dont_check_foreign_key = false;
 
 static MHT_TABLE *locator_Mht_classnames = NULL;
 
+/*
+ * Version of the classname table. It is changed every time the table is entered for update, before the table is
+ * changed. A thread remembers the classnames it found with the version they were found in, and the OID is still the
+ * one in the table while the version is the same. Only the entries of committed classes are remembered; the entries
+ * that are reserved or deleted by a transaction, including the current one, are always looked up in the table.
+ */
+static volatile UINT64 locator_Classname_table_version = 0;
+
+typedef struct locator_classname_cache_entry LOCATOR_CLASSNAME_CACHE_ENTRY;
+struct locator_classname_cache_entry
+{
+  UINT64 version;		/* Version of the table the name was found in, 0 if not used */
+  OID oid;			/* The class identifier of classname */
+  char name[DB_MAX_IDENTIFIER_LENGTH];	/* Name of the class */
+};
+
+static thread_local LOCATOR_CLASSNAME_CACHE_ENTRY locator_Classname_thread_cache[LOCATOR_CLASSNAME_THREAD_CACHE_SIZE];
+
 static const HFID NULL_HFID = { {-1, -1}, -1 };
 
 /* Pseudo pageid used to generate pseudo OID for reserved class names. */
@@ -212,6 +239,9 @@ static void locator_incr_num_transient_classnames (int tran_index);
 static void locator_decr_num_transient_classnames (int tran_index);
 static int locator_get_num_transient_classnames (int tran_index);
 static bool locator_is_exist_class_name_entry (THREAD_ENTRY * thread_p, LOCATOR_CLASSNAME_ENTRY * entry);
+static int locator_enter_class_name_table_for_update (THREAD_ENTRY * thread_p);
+static bool locator_get_cached_class_oid (const char *classname, OID * class_oid);
+static void locator_cache_class_oid (const char *classname, const OID * class_oid, UINT64 version);
 
 static DISK_ISVALID locator_repair_btree_by_delete (THREAD_ENTRY * thread_p, OID * class_oid, BTID * btid,
 						    OID * inst_oid);
@@ -252,7 +282,7 @@ locator_initialize (THREAD_ENTRY * thread_p)
   HEAP_SCANCACHE scan_cache;
   LOCATOR_CLASSNAME_ENTRY *entry;
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -363,7 +393,7 @@ error:
 void
 locator_finalize (THREAD_ENTRY * thread_p)
 {
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       /* Some kind of failure. We will leak resources. */
       assert (false);
@@ -472,7 +502,7 @@ xlocator_reserve_class_name (THREAD_ENTRY * thread_p, const char *classname, OID
 start:
   reserve = LC_CLASSNAME_RESERVED;
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -645,7 +675,7 @@ start:
 	  /*
 	   * Something wrong. Remove the entry from hash table.
 	   */
-	  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+	  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
 	    {
 	      assert (false);
 	      return LC_CLASSNAME_ERROR;
@@ -773,7 +803,7 @@ xlocator_delete_class_name (THREAD_ENTRY * thread_p, const char *classname)
 start:
   classname_delete = LC_CLASSNAME_DELETED;
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -938,7 +968,7 @@ xlocator_rename_class_name (THREAD_ENTRY * thread_p, const char *oldname, const
       return renamed;
     }
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -1042,6 +1072,12 @@ xlocator_find_class_oid (THREAD_ENTRY * thread_p, const char *classname, OID * c
 start:
   find = LC_CLASSNAME_EXIST;
 
+  if (locator_get_cached_class_oid (classname, class_oid))
+    {
+      /* The class of the name did not change since this thread found it. */
+      goto lock_class;
+    }
+
   if (csect_enter_as_reader (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
     {
       assert (false);
@@ -1059,6 +1095,9 @@ start:
   if (locator_is_exist_class_name_entry (thread_p, entry))
     {
       assert (find == LC_CLASSNAME_EXIST);	/* OK, go ahead */
+
+      /* The version cannot change while the table is entered as reader. */
+      locator_cache_class_oid (classname, class_oid, ATOMIC_LOAD_64 (&locator_Classname_table_version));
     }
   else if (entry != NULL)
     {
@@ -1126,6 +1165,7 @@ start:
 
   csect_exit (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE);
 
+lock_class:
   if (lock != NULL_LOCK && find == LC_CLASSNAME_EXIST)
     {
       /* Now acquired the desired lock */
@@ -1177,7 +1217,7 @@ locator_permoid_class_name (THREAD_ENTRY * thread_p, const char *classname, cons
   int error_code = NO_ERROR;
 
   /* Is there any entries on the classname hash table ? */
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       assert (false);
       return ER_FAILED;
@@ -1273,7 +1313,7 @@ locator_drop_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA * sa
 
   tdes = LOG_FIND_TDES (tran_index);
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -1626,7 +1666,7 @@ locator_savepoint_transient_class_name_entries (THREAD_ENTRY * thread_p, LOG_LSA
       return NO_ERROR;		/* do nothing */
     }
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -1937,7 +1977,7 @@ locator_check_class_names (THREAD_ENTRY * thread_p)
       return DISK_ERROR;
     }
 
-  if (csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT) != NO_ERROR)
+  if (locator_enter_class_name_table_for_update (thread_p) != NO_ERROR)
     {
       /* Some kind of failure. We must notify the error to the caller. */
       assert (false);
@@ -2786,6 +2826,7 @@ xlocator_fetch_all (THREAD_ENTRY * thread_p, const HFID * hfid, LOCK * lock, LC_
   int error_code = NO_ERROR;
   MVCC_SNAPSHOT *mvcc_snapshot = NULL;
   MVCC_SNAPSHOT mvcc_snapshot_dirty;
+  bool is_bulk_read = false;
 
   assert (lock != NULL);
   if (OID_ISNULL (last_oid))
@@ -2871,6 +2912,13 @@ xlocator_fetch_all (THREAD_ENTRY * thread_p, const HFID * hfid, LOCK * lock, LC_
       goto error;
     }
 
+  if (heap_is_bulk_read_scan (thread_p, hfid))
+    {
+      /* the whole heap is fetched once (e.g. by unloaddb), keep it from sweeping the page buffer */
+      pgbuf_start_bulk_read (thread_p);
+      is_bulk_read = true;
+    }
+
   /* Assume that the next object can fit in one page */
   copyarea_length = DB_PAGESIZE;
 
@@ -3030,6 +3078,11 @@ xlocator_fetch_all (THREAD_ENTRY * thread_p, const HFID * hfid, LOCK * lock, LC_
     }
 
 error:
+  if (is_bulk_read)
+    {
+      pgbuf_end_bulk_read (thread_p);
+    }
+
   return error_code;
 }
 
@@ -3083,6 +3136,13 @@ xlocator_fetch_lockset (THREAD_ENTRY * thread_p, LC_LOCKSET * lockset, LC_COPYAR
 	{
 	  goto error;
 	}
+
+      /* Return the objects in OID order. The objects of a heap page come together and the page is fixed once for all
+       * of them by the scan cache. The client finds the objects by their OIDs, not by their position. */
+      std::sort (reqobjs, reqobjs + lockset->num_reqobjs, [] (const LC_LOCKSET_REQOBJ & a, const LC_LOCKSET_REQOBJ & b)
+		 {
+		   return oid_compare (&a.oid, &b.oid) < 0;
+		 });
     }
 
   /* Start a scan cursor for getting several classes */
@@ -3100,6 +3160,10 @@ xlocator_fetch_lockset (THREAD_ENTRY * thread_p, LC_LOCKSET * lockset, LC_COPYAR
    */
 
   copyarea_length = DB_PAGESIZE;
+  if (lockset->num_reqobjs - lockset->num_reqobjs_processed > 1)
+    {
+      copyarea_length = DB_PAGESIZE * LOCATOR_LOCKSET_COPYAREA_NPAGES;
+    }
 
   nxobj.mobjs = NULL;
   nxobj.comm_area = NULL;
@@ -5165,6 +5229,9 @@ locator_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
     }
 #endif
 
+  /* counts for the statistics refresher */
+  stats_note_modification (&real_class_oid);
+
   *force_count = 1;
 
 error1:
@@ -5956,6 +6023,9 @@ locator_update_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid, OID
 	}
     }
 
+  /* counts for the statistics refresher */
+  stats_note_modification (class_oid);
+
   *force_count = 1;
 
 error:
@@ -6282,6 +6352,9 @@ locator_delete_force_internal (THREAD_ENTRY * thread_p, HFID * hfid, OID * oid,
 	}
       deleted = true;
     }
+  /* counts for the statistics refresher */
+  stats_note_modification (&class_oid);
+
   *force_count = 1;
 
 #if defined(ENABLE_UNUSED_FUNCTION)
@@ -12547,6 +12620,83 @@ locator_is_exist_class_name_entry (THREAD_ENTRY * thread_p, LOCATOR_CLASSNAME_EN
   return false;
 }
 
+/*
+ * locator_enter_class_name_table_for_update () - enter the classname table critical section to change the table
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ *   thread_p(in):
+ *
+ * Note: The table version is changed before the caller changes the table, so that no thread uses the class OIDs it
+ *       remembers from the previous version.
+ */
+static int
+locator_enter_class_name_table_for_update (THREAD_ENTRY * thread_p)
+{
+  int error;
+
+  error = csect_enter (thread_p, CSECT_LOCATOR_SR_CLASSNAME_TABLE, INF_WAIT);
+  if (error == NO_ERROR)
+    {
+      (void) ATOMIC_INC_64 (&locator_Classname_table_version, 1);
+    }
+
+  return error;
+}
+
+/*
+ * locator_get_cached_class_oid () - get the class OID this thread found for the classname, if the classname table
+ *				     did not change since
+ *
+ * return: true if class_oid is set
+ *
+ *   classname(in): Name of class
+ *   class_oid(out): The class identifier of classname
+ */
+static bool
+locator_get_cached_class_oid (const char *classname, OID * class_oid)
+{
+  LOCATOR_CLASSNAME_CACHE_ENTRY *cache_entry;
+
+  cache_entry = &locator_Classname_thread_cache[mht_1strhash (classname, LOCATOR_CLASSNAME_THREAD_CACHE_SIZE)];
+  if (cache_entry->version == 0 || cache_entry->version != ATOMIC_LOAD_64 (&locator_Classname_table_version))
+    {
+      return false;
+    }
+  if (strcmp (cache_entry->name, classname) != 0)
+    {
+      return false;
+    }
+
+  COPY_OID (class_oid, &cache_entry->oid);
+  return true;
+}
+
+/*
+ * locator_cache_class_oid () - remember the class OID of a committed classname entry
+ *
+ * return: nothing
+ *
+ *   classname(in): Name of class
+ *   class_oid(in): The class identifier of classname
+ *   version(in): Version of the classname table the entry was found in
+ */
+static void
+locator_cache_class_oid (const char *classname, const OID * class_oid, UINT64 version)
+{
+  LOCATOR_CLASSNAME_CACHE_ENTRY *cache_entry;
+
+  if (strlen (classname) >= DB_MAX_IDENTIFIER_LENGTH)
+    {
+      return;
+    }
+
+  cache_entry = &locator_Classname_thread_cache[mht_1strhash (classname, LOCATOR_CLASSNAME_THREAD_CACHE_SIZE)];
+  strcpy (cache_entry->name, classname);
+  COPY_OID (&cache_entry->oid, class_oid);
+  cache_entry->version = version;
+}
+
 /*
  * xchksum_insert_repl_log_and_demote_table_lock -
  *
@@ -13709,6 +13859,76 @@ xlocator_demote_class_lock (THREAD_ENTRY * thread_p, const OID * class_oid, LOCK
 }
 
 // *INDENT-OFF*
+/*
+ * locator_multi_insert_records_into_new_page () - insert records into a new heap page and log the page image
+ *
+ * return : error code
+ * thread_p (in)      : thread entry
+ * hfid (in)          : heap file identifier
+ * class_oid (in)     : class object identifier
+ * recdes_array (in)  : records that fit in the page
+ * new_page_vpid (in) : new page, that is appended to heap file on commit
+ * ...                : see locator_insert_force
+ */
+static int
+locator_multi_insert_records_into_new_page (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
+					    std::vector<RECDES> &recdes_array, VPID * new_page_vpid, int has_index,
+					    int op_type, HEAP_SCANCACHE * scan_cache, int *force_count, int pruning_type,
+					    PRUNING_CONTEXT * pcontext, FUNC_PRED_UNPACK_INFO * func_preds,
+					    UPDATE_INPLACE_STYLE force_in_place, bool has_BU_lock, bool dont_check_fk)
+{
+  int error_code = NO_ERROR;
+  OID dummy_oid;
+  PGBUF_WATCHER home_hint_p;
+
+  scan_cache->cache_last_fix_page = true;
+
+  error_code = heap_fix_new_page (thread_p, hfid, new_page_vpid, &home_hint_p);
+  if (error_code != NO_ERROR)
+    {
+      ASSERT_ERROR ();
+      return error_code;
+    }
+
+  for (size_t j = 0; j < recdes_array.size (); j++)
+    {
+      error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j], has_index,
+					 op_type, scan_cache, force_count, pruning_type, pcontext,
+					 func_preds, force_in_place, &home_hint_p, has_BU_lock,
+					 dont_check_fk, true);
+      if (error_code != NO_ERROR)
+	{
+	  ASSERT_ERROR ();
+
+	  if (home_hint_p.pgptr)
+	    {
+	      pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
+	    }
+
+	  if (scan_cache->page_watcher.pgptr)
+	    {
+	      pgbuf_ordered_unfix_and_init (thread_p, scan_cache->page_watcher.pgptr, &scan_cache->page_watcher);
+	    }
+
+	  assert (!pgbuf_is_page_fixed_by_thread (thread_p, new_page_vpid));
+
+	  return error_code;
+	}
+
+      pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
+    }
+
+  // Now log the whole page.
+  pgbuf_log_redo_new_page (thread_p, home_hint_p.pgptr, DB_PAGESIZE, PAGE_HEAP);
+
+  // Unfix the page.
+  pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
+
+  assert (!pgbuf_is_page_fixed_by_thread (thread_p, new_page_vpid));
+
+  return NO_ERROR;
+}
+
 int
 locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oid,
 			    const std::vector<record_descriptor> &recdes, int has_index, int op_type,
@@ -13724,6 +13944,9 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
   RECDES local_record;
   bool has_BU_lock = lock_has_lock_on_object (class_oid, oid_Root_class_oid, BU_LOCK);
   size_t record_overhead = spage_slot_size ();
+  int full_pages_left = 0;
+  VPID new_page_vpids[DISK_SECTOR_NPAGES];
+  int new_page_count = 0, new_page_index = 0;
 
   // Early-out
   if (recdes.size () == 0)
@@ -13737,6 +13960,31 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
   // Take into account the unfill factor of the heap file.
   heap_max_page_size = heap_nonheader_page_capacity () * (1.0f - prm_get_float_value (PRM_ID_HF_UNFILL_FACTOR));
 
+  // Count the pages that will be filled, to allocate them by sectors instead of one by one.
+  for (size_t i = 0; i < recdes.size (); i++)
+    {
+      int record_length = recdes[i].get_recdes ().length;
+      size_t record_size = DB_ALIGN (record_length, HEAP_MAX_ALIGN) + record_overhead;
+
+      if (heap_is_big_length (record_length))
+	{
+	  continue;
+	}
+      if (record_size + accumulated_records_size >= heap_max_page_size)
+	{
+	  full_pages_left++;
+	  accumulated_records_size = 0;
+	}
+      accumulated_records_size += record_size;
+    }
+  if (has_BU_lock && accumulated_records_size > 0)
+    {
+      // Under bulk update lock nobody else inserts into the heap; the records left over go to a new page too, so
+      // no record is logged one by one.
+      full_pages_left++;
+    }
+  accumulated_records_size = 0;
+
   for (size_t i = 0; i < recdes.size (); i++)
     {
       local_record = recdes[i].get_recdes ();
@@ -13762,50 +14010,32 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	      >= heap_max_page_size)
 	    {
 	      VPID new_page_vpid;
-	      PGBUF_WATCHER home_hint_p;
-
-	      VPID_SET_NULL (&new_page_vpid);
-	      scan_cache->cache_last_fix_page = true;
 
-	      // First alloc a new empty heap page.
-	      error_code = heap_alloc_new_page (thread_p, hfid, *class_oid, &home_hint_p, &new_page_vpid);
-	      if (error_code != NO_ERROR)
+	      // First get a new empty heap page.
+	      if (new_page_index == new_page_count)
 		{
-		  ASSERT_ERROR ();
-		  return error_code;
-		}
+		  assert (full_pages_left > 0);
+		  new_page_count = MIN (full_pages_left, DISK_SECTOR_NPAGES);
+		  new_page_index = 0;
 
-	      for (size_t j = 0; j < recdes_array.size (); j++)
-		{
-		  error_code = locator_insert_force (thread_p, hfid, class_oid, &dummy_oid, &recdes_array[j], has_index,
-						     op_type, scan_cache, force_count, pruning_type, pcontext,
-						     func_preds, force_in_place, &home_hint_p, has_BU_lock,
-						     dont_check_fk, true);
+		  error_code = heap_alloc_new_pages (thread_p, hfid, *class_oid, new_page_count, new_page_vpids);
 		  if (error_code != NO_ERROR)
 		    {
 		      ASSERT_ERROR ();
-
-		      if (home_hint_p.pgptr)
-			{
-			  pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
-			}
-
-		      if (scan_cache->page_watcher.pgptr)
-			{
-			  pgbuf_ordered_unfix_and_init (thread_p, scan_cache->page_watcher.pgptr,
-							&scan_cache->page_watcher);
-			}
-
-		      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
-
 		      return error_code;
 		    }
-
-		  pgbuf_replace_watcher (thread_p, &scan_cache->page_watcher, &home_hint_p);
 		}
+	      new_page_vpid = new_page_vpids[new_page_index++];
+	      full_pages_left--;
 
-	      // Now log the whole page.
-	      pgbuf_log_redo_new_page (thread_p, home_hint_p.pgptr, DB_PAGESIZE, PAGE_HEAP);
+	      error_code = locator_multi_insert_records_into_new_page (thread_p, hfid, class_oid, recdes_array,
+								       &new_page_vpid, has_index, op_type, scan_cache,
+								       force_count, pruning_type, pcontext, func_preds,
+								       force_in_place, has_BU_lock, dont_check_fk);
+	      if (error_code != NO_ERROR)
+		{
+		  return error_code;
+		}
 
 	      // Add the new VPID to the VPID array.
 	      assert (!VPID_ISNULL (&new_page_vpid));
@@ -13814,11 +14044,6 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	      // Clear the recdes array.
 	      recdes_array.clear ();
 	      accumulated_records_size = 0;
-
-	      // Unfix the page.
-	      pgbuf_ordered_unfix_and_init (thread_p, home_hint_p.pgptr, &home_hint_p);
-
-	      assert (!pgbuf_is_page_fixed_by_thread (thread_p, &new_page_vpid));
 	    }
 
 	  // Add this record to the recdes array and increase the accumulated size.
@@ -13828,6 +14053,42 @@ locator_multi_insert_force (THREAD_ENTRY * thread_p, HFID * hfid, OID * class_oi
 	}
     }
 
+  if (has_BU_lock && !recdes_array.empty ())
+    {
+      VPID new_page_vpid;
+
+      if (new_page_index == new_page_count)
+	{
+	  assert (full_pages_left == 1);
+	  new_page_count = 1;
+	  new_page_index = 0;
+
+	  error_code = heap_alloc_new_pages (thread_p, hfid, *class_oid, new_page_count, new_page_vpids);
+	  if (error_code != NO_ERROR)
+	    {
+	      ASSERT_ERROR ();
+	      return error_code;
+	    }
+	}
+      new_page_vpid = new_page_vpids[new_page_index++];
+      full_pages_left--;
+
+      error_code = locator_multi_insert_records_into_new_page (thread_p, hfid, class_oid, recdes_array,
+							       &new_page_vpid, has_index, op_type, scan_cache,
+							       force_count, pruning_type, pcontext, func_preds,
+							       force_in_place, has_BU_lock, dont_check_fk);
+      if (error_code != NO_ERROR)
+	{
+	  return error_code;
+	}
+
+      heap_pages_array.push_back (new_page_vpid);
+      recdes_array.clear ();
+    }
+
+  // All allocated pages were filled.
+  assert (new_page_index == new_page_count && full_pages_left == 0);
+
   // We must check if we have records which did not fill an entire page.
   for (size_t i = 0; i < recdes_array.size (); i++)
     {
@@ -50,6 +50,7 @@
 #include "oid.h"
 #include "page_buffer.h"
 #include "perf_monitor.h"
+#include "perf_hotpath.hpp"
 #include "porting.h"
 #if defined(ENABLE_SYSTEMTAP)
 #include "probes.h"
@@ -78,6 +79,12 @@ extern LOCK_COMPATIBILITY lock_Comp[12][12];
   ((OID_ISTEMP(oid)) ? (unsigned int)(-((oid)->pageid) % htsize) :\
                        lock_get_hash_value(oid, htsize))
 
+/* The shared lock entries are split in freelists by the hash of the locked object, so that transactions locking
+ * unrelated objects do not compete for the same freelist head. */
+#define LK_OBJ_FREE_ENTRY_PARTITIONS 16
+#define LK_OBJ_FREE_ENTRY_LIST(oid) \
+  (&lk_Gl.obj_free_entry_lists[LK_OBJ_LOCK_HASH (oid, LK_OBJ_FREE_ENTRY_PARTITIONS)])
+
 /* thread is lock-waiting ? */
 #define LK_IS_LOCKWAIT_THREAD(thrd) \
   ((thrd)->lockwait != NULL \
@@ -354,7 +361,7 @@ struct lk_global_data
   int max_obj_locks;		/* max # of object locks */
 
   lk_hashmap_type m_obj_hash_table;
-  LF_FREELIST obj_free_entry_list;
+  LF_FREELIST obj_free_entry_lists[LK_OBJ_FREE_ENTRY_PARTITIONS];
 
   /* transaction lock table */
   int num_trans;		/* # of transactions */
@@ -374,6 +381,7 @@ struct lk_global_data
   bool verbose_mode;
   // *INDENT-OFF*
   std::atomic_int deadlock_and_timeout_detector;
+  std::atomic_bool deadlock_suspected;	/* a blocked request closed a short wait-for cycle */
   // *INDENT-ON*
 #if defined(LK_DUMP)
   bool dump_level;
@@ -383,7 +391,7 @@ struct lk_global_data
   lk_global_data ()
     : max_obj_locks (0)
     , m_obj_hash_table {}
-    , obj_free_entry_list LF_FREELIST_INITIALIZER
+    , obj_free_entry_lists {}
     , num_trans (0)
     , tran_lock_table (NULL)
     , DL_detection_mutex PTHREAD_MUTEX_INITIALIZER
@@ -396,6 +404,7 @@ struct lk_global_data
     , no_victim_case_count (0)
     , verbose_mode (false)
     , deadlock_and_timeout_detector { 0 }
+    , deadlock_suspected { false }
 #if defined(LK_DUMP)
     , dump_level (0)
 #endif
@@ -443,6 +452,10 @@ static const int LK_MIN_TWFG_EDGE_COUNT = 200;
 /* TODO : change const */
 #define LK_MAX_TWFG_EDGE_COUNT (MAX_NTRANS * MAX_NTRANS)
 
+/* bounds of the wait-for cycle search done when a lock request blocks */
+static const int LK_WAIT_CYCLE_SEARCH_DEPTH = 4;
+static const int LK_WAIT_CYCLE_SEARCH_MAX_EDGES = 64;
+
 #define DEFAULT_WAIT_USERS	10
 static const int LK_COMPOSITE_LOCK_OID_INCREMENT = 100;
 #endif /* SERVER_MODE */
@@ -490,6 +503,8 @@ static int lock_delete_from_tran_non2pl_list (LK_ENTRY * non2pl, int owner_tran_
 static LK_ENTRY *lock_find_tran_hold_entry (THREAD_ENTRY * thread_p, int tran_index, const OID * oid, bool is_class);
 static bool lock_force_timeout_expired_wait_transactions (void *thrd_entry);
 static bool lock_is_local_deadlock_detection_interval_up (void);
+static bool lock_is_wait_cycle_suspected (int root_tran_index, LK_RES * res_ptr, LOCK wait_mode, int depth,
+					  int *edge_budget);
 static void lock_detect_local_deadlock (THREAD_ENTRY * thread_p);
 static bool lock_is_class_lock_escalated (LOCK class_lock, LOCK lock_escalation);
 static LK_ENTRY *lock_add_non2pl_lock (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_index, LOCK lock);
@@ -1122,14 +1137,19 @@ static int
 lock_initialize_object_lock_entry_list (void)
 {
   int block_count, block_size, ret;
+  int i;
 
-  /* initialize the entry freelist */
+  /* initialize the entry freelists */
   block_count = 1;
-  block_size = (int) MAX ((lk_Gl.max_obj_locks * LK_ENTRY_RATIO), 1);
-  ret = lf_freelist_init (&lk_Gl.obj_free_entry_list, block_count, block_size, &obj_lock_entry_desc, &obj_lock_ent_Ts);
-  if (ret != NO_ERROR)
+  block_size = (int) MAX ((lk_Gl.max_obj_locks * LK_ENTRY_RATIO) / LK_OBJ_FREE_ENTRY_PARTITIONS, 1);
+  for (i = 0; i < LK_OBJ_FREE_ENTRY_PARTITIONS; i++)
     {
-      return ER_FAILED;
+      ret = lf_freelist_init (&lk_Gl.obj_free_entry_lists[i], block_count, block_size, &obj_lock_entry_desc,
+			      &obj_lock_ent_Ts);
+      if (ret != NO_ERROR)
+	{
+	  return ER_FAILED;
+	}
     }
 
   return NO_ERROR;
@@ -1676,7 +1696,7 @@ lock_add_non2pl_lock (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_index,
     {				/* non2pl == (LK_ENTRY *)NULL */
       /* 2. I do not have a non2pl entry on the lock resource */
       /* allocate a lock entry, initialize it, and connect it */
-      non2pl = lock_get_new_entry (tran_index, t_entry, &lk_Gl.obj_free_entry_list);
+      non2pl = lock_get_new_entry (tran_index, t_entry, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid));
       if (non2pl != NULL)
 	{
 	  lock_initialize_entry_as_non2pl (non2pl, tran_index, res_ptr, lock);
@@ -2181,7 +2201,9 @@ lock_suspend (THREAD_ENTRY * thread_p, LK_ENTRY * entry_ptr, int wait_msecs)
   lock_event_set_tran_wait_entry (entry_ptr->tran_index, entry_ptr);
 
   /* suspend the worker thread (transaction) */
+  thread_wait_event_begin_lock (entry_ptr->thrd_entry, &entry_ptr->res_head->key.oid);
   thread_suspend_wakeup_and_unlock_entry (entry_ptr->thrd_entry, THREAD_LOCK_SUSPENDED);
+  thread_wait_event_end (entry_ptr->thrd_entry);
 
   lk_Gl.deadlock_and_timeout_detector--;
   lk_Gl.TWFG_node[entry_ptr->tran_index].thrd_wait_stime = 0;
@@ -3232,6 +3254,7 @@ lock_internal_perform_lock_object (THREAD_ENTRY * thread_p, int tran_index, cons
   bool is_instant_duration;
   LOCK_COMPATIBILITY compat1, compat2;
   bool is_res_mutex_locked = false;
+  bool is_not_holder = false;	/* true if transaction hold list shows it is not a holder of class */
   TSC_TICKS start_tick, end_tick;
   TSCTIMEVAL tv_diff;
   UINT64 lock_wait_time;
@@ -3300,6 +3323,7 @@ lock_internal_perform_lock_object (THREAD_ENTRY * thread_p, int tran_index, cons
 
 start:
   assert (!is_res_mutex_locked);
+  is_not_holder = false;
 
   if (class_oid != NULL && !OID_IS_ROOTOID (class_oid))
     {
@@ -3334,6 +3358,8 @@ start:
 	  res_ptr = entry_ptr->res_head;
 	  goto lock_tran_lk_entry;
 	}
+      /* all class locks of transaction are in its hold list; no need to look for it among the holders of class */
+      is_not_holder = true;
     }
 
   /* find or add the lockable object in the lock table */
@@ -3355,7 +3381,7 @@ start:
       /* initialize the lock resource entry */
       lock_initialize_resource_as_allocated (res_ptr, NULL_LOCK);
 
-      entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list);
+      entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid));
       if (entry_ptr == NULL)
 	{
 	  assert (is_res_mutex_locked);
@@ -3404,14 +3430,22 @@ start:
   /* the lockable object existed in the hash chain So, check whether I am a holder of the object. */
 
   /* find the lock entry of current transaction */
-  entry_ptr = res_ptr->holder;
-  while (entry_ptr != NULL)
+  entry_ptr = NULL;
+#if defined (NDEBUG)
+  if (!is_not_holder)
+#endif /* NDEBUG */
     {
-      if (entry_ptr->tran_index == tran_index)
+      /* a hot class can have many holders, all with intention locks; skip the walk when possible */
+      entry_ptr = res_ptr->holder;
+      while (entry_ptr != NULL)
 	{
-	  break;
+	  if (entry_ptr->tran_index == tran_index)
+	    {
+	      break;
+	    }
+	  entry_ptr = entry_ptr->next;
 	}
-      entry_ptr = entry_ptr->next;
+      assert (!is_not_holder || entry_ptr == NULL);
     }
 
   if (entry_ptr == NULL)
@@ -3427,7 +3461,7 @@ start:
 
       if (compat1 == LOCK_COMPAT_YES && compat2 == LOCK_COMPAT_YES)
 	{
-	  entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list);
+	  entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid));
 	  if (entry_ptr == NULL)
 	    {
 	      pthread_mutex_unlock (&res_ptr->res_mutex);
@@ -3485,7 +3519,7 @@ start:
 	    {
 	      if (entry_ptr == NULL)
 		{
-		  entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list);
+		  entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid));
 		  if (entry_ptr == NULL)
 		    {
 		      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LK_ALLOC_RESOURCE, 1, "lock heap entry");
@@ -3502,7 +3536,7 @@ start:
 		}
 	      (void) lock_set_error_for_timeout (thread_p, entry_ptr);
 
-	      lock_free_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list, entry_ptr);
+	      lock_free_entry (tran_index, t_entry_ent, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid), entry_ptr);
 	    }
 
 	  ret_val = LK_NOTGRANTED_DUE_TIMEOUT;
@@ -3577,7 +3611,7 @@ start:
 	}
 
       /* allocate a lock entry. */
-      entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list);
+      entry_ptr = lock_get_new_entry (tran_index, t_entry_ent, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid));
       if (entry_ptr == NULL)
 	{
 	  assert (is_res_mutex_locked);
@@ -3709,14 +3743,13 @@ lock_tran_lk_entry:
       pthread_mutex_unlock (&res_ptr->res_mutex);
       if (wait_msecs == LK_ZERO_WAIT)
 	{
-	  LK_ENTRY *p = lock_get_new_entry (tran_index, t_entry_ent,
-					    &lk_Gl.obj_free_entry_list);
+	  LK_ENTRY *p = lock_get_new_entry (tran_index, t_entry_ent, LK_OBJ_FREE_ENTRY_LIST (oid));
 
 	  if (p != NULL)
 	    {
 	      lock_initialize_entry_as_blocked (p, thread_p, tran_index, res_ptr, lock);
 	      lock_set_error_for_timeout (thread_p, p);
-	      lock_free_entry (tran_index, t_entry_ent, &lk_Gl.obj_free_entry_list, p);
+	      lock_free_entry (tran_index, t_entry_ent, LK_OBJ_FREE_ENTRY_LIST (oid), p);
 	    }
 	}
 
@@ -3816,10 +3849,8 @@ lock_tran_lk_entry:
 
 blocked:
 
-  if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
-    {
-      tsc_getticks (&start_tick);
-    }
+  /* the wait time histogram is always collected */
+  tsc_getticks (&start_tick);
 
   /* LK_CANWAIT(wait_msecs) : wait_msecs > 0 */
   perfmon_inc_stat (thread_p, PSTAT_LK_NUM_WAITED_ON_OBJECTS);
@@ -3827,6 +3858,19 @@ blocked:
   LK_MSG_LOCK_WAITFOR (entry_ptr);
 #endif /* LK_TRACE_OBJECT */
 
+  if (is_res_mutex_locked && !lk_Gl.deadlock_suspected)
+    {
+      int edge_budget = LK_WAIT_CYCLE_SEARCH_MAX_EDGES;
+
+      /* look for a short cycle closed by this new wait edge; the detector resolves it on its next run instead of
+       * waiting for the deadlock detection interval. */
+      if (lock_is_wait_cycle_suspected (tran_index, res_ptr, entry_ptr->blocked_mode, LK_WAIT_CYCLE_SEARCH_DEPTH,
+					&edge_budget))
+	{
+	  lk_Gl.deadlock_suspected = true;
+	}
+    }
+
   thread_lock_entry (entry_ptr->thrd_entry);
   if (is_res_mutex_locked)
     {
@@ -3834,11 +3878,12 @@ blocked:
     }
   ret_val = lock_suspend (thread_p, entry_ptr, wait_msecs);
 
+  tsc_getticks (&end_tick);
+  tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
+  lock_wait_time = tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec;
+  perfmon_lk_wait_histogram (thread_p, (int) res_ptr->key.type, lock, lock_wait_time);
   if (perfmon_is_perf_tracking_and_active (PERFMON_ACTIVATION_FLAG_LOCK_OBJECT))
     {
-      tsc_getticks (&end_tick);
-      tsc_elapsed_time_usec (&tv_diff, end_tick, start_tick);
-      lock_wait_time = tv_diff.tv_sec * 1000000LL + tv_diff.tv_usec;
       perfmon_lk_waited_time_on_objects (thread_p, lock, lock_wait_time);
     }
 
@@ -4044,7 +4089,7 @@ lock_internal_perform_unlock_object (THREAD_ENTRY * thread_p, LK_ENTRY * entry_p
 	    }
 
 	  /* free the lock entry */
-	  lock_free_entry (tran_index, t_entry, &lk_Gl.obj_free_entry_list, curr);
+	  lock_free_entry (tran_index, t_entry, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid), curr);
 
 	  if (from_whom != NULL)
 	    {
@@ -4109,7 +4154,7 @@ lock_internal_perform_unlock_object (THREAD_ENTRY * thread_p, LK_ENTRY * entry_p
 	  (void) lock_add_non2pl_lock (thread_p, res_ptr, tran_index, curr->granted_mode);
 	}
       /* free the lock entry */
-      lock_free_entry (tran_index, t_entry, &lk_Gl.obj_free_entry_list, curr);
+      lock_free_entry (tran_index, t_entry, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid), curr);
     }
 
   /* change total_holders_mode */
@@ -4568,7 +4613,7 @@ lock_remove_non2pl (THREAD_ENTRY * thread_p, LK_ENTRY * non2pl, int tran_index)
   /* (void)lk_delete_from_tran_non2pl_list(curr); */
 
   /* free the lock entry */
-  lock_free_entry (tran_index, t_entry, &lk_Gl.obj_free_entry_list, curr);
+  lock_free_entry (tran_index, t_entry, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid), curr);
 
   if (res_ptr->holder == NULL && res_ptr->waiter == NULL && res_ptr->non2pl == NULL)
     {
@@ -4622,7 +4667,7 @@ lock_update_non2pl_list (THREAD_ENTRY * thread_p, LK_RES * res_ptr, int tran_ind
 	      prev->next = curr->next;
 	    }
 	  (void) lock_delete_from_tran_non2pl_list (curr, tran_index);
-	  lock_free_entry (tran_index, t_entry, &lk_Gl.obj_free_entry_list, curr);
+	  lock_free_entry (tran_index, t_entry, LK_OBJ_FREE_ENTRY_LIST (&res_ptr->key.oid), curr);
 	  curr = next;
 	}
       else
@@ -5714,7 +5759,8 @@ lock_check_timeout_expired_and_count_suspended_mapfunc (THREAD_ENTRY & thread_re
 //      (1) to resume an interrupted lock waiter
 //      (2) to resume a timedout lock waiter
 //      (3) to detect and resolve a deadlock.
-//    It operates (1) and (2) for every 100ms and does (3) for every PRM_ID_LK_RUN_DEADLOCK_INTERVAL.
+//    It operates (1) and (2) for every 100ms and does (3) for every PRM_ID_LK_RUN_DEADLOCK_INTERVAL, or on its next run
+//    when a blocked lock request found a short wait-for cycle.
 //
 void
 deadlock_detect_task_execute (cubthread::entry & thread_ref)
@@ -5735,7 +5781,8 @@ deadlock_detect_task_execute (cubthread::entry & thread_ref)
   size_t lock_wait_count = 0;
   thread_get_manager ()->map_entries (lock_check_timeout_expired_and_count_suspended_mapfunc, lock_wait_count);
 
-  if (lock_is_local_deadlock_detection_interval_up () && lock_wait_count >= 2)
+  if (lock_wait_count >= 2
+      && (lk_Gl.deadlock_suspected.exchange (false) || lock_is_local_deadlock_detection_interval_up ()))
     {
       lock_detect_local_deadlock (&thread_ref);
     }
@@ -5838,7 +5885,10 @@ lock_finalize (void)
 
   /* destroy hash table and freelists */
   lk_Gl.m_obj_hash_table.destroy ();
-  lf_freelist_destroy (&lk_Gl.obj_free_entry_list);
+  for (i = 0; i < LK_OBJ_FREE_ENTRY_PARTITIONS; i++)
+    {
+      lf_freelist_destroy (&lk_Gl.obj_free_entry_lists[i]);
+    }
 
   lock_deadlock_detect_daemon_destroy ();
 #endif /* !SERVER_MODE */
@@ -5907,6 +5957,7 @@ lock_object (THREAD_ENTRY * thread_p, const OID * oid, const OID * class_oid, LO
   LK_SET_STANDALONE_XLOCK (lock);
   return LK_GRANTED;
 #else /* !SERVER_MODE */
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_LOCK_OBJECT);
   int tran_index;
   int wait_msecs;
   TRAN_ISOLATION isolation;
@@ -7630,6 +7681,89 @@ lock_is_local_deadlock_detection_interval_up (void)
 #endif /* SERVER_MODE */
 }
 
+#if defined (SERVER_MODE)
+/*
+ * lock_is_wait_cycle_suspected - search a short wait-for cycle from a new wait edge
+ *
+ * return: true if a path of wait edges leads back to root transaction
+ *
+ *   root_tran_index(in): transaction that is about to block
+ *   res_ptr(in): resource waited on (its res_mutex is held by caller)
+ *   wait_mode(in): lock mode waited for on res_ptr
+ *   depth(in): number of wait edges that may still be followed
+ *   edge_budget(in/out): number of holders that may still be visited
+ *
+ * Note: The search is only a hint for the deadlock detector, which still builds the whole wait-for graph to choose
+ *       the victims. Other resources and hold lists are only tried-locked, so it never waits and simply gives up a
+ *       path under contention; cycles longer than the depth are left to the periodic detection.
+ */
+static bool
+lock_is_wait_cycle_suspected (int root_tran_index, LK_RES * res_ptr, LOCK wait_mode, int depth, int *edge_budget)
+{
+  LK_ENTRY *holder;
+  LK_ENTRY *waiting;
+  LK_TRAN_LOCK *tran_lock;
+  LK_RES *next_res_ptr;
+  LOCK next_wait_mode;
+  bool found = false;
+
+  for (holder = res_ptr->holder; holder != NULL && !found; holder = holder->next)
+    {
+      if (--(*edge_budget) < 0)
+	{
+	  return false;
+	}
+      if (lock_Comp[wait_mode][holder->granted_mode] != LOCK_COMPAT_NO)
+	{
+	  continue;
+	}
+      if (holder->tran_index == root_tran_index)
+	{
+	  if (depth < LK_WAIT_CYCLE_SEARCH_DEPTH)
+	    {
+	      /* back to the transaction that is about to block */
+	      return true;
+	    }
+	  /* it is the root own entry being converted */
+	  continue;
+	}
+      if (depth <= 1)
+	{
+	  continue;
+	}
+
+      tran_lock = &lk_Gl.tran_lock_table[holder->tran_index];
+      if (pthread_mutex_trylock (&tran_lock->hold_mutex) != 0)
+	{
+	  continue;
+	}
+      /* the waiting entry cannot be freed while its owner hold list mutex is held */
+      waiting = tran_lock->waiting;
+      if (waiting == NULL || waiting->res_head == NULL || waiting->res_head == res_ptr
+	  || pthread_mutex_trylock (&waiting->res_head->res_mutex) != 0)
+	{
+	  pthread_mutex_unlock (&tran_lock->hold_mutex);
+	  continue;
+	}
+      next_res_ptr = waiting->res_head;
+      if (waiting->blocked_mode == NULL_LOCK)
+	{
+	  /* already granted */
+	  pthread_mutex_unlock (&next_res_ptr->res_mutex);
+	  pthread_mutex_unlock (&tran_lock->hold_mutex);
+	  continue;
+	}
+      next_wait_mode = waiting->blocked_mode;
+      pthread_mutex_unlock (&tran_lock->hold_mutex);
+
+      found = lock_is_wait_cycle_suspected (root_tran_index, next_res_ptr, next_wait_mode, depth - 1, edge_budget);
+      pthread_mutex_unlock (&next_res_ptr->res_mutex);
+    }
+
+  return found;
+}
+#endif /* SERVER_MODE */
+
 //
 // lock_victimize_first_thread_mapfunc - map function on all entries until one lock waiter is victimized
 //
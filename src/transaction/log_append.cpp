@@ -25,10 +25,13 @@
 #include "log_record.hpp"
 #include "page_buffer.h"
 #include "perf_monitor.h"
+#include "perf_hotpath.hpp"
 #include "thread_entry.hpp"
 #include "thread_manager.hpp"
 #include "vacuum.h"
 
+#include <thread>
+
 static bool log_Zip_support = false;
 static int log_Zip_min_size_to_compress = 255;
 #if !defined(SERVER_MODE)
@@ -70,6 +73,12 @@ static void prior_lsa_append_data (int length);
 static LOG_LSA prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes,
     int with_lock);
 static void prior_update_header_mvcc_info (const LOG_LSA &record_lsa, MVCCID mvccid);
+static LOG_PRIOR_LIST_SHARD *prior_lsa_get_shard (THREAD_ENTRY *thread_p);
+static LOG_PRIOR_NODE *prior_lsa_alloc_node (THREAD_ENTRY *thread_p);
+static char *prior_lsa_alloc_node_data (LOG_PRIOR_NODE *node, int length);
+static void prior_lsa_free_node_data (LOG_PRIOR_NODE *node);
+static INT64 prior_lsa_link_to_shard (LOG_PRIOR_LIST_SHARD *shard, LOG_PRIOR_NODE *node);
+static void prior_lsa_wait_all_shards_linked (void);
 static LOG_ZIP *log_append_get_zip_undo (THREAD_ENTRY *thread_p);
 static LOG_ZIP *log_append_get_zip_redo (THREAD_ENTRY *thread_p);
 static char *log_append_get_data_ptr (THREAD_ENTRY *thread_p);
@@ -114,12 +123,34 @@ log_append_info::set_nxio_lsa (const LOG_LSA &next_io_lsa)
   nxio_lsa.store (next_io_lsa);
 }
 
+log_prior_list_shard::log_prior_list_shard ()
+  : header (NULL)
+  , tail (NULL)
+  , list_size (0)
+  , num_reserved (0)
+  , num_linked (0)
+  , free_nodes (NULL)
+  , num_free_nodes (0)
+  , mutex ()
+{
+}
+
+log_prior_list_shard::~log_prior_list_shard ()
+{
+  LOG_PRIOR_NODE *node;
+
+  while (free_nodes != NULL)
+    {
+      node = free_nodes;
+      free_nodes = node->next;
+      free (node);
+    }
+}
+
 log_prior_lsa_info::log_prior_lsa_info ()
   : prior_lsa (NULL_LSA)
   , prev_lsa (NULL_LSA)
-  , prior_list_header (NULL)
-  , prior_list_tail (NULL)
-  , list_size (0)
+  , shards ()
   , prior_flush_list_header (NULL)
   , prior_lsa_mutex ()
 {
@@ -161,16 +192,21 @@ log_prior_has_worker_log_records (THREAD_ENTRY *thread_p)
       LOG_PRIOR_NODE *node;
 
       assert (LSA_LT (&nxio_lsa, &log_Gl.prior_info.prior_lsa));
-      node = log_Gl.prior_info.prior_list_header;
-      while (node != NULL)
+      prior_lsa_wait_all_shards_linked ();
+      for (int i = 0; i < LOG_PRIOR_LIST_SHARD_COUNT; i++)
 	{
-	  if (node->log_header.trid != LOG_SYSTEM_TRANID)
+	  std::unique_lock<std::mutex> shard_ulock (log_Gl.prior_info.shards[i].mutex);
+
+	  for (node = log_Gl.prior_info.shards[i].header; node != NULL; node = node->next)
 	    {
-	      ulock.unlock ();
-	      LOG_CS_EXIT (thread_p);
-	      return true;
+	      if (node->log_header.trid != LOG_SYSTEM_TRANID)
+		{
+		  shard_ulock.unlock ();
+		  ulock.unlock ();
+		  LOG_CS_EXIT (thread_p);
+		  return true;
+		}
 	    }
-	  node = node->next;
 	}
     }
 
@@ -276,10 +312,9 @@ prior_lsa_alloc_and_copy_data (THREAD_ENTRY *thread_p, LOG_RECTYPE rec_type, LOG
   LOG_PRIOR_NODE *node;
   int error_code = NO_ERROR;
 
-  node = (LOG_PRIOR_NODE *) malloc (sizeof (LOG_PRIOR_NODE));
+  node = prior_lsa_alloc_node (thread_p);
   if (node == NULL)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (LOG_PRIOR_NODE));
       return NULL;
     }
 
@@ -371,19 +406,7 @@ prior_lsa_alloc_and_copy_data (THREAD_ENTRY *thread_p, LOG_RECTYPE rec_type, LOG
     {
       if (node != NULL)
 	{
-	  if (node->data_header != NULL)
-	    {
-	      free_and_init (node->data_header);
-	    }
-	  if (node->udata != NULL)
-	    {
-	      free_and_init (node->udata);
-	    }
-	  if (node->rdata != NULL)
-	    {
-	      free_and_init (node->rdata);
-	    }
-	  free_and_init (node);
+	  prior_lsa_free_nodes (node);
 	}
 
       return NULL;
@@ -411,10 +434,9 @@ prior_lsa_alloc_and_copy_crumbs (THREAD_ENTRY *thread_p, LOG_RECTYPE rec_type, L
   LOG_PRIOR_NODE *node;
   int error = NO_ERROR;
 
-  node = (LOG_PRIOR_NODE *) malloc (sizeof (LOG_PRIOR_NODE));
+  node = prior_lsa_alloc_node (thread_p);
   if (node == NULL)
     {
-      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (LOG_PRIOR_NODE));
       return NULL;
     }
 
@@ -459,19 +481,7 @@ prior_lsa_alloc_and_copy_crumbs (THREAD_ENTRY *thread_p, LOG_RECTYPE rec_type, L
     {
       if (node != NULL)
 	{
-	  if (node->data_header != NULL)
-	    {
-	      free_and_init (node->data_header);
-	    }
-	  if (node->udata != NULL)
-	    {
-	      free_and_init (node->udata);
-	    }
-	  if (node->rdata != NULL)
-	    {
-	      free_and_init (node->rdata);
-	    }
-	  free_and_init (node);
+	  prior_lsa_free_nodes (node);
 	}
       return NULL;
     }
@@ -494,7 +504,7 @@ prior_lsa_copy_undo_data_to_node (LOG_PRIOR_NODE *node, int length, const char *
       return NO_ERROR;
     }
 
-  node->udata = (char *) malloc (length);
+  node->udata = prior_lsa_alloc_node_data (node, length);
   if (node->udata == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) length);
@@ -525,7 +535,7 @@ prior_lsa_copy_redo_data_to_node (LOG_PRIOR_NODE *node, int length, const char *
       return NO_ERROR;
     }
 
-  node->rdata = (char *) malloc (length);
+  node->rdata = prior_lsa_alloc_node_data (node, length);
   if (node->rdata == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) length);
@@ -565,7 +575,7 @@ prior_lsa_copy_undo_crumbs_to_node (LOG_PRIOR_NODE *node, int num_crumbs, const
   assert (node->udata == NULL);
   if (length > 0)
     {
-      node->udata = (char *) malloc (length);
+      node->udata = prior_lsa_alloc_node_data (node, length);
       if (node->udata == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) length);
@@ -610,7 +620,7 @@ prior_lsa_copy_redo_crumbs_to_node (LOG_PRIOR_NODE *node, int num_crumbs, const
   assert (node->rdata == NULL);
   if (length > 0)
     {
-      node->rdata = (char *) malloc (length);
+      node->rdata = prior_lsa_alloc_node_data (node, length);
       if (node->rdata == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) length);
@@ -838,7 +848,7 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
     }
 
   /* Allocate memory for data header */
-  node->data_header = (char *) malloc (node->data_header_length);
+  node->data_header = prior_lsa_alloc_node_data (node, node->data_header_length);
   if (node->data_header == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (LOG_REC_UNDOREDO));
@@ -1028,18 +1038,7 @@ prior_lsa_gen_undoredo_record_from_crumbs (THREAD_ENTRY *thread_p, LOG_PRIOR_NOD
   return error_code;
 
 error:
-  if (node->data_header != NULL)
-    {
-      free_and_init (node->data_header);
-    }
-  if (node->udata != NULL)
-    {
-      free_and_init (node->udata);
-    }
-  if (node->rdata != NULL)
-    {
-      free_and_init (node->rdata);
-    }
+  prior_lsa_free_node_data (node);
 
   return error_code;
 }
@@ -1064,7 +1063,7 @@ prior_lsa_gen_postpone_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG
   int error_code = NO_ERROR;
 
   node->data_header_length = sizeof (LOG_REC_REDO);
-  node->data_header = (char *) malloc (node->data_header_length);
+  node->data_header = prior_lsa_alloc_node_data (node, node->data_header_length);
   if (node->data_header == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) node->data_header_length);
@@ -1110,7 +1109,7 @@ prior_lsa_gen_dbout_redo_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, L
   int error_code = NO_ERROR;
 
   node->data_header_length = sizeof (LOG_REC_DBOUT_REDO);
-  node->data_header = (char *) malloc (node->data_header_length);
+  node->data_header = prior_lsa_alloc_node_data (node, node->data_header_length);
   if (node->data_header == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) node->data_header_length);
@@ -1144,7 +1143,7 @@ prior_lsa_gen_2pc_prepare_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node,
   int error_code = NO_ERROR;
 
   node->data_header_length = sizeof (LOG_REC_2PC_PREPCOMMIT);
-  node->data_header = (char *) malloc (node->data_header_length);
+  node->data_header = prior_lsa_alloc_node_data (node, node->data_header_length);
   if (node->data_header == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) node->data_header_length);
@@ -1181,7 +1180,7 @@ prior_lsa_gen_end_chkpt_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, in
   int error_code = NO_ERROR;
 
   node->data_header_length = sizeof (LOG_REC_CHKPT);
-  node->data_header = (char *) malloc (node->data_header_length);
+  node->data_header = prior_lsa_alloc_node_data (node, node->data_header_length);
   if (node->data_header == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) node->data_header_length);
@@ -1286,7 +1285,7 @@ prior_lsa_gen_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_RECTYPE
 
   if (node->data_header_length > 0)
     {
-      node->data_header = (char *) malloc (node->data_header_length);
+      node->data_header = prior_lsa_alloc_node_data (node, node->data_header_length);
       if (node->data_header == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) node->data_header_length);
@@ -1347,11 +1346,14 @@ prior_update_header_mvcc_info (const LOG_LSA &record_lsa, MVCCID mvccid)
 static LOG_LSA
 prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LOG_TDES *tdes, int with_lock)
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_LOG_APPEND);
   LOG_LSA start_lsa;
   LOG_REC_MVCC_UNDO *mvcc_undo = NULL;
   LOG_REC_MVCC_UNDOREDO *mvcc_undoredo = NULL;
   LOG_VACUUM_INFO *vacuum_info = NULL;
   MVCCID mvccid = MVCCID_NULL;
+  LOG_PRIOR_LIST_SHARD *shard = prior_lsa_get_shard (thread_p);
+  INT64 shard_list_size;
 
   if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
     {
@@ -1485,25 +1487,19 @@ prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LO
   /* END append */
   prior_lsa_end_append (thread_p, node);
 
-  if (log_Gl.prior_info.prior_list_tail == NULL)
-    {
-      log_Gl.prior_info.prior_list_header = node;
-      log_Gl.prior_info.prior_list_tail = node;
-    }
-  else
+  /* the LSA is reserved; the node is linked to its shard after releasing prior_lsa_mutex */
+  shard->num_reserved++;
+
+  if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
     {
-      log_Gl.prior_info.prior_list_tail->next = node;
-      log_Gl.prior_info.prior_list_tail = node;
+      log_Gl.prior_info.prior_lsa_mutex.unlock ();
     }
 
-  /* list_size in bytes */
-  log_Gl.prior_info.list_size += (sizeof (LOG_PRIOR_NODE) + node->data_header_length + node->ulength + node->rlength);
+  shard_list_size = prior_lsa_link_to_shard (shard, node);
 
   if (with_lock == LOG_PRIOR_LSA_WITHOUT_LOCK)
     {
-      log_Gl.prior_info.prior_lsa_mutex.unlock ();
-
-      if (log_Gl.prior_info.list_size >= (INT64) logpb_get_memsize ())
+      if (shard_list_size >= (INT64) logpb_get_memsize () / LOG_PRIOR_LIST_SHARD_COUNT)
 	{
 	  perfmon_inc_stat (thread_p, PSTAT_PRIOR_LSA_LIST_MAXED);
 
@@ -1533,6 +1529,331 @@ prior_lsa_next_record_internal (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, LO
   return start_lsa;
 }
 
+/*
+ * prior_lsa_get_shard - get the prior list shard of the thread
+ *
+ * return: prior list shard
+ *
+ *   thread_p(in):
+ */
+static LOG_PRIOR_LIST_SHARD *
+prior_lsa_get_shard (THREAD_ENTRY *thread_p)
+{
+  int index = (thread_p != NULL) ? thread_p->index : 0;
+
+  return &log_Gl.prior_info.shards[(unsigned int) index % LOG_PRIOR_LIST_SHARD_COUNT];
+}
+
+/*
+ * prior_lsa_alloc_node - allocate a prior node, reusing a flushed node of the thread shard if possible
+ *
+ * return: new node or NULL on error
+ *
+ *   thread_p(in):
+ */
+static LOG_PRIOR_NODE *
+prior_lsa_alloc_node (THREAD_ENTRY *thread_p)
+{
+  LOG_PRIOR_LIST_SHARD *shard = prior_lsa_get_shard (thread_p);
+  LOG_PRIOR_NODE *node = NULL;
+
+  if (shard->free_nodes != NULL)
+    {
+      std::unique_lock<std::mutex> ulock (shard->mutex);
+
+      node = shard->free_nodes;
+      if (node != NULL)
+	{
+	  shard->free_nodes = node->next;
+	  shard->num_free_nodes--;
+	}
+    }
+
+  if (node == NULL)
+    {
+      node = (LOG_PRIOR_NODE *) malloc (sizeof (LOG_PRIOR_NODE));
+      if (node == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (LOG_PRIOR_NODE));
+	  return NULL;
+	}
+    }
+
+  node->shard_index = (int) (shard - log_Gl.prior_info.shards);
+  node->inline_used = 0;
+
+  return node;
+}
+
+/*
+ * prior_lsa_alloc_node_data - allocate a buffer for the data header, undo or redo data of a prior node
+ *
+ * return: buffer or NULL if out of memory
+ *
+ *   node(in/out):
+ *   length(in):
+ *
+ * note: the buffer is carved from the node inline area while it fits; only bigger data is allocated separately.
+ */
+static char *
+prior_lsa_alloc_node_data (LOG_PRIOR_NODE *node, int length)
+{
+  int aligned_length = DB_ALIGN (length, MAX_ALIGNMENT);
+  char *data;
+
+  if (node->inline_used + aligned_length <= LOG_PRIOR_NODE_INLINE_SIZE)
+    {
+      data = (char *) node->inline_area + node->inline_used;
+      node->inline_used += aligned_length;
+      return data;
+    }
+
+  return (char *) malloc (length);
+}
+
+/*
+ * prior_lsa_free_node_data - free the data header, undo and redo data of a prior node
+ *
+ * return: void
+ *
+ *   node(in/out):
+ */
+static void
+prior_lsa_free_node_data (LOG_PRIOR_NODE *node)
+{
+  char *inline_start = (char *) node->inline_area;
+  char *inline_end = inline_start + LOG_PRIOR_NODE_INLINE_SIZE;
+  char **data_p[3] = { &node->data_header, &node->udata, &node->rdata };
+
+  for (int i = 0; i < 3; i++)
+    {
+      if (*data_p[i] != NULL && (*data_p[i] < inline_start || *data_p[i] >= inline_end))
+	{
+	  free (*data_p[i]);
+	}
+      *data_p[i] = NULL;
+    }
+
+  node->inline_used = 0;
+}
+
+/*
+ * prior_lsa_free_nodes - free a list of prior nodes
+ *
+ * return: void
+ *
+ *   list(in): nodes linked by next
+ *
+ * note: the nodes go back to the pools of their shards, each shard being locked once for the whole list. nodes that
+ *       do not fit the pools are freed.
+ */
+void
+prior_lsa_free_nodes (LOG_PRIOR_NODE *list)
+{
+  LOG_PRIOR_NODE *heads[LOG_PRIOR_LIST_SHARD_COUNT] = { NULL };
+  LOG_PRIOR_NODE *tails[LOG_PRIOR_LIST_SHARD_COUNT] = { NULL };
+  int counts[LOG_PRIOR_LIST_SHARD_COUNT] = { 0 };
+  LOG_PRIOR_NODE *node, *next;
+  int i;
+
+  for (node = list; node != NULL; node = next)
+    {
+      next = node->next;
+
+      prior_lsa_free_node_data (node);
+
+      i = node->shard_index;
+      assert (i >= 0 && i < LOG_PRIOR_LIST_SHARD_COUNT);
+      if (counts[i] >= LOG_PRIOR_LIST_SHARD_MAX_FREE_NODES)
+	{
+	  free (node);
+	  continue;
+	}
+
+      node->next = heads[i];
+      heads[i] = node;
+      if (tails[i] == NULL)
+	{
+	  tails[i] = node;
+	}
+      counts[i]++;
+    }
+
+  for (i = 0; i < LOG_PRIOR_LIST_SHARD_COUNT; i++)
+    {
+      LOG_PRIOR_LIST_SHARD *shard = &log_Gl.prior_info.shards[i];
+
+      if (heads[i] == NULL)
+	{
+	  continue;
+	}
+
+      std::unique_lock<std::mutex> ulock (shard->mutex);
+
+      if (shard->num_free_nodes + counts[i] > LOG_PRIOR_LIST_SHARD_MAX_FREE_NODES)
+	{
+	  /* pool is full */
+	  ulock.unlock ();
+	  for (node = heads[i]; node != NULL; node = next)
+	    {
+	      next = node->next;
+	      free (node);
+	    }
+	  continue;
+	}
+
+      tails[i]->next = shard->free_nodes;
+      shard->free_nodes = heads[i];
+      shard->num_free_nodes += counts[i];
+    }
+}
+
+/*
+ * prior_lsa_link_to_shard - link a node with reserved LSA to a prior list shard
+ *
+ * return: size of shard list in bytes
+ *
+ *   shard(in/out):
+ *   node(in):
+ *
+ * note: two threads of the same shard may link their nodes in other order than they reserved their LSA's, so out
+ *       of order nodes are inserted by their LSA to keep the shard sorted.
+ */
+static INT64
+prior_lsa_link_to_shard (LOG_PRIOR_LIST_SHARD *shard, LOG_PRIOR_NODE *node)
+{
+  LOG_PRIOR_NODE *prev;
+  INT64 list_size;
+
+  std::unique_lock<std::mutex> ulock (shard->mutex);
+
+  node->next = NULL;
+  if (shard->tail == NULL)
+    {
+      shard->header = node;
+      shard->tail = node;
+    }
+  else if (LSA_LT (&shard->tail->start_lsa, &node->start_lsa))
+    {
+      shard->tail->next = node;
+      shard->tail = node;
+    }
+  else if (LSA_LT (&node->start_lsa, &shard->header->start_lsa))
+    {
+      node->next = shard->header;
+      shard->header = node;
+    }
+  else
+    {
+      for (prev = shard->header; LSA_LT (&prev->next->start_lsa, &node->start_lsa); prev = prev->next)
+	{
+	  ;
+	}
+      node->next = prev->next;
+      prev->next = node;
+    }
+
+  /* list_size in bytes */
+  shard->list_size += (sizeof (LOG_PRIOR_NODE) + node->data_header_length + node->ulength + node->rlength);
+  shard->num_linked++;
+  list_size = shard->list_size;
+
+  return list_size;
+}
+
+/*
+ * prior_lsa_wait_all_shards_linked - wait until all nodes with reserved LSA are linked to their shards
+ *
+ * return: void
+ *
+ * note: caller must hold prior_lsa_mutex, so no new LSA is reserved meanwhile. nodes are linked right after
+ *       their LSA is reserved, so the wait is very short.
+ */
+static void
+prior_lsa_wait_all_shards_linked (void)
+{
+  for (int i = 0; i < LOG_PRIOR_LIST_SHARD_COUNT; i++)
+    {
+      LOG_PRIOR_LIST_SHARD *shard = &log_Gl.prior_info.shards[i];
+      std::unique_lock<std::mutex> ulock (shard->mutex);
+
+      while (shard->num_linked != shard->num_reserved)
+	{
+	  ulock.unlock ();
+	  std::this_thread::yield ();
+	  ulock.lock ();
+	}
+    }
+}
+
+/*
+ * prior_lsa_remove_all_shards - remove all nodes of prior list shards merged in LSA order
+ *
+ * return: prior list
+ *
+ *   list_size(out): size of removed list in bytes
+ *
+ * note: caller must hold prior_lsa_mutex.
+ */
+LOG_PRIOR_NODE *
+prior_lsa_remove_all_shards (INT64 &list_size)
+{
+  LOG_PRIOR_NODE *heads[LOG_PRIOR_LIST_SHARD_COUNT];
+  LOG_PRIOR_NODE *list_header = NULL, *list_tail = NULL;
+  int i, min_index;
+
+  prior_lsa_wait_all_shards_linked ();
+
+  list_size = 0;
+  for (i = 0; i < LOG_PRIOR_LIST_SHARD_COUNT; i++)
+    {
+      LOG_PRIOR_LIST_SHARD *shard = &log_Gl.prior_info.shards[i];
+      std::unique_lock<std::mutex> ulock (shard->mutex);
+
+      heads[i] = shard->header;
+      list_size += shard->list_size;
+
+      shard->header = NULL;
+      shard->tail = NULL;
+      shard->list_size = 0;
+    }
+
+  /* merge the shards; each of them is sorted by LSA */
+  while (true)
+    {
+      min_index = -1;
+      for (i = 0; i < LOG_PRIOR_LIST_SHARD_COUNT; i++)
+	{
+	  if (heads[i] != NULL && (min_index == -1 || LSA_LT (&heads[i]->start_lsa, &heads[min_index]->start_lsa)))
+	    {
+	      min_index = i;
+	    }
+	}
+      if (min_index == -1)
+	{
+	  break;
+	}
+
+      if (list_tail == NULL)
+	{
+	  list_header = heads[min_index];
+	}
+      else
+	{
+	  list_tail->next = heads[min_index];
+	}
+      list_tail = heads[min_index];
+      heads[min_index] = heads[min_index]->next;
+    }
+
+  if (list_tail != NULL)
+    {
+      list_tail->next = NULL;
+    }
+
+  return list_header;
+}
+
 LOG_LSA
 prior_lsa_next_record (THREAD_ENTRY *thread_p, LOG_PRIOR_NODE *node, log_tdes *tdes)
 {
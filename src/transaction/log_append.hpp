@@ -87,6 +87,9 @@ struct log_append_info
 };
 
 typedef struct log_prior_node LOG_PRIOR_NODE;
+/* small log record data is kept in the prior node itself, sparing separate allocations */
+const int LOG_PRIOR_NODE_INLINE_SIZE = 256;
+
 struct log_prior_node
 {
   LOG_RECORD_HEADER log_header;
@@ -105,6 +108,39 @@ struct log_prior_node
   char *rdata;
 
   LOG_PRIOR_NODE *next;
+
+  int shard_index;		/* shard that pools the node once flushed */
+  int inline_used;		/* bytes of inline_area used by data header, undo and redo data */
+  INT64 inline_area[LOG_PRIOR_NODE_INLINE_SIZE / sizeof (INT64)];
+};
+
+/*
+ * The prior list is split into shards so the log records generated concurrently are not linked under a single lock.
+ * Start LSA is still reserved under prior_lsa_mutex; the node is linked afterwards to the shard of the generating
+ * thread, under the shard mutex. Each shard is kept in LSA order, and the log flusher merges the shards.
+ */
+const int LOG_PRIOR_LIST_SHARD_COUNT = 16;
+const int LOG_PRIOR_LIST_SHARD_MAX_FREE_NODES = 256;
+
+typedef struct log_prior_list_shard LOG_PRIOR_LIST_SHARD;
+struct log_prior_list_shard
+{
+  LOG_PRIOR_NODE *header;
+  LOG_PRIOR_NODE *tail;
+
+  INT64 list_size;		/* bytes */
+
+  INT64 num_reserved;		/* nodes with a reserved LSA; protected by prior_lsa_mutex */
+  INT64 num_linked;		/* nodes linked to the shard since its creation */
+
+  /* flushed nodes kept for reuse by the threads of the shard */
+  LOG_PRIOR_NODE *free_nodes;
+  int num_free_nodes;
+
+  std::mutex mutex;
+
+  log_prior_list_shard ();
+  ~log_prior_list_shard ();
 };
 
 typedef struct log_prior_lsa_info LOG_PRIOR_LSA_INFO;
@@ -114,10 +150,7 @@ struct log_prior_lsa_info
   LOG_LSA prev_lsa;
 
   /* list */
-  LOG_PRIOR_NODE *prior_list_header;
-  LOG_PRIOR_NODE *prior_list_tail;
-
-  INT64 list_size;		/* bytes */
+  LOG_PRIOR_LIST_SHARD shards[LOG_PRIOR_LIST_SHARD_COUNT];
 
   /* flush list */
   LOG_PRIOR_NODE *prior_flush_list_header;
@@ -149,6 +182,8 @@ void LOG_RESET_PREV_LSA (const LOG_LSA *lsa);
 char *LOG_APPEND_PTR ();
 
 bool log_prior_has_worker_log_records (THREAD_ENTRY *thread_p);
+LOG_PRIOR_NODE *prior_lsa_remove_all_shards (INT64 &list_size);
+void prior_lsa_free_nodes (LOG_PRIOR_NODE *list);
 LOG_PRIOR_NODE *prior_lsa_alloc_and_copy_data (THREAD_ENTRY *thread_p, LOG_RECTYPE rec_type, LOG_RCVINDEX rcvindex,
     LOG_DATA_ADDR *addr, int ulength, const char *udata, int rlength, const char *rdata);
 LOG_PRIOR_NODE *prior_lsa_alloc_and_copy_crumbs (THREAD_ENTRY *thread_p, LOG_RECTYPE rec_type, LOG_RCVINDEX rcvindex,
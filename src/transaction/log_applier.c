@@ -81,7 +81,6 @@
 
 #define LA_DEFAULT_CACHE_BUFFER_SIZE            100
 #define LA_MAX_REPL_ITEM_WITHOUT_RELEASE_PB     50
-#define LA_MAX_UNFLUSHED_REPL_ITEMS             200
 #define LA_DEFAULT_LOG_PAGE_SIZE                4096
 #define LA_GET_PAGE_RETRY_COUNT                 10
 #define LA_REPL_LIST_COUNT                      50
@@ -338,6 +337,7 @@ struct la_info
   bool is_apply_info_updated;	/* whether catalog is partially updated or not */
 
   int num_unflushed;
+  int max_unflushed;		/* repl items flushed together to the server */
 
   /* file lock */
   int log_path_lockf_vdes;
@@ -346,9 +346,6 @@ struct la_info
   LA_REPL_FILTER repl_filter;
 
   bool reinit_copylog;
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-  int tde_sock_for_dks;		/* unix socket for sharing TDE Data keys with copylogd */
-#endif				/* UNSTABLE_TDE_FOR_REPLICATION_LOG */
 };
 
 typedef struct la_ovf_first_part LA_OVF_FIRST_PART;
@@ -563,10 +560,6 @@ static void la_print_repl_filter_info (void);
 
 static int check_reinit_copylog (void);
 
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-static THREAD_RET_T THREAD_CALLING_CONVENTION la_process_dk_request (void *arg);
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
-
 /*
  * la_shutdown_by_signal() - When the process catches the SIGTERM signal,
  *                                it does the shutdown process.
@@ -4700,7 +4693,7 @@ la_flush_repl_items (bool immediate)
       return NO_ERROR;
     }
 
-  if (la_Info.num_unflushed >= LA_MAX_UNFLUSHED_REPL_ITEMS || immediate == true)
+  if (la_Info.num_unflushed >= la_Info.max_unflushed || immediate == true)
     {
       error = locator_repl_flush_all ();
       if (error == ER_LC_PARTIALLY_FAILED_TO_FLUSH)
@@ -6820,6 +6813,7 @@ la_init (const char *log_path, const int max_mem_size)
   la_Info.db_lockf_vdes = NULL_VOLDES;
 
   la_Info.num_unflushed = 0;
+  la_Info.max_unflushed = 0;
 
   la_recdes_pool.is_initialized = false;
 
@@ -6834,10 +6828,6 @@ la_init (const char *log_path, const int max_mem_size)
 
   la_Info.reinit_copylog = false;
 
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-  la_Info.tde_sock_for_dks = -1;
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
-
   return;
 }
 
@@ -7205,7 +7195,7 @@ check_applied_info_end:
 			    la_Info.act_log.db_logpagesize);
 
 #ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-	  if (error != NO_ERROR && LOG_IS_PAGE_TDE_ENCRYPTED (logpage))
+	  if (error == NO_ERROR && LOG_IS_PAGE_TDE_ENCRYPTED (logpage))
 	    {
 	      error = tde_decrypt_log_page (logpage, logwr_get_tde_algorithm (logpage), logpage);
 	      if (error != NO_ERROR)
@@ -7913,7 +7903,9 @@ la_apply_log_file (const char *database_name, const char *log_path, const int ma
       return error;
     }
 
-  error = la_init_recdes_pool (la_Info.act_log.db_iopagesize, LA_MAX_UNFLUSHED_REPL_ITEMS);
+  /* every unflushed item keeps its record in the pool */
+  la_Info.max_unflushed = prm_get_integer_value (PRM_ID_HA_APPLYLOGDB_MAX_FLUSH_ITEMS);
+  error = la_init_recdes_pool (la_Info.act_log.db_iopagesize, la_Info.max_unflushed);
   if (error != NO_ERROR)
     {
       er_log_debug (ARG_FILE_LINE, "Cannot initialize recdes pool");
@@ -7971,15 +7963,11 @@ la_apply_log_file (const char *database_name, const char *log_path, const int ma
   last_eof_time = time (NULL);
   LSA_SET_NULL (&last_eof_lsa);
 #ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
+  /* copylogdb stores TDE log pages as ciphertext; only the applier needs the data keys */
   error = tde_get_data_keys ();
   if (error == NO_ERROR)
     {
       tde_Cipher.is_loaded = true;
-      error = la_start_dk_sharing ();
-      if (error != NO_ERROR)
-	{
-	  return error;
-	}
     }
 #endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
 
@@ -8492,177 +8480,3 @@ la_delay_replica (time_t eot_time)
 
   return NO_ERROR;
 }
-
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-int
-la_start_dk_sharing (void)
-{
-  int server_sockfd;
-  char sock_path[PATH_MAX] = { 0, };
-  pid_t pid;
-  size_t ts_size;
-  pthread_t processing_th;
-
-  struct sockaddr_un serveraddr;
-
-  fileio_make_ha_sock_name (sock_path, la_Info.log_path, TDE_HA_SOCK_NAME);
-
-  if (access (sock_path, F_OK) == 0)
-    {
-      if (unlink (sock_path) < 0)
-	{
-	  er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_UNLINK, 1, sock_path);
-	  return ER_TDE_DK_SHARING_SOCK_UNLINK;
-	}
-    }
-
-  if ((server_sockfd = socket (AF_UNIX, SOCK_STREAM, 0)) < 0)
-    {
-      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_OPEN, 1, sock_path);
-      return ER_TDE_DK_SHARING_SOCK_OPEN;
-    }
-
-  bzero (&serveraddr, sizeof (serveraddr));
-  serveraddr.sun_family = AF_UNIX;
-  strcpy (serveraddr.sun_path, sock_path);
-
-  if (bind (server_sockfd, (struct sockaddr *) &serveraddr, sizeof (serveraddr)) < 0)
-    {
-      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_BIND, 1, sock_path);
-      return ER_TDE_DK_SHARING_SOCK_BIND;
-    }
-
-  if (listen (server_sockfd, 1) < 0)
-    {
-      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_LISTEN, 1, sock_path);
-      return ER_TDE_DK_SHARING_SOCK_LISTEN;
-    }
-
-  la_Info.tde_sock_for_dks = server_sockfd;
-  if (pthread_create (&processing_th, NULL, la_process_dk_request, NULL) < 0)
-    {
-      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_PTHREAD_CREATE, 0);
-      return ER_TDE_DK_SHARING_PTHREAD_CREATE;
-    }
-  return NO_ERROR;
-}
-
-static THREAD_RET_T THREAD_CALLING_CONVENTION
-la_process_dk_request (void *arg)
-{
-  int client_sockfd, server_sockfd;
-  unsigned int client_len;
-  struct sockaddr_un clientaddr;
-  char buf[PATH_MAX];
-  char *bufptr;
-  int nbytes, len;
-  int error = NO_ERROR;
-
-  server_sockfd = la_Info.tde_sock_for_dks;
-
-  client_len = sizeof (clientaddr);
-
-  while (1)
-    {
-      client_sockfd = accept (server_sockfd, (struct sockaddr *) &clientaddr, &client_len);
-      if (client_sockfd < 0)
-	{
-	  continue;
-	}
-      bufptr = buf;
-      len = PATH_MAX;
-      while (len > 0)
-	{
-	  nbytes = read (client_sockfd, bufptr, len);
-	  if (nbytes < 0)
-	    {
-	      switch (errno)	// errno is thread-local on linux
-		{
-		case EINTR:
-		case EAGAIN:
-		  continue;
-		default:
-		  {
-		    error = ER_TDE_DK_SHARING_SOCK_READ;
-		    break;
-		  }
-		}
-	    }
-	  bufptr += nbytes;
-	  len -= nbytes;
-	}
-
-      if (error == NO_ERROR)
-	{
-	  if (!tde_Cipher.is_loaded)
-	    {
-	      error = ER_TDE_CIPHER_IS_NOT_LOADED;
-	    }
-	  else
-	    {
-	      /* validate the msg from copylogdb */
-	      if (memcmp (buf, la_Info.log_path, PATH_MAX) != 0)
-		{
-		  /* wrong request */
-		  error = ER_TDE_WRONG_DK_REQUEST;
-		}
-	    }
-	}
-
-      /* send error message */
-      bufptr = (char *) &error;
-      len = sizeof (error);
-      while (len > 0)
-	{
-	  nbytes = write (client_sockfd, bufptr, len);
-	  if (nbytes < 0)
-	    {
-	      switch (errno)
-		{
-		case EINTR:
-		case EAGAIN:
-		  continue;
-		default:
-		  {
-		    error = ER_TDE_DK_SHARING_SOCK_WRITE;
-		    break;
-		  }
-		}
-	    }
-	  bufptr += nbytes;
-	  len -= nbytes;
-	}
-
-      /* send data keys */
-      if (error == NO_ERROR)
-	{
-	  bufptr = (char *) &tde_Cipher.data_keys;
-	  len = sizeof (TDE_DATA_KEY_SET);
-	  while (len > 0)
-	    {
-	      nbytes = write (client_sockfd, bufptr, len);
-	      if (nbytes < 0)
-		{
-		  switch (errno)
-		    {
-		    case EINTR:
-		    case EAGAIN:
-		      continue;
-		    default:
-		      {
-			error = ER_TDE_DK_SHARING_SOCK_WRITE;
-			break;
-		      }
-		    }
-		}
-	      bufptr += nbytes;
-	      len -= nbytes;
-	    }
-	}
-      close (client_sockfd);
-    }
-
-  assert (false);
-  return (THREAD_RET_T) - 1;
-}
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
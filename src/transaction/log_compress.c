@@ -31,6 +31,9 @@
 #include "error_manager.h"
 #include "memory_alloc.h"
 #include "perf_monitor.h"
+#include "system_parameter.h"
+
+#include "lz4hc.h"
 
 /*
  * log_zip - compress(zip) log data into LOG_ZIP
@@ -45,6 +48,7 @@ log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
   int zip_len = 0;
   LOG_ZIP_SIZE_T buf_size;
   bool compressed;
+  int level;
 #if defined (SERVER_MODE) || defined (SA_MODE)
   PERF_UTIME_TRACKER time_track;
 #endif
@@ -92,9 +96,25 @@ log_zip (LOG_ZIP * log_zip, LOG_ZIP_SIZE_T length, const void *data)
   /* save original data length */
   memcpy (log_zip->log_data, &length, sizeof (LOG_ZIP_SIZE_T));
 
-  zip_len =
-    LZ4_compress_default ((const char *) data, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T), length,
-			  buf_size - sizeof (LOG_ZIP_SIZE_T));
+  level = prm_get_integer_value (PRM_ID_LOG_COMPRESS_LEVEL);
+  if (level > 0 && log_zip->hc_state == NULL)
+    {
+      /* falls back to fast mode if it cannot be allocated */
+      log_zip->hc_state = malloc (LZ4_sizeofStateHC ());
+    }
+
+  if (level > 0 && log_zip->hc_state != NULL)
+    {
+      zip_len =
+	LZ4_compress_HC_extStateHC (log_zip->hc_state, (const char *) data, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T),
+				    length, buf_size - sizeof (LOG_ZIP_SIZE_T), level);
+    }
+  else
+    {
+      zip_len =
+	LZ4_compress_default ((const char *) data, log_zip->log_data + sizeof (LOG_ZIP_SIZE_T), length,
+			      buf_size - sizeof (LOG_ZIP_SIZE_T));
+    }
   if (zip_len > 0)
     {
       log_zip->data_length = (LOG_ZIP_SIZE_T) zip_len + sizeof (LOG_ZIP_SIZE_T);
@@ -243,6 +263,7 @@ log_zip_alloc (LOG_ZIP_SIZE_T size)
       return NULL;
     }
   log_zip->data_length = 0;
+  log_zip->hc_state = NULL;
 
   log_zip->log_data = (char *) malloc ((size_t) buf_size);
   if (log_zip->log_data == NULL)
@@ -269,6 +290,10 @@ log_zip_free (LOG_ZIP * log_zip)
     {
       free_and_init (log_zip->log_data);
     }
+  if (log_zip->hc_state)
+    {
+      free_and_init (log_zip->hc_state);
+    }
 
   free_and_init (log_zip);
 }
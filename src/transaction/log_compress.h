@@ -20,7 +20,8 @@
 /*
  * log_compress.h - log compression functions
  *
- * Note: Using lz4 library
+ * Note: Using lz4 library. Data is compressed by lz4 high compression mode when log_compress_level is set; its output
+ *       is in the same lz4 block format, so it is decompressed the same way.
  */
 
 #ifndef _LOG_COMPRESS_H_
@@ -55,6 +56,7 @@ struct log_zip
   LOG_ZIP_SIZE_T data_length;	/* length of stored (compressed/uncompressed)log_zip data */
   LOG_ZIP_SIZE_T buf_size;	/* size of log_zip data buffer */
   char *log_data;		/* compressed/uncompressed log_zip data (used as data buffer) */
+  void *hc_state;		/* lz4 high compression state, allocated on first use */
 };
 
 extern LOG_ZIP *log_zip_alloc (LOG_ZIP_SIZE_T size);
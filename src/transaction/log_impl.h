@@ -312,16 +312,37 @@ struct log_flush_info
 #endif				/* SERVER_MODE */
 };
 
+typedef void (*LOG_FLUSH_COMPLETION_FUNC) (void *arg);
+
+/* function run once the log is flushed up to flush_lsa */
+typedef struct log_flush_completion LOG_FLUSH_COMPLETION;
+struct log_flush_completion
+{
+  LOG_LSA flush_lsa;
+  LOG_FLUSH_COMPLETION_FUNC func;
+  void *arg;
+  LOG_FLUSH_COMPLETION *next;
+};
+
 typedef struct log_group_commit_info LOG_GROUP_COMMIT_INFO;
 struct log_group_commit_info
 {
   /* group commit waiters count */
   pthread_mutex_t gc_mutex;
   pthread_cond_t gc_cond;
+
+  /* adaptive group commit; protected by gc_mutex */
+  int waiters;			/* committers waiting for the log flush */
+  INT64 last_arrival_usec;	/* time of the last commit request */
+  INT64 avg_arrival_usec;	/* moving average of the time between commit requests */
+  INT64 avg_flush_usec;		/* moving average of the log flush duration */
+  int target_batch;		/* commits expected to arrive during one log flush */
+
+  LOG_FLUSH_COMPLETION *completions;	/* run once log is flushed up to their LSA; protected by gc_mutex */
 };
 
 #define LOG_GROUP_COMMIT_INFO_INITIALIZER \
-  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER }
+  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, 0, 0, 0, 1, NULL }
 
 
 
@@ -534,6 +555,7 @@ struct log_tdes
   LOG_TRAN_UPDATE_STATS log_upd_stats;	/* Collects data about inserted/ deleted records during last
 					 * command/transaction */
   bool has_deadlock_priority;
+  bool has_authorization_change;	/* true if users, groups or grants were changed */
 
   bool block_global_oldest_active_until_commit;
   bool is_user_active;
@@ -799,6 +821,12 @@ extern char log_Name_removed_archive[];
 
 extern int logpb_initialize_pool (THREAD_ENTRY * thread_p);
 extern void logpb_finalize_pool (THREAD_ENTRY * thread_p);
+extern int logpb_get_huge_pages_type (void);
+extern int logpb_get_group_commit_target_batch (void);
+extern void logpb_group_commit_flushed (THREAD_ENTRY * thread_p, INT64 flush_usec);
+extern void logpb_add_flush_completion (THREAD_ENTRY * thread_p, const LOG_LSA * flush_lsa,
+					LOG_FLUSH_COMPLETION_FUNC func, void *arg);
+extern void logpb_run_flush_completions (THREAD_ENTRY * thread_p, bool run_all);
 extern bool logpb_is_pool_initialized (void);
 extern void logpb_invalidate_pool (THREAD_ENTRY * thread_p);
 extern LOG_PAGE *logpb_create_page (THREAD_ENTRY * thread_p, LOG_PAGEID pageid);
@@ -855,6 +883,7 @@ extern int logpb_get_archive_number (THREAD_ENTRY * thread_p, LOG_PAGEID pageid)
 extern void logpb_decache_archive_info (THREAD_ENTRY * thread_p);
 extern LOG_PAGE *logpb_fetch_from_archive (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_PAGE * log_pgptr,
 					   int *ret_arv_num, LOG_ARV_HEADER * arv_hdr, bool is_fatal);
+extern void logpb_archive_read_ahead (THREAD_ENTRY * thread_p, LOG_PAGEID pageid);
 extern void logpb_remove_archive_logs (THREAD_ENTRY * thread_p, const char *info_reason);
 extern int logpb_remove_archive_logs_exceed_limit (THREAD_ENTRY * thread_p, int max_count);
 extern void logpb_copy_from_log (THREAD_ENTRY * thread_p, char *area, int length, LOG_LSA * log_lsa,
@@ -1059,6 +1088,9 @@ extern void log_set_db_restore_time (THREAD_ENTRY * thread_p, INT64 db_restore_t
 extern int logpb_prior_lsa_append_all_list (THREAD_ENTRY * thread_p);
 
 extern bool logtb_check_class_for_rr_isolation_err (const OID * class_oid);
+extern void logtb_set_authorization_change (THREAD_ENTRY * thread_p, const OID * class_oid);
+extern void logtb_bump_authorization_version (void);
+extern unsigned int logtb_get_authorization_version (void);
 
 extern void logpb_vacuum_reset_log_header_cache (THREAD_ENTRY * thread_p, LOG_HEADER * loghdr);
 
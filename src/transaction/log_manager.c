@@ -52,6 +52,7 @@
 #include "replication.h"
 #include "xserver_interface.h"
 #include "page_buffer.h"
+#include "page_track.h"
 #include "porting_inline.hpp"
 #include "query_manager.h"
 #include "message_catalog.h"
@@ -321,6 +322,8 @@ static cubthread::daemon *log_Check_ha_delay_info_daemon = NULL;
 
 static cubthread::daemon *log_Flush_daemon = NULL;
 static std::atomic_bool log_Flush_has_been_requested = {false};
+
+static cubthread::daemon *log_Tde_keystream_daemon = NULL;
 // *INDENT-ON*
 
 static void log_daemons_init ();
@@ -1081,7 +1084,7 @@ log_initialize_internal (THREAD_ENTRY * thread_p, const char *db_fullname, const
   log_Gl.run_nxchkpt_atpageid = NULL_PAGEID;	/* Don't run the checkpoint */
   log_Gl.rcv_phase = LOG_RECOVERY_ANALYSIS_PHASE;
 
-  log_Gl.loghdr_pgptr = (LOG_PAGE *) malloc (LOG_PAGESIZE);
+  log_Gl.loghdr_pgptr = (LOG_PAGE *) fileio_alloc_aligned_buffer (LOG_PAGESIZE);
   if (log_Gl.loghdr_pgptr == NULL)
     {
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) LOG_PAGESIZE);
@@ -1326,6 +1329,8 @@ log_initialize_internal (THREAD_ENTRY * thread_p, const char *db_fullname, const
        * Execute the recovery process
        */
       log_recovery (thread_p, ismedia_crash, stopat);
+      pgtrack_load (log_Db_fullname, log_Gl.hdr.db_creation, &log_Gl.hdr.bkup_level0_lsa, &log_Gl.hdr.bkup_level1_lsa,
+		    false);
     }
   else
     {
@@ -1361,6 +1366,9 @@ log_initialize_internal (THREAD_ENTRY * thread_p, const char *db_fullname, const
       LSA_COPY (&log_Gl.flushed_lsa_lower_bound, &log_Gl.append.prev_lsa);
 #endif /* SERVER_MODE */
 
+      pgtrack_load (log_Db_fullname, log_Gl.hdr.db_creation, &log_Gl.hdr.bkup_level0_lsa, &log_Gl.hdr.bkup_level1_lsa,
+		    log_Gl.hdr.is_shutdown);
+
       /*
        * Indicate that database system is UP,... flush the header so that we
        * we know that the system was running in the even of crashes
@@ -1763,6 +1771,13 @@ log_final (THREAD_ENTRY * thread_p)
 
   logpb_flush_header (thread_p);
 
+  if (log_Gl.hdr.is_shutdown)
+    {
+      /* all pages are flushed; the next restart goes on tracking them */
+      (void) pgtrack_save (log_Db_fullname, log_Gl.hdr.db_creation, &log_Gl.hdr.bkup_level0_lsa,
+			   &log_Gl.hdr.bkup_level1_lsa);
+    }
+
   /* Undefine page buffer pool and transaction table */
   logpb_finalize_pool (thread_p);
 
@@ -4659,7 +4674,18 @@ log_change_tran_as_completed (THREAD_ENTRY * thread_p, LOG_TDES * tdes, LOG_RECT
 
       log_Stat.commit_count++;
 
-      logpb_flush_pages (thread_p, lsa);
+#if defined (SERVER_MODE)
+      if (thread_p != NULL && thread_p->defer_commit_flush && BO_IS_SERVER_RESTARTED ()
+	  && log_is_log_flush_daemon_available () && !prm_get_bool_value (PRM_ID_LOG_ASYNC_COMMIT))
+	{
+	  /* the caller waits for the flush without holding the thread, see stran_server_commit */
+	  LSA_COPY (&thread_p->commit_flush_lsa, lsa);
+	}
+      else
+#endif /* SERVER_MODE */
+	{
+	  logpb_flush_pages (thread_p, lsa);
+	}
     }
   else
     {
@@ -4894,6 +4920,12 @@ log_commit_local (THREAD_ENTRY * thread_p, LOG_TDES * tdes, bool retain_lock, bo
    * made by the transaction we will not reflect the changes. They will be definitely lost. */
   tx_lob_locator_clear (thread_p, tdes, true, NULL);
 
+  if (tdes->has_authorization_change)
+    {
+      /* clients drop their authorization caches before they can see the changes */
+      logtb_bump_authorization_version ();
+    }
+
   /* clear mvccid before releasing the locks. This operation must be done before do_postpone because it stores unique
    * statistics for all B-trees and if an error occurs those operations and all operations of current transaction must
    * be rolled back. */
@@ -9723,6 +9755,24 @@ log_wakeup_log_flush_daemon ()
     }
 }
 
+/*
+ * log_request_log_flush () - request the log flush daemon to flush at its next run; without group commit, the
+ *                            daemon is woken up right away
+ */
+void
+log_request_log_flush ()
+{
+  if (!LOG_IS_GROUP_COMMIT_ACTIVE ())
+    {
+      log_wakeup_log_flush_daemon ();
+      return;
+    }
+
+#if defined (SERVER_MODE)
+  log_Flush_has_been_requested = true;
+#endif /* SERVER_MODE */
+}
+
 /*
  * log_is_log_flush_daemon_available () - check if log flush daemon is available
  */
@@ -9736,6 +9786,20 @@ log_is_log_flush_daemon_available ()
 #endif
 }
 
+#if defined (SERVER_MODE)
+/*
+ * log_wakeup_tde_keystream_daemon () - wakeup daemon preparing TDE keystream for the next log append pages
+ */
+void
+log_wakeup_tde_keystream_daemon ()
+{
+  if (log_Tde_keystream_daemon)
+    {
+      log_Tde_keystream_daemon->wakeup ();
+    }
+}
+#endif /* SERVER_MODE */
+
 #if defined (SERVER_MODE)
 /*
  * log_flush_daemon_get_stats () - get log flush daemon thread statistics into statsp
@@ -9977,16 +10041,43 @@ log_flush_execute (cubthread::entry & thread_ref)
   // refresh log trace flush time
   thread_ref.event_stats.trace_log_flush_time = prm_get_integer_value (PRM_ID_LOG_TRACE_FLUSH_TIME_MSECS);
 
+  // *INDENT-OFF*
+  std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now ();
+  // *INDENT-ON*
+
   LOG_CS_ENTER (&thread_ref);
   logpb_flush_pages_direct (&thread_ref);
   LOG_CS_EXIT (&thread_ref);
 
+  // *INDENT-OFF*
+  INT64 flush_usec =
+    std::chrono::duration_cast<std::chrono::microseconds> (std::chrono::steady_clock::now () - start_time).count ();
+  // *INDENT-ON*
+
   log_Stat.gc_flush_count++;
 
   pthread_mutex_lock (&log_Gl.group_commit_info.gc_mutex);
+  logpb_group_commit_flushed (&thread_ref, flush_usec);
   pthread_cond_broadcast (&log_Gl.group_commit_info.gc_cond);
   log_Flush_has_been_requested = false;
   pthread_mutex_unlock (&log_Gl.group_commit_info.gc_mutex);
+
+  logpb_run_flush_completions (&thread_ref, false);
+}
+#endif /* SERVER_MODE */
+
+#if defined(SERVER_MODE)
+static void
+log_tde_keystream_execute (cubthread::entry & thread_ref)
+{
+  if (!BO_IS_SERVER_RESTARTED () || !log_Gl.append.appending_page_tde_encrypted)
+    {
+      return;
+    }
+
+  /* append_lsa is read without log critical section. It is only a hint where to start. */
+  tde_prefetch_log_keystream (log_Gl.hdr.append_lsa.pageid,
+			      (TDE_ALGORITHM) prm_get_integer_value (PRM_ID_TDE_DEFAULT_ALGORITHM));
 }
 #endif /* SERVER_MODE */
 
@@ -10080,6 +10171,29 @@ log_flush_daemon_init ()
 }
 #endif /* SERVER_MODE */
 
+#if defined(SERVER_MODE)
+/*
+ * log_tde_keystream_daemon_init () - initialize daemon preparing TDE keystream for log append pages
+ */
+void
+log_tde_keystream_daemon_init ()
+{
+  assert (log_Tde_keystream_daemon == NULL);
+
+  if (tde_log_keystream_init () != NO_ERROR)
+    {
+      /* log pages are encrypted in the flush as without it */
+      er_clear ();
+      return;
+    }
+
+  cubthread::looper looper = cubthread::looper (std::chrono::milliseconds (100));
+  cubthread::entry_callable_task *daemon_task = new cubthread::entry_callable_task (log_tde_keystream_execute);
+
+  log_Tde_keystream_daemon = cubthread::get_manager ()->create_daemon (looper, daemon_task, "log_tde_keystream");
+}
+#endif /* SERVER_MODE */
+
 #if defined(SERVER_MODE)
 /*
  * log_daemons_init () - initialize daemon threads
@@ -10092,6 +10206,7 @@ log_daemons_init ()
   log_check_ha_delay_info_daemon_init ();
   log_clock_daemon_init ();
   log_flush_daemon_init ();
+  log_tde_keystream_daemon_init ();
 }
 #endif /* SERVER_MODE */
 
@@ -10107,6 +10222,11 @@ log_daemons_destroy ()
   cubthread::get_manager ()->destroy_daemon (log_Check_ha_delay_info_daemon);
   cubthread::get_manager ()->destroy_daemon (log_Clock_daemon);
   cubthread::get_manager ()->destroy_daemon (log_Flush_daemon);
+  if (log_Tde_keystream_daemon != NULL)
+    {
+      cubthread::get_manager ()->destroy_daemon (log_Tde_keystream_daemon);
+      tde_log_keystream_final ();
+    }
 }
 #endif /* SERVER_MODE */
 // *INDENT-ON*
@@ -58,9 +58,26 @@ struct log_topop_range
 
 #define LOG_IS_SYSTEM_OP_STARTED(tdes) ((tdes)->topops.last >= 0)
 
+/* Restart statistics, reported to the error log and to the restart statistics file when crash recovery finishes. */
+typedef enum
+{
+  LOG_RV_RESTART_DWB_RECOVER_TIME,	/* microseconds */
+  LOG_RV_RESTART_VACUUM_LOAD_TIME,
+  LOG_RV_RESTART_ANALYSIS_TIME,
+  LOG_RV_RESTART_REDO_TIME,
+  LOG_RV_RESTART_POSTPONE_TIME,
+  LOG_RV_RESTART_UNDO_TIME,
+  LOG_RV_RESTART_LOG_PAGES_READ,	/* pages */
+  LOG_RV_RESTART_LOG_PAGES_DECRYPTED,
+  LOG_RV_RESTART_DATA_PAGES_READ,
+
+  LOG_RV_RESTART_STAT_COUNT
+} LOG_RV_RESTART_STAT_ID;
+
 extern const char *log_to_string (LOG_RECTYPE type);
 extern bool log_is_in_crash_recovery (void);
 extern bool log_is_in_crash_recovery_and_not_yet_completes_redo (void);
+extern void log_rv_restart_stats_add (LOG_RV_RESTART_STAT_ID id, UINT64 amount);
 extern LOG_LSA *log_get_restart_lsa (void);
 extern LOG_LSA *log_get_crash_point_lsa (void);
 extern LOG_LSA *log_get_append_lsa (void);
@@ -208,10 +225,12 @@ extern INT64 log_get_clock_msec (void);
 extern void log_wakeup_remove_log_archive_daemon ();
 extern void log_wakeup_checkpoint_daemon ();
 extern void log_wakeup_log_flush_daemon ();
+extern void log_request_log_flush ();
 
 extern bool log_is_log_flush_daemon_available ();
 #if defined (SERVER_MODE)
 extern void log_flush_daemon_get_stats (UINT64 * statsp);
+extern void log_wakeup_tde_keystream_daemon ();
 #endif // SERVER_MODE
 
 extern void log_update_global_btid_online_index_stats (THREAD_ENTRY * thread_p);
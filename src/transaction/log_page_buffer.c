@@ -50,6 +50,8 @@
 #endif /* WINDOWS */
 
 #include <assert.h>
+#include <condition_variable>
+#include <mutex>
 
 #include "porting.h"
 #include "porting_inline.hpp"
@@ -73,12 +75,14 @@
 #endif
 #include "critical_section.h"
 #include "page_buffer.h"
+#include "page_track.h"
 #include "double_write_buffer.h"
 #include "file_io.h"
 #include "disk_manager.h"
 #include "error_manager.h"
 #include "xserver_interface.h"
 #include "perf_monitor.h"
+#include "perf_hotpath.hpp"
 #include "storage_common.h"
 #include "system_parameter.h"
 #include "memory_alloc.h"
@@ -151,6 +155,10 @@ static int rv;
 
 #define ARV_PAGE_INFO_TABLE_SIZE    256
 
+/* adaptive group commit */
+#define LOGPB_GROUP_COMMIT_MAX_BATCH 1024
+#define LOGPB_GROUP_COMMIT_AVERAGE(avg, sample) ((avg) == 0 ? (sample) : ((avg) * 7 + (sample)) / 8)
+
 #define LOG_LAST_APPEND_PTR() ((char *) log_Gl.append.log_pgptr->area + LOGAREA_SIZE)
 
 #define LOG_APPEND_ALIGN(thread_p, current_setdirty) \
@@ -231,17 +239,98 @@ struct logpb_partial_append
   LOG_RECORD_HEADER *record_header_p;
 };
 
+/* Cache of decrypted TDE log pages read from the log volumes.
+ * Log pages which are not in the log page buffer any more are read from disk and decrypted again and again when
+ * several readers (e.g., vacuum workers, recovery) need the same pages. Once a log page is written entirely, its content
+ * never changes, so the decrypted page is kept here and copied to the next readers.
+ * A page is mapped to the slot (pageid % num_slots), and it replaces the page in the slot if there is. */
+typedef struct logpb_tde_page_cache_slot LOGPB_TDE_PAGE_CACHE_SLOT;
+struct logpb_tde_page_cache_slot
+{
+  pthread_mutex_t mutex;
+  LOG_PAGEID pageid;		/* Logical page kept in the slot, NULL_PAGEID if none */
+  LOG_PAGE *logpage;		/* The decrypted log page */
+};
+
+typedef struct logpb_tde_page_cache LOGPB_TDE_PAGE_CACHE;
+struct logpb_tde_page_cache
+{
+  LOGPB_TDE_PAGE_CACHE_SLOT *slots;
+  LOG_PAGE *pages_area;
+  int num_slots;		/* 0 if the cache is disabled */
+  volatile UINT64 invalidate_count;	/* increased whenever the whole cache is invalidated */
+};
+
+/* Archive pages are read in groups of consecutive pages, from one read for a raw archive or from one decompression
+ * for a compressed one. The last groups read are cached, and when groups are read in sequence, as recovery, restore
+ * and vacuum do, the following group is read ahead by a worker (in server mode).
+ *
+ * A compressed archive keeps its header page, followed by an index of its page groups and by the groups. Every
+ * group is compressed and written from a page boundary; the index gives the physical page and the compressed length
+ * of each group, so any page is read by decompressing its group. Pages are compressed as they are in the active
+ * log, TDE pages stay encrypted. */
+#define LOGPB_ARV_GROUP_NPAGES 32
+#define LOGPB_ARV_CACHE_NGROUPS 4
+
+#define LOGPB_ARV_IS_COMPRESSED(arv_hdr) ((arv_hdr)->zip_npages_per_group > 0)
+#define LOGPB_ARV_GROUP_SIZE(arv_hdr) \
+  (LOGPB_ARV_IS_COMPRESSED (arv_hdr) ? (arv_hdr)->zip_npages_per_group : LOGPB_ARV_GROUP_NPAGES)
+#define LOGPB_ARV_NUM_GROUPS(arv_hdr) ((int) CEIL_PTVDIV ((arv_hdr)->npages, LOGPB_ARV_GROUP_SIZE (arv_hdr)))
+
+typedef struct logpb_arv_zip_index_entry LOGPB_ARV_ZIP_INDEX_ENTRY;
+struct logpb_arv_zip_index_entry
+{
+  INT32 phy_pageid;		/* Physical page where the compressed group starts */
+  INT32 zip_length;		/* Length of the compressed group */
+};
+
+/* A group of pages read from an archive */
+typedef struct logpb_arv_group LOGPB_ARV_GROUP;
+struct logpb_arv_group
+{
+  int arv_num;
+  LOG_PAGEID fpageid;		/* First page of the archive, to tell apart the archives with the same number */
+  int group;
+  int npages;			/* Pages in the group, 0 if none is loaded */
+  char *pages;			/* Buffer of LOGPB_ARV_GROUP_NPAGES pages */
+  UINT64 last_used;		/* to replace the least recently used group */
+};
+
+// *INDENT-OFF*
+typedef struct logpb_arv_reader LOGPB_ARV_READER;
+struct logpb_arv_reader
+{
+  /* protected by log archive critical section */
+  LOGPB_ARV_GROUP groups[LOGPB_ARV_CACHE_NGROUPS];
+  UINT64 use_count;
+  int last_arv_num;		/* archive and group of last page read, to detect sequential reads */
+  int last_group;
+#if defined (SERVER_MODE)
+  LOGPB_ARV_GROUP next;		/* owned by the worker while is_next_loading */
+  LOG_ARV_HEADER next_arv_hdr;
+  bool is_next_loading;
+  std::mutex mutex;
+  std::condition_variable cond;
+  cubthread::entry_workpool *read_ahead_pool;
+#endif /* SERVER_MODE */
+};
+// *INDENT-ON*
+
 /* Global structure to trantable, log buffer pool, etc   */
 typedef struct log_pb_global_data LOG_PB_GLOBAL_DATA;
 struct log_pb_global_data
 {
   LOG_BUFFER *buffers;		/* Log buffer pool */
   LOG_PAGE *pages_area;
+  size_t pages_area_size;	/* allocated size of pages_area */
+  OS_HUGE_PAGES_TYPE pages_area_huge_pages;	/* how pages_area is backed */
   LOG_BUFFER header_buffer;
   LOG_PAGE *header_page;
   int num_buffers;		/* Number of log buffers */
 
   LOGPB_PARTIAL_APPEND partial_append;
+
+  LOGPB_TDE_PAGE_CACHE tde_page_cache;	/* Decrypted TDE log pages */
 };
 
 typedef struct arv_page_info
@@ -270,6 +359,8 @@ int log_default_input_for_archive_log_location = -1;
 
 LOG_PB_GLOBAL_DATA log_Pb;
 
+static LOGPB_ARV_READER logpb_Arv_reader;
+
 LOG_LOGGING_STAT log_Stat;
 static ARV_LOG_PAGE_INFO_TABLE logpb_Arv_page_info_table;
 
@@ -325,12 +416,36 @@ static void logpb_dump_log_header (FILE * outfp);
 static void logpb_dump_parameter (FILE * outfp);
 static void logpb_dump_runtime (FILE * outfp);
 static void logpb_initialize_log_buffer (LOG_BUFFER * log_buffer_p, LOG_PAGE * log_pg);
+static void logpb_free_pages_area (void);
+static int logpb_initialize_tde_page_cache (void);
+static void logpb_finalize_tde_page_cache (void);
+static void logpb_invalidate_tde_page_cache (void);
+static bool logpb_copy_page_from_tde_page_cache (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_PAGE * log_pgptr);
+static void logpb_add_page_to_tde_page_cache (LOG_PAGEID pageid, const LOG_PAGE * log_pgptr, UINT64 invalidate_count);
 
 static int logpb_check_stop_at_time (FILEIO_BACKUP_SESSION * session, time_t stop_at, time_t backup_time);
+static void logpb_backup_set_tde_keyinfo (THREAD_ENTRY * thread_p, FILEIO_BACKUP_HEADER * backup_header);
+static int logpb_restore_check_tde_keys_file (int keys_vdes, const FILEIO_BACKUP_HEADER * backup_header);
 static void logpb_write_toflush_pages_to_archive (THREAD_ENTRY * thread_p);
 static int logpb_add_archive_page_info (THREAD_ENTRY * thread_p, int arv_num, LOG_PAGEID start_page,
 					LOG_PAGEID end_page);
 static int logpb_get_archive_num_from_info_table (THREAD_ENTRY * thread_p, LOG_PAGEID page_id);
+static int logpb_arv_zip_index_npages (const LOG_ARV_HEADER * arv_hdr);
+static int logpb_arv_zip_write (THREAD_ENTRY * thread_p, int vdes, const LOG_ARV_HEADER * arv_hdr,
+				const char *arv_name);
+static int logpb_arv_load_group (THREAD_ENTRY * thread_p, int vdes, const LOG_ARV_HEADER * arv_hdr, int group,
+				 LOGPB_ARV_GROUP * arv_group);
+static bool logpb_arv_group_is_loaded (const LOGPB_ARV_GROUP * arv_group, const LOG_ARV_HEADER * arv_hdr, int group);
+static LOGPB_ARV_GROUP *logpb_arv_find_group (const LOG_ARV_HEADER * arv_hdr, int group);
+static LOGPB_ARV_GROUP *logpb_arv_victim_group (void);
+static int logpb_read_archive_page (THREAD_ENTRY * thread_p, int vdes, const LOG_ARV_HEADER * arv_hdr,
+				    LOG_PHY_PAGEID phy_pageid, LOG_PAGE * log_pgptr);
+static void logpb_arv_reader_finalize (void);
+#if defined (SERVER_MODE)
+static bool logpb_arv_take_read_ahead (const LOG_ARV_HEADER * arv_hdr, int group, LOGPB_ARV_GROUP * arv_group);
+static void logpb_arv_start_read_ahead (const LOG_ARV_HEADER * arv_hdr, int group);
+static void logpb_arv_read_ahead_execute (cubthread::entry & thread_ref);
+#endif /* SERVER_MODE */
 
 static int logpb_flush_all_append_pages (THREAD_ENTRY * thread_p);
 static int logpb_append_next_record (THREAD_ENTRY * thread_p, LOG_PRIOR_NODE * ndoe);
@@ -340,8 +455,12 @@ static void logpb_end_append (THREAD_ENTRY * thread_p, LOG_RECORD_HEADER * heade
 static void logpb_append_data (THREAD_ENTRY * thread_p, int length, const char *data);
 static void logpb_append_crumbs (THREAD_ENTRY * thread_p, int num_crumbs, const LOG_CRUMB * crumbs);
 static void logpb_next_append_page (THREAD_ENTRY * thread_p, LOG_SETDIRTY current_setdirty);
-static LOG_PRIOR_NODE *prior_lsa_remove_prior_list (THREAD_ENTRY * thread_p);
+static LOG_PRIOR_NODE *prior_lsa_remove_prior_list (THREAD_ENTRY * thread_p, INT64 * list_size);
 static int logpb_append_prior_lsa_list (THREAD_ENTRY * thread_p, LOG_PRIOR_NODE * list);
+#if defined (SERVER_MODE)
+static INT64 logpb_group_commit_now_usec (void);
+static bool logpb_group_commit_arrive (LOG_GROUP_COMMIT_INFO * group_commit_info, INT64 * wait_usec);
+#endif /* SERVER_MODE */
 static int logpb_copy_page (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_ACCESS_MODE access_mode,
 			    LOG_PAGE * log_pgptr);
 
@@ -351,6 +470,7 @@ static void logpb_fatal_error_internal (THREAD_ENTRY * thread_p, bool log_exit,
 static int logpb_copy_log_header (THREAD_ENTRY * thread_p, LOG_HEADER * to_hdr, const LOG_HEADER * from_hdr);
 STATIC_INLINE LOG_BUFFER *logpb_get_log_buffer (LOG_PAGE * log_pg) __attribute__ ((ALWAYS_INLINE));
 STATIC_INLINE int logpb_get_log_buffer_index (LOG_PAGEID log_pageid) __attribute__ ((ALWAYS_INLINE));
+STATIC_INLINE void logpb_add_restart_stats (LOG_RV_RESTART_STAT_ID id, int num_pages) __attribute__ ((ALWAYS_INLINE));
 static int logpb_fetch_header_from_active_log (THREAD_ENTRY * thread_p, const char *db_fullname,
 					       const char *logpath, const char *prefix_logname, LOG_HEADER * hdr,
 					       LOG_PAGE * log_pgptr);
@@ -378,6 +498,21 @@ logpb_get_log_buffer_index (LOG_PAGEID log_pageid)
   return log_pageid % log_Pb.num_buffers;
 }
 
+/*
+ * logpb_add_restart_stats - count log pages read or decrypted while restarting from a crash
+ * return: nothing
+ * id (in) : restart statistic
+ * num_pages (in) : number of pages
+ */
+STATIC_INLINE void
+logpb_add_restart_stats (LOG_RV_RESTART_STAT_ID id, int num_pages)
+{
+  if (!LOG_ISRESTARTED ())
+    {
+      log_rv_restart_stats_add (id, (UINT64) num_pages);
+    }
+}
+
 /*
  * logpb_get_log_buffer - get the buffer from the log page
  * return: the coresponding buffer
@@ -582,7 +717,19 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
     }
 
   size = ((size_t) log_Pb.num_buffers * (LOG_PAGESIZE));
-  log_Pb.pages_area = (LOG_PAGE *) malloc (size);
+  log_Pb.pages_area_size = size;
+  if (prm_get_bool_value (PRM_ID_USE_HUGE_PAGES))
+    {
+      log_Pb.pages_area =
+	(LOG_PAGE *) os_alloc_huge_pages (&log_Pb.pages_area_size,
+					  (size_t) prm_get_integer_value (PRM_ID_HUGE_PAGE_SIZE_KB) * ONE_K,
+					  &log_Pb.pages_area_huge_pages);
+    }
+  else
+    {
+      log_Pb.pages_area = (LOG_PAGE *) fileio_alloc_aligned_buffer (size);
+      log_Pb.pages_area_huge_pages = OS_HUGE_PAGES_NONE;
+    }
   if (log_Pb.pages_area == NULL)
     {
       free_and_init (log_Pb.buffers);
@@ -599,11 +746,11 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
     }
 
   size = LOG_PAGESIZE;
-  log_Pb.header_page = (LOG_PAGE *) malloc (size);
+  log_Pb.header_page = (LOG_PAGE *) fileio_alloc_aligned_buffer (size);
   if (log_Pb.header_page == NULL)
     {
       free_and_init (log_Pb.buffers);
-      free_and_init (log_Pb.pages_area);
+      logpb_free_pages_area ();
       er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
       return ER_OUT_OF_VIRTUAL_MEMORY;
     }
@@ -617,6 +764,12 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
       goto error;
     }
 
+  error_code = logpb_initialize_tde_page_cache ();
+  if (error_code != NO_ERROR)
+    {
+      goto error;
+    }
+
   /* Initialize partial append */
   log_Pb.partial_append.status = LOGPB_APPENDREC_SUCCESS;
   log_Pb.partial_append.log_page_record_header =
@@ -632,6 +785,11 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
 
   pthread_cond_init (&group_commit_info->gc_cond, NULL);
   pthread_mutex_init (&group_commit_info->gc_mutex, NULL);
+  group_commit_info->waiters = 0;
+  group_commit_info->last_arrival_usec = 0;
+  group_commit_info->avg_arrival_usec = 0;
+  group_commit_info->avg_flush_usec = 0;
+  group_commit_info->target_batch = 1;
 
   pthread_mutex_init (&writer_info->wr_list_mutex, NULL);
 
@@ -644,6 +802,9 @@ logpb_initialize_pool (THREAD_ENTRY * thread_p)
   pthread_cond_init (&writer_info->flush_end_cond, NULL);
   pthread_mutex_init (&writer_info->flush_end_mutex, NULL);
 
+  pthread_cond_init (&writer_info->ack_cond, NULL);
+  pthread_mutex_init (&writer_info->ack_mutex, NULL);
+
   writer_info->is_init = true;
 
   return error_code;
@@ -656,6 +817,31 @@ error:
   return error_code;
 }
 
+/*
+ * logpb_free_pages_area - free the page area of the log buffer pool
+ *
+ * return: nothing
+ */
+static void
+logpb_free_pages_area (void)
+{
+  os_free_huge_pages (log_Pb.pages_area, log_Pb.pages_area_size, log_Pb.pages_area_huge_pages);
+  log_Pb.pages_area = NULL;
+  log_Pb.pages_area_size = 0;
+  log_Pb.pages_area_huge_pages = OS_HUGE_PAGES_NONE;
+}
+
+/*
+ * logpb_get_huge_pages_type - how the page area of the log buffer pool is backed
+ *
+ * return: OS_HUGE_PAGES_TYPE
+ */
+int
+logpb_get_huge_pages_type (void)
+{
+  return (int) log_Pb.pages_area_huge_pages;
+}
+
 /*
  * logpb_finalize_pool - TERMINATES THE LOG BUFFER POOL
  *
@@ -692,11 +878,15 @@ logpb_finalize_pool (THREAD_ENTRY * thread_p)
 #endif /* CUBRID_DEBUG */
 
   free_and_init (log_Pb.buffers);
-  free_and_init (log_Pb.pages_area);
+  logpb_free_pages_area ();
   free_and_init (log_Pb.header_page);
   log_Pb.num_buffers = 0;
   logpb_Initialized = false;
   logpb_finalize_flush_info ();
+  logpb_finalize_tde_page_cache ();
+  logpb_arv_reader_finalize ();
+  /* log is flushed */
+  logpb_run_flush_completions (NULL, true);
 
   pthread_mutex_destroy (&log_Gl.chkpt_lsa_lock);
 
@@ -758,6 +948,184 @@ logpb_invalidate_pool (THREAD_ENTRY * thread_p)
 	  logpb_initialize_log_buffer (log_bufptr, log_bufptr->logpage);
 	}
     }
+
+  /* the log may be reset to the past. Logical pages after the new end of log are going to be written again. */
+  logpb_invalidate_tde_page_cache ();
+}
+
+/*
+ * logpb_initialize_tde_page_cache - Initialize the cache of decrypted TDE log pages
+ *
+ * return: NO_ERROR if all OK, ER_ status otherwise
+ *
+ * NOTE: The number of pages cached is given by tde_log_page_cache_npages. The cache is disabled if it is 0.
+ */
+static int
+logpb_initialize_tde_page_cache (void)
+{
+  LOGPB_TDE_PAGE_CACHE *cache = &log_Pb.tde_page_cache;
+  size_t size;
+  int i;
+
+  assert (cache->slots == NULL && cache->pages_area == NULL);
+
+  cache->num_slots = prm_get_integer_value (PRM_ID_TDE_LOG_PAGE_CACHE_NPAGES);
+  cache->invalidate_count = 0;
+  if (cache->num_slots <= 0)
+    {
+      cache->num_slots = 0;
+      return NO_ERROR;
+    }
+
+  size = (size_t) cache->num_slots * sizeof (*cache->slots);
+  cache->slots = (LOGPB_TDE_PAGE_CACHE_SLOT *) malloc (size);
+  if (cache->slots == NULL)
+    {
+      cache->num_slots = 0;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  size = (size_t) cache->num_slots * LOG_PAGESIZE;
+  cache->pages_area = (LOG_PAGE *) malloc (size);
+  if (cache->pages_area == NULL)
+    {
+      free_and_init (cache->slots);
+      cache->num_slots = 0;
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, size);
+      return ER_OUT_OF_VIRTUAL_MEMORY;
+    }
+
+  for (i = 0; i < cache->num_slots; i++)
+    {
+      pthread_mutex_init (&cache->slots[i].mutex, NULL);
+      cache->slots[i].pageid = NULL_PAGEID;
+      cache->slots[i].logpage = (LOG_PAGE *) ((char *) cache->pages_area + (UINT64) i * LOG_PAGESIZE);
+    }
+
+  return NO_ERROR;
+}
+
+/*
+ * logpb_finalize_tde_page_cache - Terminate the cache of decrypted TDE log pages
+ *
+ * return: nothing
+ */
+static void
+logpb_finalize_tde_page_cache (void)
+{
+  LOGPB_TDE_PAGE_CACHE *cache = &log_Pb.tde_page_cache;
+  int i;
+
+  if (cache->slots != NULL)
+    {
+      for (i = 0; i < cache->num_slots; i++)
+	{
+	  pthread_mutex_destroy (&cache->slots[i].mutex);
+	}
+      free_and_init (cache->slots);
+    }
+  if (cache->pages_area != NULL)
+    {
+      free_and_init (cache->pages_area);
+    }
+  cache->num_slots = 0;
+}
+
+/*
+ * logpb_invalidate_tde_page_cache - Invalidate all pages in the cache of decrypted TDE log pages
+ *
+ * return: nothing
+ */
+static void
+logpb_invalidate_tde_page_cache (void)
+{
+  LOGPB_TDE_PAGE_CACHE *cache = &log_Pb.tde_page_cache;
+  LOGPB_TDE_PAGE_CACHE_SLOT *slot;
+  int i;
+
+  /* the pages being read before now must not be added by the readers */
+  ATOMIC_INC_64 (&cache->invalidate_count, 1);
+
+  for (i = 0; i < cache->num_slots; i++)
+    {
+      slot = &cache->slots[i];
+
+      (void) pthread_mutex_lock (&slot->mutex);
+      slot->pageid = NULL_PAGEID;
+      pthread_mutex_unlock (&slot->mutex);
+    }
+}
+
+/*
+ * logpb_copy_page_from_tde_page_cache - Copy a decrypted TDE log page from the cache
+ *
+ * return: true if the page was found in the cache
+ *
+ *   pageid(in): Page identifier
+ *   log_pgptr(out): Page buffer to copy
+ */
+static bool
+logpb_copy_page_from_tde_page_cache (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_PAGE * log_pgptr)
+{
+  LOGPB_TDE_PAGE_CACHE *cache = &log_Pb.tde_page_cache;
+  LOGPB_TDE_PAGE_CACHE_SLOT *slot;
+  bool found = false;
+
+  if (cache->num_slots == 0 || pageid < 0)
+    {
+      return false;
+    }
+
+  slot = &cache->slots[pageid % cache->num_slots];
+
+  (void) pthread_mutex_lock (&slot->mutex);
+  if (slot->pageid == pageid)
+    {
+      memcpy (log_pgptr, slot->logpage, LOG_PAGESIZE);
+      found = true;
+    }
+  pthread_mutex_unlock (&slot->mutex);
+
+  if (found)
+    {
+      assert (log_pgptr->hdr.logical_pageid == pageid);
+      perfmon_inc_stat (thread_p, PSTAT_TDE_LOG_PAGE_CACHE_HITS);
+    }
+
+  return found;
+}
+
+/*
+ * logpb_add_page_to_tde_page_cache - Keep a decrypted TDE log page in the cache
+ *
+ * return: nothing
+ *
+ *   pageid(in): Page identifier
+ *   log_pgptr(in): Decrypted log page read from disk
+ *   invalidate_count(in): invalidate_count of the cache before the page was read
+ *
+ * NOTE: The caller must make sure that the page is entirely written, which means its content will not change any more.
+ */
+static void
+logpb_add_page_to_tde_page_cache (LOG_PAGEID pageid, const LOG_PAGE * log_pgptr, UINT64 invalidate_count)
+{
+  LOGPB_TDE_PAGE_CACHE *cache = &log_Pb.tde_page_cache;
+  LOGPB_TDE_PAGE_CACHE_SLOT *slot;
+
+  assert (cache->num_slots > 0 && pageid >= 0);
+  assert (log_pgptr->hdr.logical_pageid == pageid);
+
+  slot = &cache->slots[pageid % cache->num_slots];
+
+  (void) pthread_mutex_lock (&slot->mutex);
+  /* check it under the slot mutex, since the invalidation clears the slots after increasing the count */
+  if (invalidate_count == ATOMIC_LOAD_64 (&cache->invalidate_count))
+    {
+      memcpy (slot->logpage, log_pgptr, LOG_PAGESIZE);
+      slot->pageid = pageid;
+    }
+  pthread_mutex_unlock (&slot->mutex);
 }
 
 
@@ -1676,7 +2044,7 @@ logpb_flush_header (THREAD_ENTRY * thread_p)
 
       /* This is just a safe guard. log_initialize frees log_Gl.loghdr_pgptr when it fails. It can only happen when
        * deletedb or emergency utilities fail to initialize log. */
-      log_Gl.loghdr_pgptr = (LOG_PAGE *) malloc (LOG_PAGESIZE);
+      log_Gl.loghdr_pgptr = (LOG_PAGE *) fileio_alloc_aligned_buffer (LOG_PAGESIZE);
       if (log_Gl.loghdr_pgptr == NULL)
 	{
 	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) LOG_PAGESIZE);
@@ -1863,6 +2231,8 @@ logpb_copy_page (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_ACCESS_MODE
   PERF_PAGE_MODE stat_page_found = PERF_PAGE_MODE_OLD_IN_BUFFER;
   bool log_csect_entered = false;
   int rv = NO_ERROR, index;
+  LOG_PAGEID nxio_pageid;
+  UINT64 tde_cache_invalidate_count;
 
   assert (log_pgptr != NULL);
   assert (pageid != NULL_PAGEID);
@@ -1926,6 +2296,15 @@ logpb_copy_page (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_ACCESS_MODE
     }
 
   /* Could not get from log page buffer cache */
+  if (logpb_copy_page_from_tde_page_cache (thread_p, pageid, log_pgptr))
+    {
+      goto exit;
+    }
+
+  /* pages before the next io page are written entirely and they won't be changed */
+  nxio_pageid = log_Gl.append.get_nxio_lsa ().pageid;
+  tde_cache_invalidate_count = ATOMIC_LOAD_64 (&log_Pb.tde_page_cache.invalidate_count);
+
   rv = logpb_read_page_from_file (thread_p, pageid, access_mode, log_pgptr);
   if (rv != NO_ERROR)
     {
@@ -1934,6 +2313,13 @@ logpb_copy_page (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_ACCESS_MODE
     }
   stat_page_found = PERF_PAGE_MODE_OLD_LOCK_WAIT;
 
+  if (log_Pb.tde_page_cache.num_slots > 0 && pageid < nxio_pageid
+      && logpb_get_tde_algorithm (log_pgptr) != TDE_ALGORITHM_NONE)
+    {
+      /* decrypted in logpb_read_page_from_file (), keep it for next readers */
+      logpb_add_page_to_tde_page_cache (pageid, log_pgptr, tde_cache_invalidate_count);
+    }
+
   /* Always exit through here */
 exit:
   if (log_csect_entered)
@@ -1983,6 +2369,8 @@ logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_AC
 	     "LOGPB_ACTIVE_NPAGES = %d\n", (long long int) pageid, (long long int) log_pgptr->hdr.logical_pageid,
 	     LOGPB_ACTIVE_NPAGES);
 
+  logpb_add_restart_stats (LOG_RV_RESTART_LOG_PAGES_READ, 1);
+
   if (access_mode == LOG_CS_SAFE_READER)
     {
       /* This is added here to block others from creating new archive or mounting/dismounting archives while the vacuum
@@ -2086,6 +2474,7 @@ logpb_read_page_from_file (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_CS_AC
 		      ASSERT_ERROR ();
 		      goto error;
 		    }
+		  logpb_add_restart_stats (LOG_RV_RESTART_LOG_PAGES_DECRYPTED, 1);
 		}
 	    }
 	}
@@ -2162,6 +2551,7 @@ logpb_read_page_from_active_log (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, int
 	  return -1;
 	}
     }
+  logpb_add_restart_stats (LOG_RV_RESTART_LOG_PAGES_READ, num_pages);
 
   if (decrypt_needed)
     {
@@ -2177,6 +2567,7 @@ logpb_read_page_from_active_log (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, int
 		  ASSERT_ERROR ();
 		  return -1;
 		}
+	      logpb_add_restart_stats (LOG_RV_RESTART_LOG_PAGES_DECRYPTED, 1);
 	    }
 	  ptr += LOG_PAGESIZE;
 	}
@@ -2669,6 +3060,10 @@ logpb_next_append_page (THREAD_ENTRY * thread_p, LOG_SETDIRTY current_setdirty)
       logpb_log ("logpb_next_append_page: set tde_algorithm to appending page (%lld), "
 		 "tde_algorithm = %s\n", (long long int) log_Gl.append.log_pgptr->hdr.logical_pageid,
 		 tde_get_algorithm_name (tde_algo));
+#if defined (SERVER_MODE)
+      /* keep the keystream of the next append pages ready before they are flushed */
+      log_wakeup_tde_keystream_daemon ();
+#endif /* SERVER_MODE */
     }
 
 #if defined(CUBRID_DEBUG)
@@ -3001,6 +3396,7 @@ static int
 logpb_append_prior_lsa_list (THREAD_ENTRY * thread_p, LOG_PRIOR_NODE * list)
 {
   LOG_PRIOR_NODE *node;
+  LOG_PRIOR_NODE *appended_list = NULL;
 
   assert (LOG_CS_OWN_WRITE_MODE (thread_p));
 
@@ -3016,22 +3412,13 @@ logpb_append_prior_lsa_list (THREAD_ENTRY * thread_p, LOG_PRIOR_NODE * list)
 
       logpb_append_next_record (thread_p, node);
 
-      if (node->data_header != NULL)
-	{
-	  free_and_init (node->data_header);
-	}
-      if (node->udata != NULL)
-	{
-	  free_and_init (node->udata);
-	}
-      if (node->rdata != NULL)
-	{
-	  free_and_init (node->rdata);
-	}
-
-      free_and_init (node);
+      node->next = appended_list;
+      appended_list = node;
     }
 
+  /* give the nodes back in bulk */
+  prior_lsa_free_nodes (appended_list);
+
   return NO_ERROR;
 }
 
@@ -3040,19 +3427,16 @@ logpb_append_prior_lsa_list (THREAD_ENTRY * thread_p, LOG_PRIOR_NODE * list)
  *
  * return: prior list
  *
+ *   list_size(out): size of prior list in bytes
  */
 static LOG_PRIOR_NODE *
-prior_lsa_remove_prior_list (THREAD_ENTRY * thread_p)
+prior_lsa_remove_prior_list (THREAD_ENTRY * thread_p, INT64 * list_size)
 {
   LOG_PRIOR_NODE *prior_list;
 
   assert (LOG_CS_OWN_WRITE_MODE (thread_p));
 
-  prior_list = log_Gl.prior_info.prior_list_header;
-
-  log_Gl.prior_info.prior_list_header = NULL;
-  log_Gl.prior_info.prior_list_tail = NULL;
-  log_Gl.prior_info.list_size = 0;
+  prior_list = prior_lsa_remove_all_shards (*list_size);
 
   return prior_list;
 }
@@ -3066,14 +3450,14 @@ prior_lsa_remove_prior_list (THREAD_ENTRY * thread_p)
 int
 logpb_prior_lsa_append_all_list (THREAD_ENTRY * thread_p)
 {
+  PERF_HOTPATH_SCOPE (PERF_HOTPATH_PRIOR_FLUSH);
   LOG_PRIOR_NODE *prior_list;
   INT64 current_size;
 
   assert (LOG_CS_OWN_WRITE_MODE (thread_p));
 
   log_Gl.prior_info.prior_lsa_mutex.lock ();
-  current_size = log_Gl.prior_info.list_size;
-  prior_list = prior_lsa_remove_prior_list (thread_p);
+  prior_list = prior_lsa_remove_prior_list (thread_p, &current_size);
   log_Gl.prior_info.prior_lsa_mutex.unlock ();
 
   if (prior_list != NULL)
@@ -3949,6 +4333,8 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
   int max_wait_time_in_msec = 1000;
   bool need_wakeup_LFT, need_wait;
   bool async_commit, group_commit;
+  bool adaptive_commit = false, is_adaptive_waiter = false;
+  INT64 adaptive_wait_usec = 0;
   LOG_LSA nxio_lsa;
   LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
 
@@ -3989,6 +4375,7 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	  /* synchronous & group commit */
 	  need_wakeup_LFT = false;
 	  log_Stat.gc_commit_request_count++;
+	  adaptive_commit = prm_get_bool_value (PRM_ID_LOG_GROUP_COMMIT_ADAPTIVE);
 	}
     }
   else
@@ -4022,6 +4409,8 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	  need_wakeup_LFT = true;
 	}
 
+      thread_wait_event_begin_log_flush (thread_p, flush_lsa);
+
       while (LSA_LT (&nxio_lsa, flush_lsa))
 	{
 	  gettimeofday (&start_time, NULL);
@@ -4036,6 +4425,22 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	      break;
 	    }
 
+	  if (adaptive_commit == true && is_adaptive_waiter == false)
+	    {
+	      /* first wait of adaptive group commit: flush now or wait for the expected batch to gather */
+	      is_adaptive_waiter = true;
+	      if (logpb_group_commit_arrive (group_commit_info, &adaptive_wait_usec))
+		{
+		  need_wakeup_LFT = true;
+		}
+	      else
+		{
+		  tmp_timeval.tv_sec = start_time.tv_sec + (start_time.tv_usec + adaptive_wait_usec) / 1000000;
+		  tmp_timeval.tv_usec = (start_time.tv_usec + adaptive_wait_usec) % 1000000;
+		  (void) timeval_to_timespec (&to, &tmp_timeval);
+		}
+	    }
+
 	  if (need_wakeup_LFT == true)
 	    {
 	      log_wakeup_log_flush_daemon ();
@@ -4046,84 +4451,300 @@ logpb_flush_pages (THREAD_ENTRY * thread_p, LOG_LSA * flush_lsa)
 	  need_wakeup_LFT = true;
 	  nxio_lsa = log_Gl.append.get_nxio_lsa ();
 	}
+
+      if (is_adaptive_waiter == true)
+	{
+	  pthread_mutex_lock (&group_commit_info->gc_mutex);
+	  assert (group_commit_info->waiters > 0);
+	  group_commit_info->waiters--;
+	  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+	}
+
+      /* with pipelined log copy, the flush does not wait for SYNC replicas; the commit does */
+      logwr_wait_for_sync_ack (thread_p, flush_lsa);
+
+      thread_wait_event_end (thread_p);
     }
 #endif /* SERVER_MODE */
 }
 
-void
-logpb_force_flush_pages (THREAD_ENTRY * thread_p)
+#if defined (SERVER_MODE)
+/*
+ * logpb_group_commit_now_usec - current time in microseconds
+ */
+static INT64
+logpb_group_commit_now_usec (void)
 {
-  LOG_CS_ENTER (thread_p);
-  logpb_flush_pages_direct (thread_p);
-  LOG_CS_EXIT (thread_p);
-}
+  struct timeval now;
 
-void
-logpb_force_flush_header_and_pages (THREAD_ENTRY * thread_p)
-{
-  LOG_CS_ENTER (thread_p);
-  logpb_flush_pages_direct (thread_p);
-  logpb_flush_header (thread_p);
-  LOG_CS_EXIT (thread_p);
+  gettimeofday (&now, NULL);
+  return (INT64) now.tv_sec * 1000000LL + now.tv_usec;
 }
 
 /*
- * logpb_invalid_all_append_pages - Invalidate all append pages
+ * logpb_group_commit_arrive - register a committer that waits for log flush in adaptive group commit
  *
- * return: nothing
+ * return: true to flush right away, false to wait for more commits first
  *
- * NOTE:Invalidate and free all append pages. Before invalidating the
- *              pages if their are dirty, they are flushed.
+ *   group_commit_info(in/out):
+ *   wait_usec(out): how long to wait for more commits
+ *
+ * NOTE: Caller must hold gc_mutex.
+ *       The commits that arrive while log is flushed are grouped in the next flush anyway, so the best batch is the
+ *       number of commits that arrive during one flush. Waiting for more only delays the committers already waiting,
+ *       and waiting for less costs an extra flush. The committer alone is flushed right away, the others wait until
+ *       the batch is expected to gather, but never longer than the group commit interval.
  */
-void
-logpb_invalid_all_append_pages (THREAD_ENTRY * thread_p)
+static bool
+logpb_group_commit_arrive (LOG_GROUP_COMMIT_INFO * group_commit_info, INT64 * wait_usec)
 {
-  LOG_FLUSH_INFO *flush_info = &log_Gl.flush_info;
-#if defined(SERVER_MODE)
-  int rv;
-#endif /* SERVER_MODE */
+  INT64 now_usec = logpb_group_commit_now_usec ();
+  INT64 arrival_usec;
+  INT64 max_wait_usec = (INT64) prm_get_integer_value (PRM_ID_LOG_GROUP_COMMIT_INTERVAL_MSECS) * 1000;
+  INT64 target_batch = 1;
 
-  assert (LOG_CS_OWN_WRITE_MODE (thread_p));
-
-  logpb_log ("called logpb_invalid_all_append_pages\n");
-
-  if (log_Gl.append.log_pgptr != NULL)
+  if (group_commit_info->last_arrival_usec > 0 && now_usec >= group_commit_info->last_arrival_usec)
     {
-      /*
-       * Somehow we already have an append page, flush all current append page
-       * and start form scratch
-       */
-      logpb_flush_pages_direct (thread_p);
-      log_Gl.append.log_pgptr = NULL;
+      arrival_usec = now_usec - group_commit_info->last_arrival_usec;
+      group_commit_info->avg_arrival_usec =
+	LOGPB_GROUP_COMMIT_AVERAGE (group_commit_info->avg_arrival_usec, arrival_usec);
     }
+  group_commit_info->last_arrival_usec = now_usec;
+  group_commit_info->waiters++;
 
-  rv = pthread_mutex_lock (&flush_info->flush_mutex);
+  if (group_commit_info->avg_arrival_usec > 0)
+    {
+      target_batch = group_commit_info->avg_flush_usec / group_commit_info->avg_arrival_usec;
+      target_batch = MAX (target_batch, 1);
+      target_batch = MIN (target_batch, LOGPB_GROUP_COMMIT_MAX_BATCH);
+    }
+  group_commit_info->target_batch = (int) target_batch;
 
-  flush_info->num_toflush = 0;
-  flush_info->toflush[flush_info->num_toflush] = NULL;
+  if (group_commit_info->waiters == 1 || group_commit_info->waiters >= target_batch)
+    {
+      *wait_usec = 0;
+      return true;
+    }
 
-  pthread_mutex_unlock (&flush_info->flush_mutex);
+  *wait_usec = (target_batch - group_commit_info->waiters) * group_commit_info->avg_arrival_usec;
+  *wait_usec = MIN (*wait_usec, max_wait_usec);
+  return false;
 }
+#endif /* SERVER_MODE */
 
 /*
- * logpb_flush_log_for_wal - Flush log if needed
+ * logpb_group_commit_flushed - account a log flush for adaptive group commit
  *
  * return: nothing
  *
- *   lsa_ptr(in): Force all log records up to this lsa
+ *   flush_usec(in): duration of log flush
  *
- * NOTE:Flush the log up to given log sequence address according to the WAL rule.
- *              The page buffer manager must call this function whenever a
- *              page is about to be flushed due to a page replacement.
+ * NOTE: Caller must hold gc_mutex.
  */
 void
-logpb_flush_log_for_wal (THREAD_ENTRY * thread_p, const LOG_LSA * lsa_ptr)
+logpb_group_commit_flushed (THREAD_ENTRY * thread_p, INT64 flush_usec)
 {
-  if (logpb_need_wal (lsa_ptr))
-    {
-      perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_WALS);
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
 
-      LOG_CS_ENTER (thread_p);
+  group_commit_info->avg_flush_usec = LOGPB_GROUP_COMMIT_AVERAGE (group_commit_info->avg_flush_usec, flush_usec);
+
+  if (group_commit_info->waiters > 0)
+    {
+      perfmon_inc_stat (thread_p, PSTAT_LOG_GROUP_COMMIT_FLUSHES);
+      perfmon_add_stat (thread_p, PSTAT_LOG_GROUP_COMMIT_BATCHED, group_commit_info->waiters);
+    }
+}
+
+/*
+ * logpb_add_flush_completion - run a function once the log is flushed up to an LSA
+ *
+ * return: nothing
+ *
+ *   flush_lsa(in): LSA to flush
+ *   func(in): function to run; it may be run by this thread, right away, or by log flush daemon
+ *   arg(in): argument of func
+ *
+ * NOTE: This lets a thread wait for a log flush without blocking.
+ */
+void
+logpb_add_flush_completion (THREAD_ENTRY * thread_p, const LOG_LSA * flush_lsa, LOG_FLUSH_COMPLETION_FUNC func,
+			    void *arg)
+{
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  LOG_FLUSH_COMPLETION *completion;
+  LOG_LSA nxio_lsa;
+
+  assert (flush_lsa != NULL && func != NULL);
+
+  completion = (LOG_FLUSH_COMPLETION *) malloc (sizeof (LOG_FLUSH_COMPLETION));
+  if (completion == NULL)
+    {
+      /* wait for the flush */
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, sizeof (LOG_FLUSH_COMPLETION));
+      logpb_flush_pages (thread_p, (LOG_LSA *) flush_lsa);
+      func (arg);
+      return;
+    }
+
+  pthread_mutex_lock (&group_commit_info->gc_mutex);
+  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+  if (LSA_GE (&nxio_lsa, flush_lsa))
+    {
+      /* already flushed */
+      pthread_mutex_unlock (&group_commit_info->gc_mutex);
+      free_and_init (completion);
+      func (arg);
+      return;
+    }
+
+  LSA_COPY (&completion->flush_lsa, flush_lsa);
+  completion->func = func;
+  completion->arg = arg;
+  completion->next = group_commit_info->completions;
+  group_commit_info->completions = completion;
+  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+
+  log_request_log_flush ();
+}
+
+/*
+ * logpb_run_flush_completions - run the completions whose LSA is flushed
+ *
+ * return: nothing
+ *
+ *   run_all(in): run all completions, when the log is finalized
+ */
+void
+logpb_run_flush_completions (THREAD_ENTRY * thread_p, bool run_all)
+{
+  LOG_GROUP_COMMIT_INFO *group_commit_info = &log_Gl.group_commit_info;
+  LOG_FLUSH_COMPLETION *completion, *next, *flushed = NULL, *pending = NULL;
+  LOG_LSA nxio_lsa;
+
+  pthread_mutex_lock (&group_commit_info->gc_mutex);
+  if (group_commit_info->completions == NULL)
+    {
+      pthread_mutex_unlock (&group_commit_info->gc_mutex);
+      return;
+    }
+
+  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+  for (completion = group_commit_info->completions; completion != NULL; completion = next)
+    {
+      next = completion->next;
+      if (run_all || LSA_GE (&nxio_lsa, &completion->flush_lsa))
+	{
+	  completion->next = flushed;
+	  flushed = completion;
+	}
+      else
+	{
+	  completion->next = pending;
+	  pending = completion;
+	}
+    }
+  group_commit_info->completions = pending;
+  pthread_mutex_unlock (&group_commit_info->gc_mutex);
+
+  if (pending != NULL)
+    {
+      /* added during the flush */
+      log_request_log_flush ();
+    }
+
+  for (completion = flushed; completion != NULL; completion = next)
+    {
+      next = completion->next;
+      completion->func (completion->arg);
+      free_and_init (completion);
+    }
+}
+
+/*
+ * logpb_get_group_commit_target_batch - commits the adaptive group commit expects to batch in one log flush
+ *
+ * return: target batch size
+ */
+int
+logpb_get_group_commit_target_batch (void)
+{
+  return log_Gl.group_commit_info.target_batch;
+}
+
+void
+logpb_force_flush_pages (THREAD_ENTRY * thread_p)
+{
+  LOG_CS_ENTER (thread_p);
+  logpb_flush_pages_direct (thread_p);
+  LOG_CS_EXIT (thread_p);
+}
+
+void
+logpb_force_flush_header_and_pages (THREAD_ENTRY * thread_p)
+{
+  LOG_CS_ENTER (thread_p);
+  logpb_flush_pages_direct (thread_p);
+  logpb_flush_header (thread_p);
+  LOG_CS_EXIT (thread_p);
+}
+
+/*
+ * logpb_invalid_all_append_pages - Invalidate all append pages
+ *
+ * return: nothing
+ *
+ * NOTE:Invalidate and free all append pages. Before invalidating the
+ *              pages if their are dirty, they are flushed.
+ */
+void
+logpb_invalid_all_append_pages (THREAD_ENTRY * thread_p)
+{
+  LOG_FLUSH_INFO *flush_info = &log_Gl.flush_info;
+#if defined(SERVER_MODE)
+  int rv;
+#endif /* SERVER_MODE */
+
+  assert (LOG_CS_OWN_WRITE_MODE (thread_p));
+
+  logpb_log ("called logpb_invalid_all_append_pages\n");
+
+  if (log_Gl.append.log_pgptr != NULL)
+    {
+      /*
+       * Somehow we already have an append page, flush all current append page
+       * and start form scratch
+       */
+      logpb_flush_pages_direct (thread_p);
+      log_Gl.append.log_pgptr = NULL;
+    }
+
+  rv = pthread_mutex_lock (&flush_info->flush_mutex);
+
+  flush_info->num_toflush = 0;
+  flush_info->toflush[flush_info->num_toflush] = NULL;
+
+  pthread_mutex_unlock (&flush_info->flush_mutex);
+}
+
+/*
+ * logpb_flush_log_for_wal - Flush log if needed
+ *
+ * return: nothing
+ *
+ *   lsa_ptr(in): Force all log records up to this lsa
+ *
+ * NOTE:Flush the log up to given log sequence address according to the WAL rule.
+ *              The page buffer manager must call this function whenever a
+ *              page is about to be flushed due to a page replacement.
+ */
+void
+logpb_flush_log_for_wal (THREAD_ENTRY * thread_p, const LOG_LSA * lsa_ptr)
+{
+  if (logpb_need_wal (lsa_ptr))
+    {
+      perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_WALS);
+
+      LOG_CS_ENTER (thread_p);
       if (logpb_need_wal (lsa_ptr))
 	{
 	  logpb_flush_pages_direct (thread_p);
@@ -5269,10 +5890,7 @@ logpb_fetch_from_archive (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_PAGE *
 	  /* Find location of logical page in the archive log */
 	  phy_pageid = (LOG_PHY_PAGEID) (pageid - arv_hdr->fpageid + 1);
 
-	  /* Record number of reads in statistics */
-	  perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_IOREADS);
-
-	  if (fileio_read (thread_p, vdes, log_pgptr, phy_pageid, LOG_PAGESIZE) == NULL)
+	  if (logpb_read_archive_page (thread_p, vdes, arv_hdr, phy_pageid, log_pgptr) != NO_ERROR)
 	    {
 	      /* Error reading archive page */
 	      tmp_arv_name = fileio_get_volume_label_by_fd (vdes, PEEK);
@@ -5293,6 +5911,7 @@ logpb_fetch_from_archive (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_PAGE *
 		  LOG_ARCHIVE_CS_EXIT (thread_p);
 		  return NULL;
 		}
+	      logpb_add_restart_stats (LOG_RV_RESTART_LOG_PAGES_DECRYPTED, 1);
 	    }
 
 	  /* Cast the archive information. May be used again */
@@ -5494,109 +6113,668 @@ logpb_fetch_from_archive (THREAD_ENTRY * thread_p, LOG_PAGEID pageid, LOG_PAGE *
 		    }
 		}
 
-	      switch (retry)
-		{
-		case 0:	/* quit */
-		  logpb_set_unavailable_archive (thread_p, *ret_arv_num);
-		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_NOTIN_ARCHIVE, 1, pageid);
-		  if (is_fatal)
-		    {
-		      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_fetch_from_archive");
-		    }
+	      switch (retry)
+		{
+		case 0:	/* quit */
+		  logpb_set_unavailable_archive (thread_p, *ret_arv_num);
+		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_NOTIN_ARCHIVE, 1, pageid);
+		  if (is_fatal)
+		    {
+		      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_fetch_from_archive");
+		    }
+
+		  LOG_ARCHIVE_CS_EXIT (thread_p);
+
+		  return NULL;
+
+		case 1:	/* Not available */
+		  logpb_set_unavailable_archive (thread_p, *ret_arv_num);
+		  break;
+
+		case 3:	/* Relocate */
+		  fprintf (stdout, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOG, MSGCAT_LOG_NEWLOCATION));
+		  if (fgets (line_buf, PATH_MAX, stdin) == 0 || (sscanf (line_buf, format_string, arv_name) != 1))
+		    {
+		      fileio_make_log_archive_name (arv_name, log_Archive_path, log_Prefix, *ret_arv_num);
+		    }
+		  break;
+
+		case 2:	/* Retry */
+		  break;
+
+		default:	/* Something strange.  Get user to try again. */
+		  fprintf (stdout, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOG, MSGCAT_LOG_INPUT_RANGE_ERROR),
+			   0, 3);
+		  goto retry_prompt;
+		}
+	    }
+
+	  if (vdes != NULL_VOLDES)
+	    {
+	      /* Read header page and make sure the page is here */
+
+	      /* Record number of reads in statistics */
+	      perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_IOREADS);
+
+	      if (fileio_read (thread_p, vdes, hdr_pgptr, 0, LOG_PAGESIZE) == NULL)
+		{
+		  fileio_dismount (thread_p, vdes);
+		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_READ, 3, 0LL, 0LL, arv_name);
+
+		  LOG_ARCHIVE_CS_EXIT (thread_p);
+
+		  return NULL;
+		}
+	      arv_hdr = (LOG_ARV_HEADER *) hdr_pgptr->area;
+	      if (log_Gl.append.vdes != NULL_VOLDES)
+		{
+		  if (difftime64 ((time_t) arv_hdr->db_creation, (time_t) log_Gl.hdr.db_creation) != 0)
+		    {
+		      /*
+		       * This volume does not belong to the database. For now, assume
+		       * that it is not only. Later, we will give this error to user
+		       */
+		      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_DOESNT_CORRESPOND_TO_DATABASE, 1,
+			      arv_name);
+		      arv_hdr = NULL;
+		    }
+		}
+	    }
+	  else
+	    {
+	      arv_hdr = NULL;
+	    }
+	}
+    }
+
+#if defined(CUBRID_DEBUG)
+  if (log_pgptr->hdr.logical_pageid != pageid)
+    {
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1, pageid);
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_fetch_from_archive");
+
+      LOG_ARCHIVE_CS_EXIT (thread_p);
+
+      return NULL;
+    }
+#endif /* CUBRID_DEBUG */
+
+#if !defined (NDEBUG)
+  /* In analysys phase, the page may be corrupted. */
+  if (log_Gl.rcv_phase == LOG_RESTARTED)
+    {
+      logpb_debug_check_log_page (thread_p, log_pgptr);
+    }
+#endif /* !NDEBUG */
+
+  assert (log_pgptr != NULL && *ret_arv_num != -1 && arv_hdr != NULL);
+  if (ret_arv_hdr != NULL)
+    {
+      *ret_arv_hdr = *arv_hdr;
+    }
+
+  LOG_ARCHIVE_CS_EXIT (thread_p);
+
+  return log_pgptr;
+}
+
+/*
+ * logpb_arv_zip_index_npages - number of pages of the group index of a compressed archive
+ *
+ * return: number of pages
+ *
+ *   arv_hdr(in): archive header
+ */
+static int
+logpb_arv_zip_index_npages (const LOG_ARV_HEADER * arv_hdr)
+{
+  assert (LOGPB_ARV_IS_COMPRESSED (arv_hdr));
+
+  return (int) CEIL_PTVDIV (LOGPB_ARV_NUM_GROUPS (arv_hdr) * sizeof (LOGPB_ARV_ZIP_INDEX_ENTRY), LOG_PAGESIZE);
+}
+
+/*
+ * logpb_arv_zip_write - write the pages of a compressed archive, its header page excepted
+ *
+ * return: error code
+ *
+ *   vdes(in): archive volume descriptor
+ *   arv_hdr(in): archive header
+ *   arv_name(in): archive name
+ */
+static int
+logpb_arv_zip_write (THREAD_ENTRY * thread_p, int vdes, const LOG_ARV_HEADER * arv_hdr, const char *arv_name)
+{
+  int num_groups = LOGPB_ARV_NUM_GROUPS (arv_hdr);
+  int index_npages = logpb_arv_zip_index_npages (arv_hdr);
+  LOGPB_ARV_ZIP_INDEX_ENTRY *index = NULL;
+  char *group_buf = NULL, *zip_buf = NULL;
+  int group_size = arv_hdr->zip_npages_per_group * LOG_PAGESIZE;
+  int zip_buf_size = (int) CEIL_PTVDIV (LZ4_compressBound (group_size), LOG_PAGESIZE) * LOG_PAGESIZE;
+  LOG_PHY_PAGEID phy_pageid = 1 + index_npages;
+  LOG_PAGEID pageid, group_last_pageid;
+  int group, num_pages, group_npages, zip_length, zip_npages;
+  int error_code = NO_ERROR;
+
+  index = (LOGPB_ARV_ZIP_INDEX_ENTRY *) malloc ((size_t) index_npages * LOG_PAGESIZE);
+  group_buf = (char *) malloc (group_size);
+  zip_buf = (char *) malloc (zip_buf_size);
+  if (index == NULL || group_buf == NULL || zip_buf == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) zip_buf_size);
+      error_code = ER_OUT_OF_VIRTUAL_MEMORY;
+      goto end;
+    }
+  memset (index, 0, (size_t) index_npages * LOG_PAGESIZE);
+
+  for (group = 0; group < num_groups; group++)
+    {
+      /* read the pages of group from active log */
+      pageid = arv_hdr->fpageid + (LOG_PAGEID) group * arv_hdr->zip_npages_per_group;
+      group_last_pageid = MIN (pageid + arv_hdr->zip_npages_per_group, arv_hdr->fpageid + arv_hdr->npages) - 1;
+      group_npages = (int) (group_last_pageid - pageid + 1);
+      for (num_pages = 0; pageid <= group_last_pageid; pageid += num_pages)
+	{
+	  num_pages = (int) MIN (LOGPB_IO_NPAGES, group_last_pageid - pageid + 1);
+	  num_pages = logpb_read_page_from_active_log (thread_p, pageid, num_pages, false,
+						       (LOG_PAGE *) (group_buf + (pageid - group_last_pageid
+										  + group_npages - 1) * LOG_PAGESIZE));
+	  if (num_pages <= 0)
+	    {
+	      error_code = ER_FAILED;
+	      goto end;
+	    }
+	}
+
+      zip_length = LZ4_compress_default (group_buf, zip_buf, group_npages * LOG_PAGESIZE, zip_buf_size);
+      if (zip_length <= 0)
+	{
+	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_WRITE, 3, pageid, phy_pageid, arv_name);
+	  error_code = ER_LOG_WRITE;
+	  goto end;
+	}
+      zip_npages = (int) CEIL_PTVDIV (zip_length, LOG_PAGESIZE);
+      memset (zip_buf + zip_length, 0, zip_npages * LOG_PAGESIZE - zip_length);
+
+      if (fileio_write_pages (thread_p, vdes, zip_buf, phy_pageid, zip_npages, LOG_PAGESIZE,
+			      FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+	{
+	  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_WRITE, 3, pageid, phy_pageid, arv_name);
+	  error_code = ER_LOG_WRITE;
+	  goto end;
+	}
+
+      index[group].phy_pageid = (INT32) phy_pageid;
+      index[group].zip_length = zip_length;
+      phy_pageid += zip_npages;
+    }
+
+  if (fileio_write_pages (thread_p, vdes, (char *) index, 1, index_npages, LOG_PAGESIZE,
+			  FILEIO_WRITE_NO_COMPENSATE_WRITE) == NULL)
+    {
+      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_WRITE, 3, arv_hdr->fpageid, 1LL, arv_name);
+      error_code = ER_LOG_WRITE;
+      goto end;
+    }
+
+  log_archive_er_log ("logpb_arv_zip_write, %d pages compressed into %lld pages\n", arv_hdr->npages,
+		      (long long int) phy_pageid - 1);
+
+end:
+  if (index != NULL)
+    {
+      free_and_init (index);
+    }
+  if (group_buf != NULL)
+    {
+      free_and_init (group_buf);
+    }
+  if (zip_buf != NULL)
+    {
+      free_and_init (zip_buf);
+    }
+
+  return error_code;
+}
+
+/*
+ * logpb_arv_load_group - read a group of pages of an archive
+ *
+ * return: error code
+ *
+ *   vdes(in): archive volume descriptor
+ *   arv_hdr(in): archive header
+ *   group(in): group to load
+ *   arv_group(out): the group of pages
+ */
+static int
+logpb_arv_load_group (THREAD_ENTRY * thread_p, int vdes, const LOG_ARV_HEADER * arv_hdr, int group,
+		      LOGPB_ARV_GROUP * arv_group)
+{
+  char index_pgbuf[IO_MAX_PAGE_SIZE + MAX_ALIGNMENT], *aligned_index_pgbuf;
+  LOGPB_ARV_ZIP_INDEX_ENTRY entry;
+  int entries_per_page = LOG_PAGESIZE / sizeof (LOGPB_ARV_ZIP_INDEX_ENTRY);
+  int group_size = LOGPB_ARV_GROUP_SIZE (arv_hdr);
+  int group_npages, zip_npages, unzip_length;
+  char *zip_buf = NULL;
+  int error_code = NO_ERROR;
+
+  assert (group >= 0 && group < LOGPB_ARV_NUM_GROUPS (arv_hdr));
+
+  arv_group->npages = 0;
+  if (group_size > LOGPB_ARV_GROUP_NPAGES)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1, arv_hdr->fpageid);
+      return ER_LOG_PAGE_CORRUPTED;
+    }
+
+  if (arv_group->pages == NULL)
+    {
+      arv_group->pages = (char *) malloc ((size_t) LOGPB_ARV_GROUP_NPAGES * LOG_PAGESIZE);
+      if (arv_group->pages == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+		  (size_t) LOGPB_ARV_GROUP_NPAGES * LOG_PAGESIZE);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+    }
+
+  group_npages = MIN (group_size, arv_hdr->npages - group * group_size);
+
+  if (!LOGPB_ARV_IS_COMPRESSED (arv_hdr))
+    {
+      /* the pages of group are stored in sequence after the header page */
+      perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_IOREADS);
+      if (fileio_read_pages (thread_p, vdes, arv_group->pages, 1 + (LOG_PHY_PAGEID) group * group_size, group_npages,
+			     LOG_PAGESIZE) == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+    }
+  else
+    {
+      /* find the group in index */
+      aligned_index_pgbuf = PTR_ALIGN (index_pgbuf, MAX_ALIGNMENT);
+      perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_IOREADS);
+      if (fileio_read (thread_p, vdes, aligned_index_pgbuf, 1 + group / entries_per_page, LOG_PAGESIZE) == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  return error_code;
+	}
+      entry = ((LOGPB_ARV_ZIP_INDEX_ENTRY *) aligned_index_pgbuf)[group % entries_per_page];
+      if (entry.phy_pageid <= 0 || entry.zip_length <= 0)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1, arv_hdr->fpageid);
+	  return ER_LOG_PAGE_CORRUPTED;
+	}
+
+      zip_npages = (int) CEIL_PTVDIV (entry.zip_length, LOG_PAGESIZE);
+      zip_buf = (char *) malloc ((size_t) zip_npages * LOG_PAGESIZE);
+      if (zip_buf == NULL)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1, (size_t) zip_npages * LOG_PAGESIZE);
+	  return ER_OUT_OF_VIRTUAL_MEMORY;
+	}
+
+      perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_IOREADS);
+      if (fileio_read_pages (thread_p, vdes, zip_buf, entry.phy_pageid, zip_npages, LOG_PAGESIZE) == NULL)
+	{
+	  ASSERT_ERROR_AND_SET (error_code);
+	  free_and_init (zip_buf);
+	  return error_code;
+	}
+
+      unzip_length = LZ4_decompress_safe (zip_buf, arv_group->pages, entry.zip_length, group_npages * LOG_PAGESIZE);
+      free_and_init (zip_buf);
+      if (unzip_length != group_npages * LOG_PAGESIZE)
+	{
+	  er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1,
+		  arv_hdr->fpageid + (LOG_PAGEID) group * group_size);
+	  return ER_LOG_PAGE_CORRUPTED;
+	}
+    }
+
+  arv_group->arv_num = arv_hdr->arv_num;
+  arv_group->fpageid = arv_hdr->fpageid;
+  arv_group->group = group;
+  arv_group->npages = group_npages;
+
+  return NO_ERROR;
+}
+
+/*
+ * logpb_arv_group_is_loaded - is the group of the archive loaded?
+ *
+ * return: true if loaded
+ *
+ *   arv_group(in): group of pages
+ *   arv_hdr(in): archive header
+ *   group(in): group
+ */
+static bool
+logpb_arv_group_is_loaded (const LOGPB_ARV_GROUP * arv_group, const LOG_ARV_HEADER * arv_hdr, int group)
+{
+  return (arv_group->npages > 0 && arv_group->arv_num == arv_hdr->arv_num && arv_group->fpageid == arv_hdr->fpageid
+	  && arv_group->group == group);
+}
+
+/*
+ * logpb_arv_find_group - find a group of an archive in the cache of archive pages
+ *
+ * return: cached group or NULL
+ *
+ *   arv_hdr(in): archive header
+ *   group(in): group
+ */
+static LOGPB_ARV_GROUP *
+logpb_arv_find_group (const LOG_ARV_HEADER * arv_hdr, int group)
+{
+  int i;
+
+  for (i = 0; i < LOGPB_ARV_CACHE_NGROUPS; i++)
+    {
+      if (logpb_arv_group_is_loaded (&logpb_Arv_reader.groups[i], arv_hdr, group))
+	{
+	  return &logpb_Arv_reader.groups[i];
+	}
+    }
+
+  return NULL;
+}
+
+/*
+ * logpb_arv_victim_group - the cached group to replace, an empty one or else the least recently used
+ *
+ * return: group
+ */
+static LOGPB_ARV_GROUP *
+logpb_arv_victim_group (void)
+{
+  LOGPB_ARV_GROUP *victim = &logpb_Arv_reader.groups[0];
+  int i;
+
+  for (i = 0; i < LOGPB_ARV_CACHE_NGROUPS; i++)
+    {
+      if (logpb_Arv_reader.groups[i].npages == 0)
+	{
+	  return &logpb_Arv_reader.groups[i];
+	}
+      if (logpb_Arv_reader.groups[i].last_used < victim->last_used)
+	{
+	  victim = &logpb_Arv_reader.groups[i];
+	}
+    }
+
+  return victim;
+}
+
+/*
+ * logpb_read_archive_page - read a page of an archive
+ *
+ * return: error code
+ *
+ *   vdes(in): archive volume descriptor
+ *   arv_hdr(in): archive header
+ *   phy_pageid(in): physical page of the page in a not compressed archive
+ *   log_pgptr(out): the page, as it is in the archive
+ *
+ * NOTE: Caller must hold log archive critical section.
+ */
+static int
+logpb_read_archive_page (THREAD_ENTRY * thread_p, int vdes, const LOG_ARV_HEADER * arv_hdr,
+			 LOG_PHY_PAGEID phy_pageid, LOG_PAGE * log_pgptr)
+{
+  LOGPB_ARV_READER *reader = &logpb_Arv_reader;
+  LOGPB_ARV_GROUP *arv_group;
+  int group_size = LOGPB_ARV_GROUP_SIZE (arv_hdr);
+  int group;
+  bool is_forward, is_backward;
+  int error_code;
+
+  group = (int) ((phy_pageid - 1) / group_size);
+  arv_group = logpb_arv_find_group (arv_hdr, group);
+  if (arv_group == NULL)
+    {
+      is_forward = (reader->last_arv_num == arv_hdr->arv_num && reader->last_group + 1 == group);
+      is_backward = (reader->last_arv_num == arv_hdr->arv_num && reader->last_group - 1 == group);
 
-		  LOG_ARCHIVE_CS_EXIT (thread_p);
+      arv_group = logpb_arv_victim_group ();
+#if defined (SERVER_MODE)
+      if (!logpb_arv_take_read_ahead (arv_hdr, group, arv_group))
+#endif /* SERVER_MODE */
+	{
+	  error_code = logpb_arv_load_group (thread_p, vdes, arv_hdr, group, arv_group);
+	  if (error_code != NO_ERROR)
+	    {
+	      return error_code;
+	    }
+	}
 
-		  return NULL;
+#if defined (SERVER_MODE)
+      if (is_forward || is_backward)
+	{
+	  logpb_arv_start_read_ahead (arv_hdr, is_forward ? group + 1 : group - 1);
+	}
+#endif /* SERVER_MODE */
+    }
 
-		case 1:	/* Not available */
-		  logpb_set_unavailable_archive (thread_p, *ret_arv_num);
-		  break;
+  arv_group->last_used = ++reader->use_count;
+  reader->last_arv_num = arv_hdr->arv_num;
+  reader->last_group = group;
 
-		case 3:	/* Relocate */
-		  fprintf (stdout, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOG, MSGCAT_LOG_NEWLOCATION));
-		  if (fgets (line_buf, PATH_MAX, stdin) == 0 || (sscanf (line_buf, format_string, arv_name) != 1))
-		    {
-		      fileio_make_log_archive_name (arv_name, log_Archive_path, log_Prefix, *ret_arv_num);
-		    }
-		  break;
+  memcpy (log_pgptr, arv_group->pages + ((phy_pageid - 1) % group_size) * LOG_PAGESIZE, LOG_PAGESIZE);
 
-		case 2:	/* Retry */
-		  break;
+  return NO_ERROR;
+}
 
-		default:	/* Something strange.  Get user to try again. */
-		  fprintf (stdout, msgcat_message (MSGCAT_CATALOG_CUBRID, MSGCAT_SET_LOG, MSGCAT_LOG_INPUT_RANGE_ERROR),
-			   0, 3);
-		  goto retry_prompt;
-		}
-	    }
+/*
+ * logpb_archive_read_ahead - read ahead the archive pages around pageid, so they are cached when needed
+ *
+ * return: nothing
+ *
+ *   pageid(in): logical page expected to be read soon
+ *
+ * NOTE: Only the archive in use is read ahead, and only in server mode. It is only a hint: the pages are read
+ *       anyway when fetched.
+ */
+void
+logpb_archive_read_ahead (THREAD_ENTRY * thread_p, LOG_PAGEID pageid)
+{
+#if defined (SERVER_MODE)
+  const LOG_ARV_HEADER *arv_hdr = &log_Gl.archive.hdr;
+  int group;
 
-	  if (vdes != NULL_VOLDES)
-	    {
-	      /* Read header page and make sure the page is here */
+  if (!logpb_is_page_in_archive (pageid))
+    {
+      return;
+    }
 
-	      /* Record number of reads in statistics */
-	      perfmon_inc_stat (thread_p, PSTAT_LOG_NUM_IOREADS);
+  LOG_ARCHIVE_CS_ENTER (thread_p);
+  if (log_Gl.archive.vdes != NULL_VOLDES && pageid >= arv_hdr->fpageid
+      && pageid <= arv_hdr->fpageid + arv_hdr->npages - 1)
+    {
+      group = (int) ((pageid - arv_hdr->fpageid) / LOGPB_ARV_GROUP_SIZE (arv_hdr));
+      if (logpb_arv_find_group (arv_hdr, group) == NULL)
+	{
+	  logpb_arv_start_read_ahead (arv_hdr, group);
+	}
+    }
+  LOG_ARCHIVE_CS_EXIT (thread_p);
+#endif /* SERVER_MODE */
+}
 
-	      if (fileio_read (thread_p, vdes, hdr_pgptr, 0, LOG_PAGESIZE) == NULL)
-		{
-		  fileio_dismount (thread_p, vdes);
-		  er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_READ, 3, 0LL, 0LL, arv_name);
+#if defined (SERVER_MODE)
+/*
+ * logpb_arv_take_read_ahead - take the group read ahead, if it is the one needed
+ *
+ * return: true if the group was taken
+ *
+ *   arv_hdr(in): archive header
+ *   group(in): the group needed
+ *   arv_group(in/out): cached group replaced by the group read ahead
+ */
+static bool
+logpb_arv_take_read_ahead (const LOG_ARV_HEADER * arv_hdr, int group, LOGPB_ARV_GROUP * arv_group)
+{
+  LOGPB_ARV_READER *reader = &logpb_Arv_reader;
+  LOGPB_ARV_GROUP swap_group;
 
-		  LOG_ARCHIVE_CS_EXIT (thread_p);
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (reader->mutex);
+  // *INDENT-ON*
 
-		  return NULL;
-		}
-	      arv_hdr = (LOG_ARV_HEADER *) hdr_pgptr->area;
-	      if (log_Gl.append.vdes != NULL_VOLDES)
-		{
-		  if (difftime64 ((time_t) arv_hdr->db_creation, (time_t) log_Gl.hdr.db_creation) != 0)
-		    {
-		      /*
-		       * This volume does not belong to the database. For now, assume
-		       * that it is not only. Later, we will give this error to user
-		       */
-		      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_DOESNT_CORRESPOND_TO_DATABASE, 1,
-			      arv_name);
-		      arv_hdr = NULL;
-		    }
-		}
-	    }
-	  else
-	    {
-	      arv_hdr = NULL;
-	    }
+  if (reader->is_next_loading)
+    {
+      if (reader->next.arv_num != arv_hdr->arv_num || reader->next.fpageid != arv_hdr->fpageid
+	  || reader->next.group != group)
+	{
+	  return false;
 	}
+
+      // *INDENT-OFF*
+      reader->cond.wait (ulock, [reader] { return !reader->is_next_loading; });
+      // *INDENT-ON*
     }
 
-#if defined(CUBRID_DEBUG)
-  if (log_pgptr->hdr.logical_pageid != pageid)
+  if (!logpb_arv_group_is_loaded (&reader->next, arv_hdr, group))
     {
-      er_set (ER_FATAL_ERROR_SEVERITY, ARG_FILE_LINE, ER_LOG_PAGE_CORRUPTED, 1, pageid);
-      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_fetch_from_archive");
+      return false;
+    }
 
-      LOG_ARCHIVE_CS_EXIT (thread_p);
+  swap_group = *arv_group;
+  *arv_group = reader->next;
+  reader->next = swap_group;
+  reader->next.npages = 0;
 
-      return NULL;
+  return true;
+}
+
+/*
+ * logpb_arv_start_read_ahead - start reading a group ahead, unless a worker already is
+ *
+ * return: nothing
+ *
+ *   arv_hdr(in): archive header
+ *   group(in): the group to read
+ */
+static void
+logpb_arv_start_read_ahead (const LOG_ARV_HEADER * arv_hdr, int group)
+{
+  LOGPB_ARV_READER *reader = &logpb_Arv_reader;
+
+  if (group < 0 || group >= LOGPB_ARV_NUM_GROUPS (arv_hdr) || logpb_arv_find_group (arv_hdr, group) != NULL)
+    {
+      /* the next archive is read ahead when it is first read in sequence */
+      return;
     }
-#endif /* CUBRID_DEBUG */
 
-#if !defined (NDEBUG)
-  /* In analysys phase, the page may be corrupted. */
-  if (log_Gl.rcv_phase == LOG_RESTARTED)
+  if (reader->read_ahead_pool == NULL)
     {
-      logpb_debug_check_log_page (thread_p, log_pgptr);
+      reader->read_ahead_pool =
+	thread_get_manager ()->create_worker_pool (1, 1, "log_archive_read_ahead", NULL, 1, false);
+      if (reader->read_ahead_pool == NULL)
+	{
+	  /* not fatal, groups are read when needed */
+	  return;
+	}
     }
-#endif /* !NDEBUG */
 
-  assert (log_pgptr != NULL && *ret_arv_num != -1 && arv_hdr != NULL);
-  if (ret_arv_hdr != NULL)
+  {
+    // *INDENT-OFF*
+    std::unique_lock<std::mutex> ulock (reader->mutex);
+    // *INDENT-ON*
+
+    if (reader->is_next_loading || logpb_arv_group_is_loaded (&reader->next, arv_hdr, group))
+      {
+	return;
+      }
+
+    reader->next_arv_hdr = *arv_hdr;
+    reader->next.arv_num = arv_hdr->arv_num;
+    reader->next.fpageid = arv_hdr->fpageid;
+    reader->next.group = group;
+    reader->next.npages = 0;
+    reader->is_next_loading = true;
+  }
+
+  thread_get_manager ()->push_task (reader->read_ahead_pool,
+				    new cubthread::entry_callable_task (logpb_arv_read_ahead_execute));
+}
+
+/*
+ * logpb_arv_read_ahead_execute - read the group requested by logpb_arv_start_read_ahead
+ *
+ * return: nothing
+ *
+ *   thread_ref(in): thread entry
+ *
+ * NOTE: The archive is opened again, since the reader may dismount it meanwhile. Errors are not reported: the reader
+ *       finds the group is not loaded and loads it itself.
+ */
+static void
+logpb_arv_read_ahead_execute (cubthread::entry & thread_ref)
+{
+  LOGPB_ARV_READER *reader = &logpb_Arv_reader;
+  char arv_name[PATH_MAX];
+  int vdes;
+
+  fileio_make_log_archive_name (arv_name, log_Archive_path, log_Prefix, reader->next_arv_hdr.arv_num);
+  vdes = fileio_open (arv_name, O_RDONLY, 0);
+  if (vdes != NULL_VOLDES)
     {
-      *ret_arv_hdr = *arv_hdr;
+      if (logpb_arv_load_group (&thread_ref, vdes, &reader->next_arv_hdr, reader->next.group, &reader->next)
+	  != NO_ERROR)
+	{
+	  reader->next.npages = 0;
+	}
+      fileio_close (vdes);
     }
+  er_clear ();
 
-  LOG_ARCHIVE_CS_EXIT (thread_p);
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (reader->mutex);
+  // *INDENT-ON*
+  reader->is_next_loading = false;
+  reader->cond.notify_all ();
+}
+#endif /* SERVER_MODE */
 
-  return log_pgptr;
+/*
+ * logpb_arv_reader_finalize - free the cache of archive pages
+ *
+ * return: nothing
+ */
+static void
+logpb_arv_reader_finalize (void)
+{
+  LOGPB_ARV_READER *reader = &logpb_Arv_reader;
+  int i;
+
+#if defined (SERVER_MODE)
+  if (reader->read_ahead_pool != NULL)
+    {
+      /* waits for the worker to finish */
+      thread_get_manager ()->destroy_worker_pool (reader->read_ahead_pool);
+      reader->read_ahead_pool = NULL;
+    }
+  reader->is_next_loading = false;
+  reader->next.npages = 0;
+  if (reader->next.pages != NULL)
+    {
+      free_and_init (reader->next.pages);
+    }
+#endif /* SERVER_MODE */
+
+  for (i = 0; i < LOGPB_ARV_CACHE_NGROUPS; i++)
+    {
+      reader->groups[i].npages = 0;
+      if (reader->groups[i].pages != NULL)
+	{
+	  free_and_init (reader->groups[i].pages);
+	}
+    }
+  reader->last_arv_num = -1;
 }
 
 /*
@@ -5625,6 +6803,7 @@ logpb_archive_active_log (THREAD_ENTRY * thread_p)
   int error_code = NO_ERROR;
   int num_pages = 0;
   FILEIO_WRITE_MODE write_mode;
+  bool is_compressed;
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
@@ -5693,6 +6872,11 @@ logpb_archive_active_log (THREAD_ENTRY * thread_p)
 
   arvhdr->npages = (DKNPAGES) (last_pageid - arvhdr->fpageid + 1);
 
+  /* the archive is compressed at once, so background archiving, which copies the pages as they are, must be off */
+  is_compressed = (prm_get_bool_value (PRM_ID_LOG_ARCHIVE_COMPRESS)
+		   && !prm_get_bool_value (PRM_ID_LOG_BACKGROUND_ARCHIVING));
+  arvhdr->zip_npages_per_group = is_compressed ? LOGPB_ARV_GROUP_NPAGES : 0;
+
   /*
    * Now create the archive and start copying pages
    */
@@ -5707,7 +6891,9 @@ logpb_archive_active_log (THREAD_ENTRY * thread_p)
     }
   else
     {
-      vdes = fileio_format (thread_p, log_Db_fullname, arv_name, LOG_DBLOG_ARCHIVE_VOLID, arvhdr->npages + 1, false,
+      /* a compressed archive grows as its groups are written */
+      vdes = fileio_format (thread_p, log_Db_fullname, arv_name, LOG_DBLOG_ARCHIVE_VOLID,
+			    is_compressed ? 1 + logpb_arv_zip_index_npages (arvhdr) : arvhdr->npages + 1, false,
 			    false, false, LOG_PAGESIZE, 0, false);
       if (vdes == NULL_VOLDES)
 	{
@@ -5750,6 +6936,17 @@ logpb_archive_active_log (THREAD_ENTRY * thread_p)
 
   log_pgptr = (LOG_PAGE *) aligned_log_pgbuf;
 
+  if (is_compressed)
+    {
+      assert (pageid == arvhdr->fpageid);
+      if (logpb_arv_zip_write (thread_p, vdes, arvhdr, arv_name) != NO_ERROR)
+	{
+	  goto error;
+	}
+      /* all pages are written */
+      pageid = last_pageid + 1;
+    }
+
   /* Now start dumping the current active pages to archive */
   for (; pageid <= last_pageid; pageid += num_pages, ar_phy_pageid += num_pages)
     {
@@ -7835,8 +9032,15 @@ loop:
 
   /* Begin backing up in earnest */
   assert (!skip_activelog);
+  pgtrack_start_backup (backup_level);
   session.bkup.bkuphdr->skip_activelog = skip_activelog;
 
+  if (tde_Cipher.is_loaded)
+    {
+      /* record the key information for restore to check the keys file without decrypting any page */
+      logpb_backup_set_tde_keyinfo (thread_p, session.bkup.bkuphdr);
+    }
+
   if (fileio_start_backup (thread_p, log_Db_fullname, &log_Gl.hdr.db_creation, backup_level, &bkup_start_lsa,
 			   &chkpt_lsa, all_bkup_info, &session, zip_method, zip_level) == NULL)
     {
@@ -8041,6 +9245,7 @@ loop:
       LSA_COPY (&log_Gl.hdr.bkup_level2_lsa, &chkpt_lsa);
       break;
     }
+  pgtrack_end_backup (backup_level, true);
 
   /* Now indicate how many volumes were backed up */
   logpb_flush_header (thread_p);
@@ -8126,6 +9331,7 @@ error:
    * Destroy the backup that has been created.
    */
   fileio_abort_backup (thread_p, &session, bkup_in_progress);
+  pgtrack_end_backup (backup_level, false);
 
 #if defined(SERVER_MODE)
   LOG_CS_ENTER (thread_p);
@@ -8184,6 +9390,63 @@ logpb_update_backup_volume_info (const char *bkupinfo_file_name)
   return error_code;
 }
 
+/*
+ * logpb_backup_set_tde_keyinfo - Record the TDE key information on the backup header
+ *
+ * return: nothing
+ *
+ *   backup_header(in/out): backup header to be written
+ *
+ * NOTE: It is left unknown (tde_mk_index = -1) if the key information cannot be read.
+ */
+static void
+logpb_backup_set_tde_keyinfo (THREAD_ENTRY * thread_p, FILEIO_BACKUP_HEADER * backup_header)
+{
+  TDE_KEYINFO keyinfo;
+
+  assert (sizeof (backup_header->tde_mk_hash) == sizeof (keyinfo.mk_hash));
+
+  if (tde_get_keyinfo (thread_p, &keyinfo) != NO_ERROR)
+    {
+      er_clear ();
+      return;
+    }
+
+  backup_header->tde_mk_index = keyinfo.mk_index;
+  backup_header->tde_dk_perm_gen = keyinfo.dk_perm_gen;
+  backup_header->tde_mk_created_time = (INT64) keyinfo.created_time;
+  memcpy (backup_header->tde_mk_hash, keyinfo.mk_hash, sizeof (backup_header->tde_mk_hash));
+}
+
+/*
+ * logpb_restore_check_tde_keys_file - Check if a keys file has the master key recorded on the backup header
+ *
+ * return: NO_ERROR if the keys file has the master key or the backup has no key information, error code otherwise
+ *
+ *   keys_vdes(in): descriptor of the keys file
+ *   backup_header(in): backup header read
+ */
+static int
+logpb_restore_check_tde_keys_file (int keys_vdes, const FILEIO_BACKUP_HEADER * backup_header)
+{
+  TDE_KEYINFO keyinfo;
+  unsigned char master_key[TDE_MASTER_KEY_LENGTH];
+
+  if (backup_header->tde_mk_index < 0)
+    {
+      /* backed up by an older version or without the TDE module */
+      return NO_ERROR;
+    }
+
+  memset (&keyinfo, 0, sizeof (keyinfo));
+  keyinfo.mk_index = backup_header->tde_mk_index;
+  keyinfo.created_time = (time_t) backup_header->tde_mk_created_time;
+  memcpy (keyinfo.mk_hash, backup_header->tde_mk_hash, sizeof (keyinfo.mk_hash));
+
+  /* it finds the master key by the index and checks it with the hash and the creation time */
+  return tde_load_mk (keys_vdes, &keyinfo, master_key);
+}
+
 /*
  * logpb_check_stop_at_time - Check if the stopat time is valid
  *
@@ -8287,6 +9550,7 @@ logpb_restore (THREAD_ENTRY * thread_p, const char *db_fullname, const char *log
   char time_val[CTIME_MAX];
   int loop_cnt = 0;
   char tmp_logfiles_from_backup[PATH_MAX];
+  char page_track_name[PATH_MAX];
   char bk_mk_path[PATH_MAX];
   char bkpath_without_units[PATH_MAX];
   char backup_dir_path[PATH_MAX];
@@ -8335,6 +9599,13 @@ logpb_restore (THREAD_ENTRY * thread_p, const char *db_fullname, const char *log
 
   nopath_name = fileio_get_base_file_name (db_fullname);
 
+  /* The pages changed since the last backups are not known for the restored volumes. */
+  fileio_make_backup_page_track_name (page_track_name, db_fullname);
+  if (fileio_is_volume_exist (page_track_name))
+    {
+      fileio_unformat (thread_p, page_track_name);
+    }
+
   /* The enum type can be negative in Windows. */
   while (success == NO_ERROR && try_level >= FILEIO_BACKUP_FULL_LEVEL && try_level < FILEIO_BACKUP_UNDEFINED_LEVEL)
     {
@@ -8549,6 +9820,16 @@ logpb_restore (THREAD_ENTRY * thread_p, const char *db_fullname, const char *log
 		  goto error;
 		}
 
+	      /* The master key of the database at backup time has to be in the keys file given. */
+	      error_code = logpb_restore_check_tde_keys_file (vdes, session->bkup.bkuphdr);
+	      if (error_code != NO_ERROR)
+		{
+		  fileio_dismount (thread_p, vdes);
+		  LOG_CS_EXIT (thread_p);
+		  error_expected = true;
+		  goto error;
+		}
+
 	      fileio_dismount (thread_p, vdes);
 	    }
 	}
@@ -10230,8 +11511,25 @@ logpb_delete (THREAD_ENTRY * thread_p, VOLID num_perm_vols, const char *db_fulln
   tde_make_keys_file_fullname (vol_fullname, db_fullname, true);
   fileio_unformat (thread_p, vol_fullname);
 
-  /* Destroy DWB, if still exists. */
-  fileio_make_dwb_name (vol_fullname, log_Path, log_Prefix);
+  /* Destroy DWB instances, if still exist. */
+  for (i = 0; i < DWB_MAX_INSTANCES; i++)
+    {
+      fileio_make_dwb_instance_name (vol_fullname, log_Path, log_Prefix, i);
+      if (fileio_is_volume_exist (vol_fullname))
+	{
+	  fileio_unformat (thread_p, vol_fullname);
+	}
+    }
+
+  /* Destroy the page buffer warm-up file, if exists. */
+  fileio_make_pgbuf_warmup_name (vol_fullname, db_fullname);
+  if (fileio_is_volume_exist (vol_fullname))
+    {
+      fileio_unformat (thread_p, vol_fullname);
+    }
+
+  /* Destroy the changed page tracking file, if exists. */
+  fileio_make_backup_page_track_name (vol_fullname, db_fullname);
   if (fileio_is_volume_exist (vol_fullname))
     {
       fileio_unformat (thread_p, vol_fullname);
@@ -10774,6 +12072,9 @@ logpb_finalize_writer_info (void)
 
       pthread_mutex_destroy (&writer_info->flush_end_mutex);
       pthread_cond_destroy (&writer_info->flush_end_cond);
+
+      pthread_mutex_destroy (&writer_info->ack_mutex);
+      pthread_cond_destroy (&writer_info->ack_cond);
     }
 
   return;
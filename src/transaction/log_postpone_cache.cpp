@@ -26,6 +26,7 @@
 #include "memory_private_allocator.hpp"
 #include "object_representation.h"
 #include "log_manager.h"
+#include "system_parameter.h"
 
 #include <cstring>
 
@@ -34,11 +35,16 @@ log_postpone_cache::reset ()
 {
   m_cursor = 0;
   m_redo_data_offset = 0;
-  m_is_redo_data_buf_full = false;
+  m_is_full = false;
   if (m_redo_data_buf.get_size () > BUFFER_RESET_SIZE)
     {
       m_redo_data_buf.freemem ();
     }
+  if (m_cache_entries.capacity () > ENTRIES_RESET_COUNT)
+    {
+      // give back the memory of a big transaction
+      std::vector<cache_entry> ().swap (m_cache_entries);
+    }
 }
 
 /**
@@ -52,7 +58,7 @@ log_postpone_cache::add_redo_data (const log_prior_node &node)
 {
   assert (node.data_header != NULL);
   assert (node.rlength == 0 || node.rdata != NULL);
-  assert (m_cursor <= MAX_CACHE_ENTRIES);
+  assert (m_cursor <= m_cache_entries.size ());
 
   if (is_full ())
     {
@@ -60,13 +66,13 @@ log_postpone_cache::add_redo_data (const log_prior_node &node)
       return;
     }
 
-  // Check if recovery data fits in preallocated buffer
+  // Check if the entry and its recovery data fit in cache size
   std::size_t redo_data_size = sizeof (log_rec_redo) + node.rlength + (2 * MAX_ALIGNMENT);
   std::size_t total_size = redo_data_size + m_redo_data_offset;
-  if (total_size > REDO_DATA_MAX_SIZE)
+  if (total_size + (m_cursor + 1) * sizeof (cache_entry) > get_max_size ())
     {
       // Cannot store all recovery data
-      m_is_redo_data_buf_full = true;
+      m_is_full = true;
       return;
     }
   else
@@ -75,6 +81,10 @@ log_postpone_cache::add_redo_data (const log_prior_node &node)
     }
 
   // Cache a new postpone log record entry
+  if (m_cursor == m_cache_entries.size ())
+    {
+      m_cache_entries.emplace_back ();
+    }
   cache_entry &new_entry = m_cache_entries[m_cursor];
   new_entry.m_offset = m_redo_data_offset;
   // first and only first entry has m_offset equal to zero
@@ -118,7 +128,7 @@ log_postpone_cache::add_lsa (const log_lsa &lsa)
       return;
     }
 
-  assert (m_cursor < MAX_CACHE_ENTRIES);
+  assert (m_cursor < m_cache_entries.size ());
 
   m_cache_entries[m_cursor].m_lsa = lsa;
 
@@ -185,7 +195,7 @@ log_postpone_cache::do_postpone (cubthread::entry &thread_ref, const log_lsa &st
     }
 
   // Finished running postpones, update the number of entries which should be run on next commit
-  assert (!m_is_redo_data_buf_full);
+  assert (!m_is_full);
   m_cursor = start_index;
   m_redo_data_offset = m_cache_entries[start_index].m_offset;
   if (m_cursor == 0)
@@ -200,5 +210,11 @@ log_postpone_cache::do_postpone (cubthread::entry &thread_ref, const log_lsa &st
 bool
 log_postpone_cache::is_full () const
 {
-  return m_cursor == MAX_CACHE_ENTRIES || m_is_redo_data_buf_full;
+  return m_is_full;
+}
+
+std::size_t
+log_postpone_cache::get_max_size () const
+{
+  return (std::size_t) prm_get_integer_value (PRM_ID_LOG_POSTPONE_CACHE_SIZE_KB) * ONE_K;
 }
@@ -28,7 +28,7 @@
 #include "mem_block.hpp"
 #include "storage_common.h"
 
-#include <array>
+#include <vector>
 
 // forward declarations
 struct log_tdes;
@@ -42,6 +42,9 @@ namespace cubthread
 /**
  * Caches postpones to avoid reading them from log after commit top operation with postpone.
  * Otherwise, log critical section may be required which will slow the access on merged index nodes
+ *
+ * The cache grows with the postpones of transaction, until the entries and redo data reach the size of
+ * log_postpone_cache_size_in_kbytes. Only the postpones of a transaction beyond that are read from log.
  */
 class log_postpone_cache
 {
@@ -49,7 +52,7 @@ class log_postpone_cache
     log_postpone_cache ()
       : m_redo_data_buf ()
       , m_redo_data_offset (0)
-      , m_is_redo_data_buf_full (false)
+      , m_is_full (false)
       , m_cursor (0)
       , m_cache_entries ()
     {
@@ -70,9 +73,8 @@ class log_postpone_cache
     bool do_postpone (cubthread::entry &thread_ref, const log_lsa &start_postpone_lsa);
 
   private:
-    static const std::size_t MAX_CACHE_ENTRIES = 512;
-    static const std::size_t REDO_DATA_MAX_SIZE = 100 * 1024;   // 100k
     static const std::size_t BUFFER_RESET_SIZE = 1024;
+    static const std::size_t ENTRIES_RESET_COUNT = 512;
 
     class cache_entry
     {
@@ -90,12 +92,13 @@ class log_postpone_cache
 
     cubmem::extensible_block m_redo_data_buf;
     std::size_t m_redo_data_offset;
-    bool m_is_redo_data_buf_full;
+    bool m_is_full;               // a postpone did not fit in cache size
 
     std::size_t m_cursor;
-    std::array<cache_entry, MAX_CACHE_ENTRIES> m_cache_entries;
+    std::vector<cache_entry> m_cache_entries;
 
     bool is_full () const;
+    std::size_t get_max_size () const;
 };
 
 #endif /* _LOG_POSTPONE_CACHE_HPP_ */
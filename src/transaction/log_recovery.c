@@ -30,6 +30,8 @@
 #include <string.h>
 #include <time.h>
 #include <assert.h>
+#include <condition_variable>
+#include <mutex>
 
 #include "log_2pc.h"
 #include "log_append.hpp"
@@ -53,13 +55,27 @@
 #include "log_compress.h"
 #include "thread_entry.hpp"
 #include "thread_manager.hpp"
+#include "tsc_timer.h"
 
 static void log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				LOG_RCVINDEX rcvindex, const VPID * rcv_vpid, LOG_RCV * rcv,
 				const LOG_LSA * rcv_lsa_ptr, LOG_TDES * tdes, LOG_ZIP * undo_unzip_ptr);
 static void log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
-				int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv,
-				LOG_LSA * rcv_lsa_ptr, int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
+				LOG_RCVINDEX rcvindex, bool is_compensate, LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr,
+				int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
+static char *log_rv_redo_record_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+				      LOG_RCV * rcv, int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr,
+				      bool * is_fail);
+static void log_rv_redo_record_apply (THREAD_ENTRY * thread_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *),
+				      LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr);
+static void log_rv_redo_workers_start (THREAD_ENTRY * thread_p);
+static void log_rv_redo_workers_wait (void);
+static void log_rv_redo_workers_stop (void);
+STATIC_INLINE bool log_rv_redo_can_dispatch (const VPID * rcv_vpid, LOG_RCVINDEX rcvindex)
+  __attribute__ ((ALWAYS_INLINE));
+static void log_rv_redo_dispatch (THREAD_ENTRY * thread_p, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex,
+				  bool is_compensate, LOG_RCV * rcv, const LOG_LSA * rcv_lsa, LOG_LSA * log_lsa,
+				  LOG_PAGE * log_page_p, int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr);
 static bool log_rv_find_checkpoint (THREAD_ENTRY * thread_p, VOLID volid, LOG_LSA * rcv_lsa);
 static bool log_rv_get_unzip_log_data (THREAD_ENTRY * thread_p, int length, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
 				       LOG_ZIP * undo_unzip_ptr);
@@ -132,6 +148,21 @@ STATIC_INLINE PAGE_PTR log_rv_redo_fix_page (THREAD_ENTRY * thread_p, const VPID
 static void log_rv_simulate_runtime_worker (THREAD_ENTRY * thread_p, LOG_TDES * tdes);
 static void log_rv_end_simulation (THREAD_ENTRY * thread_p);
 
+/* Restart statistics of crash recovery. Redo workers read data pages, so values are added atomically. */
+typedef struct log_rv_restart_stats LOG_RV_RESTART_STATS;
+struct log_rv_restart_stats
+{
+  UINT64 values[LOG_RV_RESTART_STAT_COUNT];
+  UINT64 redo_records[RV_LAST_LOGID + 1];	/* by recovery index, counted by recovery thread */
+  UINT64 undo_records[RV_LAST_LOGID + 1];
+};
+
+static LOG_RV_RESTART_STATS log_Rv_restart_stats;
+
+STATIC_INLINE void log_rv_restart_stats_count_record (UINT64 * records, LOG_RCVINDEX rcvindex)
+  __attribute__ ((ALWAYS_INLINE));
+static void log_rv_restart_stats_report (THREAD_ENTRY * thread_p);
+
 /*
  * CRASH RECOVERY PROCESS
  */
@@ -181,6 +212,7 @@ log_rv_undo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     }
 
   log_rv_simulate_runtime_worker (thread_p, tdes);
+  log_rv_restart_stats_count_record (log_Rv_restart_stats.undo_records, rcvindex);
 
   if (MVCCID_IS_VALID (rcv->mvcc_id))
     {
@@ -416,7 +448,8 @@ end:
  *   log_lsa(in/out): Log address identifier containing the log record
  *   log_page_p(in/out): Pointer to page where data starts (Set as a side
  *               effect to the page where data ends)
- *   redofun(in): Function to invoke to redo the data
+ *   rcvindex(in): Recovery index of the record
+ *   is_compensate(in): true to redo a compensation record with the undo function
  *   rcv(in/out): Recovery structure for recovery function(Set as a side
  *               effect)
  *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
@@ -428,16 +461,55 @@ end:
  * NOTE: Execute a redo log record.
  */
 static void
-log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
-		    int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *), LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr,
-		    int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
+log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCVINDEX rcvindex,
+		    bool is_compensate, LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr, int undo_length, char *undo_data,
+		    LOG_ZIP * redo_unzip_ptr)
 {
   char *area = NULL;
-  bool is_zip = false;
-  int error_code;
+  bool is_fail = false;
 
   /* Note the the data page rcv->pgptr has been fetched by the caller */
 
+  area = log_rv_redo_record_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr,
+				  &is_fail);
+  if (is_fail)
+    {
+      return;
+    }
+
+  log_rv_restart_stats_count_record (log_Rv_restart_stats.redo_records, rcvindex);
+  log_rv_redo_record_apply (thread_p, is_compensate ? RV_fun[rcvindex].undofun : RV_fun[rcvindex].redofun, rcv,
+			    rcv_lsa_ptr);
+
+  if (area != NULL)
+    {
+      free_and_init (area);
+    }
+}
+
+/*
+ * log_rv_redo_record_data - GET THE DATA OF A REDO RECORD
+ *
+ * return: the area allocated for the data, if it is not contained in the log page. The caller must free it.
+ *
+ *   log_lsa(in/out): Log address identifier containing the log record
+ *   log_page_p(in/out): Pointer to page where data starts (Set as a side
+ *              effect to the page where data ends)
+ *   rcv(in/out): Recovery structure, data and length are set
+ *   undo_length(in):
+ *   undo_data(in):
+ *   redo_unzip_ptr(in):
+ *   is_fail(out): true if the data could not be read
+ */
+static char *
+log_rv_redo_record_data (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_page_p, LOG_RCV * rcv,
+			 int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr, bool * is_fail)
+{
+  char *area = NULL;
+  bool is_zip = false;
+
+  *is_fail = false;
+
   /*
    * If data is contained in only one buffer, pass pointer directly.
    * Otherwise, allocate a contiguous area, copy the data and pass this area.
@@ -461,7 +533,8 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
       if (area == NULL)
 	{
 	  logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rvredo_rec");
-	  return;
+	  *is_fail = true;
+	  return NULL;
 	}
       /* Copy the data */
       logpb_copy_from_log (thread_p, area, rcv->length, log_lsa, log_page_p);
@@ -490,6 +563,24 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
 	}
     }
 
+  return area;
+}
+
+/*
+ * log_rv_redo_record_apply - APPLY THE DATA OF A REDO RECORD
+ *
+ * return: nothing
+ *
+ *   redofun(in): Function to invoke to redo the data
+ *   rcv(in/out): Recovery structure for recovery function
+ *   rcv_lsa_ptr(in): Reset data page (rcv->pgptr) to this LSA
+ */
+static void
+log_rv_redo_record_apply (THREAD_ENTRY * thread_p, int (*redofun) (THREAD_ENTRY * thread_p, LOG_RCV *),
+			  LOG_RCV * rcv, LOG_LSA * rcv_lsa_ptr)
+{
+  int error_code;
+
   if (redofun != NULL)
     {
       error_code = (*redofun) (thread_p, rcv);
@@ -524,11 +615,340 @@ log_rv_redo_record (THREAD_ENTRY * thread_p, LOG_LSA * log_lsa, LOG_PAGE * log_p
     {
       (void) pgbuf_set_lsa (thread_p, rcv->pgptr, rcv_lsa_ptr);
     }
+}
+
+/*
+ * PARALLEL REDO
+ *
+ * The redo phase keeps reading the log on a single thread, but it can hand the records that only change their own
+ * page (see RCV_IS_PAGE_LOCAL_REDO) over to a fixed set of redo workers. The worker of a record is chosen by hashing
+ * its page, so all records of a page are redone by the same worker, in log order.
+ * Every other record that changes pages waits until the workers have redone all records dispatched so far and is
+ * then applied by the reader itself, so it is ordered against the records of all pages. Records that do not change
+ * any page (see RCV_IS_PAGE_INDEPENDENT_REDO) and the transaction records of the redo phase do not wait.
+ */
+
+#define LOG_RV_REDO_MAX_PENDING_JOBS 1024	/* jobs waiting for a worker, before the reader waits too */
+
+/* A record dispatched to a redo worker. */
+typedef struct log_rv_redo_job LOG_RV_REDO_JOB;
+struct log_rv_redo_job
+{
+  LOG_RV_REDO_JOB *next;	/* next job of the worker */
+  VPID vpid;			/* page to redo */
+  LOG_LSA rcv_lsa;		/* address of the log record */
+  LOG_RCVINDEX rcvindex;	/* recovery index of the log record */
+  bool is_compensate;		/* compensating records are redone with the undo function */
+  LOG_RCV rcv;			/* recovery structure; data points to the data below */
+  char data[1];			/* the data of the log record */
+};
+
+// *INDENT-OFF*
+/* The jobs of one redo worker. */
+struct log_rv_redo_worker
+{
+  std::mutex mutex;
+  std::condition_variable job_cond;	/* notified when a job is added or the worker must stop */
+  std::condition_variable done_cond;	/* notified when a job is done */
+  LOG_RV_REDO_JOB *head;
+  LOG_RV_REDO_JOB *tail;
+  int count_pending;			/* jobs added and not yet done */
+  bool is_stopped;
+};
+// *INDENT-ON*
+
+static cubthread::entry_workpool *log_Rv_redo_workpool = NULL;
+static log_rv_redo_worker *log_Rv_redo_workers = NULL;
+static int log_Rv_redo_num_workers = 0;
+
+/*
+ * log_rv_redo_job_execute - redo a dispatched record
+ *
+ * return: nothing
+ *
+ *   job(in): the dispatched record
+ */
+static void
+log_rv_redo_job_execute (THREAD_ENTRY * thread_p, LOG_RV_REDO_JOB * job)
+{
+  LOG_RCV *rcv = &job->rcv;
+
+  rcv->pgptr = log_rv_redo_fix_page (thread_p, &job->vpid, job->rcvindex);
+  if (rcv->pgptr == NULL)
+    {
+      /* deallocated */
+      return;
+    }
+
+  if (LSA_LE (&job->rcv_lsa, pgbuf_get_lsa (rcv->pgptr)))
+    {
+      /* It is already done */
+      pgbuf_unfix (thread_p, rcv->pgptr);
+      return;
+    }
+
+  rcv->data = job->data;
+  log_rv_redo_record_apply (thread_p, job->is_compensate ? RV_fun[job->rcvindex].undofun
+			    : RV_fun[job->rcvindex].redofun, rcv, &job->rcv_lsa);
+
+  pgbuf_unfix (thread_p, rcv->pgptr);
+}
+
+/*
+ * log_rv_redo_worker_execute - redo the jobs of a worker, in the order they were dispatched, until it is stopped
+ *
+ * return: nothing
+ *
+ *   thread_ref(in): thread entry
+ *   worker(in): redo worker
+ */
+static void
+log_rv_redo_worker_execute (cubthread::entry & thread_ref, log_rv_redo_worker * worker)
+{
+  LOG_RV_REDO_JOB *job;
+
+  thread_ref.tran_index = LOG_SYSTEM_TRAN_INDEX;
+
+  while (true)
+    {
+      // *INDENT-OFF*
+      std::unique_lock<std::mutex> ulock (worker->mutex);
+      worker->job_cond.wait (ulock, [worker] { return worker->head != NULL || worker->is_stopped; });
+      // *INDENT-ON*
+
+      job = worker->head;
+      if (job == NULL)
+	{
+	  /* stopped and all jobs done */
+	  break;
+	}
+      worker->head = job->next;
+      if (worker->head == NULL)
+	{
+	  worker->tail = NULL;
+	}
+      ulock.unlock ();
+
+      log_rv_redo_job_execute (&thread_ref, job);
+      free_and_init (job);
+
+      ulock.lock ();
+      worker->count_pending--;
+      worker->done_cond.notify_one ();
+    }
+}
+
+/*
+ * log_rv_redo_workers_start - start the redo workers, if the redo phase is parallel
+ *
+ * return: nothing
+ */
+static void
+log_rv_redo_workers_start (THREAD_ENTRY * thread_p)
+{
+#if defined (SERVER_MODE)
+  int num_workers = prm_get_integer_value (PRM_ID_LOG_RECOVERY_REDO_THREADS);
+  int i;
+
+  assert (log_Rv_redo_workpool == NULL);
+
+  if (num_workers <= 0)
+    {
+      return;
+    }
+
+  log_Rv_redo_workers = new log_rv_redo_worker[num_workers];
+  for (i = 0; i < num_workers; i++)
+    {
+      log_Rv_redo_workers[i].head = NULL;
+      log_Rv_redo_workers[i].tail = NULL;
+      log_Rv_redo_workers[i].count_pending = 0;
+      log_Rv_redo_workers[i].is_stopped = false;
+    }
+
+  log_Rv_redo_workpool =
+    thread_get_manager ()->create_worker_pool (num_workers, num_workers, "log_recovery_redo_workers", NULL, 1, false);
+  if (log_Rv_redo_workpool == NULL)
+    {
+      /* not fatal, records are redone serially */
+      delete[] log_Rv_redo_workers;
+      log_Rv_redo_workers = NULL;
+      return;
+    }
+
+  /* every worker redoes its own jobs until it is stopped */
+  for (i = 0; i < num_workers; i++)
+    {
+      // *INDENT-OFF*
+      cubthread::entry_callable_task *task =
+        new cubthread::entry_callable_task (std::bind (log_rv_redo_worker_execute, std::placeholders::_1,
+                                                       &log_Rv_redo_workers[i]));
+      // *INDENT-ON*
+      thread_get_manager ()->push_task (log_Rv_redo_workpool, task);
+    }
+  log_Rv_redo_num_workers = num_workers;
+#endif /* SERVER_MODE */
+}
+
+/*
+ * log_rv_redo_workers_wait - wait until the redo workers have redone all dispatched records
+ *
+ * return: nothing
+ */
+static void
+log_rv_redo_workers_wait (void)
+{
+  int i;
+
+  for (i = 0; i < log_Rv_redo_num_workers; i++)
+    {
+      log_rv_redo_worker *worker = &log_Rv_redo_workers[i];
+
+      // *INDENT-OFF*
+      std::unique_lock<std::mutex> ulock (worker->mutex);
+      worker->done_cond.wait (ulock, [worker] { return worker->count_pending == 0; });
+      // *INDENT-ON*
+    }
+}
+
+/*
+ * log_rv_redo_workers_stop - redo all dispatched records and stop the redo workers
+ *
+ * return: nothing
+ */
+static void
+log_rv_redo_workers_stop (void)
+{
+  int i;
+
+  if (log_Rv_redo_num_workers == 0)
+    {
+      return;
+    }
+
+  log_rv_redo_workers_wait ();
+
+  for (i = 0; i < log_Rv_redo_num_workers; i++)
+    {
+      log_rv_redo_worker *worker = &log_Rv_redo_workers[i];
+
+      // *INDENT-OFF*
+      std::unique_lock<std::mutex> ulock (worker->mutex);
+      // *INDENT-ON*
+      worker->is_stopped = true;
+      worker->job_cond.notify_one ();
+    }
+
+  thread_get_manager ()->destroy_worker_pool (log_Rv_redo_workpool);
+  log_Rv_redo_workpool = NULL;
+
+  delete[] log_Rv_redo_workers;
+  log_Rv_redo_workers = NULL;
+  log_Rv_redo_num_workers = 0;
+}
+
+/*
+ * log_rv_redo_can_dispatch - can the record be redone by a redo worker?
+ *
+ * return: true if redo is parallel and the record only changes its own page
+ *
+ *   rcv_vpid(in): page of the record
+ *   rcvindex(in): recovery index of the record
+ */
+STATIC_INLINE bool
+log_rv_redo_can_dispatch (const VPID * rcv_vpid, LOG_RCVINDEX rcvindex)
+{
+  return log_Rv_redo_num_workers > 0 && RCV_IS_PAGE_LOCAL_REDO (rcv_vpid, rcvindex);
+}
+
+/*
+ * log_rv_redo_dispatch - hand a record over to the redo worker of its page
+ *
+ * return: nothing
+ *
+ *   rcv_vpid(in): page of the record
+ *   rcvindex(in): recovery index of the record
+ *   is_compensate(in): true for compensating records
+ *   rcv(in/out): recovery structure of the record (its page is not fixed)
+ *   rcv_lsa(in): address of the record
+ *   log_lsa(in/out): address of the record data (set to the end of the data)
+ *   log_page_p(in/out): log page of the record data
+ *   undo_length(in):
+ *   undo_data(in):
+ *   redo_unzip_ptr(in):
+ *
+ * NOTE: The data is copied, the worker does not read the log.
+ */
+static void
+log_rv_redo_dispatch (THREAD_ENTRY * thread_p, const VPID * rcv_vpid, LOG_RCVINDEX rcvindex, bool is_compensate,
+		      LOG_RCV * rcv, const LOG_LSA * rcv_lsa, LOG_LSA * log_lsa, LOG_PAGE * log_page_p,
+		      int undo_length, char *undo_data, LOG_ZIP * redo_unzip_ptr)
+{
+  LOG_RV_REDO_JOB *job;
+  log_rv_redo_worker *worker;
+  char *area;
+  bool is_fail;
+
+  assert (rcv->pgptr == NULL);
+
+  area = log_rv_redo_record_data (thread_p, log_lsa, log_page_p, rcv, undo_length, undo_data, redo_unzip_ptr,
+				  &is_fail);
+  if (is_fail)
+    {
+      return;
+    }
+
+  log_rv_restart_stats_count_record (log_Rv_restart_stats.redo_records, rcvindex);
+
+  job = (LOG_RV_REDO_JOB *) malloc (offsetof (LOG_RV_REDO_JOB, data) + MAX (rcv->length, 1));
+  if (job == NULL)
+    {
+      er_set (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_OUT_OF_VIRTUAL_MEMORY, 1,
+	      offsetof (LOG_RV_REDO_JOB, data) + MAX (rcv->length, 1));
+      logpb_fatal_error (thread_p, true, ARG_FILE_LINE, "log_rv_redo_dispatch");
+      if (area != NULL)
+	{
+	  free_and_init (area);
+	}
+      return;
+    }
+
+  job->next = NULL;
+  job->vpid = *rcv_vpid;
+  job->rcv_lsa = *rcv_lsa;
+  job->rcvindex = rcvindex;
+  job->is_compensate = is_compensate;
+  job->rcv = *rcv;
+  if (rcv->length > 0)
+    {
+      memcpy (job->data, rcv->data, rcv->length);
+    }
+  job->rcv.data = NULL;
 
   if (area != NULL)
     {
       free_and_init (area);
     }
+
+  worker = &log_Rv_redo_workers[((unsigned int) rcv_vpid->volid * 31 + (unsigned int) rcv_vpid->pageid)
+				% log_Rv_redo_num_workers];
+
+  // *INDENT-OFF*
+  std::unique_lock<std::mutex> ulock (worker->mutex);
+  worker->done_cond.wait (ulock, [worker] { return worker->count_pending < LOG_RV_REDO_MAX_PENDING_JOBS; });
+  // *INDENT-ON*
+
+  if (worker->tail == NULL)
+    {
+      worker->head = job;
+    }
+  else
+    {
+      worker->tail->next = job;
+    }
+  worker->tail = job;
+  worker->count_pending++;
+  worker->job_cond.notify_one ();
 }
 
 /*
@@ -657,6 +1077,8 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
   int tran_index;
   INT64 num_redo_log_records;
   int error_code = NO_ERROR;
+  TSC_TICKS start_tick, end_tick;
+  UINT64 postpone_time;
 
   assert (LOG_CS_OWN_WRITE_MODE (thread_p));
 
@@ -727,8 +1149,11 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
    */
 
   log_Gl.rcv_phase = LOG_RECOVERY_ANALYSIS_PHASE;
+  tsc_getticks (&start_tick);
   log_recovery_analysis (thread_p, &rcv_lsa, &start_redolsa, &end_redo_lsa, ismedia_crash, stopat, &did_incom_recovery,
 			 &num_redo_log_records);
+  tsc_getticks (&end_tick);
+  log_rv_restart_stats_add (LOG_RV_RESTART_ANALYSIS_TIME, tsc_elapsed_utime (end_tick, start_tick));
 
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_STARTED, 3, num_redo_log_records,
 	  start_redolsa.pageid, end_redo_lsa.pageid);
@@ -767,7 +1192,13 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
 
   LOG_SET_CURRENT_TRAN_INDEX (thread_p, rcv_tran_index);
 
+  postpone_time = log_Rv_restart_stats.values[LOG_RV_RESTART_POSTPONE_TIME];
+  tsc_getticks (&start_tick);
   log_recovery_redo (thread_p, &start_redolsa, &end_redo_lsa, stopat);
+  tsc_getticks (&end_tick);
+  /* postpones are finished at the end of redo phase, but they are timed on their own */
+  postpone_time = log_Rv_restart_stats.values[LOG_RV_RESTART_POSTPONE_TIME] - postpone_time;
+  log_rv_restart_stats_add (LOG_RV_RESTART_REDO_TIME, tsc_elapsed_utime (end_tick, start_tick) - postpone_time);
   boot_reset_db_parm (thread_p);
 
   /* Undo phase */
@@ -775,7 +1206,10 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
 
   LOG_SET_CURRENT_TRAN_INDEX (thread_p, rcv_tran_index);
 
+  tsc_getticks (&start_tick);
   log_recovery_undo (thread_p);
+  tsc_getticks (&end_tick);
+  log_rv_restart_stats_add (LOG_RV_RESTART_UNDO_TIME, tsc_elapsed_utime (end_tick, start_tick));
   boot_reset_db_parm (thread_p);
 
   // *INDENT-OFF*
@@ -846,9 +1280,127 @@ log_recovery (THREAD_ENTRY * thread_p, int ismedia_crash, time_t * stopat)
       return;
     }
 
+  log_rv_restart_stats_report (thread_p);
+
   er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_FINISHED, 0);
 }
 
+/*
+ * log_rv_restart_stats_add - add to a restart statistic of crash recovery
+ *
+ * return: nothing
+ *
+ *   id(in): restart statistic
+ *   amount(in): microseconds for timers, pages for counters
+ */
+void
+log_rv_restart_stats_add (LOG_RV_RESTART_STAT_ID id, UINT64 amount)
+{
+  assert (id >= 0 && id < LOG_RV_RESTART_STAT_COUNT);
+
+  ATOMIC_INC_64 (&log_Rv_restart_stats.values[id], amount);
+}
+
+/*
+ * log_rv_restart_stats_count_record - count a record applied by recovery
+ *
+ * return: nothing
+ *
+ *   records(in/out): redo or undo record counters
+ *   rcvindex(in): recovery index of the record
+ */
+STATIC_INLINE void
+log_rv_restart_stats_count_record (UINT64 * records, LOG_RCVINDEX rcvindex)
+{
+  if (rcvindex >= 0 && rcvindex <= RV_LAST_LOGID)
+    {
+      records[rcvindex]++;
+    }
+}
+
+/*
+ * log_rv_restart_stats_report - report the restart statistics of crash recovery
+ *
+ * return: nothing
+ *
+ * NOTE: A summary is written to the error log. The details, with the records applied by recovery index, are appended
+ *       to the restart statistics file in log path, so the restart times can be compared across restarts and
+ *       upgrades.
+ */
+static void
+log_rv_restart_stats_report (THREAD_ENTRY * thread_p)
+{
+  const UINT64 *values = log_Rv_restart_stats.values;
+  char stats_name[PATH_MAX];
+  char time_array[128];
+  UINT64 redo_total = 0, undo_total = 0;
+  time_t report_time;
+  struct tm report_tm;
+  FILE *fp;
+  int rcvindex;
+
+  for (rcvindex = 0; rcvindex <= RV_LAST_LOGID; rcvindex++)
+    {
+      redo_total += log_Rv_restart_stats.redo_records[rcvindex];
+      undo_total += log_Rv_restart_stats.undo_records[rcvindex];
+    }
+
+  fileio_make_restart_stats_name (stats_name, log_Path, log_Prefix);
+
+  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_LOG_RECOVERY_STATS, 12,
+	  (long long) values[LOG_RV_RESTART_ANALYSIS_TIME] / 1000, (long long) values[LOG_RV_RESTART_REDO_TIME] / 1000,
+	  (long long) values[LOG_RV_RESTART_POSTPONE_TIME] / 1000, (long long) values[LOG_RV_RESTART_UNDO_TIME] / 1000,
+	  (long long) values[LOG_RV_RESTART_DWB_RECOVER_TIME] / 1000,
+	  (long long) values[LOG_RV_RESTART_VACUUM_LOAD_TIME] / 1000, (long long) values[LOG_RV_RESTART_LOG_PAGES_READ],
+	  (long long) values[LOG_RV_RESTART_LOG_PAGES_DECRYPTED], (long long) values[LOG_RV_RESTART_DATA_PAGES_READ],
+	  (long long) redo_total, (long long) undo_total, stats_name);
+
+  fp = fopen (stats_name, "a");
+  if (fp == NULL)
+    {
+      er_log_debug (ARG_FILE_LINE, "log_rv_restart_stats_report: cannot open %s", stats_name);
+      return;
+    }
+
+  report_time = time (NULL);
+  if (localtime_r (&report_time, &report_tm) == NULL)
+    {
+      strcpy (time_array, "00/00/00 00:00:00");
+    }
+  else
+    {
+      strftime (time_array, sizeof (time_array), "%m/%d/%y %H:%M:%S", &report_tm);
+    }
+
+  fprintf (fp, "Time: %s - crash recovery of %s\n", time_array, log_Prefix);
+  fprintf (fp, "  %-30s = %16lld\n", "dwb_recover_time_msec",
+	   (long long) values[LOG_RV_RESTART_DWB_RECOVER_TIME] / 1000);
+  fprintf (fp, "  %-30s = %16lld\n", "vacuum_data_load_time_msec",
+	   (long long) values[LOG_RV_RESTART_VACUUM_LOAD_TIME] / 1000);
+  fprintf (fp, "  %-30s = %16lld\n", "analysis_time_msec", (long long) values[LOG_RV_RESTART_ANALYSIS_TIME] / 1000);
+  fprintf (fp, "  %-30s = %16lld\n", "redo_time_msec", (long long) values[LOG_RV_RESTART_REDO_TIME] / 1000);
+  fprintf (fp, "  %-30s = %16lld\n", "postpone_time_msec", (long long) values[LOG_RV_RESTART_POSTPONE_TIME] / 1000);
+  fprintf (fp, "  %-30s = %16lld\n", "undo_time_msec", (long long) values[LOG_RV_RESTART_UNDO_TIME] / 1000);
+  fprintf (fp, "  %-30s = %16lld\n", "log_pages_read", (long long) values[LOG_RV_RESTART_LOG_PAGES_READ]);
+  fprintf (fp, "  %-30s = %16lld\n", "log_pages_decrypted", (long long) values[LOG_RV_RESTART_LOG_PAGES_DECRYPTED]);
+  fprintf (fp, "  %-30s = %16lld\n", "data_pages_read", (long long) values[LOG_RV_RESTART_DATA_PAGES_READ]);
+  fprintf (fp, "  %-30s = %16lld\n", "records_redone", (long long) redo_total);
+  fprintf (fp, "  %-30s = %16lld\n", "records_undone", (long long) undo_total);
+
+  for (rcvindex = 0; rcvindex <= RV_LAST_LOGID; rcvindex++)
+    {
+      if (log_Rv_restart_stats.redo_records[rcvindex] == 0 && log_Rv_restart_stats.undo_records[rcvindex] == 0)
+	{
+	  continue;
+	}
+      fprintf (fp, "  %-30s : redo = %12lld, undo = %12lld\n", rv_rcvindex_string ((LOG_RCVINDEX) rcvindex),
+	       (long long) log_Rv_restart_stats.redo_records[rcvindex],
+	       (long long) log_Rv_restart_stats.undo_records[rcvindex]);
+    }
+
+  fclose (fp);
+}
+
 /*
  * log_rv_analysis_undo_redo -
  *
@@ -3081,6 +3633,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   LOG_ZIP *redo_unzip_ptr = NULL;
   bool is_diff_rec;
   bool is_mvcc_op = false;
+  bool is_dispatched = false;
+  TSC_TICKS postpone_start_tick, postpone_end_tick;
 
   aligned_log_pgbuf = PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
 
@@ -3122,6 +3676,8 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
       return;
     }
 
+  log_rv_redo_workers_start (thread_p);
+
   while (!LSA_ISNULL (&lsa))
     {
       /* Fetch the page where the LSA record to undo is located */
@@ -3294,8 +3850,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = undoredo->data.rcvindex;
-	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      is_dispatched = log_rv_redo_can_dispatch (&rcv_vpid, rcvindex);
+	      if (!is_dispatched)
+		{
+		  /* redone here, after the records dispatched so far */
+		  log_rv_redo_workers_wait ();
+		}
+	      /* If the page does not exit, there is nothing to redo; a dispatched record is checked by its worker */
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3404,16 +3966,22 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      if (is_diff_rec)
+	      if (is_dispatched)
+		{
+		  log_rv_redo_dispatch (thread_p, &rcv_vpid, rcvindex, false, &rcv, &rcv_lsa, &log_lsa, log_pgptr,
+					is_diff_rec ? (int) undo_unzip_ptr->data_length : 0,
+					is_diff_rec ? (char *) undo_unzip_ptr->log_data : NULL, redo_unzip_ptr);
+		}
+	      else if (is_diff_rec)
 		{
 		  /* XOR Process */
-		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa,
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, rcvindex, false, &rcv, &rcv_lsa,
 				      (int) undo_unzip_ptr->data_length, (char *) undo_unzip_ptr->log_data,
 				      redo_unzip_ptr);
 		}
 	      else
 		{
-		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, rcvindex, false, &rcv, &rcv_lsa, 0, NULL,
 				      redo_unzip_ptr);
 		}
 	      if (rcv.pgptr != NULL)
@@ -3480,8 +4048,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = redo->data.rcvindex;
-	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      is_dispatched = log_rv_redo_can_dispatch (&rcv_vpid, rcvindex);
+	      if (!is_dispatched)
+		{
+		  /* redone here, after the records dispatched so far */
+		  log_rv_redo_workers_wait ();
+		}
+	      /* If the page does not exit, there is nothing to redo; a dispatched record is checked by its worker */
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3537,8 +4111,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
-				  redo_unzip_ptr);
+	      if (is_dispatched)
+		{
+		  log_rv_redo_dispatch (thread_p, &rcv_vpid, rcvindex, false, &rcv, &rcv_lsa, &log_lsa, log_pgptr, 0,
+					NULL, redo_unzip_ptr);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, rcvindex, false, &rcv, &rcv_lsa, 0,
+				      NULL, redo_unzip_ptr);
+		}
 
 	      if (rcv.pgptr != NULL)
 		{
@@ -3576,7 +4158,12 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      if (!log_recovery_needs_skip_logical_redo (thread_p, tran_id, log_rtype, rcvindex, &rcv_lsa))
 		{
-		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
+		  if (!RCV_IS_PAGE_INDEPENDENT_REDO (rcvindex))
+		    {
+		      /* redone here, after the records dispatched so far */
+		      log_rv_redo_workers_wait ();
+		    }
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, rcvindex, false, &rcv, &rcv_lsa, 0, NULL,
 				      NULL);
 		}
 
@@ -3602,8 +4189,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = run_posp->data.rcvindex;
-	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      is_dispatched = log_rv_redo_can_dispatch (&rcv_vpid, rcvindex);
+	      if (!is_dispatched)
+		{
+		  /* redone here, after the records dispatched so far */
+		  log_rv_redo_workers_wait ();
+		}
+	      /* If the page does not exit, there is nothing to redo; a dispatched record is checked by its worker */
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3660,8 +4253,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].redofun, &rcv, &rcv_lsa, 0, NULL,
-				  NULL);
+	      if (is_dispatched)
+		{
+		  log_rv_redo_dispatch (thread_p, &rcv_vpid, rcvindex, false, &rcv, &rcv_lsa, &log_lsa, log_pgptr, 0,
+					NULL, NULL);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, rcvindex, false, &rcv, &rcv_lsa, 0,
+				      NULL, NULL);
+		}
 
 	      if (rcv.pgptr != NULL)
 		{
@@ -3689,8 +4290,14 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 
 	      rcv.pgptr = NULL;
 	      rcvindex = compensate->data.rcvindex;
-	      /* If the page does not exit, there is nothing to redo */
-	      if (rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
+	      is_dispatched = log_rv_redo_can_dispatch (&rcv_vpid, rcvindex);
+	      if (!is_dispatched)
+		{
+		  /* redone here, after the records dispatched so far */
+		  log_rv_redo_workers_wait ();
+		}
+	      /* If the page does not exit, there is nothing to redo; a dispatched record is checked by its worker */
+	      if (!is_dispatched && rcv_vpid.pageid != NULL_PAGEID && rcv_vpid.volid != NULL_VOLID)
 		{
 		  rcv.pgptr = log_rv_redo_fix_page (thread_p, &rcv_vpid, rcvindex);
 		  if (rcv.pgptr == NULL)
@@ -3746,8 +4353,16 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 		}
 #endif /* !NDEBUG */
 
-	      log_rv_redo_record (thread_p, &log_lsa, log_pgptr, RV_fun[rcvindex].undofun, &rcv, &rcv_lsa, 0, NULL,
-				  NULL);
+	      if (is_dispatched)
+		{
+		  log_rv_redo_dispatch (thread_p, &rcv_vpid, rcvindex, true, &rcv, &rcv_lsa, &log_lsa, log_pgptr, 0,
+					NULL, NULL);
+		}
+	      else
+		{
+		  log_rv_redo_record (thread_p, &log_lsa, log_pgptr, rcvindex, true, &rcv, &rcv_lsa, 0,
+				      NULL, NULL);
+		}
 	      if (rcv.pgptr != NULL)
 		{
 		  pgbuf_unfix (thread_p, rcv.pgptr);
@@ -4040,6 +4655,9 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
 	}
     }
 
+  /* all records must be redone before the postpones */
+  log_rv_redo_workers_stop ();
+
   log_zip_free (undo_unzip_ptr);
   log_zip_free (redo_unzip_ptr);
 
@@ -4049,7 +4667,10 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   log_recovery_abort_all_atomic_sysops (thread_p);
 
   /* Now finish all postpone operations */
+  tsc_getticks (&postpone_start_tick);
   log_recovery_finish_all_postpone (thread_p);
+  tsc_getticks (&postpone_end_tick);
+  log_rv_restart_stats_add (LOG_RV_RESTART_POSTPONE_TIME, tsc_elapsed_utime (postpone_end_tick, postpone_start_tick));
 
   /* Flush all dirty pages */
   logpb_flush_pages_direct (thread_p);
@@ -4058,6 +4679,7 @@ log_recovery_redo (THREAD_ENTRY * thread_p, const LOG_LSA * start_redolsa, const
   (void) pgbuf_flush_all (thread_p, NULL_VOLID);
 
 exit:
+  log_rv_redo_workers_stop ();
   LSA_SET_NULL (&log_Gl.unique_stats_table.curr_rcv_rec_lsa);
 
   return;
@@ -230,7 +230,7 @@ struct log_arv_header
 {
   /* Log archive header information */
   char magic[CUBRID_MAGIC_MAX_LENGTH];	/* Magic value for file/magic Unix utility */
-  INT32 dummy;			/* for 8byte align */
+  INT32 zip_npages_per_group;	/* Pages compressed together if the archive is compressed; not positive otherwise */
   INT64 db_creation;		/* Database creation time. For safety reasons, this value is set on all volumes and the
 				 * log. The value is generated by the log manager */
   TRANID next_trid;		/* Next Transaction identifier */
@@ -241,7 +241,7 @@ struct log_arv_header
 
   log_arv_header ()
     : magic {'0'}
-    , dummy (0)
+    , zip_npages_per_group (0)
     , db_creation (0)
     , next_trid (0)
     , npages (0)
@@ -98,6 +98,10 @@ static BOOT_CLIENT_CREDENTIAL log_Client_credential;
 
 static const unsigned int LOGTB_RETRY_SLAM_MAX_TIMES = 10;
 
+/* Changed every time a transaction that changed users, groups or grants commits. Clients get it at the end of their
+ * transactions and keep their authorization caches while it does not change. It is never 0. */
+static volatile unsigned int logtb_Authorization_version = 1;
+
 static int logtb_expand_trantable (THREAD_ENTRY * thread_p, int num_new_indices);
 static int logtb_allocate_tran_index (THREAD_ENTRY * thread_p, TRANID trid, TRAN_STATE state,
 				      const BOOT_CLIENT_CREDENTIAL * client_credential, TRAN_STATE * current_state,
@@ -1470,6 +1474,7 @@ logtb_free_tran_mvcc_info (LOG_TDES * tdes)
   MVCC_INFO *curr_mvcc_info = &tdes->mvccinfo;
 
   curr_mvcc_info->snapshot.m_active_mvccs.finalize ();
+  curr_mvcc_info->snapshot.reusable = false;
   curr_mvcc_info->sub_ids.clear ();
 }
 
@@ -1578,6 +1583,7 @@ logtb_clear_tdes (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
       tdes->disable_modifications = db_Disable_modifications;
     }
   tdes->has_deadlock_priority = false;
+  tdes->has_authorization_change = false;
 
   tdes->num_log_records_written = 0;
 
@@ -1655,6 +1661,7 @@ logtb_initialize_tdes (LOG_TDES * tdes, int tran_index)
       tdes->bind_history[i].vals = NULL;
     }
   tdes->has_deadlock_priority = false;
+  tdes->has_authorization_change = false;
 
   tdes->num_log_records_written = 0;
 
@@ -4590,6 +4597,7 @@ logtb_complete_sub_mvcc (THREAD_ENTRY * thread_p, LOG_TDES * tdes)
 	  MVCCID_FORWARD (snapshot->highest_completed_mvccid);
 	}
       snapshot->m_active_mvccs.set_inactive_mvccid (mvcc_sub_id);
+      snapshot->reusable = false;
     }
 }
 
@@ -5656,6 +5664,59 @@ logtb_check_class_for_rr_isolation_err (const OID * class_oid)
   return false;
 }
 
+/*
+ * logtb_set_authorization_change () - mark current transaction if the class is one of users, groups or grants
+ *
+ * return	   : void
+ * thread_p (in)   : Thread entry.
+ * class_oid (in)  : Class of changed object.
+ */
+void
+logtb_set_authorization_change (THREAD_ENTRY * thread_p, const OID * class_oid)
+{
+  LOG_TDES *tdes;
+
+  if (!oid_check_cached_class_oid (OID_CACHE_USER_CLASS_ID, class_oid)
+      && !oid_check_cached_class_oid (OID_CACHE_AUTH_CLASS_ID, class_oid)
+      && !oid_check_cached_class_oid (OID_CACHE_CLASSAUTH_CLASS_ID, class_oid))
+    {
+      return;
+    }
+
+  tdes = LOG_FIND_CURRENT_TDES (thread_p);
+  if (tdes != NULL)
+    {
+      tdes->has_authorization_change = true;
+    }
+}
+
+/*
+ * logtb_bump_authorization_version () - change the authorization version when a transaction that changed users,
+ *					  groups or grants commits
+ *
+ * return : void
+ */
+void
+logtb_bump_authorization_version (void)
+{
+  if (ATOMIC_INC_32 (&logtb_Authorization_version, 1) == 0)
+    {
+      /* 0 is unknown for the clients */
+      (void) ATOMIC_INC_32 (&logtb_Authorization_version, 1);
+    }
+}
+
+/*
+ * logtb_get_authorization_version () - get current authorization version
+ *
+ * return : authorization version
+ */
+unsigned int
+logtb_get_authorization_version (void)
+{
+  return ATOMIC_INC_32 (&logtb_Authorization_version, 0);
+}
+
 void
 logtb_slam_transaction (THREAD_ENTRY * thread_p, int tran_index)
 {
@@ -28,10 +28,6 @@
 #include <errno.h>
 #if !defined(WINDOWS)
 #include <dirent.h>
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-#include "sys/socket.h"
-#include "sys/un.h"
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
 #endif /* !WINDOWNS */
 #include <signal.h>
 
@@ -178,9 +174,6 @@ static int logwr_flush_all_append_pages (void);
 static int logwr_archive_active_log (void);
 static int logwr_flush_bgarv_header_page (void);
 static void logwr_reinit_copylog (void);
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-static int logwr_load_tde (void);
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
 
 /*
  * logwr_to_physical_pageid -
@@ -835,33 +828,29 @@ logwr_copy_necessary_log (LOG_PAGEID to_pageid)
 static LOG_PAGE **
 logwr_writev_append_pages (LOG_PAGE ** to_flush, DKNPAGES npages)
 {
-  char log_pgbuf[IO_MAX_PAGE_SIZE * LOGPB_IO_NPAGES + MAX_ALIGNMENT];
   LOG_PAGEID fpageid;
   LOG_PHY_PAGEID phy_pageid;
   BACKGROUND_ARCHIVING_INFO *bg_arv_info = NULL;
   LOG_PAGE *log_pgptr = NULL;
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-  LOG_PAGE *buf_pgptr = NULL;
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
   FILEIO_WRITE_MODE write_mode = FILEIO_WRITE_DEFAULT_WRITE;
-  const TDE_ALGORITHM tde_algo = (TDE_ALGORITHM) prm_get_integer_value (PRM_ID_TDE_DEFAULT_ALGORITHM);
   int error = NO_ERROR;
   int i;
-  int tde_load_retries = 3;
 
 #if !defined (CS_MODE)
   write_mode = dwb_is_created () == true ? FILEIO_WRITE_NO_COMPENSATE_WRITE : FILEIO_WRITE_DEFAULT_WRITE;
 #endif
 
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-  buf_pgptr = (LOG_PAGE *) PTR_ALIGN (log_pgbuf, MAX_ALIGNMENT);
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
-
   if (npages > 0)
     {
       fpageid = to_flush[0]->hdr.logical_pageid;
 
-      (void) logwr_check_page_checksum (NULL, *to_flush);
+#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
+      /* TDE encrypted pages are forwarded as ciphertext, and the checksum is of the plaintext */
+      if (!LOG_IS_PAGE_TDE_ENCRYPTED (*to_flush))
+#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
+	{
+	  (void) logwr_check_page_checksum (NULL, *to_flush);
+	}
 
       /* 1. archive temp write */
       if (prm_get_bool_value (PRM_ID_LOG_BACKGROUND_ARCHIVING))
@@ -890,35 +879,6 @@ logwr_writev_append_pages (LOG_PAGE ** to_flush, DKNPAGES npages)
 	  for (i = 0; i < npages; i++)
 	    {
 	      log_pgptr = to_flush[i];
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-	      if (LOG_IS_PAGE_TDE_ENCRYPTED (log_pgptr))
-		{
-		  logwr_set_tde_algorithm (NULL, log_pgptr, tde_algo);
-
-		  while (!tde_Cipher.is_loaded)
-		    {
-		      error = logwr_load_tde ();
-		      if (error != NO_ERROR)
-			{
-			  ASSERT_ERROR ();
-			  if (tde_load_retries-- > 0)
-			    {
-			      er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_TDE_CIPHER_LOAD_FAIL, 0);
-			      sleep (1);
-			      er_clear ();
-			      continue;
-			    }
-			  return NULL;
-			}
-		    }
-
-		  if (tde_encrypt_log_page (log_pgptr, tde_algo, buf_pgptr) != NO_ERROR)
-		    {
-		      return NULL;
-		    }
-		  log_pgptr = buf_pgptr;
-		}
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
 	      if (fileio_write (NULL, bg_arv_info->vdes, log_pgptr, phy_pageid + i, LOG_PAGESIZE, write_mode) == NULL)
 		{
 		  if (er_errid () == ER_IO_WRITE_OUT_OF_SPACE)
@@ -948,42 +908,11 @@ logwr_writev_append_pages (LOG_PAGE ** to_flush, DKNPAGES npages)
 	    }
 	}
 
-      tde_load_retries = 3;
-
       /* 2. active write */
       phy_pageid = logwr_to_physical_pageid (fpageid);
       for (i = 0; i < npages; i++)
 	{
 	  log_pgptr = to_flush[i];
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-	  if (LOG_IS_PAGE_TDE_ENCRYPTED (log_pgptr))
-	    {
-	      logwr_set_tde_algorithm (NULL, log_pgptr, tde_algo);
-
-	      while (!tde_Cipher.is_loaded)
-		{
-		  error = logwr_load_tde ();
-		  if (error != NO_ERROR)
-		    {
-		      ASSERT_ERROR ();
-		      if (tde_load_retries-- > 0)
-			{
-			  er_set (ER_NOTIFICATION_SEVERITY, ARG_FILE_LINE, ER_TDE_CIPHER_LOAD_FAIL, 0);
-			  sleep (1);
-			  er_clear ();
-			  continue;
-			}
-		      return NULL;
-		    }
-		}
-
-	      if (tde_encrypt_log_page (log_pgptr, tde_algo, buf_pgptr) != NO_ERROR)
-		{
-		  return NULL;
-		}
-	      log_pgptr = buf_pgptr;
-	    }
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
 	  if (fileio_write (NULL, logwr_Gl.append_vdes, log_pgptr, phy_pageid + i, LOG_PAGESIZE, write_mode) == NULL)
 	    {
 	      if (er_errid () == ER_IO_WRITE_OUT_OF_SPACE)
@@ -1307,6 +1236,7 @@ logwr_archive_active_log (void)
   /* Construct the archive log header */
   arvhdr = (LOG_ARV_HEADER *) malloc_arv_hdr_pgptr->area;
   strncpy (arvhdr->magic, CUBRID_MAGIC_LOG_ARCHIVE, CUBRID_MAGIC_MAX_LENGTH);
+  arvhdr->zip_npages_per_group = 0;
   arvhdr->db_creation = logwr_Gl.hdr.db_creation;
   arvhdr->next_trid = NULL_TRANID;
   arvhdr->fpageid = logwr_Gl.last_arv_fpageid;
@@ -1829,132 +1759,6 @@ logwr_reinit_copylog (void)
   return;
 }
 
-#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
-static int
-logwr_load_tde (void)
-{
-  int client_len;
-  int client_sockfd;
-  char sock_path[PATH_MAX];
-  TDE_DATA_KEY_SET dks;
-  char *bufptr;
-  int nbytes, len;
-  int err_msg = NO_ERROR;
-
-  struct sockaddr_un clientaddr;
-
-  fileio_make_ha_sock_name (sock_path, logwr_Gl.log_path, TDE_HA_SOCK_NAME);
-
-  client_sockfd = socket (AF_UNIX, SOCK_STREAM, 0);
-  if (client_sockfd == -1)
-    {
-      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_OPEN, 1, sock_path);
-      return ER_TDE_DK_SHARING_SOCK_OPEN;
-    }
-
-  bzero (&clientaddr, sizeof (clientaddr));
-  clientaddr.sun_family = AF_UNIX;
-  strcpy (clientaddr.sun_path, sock_path);
-  client_len = sizeof (clientaddr);
-
-  if (connect (client_sockfd, (struct sockaddr *) &clientaddr, client_len) < 0)
-    {
-      er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_CONNECT, 0);
-      return ER_TDE_DK_SHARING_SOCK_CONNECT;
-    }
-
-  bufptr = logwr_Gl.log_path;
-  len = PATH_MAX;
-  while (len > 0)
-    {
-      nbytes = write (client_sockfd, bufptr, len);
-      if (nbytes < 0)
-	{
-	  switch (errno)
-	    {
-	    case EINTR:
-	    case EAGAIN:
-	      continue;
-	    default:
-	      {
-		close (client_sockfd);
-		er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_WRITE, 0);
-		return ER_TDE_DK_SHARING_SOCK_WRITE;
-	      }
-	    }
-	}
-      bufptr += nbytes;
-      len -= nbytes;
-    }
-
-  /* read error message */
-  bufptr = (char *) &err_msg;
-  len = sizeof (err_msg);
-  while (len > 0)
-    {
-      nbytes = read (client_sockfd, bufptr, len);
-      if (nbytes < 0)
-	{
-	  switch (errno)
-	    {
-	    case EINTR:
-	    case EAGAIN:
-	      continue;
-	    default:
-	      {
-		close (client_sockfd);
-		er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_READ, 0);
-		return ER_TDE_DK_SHARING_SOCK_READ;
-	      }
-	    }
-	}
-      bufptr += nbytes;
-      len -= nbytes;
-    }
-
-  if (err_msg != NO_ERROR)
-    {
-      close (client_sockfd);
-      return err_msg;
-    }
-
-  /* read data keys */
-
-  bufptr = (char *) &dks;
-  len = sizeof (TDE_DATA_KEY_SET);
-  while (len > 0)
-    {
-      nbytes = read (client_sockfd, bufptr, len);
-      if (nbytes < 0)
-	{
-	  switch (errno)
-	    {
-	    case EINTR:
-	    case EAGAIN:
-	      continue;
-	    default:
-	      {
-		close (client_sockfd);
-		er_set_with_oserror (ER_ERROR_SEVERITY, ARG_FILE_LINE, ER_TDE_DK_SHARING_SOCK_READ, 0);
-		return ER_TDE_DK_SHARING_SOCK_READ;
-	      }
-	    }
-	}
-      bufptr += nbytes;
-      len -= nbytes;
-    }
-
-  memcpy (tde_Cipher.data_keys.perm_key, dks.perm_key, TDE_DATA_KEY_LENGTH);
-  memcpy (tde_Cipher.data_keys.temp_key, dks.temp_key, TDE_DATA_KEY_LENGTH);
-  memcpy (tde_Cipher.data_keys.log_key, dks.log_key, TDE_DATA_KEY_LENGTH);
-
-  tde_Cipher.is_loaded = true;
-
-  close (client_sockfd);
-  return NO_ERROR;
-}
-#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
-
 #else /* CS_MODE */
 int
 logwr_copy_log_file (const char *db_name, const char *log_path, int mode, INT64 start_page_id)
@@ -2107,6 +1911,8 @@ static void logwr_write_end (THREAD_ENTRY * thread_p, LOGWR_INFO * writer_info,
 static void logwr_set_eof_lsa (THREAD_ENTRY * thread_p, LOGWR_ENTRY * entry);
 static bool logwr_is_delayed (THREAD_ENTRY * thread_p, LOGWR_ENTRY * entry);
 static void logwr_update_last_sent_eof_lsa (LOGWR_ENTRY * entry);
+static void logwr_receive_sync_ack (LOGWR_ENTRY * entry);
+static bool logwr_is_sync_ack_pending (const LOG_LSA * lsa);
 
 /*
  * logwr_register_writer_entry -
@@ -2156,6 +1962,7 @@ logwr_register_writer_entry (LOGWR_ENTRY ** wr_entry_p, THREAD_ENTRY * thread_p,
       entry->mode = (LOGWR_MODE) mode;
       entry->start_copy_time = 0;
       entry->copy_from_first_phy_page = copy_from_first_phy_page;
+      entry->is_in_sync = false;
 
       entry->status = LOGWR_STATUS_DELAY;
       LSA_SET_NULL (&entry->eof_lsa);
@@ -2449,6 +2256,19 @@ logwr_pack_log_pages (THREAD_ENTRY * thread_p, char *logpg_area, int *logpg_used
 	    }
 
 	  assert (pageid == (log_pgptr->hdr.logical_pageid));
+
+#ifdef UNSTABLE_TDE_FOR_REPLICATION_LOG
+	  /* Send TDE pages as ciphertext. copylogdb stores them as they are and only applylogdb decrypts them. */
+	  if (LOG_IS_PAGE_TDE_ENCRYPTED (log_pgptr))
+	    {
+	      error_code = tde_encrypt_log_page (log_pgptr, logwr_get_tde_algorithm (log_pgptr), log_pgptr);
+	      if (error_code != NO_ERROR)
+		{
+		  ASSERT_ERROR ();
+		  goto error;
+		}
+	    }
+#endif /* UNSTABLE_TDE_FOR_REPLICATION_LOG */
 	  p += LOG_PAGESIZE;
 	}
     }
@@ -2556,6 +2376,111 @@ logwr_update_last_sent_eof_lsa (LOGWR_ENTRY * entry)
   return;
 }
 
+/*
+ * logwr_receive_sync_ack - the replica of a pipelined SYNC writer has written the pages sent to it
+ *
+ * return:
+ *
+ *   entry(in):
+ *
+ * Note: The flusher did not wait for the writer, so more pages may have been flushed meanwhile. The writer is then
+ *       marked as delayed to send them right away instead of waiting for the next flush.
+ */
+static void
+logwr_receive_sync_ack (LOGWR_ENTRY * entry)
+{
+  LOGWR_INFO *writer_info = log_Gl.writer_info;
+  LOG_LSA nxio_lsa;
+
+  nxio_lsa = log_Gl.append.get_nxio_lsa ();
+
+  pthread_mutex_lock (&writer_info->ack_mutex);
+  pthread_mutex_lock (&writer_info->wr_list_mutex);
+  LSA_COPY (&entry->last_sent_eof_lsa, &entry->tmp_last_sent_eof_lsa);
+  if (entry->status == LOGWR_STATUS_DONE && LSA_LT (&entry->last_sent_eof_lsa, &nxio_lsa))
+    {
+      entry->status = LOGWR_STATUS_DELAY;
+    }
+  pthread_mutex_unlock (&writer_info->wr_list_mutex);
+  pthread_cond_broadcast (&writer_info->ack_cond);
+  pthread_mutex_unlock (&writer_info->ack_mutex);
+}
+
+/*
+ * logwr_is_sync_ack_pending - check whether a SYNC writer in sync has not received the ack of lsa yet
+ *
+ * return: true if commit of lsa must wait
+ *
+ *   lsa(in):
+ */
+static bool
+logwr_is_sync_ack_pending (const LOG_LSA * lsa)
+{
+  LOGWR_INFO *writer_info = log_Gl.writer_info;
+  LOGWR_ENTRY *entry;
+  bool is_pending = false;
+
+  pthread_mutex_lock (&writer_info->wr_list_mutex);
+  for (entry = writer_info->writer_list; entry != NULL; entry = entry->next)
+    {
+      if (entry->mode == LOGWR_MODE_SYNC && entry->is_in_sync && entry->status != LOGWR_STATUS_ERROR
+	  && LSA_LT (&entry->last_sent_eof_lsa, lsa))
+	{
+	  is_pending = true;
+	  break;
+	}
+    }
+  pthread_mutex_unlock (&writer_info->wr_list_mutex);
+
+  return is_pending;
+}
+
+/*
+ * logwr_wait_for_sync_ack - wait until the SYNC replicas have written the log up to lsa
+ *
+ * return:
+ *
+ *   thread_p(in):
+ *   lsa(in): commit lsa, already flushed
+ *
+ * Note: Only for ha_copy_log_pipelined. The log flush sends the pages to the writers and goes on; each committing
+ *       transaction waits for the acks of its own commit lsa instead. Replicas that are catching up are not waited
+ *       for, same as they do not delay the flush without pipelining, and nor is a replica that does not ack within
+ *       ha_copy_log_timeout.
+ */
+void
+logwr_wait_for_sync_ack (THREAD_ENTRY * thread_p, const LOG_LSA * lsa)
+{
+  LOGWR_INFO *writer_info = log_Gl.writer_info;
+  struct timespec to;
+  int timeout_sec;
+  time_t end_time;
+
+  if (HA_DISABLED () || !prm_get_bool_value (PRM_ID_HA_COPY_LOG_PIPELINED) || !logwr_is_sync_ack_pending (lsa))
+    {
+      return;
+    }
+
+  timeout_sec = prm_get_integer_value (PRM_ID_HA_COPY_LOG_TIMEOUT);
+  end_time = time (NULL) + timeout_sec;
+
+  pthread_mutex_lock (&writer_info->ack_mutex);
+  while (logwr_is_sync_ack_pending (lsa))
+    {
+      if (timeout_sec >= 0 && time (NULL) >= end_time)
+	{
+	  logwr_er_log ("logwr_wait_for_sync_ack: no ack of lsa (%lld|%d) within %d seconds\n",
+			LSA_AS_ARGS (lsa), timeout_sec);
+	  break;
+	}
+
+      to.tv_sec = time (NULL) + 1;
+      to.tv_nsec = 0;
+      (void) pthread_cond_timedwait (&writer_info->ack_cond, &writer_info->ack_mutex, &to);
+    }
+  pthread_mutex_unlock (&writer_info->ack_mutex);
+}
+
 /*
  * xlogwr_get_log_pages -
  *
@@ -2584,6 +2509,7 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
   bool is_interrupted = false;
   bool copy_from_file = false;
   bool need_cs_exit_after_send = true;
+  bool is_pipelined = false;
   struct timespec to;
   LOGWR_INFO *writer_info = log_Gl.writer_info;
   bool copy_from_first_phy_page = false;
@@ -2751,7 +2677,17 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
        * transition \ req mode | req_sync req_async ----------------------------------------- delay -> delay | n/a
        * ASYNC delay -> done | n/a SYNC wait -> delay | SYNC ASYNC wait -> done | SYNC ASYNC */
 
-      if (orig_mode == LOGWR_MODE_ASYNC
+      /* With pipelined copy, a SYNC writer does not hold the flush until the replica acks; the committing
+       * transactions wait for the ack (see logwr_wait_for_sync_ack). */
+      is_pipelined = (mode == LOGWR_MODE_SYNC && prm_get_bool_value (PRM_ID_HA_COPY_LOG_PIPELINED));
+      if (is_pipelined)
+	{
+	  rv = pthread_mutex_lock (&writer_info->wr_list_mutex);
+	  entry->is_in_sync = (status == LOGWR_STATUS_DONE);
+	  pthread_mutex_unlock (&writer_info->wr_list_mutex);
+	}
+
+      if (orig_mode == LOGWR_MODE_ASYNC || is_pipelined
 	  || (mode == LOGWR_MODE_ASYNC && (entry->status != LOGWR_STATUS_DELAY || status != LOGWR_STATUS_DONE)))
 	{
 	  logwr_cs_exit (thread_p, &check_cs_own);
@@ -2767,7 +2703,7 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
 	}
 
       /* Get the next request from the client and reset the arguments */
-      if (need_cs_exit_after_send == true)
+      if (need_cs_exit_after_send == true || is_pipelined)
 	{
 	  error_code =
 	    xlog_get_page_request_with_reply (thread_p, &next_fpageid, &next_mode,
@@ -2783,7 +2719,15 @@ xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MO
 	  goto error;
 	}
 
-      logwr_update_last_sent_eof_lsa (entry);
+      if (is_pipelined)
+	{
+	  /* the next request of a SYNC writer is the ack of the sent pages */
+	  logwr_receive_sync_ack (entry);
+	}
+      else
+	{
+	  logwr_update_last_sent_eof_lsa (entry);
+	}
 
       /* In case of sync mode, unregister the writer and wakeup LFT to finish */
       if (need_cs_exit_after_send)
@@ -2821,6 +2765,14 @@ error:
   logwr_cs_exit (thread_p, &check_cs_own);
   logwr_write_end (thread_p, writer_info, entry, status);
 
+  if (is_pipelined)
+    {
+      /* the writer entry is gone; release the commits waiting for its ack */
+      pthread_mutex_lock (&writer_info->ack_mutex);
+      pthread_cond_broadcast (&writer_info->ack_cond);
+      pthread_mutex_unlock (&writer_info->ack_mutex);
+    }
+
   db_private_free_and_init (thread_p, logpg_area);
 
   return error_code;
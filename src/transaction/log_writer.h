@@ -150,6 +150,7 @@ struct logwr_entry
   LOG_LSA tmp_last_sent_eof_lsa;
   INT64 start_copy_time;
   bool copy_from_first_phy_page;
+  bool is_in_sync;		/* SYNC writer keeping up with the flushes; commits wait for its acks (pipelined copy) */
   LOGWR_ENTRY *next;
 };
 
@@ -164,6 +165,8 @@ struct logwr_info
   pthread_mutex_t flush_wait_mutex;
   pthread_cond_t flush_end_cond;
   pthread_mutex_t flush_end_mutex;
+  pthread_cond_t ack_cond;	/* broadcast when a SYNC writer receives an ack (pipelined copy) */
+  pthread_mutex_t ack_mutex;
   bool skip_flush;
   bool flush_completed;
   bool is_init;
@@ -183,6 +186,8 @@ struct logwr_info
     , flush_wait_mutex PTHREAD_MUTEX_INITIALIZER
     , flush_end_cond PTHREAD_COND_INITIALIZER
     , flush_end_mutex PTHREAD_MUTEX_INITIALIZER
+    , ack_cond PTHREAD_COND_INITIALIZER
+    , ack_mutex PTHREAD_MUTEX_INITIALIZER
     , skip_flush (false)
     , flush_completed (false)
     , is_init (false)
@@ -207,6 +212,7 @@ extern void logwr_set_tde_algorithm (THREAD_ENTRY * thread_p, LOG_PAGE * log_pgp
 #if defined(SERVER_MODE)
 int xlogwr_get_log_pages (THREAD_ENTRY * thread_p, LOG_PAGEID first_pageid, LOGWR_MODE mode);
 extern LOG_PAGEID logwr_get_min_copied_fpageid (void);
+extern void logwr_wait_for_sync_ack (THREAD_ENTRY * thread_p, const LOG_LSA * lsa);
 
 #endif /* SERVER_MODE */
 #endif /* _LOG_WRITER_HEADER_ */
@@ -177,6 +177,9 @@ struct mvcc_snapshot
 
   bool valid;			/* true, if the snapshot is valid */
 
+  bool reusable;		/* true, if the active MVCCIDs are still those copied from transaction status */
+  unsigned int trans_status_version;	/* version of the transaction status copied, if reusable */
+
   // *INDENT-OFF*
   mvcc_snapshot ();
   void reset ();
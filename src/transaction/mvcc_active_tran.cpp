@@ -24,6 +24,7 @@
 
 #include "log_impl.h"
 
+#include <algorithm>
 #include <cstring>
 
 mvcc_active_tran::mvcc_active_tran ()
@@ -318,16 +319,10 @@ mvcc_active_tran::is_active (MVCCID mvccid) const
 {
   if (MVCC_ID_PRECEDES (mvccid, m_bit_area_start_mvccid))
     {
-      /* check long time transactions */
-      if (m_long_tran_mvccids != NULL)
+      /* check long time transactions; they are kept in ascending order (see add_long_transaction) */
+      if (m_long_tran_mvccids != NULL && m_long_tran_mvccids_length > 0)
 	{
-	  for (size_t i = 0; i < m_long_tran_mvccids_length; i++)
-	    {
-	      if (mvccid == m_long_tran_mvccids[i])
-		{
-		  return true;
-		}
-	    }
+	  return std::binary_search (m_long_tran_mvccids, m_long_tran_mvccids + m_long_tran_mvccids_length, mvccid);
 	}
       // is committed
       return false;
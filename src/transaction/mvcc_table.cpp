@@ -235,6 +235,7 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
   TSCTIMEVAL tv_diff;
   UINT64 snapshot_wait_time;
   UINT64 snapshot_retry_count = 0;
+  bool is_reused = false;
 
   assert (tdes.tran_index >= 0 && tdes.tran_index < logtb_get_number_of_total_tran_indices ());
 
@@ -295,6 +296,14 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
       const mvcc_trans_status &trans_status = m_trans_status_history[index];
 
       trans_status_version = trans_status.m_version.load ();
+      if (tdes.mvccinfo.snapshot.reusable && tdes.mvccinfo.snapshot.trans_status_version == trans_status_version)
+	{
+	  // nothing completed since previous snapshot of transaction (e.g. previous read committed statement); its
+	  // active MVCCIDs are still the current ones
+	  is_reused = true;
+	  break;
+	}
+      tdes.mvccinfo.snapshot.reusable = false;
       trans_status.m_active_mvccs.copy_to (tdes.mvccinfo.snapshot.m_active_mvccs,
 					   mvcc_active_tran::copy_safety::THREAD_UNSAFE);
       /* load statistics temporary disabled need to be enabled when activate count optimization */
@@ -320,11 +329,25 @@ mvcctable::build_mvcc_info (log_tdes &tdes)
 	}
     }
 
-  // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
-  tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
+  if (is_reused)
+    {
+      highest_completed_mvccid = tdes.mvccinfo.snapshot.highest_completed_mvccid;
+      if (is_perf_tracking)
+	{
+	  perfmon_inc_stat (thread_get_thread_entry_info (), PSTAT_LOG_SNAPSHOT_REUSED_COUNTERS);
+	}
+    }
+  else
+    {
+      // tdes.mvccinfo.snapshot.m_active_mvccs was not checked because it was not safe; now it is
+      tdes.mvccinfo.snapshot.m_active_mvccs.check_valid ();
 
-  highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
-  MVCCID_FORWARD (highest_completed_mvccid);
+      highest_completed_mvccid = tdes.mvccinfo.snapshot.m_active_mvccs.compute_highest_completed_mvccid ();
+      MVCCID_FORWARD (highest_completed_mvccid);
+
+      tdes.mvccinfo.snapshot.reusable = true;
+      tdes.mvccinfo.snapshot.trans_status_version = trans_status_version;
+    }
 
   /* update lowest active mvccid computed for the most recent snapshot */
   tdes.mvccinfo.recent_snapshot_lowest_active_mvccid = crt_status_lowest_active;
@@ -265,6 +265,23 @@ extern void rv_check_rvfuns (void);
    || (idx) == RVFL_TRACKER_HEAP_REUSE \
    || (idx) == RVFL_TRACKER_UNREGISTER)
 
+/* redo of these records only changes the page of the record, it can be applied in parallel with the redo of other
+ * pages */
+#define RCV_IS_PAGE_LOCAL_REDO(vpid, idx) \
+  (!RCV_IS_LOGICAL_LOG (vpid, idx) \
+   && (((idx) >= RVHF_CREATE_HEADER && (idx) <= RVBT_MARK_DEALLOC_PAGE) \
+       || (idx) == RVHF_APPEND_PAGES_TO_HEAP \
+       || (idx) == RVPGBUF_NEW_PAGE \
+       || (idx) == RVPGBUF_SET_TDE_ALGORITHM) \
+   && (idx) != RVBT_LOG_GLOBAL_UNIQUE_STATS_COMMIT \
+   && (idx) != RVBT_REMOVE_UNIQUE_STATS)
+
+/* redo of these records does not touch any page */
+#define RCV_IS_PAGE_INDEPENDENT_REDO(idx) \
+  ((idx) == RVLOG_OUTSIDE_LOGICAL_REDO_NOOP \
+   || (idx) == RVBT_LOG_GLOBAL_UNIQUE_STATS_COMMIT \
+   || (idx) == RVBT_REMOVE_UNIQUE_STATS)
+
 #define RCV_IS_NEW_PAGE_INIT(idx) \
   ((idx) == RVPGBUF_NEW_PAGE \
    || (idx) == RVDK_FORMAT \
@@ -78,6 +78,9 @@ LOCK tm_Tran_rep_read_lock = NULL_LOCK;	/* used in RR transaction locking to not
 LC_FETCH_VERSION_TYPE tm_Tran_read_fetch_instance_version = LC_FETCH_MVCC_VERSION;
 int tm_Tran_latest_query_status;
 
+/* authorization version the server reported when the latest transaction committed, 0 if not reported */
+unsigned int tm_Tran_authorization_version = 0;
+
 /* Timeout(milli seconds) for queries.
  *
  * JDBC can send a bundle of queries to a CAS by setting CCI_EXEC_QUERY_ALL flag.
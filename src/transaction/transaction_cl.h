@@ -62,6 +62,7 @@ extern bool tm_Use_OID_preflush;
 extern LOCK tm_Tran_rep_read_lock;
 extern LC_FETCH_VERSION_TYPE tm_Tran_read_fetch_instance_version;
 extern int tm_Tran_invalidate_snapshot;
+extern unsigned int tm_Tran_authorization_version;
 
 extern void tran_cache_tran_settings (int tran_index, int lock_timeout, TRAN_ISOLATION tran_isolation);
 extern void tran_get_tran_settings (int *lock_timeout_in_msecs, TRAN_ISOLATION * tran_isolation, bool * async_ws);
@@ -99,6 +99,8 @@ stx_init_xasl_unpack_info (THREAD_ENTRY *thread_p, char *xasl_stream, int xasl_s
   unpack_info->alloc_buf = (char *) unpack_info + head_offset;
   unpack_info->additional_buffers = NULL;
   unpack_info->track_allocated_bufers = 0;
+  unpack_info->use_xasl_clone = false;
+  unpack_info->is_stream_kept = false;
 #if defined (SERVER_MODE)
   unpack_info->thrd = thread_p;
 #endif /* SERVER_MODE */
@@ -285,6 +287,43 @@ stx_build_db_value (THREAD_ENTRY *thread_p, char *ptr, DB_VALUE *value)
   return ptr;
 }
 
+/*
+ * stx_build_constant_db_value () - build a constant value of the XASL tree
+ *
+ * note: when the stream is kept as long as the tree, a string or bit string constant points into the stream instead of
+ *	 being copied; a constant is never modified, since the XASL clones are executed more than once.
+ */
+char *
+stx_build_constant_db_value (THREAD_ENTRY *thread_p, char *ptr, DB_VALUE *value)
+{
+  XASL_UNPACK_INFO *unpack_info = get_xasl_unpack_info_ptr (thread_p);
+  OR_BUF buf;
+  TP_DOMAIN *domain;
+  int is_null = 0;
+  bool copy = true;
+
+  if (unpack_info == NULL || !unpack_info->is_stream_kept)
+    {
+      return stx_build_db_value (thread_p, ptr, value);
+    }
+
+  ptr = PTR_ALIGN (ptr, MAX_ALIGNMENT);
+
+  /* peek the domain tag */
+  or_init (&buf, ptr, 0);
+  domain = or_get_domain (&buf, NULL, &is_null);
+  if (domain != NULL && !is_null && TP_IS_CHAR_BIT_TYPE (TP_DOMAIN_TYPE (domain))
+      && TP_DOMAIN_COLLATION_FLAG (domain) == TP_DOMAIN_COLL_NORMAL)
+    {
+      copy = false;
+    }
+
+  or_init (&buf, ptr, 0);
+  or_get_value (&buf, value, NULL, -1, copy);
+
+  return buf.ptr;
+}
+
 char *
 stx_build_string (THREAD_ENTRY *thread_p, char *ptr, char *string)
 {
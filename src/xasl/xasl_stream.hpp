@@ -75,6 +75,7 @@ char *stx_build (THREAD_ENTRY *thread_p, char *ptr, regu_variable_node &reguvar)
 
 // dependencies not ported
 char *stx_build_db_value (THREAD_ENTRY *thread_p, char *tmp, db_value *ptr);
+char *stx_build_constant_db_value (THREAD_ENTRY *thread_p, char *tmp, db_value *ptr);
 char *stx_build_string (THREAD_ENTRY *thread_p, char *tmp, char *ptr);
 
 // restore string; return restored string, updates stream pointer
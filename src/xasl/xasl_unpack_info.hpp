@@ -75,6 +75,7 @@ struct xasl_unpack_info
   int track_allocated_bufers;
 
   bool use_xasl_clone;		/* true, if uses xasl clone */
+  bool is_stream_kept;		/* true, if packed_xasl is kept as long as the unpacked tree */
 };
 
 XASL_UNPACK_INFO *get_xasl_unpack_info_ptr (THREAD_ENTRY *thread_p);
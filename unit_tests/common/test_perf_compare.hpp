@@ -81,6 +81,15 @@ class perf_compare
     /* get step count */
     size_t get_step_count (void);
 
+    /* get the time registered for step_index step of scenario_index scenario, in microseconds */
+    inline unsigned long long get_time (size_t scenario_index, size_t step_index) const
+    {
+      custom_assert (scenario_index < m_scenario_names.get_count ());
+      custom_assert (step_index < m_step_names.get_count ());
+
+      return m_values[scenario_index][step_index];
+    }
+
   private:
     typedef unsigned long long value_type;
     typedef std::vector<value_type> value_container_type;
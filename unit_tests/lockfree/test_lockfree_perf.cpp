@@ -0,0 +1,693 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_lockfree_perf.cpp - scaling benchmark of lock-free structures against mutex baselines
+ *
+ *  lockfree::hashmap and the older lock_free.c hash table (LF_HASH) are compared to an std::unordered_map protected by
+ *  a mutex, for several read/write mixes and key space sizes. lockfree::freelist is compared to a vector of free
+ *  items protected by a mutex, and lockfree::circular_queue to an std::deque protected by a mutex.
+ *
+ *  Each step runs with a different number of threads and each thread does the same number of operations, so the time
+ *  of a step is flat as long as the structure scales. The lock-free structure is the first scenario, and a warning is
+ *  printed for each step where it is slower than a mutex baseline. Erase, retire and consume go through the
+ *  transaction system reclamation, so a regression there shows up as the thread count grows.
+ */
+
+#include "test_lockfree_perf.hpp"
+
+#include "test_perf_compare.hpp"
+#include "test_output.hpp"
+
+#include "lock_free.h"
+#include "lockfree_circular_queue.hpp"
+#include "lockfree_freelist.hpp"
+#include "lockfree_hashmap.hpp"
+#include "lockfree_transaction_system.hpp"
+
+/* this hack */
+#ifdef strlen
+#undef strlen
+#endif /* strlen */
+
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace lockfree;
+
+namespace test_lockfree
+{
+
+  /************************************************************************/
+  /* helpers                                                              */
+  /************************************************************************/
+
+  const unsigned int THREAD_COUNTS[] = { 1, 2, 4, 8, 16 };
+  test_common::string_collection thread_step_names ("1 thread", "2 threads", "4 threads", "8 threads",
+      "16 threads");
+
+  /* operations done by each thread in each step */
+  const size_t HASH_OPS_PER_THREAD = 200000;
+  const size_t FREELIST_OPS_PER_THREAD = 100000;
+  const size_t CQUEUE_OPS_PER_THREAD = 200000;
+
+  /* nodes claimed by a thread before retiring them all */
+  const size_t FREELIST_CLAIM_BATCH = 16;
+  const size_t CQUEUE_SIZE = 1024;
+
+  /* run job on thread_count threads and register the elapsed time of all of them */
+  template <typename Bench, typename Job>
+  static void
+  run_step (test_common::perf_compare &results, size_t scenario, size_t step, unsigned int thread_count,
+	    Bench &bench, const Job &job)
+  {
+    std::vector<std::thread> workers;
+    test_common::us_timer timer;
+    unsigned int i;
+
+    for (i = 0; i < thread_count; i++)
+      {
+	workers.emplace_back (job, std::ref (bench), i);
+      }
+    for (i = 0; i < thread_count; i++)
+      {
+	workers[i].join ();
+      }
+    results.register_time (timer, scenario, step);
+  }
+
+  static void
+  print_header (const std::string &title, size_t ops_per_thread)
+  {
+    std::cout << std::endl << "    " << title << ", " << ops_per_thread << " operations per thread" << std::endl
+	      << std::endl;
+  }
+
+  /************************************************************************/
+  /* hash tables                                                          */
+  /************************************************************************/
+
+  struct perf_entry
+  {
+    int m_key;
+    perf_entry *m_next;
+    perf_entry *m_rstack;
+    pthread_mutex_t m_mutex;
+    UINT64 m_delid;
+  };
+
+  static void *
+  alloc_perf_entry ()
+  {
+    return (void *) new perf_entry ();
+  }
+
+  static int
+  free_perf_entry (void *p)
+  {
+    delete (perf_entry *) p;
+    return 0;
+  }
+
+  static int
+  copy_perf_key (void *src, void *dest)
+  {
+    * (int *) dest = * (int *) src;
+    return 0;
+  }
+
+  static int
+  compare_perf_key (void *key1, void *key2)
+  {
+    return * (int *) key1 != * (int *) key2 ? 1 : 0;
+  }
+
+  static unsigned int
+  hash_perf_key (void *key, int hash_size)
+  {
+    return ((unsigned int) * (int *) key) % (unsigned int) hash_size;
+  }
+
+  static lf_entry_descriptor g_perf_edesc =
+  {
+    offsetof (perf_entry, m_rstack),
+    offsetof (perf_entry, m_next),
+    offsetof (perf_entry, m_delid),
+    offsetof (perf_entry, m_key),
+    offsetof (perf_entry, m_mutex),
+
+    LF_EM_NOT_USING_MUTEX,
+
+    alloc_perf_entry,
+    free_perf_entry,
+    NULL,
+    NULL,
+    copy_perf_key,
+    compare_perf_key,
+    hash_perf_key,
+    NULL
+  };
+
+  enum hash_scenario
+  {
+    HASH_LOCKFREE_HASHMAP,
+    HASH_LF_HASH,
+    HASH_MUTEX_MAP
+  };
+  test_common::string_collection hash_scenario_names ("lockfree::hashmap", "LF_HASH", "mutex + unordered_map");
+
+  /* read/write mixes, as percentage of the operations that are finds; the others are half inserts, half erases */
+  const size_t HASH_FIND_PERCENTS[] = { 90, 50, 10 };
+  const size_t HASH_KEY_SPACES[] = { 1024, 256 * 1024 };
+
+  /* the interface of all hash benchmarks */
+  class hash_bench
+  {
+    public:
+      hash_bench (size_t find_percent, size_t key_space)
+	: m_find_percent (find_percent)
+	, m_key_space (key_space)
+      {
+      }
+      virtual ~hash_bench () = default;
+
+      virtual void find (size_t thread_index, int key) = 0;
+      virtual void insert (size_t thread_index, int key) = 0;
+      virtual void erase (size_t thread_index, int key) = 0;
+
+      /* half of the keys are in the table before the step starts */
+      void populate ()
+      {
+	for (size_t key = 0; key < m_key_space; key += 2)
+	  {
+	    insert (0, (int) key);
+	  }
+      }
+
+      size_t m_find_percent;
+      size_t m_key_space;
+  };
+
+  class lockfree_hashmap_bench : public hash_bench
+  {
+    public:
+      lockfree_hashmap_bench (unsigned int thread_count, size_t find_percent, size_t key_space)
+	: hash_bench (find_percent, key_space)
+	, m_transys (thread_count)
+	, m_indexes ()
+	, m_hash ()
+      {
+	for (unsigned int i = 0; i < thread_count; i++)
+	  {
+	    m_indexes.push_back (m_transys.assign_index ());
+	  }
+	m_hash.init (m_transys, key_space, 100, 100, g_perf_edesc);
+	populate ();
+      }
+
+      ~lockfree_hashmap_bench () override
+      {
+	m_hash.destroy ();
+	for (tran::index index : m_indexes)
+	  {
+	    m_transys.free_index (index);
+	  }
+      }
+
+      void find (size_t thread_index, int key) override
+      {
+	perf_entry *entry = m_hash.find (m_indexes[thread_index], key);
+	if (entry != NULL)
+	  {
+	    m_hash.unlock (m_indexes[thread_index], entry);
+	  }
+      }
+
+      void insert (size_t thread_index, int key) override
+      {
+	perf_entry *entry = NULL;
+	(void) m_hash.find_or_insert (m_indexes[thread_index], key, entry);
+	m_hash.unlock (m_indexes[thread_index], entry);
+      }
+
+      void erase (size_t thread_index, int key) override
+      {
+	(void) m_hash.erase (m_indexes[thread_index], key);
+      }
+
+    private:
+      tran::system m_transys;
+      std::vector<tran::index> m_indexes;
+      hashmap<int, perf_entry> m_hash;
+  };
+
+  class lf_hash_bench : public hash_bench
+  {
+    public:
+      lf_hash_bench (unsigned int thread_count, size_t find_percent, size_t key_space)
+	: hash_bench (find_percent, key_space)
+	, m_transys ()
+	, m_tran_ents ()
+	, m_hash ()
+      {
+	lf_tran_system_init (&m_transys, (int) thread_count);
+	for (unsigned int i = 0; i < thread_count; i++)
+	  {
+	    m_tran_ents.push_back (lf_tran_request_entry (&m_transys));
+	  }
+	m_hash.init (m_transys, (int) key_space, 100, 100, g_perf_edesc);
+	populate ();
+      }
+
+      ~lf_hash_bench () override
+      {
+	m_hash.destroy ();
+	for (lf_tran_entry *t_entry : m_tran_ents)
+	  {
+	    lf_tran_return_entry (t_entry);
+	  }
+	lf_tran_system_destroy (&m_transys);
+      }
+
+      void find (size_t thread_index, int key) override
+      {
+	perf_entry *entry = m_hash.find (m_tran_ents[thread_index], key);
+	if (entry != NULL)
+	  {
+	    m_hash.unlock (m_tran_ents[thread_index], entry);
+	  }
+      }
+
+      void insert (size_t thread_index, int key) override
+      {
+	perf_entry *entry = NULL;
+	(void) m_hash.find_or_insert (m_tran_ents[thread_index], key, entry);
+	m_hash.unlock (m_tran_ents[thread_index], entry);
+      }
+
+      void erase (size_t thread_index, int key) override
+      {
+	(void) m_hash.erase (m_tran_ents[thread_index], key);
+      }
+
+    private:
+      lf_tran_system m_transys;
+      std::vector<lf_tran_entry *> m_tran_ents;
+      lf_hash_table_cpp<int, perf_entry> m_hash;
+  };
+
+  class mutex_map_bench : public hash_bench
+  {
+    public:
+      mutex_map_bench (unsigned int thread_count, size_t find_percent, size_t key_space)
+	: hash_bench (find_percent, key_space)
+	, m_mutex ()
+	, m_map (key_space)
+      {
+	populate ();
+      }
+
+      void find (size_t thread_index, int key) override
+      {
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	(void) m_map.find (key);
+      }
+
+      void insert (size_t thread_index, int key) override
+      {
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	(void) m_map.emplace (key, perf_entry ());
+      }
+
+      void erase (size_t thread_index, int key) override
+      {
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	(void) m_map.erase (key);
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::unordered_map<int, perf_entry> m_map;
+  };
+
+  static void
+  hash_job (hash_bench &bench, unsigned int thread_index)
+  {
+    std::mt19937 generator (thread_index);
+    std::uniform_int_distribution<int> key_dist (0, (int) bench.m_key_space - 1);
+    std::uniform_int_distribution<size_t> op_dist (0, 99);
+
+    for (size_t op = 0; op < HASH_OPS_PER_THREAD; op++)
+      {
+	int key = key_dist (generator);
+	size_t op_percent = op_dist (generator);
+
+	if (op_percent < bench.m_find_percent)
+	  {
+	    bench.find (thread_index, key);
+	  }
+	else if ((op_percent - bench.m_find_percent) % 2 == 0)
+	  {
+	    bench.insert (thread_index, key);
+	  }
+	else
+	  {
+	    bench.erase (thread_index, key);
+	  }
+      }
+  }
+
+  static void
+  test_hash_scaling (size_t find_percent, size_t key_space)
+  {
+    test_common::perf_compare results (hash_scenario_names, thread_step_names);
+
+    print_header ("hash tables: " + std::to_string (find_percent) + "% finds, " + std::to_string (key_space)
+		  + " keys", HASH_OPS_PER_THREAD);
+
+    for (size_t step = 0; step < thread_step_names.get_count (); step++)
+      {
+	unsigned int thread_count = THREAD_COUNTS[step];
+	{
+	  lockfree_hashmap_bench bench (thread_count, find_percent, key_space);
+	  run_step (results, HASH_LOCKFREE_HASHMAP, step, thread_count, bench, hash_job);
+	}
+	{
+	  lf_hash_bench bench (thread_count, find_percent, key_space);
+	  run_step (results, HASH_LF_HASH, step, thread_count, bench, hash_job);
+	}
+	{
+	  mutex_map_bench bench (thread_count, find_percent, key_space);
+	  run_step (results, HASH_MUTEX_MAP, step, thread_count, bench, hash_job);
+	}
+      }
+
+    results.print_results_and_warnings (std::cout);
+  }
+
+  /************************************************************************/
+  /* free lists                                                           */
+  /************************************************************************/
+
+  struct perf_item
+  {
+    size_t m_owner;
+
+    void on_reclaim () {}  // do nothing
+  };
+
+  enum freelist_scenario
+  {
+    FREELIST_LOCKFREE,
+    FREELIST_MUTEX
+  };
+  test_common::string_collection freelist_scenario_names ("lockfree::freelist", "mutex + vector");
+
+  class lockfree_freelist_bench
+  {
+    public:
+      lockfree_freelist_bench (unsigned int thread_count)
+	: m_transys (thread_count + 1)
+	, m_freelist (m_transys, thread_count * FREELIST_CLAIM_BATCH, 2)
+      {
+      }
+
+      void job (unsigned int thread_index)
+      {
+	tran::index index = m_transys.assign_index ();
+	std::vector<freelist<perf_item>::free_node *> claimed;
+
+	for (size_t op = 0; op < FREELIST_OPS_PER_THREAD; op += FREELIST_CLAIM_BATCH)
+	  {
+	    for (size_t i = 0; i < FREELIST_CLAIM_BATCH; i++)
+	      {
+		freelist<perf_item>::free_node *node = m_freelist.claim (index);
+		node->get_data ().m_owner = thread_index;
+		claimed.push_back (node);
+		m_freelist.get_transaction_table ().end_tran (index);
+	      }
+	    for (freelist<perf_item>::free_node *node : claimed)
+	      {
+		m_freelist.retire (index, *node);
+	      }
+	    claimed.clear ();
+	  }
+
+	m_transys.free_index (index);
+      }
+
+    private:
+      tran::system m_transys;
+      freelist<perf_item> m_freelist;
+  };
+
+  class mutex_freelist_bench
+  {
+    public:
+      mutex_freelist_bench (unsigned int thread_count)
+	: m_mutex ()
+	, m_available ()
+      {
+	m_available.reserve (thread_count * FREELIST_CLAIM_BATCH);
+      }
+
+      ~mutex_freelist_bench ()
+      {
+	for (perf_item *item : m_available)
+	  {
+	    delete item;
+	  }
+      }
+
+      void job (unsigned int thread_index)
+      {
+	std::vector<perf_item *> claimed;
+
+	for (size_t op = 0; op < FREELIST_OPS_PER_THREAD; op += FREELIST_CLAIM_BATCH)
+	  {
+	    for (size_t i = 0; i < FREELIST_CLAIM_BATCH; i++)
+	      {
+		perf_item *item = claim ();
+		item->m_owner = thread_index;
+		claimed.push_back (item);
+	      }
+	    for (perf_item *item : claimed)
+	      {
+		retire (item);
+	      }
+	    claimed.clear ();
+	  }
+      }
+
+    private:
+      perf_item *claim ()
+      {
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	if (m_available.empty ())
+	  {
+	    return new perf_item ();
+	  }
+	perf_item *item = m_available.back ();
+	m_available.pop_back ();
+	return item;
+      }
+
+      void retire (perf_item *item)
+      {
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	m_available.push_back (item);
+      }
+
+      std::mutex m_mutex;
+      std::vector<perf_item *> m_available;
+  };
+
+  template <typename Bench>
+  static void
+  freelist_job (Bench &bench, unsigned int thread_index)
+  {
+    bench.job (thread_index);
+  }
+
+  static void
+  test_freelist_scaling ()
+  {
+    test_common::perf_compare results (freelist_scenario_names, thread_step_names);
+
+    print_header ("free lists: claim " + std::to_string (FREELIST_CLAIM_BATCH) + " nodes, then retire them",
+		  FREELIST_OPS_PER_THREAD);
+
+    for (size_t step = 0; step < thread_step_names.get_count (); step++)
+      {
+	unsigned int thread_count = THREAD_COUNTS[step];
+	{
+	  lockfree_freelist_bench bench (thread_count);
+	  run_step (results, FREELIST_LOCKFREE, step, thread_count, bench, freelist_job<lockfree_freelist_bench>);
+	}
+	{
+	  mutex_freelist_bench bench (thread_count);
+	  run_step (results, FREELIST_MUTEX, step, thread_count, bench, freelist_job<mutex_freelist_bench>);
+	}
+      }
+
+    results.print_results_and_warnings (std::cout);
+  }
+
+  /************************************************************************/
+  /* circular queues                                                      */
+  /************************************************************************/
+
+  enum cqueue_scenario
+  {
+    CQUEUE_LOCKFREE,
+    CQUEUE_MUTEX
+  };
+  test_common::string_collection cqueue_scenario_names ("lockfree::circular_queue", "mutex + deque");
+
+  class lockfree_cqueue_bench
+  {
+    public:
+      lockfree_cqueue_bench ()
+	: m_cqueue (CQUEUE_SIZE)
+      {
+      }
+
+      bool produce (int value)
+      {
+	return m_cqueue.produce (value);
+      }
+
+      bool consume (int &value)
+      {
+	return m_cqueue.consume (value);
+      }
+
+    private:
+      circular_queue<int> m_cqueue;
+  };
+
+  class mutex_cqueue_bench
+  {
+    public:
+      mutex_cqueue_bench ()
+	: m_mutex ()
+	, m_queue ()
+      {
+      }
+
+      bool produce (int value)
+      {
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	if (m_queue.size () >= CQUEUE_SIZE)
+	  {
+	    return false;
+	  }
+	m_queue.push_back (value);
+	return true;
+      }
+
+      bool consume (int &value)
+      {
+	std::unique_lock<std::mutex> ulock (m_mutex);
+	if (m_queue.empty ())
+	  {
+	    return false;
+	  }
+	value = m_queue.front ();
+	m_queue.pop_front ();
+	return true;
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::deque<int> m_queue;
+  };
+
+  /* every thread produces an element and then consumes one; elements in queue never exceed the thread count, so
+   * both operations end up succeeding */
+  template <typename Bench>
+  static void
+  cqueue_job (Bench &bench, unsigned int thread_index)
+  {
+    int value;
+
+    for (size_t op = 0; op < CQUEUE_OPS_PER_THREAD; op += 2)
+      {
+	while (!bench.produce ((int) thread_index))
+	  {
+	    std::this_thread::yield ();
+	  }
+	while (!bench.consume (value))
+	  {
+	    std::this_thread::yield ();
+	  }
+      }
+  }
+
+  static void
+  test_cqueue_scaling ()
+  {
+    test_common::perf_compare results (cqueue_scenario_names, thread_step_names);
+
+    print_header ("circular queues: produce, then consume", CQUEUE_OPS_PER_THREAD);
+
+    for (size_t step = 0; step < thread_step_names.get_count (); step++)
+      {
+	unsigned int thread_count = THREAD_COUNTS[step];
+	{
+	  lockfree_cqueue_bench bench;
+	  run_step (results, CQUEUE_LOCKFREE, step, thread_count, bench, cqueue_job<lockfree_cqueue_bench>);
+	}
+	{
+	  mutex_cqueue_bench bench;
+	  run_step (results, CQUEUE_MUTEX, step, thread_count, bench, cqueue_job<mutex_cqueue_bench>);
+	}
+      }
+
+    results.print_results_and_warnings (std::cout);
+  }
+
+  /************************************************************************/
+  /* test                                                                 */
+  /************************************************************************/
+
+  int
+  test_lockfree_scaling_performance ()
+  {
+    std::cout << "test_lockfree_scaling_performance" << std::endl;
+
+    for (size_t key_space : HASH_KEY_SPACES)
+      {
+	for (size_t find_percent : HASH_FIND_PERCENTS)
+	  {
+	    test_hash_scaling (find_percent, key_space);
+	  }
+      }
+    test_freelist_scaling ();
+    test_cqueue_scaling ();
+
+    return 0;
+  }
+
+} // namespace test_lockfree
@@ -0,0 +1,31 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_lockfree_perf.hpp - scaling benchmark of lock-free structures against mutex baselines
+ */
+
+#ifndef _TEST_LOCKFREE_PERF_HPP_
+#define _TEST_LOCKFREE_PERF_HPP_
+
+namespace test_lockfree
+{
+  int test_lockfree_scaling_performance ();
+} // namespace test_lockfree
+
+#endif // !_TEST_LOCKFREE_PERF_HPP_
@@ -19,6 +19,7 @@
 #include "test_cqueue_functional.hpp"
 #include "test_freelist_functional.hpp"
 #include "test_hashmap.hpp"
+#include "test_lockfree_perf.hpp"
 
 #include <string>
 #include <vector>
@@ -32,7 +33,8 @@ main (int argc, char **argv)
     "all",
     "cqueue",
     "freelist",
-    "hashmap"
+    "hashmap",
+    "scaling"
   };
   if (argc >= 2)
     {
@@ -89,6 +91,10 @@ main (int argc, char **argv)
 	  err = err | test_lockfree::test_hashmap_performance ();
 	}
     }
+  if (opt == 0 || opt == 4)
+    {
+      err = err | test_lockfree::test_lockfree_scaling_performance ();
+    }
 
   return err;
 }
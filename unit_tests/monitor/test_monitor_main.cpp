@@ -505,10 +505,51 @@ test_counter_timer_max (void)
   assert (statsp[3] == 4);    // average of 4 microseconds
 }
 
+void
+test_histogram (void)
+{
+  using namespace cubmonitor;
+
+  histogram_statistic my_stat;
+  monitor my_monitor;
+
+  // register
+  my_stat.register_to_monitor (my_monitor, "mystat");
+
+  // allocate statistics
+  statistic_value *statsp = my_monitor.allocate_statistics_buffer ();
+
+  // one event for each duration from 1 to 100 microseconds
+  for (int usec = 1; usec <= 100; usec++)
+    {
+      my_stat.collect (std::chrono::microseconds (usec));
+    }
+
+  // get statistics; percentiles are bucket upper bounds
+  my_monitor.fetch_global_statistics (statsp);
+  assert (statsp[0] == 100);  // count
+  assert (statsp[1] == 51);   // p50, bucket [50, 51]
+  assert (statsp[2] == 91);   // p90, bucket [88, 91]
+  assert (statsp[3] == 99);   // p99, bucket [96, 99]
+  assert (statsp[4] == 103);  // p99.9, bucket [100, 103]
+  assert (statsp[5] == 103);  // max
+  assert (my_stat.get_count () == 100);
+
+  // tiny and huge durations
+  histogram_statistic edge_stat;
+  edge_stat.collect (time_rep (0));
+  assert (edge_stat.get_percentile (100.0) == time_rep (0));
+  edge_stat.collect (std::chrono::hours (24 * 365 * 100));
+  assert (edge_stat.get_count () == 2);
+  assert (edge_stat.get_percentile (50.0) == time_rep (0));
+  assert (edge_stat.get_percentile (100.0) > std::chrono::hours (24));   // capped to last bucket
+}
+
 void
 test_collect (void)
 {
   test_counter_timer_max ();
+  test_histogram ();
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,8 @@ int main ()
 
   test_module (global_error, test_packing::test_packing_all);
 
+  test_module (global_error, test_packing::test_packing_segments);
+
   /* add more tests here */
 
   return global_error;
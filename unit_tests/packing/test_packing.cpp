@@ -25,6 +25,8 @@
 #include "thread_compat.hpp"
 #include "thread_manager.hpp"
 
+#include <cstring>
+
 namespace test_packing
 {
 
@@ -456,4 +458,54 @@ namespace test_packing
 
     return NO_ERROR;
   }
+
+  int test_packing_segments (void)
+  {
+    po1 po_pack_1;
+    po1 po_pack_2;
+    po1 po_unpack_1;
+    po1 po_unpack_2;
+
+    po_pack_1.generate_obj ();
+    po_pack_2.generate_obj ();
+
+    // pack same objects without and with references to their large strings
+    cubpacking::packer serializer;
+    cubpacking::packer segment_serializer;
+    cubmem::extensible_block eb;
+    cubmem::extensible_block segment_eb;
+
+    serializer.set_buffer_and_pack_all (eb, po_pack_1, po_pack_1.str1, po_pack_2);
+
+    segment_serializer.set_reference_min_size (1000);
+    segment_serializer.set_buffer_and_pack_all (segment_eb, po_pack_1, po_pack_1.str1, po_pack_2);
+
+    std::vector<cubpacking::packed_segment> segments;
+    segment_serializer.get_segments (segments);
+
+    std::string gathered;
+    for (const cubpacking::packed_segment &seg : segments)
+      {
+	gathered.append (seg.m_ptr, seg.m_size);
+      }
+
+    if (gathered.size () != serializer.get_current_size ()
+	|| std::memcmp (gathered.c_str (), serializer.get_buffer_start (), gathered.size ()) != 0)
+      {
+	assert (false);
+	return ER_FAILED;
+      }
+
+    std::string str1_unpack;
+    cubpacking::unpacker deserializer (gathered.c_str (), gathered.size ());
+    deserializer.unpack_all (po_unpack_1, str1_unpack, po_unpack_2);
+
+    if (!po_pack_1.is_equal (&po_unpack_1) || po_pack_1.str1 != str1_unpack || !po_pack_2.is_equal (&po_unpack_2))
+      {
+	assert (false);
+	return ER_FAILED;
+      }
+
+    return NO_ERROR;
+  }
 }
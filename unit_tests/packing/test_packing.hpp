@@ -32,6 +32,8 @@ namespace test_packing
 
   int test_packing_all (void);
 
+  int test_packing_segments (void);
+
   class buffer_manager : public cubbase::pinner
   {
     private:
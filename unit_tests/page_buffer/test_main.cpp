@@ -0,0 +1,110 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+#include "test_page_buffer_perf.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+static void
+print_usage (const char *program)
+{
+  std::cout << "usage: " << program << " <database> [options]" << std::endl;
+  std::cout << "  -t <count>     threads (default: hardware threads)" << std::endl;
+  std::cout << "  -a <pattern>   uniform, zipfian or scan (default: zipfian)" << std::endl;
+  std::cout << "  -z <theta>     zipfian skew, between 0 and 1 (default: 0.99)" << std::endl;
+  std::cout << "  -w <percent>   fixes for write (default: 10)" << std::endl;
+  std::cout << "  -r <ratio>     pages fixed / page buffer size (default: 2.0)" << std::endl;
+  std::cout << "  -n <count>     fixes per thread (default: 1000000)" << std::endl;
+  std::cout << "database is booted by the benchmark and must not be in use; page buffer size is data_buffer_size "
+	    << "of its configuration." << std::endl;
+}
+
+int
+main (int argc, char **argv)
+{
+  test_page_buffer::config conf;
+  int i;
+
+  if (argc < 2 || argv[1][0] == '-')
+    {
+      print_usage (argv[0]);
+      return 0;
+    }
+  conf.db_name = argv[1];
+
+  for (i = 2; i + 1 < argc; i += 2)
+    {
+      const char *value = argv[i + 1];
+
+      if (std::strcmp (argv[i], "-t") == 0)
+	{
+	  conf.thread_count = (unsigned int) std::atoi (value);
+	}
+      else if (std::strcmp (argv[i], "-a") == 0)
+	{
+	  if (std::strcmp (value, "uniform") == 0)
+	    {
+	      conf.pattern = test_page_buffer::ACCESS_UNIFORM;
+	    }
+	  else if (std::strcmp (value, "zipfian") == 0)
+	    {
+	      conf.pattern = test_page_buffer::ACCESS_ZIPFIAN;
+	    }
+	  else if (std::strcmp (value, "scan") == 0)
+	    {
+	      conf.pattern = test_page_buffer::ACCESS_SCAN;
+	    }
+	  else
+	    {
+	      print_usage (argv[0]);
+	      return 1;
+	    }
+	}
+      else if (std::strcmp (argv[i], "-z") == 0)
+	{
+	  conf.zipf_theta = std::atof (value);
+	}
+      else if (std::strcmp (argv[i], "-w") == 0)
+	{
+	  conf.write_percent = std::atoi (value);
+	}
+      else if (std::strcmp (argv[i], "-r") == 0)
+	{
+	  conf.data_to_pool_ratio = std::atof (value);
+	}
+      else if (std::strcmp (argv[i], "-n") == 0)
+	{
+	  conf.fix_count = (unsigned int) std::atoi (value);
+	}
+      else
+	{
+	  print_usage (argv[0]);
+	  return 1;
+	}
+    }
+  if (i < argc || conf.thread_count == 0 || conf.fix_count == 0 || conf.write_percent < 0 || conf.write_percent > 100
+      || conf.zipf_theta <= 0 || conf.zipf_theta >= 1 || conf.data_to_pool_ratio <= 0)
+    {
+      print_usage (argv[0]);
+      return 1;
+    }
+
+  return test_page_buffer::test_page_buffer_performance (conf);
+}
@@ -0,0 +1,480 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_page_buffer_perf.cpp - benchmark of page buffer fix and unfix
+ *
+ *  The database server is booted in this process, without network. A temporary file with as many pages as the page
+ *  buffer size times the given ratio is allocated, then each worker thread fixes and unfixes its pages with the given
+ *  access pattern; a part of the fixes are for write and set the page dirty.
+ *  The benchmark reports fixes per second, the hit ratio and victimizations of the page buffer during the run and the
+ *  percentiles of the time to fix and unfix a page.
+ *  Pages are temporary, so they are not logged; everything else about fix, replacement and flush is the same as for
+ *  permanent pages.
+ */
+
+#include "test_page_buffer_perf.hpp"
+
+#include "boot_sr.h"
+#include "critical_section.h"
+#include "error_manager.h"
+#include "file_manager.h"
+#include "internal_tasks_worker_pool.hpp"
+#include "log_impl.h"
+#include "message_catalog.h"
+#include "page_buffer.h"
+#include "perf_monitor.h"
+#include "system_parameter.h"
+#include "thread_entry_task.hpp"
+#include "thread_manager.hpp"
+#include "tz_support.h"
+#include "xserver_interface.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace test_page_buffer
+{
+
+  /************************************************************************/
+  /* helpers                                                              */
+  /************************************************************************/
+
+  config::config ()
+    : db_name ()
+    , thread_count (std::thread::hardware_concurrency () != 0 ? std::thread::hardware_concurrency () : 4)
+    , pattern (ACCESS_ZIPFIAN)
+    , zipf_theta (0.99)
+    , write_percent (10)
+    , data_to_pool_ratio (2.0)
+    , fix_count (1000000)
+  {
+  }
+
+  /* zipfian page index generator of Gray et al, "Quickly generating billion-record synthetic databases". Page 0 is
+   * the hottest. */
+  class zipf_generator
+  {
+    public:
+      zipf_generator (std::size_t count, double theta)
+	: m_count (count)
+	, m_theta (theta)
+	, m_alpha (1.0 / (1.0 - theta))
+	, m_zetan (zeta (count, theta))
+	, m_eta (0)
+      {
+	m_eta = (1.0 - std::pow (2.0 / (double) count, 1.0 - theta)) / (1.0 - zeta (2, theta) / m_zetan);
+      }
+
+      std::size_t next (double uniform) const
+      {
+	double uz = uniform * m_zetan;
+	std::size_t index;
+
+	if (uz < 1.0)
+	  {
+	    return 0;
+	  }
+	if (uz < 1.0 + std::pow (0.5, m_theta))
+	  {
+	    return std::min<std::size_t> (1, m_count - 1);
+	  }
+	index = (std::size_t) ((double) m_count * std::pow (m_eta * uniform - m_eta + 1.0, m_alpha));
+	return std::min (index, m_count - 1);
+      }
+
+    private:
+      static double zeta (std::size_t count, double theta)
+      {
+	double sum = 0;
+	for (std::size_t i = 1; i <= count; i++)
+	  {
+	    sum += 1.0 / std::pow ((double) i, theta);
+	  }
+	return sum;
+      }
+
+      std::size_t m_count;
+      double m_theta;
+      double m_alpha;
+      double m_zetan;
+      double m_eta;
+  };
+
+  /* results of one worker */
+  struct worker_result
+  {
+    std::vector<std::uint32_t> latencies;   // nanoseconds of each fix and unfix
+    int error;
+
+    worker_result ()
+      : latencies ()
+      , error (NO_ERROR)
+    {
+    }
+  };
+
+  /* wait for all workers to finish */
+  class completion
+  {
+    public:
+      completion (unsigned int count)
+	: m_mutex ()
+	, m_condvar ()
+	, m_count (count)
+      {
+      }
+
+      void notify (void)
+      {
+	std::unique_lock<std::mutex> lock (m_mutex);
+	if (--m_count == 0)
+	  {
+	    m_condvar.notify_all ();
+	  }
+      }
+
+      void wait (void)
+      {
+	std::unique_lock<std::mutex> lock (m_mutex);
+	m_condvar.wait (lock, [this] { return m_count == 0; });
+      }
+
+    private:
+      std::mutex m_mutex;
+      std::condition_variable m_condvar;
+      unsigned int m_count;
+  };
+
+  /* fix and unfix pages with the configured access, on a worker thread */
+  class fix_task : public cubthread::entry_task
+  {
+    public:
+      fix_task (const config &conf, const std::vector<VPID> &vpids, const zipf_generator &zipf, unsigned int index,
+		worker_result &result, completion &done)
+	: m_conf (conf)
+	, m_vpids (vpids)
+	, m_zipf (zipf)
+	, m_index (index)
+	, m_result (result)
+	, m_done (done)
+      {
+      }
+
+      void execute (cubthread::entry &context) override
+      {
+	std::mt19937_64 random (m_index + 1);
+	std::uniform_real_distribution<double> uniform (0.0, 1.0);
+	std::uniform_int_distribution<int> percent (0, 99);
+	std::size_t page_count = m_vpids.size ();
+	std::size_t scan_index = (page_count / m_conf.thread_count) * m_index;
+	std::size_t page_index;
+	bool is_write;
+	PAGE_PTR pgptr;
+
+	logtb_set_to_system_tran_index (&context);
+	m_result.latencies.reserve (m_conf.fix_count);
+
+	for (unsigned int i = 0; i < m_conf.fix_count; i++)
+	  {
+	    switch (m_conf.pattern)
+	      {
+	      case ACCESS_UNIFORM:
+		page_index = (std::size_t) (uniform (random) * page_count) % page_count;
+		break;
+	      case ACCESS_ZIPFIAN:
+		page_index = m_zipf.next (uniform (random));
+		break;
+	      case ACCESS_SCAN:
+	      default:
+		page_index = scan_index++ % page_count;
+		break;
+	      }
+	    is_write = percent (random) < m_conf.write_percent;
+
+	    auto start = std::chrono::steady_clock::now ();
+
+	    pgptr = pgbuf_fix (&context, &m_vpids[page_index], OLD_PAGE,
+			       is_write ? PGBUF_LATCH_WRITE : PGBUF_LATCH_READ, PGBUF_UNCONDITIONAL_LATCH);
+	    if (pgptr == NULL)
+	      {
+		ASSERT_ERROR_AND_SET (m_result.error);
+		break;
+	      }
+	    if (is_write)
+	      {
+		pgbuf_set_dirty (&context, pgptr, DONT_FREE);
+	      }
+	    pgbuf_unfix (&context, pgptr);
+
+	    auto nsecs = std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now () - start);
+	    m_result.latencies.push_back ((std::uint32_t) std::min<std::int64_t> (nsecs.count (), UINT32_MAX));
+	  }
+
+	m_done.notify ();
+      }
+
+    private:
+      const config &m_conf;
+      const std::vector<VPID> &m_vpids;
+      const zipf_generator &m_zipf;
+      unsigned int m_index;
+      worker_result &m_result;
+      completion &m_done;
+  };
+
+  static const char *
+  get_pattern_name (const config &conf)
+  {
+    switch (conf.pattern)
+      {
+      case ACCESS_UNIFORM:
+	return "uniform";
+      case ACCESS_ZIPFIAN:
+	return "zipfian";
+      case ACCESS_SCAN:
+      default:
+	return "scan";
+      }
+  }
+
+  static UINT64
+  get_stat_diff (const UINT64 *after, const UINT64 *before, PERF_STAT_ID psid)
+  {
+    int offset = pstat_Metadata[psid].start_offset;
+    return after[offset] - before[offset];
+  }
+
+  /* print throughput, page buffer statistics and latency percentiles of the run */
+  static void
+  print_results (const config &conf, std::vector<worker_result> &results, const UINT64 *before, const UINT64 *after,
+		 double elapsed_sec)
+  {
+    std::vector<std::uint32_t> latencies;
+    std::ostringstream out;
+    UINT64 fetches = get_stat_diff (after, before, PSTAT_PB_NUM_FETCHES);
+    UINT64 ioreads = get_stat_diff (after, before, PSTAT_PB_NUM_IOREADS);
+    UINT64 victims = get_stat_diff (after, before, PSTAT_PB_ALLOC_BCB_SEARCH_VICTIM);
+    double fixes;
+
+    for (worker_result &result : results)
+      {
+	latencies.insert (latencies.end (), result.latencies.begin (), result.latencies.end ());
+      }
+    std::sort (latencies.begin (), latencies.end ());
+    fixes = (double) latencies.size ();
+    if (latencies.empty () || elapsed_sec <= 0)
+      {
+	return;
+      }
+
+    out << std::fixed << std::setprecision (2);
+    out << "    fixes/s             : " << std::setprecision (0) << fixes / elapsed_sec << std::setprecision (2)
+	<< std::endl;
+    out << "    hit ratio           : " << (fetches > 0 ? 100.0 * (double) (fetches - std::min (ioreads, fetches))
+					   / (double) fetches : 0.0) << "%" << std::endl;
+    out << "    victimizations      : " << victims << " (" << 1000.0 * (double) victims / fixes
+	<< " per 1000 fixes, " << std::setprecision (0) << (double) victims / elapsed_sec << "/s)"
+	<< std::setprecision (2) << std::endl;
+    out << "    fix+unfix (usec)    :";
+    for (double percent : { 50.0, 90.0, 99.0, 99.9 })
+      {
+	std::size_t index = std::min (latencies.size () - 1, (std::size_t) (percent / 100 * latencies.size ()));
+	out << " p" << std::setprecision (percent == 99.9 ? 1 : 0) << percent << " " << std::setprecision (2)
+	    << latencies[index] / 1000.0 << ",";
+      }
+    out << " max " << latencies.back () / 1000.0 << std::endl << std::endl;
+
+    std::cout << out.str ();
+  }
+
+  /* allocate the pages of a temporary file */
+  static int
+  alloc_pages (THREAD_ENTRY * thread_p, std::size_t page_count, VFID &vfid, std::vector<VPID> &vpids)
+  {
+    PAGE_TYPE ptype = PAGE_QRESULT;
+    int error;
+
+    error = file_create_temp (thread_p, (int) page_count, &vfid);
+    if (error != NO_ERROR)
+      {
+	return error;
+      }
+    vpids.resize (page_count);
+    return file_alloc_multiple (thread_p, &vfid, file_init_temp_page_type, &ptype, (int) page_count, vpids.data ());
+  }
+
+  /* run fixes on all threads and print results */
+  static int
+  run_benchmark (THREAD_ENTRY * thread_p, const config &conf)
+  {
+    std::size_t pool_pages = (std::size_t) prm_get_integer_value (PRM_ID_PB_NBUFFERS);
+    std::size_t page_count = std::max<std::size_t> (1, (std::size_t) (pool_pages * conf.data_to_pool_ratio));
+    std::vector<VPID> vpids;
+    std::vector<worker_result> results (conf.thread_count);
+    completion done (conf.thread_count);
+    cubthread::entry_workpool *workpool;
+    UINT64 *before = NULL, *after = NULL;
+    VFID vfid = VFID_INITIALIZER;
+    int error;
+
+    std::cout << "    threads: " << conf.thread_count << ", access: " << get_pattern_name (conf);
+    if (conf.pattern == ACCESS_ZIPFIAN)
+      {
+	std::cout << " (theta " << conf.zipf_theta << ")";
+      }
+    std::cout << ", writes: " << conf.write_percent << "%, pages: " << page_count << " (" << conf.data_to_pool_ratio
+	      << " x page buffer of " << pool_pages << "), fixes per thread: " << conf.fix_count << std::endl
+	      << std::endl;
+
+    error = alloc_pages (thread_p, page_count, vfid, vpids);
+    if (error != NO_ERROR)
+      {
+	goto end;
+      }
+
+    before = perfmon_allocate_values ();
+    after = perfmon_allocate_values ();
+    if (before == NULL || after == NULL)
+      {
+	error = ER_OUT_OF_VIRTUAL_MEMORY;
+	goto end;
+      }
+
+    workpool = cubthread::get_manager ()->create_worker_pool (conf.thread_count, conf.thread_count,
+	       "page buffer benchmark", NULL, 1, false);
+    if (workpool == NULL)
+      {
+	std::cout << "    not enough thread entries for " << conf.thread_count << " threads" << std::endl;
+	error = ER_FAILED;
+	goto end;
+      }
+
+    {
+      zipf_generator zipf (page_count, conf.zipf_theta);
+
+      perfmon_start_watch (thread_p);
+      xperfmon_server_copy_global_stats (before);
+      auto start = std::chrono::steady_clock::now ();
+
+      for (unsigned int i = 0; i < conf.thread_count; i++)
+	{
+	  cubthread::get_manager ()->push_task (workpool, new fix_task (conf, vpids, zipf, i, results[i], done));
+	}
+      done.wait ();
+
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now () - start;
+      xperfmon_server_copy_global_stats (after);
+      perfmon_stop_watch (thread_p);
+
+      cubthread::get_manager ()->destroy_worker_pool (workpool);
+
+      for (worker_result &result : results)
+	{
+	  if (result.error != NO_ERROR)
+	    {
+	      error = result.error;
+	      goto end;
+	    }
+	}
+      print_results (conf, results, before, after, elapsed.count ());
+    }
+
+end:
+    if (!VFID_ISNULL (&vfid))
+      {
+	(void) file_temp_retire (thread_p, &vfid);
+      }
+    if (before != NULL)
+      {
+	free_and_init (before);
+      }
+    if (after != NULL)
+      {
+	free_and_init (after);
+      }
+    return error;
+  }
+
+  /************************************************************************/
+  /* test                                                                 */
+  /************************************************************************/
+
+  int
+  test_page_buffer_performance (const config &conf)
+  {
+    CHECK_ARGS check_coll_and_timezone = { true, true };
+    THREAD_ENTRY *thread_p = NULL;
+    int error = NO_ERROR;
+
+    std::cout << "test_page_buffer_performance" << std::endl << std::endl;
+
+    /* boot like net_server_start, without network */
+    if (er_init (NULL, ER_NEVER_EXIT) != NO_ERROR)
+      {
+	return ER_FAILED;
+      }
+    cubthread::initialize (thread_p);
+    cubthread::internal_tasks_worker_pool::initialize ();
+
+    if (msgcat_init () != NO_ERROR || tz_load () != NO_ERROR)
+      {
+	error = ER_FAILED;
+	goto end;
+      }
+    sysprm_load_and_init (NULL, NULL, SYSPRM_LOAD_ALL);
+    if (sync_initialize_sync_stats () != NO_ERROR || csect_initialize_static_critical_sections () != NO_ERROR)
+      {
+	error = ER_FAILED;
+	goto end;
+      }
+
+    error = boot_restart_server (thread_p, false, conf.db_name.c_str (), false, &check_coll_and_timezone, NULL, true);
+    if (error == NO_ERROR)
+      {
+	logtb_set_to_system_tran_index (thread_p);
+	error = run_benchmark (thread_p, conf);
+	(void) xboot_shutdown_server (thread_p, ER_THREAD_FINAL);
+      }
+
+end:
+    if (error != NO_ERROR)
+      {
+	std::cout << "    benchmark failed: " << er_msg () << std::endl;
+      }
+
+    cubthread::finalize ();
+    cubthread::internal_tasks_worker_pool::finalize ();
+    er_final (ER_ALL_FINAL);
+    csect_finalize_static_critical_sections ();
+    (void) sync_finalize_sync_stats ();
+
+    return error;
+  }
+
+}  // namespace test_page_buffer
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_page_buffer_perf.hpp - benchmark of page buffer fix and unfix
+ */
+
+#ifndef _TEST_PAGE_BUFFER_PERF_HPP_
+#define _TEST_PAGE_BUFFER_PERF_HPP_
+
+#include <string>
+
+namespace test_page_buffer
+{
+
+  enum access_pattern
+  {
+    ACCESS_UNIFORM,         // every page is equally likely to be fixed
+    ACCESS_ZIPFIAN,         // few pages are fixed most of the time
+    ACCESS_SCAN             // each thread fixes all pages in order, from its own start page
+  };
+
+  struct config
+  {
+    std::string db_name;
+    unsigned int thread_count;
+    access_pattern pattern;
+    double zipf_theta;            // skew of zipfian access; the closer to 1, the fewer hot pages
+    int write_percent;            // fixes with write latch that set the page dirty
+    double data_to_pool_ratio;    // pages fixed / page buffer size
+    unsigned int fix_count;       // fixes per thread
+
+    config ();
+  };
+
+  // boot database server in this process, run fixes and report results. database must not be in use.
+  int test_page_buffer_performance (const config &conf);
+
+}  // namespace test_page_buffer
+
+#endif // !_TEST_PAGE_BUFFER_PERF_HPP_
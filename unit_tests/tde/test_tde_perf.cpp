@@ -0,0 +1,359 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_tde_perf.cpp - benchmark of TDE page encryption and decryption
+ *
+ *  Data pages (perm and temp) and log pages are encrypted and decrypted with AES-256-CTR and ARIA-256-CTR,
+ *  for several page sizes, with one and as many threads as cores, and with warm and cold cipher contexts.
+ *  A cold run drops the cipher contexts cached by the threads before every page, so the cost to set up a key is
+ *  included for every page. Decrypted pages are compared to the original ones.
+ */
+
+#include "test_tde_perf.hpp"
+
+#include "test_perf_compare.hpp"
+#include "test_output.hpp"
+
+#include "error_code.h"
+#include "file_io.h"
+#include "log_storage.hpp"
+#include "storage_common.h"
+#include "tde.h"
+
+#include <openssl/rand.h>
+
+/* this hack */
+#ifdef strlen
+#undef strlen
+#endif /* strlen */
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace test_tde
+{
+
+  /************************************************************************/
+  /* helpers                                                              */
+  /************************************************************************/
+
+  /* pages processed by each thread in each step */
+  const size_t PAGE_COUNT = 8 * 1024;
+  /* pages are used round-robin from a pool of this size */
+  const size_t PAGE_POOL_SIZE = 64;
+
+  const PGLENGTH page_sizes[] = { 4 * 1024, 8 * 1024, 16 * 1024 };
+
+  const TDE_ALGORITHM algorithms[] = { TDE_ALGORITHM_AES, TDE_ALGORITHM_ARIA };
+  test_common::string_collection algorithm_names ("AES-256-CTR", "ARIA-256-CTR");
+
+  enum step
+  {
+    STEP_ENCRYPT_PERM,
+    STEP_DECRYPT_PERM,
+    STEP_ENCRYPT_TEMP,
+    STEP_DECRYPT_TEMP,
+    STEP_ENCRYPT_LOG,
+    STEP_DECRYPT_LOG,
+    STEP_COUNT
+  };
+  test_common::string_collection step_names ("Encrypt perm pages", "Decrypt perm pages", "Encrypt temp pages",
+      "Decrypt temp pages", "Encrypt log pages", "Decrypt log pages");
+
+  /* a pool of pages: plain, encrypted and decrypted back */
+  class page_pool
+  {
+    public:
+      page_pool (size_t page_size)
+	: m_page_size (page_size)
+	, m_plain (page_size * PAGE_POOL_SIZE)
+	, m_cipher (page_size * PAGE_POOL_SIZE)
+	, m_decrypted (page_size * PAGE_POOL_SIZE)
+      {
+	RAND_bytes ((unsigned char *) m_plain.data (), (int) m_plain.size ());
+      }
+
+      inline char *plain (size_t index)
+      {
+	return m_plain.data () + (index % PAGE_POOL_SIZE) * m_page_size;
+      }
+
+      inline char *cipher (size_t index)
+      {
+	return m_cipher.data () + (index % PAGE_POOL_SIZE) * m_page_size;
+      }
+
+      inline char *decrypted (size_t index)
+      {
+	return m_decrypted.data () + (index % PAGE_POOL_SIZE) * m_page_size;
+      }
+
+      inline bool check_decrypted (void) const
+      {
+	return m_plain == m_decrypted;
+      }
+
+    private:
+      size_t m_page_size;
+      std::vector<char> m_plain;
+      std::vector<char> m_cipher;
+      std::vector<char> m_decrypted;
+  };
+
+  /* set random data keys on tde_Cipher, no database is needed */
+  static void
+  load_test_cipher (void)
+  {
+    RAND_bytes (tde_Cipher.data_keys.perm_key, TDE_DATA_KEY_LENGTH);
+    RAND_bytes (tde_Cipher.data_keys.temp_key, TDE_DATA_KEY_LENGTH);
+    RAND_bytes (tde_Cipher.data_keys.log_key, TDE_DATA_KEY_LENGTH);
+    std::memcpy (tde_Cipher.perm_keys[TDE_PERM_KEY_SLOT (0)], tde_Cipher.data_keys.perm_key, TDE_DATA_KEY_LENGTH);
+    tde_Cipher.perm_key_gen = 0;
+    tde_Cipher.is_rekeying = false;
+    tde_Cipher.temp_write_counter = 0;
+    tde_Cipher.is_loaded = true;
+  }
+
+  /* drop the cipher contexts cached by the threads */
+  static inline void
+  make_contexts_cold (bool is_cold)
+  {
+    if (is_cold)
+      {
+	(void) ATOMIC_INC_64 (&tde_Cipher.dks_version, 1);
+      }
+  }
+
+  /* time en/decryption of data pages of a file type */
+  static int
+  test_data_pages (test_common::perf_compare &results, test_common::us_timer &timer, size_t algo_index,
+		   bool is_cold, bool is_temp, page_pool &pages)
+  {
+    TDE_ALGORITHM tde_algo = algorithms[algo_index];
+    FILEIO_PAGE *iopage;
+    size_t i;
+
+    for (i = 0; i < PAGE_POOL_SIZE; i++)
+      {
+	iopage = (FILEIO_PAGE *) pages.plain (i);
+	iopage->prv.lsa.pageid = (LOG_PAGEID) i;
+	iopage->prv.lsa.offset = 0;
+	iopage->prv.tde_dk_gen = 0;
+      }
+    timer.reset ();
+
+    for (i = 0; i < PAGE_COUNT; i++)
+      {
+	make_contexts_cold (is_cold);
+	if (tde_encrypt_data_page ((FILEIO_PAGE *) pages.plain (i), tde_algo, is_temp,
+				   (FILEIO_PAGE *) pages.cipher (i)) != NO_ERROR)
+	  {
+	    return ER_FAILED;
+	  }
+      }
+    results.register_time (timer, algo_index, is_temp ? STEP_ENCRYPT_TEMP : STEP_ENCRYPT_PERM);
+
+    for (i = 0; i < PAGE_COUNT; i++)
+      {
+	make_contexts_cold (is_cold);
+	if (tde_decrypt_data_page ((FILEIO_PAGE *) pages.cipher (i), tde_algo, is_temp,
+				   (FILEIO_PAGE *) pages.decrypted (i)) != NO_ERROR)
+	  {
+	    return ER_FAILED;
+	  }
+      }
+    results.register_time (timer, algo_index, is_temp ? STEP_DECRYPT_TEMP : STEP_DECRYPT_PERM);
+
+    return pages.check_decrypted () ? NO_ERROR : ER_FAILED;
+  }
+
+  /* time en/decryption of log pages */
+  static int
+  test_log_pages (test_common::perf_compare &results, test_common::us_timer &timer, size_t algo_index,
+		  bool is_cold, page_pool &pages)
+  {
+    TDE_ALGORITHM tde_algo = algorithms[algo_index];
+    size_t i;
+
+    for (i = 0; i < PAGE_POOL_SIZE; i++)
+      {
+	((LOG_PAGE *) pages.plain (i))->hdr.logical_pageid = (LOG_PAGEID) i;
+      }
+    timer.reset ();
+
+    for (i = 0; i < PAGE_COUNT; i++)
+      {
+	make_contexts_cold (is_cold);
+	if (tde_encrypt_log_page ((LOG_PAGE *) pages.plain (i), tde_algo, (LOG_PAGE *) pages.cipher (i)) != NO_ERROR)
+	  {
+	    return ER_FAILED;
+	  }
+      }
+    results.register_time (timer, algo_index, STEP_ENCRYPT_LOG);
+
+    for (i = 0; i < PAGE_COUNT; i++)
+      {
+	make_contexts_cold (is_cold);
+	if (tde_decrypt_log_page ((LOG_PAGE *) pages.cipher (i), tde_algo, (LOG_PAGE *) pages.decrypted (i))
+	    != NO_ERROR)
+	  {
+	    return ER_FAILED;
+	  }
+      }
+    results.register_time (timer, algo_index, STEP_DECRYPT_LOG);
+
+    return pages.check_decrypted () ? NO_ERROR : ER_FAILED;
+  }
+
+  /* run all steps for an algorithm, it is run by each thread */
+  static void
+  test_page_cipher (test_common::perf_compare &results, size_t algo_index, bool is_cold, int &error)
+  {
+    page_pool data_pages (IO_PAGESIZE);
+    page_pool temp_pages (IO_PAGESIZE);
+    page_pool log_pages (LOG_PAGESIZE);
+    test_common::us_timer timer;
+
+    error = test_data_pages (results, timer, algo_index, is_cold, false, data_pages);
+    if (error != NO_ERROR)
+      {
+	return;
+      }
+    error = test_data_pages (results, timer, algo_index, is_cold, true, temp_pages);
+    if (error != NO_ERROR)
+      {
+	return;
+      }
+    error = test_log_pages (results, timer, algo_index, is_cold, log_pages);
+  }
+
+  /* run test_page_cipher with thread_count threads */
+  static int
+  run_parallel (test_common::perf_compare &results, size_t algo_index, bool is_cold, unsigned int thread_count)
+  {
+    std::vector<std::thread> workers;
+    std::vector<int> errors (thread_count, NO_ERROR);
+    unsigned int i;
+
+    for (i = 0; i < thread_count; i++)
+      {
+	workers.emplace_back (test_page_cipher, std::ref (results), algo_index, is_cold, std::ref (errors[i]));
+      }
+    for (i = 0; i < thread_count; i++)
+      {
+	workers[i].join ();
+      }
+    for (i = 0; i < thread_count; i++)
+      {
+	if (errors[i] != NO_ERROR)
+	  {
+	    return errors[i];
+	  }
+      }
+    return NO_ERROR;
+  }
+
+  /* print pages/s and GB/s of all threads. The threads run concurrently, so the elapsed time is about the time
+   * registered for all threads divided by the number of threads */
+  static void
+  print_throughput (test_common::perf_compare &results, unsigned int thread_count)
+  {
+    std::ostringstream out;
+
+    out << "    Throughput (pages/s, GB/s):" << std::endl;
+    for (size_t step = 0; step < STEP_COUNT; step++)
+      {
+	size_t page_size = (step == STEP_ENCRYPT_LOG || step == STEP_DECRYPT_LOG) ? LOG_PAGESIZE : IO_PAGESIZE;
+	double pages = (double) PAGE_COUNT * thread_count;
+
+	out << "    " << std::left << std::setw (20) << step_names.get_name (step) << ": ";
+	for (size_t algo_index = 0; algo_index < algorithm_names.get_count (); algo_index++)
+	  {
+	    double usec = (double) results.get_time (algo_index, step) / thread_count;
+	    if (usec <= 0)
+	      {
+		usec = 1;
+	      }
+	    out << std::right << std::setw (12) << std::fixed << std::setprecision (0) << pages * 1000000 / usec;
+	    out << std::setw (8) << std::setprecision (2) << pages * page_size / usec / 1000;
+	  }
+	out << std::endl;
+      }
+    out << std::endl;
+
+    test_common::sync_cout (out.str ());
+  }
+
+  /************************************************************************/
+  /* test                                                                 */
+  /************************************************************************/
+
+  int
+  test_tde_page_performance (void)
+  {
+    unsigned int max_threads = std::thread::hardware_concurrency ();
+    unsigned int thread_counts[2] = { 1, max_threads != 0 ? max_threads : 4 };
+    int error = NO_ERROR;
+
+    std::cout << "test_tde_page_performance" << std::endl;
+
+    load_test_cipher ();
+
+    for (PGLENGTH page_size : page_sizes)
+      {
+	if (db_set_page_size (page_size, page_size) != NO_ERROR)
+	  {
+	    return ER_FAILED;
+	  }
+
+	for (bool is_cold : { false, true })
+	  {
+	    for (unsigned int thread_count : thread_counts)
+	      {
+		test_common::perf_compare results (algorithm_names, step_names);
+
+		std::cout << std::endl << "    page size: " << page_size << ", "
+			  << (is_cold ? "cold" : "warm") << " contexts, " << thread_count << " thread(s), "
+			  << PAGE_COUNT << " pages per thread" << std::endl << std::endl;
+
+		for (size_t algo_index = 0; algo_index < algorithm_names.get_count (); algo_index++)
+		  {
+		    error = run_parallel (results, algo_index, is_cold, thread_count);
+		    if (error != NO_ERROR)
+		      {
+			std::cout << "    " << algorithm_names.get_name (algo_index)
+				  << ": en/decryption failed or the decrypted pages differ" << std::endl;
+			return error;
+		      }
+		  }
+
+		results.print_results (std::cout);
+		print_throughput (results, thread_count);
+	      }
+	  }
+      }
+
+    return NO_ERROR;
+  }
+
+}  // namespace test_tde
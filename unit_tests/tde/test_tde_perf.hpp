@@ -0,0 +1,33 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+
+/*
+ * test_tde_perf.hpp - benchmark of TDE page encryption and decryption
+ */
+
+#ifndef _TEST_TDE_PERF_HPP_
+#define _TEST_TDE_PERF_HPP_
+
+namespace test_tde
+{
+
+  int test_tde_page_performance (void);
+
+}  // namespace test_tde
+
+#endif // !_TEST_TDE_PERF_HPP_
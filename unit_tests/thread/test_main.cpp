@@ -18,12 +18,14 @@
 
 #include "test_worker_pool.hpp"
 #include "test_manager.hpp"
+#include "test_timer_wheel.hpp"
 
 int
 main (int, char **)
 {
   (void) test_thread::test_worker_pool ();
   (void) test_thread::test_manager ();
+  (void) test_thread::test_timer_wheel ();
 
   return 0;
 }
@@ -0,0 +1,116 @@
+/*
+ * Copyright 2008 Search Solution Corporation
+ * Copyright 2016 CUBRID Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ */
+/*
+ * test_timer_wheel.cpp - implementation for timer wheel tests
+ */
+
+#include "test_timer_wheel.hpp"
+
+#include "test_output.hpp"
+
+#include "thread_timer_wheel.hpp"
+#include "thread_waiter.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+namespace test_thread
+{
+  using clock_type = std::chrono::system_clock;
+
+  static int
+  test_timeouts (void)
+  {
+    cubthread::timer_wheel wheel (std::chrono::milliseconds (2));
+    const std::size_t SLEEPER_COUNT = 8;
+    std::thread sleepers[SLEEPER_COUNT];
+    bool failed[SLEEPER_COUNT] = { false };
+
+    // sleepers wake up from the wheel, never before their deadline; the last ones are cascaded from upper levels
+    for (std::size_t i = 0; i < SLEEPER_COUNT; i++)
+      {
+	sleepers[i] = std::thread ([&wheel, &failed, i]
+	{
+	  cubthread::waiter sleeper;
+	  cubthread::wheel_timer timer;
+	  auto period = std::chrono::milliseconds (1 + i * i * 10);
+	  auto deadline = clock_type::now () + period;
+
+	  bool woken_up = sleeper.wait_on_timer (wheel, timer, deadline);
+	  failed[i] = woken_up || clock_type::now () < deadline;
+	});
+      }
+    for (std::size_t i = 0; i < SLEEPER_COUNT; i++)
+      {
+	sleepers[i].join ();
+	if (failed[i])
+	  {
+	    test_common::sync_cout ("  timer of sleeper did not fire on time\n");
+	    return 1;
+	  }
+      }
+    return 0;
+  }
+
+  static int
+  test_wakeup (void)
+  {
+    cubthread::timer_wheel wheel (std::chrono::milliseconds (2));
+    cubthread::waiter sleeper;
+    cubthread::wheel_timer timer;
+    std::atomic<bool> is_done (false);
+    bool woken_up = false;
+
+    // woken up long before timeout; its timer is cancelled
+    std::thread sleeper_thread ([&]
+    {
+      woken_up = sleeper.wait_on_timer (wheel, timer, clock_type::now () + std::chrono::seconds (60));
+      is_done = true;
+    });
+
+    while (!is_done)
+      {
+	// wake-ups before the thread sleeps are lost; keep waking it up
+	std::this_thread::sleep_for (std::chrono::milliseconds (5));
+	sleeper.wakeup ();
+      }
+    sleeper_thread.join ();
+
+    if (!woken_up)
+      {
+	test_common::sync_cout ("  sleeper was not woken up\n");
+	return 1;
+      }
+    return 0;
+  }
+
+  int
+  test_timer_wheel (void)
+  {
+    if (test_timeouts () != 0 || test_wakeup () != 0)
+      {
+	std::cout << "  test_timer_wheel failed" << std::endl;
+	return 1;
+      }
+
+    std::cout << "  test_timer_wheel successful" << std::endl;
+    return 0;
+  }
+
+} // namespace test_thread
@@ -158,12 +158,57 @@ namespace test_thread
     return 0;
   }
 
+  class flag_task : public cubthread::task<test_context>
+  {
+    public:
+      flag_task (std::atomic<bool> &flag)
+	: m_flag (flag)
+      {
+      }
+
+      void execute (context_type &context)
+      {
+	(void) context;  // suppress unused parameter
+	m_flag = true;
+      }
+
+    private:
+      std::atomic<bool> &m_flag;
+  };
+
+  int
+  test_work_stealing (void)
+  {
+    test_context_manager ctx_mgr;
+    std::atomic<bool> is_executed = { false };
+
+    // two cores of one worker; the worker of second core must take the task queued behind the long task of first
+    test_worker_pool_type pool (2, 16, ctx_mgr, NULL, 2, false);
+    pool.set_work_stealing (true);
+
+    pool.execute_on_core (new start_end_task (), 0);
+    pool.execute_on_core (new flag_task (is_executed), 0);
+
+    std::this_thread::sleep_for (std::chrono::milliseconds (300));
+    if (!is_executed)
+      {
+	test_common::sync_cout ("work stealing failed: queued task was not executed by sibling core\n");
+	pool.stop_execution ();
+	return -1;
+      }
+    test_common::sync_cout ("work stealing succeeded\n");
+
+    pool.stop_execution ();
+    return 0;
+  }
+
   int
   test_worker_pool (void)
   {
     test_one_thread_pool ();
     test_two_threads_pool ();
     test_stress ();
+    test_work_stealing ();
     return 0;
   }
 